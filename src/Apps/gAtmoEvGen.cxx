@@ -22,6 +22,7 @@
                        [-o output_event_file_prefix]
                        [--flux-ray-generation-surface-distance ]
                        [--flux-ray-generation-surface-radius   ]
+                       [--prem-depth depth]
                        [--seed random_number_seed]
                        [--cross-sections xml_file]
                        [--event-generator-list list_name]
@@ -31,6 +32,9 @@
                        [--event-record-print-level level]
                        [--mc-job-status-refresh-rate  rate]
                        [--cache-file root_file]
+                       [--checkpoint file]
+                       [--checkpoint-interval nev]
+                       [--restart]
 
          *** Options :
 
@@ -146,6 +150,14 @@
               The argument --flux-ray-generation-surface-distance sets Rl, while              
               the argument --flux-ray-generation-surface-distance sets Rt.
               SI units are used.
+           --prem-depth
+              Only used with a target mix (-g): generate events in the whole
+              Earth, with the PREM density profile and the target mix as the
+              composition, for a detector at the given depth (m) below the
+              surface. The Earth crossed by each flux ray (in the
+              topocentric horizontal frame, rotated by -R) is traced
+              analytically, so set a flux ray generation surface distance
+              covering the rock of interest.
            -o
               Sets the prefix of the output event file.
               The output filename is built as:
@@ -178,6 +190,17 @@
            --cache-file
               Allows users to specify a cache file so that the cache can be
               re-used in subsequent MC jobs.
+           --checkpoint
+              Periodically saves a checkpoint (random number generator state,
+              flux driver position & exposure counters, number of events
+              written out) in the specified ROOT file, so that a job killed
+              partway through can be restarted (see --restart).
+           --checkpoint-interval
+              Number of generated events between checkpoints [default: 1000].
+           --restart
+              Resumes the job from the file given via --checkpoint, appending
+              events to the existing output event file. All other options must
+              be identical to those of the original job.
 
          *** Examples:
 
@@ -237,6 +260,7 @@
 #include <TRotation.h>
 
 #include "Framework/Conventions/Units.h"
+#include "Framework/EventGen/EVGThreadStats.h"
 #include "Framework/EventGen/EventRecord.h"
 #include "Framework/EventGen/GFluxI.h"
 #include "Framework/EventGen/GMCJDriver.h"
@@ -266,6 +290,7 @@
 #include "Tools/Geometry/GeoUtils.h"
 #include "Tools/Geometry/ROOTGeomAnalyzer.h"
 #include "Tools/Geometry/PointGeomAnalyzer.h"
+#include "Tools/Geometry/PREMGeomAnalyzer.h"
 #endif
 
 using std::string;
@@ -303,6 +328,7 @@ long int        gOptRanSeed;                   // random number seed
 string          gOptInpXSecFile;               // cross-section splines
 double          gOptRL;                        // distance of flux ray generation surface (m)
 double          gOptRT;                        // radius of flux ray generation surface (m)
+double          gOptPREMDepth = -1;            // detector depth (m) in a PREM Earth built from the target mix (if >= 0)
 
 // Defaults:
 //
@@ -329,7 +355,7 @@ int main(int argc, char** argv)
   utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
   utils::app_init::CacheFile(RunOpt::Instance()->CacheFile());
   utils::app_init::RandGen(gOptRanSeed);
-  utils::app_init::XSecTable(gOptInpXSecFile, true);
+  utils::app_init::XSecTable(gOptInpXSecFile, true, true);
 
   // get flux driver
   GFluxI * flux_driver = GetFlux();
@@ -349,7 +375,21 @@ int main(int argc, char** argv)
   // initialize an ntuple writer
   NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
   ntpw.CustomizeFilenamePrefix(gOptEvFilePrefix);
-  ntpw.Initialize();
+
+  // Start from scratch, or resume a checkpointed job
+  string ckpt_file = RunOpt::Instance()->CheckpointFile();
+  int    ckpt_nev  = RunOpt::Instance()->CheckpointInterval();
+  Long64_t iev0 = 0;
+  if ( ! ckpt_file.empty() && RunOpt::Instance()->Restart() ) {
+    if ( ! mcj_driver->RestoreCheckpoint(ckpt_file, iev0) ||
+         ! ntpw.Resume(iev0) ) {
+      LOG("gevgen_atmo", pFATAL)
+        << "Couldn't restart job from checkpoint: " << ckpt_file;
+      exit(1);
+    }
+  } else {
+    ntpw.Initialize();
+  }
 
   // Create a MC job monitor for a periodically updated status file
   GMCJMonitor mcjmonitor(gOptRunNu);
@@ -359,7 +399,7 @@ int main(int argc, char** argv)
   GHepRecord::SetPrintLevel(RunOpt::Instance()->EventRecordPrintLevel());
 
   // event loop
-  for(int iev = 0; iev < gOptNev; iev++) {
+  for(int iev = iev0; iev < gOptNev; iev++) {
 
     // generate next event
     EventRecord* event = mcj_driver->GenerateEvent();
@@ -376,11 +416,22 @@ int main(int argc, char** argv)
 
     // clean-up
     delete event;
+
+    // checkpoint, if requested
+    if ( ! ckpt_file.empty() && (iev+1) % ckpt_nev == 0 ) {
+      ntpw.Checkpoint();
+      mcj_driver->SaveCheckpoint(ckpt_file, iev+1);
+    }
   }
 
   // save the event file
   ntpw.Save();
 
+  // Save per-module event generation statistics, if requested
+  if ( ! RunOpt::Instance()->EVGStatsFile().empty() ) {
+    EVGThreadStats::Instance()->Save(RunOpt::Instance()->EVGStatsFile());
+  }
+
   // clean-up
   delete geom_driver;
   delete flux_driver;
@@ -429,6 +480,19 @@ GeomAnalyzerI* GetGeometry(void)
     // casting to the GENIE geometry driver interface
     geom_driver = dynamic_cast<GeomAnalyzerI *> (rgeom);
   }
+  else if(gOptPREMDepth >= 0) {
+    //
+    // *** Using the PREM Earth with the specified target mix
+    //
+
+    geometry::PREMGeomAnalyzer * egeom =
+              new geometry::PREMGeomAnalyzer(gOptTgtMix);
+    egeom->SetDetectorDepth(gOptPREMDepth);
+    // the flux rays are in the user-defined topocentric system
+    egeom->SetEarthCentre(gOptRot * egeom->EarthCentre());
+    // casting to the GENIE geometry driver interface
+    geom_driver = dynamic_cast<GeomAnalyzerI *> (egeom);
+  }
   else {
     //
     // *** Using a 'point' geometry with the specified target mix
@@ -719,6 +783,11 @@ void GetCommandLineArgs(int argc, char ** argv)
       << "Unspecified radius of flux ray generation surface - Using default";
   }
 
+  if( parser.OptionExists("prem-depth") ) {
+    LOG("gevgen_atmo", pINFO) << "Reading detector depth in the PREM Earth";
+    gOptPREMDepth = parser.ArgAsDouble("prem-depth");
+  }
+
   //
   // *** geometry
   //
@@ -919,6 +988,10 @@ void GetCommandLineArgs(int argc, char ** argv)
            << ", length  units: " << lunits
            << ", density units: " << dunits;
   } else {
+    if(gOptPREMDepth >= 0) {
+      gminfo << "Using the PREM Earth - detector depth: "
+             << gOptPREMDepth << " m, composition: ";
+    }
     gminfo << "Using target mix - ";
     map<int,double>::const_iterator iter;
     for(iter = gOptTgtMix.begin(); iter != gOptTgtMix.end(); ++iter) {
@@ -1009,6 +1082,7 @@ void PrintSyntax(void)
    << "\n           [-o output_event_file_prefix]"
    << "\n           [--flux-ray-generation-surface-distance]"               
    << "\n           [--flux-ray-generation-surface-radius]"
+   << "\n           [--prem-depth depth]"
    << "\n           [--seed random_number_seed]"
    << "\n            --cross-sections xml_file"
    << "\n           [--event-generator-list list_name]"
@@ -1017,6 +1091,9 @@ void PrintSyntax(void)
    << "\n           [--event-record-print-level level]"
    << "\n           [--mc-job-status-refresh-rate  rate]"
    << "\n           [--cache-file root_file]"
+   << "\n           [--checkpoint file]"
+   << "\n           [--checkpoint-interval nev]"
+   << "\n           [--restart]"
    << "\n"
    << " Please also read the detailed documentation at http://www.genie-mc.org"
    << "\n";
@@ -0,0 +1,130 @@
+//____________________________________________________________________________
+/*!
+
+\program gconfsnap
+
+\brief   Saves the fully resolved GENIE algorithm configuration pool (for a
+         given tune and XML search path) in a binary snapshot, so that
+         short jobs can skip parsing the XML configuration files.
+
+         Syntax :
+           gconfsnap -o output_snapshot_file
+                     [--tune genie_tune]
+                     [--xml-path config_xml_dir]
+                     [--message-thresholds xml_file]
+
+         Options :
+           -o
+              Name of the output snapshot file.
+           --tune
+              Specifies a GENIE comprehensive neutrino interaction model tune.
+              [default: "Default"].
+           --xml-path
+              A directory to load XML files from - overrides $GXMLPATH, and
+              $GENIE/config
+           --message-thresholds
+              Allows users to customize the message stream thresholds.
+              The thresholds are specified using an XML file.
+              See $GENIE/config/Messenger.xml for the XML schema.
+
+         Notes :
+           The snapshot is used by any GENIE app given the same tune and XML
+           search path, via its --config-snapshot option or the GCONFSNAPSHOT
+           env. var. It is ignored (and the XML files are parsed as usual) if
+           any of the XML files it was built from has changed since.
+
+         Example :
+
+           shell% gconfsnap --tune G18_02a_00_000 -o G18_02a_00_000.gcfg
+           shell% gevgen_hadron ... --tune G18_02a_00_000 \
+                                    --config-snapshot G18_02a_00_000.gcfg
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <string>
+
+#include "Framework/Algorithm/AlgConfigPool.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+
+using std::string;
+
+using namespace genie;
+
+void GetCommandLineArgs (int argc, char ** argv);
+void PrintSyntax        (void);
+
+//User-specified options:
+string gOptOutFile; ///< output snapshot file
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc,argv);
+
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+
+  if ( ! RunOpt::Instance()->Tune() ) {
+    LOG("gconfsnap", pFATAL) << " No TuneId in RunOption";
+    exit(-1);
+  }
+  RunOpt::Instance()->BuildTune();
+
+  AlgConfigPool * pool = AlgConfigPool::Instance();
+
+  // common parameter lists are otherwise only loaded on demand
+  if( ! pool->LoadAllCommonLists() ) {
+    LOG("gconfsnap", pWARN) << "Not all common parameter lists were loaded";
+  }
+
+  if( ! pool->SaveSnapshot(gOptOutFile) ) {
+    LOG("gconfsnap", pFATAL) << "Couldn't save snapshot: " << gOptOutFile;
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  return 0;
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("gconfsnap", pNOTICE) << "Parsing command line arguments";
+
+  // Common run options.
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  // Parse run options for this app
+
+  CmdLnArgParser parser(argc,argv);
+
+  if( parser.OptionExists('o') ) {
+    LOG("gconfsnap", pINFO) << "Reading output file name";
+    gOptOutFile = parser.ArgAsString('o');
+  } else {
+    LOG("gconfsnap", pFATAL) << "You must specify an output file name";
+    PrintSyntax();
+    exit(1);
+  }
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("gconfsnap", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "   gconfsnap -o output_snapshot_file"
+    << " [--tune genie_tune]"
+    << " [--xml-path config_xml_dir]"
+    << " [--message-thresholds xml_file]\n\n";
+}
+//____________________________________________________________________________
@@ -16,6 +16,9 @@
            -f Specifies the GENIE/ROOT file with the generated event sample
 	   -r Specifies another GENIE/ROOT event sample file for comparison 
            -n Specifies how many events to analyze [default: all]
+           --thread-pool-size
+              Number of threads filling the plots (default: $GTHREADPOOLSIZE
+              or 1). All plots are filled in a single pass over each sample.
 
          Notes:
            The input ROOT files are the gst summary ntuples generated by 
@@ -38,6 +41,7 @@
 #include <cassert>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include <TSystem.h>
 #include <TFile.h>
@@ -60,10 +64,13 @@
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/GSimFilesAnalyzer.h"
+#include "Framework/Utils/RunOpt.h"
 #include "Framework/Utils/Style.h"
 
 using std::ostringstream;
 using std::string;
+using std::vector;
 
 using namespace genie;
 
@@ -73,10 +80,18 @@ void   PrintSyntax          (void);
 bool   CheckRootFilename    (string filename);
 string OutputFileName       (string input_file_name);
 void   CreatePlots          (string filename, string filename_ref);
+void   DrawPages            (TPostScript * ps);
+void   NewPage              (TPostScript * ps);
+void   DrawPlot             (int isample, string varexp, string selection, string option);
+double CountEvents          (int isample, string selection);
 
 // command-line arguments
 string   gOptInpFile     = ""; // (-f) input GENIE event sample file
 string   gOptInpFileRef  = ""; // (-r) input GENIE event sample file (reference)
+Long64_t gOptNEvents     = -1; // (-n) number of events to analyze
+
+GSimFilesAnalyzer * gSamples = 0;     // fills the plots of all samples in one pass
+bool                gBooking = false; // booking (rather than drawing) the plots?
 
 //_________________________________________________________________________________
 int main(int argc, char ** argv)
@@ -91,35 +106,16 @@ int main(int argc, char ** argv)
 //_________________________________________________________________________________
 void CreatePlots(string inp_filename, string inp_filename_ref)
 {
-  TFile * fin_0 = 0;
-  TFile * fin_1 = 0;
-  TTree * gst_0 = 0;
-  TTree * gst_1 = 0;
-
   if(!CheckRootFilename(inp_filename)) {
     LOG("gevcomp", pERROR) << "Input file: " << inp_filename << " doesn't exist";
     return;
   }
-  fin_0 = new TFile(inp_filename.c_str(),"READ");
-  gst_0 = (TTree *) fin_0->Get("gst");
-  assert(gst_0);
-  
+  gSamples = new GSimFilesAnalyzer;
+  gSamples->AddModel("test", vector<string>(1, inp_filename), "gst");
   if(CheckRootFilename(inp_filename_ref)) {
-     fin_1 = new TFile(inp_filename_ref.c_str(),"READ");
-     gst_1 = (TTree *) fin_1->Get("gst");
-     assert(gst_1);
+    gSamples->AddModel("reference", vector<string>(1, inp_filename_ref), "gst");
   }
-  
-  gst_0->SetLineColor(kBlack);
-  gst_0->SetLineWidth(3);
-  if(gst_1) {
-    gst_1->SetLineColor(kRed);
-    gst_1->SetMarkerColor(kRed);
-    gst_1->SetLineWidth(2);
-    gst_1->SetMarkerStyle(20);
-    gst_1->SetMarkerSize(1);
-  }
-  
+
   // Set global plot style
   //
   gStyle->SetOptTitle(0);
@@ -127,6 +123,29 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
   gStyle->SetHistTopMargin(0.33);
   gStyle->SetHistMinimumZero(true);
   
+  // Book all plots, fill them in a single (multi-threaded) pass over each
+  // event sample, and draw them
+  gBooking = true;
+  DrawPages(0);
+  gBooking = false;
+
+  gSamples->Process(gOptNEvents);
+
+  string ps_filename = OutputFileName(inp_filename);
+  TPostScript * ps = new TPostScript(ps_filename.c_str(), 111);
+  DrawPages(ps);
+  ps->Close();
+  delete ps;
+
+  delete gSamples;
+  gSamples = 0;
+}
+//_________________________________________________________________________________
+void DrawPages(TPostScript * ps)
+{
+// Draws all pages of plots; when booking (gBooking is set) it only books the
+// plots with the sample analyzer
+
   // Plotting options
   //
   bool monoenergetic_sample = true;
@@ -135,8 +154,7 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
   bool show_mult_per_proc   = true;
   bool show_primary_hadsyst = true;
   
-  gst_0->Draw("1","tgt>1000010010","GOFF");
-  show_coh_plots = (gst_0->GetSelectedRows() > 0); 
+  show_coh_plots = gBooking || (CountEvents(0,"tgt>1000010010") > 0);
 
   TCanvas * c = new TCanvas("c","",20,20,500,650);
   c->SetBorderMode(0);
@@ -148,14 +166,11 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
   ls->SetFillColor(0);
   ls->SetBorderSize(0);
 
-  string ps_filename = OutputFileName(inp_filename);
-  TPostScript * ps = new TPostScript(ps_filename.c_str(), 111);
-  
   //
   // SECTION: PS File Header
   //
 
-  ps->NewPage();
+  NewPage(ps);
   c->Range(0,0,100,100);
   TPavesText hdr(10,40,90,70,3,"tr");
   hdr.AddText("GENIE Event Sample Comparisons");
@@ -174,123 +189,87 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
   // SECTION: Event Numbers
   //
 
-  TH1F * h0num = new TH1F("h0num","", 2, 0., 2.);
-  TH1F * h1num = new TH1F("h1num","", 2, 0., 2.);
   float n0=0, n1=0;
-  ps->NewPage();
+  NewPage(ps);
   c->Range(0,0,100,100);
   TPavesText evn(10,10,90,90,3,"tr");
   evn.AddText("Event Numbers:");
   evn.AddText("  ");
  
-            gst_0->Draw("1>>h0num","1","goff");
-  if(gst_1) gst_1->Draw("1>>h1num","1","goff");
-  n0 =           h0num->GetEntries();
-  n1 = (gst_1) ? h1num->GetEntries() : 0;
+  n0 = CountEvents(0,"1");
+  n1 = CountEvents(1,"1");
   evn.AddText( Form("ALL    : %7.0f [test sample], %7.0f [ref sample]", n0, n1) );
 
-            gst_0->Draw("1>>h0num","qel","goff");
-  if(gst_1) gst_1->Draw("1>>h1num","qel","goff");
-  n0 =           h0num->GetEntries();
-  n1 = (gst_1) ? h1num->GetEntries() : 0;
+  n0 = CountEvents(0,"qel");
+  n1 = CountEvents(1,"qel");
   evn.AddText( Form("QEL    : %7.0f [test sample], %7.0f [ref sample]", n0, n1) );
 
-            gst_0->Draw("1>>h0num","qel&&cc","goff");
-  if(gst_1) gst_1->Draw("1>>h1num","qel&&cc","goff");
-  n0 =           h0num->GetEntries();
-  n1 = (gst_1) ? h1num->GetEntries() : 0;
+  n0 = CountEvents(0,"qel&&cc");
+  n1 = CountEvents(1,"qel&&cc");
   evn.AddText( Form("QEL-CC : %7.0f [test sample], %7.0f [ref sample]", n0, n1) );
 
-            gst_0->Draw("1>>h0num","qel&&nc","goff");
-  if(gst_1) gst_1->Draw("1>>h1num","qel&&nc","goff");
-  n0 =           h0num->GetEntries();
-  n1 = (gst_1) ? h1num->GetEntries() : 0;
+  n0 = CountEvents(0,"qel&&nc");
+  n1 = CountEvents(1,"qel&&nc");
   evn.AddText( Form("QEL-NC : %7.0f [test sample], %7.0f [ref sample]", n0, n1) );
 
-            gst_0->Draw("1>>h0num","res","goff");
-  if(gst_1) gst_1->Draw("1>>h1num","res","goff");
-  n0 =           h0num->GetEntries();
-  n1 = (gst_1) ? h1num->GetEntries() : 0;
+  n0 = CountEvents(0,"res");
+  n1 = CountEvents(1,"res");
   evn.AddText( Form("RES    : %7.0f [test sample], %7.0f [ref sample]", n0, n1) );
 
-            gst_0->Draw("1>>h0num","res&&cc","goff");
-  if(gst_1) gst_1->Draw("1>>h1num","res&&cc","goff");
-  n0 =           h0num->GetEntries();
-  n1 = (gst_1) ? h1num->GetEntries() : 0;
+  n0 = CountEvents(0,"res&&cc");
+  n1 = CountEvents(1,"res&&cc");
   evn.AddText( Form("RES-CC : %7.0f [test sample], %7.0f [ref sample]", n0, n1) );
 
-            gst_0->Draw("1>>h0num","res&&nc","goff");
-  if(gst_1) gst_1->Draw("1>>h1num","res&&nc","goff");
-  n0 =           h0num->GetEntries();
-  n1 = (gst_1) ? h1num->GetEntries() : 0;
+  n0 = CountEvents(0,"res&&nc");
+  n1 = CountEvents(1,"res&&nc");
   evn.AddText( Form("RES-NC : %7.0f [test sample], %7.0f [ref sample]", n0, n1) );
 
-            gst_0->Draw("1>>h0num","dis","goff");
-  if(gst_1) gst_1->Draw("1>>h1num","dis","goff");
-  n0 =           h0num->GetEntries();
-  n1 = (gst_1) ? h1num->GetEntries() : 0;
+  n0 = CountEvents(0,"dis");
+  n1 = CountEvents(1,"dis");
   evn.AddText( Form("DIS    : %7.0f [test sample], %7.0f [ref sample]", n0, n1) );
 
-            gst_0->Draw("1>>h0num","dis&&cc","goff");
-  if(gst_1) gst_1->Draw("1>>h1num","dis&&cc","goff");
-  n0 =           h0num->GetEntries();
-  n1 = (gst_1) ? h1num->GetEntries() : 0;
+  n0 = CountEvents(0,"dis&&cc");
+  n1 = CountEvents(1,"dis&&cc");
   evn.AddText( Form("DIS-CC : %7.0f [test sample], %7.0f [ref sample]", n0, n1) );
 
-            gst_0->Draw("1>>h0num","dis&&nc","goff");
-  if(gst_1) gst_1->Draw("1>>h1num","dis&&nc","goff");
-  n0 =           h0num->GetEntries();
-  n1 = (gst_1) ? h1num->GetEntries() : 0;
+  n0 = CountEvents(0,"dis&&nc");
+  n1 = CountEvents(1,"dis&&nc");
   evn.AddText( Form("DIS-NC : %7.0f [test sample], %7.0f [ref sample]", n0, n1) );
 
-            gst_0->Draw("1>>h0num","coh","goff");
-  if(gst_1) gst_1->Draw("1>>h1num","coh","goff");
-  n0 =           h0num->GetEntries();
-  n1 = (gst_1) ? h1num->GetEntries() : 0;
+  n0 = CountEvents(0,"coh");
+  n1 = CountEvents(1,"coh");
   evn.AddText( Form("COH      : %7.0f [test sample], %7.0f [ref sample]", n0, n1) );
 
-            gst_0->Draw("1>>h0num","coh&&cc","goff");
-  if(gst_1) gst_1->Draw("1>>h1num","coh&&cc","goff");
-  n0 =           h0num->GetEntries();
-  n1 = (gst_1) ? h1num->GetEntries() : 0;
+  n0 = CountEvents(0,"coh&&cc");
+  n1 = CountEvents(1,"coh&&cc");
   evn.AddText( Form("COH-CC   : %7.0f [test sample], %7.0f [ref sample]", n0, n1) );
 
-            gst_0->Draw("1>>h0num","coh&&nc","goff");
-  if(gst_1) gst_1->Draw("1>>h1num","coh&&nc","goff");
-  n0 =           h0num->GetEntries();
-  n1 = (gst_1) ? h1num->GetEntries() : 0;
+  n0 = CountEvents(0,"coh&&nc");
+  n1 = CountEvents(1,"coh&&nc");
   evn.AddText( Form("COH-NC   : %7.0f [test sample], %7.0f [ref sample]", n0, n1) );
 
-            gst_0->Draw("1>>h0num","imd","goff");
-  if(gst_1) gst_1->Draw("1>>h1num","imd","goff");
-  n0 =           h0num->GetEntries();
-  n1 = (gst_1) ? h1num->GetEntries() : 0;
+  n0 = CountEvents(0,"imd");
+  n1 = CountEvents(1,"imd");
   evn.AddText( Form("IMD    : %7.0f [test sample], %7.0f [ref sample]", n0, n1) );
 
-            gst_0->Draw("1>>h0num","nuel","goff");
-  if(gst_1) gst_1->Draw("1>>h1num","nuel","goff");
-  n0 =           h0num->GetEntries();
-  n1 = (gst_1) ? h1num->GetEntries() : 0;
+  n0 = CountEvents(0,"nuel");
+  n1 = CountEvents(1,"nuel");
   evn.AddText( Form("NuE-EL : %7.0f [test sample], %7.0f [ref sample]", n0, n1) );
 
-            gst_0->Draw("1>>h0num","dis&&cc&&charm","goff");
-  if(gst_1) gst_1->Draw("1>>h1num","dis&&cc&&charm","goff");
-  n0 =           h0num->GetEntries();
-  n1 = (gst_1) ? h1num->GetEntries() : 0;
+  n0 = CountEvents(0,"dis&&cc&&charm");
+  n1 = CountEvents(1,"dis&&cc&&charm");
   evn.AddText( Form("DIS-CHARM: %7.0f [test sample], %7.0f [ref sample]", n0, n1) );
 
-            gst_0->Draw("1>>h0num","qel&&cc&&charm","goff");
-  if(gst_1) gst_1->Draw("1>>h1num","qel&&cc&&charm","goff");
-  n0 =           h0num->GetEntries();
-  n1 = (gst_1) ? h1num->GetEntries() : 0;
+  n0 = CountEvents(0,"qel&&cc&&charm");
+  n1 = CountEvents(1,"qel&&cc&&charm");
   evn.AddText( Form("QEL-CHARM: %7.0f [test sample], %7.0f [ref sample]", n0, n1) );
 
   evn.Draw();
   c->Update();
 
   if(!monoenergetic_sample) {
-              gst_0->Draw("Ev","","");
-    if(gst_1) gst_1->Draw("Ev","","perrsame");
+              DrawPlot(0,"Ev","","");
+    DrawPlot(1,"Ev","","perrsame");
     ls->Clear();
     ls->SetHeader("Neutrino Energy Spectrum");
     ls->Draw();
@@ -300,7 +279,7 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
   //
   // SECTION: Kinematics
   //
-  ps->NewPage();
+  NewPage(ps);
   c->Clear();
   c->Range(0,0,100,100);
   TPavesText hdrk(10,40,90,70,3,"tr");
@@ -310,99 +289,99 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
   c->Update();
 
   //------ selected Q2 for all events
-  ps->NewPage();
-  gst_0->Draw("Q2s","Q2s>0","");
-  if(gst_1) gst_1->Draw("Q2s","Q2s>0","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"Q2s","Q2s>0","");
+  DrawPlot(1,"Q2s","Q2s>0","perrsame");
   ls->Clear();
   ls->SetHeader("selected Q2 for all events");
   ls->Draw();
   c->Update();
 
   //------ selected Q2 for QEL
-  ps->NewPage();
-  gst_0->Draw("Q2s","qel&&!charm","");
-  if(gst_1) gst_1->Draw("Q2s","qel&&!charm","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"Q2s","qel&&!charm","");
+  DrawPlot(1,"Q2s","qel&&!charm","perrsame");
   ls->Clear();
   ls->SetHeader("selected Q2 for QEL events");
   ls->Draw();
   c->Update();
 
   //------ selected Q2 for QEL CC
-  ps->NewPage();
-  gst_0->Draw("Q2s","qel&&cc&&!charm","");
-  if(gst_1) gst_1->Draw("Q2s","qel&&cc&&!charm","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"Q2s","qel&&cc&&!charm","");
+  DrawPlot(1,"Q2s","qel&&cc&&!charm","perrsame");
   ls->Clear();
   ls->SetHeader("selected Q2 for QEL CC events");
   ls->Draw();
   c->Update();
 
   //------ selected Q2 for QEL NC
-  ps->NewPage();
-  gst_0->Draw("Q2s","qel&&nc&&!charm","");
-  if(gst_1) gst_1->Draw("Q2s","qel&&nc&&!charm","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"Q2s","qel&&nc&&!charm","");
+  DrawPlot(1,"Q2s","qel&&nc&&!charm","perrsame");
   ls->Clear();
   ls->SetHeader("selected Q2 for QEL NC events");
   ls->Draw();
   c->Update();
 
   //------ selected Q2 for RES
-  ps->NewPage();
-  gst_0->Draw("Q2s","res","");
-  if(gst_1) gst_1->Draw("Q2s","res","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"Q2s","res","");
+  DrawPlot(1,"Q2s","res","perrsame");
   ls->Clear();
   ls->SetHeader("selected Q2 for RES events");
   ls->Draw();
   c->Update();
 
   //------ selected Q2 for RES CC
-  ps->NewPage();
-  gst_0->Draw("Q2s","res&&cc","");
-  if(gst_1) gst_1->Draw("Q2s","res&&cc","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"Q2s","res&&cc","");
+  DrawPlot(1,"Q2s","res&&cc","perrsame");
   ls->Clear();
   ls->SetHeader("selected Q2 for RES CC events");
   ls->Draw();
   c->Update();
 
   //------ selected Q2 for RES NC
-  ps->NewPage();
-  gst_0->Draw("Q2s","res&&nc","");
-  if(gst_1) gst_1->Draw("Q2s","res&&nc","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"Q2s","res&&nc","");
+  DrawPlot(1,"Q2s","res&&nc","perrsame");
   ls->Clear();
   ls->SetHeader("selected Q2 for RES NC events");
   ls->Draw();
   c->Update();
 
   //------ selected Q2 for DIS
-  ps->NewPage();
-  gst_0->Draw("Q2s","dis","");
-  if(gst_1) gst_1->Draw("Q2s","dis","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"Q2s","dis","");
+  DrawPlot(1,"Q2s","dis","perrsame");
   ls->Clear();
   ls->SetHeader("selected Q2 for DIS events");
   ls->Draw();
   c->Update();
 
   //------ selected Q2 for DIS CC
-  ps->NewPage();
-  gst_0->Draw("Q2s","dis&&cc","");
-  if(gst_1) gst_1->Draw("Q2s","dis&&cc","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"Q2s","dis&&cc","");
+  DrawPlot(1,"Q2s","dis&&cc","perrsame");
   ls->Clear();
   ls->SetHeader("selected Q2 for DIS CC events");
   ls->Draw();
   c->Update();
 
   //------ selected Q2 for DIS NC
-  ps->NewPage();
-  gst_0->Draw("Q2s","dis&&nc","");
-  if(gst_1) gst_1->Draw("Q2s","dis&&nc","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"Q2s","dis&&nc","");
+  DrawPlot(1,"Q2s","dis&&nc","perrsame");
   ls->Clear();
   ls->SetHeader("selected Q2 for DIS NC events");
   ls->Draw();
   c->Update();
 
   //------ selected Q2 for Charm/DIS
-  ps->NewPage();
-  gst_0->Draw("Q2s","dis&&charm","");
-  if(gst_1) gst_1->Draw("Q2s","dis&&charm","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"Q2s","dis&&charm","");
+  DrawPlot(1,"Q2s","dis&&charm","perrsame");
   ls->Clear();
   ls->SetHeader("selected Q2 for Charm/DIS events");
   ls->Draw();
@@ -410,27 +389,27 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
 
   if(show_coh_plots) {
      //------ selected Q2 for COH
-     ps->NewPage();
-     gst_0->Draw("Q2s","coh","");
-     if(gst_1) gst_1->Draw("Q2s","coh","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"Q2s","coh","");
+     DrawPlot(1,"Q2s","coh","perrsame");
      ls->Clear();
      ls->SetHeader("selected Q2 for COH events");
      ls->Draw();
      c->Update();
 
      //------ selected Q2 for COH CC
-     ps->NewPage();
-     gst_0->Draw("Q2s","coh&&cc","");
-     if(gst_1) gst_1->Draw("Q2s","coh&&cc","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"Q2s","coh&&cc","");
+     DrawPlot(1,"Q2s","coh&&cc","perrsame");
      ls->Clear();
      ls->SetHeader("selected Q2 for COH CC events");
      ls->Draw();
      c->Update();
 
      //------ selected Q2 for COH NC
-     ps->NewPage();
-     gst_0->Draw("Q2s","coh&&nc","");
-     if(gst_1) gst_1->Draw("Q2s","coh&&nc","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"Q2s","coh&&nc","");
+     DrawPlot(1,"Q2s","coh&&nc","perrsame");
      ls->Clear();
      ls->SetHeader("selected Q2 for COH NC events");
      ls->Draw();
@@ -438,117 +417,117 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
   }
   
   //------ selected W for all events
-  ps->NewPage();
-  gst_0->Draw("Ws","Ws>0","");
-  if(gst_1) gst_1->Draw("Ws","Ws>0","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"Ws","Ws>0","");
+  DrawPlot(1,"Ws","Ws>0","perrsame");
   ls->Clear();
   ls->SetHeader("selected W for all events");
   ls->Draw();
   c->Update();
 
   //------ selected W for QEL
-  ps->NewPage();
-  gst_0->Draw("Ws","qel&&!charm","");
-  if(gst_1) gst_1->Draw("Ws","qel&&!charm","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"Ws","qel&&!charm","");
+  DrawPlot(1,"Ws","qel&&!charm","perrsame");
   ls->Clear();
   ls->SetHeader("selected W for QEL events");
   ls->Draw();
   c->Update();
 
   //------ selected W for RES
-  ps->NewPage();
-  gst_0->Draw("Ws","res","");
-  if(gst_1) gst_1->Draw("Ws","res","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"Ws","res","");
+  DrawPlot(1,"Ws","res","perrsame");
   ls->Clear();
   ls->SetHeader("selected W for RES events");
   ls->Draw();
   c->Update();
 
   //------ selected W for DIS
-  ps->NewPage();
-  gst_0->Draw("Ws","dis","");
-  if(gst_1) gst_1->Draw("Ws","dis","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"Ws","dis","");
+  DrawPlot(1,"Ws","dis","perrsame");
   ls->Clear();
   ls->SetHeader("selected W for DIS events");
   ls->Draw();
   c->Update();
 
   //------ selected W for DIS CC
-  ps->NewPage();
-  gst_0->Draw("Ws","dis&&cc","");
-  if(gst_1) gst_1->Draw("Ws","dis&&cc","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"Ws","dis&&cc","");
+  DrawPlot(1,"Ws","dis&&cc","perrsame");
   ls->Clear();
   ls->SetHeader("selected W for DIS CC events");
   ls->Draw();
   c->Update();
 
   //------ selected W for DIS NC
-  ps->NewPage();
-  gst_0->Draw("Ws","dis&&nc","");
-  if(gst_1) gst_1->Draw("Ws","dis&&nc","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"Ws","dis&&nc","");
+  DrawPlot(1,"Ws","dis&&nc","perrsame");
   ls->Clear();
   ls->SetHeader("selected W for DIS NC events");
   ls->Draw();
   c->Update();
 
   //------ selected x for all events
-  ps->NewPage();
-  gst_0->Draw("xs","","");
-  if(gst_1) gst_1->Draw("xs","","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"xs","","");
+  DrawPlot(1,"xs","","perrsame");
   ls->Clear();
   ls->SetHeader("selected x for all events");
   ls->Draw();
   c->Update();
 
   //------ selected x for QEL
-  ps->NewPage();
-  gst_0->Draw("xs","qel&&!charm","");
-  if(gst_1) gst_1->Draw("xs","qel&&!charm","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"xs","qel&&!charm","");
+  DrawPlot(1,"xs","qel&&!charm","perrsame");
   ls->Clear();
   ls->SetHeader("selected x for QEL events");
   ls->Draw();
   c->Update();
 
   //------ selected x for RES
-  ps->NewPage();
-  gst_0->Draw("xs","res","");
-  if(gst_1) gst_1->Draw("xs","res","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"xs","res","");
+  DrawPlot(1,"xs","res","perrsame");
   ls->Clear();
   ls->SetHeader("selected x for RES events");
   ls->Draw();
   c->Update();
 
   //------ selected x for DIS
-  ps->NewPage();
-  gst_0->Draw("xs","dis","");
-  if(gst_1) gst_1->Draw("xs","dis","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"xs","dis","");
+  DrawPlot(1,"xs","dis","perrsame");
   ls->Clear();
   ls->SetHeader("selected x for DIS events");
   ls->Draw();
   c->Update();
 
   //------ selected x for DIS CC
-  ps->NewPage();
-  gst_0->Draw("xs","dis&&cc","");
-  if(gst_1) gst_1->Draw("xs","dis&&cc","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"xs","dis&&cc","");
+  DrawPlot(1,"xs","dis&&cc","perrsame");
   ls->Clear();
   ls->SetHeader("selected x for DIS CC events");
   ls->Draw();
   c->Update();
 
   //------ selected x for DIS NC
-  ps->NewPage();
-  gst_0->Draw("xs","dis&&nc","");
-  if(gst_1) gst_1->Draw("xs","dis&&nc","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"xs","dis&&nc","");
+  DrawPlot(1,"xs","dis&&nc","perrsame");
   ls->Clear();
   ls->SetHeader("selected x for DIS NC events");
   ls->Draw();
   c->Update();
 
   //------ selected x for Charm/DIS 
-  ps->NewPage();
-  gst_0->Draw("xs","dis&&charm","");
-  if(gst_1) gst_1->Draw("xs","dis&&charm","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"xs","dis&&charm","");
+  DrawPlot(1,"xs","dis&&charm","perrsame");
   ls->Clear();
   ls->SetHeader("selected x for Charm/DIS events");
   ls->Draw();
@@ -556,27 +535,27 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
 
   if(show_coh_plots) {
      //------ selected x for COH
-     ps->NewPage();
-     gst_0->Draw("xs","coh","");
-     if(gst_1) gst_1->Draw("xs","coh","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"xs","coh","");
+     DrawPlot(1,"xs","coh","perrsame");
      ls->Clear();
      ls->SetHeader("selected x for COH events");
      ls->Draw();
      c->Update();
 
      //------ selected x for COH CC
-     ps->NewPage();
-     gst_0->Draw("xs","coh&&cc","");
-     if(gst_1) gst_1->Draw("xs","coh&&cc","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"xs","coh&&cc","");
+     DrawPlot(1,"xs","coh&&cc","perrsame");
      ls->Clear();
      ls->SetHeader("selected x for COH CC events");
      ls->Draw();
      c->Update();
 
      //------ selected x for COH NC
-     ps->NewPage();
-     gst_0->Draw("xs","coh&&nc","");
-     if(gst_1) gst_1->Draw("xs","coh&&nc","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"xs","coh&&nc","");
+     DrawPlot(1,"xs","coh&&nc","perrsame");
      ls->Clear();
      ls->SetHeader("selected x for COH NC events");
      ls->Draw();
@@ -584,63 +563,63 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
   }
 
   //------ selected y for all events
-  ps->NewPage();
-  gst_0->Draw("ys","","");
-  if(gst_1) gst_1->Draw("ys","","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"ys","","");
+  DrawPlot(1,"ys","","perrsame");
   ls->Clear();
   ls->SetHeader("selected y for all events");
   ls->Draw();
   c->Update();
 
   //------ selected y for QEL
-  ps->NewPage();
-  gst_0->Draw("ys","qel&&!charm","");
-  if(gst_1) gst_1->Draw("ys","qel&&!charm","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"ys","qel&&!charm","");
+  DrawPlot(1,"ys","qel&&!charm","perrsame");
   ls->Clear();
   ls->SetHeader("selected y for QEL events");
   ls->Draw();
   c->Update();
 
   //------ selected y for RES
-  ps->NewPage();
-  gst_0->Draw("ys","res","");
-  if(gst_1) gst_1->Draw("ys","res","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"ys","res","");
+  DrawPlot(1,"ys","res","perrsame");
   ls->Clear();
   ls->SetHeader("selected y for RES events");
   ls->Draw();
   c->Update();
 
   //------ selected y for DIS
-  ps->NewPage();
-  gst_0->Draw("ys","dis","");
-  if(gst_1) gst_1->Draw("ys","dis","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"ys","dis","");
+  DrawPlot(1,"ys","dis","perrsame");
   ls->Clear();
   ls->SetHeader("selected y for DIS events");
   ls->Draw();
   c->Update();
 
   //------ selected y for DIS CC
-  ps->NewPage();
-  gst_0->Draw("ys","dis&&cc","");
-  if(gst_1) gst_1->Draw("ys","dis&&cc","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"ys","dis&&cc","");
+  DrawPlot(1,"ys","dis&&cc","perrsame");
   ls->Clear();
   ls->SetHeader("selected y for DIS CC events");
   ls->Draw();
   c->Update();
 
   //------ selected y for DIS NC
-  ps->NewPage();
-  gst_0->Draw("ys","dis&&nc","");
-  if(gst_1) gst_1->Draw("ys","dis&&nc","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"ys","dis&&nc","");
+  DrawPlot(1,"ys","dis&&nc","perrsame");
   ls->Clear();
   ls->SetHeader("selected y for DIS NC events");
   ls->Draw();
   c->Update();
 
   //------ selected y for Charm/DIS 
-  ps->NewPage();
-  gst_0->Draw("ys","dis&&charm","");
-  if(gst_1) gst_1->Draw("ys","dis&&charm","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"ys","dis&&charm","");
+  DrawPlot(1,"ys","dis&&charm","perrsame");
   ls->Clear();
   ls->SetHeader("selected y for Charm/DIS events");
   ls->Draw();
@@ -648,36 +627,36 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
 
   if(show_coh_plots) {
      //------ selected y for COH
-     ps->NewPage();
-     gst_0->Draw("ys","coh","");
-     if(gst_1) gst_1->Draw("ys","coh","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"ys","coh","");
+     DrawPlot(1,"ys","coh","perrsame");
      ls->Clear();
      ls->SetHeader("selected y for COH events");
      ls->Draw();
      c->Update();
 
      //------ selected y for COH CC
-     ps->NewPage();
-     gst_0->Draw("ys","coh&&cc","");
-     if(gst_1) gst_1->Draw("ys","coh&&cc","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"ys","coh&&cc","");
+     DrawPlot(1,"ys","coh&&cc","perrsame");
      ls->Clear();
      ls->SetHeader("selected y for COH CC events");
      ls->Draw();
      c->Update();
 
      //------ selected y for COH NC
-     ps->NewPage();
-     gst_0->Draw("ys","coh&&nc","");
-     if(gst_1) gst_1->Draw("ys","coh&&nc","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"ys","coh&&nc","");
+     DrawPlot(1,"ys","coh&&nc","perrsame");
      ls->Clear();
      ls->SetHeader("selected y for COH NC events");
      ls->Draw();
      c->Update();
 
      //------ selected t for COH
-     ps->NewPage();
-     gst_0->Draw("ts","coh","");
-     if(gst_1) gst_1->Draw("ts","coh","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"ts","coh","");
+     DrawPlot(1,"ts","coh","perrsame");
      ls->Clear();
      ls->SetHeader("selected t for COH events");
      ls->Draw();
@@ -689,7 +668,7 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
      //
      // SECTION: Computed Kinematics 
      //
-     ps->NewPage();
+     NewPage(ps);
      c->Clear();
      c->Range(0,0,100,100);
      TPavesText hdrck(10,40,90,70,3,"tr");
@@ -702,108 +681,108 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
      c->Update();
 
      //------ Q2 for all events
-     ps->NewPage();
-               gst_0->Draw("Q2","","");
-     if(gst_1) gst_1->Draw("Q2","","perrsame");
+     NewPage(ps);
+               DrawPlot(0,"Q2","","");
+     DrawPlot(1,"Q2","","perrsame");
      ls->Clear();
      ls->SetHeader("computed Q2 for all events");
      ls->Draw();
      c->Update();
 
      //------ Q2 for QEL
-     ps->NewPage();
-               gst_0->Draw("Q2","qel&&!charm","");
-     if(gst_1) gst_1->Draw("Q2","qel&&!charm","perrsame");
+     NewPage(ps);
+               DrawPlot(0,"Q2","qel&&!charm","");
+     DrawPlot(1,"Q2","qel&&!charm","perrsame");
      ls->Clear();
      ls->SetHeader("computed Q2 for QEL events");
      ls->Draw();
      c->Update();
 
      //------ Q2 for RES
-     ps->NewPage();
-               gst_0->Draw("Q2","res","");
-     if(gst_1) gst_1->Draw("Q2","res","perrsame");
+     NewPage(ps);
+               DrawPlot(0,"Q2","res","");
+     DrawPlot(1,"Q2","res","perrsame");
      ls->Clear();
      ls->SetHeader("computed Q2 for RES events");
      ls->Draw();
      c->Update();
 
      //------ Q2 for DIS
-     ps->NewPage();
-               gst_0->Draw("Q2","dis","");
-     if(gst_1) gst_1->Draw("Q2","dis","perrsame");
+     NewPage(ps);
+               DrawPlot(0,"Q2","dis","");
+     DrawPlot(1,"Q2","dis","perrsame");
      ls->Clear();
      ls->SetHeader("computed Q2 for DIS events");
      ls->Draw();
      c->Update();
 
      //------ x for all events
-     ps->NewPage();
-     gst_0->Draw("x","","");
-     if(gst_1) gst_1->Draw("x","","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"x","","");
+     DrawPlot(1,"x","","perrsame");
      ls->Clear();
      ls->SetHeader("computed x for all events");
      ls->Draw();
      c->Update();
 
      //------ x for QEL
-     ps->NewPage();
-     gst_0->Draw("x","qel&&!charm","");
-     if(gst_1) gst_1->Draw("x","qel&&!charm","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"x","qel&&!charm","");
+     DrawPlot(1,"x","qel&&!charm","perrsame");
      ls->Clear();
      ls->SetHeader("computed x for QEL events");
      ls->Draw();
      c->Update();
 
      //------ x for RES
-     ps->NewPage();
-     gst_0->Draw("x","res","");
-     if(gst_1) gst_1->Draw("x","res","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"x","res","");
+     DrawPlot(1,"x","res","perrsame");
      ls->Clear();
      ls->SetHeader("computed x for RES events");
      ls->Draw();
      c->Update();
 
      //------ x for DIS
-     ps->NewPage();
-     gst_0->Draw("x","dis","");
-     if(gst_1) gst_1->Draw("x","dis","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"x","dis","");
+     DrawPlot(1,"x","dis","perrsame");
      ls->Clear();
      ls->SetHeader("computed x for DIS events");
      ls->Draw();
      c->Update();
 
      //------ y for all events
-     ps->NewPage();
-     gst_0->Draw("y","","");
-     if(gst_1) gst_1->Draw("y","","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"y","","");
+     DrawPlot(1,"y","","perrsame");
      ls->Clear();
      ls->SetHeader("computed y for all events");
      ls->Draw();
      c->Update();
 
      //------ y for QEL
-     ps->NewPage();
-     gst_0->Draw("y","qel&&!charm","");
-     if(gst_1) gst_1->Draw("y","qel&&!charm","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"y","qel&&!charm","");
+     DrawPlot(1,"y","qel&&!charm","perrsame");
      ls->Clear();
      ls->SetHeader("computed y for QEL events");
      ls->Draw();
      c->Update();
 
      //------ y for RES
-     ps->NewPage();
-     gst_0->Draw("y","res","");
-     if(gst_1) gst_1->Draw("y","res","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"y","res","");
+     DrawPlot(1,"y","res","perrsame");
      ls->Clear();
      ls->SetHeader("computed y for RES events");
      ls->Draw();
      c->Update();
 
      //------ y for DIS
-     ps->NewPage();
-     gst_0->Draw("y","dis","");
-     if(gst_1) gst_1->Draw("y","dis","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"y","dis","");
+     DrawPlot(1,"y","dis","perrsame");
      ls->Clear();
      ls->SetHeader("computed y for DIS events");
      ls->Draw();
@@ -815,7 +794,7 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
   //
   // SECTION: Initial State nucleon
   //
-  ps->NewPage();
+  NewPage(ps);
   c->Clear();
   c->Range(0,0,100,100);
   TPavesText hdrinuc(10,40,90,70,3,"tr");
@@ -824,27 +803,27 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
   c->Update();
 
   //------ selected hit nucleon px
-  ps->NewPage();
+  NewPage(ps);
   c->Clear();
   c->Divide(2,2);
   c->cd(1);
-  gst_0->Draw("pxn","","");
-  if(gst_1) gst_1->Draw("pxn","","perrsame");
+  DrawPlot(0,"pxn","","");
+  DrawPlot(1,"pxn","","perrsame");
   c->cd(2);
-  gst_0->Draw("pyn","","");
-  if(gst_1) gst_1->Draw("pyn","","perrsame");
+  DrawPlot(0,"pyn","","");
+  DrawPlot(1,"pyn","","perrsame");
   c->cd(3);
-  gst_0->Draw("pzn","","");
-  if(gst_1) gst_1->Draw("pzn","","perrsame");
+  DrawPlot(0,"pzn","","");
+  DrawPlot(1,"pzn","","perrsame");
   c->cd(4);
-  gst_0->Draw("En","En>.2","");
-  if(gst_1) gst_1->Draw("En","En>.2","perrsame");
+  DrawPlot(0,"En","En>.2","");
+  DrawPlot(1,"En","En>.2","perrsame");
   c->Update();
 
   //
   // SECTION: Final State Primary Lepton
   //
-  ps->NewPage();
+  NewPage(ps);
   c->Clear();
   c->Range(0,0,100,100);
   TPavesText hdrfsl(10,40,90,70,3,"tr");
@@ -853,20 +832,20 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
   c->Update();
 
   //------ f/s primary lepton : all events
-  ps->NewPage();
+  NewPage(ps);
   c->Divide(2,2);
   c->cd(1);
-  gst_0->Draw("pxl","","");
-  if(gst_1) gst_1->Draw("pxl","","perrsame");
+  DrawPlot(0,"pxl","","");
+  DrawPlot(1,"pxl","","perrsame");
   c->cd(2);
-  gst_0->Draw("pyl","","");
-  if(gst_1) gst_1->Draw("pyl","","perrsame");
+  DrawPlot(0,"pyl","","");
+  DrawPlot(1,"pyl","","perrsame");
   c->cd(3);
-  gst_0->Draw("pzl","","");
-  if(gst_1) gst_1->Draw("pzl","","perrsame");
+  DrawPlot(0,"pzl","","");
+  DrawPlot(1,"pzl","","perrsame");
   c->cd(4);
-  gst_0->Draw("El","","");
-  if(gst_1) gst_1->Draw("El","","perrsame");
+  DrawPlot(0,"El","","");
+  DrawPlot(1,"El","","perrsame");
   c->cd();
   ls->Clear();
   ls->SetHeader("Final state primary lepton 4-p: All events");
@@ -874,21 +853,21 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
   c->Update();
 
   //------ f/s primary lepton : all CC events
-  ps->NewPage();
+  NewPage(ps);
   c->Clear();
   c->Divide(2,2);
   c->cd(1);
-  gst_0->Draw("pxl","cc","");
-  if(gst_1) gst_1->Draw("pxl","cc","perrsame");
+  DrawPlot(0,"pxl","cc","");
+  DrawPlot(1,"pxl","cc","perrsame");
   c->cd(2);
-  gst_0->Draw("pyl","cc","");
-  if(gst_1) gst_1->Draw("pyl","cc","perrsame");
+  DrawPlot(0,"pyl","cc","");
+  DrawPlot(1,"pyl","cc","perrsame");
   c->cd(3);
-  gst_0->Draw("pzl","cc","");
-  if(gst_1) gst_1->Draw("pzl","cc","perrsame");
+  DrawPlot(0,"pzl","cc","");
+  DrawPlot(1,"pzl","cc","perrsame");
   c->cd(4);
-  gst_0->Draw("El","cc","");
-  if(gst_1) gst_1->Draw("El","cc","perrsame");
+  DrawPlot(0,"El","cc","");
+  DrawPlot(1,"El","cc","perrsame");
   c->cd();
   ls->Clear();
   ls->SetHeader("Final state primary lepton 4-p: All CC events");
@@ -896,21 +875,21 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
   c->Update();
 
   //------ f/s primary lepton : all NC events
-  ps->NewPage();
+  NewPage(ps);
   c->Clear();
   c->Divide(2,2);
   c->cd(1);
-  gst_0->Draw("pxl","nc","");
-  if(gst_1) gst_1->Draw("pxl","nc","perrsame");
+  DrawPlot(0,"pxl","nc","");
+  DrawPlot(1,"pxl","nc","perrsame");
   c->cd(2);
-  gst_0->Draw("pyl","nc","");
-  if(gst_1) gst_1->Draw("pyl","nc","perrsame");
+  DrawPlot(0,"pyl","nc","");
+  DrawPlot(1,"pyl","nc","perrsame");
   c->cd(3);
-  gst_0->Draw("pzl","nc","");
-  if(gst_1) gst_1->Draw("pzl","nc","perrsame");
+  DrawPlot(0,"pzl","nc","");
+  DrawPlot(1,"pzl","nc","perrsame");
   c->cd(4);
-  gst_0->Draw("El","nc","");
-  if(gst_1) gst_1->Draw("El","nc","perrsame");
+  DrawPlot(0,"El","nc","");
+  DrawPlot(1,"El","nc","perrsame");
   c->cd();
   ls->Clear();
   ls->SetHeader("Final state primary lepton 4-p: All NC events");
@@ -918,21 +897,21 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
   c->Update();
 
   //------ f/s primary lepton : QEL events
-  ps->NewPage();
+  NewPage(ps);
   c->Clear();
   c->Divide(2,2);
   c->cd(1);
-  gst_0->Draw("pxl","qel&&!charm","");
-  if(gst_1) gst_1->Draw("pxl","qel&&!charm","perrsame");
+  DrawPlot(0,"pxl","qel&&!charm","");
+  DrawPlot(1,"pxl","qel&&!charm","perrsame");
   c->cd(2);
-  gst_0->Draw("pyl","qel&&!charm","");
-  if(gst_1) gst_1->Draw("pyl","qel&&!charm","perrsame");
+  DrawPlot(0,"pyl","qel&&!charm","");
+  DrawPlot(1,"pyl","qel&&!charm","perrsame");
   c->cd(3);
-  gst_0->Draw("pzl","qel&&!charm","");
-  if(gst_1) gst_1->Draw("pzl","qel&&!charm","perrsame");
+  DrawPlot(0,"pzl","qel&&!charm","");
+  DrawPlot(1,"pzl","qel&&!charm","perrsame");
   c->cd(4);
-  gst_0->Draw("El","qel&&!charm","");
-  if(gst_1) gst_1->Draw("El","qel&&!charm","perrsame");
+  DrawPlot(0,"El","qel&&!charm","");
+  DrawPlot(1,"El","qel&&!charm","perrsame");
   c->cd();
   ls->Clear();
   ls->SetHeader("Final state primary lepton 4-p: QEL events");
@@ -940,21 +919,21 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
   c->Update();
 
   //------ f/s primary lepton : RES events
-  ps->NewPage();
+  NewPage(ps);
   c->Clear();
   c->Divide(2,2);
   c->cd(1);
-  gst_0->Draw("pxl","res","");
-  if(gst_1) gst_1->Draw("pxl","res","perrsame");
+  DrawPlot(0,"pxl","res","");
+  DrawPlot(1,"pxl","res","perrsame");
   c->cd(2);
-  gst_0->Draw("pyl","res","");
-  if(gst_1) gst_1->Draw("pyl","res","perrsame");
+  DrawPlot(0,"pyl","res","");
+  DrawPlot(1,"pyl","res","perrsame");
   c->cd(3);
-  gst_0->Draw("pzl","res","");
-  if(gst_1) gst_1->Draw("pzl","res","perrsame");
+  DrawPlot(0,"pzl","res","");
+  DrawPlot(1,"pzl","res","perrsame");
   c->cd(4);
-  gst_0->Draw("El","res","");
-  if(gst_1) gst_1->Draw("El","res","perrsame");
+  DrawPlot(0,"El","res","");
+  DrawPlot(1,"El","res","perrsame");
   c->cd();
   ls->Clear();
   ls->SetHeader("Final state primary lepton 4-p: RES events");
@@ -962,21 +941,21 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
   c->Update();
 
   //------ f/s primary lepton : DIS events
-  ps->NewPage();
+  NewPage(ps);
   c->Clear();
   c->Divide(2,2);
   c->cd(1);
-  gst_0->Draw("pxl","dis","");
-  if(gst_1) gst_1->Draw("pxl","dis","perrsame");
+  DrawPlot(0,"pxl","dis","");
+  DrawPlot(1,"pxl","dis","perrsame");
   c->cd(2);
-  gst_0->Draw("pyl","dis","");
-  if(gst_1) gst_1->Draw("pyl","dis","perrsame");
+  DrawPlot(0,"pyl","dis","");
+  DrawPlot(1,"pyl","dis","perrsame");
   c->cd(3);
-  gst_0->Draw("pzl","dis","");
-  if(gst_1) gst_1->Draw("pzl","dis","perrsame");
+  DrawPlot(0,"pzl","dis","");
+  DrawPlot(1,"pzl","dis","perrsame");
   c->cd(4);
-  gst_0->Draw("El","dis","");
-  if(gst_1) gst_1->Draw("El","dis","perrsame");
+  DrawPlot(0,"El","dis","");
+  DrawPlot(1,"El","dis","perrsame");
   c->cd();
   ls->Clear();
   ls->SetHeader("Final state primary lepton 4-p: All DIS events");
@@ -985,21 +964,21 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
 
   if(show_coh_plots) {
      //------ f/s primary lepton : COH events
-     ps->NewPage();
+     NewPage(ps);
      c->Clear();
      c->Divide(2,2);
      c->cd(1);
-     gst_0->Draw("pxl","coh","");
-     if(gst_1) gst_1->Draw("pxl","coh","perrsame");
+     DrawPlot(0,"pxl","coh","");
+     DrawPlot(1,"pxl","coh","perrsame");
      c->cd(2);
-     gst_0->Draw("pyl","coh","");
-     if(gst_1) gst_1->Draw("pyl","coh","perrsame");
+     DrawPlot(0,"pyl","coh","");
+     DrawPlot(1,"pyl","coh","perrsame");
      c->cd(3);
-     gst_0->Draw("pzl","coh","");
-     if(gst_1) gst_1->Draw("pzl","coh","perrsame");
+     DrawPlot(0,"pzl","coh","");
+     DrawPlot(1,"pzl","coh","perrsame");
      c->cd(4);
-     gst_0->Draw("El","coh","");
-     if(gst_1) gst_1->Draw("El","coh","perrsame");
+     DrawPlot(0,"El","coh","");
+     DrawPlot(1,"El","coh","perrsame");
      c->cd();
      ls->Clear();
      ls->SetHeader("Final state primary lepton 4-p: COH events");
@@ -1010,7 +989,7 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
   //
   // SECTION: Final State Hadronic System Multiplicities & 4P
   //
-  ps->NewPage();
+  NewPage(ps);
   c->Clear();
   c->Range(0,0,100,100);
   TPavesText hdrfhad(10,40,90,70,3,"tr");
@@ -1027,92 +1006,92 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
   c->Update();
 
   //------ number of final state p
-  ps->NewPage();
-  gst_0->Draw("nfp","","");
-  if(gst_1) gst_1->Draw("nfp","","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"nfp","","");
+  DrawPlot(1,"nfp","","perrsame");
   ls->Clear();
   ls->SetHeader("Number of final state protons");
   ls->Draw();
   c->Update();
 
   //------ number of final state n
-  ps->NewPage();
-  gst_0->Draw("nfn","","");
-  if(gst_1) gst_1->Draw("nfn","","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"nfn","","");
+  DrawPlot(1,"nfn","","perrsame");
   ls->Clear();
   ls->SetHeader("Number of final state neutrons");
   ls->Draw();
   c->Update();
 
   //------ number of final state pi+
-  ps->NewPage();
-  gst_0->Draw("nfpip","","");
-  if(gst_1) gst_1->Draw("nfpip","","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"nfpip","","");
+  DrawPlot(1,"nfpip","","perrsame");
   ls->Clear();
   ls->SetHeader("Number of final state pi+");
   ls->Draw();
   c->Update();
 
   //------ number of final state pi-
-  ps->NewPage();
-  gst_0->Draw("nfpim","","");
-  if(gst_1) gst_1->Draw("nfpim","","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"nfpim","","");
+  DrawPlot(1,"nfpim","","perrsame");
   ls->Clear();
   ls->SetHeader("Number of final state pi-");
   ls->Draw();
   c->Update();
 
   //------ number of final state pi0
-  ps->NewPage();
-  gst_0->Draw("nfpi0","","");
-  if(gst_1) gst_1->Draw("nfpi0","","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"nfpi0","","");
+  DrawPlot(1,"nfpi0","","perrsame");
   ls->Clear();
   ls->SetHeader("Number of final state pi0");
   ls->Draw();
   c->Update();
 
   //------ number of final state K+
-  ps->NewPage();
-  gst_0->Draw("nfkp","","");
-  if(gst_1) gst_1->Draw("nfkp","","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"nfkp","","");
+  DrawPlot(1,"nfkp","","perrsame");
   ls->Clear();
   ls->SetHeader("Number of final state K+");
   ls->Draw();
   c->Update();
 
   //------ number of final state K-
-  ps->NewPage();
-  gst_0->Draw("nfkm","","");
-  if(gst_1) gst_1->Draw("nfkm","","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"nfkm","","");
+  DrawPlot(1,"nfkm","","perrsame");
   ls->Clear();
   ls->SetHeader("Number of final state K-");
   ls->Draw();
   c->Update();
 
   //------ number of final state K0
-  ps->NewPage();
-  gst_0->Draw("nfk0","","");
-  if(gst_1) gst_1->Draw("nfk0","","perrsame");
+  NewPage(ps);
+  DrawPlot(0,"nfk0","","");
+  DrawPlot(1,"nfk0","","perrsame");
   ls->Clear();
   ls->SetHeader("Number of final state K0");
   ls->Draw();
   c->Update();
 
   //------ momentum of final state p
-  ps->NewPage();
+  NewPage(ps);
   c->Divide(2,2);
   c->cd(1);
-  gst_0->Draw("pxf","pdgf==2212","");
-  if(gst_1) gst_1->Draw("pxf","pdgf==2212","perrsame");
+  DrawPlot(0,"pxf","pdgf==2212","");
+  DrawPlot(1,"pxf","pdgf==2212","perrsame");
   c->cd(2);
-  gst_0->Draw("pyf","pdgf==2212","");
-  if(gst_1) gst_1->Draw("pyf","pdgf==2212","perrsame");
+  DrawPlot(0,"pyf","pdgf==2212","");
+  DrawPlot(1,"pyf","pdgf==2212","perrsame");
   c->cd(3);
-  gst_0->Draw("pzf","pdgf==2212","");
-  if(gst_1) gst_1->Draw("pzf","pdgf==2212","perrsame"); 
+  DrawPlot(0,"pzf","pdgf==2212","");
+  DrawPlot(1,"pzf","pdgf==2212","perrsame"); 
   c->cd(4);
-  gst_0->Draw("Ef","pdgf==2212","");
-  if(gst_1) gst_1->Draw("Ef","pdgf==2212","perrsame");
+  DrawPlot(0,"Ef","pdgf==2212","");
+  DrawPlot(1,"Ef","pdgf==2212","perrsame");
   c->cd();
   ls->Clear();
   ls->SetHeader("Final state protons 4-momentum");
@@ -1120,21 +1099,21 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
   c->Update();
 
   //------ momentum of final state n
-  ps->NewPage();
+  NewPage(ps);
   c->Clear();
   c->Divide(2,2);
   c->cd(1);
-  gst_0->Draw("pxf","pdgf==2112","");
-  if(gst_1) gst_1->Draw("pxf","pdgf==2112","perrsame");
+  DrawPlot(0,"pxf","pdgf==2112","");
+  DrawPlot(1,"pxf","pdgf==2112","perrsame");
   c->cd(2);
-  gst_0->Draw("pyf","pdgf==2112","");
-  if(gst_1) gst_1->Draw("pyf","pdgf==2112","perrsame");
+  DrawPlot(0,"pyf","pdgf==2112","");
+  DrawPlot(1,"pyf","pdgf==2112","perrsame");
   c->cd(3);
-  gst_0->Draw("pzf","pdgf==2112","");
-  if(gst_1) gst_1->Draw("pzf","pdgf==2112","perrsame");
+  DrawPlot(0,"pzf","pdgf==2112","");
+  DrawPlot(1,"pzf","pdgf==2112","perrsame");
   c->cd(4);
-  gst_0->Draw("Ef","pdgf==2112","");
-  if(gst_1) gst_1->Draw("Ef","pdgf==2112","perrsame");
+  DrawPlot(0,"Ef","pdgf==2112","");
+  DrawPlot(1,"Ef","pdgf==2112","perrsame");
   c->cd();
   ls->Clear();
   ls->SetHeader("Final state neutrons 4-momentum");
@@ -1142,21 +1121,21 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
   c->Update();
 
   //------ momentum of final state pi0
-  ps->NewPage();
+  NewPage(ps);
   c->Clear();
   c->Divide(2,2);
   c->cd(1);
-  gst_0->Draw("pxf","pdgf==111","");
-  if(gst_1) gst_1->Draw("pxf","pdgf==111","perrsame");
+  DrawPlot(0,"pxf","pdgf==111","");
+  DrawPlot(1,"pxf","pdgf==111","perrsame");
   c->cd(2);
-  gst_0->Draw("pyf","pdgf==111","");
-  if(gst_1) gst_1->Draw("pyf","pdgf==111","perrsame");
+  DrawPlot(0,"pyf","pdgf==111","");
+  DrawPlot(1,"pyf","pdgf==111","perrsame");
   c->cd(3);
-  gst_0->Draw("pzf","pdgf==111","");
-  if(gst_1) gst_1->Draw("pzf","pdgf==111","perrsame");
+  DrawPlot(0,"pzf","pdgf==111","");
+  DrawPlot(1,"pzf","pdgf==111","perrsame");
   c->cd(4);
-  gst_0->Draw("Ef","pdgf==111","");
-  if(gst_1) gst_1->Draw("Ef","pdgf==111","perrsame");
+  DrawPlot(0,"Ef","pdgf==111","");
+  DrawPlot(1,"Ef","pdgf==111","perrsame");
   c->cd();
   ls->Clear();
   ls->SetHeader("Final state pi0's 4-momentum");
@@ -1164,21 +1143,21 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
   c->Update();
 
   //------ momentum of final state pi+
-  ps->NewPage();
+  NewPage(ps);
   c->Clear();
   c->Divide(2,2);
   c->cd(1);
-  gst_0->Draw("pxf","pdgf==211","");
-  if(gst_1) gst_1->Draw("pxf","pdgf==211","perrsame");
+  DrawPlot(0,"pxf","pdgf==211","");
+  DrawPlot(1,"pxf","pdgf==211","perrsame");
   c->cd(2);
-  gst_0->Draw("pyf","pdgf==211","");
-  if(gst_1) gst_1->Draw("pyf","pdgf==211","perrsame");
+  DrawPlot(0,"pyf","pdgf==211","");
+  DrawPlot(1,"pyf","pdgf==211","perrsame");
   c->cd(3);
-  gst_0->Draw("pzf","pdgf==211","");
-  if(gst_1) gst_1->Draw("pzf","pdgf==211","perrsame");
+  DrawPlot(0,"pzf","pdgf==211","");
+  DrawPlot(1,"pzf","pdgf==211","perrsame");
   c->cd(4);
-  gst_0->Draw("Ef","pdgf==211","");
-  if(gst_1) gst_1->Draw("Ef","pdgf==211","perrsame");
+  DrawPlot(0,"Ef","pdgf==211","");
+  DrawPlot(1,"Ef","pdgf==211","perrsame");
   c->cd();
   ls->Clear();
   ls->SetHeader("Final state pi+'s 4-momentum");
@@ -1186,21 +1165,21 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
   c->Update();
 
   //------ momentum of final state pi+
-  ps->NewPage();
+  NewPage(ps);
   c->Clear();
   c->Divide(2,2);
   c->cd(1);
-  gst_0->Draw("pxf","pdgf==-211","");
-  if(gst_1) gst_1->Draw("pxf","pdgf==-211","perrsame");
+  DrawPlot(0,"pxf","pdgf==-211","");
+  DrawPlot(1,"pxf","pdgf==-211","perrsame");
   c->cd(2);
-  gst_0->Draw("pyf","pdgf==-211","");
-  if(gst_1) gst_1->Draw("pyf","pdgf==-211","perrsame");
+  DrawPlot(0,"pyf","pdgf==-211","");
+  DrawPlot(1,"pyf","pdgf==-211","perrsame");
   c->cd(3);
-  gst_0->Draw("pzf","pdgf==-211","");
-  if(gst_1) gst_1->Draw("pzf","pdgf==-211","perrsame");
+  DrawPlot(0,"pzf","pdgf==-211","");
+  DrawPlot(1,"pzf","pdgf==-211","perrsame");
   c->cd(4);
-  gst_0->Draw("Ef","pdgf==-211","");
-  if(gst_1) gst_1->Draw("Ef","pdgf==-211","perrsame");
+  DrawPlot(0,"Ef","pdgf==-211","");
+  DrawPlot(1,"Ef","pdgf==-211","perrsame");
   c->cd();
   ls->Clear();
   ls->SetHeader("Final state pi-'s 4-momentum");
@@ -1214,92 +1193,92 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
      //
 
      //------ number of final state p /QEL
-     ps->NewPage();
-     if(gst_1) gst_1->Draw("nfp","qel&&!charm","");
-     gst_0->Draw("nfp","qel&&!charm","perrsame");
+     NewPage(ps);
+     DrawPlot(1,"nfp","qel&&!charm","");
+     DrawPlot(0,"nfp","qel&&!charm","perrsame");
      ls->Clear();
      ls->SetHeader("Number of final state protons / QEL only");
      ls->Draw();
      c->Update();
 
      //------ number of final state n /QEL
-     ps->NewPage();
-     if(gst_1) gst_1->Draw("nfn","qel&&!charm","");
-     gst_0->Draw("nfn","qel&&!charm","perrsame");
+     NewPage(ps);
+     DrawPlot(1,"nfn","qel&&!charm","");
+     DrawPlot(0,"nfn","qel&&!charm","perrsame");
      ls->Clear();
      ls->SetHeader("Number of final state neutrons / QEL only");
      ls->Draw();
      c->Update();
 
      //------ number of final state pi+ /QEL
-     ps->NewPage();
-     gst_0->Draw("nfpip","qel&&!charm","");
-     if(gst_1) gst_1->Draw("nfpip","qel&&!charm","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"nfpip","qel&&!charm","");
+     DrawPlot(1,"nfpip","qel&&!charm","perrsame");
      ls->Clear();
      ls->SetHeader("Number of final state pi+ / QEL only");
      ls->Draw();
      c->Update();
 
      //------ number of final state pi- /QEL
-     ps->NewPage();
-     gst_0->Draw("nfpim","qel&&!charm","");
-     if(gst_1) gst_1->Draw("nfpim","qel&&!charm","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"nfpim","qel&&!charm","");
+     DrawPlot(1,"nfpim","qel&&!charm","perrsame");
      ls->Clear();
      ls->SetHeader("Number of final state pi- / QEL only");
      ls->Draw();
      c->Update();
 
      //------ number of final state pi0 /QEL
-     ps->NewPage();
-     gst_0->Draw("nfpi0","qel&&!charm","");
-     if(gst_1) gst_1->Draw("nfpi0","qel&&!charm","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"nfpi0","qel&&!charm","");
+     DrawPlot(1,"nfpi0","qel&&!charm","perrsame");
      ls->Clear();
      ls->SetHeader("Number of final state pi0 / QEL only");
      ls->Draw();
      c->Update();
 
      //------ number of final state K+ /QEL
-     ps->NewPage();
-     gst_0->Draw("nfkp","qel&&!charm","");
-     if(gst_1) gst_1->Draw("nfkp","qel&&!charm","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"nfkp","qel&&!charm","");
+     DrawPlot(1,"nfkp","qel&&!charm","perrsame");
      ls->Clear();
      ls->SetHeader("Number of final state K+ / QEL only");
      ls->Draw();
      c->Update();
 
      //------ number of final state K- /QEL
-     ps->NewPage();
-     gst_0->Draw("nfkm","qel&&!charm","");
-     if(gst_1) gst_1->Draw("nfkm","qel&&!charm","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"nfkm","qel&&!charm","");
+     DrawPlot(1,"nfkm","qel&&!charm","perrsame");
      ls->Clear();
      ls->SetHeader("Number of final state K- / QEL only");
      ls->Draw();
      c->Update();
 
      //------ number of final state K0 /QEL
-     ps->NewPage();
-     gst_0->Draw("nfk0","qel&&!charm","");
-     if(gst_1) gst_1->Draw("nfk0","qel&&!charm","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"nfk0","qel&&!charm","");
+     DrawPlot(1,"nfk0","qel&&!charm","perrsame");
      ls->Clear();
      ls->SetHeader("Number of final state K0 / QEL only");
      ls->Draw();
      c->Update();
 
      //------ momentum of final state p /QEL
-     ps->NewPage();
+     NewPage(ps);
      c->Divide(2,2);
      c->cd(1);
-     gst_0->Draw("pxf","qel&&!charm&&pdgf==2212","");
-     if(gst_1) gst_1->Draw("pxf","qel&&!charm&&pdgf==2212","perrsame");
+     DrawPlot(0,"pxf","qel&&!charm&&pdgf==2212","");
+     DrawPlot(1,"pxf","qel&&!charm&&pdgf==2212","perrsame");
      c->cd(2);
-     gst_0->Draw("pyf","qel&&!charm&&pdgf==2212","");
-     if(gst_1) gst_1->Draw("pyf","qel&&!charm&&pdgf==2212","perrsame");
+     DrawPlot(0,"pyf","qel&&!charm&&pdgf==2212","");
+     DrawPlot(1,"pyf","qel&&!charm&&pdgf==2212","perrsame");
      c->cd(3);
-     gst_0->Draw("pzf","qel&&!charm&&pdgf==2212","");
-     if(gst_1) gst_1->Draw("pzf","qel&&!charm&&pdgf==2212","perrsame");
+     DrawPlot(0,"pzf","qel&&!charm&&pdgf==2212","");
+     DrawPlot(1,"pzf","qel&&!charm&&pdgf==2212","perrsame");
      c->cd(4);
-     gst_0->Draw("Ef","qel&&!charm&&pdgf==2212","");
-     if(gst_1) gst_1->Draw("Ef","qel&&!charm&&pdgf==2212","perrsame");
+     DrawPlot(0,"Ef","qel&&!charm&&pdgf==2212","");
+     DrawPlot(1,"Ef","qel&&!charm&&pdgf==2212","perrsame");
      c->cd();
      ls->Clear();
      ls->SetHeader("Final state protons 4-momentum / QEL only");
@@ -1307,21 +1286,21 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
      c->Update();
 
      //------ momentum of final state n /QEL
-     ps->NewPage();
+     NewPage(ps);
      c->Clear();
      c->Divide(2,2);
      c->cd(1);
-     gst_0->Draw("pxf","qel&&!charm&&pdgf==2112","");
-     if(gst_1) gst_1->Draw("pxf","qel&&!charm&&pdgf==2112","perrsame");
+     DrawPlot(0,"pxf","qel&&!charm&&pdgf==2112","");
+     DrawPlot(1,"pxf","qel&&!charm&&pdgf==2112","perrsame");
      c->cd(2);
-     gst_0->Draw("pyf","qel&&!charm&&pdgf==2112","");
-     if(gst_1) gst_1->Draw("pyf","qel&&!charm&&pdgf==2112","perrsame");
+     DrawPlot(0,"pyf","qel&&!charm&&pdgf==2112","");
+     DrawPlot(1,"pyf","qel&&!charm&&pdgf==2112","perrsame");
      c->cd(3);
-     gst_0->Draw("pzf","qel&&!charm&&pdgf==2112","");
-     if(gst_1) gst_1->Draw("pzf","qel&&!charm&&pdgf==2112","perrsame");
+     DrawPlot(0,"pzf","qel&&!charm&&pdgf==2112","");
+     DrawPlot(1,"pzf","qel&&!charm&&pdgf==2112","perrsame");
      c->cd(4);
-     gst_0->Draw("Ef","qel&&!charm&&pdgf==2112","");
-     if(gst_1) gst_1->Draw("Ef","qel&&!charm&&pdgf==2112","perrsame");
+     DrawPlot(0,"Ef","qel&&!charm&&pdgf==2112","");
+     DrawPlot(1,"Ef","qel&&!charm&&pdgf==2112","perrsame");
      c->cd();
      ls->Clear();
      ls->SetHeader("Final state neutrons 4-momentum / QEL only");
@@ -1329,21 +1308,21 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
      c->Update();
 
      //------ momentum of final state pi0 /QEL
-     ps->NewPage();
+     NewPage(ps);
      c->Clear();
      c->Divide(2,2);
      c->cd(1);
-     gst_0->Draw("pxf","qel&&!charm&&pdgf==111","");
-     if(gst_1) gst_1->Draw("pxf","qel&&!charm&&pdgf==111","perrsame");
+     DrawPlot(0,"pxf","qel&&!charm&&pdgf==111","");
+     DrawPlot(1,"pxf","qel&&!charm&&pdgf==111","perrsame");
      c->cd(2);
-     gst_0->Draw("pyf","qel&&!charm&&pdgf==111","");
-     if(gst_1) gst_1->Draw("pyf","qel&&!charm&&pdgf==111","perrsame");
+     DrawPlot(0,"pyf","qel&&!charm&&pdgf==111","");
+     DrawPlot(1,"pyf","qel&&!charm&&pdgf==111","perrsame");
      c->cd(3);
-     gst_0->Draw("pzf","qel&&!charm&&pdgf==111","");
-     if(gst_1) gst_1->Draw("pzf","qel&&!charm&&pdgf==111","perrsame");
+     DrawPlot(0,"pzf","qel&&!charm&&pdgf==111","");
+     DrawPlot(1,"pzf","qel&&!charm&&pdgf==111","perrsame");
      c->cd(4);
-     gst_0->Draw("Ef","qel&&!charm&&pdgf==111","");
-     if(gst_1) gst_1->Draw("Ef","qel&&!charm&&pdgf==111","perrsame");
+     DrawPlot(0,"Ef","qel&&!charm&&pdgf==111","");
+     DrawPlot(1,"Ef","qel&&!charm&&pdgf==111","perrsame");
      c->cd();
      ls->Clear();
      ls->SetHeader("Final state pi0's 4-momentum / QEL only");
@@ -1351,21 +1330,21 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
      c->Update();
 
      //------ momentum of final state pi+ /QEL
-     ps->NewPage();
+     NewPage(ps);
      c->Clear();
      c->Divide(2,2);
      c->cd(1);
-     gst_0->Draw("pxf","qel&&!charm&&pdgf==211","");
-     if(gst_1) gst_1->Draw("pxf","qel&&!charm&&pdgf==211","perrsame");
+     DrawPlot(0,"pxf","qel&&!charm&&pdgf==211","");
+     DrawPlot(1,"pxf","qel&&!charm&&pdgf==211","perrsame");
      c->cd(2);
-     gst_0->Draw("pyf","qel&&!charm&&pdgf==211","");
-     if(gst_1) gst_1->Draw("pyf","qel&&!charm&&pdgf==211","perrsame");
+     DrawPlot(0,"pyf","qel&&!charm&&pdgf==211","");
+     DrawPlot(1,"pyf","qel&&!charm&&pdgf==211","perrsame");
      c->cd(3);
-     gst_0->Draw("pzf","qel&&!charm&&pdgf==211","");
-     if(gst_1) gst_1->Draw("pzf","qel&&!charm&&pdgf==211","perrsame");
+     DrawPlot(0,"pzf","qel&&!charm&&pdgf==211","");
+     DrawPlot(1,"pzf","qel&&!charm&&pdgf==211","perrsame");
      c->cd(4);
-     gst_0->Draw("Ef","qel&&!charm&&pdgf==211","");
-     if(gst_1) gst_1->Draw("Ef","qel&&!charm&&pdgf==211","perrsame");
+     DrawPlot(0,"Ef","qel&&!charm&&pdgf==211","");
+     DrawPlot(1,"Ef","qel&&!charm&&pdgf==211","perrsame");
      c->cd();
      ls->Clear();
      ls->SetHeader("Final state pi+'s 4-momentum / QEL only");
@@ -1373,21 +1352,21 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
      c->Update();
      
      //------ momentum of final state pi+ /QEL
-     ps->NewPage();
+     NewPage(ps);
      c->Clear();
      c->Divide(2,2);
      c->cd(1);
-     gst_0->Draw("pxf","qel&&!charm&&pdgf==-211","");
-     if(gst_1) gst_1->Draw("pxf","qel&&!charm&&pdgf==-211","perrsame");
+     DrawPlot(0,"pxf","qel&&!charm&&pdgf==-211","");
+     DrawPlot(1,"pxf","qel&&!charm&&pdgf==-211","perrsame");
      c->cd(2);
-     gst_0->Draw("pyf","qel&&!charm&&pdgf==-211","");
-     if(gst_1) gst_1->Draw("pyf","qel&&!charm&&pdgf==-211","perrsame");
+     DrawPlot(0,"pyf","qel&&!charm&&pdgf==-211","");
+     DrawPlot(1,"pyf","qel&&!charm&&pdgf==-211","perrsame");
      c->cd(3);
-     gst_0->Draw("pzf","qel&&!charm&&pdgf==-211","");
-     if(gst_1) gst_1->Draw("pzf","qel&&!charm&&pdgf==-211","perrsame");
+     DrawPlot(0,"pzf","qel&&!charm&&pdgf==-211","");
+     DrawPlot(1,"pzf","qel&&!charm&&pdgf==-211","perrsame");
      c->cd(4);
-     gst_0->Draw("Ef","qel&&!charm&&pdgf==-211","");
-     if(gst_1) gst_1->Draw("Ef","qel&&!charm&&pdgf==-211","perrsame");
+     DrawPlot(0,"Ef","qel&&!charm&&pdgf==-211","");
+     DrawPlot(1,"Ef","qel&&!charm&&pdgf==-211","perrsame");
      c->cd();
      ls->Clear();
      ls->SetHeader("Final state pi-'s 4-momentum/ QEL only");
@@ -1399,92 +1378,92 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
      //
      
      //------ number of final state p /RES
-     ps->NewPage();
-               gst_0->Draw("nfp","res","");
-     if(gst_1) gst_1->Draw("nfp","res","perrsame");
+     NewPage(ps);
+               DrawPlot(0,"nfp","res","");
+     DrawPlot(1,"nfp","res","perrsame");
      ls->Clear();
      ls->SetHeader("Number of final state protons / RES only");
      ls->Draw();
      c->Update();
      
      //------ number of final state n /RES
-     ps->NewPage();
-               gst_0->Draw("nfn","res","");
-     if(gst_1) gst_1->Draw("nfn","res","perrsame");
+     NewPage(ps);
+               DrawPlot(0,"nfn","res","");
+     DrawPlot(1,"nfn","res","perrsame");
      ls->Clear();
      ls->SetHeader("Number of final state neutrons / RES only");
      ls->Draw();
      c->Update();
      
      //------ number of final state pi+ /RES
-     ps->NewPage();
-               gst_0->Draw("nfpip","res","");
-     if(gst_1) gst_1->Draw("nfpip","res","perrsame");
+     NewPage(ps);
+               DrawPlot(0,"nfpip","res","");
+     DrawPlot(1,"nfpip","res","perrsame");
      ls->Clear();
      ls->SetHeader("Number of final state pi+ / RES only");
      ls->Draw();
      c->Update();
      
      //------ number of final state pi- /RES
-     ps->NewPage();
-               gst_0->Draw("nfpim","res","");
-     if(gst_1) gst_1->Draw("nfpim","res","perrsame");
+     NewPage(ps);
+               DrawPlot(0,"nfpim","res","");
+     DrawPlot(1,"nfpim","res","perrsame");
      ls->Clear();
      ls->SetHeader("Number of final state pi- / RES only");
      ls->Draw();
      c->Update();
 
      //------ number of final state pi0 /RES
-     ps->NewPage();
-               gst_0->Draw("nfpi0","res","");
-     if(gst_1) gst_1->Draw("nfpi0","res","perrsame");
+     NewPage(ps);
+               DrawPlot(0,"nfpi0","res","");
+     DrawPlot(1,"nfpi0","res","perrsame");
      ls->Clear();
      ls->SetHeader("Number of final state pi0 / RES only");
      ls->Draw();
      c->Update();
      
      //------ number of final state K+ /RES
-     ps->NewPage();
-     gst_0->Draw("nfkp","res","");
-     if(gst_1) gst_1->Draw("nfkp","res","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"nfkp","res","");
+     DrawPlot(1,"nfkp","res","perrsame");
      ls->Clear();
      ls->SetHeader("Number of final state K+ / RES only");
      ls->Draw();
      c->Update();
      
      //------ number of final state K- /RES
-     ps->NewPage();
-     gst_0->Draw("nfkm","res","");
-     if(gst_1) gst_1->Draw("nfkm","res","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"nfkm","res","");
+     DrawPlot(1,"nfkm","res","perrsame");
      ls->Clear();
      ls->SetHeader("Number of final state K- / RES only");
      ls->Draw();
      c->Update();
      
      //------ number of final state K0 /RES
-     ps->NewPage();
-     gst_0->Draw("nfk0","res","");
-     if(gst_1) gst_1->Draw("nfk0","res","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"nfk0","res","");
+     DrawPlot(1,"nfk0","res","perrsame");
      ls->Clear();
      ls->SetHeader("Number of final state K0 / RES only");
      ls->Draw();
      c->Update();
      
      //------ momentum of final state p /RES
-     ps->NewPage();
+     NewPage(ps);
      c->Divide(2,2);
      c->cd(1);
-     gst_0->Draw("pxf","res&&pdgf==2212","");
-     if(gst_1) gst_1->Draw("pxf","res&&pdgf==2212","perrsame");
+     DrawPlot(0,"pxf","res&&pdgf==2212","");
+     DrawPlot(1,"pxf","res&&pdgf==2212","perrsame");
      c->cd(2);
-     gst_0->Draw("pyf","res&&pdgf==2212","");
-     if(gst_1) gst_1->Draw("pyf","res&&pdgf==2212","perrsame");
+     DrawPlot(0,"pyf","res&&pdgf==2212","");
+     DrawPlot(1,"pyf","res&&pdgf==2212","perrsame");
      c->cd(3);
-     gst_0->Draw("pzf","res&&pdgf==2212","");
-     if(gst_1) gst_1->Draw("pzf","res&&pdgf==2212","perrsame");
+     DrawPlot(0,"pzf","res&&pdgf==2212","");
+     DrawPlot(1,"pzf","res&&pdgf==2212","perrsame");
      c->cd(4);
-     gst_0->Draw("Ef","res&&pdgf==2212","");
-     if(gst_1) gst_1->Draw("Ef","res&&pdgf==2212","perrsame");
+     DrawPlot(0,"Ef","res&&pdgf==2212","");
+     DrawPlot(1,"Ef","res&&pdgf==2212","perrsame");
      c->cd();
      ls->Clear();
      ls->SetHeader("Final state protons 4-momentum / RES only");
@@ -1492,21 +1471,21 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
      c->Update();
      
      //------ momentum of final state n /RES
-     ps->NewPage();
+     NewPage(ps);
      c->Clear();
      c->Divide(2,2);
      c->cd(1);
-     gst_0->Draw("pxf","res&&pdgf==2112","");
-     if(gst_1) gst_1->Draw("pxf","res&&pdgf==2112","perrsame");
+     DrawPlot(0,"pxf","res&&pdgf==2112","");
+     DrawPlot(1,"pxf","res&&pdgf==2112","perrsame");
      c->cd(2);
-     gst_0->Draw("pyf","res&&pdgf==2112","");
-     if(gst_1) gst_1->Draw("pyf","res&&pdgf==2112","perrsame");
+     DrawPlot(0,"pyf","res&&pdgf==2112","");
+     DrawPlot(1,"pyf","res&&pdgf==2112","perrsame");
      c->cd(3);
-     gst_0->Draw("pzf","res&&pdgf==2112","");
-     if(gst_1) gst_1->Draw("pzf","res&&pdgf==2112","perrsame");
+     DrawPlot(0,"pzf","res&&pdgf==2112","");
+     DrawPlot(1,"pzf","res&&pdgf==2112","perrsame");
      c->cd(4);
-     gst_0->Draw("Ef","res&&pdgf==2112","");
-     if(gst_1) gst_1->Draw("Ef","res&&pdgf==2112","perrsame");
+     DrawPlot(0,"Ef","res&&pdgf==2112","");
+     DrawPlot(1,"Ef","res&&pdgf==2112","perrsame");
      c->cd();
      ls->Clear();
      ls->SetHeader("Final state neutrons 4-momentum / RES only");
@@ -1514,21 +1493,21 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
      c->Update();
      
      //------ momentum of final state pi0 /RES
-     ps->NewPage();
+     NewPage(ps);
      c->Clear();
      c->Divide(2,2);
      c->cd(1);
-     gst_0->Draw("pxf","res&&pdgf==111","");
-     if(gst_1) gst_1->Draw("pxf","res&&pdgf==111","perrsame");
+     DrawPlot(0,"pxf","res&&pdgf==111","");
+     DrawPlot(1,"pxf","res&&pdgf==111","perrsame");
      c->cd(2);
-     gst_0->Draw("pyf","res&&pdgf==111","");
-     if(gst_1) gst_1->Draw("pyf","res&&pdgf==111","perrsame");
+     DrawPlot(0,"pyf","res&&pdgf==111","");
+     DrawPlot(1,"pyf","res&&pdgf==111","perrsame");
      c->cd(3);
-     gst_0->Draw("pzf","res&&pdgf==111","");
-     if(gst_1) gst_1->Draw("pzf","res&&pdgf==111","perrsame");
+     DrawPlot(0,"pzf","res&&pdgf==111","");
+     DrawPlot(1,"pzf","res&&pdgf==111","perrsame");
      c->cd(4);
-     gst_0->Draw("Ef","res&&pdgf==111","");
-     if(gst_1) gst_1->Draw("Ef","res&&pdgf==111","perrsame");
+     DrawPlot(0,"Ef","res&&pdgf==111","");
+     DrawPlot(1,"Ef","res&&pdgf==111","perrsame");
      c->cd();
      ls->Clear();
      ls->SetHeader("Final state pi0's 4-momentum / RES only");
@@ -1536,21 +1515,21 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
      c->Update();
      
      //------ momentum of final state pi+ /RES
-     ps->NewPage();
+     NewPage(ps);
      c->Clear();
      c->Divide(2,2);
      c->cd(1);
-     gst_0->Draw("pxf","res&&pdgf==211","");
-     if(gst_1) gst_1->Draw("pxf","res&&pdgf==211","perrsame");
+     DrawPlot(0,"pxf","res&&pdgf==211","");
+     DrawPlot(1,"pxf","res&&pdgf==211","perrsame");
      c->cd(2);
-     gst_0->Draw("pyf","res&&pdgf==211","");
-     if(gst_1) gst_1->Draw("pyf","res&&pdgf==211","perrsame");
+     DrawPlot(0,"pyf","res&&pdgf==211","");
+     DrawPlot(1,"pyf","res&&pdgf==211","perrsame");
      c->cd(3);
-     gst_0->Draw("pzf","res&&pdgf==211","");
-     if(gst_1) gst_1->Draw("pzf","res&&pdgf==211","perrsame");
+     DrawPlot(0,"pzf","res&&pdgf==211","");
+     DrawPlot(1,"pzf","res&&pdgf==211","perrsame");
      c->cd(4);
-     gst_0->Draw("Ef","res&&pdgf==211","");
-     if(gst_1) gst_1->Draw("Ef","res&&pdgf==211","perrsame");
+     DrawPlot(0,"Ef","res&&pdgf==211","");
+     DrawPlot(1,"Ef","res&&pdgf==211","perrsame");
      c->cd();
      ls->Clear();
      ls->SetHeader("Final state pi+'s 4-momentum / RES only");
@@ -1558,21 +1537,21 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
      c->Update();
 
      //------ momentum of final state pi+ /RES
-     ps->NewPage();
+     NewPage(ps);
      c->Clear();
      c->Divide(2,2);
      c->cd(1);
-     gst_0->Draw("pxf","res&&pdgf==-211","");
-     if(gst_1) gst_1->Draw("pxf","res&&pdgf==-211","perrsame");
+     DrawPlot(0,"pxf","res&&pdgf==-211","");
+     DrawPlot(1,"pxf","res&&pdgf==-211","perrsame");
      c->cd(2);
-     gst_0->Draw("pyf","res&&pdgf==-211","");
-     if(gst_1) gst_1->Draw("pyf","res&&pdgf==-211","perrsame");
+     DrawPlot(0,"pyf","res&&pdgf==-211","");
+     DrawPlot(1,"pyf","res&&pdgf==-211","perrsame");
      c->cd(3);
-     gst_0->Draw("pzf","res&&pdgf==-211","");
-     if(gst_1) gst_1->Draw("pzf","res&&pdgf==-211","perrsame");
+     DrawPlot(0,"pzf","res&&pdgf==-211","");
+     DrawPlot(1,"pzf","res&&pdgf==-211","perrsame");
      c->cd(4);
-     gst_0->Draw("Ef","res&&pdgf==-211","");
-     if(gst_1) gst_1->Draw("Ef","res&&pdgf==-211","perrsame");
+     DrawPlot(0,"Ef","res&&pdgf==-211","");
+     DrawPlot(1,"Ef","res&&pdgf==-211","perrsame");
      c->cd();
      ls->Clear();
      ls->SetHeader("Final state pi-'s 4-momentum/ RES only");
@@ -1584,92 +1563,92 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
      //
      
      //------ number of final state p /DIS
-     ps->NewPage();
-     gst_0->Draw("nfp","dis","");
-     if(gst_1) gst_1->Draw("nfp","dis","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"nfp","dis","");
+     DrawPlot(1,"nfp","dis","perrsame");
      ls->Clear();
      ls->SetHeader("Number of final state protons / DIS only");
      ls->Draw();
      c->Update();
      
      //------ number of final state n /DIS
-     ps->NewPage();
-     gst_0->Draw("nfn","dis","");
-     if(gst_1) gst_1->Draw("nfn","dis","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"nfn","dis","");
+     DrawPlot(1,"nfn","dis","perrsame");
      ls->Clear();
      ls->SetHeader("Number of final state neutrons / DIS only");
      ls->Draw();
      c->Update();
      
      //------ number of final state pi+ /DIS
-     ps->NewPage();
-     gst_0->Draw("nfpip","dis","");
-     if(gst_1) gst_1->Draw("nfpip","dis","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"nfpip","dis","");
+     DrawPlot(1,"nfpip","dis","perrsame");
      ls->Clear();
      ls->SetHeader("Number of final state pi+ / DIS only");
      ls->Draw();
      c->Update();
      
      //------ number of final state pi- /DIS
-     ps->NewPage();
-     gst_0->Draw("nfpim","dis","");
-     if(gst_1) gst_1->Draw("nfpim","dis","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"nfpim","dis","");
+     DrawPlot(1,"nfpim","dis","perrsame");
      ls->Clear();
      ls->SetHeader("Number of final state pi- / DIS only");
      ls->Draw();
      c->Update();
      
      //------ number of final state pi0 /DIS
-     ps->NewPage();
-     gst_0->Draw("nfpi0","dis","");
-     if(gst_1) gst_1->Draw("nfpi0","dis","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"nfpi0","dis","");
+     DrawPlot(1,"nfpi0","dis","perrsame");
      ls->Clear();
      ls->SetHeader("Number of final state pi0 / DIS only");
      ls->Draw();
      c->Update();
      
      //------ number of final state K+ /DIS
-     ps->NewPage();
-     gst_0->Draw("nfkp","dis","");
-     if(gst_1) gst_1->Draw("nfkp","dis","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"nfkp","dis","");
+     DrawPlot(1,"nfkp","dis","perrsame");
      ls->Clear();
      ls->SetHeader("Number of final state K+ / DIS only");
      ls->Draw();
      c->Update();
      
      //------ number of final state K- /DIS
-     ps->NewPage();
-     gst_0->Draw("nfkm","dis","");
-     if(gst_1) gst_1->Draw("nfkm","dis","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"nfkm","dis","");
+     DrawPlot(1,"nfkm","dis","perrsame");
      ls->Clear();
      ls->SetHeader("Number of final state K- / DIS only");
      ls->Draw();
      c->Update();
      
      //------ number of final state K0 /DIS
-     ps->NewPage();
-     gst_0->Draw("nfk0","dis","");
-     if(gst_1) gst_1->Draw("nfk0","dis","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"nfk0","dis","");
+     DrawPlot(1,"nfk0","dis","perrsame");
      ls->Clear();
      ls->SetHeader("Number of final state K0 / DIS only");
      ls->Draw();
      c->Update();
      
      //------ momentum of final state p /DIS
-     ps->NewPage();
+     NewPage(ps);
      c->Divide(2,2);
      c->cd(1);
-     gst_0->Draw("pxf","dis&&pdgf==2212","");
-     if(gst_1) gst_1->Draw("pxf","dis&&pdgf==2212","perrsame");
+     DrawPlot(0,"pxf","dis&&pdgf==2212","");
+     DrawPlot(1,"pxf","dis&&pdgf==2212","perrsame");
      c->cd(2);
-     gst_0->Draw("pyf","dis&&pdgf==2212","");
-     if(gst_1) gst_1->Draw("pyf","dis&&pdgf==2212","perrsame");
+     DrawPlot(0,"pyf","dis&&pdgf==2212","");
+     DrawPlot(1,"pyf","dis&&pdgf==2212","perrsame");
      c->cd(3);
-     gst_0->Draw("pzf","dis&&pdgf==2212","");
-     if(gst_1) gst_1->Draw("pzf","dis&&pdgf==2212","perrsame");
+     DrawPlot(0,"pzf","dis&&pdgf==2212","");
+     DrawPlot(1,"pzf","dis&&pdgf==2212","perrsame");
      c->cd(4);
-     gst_0->Draw("Ef","dis&&pdgf==2212","");
-     if(gst_1) gst_1->Draw("Ef","dis&&pdgf==2212","perrsame");
+     DrawPlot(0,"Ef","dis&&pdgf==2212","");
+     DrawPlot(1,"Ef","dis&&pdgf==2212","perrsame");
      c->cd();
      ls->Clear();
      ls->SetHeader("Final state protons 4-momentum / DIS only");
@@ -1677,21 +1656,21 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
      c->Update();
      
      //------ momentum of final state n /DIS
-     ps->NewPage();
+     NewPage(ps);
      c->Clear();
      c->Divide(2,2);
      c->cd(1);
-     gst_0->Draw("pxf","dis&&pdgf==2112","");
-     if(gst_1) gst_1->Draw("pxf","dis&&pdgf==2112","perrsame");
+     DrawPlot(0,"pxf","dis&&pdgf==2112","");
+     DrawPlot(1,"pxf","dis&&pdgf==2112","perrsame");
      c->cd(2);
-     gst_0->Draw("pyf","dis&&pdgf==2112","");
-     if(gst_1) gst_1->Draw("pyf","dis&&pdgf==2112","perrsame");
+     DrawPlot(0,"pyf","dis&&pdgf==2112","");
+     DrawPlot(1,"pyf","dis&&pdgf==2112","perrsame");
      c->cd(3);
-     gst_0->Draw("pzf","dis&&pdgf==2112","");
-     if(gst_1) gst_1->Draw("pzf","dis&&pdgf==2112","perrsame");
+     DrawPlot(0,"pzf","dis&&pdgf==2112","");
+     DrawPlot(1,"pzf","dis&&pdgf==2112","perrsame");
      c->cd(4);
-     gst_0->Draw("Ef","dis&&pdgf==2112","");
-     if(gst_1) gst_1->Draw("Ef","dis&&pdgf==2112","perrsame");
+     DrawPlot(0,"Ef","dis&&pdgf==2112","");
+     DrawPlot(1,"Ef","dis&&pdgf==2112","perrsame");
      c->cd();
      ls->Clear();
      ls->SetHeader("Final state neutrons 4-momentum / DIS only");
@@ -1699,21 +1678,21 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
      c->Update();
      
      //------ momentum of final state pi0 /DIS
-     ps->NewPage();
+     NewPage(ps);
      c->Clear();
      c->Divide(2,2);
      c->cd(1);
-     gst_0->Draw("pxf","dis&&pdgf==111","");
-     if(gst_1) gst_1->Draw("pxf","dis&&pdgf==111","perrsame");
+     DrawPlot(0,"pxf","dis&&pdgf==111","");
+     DrawPlot(1,"pxf","dis&&pdgf==111","perrsame");
      c->cd(2);
-     gst_0->Draw("pyf","dis&&pdgf==111","");
-     if(gst_1) gst_1->Draw("pyf","dis&&pdgf==111","perrsame");
+     DrawPlot(0,"pyf","dis&&pdgf==111","");
+     DrawPlot(1,"pyf","dis&&pdgf==111","perrsame");
      c->cd(3);
-     gst_0->Draw("pzf","dis&&pdgf==111","");
-     if(gst_1) gst_1->Draw("pzf","dis&&pdgf==111","perrsame");
+     DrawPlot(0,"pzf","dis&&pdgf==111","");
+     DrawPlot(1,"pzf","dis&&pdgf==111","perrsame");
      c->cd(4);
-     gst_0->Draw("Ef","dis&&pdgf==111","");
-     if(gst_1) gst_1->Draw("Ef","dis&&pdgf==111","perrsame");
+     DrawPlot(0,"Ef","dis&&pdgf==111","");
+     DrawPlot(1,"Ef","dis&&pdgf==111","perrsame");
      c->cd();
      ls->Clear();
      ls->SetHeader("Final state pi0's 4-momentum / DIS only");
@@ -1721,21 +1700,21 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
      c->Update();
 
      //------ momentum of final state pi+ /DIS
-     ps->NewPage();
+     NewPage(ps);
      c->Clear();
      c->Divide(2,2);
      c->cd(1);
-     gst_0->Draw("pxf","dis&&pdgf==211","");
-     if(gst_1) gst_1->Draw("pxf","dis&&pdgf==211","perrsame");
+     DrawPlot(0,"pxf","dis&&pdgf==211","");
+     DrawPlot(1,"pxf","dis&&pdgf==211","perrsame");
      c->cd(2);
-     gst_0->Draw("pyf","dis&&pdgf==211","");
-     if(gst_1) gst_1->Draw("pyf","dis&&pdgf==211","perrsame");
+     DrawPlot(0,"pyf","dis&&pdgf==211","");
+     DrawPlot(1,"pyf","dis&&pdgf==211","perrsame");
      c->cd(3);
-     gst_0->Draw("pzf","dis&&pdgf==211","");
-     if(gst_1) gst_1->Draw("pzf","dis&&pdgf==211","perrsame");
+     DrawPlot(0,"pzf","dis&&pdgf==211","");
+     DrawPlot(1,"pzf","dis&&pdgf==211","perrsame");
      c->cd(4);
-     gst_0->Draw("Ef","dis&&pdgf==211","");
-     if(gst_1) gst_1->Draw("Ef","dis&&pdgf==211","perrsame");
+     DrawPlot(0,"Ef","dis&&pdgf==211","");
+     DrawPlot(1,"Ef","dis&&pdgf==211","perrsame");
      c->cd();
      ls->Clear();
      ls->SetHeader("Final state pi+'s 4-momentum / DIS only");
@@ -1743,21 +1722,21 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
      c->Update();
      
      //------ momentum of final state pi+ /DIS
-     ps->NewPage();
+     NewPage(ps);
      c->Clear();
      c->Divide(2,2);
      c->cd(1);
-     gst_0->Draw("pxf","dis&&pdgf==-211","");
-     if(gst_1) gst_1->Draw("pxf","dis&&pdgf==-211","perrsame");
+     DrawPlot(0,"pxf","dis&&pdgf==-211","");
+     DrawPlot(1,"pxf","dis&&pdgf==-211","perrsame");
      c->cd(2);
-     gst_0->Draw("pyf","dis&&pdgf==-211","");
-     if(gst_1) gst_1->Draw("pyf","dis&&pdgf==-211","perrsame");
+     DrawPlot(0,"pyf","dis&&pdgf==-211","");
+     DrawPlot(1,"pyf","dis&&pdgf==-211","perrsame");
      c->cd(3);
-     gst_0->Draw("pzf","dis&&pdgf==-211","");
-     if(gst_1) gst_1->Draw("pzf","dis&&pdgf==-211","perrsame");
+     DrawPlot(0,"pzf","dis&&pdgf==-211","");
+     DrawPlot(1,"pzf","dis&&pdgf==-211","perrsame");
      c->cd(4);
-     gst_0->Draw("Ef","dis&&pdgf==-211","");
-     if(gst_1) gst_1->Draw("Ef","dis&&pdgf==-211","perrsame");
+     DrawPlot(0,"Ef","dis&&pdgf==-211","");
+     DrawPlot(1,"Ef","dis&&pdgf==-211","perrsame");
      c->cd();
      ls->Clear();
      ls->SetHeader("Final state pi-'s 4-momentum/ DIS only");
@@ -1771,7 +1750,7 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
   //
   if(show_primary_hadsyst) {
      
-     ps->NewPage();
+     NewPage(ps);
      c->Clear();
      c->Range(0,0,100,100);
      TPavesText hdrihad(10,40,90,70,3,"tr");
@@ -1788,92 +1767,92 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
      c->Update();
      
      //------ number of prim p
-     ps->NewPage();
-     gst_0->Draw("nip","","");
-     if(gst_1) gst_1->Draw("nip","","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"nip","","");
+     DrawPlot(1,"nip","","perrsame");
      ls->Clear();
      ls->SetHeader("Primary Hadronic System: Number of protons");
      ls->Draw();
      c->Update();
      
      //------ number of prim n
-     ps->NewPage();
-     gst_0->Draw("nin","","");
-     if(gst_1) gst_1->Draw("nin","","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"nin","","");
+     DrawPlot(1,"nin","","perrsame");
      ls->Clear();
      ls->SetHeader("Primary Hadronic System: Number of neutrons");
      ls->Draw();
      c->Update();
      
      //------ number of prim pi+
-     ps->NewPage();
-     gst_0->Draw("nipip","","");
-     if(gst_1) gst_1->Draw("nipip","","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"nipip","","");
+     DrawPlot(1,"nipip","","perrsame");
      ls->Clear();
      ls->SetHeader("Primary Hadronic System: Number of pi+");
      ls->Draw();
      c->Update();
      
      //------ number of prim pi-
-     ps->NewPage();
-     gst_0->Draw("nipim","","");
-     if(gst_1) gst_1->Draw("nipim","","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"nipim","","");
+     DrawPlot(1,"nipim","","perrsame");
      ls->Clear();
      ls->SetHeader("Primary Hadronic System: Number of pi-");
      ls->Draw();
      c->Update();
      
      //------ number of prim pi0
-     ps->NewPage();
-     gst_0->Draw("nipi0","","");
-     if(gst_1) gst_1->Draw("nipi0","","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"nipi0","","");
+     DrawPlot(1,"nipi0","","perrsame");
      ls->Clear();
      ls->SetHeader("Primary Hadronic System: Number of pi0");
      ls->Draw();
      c->Update();
      
      //------ number of prim K+
-     ps->NewPage();
-     gst_0->Draw("nikp","","");
-     if(gst_1) gst_1->Draw("nikp","","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"nikp","","");
+     DrawPlot(1,"nikp","","perrsame");
      ls->Clear();
      ls->SetHeader("Primary Hadronic System: Number of K+");
      ls->Draw();
      c->Update();
      
      //------ number of prim K-
-     ps->NewPage();
-     gst_0->Draw("nikm","","");
-     if(gst_1) gst_1->Draw("nikm","","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"nikm","","");
+     DrawPlot(1,"nikm","","perrsame");
      ls->Clear();
      ls->SetHeader("Primary Hadronic System: Number of K-");
      ls->Draw();
      c->Update();
      
      //------ number of prim K0
-     ps->NewPage();
-     gst_0->Draw("nik0","","");
-     if(gst_1) gst_1->Draw("nik0","","perrsame");
+     NewPage(ps);
+     DrawPlot(0,"nik0","","");
+     DrawPlot(1,"nik0","","perrsame");
      ls->Clear();
      ls->SetHeader("Primary Hadronic System: Number of K0");
      ls->Draw();
      c->Update();
      
      //------ momentum of prim, p
-     ps->NewPage();
+     NewPage(ps);
      c->Divide(2,2);
      c->cd(1);
-     gst_0->Draw("pxi","pdgi==2212","");
-     if(gst_1) gst_1->Draw("pxi","pdgi==2212","perrsame");
+     DrawPlot(0,"pxi","pdgi==2212","");
+     DrawPlot(1,"pxi","pdgi==2212","perrsame");
      c->cd(2);
-     gst_0->Draw("pyi","pdgi==2212","");
-     if(gst_1) gst_1->Draw("pyi","pdgi==2212","perrsame");
+     DrawPlot(0,"pyi","pdgi==2212","");
+     DrawPlot(1,"pyi","pdgi==2212","perrsame");
      c->cd(3);
-     gst_0->Draw("pzi","pdgi==2212","");
-     if(gst_1) gst_1->Draw("pzi","pdgi==2212","perrsame");
+     DrawPlot(0,"pzi","pdgi==2212","");
+     DrawPlot(1,"pzi","pdgi==2212","perrsame");
      c->cd(4);
-     gst_0->Draw("Ei","pdgi==2212","");
-     if(gst_1) gst_1->Draw("Ei","pdgi==2212","perrsame");
+     DrawPlot(0,"Ei","pdgi==2212","");
+     DrawPlot(1,"Ei","pdgi==2212","perrsame");
      c->cd();
      ls->Clear();
      ls->SetHeader("Primary Hadronic System: proton 4-momentum");
@@ -1881,21 +1860,21 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
      c->Update();
      
      //------ momentum of prim. n
-     ps->NewPage();
+     NewPage(ps);
      c->Clear();
      c->Divide(2,2);
      c->cd(1);
-     gst_0->Draw("pxi","pdgi==2112","");
-     if(gst_1) gst_1->Draw("pxi","pdgi==2112","perrsame");
+     DrawPlot(0,"pxi","pdgi==2112","");
+     DrawPlot(1,"pxi","pdgi==2112","perrsame");
      c->cd(2);
-     gst_0->Draw("pyi","pdgi==2112","");
-     if(gst_1) gst_1->Draw("pyi","pdgi==2112","perrsame");
+     DrawPlot(0,"pyi","pdgi==2112","");
+     DrawPlot(1,"pyi","pdgi==2112","perrsame");
      c->cd(3);
-     gst_0->Draw("pzi","pdgi==2112","");
-     if(gst_1) gst_1->Draw("pzi","pdgi==2112","perrsame");
+     DrawPlot(0,"pzi","pdgi==2112","");
+     DrawPlot(1,"pzi","pdgi==2112","perrsame");
      c->cd(4);
-     gst_0->Draw("Ei","pdgi==2112","");
-     if(gst_1) gst_1->Draw("Ei","pdgi==2112","perrsame");
+     DrawPlot(0,"Ei","pdgi==2112","");
+     DrawPlot(1,"Ei","pdgi==2112","perrsame");
      c->cd();
      ls->Clear();
      ls->SetHeader("Primary Hadronic System: neutron 4-momentum");
@@ -1903,21 +1882,21 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
      c->Update();
      
      //------ momentum of prim. pi0
-     ps->NewPage();
+     NewPage(ps);
      c->Clear();
      c->Divide(2,2);
      c->cd(1);
-     gst_0->Draw("pxi","pdgi==111","");
-     if(gst_1) gst_1->Draw("pxi","pdgi==111","perrsame");
+     DrawPlot(0,"pxi","pdgi==111","");
+     DrawPlot(1,"pxi","pdgi==111","perrsame");
      c->cd(2);
-     gst_0->Draw("pyi","pdgi==111","");
-     if(gst_1) gst_1->Draw("pyi","pdgi==111","perrsame");
+     DrawPlot(0,"pyi","pdgi==111","");
+     DrawPlot(1,"pyi","pdgi==111","perrsame");
      c->cd(3);
-     gst_0->Draw("pzi","pdgi==111","");
-     if(gst_1) gst_1->Draw("pzi","pdgi==111","perrsame");
+     DrawPlot(0,"pzi","pdgi==111","");
+     DrawPlot(1,"pzi","pdgi==111","perrsame");
      c->cd(4);
-     gst_0->Draw("Ei","pdgi==111","");
-     if(gst_1) gst_1->Draw("Ei","pdgi==111","perrsame");
+     DrawPlot(0,"Ei","pdgi==111","");
+     DrawPlot(1,"Ei","pdgi==111","perrsame");
      c->cd();
      ls->Clear();
      ls->SetHeader("Primary Hadronic System: pi0's 4-momentum");
@@ -1925,21 +1904,21 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
      c->Update();
 
      //------ momentum of prim pi+
-     ps->NewPage();
+     NewPage(ps);
      c->Clear();
      c->Divide(2,2);
      c->cd(1);
-     gst_0->Draw("pxi","pdgi==211","");
-     if(gst_1) gst_1->Draw("pxi","pdgi==211","perrsame");
+     DrawPlot(0,"pxi","pdgi==211","");
+     DrawPlot(1,"pxi","pdgi==211","perrsame");
      c->cd(2);
-     gst_0->Draw("pyi","pdgi==211","");
-     if(gst_1) gst_1->Draw("pyi","pdgi==211","perrsame");
+     DrawPlot(0,"pyi","pdgi==211","");
+     DrawPlot(1,"pyi","pdgi==211","perrsame");
      c->cd(3);
-     gst_0->Draw("pzi","pdgi==211","");
-     if(gst_1) gst_1->Draw("pzi","pdgi==211","perrsame");
+     DrawPlot(0,"pzi","pdgi==211","");
+     DrawPlot(1,"pzi","pdgi==211","perrsame");
      c->cd(4);
-     gst_0->Draw("Ei","pdgi==211","");
-     if(gst_1) gst_1->Draw("Ei","pdgi==211","perrsame");
+     DrawPlot(0,"Ei","pdgi==211","");
+     DrawPlot(1,"Ei","pdgi==211","perrsame");
      c->cd();
      ls->Clear();
      ls->SetHeader("Primary Hadronic System:pi+'s 4-momentum");
@@ -1947,21 +1926,21 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
      c->Update();
      
      //------ momentum of prim. pi+
-     ps->NewPage();
+     NewPage(ps);
      c->Clear();
      c->Divide(2,2);
      c->cd(1);
-     gst_0->Draw("pxi","pdgi==-211","");
-     if(gst_1) gst_1->Draw("pxi","pdgi==-211","perrsame");
+     DrawPlot(0,"pxi","pdgi==-211","");
+     DrawPlot(1,"pxi","pdgi==-211","perrsame");
      c->cd(2);
-     gst_0->Draw("pyi","pdgi==-211","");
-     if(gst_1) gst_1->Draw("pyi","pdgi==-211","perrsame");
+     DrawPlot(0,"pyi","pdgi==-211","");
+     DrawPlot(1,"pyi","pdgi==-211","perrsame");
      c->cd(3);
-     gst_0->Draw("pzi","pdgi==-211","");
-     if(gst_1) gst_1->Draw("pzi","pdgi==-211","perrsame");
+     DrawPlot(0,"pzi","pdgi==-211","");
+     DrawPlot(1,"pzi","pdgi==-211","perrsame");
      c->cd(4);
-     gst_0->Draw("Ei","pdgi==-211","");
-     if(gst_1) gst_1->Draw("Ei","pdgi==-211","perrsame");
+     DrawPlot(0,"Ei","pdgi==-211","");
+     DrawPlot(1,"Ei","pdgi==-211","perrsame");
      c->cd();
      ls->Clear();
      ls->SetHeader("Primary Hadronic System:  pi-'s 4-momentum");
@@ -1969,14 +1948,55 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
      c->Update();
   }//show?
        
-  ps->Close();
+  delete ls;
+  delete c;
+}
+//_________________________________________________________________________________
+void NewPage(TPostScript * ps)
+{
+  if(ps) ps->NewPage();
+}
+//_________________________________________________________________________________
+void DrawPlot(int isample, string varexp, string selection, string option)
+{
+// Books (when booking) or draws the isample plot of varexp for the selected
+// events, as in TTree::Draw(varexp, selection, option)
 
-  fin_0->Close();
-  delete fin_0;
-  if(fin_1) {
-     fin_1->Close();
-     delete fin_1;
+  if(isample >= gSamples->NModels()) return;
+
+  if(gBooking) {
+    gSamples->Book(varexp, selection);
+    return;
+  }
+
+  TH1D * h = gSamples->Histogram(isample, gSamples->FindPlot(varexp, selection));
+  if(!h) return;
+  if(isample == 0) {
+    h->SetLineColor(kBlack);
+    h->SetLineWidth(3);
+  } else {
+    h->SetLineColor(kRed);
+    h->SetMarkerColor(kRed);
+    h->SetLineWidth(2);
+    h->SetMarkerStyle(20);
+    h->SetMarkerSize(1);
   }
+  h->Draw(option.c_str());
+}
+//_________________________________________________________________________________
+double CountEvents(int isample, string selection)
+{
+// Books (when booking) or returns the number of selected events of isample
+
+  if(isample >= gSamples->NModels()) return 0;
+
+  if(gBooking) {
+    gSamples->Book("1", selection, 2, 0., 2.);
+    return 0;
+  }
+
+  TH1D * h = gSamples->Histogram(isample, gSamples->FindPlot("1", selection));
+  return (h) ? h->GetEntries() : 0;
 }
 //_________________________________________________________________________________
 string OutputFileName(string inpname)
@@ -2002,6 +2022,9 @@ void GetCommandLineArgs(int argc, char ** argv)
 {
   LOG("gevcomp", pNOTICE) << "*** Parsing command line arguments";
 
+  // common run options (eg --thread-pool-size)
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
   CmdLnArgParser parser(argc,argv);
 
   // get GENIE summary ntuple
@@ -2021,13 +2044,19 @@ void GetCommandLineArgs(int argc, char ** argv)
   } else {
     LOG("gevcomp", pNOTICE) << "Unspecified 'reference' event sample";
   }
+
+  // number of events to analyze
+  if( parser.OptionExists('n') ) {
+    gOptNEvents = parser.ArgAsLong('n');
+  }
 }
 //_________________________________________________________________________________
 void PrintSyntax(void)
 {
   LOG("gevcomp", pNOTICE)
     << "\n\n" << "Syntax:" << "\n"
-    << " gevcomp -f sample.root [-n nev] [-r reference_sample.root]\n";
+    << " gevcomp -f sample.root [-n nev] [-r reference_sample.root]"
+    << " [--thread-pool-size n]\n";
 }
 //_________________________________________________________________________________
 bool CheckRootFilename(string filename)
@@ -24,6 +24,7 @@
                    -t target_pdg
                   [-f flux_description]
                   [-o outfile_name]
+                  [--hepmc3 hepmc3_file]
                   [-w]
                   [--seed random_number_seed]
                   [--cross-sections xml_file]
@@ -35,6 +36,10 @@
                   [--mc-job-status-refresh-rate  rate]
                   [--cache-file root_file]
                   [--xml-path config_xml_dir]
+                  [--evg-stats stats_file]
+                  [--xsec-universes alg_keys]
+                  [--reweight-stream]
+                  [--nworkers N]
 
          Options :
            [] Denotes an optional argument.
@@ -70,6 +75,10 @@
                  The general syntax is `-f /full/path/file.root,object_name'
            -o
               Specifies the name of the output file events will be saved in.
+           --hepmc3
+              Also streams the events, as they are generated, to the given
+              HepMC3 (ASCII) file. It can be a named pipe (mkfifo) read by a
+              detector simulation job.
            -w
               Forces generation of weighted events.
               This option is relevant only if a neutrino flux is specified.
@@ -107,6 +116,33 @@
               re-used in subsequent MC jobs.
            --xml-path
               A directory to load XML files from - overrides $GXMLPATH, and $GENIE/config
+           --evg-stats
+              Collects per-module timing and counters (calls, retries) for
+              every event generation thread and probe/target combination,
+              and saves them at the end of the job. A file name ending in
+              `.root' gives a ROOT tree, any other name a JSON file.
+           --xsec-universes
+              Comma-separated list of alternative configurations of the cross
+              section algorithms (eg `genie::LwlynSmithQELCCPXSec/MyTune').
+              For every event, the ratio of the alternative to the nominal
+              differential cross section at the generated kinematics is
+              stored in the event record (GHepRecord::XSecWeights()), in the
+              order of the list. Universes of the algorithms not used for an
+              event get a weight of 1.
+           --reweight-stream
+              Writes, next to the event tree, a tree (grwtree) with a compact
+              fixed-size summary of each event holding the inputs needed for
+              reweighting (interaction summary, kinematics, hit nucleon state
+              and intranuclear hadron history; see NtpMCReweightRecord).
+           --nworkers
+              Generates the events in N processes, forked once the event
+              generation drivers are initialized (so that they share the
+              loaded splines and configuration). Each worker generates its
+              share of the events, with a random number seed derived from
+              the job seed, and the worker outputs are merged in the output
+              file at the end of the job. Not available with --hepmc3. The
+              --evg-stats statistics are saved per worker (stats_file.w<i>).
+              [default: 1]
 
         ***  See the User Manual for more details and examples. ***
 
@@ -128,12 +164,16 @@
 #include <vector>
 #include <map>
 
+#include <unistd.h> // for `_exit`
+
 #if defined(HAVE_FENV_H) && defined(HAVE_FEENABLEEXCEPT)
 #include <fenv.h> // for `feenableexcept`
 #endif
 
 #include <TFile.h>
 #include <TTree.h>
+#include <TParameter.h>
+#include <TMath.h>
 #include <TSystem.h>
 #include <TVector3.h>
 #include <TH1.h>
@@ -142,6 +182,7 @@
 #include "Framework/Conventions/XmlParserStatus.h"
 #include "Framework/Conventions/GBuild.h"
 #include "Framework/Conventions/Controls.h"
+#include "Framework/EventGen/EVGThreadStats.h"
 #include "Framework/EventGen/EventRecord.h"
 #include "Framework/EventGen/GFluxI.h"
 #include "Framework/EventGen/GEVGDriver.h"
@@ -150,6 +191,7 @@
 #include "Framework/Interaction/Interaction.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Ntuple/NtpWriter.h"
+#include "Framework/Ntuple/HepMC3Writer.h"
 #include "Framework/Ntuple/NtpMCFormat.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Numerical/Spline.h"
@@ -194,6 +236,10 @@ GFluxI *        TH1FluxDriver           (void);
 
 void GenerateEventsAtFixedInitState (void);
 
+void SaveEVGStats       (void);
+void StartWorkers       (void);
+void FinishWorker       (string outfile, Long64_t nflux = -1);
+
 //Default options (override them using the command line arguments):
 int           kDefOptNevents   = 0;       // n-events to generate
 NtpMCFormat_t kDefOptNtpFormat = kNFGHEP; // ntuple format
@@ -213,6 +259,13 @@ long int        gOptRanSeed;      // random number seed
 string          gOptInpXSecFile;  // cross-section splines
 string          gOptOutFileName;  // Optional outfile name
 string          gOptStatFileName; // Status file name, set if gOptOutFileName was set.
+string          gOptHepMC3FileName; // Optional HepMC3 output file name
+int             gOptNWorkers = 1; // number of event generation processes
+
+// multi-process generation: index and share of events of this worker
+int             gWorker      = 0;
+int             gFirstEvent  = 0;
+int             gLastEvent   = 0;
 
 //____________________________________________________________________________
 int main(int argc, char ** argv)
@@ -279,6 +332,13 @@ void GenerateEventsAtFixedInitState(void)
   evg_driver.SetUnphysEventMask(*RunOpt::Instance()->UnphysEventMask());
   evg_driver.Configure(init_state);
 
+  // Select interactions from the cumulative xsecs at the fixed energy
+  // (built only if all the xsec splines were loaded; exact at that energy)
+  evg_driver.CreateChannelTable(1, Ev, Ev);
+
+  // Fork the event generation workers, if requested
+  StartWorkers();
+
   // Initialize an Ntuple Writer
   NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
 
@@ -286,8 +346,20 @@ void GenerateEventsAtFixedInitState(void)
   if (!gOptOutFileName.empty()){
     ntpw.CustomizeFilename(gOptOutFileName);
   }
+  string outfile = ntpw.Filename();
+  if (gOptNWorkers > 1){
+    ntpw.CustomizeFilename(utils::app_init::WorkerFilename(outfile, gWorker));
+  }
   ntpw.Initialize();
 
+  // Initialize a HepMC3 writer, if requested
+  HepMC3Writer * hepmc3w = 0;
+  if (!gOptHepMC3FileName.empty()){
+    hepmc3w = new HepMC3Writer(gOptRunNu);
+    hepmc3w->CustomizeFilename(gOptHepMC3FileName);
+    hepmc3w->Initialize();
+  }
+
 
   // Create an MC Job Monitor
   GMCJMonitor mcjmonitor(gOptRunNu);
@@ -297,15 +369,18 @@ void GenerateEventsAtFixedInitState(void)
   if (!gOptStatFileName.empty()){
     mcjmonitor.CustomizeFilename(gOptStatFileName);
   }
-
+  if (gOptNWorkers > 1){
+    mcjmonitor.CustomizeFilename(
+       utils::app_init::WorkerFilename(mcjmonitor.Filename(), gWorker));
+  }
 
   LOG("gevgen", pNOTICE)
-    << "\n ** Will generate " << gOptNevents << " events for \n"
+    << "\n ** Will generate " << gLastEvent-gFirstEvent << " events for \n"
     << init_state << " at Ev = " << Ev << " GeV";
 
   // Generate events / print the GHEP record / add it to the ntuple
-  int ievent = 0;
-  while (ievent < gOptNevents) {
+  int ievent = gFirstEvent;
+  while (ievent < gLastEvent) {
      LOG("gevgen", pNOTICE)
         << " *** Generating event............ " << ievent;
 
@@ -323,6 +398,7 @@ void GenerateEventsAtFixedInitState(void)
 
      // add event at the output ntuple, refresh the mc job monitor & clean up
      ntpw.AddEventRecord(ievent, event);
+     if(hepmc3w) hepmc3w->AddEventRecord(ievent, event);
      mcjmonitor.Update(ievent,event);
      ievent++;
      delete event;
@@ -330,6 +406,104 @@ void GenerateEventsAtFixedInitState(void)
 
   // Save the generated MC events
   ntpw.Save();
+  if(hepmc3w) {
+    hepmc3w->Save();
+    delete hepmc3w;
+  }
+
+  // Save per-module event generation statistics, if requested
+  SaveEVGStats();
+
+  // Merge the worker outputs, if generating with many processes
+  FinishWorker(outfile);
+}
+//____________________________________________________________________________
+void SaveEVGStats(void)
+{
+  string statsfile = RunOpt::Instance()->EVGStatsFile();
+  if ( statsfile.empty() ) return;
+
+  if ( gOptNWorkers > 1 ) {
+    statsfile = utils::app_init::WorkerFilename(statsfile, gWorker);
+  }
+  EVGThreadStats::Instance()->Save(statsfile);
+}
+//____________________________________________________________________________
+void StartWorkers(void)
+{
+  gWorker     = utils::app_init::ForkWorkers(gOptNWorkers);
+  gFirstEvent = 0;
+  gLastEvent  = gOptNevents;
+  if ( gOptNWorkers <= 1 ) return;
+
+  // split the events as evenly as possible; the event numbers stay unique
+  int nshare = gOptNevents / gOptNWorkers;
+  int nextra = gOptNevents % gOptNWorkers;
+  gFirstEvent = gWorker * nshare + TMath::Min(gWorker, nextra);
+  gLastEvent  = gFirstEvent + nshare + (gWorker < nextra ? 1 : 0);
+
+  LOG("gevgen", pNOTICE)
+    << "Worker " << gWorker << " generates events ["
+    << gFirstEvent << ", " << gLastEvent << ")";
+}
+//____________________________________________________________________________
+void FinishWorker(string outfile, Long64_t nflux)
+{
+  if ( gOptNWorkers <= 1 ) return;
+
+  // the forked workers are done: leave without running the exit handlers
+  // (they would eg all write out the cache file)
+  if ( gWorker > 0 ) {
+    Messenger::Instance()->Flush();
+    _exit(0);
+  }
+
+  if ( ! utils::app_init::WaitForWorkers() ) {
+    LOG("gevgen", pFATAL)
+      << "Event generation worker(s) failed - The worker outputs are kept in "
+      << outfile << ".w*";
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  LOG("gevgen", pNOTICE)
+    << "Merging the outputs of " << gOptNWorkers << " workers in " << outfile;
+
+  NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
+  ntpw.CustomizeFilename(outfile);
+  ntpw.Initialize();
+
+  Long64_t nev = 0;
+  Long64_t nflux_total = 0;
+  for ( int iw = 0; iw < gOptNWorkers; iw++ ) {
+    string wfile = utils::app_init::WorkerFilename(outfile, iw);
+    TFile fin(wfile.c_str(), "READ");
+    TTree * tree = dynamic_cast<TTree *> (fin.Get("gtree"));
+    if ( ! tree ) {
+      LOG("gevgen", pFATAL) << "No event tree in worker output: " << wfile;
+      gAbortingInErr = true;
+      exit(1);
+    }
+    nev += ntpw.EventTree()->CopyEntries(tree, -1, "fast");
+    TTree * rwtree = dynamic_cast<TTree *> (fin.Get("grwtree"));
+    if ( rwtree && ntpw.ReweightTree() ) {
+      ntpw.ReweightTree()->CopyEntries(rwtree, -1, "fast");
+    }
+    TParameter<Long64_t> * wnflux = dynamic_cast<TParameter<Long64_t> *> (
+       tree->GetUserInfo()->FindObject("NFluxNeutrinos"));
+    if ( wnflux ) nflux_total += wnflux->GetVal();
+    fin.Close();
+    gSystem->Unlink(wfile.c_str());
+  }
+  if ( nflux >= 0 ) {
+    ntpw.EventTree()->GetUserInfo()->Add(
+       new TParameter<Long64_t>("NFluxNeutrinos", nflux_total));
+    LOG("gevgen", pNOTICE)
+      << "Number of flux neutrinos thrown (all workers): " << nflux_total;
+  }
+  ntpw.Save();
+
+  LOG("gevgen", pNOTICE) << "Merged " << nev << " events in " << outfile;
 }
 //____________________________________________________________________________
 
@@ -352,6 +526,9 @@ void GenerateEventsUsingFluxOrTgtMix(void)
   if(!gOptWeighted)
         mcj_driver->ForceSingleProbScale();
 
+  // Fork the event generation workers, if requested
+  StartWorkers();
+
   // Initialize an Ntuple Writer to save GHEP records into a TTree
   NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
 
@@ -359,8 +536,20 @@ void GenerateEventsUsingFluxOrTgtMix(void)
   if (!gOptOutFileName.empty()){
     ntpw.CustomizeFilename(gOptOutFileName);
   }
+  string outfile = ntpw.Filename();
+  if (gOptNWorkers > 1){
+    ntpw.CustomizeFilename(utils::app_init::WorkerFilename(outfile, gWorker));
+  }
   ntpw.Initialize();
 
+  // Initialize a HepMC3 writer, if requested
+  HepMC3Writer * hepmc3w = 0;
+  if (!gOptHepMC3FileName.empty()){
+    hepmc3w = new HepMC3Writer(gOptRunNu);
+    hepmc3w->CustomizeFilename(gOptHepMC3FileName);
+    hepmc3w->Initialize();
+  }
+
   // Create an MC Job Monitor
   GMCJMonitor mcjmonitor(gOptRunNu);
   mcjmonitor.SetRefreshRate(RunOpt::Instance()->MCJobStatusRefreshRate());
@@ -369,11 +558,15 @@ void GenerateEventsUsingFluxOrTgtMix(void)
   if (!gOptStatFileName.empty()){
     mcjmonitor.CustomizeFilename(gOptStatFileName);
   }
+  if (gOptNWorkers > 1){
+    mcjmonitor.CustomizeFilename(
+       utils::app_init::WorkerFilename(mcjmonitor.Filename(), gWorker));
+  }
 
 
   // Generate events / print the GHEP record / add it to the ntuple
-  int ievent = 0;
-  while ( ievent < gOptNevents) {
+  int ievent = gFirstEvent;
+  while ( ievent < gLastEvent) {
 
      LOG("gevgen", pNOTICE) << " *** Generating event............ " << ievent;
 
@@ -384,13 +577,32 @@ void GenerateEventsUsingFluxOrTgtMix(void)
 
      // add event at the output ntuple, refresh the mc job monitor & clean-up
      ntpw.AddEventRecord(ievent, event);
+     if(hepmc3w) hepmc3w->AddEventRecord(ievent, event);
      mcjmonitor.Update(ievent,event);
      ievent++;
      delete event;
   }
 
+  // Store the number of flux neutrinos thrown by this worker, summed over
+  // the workers when merging their outputs
+  Long64_t nflux = mcj_driver->NFluxNeutrinos();
+  if (gOptNWorkers > 1){
+    ntpw.EventTree()->GetUserInfo()->Add(
+       new TParameter<Long64_t>("NFluxNeutrinos", nflux));
+  }
+
   // Save the generated MC events
   ntpw.Save();
+  if(hepmc3w) {
+    hepmc3w->Save();
+    delete hepmc3w;
+  }
+
+  // Save per-module event generation statistics, if requested
+  SaveEVGStats();
+
+  // Merge the worker outputs, if generating with many processes
+  FinishWorker(outfile, nflux);
 
   delete flux_driver;
   delete geom_driver;
@@ -603,6 +815,26 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptStatFileName .append(".status");
   }
 
+  // HepMC3 output file name
+  if( parser.OptionExists("hepmc3") ) {
+    LOG("gevgen", pINFO) << "Reading HepMC3 output file name";
+    gOptHepMC3FileName = parser.ArgAsString("hepmc3");
+  }
+
+  // number of event generation processes
+  if( parser.OptionExists("nworkers") ) {
+    LOG("gevgen", pINFO) << "Reading number of event generation workers";
+    gOptNWorkers = TMath::Max(1, parser.ArgAsInt("nworkers"));
+  } else {
+    gOptNWorkers = 1;
+  }
+  if( gOptNWorkers > 1 && ! gOptHepMC3FileName.empty() ) {
+    LOG("gevgen", pFATAL)
+      << "The --hepmc3 output is not available with --nworkers > 1";
+    gAbortingInErr = true;
+    exit(1);
+  }
+
   // flux functional form
   bool using_flux = false;
   if( parser.OptionExists('f') ) {
@@ -737,6 +969,8 @@ void GetCommandLineArgs(int argc, char ** argv)
   }
   LOG("gevgen", pNOTICE)
        << "Number of events requested: " << gOptNevents;
+  LOG("gevgen", pNOTICE)
+       << "Number of event generation workers: " << gOptNWorkers;
   if(gOptInpXSecFile.size() > 0) {
      LOG("gevgen", pNOTICE)
        << "Using cross-section splines read from: " << gOptInpXSecFile;
@@ -785,6 +1019,7 @@ void PrintSyntax(void)
     << "\n               -t target_pdg "
     << "\n              [-f flux_description]"
     << "\n              [-o outfile_name]"
+    << "\n              [--hepmc3 hepmc3_file]"
     << "\n              [-w]"
     << "\n              [--seed random_number_seed]"
     << "\n              [--cross-sections xml_file]"
@@ -795,6 +1030,10 @@ void PrintSyntax(void)
     << "\n              [--mc-job-status-refresh-rate  rate]"
     << "\n              [--cache-file root_file]"
     << "\n              [--xml-path config_xml_dir]"
+    << "\n              [--evg-stats stats_file]"
+    << "\n              [--xsec-universes alg_keys]"
+    << "\n              [--reweight-stream]"
+    << "\n              [--nworkers N]"
     << "\n";
 }
 //____________________________________________________________________________
@@ -153,6 +153,7 @@
 #include "Framework/Conventions/Controls.h"
 #include "Framework/Conventions/Constants.h"
 #include "Framework/Conventions/Units.h"
+#include "Framework/EventGen/EVGThreadStats.h"
 #include "Framework/EventGen/EventRecord.h"
 #include "Framework/EventGen/GFluxI.h"
 #include "Framework/EventGen/GEVGDriver.h"
@@ -366,6 +367,11 @@ void GenerateEventsAtFixedInitState(void)
 
   // Save the generated MC events
   ntpw.Save();
+
+  // Save per-module event generation statistics, if requested
+  if ( ! RunOpt::Instance()->EVGStatsFile().empty() ) {
+    EVGThreadStats::Instance()->Save(RunOpt::Instance()->EVGStatsFile());
+  }
 }
 //____________________________________________________________________________
 
@@ -428,6 +434,11 @@ void GenerateEventsUsingFluxOrTgtMix(void)
   // Save the generated MC events
   ntpw.Save();
 
+  // Save per-module event generation statistics, if requested
+  if ( ! RunOpt::Instance()->EVGStatsFile().empty() ) {
+    EVGThreadStats::Instance()->Save(RunOpt::Instance()->EVGStatsFile());
+  }
+
   delete flux_driver;
   delete geom_driver;
   delete mcj_driver;;
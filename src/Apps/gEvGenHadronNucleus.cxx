@@ -10,6 +10,7 @@
            gevgen_hadron [-n nev] -p probe -t tgt [-r run#] -k KE
                          [-f flux] [-o prefix] [-m mode]
                          [--seed random_number_seed]
+                         [--xsec-scan nke]
                          [--message-thresholds xml_file]
                          [--event-record-print-level level]
                          [--mc-job-status-refresh-rate  rate]
@@ -43,6 +44,15 @@
               INTRANUKE mode <hA, hN> (default: hA)
            --seed
               Random number seed.
+           --xsec-scan
+              Instead of generating events, computes the hadron + nucleus
+              cross sections at nke kinetic energies uniformly spread over
+              the range given with -k. The cross sections are integrated
+              directly from the INTRANUKE mean free path (and, in hA mode,
+              from the fate fractions) and are written out as a text table,
+              <prefix>.<run>.xsec.txt. The kinetic energy points are spread
+              over the --thread-pool-size threads.
+              Only available for the hA2018 and hN2018 modes.
            --message-thresholds
               Allows users to customize the message stream thresholds.
               The thresholds are specified using an XML file.
@@ -67,6 +77,11 @@
              distributed as f(KE) = 1/KE in the [165 MeV, 1200 MeV] range:
              % ghAevgen -n gevgen_hadron -p 211 -t 1000260560 -k 0.165,1.200 -f '1/x'
 
+         (4) Compute the pi^{+}+Fe56 hA2018 cross sections at 100 kinetic
+             energies in the [10 MeV, 1200 MeV] range, without generating events:
+             % gevgen_hadron -p 211 -t 1000260560 -k 0.010,1.200 -m hA2018
+                             --xsec-scan 100
+
 \authors  Steve Dytman, Minsuk Kim and Aaron Meyer
           University of Pittsburgh
 
@@ -85,6 +100,9 @@
 
 #include <cassert>
 #include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
 
 // ROOT
 #include "TSystem.h"
@@ -92,10 +110,12 @@
 #include "TTree.h"
 #include "TH1D.h"
 #include "TF1.h"
+#include "TMath.h"
 
 #include "Framework/Conventions/GBuild.h"
 #include "Framework/Algorithm/AlgFactory.h"
 #include "Framework/Conventions/Controls.h"
+#include "Framework/Conventions/Units.h"
 #include "Framework/EventGen/EventRecord.h"
 #include "Framework/EventGen/GMCJMonitor.h"
 #include "Framework/EventGen/EventRecordVisitorI.h"
@@ -110,27 +130,29 @@
 #include "Framework/Numerical/Spline.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGLibrary.h"
+#include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/Utils/AppInit.h"
 #include "Framework/Utils/StringUtils.h"
 #include "Framework/Utils/PrintUtils.h"
 #include "Framework/Utils/XSecSplineList.h"
 #include "Framework/Utils/RunOpt.h"
 #include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/ThreadPool.h"
 
-#include "Physics/HadronTransport/INukeHadroFates.h"
-#include "Physics/HadronTransport/INukeUtils.h"
+#include "Physics/HadronTransport/INukeHadroFates2018.h"
+#include "Physics/HadronTransport/Intranuke2018.h"
+#include "Physics/HadronTransport/HAIntranuke2018.h"
 
 using namespace genie;
 using namespace genie::controls;
 
-using namespace genie::utils::intranuke;
-
 // Function prototypes
 void                        GetCommandLineArgs    (int argc, char ** argv);
 const EventRecordVisitorI * GetIntranuke          (void);
 double                      GenProbeKineticEnergy (void);
 EventRecord *               InitializeEvent       (void);
 void                        BuildSpectrum         (void);
+void                        ScanXSec              (void);
 void                        PrintSyntax           (void);
 
 // Default options
@@ -152,6 +174,7 @@ string   gOptFlux;             // input flux (function or flux file)
 string   gOptEvFilePrefix;     // event file prefix
 bool     gOptUsingFlux=false;  // using kinetic energy distribution?
 long int gOptRanSeed ;         // random number seed
+int      gOptXSecScanNKE = 0;  // n-KE points of the cross section scan (0: generate events)
 
 TH1D * gSpectrum  = 0;
 
@@ -173,6 +196,12 @@ int main(int argc, char ** argv)
   utils::app_init::RandGen(gOptRanSeed);
   GHepRecord::SetPrintLevel(RunOpt::Instance()->EventRecordPrintLevel());
 
+  // Compute the cross sections without generating events, if required
+  if(gOptXSecScanNKE > 0) {
+    ScanXSec();
+    return 0;
+  }
+
   // Build the incident hadron kinetic energy spectrum, if required
   BuildSpectrum();
 
@@ -281,6 +310,85 @@ const EventRecordVisitorI * GetIntranuke(void)
   return intranuke;
 }
 //____________________________________________________________________________
+void ScanXSec(void)
+{
+// Computes the hadron + nucleus cross sections on a kinetic energy grid
+// directly from the INTRANUKE mean free path and fate fractions.
+// The kinetic energy points are spread over the thread pool.
+
+  const Intranuke2018 * inuke =
+      dynamic_cast<const Intranuke2018 *> (GetIntranuke());
+  if(!inuke) {
+    LOG("gevgen_hadron", pFATAL)
+      << "The cross section scan is not available for mode: "
+      << gOptMode << " - Exiting";
+    gAbortingInErr = true;
+    exit(1);
+  }
+  bool is_ha = (dynamic_cast<const HAIntranuke2018 *> (inuke) != 0);
+
+  double kemin = (gOptProbeKEmin < 0) ? gOptProbeKE : gOptProbeKEmin;
+  double kemax = (gOptProbeKEmax < 0) ? gOptProbeKE : gOptProbeKEmax;
+  int    nke   = (kemax > kemin) ? gOptXSecScanNKE : 1;
+  double dke   = (nke > 1) ? (kemax-kemin)/(nke-1) : 0.;
+
+  int A = pdg::IonPdgCodeToA(gOptTgtPdgCode);
+  int Z = pdg::IonPdgCodeToZ(gOptTgtPdgCode);
+
+  const int nf = HAIntranuke2018::kNFatesHA;
+  vector<double> xsec (nke,    0.);
+  vector<double> frac (nke*nf, 0.);
+
+  ThreadPool::Instance()->ParallelFor(nke, [&] (int i, unsigned int worker) {
+     // algorithm instances are per-thread (see AlgFactory)
+     const Intranuke2018 * in = (worker == 0) ? inuke :
+         dynamic_cast<const Intranuke2018 *> (GetIntranuke());
+     double ke = kemin + i*dke;
+     xsec[i] = in->ReactionXSec(gOptProbePdgCode, ke, A, Z);
+     if(is_ha) {
+       dynamic_cast<const HAIntranuke2018 *> (in)->FateFractions(
+          gOptProbePdgCode, ke, A, &frac[i*nf]);
+     }
+  });
+
+  // fates reported in hA mode
+  const int nfsel = 5;
+  const INukeFateHA_t fates[nfsel] = {
+    kIHAFtCEx, kIHAFtInelas, kIHAFtAbs, kIHAFtPiProd, kIHAFtCmp };
+
+  std::ostringstream fname;
+  fname << gOptEvFilePrefix << "." << gOptRunNu << ".xsec.txt";
+  std::ofstream out(fname.str().c_str());
+
+  out << "# " << gOptMode << ": probe = " << gOptProbePdgCode
+      << ", target = " << gOptTgtPdgCode << "\n";
+  out << "# KE (GeV)    xsec (mb)";
+  if(is_ha) {
+    for(int j=0; j<nfsel; j++) {
+      out << "    " << INukeHadroFates::AsString(fates[j]);
+    }
+  }
+  out << "\n";
+
+  for(int i=0; i<nke; i++) {
+    double ke = kemin + i*dke;
+    out << std::setw(10) << ke << "  "
+        << std::setw(12) << xsec[i]/units::mb;
+    if(is_ha) {
+      for(int j=0; j<nfsel; j++) {
+        out << "  " << std::setw(12) << xsec[i]*frac[i*nf+fates[j]]/units::mb;
+      }
+    }
+    out << "\n";
+    LOG("gevgen_hadron", pNOTICE)
+       << "KE = " << ke << " GeV: xsec = " << xsec[i]/units::mb << " mb";
+  }
+  out.close();
+
+  LOG("gevgen_hadron", pNOTICE)
+     << "Wrote the cross section scan to: " << fname.str();
+}
+//____________________________________________________________________________
 EventRecord * InitializeEvent(void)
 {
 // Initialize event record. Inserting the probe and target particles.
@@ -530,6 +638,11 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptRanSeed = -1;
   }
 
+  // cross section scan
+  if( parser.OptionExists("xsec-scan") ) {
+    LOG("gevgen_hadron", pINFO) << "Reading number of cross section scan points";
+    gOptXSecScanNKE = parser.ArgAsInt("xsec-scan");
+  }
 
   LOG("gevgen_hadron", pNOTICE)
      << "\n"
@@ -539,6 +652,9 @@ void GetCommandLineArgs(int argc, char ** argv)
   LOG("gevgen_hadron", pNOTICE) << "Random number seed = " << gOptRanSeed;
   LOG("gevgen_hadron", pNOTICE) << "Mode               = " << gOptMode;
   LOG("gevgen_hadron", pNOTICE) << "Number of events   = " << gOptNevents;
+  if(gOptXSecScanNKE > 0) {
+    LOG("gevgen_hadron", pNOTICE) << "X-section scan     = " << gOptXSecScanNKE << " KE points";
+  }
   LOG("gevgen_hadron", pNOTICE) << "Probe PDG code     = " << gOptProbePdgCode;
   LOG("gevgen_hadron", pNOTICE) << "Target PDG code    = " << gOptTgtPdgCode;
   if(gOptProbeKEmin<0 && gOptProbeKEmax<0) {
@@ -567,6 +683,7 @@ void PrintSyntax(void)
     << "   gevgen_hadron [-r run] [-n nev] -p hadron_pdg -t tgt_pdg -k KE [-m mode] "
     << "                 [-f flux] "
     << "                 [--seed random_number_seed]"
+    << "                 [--xsec-scan nke]"
     << "                 [--message-thresholds xml_file]"
     << "                 [--event-record-print-level level]"
     << "                 [--mc-job-status-refresh-rate rate]"
@@ -276,6 +276,7 @@
 
 #include "Framework/Algorithm/AlgConfigPool.h"
 #include "Framework/Conventions/Units.h"
+#include "Framework/EventGen/EVGThreadStats.h"
 #include "Framework/EventGen/EventRecord.h"
 #include "Framework/EventGen/GFluxI.h"
 #include "Framework/EventGen/GMCJDriver.h"
@@ -403,7 +404,7 @@ int main(int argc, char ** argv)
   utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
   utils::app_init::CacheFile(RunOpt::Instance()->CacheFile());
   utils::app_init::RandGen(gOptRanSeed);
-  utils::app_init::XSecTable(gOptInpXSecFile, false);
+  utils::app_init::XSecTable(gOptInpXSecFile, false, true);
 
   // Set GHEP print level
   GHepRecord::SetPrintLevel(RunOpt::Instance()->EventRecordPrintLevel());
@@ -714,6 +715,11 @@ int main(int argc, char ** argv)
   // Save the generated event tree & close the output file
   ntpw.Save();
 
+  // Save per-module event generation statistics, if requested
+  if ( ! RunOpt::Instance()->EVGStatsFile().empty() ) {
+    EVGThreadStats::Instance()->Save(RunOpt::Instance()->EVGStatsFile());
+  }
+
   // Clean-up
   delete geom_driver;
   delete flux_driver;
@@ -37,6 +37,7 @@
                    [-o output_file]
                    [--message-thresholds xmfile]
                    [--event-record-print-level level]
+                   [--thread-pool-size n]
 
          Options:
 
@@ -82,6 +83,14 @@
           --event-record-print-level
               Allows users to set the level of information shown when the event
               record is printed in the screen. See GHepRecord::Print().
+          --thread-pool-size
+              Number of threads scanning the input files concurrently
+              (default: $GTHREADPOOLSIZE or 1).
+
+         Event trees written by this GENIE version carry an index of event
+         summary columns (see NtpMCEventIndex): for those files, only the
+         index is read to select the picked events and only the selected
+         event records are read back. Older files are scanned in full.
 
          Examples:
 
@@ -105,6 +114,7 @@
 #include <cassert>
 #include <string>
 #include <sstream>
+#include <vector>
 
 #include <TSystem.h>
 #include <TFile.h>
@@ -117,8 +127,10 @@
 #include "Framework/GHEP/GHepStatus.h"
 #include "Framework/GHEP/GHepParticle.h"
 #include "Framework/GHEP/GHepUtils.h"
+#include "Framework/Interaction/InteractionType.h"
 #include "Framework/Ntuple/NtpMCFormat.h"
 #include "Framework/Ntuple/NtpMCTreeHeader.h"
+#include "Framework/Ntuple/NtpMCEventIndex.h"
 #include "Framework/Ntuple/NtpMCEventRecord.h"
 #include "Framework/Ntuple/NtpWriter.h"
 #include "Framework/Messenger/Messenger.h"
@@ -129,15 +141,18 @@
 #include "Framework/Utils/CmdLnArgParser.h"
 #include "Framework/Utils/SystemUtils.h"
 #include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/ThreadPool.h"
 
 using std::string;
 using std::ostringstream;
+using std::vector;
 
 using namespace genie;
 
 // func prototypes
 void   GetCommandLineArgs (int argc, char ** argv);
 void   RunCherryPicker    (void);
+void   SelectEvents       (string filename, vector<Long64_t> & entries);
 bool   AcceptEvent        (const EventRecord & event);
 void   PrintSyntax        (void);
 string DefaultOutputFile  (void);
@@ -158,6 +173,18 @@ typedef enum EGPickTopo {
 
 } GPickTopo_t;
 
+// what the picked topologies are decided on
+struct FinalState {
+  int  nupdg;   ///< probe pdg code
+  bool iscc;    ///< is weak CC?
+  bool isnc;    ///< is weak NC?
+  int  NfPip;   ///< number of \pi^+'s  in final state
+  int  NfPim;   ///< number of \pi^-'s  in final state
+  int  NfPi0;   ///< number of \pi^0's  in final state
+  int  NfHype;  ///< number of hyperons in final state
+};
+bool   AcceptTopology     (const FinalState & fs);
+
 // input options (from command line arguments):
 string      gOptInpFileNames;  ///< input file name
 string      gOptOutFileName;   ///< output file name
@@ -178,10 +205,41 @@ int main(int argc, char ** argv)
 //____________________________________________________________________________________
 void RunCherryPicker(void)
 {
+  // Load input trees. More than one trees can be loaded here if a wildcard was
+  // specified with -f (eg -f /data/myfiles/genie/*.ghep.root)
+
+  TChain gchain;
+  gchain.Add(gOptInpFileNames.c_str());
+
+  TObjArray * file_array = gchain.GetListOfFiles();
+  int nfiles = file_array->GetEntries();
+  LOG("gevpick", pFATAL) 
+      << "Processing " << nfiles
+      << (nfiles==1 ? " file " : " files ");
+
+  vector<string> filenames;
+  TIter next_file(file_array);
+  TChainElement *chEl=0;
+  while (( chEl=(TChainElement*)next_file() )) {
+     filenames.push_back(chEl->GetTitle());
+  }
+
+  //
+  // Scan the input files concurrently and select the events to pick
+  //
+
+  vector< vector<Long64_t> > selected(filenames.size());
+  ThreadPool::Instance()->ParallelFor(filenames.size(),
+     [&] (int ifile, unsigned int /*worker*/) {
+        SelectEvents(filenames[ifile], selected[ifile]);
+  });
+
+  //
   // Create an NtpWriter for writing out a tree with the cherry-picked events
   // Add 2 additional branches to the output event tree to save the original filename
   // and the event number in the original file (so that all info can be traced back 
   // to its source).
+  //
 
   NtpWriter ntpw(kNFGHEP, 0);
   ntpw.CustomizeFilename(gOptOutFileName);
@@ -192,74 +250,41 @@ void RunCherryPicker(void)
   ntpw.EventTree()->Branch("orig_evtnum", &brOrigEvtNum, "brOrigEvtNum/L");
   Long64_t iev_glob = 0;
 
-  // Load input trees. More than one trees can be loaded here if a wildcard was
-  // specified with -f (eg -f /data/myfiles/genie/*.ghep.root)
-
-  TChain gchain;
-  gchain.Add(gOptInpFileNames.c_str());
-
-  TObjArray * file_array = gchain.GetListOfFiles();
-  int nfiles = file_array->GetEntries();
-  LOG("gevpick", pFATAL) 
-      << "Processing " << nfiles
-      << (nfiles==1 ? " file " : " files ");
-
   //
-  // Loop over input event files
+  // Read the selected events only, file by file, and write them out
   //
 
-  TIter next_file(file_array);
-  TChainElement *chEl=0;
+  for(unsigned int ifile = 0; ifile < filenames.size(); ifile++) {
 
-  while (( chEl=(TChainElement*)next_file() )) {
+     const vector<Long64_t> & entries = selected[ifile];
+     if(entries.empty()) continue;
 
-     TFile fin(chEl->GetTitle(),"read");
+     TFile fin(filenames[ifile].c_str(),"read");
      TTree * ghep_tree = 
         dynamic_cast <TTree *> ( fin.Get("gtree")  );
 
-     if(!ghep_tree) {
-        LOG("gevpick", pWARN) 
-           << "No GHEP tree found in " << chEl->GetTitle();
-        LOG("gevpick", pWARN) 
-           << "Skipping to next file...";
-        continue;
-     }
-
-     NtpMCEventRecord * mcrec = 0;
-     ghep_tree->SetBranchAddress("gmcrec", &mcrec);
-     if (!mcrec) {
-       LOG("gevpick", pERROR) << "Null MC record";
-       return;
-     }
-     Long64_t nmax = ghep_tree->GetEntries();
-     LOG("gevpick", pNOTICE) 
-        << "* Analyzing: " << nmax 
-        << " events from GHEP tree in file: " << chEl->GetTitle();
-
      NtpMCTreeHeader * thdr = 
         dynamic_cast <NtpMCTreeHeader *> ( fin.Get("header") );
      LOG("gevpick", pNOTICE) 
           << "Input tree header: " << *thdr;
 
-     //
-     // Loop over events in current file
-     //
+     NtpMCEventRecord * mcrec = 0;
+     ghep_tree->SetBranchAddress("gmcrec", &mcrec);
 
-     for(Long64_t iev = 0; iev < nmax; iev++) {
+     for(unsigned int i = 0; i < entries.size(); i++) {
+       Long64_t iev = entries[i];
        ghep_tree->GetEntry(iev);
-       NtpMCRecHeader rec_header = mcrec->hdr;
-       EventRecord &  event      = *(mcrec->event);
-       LOG("gevpick", pDEBUG) << rec_header;
+       EventRecord & event = *(mcrec->event);
+       LOG("gevpick", pDEBUG) << mcrec->hdr;
        LOG("gevpick", pDEBUG) << event;
-       if(AcceptEvent(event)) {
-          brOrigFilename->SetString(chEl->GetTitle());
-          brOrigEvtNum = iev;
-          ntpw.AddEventRecord( iev_glob, &event );
-          iev_glob++;
-       }
+       brOrigFilename->SetString(filenames[ifile].c_str());
+       brOrigEvtNum = iev;
+       ntpw.AddEventRecord( iev_glob, &event );
+       iev_glob++;
        mcrec->Clear();
-
-    } // event loop (current file)
+     }
+     ghep_tree->ResetBranchAddresses();
+     delete mcrec;
   }// file loop
 
   // save the cherry-picked MC events
@@ -268,38 +293,79 @@ void RunCherryPicker(void)
   LOG("gevpick", pFATAL) << "Done!";
 }
 //____________________________________________________________________________________
-bool AcceptEvent(const EventRecord & event)
+void SelectEvents(string filename, vector<Long64_t> & entries)
 {
-  if ( gPickedTopology == kPtAll       ) return true;
-  if ( gPickedTopology == kPtUndefined ) return false;
+// Find the entries of the input file with events of the picked topology.
+// Files written with an NtpMCEventIndex are selected reading the index
+// columns only; older files are selected reading all event records.
+
+  TFile fin(filename.c_str(),"read");
+  TTree * ghep_tree = 
+     dynamic_cast <TTree *> ( fin.Get("gtree")  );
+
+  if(!ghep_tree) {
+     LOG("gevpick", pWARN) 
+        << "No GHEP tree found in " << filename;
+     LOG("gevpick", pWARN) 
+        << "Skipping to next file...";
+     return;
+  }
+  Long64_t nmax = ghep_tree->GetEntries();
 
+  if(gPickedTopology == kPtAll) {
+     for(Long64_t iev = 0; iev < nmax; iev++) entries.push_back(iev);
+     return;
+  }
+
+  NtpMCEventIndex index;
+  if(index.SetBranchAddresses(ghep_tree)) {
+     LOG("gevpick", pNOTICE) 
+        << "* Scanning the index of: " << nmax 
+        << " events from GHEP tree in file: " << filename;
+     index.EnableBranches(ghep_tree);
+     for(Long64_t iev = 0; iev < nmax; iev++) {
+       ghep_tree->GetEntry(iev);
+       FinalState fs;
+       fs.nupdg  = index.neu;
+       fs.iscc   = (index.intr == kIntWeakCC);
+       fs.isnc   = (index.intr == kIntWeakNC);
+       fs.NfPip  = index.npip;
+       fs.NfPim  = index.npim;
+       fs.NfPi0  = index.npi0;
+       fs.NfHype = index.nhyp;
+       if(AcceptTopology(fs)) entries.push_back(iev);
+     }
+  } else {
+     LOG("gevpick", pNOTICE) 
+        << "* Analyzing: " << nmax 
+        << " events from GHEP tree in file: " << filename;
+     NtpMCEventRecord * mcrec = 0;
+     ghep_tree->SetBranchAddress("gmcrec", &mcrec);
+     for(Long64_t iev = 0; iev < nmax; iev++) {
+       ghep_tree->GetEntry(iev);
+       if(AcceptEvent(*(mcrec->event))) entries.push_back(iev);
+       mcrec->Clear();
+     }
+     ghep_tree->ResetBranchAddresses();
+     delete mcrec;
+  }
+
+  LOG("gevpick", pNOTICE) 
+     << "Selected " << entries.size() << " events in file: " << filename;
+}
+//____________________________________________________________________________________
+bool AcceptEvent(const EventRecord & event)
+{
   const Interaction * interaction = event.Summary();
 
-  int  nupdg     = event.Probe()->Pdg();
-  bool isnumu    = (nupdg == kPdgNuMu);
-  bool isnumubar = (nupdg == kPdgAntiNuMu);
-  bool iscc      = interaction->ProcInfo().IsWeakCC();
-  bool isnc      = interaction->ProcInfo().IsWeakNC();
-
-  int NfP        = 0; // number of protons         in final state
-  int NfPbar     = 0; // number of anti-protons    in final state
-  int NfN        = 0; // number of neutrons        in final state
-  int NfNbar     = 0; // number of anti-neutrons   in final state
-  int NfPip      = 0; // number of \pi^+'s         in final state
-  int NfPim      = 0; // number of \pi^-'s         in final state
-  int NfPi0      = 0; // number of \pi^0's         in final state
-  int NfKp       = 0; // number of \K^+'s          in final state
-  int NfKm       = 0; // number of \K^-'s          in final state
-  int NfK0       = 0; // number of \K^0's          in final state
-  int NfK0bar    = 0; // number of \bar{\K^0}'s    in final state
-  int NfSigmap   = 0; // number of \Sigma^+'s      in final state
-  int NfSigma0   = 0; // number of \Sigma^0's      in final state
-  int NfSigmam   = 0; // number of \Sigma^-'s      in final state
-  int NfLambda0  = 0; // number of \Lambda^0's     in final state
-  int NfXi0      = 0; // number of \Xi^0's         in final state
-  int NfXim      = 0; // number of \Xi^-'s         in final state
-  int NfOmegam   = 0; // number of \Omega^-'s      in final state
-  int NfOther    = 0; // number of other particles in final state
+  FinalState fs;
+  fs.nupdg  = event.Probe()->Pdg();
+  fs.iscc   = interaction->ProcInfo().IsWeakCC();
+  fs.isnc   = interaction->ProcInfo().IsWeakNC();
+  fs.NfPip  = 0; // number of \pi^+'s in final state
+  fs.NfPim  = 0; // number of \pi^-'s in final state
+  fs.NfPi0  = 0; // number of \pi^0's in final state
+  fs.NfHype = 0; // number of hyperons (\Sigma^{+,0,-}, \Lambda^{0}, \Xi^{0,-}, \Omega^{-}) in final state
 
   TObjArrayIter piter(&event);
   GHepParticle * p = 0;
@@ -315,31 +381,31 @@ bool AcceptEvent(const EventRecord & event)
     // skip pseudo-particles
     if(pdg::IsPseudoParticle(pdgc)) continue;
     // count ...
-    if      (pdgc == kPdgProton     ) NfP++;
-    else if (pdgc == kPdgAntiProton ) NfPbar++;
-    else if (pdgc == kPdgNeutron    ) NfN++;
-    else if (pdgc == kPdgAntiNeutron) NfNbar++;
-    else if (pdgc == kPdgPiP        ) NfPip++;
-    else if (pdgc == kPdgPiM        ) NfPim++;
-    else if (pdgc == kPdgPi0        ) NfPi0++;
-    else if (pdgc == kPdgKP         ) NfKp++;
-    else if (pdgc == kPdgKM         ) NfKm++;
-    else if (pdgc == kPdgK0         ) NfK0++;
-    else if (pdgc == kPdgAntiK0     ) NfK0bar++;
-    else if (pdgc == kPdgSigmaP     ) NfSigmap++;
-    else if (pdgc == kPdgSigma0     ) NfSigma0++;
-    else if (pdgc == kPdgSigmaM     ) NfSigmam++;
-    else if (pdgc == kPdgLambda     ) NfLambda0++;
-    else if (pdgc == kPdgXi0        ) NfXi0++;
-    else if (pdgc == kPdgXiM        ) NfXim++;
-    else if (pdgc == kPdgOmegaM     ) NfOmegam++;
-    else                              NfOther++;
+    if      (pdgc == kPdgPiP        ) fs.NfPip++;
+    else if (pdgc == kPdgPiM        ) fs.NfPim++;
+    else if (pdgc == kPdgPi0        ) fs.NfPi0++;
+    else if (pdgc == kPdgSigmaP || pdgc == kPdgSigma0 || pdgc == kPdgSigmaM ||
+             pdgc == kPdgLambda || pdgc == kPdgXi0    || pdgc == kPdgXiM    ||
+             pdgc == kPdgOmegaM ) fs.NfHype++;
   }
 
-  bool is1pipX  = (NfPip==1 && NfPi0==0 && NfPim==0);
-  bool is1pi0X  = (NfPip==0 && NfPi0==1 && NfPim==0);
-  bool is1pimX  = (NfPip==0 && NfPi0==0 && NfPim==1);
-  bool has_hype = (NfSigmap+NfSigma0+NfSigmam+NfLambda0+NfXi0+NfXim+NfOmegam > 0);
+  return AcceptTopology(fs);
+}
+//____________________________________________________________________________________
+bool AcceptTopology(const FinalState & fs)
+{
+  if ( gPickedTopology == kPtAll       ) return true;
+  if ( gPickedTopology == kPtUndefined ) return false;
+
+  bool isnumu    = (fs.nupdg == kPdgNuMu);
+  bool isnumubar = (fs.nupdg == kPdgAntiNuMu);
+  bool iscc      = fs.iscc;
+  bool isnc      = fs.isnc;
+
+  bool is1pipX  = (fs.NfPip==1 && fs.NfPi0==0 && fs.NfPim==0);
+  bool is1pi0X  = (fs.NfPip==0 && fs.NfPi0==1 && fs.NfPim==0);
+  bool is1pimX  = (fs.NfPip==0 && fs.NfPi0==0 && fs.NfPim==1);
+  bool has_hype = (fs.NfHype > 0);
 
   if ( gPickedTopology == kPtNumuCC1pip ) {
     if(isnumu && iscc && is1pipX) return true;
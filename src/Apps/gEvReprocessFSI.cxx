@@ -0,0 +1,425 @@
+//____________________________________________________________________________
+/*!
+
+\program gevgen_fsi
+
+\brief   Re-runs the intranuclear hadron transport on the events of an existing
+         GHEP event file.
+
+         The entries added to each event record by the hadron transport step
+         (and by any step following it) are stripped and the primary hadronic
+         system, as it was handed to the hadron transporter, is restored.
+         The hadron transport is then re-run and the re-processed events are
+         saved in a new GHEP event file. The event weights, cross sections
+         and the primary interaction are kept as they were.
+         This allows FSI model studies on a fixed sample of primary
+         interactions without regenerating them.
+
+         Syntax :
+           gevgen_fsi -f input_file [-n nev] [-r run#] [-o prefix]
+                      [-m module] --tune tune
+                      [--seed random_number_seed]
+                      [--message-thresholds xml_file]
+                      [--event-record-print-level level]
+                      [--mc-job-status-refresh-rate  rate]
+
+         Options :
+           [] Denotes an optional argument
+           -f
+              Specifies the input GHEP event file
+           -n
+              Specifies the number of events to re-process
+              (default: all events in the input file)
+           -r
+              Specifies the MC run number (default: 0)
+           -o
+              Output filename prefix (default: gntp.fsi)
+           -m
+              The hadron transport modules to run, as a comma-separated list
+              of `algorithm/configuration' EventRecordVisitorI names. They
+              are run in the order given.
+              (default: genie::HadronTransporter/Default, which runs the FSI
+              model of the selected tune)
+           --tune
+              Specifies the GENIE comprehensive tune
+           --seed
+              Random number seed.
+           --message-thresholds
+              Allows users to customize the message stream thresholds.
+              The thresholds are specified using an XML file.
+              See $GENIE/config/Messenger.xml for the XML schema.
+           --event-record-print-level
+              Allows users to set the level of information shown when the event
+              record is printed in the screen. See GHepRecord::Print().
+           --mc-job-status-refresh-rate
+              Allows users to customize the refresh rate of the status file.
+
+         Notes:
+           Only the selected modules are re-run. Post-FSI steps of the
+           original event generation (eg decays of the hadrons exiting the
+           nucleus) may be appended by adding the corresponding modules
+           after the hadron transporter in the -m list.
+           The algorithms are created once and re-used for all events, so
+           the per-nucleus setup and the tables built by the INTRANUKE
+           modules are shared by all events with the same nuclear target.
+
+         Examples:
+
+         (1) Re-run the hA2018 FSI model on all events of gntp.0.ghep.root:
+             % gevgen_fsi -f gntp.0.ghep.root --tune G18_02a_00_000
+                          -m genie::HAIntranuke2018/Default
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+
+*/
+//____________________________________________________________________________
+
+#include <cassert>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+// ROOT
+#include "TFile.h"
+#include "TTree.h"
+
+#include "Framework/Algorithm/AlgFactory.h"
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/GMCJMonitor.h"
+#include "Framework/EventGen/EventRecordVisitorI.h"
+#include "Framework/GHEP/GHepParticle.h"
+#include "Framework/GHEP/GHepRecord.h"
+#include "Framework/GHEP/GHepStatus.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Ntuple/NtpWriter.h"
+#include "Framework/Ntuple/NtpMCFormat.h"
+#include "Framework/Ntuple/NtpMCTreeHeader.h"
+#include "Framework/Ntuple/NtpMCEventRecord.h"
+#include "Framework/ParticleData/PDGUtils.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/StringUtils.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+
+using std::string;
+using std::vector;
+
+using namespace genie;
+
+// Function prototypes
+void GetCommandLineArgs (int argc, char ** argv);
+void GetModules         (vector<const EventRecordVisitorI *> & modules);
+bool StripFSI           (EventRecord * evrec);
+void PrintSyntax        (void);
+
+// Default options
+Long_t  kDefOptRunNu        = 0;                               // default run number
+string  kDefOptEvFilePrefix = "gntp.fsi";                      // default output file prefix
+string  kDefOptModules      = "genie::HadronTransporter/Default"; // default FSI module
+
+// User-specified options:
+string   gOptInpFilename;      // input GHEP event file
+Long_t   gOptRunNu;            // run number
+Long64_t gOptNevents;          // n-events to re-process (-1: all)
+string   gOptModules;          // comma-separated list of modules to run
+string   gOptEvFilePrefix;     // event file prefix
+long int gOptRanSeed;          // random number seed
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  // Parse command line arguments
+  GetCommandLineArgs(argc,argv);
+
+  if ( ! RunOpt::Instance()->Tune() ) {
+    LOG("gevgen_fsi", pFATAL) << " No TuneId in RunOption";
+    exit(-1);
+  }
+  RunOpt::Instance()->BuildTune();
+
+  // Init random number generator generator with user-specified seed number,
+  // set user-specified mesg thresholds, set user-specified GHEP print-level
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+  utils::app_init::RandGen(gOptRanSeed);
+  GHepRecord::SetPrintLevel(RunOpt::Instance()->EventRecordPrintLevel());
+
+  // Get the hadron transport modules to re-run
+  vector<const EventRecordVisitorI *> modules;
+  GetModules(modules);
+
+  // Open the input file and get the GHEP event tree
+  TFile file(gOptInpFilename.c_str(),"READ");
+
+  TTree * ghep_tree = dynamic_cast <TTree *> (file.Get("gtree"));
+  if(!ghep_tree) {
+    LOG("gevgen_fsi", pFATAL)
+        << "No GHEP event tree in input file: " << gOptInpFilename;
+    gAbortingInErr=true;
+    exit(1);
+  }
+  NtpMCTreeHeader * thdr =
+     dynamic_cast <NtpMCTreeHeader *> ( file.Get("header") );
+  if(thdr) {
+    LOG("gevgen_fsi", pNOTICE) << "Input tree header: " << *thdr;
+  }
+
+  NtpMCEventRecord * mcrec = 0;
+  ghep_tree->SetBranchAddress("gmcrec", &mcrec);
+
+  Long64_t nev = ghep_tree->GetEntries();
+  if(gOptNevents >= 0 && gOptNevents < nev) nev = gOptNevents;
+
+  LOG("gevgen_fsi", pNOTICE)
+     << "Re-processing " << nev << ((nev==1) ? " event" : " events")
+     << " from: " << gOptInpFilename;
+
+  // Initialize an Ntuple Writer to save GHEP records into a ROOT tree
+  NtpWriter ntpw(kNFGHEP, gOptRunNu);
+  ntpw.CustomizeFilenamePrefix(gOptEvFilePrefix);
+  ntpw.Initialize();
+
+  // Create an MC job monitor
+  GMCJMonitor mcjmonitor(gOptRunNu);
+
+  //
+  // Re-process events
+  //
+
+  for(Long64_t ievent = 0; ievent < nev; ievent++) {
+    ghep_tree->GetEntry(ievent);
+
+    LOG("gevgen_fsi", pNOTICE)
+       << " *** Re-processing event............ " << ievent;
+
+    EventRecord * evrec = new EventRecord(*(mcrec->event));
+    mcrec->Clear();
+
+    // strip the hadron transport products and re-run the transport
+    if(StripFSI(evrec)) {
+      vector<const EventRecordVisitorI *>::const_iterator im;
+      for(im = modules.begin(); im != modules.end(); ++im) {
+        (*im)->ProcessEventRecord(evrec);
+      }
+    }
+
+    LOG("gevgen_fsi", pNOTICE) << *evrec;
+
+    // add event at the output ntuple
+    ntpw.AddEventRecord(ievent, evrec);
+
+    // refresh the mc job monitor
+    mcjmonitor.Update(ievent,evrec);
+
+    delete evrec;
+  }
+
+  // Save the re-processed MC events
+  ntpw.Save();
+
+  file.Close();
+
+  LOG("gevgen_fsi", pNOTICE) << "Done!";
+  return 0;
+}
+//____________________________________________________________________________
+void GetModules(vector<const EventRecordVisitorI *> & modules)
+{
+// get the requested hadron transport modules
+
+  AlgFactory * algf = AlgFactory::Instance();
+
+  vector<string> specs = utils::str::Split(gOptModules, ",");
+  vector<string>::const_iterator is;
+  for(is = specs.begin(); is != specs.end(); ++is) {
+    string spec = utils::str::TrimSpaces(*is);
+    if(spec.size() == 0) continue;
+
+    vector<string> nc = utils::str::Split(spec, "/");
+    string sname = nc[0];
+    string sconf = (nc.size() > 1) ? nc[1] : "Default";
+
+    const EventRecordVisitorI * module =
+      dynamic_cast<const EventRecordVisitorI *> (
+         algf->GetAlgorithm(sname,sconf));
+    if(!module) {
+      LOG("gevgen_fsi", pFATAL)
+         << "Couldn't get an EventRecordVisitorI for: " << spec << " - Exiting";
+      gAbortingInErr = true;
+      exit(1);
+    }
+    LOG("gevgen_fsi", pNOTICE) << "Will run: " << sname << "/" << sconf;
+    modules.push_back(module);
+  }
+
+  if(modules.size() == 0) {
+    LOG("gevgen_fsi", pFATAL) << "No hadron transport module - Exiting";
+    gAbortingInErr = true;
+    exit(1);
+  }
+}
+//____________________________________________________________________________
+bool StripFSI(EventRecord * evrec)
+{
+// Restores the event record as it was handed to the hadron transporter.
+// All particles produced by the hadron transport have a hadron in the
+// nucleus as an ancestor and they are all appended after the primary
+// hadronic system; the record is truncated at the first of them.
+// Returns false if the event has no nuclear target (nothing to re-run).
+
+  GHepParticle * nucltgt = evrec->TargetNucleus();
+  if(!nucltgt) return false;
+
+  int n  = evrec->GetEntries();
+  int n0 = n;
+  for(int i = 0; i < n; i++) {
+    int mom = evrec->Particle(i)->FirstMother();
+    if(mom < 0) continue;
+    if(evrec->Particle(mom)->Status() == kIStHadronInTheNucleus) {
+      n0 = i;
+      break;
+    }
+  }
+
+  // remove the transport products
+  for(int i = n-1; i >= n0; i--) {
+    evrec->RemoveAt(i);
+  }
+  evrec->Compress();
+
+  // fix the daughter lists pointing into the removed entries, reset the
+  // rescattering codes and restore the remnant nucleus status
+  for(int i = 0; i < n0; i++) {
+    GHepParticle * p = evrec->Particle(i);
+    if(p->FirstDaughter() >= n0) {
+      p->SetFirstDaughter(-1);
+      p->SetLastDaughter(-1);
+    }
+    else
+    if(p->LastDaughter() >= n0) {
+      p->SetLastDaughter(n0-1);
+    }
+    if(p->Status() == kIStHadronInTheNucleus) {
+      p->SetRescatterCode(-1);
+    }
+  }
+
+  int dau1 = nucltgt->FirstDaughter();
+  int dau2 = nucltgt->LastDaughter();
+  if(dau1 >= 0) {
+    for(int i = dau1; i <= dau2; i++) {
+      GHepParticle * p = evrec->Particle(i);
+      if(pdg::IsIon(p->Pdg()) && p->Status() == kIStIntermediateState) {
+        p->SetStatus(kIStStableFinalState);
+        break;
+      }
+    }
+  }
+
+  LOG("gevgen_fsi", pINFO)
+     << "Removed " << n-n0 << " entries added by the hadron transport";
+
+  return true;
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("gevgen_fsi", pINFO) << "Parsing command line arguments";
+
+  // Common run options.
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  // Parse run options for this app
+
+  CmdLnArgParser parser(argc,argv);
+
+  // input event file
+  if( parser.OptionExists('f') ) {
+    LOG("gevgen_fsi", pINFO) << "Reading input event file";
+    gOptInpFilename = parser.ArgAsString('f');
+  } else {
+    LOG("gevgen_fsi", pFATAL) << "Unspecified input event file - Exiting";
+    PrintSyntax();
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  // number of events
+  if( parser.OptionExists('n') ) {
+    LOG("gevgen_fsi", pINFO) << "Reading number of events to re-process";
+    gOptNevents = parser.ArgAsLong('n');
+  } else {
+    LOG("gevgen_fsi", pINFO)
+       << "Unspecified number of events to re-process - Using all";
+    gOptNevents = -1;
+  }
+
+  // run number
+  if( parser.OptionExists('r') ) {
+    LOG("gevgen_fsi", pINFO) << "Reading MC run number";
+    gOptRunNu = parser.ArgAsLong('r');
+  } else {
+    LOG("gevgen_fsi", pINFO) << "Unspecified run number - Using default";
+    gOptRunNu = kDefOptRunNu;
+  }
+
+  // hadron transport modules
+  if( parser.OptionExists('m') ) {
+    LOG("gevgen_fsi", pINFO) << "Reading hadron transport modules";
+    gOptModules = parser.ArgAsString('m');
+  } else {
+    LOG("gevgen_fsi", pINFO)
+       << "Unspecified hadron transport modules - Using default";
+    gOptModules = kDefOptModules;
+  }
+
+  // event file prefix
+  if( parser.OptionExists('o') ) {
+    LOG("gevgen_fsi", pINFO) << "Reading the event filename prefix";
+    gOptEvFilePrefix = parser.ArgAsString('o');
+  } else {
+    LOG("gevgen_fsi", pDEBUG)
+      << "Will set the default event filename prefix";
+    gOptEvFilePrefix = kDefOptEvFilePrefix;
+  }
+
+  // random number seed
+  if( parser.OptionExists("seed") ) {
+    LOG("gevgen_fsi", pINFO) << "Reading random number seed";
+    gOptRanSeed = parser.ArgAsLong("seed");
+  } else {
+    LOG("gevgen_fsi", pINFO) << "Unspecified random number seed - Using default";
+    gOptRanSeed = -1;
+  }
+
+  LOG("gevgen_fsi", pNOTICE)
+     << "\n"
+     << "\n gevgen_fsi job configuration:"
+     << "\n Input event file : " << gOptInpFilename
+     << "\n Number of events : "
+     << ((gOptNevents < 0) ? string("all") : utils::str::IntAsString(gOptNevents))
+     << "\n MC run number    : " << gOptRunNu
+     << "\n Modules          : " << gOptModules
+     << "\n Random seed      : " << gOptRanSeed
+     << "\n\n";
+
+  LOG("gevgen_fsi", pNOTICE) << *RunOpt::Instance();
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("gevgen_fsi", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "   gevgen_fsi -f input_file [-n nev] [-r run#] [-o prefix]\n"
+    << "              [-m module] --tune tune\n"
+    << "              [--seed random_number_seed]\n"
+    << "              [--message-thresholds xml_file]\n"
+    << "              [--event-record-print-level level]\n"
+    << "              [--mc-job-status-refresh-rate  rate]\n";
+}
+//____________________________________________________________________________
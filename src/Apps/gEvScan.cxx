@@ -21,6 +21,12 @@
             [--check-vertex-distribution]
             [--check-decayer-consistency]
             [--all]
+            [--thread-pool-size n]
+
+         The selected checks are independent: each one reads the event tree
+         through its own file handle and they run concurrently on the GENIE
+         thread pool (sized by --thread-pool-size or $GTHREADPOOLSIZE).
+         Check reports are written to the error log in the order above.
 
 \author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
  University of Liverpool & STFC Rutherford Appleton Laboratory
@@ -61,6 +67,7 @@
 #include "Physics/NuclearState/NuclearUtils.h"
 #include "Framework/Utils/CmdLnArgParser.h"
 #include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/ThreadPool.h"
 
 using std::ostringstream;
 using std::ofstream;
@@ -106,9 +113,13 @@ bool     gOptCheckDecayerConsistency = false;
 Long64_t gFirstEventNum = -1;
 Long64_t gLastEventNum  = -1;
 
-TTree *            gEventTree = 0;
-NtpMCEventRecord * gMCRec = 0;
-ofstream           gErrLog;
+// per-check event tree, record and error log (checks run concurrently)
+thread_local TTree *            gEventTree = 0;
+thread_local NtpMCEventRecord * gMCRec = 0;
+thread_local ostringstream      gErrLog;
+bool                            gWriteErrLog = false;
+
+typedef void (*CheckFunc_t) (void);
 
 //____________________________________________________________________________
 int main(int argc, char ** argv)
@@ -131,10 +142,13 @@ int main(int argc, char ** argv)
       return 3;
   }
 
-  gEventTree = dynamic_cast <TTree *> (file.Get("gtree"));
-  gEventTree->SetBranchAddress("gmcrec", &gMCRec);
-
-  Long64_t nev = gEventTree->GetEntries();
+  TTree * tree = dynamic_cast <TTree *> (file.Get("gtree"));
+  if(!tree) {
+      LOG("gevscan", pERROR) << "*** No GHEP event tree in " << gOptInpFilename;
+      file.Close();
+      return 3;
+  }
+  Long64_t nev = tree->GetEntries();
   if(gOptNEvtL == -1 && gOptNEvtH == -1) {
     // read all events
     gFirstEventNum = 0;
@@ -158,39 +172,60 @@ int main(int argc, char ** argv)
      logfile << gOptInpFilename << ".errlog";
      gOptOutFilename = logfile.str();
   }
-  if(gOptOutFilename != "none") {
-     gErrLog.open(gOptOutFilename.c_str());
-     gErrLog << "# ..................................................................................." << endl;
-     gErrLog << "# Error log for event file " << gOptInpFilename << endl;
-     gErrLog << "# ..................................................................................." << endl;
-     gErrLog << "# " << endl;
-  }
+  gWriteErrLog = (gOptOutFilename != "none");
 
+  vector<CheckFunc_t> checks;
   if (gOptCheckEnergyMomentumConservation) {
-	  CheckEnergyMomentumConservation();
+	  checks.push_back(CheckEnergyMomentumConservation);
   }
   if (gOptCheckChargeConservation) {
-          CheckChargeConservation();
+          checks.push_back(CheckChargeConservation);
   }
   if (gOptCheckForPseudoParticlesInFinState) {
-          CheckForPseudoParticlesInFinState();
+          checks.push_back(CheckForPseudoParticlesInFinState);
   }
   if (gOptCheckForOffMassShellParticlesInFinState) {
-          CheckForOffMassShellParticlesInFinState();
+          checks.push_back(CheckForOffMassShellParticlesInFinState);
   }
   if (gOptCheckForNumFinStateNucleonsInconsistentWithTarget) {
-          CheckForNumFinStateNucleonsInconsistentWithTarget();
+          checks.push_back(CheckForNumFinStateNucleonsInconsistentWithTarget);
   }
   if (gOptCheckVertexDistribution) {
-          CheckVertexDistribution();
+          checks.push_back(CheckVertexDistribution);
   }
   if (gOptCheckDecayerConsistency) {
-          CheckDecayerConsistency();
-  }
-
-
-  if(gOptOutFilename != "none") {
-     gErrLog.close();
+          checks.push_back(CheckDecayerConsistency);
+  }
+
+  // run the checks concurrently, each reading the events through its own
+  // file handle and keeping its own error log
+  vector<string> logs(checks.size());
+  ThreadPool::Instance()->ParallelFor(checks.size(),
+    [&] (int i, unsigned int /*worker*/) {
+      TFile fin(gOptInpFilename.c_str(),"READ");
+      gEventTree = dynamic_cast <TTree *> (fin.Get("gtree"));
+      gMCRec     = 0;
+      gEventTree->SetBranchAddress("gmcrec", &gMCRec);
+      gErrLog.str("");
+      checks[i]();
+      logs[i] = gErrLog.str();
+      gEventTree->ResetBranchAddresses();
+      delete gMCRec;
+      gMCRec     = 0;
+      gEventTree = 0;
+      fin.Close();
+  });
+
+  if(gWriteErrLog) {
+     ofstream errlog(gOptOutFilename.c_str());
+     errlog << "# ..................................................................................." << endl;
+     errlog << "# Error log for event file " << gOptInpFilename << endl;
+     errlog << "# ..................................................................................." << endl;
+     errlog << "# " << endl;
+     for(unsigned int i = 0; i < logs.size(); i++) {
+        errlog << logs[i];
+     }
+     errlog.close();
   }
 
   return 0;
@@ -200,7 +235,7 @@ void CheckEnergyMomentumConservation (void)
 {
   LOG("gevscan", pNOTICE) << "Checking energy/momentum conservation...";
 
-  if(gErrLog.is_open()) {
+  if(gWriteErrLog) {
     gErrLog << "# Events failing the energy-momentum conservation test:" << endl;
     gErrLog << "# " << endl;
   }
@@ -263,7 +298,7 @@ void CheckEnergyMomentumConservation (void)
          << " ** Energy-momentum non-conservation in event: " << i 
          << "\n"
          << event;
-       if(gErrLog.is_open()) {
+       if(gWriteErrLog) {
            gErrLog << i;
            if(gOptAddEventPrintoutInErrLog) {
                gErrLog << event;
@@ -276,7 +311,7 @@ void CheckEnergyMomentumConservation (void)
 
   }//i
 
-  if(gErrLog.is_open()) {
+  if(gWriteErrLog) {
      if(nerr == 0) {
          gErrLog << "none" << endl;    
      }
@@ -291,7 +326,7 @@ void CheckChargeConservation(void)
 {
   LOG("gevscan", pNOTICE) << "Checking charge conservation...";
 
-  if(gErrLog.is_open()) {
+  if(gWriteErrLog) {
      gErrLog << "# Events failing the charge conservation test:" << endl;
      gErrLog << "# " << endl;
   }
@@ -346,7 +381,7 @@ void CheckChargeConservation(void)
            << " ** Charge non-conservation in event: " << i 
            << "\n"
            << event;
-         if(gErrLog.is_open()) {
+         if(gWriteErrLog) {
             gErrLog << i << endl;    
             if(gOptAddEventPrintoutInErrLog) {
                  gErrLog << event;
@@ -359,7 +394,7 @@ void CheckChargeConservation(void)
     gMCRec->Clear(); // clear out explicitly to prevent memory leak w/Root6
   }//i
 
-  if(gErrLog.is_open()) {
+  if(gWriteErrLog) {
      if(nerr == 0) {
         gErrLog << "none" << endl;    
      }
@@ -375,7 +410,7 @@ void CheckForPseudoParticlesInFinState(void)
   LOG("gevscan", pNOTICE) 
       << "Checking for pseudo-particles appearing in final state...";
 
-  if(gErrLog.is_open()) {
+  if(gWriteErrLog) {
      gErrLog << "# Events with pseudo-particles in final state:" << endl;
      gErrLog << "# " << endl;
   }
@@ -413,7 +448,7 @@ void CheckForPseudoParticlesInFinState(void)
          << " ** Pseudo-particle final state particle in event: " << i 
          << "\n"
          << event;
-       if(gErrLog.is_open()) {
+       if(gWriteErrLog) {
           gErrLog << i << endl;    
           if(gOptAddEventPrintoutInErrLog) {
                gErrLog << event;
@@ -426,7 +461,7 @@ void CheckForPseudoParticlesInFinState(void)
 
   }//i
 
-  if(gErrLog.is_open()) {
+  if(gWriteErrLog) {
      if(nerr == 0) {
         gErrLog << "none" << endl;    
      }
@@ -442,7 +477,7 @@ void CheckForOffMassShellParticlesInFinState(void)
   LOG("gevscan", pNOTICE) 
       << "Checking for off-mass-shell particles appearing in the final state...";
 
-  if(gErrLog.is_open()) {
+  if(gWriteErrLog) {
      gErrLog << "# Events with off-mass-shell particles in final state:" << endl;
      gErrLog << "# " << endl;
   }
@@ -479,7 +514,7 @@ void CheckForOffMassShellParticlesInFinState(void)
          << " ** Off-mass-shell final state particle in event: " << i 
          << "\n"
          << event;
-       if(gErrLog.is_open()) {
+       if(gWriteErrLog) {
           gErrLog << i << endl;    
           if(gOptAddEventPrintoutInErrLog) {
                gErrLog << event;
@@ -492,7 +527,7 @@ void CheckForOffMassShellParticlesInFinState(void)
 
   }//i
 
-  if(gErrLog.is_open()) {
+  if(gWriteErrLog) {
      if(nerr == 0) {
         gErrLog << "none" << endl;    
      }
@@ -508,7 +543,7 @@ void CheckForNumFinStateNucleonsInconsistentWithTarget(void)
   LOG("gevscan", pNOTICE) 
      << "Checking for number of final state nucleons inconsistent with target...";
 
-  if(gErrLog.is_open()) {
+  if(gWriteErrLog) {
     gErrLog << "# Events with number of final state nucleons inconsistent with target:" << endl;
     gErrLog << "# " << endl;
   }
@@ -583,7 +618,7 @@ void CheckForNumFinStateNucleonsInconsistentWithTarget(void)
            << " ** Number of final state nucleons inconsistent with target in event: " << i 
            << "\n"
            << event;
-         if(gErrLog.is_open()) {
+         if(gWriteErrLog) {
              gErrLog << i << endl;    
              if(gOptAddEventPrintoutInErrLog) {
                  gErrLog << event;
@@ -598,7 +633,7 @@ void CheckForNumFinStateNucleonsInconsistentWithTarget(void)
   }//i
 
 
-  if(gErrLog.is_open()) {
+  if(gWriteErrLog) {
      if(nerr == 0) {
          gErrLog << "none" << endl;    
      }
@@ -614,7 +649,7 @@ void CheckVertexDistribution(void)
   LOG("gevscan", pNOTICE) 
      << "Checking intra-nuclear vertex distribution...";
 
-  if(gErrLog.is_open()) {
+  if(gWriteErrLog) {
     gErrLog << "# Intranuclear vertex distribution check:" << endl;
     gErrLog << "# " << endl;
   }
@@ -681,7 +716,7 @@ void CheckVertexDistribution(void)
     double pvalue = r_distr_mc->Chi2Test(r_distr_expected,"WWP");
     LOG("gevscan", pNOTICE) << "p-value {\\chi^2 test} = " << pvalue;
 
-    if(gErrLog.is_open()) {
+    if(gWriteErrLog) {
        if(pvalue < 0.99) {
          gErrLog << "Problem! p-value = " << pvalue << endl;    
        } else {
@@ -699,7 +734,7 @@ void CheckVertexDistribution(void)
   }//A
   else {
 
-    if(gErrLog.is_open()) {
+    if(gWriteErrLog) {
       gErrLog << "Can not run test with current sample" << endl;   
     }
 
@@ -719,7 +754,7 @@ void CheckDecayerConsistency(void)
   LOG("gevscan", pNOTICE) 
      << "Checking decayer consistency...";
 
-  if(gErrLog.is_open()) {
+  if(gWriteErrLog) {
     gErrLog << "# Decayer consistency check:" << endl;
     gErrLog << "# " << endl;
   }
@@ -780,7 +815,7 @@ void CheckDecayerConsistency(void)
   LOG("gevscan", pNOTICE) 
     << "Particles seen in both lists: " << particles_in_both_lists;
 
-  if(gErrLog.is_open()) {
+  if(gWriteErrLog) {
      gErrLog << mesg.str() << endl;
      gErrLog << "\nParticles seen in final state:" << final_state_particles << endl;
      gErrLog << "\nParticles seen to have decayed:" << decayed_particles << endl;
@@ -789,7 +824,7 @@ void CheckDecayerConsistency(void)
 
    // find example events
    if(!ok) {
-      if(gErrLog.is_open()) {
+      if(gWriteErrLog) {
          gErrLog << "\nExample events: " << endl;          
       }
       for(iter  = particles_in_both_lists.begin(); 
@@ -817,7 +852,7 @@ void CheckDecayerConsistency(void)
            }//p
            gMCRec->Clear(); // clear out explicitly to prevent memory leak w/Root6
          }//i
-         if(gErrLog.is_open()) {
+         if(gWriteErrLog) {
             gErrLog << ">> " << PDGLibrary::Instance()->Find(pdgc_bothlists)->GetName()
                     << ": Decayed in event " << iev_decay 
                     << ". Seen in final state in event " << iev_fs << "." << endl;
@@ -0,0 +1,713 @@
+//____________________________________________________________________________
+/*!
+
+\program gevserv
+
+\brief   GENIE v+A event generation server.
+
+         A long-lived, warmed-up generator process (cross section splines
+         loaded, event generation drivers configured once) handing out
+         events to any number of concurrently connected clients, e.g. the
+         detector simulation (Geant4) jobs of a production, over TCP/IP.
+
+         *** Synopsis :
+
+           gevserv [-h]
+                   [-p port]
+                   [--max-clients n]
+                   [--compress level]
+                   [--seed random_number_seed]
+                    --cross-sections xml_file
+                   [--event-generator-list list_name]
+                   [--tune genie_tune]
+                   [--message-thresholds xml_file]
+                   [--unphysical-event-mask mask]
+                   [--event-record-print-level level]
+                   [--cache-file root_file]
+
+         Options :
+           [] denotes an optional argument
+           -h
+              Prints out the syntax and exits
+           -p
+              Port number (default: 9090)
+           --max-clients
+              Maximum number of concurrently connected clients (default: 64)
+           --compress
+              ROOT compression level of the reply frames (default: 0, off)
+           --seed
+              Random number seed
+           --cross-sections
+              Name (incl. full path) of an XML file with pre-computed
+              cross-section values used for constructing splines
+           See RunOpt for the common GENIE run options.
+
+         *** Wire format :
+
+         Every request and reply is one ROOT TMessage, identified by its
+         What() code, with a binary payload written (and read) through the
+         TBuffer streamers: int = 4 bytes, double = 8 bytes, network byte
+         order, optionally compressed.
+
+           request (client->server)      reply (server->client)
+           -----------------------------------------------------------------
+           kEvSrvHello      [int version]  kEvSrvHello [int version]
+                                                       [int nclients]
+           kEvSrvConfig     [int nnu] [int nu pdg]*nnu
+                            [int ntgt] [int tgt pdg]*ntgt
+                                           kEvSrvOk, or kEvSrvError
+           kEvSrvXSec       [int nu pdg] [int tgt pdg]
+                            [int np] [double Emin] [double Emax]
+                                           kEvSrvXSecFrame
+                                             [int np] ([double E]
+                                             [double xsec, 1E-38 cm2])*np
+           kEvSrvGenerate   [int nev] ([int tag] [int nu pdg] [int tgt pdg]
+                            [double px] [double py] [double pz])*nev
+                                           kEvSrvEventFrame [int nev] (event)*nev
+           kEvSrvJob        [Long64 run#] [Long64 seed] [int nev]
+                            [int nu pdg] [int tgt pdg]
+                            [double px] [double py] [double pz]
+                            [string output file]
+                                           kEvSrvJobStarted [int job id]
+                                             or kEvSrvError
+           kEvSrvJobStatus  [int job id]   kEvSrvJobState [int state]
+           kEvSrvBye                       (closes the connection)
+           kEvSrvShutdown                  kEvSrvOk (and stops the server)
+
+         Each (event) of an event frame is:
+           [int tag] [int ok] and, if ok,
+           [int scattering type] [int interaction type]
+           [double xsec] [double diff xsec] [double weight] (natural units)
+           [double x] [double y] [double Q2] [double W] (selected kinematics)
+           [int npart] ([int status] [int pdg] [int mother1] [int mother2]
+                        [int daughter1] [int daughter2]
+                        [double px] [double py] [double pz] [double E]
+                        [double vx] [double vy] [double vz] [double vt])*npart
+         The tag is passed through unchanged, for the client to match the
+         events to its requests. A kEvSrvError reply carries a string.
+
+         Requests are served one at a time, in the order they arrive: GENIE
+         event generation is not thread-safe. Batching the event requests
+         (kEvSrvGenerate with nev > 1) amortizes the network round trips.
+         The kEvSrvConfig requests of the clients add drivers for the
+         requested initial states to a pool shared by all clients.
+
+         A kEvSrvJob request runs a complete (fixed initial state) event
+         generation job, as gevgen would, in a child process forked from
+         the initialized server: the child re-seeds the random number
+         generator with the job seed, generates nev events with the pool
+         driver of the requested initial state (see kEvSrvConfig) and
+         writes them in a GHEP event tree with the given run number and
+         output file, which the server host must be able to write. The
+         start-up of short jobs (configuration, splines, hadron transport
+         tables) is thus paid once per server. The job id is the process
+         id of the child; the job state is 0 while it runs, 1 once it has
+         finished successfully and -1 if it failed (or is unknown).
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created September 18, 2007
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <map>
+
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <TSystem.h>
+#include <TServerSocket.h>
+#include <TSocket.h>
+#include <TMonitor.h>
+#include <TMessage.h>
+#include <TLorentzVector.h>
+#include <TMath.h>
+
+#include "Framework/Conventions/Units.h"
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/GEVGDriver.h"
+#include "Framework/EventGen/GEVGPool.h"
+#include "Framework/GHEP/GHepParticle.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Ntuple/NtpWriter.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/Numerical/Spline.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/ThreadPool.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+
+using std::string;
+using std::vector;
+using std::map;
+
+using namespace genie;
+
+// ** Message codes (TMessage::What()), outside the range used by ROOT
+//
+const int kEvSrvProtocolVersion = 2;
+
+const int kEvSrvHello      = 9000;
+const int kEvSrvConfig     = 9001;
+const int kEvSrvXSec       = 9002;
+const int kEvSrvGenerate   = 9003;
+const int kEvSrvBye        = 9004;
+const int kEvSrvShutdown   = 9005;
+const int kEvSrvJob        = 9006;
+const int kEvSrvJobStatus  = 9007;
+const int kEvSrvOk         = 9100;
+const int kEvSrvError      = 9101;
+const int kEvSrvXSecFrame  = 9102;
+const int kEvSrvEventFrame = 9103;
+const int kEvSrvJobStarted = 9104;
+const int kEvSrvJobState   = 9105;
+
+// ** Prototypes
+//
+void GetCommandLineArgs (int argc, char ** argv);
+void Initialize         (void);
+void PrintSyntax        (void);
+void Serve              (void);
+bool HandleMesg         (TSocket * sock, TMessage * mesg);
+void Hello              (TSocket * sock, TMessage * mesg);
+void Configure          (TSocket * sock, TMessage * mesg);
+void CalcTotalXSec      (TSocket * sock, TMessage * mesg);
+void GenerateEvents     (TSocket * sock, TMessage * mesg);
+void StartJob           (TSocket * sock, TMessage * mesg);
+void JobStatus          (TSocket * sock, TMessage * mesg);
+void RunJob             (GEVGDriver * driver, Long_t runnu, int nev,
+                         const TLorentzVector & p4, string outfile);
+void ReapJobs           (bool wait);
+void SendError          (TSocket * sock, string error);
+void SendReply          (TSocket * sock, TMessage & reply);
+
+// ** Consts & Defaults
+//
+const int kDefPortNum       = 9090;  // default port number
+const int kDefMaxClients    = 64;    // default max number of clients
+const int kMaxEventsInFrame = 10000; // max number of events per request
+
+// ** User-specified options:
+//
+int      gOptPortNum;      // port number
+int      gOptMaxClients;   // max number of concurrently connected clients
+int      gOptCompress;     // compression level of the reply frames
+long int gOptRanSeed;      // random number seed
+string   gOptInpXSecFile;  // cross-section splines
+
+// ** Globals
+//
+bool          gShutDown = false;  // 'shutting down?' flag
+int           gNClients = 0;      // number of connected clients
+GEVGPool      gGPool;             // event generation drivers, shared by all clients
+EventRecord * gEvent    = 0;      // event record, re-filled for every event
+map<int,int>  gJobs;              // forked jobs (pid) -> state (0 running, 1 done, -1 failed)
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc,argv);
+  Initialize();
+
+  Serve();
+
+  delete gEvent;
+
+  return 0;
+}
+//____________________________________________________________________________
+void Initialize(void)
+{
+  if ( ! RunOpt::Instance()->Tune() ) {
+    LOG("gevserv", pFATAL) << " No TuneId in RunOption";
+    exit(-1);
+  }
+  RunOpt::Instance()->BuildTune();
+
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+  utils::app_init::CacheFile(RunOpt::Instance()->CacheFile());
+  utils::app_init::RandGen(gOptRanSeed);
+  utils::app_init::XSecTable(gOptInpXSecFile, false);
+
+  GHepRecord::SetPrintLevel(RunOpt::Instance()->EventRecordPrintLevel());
+
+  gEvent = new EventRecord;
+}
+//____________________________________________________________________________
+void Serve(void)
+{
+  TServerSocket * serv_sock = new TServerSocket(gOptPortNum, kTRUE);
+  if(!serv_sock->IsValid()) {
+    LOG("gevserv", pFATAL)
+      << "Could not open a server socket at port: " << gOptPortNum;
+    gAbortingInErr = true;
+    exit(1);
+  }
+  LOG("gevserv", pNOTICE) << "Listening on port: " << gOptPortNum;
+
+  TMonitor monitor;
+  monitor.Add(serv_sock);
+
+  while(!gShutDown) {
+
+    TSocket * sock = monitor.Select();
+    if(!sock || sock == (TSocket *) -1) continue;
+
+    // a new connection
+    if(sock == serv_sock) {
+      TSocket * client = serv_sock->Accept();
+      if(!client || client == (TSocket *) -1) continue;
+      if(gNClients >= gOptMaxClients) {
+        LOG("gevserv", pWARN)
+          << "Refusing connection: " << gOptMaxClients << " clients already";
+        SendError(client, "too many clients");
+        client->Close();
+        delete client;
+        continue;
+      }
+      client->SetOption(kNoDelay,1);
+      monitor.Add(client);
+      gNClients++;
+      LOG("gevserv", pNOTICE)
+        << "Accepted connection from " << client->GetInetAddress().GetHostName()
+        << " (" << gNClients << " clients connected)";
+      continue;
+    }
+
+    // a request by a connected client
+    TMessage * mesg = 0;
+    bool keep = (sock->Recv(mesg) > 0 && mesg != 0);
+    if(keep) keep = HandleMesg(sock, mesg);
+    delete mesg;
+
+    // collect the forked jobs that finished in the meantime
+    ReapJobs(false);
+
+    if(!keep) {
+      monitor.Remove(sock);
+      sock->Close();
+      delete sock;
+      gNClients--;
+      LOG("gevserv", pNOTICE)
+        << "Closed a connection (" << gNClients << " clients connected)";
+    }
+  } // !shutdown
+
+  // close all remaining connections
+  TList * active = monitor.GetListOfActives();
+  monitor.RemoveAll();
+  TIter next(active);
+  TSocket * sock = 0;
+  while( (sock = (TSocket *) next()) ) {
+    if(sock == serv_sock) continue;
+    sock->Close();
+    delete sock;
+  }
+  delete active;
+
+  serv_sock->Close();
+  delete serv_sock;
+
+  // let the running jobs finish
+  ReapJobs(true);
+
+  LOG("gevserv", pNOTICE) << "Shutting GENIE event server down";
+}
+//____________________________________________________________________________
+bool HandleMesg(TSocket * sock, TMessage * mesg)
+{
+// Serves a client request. Returns false to close the connection.
+
+  switch(mesg->What()) {
+    case kEvSrvHello    : Hello          (sock, mesg); break;
+    case kEvSrvConfig   : Configure      (sock, mesg); break;
+    case kEvSrvXSec     : CalcTotalXSec  (sock, mesg); break;
+    case kEvSrvGenerate : GenerateEvents (sock, mesg); break;
+    case kEvSrvJob      : StartJob       (sock, mesg); break;
+    case kEvSrvJobStatus: JobStatus      (sock, mesg); break;
+    case kEvSrvBye      : return false;
+    case kEvSrvShutdown :
+    {
+      TMessage reply(kEvSrvOk);
+      SendReply(sock, reply);
+      gShutDown = true;
+      return false;
+    }
+    default:
+      LOG("gevserv", pWARN) << "Unknown request: " << mesg->What();
+      SendError(sock, "unknown request");
+      return false;
+  }
+  return true;
+}
+//____________________________________________________________________________
+void Hello(TSocket * sock, TMessage * mesg)
+{
+  int version = 0;
+  *mesg >> version;
+
+  LOG("gevserv", pNOTICE)
+    << "Hello from a client speaking protocol version " << version;
+
+  TMessage reply(kEvSrvHello);
+  reply << kEvSrvProtocolVersion;
+  reply << gNClients;
+  SendReply(sock, reply);
+}
+//____________________________________________________________________________
+void Configure(TSocket * sock, TMessage * mesg)
+{
+// Adds an event generation driver for every requested neutrino / target
+// pair not already in the pool. All needed cross section splines should be
+// available in the input XML file, or they are computed now (which may take
+// a while).
+
+  int nnu = 0;
+  *mesg >> nnu;
+  vector<int> neutrinos(TMath::Max(0,nnu));
+  for(unsigned int i = 0; i < neutrinos.size(); i++) *mesg >> neutrinos[i];
+  int ntgt = 0;
+  *mesg >> ntgt;
+  vector<int> targets(TMath::Max(0,ntgt));
+  for(unsigned int i = 0; i < targets.size(); i++) *mesg >> targets[i];
+
+  for(unsigned int inu = 0; inu < neutrinos.size(); inu++) {
+   for(unsigned int itgt = 0; itgt < targets.size(); itgt++) {
+
+     if(gGPool.FindDriver(neutrinos[inu], targets[itgt])) continue;
+
+     InitialState init_state(targets[itgt], neutrinos[inu]);
+
+     LOG("gevserv", pNOTICE)
+       << "Creating a GEVGDriver object configured for init-state: "
+       << init_state.AsString();
+
+     GEVGDriver * evgdriver = new GEVGDriver;
+     evgdriver->SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+     evgdriver->SetUnphysEventMask(*RunOpt::Instance()->UnphysEventMask());
+     evgdriver->Configure(init_state);
+     evgdriver->UseSplines();
+
+     gGPool.AddDriver(init_state, evgdriver);
+   } // targets
+  } // neutrinos
+
+  TMessage reply(kEvSrvOk);
+  SendReply(sock, reply);
+}
+//____________________________________________________________________________
+void CalcTotalXSec(TSocket * sock, TMessage * mesg)
+{
+  int    ipdgnu = 0, ipdgtgt = 0, np = 0;
+  double Emin = 0, Emax = 0;
+  *mesg >> ipdgnu >> ipdgtgt >> np >> Emin >> Emax;
+
+  GEVGDriver * evg_driver = gGPool.FindDriver(ipdgnu, ipdgtgt);
+  if(!evg_driver) {
+     LOG("gevserv", pERROR)
+       << "No GEVGDriver object for init state: " << ipdgnu << " + " << ipdgtgt;
+     SendError(sock, "no event generation driver");
+     return;
+  }
+  if(np < 1 || Emin <= 0 || Emax < Emin) {
+     SendError(sock, "bad energy range");
+     return;
+  }
+
+  if(!evg_driver->XSecSumSpline()) {
+    evg_driver->CreateXSecSumSpline (
+       1000 /*nknots*/, 0.001 /*Emin*/, 300 /*Emax*/, true /*in-log*/);
+  }
+  const Spline * total_xsec_spl = evg_driver->XSecSumSpline();
+
+  double dE = (np > 1) ? (Emax-Emin)/(np-1) : 0.;
+
+  TMessage reply(kEvSrvXSecFrame);
+  reply << np;
+  for(int ip=0; ip<np; ip++) {
+     double E  = Emin + ip*dE;
+     double xs = TMath::Max(0., total_xsec_spl->Evaluate(E) / (1E-38*units::cm2));
+     reply << E << xs;
+  }
+  SendReply(sock, reply);
+}
+//____________________________________________________________________________
+void GenerateEvents(TSocket * sock, TMessage * mesg)
+{
+  int nev = 0;
+  *mesg >> nev;
+  if(nev < 0 || nev > kMaxEventsInFrame) {
+    SendError(sock, "bad number of events");
+    return;
+  }
+
+  TMessage reply(kEvSrvEventFrame);
+  reply << nev;
+
+  for(int iev = 0; iev < nev; iev++) {
+
+    int    tag = 0, ipdgnu = 0, ipdgtgt = 0;
+    double px = 0, py = 0, pz = 0;
+    *mesg >> tag >> ipdgnu >> ipdgtgt >> px >> py >> pz;
+
+    reply << tag;
+
+    GEVGDriver * evg_driver = gGPool.FindDriver(ipdgnu, ipdgtgt);
+    if(!evg_driver) {
+      LOG("gevserv", pERROR)
+        << "No GEVGDriver object for init state: " << ipdgnu << " + " << ipdgtgt;
+      reply << 0;
+      continue;
+    }
+
+    TLorentzVector p4(px, py, pz, TMath::Sqrt(px*px + py*py + pz*pz));
+
+    EventRecord * event = evg_driver->GenerateEvent(p4, gEvent);
+    if(!event) {
+      LOG("gevserv", pWARN) << "Failed to generate the requested event";
+      reply << 0;
+      continue;
+    }
+    LOG("gevserv", pINFO) << "Generated event: " << *event;
+
+    const Interaction * interaction = event->Summary();
+    const ProcessInfo & proc_info   = interaction->ProcInfo();
+    const Kinematics &  kine        = interaction->Kine();
+
+    reply << 1;
+    reply << (int) proc_info.ScatteringTypeId();
+    reply << (int) proc_info.InteractionTypeId();
+    reply << event->XSec() << event->DiffXSec() << event->Weight();
+
+    bool get_selected = true;
+    reply << kine.x(get_selected) << kine.y(get_selected)
+          << kine.Q2(get_selected) << kine.W(get_selected);
+
+    int npart = event->GetEntriesFast();
+    reply << npart;
+    for(int i = 0; i < npart; i++) {
+      const GHepParticle * p = event->Particle(i);
+      reply << (int) p->Status() << p->Pdg()
+            << p->FirstMother()   << p->LastMother()
+            << p->FirstDaughter() << p->LastDaughter();
+      reply << p->Px() << p->Py() << p->Pz() << p->E()
+            << p->Vx() << p->Vy() << p->Vz() << p->Vt();
+    }
+  }
+
+  SendReply(sock, reply);
+}
+//____________________________________________________________________________
+void StartJob(TSocket * sock, TMessage * mesg)
+{
+  Long64_t runnu = 0, seed = 0;
+  int      nev = 0, ipdgnu = 0, ipdgtgt = 0;
+  double   px = 0, py = 0, pz = 0;
+  *mesg >> runnu >> seed >> nev >> ipdgnu >> ipdgtgt >> px >> py >> pz;
+  TString outfile;
+  mesg->ReadTString(outfile);
+
+  GEVGDriver * evg_driver = gGPool.FindDriver(ipdgnu, ipdgtgt);
+  if(!evg_driver) {
+    LOG("gevserv", pERROR)
+      << "No GEVGDriver object for init state: " << ipdgnu << " + " << ipdgtgt;
+    SendError(sock, "no event generation driver");
+    return;
+  }
+  if(nev < 1 || outfile.Length() == 0) {
+    SendError(sock, "bad job specification");
+    return;
+  }
+
+  // the pool threads are not carried over to the child: stop them before
+  // forking and restart them in both processes
+  unsigned int nthreads = ThreadPool::Instance()->NThreads();
+  ThreadPool::Instance()->SetNThreads(1);
+
+  pid_t pid = fork();
+  if(pid == 0) {
+    ThreadPool::Instance()->SetNThreads(nthreads);
+    utils::app_init::RandGen(seed);
+    TLorentzVector p4(px, py, pz, TMath::Sqrt(px*px + py*py + pz*pz));
+    RunJob(evg_driver, runnu, nev, p4, outfile.Data());
+    // leave without running the exit handlers of the server
+    Messenger::Instance()->Flush();
+    _exit(0);
+  }
+  ThreadPool::Instance()->SetNThreads(nthreads);
+
+  if(pid < 0) {
+    LOG("gevserv", pERROR) << "Couldn't fork an event generation job";
+    SendError(sock, "couldn't start the job");
+    return;
+  }
+
+  gJobs[pid] = 0;
+  LOG("gevserv", pNOTICE)
+    << "Started job " << pid << ": " << nev << " events for "
+    << ipdgnu << " + " << ipdgtgt << " (run " << runnu << ", seed " << seed
+    << ") -> " << outfile.Data();
+
+  TMessage reply(kEvSrvJobStarted);
+  reply << (int) pid;
+  SendReply(sock, reply);
+}
+//____________________________________________________________________________
+void RunJob(GEVGDriver * driver, Long_t runnu, int nev,
+            const TLorentzVector & p4, string outfile)
+{
+  NtpWriter ntpw(kNFGHEP, runnu);
+  ntpw.CustomizeFilename(outfile);
+  ntpw.Initialize();
+
+  int ievent = 0;
+  while(ievent < nev) {
+    EventRecord * event = driver->GenerateEvent(p4);
+    if(!event) {
+      LOG("gevserv", pNOTICE) << "Last attempt failed. Re-trying....";
+      continue;
+    }
+    LOG("gevserv", pINFO) << "Generated event: " << *event;
+    ntpw.AddEventRecord(ievent, event);
+    ievent++;
+    delete event;
+  }
+  ntpw.Save();
+}
+//____________________________________________________________________________
+void JobStatus(TSocket * sock, TMessage * mesg)
+{
+  int pid = 0;
+  *mesg >> pid;
+
+  ReapJobs(false);
+
+  map<int,int>::const_iterator job = gJobs.find(pid);
+  int state = (job == gJobs.end()) ? -1 : job->second;
+
+  TMessage reply(kEvSrvJobState);
+  reply << state;
+  SendReply(sock, reply);
+}
+//____________________________________________________________________________
+void ReapJobs(bool wait)
+{
+  map<int,int>::iterator job = gJobs.begin();
+  for( ; job != gJobs.end(); ++job) {
+    if(job->second != 0) continue;
+    int status = 0;
+    pid_t pid = waitpid(job->first, &status, wait ? 0 : WNOHANG);
+    if(pid == 0) continue; // still running
+    bool ok = (pid > 0 && WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    job->second = ok ? 1 : -1;
+    LOG("gevserv", pNOTICE)
+      << "Job " << job->first << (ok ? " finished" : " failed");
+  }
+}
+//____________________________________________________________________________
+void SendError(TSocket * sock, string error)
+{
+  TMessage reply(kEvSrvError);
+  reply.WriteTString(error.c_str());
+  SendReply(sock, reply);
+}
+//____________________________________________________________________________
+void SendReply(TSocket * sock, TMessage & reply)
+{
+  if(gOptCompress > 0) reply.SetCompressionLevel(gOptCompress);
+  if(sock->Send(reply) <= 0) {
+    LOG("gevserv", pWARN) << "Failed to send a reply to a client";
+  }
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("gevserv", pNOTICE) << "Parsing command line arguments";
+
+  // Common run options. Set defaults and read.
+  RunOpt::Instance()->EnableBareXSecPreCalc(true);
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  CmdLnArgParser parser(argc,argv);
+
+  // help?
+  if(parser.OptionExists('h')) {
+    PrintSyntax();
+    exit(0);
+  }
+
+  // port number:
+  if( parser.OptionExists('p') ) {
+    gOptPortNum = parser.ArgAsInt('p');
+  } else {
+    LOG("gevserv", pINFO)
+      << "Unspecified port number - Using default (" << kDefPortNum << ")";
+    gOptPortNum = kDefPortNum;
+  }
+
+  // max number of clients:
+  if( parser.OptionExists("max-clients") ) {
+    gOptMaxClients = TMath::Max(1, parser.ArgAsInt("max-clients"));
+  } else {
+    gOptMaxClients = kDefMaxClients;
+  }
+
+  // compression level of the reply frames:
+  if( parser.OptionExists("compress") ) {
+    gOptCompress = parser.ArgAsInt("compress");
+  } else {
+    gOptCompress = 0;
+  }
+
+  // random number seed
+  if( parser.OptionExists("seed") ) {
+    gOptRanSeed = parser.ArgAsLong("seed");
+  } else {
+    LOG("gevserv", pINFO) << "Unspecified random number seed - Using default";
+    gOptRanSeed = -1;
+  }
+
+  // input cross-section file
+  if( parser.OptionExists("cross-sections") ) {
+    gOptInpXSecFile = parser.ArgAsString("cross-sections");
+  } else {
+    LOG("gevserv", pWARN)
+      << "Unspecified cross-section file - Expect a significant start-up overhead!";
+    gOptInpXSecFile = "";
+  }
+
+  LOG("gevserv", pNOTICE) << "Port number: " << gOptPortNum;
+  LOG("gevserv", pNOTICE) << "Max number of clients: " << gOptMaxClients;
+  LOG("gevserv", pNOTICE) << "Reply compression level: " << gOptCompress;
+  LOG("gevserv", pNOTICE) << *RunOpt::Instance();
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("gevserv", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "\n      gevserv [-h]"
+    << "\n              [-p port]"
+    << "\n              [--max-clients n]"
+    << "\n              [--compress level]"
+    << "\n              [--seed random_number_seed]"
+    << "\n               --cross-sections xml_file"
+    << "\n              [--event-generator-list list_name]"
+    << "\n              [--tune genie_tune]"
+    << "\n              [--message-thresholds xml_file]"
+    << "\n              [--unphysical-event-mask mask]"
+    << "\n              [--event-record-print-level level]"
+    << "\n              [--cache-file root_file]"
+    << "\n\n" ;
+}
+//____________________________________________________________________________
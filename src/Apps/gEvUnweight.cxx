@@ -0,0 +1,336 @@
+//_____________________________________________________________________________________________
+/*!
+
+\program gevunweight
+
+\brief   Reads a list of weighted GENIE event files (GHEP format), eg generated with
+         gevgen_fnal --force-interactions, and writes out an unweighted sample: each event
+         is kept with probability weight / max weight and the kept events get unit weight.
+         As in gevpick, the output event tree carries two additional branches with the name
+         of the original file and the original event number of each kept event.
+
+         The event weights are read from the event index columns (see NtpMCEventIndex) of
+         event trees written by this GENIE version, so only the kept event records are read
+         (a small fraction of the input for samples with a broad weight distribution).
+         Older files are scanned in full.
+
+         The normalization of the unweighted sample is that of the input samples: the sum
+         of the input tree weights (eg the POT stored by gevgen_fnal) is stored as the output
+         tree weight, and the sum of the input event weights and the max weight are stored
+         in the output tree UserInfo (SumWeights, WMax).
+
+         Synopsis:
+           gevunweight -i list_of_input_files
+                       [-o output_file]
+                       [--wmax max_weight]
+                       [--seed random_number_seed]
+                       [--message-thresholds xmfile]
+                       [--event-record-print-level level]
+                       [--thread-pool-size n]
+
+         Options:
+
+           [] denotes an optional argument
+
+           -i
+              Specify input file(s).
+              Wildcards accepted, eg `-i "/data/genie/dune/gntp.*.ghep.root"'
+           -o
+              Specify output filename.
+              (optional, default: gntp.unweighted.ghep.root)
+           --wmax
+              Max weight used for unweighting (default: the max event weight of the
+              input samples). Events with a larger weight are kept with weight / wmax.
+           --seed
+              Random number seed.
+          --message-thresholds
+              Allows users to customize the message stream thresholds.
+              The thresholds are specified using an XML file.
+              See $GENIE/config/Messenger.xml for the XML schema.
+          --event-record-print-level
+              Allows users to set the level of information shown when the event
+              record is printed in the screen. See GHepRecord::Print().
+          --thread-pool-size
+              Number of threads reading the event weights of the input files
+              concurrently (default: $GTHREADPOOLSIZE or 1). The kept events don't
+              depend on it.
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+
+*/
+//_____________________________________________________________________________________________
+
+#include <string>
+#include <vector>
+
+#include <TSystem.h>
+#include <TFile.h>
+#include <TTree.h>
+#include <TChain.h>
+#include <TChainElement.h>
+#include <TObjString.h>
+#include <TParameter.h>
+#include <TMath.h>
+
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/Ntuple/NtpMCFormat.h"
+#include "Framework/Ntuple/NtpMCEventIndex.h"
+#include "Framework/Ntuple/NtpMCEventRecord.h"
+#include "Framework/Ntuple/NtpWriter.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/ThreadPool.h"
+
+using std::string;
+using std::vector;
+
+using namespace genie;
+
+// func prototypes
+void   GetCommandLineArgs (int argc, char ** argv);
+void   Unweight           (void);
+void   ReadWeights        (string filename, vector<double> & weights, double & tree_weight);
+void   PrintSyntax        (void);
+
+// input options (from command line arguments):
+string   gOptInpFileNames;  ///< input file name
+string   gOptOutFileName;   ///< output file name
+double   gOptWMax;          ///< max weight (<=0: max input event weight)
+long int gOptRanSeed;       ///< random number seed
+
+//____________________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc, argv);
+
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+  utils::app_init::RandGen(gOptRanSeed);
+  GHepRecord::SetPrintLevel(RunOpt::Instance()->EventRecordPrintLevel());
+
+  Unweight();
+
+  return 0;
+}
+//____________________________________________________________________________________
+void Unweight(void)
+{
+  TChain gchain;
+  gchain.Add(gOptInpFileNames.c_str());
+
+  vector<string> filenames;
+  TIter next_file(gchain.GetListOfFiles());
+  TChainElement *chEl=0;
+  while (( chEl=(TChainElement*)next_file() )) {
+     filenames.push_back(chEl->GetTitle());
+  }
+  LOG("gevunweight", pNOTICE)
+      << "Processing " << filenames.size()
+      << (filenames.size()==1 ? " file " : " files ");
+
+  //
+  // Read the event weights of the input files concurrently
+  //
+
+  unsigned int nfiles = filenames.size();
+  vector< vector<double> > weights(nfiles);
+  vector<double>           tree_weights(nfiles, 0.);
+  ThreadPool::Instance()->ParallelFor(nfiles,
+     [&] (int ifile, unsigned int /*worker*/) {
+        ReadWeights(filenames[ifile], weights[ifile], tree_weights[ifile]);
+  });
+
+  double   wmax = 0, wsum = 0, tree_wsum = 0;
+  Long64_t nin  = 0;
+  for(unsigned int ifile = 0; ifile < nfiles; ifile++) {
+     for(unsigned int i = 0; i < weights[ifile].size(); i++) {
+        wmax  = TMath::Max(wmax, weights[ifile][i]);
+        wsum += weights[ifile][i];
+     }
+     nin       += weights[ifile].size();
+     tree_wsum += tree_weights[ifile];
+  }
+  if(gOptWMax > 0) wmax = gOptWMax;
+  if(wmax <= 0) {
+     LOG("gevunweight", pFATAL) << "No events with a positive weight in the input";
+     gAbortingInErr = true;
+     exit(1);
+  }
+  LOG("gevunweight", pNOTICE)
+     << "Unweighting " << nin << " events (sum of weights: " << wsum
+     << ") with max weight: " << wmax;
+
+  //
+  // Output tree, with the original filename & event number of each event
+  //
+
+  NtpWriter ntpw(kNFGHEP, 0);
+  ntpw.CustomizeFilename(gOptOutFileName);
+  ntpw.Initialize();
+  TObjString* brOrigFilename = new TObjString;
+  Long64_t    brOrigEvtNum;
+  ntpw.EventTree()->Branch("orig_filename", "TObjString", &brOrigFilename, 5000,0);
+  ntpw.EventTree()->Branch("orig_evtnum", &brOrigEvtNum, "brOrigEvtNum/L");
+
+  //
+  // Keep the events with probability weight / max weight. The random numbers are
+  // thrown in the order of the input events, so the kept events depend only on the
+  // seed & inputs. Only the kept event records are read.
+  //
+
+  TRandom3 & rnd = RandomGen::Instance()->RndGen();
+  Long64_t iev_glob = 0, nover = 0;
+  for(unsigned int ifile = 0; ifile < nfiles; ifile++) {
+
+     const vector<double> & w = weights[ifile];
+     if(w.empty()) continue;
+
+     TFile fin(filenames[ifile].c_str(),"read");
+     TTree * ghep_tree = dynamic_cast <TTree *> ( fin.Get("gtree") );
+     NtpMCEventRecord * mcrec = 0;
+     ghep_tree->SetBranchAddress("gmcrec", &mcrec);
+
+     for(unsigned int iev = 0; iev < w.size(); iev++) {
+       if(rnd.Rndm() * wmax >= w[iev]) continue;
+       ghep_tree->GetEntry(iev);
+       EventRecord & event = *(mcrec->event);
+       if(w[iev] > wmax) nover++;
+       event.SetWeight(TMath::Max(1., w[iev]/wmax));
+       LOG("gevunweight", pDEBUG) << event;
+       brOrigFilename->SetString(filenames[ifile].c_str());
+       brOrigEvtNum = iev;
+       ntpw.AddEventRecord( iev_glob, &event );
+       iev_glob++;
+       mcrec->Clear();
+     }
+     ghep_tree->ResetBranchAddresses();
+     delete mcrec;
+  }// file loop
+
+  if(nover > 0) {
+     LOG("gevunweight", pWARN)
+        << nover << " events had a weight above the max weight (kept with weight / wmax)";
+  }
+
+  // normalization of the unweighted sample
+  ntpw.EventTree()->SetWeight(tree_wsum);
+  ntpw.EventTree()->GetUserInfo()->Add(new TParameter<double>("SumWeights", wsum));
+  ntpw.EventTree()->GetUserInfo()->Add(new TParameter<double>("WMax", wmax));
+
+  ntpw.Save();
+
+  LOG("gevunweight", pNOTICE)
+     << "Kept " << iev_glob << " of " << nin << " events in " << gOptOutFileName;
+}
+//____________________________________________________________________________________
+void ReadWeights(string filename, vector<double> & weights, double & tree_weight)
+{
+// Read the weights of all events of the input file: from the index columns, for
+// files written with an NtpMCEventIndex event weight, or else from the event records.
+
+  TFile fin(filename.c_str(),"read");
+  TTree * ghep_tree = dynamic_cast <TTree *> ( fin.Get("gtree") );
+  if(!ghep_tree) {
+     LOG("gevunweight", pWARN)
+        << "No GHEP tree found in " << filename << " - Skipping to next file...";
+     return;
+  }
+  Long64_t nmax = ghep_tree->GetEntries();
+  weights.resize(nmax);
+  tree_weight = ghep_tree->GetWeight();
+
+  NtpMCEventIndex index;
+  if(ghep_tree->GetBranch("idx_wght") && index.SetBranchAddresses(ghep_tree)) {
+     LOG("gevunweight", pNOTICE)
+        << "* Reading the index weights of: " << nmax << " events in file: " << filename;
+     ghep_tree->SetBranchStatus("*", 0);
+     ghep_tree->SetBranchStatus("idx_wght", 1);
+     for(Long64_t iev = 0; iev < nmax; iev++) {
+       ghep_tree->GetEntry(iev);
+       weights[iev] = index.wght;
+     }
+  } else {
+     LOG("gevunweight", pNOTICE)
+        << "* Reading the weights of: " << nmax << " events in file: " << filename;
+     NtpMCEventRecord * mcrec = 0;
+     ghep_tree->SetBranchAddress("gmcrec", &mcrec);
+     for(Long64_t iev = 0; iev < nmax; iev++) {
+       ghep_tree->GetEntry(iev);
+       weights[iev] = mcrec->event->Weight();
+       mcrec->Clear();
+     }
+     ghep_tree->ResetBranchAddresses();
+     delete mcrec;
+  }
+}
+//____________________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  // Common run options. Set defaults and read.
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  // Parse run options for this app
+
+  CmdLnArgParser parser(argc,argv);
+
+  // get input ROOT file (containing a GENIE GHEP event tree)
+  if( parser.OptionExists('i') ) {
+    gOptInpFileNames = parser.ArgAsString('i');
+  } else {
+    LOG("gevunweight", pFATAL)
+       << "Unspecified input filename - Exiting";
+    PrintSyntax();
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  // get output file name
+  if( parser.OptionExists('o') ) {
+    gOptOutFileName = parser.ArgAsString('o');
+  } else {
+    LOG("gevunweight", pINFO)
+       << "Unspecified output filename - Using default";
+    gOptOutFileName = "gntp.unweighted.ghep.root";
+  }
+
+  // max weight
+  if( parser.OptionExists("wmax") ) {
+    gOptWMax = parser.ArgAsDouble("wmax");
+  } else {
+    gOptWMax = -1;
+  }
+
+  // random number seed
+  if( parser.OptionExists("seed") ) {
+    gOptRanSeed = parser.ArgAsLong("seed");
+  } else {
+    gOptRanSeed = -1;
+  }
+
+  // Summarize
+  LOG("gevunweight", pNOTICE)
+    << "\n\n gevunweight job info: "
+    << "\n - input file(s) : " << gOptInpFileNames
+    << "\n - output file   : " << gOptOutFileName
+    << "\n - max weight    : " << (gOptWMax > 0 ? "" : "from input ")
+    << (gOptWMax > 0 ? gOptWMax : 0.)
+    << "\n";
+}
+//____________________________________________________________________________________
+void PrintSyntax(void)
+{
+  string basedir  = string( gSystem->Getenv("GENIE") );
+  string thisfile = basedir + string("/src/Apps/gEvUnweight.cxx");
+  string cmd      = "less " + thisfile;
+
+  gSystem->Exec(cmd.c_str());
+}
+//____________________________________________________________________________________
@@ -37,6 +37,11 @@
                        [-S nrays]
                        [-z zmin]
                        [-d debug flags]
+                       [--voxel-grid nx,ny,nz[,nsub]]
+                       [--path-length-cache file]
+                       [--init-cache file]
+                       [--force-interactions]
+                       [--event-rates]
                        [--seed random_number_seed]
                         --cross-sections xml_file
                        [--event-generator-list list_name]
@@ -46,6 +51,9 @@
                        [--event-record-print-level level]
                        [--mc-job-status-refresh-rate  rate]
                        [--cache-file root_file]
+                       [--checkpoint file]
+                       [--checkpoint-interval nev]
+                       [--restart]
 
          *** Options :
 
@@ -197,6 +205,48 @@
               If left unset then flux originates on the flux window
               [No longer attempts to determine z from geometry, generally
               got this wrong]
+           --voxel-grid
+              Builds a grid of nx x ny x nz voxels over the top volume with
+              the largest density of each target nucleus in each voxel
+              (found by swimming nsub x nsub lines per voxel face along
+              each axis, default nsub=4). It provides upper bounds of the
+              path lengths of each flux neutrino so that most of them are
+              rejected before being swum through the geometry.
+              Only used with ROOTGeomAnalyzer.
+           --path-length-cache
+              Re-uses the path lengths computed for a flux entry whenever the
+              same entry is thrown again with the same ray (eg. recycled
+              flux files with fixed ray origins). The cache is loaded from
+              the given ROOT file, if it exists, and saved in it at the end
+              of the job, so that later jobs using the same flux file and
+              geometry can start from it.
+           --init-cache
+              Re-uses the total cross section splines, max path lengths and
+              interaction probability scales computed by an earlier job with
+              the same tune, geometry (file, top volume, units, fiducial cut)
+              and flux (file, location): they are loaded from the given ROOT
+              file if it was made for such a job, or computed (in parallel
+              over the initial states, see --thread-pool-size) and saved in
+              it. Not used when writing out the max path lengths (-m +file).
+           --force-interactions
+              Makes every flux neutrino crossing the geometry interact and
+              weights each event by the interaction probability of its flux
+              neutrino (see GMCJDriver::ForceInteractions()), rather than
+              throwing flux neutrinos until one interacts. Far fewer flux
+              neutrinos are needed per event for thin detectors. The sample
+              normalization is unchanged (POT, for summed event weights);
+              use gevunweight to get an unweighted sample.
+           --event-rates
+              Computes the expected event rates of every enabled channel for
+              each neutrino type & target material, for a full cycle of the
+              flux (or for -n flux neutrinos, as needed for flux histograms),
+              instead of generating events: only the path lengths and
+              the cross section splines are evaluated (no kinematics,
+              hadronization or FSI), in parallel over --thread-pool-size
+              threads. The rates, per flux exposure unit (eg POT, or else per
+              flux neutrino), are printed
+              and saved in the gEvRates tree of [prefix].[run_number].rates.root
+              (branches NuPdg, TgtPdg, Channel, Rate, RateErr).
            -o
               Sets the prefix of the output event file.
               The output filename is built as:
@@ -228,6 +278,17 @@
            --cache-file
               Allows users to specify a cache file so that the cache can be
               re-used in subsequent MC jobs.
+           --checkpoint
+              Periodically saves a checkpoint (random number generator state,
+              flux driver position & exposure counters, number of events
+              written out) in the specified ROOT file, so that a job killed
+              partway through can be restarted (see --restart).
+           --checkpoint-interval
+              Number of generated events between checkpoints [default: 1000].
+           --restart
+              Resumes the job from the file given via --checkpoint, appending
+              events to the existing output event file. All other options must
+              be identical to those of the original job.
 
          *** Examples:
 
@@ -273,6 +334,7 @@
 
 #include <cassert>
 #include <cstdlib>
+#include <cstring>
 #include <csignal>
 
 #include <string>
@@ -286,12 +348,14 @@
 #include <TError.h>  // for gErrorIgnoreLevel
 #include <TTree.h>
 #include <TFile.h>
+#include <TObjString.h>
 #include <TH1D.h>
 #include <TMath.h>
 #include <TGeoVolume.h>
 #include <TGeoShape.h>
 
 #include "Framework/Conventions/Units.h"
+#include "Framework/EventGen/EVGThreadStats.h"
 #include "Framework/EventGen/EventRecord.h"
 #include "Framework/EventGen/GFluxI.h"
 #include "Framework/EventGen/GMCJDriver.h"
@@ -354,6 +418,8 @@ void CreateRockBoxSelection (string fidcut, GeomAnalyzerI* geom_driver);
 void DetermineFluxDriver(string fopt);
 void ParseFluxHst       (string fopt);
 void ParseFluxFileConfig(string fopt);
+void SaveEventRates     (GMCJDriver * mcj_driver,
+                         genie::flux::GFluxExposureI * fluxExposureI);
 
 // Default options (override them using the command line arguments):
 //
@@ -391,6 +457,11 @@ string          gOptEvFilePrefix;              // event file prefix
 int             gOptDebug = 0;                 // debug flags
 long int        gOptRanSeed;                   // random number seed
 string          gOptInpXSecFile;               // cross-section splines
+string          gOptVoxelGrid;                 // voxel grid nx,ny,nz[,nsub] (ROOT geom only)
+string          gOptPlCacheFile;               // path length cache file
+string          gOptInitCacheFile;             // init cache file (total xsec splines, prob scales)
+bool            gOptForceInteractions;         // weighted events, every flux neutrino crossing the geometry interacts
+bool            gOptEventRates;                // compute event rates rather than generating events
 
 bool            gSigTERM = false;              // was TERM signal sent?
 
@@ -417,7 +488,7 @@ int main(int argc, char ** argv)
   utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
   utils::app_init::CacheFile(RunOpt::Instance()->CacheFile());
   utils::app_init::RandGen(gOptRanSeed);
-  utils::app_init::XSecTable(gOptInpXSecFile, false);
+  utils::app_init::XSecTable(gOptInpXSecFile, false, true);
 
   // Set GHEP print level
   int print_level = RunOpt::Instance()->EventRecordPrintLevel();
@@ -603,6 +674,29 @@ int main(int argc, char ** argv)
     }
   }
 
+  // *************************************************************************
+  // * Optional voxel grid: path length bounds for a fast first rejection
+  // *************************************************************************
+  if ( gOptUsingRootGeom && gOptVoxelGrid != "" ) {
+
+    geometry::ROOTGeomAnalyzer * rgeom =
+      dynamic_cast<geometry::ROOTGeomAnalyzer *>(geom_driver);
+    if ( ! rgeom ) assert(0);
+
+    vector<string> nvox = utils::str::Split(gOptVoxelGrid,",");
+    if ( nvox.size() != 3 && nvox.size() != 4 ) {
+      LOG("gevgen_fnal", pFATAL)
+        << "Invalid voxel grid: \"" << gOptVoxelGrid
+        << "\" (expected nx,ny,nz[,nsub])";
+      gAbortingInErr = true;
+      exit(1);
+    }
+    int nsub = (nvox.size() == 4) ? atoi(nvox[3].c_str()) : 4;
+    rgeom->BuildVoxelGrid(atoi(nvox[0].c_str()),
+                          atoi(nvox[1].c_str()),
+                          atoi(nvox[2].c_str()), nsub);
+  }
+
   // *************************************************************************
   // * Create/configure the event generation driver
   // *************************************************************************
@@ -613,9 +707,32 @@ int main(int argc, char ** argv)
   if ( ( gOptExtMaxPlXml != "" ) && ! gOptWriteMaxPlXml ) {
     mcj_driver->UseMaxPathLengths(gOptExtMaxPlXml);
   }
-  mcj_driver->Configure();
+  if ( gOptInitCacheFile != "" && ! gOptWriteMaxPlXml ) {
+    // the geometry & flux inputs aren't known to the driver: key them here,
+    // with content hashes of the geometry & max path length files (the flux
+    // may be a pattern over many large files: it is keyed by name)
+    ostringstream key;
+    key << "geom:" << gOptRootGeom << "[" << gOptRootGeomTopVol << "]"
+        << "#" << utils::system::FileContentHash(gOptRootGeom)
+        << ",L:" << gOptGeomLUnits << ",D:" << gOptGeomDUnits
+        << ",fid:" << gOptFidCut
+        << ",maxpl:" << gOptExtMaxPlXml
+        << "#" << utils::system::FileContentHash(gOptExtMaxPlXml)
+        << ";flux:" << gOptFluxFile << "@" << gOptDetectorLocation;
+    mcj_driver->UseInitCache(gOptInitCacheFile, key.str());
+  }
+  mcj_driver->Configure( ! gOptEventRates ); // rates need no prob scales
   mcj_driver->UseSplines();
   mcj_driver->ForceSingleProbScale();
+  mcj_driver->ForceInteractions(gOptForceInteractions);
+
+  if ( gOptPlCacheFile != "" ) {
+    bool loaded = false;
+    if ( ! gSystem->AccessPathName(gOptPlCacheFile.c_str()) ) {
+      loaded = mcj_driver->LoadPathLengthCache(gOptPlCacheFile);
+    }
+    if ( ! loaded ) mcj_driver->UsePathLengthCache(true);
+  }
 
   if ( ( gOptExtMaxPlXml != "" ) && gOptWriteMaxPlXml ) {
     geometry::ROOTGeomAnalyzer * rgeom =
@@ -648,6 +765,21 @@ int main(int argc, char ** argv)
     }
   }
 
+  // *************************************************************************
+  // * Event rate tables, rather than events
+  // *************************************************************************
+  if ( gOptEventRates ) {
+    SaveEventRates(mcj_driver, fluxExposureI);
+    if ( gOptPlCacheFile != "" ) {
+      mcj_driver->SavePathLengthCache(gOptPlCacheFile);
+    }
+    delete geom_driver;
+    delete flux_driver;
+    delete mcj_driver;
+    LOG("gevgen_fnal", pNOTICE) << "Done!";
+    return 0;
+  }
+
   // *************************************************************************
   // * Prepare for writing the output event tree & status file
   // *************************************************************************
@@ -655,7 +787,22 @@ int main(int argc, char ** argv)
   // Initialize an Ntuple Writer to save GHEP records into a TTree
   NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
   ntpw.CustomizeFilenamePrefix(gOptEvFilePrefix);
-  ntpw.Initialize();
+
+  // Start from scratch, or resume a checkpointed job
+  string ckpt_file = RunOpt::Instance()->CheckpointFile();
+  int    ckpt_nev  = RunOpt::Instance()->CheckpointInterval();
+  bool   restart   = ! ckpt_file.empty() && RunOpt::Instance()->Restart();
+  Long64_t ievent0 = 0;
+  if ( restart ) {
+    if ( ! mcj_driver->RestoreCheckpoint(ckpt_file, ievent0) ||
+         ! ntpw.Resume(ievent0) ) {
+      LOG("gevgen_fnal", pFATAL)
+        << "Couldn't restart job from checkpoint: " << ckpt_file;
+      exit(1);
+    }
+  } else {
+    ntpw.Initialize();
+  }
 
 
   std::vector<TBranch*>    extraBranches;
@@ -685,7 +832,14 @@ int main(int argc, char ** argv)
         LOG("gevgen_fnal", pNOTICE)
           << "Adding extra branch \"" << bname << "\" of type \""
           << cname << "\" (" << optr << ") to output tree";
-        TBranch* bptr = ntpw.EventTree()->Branch(bname,cname,optr,32000,split);
+        TBranch* bptr = 0;
+        if ( restart && ntpw.EventTree()->GetBranch(bname) ) {
+          // resumed job: re-attach the branch already in the event tree
+          ntpw.EventTree()->SetBranchAddress(bname,optr);
+          bptr = ntpw.EventTree()->GetBranch(bname);
+        } else {
+          bptr = ntpw.EventTree()->Branch(bname,cname,optr,32000,split);
+        }
         extraBranches.push_back(bptr);
 
         if ( bptr ) {
@@ -711,7 +865,7 @@ int main(int argc, char ** argv)
   // define handler to allow signal to end job gracefully
   signal(SIGTERM,gsSIGTERMhandler);
 
-  int ievent = 0;
+  int ievent = ievent0;
   while ( ! gSigTERM )
   {
      LOG("gevgen_fnal", pINFO)
@@ -760,6 +914,12 @@ int main(int argc, char ** argv)
      delete event;
      ievent++;
 
+     // checkpoint, if requested
+     if ( ! ckpt_file.empty() && ievent % ckpt_nev == 0 ) {
+       ntpw.Checkpoint();
+       mcj_driver->SaveCheckpoint(ckpt_file, ievent);
+     }
+
   } //1
 
   // Copy metadata tree, if available
@@ -831,6 +991,16 @@ int main(int argc, char ** argv)
   // Save the generated event tree & close the output file
   ntpw.Save();
 
+  // Save the path lengths for later jobs
+  if ( gOptPlCacheFile != "" ) {
+    mcj_driver->SavePathLengthCache(gOptPlCacheFile);
+  }
+
+  // Save per-module event generation statistics, if requested
+  if ( ! RunOpt::Instance()->EVGStatsFile().empty() ) {
+    EVGThreadStats::Instance()->Save(RunOpt::Instance()->EVGStatsFile());
+  }
+
   // Clean-up
   delete geom_driver;
   delete flux_driver;
@@ -1152,6 +1322,36 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptInpXSecFile = "";
   }
 
+  // voxel grid for fast flux neutrino rejection
+  if( parser.OptionExists("voxel-grid") ) {
+    LOG("gevgen_fnal", pINFO) << "Reading voxel grid size";
+    gOptVoxelGrid = parser.ArgAsString("voxel-grid");
+  } else {
+    gOptVoxelGrid = "";
+  }
+
+  // path length cache
+  if( parser.OptionExists("path-length-cache") ) {
+    LOG("gevgen_fnal", pINFO) << "Reading path length cache file name";
+    gOptPlCacheFile = parser.ArgAsString("path-length-cache");
+  } else {
+    gOptPlCacheFile = "";
+  }
+
+  // init cache
+  if( parser.OptionExists("init-cache") ) {
+    LOG("gevgen_fnal", pINFO) << "Reading init cache file name";
+    gOptInitCacheFile = parser.ArgAsString("init-cache");
+  } else {
+    gOptInitCacheFile = "";
+  }
+
+  // weighted events, forcing the flux neutrinos to interact
+  gOptForceInteractions = parser.OptionExists("force-interactions");
+
+  // event rates, rather than events
+  gOptEventRates = parser.OptionExists("event-rates");
+
 
   //
   // >>> perform 'sanity' checks on command line arguments
@@ -1161,7 +1361,8 @@ void GetCommandLineArgs(int argc, char ** argv)
   // - a number of POTs
   // - a number of generated events
   // Only one of those options can be set.
-  if(!gOptUsingHistFlux) {
+  // (not needed for event rates, computed for a full cycle of a flux ntuple)
+  if(!gOptUsingHistFlux && !gOptEventRates) {
     int nset=0;
     if(gOptPOT > 0) nset++;
     if(gOptNev > 0) nset++;
@@ -1270,6 +1471,69 @@ void GetCommandLineArgs(int argc, char ** argv)
 
   LOG("gevgen_fnal", pNOTICE) << *RunOpt::Instance();
 }
+//____________________________________________________________________________
+void SaveEventRates(GMCJDriver * mcj_driver,
+                    genie::flux::GFluxExposureI * fluxExposureI)
+{
+// Compute the event rates of all enabled channels for a full cycle of the
+// flux (or -n flux neutrinos), normalize them to the flux exposure and save them in a tree
+
+  vector<GMCJDriver::EventRate> rates;
+  Long64_t nflux = ( gOptNev > 0 ) ? gOptNev : -1;
+  if ( ! mcj_driver->ComputeEventRates(rates, nflux) ) {
+    LOG("gevgen_fnal", pFATAL) << "Couldn't compute the event rates";
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  // per exposure unit (eg POT), or else per flux neutrino thrown
+  double      fexposure     = mcj_driver->NFluxNeutrinos();
+  const char* exposureUnits = "flux neutrino";
+  if ( fluxExposureI ) {
+    fexposure     = fluxExposureI->GetTotalExposure();
+    exposureUnits = fluxExposureI->GetExposureUnits();
+  }
+  double norm = ( fexposure > 0 ) ? 1./fexposure : 1.;
+
+  ostringstream filename;
+  filename << gOptEvFilePrefix << "." << gOptRunNu << ".rates.root";
+  TFile file(filename.str().c_str(), "RECREATE");
+  TTree * rate_tree = new TTree("gEvRates", "GENIE event rates per channel");
+  int    nupdg = 0, tgtpdg = 0;
+  char   channel[1024];
+  double rate = 0, rate_err = 0;
+  rate_tree->Branch("NuPdg",   &nupdg,    "NuPdg/I");
+  rate_tree->Branch("TgtPdg",  &tgtpdg,   "TgtPdg/I");
+  rate_tree->Branch("Channel", channel,   "Channel/C");
+  rate_tree->Branch("Rate",    &rate,     "Rate/D");
+  rate_tree->Branch("RateErr", &rate_err, "RateErr/D");
+
+  ostringstream table;
+  double total = 0;
+  for ( unsigned int i = 0; i < rates.size(); i++ ) {
+    const GMCJDriver::EventRate & r = rates[i];
+    nupdg    = r.fNuPdg;
+    tgtpdg   = r.fTgtPdg;
+    rate     = r.fRate    * norm;
+    rate_err = r.fRateErr * norm;
+    strncpy(channel, r.fChannel.c_str(), sizeof(channel)-1);
+    channel[sizeof(channel)-1] = 0;
+    rate_tree->Fill();
+    total += rate;
+    if ( rate > 0 ) {
+      table << "\n " << r.fChannel << " : " << rate << " +/- " << rate_err;
+    }
+  }
+  rate_tree->GetUserInfo()->Add(new TObjString(exposureUnits));
+  file.Write();
+  file.Close();
+
+  LOG("gevgen_fnal", pNOTICE)
+    << "\n Event rates per " << exposureUnits << " * detector" << table.str()
+    << "\n ** Total : " << total
+    << "\n Saved in: " << filename.str();
+}
+
 //____________________________________________________________________________
 void PrintSyntax(void)
 {
@@ -1282,7 +1546,10 @@ void PrintSyntax(void)
    << "\n            [-n n_of_events] [-e exposure_in_POTs]"
    << "\n            [-o output_event_file_prefix]"
    << "\n            [-F fid_cut_string] [-S nrays_scan]"
-   << "\n            [-z zmin_start]"
+   << "\n            [-z zmin_start] [--voxel-grid nx,ny,nz[,nsub]]"
+   << "\n            [--path-length-cache file]"
+   << "\n            [--init-cache file] [--force-interactions]"
+   << "\n            [--event-rates]"
    << "\n            [--seed random_number_seed]"
    << "\n             --cross-sections xml_file"
    << "\n            [--event-generator-list list_name]"
@@ -1291,6 +1558,9 @@ void PrintSyntax(void)
    << "\n            [--event-record-print-level level]"
    << "\n            [--mc-job-status-refresh-rate  rate]"
    << "\n            [--cache-file root_file]"
+   << "\n            [--checkpoint file]"
+   << "\n            [--checkpoint-interval nev]"
+   << "\n            [--restart]"
    << "\n"
    << " Please also read the detailed documentation at "
    << "$GENIE/src/Apps/gFNALExptEvGen.cxx"
@@ -0,0 +1,141 @@
+//____________________________________________________________________________
+/*!
+
+\program gmectensor2bin
+
+\brief   Converts the MEC hadron tensor text files to the binary format
+         which is mapped in memory by MECHadronTensor (one file per target),
+         so that jobs skip parsing the text files and share the tables
+         through the page cache.
+
+         Syntax :
+           gmectensor2bin [-t target_pdg_codes] [-o output_dir]
+                          [--message-thresholds xml_file]
+
+         Options :
+           -t
+              Comma separated list of target PDG codes.
+              [default: all targets with hadron tensor tables]
+           -o
+              Output directory.
+              [default: the hadron tensor data directory, $GMECTENSORDATA if
+              set or else $GENIE/data/evgen/mectensor/nieves]
+           --message-thresholds
+              Allows users to customize the message stream thresholds.
+              The thresholds are specified using an XML file.
+              See $GENIE/config/Messenger.xml for the XML schema.
+
+         Notes :
+           The binary files are only used if they are in the hadron tensor
+           data directory. They must be rebuilt if the text files change.
+
+         Example :
+
+           shell% gmectensor2bin -t 1000060120,1000080160
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <TSystem.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Physics/Multinucleon/XSection/MECHadronTensor.h"
+
+using std::string;
+using std::vector;
+
+using namespace genie;
+
+void GetCommandLineArgs (int argc, char ** argv);
+void PrintSyntax        (void);
+
+//User-specified options:
+vector<int> gOptTargets; ///< targets to convert the tables of
+string      gOptOutDir;  ///< output directory
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc,argv);
+
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+
+  MECHadronTensor * hadtensor = MECHadronTensor::Instance();
+
+  if(gOptTargets.empty()) gOptTargets = hadtensor->KnownTensors();
+
+  int nerr = 0;
+  for(unsigned int i = 0; i < gOptTargets.size(); i++) {
+    int targetpdg = gOptTargets[i];
+    if( ! hadtensor->KnownTensor(targetpdg) ) {
+      LOG("gmectensor2bin", pERROR)
+        << "No hadron tensor tables for target: " << targetpdg;
+      nerr++;
+      continue;
+    }
+    string filename = hadtensor->BinaryFileName(targetpdg);
+    if( ! gOptOutDir.empty() ) {
+      filename = gOptOutDir + "/" + gSystem->BaseName(filename.c_str());
+    }
+    if( ! hadtensor->SaveAsBinary(targetpdg, filename) ) nerr++;
+  }
+
+  if(nerr > 0) {
+    LOG("gmectensor2bin", pFATAL)
+      << "Failed to convert the tables of " << nerr << " target(s)";
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  return 0;
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("gmectensor2bin", pNOTICE) << "Parsing command line arguments";
+
+  // Common run options.
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  // Parse run options for this app
+
+  CmdLnArgParser parser(argc,argv);
+
+  if( parser.OptionExists('t') ) {
+    LOG("gmectensor2bin", pINFO) << "Reading target PDG codes";
+    gOptTargets = parser.ArgAsIntTokens('t', ",");
+  }
+
+  if( parser.OptionExists('o') ) {
+    LOG("gmectensor2bin", pINFO) << "Reading output directory";
+    gOptOutDir = parser.ArgAsString('o');
+  }
+
+  if( parser.OptionExists('h') ) {
+    PrintSyntax();
+    exit(0);
+  }
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("gmectensor2bin", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "   gmectensor2bin [-t target_pdg_codes] [-o output_dir]"
+    << " [--message-thresholds xml_file]\n\n";
+}
+//____________________________________________________________________________
@@ -16,9 +16,13 @@
                   <-o | --output-cross-sections> output_xml_xsec_file
                   [-n nknots]
                   [-e max_energy]
+                  [--adaptive-knots tolerance]
                   [--no-copy]
+                  [--task-id task_id --n-tasks number_of_tasks]
+                  [--nproc number_of_processes]
+                  [--cache-file root_file [--max-xsec-envelopes]]
                   [--seed random_number_seed]
-                  [--input-cross-sections xml_file]
+                  [--input-cross-sections xml_file [--update]]
                   [--event-generator-list list_name]
                   [--tune genie_tune]
                   [--message-thresholds xml_file]
@@ -39,6 +43,8 @@
                A ROOT file containing a ROOT/GEANT geometry description.
            -o, --output-cross-sections
                Name of output XML file containing computed cross-section data.
+               If the name ends in `.bin', the splines are written in the
+               memory-mappable binary format instead (see XSecSplineList).
                Default: `xsec_splines.xml'.
            -n
                Number of knots per spline.
@@ -48,14 +54,67 @@
                Maximum energy in spline.
                Default: The max energy in the validity range of the spline
                generating thread.
+           --adaptive-knots
+               Places the spline knots adaptively: Starting from a coarse
+               grid, intervals are split until the cross section computed at
+               their midpoint agrees with the interpolated one within the
+               given relative tolerance (e.g. 1E-3). The number of knots set
+               with -n is then the maximum number of knots per spline.
            --no-copy
                Does not write out the input cross-sections in the output file
+           --task-id, --n-tasks
+               Splits the spline calculation into a number of tasks and
+               computes only the splines of the given task (0 to n-tasks-1).
+               All the splines needed for the input neutrinos and targets
+               are enumerated in a fixed order and distributed to tasks in
+               turn, so that the same list of neutrinos and targets (and the
+               same input cross-sections) must be given to all tasks.
+               Free-nucleon splines, used when computing nuclear cross
+               sections, should be computed first and passed to all tasks
+               via --input-cross-sections.
+               The partial outputs can be merged with gspladd.
+           --nproc
+               Number of processes used for computing the splines (of the
+               current task, if --task-id is set) on the local machine.
+               The splines computed by each process are merged in the output
+               file. Default: 1.
+           --cache-file
+               Name of a ROOT file used for memoizing the computed cross
+               section integrals. Integrals are keyed on a hash of the full
+               (resolved) configuration of the cross section algorithm and
+               of the interaction, so that they can be re-used by any later
+               job, and any tune, with identical settings. The file is read
+               at the start of the job and updated at its end. It is not
+               updated by the processes started with --nproc, and it should
+               not be shared by concurrent jobs. Cached values must be
+               discarded whenever the GENIE code or its data files change.
+           --max-xsec-envelopes
+               Also precomputes, over the full energy range of each spline,
+               the max differential cross sections used by the kinematics
+               generators for the rejection method, and stores them in the
+               --cache-file. Event generation jobs given the same cache file
+               (and tune) then skip the max cross section scans at start-up.
+               The envelopes are computed by the first task (see --task-id)
+               in the main process.
            --seed
               Random number seed.
            --input-cross-sections
               Name (incl. full path) of an XML file with pre-computed
               free-nucleon cross-section values. If loaded, it can speed-up
               cross-section calculation for nuclear targets.
+           --update
+              Incremental update of the --input-cross-sections file, eg after
+              a change in the tune configuration: Every input spline needed
+              for the input neutrinos and targets is compared with the current
+              configuration (a hash of the resolved configuration of its cross
+              section algorithm and of its knot settings is stored with each
+              spline in the output files). Only the splines whose configuration
+              changed, or that were saved without a configuration hash by
+              earlier GENIE versions, are built again. Unchanged splines are
+              copied forward (unless --no-copy is set). The --task-id and
+              --nproc options then distribute the splines to be rebuilt. Input
+              free-nucleon splines used for nuclear targets are only checked
+              if the free nucleons are among the targets.
           --event-generator-list
               List of event generators to load in event generation drivers.
               [default: "Default"].
@@ -85,17 +144,28 @@
 
 #include <cassert>
 #include <cstdlib>
+#include <cstdio>
+#include <sstream>
 #include <string>
 #include <vector>
 
+#include <unistd.h>
+#include <sys/wait.h>
+
 #if defined(HAVE_FENV_H) && defined(HAVE_FEENABLEEXCEPT)
 #include <fenv.h> // for `feenableexcept`
 #endif
 
 #include <TSystem.h>
+#include <TMath.h>
 
 #include "Framework/Conventions/GBuild.h"
 #include "Framework/EventGen/GEVGDriver.h"
+#include "Framework/EventGen/EventGenerator.h"
+#include "Framework/EventGen/EventGeneratorList.h"
+#include "Framework/EventGen/InteractionList.h"
+#include "Framework/EventGen/InteractionListGeneratorI.h"
+#include "Framework/EventGen/RunningThreadInfo.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
@@ -107,6 +177,7 @@
 #include "Framework/Utils/PrintUtils.h"
 #include "Framework/Utils/XSecSplineList.h"
 #include "Framework/Utils/CmdLnArgParser.h"
+#include "Physics/Common/KineGeneratorWithCache.h"
 
 #ifdef __GENIE_GEOM_DRIVERS_ENABLED__
 #include "Tools/Geometry/ROOTGeomAnalyzer.h"
@@ -114,6 +185,7 @@
 
 using std::string;
 using std::vector;
+using std::ostringstream;
 
 using namespace genie;
 
@@ -126,6 +198,14 @@ void          GetCommandLineArgs (int argc, char ** argv);
 void          PrintSyntax        (void);
 PDGCodeList * GetNeutrinoCodes   (void);
 PDGCodeList * GetTargetCodes     (void);
+void          MakeSplines        (const PDGCodeList & neutrinos,
+                                  const PDGCodeList & targets,
+                                  int task, int ntasks);
+string        PartialOutputFile  (int iproc);
+void          MakeMaxXSecEnvelopes (const PDGCodeList & neutrinos,
+                                    const PDGCodeList & targets);
+void          RemoveStaleSplines (const PDGCodeList & neutrinos,
+                                  const PDGCodeList & targets);
 
 // User-specified options:
 string   gOptNuPdgCodeList  = "";
@@ -134,9 +214,15 @@ string   gOptGeomFilename   = "";
 int      gOptNKnots         = -1;
 double   gOptMaxE           = -1.;
 bool     gOptNoCopy         = false;
+double   gOptAdaptiveTol    = -1.;  // adaptive knot placement tolerance (off if <0)
 long int gOptRanSeed        = -1;   // random number seed
 string   gOptInpXSecFile    = "";   // input cross-section file
 string   gOptOutXSecFile    = "";   // output cross-section file
+int      gOptTaskId         = 0;    // spline calculation task id
+int      gOptNTasks         = 1;    // number of spline calculation tasks
+int      gOptNProc          = 1;    // number of local processes
+bool     gOptMaxXSecEnv     = false; // precompute max xsec envelopes?
+bool     gOptUpdate         = false; // rebuild only the input splines whose configuration changed?
 
 //____________________________________________________________________________
 int main(int argc, char ** argv)
@@ -159,6 +245,7 @@ int main(int argc, char ** argv)
   utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
   utils::app_init::RandGen(gOptRanSeed);
   utils::app_init::XSecTable(gOptInpXSecFile, false);
+  utils::app_init::CacheFile(RunOpt::Instance()->CacheFile());
 
   // Get list of neutrinos and nuclear targets
 
@@ -179,33 +266,208 @@ int main(int argc, char ** argv)
   LOG("gmkspl", pINFO) << "Neutrinos: " << *neutrinos;
   LOG("gmkspl", pINFO) << "Targets: "   << *targets;
 
+  XSecSplineList * xspl = XSecSplineList::Instance();
+  bool save_init = !gOptNoCopy;
+  if(gOptAdaptiveTol > 0) {
+    xspl->SetAdaptiveKnots(true, gOptAdaptiveTol);
+  }
+  if(RunOpt::Instance()->CacheFile().size() > 0) {
+    xspl->SetIntegralCache(true);
+  }
+
+  // In update mode, drop the input splines built with another configuration,
+  // so that they are built again (before forking: the processes and the final
+  // merge see the same list)
+  if(gOptUpdate) {
+    RemoveStaleSplines(*neutrinos, *targets);
+  }
+
+  if(gOptNProc == 1) {
+    // Build the splines of the current task in this process
+    MakeSplines(*neutrinos, *targets, gOptTaskId, gOptNTasks);
+  }
+  else {
+    // Fork a process for each share of the current task. Each process writes
+    // the splines it computed in a partial output file.
+    vector<pid_t> children;
+    for(int iproc = 0; iproc < gOptNProc; iproc++) {
+      pid_t pid = fork();
+      if(pid < 0) {
+        LOG("gmkspl", pFATAL) << "Couldn't fork spline calculation process";
+        gAbortingInErr = true;
+        exit(1);
+      }
+      if(pid == 0) {
+        MakeSplines(*neutrinos, *targets,
+           gOptTaskId * gOptNProc + iproc, gOptNTasks * gOptNProc);
+        xspl->Save(PartialOutputFile(iproc), false);
+        _exit(0);
+      }
+      children.push_back(pid);
+    }
+    bool ok = true;
+    for(unsigned int i = 0; i < children.size(); i++) {
+      int status = 0;
+      waitpid(children[i], &status, 0);
+      ok = ok && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    }
+    if(!ok) {
+      LOG("gmkspl", pFATAL) << "A spline calculation process failed";
+      gAbortingInErr = true;
+      exit(1);
+    }
+    // Merge the partial outputs, in process order
+    for(int iproc = 0; iproc < gOptNProc; iproc++) {
+      string filename = PartialOutputFile(iproc);
+      bool keep = save_init || iproc > 0;
+      XmlParserStatus_t status = xspl->Load(filename, keep);
+      if(status != kXmlOK) {
+        LOG("gmkspl", pFATAL) << "Problem reading file: " << filename;
+        gAbortingInErr = true;
+        exit(1);
+      }
+      remove(filename.c_str());
+    }
+    save_init = true;
+  }
+
+  // Save the splines at the requested XML file
+  xspl->Save(gOptOutXSecFile, save_init);
+
+  // Precompute the max xsec envelopes (saved in the cache file at exit)
+  if(gOptMaxXSecEnv && gOptTaskId == 0) {
+    MakeMaxXSecEnvelopes(*neutrinos, *targets);
+  }
+
+  delete neutrinos;
+  delete targets;
+
+  return 0;
+}
+//____________________________________________________________________________
+void MakeSplines(
+  const PDGCodeList & neutrinos, const PDGCodeList & targets,
+  int task, int ntasks)
+{
   // Loop over all possible input init states and ask the GEVGDriver
   // to build splines for all the interactions that its loaded list
   // of event generators can generate.
+  // The missing splines are taken in turn by the ntasks tasks: only those
+  // of the input task are built.
+
+  long int ispline = 0;
+  GEVGDriver::SplineFilter_t filter;
+  if(ntasks > 1) {
+    filter = [&ispline, task, ntasks] (const Interaction *) {
+      return (ispline++ % ntasks) == task;
+    };
+  }
 
   PDGCodeList::const_iterator nuiter;
   PDGCodeList::const_iterator tgtiter;
-  for(nuiter = neutrinos->begin(); nuiter != neutrinos->end(); ++nuiter) {
-    for(tgtiter = targets->begin(); tgtiter != targets->end(); ++tgtiter) {
+  for(nuiter = neutrinos.begin(); nuiter != neutrinos.end(); ++nuiter) {
+    for(tgtiter = targets.begin(); tgtiter != targets.end(); ++tgtiter) {
       int nupdgc  = *nuiter;
       int tgtpdgc = *tgtiter;
       InitialState init_state(tgtpdgc, nupdgc);
       GEVGDriver driver;
       driver.SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
       driver.Configure(init_state);
-      driver.CreateSplines(gOptNKnots, gOptMaxE);
+      driver.CreateSplines(gOptNKnots, gOptMaxE, true, filter);
     }
   }
 
-  // Save the splines at the requested XML file
-  XSecSplineList * xspl = XSecSplineList::Instance();
-  bool save_init = !gOptNoCopy;
-  xspl->SaveAsXml(gOptOutXSecFile, save_init);
+  LOG("gmkspl", pNOTICE)
+    << "Task " << task << " / " << ntasks << " done";
+}
+//____________________________________________________________________________
+void RemoveStaleSplines(
+  const PDGCodeList & neutrinos, const PDGCodeList & targets)
+{
+  int nloaded  = XSecSplineList::Instance()->NSplines();
+  int nremoved = 0;
 
-  delete neutrinos;
-  delete targets;
+  PDGCodeList::const_iterator nuiter;
+  PDGCodeList::const_iterator tgtiter;
+  for(nuiter = neutrinos.begin(); nuiter != neutrinos.end(); ++nuiter) {
+    for(tgtiter = targets.begin(); tgtiter != targets.end(); ++tgtiter) {
+      InitialState init_state(*tgtiter, *nuiter);
+      GEVGDriver driver;
+      driver.SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+      driver.Configure(init_state);
+      nremoved += driver.RemoveStaleSplines(gOptNKnots, gOptMaxE, true);
+    }
+  }
 
-  return 0;
+  LOG("gmkspl", pNOTICE)
+    << nremoved << " of the " << nloaded << " input splines were built with "
+    << "a different configuration and will be built again";
+}
+//____________________________________________________________________________
+void MakeMaxXSecEnvelopes(
+  const PDGCodeList & neutrinos, const PDGCodeList & targets)
+{
+  // Loop over all possible input init states and, for every interaction
+  // that can be generated, ask the kinematics generators with a max xsec
+  // cache to fill it over the energy range of the interaction spline.
+
+  PDGCodeList::const_iterator nuiter;
+  PDGCodeList::const_iterator tgtiter;
+  for(nuiter = neutrinos.begin(); nuiter != neutrinos.end(); ++nuiter) {
+    for(tgtiter = targets.begin(); tgtiter != targets.end(); ++tgtiter) {
+      InitialState init_state(*tgtiter, *nuiter);
+      GEVGDriver driver;
+      driver.SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+      driver.Configure(init_state);
+
+      int nknots = gOptNKnots;
+      const EventGeneratorList * evglist = driver.EventGenerators();
+      EventGeneratorList::const_iterator evgiter = evglist->begin();
+      for( ; evgiter != evglist->end(); ++evgiter) {
+        const EventGenerator * evgen =
+             dynamic_cast<const EventGenerator *> (*evgiter);
+        if(!evgen) continue;
+
+        // same energy range and number of points as the xsec splines
+        double Emin = TMath::Max(0.001, evgen->ValidityContext().Emin());
+        double Emax = evgen->ValidityContext().Emax();
+        if(gOptMaxE > 0) Emax = TMath::Min(gOptMaxE, Emax);
+        if(Emax <= Emin) continue;
+        if(nknots < 0) nknots = (int) (15 * TMath::Log10(Emax-Emin));
+        nknots = TMath::Max(nknots, 30);
+
+        InteractionList * ilst =
+           evgen->IntListGenerator()->CreateInteractionList(init_state);
+        if(!ilst) continue;
+
+        RunningThreadInfo::Instance()->UpdateRunningThread(evgen);
+
+        const vector<const EventRecordVisitorI *> & modules = evgen->Modules();
+        for(unsigned int im = 0; im < modules.size(); im++) {
+          const KineGeneratorWithCache * kine =
+               dynamic_cast<const KineGeneratorWithCache *> (modules[im]);
+          if(!kine) continue;
+          InteractionList::const_iterator intiter = ilst->begin();
+          for( ; intiter != ilst->end(); ++intiter) {
+            kine->PrecomputeMaxXSec(
+               evgen->CrossSectionAlg(), *intiter, Emin, Emax, nknots);
+          }
+        }
+        delete ilst;
+      }
+    }
+  }
+}
+//____________________________________________________________________________
+string PartialOutputFile(int iproc)
+{
+  ostringstream name;
+  name << gOptOutXSecFile << ".proc" << iproc;
+  if(gOptOutXSecFile.size() > 4 &&
+     gOptOutXSecFile.compare(gOptOutXSecFile.size()-4, 4, ".bin") == 0) {
+    name << ".bin";
+  }
+  return name.str();
 }
 //____________________________________________________________________________
 void GetCommandLineArgs(int argc, char ** argv)
@@ -256,6 +518,12 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptMaxE = -1;
   }
 
+  // adaptive knot placement
+  if( parser.OptionExists("adaptive-knots") ) {
+    LOG("gmkspl", pINFO) << "Reading adaptive knot placement tolerance";
+    gOptAdaptiveTol = parser.ArgAsDouble("adaptive-knots");
+  }
+
   // write out input splines?
   if( parser.OptionExists("no-copy") ) {
     LOG("gmkspl", pINFO) << "Not copying input splines to output";
@@ -308,6 +576,37 @@ void GetCommandLineArgs(int argc, char ** argv)
     exit(1);
   }
 
+  // work distribution
+  if( parser.OptionExists("n-tasks") ) {
+    LOG("gmkspl", pINFO) << "Reading number of spline calculation tasks";
+    gOptNTasks = parser.ArgAsInt("n-tasks");
+    if( parser.OptionExists("task-id") ) {
+      gOptTaskId = parser.ArgAsInt("task-id");
+    }
+  }
+  if(gOptNTasks < 1 || gOptTaskId < 0 || gOptTaskId >= gOptNTasks) {
+    LOG("gmkspl", pFATAL)
+       << "Invalid task id: " << gOptTaskId << " / " << gOptNTasks << " - Exiting";
+    PrintSyntax();
+    exit(1);
+  }
+  if( parser.OptionExists("nproc") ) {
+    LOG("gmkspl", pINFO) << "Reading number of processes";
+    gOptNProc = parser.ArgAsInt("nproc");
+    if(gOptNProc < 1) gOptNProc = 1;
+  }
+
+  // max xsec envelopes (stored in the cache file)
+  if( parser.OptionExists("max-xsec-envelopes") ) {
+    if(RunOpt::Instance()->CacheFile().size() == 0) {
+      LOG("gmkspl", pFATAL)
+         << "--max-xsec-envelopes requires a --cache-file - Exiting";
+      PrintSyntax();
+      exit(1);
+    }
+    gOptMaxXSecEnv = true;
+  }
+
   // random number seed
   if( parser.OptionExists("seed") ) {
     LOG("gmkspl", pINFO) << "Reading random number seed";
@@ -326,6 +625,17 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptInpXSecFile = "";
   }
 
+  // incremental update of the input cross-sections
+  if( parser.OptionExists("update") ) {
+    if(gOptInpXSecFile.size() == 0) {
+      LOG("gmkspl", pFATAL)
+         << "--update requires --input-cross-sections - Exiting";
+      PrintSyntax();
+      exit(1);
+    }
+    gOptUpdate = true;
+  }
+
   //
   // print the command-line options
   //
@@ -337,6 +647,10 @@ void GetCommandLineArgs(int argc, char ** argv)
      << "\n Input ROOT geometry : " << gOptGeomFilename
      << "\n Output cross-section file : " << gOptOutXSecFile
      << "\n Input cross-section file : " << gOptInpXSecFile
+     << "\n Update input cross-sections : " << ((gOptUpdate) ? "Yes" : "No")
+     << "\n Task : " << gOptTaskId << " / " << gOptNTasks
+     << "\n Number of processes : " << gOptNProc
+     << "\n Precompute max xsec envelopes : " << ((gOptMaxXSecEnv) ? "Yes" : "No")
      << "\n Random number seed : " << gOptRanSeed
      << "\n";
 
@@ -349,7 +663,9 @@ void PrintSyntax(void)
     << "\n\n" << "Syntax:" << "\n"
     << "   gmkspl -p nupdg <-t tgtpdg, -f geomfile> "
     << " <-o | --output-cross-section> xsec_xml_file_name"
-    << " [-n nknots] [-e max_energy] "
+    << " [-n nknots] [-e max_energy] [--adaptive-knots tolerance]"
+    << " [--task-id task_id --n-tasks number_of_tasks] [--nproc nproc]"
+    << " [--cache-file root_file [--max-xsec-envelopes]]"
     << " [--seed seed_number]"
     << " [--input-cross-section xml_file]"
     << " [--event-generator-list list_name]"
@@ -19,6 +19,7 @@
                   [-n nknots]
                   [-e max_energy]
                   [--no-copy]
+                  [--tabulate-sf]
                   [--seed random_number_seed]
                   [--input-cross-sections xml_file]
                   [--event-generator-list list_name]
@@ -33,6 +34,11 @@
          Options :
            -m
                A comma separated list of DM masses.
+               All the combinations of DM masses, mediator mass ratios and
+               Z' couplings are processed in a single job, reusing the
+               configured algorithms. If there are more than one, the
+               splines of each are saved in a separate file, named after
+               the output file & the point, eg xsec_splines.m0.5_r0.5.xml
            -t
                A comma separated list of tgt PDG codes.
                PDG code format: 10LZZZAAAI
@@ -40,6 +46,8 @@
                A ROOT file containing a ROOT/GEANT geometry description.
            -o, --output-cross-sections
                Name of output XML file containing computed cross-section data.
+               If the name ends in `.bin', the splines are written in the
+               memory-mappable binary format instead (see XSecSplineList).
                Default: `xsec_splines.xml'.
            -g
                A comma separated list of Z' coupling constants
@@ -58,6 +66,10 @@
                generating thread.
            --no-copy
                Does not write out the input cross-sections in the output file
+           --tabulate-sf
+               Interpolates the DIS structure functions from (x,Q2) tables
+               built once for all the DM mass points (see SF-Tabulate in
+               $GENIE/config/DMBYStrucFunc.xml)
            --seed
               Random number seed.
            --input-cross-sections
@@ -92,6 +104,7 @@
 
 #include <cassert>
 #include <cstdlib>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -102,6 +115,7 @@
 #include <TSystem.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
+#include "Framework/Algorithm/AlgFactory.h"
 #include "Framework/Conventions/GBuild.h"
 #include "Framework/EventGen/GEVGDriver.h"
 #include "Framework/Interaction/Interaction.h"
@@ -124,6 +138,7 @@
 
 using std::string;
 using std::vector;
+using std::ostringstream;
 
 using namespace genie;
 
@@ -135,6 +150,7 @@ using namespace genie::geometry;
 void          GetCommandLineArgs (int argc, char ** argv);
 void          PrintSyntax        (void);
 PDGCodeList * GetTargetCodes     (void);
+string        ScanPointFilename  (double mass, double ratio, double coup);
 
 // User-specified options:
 string   gOptTgtPdgCodeList = "";
@@ -145,6 +161,7 @@ vector<double>   gOptDMMasses;
 vector<double>   gOptMedRatios;
 vector<double>   gOptZpCouplings;
 bool     gOptNoCopy         = false;
+bool     gOptTabulateSF     = false;
 long int gOptRanSeed        = -1;   // random number seed
 string   gOptInpXSecFile    = "";   // input cross-section file
 string   gOptOutXSecFile    = "";   // output cross-section file
@@ -161,50 +178,75 @@ int main(int argc, char ** argv)
   }
   RunOpt::Instance()->BuildTune();
 
+  // throw on NaNs and Infs...
+#if defined(HAVE_FENV_H) && defined(HAVE_FEENABLEEXCEPT)
+  feenableexcept(FE_DIVBYZERO | FE_INVALID | FE_OVERFLOW);
+#endif
+
+  // Init
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+  utils::app_init::RandGen(gOptRanSeed);
+
+  // Get list of nuclear targets
+  PDGCodeList * targets = GetTargetCodes();
+  if(!targets || targets->size() == 0 ) {
+    LOG("gmkspl_dm", pFATAL) << "Empty target PDG code list";
+    PrintSyntax();
+    exit(3);
+  }
+  LOG("gmkspl_dm", pINFO) << "Targets: "   << *targets;
+
+  // Share the structure function tables by all the mass points?
+  // The DIS structure functions do not depend on the dark matter and
+  // mediator masses, so they are tabulated once (see QPMDMDISStrucFuncBase)
+  Registry * dmr = AlgConfigPool::Instance()->CommonList("Param", "BoostedDarkMatter");
+  if(gOptTabulateSF) {
+    dmr->UnLock();
+    dmr->Set("SF-Tabulate", true);
+    dmr->Lock();
+  }
+
+  // All mass points are processed in this job: The algorithms are configured
+  // once and are only reconfigured to pick up the new masses and couplings,
+  // while data that don't depend on them (eg the structure function tables)
+  // are kept. The splines of a mass point have the same keys as those of any
+  // other, so, in scans, each point is saved in its own output file.
+  unsigned int npoints =
+     gOptDMMasses.size() * gOptMedRatios.size() * gOptZpCouplings.size();
+  AlgFactory * algf = AlgFactory::Instance();
+  XSecSplineList * xspl = XSecSplineList::Instance();
+  bool save_init = !gOptNoCopy;
+  bool first = true;
+
   for (vector<double>::iterator mass = gOptDMMasses.begin(); mass != gOptDMMasses.end(); ++mass) {
     for (vector<double>::iterator ratio = gOptMedRatios.begin(); ratio != gOptMedRatios.end(); ++ratio) {
       for (vector<double>::iterator coup = gOptZpCouplings.begin(); coup != gOptZpCouplings.end(); ++coup) {
+
+        LOG("gmkspl_dm", pNOTICE)
+          << "Building splines for DM mass : " << *mass
+          << ", mediator mass ratio : " << *ratio;
+
         // Add dark matter to the table
         PDGLibrary::Instance()->ReloadDBase();
         PDGLibrary::Instance()->AddDarkMatter(*mass,*ratio);
         if (*coup > 0.) {
-            Registry * r = AlgConfigPool::Instance()->CommonList("Param", "BoostedDarkMatter");
-            r->UnLock();
-            r->Set("ZpCoupling", *coup);
-            r->Lock();
+            dmr->UnLock();
+            dmr->Set("ZpCoupling", *coup);
+            dmr->Lock();
         }
-
-
-        // throw on NaNs and Infs...
-#if defined(HAVE_FENV_H) && defined(HAVE_FEENABLEEXCEPT)
-        feenableexcept(FE_DIVBYZERO | FE_INVALID | FE_OVERFLOW);
-#endif
-
-        // Init
-        utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
-        utils::app_init::RandGen(gOptRanSeed);
-        utils::app_init::XSecTable(gOptInpXSecFile, false);
-
-        // Get list of neutrinos and nuclear targets
-
-        //  PDGCodeList * neutrinos = GetNeutrinoCodes();
-        PDGCodeList * targets   = GetTargetCodes();
-
-        if(!targets || targets->size() == 0 ) {
-          LOG("gmkspl_dm", pFATAL) << "Empty target PDG code list";
-          PrintSyntax();
-          exit(3);
+        if(!first) {
+          algf->ForceReconfiguration();
+          xspl->Clear();
         }
+        first = false;
 
-        LOG("gmkspl_dm", pINFO) << "Targets: "   << *targets;
+        utils::app_init::XSecTable(gOptInpXSecFile, false);
 
         // Loop over all possible input init states and ask the GEVGDriver
         // to build splines for all the interactions that its loaded list
         // of event generators can generate.
 
-        //  PDGCodeList::const_iterator nuiter;
         PDGCodeList::const_iterator tgtiter;
-        //  for(nuiter = neutrinos->begin(); nuiter != neutrinos->end(); ++nuiter) {
         for(tgtiter = targets->begin(); tgtiter != targets->end(); ++tgtiter) {
           int dmpdgc  = kPdgDarkMatter;
           int tgtpdgc = *tgtiter;
@@ -214,17 +256,16 @@ int main(int argc, char ** argv)
           driver.Configure(init_state);
           driver.CreateSplines(gOptNKnots, gOptMaxE);
         }
-        delete targets;
+
+        // Save the splines at the requested XML file
+        string filename = (npoints > 1) ?
+             ScanPointFilename(*mass, *ratio, *coup) : gOptOutXSecFile;
+        xspl->Save(filename, save_init);
+        LOG("gmkspl_dm", pNOTICE) << "Saved splines in: " << filename;
       }
     }
   }
-  //  }
-
-  // Save the splines at the requested XML file
-  XSecSplineList * xspl = XSecSplineList::Instance();
-  bool save_init = !gOptNoCopy;
-  xspl->SaveAsXml(gOptOutXSecFile, save_init);
-
+  delete targets;
 
   return 0;
 }
@@ -353,6 +394,11 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptNoCopy = true;
   }
 
+  // interpolate the DIS structure functions from tables?
+  if( parser.OptionExists("tabulate-sf") ) {
+    LOG("gmkspl_dm", pINFO) << "Tabulating the DIS structure functions";
+    gOptTabulateSF = true;
+  }
 
   // comma-separated target PDG code list or input geometry file
   bool tgt_cmd = true;
@@ -446,12 +492,31 @@ void PrintSyntax(void)
     << " [-g zp_couplings] "
     << " [-z med_ratios] "
     << " [-n nknots] [-e max_energy] "
+    << " [--no-copy] [--tabulate-sf]"
     << " [--seed seed_number]"
     << " [--input-cross-section xml_file]"
     << " [--event-generator-list list_name]"
     << " [--message-thresholds xml_file]\n\n";
 }
 //____________________________________________________________________________
+string ScanPointFilename(double mass, double ratio, double coup)
+{
+// Output filename for a point of a mass / mediator ratio / coupling scan:
+// eg xsec_splines.xml -> xsec_splines.m0.5_r0.5.xml
+
+  ostringstream point;
+  point << ".m" << mass << "_r" << ratio;
+  if(coup > 0.) point << "_g" << coup;
+
+  string filename = gOptOutXSecFile;
+  size_t dot   = filename.rfind(".");
+  size_t slash = filename.rfind("/");
+  if(dot == string::npos || (slash != string::npos && dot < slash)) {
+    return filename + point.str();
+  }
+  return filename.substr(0, dot) + point.str() + filename.substr(dot);
+}
+//____________________________________________________________________________
 PDGCodeList * GetTargetCodes(void)
 {
   bool from_geom_file = ( gOptGeomFilename.size()   > 0 );
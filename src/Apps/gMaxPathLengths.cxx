@@ -21,6 +21,7 @@
            gmxpl -f geom_file [-L length_units] [-D density_units] 
                  [-t top_vol_name] [-o output_xml_file] [-n np] [-r nr]
                  [-seed random_number_seed]
+                 [--thread-pool-size n]
                  [--message-thresholds xml_file]
 
          Options :
@@ -40,6 +41,10 @@
                Name of output XML file [ default: maxpl.xml ]
            --seed 
                Random number seed.
+          --thread-pool-size
+              Number of threads swimming the scanning rays [ default: 1 ].
+              The rays are generated by a single thread from the random
+              number seed, so the results do not depend on the thread count.
           --message-thresholds
               Allows users to customize the message stream thresholds.
               The thresholds are specified using an XML file.
@@ -267,6 +272,7 @@ void PrintSyntax(void)
       << " [-t top_volume_name]"
       << " [-o output_xml_file]"
       << " [-seed random_number_seed]"
+      << " [--thread-pool-size n]"
       << " [--message-thresholds xml_file]\n";
 
 }
@@ -128,6 +128,7 @@
 #include <TSystem.h> 
 
 #include "Framework/Algorithm/AlgFactory.h"
+#include "Framework/EventGen/EVGThreadStats.h"
 #include "Framework/EventGen/EventRecord.h"
 #include "Framework/EventGen/EventGeneratorI.h"
 #include "Framework/EventGen/EventRecordVisitorI.h"
@@ -206,6 +207,10 @@ int main(int argc, char ** argv)
 
   // Event loop
   int ievent = 0;
+
+  // A single event record, recycled for every event
+  EventRecord * event = new EventRecord;
+
   while (1)
   {
      if(ievent == gOptNev) break;
@@ -213,10 +218,11 @@ int main(int argc, char ** argv)
      LOG("gevgen_nnbar_osc", pNOTICE)
           << " *** Generating event............ " << ievent;
 
-     EventRecord * event = new EventRecord;
+     event->RecycleRecord();
      int target = SelectInitState();
      int decay = SelectAnnihilationMode(target);
      Interaction * interaction = Interaction::NOsc(target,decay);
+     delete event->Summary();
      event->AttachSummary(interaction);
 
      // Simulate decay     
@@ -228,14 +234,20 @@ int main(int argc, char ** argv)
      // Add event at the output ntuple, refresh the mc job monitor & clean-up
      ntpw.AddEventRecord(ievent, event);
      mcjmonitor.Update(ievent,event);
-     delete event;
 
      ievent++;
   } // event loop
 
+  delete event;
+
   // Save the generated event tree & close the output file
   ntpw.Save();
 
+  // Save per-module event generation statistics, if requested
+  if ( ! RunOpt::Instance()->EVGStatsFile().empty() ) {
+    EVGThreadStats::Instance()->Save(RunOpt::Instance()->EVGStatsFile());
+  }
+
   LOG("gevgen_nnbar_osc", pNOTICE) << "Done!";
 
   return 0;
@@ -8,6 +8,7 @@
 
          Syntax:
            gntpc -i input_file [-o output_file] -f format [-n nev] [-v vrs] [-c] 
+                 [--first-entry entry] [--jobs njobs]
                  [--seed random_number_seed]
                  [--message-thresholds xml_file]
                  [--event-record-print-level level]
@@ -25,6 +26,17 @@
               (optional, default: use latest version of each format)
            -c 
               Copy MC job metadata (gconfig and genv TFolders) from the input GHEP file.
+           --first-entry
+              First event tree entry to convert (optional, default: 0).
+              Together with -n it selects an entry range of the input file, so
+              that the conversion of a large file can be split up.
+           --jobs
+              Number of parallel conversion jobs (optional, default: 1).
+              The entries to convert are split in as many ranges, each converted
+              by a child process to a part file. The part files are then merged
+              into the output file and removed. Only for the ROOT tree output
+              formats (gst, rootracker, rootracker_mock_data, t2k_rootracker,
+              numi_rootracker, ginuke).
            -f 
               A string that specifies the output file format. 
               >>
@@ -125,6 +137,10 @@
 #include <vector>
 #include <algorithm>
 
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
 #include "libxml/parser.h"
 #include "libxml/xmlmemory.h"
 
@@ -135,6 +151,7 @@
 #include <TBits.h>
 #include <TObjString.h>
 #include <TMath.h>
+#include <TFileMerger.h>
 #include "Framework/ParticleData/BaryonResonance.h"
 #include "Framework/ParticleData/BaryonResUtils.h"
 #include "Framework/Conventions/GBuild.h"
@@ -181,6 +198,9 @@ using namespace genie;
 using namespace genie::constants;
 
 //func prototypes
+void   Convert                   (void);
+void   ConvertInParallel         (void);
+Long64_t LastEntry               (Long64_t nentries);
 void   ConvertToGST              (void);
 void   ConvertToGXML             (void);
 void   ConvertToGHepMock         (void);
@@ -216,6 +236,8 @@ string     gOptOutFileName;         ///< output file name
 GNtpcFmt_t gOptOutFileFormat;       ///< output file format id
 int        gOptVersion;             ///< output file format version
 Long64_t   gOptN;                   ///< number of events to process
+Long64_t   gOptFirst = 0;           ///< first entry to process
+int        gOptNJobs = 1;           ///< number of parallel conversion jobs
 bool       gOptCopyJobMeta = false; ///< copy MC job metadata (gconfig, genv TFolders)
 long int   gOptRanSeed;             ///< random number seed
 
@@ -237,7 +259,17 @@ int main(int argc, char ** argv)
   GHepRecord::SetPrintLevel(RunOpt::Instance()->EventRecordPrintLevel());
 
   PDGLibrary::Instance()->AddDarkMatter( 1.0, 0.5 ) ;
-  
+
+  if(gOptNJobs > 1) {
+    ConvertInParallel();
+  } else {
+    Convert();
+  }
+  return 0;
+}
+//____________________________________________________________________________________
+void Convert(void)
+{
   // Call the appropriate conversion function
   switch(gOptOutFileFormat) {
 
@@ -287,7 +319,108 @@ int main(int argc, char ** argv)
      gAbortingInErr = true;
      exit(3);
   }
-  return 0;
+}
+//____________________________________________________________________________________
+void ConvertInParallel(void)
+{
+  // Split the entries to convert in gOptNJobs ranges, convert each range to a
+  // part file in a child process and merge the part files in the output file
+  //
+  bool is_tree_fmt =
+       gOptOutFileFormat == kConvFmt_gst                  ||
+       gOptOutFileFormat == kConvFmt_rootracker           ||
+       gOptOutFileFormat == kConvFmt_rootracker_mock_data ||
+       gOptOutFileFormat == kConvFmt_t2k_rootracker       ||
+       gOptOutFileFormat == kConvFmt_numi_rootracker      ||
+       gOptOutFileFormat == kConvFmt_ginuke;
+  if(!is_tree_fmt) {
+    LOG("gntpc", pFATAL)
+       << "Parallel conversion (--jobs) is supported for ROOT tree formats only";
+    gAbortingInErr = true;
+    exit(5);
+  }
+
+  Long64_t last = 0;
+  {
+    TFile fin(gOptInpFileName.c_str(),"READ");
+    TTree * tree = dynamic_cast <TTree *> ( fin.Get("gtree") );
+    if (!tree) {
+      LOG("gntpc", pFATAL) << "Null input GHEP event tree";
+      gAbortingInErr = true;
+      exit(5);
+    }
+    last = LastEntry(tree->GetEntries());
+    fin.Close();
+  }
+  Long64_t first = gOptFirst;
+  Long64_t nev   = TMath::Max((Long64_t)0, last-first);
+
+  LOG("gntpc", pNOTICE)
+     << "*** Converting " << nev << " events in " << gOptNJobs << " parallel jobs";
+
+  string         outfilename = gOptOutFileName;
+  vector<string> parts;
+  vector<pid_t>  pids;
+  for(int ijob = 0; ijob < gOptNJobs; ijob++) {
+    ostringstream part;
+    part << outfilename << ".part" << ijob << ".root";
+    parts.push_back(part.str());
+
+    pid_t pid = fork();
+    if(pid < 0) {
+      LOG("gntpc", pFATAL) << "Couldn't start conversion job " << ijob;
+      gAbortingInErr = true;
+      exit(5);
+    }
+    if(pid == 0) {
+      // child: convert its own entry range (only the 1st copies the metadata)
+      gOptFirst       = first + (nev *  ijob   ) / gOptNJobs;
+      gOptN           = first + (nev * (ijob+1)) / gOptNJobs - gOptFirst;
+      gOptOutFileName = part.str();
+      gOptCopyJobMeta = gOptCopyJobMeta && (ijob == 0);
+      Convert();
+      exit(0);
+    }
+    pids.push_back(pid);
+  }
+
+  bool ok = true;
+  for(unsigned int ijob = 0; ijob < pids.size(); ijob++) {
+    int status = 0;
+    waitpid(pids[ijob], &status, 0);
+    if(!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+      LOG("gntpc", pERROR) << "Conversion job " << ijob << " failed";
+      ok = false;
+    }
+  }
+  if(!ok) {
+    LOG("gntpc", pFATAL) << "Not all conversion jobs succeeded";
+    gAbortingInErr = true;
+    exit(5);
+  }
+
+  LOG("gntpc", pNOTICE) << "*** Merging the part files into: " << outfilename;
+  TFileMerger merger(kFALSE);
+  merger.OutputFile(outfilename.c_str(), "RECREATE");
+  for(unsigned int ijob = 0; ijob < parts.size(); ijob++) {
+    merger.AddFile(parts[ijob].c_str());
+  }
+  if(!merger.Merge()) {
+    LOG("gntpc", pFATAL) << "Couldn't merge the part files";
+    gAbortingInErr = true;
+    exit(5);
+  }
+  for(unsigned int ijob = 0; ijob < parts.size(); ijob++) {
+    gSystem->Unlink(parts[ijob].c_str());
+  }
+}
+//____________________________________________________________________________________
+Long64_t LastEntry(Long64_t nentries)
+{
+  // One past the last entry to convert, given the input number of entries
+  //
+  if(gOptN < 0) return nentries;
+  return TMath::Min(nentries, gOptFirst + gOptN);
 }
 //____________________________________________________________________________________
 // GENIE GHEP EVENT TREE FORMAT -> GENIE SUMMARY NTUPLE 
@@ -524,19 +657,18 @@ void ConvertToGST(void)
   }
   
   // Figure out how many events to analyze
-  Long64_t nmax = (gOptN<0) ? 
-       er_tree->GetEntries() : TMath::Min( er_tree->GetEntries(), gOptN );
+  Long64_t nmax = LastEntry(er_tree->GetEntries());
   if (nmax<0) {
     LOG("gntpc", pERROR) << "Number of events = 0";
     return;
   }
 
-  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
+  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax-gOptFirst << " events";
 
   TLorentzVector pdummy(0,0,0,0);
 
   // Event loop
-  for(Long64_t iev = 0; iev < nmax; iev++) {
+  for(Long64_t iev = gOptFirst; iev < nmax; iev++) {
     er_tree->GetEntry(iev);
 
     NtpMCRecHeader rec_header = mcrec->hdr;
@@ -1109,16 +1241,15 @@ void ConvertToGXML(void)
   output << "<genie_event_list version=\"1.00\">" << endl;
 
   //-- figure out how many events to analyze
-  Long64_t nmax = (gOptN<0) ? 
-       tree->GetEntries() : TMath::Min(tree->GetEntries(), gOptN);
+  Long64_t nmax = LastEntry(tree->GetEntries());
   if (nmax<0) {
     LOG("gntpc", pERROR) << "Number of events = 0";
     return;
   }
-  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
+  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax-gOptFirst << " events";
 
   //-- event loop
-  for(Long64_t iev = 0; iev < nmax; iev++) {
+  for(Long64_t iev = gOptFirst; iev < nmax; iev++) {
     tree->GetEntry(iev);
     NtpMCRecHeader rec_header = mcrec->hdr;
     EventRecord &  event      = *(mcrec->event);
@@ -1245,13 +1376,12 @@ void ConvertToGHepMock(void)
   tree->SetBranchAddress("gmcrec", &mcrec);
         
   //-- figure out how many events to analyze
-  Long64_t nmax = (gOptN<0) ?
-       tree->GetEntries() : TMath::Min(tree->GetEntries(), gOptN);
+  Long64_t nmax = LastEntry(tree->GetEntries());
   if (nmax<0) {
     LOG("gntpc", pERROR) << "Number of events = 0";
     return;
   }
-  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
+  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax-gOptFirst << " events";
 
   //-- initialize an Ntuple Writer
   NtpWriter ntpw(kNFGHEP, thdr->runnu);
@@ -1259,7 +1389,7 @@ void ConvertToGHepMock(void)
   ntpw.Initialize();
 
   //-- event loop
-  for(Long64_t iev = 0; iev < nmax; iev++) {
+  for(Long64_t iev = gOptFirst; iev < nmax; iev++) {
     tree->GetEntry(iev);
     NtpMCRecHeader rec_header = mcrec->hdr;
     EventRecord &  event      = *(mcrec->event);
@@ -1335,16 +1465,15 @@ void ConvertToGTracker(void)
   ofstream output(gOptOutFileName.c_str(), ios::out);
 
   //-- figure out how many events to analyze
-  Long64_t nmax = (gOptN<0) ? 
-       tree->GetEntries() : TMath::Min(tree->GetEntries(), gOptN);
+  Long64_t nmax = LastEntry(tree->GetEntries());
   if (nmax<0) {
     LOG("gntpc", pERROR) << "Number of events = 0";
     return;
   }
-  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
+  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax-gOptFirst << " events";
 
   //-- event loop
-  for(Long64_t iev = 0; iev < nmax; iev++) {
+  for(Long64_t iev = gOptFirst; iev < nmax; iev++) {
     tree->GetEntry(iev);
     NtpMCRecHeader rec_header = mcrec->hdr;
     EventRecord &  event      = *(mcrec->event);
@@ -2143,16 +2272,15 @@ void ConvertToGRooTracker(void)
 #endif
 
   //-- figure out how many events to analyze
-  Long64_t nmax = (gOptN<0) ? 
-      gtree->GetEntries() : TMath::Min(gtree->GetEntries(), gOptN);
+  Long64_t nmax = LastEntry(gtree->GetEntries());
   if (nmax<0) {
     LOG("gntpc", pERROR) << "Number of events = 0";
     return;
   }
-  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
+  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax-gOptFirst << " events";
 
   //-- event loop
-  for(Long64_t iev = 0; iev < nmax; iev++) {
+  for(Long64_t iev = gOptFirst; iev < nmax; iev++) {
     gtree->GetEntry(iev);
 
     NtpMCRecHeader rec_header = mcrec->hdr;
@@ -2550,16 +2678,15 @@ void ConvertToGHad(void)
 #endif
 
   //-- figure out how many events to analyze
-  Long64_t nmax = (gOptN<0) ? 
-      tree->GetEntries() : TMath::Min(tree->GetEntries(), gOptN);
+  Long64_t nmax = LastEntry(tree->GetEntries());
   if (nmax<0) {
     LOG("gntpc", pERROR) << "Number of events = 0";
     return;
   }
-  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
+  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax-gOptFirst << " events";
 
   //-- event loop
-  for(Long64_t iev = 0; iev < nmax; iev++) {
+  for(Long64_t iev = gOptFirst; iev < nmax; iev++) {
     tree->GetEntry(iev);
     NtpMCRecHeader rec_header = mcrec->hdr;
     EventRecord &  event      = *(mcrec->event);
@@ -2842,15 +2969,14 @@ TTree * tEvtTree = new TTree("ginuke","GENIE INuke Summary Tree");
   }
 
   //-- figure out how many events to analyze
-  Long64_t nmax = (gOptN<0) ?
-       er_tree->GetEntries() : TMath::Min( er_tree->GetEntries(), gOptN );
+  Long64_t nmax = LastEntry(er_tree->GetEntries());
   if (nmax<0) {
     LOG("gntpc", pERROR) << "Number of events = 0";
     return;
   }
-  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
+  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax-gOptFirst << " events";
 
-  for(Long64_t iev = 0; iev < nmax; iev++) {
+  for(Long64_t iev = gOptFirst; iev < nmax; iev++) {
     brIEv = iev; 
     er_tree->GetEntry(iev);
     NtpMCRecHeader rec_header = mcrec->hdr;
@@ -3061,6 +3187,22 @@ void GetCommandLineArgs(int argc, char ** argv)
   // check whether to copy MC job metadata (only if output file is in ROOT format)
   gOptCopyJobMeta = parser.OptionExists('c');
 
+  // first entry to convert
+  if( parser.OptionExists("first-entry") ) {
+    LOG("gntpc", pINFO) << "Reading first entry to convert";
+    gOptFirst = TMath::Max(0L, parser.ArgAsLong("first-entry"));
+  } else {
+    gOptFirst = 0;
+  }
+
+  // number of parallel conversion jobs
+  if( parser.OptionExists("jobs") ) {
+    LOG("gntpc", pINFO) << "Reading number of parallel conversion jobs";
+    gOptNJobs = TMath::Max(1, parser.ArgAsInt("jobs"));
+  } else {
+    gOptNJobs = 1;
+  }
+
   // random number seed
   if( parser.OptionExists("seed") ) {
     LOG("gntpc", pINFO) << "Reading random number seed";
@@ -3075,6 +3217,8 @@ void GetCommandLineArgs(int argc, char ** argv)
   LOG("gntpc", pNOTICE) << "Conversion to format = " << gOptRanSeed 
                         << ", vrs = " << gOptVersion;
   LOG("gntpc", pNOTICE) << "Number of events to be converted = " << gOptN;
+  LOG("gntpc", pNOTICE) << "First entry to be converted = " << gOptFirst;
+  LOG("gntpc", pNOTICE) << "Number of parallel conversion jobs = " << gOptNJobs;
   LOG("gntpc", pNOTICE) << "Copy metadata? = " << ((gOptCopyJobMeta) ? "Yes" : "No");
   LOG("gntpc", pNOTICE) << "Random number seed = " << gOptRanSeed;
 
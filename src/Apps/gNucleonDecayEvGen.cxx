@@ -121,6 +121,7 @@
 #include <TSystem.h> 
 
 #include "Framework/Algorithm/AlgFactory.h"
+#include "Framework/EventGen/EVGThreadStats.h"
 #include "Framework/EventGen/EventRecord.h"
 #include "Framework/EventGen/EventGeneratorI.h"
 #include "Framework/EventGen/EventRecordVisitorI.h"
@@ -206,6 +207,9 @@ int main(int argc, char ** argv)
     dpdg = utils::nucleon_decay::DecayedNucleonPdgCode(gOptDecayMode);
   }  
 
+  // A single event record, recycled for every event
+  EventRecord * event = new EventRecord;
+
   while (1)
   {
      if(ievent == gOptNev) break;
@@ -213,10 +217,11 @@ int main(int argc, char ** argv)
      LOG("gevgen_ndcy", pNOTICE)
           << " *** Generating event............ " << ievent;
 
-     EventRecord * event = new EventRecord;
+     event->RecycleRecord();
      int target = SelectInitState();
      int decay  = (int)gOptDecayMode;
      Interaction * interaction = Interaction::NDecay(target,decay,dpdg);
+     delete event->Summary();
      event->AttachSummary(interaction);
 
      // Simulate decay     
@@ -228,14 +233,20 @@ int main(int argc, char ** argv)
      // Add event at the output ntuple, refresh the mc job monitor & clean-up
      ntpw.AddEventRecord(ievent, event);
      mcjmonitor.Update(ievent,event);
-     delete event;
 
      ievent++;
   } // event loop
 
+  delete event;
+
   // Save the generated event tree & close the output file
   ntpw.Save();
 
+  // Save per-module event generation statistics, if requested
+  if ( ! RunOpt::Instance()->EVGStatsFile().empty() ) {
+    EVGThreadStats::Instance()->Save(RunOpt::Instance()->EVGStatsFile());
+  }
+
   LOG("gevgen_ndcy", pNOTICE) << "Done!";
 
   return 0;
@@ -256,24 +267,27 @@ int SelectInitState(void)
      dpdg = utils::nucleon_decay::DecayedNucleonPdgCode(gOptDecayMode);
   }
 
-  map<int,double> cprob; // cumulative probability 
+  // cumulative probabilities, computed at the first call
+  static map<int,double> cprob;
+  static double sum_prob = 0;
   map<int,double>::const_iterator iter;
- 
-  double sum_prob = 0;
-  for(iter = gOptTgtMix.begin(); iter != gOptTgtMix.end(); ++iter) {
-     int pdg_code = iter->first;
-     int A = pdg::IonPdgCodeToA(pdg_code);
-     int Z = pdg::IonPdgCodeToZ(pdg_code);
 
-     double nucleon_decay_fraction = 0.;
-     if (dpdg == kPdgProton ) { nucleon_decay_fraction = (double)Z / (double)A; }
-     else if (dpdg == kPdgNeutron ) { nucleon_decay_fraction = (double)(A-Z) / (double)A; }
+  if(cprob.empty()) {
+    for(iter = gOptTgtMix.begin(); iter != gOptTgtMix.end(); ++iter) {
+       int pdg_code = iter->first;
+       int A = pdg::IonPdgCodeToA(pdg_code);
+       int Z = pdg::IonPdgCodeToZ(pdg_code);
+
+       double nucleon_decay_fraction = 0.;
+       if (dpdg == kPdgProton ) { nucleon_decay_fraction = (double)Z / (double)A; }
+       else if (dpdg == kPdgNeutron ) { nucleon_decay_fraction = (double)(A-Z) / (double)A; }
 
-     double wgt  = iter->second;
-     double prob = wgt*nucleon_decay_fraction;
+       double wgt  = iter->second;
+       double prob = wgt*nucleon_decay_fraction;
 
-     sum_prob += prob;
-     cprob.insert(map<int, double>::value_type(pdg_code, sum_prob));
+       sum_prob += prob;
+       cprob.insert(map<int, double>::value_type(pdg_code, sum_prob));
+    }
   }
 
   assert(sum_prob > 0.);
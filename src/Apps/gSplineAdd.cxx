@@ -7,6 +7,8 @@
 
          Syntax :
            gspladd -f file_list -d directory_list -o output.xml
+                   [--strict]
+                   [--thread-pool-size n]
                    [--message-thresholds xml_file]
 
          Options :
@@ -18,13 +20,31 @@
               files. If more than one then separate using commas.
            -o 
               output xml file
+              If the file name ends in `.bin', splines are written in the
+              memory-mappable binary format (see XSecSplineList).
+              Input files can be in either format.
+           --strict
+              Exit with an error if a spline appears in more than one input
+              file with different knots (the default is to keep the first
+              copy and report the conflict).
+           --thread-pool-size
+              Number of threads parsing input files concurrently
+              (default: $GTHREADPOOLSIZE or 1). The output doesn't depend on it.
            --message-thresholds
               Allows users to customize the message stream thresholds.
               The thresholds are specified using an XML file.
               See $GENIE/config/Messenger.xml for the XML schema.
 
          Notes :
-           There must be at least 2 files for the merges to work
+           There must be at least 2 files for the merges to work.
+           The input files are merged in name order, so that the output does
+           not depend on the order they are given in. If a spline appears in
+           more than one file, the first copy is kept. This allows merging
+           the partial outputs of gmkspl jobs run with --task-id / --n-tasks.
+           The merge is streamed: The input files are parsed a few at a time
+           (concurrently) and their splines are written out as they come, in
+           file order, so only the spline keys of the processed files are
+           held in memory.
 
          Examples :
 
@@ -50,13 +70,16 @@
 */
 //____________________________________________________________________________
 
-#include <cassert>
+#include <algorithm>
+#include <map>
 #include <sstream>
 #include <string>
 #include <vector>
 
 #include <TSystem.h>
 
+#include "libxml/parser.h"
+
 #include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Framework/Conventions/XmlParserStatus.h"
 #include "Framework/Messenger/Messenger.h"
@@ -66,14 +89,32 @@
 #include "Framework/Utils/StringUtils.h"
 #include "Framework/Utils/SystemUtils.h"
 #include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/ThreadPool.h"
 
 using std::string;
 using std::vector;
+using std::map;
 using std::ostringstream;
 
 using namespace genie;
 
+// the splines of a parsed input file
+struct SplineData {
+  string         tune;
+  string         key;
+  vector<double> E;
+  vector<double> xsec;
+  string         config;  ///< configuration hash (see XSecSplineList::ConfigHash())
+};
+struct SplineFile {
+  XmlParserStatus_t  status;
+  int                uselog;
+  vector<SplineData> splines;
+};
+
 vector<string> GetAllInputFiles   (void);
+void           ParseFile          (const string & filename, SplineFile & file);
+uint64_t       KnotChecksum       (const SplineData & spline);
 void           GetCommandLineArgs (int argc, char ** argv);
 void           PrintSyntax        (void);
 
@@ -82,6 +123,7 @@ string         gOutFile;   ///< output XML file
 vector<string> gInpFiles;  ///< list of input XML files
 vector<string> gInpDirs;   ///< list of input dirs (to look for XML files)
 vector<string> gAllFiles;  ///< list of all input files
+bool           gStrict;    ///< exit on conflicting duplicate splines?
 
 //____________________________________________________________________________
 int main(int argc, char ** argv)
@@ -89,26 +131,133 @@ int main(int argc, char ** argv)
   GetCommandLineArgs(argc,argv);
 
   utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
-  
-  XSecSplineList * xspl = XSecSplineList::Instance();
 
-  vector<string>::const_iterator file_iter = gAllFiles.begin();
-  for( ; file_iter != gAllFiles.end(); ++file_iter) {
-    string filename = *file_iter;
-    LOG("gspladd", pNOTICE) << " ---- >> Loading file : " << filename;
-    XmlParserStatus_t ist = xspl->LoadFromXml(filename, true);
-    assert(ist==kXmlOK);
+  // initialize the XML parser before parsing files in several threads
+  xmlInitParser();
+
+  // parse a few files per thread at a time, and write out their splines
+  // in file order
+  ThreadPool * pool = ThreadPool::Instance();
+  const int nfiles  = gAllFiles.size();
+  const int nchunk  = 2 * pool->NThreads();
+
+  XSecSplineFileWriter writer;
+  int uselog = -1;
+
+  map<string, uint64_t> written;  // tune/key -> knot checksum
+  int nduplicates = 0, nconflicts = 0;
+
+  for(int first = 0; first < nfiles; first += nchunk) {
+
+    int n = std::min(nchunk, nfiles - first);
+    vector<SplineFile> files(n);
+    pool->ParallelFor(n, [&] (int i, unsigned int /*worker*/) {
+       ParseFile(gAllFiles[first+i], files[i]);
+    });
+
+    for(int i = 0; i < n; i++) {
+      const string & filename = gAllFiles[first+i];
+      LOG("gspladd", pNOTICE) << " ---- >> Merging file : " << filename;
+      SplineFile & file = files[i];
+      if(file.status != kXmlOK) {
+        LOG("gspladd", pFATAL)
+           << "Couldn't read " << filename << ": "
+           << XmlParserStatus::AsString(file.status);
+        gAbortingInErr = true;
+        exit(1);
+      }
+      if(uselog < 0) {
+        uselog = file.uselog;
+        if(!writer.Open(gOutFile, uselog == 1)) {
+          LOG("gspladd", pFATAL) << "Couldn't open the output file: " << gOutFile;
+          gAbortingInErr = true;
+          exit(1);
+        }
+      }
+      else if(file.uselog != uselog) {
+        LOG("gspladd", pFATAL)
+           << "The splines of " << filename << " are built as a function of "
+           << (file.uselog == 1 ? "log(E)" : "E") << ", unlike those of the previous files";
+        gAbortingInErr = true;
+        exit(1);
+      }
+
+      for(unsigned int is = 0; is < file.splines.size(); is++) {
+        const SplineData & spline = file.splines[is];
+        if(spline.E.empty()) continue;
+        uint64_t checksum = KnotChecksum(spline);
+        string   tune_key = spline.tune + "/" + spline.key;
+        map<string, uint64_t>::const_iterator it = written.find(tune_key);
+        if(it != written.end()) {
+          // keep the first copy
+          nduplicates++;
+          if(it->second != checksum) {
+            nconflicts++;
+            LOG("gspladd", (gStrict ? pFATAL : pWARN))
+               << "Spline " << spline.key << " (tune: " << spline.tune
+               << ") of " << filename << " differs from a previous copy";
+            if(gStrict) {
+              gAbortingInErr = true;
+              exit(1);
+            }
+          }
+          continue;
+        }
+        written.insert(map<string, uint64_t>::value_type(tune_key, checksum));
+        writer.Write(spline.tune, spline.key,
+                     spline.E.size(), &spline.E[0], &spline.xsec[0], spline.config);
+      }
+    }// files in chunk
+  }// chunks
+
+  if(!writer.Close()) {
+    LOG("gspladd", pFATAL) << "Couldn't write the output file: " << gOutFile;
+    gAbortingInErr = true;
+    exit(1);
   }
 
-  LOG("gspladd",pDEBUG) << *xspl ;
-
-  LOG("gspladd", pNOTICE) 
-     << " ****** Saving all loaded splines into : " << gOutFile;
-  xspl->SaveAsXml(gOutFile);
+  LOG("gspladd", pNOTICE)
+     << " ****** Saved " << writer.NSplines() << " splines into : " << gOutFile
+     << " (skipped " << nduplicates << " duplicates, of which "
+     << nconflicts << " with different knots)";
 
   return 0;
 }
 //____________________________________________________________________________
+void ParseFile(const string & filename, SplineFile & file)
+{
+  file.uselog = -1;
+  file.status = XSecSplineList::ReadFile(filename,
+    [&file] (const string & tune, const string & key,
+             int nknots, const double * E, const double * xsec,
+             const string & config) {
+       SplineData spline;
+       spline.tune   = tune;
+       spline.key    = key;
+       spline.config = config;
+       spline.E.assign   (E,    E    + nknots);
+       spline.xsec.assign(xsec, xsec + nknots);
+       file.splines.push_back(spline);
+    }, &file.uselog);
+}
+//____________________________________________________________________________
+uint64_t KnotChecksum(const SplineData & spline)
+{
+// FNV-1a hash of the knots, to tell apart different copies of a spline
+
+  uint64_t h = 14695981039346656037ULL;
+  const vector<double> * arrays[2] = { &spline.E, &spline.xsec };
+  for(int a = 0; a < 2; a++) {
+    const unsigned char * bytes = (const unsigned char *) arrays[a]->data();
+    size_t nbytes = arrays[a]->size() * sizeof(double);
+    for(size_t i = 0; i < nbytes; i++) {
+      h ^= bytes[i];
+      h *= 1099511628211ULL;
+    }
+  }
+  return h;
+}
+//____________________________________________________________________________
 vector<string> GetAllInputFiles(void)
 {
   vector<string> files;
@@ -127,8 +276,10 @@ vector<string> GetAllInputFiles(void)
   dir_iter = gInpDirs.begin();
   for( ; dir_iter != gInpDirs.end(); ++dir_iter) {
     string path = *dir_iter;
-    // get all XML files in this dir
+    // get all XML and binary spline files in this dir
     vector<string> path_files = utils::system::GetAllFilesInPath(path,"xml");
+    vector<string> bin_files  = utils::system::GetAllFilesInPath(path,"bin");
+    path_files.insert(path_files.end(), bin_files.begin(), bin_files.end());
     // add these files too
     file_iter = path_files.begin();
     for( ; file_iter != path_files.end(); ++file_iter) {
@@ -137,6 +288,12 @@ vector<string> GetAllInputFiles(void)
     }//file_iter
   }//dir_iter
 
+  // merge in a fixed order, independent of the order the files were given
+  // or listed in: if a spline appears in more than one file, the copy from
+  // the first file (in name order) is kept
+  std::sort(files.begin(), files.end());
+  files.erase(std::unique(files.begin(), files.end()), files.end());
+
   return files;
 }
 //____________________________________________________________________________
@@ -184,6 +341,8 @@ void GetCommandLineArgs(int argc, char ** argv)
     exit(1);
   }
 
+  gStrict = parser.OptionExists("strict");
+
   gAllFiles = GetAllInputFiles();
   if(gAllFiles.size() <= 1) {
     LOG("gspladd", pFATAL) << "There must be at least 2 input files";
@@ -197,6 +356,7 @@ void PrintSyntax(void)
   LOG("gspladd", pNOTICE)
     << "\n\n" << "Syntax:" << "\n"
     << "   gspladd  -f file_list -d directory_list  -o output.xml\n"
+    << "            [--strict] [--thread-pool-size n]\n"
     << "            [--message-thresholds xml_file]\n";
 
 }
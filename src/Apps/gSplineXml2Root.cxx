@@ -8,7 +8,7 @@
 
          Syntax :
            gspl2root -f xml_file -p nu -t tgt [-e emax]
-                     [-o root_file] [-w] [-k]
+                     [-o root_file] [-w] [-k] [--batch]
                      [--message-thresholds xml_file]
                      [--event-generator-list list_name]
 
@@ -18,9 +18,9 @@
            -f
               the input XML file containing the cross section spline data
            -p
-              the neutrino pdg code
+              the neutrino pdg code (comma separated list)
            -t
-              the target pdg code (format: 10LZZZAAAI)
+              the target pdg code (format: 10LZZZAAAI) (comma separated list)
            -e
               the maximum energy (in generated plots -- use it to zoom at low E)
            -o
@@ -29,6 +29,14 @@
               write out plots in a postscipt file
            -k
               keep spline knot points  (not yet implemented).
+           --batch
+              Export the splines of every (probe, target) found in the input
+              file (or of those listed with -p / -t) in one go: The processes
+              are taken from the spline keys of the current tune, without
+              building event generation drivers, and each spline is evaluated
+              once for all the graphs (and totals) it enters. All splines in
+              the file are exported, whatever the event generator list.
+              The -w option is not available in this mode.
            --message-thresholds
               Allows users to customize the message stream thresholds.
            --event-generator-list
@@ -78,6 +86,9 @@
 //____________________________________________________________________________
 
 #include <cassert>
+#include <cstdio>
+#include <map>
+#include <set>
 #include <string>
 #include <sstream>
 #include <vector>
@@ -115,16 +126,25 @@
 
 using std::string;
 using std::vector;
+using std::map;
+using std::set;
+using std::pair;
 using std::ostringstream;
 
 using namespace genie;
 using namespace genie::utils;
 
+// the cross section spline of each interaction of an initial state
+typedef map<const Interaction *, const Spline *> SplineMap_t;
+
 //Prototypes:
 void       LoadSplines          (void);
 GEVGDriver GetEventGenDriver    (void);
-void       SaveToPsFile         (void);
-void       SaveGraphsToRootFile (void);
+SplineMap_t DriverSplines       (const GEVGDriver & evg_driver);
+void       ExportAllFromSplineKeys (void);
+Interaction * InteractionFromString (const string & intkey);
+void       SaveToPsFile         (GEVGDriver & evg_driver);
+void       SaveGraphsToRootFile (const InteractionList * ilist, const SplineMap_t & splines);
 void       SaveNtupleToRootFile (void);
 void       GetCommandLineArgs   (int argc, char ** argv);
 void       PrintSyntax          (void);
@@ -139,6 +159,7 @@ PDGCodeList gOptTgtPdgList;    // list of target PDG codes
 int    gOptProbePdgCode; // probe PDG code (currently being processed)
 int    gOptTgtPdgCode;   // target PDG code
 bool   gWriteOutPlots;   // write out a postscript file with plots
+bool   gOptBatch;        // export all initial states from the spline keys
 //bool   gKeepSplineKnots; // use spline abscissa points rather than equi-spaced
 
 //Globals & constants
@@ -169,14 +190,22 @@ int main(int argc, char ** argv)
     LOG("gspl2root", pWARN) << "No splines loaded for tune " << RunOpt::Instance() -> Tune() -> Name() ;
   }
 
+  if(gOptBatch) {
+    // export all (requested) initial states found in the spline keys
+    ExportAllFromSplineKeys();
+    return 0;
+  }
+
   for (unsigned int indx_p = 0; indx_p < gOptProbePdgList.size(); ++indx_p ) {
     for (unsigned int indx_t = 0; indx_t < gOptTgtPdgList.size(); ++indx_t ) {
       gOptProbePdgCode = gOptProbePdgList[indx_p];
       gOptTgtPdgCode   = gOptTgtPdgList[indx_t];
+      // get the event generation driver
+      GEVGDriver evg_driver = GetEventGenDriver();
       // save the cross section plots in a postscript file
-      SaveToPsFile();
+      SaveToPsFile(evg_driver);
       // save the cross section graphs at a root file
-      SaveGraphsToRootFile();
+      SaveGraphsToRootFile(evg_driver.Interactions(), DriverSplines(evg_driver));
     }
   }
 
@@ -188,7 +217,7 @@ void LoadSplines(void)
 // load the cross section splines specified at the cmd line
 
   XSecSplineList * splist = XSecSplineList::Instance();
-  XmlParserStatus_t ist = splist->LoadFromXml(gOptXMLFilename);
+  XmlParserStatus_t ist = splist->Load(gOptXMLFilename);
   assert(ist == kXmlOK);
 }
 //____________________________________________________________________________
@@ -209,12 +238,180 @@ GEVGDriver GetEventGenDriver(void)
   return evg_driver;
 }
 //____________________________________________________________________________
-void SaveToPsFile(void)
+SplineMap_t DriverSplines(const GEVGDriver & evg_driver)
 {
-  if(!gWriteOutPlots) return;
+// the cross section splines of the interactions simulated by the driver
+
+  SplineMap_t splines;
+  const InteractionList * ilist = evg_driver.Interactions();
+  InteractionList::const_iterator ilistiter = ilist->begin();
+  for( ; ilistiter != ilist->end(); ++ilistiter) {
+    splines[*ilistiter] = evg_driver.XSecSpline(*ilistiter);
+  }
+  return splines;
+}
+//____________________________________________________________________________
+void ExportAllFromSplineKeys(void)
+{
+// Groups the splines of the current tune by initial state, taking the
+// interactions from the spline keys (<alg>/<config>/<interaction>), and
+// exports each initial state
+
+  XSecSplineList * xspl = XSecSplineList::Instance();
+  const vector<string> * keys = xspl->GetSplineKeys();
+  if(!keys) return;
+
+  map< pair<int,int>, InteractionList * > ilists;  // (probe, target) -> interactions
+  map< pair<int,int>, SplineMap_t >       splines; // (probe, target) -> splines
+  set<string>                             intkeys;
+
+  vector<string>::const_iterator key_iter = keys->begin();
+  for( ; key_iter != keys->end(); ++key_iter) {
+    const string & key = *key_iter;
+    size_t pos = key.find('/');
+    if(pos != string::npos) pos = key.find('/', pos+1);
+    if(pos == string::npos) {
+      LOG("gspl2root", pWARN) << "Skipping spline with unexpected key: " << key;
+      continue;
+    }
+    string intkey = key.substr(pos+1);
+
+    Interaction * interaction = InteractionFromString(intkey);
+    if(!interaction) {
+      LOG("gspl2root", pWARN) << "Can't interpret spline key: " << key;
+      continue;
+    }
+    int probe  = interaction->InitState().ProbePdg();
+    int target = interaction->InitState().Tgt().Pdg();
+    bool requested =
+      (gOptProbePdgList.empty() || gOptProbePdgList.ExistsInPDGCodeList(probe )) &&
+      (gOptTgtPdgList.empty()   || gOptTgtPdgList.ExistsInPDGCodeList  (target));
+    if(!requested) {
+      delete interaction;
+      continue;
+    }
+    if(!intkeys.insert(intkey).second) {
+      LOG("gspl2root", pWARN)
+         << "More than one spline for " << intkey << ": Keeping the first one";
+      delete interaction;
+      continue;
+    }
 
-  //-- get the event generation driver
-  GEVGDriver evg_driver = GetEventGenDriver();
+    pair<int,int> init_state(probe, target);
+    if(ilists.count(init_state) == 0) ilists[init_state] = new InteractionList;
+    ilists[init_state]->push_back(interaction);
+    splines[init_state][interaction] = xspl->GetSpline(key);
+  }
+  delete keys;
+
+  LOG("gspl2root", pNOTICE)
+     << "Exporting the splines of " << ilists.size() << " initial states";
+
+  map< pair<int,int>, InteractionList * >::iterator it = ilists.begin();
+  for( ; it != ilists.end(); ++it) {
+    gOptProbePdgCode = it->first.first;
+    gOptTgtPdgCode   = it->first.second;
+    LOG("gspl2root", pNOTICE)
+       << "Exporting " << it->second->size() << " splines for probe = "
+       << gOptProbePdgCode << ", target = " << gOptTgtPdgCode;
+    SaveGraphsToRootFile(it->second, splines[it->first]);
+    delete it->second;
+  }
+}
+//____________________________________________________________________________
+Interaction * InteractionFromString(const string & intkey)
+{
+// Builds the interaction with the input string code (see Interaction::AsString()),
+// or returns 0 if it can't be interpreted. The string code of the result is
+// checked against the input one.
+
+  int probe = 0, tgt = 0, hitnuc = 0, hitqrk = 0;
+  bool sea = false, hitqrk_set = false;
+  ScatteringType_t  sc = kScNull;
+  InteractionType_t it = kIntNull;
+  int charm = -1, strange = -1, res = -1, decay = -1;
+  int np = 0, nn = 0, npip = 0, npim = 0, npi0 = 0, ngamma = 0;
+  int nrhop = 0, nrhom = 0, nrho0 = 0;
+
+  // the decay mode tag is appended with no separator
+  string s = intkey;
+  size_t dpos = s.find("dec:");
+  if(dpos != string::npos) {
+    decay = atoi(s.substr(dpos+4).c_str());
+    s = s.substr(0, dpos);
+  }
+
+  vector<string> fields = str::Split(s, ";");
+  vector<string>::const_iterator fiter = fields.begin();
+  for( ; fiter != fields.end(); ++fiter) {
+    const string & field = *fiter;
+    if(field.empty()) continue;
+    size_t colon = field.find(':');
+    if(colon == string::npos) return 0;   // eg DM probes
+    string name  = field.substr(0, colon);
+    string value = field.substr(colon+1);
+
+    if      (name == "nu" ) probe  = atoi(value.c_str());
+    else if (name == "tgt") tgt    = atoi(value.c_str());
+    else if (name == "N"  ) hitnuc = atoi(value.c_str());
+    else if (name == "q"  ) {
+      hitqrk     = atoi(value.c_str());
+      sea        = (value.find("(s)") != string::npos);
+      hitqrk_set = true;
+    }
+    else if (name == "proc") {
+      size_t comma = value.rfind(',');
+      if(comma == string::npos) return 0;
+      string sit = value.substr(0, comma);
+      string ssc = value.substr(comma+1);
+      for(int i = kIntEM; i <= kIntNOsc; i++) {
+        if(InteractionType::AsString((InteractionType_t)i) == sit) it = (InteractionType_t)i;
+      }
+      for(int i = kScQuasiElastic; i <= kScDarkMatterElectron; i++) {
+        if(ScatteringType::AsString((ScatteringType_t)i) == ssc) sc = (ScatteringType_t)i;
+      }
+    }
+    else if (name == "charm"  ) charm   = (value == "incl") ? 0 : atoi(value.c_str());
+    else if (name == "strange") strange = (value == "incl") ? 0 : atoi(value.c_str());
+    else if (name == "res"    ) res     = atoi(value.c_str());
+    else if (name == "hmult"  ) {
+      sscanf(value.c_str(),
+        "(p=%d,n=%d,pi+=%d,pi-=%d,pi0=%d,gamma=%d,rho+=%d,rho-=%d,rho0=%d)",
+        &np, &nn, &npip, &npim, &npi0, &ngamma, &nrhop, &nrhom, &nrho0);
+    }
+    else return 0;
+  }
+  if(!probe || !tgt || sc == kScNull || it == kIntNull) return 0;
+
+  InitialState init_state(tgt, probe);
+  if(hitnuc)     init_state.TgtPtr()->SetHitNucPdg(hitnuc);
+  if(hitqrk_set) {
+    init_state.TgtPtr()->SetHitQrkPdg(hitqrk);
+    init_state.TgtPtr()->SetHitSeaQrk(sea);
+  }
+  ProcessInfo proc_info(sc, it);
+  Interaction * interaction = new Interaction(init_state, proc_info);
+
+  XclsTag * xcls = interaction->ExclTagPtr();
+  if(charm   >= 0) xcls->SetCharm(charm);
+  if(strange >= 0) xcls->SetStrange(strange);
+  xcls->SetNNucleons(np, nn);
+  xcls->SetNPions(npip, npi0, npim);
+  xcls->SetNSingleGammas(ngamma);
+  xcls->SetNRhos(nrhop, nrho0, nrhom);
+  if(res   >= 0) xcls->SetResonance((Resonance_t)res);
+  if(decay >= 0) xcls->SetDecayMode(decay);
+
+  if(interaction->AsString() != intkey) {
+    delete interaction;
+    return 0;
+  }
+  return interaction;
+}
+//____________________________________________________________________________
+void SaveToPsFile(GEVGDriver & evg_driver)
+{
+  if(!gWriteOutPlots) return;
 
   //-- define some marker styles / colors
   const unsigned int kNMarkers = 5;
@@ -515,14 +712,9 @@ void FormatXSecGraph(TGraph * g)
   g->GetYaxis()->SetTitle("#sigma_{nuclear} (10^{-38} cm^{2})");
 }
 //____________________________________________________________________________
-void SaveGraphsToRootFile(void)
+void SaveGraphsToRootFile(
+    const InteractionList * ilist, const SplineMap_t & splines)
 {
-  //-- get the event generation driver
-  GEVGDriver evg_driver = GetEventGenDriver();
-
-  //-- get the list of interactions that can be simulated by the driver
-  const InteractionList * ilist = evg_driver.Interactions();
-
   //-- check whether the splines will be saved in a ROOT file - if not, exit now
   bool save_in_root = gOptROOTFilename.size()>0;
   if(!save_in_root) return;
@@ -573,7 +765,25 @@ void SaveGraphsToRootFile(void)
 
   double * xs = new double[kNSplineP];
 
+  //-- evaluate each spline once, for all the graphs it enters
+  map<const Interaction *, vector<double> > xsgrid;
   InteractionList::const_iterator ilistiter = ilist->begin();
+  for(; ilistiter != ilist->end(); ++ilistiter) {
+    const Interaction * interaction = *ilistiter;
+    SplineMap_t::const_iterator spl_iter = splines.find(interaction);
+    if(spl_iter == splines.end() || !spl_iter->second) {
+      LOG("gspl2root", pFATAL)
+         << "Can't get spline for: " << interaction->AsString();
+      exit(2);
+    }
+    vector<double> & xsi = xsgrid[interaction];
+    xsi.resize(kNSplineP);
+    for(int i=0; i<kNSplineP; i++) {
+      xsi[i] = spl_iter->second->Evaluate(e[i]) * (1E+38/units::cm2);
+    }
+  }
+
+  ilistiter = ilist->begin();
 
   for(; ilistiter != ilist->end(); ++ilistiter) {
 
@@ -663,9 +873,10 @@ void SaveGraphsToRootFile(void)
         if(!xcls.IsInclusiveCharm()) { title << xcls.CharmHadronPdg(); }
     }
 
-    const Spline * spl = evg_driver.XSecSpline(interaction);
+    const Spline * spl = splines.find(interaction)->second;
+    const vector<double> & xsi = xsgrid[interaction];
     for(int i=0; i<kNSplineP; i++) {
-      xs[i] = spl->Evaluate(e[i]) * (1E+38/units::cm2);
+      xs[i] = xsi[i];
     }
 
     TGraph * gr = new TGraph(kNSplineP, e, xs);
@@ -706,26 +917,26 @@ void SaveGraphsToRootFile(void)
        const InitialState & init = interaction->InitState();
        const Target &       tgt  = init.Tgt();
 
-       const Spline * spl = evg_driver.XSecSpline(interaction);
+       const vector<double> & xsi = xsgrid[interaction];
 
        if (proc.IsResonant() && proc.IsWeakCC() && pdg::IsProton(tgt.HitNucPdg())) {
          for(int i=0; i<kNSplineP; i++) {
-             xsresccp[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+             xsresccp[i] += xsi[i];
          }
        }
        if (proc.IsResonant() && proc.IsWeakCC() && pdg::IsNeutron(tgt.HitNucPdg())) {
          for(int i=0; i<kNSplineP; i++) {
-             xsresccn[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+             xsresccn[i] += xsi[i];
          }
        }
        if (proc.IsResonant() && proc.IsWeakNC() && pdg::IsProton(tgt.HitNucPdg())) {
          for(int i=0; i<kNSplineP; i++) {
-             xsresncp[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+             xsresncp[i] += xsi[i];
          }
        }
        if (proc.IsResonant() && proc.IsWeakNC() && pdg::IsNeutron(tgt.HitNucPdg())) {
          for(int i=0; i<kNSplineP; i++) {
-             xsresncn[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+             xsresncn[i] += xsi[i];
          }
        }
     }
@@ -768,28 +979,28 @@ void SaveGraphsToRootFile(void)
        const InitialState & init = interaction->InitState();
        const Target &       tgt  = init.Tgt();
 
-       const Spline * spl = evg_driver.XSecSpline(interaction);
+       const vector<double> & xsi = xsgrid[interaction];
 
        if(xcls.IsCharmEvent()) continue;
 
        if (proc.IsDeepInelastic() && proc.IsWeakCC() && pdg::IsProton(tgt.HitNucPdg())) {
          for(int i=0; i<kNSplineP; i++) {
-             xsdisccp[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+             xsdisccp[i] += xsi[i];
          }
        }
        if (proc.IsDeepInelastic() && proc.IsWeakCC() && pdg::IsNeutron(tgt.HitNucPdg())) {
          for(int i=0; i<kNSplineP; i++) {
-             xsdisccn[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+             xsdisccn[i] += xsi[i];
          }
        }
        if (proc.IsDeepInelastic() && proc.IsWeakNC() && pdg::IsProton(tgt.HitNucPdg())) {
          for(int i=0; i<kNSplineP; i++) {
-             xsdisncp[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+             xsdisncp[i] += xsi[i];
          }
        }
        if (proc.IsDeepInelastic() && proc.IsWeakNC() && pdg::IsNeutron(tgt.HitNucPdg())) {
          for(int i=0; i<kNSplineP; i++) {
-             xsdisncn[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+             xsdisncn[i] += xsi[i];
          }
        }
     }
@@ -827,28 +1038,28 @@ void SaveGraphsToRootFile(void)
       const InitialState & init = interaction->InitState();
       const Target &       tgt  = init.Tgt();
 
-      const Spline * spl = evg_driver.XSecSpline(interaction);
+      const vector<double> & xsi = xsgrid[interaction];
 
       if(!xcls.IsCharmEvent()) continue;
 
       if (proc.IsDeepInelastic() && proc.IsWeakCC() && pdg::IsProton(tgt.HitNucPdg())) {
         for(int i=0; i<kNSplineP; i++) {
-            xsdisccp[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+            xsdisccp[i] += xsi[i];
         }
       }
       if (proc.IsDeepInelastic() && proc.IsWeakCC() && pdg::IsNeutron(tgt.HitNucPdg())) {
         for(int i=0; i<kNSplineP; i++) {
-            xsdisccn[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+            xsdisccn[i] += xsi[i];
         }
       }
       if (proc.IsDeepInelastic() && proc.IsWeakNC() && pdg::IsProton(tgt.HitNucPdg())) {
         for(int i=0; i<kNSplineP; i++) {
-            xsdisncp[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+            xsdisncp[i] += xsi[i];
         }
       }
       if (proc.IsDeepInelastic() && proc.IsWeakNC() && pdg::IsNeutron(tgt.HitNucPdg())) {
         for(int i=0; i<kNSplineP; i++) {
-            xsdisncn[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+            xsdisncn[i] += xsi[i];
         }
       }
     }
@@ -884,16 +1095,16 @@ void SaveGraphsToRootFile(void)
        const Interaction * interaction = *ilistiter;
        const ProcessInfo &  proc = interaction->ProcInfo();
 
-       const Spline * spl = evg_driver.XSecSpline(interaction);
+       const vector<double> & xsi = xsgrid[interaction];
 
        if (proc.IsMEC() && proc.IsWeakCC()) {
          for(int i=0; i<kNSplineP; i++) {
-             xsmeccc[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+             xsmeccc[i] += xsi[i];
          }
        }
        if (proc.IsMEC() && proc.IsWeakNC()) {
          for(int i=0; i<kNSplineP; i++) {
-             xsmecnc[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+             xsmecnc[i] += xsi[i];
          }
        }
     }
@@ -925,21 +1136,21 @@ void SaveGraphsToRootFile(void)
       const Interaction * interaction = *ilistiter;
       const ProcessInfo &  proc = interaction->ProcInfo();
       
-      const Spline * spl = evg_driver.XSecSpline(interaction);
+      const vector<double> & xsi = xsgrid[interaction];
       
       if (proc.IsCoherentProduction() && proc.IsWeakCC()) {
 	for(int i=0; i<kNSplineP; i++) {
-	  xscohcc[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+	  xscohcc[i] += xsi[i];
 	}
       }
       if (proc.IsCoherentProduction() && proc.IsWeakNC()) {
 	for(int i=0; i<kNSplineP; i++) {
-	  xscohnc[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+	  xscohnc[i] += xsi[i];
 	}
       }
       if ( proc.IsCoherentProduction() ) {
 	for(int i=0; i<kNSplineP; i++) {
-	  xscohtot[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+	  xscohtot[i] += xsi[i];
 	}
       }
 
@@ -983,7 +1194,7 @@ void SaveGraphsToRootFile(void)
       const InitialState & init = interaction->InitState();
       const Target &       tgt  = init.Tgt();
 
-      const Spline * spl = evg_driver.XSecSpline(interaction);
+      const vector<double> & xsi = xsgrid[interaction];
 
       bool iscc = proc.IsWeakCC();
       bool isnc = proc.IsWeakNC();
@@ -992,33 +1203,33 @@ void SaveGraphsToRootFile(void)
 
       if (iscc && offp) {
         for(int i=0; i<kNSplineP; i++) {
-            xstotccp[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+            xstotccp[i] += xsi[i];
         }
       }
       if (iscc && offn) {
         for(int i=0; i<kNSplineP; i++) {
-            xstotccn[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+            xstotccn[i] += xsi[i];
         }
       }
       if (isnc && offp) {
         for(int i=0; i<kNSplineP; i++) {
-            xstotncp[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+            xstotncp[i] += xsi[i];
         }
       }
       if (isnc && offn) {
         for(int i=0; i<kNSplineP; i++) {
-            xstotncn[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+            xstotncn[i] += xsi[i];
         }
       }
 
       if (iscc) {
         for(int i=0; i<kNSplineP; i++) {
-            xstotcc[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+            xstotcc[i] += xsi[i];
         }
       }
       if (isnc) {
         for(int i=0; i<kNSplineP; i++) {
-            xstotnc[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+            xstotnc[i] += xsi[i];
         }
       }
     }
@@ -1096,16 +1307,16 @@ void SaveGraphsToRootFile(void)
        const InitialState & init = interaction->InitState();
        const Target &       tgt  = init.Tgt();
 
-       const Spline * spl = evg_driver.XSecSpline(interaction);
+       const vector<double> & xsi = xsgrid[interaction];
 
        if (proc.IsResonant() && proc.IsEM() && pdg::IsProton(tgt.HitNucPdg())) {
          for(int i=0; i<kNSplineP; i++) {
-             xsresemp[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+             xsresemp[i] += xsi[i];
          }
        }
        if (proc.IsResonant() && proc.IsEM() && pdg::IsNeutron(tgt.HitNucPdg())) {
          for(int i=0; i<kNSplineP; i++) {
-             xsresemn[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+             xsresemn[i] += xsi[i];
          }
        }
     }
@@ -1136,18 +1347,18 @@ void SaveGraphsToRootFile(void)
        const InitialState & init = interaction->InitState();
        const Target &       tgt  = init.Tgt();
 
-       const Spline * spl = evg_driver.XSecSpline(interaction);
+       const vector<double> & xsi = xsgrid[interaction];
 
        if(xcls.IsCharmEvent()) continue;
 
        if (proc.IsDeepInelastic() && proc.IsEM() && pdg::IsProton(tgt.HitNucPdg())) {
          for(int i=0; i<kNSplineP; i++) {
-             xsdisemp[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+             xsdisemp[i] += xsi[i];
          }
        }
        if (proc.IsDeepInelastic() && proc.IsEM() && pdg::IsNeutron(tgt.HitNucPdg())) {
          for(int i=0; i<kNSplineP; i++) {
-             xsdisemn[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+             xsdisemn[i] += xsi[i];
          }
        }
     }
@@ -1175,18 +1386,18 @@ void SaveGraphsToRootFile(void)
       const InitialState & init = interaction->InitState();
       const Target &       tgt  = init.Tgt();
 
-      const Spline * spl = evg_driver.XSecSpline(interaction);
+      const vector<double> & xsi = xsgrid[interaction];
 
       if(!xcls.IsCharmEvent()) continue;
 
       if (proc.IsDeepInelastic() && proc.IsEM() && pdg::IsProton(tgt.HitNucPdg())) {
         for(int i=0; i<kNSplineP; i++) {
-            xsdisemp[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+            xsdisemp[i] += xsi[i];
         }
       }
       if (proc.IsDeepInelastic() && proc.IsEM() && pdg::IsNeutron(tgt.HitNucPdg())) {
         for(int i=0; i<kNSplineP; i++) {
-            xsdisemn[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+            xsdisemn[i] += xsi[i];
         }
       }
     }
@@ -1216,7 +1427,7 @@ void SaveGraphsToRootFile(void)
       const InitialState & init = interaction->InitState();
       const Target &       tgt  = init.Tgt();
 
-      const Spline * spl = evg_driver.XSecSpline(interaction);
+      const vector<double> & xsi = xsgrid[interaction];
 
       bool isem = proc.IsEM();
       bool offp = pdg::IsProton (tgt.HitNucPdg());
@@ -1224,17 +1435,17 @@ void SaveGraphsToRootFile(void)
 
       if (isem && offp) {
         for(int i=0; i<kNSplineP; i++) {
-            xstotemp[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+            xstotemp[i] += xsi[i];
         }
       }
       if (isem && offn) {
         for(int i=0; i<kNSplineP; i++) {
-            xstotemn[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+            xstotemn[i] += xsi[i];
         }
       }
       if (isem) {
         for(int i=0; i<kNSplineP; i++) {
-            xstotem[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+            xstotem[i] += xsi[i];
         }
       }
     }
@@ -1322,6 +1533,9 @@ void GetCommandLineArgs(int argc, char ** argv)
 
   CmdLnArgParser parser(argc,argv);
 
+  // export all initial states found in the spline keys?
+  gOptBatch = parser.OptionExists("batch");
+
   // input XML file name:
   if( parser.OptionExists('f') ) {
     LOG("gspl2root", pINFO) << "Reading input XML filename";
@@ -1336,6 +1550,8 @@ void GetCommandLineArgs(int argc, char ** argv)
   if( parser.OptionExists('p') ) {
     LOG("gspl2root", pINFO) << "Reading probe PDG code";
     gOptProbePdgList = GetPDGCodeListFromString(parser.ArgAsString('p'));
+  } else if(gOptBatch) {
+    LOG("gspl2root", pINFO) << "Unspecified probe PDG code - Exporting all probes";
   } else {
     LOG("gspl2root", pFATAL)
        << "Unspecified probe PDG code - Exiting";
@@ -1347,6 +1563,8 @@ void GetCommandLineArgs(int argc, char ** argv)
   if( parser.OptionExists('t') ) {
     LOG("gspl2root", pINFO) << "Reading target PDG code";
     gOptTgtPdgList = GetPDGCodeListFromString(parser.ArgAsString('t'));
+  } else if(gOptBatch) {
+    LOG("gspl2root", pINFO) << "Unspecified target PDG code - Exporting all targets";
   } else {
     LOG("gspl2root", pFATAL)
       << "Unspecified target PDG code - Exiting";
@@ -1376,6 +1594,10 @@ void GetCommandLineArgs(int argc, char ** argv)
 
   // write-out a PS file with plots
   gWriteOutPlots = parser.OptionExists('w');
+  if(gWriteOutPlots && gOptBatch) {
+    LOG("gspl2root", pWARN) << "No postscript plots are written in batch mode";
+    gWriteOutPlots = false;
+  }
 
   // use same abscissa points as splines
   //not yet//gKeepSplineKnots = parser.OptionExists('k');
@@ -1399,7 +1621,7 @@ void PrintSyntax(void)
   LOG("gspl2root", pNOTICE)
       << "\n\n" << "Syntax:" << "\n"
       << "   gspl2root -f xml_file -p probe_pdg -t target_pdg"
-      << "            [-e emax] [-o output_root_file] [-w]\n"
+      << "            [-e emax] [-o output_root_file] [-w] [--batch]\n"
       << "            [--message-thresholds xml_file]\n";
 }
 //____________________________________________________________________________
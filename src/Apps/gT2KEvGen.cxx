@@ -24,6 +24,7 @@
                       [-t top_volume_name_at_geom || -t +Vol1-Vol2...]
                       [-P pre_gen_prob_file_name]
                       [-S] [output_name]
+                      [--flux-prob-part ijob,njobs]
                       [-m max_path_lengths_xml_file]
                       [-L length_units_at_geom]
                       [-D density_units_at_geom]
@@ -120,6 +121,13 @@
               Introducing multiple functionality to the executable is not
               desirable but is less error prone than duplicating a lot of the
               functionality in a separate application.
+              The path lengths of the flux neutrinos are computed over the
+              threads of the GENIE thread pool (see --thread-pool-size).
+           --flux-prob-part
+              Only used with -S: pre-generates the interaction probabilities
+              of part ijob (0 <= ijob < njobs) of the flux entries, so that the
+              -S step can be split over njobs jobs. Each job must write its own
+              output file; merge them with hadd and pass the merged file to -P.
            -m
               An XML file (generated by gmxpl) with the max (density weighted)
               path-lengths for each target material in the input ROOT geometry.
@@ -429,6 +437,7 @@
 #include <TObject.h>
 
 #include "Framework/Conventions/Units.h"
+#include "Framework/EventGen/EVGThreadStats.h"
 #include "Framework/EventGen/EventRecord.h"
 #include "Framework/EventGen/GFluxI.h"
 #include "Framework/EventGen/GMCJDriver.h"
@@ -504,6 +513,8 @@ bool            gOptUseFluxProbs = false;      // use pre-calculated flux intera
 bool            gOptSaveFluxProbsFile = false; // special mode: no events generated, calculate and save flux interaction probs to root file
 string          gOptFluxProbFileName;          // filename for file containg flux probs
 string          gOptSaveFluxProbsFileName;     // output filename for pre-generated flux probabilities
+int             gOptFluxProbIJob = 0;          // part of the flux entries whose interaction probs are pre-generated (with -S)
+int             gOptFluxProbNJobs = 1;         // number of parts the pre-generation of flux interaction probs is split into
 bool            gOptRandomFluxOffset = false;  // start looping over flux file from random start entry
 long int        gOptRanSeed;                   // random number seed
 string          gOptInpXSecFile;               // cross-section splines
@@ -526,7 +537,7 @@ int main(int argc, char ** argv)
   utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
   utils::app_init::CacheFile(RunOpt::Instance()->CacheFile());
   utils::app_init::RandGen(gOptRanSeed);
-  utils::app_init::XSecTable(gOptInpXSecFile, true);
+  utils::app_init::XSecTable(gOptInpXSecFile, true, true);
 
   // Set GHEP print level
   GHepRecord::SetPrintLevel(RunOpt::Instance()->EventRecordPrintLevel());
@@ -680,6 +691,10 @@ int main(int argc, char ** argv)
       if(gOptSaveFluxProbsFileName.size()>0) name = gOptSaveFluxProbsFileName;
       // Tell the driver save pre-generated probabilities to an output file
       mcj_driver->SaveFluxProbabilities(name);
+      if(gOptFluxProbNJobs > 1) {
+        mcj_driver->SetFluxProbabilitiesPartition(
+            gOptFluxProbIJob, gOptFluxProbNJobs);
+      }
     }
 
     // Either load pre-generated flux probabilities
@@ -917,6 +932,11 @@ int main(int argc, char ** argv)
   // Save the generated event tree & close the output file
   ntpw.Save();
 
+  // Save per-module event generation statistics, if requested
+  if ( ! RunOpt::Instance()->EVGStatsFile().empty() ) {
+    EVGThreadStats::Instance()->Save(RunOpt::Instance()->EVGStatsFile());
+  }
+
   // Clean-up
   delete geom_driver;
   delete flux_driver;
@@ -1235,6 +1255,23 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptSaveFluxProbsFileName = parser.ArgAsString('S');
   }
 
+  // splitting the pre-generation of interaction probs over several jobs
+  if( parser.OptionExists("flux-prob-part") ){
+    vector<string> part =
+       utils::str::Split(parser.ArgAsString("flux-prob-part"), ",");
+    if(part.size() == 2) {
+      gOptFluxProbIJob  = atoi(part[0].c_str());
+      gOptFluxProbNJobs = atoi(part[1].c_str());
+    }
+    if(part.size() != 2 || !gOptSaveFluxProbsFile || gOptFluxProbNJobs < 1 ||
+       gOptFluxProbIJob < 0 || gOptFluxProbIJob >= gOptFluxProbNJobs) {
+      LOG("gevgen_t2k", pFATAL)
+       << "The --flux-prob-part option expects ijob,njobs (0 <= ijob < njobs)"
+       << " and is only used with the -S option!";
+      exit(1);
+    }
+  }
+
   // cannot save and run at the same time
   if(gOptUseFluxProbs && gOptSaveFluxProbsFile){
     LOG("gevgen_t2k", pFATAL)
@@ -1472,6 +1509,7 @@ void PrintSyntax(void)
    << "\n           [-t top_volume_name_at_geom]"
    << "\n           [-P pre_gen_prob_file]"
    << "\n           [-S] [output_name]"
+   << "\n           [--flux-prob-part ijob,njobs]"
    << "\n           [-m max_path_lengths_xml_file]"
    << "\n           [-L length_units_at_geom]"
    << "\n           [-D density_units_at_geom]"
@@ -11,7 +11,14 @@
 #include <iomanip>
 #include <iostream>
 #include <sstream>
+#include <fstream>
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <mutex>
+
+#include <stdint.h>
+#include <sys/stat.h>
 
 #include "libxml/xmlmemory.h"
 #include "libxml/parser.h"
@@ -25,9 +32,12 @@
 #include "Framework/Algorithm/AlgConfigPool.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Registry/RegistryItemTypeDef.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/TuneId.h"
 #include "Framework/Utils/XmlParserUtils.h"
 
 #include "Framework/Utils/StringUtils.h"
+#include "Framework/Utils/StartupProfiler.h"
 
 using std::setw;
 using std::setfill;
@@ -46,11 +56,29 @@ namespace genie {
 }
 //____________________________________________________________________________
 AlgConfigPool * AlgConfigPool::fInstance = 0;
+map<string, AlgConfigPool *> AlgConfigPool::fTunePools;
+//____________________________________________________________________________
+namespace {
+  // guards the late initialization of the pools
+  std::mutex gPoolInitMutex;
+}
 //____________________________________________________________________________
 AlgConfigPool::AlgConfigPool()
 {
-  if( ! this->LoadAlgConfig() )
-  LOG("AlgConfigPool", pERROR) << "Could not load XML config file";
+  StartupTimer timer("AlgConfigPool: algorithm configuration loading");
+
+  TuneId * tune = RunOpt::Instance()->Tune();
+  fTuneName  = (tune) ? tune->Name() : "";
+  fTuneIndex = fTunePools.size();
+  fTunePools[fTuneName] = this;
+
+  string snapshot = RunOpt::Instance()->ConfigSnapshot();
+  bool restored = (snapshot.size() > 0) && this->LoadSnapshot(snapshot);
+
+  if( ! restored ) {
+    if( ! this->LoadAlgConfig() )
+    LOG("AlgConfigPool", pERROR) << "Could not load XML config file";
+  }
   fInstance =  0;
 }
 //____________________________________________________________________________
@@ -77,19 +105,64 @@ AlgConfigPool::~AlgConfigPool()
   fRegistryPool.clear();
   fConfigFiles.clear();
   fConfigKeyList.clear();
+  fXmlFiles.clear();
   fInstance = 0;
 }
 //____________________________________________________________________________
 AlgConfigPool * AlgConfigPool::Instance()
 {
+// The config pool is shared (read-only) by all event generation threads.
+// Guard its late initialization in case it is first requested by a worker.
+
   if(fInstance == 0) {
-    static AlgConfigPool::Cleaner cleaner;
-    cleaner.DummyMethodAndSilentCompiler();
-    fInstance = new AlgConfigPool;
+    std::lock_guard<std::mutex> lock(gPoolInitMutex);
+    if(fInstance == 0) {
+      fInstance = BuildPool();
+    }
   }
   return fInstance;
 }
 //____________________________________________________________________________
+void AlgConfigPool::ActivateTune(string tune)
+{
+// Makes the pool of the input tune the active one. The pools of previously
+// activated tunes are kept, so switching back to them is immediate.
+
+  std::lock_guard<std::mutex> lock(gPoolInitMutex);
+
+  map<string, AlgConfigPool *>::iterator it = fTunePools.find(tune);
+  if(it != fTunePools.end()) {
+    fInstance = it->second;
+    return;
+  }
+
+  TuneId * current = RunOpt::Instance()->Tune();
+  if( !current || current->Name() != tune ) {
+    LOG("AlgConfigPool", pFATAL)
+      << "Can't build the configuration pool of tune " << tune
+      << ", which is not the current RunOpt tune (use RunOpt::SwitchTune())";
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  LOG("AlgConfigPool", pNOTICE)
+     << "Building the configuration pool of tune " << tune;
+  fInstance = BuildPool();
+}
+//____________________________________________________________________________
+unsigned int AlgConfigPool::ActiveTuneIndex(void)
+{
+  return (fInstance) ? fInstance->fTuneIndex : 0;
+}
+//____________________________________________________________________________
+AlgConfigPool * AlgConfigPool::BuildPool(void)
+{
+  static AlgConfigPool::Cleaner cleaner;
+  cleaner.DummyMethodAndSilentCompiler();
+
+  return new AlgConfigPool;
+}
+//____________________________________________________________________________
 bool AlgConfigPool::LoadAlgConfig(void)
 {
 // Loads all algorithm XML configurations and creates a map with all loaded
@@ -111,30 +184,64 @@ bool AlgConfigPool::LoadAlgConfig(void)
   }
 
   //-- loop over all XML config files and read all named configuration
-  //   sets for each algorithm
+  //   sets for each algorithm. In the demand-driven mode, just mark them
+  //   as pending: each one is read at the first request of the algorithm.
   map<string, string>::const_iterator conf_file_iter;
 
   for(conf_file_iter = fConfigFiles.begin();
                   conf_file_iter != fConfigFiles.end(); ++conf_file_iter) {
-
-    string alg_name    = conf_file_iter->first;
-    string file_name   = conf_file_iter->second;
-
-    SLOG("AlgConfigPool", pINFO)
-         << setfill('.') << setw(40) << alg_name << " -> " << file_name;
-
-    string full_path = utils::xml::GetXMLFilePath(file_name);
+    fPendingAlgs.insert(conf_file_iter->first);
+  }
+  if(RunOpt::Instance()->LazyConfig()) {
     SLOG("AlgConfigPool", pNOTICE)
-      << "*** GENIE XML config file " << full_path;
-    bool ok = this->LoadSingleAlgConfig(alg_name, full_path);
-    if(!ok) {
-      SLOG("AlgConfigPool", pERROR)
-           << "Error in loading config sets for algorithm = " << alg_name;
-    }
+      << "Algorithm XML config files will be read on demand";
+    return true;
   }
+
+  this->LoadAllPendingAlgConfigs();
   return true;
 };
 //____________________________________________________________________________
+bool AlgConfigPool::LoadPendingAlgConfig(string alg_name)
+{
+// Reads all named configuration sets of the input algorithm, unless its XML
+// config file was already read
+
+  StartupTimer timer("AlgConfigPool: on-demand configuration loading");
+
+  std::lock_guard<std::recursive_mutex> lock(fMutex);
+
+  if(fPendingAlgs.erase(alg_name) == 0) return false;
+
+  map<string, string>::const_iterator conf_file_iter =
+                                              fConfigFiles.find(alg_name);
+  if(conf_file_iter == fConfigFiles.end()) return false;
+
+  string file_name = conf_file_iter->second;
+
+  SLOG("AlgConfigPool", pINFO)
+       << setfill('.') << setw(40) << alg_name << " -> " << file_name;
+
+  string full_path = utils::xml::GetXMLFilePath(file_name);
+  SLOG("AlgConfigPool", pNOTICE)
+    << "*** GENIE XML config file " << full_path;
+  bool ok = this->LoadSingleAlgConfig(alg_name, full_path);
+  if(!ok) {
+    SLOG("AlgConfigPool", pERROR)
+         << "Error in loading config sets for algorithm = " << alg_name;
+  }
+  return ok;
+}
+//____________________________________________________________________________
+void AlgConfigPool::LoadAllPendingAlgConfigs(void)
+{
+  std::lock_guard<std::recursive_mutex> lock(fMutex);
+
+  while(!fPendingAlgs.empty()) {
+    this->LoadPendingAlgConfig(*fPendingAlgs.begin());
+  }
+}
+//____________________________________________________________________________
 bool AlgConfigPool::LoadMasterConfig(void)
 {
 // Loads the master config XML file: the file that specifies which XML config
@@ -191,6 +298,7 @@ bool AlgConfigPool::LoadMasterConfig(void)
   }
   xmlFreeNode(xml_ac);
   xmlFreeDoc(xml_doc);
+  fXmlFiles.push_back(fMasterConfig);
   return true;
 }
 //____________________________________________________________________________
@@ -366,6 +474,8 @@ bool AlgConfigPool::LoadRegistries(
   //xmlFree(xml_doc);
   xmlFreeDoc(xml_doc);
 
+  fXmlFiles.push_back(file_name);
+
   return true;
 }
 //____________________________________________________________________________
@@ -566,6 +676,15 @@ Registry * AlgConfigPool::FindRegistry(string key) const
 {
   LOG("AlgConfigPool", pDEBUG) << "Searching for registry with key " << key;
 
+  std::lock_guard<std::recursive_mutex> lock(fMutex);
+
+  // demand-driven mode: read the XML config file of the algorithm at its
+  // first request
+  if( fRegistryPool.count(key) == 0 && !fPendingAlgs.empty() ) {
+    string alg_name = key.substr(0, key.find('/'));
+    const_cast<AlgConfigPool*>( this ) -> LoadPendingAlgConfig(alg_name);
+  }
+
   if( fRegistryPool.count(key) == 1 ) {
      map<string, Registry *>::const_iterator config_entry =
                                                    fRegistryPool.find(key);
@@ -593,6 +712,8 @@ Registry * AlgConfigPool::CommonList( const string & file_id, const string & set
   ostringstream key;
   key << "Common" << file_id << "List/" << set_name;
 
+  std::lock_guard<std::recursive_mutex> lock(fMutex);
+
   if ( ! this->FindRegistry(key.str()) ) {
 	const_cast<AlgConfigPool*>( this ) -> LoadCommonLists( file_id ) ;
   }
@@ -611,13 +732,333 @@ Registry * AlgConfigPool::TuneGeneratorList( void ) const
 //____________________________________________________________________________
 const vector<string> & AlgConfigPool::ConfigKeyList(void) const
 {
+  // the full list is needed: read all pending XML config files
+  const_cast<AlgConfigPool*>( this ) -> LoadAllPendingAlgConfigs();
+
   return fConfigKeyList;
 }
 //____________________________________________________________________________
+bool AlgConfigPool::LoadAllCommonLists(void)
+{
+// Common parameter lists are normally loaded on demand. Before saving a
+// snapshot, load all the Common<id>.xml files found in the XML search path.
+
+  bool ok = true;
+
+  vector<string> paths =
+      utils::str::Split(utils::xml::GetXMLPathList(), ":;,");
+  vector<string>::const_iterator path_iter = paths.begin();
+  for( ; path_iter != paths.end(); ++path_iter) {
+    string dir = gSystem->ExpandPathName(path_iter->c_str());
+    void * dirp = gSystem->OpenDirectory(dir.c_str());
+    if(!dirp) continue;
+
+    const char * entry = 0;
+    while( (entry = gSystem->GetDirEntry(dirp)) ) {
+      string filename(entry);
+      if(filename.size() <= 10) continue;
+      if(filename.compare(0, 6, "Common") != 0) continue;
+      if(filename.compare(filename.size()-4, 4, ".xml") != 0) continue;
+
+      string file_id = filename.substr(6, filename.size()-10);
+      string key_prefix = "Common" + file_id + "List/";
+
+      bool loaded = false;
+      vector<string>::const_iterator key_iter = fConfigKeyList.begin();
+      for( ; key_iter != fConfigKeyList.end(); ++key_iter) {
+        if(key_iter->compare(0, key_prefix.size(), key_prefix) == 0) {
+          loaded = true;
+          break;
+        }
+      }
+      if(!loaded) ok = this->LoadCommonLists(file_id) && ok;
+    }
+    gSystem->FreeDirectory(dirp);
+  }
+  return ok;
+}
+//____________________________________________________________________________
+namespace {
+  // Binary snapshot layout:
+  //  - signature, version
+  //  - fingerprint (tune & XML search path)
+  //  - the XML files read, with their size and modification time
+  //  - master config file name, algorithm -> XML config file map
+  //  - configuration key list
+  //  - registries: key, name and items (key, type, value)
+  const char     kSnapshotSignature[8] = { 'G','C','F','G','S','N','A','P' };
+  const uint32_t kSnapshotVersion      = 1;
+
+  void WriteString(ostream & out, const string & s)
+  {
+    uint32_t n = s.size();
+    out.write((const char *) &n, sizeof(n));
+    out.write(s.data(), n);
+  }
+  template<class T> void WriteValue(ostream & out, T v)
+  {
+    out.write((const char *) &v, sizeof(T));
+  }
+
+  class SnapshotReader {
+  public:
+    SnapshotReader(const char * begin, const char * end) :
+      fPtr(begin), fEnd(end), fOk(true) { }
+    bool Ok   (void) const { return fOk;  }
+    void Fail (void)       { fOk = false; }
+    template<class T> T Value(void)
+    {
+      T v = T();
+      if(!fOk || fPtr + sizeof(T) > fEnd) { fOk = false; return v; }
+      memcpy(&v, fPtr, sizeof(T));
+      fPtr += sizeof(T);
+      return v;
+    }
+    string String(void)
+    {
+      uint32_t n = this->Value<uint32_t>();
+      if(!fOk || fPtr + n > fEnd) { fOk = false; return ""; }
+      string s(fPtr, n);
+      fPtr += n;
+      return s;
+    }
+  private:
+    const char * fPtr;
+    const char * fEnd;
+    bool         fOk;
+  };
+
+  bool FileStat(const string & filename, int64_t & size, int64_t & mtime)
+  {
+    struct stat st;
+    if(stat(filename.c_str(), &st) != 0) return false;
+    size  = st.st_size;
+    mtime = st.st_mtime;
+    return true;
+  }
+}
+//____________________________________________________________________________
+string AlgConfigPool::SnapshotFingerprint(void) const
+{
+  TuneId * tune = RunOpt::Instance()->Tune();
+  ostringstream fp;
+  fp << ((tune) ? tune->Name() : "") << "|" << utils::xml::GetXMLPathList();
+  return fp.str();
+}
+//____________________________________________________________________________
+bool AlgConfigPool::SaveSnapshot(string filename) const
+{
+// Saves the fully resolved pool in a binary snapshot. Configuration
+// parameters that are ROOT objects can not be included.
+
+  // the snapshot must hold the complete pool
+  const_cast<AlgConfigPool*>( this ) -> LoadAllPendingAlgConfigs();
+
+  std::lock_guard<std::recursive_mutex> lock(fMutex);
+
+  std::ofstream out(filename.c_str(), std::ios::out | std::ios::binary);
+  if(!out.is_open()) {
+    LOG("AlgConfigPool", pERROR)
+      << "Couldn't open configuration snapshot file: " << filename;
+    return false;
+  }
+
+  out.write(kSnapshotSignature, sizeof(kSnapshotSignature));
+  WriteValue<uint32_t>(out, kSnapshotVersion);
+  WriteString(out, this->SnapshotFingerprint());
+
+  WriteValue<uint32_t>(out, fXmlFiles.size());
+  vector<string>::const_iterator file_iter = fXmlFiles.begin();
+  for( ; file_iter != fXmlFiles.end(); ++file_iter) {
+    int64_t size = 0, mtime = 0;
+    FileStat(*file_iter, size, mtime);
+    WriteString(out, *file_iter);
+    WriteValue<int64_t>(out, size);
+    WriteValue<int64_t>(out, mtime);
+  }
+
+  WriteString(out, fMasterConfig);
+  WriteValue<uint32_t>(out, fConfigFiles.size());
+  map<string, string>::const_iterator conf_file_iter = fConfigFiles.begin();
+  for( ; conf_file_iter != fConfigFiles.end(); ++conf_file_iter) {
+    WriteString(out, conf_file_iter->first);
+    WriteString(out, conf_file_iter->second);
+  }
+
+  WriteValue<uint32_t>(out, fConfigKeyList.size());
+  vector<string>::const_iterator key_iter = fConfigKeyList.begin();
+  for( ; key_iter != fConfigKeyList.end(); ++key_iter) {
+    WriteString(out, *key_iter);
+  }
+
+  WriteValue<uint32_t>(out, fRegistryPool.size());
+  map<string, Registry *>::const_iterator reg_iter = fRegistryPool.begin();
+  for( ; reg_iter != fRegistryPool.end(); ++reg_iter) {
+    const Registry * config = reg_iter->second;
+    WriteString(out, reg_iter->first);
+    WriteString(out, config->Name());
+
+    const RgIMap & items = config->GetItemMap();
+    WriteValue<uint32_t>(out, items.size());
+    RgIMapConstIter item_iter = items.begin();
+    for( ; item_iter != items.end(); ++item_iter) {
+      const RgKey & key = item_iter->first;
+      RgType_t type = item_iter->second->TypeInfo();
+      WriteString(out, key);
+      WriteValue<uint8_t>(out, (uint8_t) type);
+      switch(type) {
+        case (kRgBool) : WriteValue<uint8_t>(out, config->GetBool(key));   break;
+        case (kRgInt)  : WriteValue<int32_t>(out, config->GetInt(key));    break;
+        case (kRgDbl)  : WriteValue<double> (out, config->GetDouble(key)); break;
+        case (kRgStr)  : WriteString        (out, config->GetString(key)); break;
+        case (kRgAlg)  : {
+          RgAlg alg = config->GetAlg(key);
+          WriteString(out, alg.name);
+          WriteString(out, alg.config);
+          break;
+        }
+        default :
+          LOG("AlgConfigPool", pERROR)
+            << "Parameter " << reg_iter->first << ":" << key << " of type "
+            << RgType::AsString(type) << " can not be saved in a snapshot";
+          out.close();
+          remove(filename.c_str());
+          return false;
+      }
+    }
+  }
+  out.close();
+
+  LOG("AlgConfigPool", pNOTICE)
+    << "Saved " << fRegistryPool.size()
+    << " configuration sets in snapshot: " << filename;
+  return true;
+}
+//____________________________________________________________________________
+bool AlgConfigPool::LoadSnapshot(string filename)
+{
+// Restores the pool from a binary snapshot. Returns false (leaving the pool
+// empty) if the snapshot can not be read, was made for a different tune or
+// XML search path, or if any of the XML files it was built from changed.
+
+  std::ifstream in(filename.c_str(), std::ios::in | std::ios::binary);
+  if(!in.is_open()) {
+    LOG("AlgConfigPool", pWARN)
+      << "Couldn't open configuration snapshot: " << filename;
+    return false;
+  }
+  vector<char> buffer( (std::istreambuf_iterator<char>(in)),
+                        std::istreambuf_iterator<char>() );
+  in.close();
+
+  if(buffer.size() < sizeof(kSnapshotSignature) ||
+     memcmp(buffer.data(), kSnapshotSignature, sizeof(kSnapshotSignature))) {
+    LOG("AlgConfigPool", pWARN)
+      << "Not a configuration snapshot: " << filename;
+    return false;
+  }
+  SnapshotReader reader(buffer.data() + sizeof(kSnapshotSignature),
+                        buffer.data() + buffer.size());
+
+  if(reader.Value<uint32_t>() != kSnapshotVersion) {
+    LOG("AlgConfigPool", pWARN)
+      << "Unsupported configuration snapshot version: " << filename;
+    return false;
+  }
+  if(reader.String() != this->SnapshotFingerprint()) {
+    LOG("AlgConfigPool", pWARN)
+      << "Configuration snapshot " << filename
+      << " was made for a different tune or XML search path - Ignoring it";
+    return false;
+  }
+
+  vector<string> xml_files;
+  uint32_t nfiles = reader.Value<uint32_t>();
+  for(uint32_t i = 0; i < nfiles && reader.Ok(); i++) {
+    string file = reader.String();
+    int64_t size  = reader.Value<int64_t>();
+    int64_t mtime = reader.Value<int64_t>();
+    int64_t cur_size = -1, cur_mtime = -1;
+    if(!FileStat(file, cur_size, cur_mtime) ||
+       cur_size != size || cur_mtime != mtime) {
+      LOG("AlgConfigPool", pWARN)
+        << "Configuration snapshot " << filename << " is out of date ("
+        << file << " has changed) - Ignoring it";
+      return false;
+    }
+    xml_files.push_back(file);
+  }
+
+  string master_config = reader.String();
+  map<string, string> config_files;
+  uint32_t nconf = reader.Value<uint32_t>();
+  for(uint32_t i = 0; i < nconf && reader.Ok(); i++) {
+    string alg_name  = reader.String();
+    string file_name = reader.String();
+    config_files.insert(pair<string, string>(alg_name, file_name));
+  }
+
+  vector<string> key_list;
+  uint32_t nkeys = reader.Value<uint32_t>();
+  for(uint32_t i = 0; i < nkeys && reader.Ok(); i++) {
+    key_list.push_back(reader.String());
+  }
+
+  map<string, Registry *> registry_pool;
+  uint32_t nreg = reader.Value<uint32_t>();
+  for(uint32_t i = 0; i < nreg && reader.Ok(); i++) {
+    string key  = reader.String();
+    string name = reader.String();
+    Registry * config = new Registry(name, false);
+    uint32_t nitems = reader.Value<uint32_t>();
+    for(uint32_t j = 0; j < nitems && reader.Ok(); j++) {
+      RgKey item_key = reader.String();
+      RgType_t type = (RgType_t) reader.Value<uint8_t>();
+      switch(type) {
+        case (kRgBool) : config->Set(item_key, (RgBool) reader.Value<uint8_t>()); break;
+        case (kRgInt)  : config->Set(item_key, (RgInt)  reader.Value<int32_t>()); break;
+        case (kRgDbl)  : config->Set(item_key, (RgDbl)  reader.Value<double>());  break;
+        case (kRgStr)  : config->Set(item_key, (RgStr)  reader.String());         break;
+        case (kRgAlg)  : {
+          string alg_name   = reader.String();
+          string alg_config = reader.String();
+          config->Set(item_key, RgAlg(alg_name, alg_config));
+          break;
+        }
+        default : reader.Fail(); break;
+      }
+    }
+    config->SetName(name);
+    config->Lock();
+    registry_pool.insert(pair<string, Registry *>(key, config));
+  }
+
+  if(!reader.Ok()) {
+    LOG("AlgConfigPool", pWARN)
+      << "Corrupted configuration snapshot: " << filename << " - Ignoring it";
+    map<string, Registry *>::iterator it = registry_pool.begin();
+    for( ; it != registry_pool.end(); ++it) delete it->second;
+    return false;
+  }
+
+  fMasterConfig = master_config;
+  fXmlFiles.swap(xml_files);
+  fConfigFiles.swap(config_files);
+  fConfigKeyList.swap(key_list);
+  fRegistryPool.swap(registry_pool);
+
+  LOG("AlgConfigPool", pNOTICE)
+    << "Restored " << fRegistryPool.size()
+    << " configuration sets from snapshot: " << filename;
+  return true;
+}
+//____________________________________________________________________________
 void AlgConfigPool::Print(ostream & stream) const
 {
   string frame(100,'~');
 
+  const_cast<AlgConfigPool*>( this ) -> LoadAllPendingAlgConfigs();
+
   typedef map<string, Registry *>::const_iterator  sregIter;
   typedef map<string, Registry *>::size_type       sregSize;
 
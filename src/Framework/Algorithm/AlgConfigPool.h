@@ -6,6 +6,22 @@
 \brief    A singleton class holding all configuration registries built while
           parsing all loaded XML configuration files.
 
+          The fully resolved pool, for a given tune and XML search path, can
+          be saved in a binary snapshot (see the gconfsnap utility). If a
+          snapshot is specified (--config-snapshot option or GCONFSNAPSHOT
+          env. var), the pool is restored from it instead of parsing all XML
+          files. The snapshot is ignored, and the XML files parsed as usual,
+          if it was made for a different tune or XML search path, or if any
+          of the XML files it was built from has changed since.
+
+          In the demand-driven mode (--lazy-config option or GCONFLAZY env.
+          var) the XML config file of an algorithm is parsed only when one of
+          its configurations is first requested.
+
+          Several tunes can be held in one process: ActivateTune() (see
+          RunOpt::SwitchTune()) selects the pool that Instance() returns,
+          building it at the first activation of each tune.
+
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -20,14 +36,17 @@
 #define _ALG_CONFIG_POOL_H_
 
 #include <map>
+#include <set>
 #include <vector>
 #include <string>
 #include <iostream>
+#include <mutex>
 
 #include "Framework/Algorithm/Algorithm.h"
 #include "Framework/Registry/Registry.h"
 
 using std::map;
+using std::set;
 using std::vector;
 using std::string;
 using std::ostream;
@@ -42,6 +61,20 @@ class AlgConfigPool {
 public:
   static AlgConfigPool * Instance();
 
+  //! Make the pool of the input tune the one returned by Instance(). It is
+  //! built at the first activation of the tune, which must then be the
+  //! current RunOpt tune, and kept for later activations. Not thread-safe:
+  //! switch tunes only while no other thread uses the pool
+  static void ActivateTune(string tune);
+
+  //! Index of the tune of the active pool, in the order the pools were
+  //! built (0 also before any pool is built). Used by AlgFactory to keep
+  //! separate algorithm pools for each tune
+  static unsigned int ActiveTuneIndex(void);
+
+  //! Name of the tune this pool was built for
+  string TuneName(void) const { return fTuneName; }
+
   Registry * FindRegistry (string key)                        const;
   Registry * FindRegistry (string alg_name, string param_set) const;
   Registry * FindRegistry (const Algorithm * algorithm)       const;
@@ -54,6 +87,10 @@ public:
 
   const vector<string> & ConfigKeyList (void) const;
 
+  // binary snapshot of the fully resolved configuration pool
+  bool SaveSnapshot       (string filename) const;
+  bool LoadAllCommonLists (void);
+
   void Print(ostream & stream) const;
   friend ostream & operator << (ostream & stream, const AlgConfigPool & cp);
 
@@ -71,27 +108,43 @@ private:
   bool   LoadCommonLists( const string & file_id );
   bool   LoadTuneGeneratorList(void);
   bool   LoadSingleAlgConfig (string alg_name, string file_name);
+  bool   LoadPendingAlgConfig(string alg_name);
+  void   LoadAllPendingAlgConfigs (void);
   bool   LoadRegistries      (string key_base, string file_name, string root);
   int    AddParameterVector  (Registry * r, string pt, string pn, string pv, const string & delim = ";" );
   void   AddConfigParameter  (Registry * r, string pt, string pn, string pv);
   void   AddBasicParameter   (Registry * r, string pt, string pn, string pv);
   void   AddRootObjParameter (Registry * r, string pt, string pn, string pv);
+  bool   LoadSnapshot        (string filename);
+  string SnapshotFingerprint (void) const;
+
 
+  static AlgConfigPool * BuildPool(void);
 
-  static AlgConfigPool * fInstance;
+  static AlgConfigPool * fInstance;               ///< pool of the active tune
+  static map<string, AlgConfigPool *> fTunePools; ///< tune name -> pool, for all pools built
+
+  string                  fTuneName;      ///< tune this pool was built for
+  unsigned int            fTuneIndex;     ///< see ActiveTuneIndex()
 
   map<string, Registry *> fRegistryPool;  ///< algorithm/param_set -> Registry
   map<string, string>     fConfigFiles;   ///< algorithm -> XML config file
   vector<string>          fConfigKeyList; ///< list of all available configuration keys
   string                  fMasterConfig;  ///< lists config files for all algorithms
+  vector<string>          fXmlFiles;      ///< all XML files read so far
+  set<string>             fPendingAlgs;   ///< algorithms whose XML config file is not parsed yet (demand-driven mode)
+
+  mutable std::recursive_mutex fMutex;    ///< guards the on-demand loading
 
   struct Cleaner {
       void DummyMethodAndSilentCompiler() { }
       ~Cleaner() {
-         if (AlgConfigPool::fInstance !=0) {
-            delete AlgConfigPool::fInstance;
-            AlgConfigPool::fInstance = 0;
+         map<string, AlgConfigPool *>::iterator it = AlgConfigPool::fTunePools.begin();
+         for( ; it != AlgConfigPool::fTunePools.end(); ++it) {
+            delete it->second;
          }
+         AlgConfigPool::fTunePools.clear();
+         AlgConfigPool::fInstance = 0;
       }
   };
   friend struct Cleaner;
@@ -10,6 +10,8 @@
 
 #include <iostream>
 #include <cstdlib>
+#include <set>
+#include <vector>
 
 #include <TROOT.h>
 #include <TClass.h>
@@ -20,6 +22,8 @@
 #include "Framework/Messenger/Messenger.h"
 
 using std::endl;
+using std::set;
+using std::vector;
 
 using namespace genie;
 
@@ -32,9 +36,11 @@ namespace genie {
   }
 }
 //____________________________________________________________________________
-AlgFactory * AlgFactory::fInstance = 0;
+thread_local AlgFactory * AlgFactory::fInstance = 0;
+thread_local unsigned int AlgFactory::fInstanceTune = 0;
 //____________________________________________________________________________
-AlgFactory::AlgFactory()
+AlgFactory::AlgFactory() :
+fGeneration(0)
 {
   fInstance =  0;
 }
@@ -63,11 +69,15 @@ AlgFactory::~AlgFactory()
 //____________________________________________________________________________
 AlgFactory * AlgFactory::Instance()
 {
-  if(fInstance == 0) {
-    static AlgFactory::Cleaner cleaner;
+  unsigned int tune = AlgConfigPool::ActiveTuneIndex();
+  if(fInstance == 0 || fInstanceTune != tune) {
+    static thread_local AlgFactory::Cleaner cleaner;
     cleaner.DummyMethodAndSilentCompiler();
 
-    fInstance = new AlgFactory;
+    AlgFactory * & factory = cleaner.fTuneFactories[tune];
+    if(factory == 0) factory = new AlgFactory;
+    fInstance     = factory;
+    fInstanceTune = tune;
   }
   return fInstance;
 }
@@ -133,19 +143,91 @@ void AlgFactory::ForceReconfiguration(bool ignore_alg_opt_out)
   LOG("AlgFactory", pNOTICE)
        << " ** Forcing algorithm re-configuration";
 
+  fGeneration++;
+
   map<string, Algorithm *>::iterator alg_iter = fAlgPool.begin();
   for( ; alg_iter != fAlgPool.end(); ++alg_iter) {
-    Algorithm * alg = alg_iter->second;
-    bool reconfig = (ignore_alg_opt_out) ? true : alg->AllowReconfig();
-    if(reconfig) {
-       string config = alg->Id().Config();
-       bool skip_conf = (config=="NoConfig" || config=="");
-       if(!skip_conf) {
-//         LOG("AlgFactory", pINFO) << "Reconfiguring: " << alg->Id().Key();
-           alg->Configure(config);
-       }
-    }//allow?
+    this->Reconfigure(alg_iter->second, ignore_alg_opt_out);
+  }
+}
+//____________________________________________________________________________
+int AlgFactory::ReconfigureChanged(bool ignore_alg_opt_out)
+{
+  // find the algorithms with changed registries
+  set<string> stale;
+  map<string, Algorithm *>::iterator alg_iter = fAlgPool.begin();
+  for( ; alg_iter != fAlgPool.end(); ++alg_iter) {
+    if(alg_iter->second->ConfigChanged()) stale.insert(alg_iter->first);
+  }
+  if(stale.empty()) {
+    LOG("AlgFactory", pINFO) << "No algorithm configuration has changed";
+    return 0;
+  }
+
+  // add the algorithms referring to them, up to a fixed point
+  map<string, vector<string> > subalgs;
+  for(alg_iter = fAlgPool.begin(); alg_iter != fAlgPool.end(); ++alg_iter) {
+    subalgs[alg_iter->first] = alg_iter->second->SubAlgKeys();
+  }
+  bool added = true;
+  while(added) {
+    added = false;
+    map<string, vector<string> >::const_iterator dep_iter = subalgs.begin();
+    for( ; dep_iter != subalgs.end(); ++dep_iter) {
+      if(stale.count(dep_iter->first)) continue;
+      const vector<string> & keys = dep_iter->second;
+      for(unsigned int i = 0; i < keys.size(); i++) {
+        if(stale.count(keys[i])) {
+          stale.insert(dep_iter->first);
+          added = true;
+          break;
+        }
+      }
+    }
+  }
+
+  LOG("AlgFactory", pNOTICE)
+       << " ** Re-configuring " << stale.size() << " of "
+       << fAlgPool.size() << " algorithms";
+
+  fGeneration++;
+
+  // reconfigure sub-algorithms first (in pool order, if there is a cycle)
+  int nreconf = 0;
+  while(!stale.empty()) {
+    vector<string> ready;
+    set<string>::const_iterator key_iter = stale.begin();
+    for( ; key_iter != stale.end(); ++key_iter) {
+      const vector<string> & keys = subalgs[*key_iter];
+      bool waits = false;
+      for(unsigned int i = 0; i < keys.size() && !waits; i++) {
+        waits = (keys[i] != *key_iter && stale.count(keys[i]) > 0);
+      }
+      if(!waits) ready.push_back(*key_iter);
+    }
+    if(ready.empty()) ready.assign(stale.begin(), stale.end());
+
+    for(unsigned int i = 0; i < ready.size(); i++) {
+      if(this->Reconfigure(fAlgPool[ready[i]], ignore_alg_opt_out)) nreconf++;
+      stale.erase(ready[i]);
+    }
   }
+  return nreconf;
+}
+//____________________________________________________________________________
+bool AlgFactory::Reconfigure(Algorithm * alg, bool ignore_alg_opt_out) const
+{
+  bool reconfig = (ignore_alg_opt_out) ? true : alg->AllowReconfig();
+  if(reconfig) {
+     string config = alg->Id().Config();
+     bool skip_conf = (config=="NoConfig" || config=="");
+     if(!skip_conf) {
+//       LOG("AlgFactory", pINFO) << "Reconfiguring: " << alg->Id().Key();
+         alg->Configure(config);
+         return true;
+     }
+  }//allow?
+  return false;
 }
 //____________________________________________________________________________
 Algorithm * AlgFactory::InstantiateAlgorithm(string name, string config) const
@@ -39,6 +39,15 @@ ostream & operator << (ostream & stream, const genie::AlgFactory & algf);
 class AlgFactory {
 
 public:
+  //! Access instance.
+  //! Each thread gets its own factory and, therefore, its own pool of
+  //! configured algorithms. Algorithms keep per-call state so they can not be
+  //! shared between threads. Configurations are still read from the (shared)
+  //! AlgConfigPool, and large read-only tables can be shared between the
+  //! instances of all threads via the AlgSharedData store.
+  //! Each thread also keeps a separate factory for each tune held in the
+  //! process (see AlgConfigPool::ActivateTune()): the one returned is the
+  //! factory of the active tune.
   static AlgFactory * Instance();
 
   //! Instantiates, configures and returns a pointer to the specified algorithm.
@@ -57,6 +66,20 @@ public:
   //! Use that to propagate modifications made directly at the config pool.
   void ForceReconfiguration(bool ignore_alg_opt_out=false);
 
+  //! Like ForceReconfiguration() but only the algorithms whose configuration
+  //! registries have changed since they were last configured, and the
+  //! algorithms that refer to them (directly or through other algorithms),
+  //! are reconfigured. Sub-algorithms are reconfigured before the algorithms
+  //! referring to them. Tracks changes made in place to the registries of the
+  //! config pool (eg by tuning and reweighting loops); use
+  //! ForceReconfiguration() after any other change.
+  //! Returns the number of reconfigured algorithms.
+  int ReconfigureChanged(bool ignore_alg_opt_out=false);
+
+  //! Incremented at every ForceReconfiguration(). Lets clients caching
+  //! algorithm handles (see AlgHandle) know when to resolve them again.
+  unsigned long Generation(void) const { return fGeneration; }
+
   //! print algorithm factory
   void Print(ostream & stream) const;
   friend ostream & operator << (ostream & stream, const AlgFactory & algf);
@@ -70,21 +93,33 @@ private:
   //! & configuring algorithmic objects
   Algorithm * InstantiateAlgorithm(string name, string config) const;
 
+  //! reconfigure a pooled algorithm, unless it opts out
+  bool Reconfigure(Algorithm * alg, bool ignore_alg_opt_out) const;
+
   //! sinleton's self
-  static AlgFactory * fInstance;
+  static thread_local AlgFactory * fInstance;
+
+  //! tune (see AlgConfigPool::ActiveTuneIndex()) of fInstance
+  static thread_local unsigned int fInstanceTune;
 
   //! 'algorithm key' (namespace::name/config) -> 'algorithmic object' map
   map<string, Algorithm *> fAlgPool;
 
+  //! number of forced reconfigurations so far
+  unsigned long fGeneration;
+
   //! singleton cleaner
   struct Cleaner {
       void DummyMethodAndSilentCompiler() { }
       ~Cleaner() {
-         if (AlgFactory::fInstance !=0) {
-            delete AlgFactory::fInstance;
-            AlgFactory::fInstance = 0;
+         map<unsigned int, AlgFactory *>::iterator it = fTuneFactories.begin();
+         for( ; it != fTuneFactories.end(); ++it) {
+            delete it->second;
          }
+         fTuneFactories.clear();
+         AlgFactory::fInstance = 0;
       }
+      map<unsigned int, AlgFactory *> fTuneFactories; ///< tune -> factory of this thread
   };
   friend struct Cleaner;
 };
@@ -0,0 +1,110 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::AlgHandle
+
+\brief    A cached handle to a configured algorithm, for code outside the
+          Algorithm class hierarchy (eg free functions in the utils
+          namespaces) that would otherwise look-up an algorithm in the
+          AlgFactory, and cast it to its interface, at every call.
+
+          The algorithm is resolved on first use and again only after the
+          AlgFactory of the calling thread is forced to reconfigure its
+          algorithms, or the global parameter list (for handles resolved
+          from one of its keys) changes. Since each thread has its own
+          AlgFactory, handles should be thread_local, eg
+
+            static thread_local AlgHandle<NuclearModelI> nuclmodel;
+            const NuclearModelI * m =
+                  nuclmodel.FromGlobalParameterList("NuclearModel");
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _ALG_HANDLE_H_
+#define _ALG_HANDLE_H_
+
+#include <string>
+
+#include "Framework/Algorithm/AlgId.h"
+#include "Framework/Algorithm/AlgFactory.h"
+#include "Framework/Algorithm/AlgConfigPool.h"
+#include "Framework/Registry/Registry.h"
+
+using std::string;
+
+namespace genie {
+
+template<class T> class AlgHandle {
+public:
+  AlgHandle() :
+    fAlg(0), fFactory(0), fGeneration(0), fRegistry(0), fVersion(0),
+    fResolved(false) { }
+
+  //! The algorithm with the input name & configuration, cast to T
+  //! (null if it is not a T)
+  const T * Get(const string & name, const string & config = "Default")
+  {
+    AlgFactory * algf = AlgFactory::Instance();
+    if( ! this->IsValid(algf, 0) || name != fName || config != fConfig ) {
+      fAlg = dynamic_cast<const T *> (algf->GetAlgorithm(name, config));
+      fName   = name;
+      fConfig = config;
+      this->SetValid(algf, 0);
+    }
+    return fAlg;
+  }
+
+  //! The algorithm pointed to by the input key of the global parameter
+  //! list, cast to T (null if it is not a T)
+  const T * FromGlobalParameterList(const RgKey & key)
+  {
+    AlgFactory * algf = AlgFactory::Instance();
+    const Registry * gc = AlgConfigPool::Instance()->GlobalParameterList();
+    if( ! this->IsValid(algf, gc) || key != fName ) {
+      RgAlg alg = gc->GetAlg(key);
+      fAlg = dynamic_cast<const T *> (algf->GetAlgorithm(alg.name, alg.config));
+      fName   = key;
+      fConfig = "";
+      this->SetValid(algf, gc);
+    }
+    return fAlg;
+  }
+
+  //! Forces the algorithm to be resolved again at the next call
+  void Reset(void) { fResolved = false; }
+
+private:
+  bool IsValid(const AlgFactory * algf, const Registry * r) const {
+    return fResolved && algf == fFactory &&
+           algf->Generation() == fGeneration &&
+           r == fRegistry && (r == 0 || r->Version() == fVersion);
+  }
+  void SetValid(const AlgFactory * algf, const Registry * r) {
+    fFactory    = algf;
+    fGeneration = algf->Generation();
+    fRegistry   = r;
+    fVersion    = (r) ? r->Version() : 0;
+    fResolved   = true;
+  }
+
+  const T *          fAlg;
+  string             fName;        ///< algorithm name, or global parameter list key
+  string             fConfig;      ///< algorithm configuration
+  const AlgFactory * fFactory;     ///< factory the algorithm was resolved from
+  unsigned long      fGeneration;  ///< factory generation at resolution
+  const Registry *   fRegistry;    ///< global parameter list, if used
+  unsigned long      fVersion;     ///< its version at resolution
+  bool               fResolved;
+};
+
+}      // genie namespace
+
+#endif // _ALG_HANDLE_H_
@@ -41,9 +41,9 @@ public:
   AlgId(const RgAlg & registry_item);
  ~AlgId();
 
-  string Name   (void) const { return fName;   }
-  string Config (void) const { return fConfig; }
-  string Key    (void) const { return fKey;    }
+  const string & Name   (void) const { return fName;   }
+  const string & Config (void) const { return fConfig; }
+  const string & Key    (void) const { return fKey;    }
 
   void   SetId     (string name, string config="");
   void   SetName   (string name);
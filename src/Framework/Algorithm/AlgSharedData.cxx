@@ -0,0 +1,89 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+
+#include "Framework/Algorithm/AlgSharedData.h"
+#include "Framework/Messenger/Messenger.h"
+
+using std::endl;
+
+using namespace genie;
+
+//____________________________________________________________________________
+namespace genie {
+  ostream & operator << (ostream & stream, const AlgSharedData & data)
+  {
+    data.Print(stream);
+    return stream;
+  }
+}
+//____________________________________________________________________________
+AlgSharedData * AlgSharedData::fInstance = 0;
+//____________________________________________________________________________
+AlgSharedData::AlgSharedData()
+{
+  fInstance = 0;
+}
+//____________________________________________________________________________
+AlgSharedData::~AlgSharedData()
+{
+  fData.clear();
+  fInstance = 0;
+}
+//____________________________________________________________________________
+AlgSharedData * AlgSharedData::Instance()
+{
+  static std::mutex init_mutex;
+  std::lock_guard<std::mutex> lock(init_mutex);
+
+  if(fInstance == 0) {
+    static AlgSharedData::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+    fInstance = new AlgSharedData;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+void AlgSharedData::Release(const string & key)
+{
+  std::lock_guard<std::recursive_mutex> lock(fMutex);
+  fData.erase(key);
+}
+//____________________________________________________________________________
+bool AlgSharedData::Exists(const string & key) const
+{
+  std::lock_guard<std::recursive_mutex> lock(fMutex);
+  return fData.count(key) > 0;
+}
+//____________________________________________________________________________
+void AlgSharedData::Print(ostream & stream) const
+{
+  std::lock_guard<std::recursive_mutex> lock(fMutex);
+
+  stream << "\n[-] Shared algorithm data:";
+  map<string, Entry>::const_iterator it = fData.begin();
+  for( ; it != fData.end(); ++it) {
+    stream << "\n |-> " << it->first
+           << " (users: " << it->second.data.use_count() - 1 << ")";
+  }
+  stream << endl;
+}
+//____________________________________________________________________________
+void AlgSharedData::AbortOnTypeMismatch(
+                            const string & key, const string & type) const
+{
+  LOG("AlgSharedData", pFATAL)
+     << "Data stored with key: " << key << " are not of requested type: "
+     << type;
+  gAbortingInErr = true;
+  exit(1);
+}
+//____________________________________________________________________________
@@ -0,0 +1,132 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::AlgSharedData
+
+\brief    A process-wide store of immutable data (eg large tables read from
+          data files) shared by the instances of an algorithm in all
+          threads.
+
+          Each thread has its own AlgFactory and, therefore, its own
+          instances of the configured algorithms (see AlgFactory). These
+          instances hold the per-call (scratch) state and can be used by a
+          single thread only. Data that are expensive to build and are only
+          read after construction should be obtained from this store when
+          the algorithm is configured, so that they are built once and
+          shared by all threads rather than duplicated in each of them:
+
+            fGrid = AlgSharedData::Instance()->Get<Grid>(
+                        "GRV98LO/" + file, [&file] () { return ReadGrid(file); });
+
+          The data are built by the first caller, under a lock, and are kept
+          alive for as long as the store or any algorithm refers to them.
+          Stored data must be safe to read concurrently.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _ALG_SHARED_DATA_H_
+#define _ALG_SHARED_DATA_H_
+
+#include <map>
+#include <string>
+#include <iostream>
+#include <memory>
+#include <functional>
+#include <mutex>
+#include <typeinfo>
+
+using std::map;
+using std::string;
+using std::ostream;
+
+namespace genie {
+
+class AlgSharedData;
+ostream & operator << (ostream & stream, const AlgSharedData & data);
+
+class AlgSharedData
+{
+public:
+  static AlgSharedData * Instance(void);
+
+  //! Returns the data stored with the input key, building them first with
+  //! the input function if they aren't stored yet. Data built as null are
+  //! not stored.
+  template<class T>
+    std::shared_ptr<const T> Get(
+        const string & key, std::function<T * (void)> build);
+
+  //! Drops the store reference to the data kept with the input key (eg so
+  //! that they are rebuilt after their data source was changed). Algorithms
+  //! holding the data keep them until they release them.
+  void Release (const string & key);
+  bool Exists  (const string & key) const;
+  void Print   (ostream & stream) const;
+
+  friend ostream & operator << (ostream & stream, const AlgSharedData & data);
+
+private:
+  AlgSharedData();
+  AlgSharedData(const AlgSharedData & data);
+  virtual ~AlgSharedData();
+
+  struct Entry {
+    std::shared_ptr<const void> data;
+    string                      type;  ///< typeid name of the stored type
+  };
+
+  void AbortOnTypeMismatch (const string & key, const string & type) const;
+
+  map<string, Entry>           fData;
+  mutable std::recursive_mutex fMutex; ///< builders may request other data
+
+  static AlgSharedData * fInstance;
+
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (AlgSharedData::fInstance !=0) {
+            delete AlgSharedData::fInstance;
+            AlgSharedData::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+//____________________________________________________________________________
+template<class T>
+  std::shared_ptr<const T> AlgSharedData::Get(
+     const string & key, std::function<T * (void)> build)
+{
+  std::lock_guard<std::recursive_mutex> lock(fMutex);
+
+  map<string, Entry>::const_iterator it = fData.find(key);
+  if(it != fData.end()) {
+    if(it->second.type != typeid(T).name()) {
+      this->AbortOnTypeMismatch(key, typeid(T).name());
+    }
+    return std::static_pointer_cast<const T>(it->second.data);
+  }
+
+  std::shared_ptr<const T> data(build());
+  if(data) {
+    Entry entry;
+    entry.data = data;
+    entry.type = typeid(T).name();
+    fData[key] = entry;
+  }
+  return data;
+}
+
+}      // genie namespace
+
+#endif // _ALG_SHARED_DATA_H_
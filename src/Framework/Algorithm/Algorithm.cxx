@@ -8,9 +8,12 @@
 */
 //____________________________________________________________________________
 
+#include <atomic>
 #include <vector>
+#include <set>
 #include <string>
 #include <sstream>
+#include <iomanip>
 
 #include "Framework/Algorithm/AlgFactory.h"
 #include "Framework/Algorithm/Algorithm.h"
@@ -25,6 +28,11 @@ using std::endl;
 using namespace genie;
 using namespace genie::utils;
 
+namespace {
+  // see Algorithm::ConfigEpoch()
+  std::atomic<unsigned long> gConfigEpoch(0);
+}
+
 //____________________________________________________________________________
 namespace genie
 {
@@ -81,6 +89,8 @@ void Algorithm::Configure(const Registry & config)
     delete rp ;
   }
 
+  this->RecordConfigVersions();
+
   if(!fOwnsSubstruc) return;              // doesn't own substructure
   if(fOwnedSubAlgMp->size()==0) return;   // no sub-algorithms
 
@@ -239,6 +249,7 @@ void Algorithm::FindConfig(void)
     fConfig = 0 ;
   }
 
+  this->RecordConfigVersions();
 }
 
 //____________________________________________________________________________
@@ -283,6 +294,111 @@ Registry * Algorithm::GetOwnedConfig(void)
   return fConfig;
 }
 //____________________________________________________________________________
+bool Algorithm::ConfigChanged(void) const
+{
+  if ( fConfVersions.size() != fConfVect.size() ) return true ;
+
+  for ( unsigned int i = 0 ; i < fConfVect.size() ; ++i ) {
+    if ( fConfVect[i] -> Version() != fConfVersions[i] ) return true ;
+  }
+
+  if ( fOwnsSubstruc ) {
+    for ( AlgMapConstIter iter = fOwnedSubAlgMp -> begin() ;
+          iter != fOwnedSubAlgMp -> end() ; ++iter ) {
+      if ( iter -> second && iter -> second -> ConfigChanged() ) return true ;
+    }
+  }
+
+  return false ;
+}
+//____________________________________________________________________________
+namespace {
+  // Print the (resolved) configuration of the input algorithm and, recursively,
+  // of all the algorithms it refers to
+  void PrintConfigFingerprint(
+    const Algorithm * alg, std::ostream & stream, std::set<string> & visited)
+  {
+    if(!alg) return;
+    string id = alg->Id().Key();
+    stream << "{" << id;
+    if(visited.count(id) == 1) { stream << "}"; return; }
+    visited.insert(id);
+
+    const RgIMap & items = alg->GetConfig().GetItemMap();
+    RgIMapConstIter it = items.begin();
+    for( ; it != items.end(); ++it) {
+      const RgKey & key = it->first;
+      const RegistryItemI * item = it->second;
+      if(!item) continue;
+      stream << ";" << key << "=";
+      switch(item->TypeInfo()) {
+        case (kRgBool) : stream << alg->GetConfig().GetBool(key);   break;
+        case (kRgInt)  : stream << alg->GetConfig().GetInt(key);    break;
+        case (kRgDbl)  : stream << std::setprecision(17)
+                                << alg->GetConfig().GetDouble(key); break;
+        case (kRgStr)  : stream << alg->GetConfig().GetString(key); break;
+        case (kRgAlg)  : {
+          RgAlg subalg = alg->GetConfig().GetAlg(key);
+          PrintConfigFingerprint(
+            AlgFactory::Instance()->GetAlgorithm(subalg.name, subalg.config),
+            stream, visited);
+          break;
+        }
+        default : item->Print(stream); break;
+      }
+    }
+    stream << "}";
+  }
+}
+//____________________________________________________________________________
+unsigned long Algorithm::ConfigEpoch(void)
+{
+  return gConfigEpoch;
+}
+//____________________________________________________________________________
+string Algorithm::ConfigFingerprint(void) const
+{
+  std::ostringstream fingerprint;
+  std::set<string> visited;
+  PrintConfigFingerprint(this, fingerprint, visited);
+  return fingerprint.str();
+}
+//____________________________________________________________________________
+vector<string> Algorithm::SubAlgKeys(void) const
+{
+  vector<string> keys ;
+
+  for ( unsigned int i = 0 ; i < fConfVect.size() ; ++i ) {
+    const RgIMap & rgmap = fConfVect[i] -> GetItemMap() ;
+    for ( RgIMapConstIter it = rgmap.begin() ; it != rgmap.end() ; ++it ) {
+      if ( it -> second -> TypeInfo() != kRgAlg ) continue ;
+      AlgId id( fConfVect[i] -> GetAlg( it -> first ) ) ;
+      keys.push_back( id.Key() ) ;
+    }
+  }
+
+  return keys ;
+}
+//____________________________________________________________________________
+bool Algorithm::DataSourceChanged( const string & name, const string & source )
+{
+  std::map<string, string>::iterator it = fDataSources.find( name ) ;
+  if ( it != fDataSources.end() && it -> second == source ) return false ;
+
+  fDataSources[name] = source ;
+  return true ;
+}
+//____________________________________________________________________________
+void Algorithm::RecordConfigVersions(void)
+{
+  gConfigEpoch++;
+
+  fConfVersions.resize( fConfVect.size() ) ;
+  for ( unsigned int i = 0 ; i < fConfVect.size() ; ++i ) {
+    fConfVersions[i] = fConfVect[i] -> Version() ;
+  }
+}
+//____________________________________________________________________________
 AlgCmp_t Algorithm::Compare(const Algorithm * algo) const
 {
 // Compares itself with the input algorithm
@@ -104,6 +104,26 @@ public:
   //! to improve event reweighting speed.
   virtual bool AllowReconfig(void) const { return fAllowReconfig; }
 
+  //! Has any configuration registry (also of the owned sub-algorithms)
+  //! changed since the algorithm was last configured?
+  //! Used by AlgFactory::ReconfigureChanged()
+  bool ConfigChanged(void) const;
+
+  //! Keys (name/config) of all sub-algorithms referred to in the
+  //! configuration registries
+  vector<string> SubAlgKeys(void) const;
+
+  //! Resolved configuration of the algorithm and, recursively, of all the
+  //! algorithms it refers to, printed in a string. Algorithms with the same
+  //! fingerprint compute the same thing (used eg as a content-addressed
+  //! key for data derived from the algorithm)
+  string ConfigFingerprint(void) const;
+
+  //! Counter incremented whenever any algorithm is (re)configured. Results
+  //! memoized across calls (eg form factors, see FormFactorMemo) record it
+  //! and are discarded once it changes
+  static unsigned long ConfigEpoch(void);
+
   //! Compare with input algorithm
   virtual AlgCmp_t Compare(const Algorithm * alg) const;
 
@@ -147,6 +167,12 @@ protected:
   void DeleteConfig       (void);
   void DeleteSubstructure (void);
 
+  //! For LoadConfig() methods loading data files: true if the data source
+  //! (eg the file name, plus any parameter affecting how it is read) with
+  //! the input name is different from the one recorded at the previous call,
+  //! ie if the data must be reloaded rather than only the parameters
+  bool DataSourceChanged( const string & name, const string & source ) ;
+
   //! Split an incoming configuration Registry into a block valid for this algorithm
   //! Ownership of the returned registry belongs to the algo
   Registry * ExtractLocalConfig( const Registry & in ) const ;
@@ -173,6 +199,10 @@ protected:
   //! Returns true if the value is found and the parameters is set
   template<class T>
     bool GetParam( const RgKey & name, T & p, bool is_top_call = true ) const ;
+  //! As above, with the key interned (and hashed) once for all registries
+  //! looked at, including those of the sub-algorithms
+  template<class T>
+    bool GetParam( const RgIKey & name, T & p, bool is_top_call = true ) const ;
 
   //! Ideal access to a parameter value from the vector of registries,
   //! With default value. Returns true if the value is set from the
@@ -198,6 +228,11 @@ private:
 
   Registry *   fConfig;        ///< Summary configuration derived from fConvVect, not necessarily allocated
 
+  void RecordConfigVersions(void);
+
+  vector<unsigned long> fConfVersions; ///< versions of the fConfVect registries when last configured
+  map<string, string>   fDataSources;  ///< data sources, see DataSourceChanged()
+
 };
 
 }       // genie namespace
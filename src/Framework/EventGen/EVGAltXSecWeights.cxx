@@ -0,0 +1,161 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <TMath.h>
+
+#include "Framework/Algorithm/AlgFactory.h"
+#include "Framework/EventGen/EVGAltXSecWeights.h"
+#include "Framework/EventGen/XSecAlgorithmI.h"
+#include "Framework/GHEP/GHepRecord.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+EVGAltXSecWeights * EVGAltXSecWeights::fInstance = 0;
+//____________________________________________________________________________
+EVGAltXSecWeights::EVGAltXSecWeights()
+{
+  fInstance = 0;
+  fEnabled  = false;
+}
+//____________________________________________________________________________
+EVGAltXSecWeights::~EVGAltXSecWeights()
+{
+  fInstance = 0;
+}
+//____________________________________________________________________________
+EVGAltXSecWeights * EVGAltXSecWeights::Instance()
+{
+  static std::mutex init_mutex;
+  std::lock_guard<std::mutex> lock(init_mutex);
+
+  if(fInstance == 0) {
+    static EVGAltXSecWeights::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+    fInstance = new EVGAltXSecWeights;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+int EVGAltXSecWeights::AddUniverse(string alg_key)
+{
+  std::lock_guard<std::mutex> lock(fMutex);
+
+  string::size_type slash = alg_key.find('/');
+  string name   = alg_key.substr(0, slash);
+  string config = (slash == string::npos) ?
+                     "Default" : alg_key.substr(slash+1);
+
+  fAlgName.push_back(name);
+  fAlgConfig.push_back(config);
+  fEnabled = true;
+
+  LOG("EVGAltXSecWeights", pNOTICE)
+    << "Added xsec model universe " << fAlgName.size() - 1
+    << ": " << name << "/" << config;
+
+  return fAlgName.size() - 1;
+}
+//____________________________________________________________________________
+void EVGAltXSecWeights::Clear(void)
+{
+  std::lock_guard<std::mutex> lock(fMutex);
+
+  fAlgName.clear();
+  fAlgConfig.clear();
+  fEnabled = false;
+}
+//____________________________________________________________________________
+bool EVGAltXSecWeights::IsEnabled(void) const
+{
+  std::lock_guard<std::mutex> lock(fMutex);
+  return fEnabled;
+}
+//____________________________________________________________________________
+int EVGAltXSecWeights::NUniverses(void) const
+{
+  std::lock_guard<std::mutex> lock(fMutex);
+  return fAlgName.size();
+}
+//____________________________________________________________________________
+string EVGAltXSecWeights::Universe(int i) const
+{
+  std::lock_guard<std::mutex> lock(fMutex);
+  if(i < 0 || i >= (int)fAlgName.size()) return "";
+  return fAlgName[i] + "/" + fAlgConfig[i];
+}
+//____________________________________________________________________________
+void EVGAltXSecWeights::Compute(
+    GHepRecord * event, const XSecAlgorithmI * nominal) const
+{
+  vector<string> names, configs;
+  {
+    std::lock_guard<std::mutex> lock(fMutex);
+    names   = fAlgName;
+    configs = fAlgConfig;
+  }
+  unsigned int nuniv = names.size();
+
+  vector<double> weights(nuniv, 1.);
+
+  Interaction * interaction = event->Summary();
+  KinePhaseSpace_t kps = event->DiffXSecVars();
+
+  bool has_nominal = false;
+  for(unsigned int i = 0; i < nuniv; i++) {
+    if(nominal && names[i] == nominal->Id().Name()) has_nominal = true;
+  }
+  if(!has_nominal || !interaction || kps == kPSNull) {
+    event->SetXSecWeights(weights);
+    return;
+  }
+
+  // Evaluate the nominal and alternative differential cross sections at the
+  // selected kinematics, with the validity checks already passed at generation
+
+  bool skip_proc = interaction->TestBit(kISkipProcessChk);
+  bool skip_kine = interaction->TestBit(kISkipKinematicChk);
+  interaction->SetBit(kISkipProcessChk);
+  interaction->SetBit(kISkipKinematicChk);
+  interaction->KinePtr()->UseSelectedKinematics();
+
+  double xsec_nom = nominal->XSec(interaction, kps);
+  if(xsec_nom > 0) {
+    AlgFactory * algf = AlgFactory::Instance();
+    for(unsigned int i = 0; i < nuniv; i++) {
+      if(names[i] != nominal->Id().Name()) continue;
+      const XSecAlgorithmI * alt = dynamic_cast<const XSecAlgorithmI *> (
+                                algf->GetAlgorithm(names[i], configs[i]));
+      if(!alt) {
+        LOG("EVGAltXSecWeights", pERROR)
+          << "Not a cross section algorithm: " << names[i] << "/" << configs[i];
+        continue;
+      }
+      weights[i] = TMath::Max(0., alt->XSec(interaction, kps)) / xsec_nom;
+    }
+  } else {
+    LOG("EVGAltXSecWeights", pWARN)
+      << "Null nominal cross section at the selected kinematics - "
+      << "Setting unit weights";
+  }
+
+  interaction->KinePtr()->ClearRunningValues();
+  if(!skip_proc) interaction->ResetBit(kISkipProcessChk);
+  if(!skip_kine) interaction->ResetBit(kISkipKinematicChk);
+
+  event->SetXSecWeights(weights);
+
+  LOG("EVGAltXSecWeights", pINFO)
+    << "Computed " << nuniv << " xsec model weights (nominal model: "
+    << nominal->Id().Key() << ")";
+}
+//____________________________________________________________________________
@@ -0,0 +1,99 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::EVGAltXSecWeights
+
+\brief    Event weights for alternative cross section model configurations
+          ("universes"), computed by the event generation threads
+          (EventGenerator objects) while an event is being generated.
+
+          Each universe is an alternative configuration of a cross section
+          algorithm (algorithm key, e.g. "genie::LwlynSmithQELCCPXSec/MyTune").
+          At the end of each processing sequence, for the universes of the
+          thread's cross section algorithm, the weight of the event is the
+          ratio of the alternative to the nominal differential cross section
+          evaluated at the generated kinematics (for the differential cross
+          section stored in the event, see GHepRecord::DiffXSecVars()), with
+          the interaction summary and the struck nucleon still in memory.
+          The other universes get a weight of 1. The weights are stored in the
+          event (GHepRecord::XSecWeights()), in the order of the universes.
+
+          This is a weight for the selected kinematics only: The total cross
+          section (the interaction selection probability) is not reweighted.
+          Changes to the hadronization and intranuclear models are not covered
+          either.
+
+          Computing the weights is off until a universe is added. Updates are
+          serialized so that the class can be used from several event
+          generation threads (each of which gets its own algorithm instances,
+          see AlgFactory).
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _EVG_ALT_XSEC_WEIGHTS_H_
+#define _EVG_ALT_XSEC_WEIGHTS_H_
+
+#include <string>
+#include <vector>
+#include <mutex>
+
+using std::string;
+using std::vector;
+
+namespace genie {
+
+class GHepRecord;
+class XSecAlgorithmI;
+
+class EVGAltXSecWeights
+{
+public:
+  static EVGAltXSecWeights * Instance(void);
+
+  // Add a universe: an algorithm key, e.g. "genie::LwlynSmithQELCCPXSec/MyTune"
+  // (the configuration defaults to "Default"). Returns the universe index
+  int    AddUniverse  (string alg_key);
+  void   Clear        (void);
+  bool   IsEnabled    (void) const;
+  int    NUniverses   (void) const;
+  string Universe     (int i) const;
+
+  // Called by the event generation threads after the processing sequence:
+  // Computes the weights of the event generated with the nominal xsec model
+  void Compute (GHepRecord * event, const XSecAlgorithmI * nominal) const;
+
+private:
+  EVGAltXSecWeights();
+  EVGAltXSecWeights(const EVGAltXSecWeights & weights);
+  virtual ~EVGAltXSecWeights();
+
+  vector<string>        fAlgName;      ///< xsec algorithm name, for each universe
+  vector<string>        fAlgConfig;    ///< xsec algorithm configuration, for each universe
+  bool                  fEnabled;      ///< compute weights?
+  mutable std::mutex    fMutex;
+
+  static EVGAltXSecWeights * fInstance;
+
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (EVGAltXSecWeights::fInstance !=0) {
+            delete EVGAltXSecWeights::fInstance;
+            EVGAltXSecWeights::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+}      // genie namespace
+
+#endif // _EVG_ALT_XSEC_WEIGHTS_H_
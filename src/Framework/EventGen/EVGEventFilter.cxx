@@ -0,0 +1,106 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include "Framework/EventGen/EVGEventFilter.h"
+#include "Framework/GHEP/GHepRecord.h"
+#include "Framework/Messenger/Messenger.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+EVGEventFilter * EVGEventFilter::fInstance = 0;
+//____________________________________________________________________________
+EVGEventFilter::EVGEventFilter()
+{
+  fInstance  = 0;
+  fNTested   = 0;
+  fNRejected = 0;
+}
+//____________________________________________________________________________
+EVGEventFilter::~EVGEventFilter()
+{
+  fInstance = 0;
+}
+//____________________________________________________________________________
+EVGEventFilter * EVGEventFilter::Instance()
+{
+  static std::mutex init_mutex;
+  std::lock_guard<std::mutex> lock(init_mutex);
+
+  if(fInstance == 0) {
+    static EVGEventFilter::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+    fInstance = new EVGEventFilter;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+void EVGEventFilter::Set(Filter_t filter, string after_module)
+{
+  std::lock_guard<std::mutex> lock(fMutex);
+
+  fFilter      = filter;
+  fAfterModule = after_module;
+  fNTested     = 0;
+  fNRejected   = 0;
+
+  LOG("EVGEventFilter", pNOTICE)
+    << "Filtering events after processing step: " << fAfterModule;
+}
+//____________________________________________________________________________
+void EVGEventFilter::Unset(void)
+{
+  std::lock_guard<std::mutex> lock(fMutex);
+
+  fFilter = Filter_t();
+  fAfterModule = "";
+}
+//____________________________________________________________________________
+bool EVGEventFilter::Apply(
+    const GHepRecord * event, string module_name, string module_key)
+{
+  if(!fFilter) return true;
+  if(module_name != fAfterModule && module_key != fAfterModule) return true;
+
+  bool keep = fFilter(event);
+
+  std::lock_guard<std::mutex> lock(fMutex);
+  fNTested++;
+  if(!keep) fNRejected++;
+
+  return keep;
+}
+//____________________________________________________________________________
+long EVGEventFilter::NTested(void) const
+{
+  std::lock_guard<std::mutex> lock(fMutex);
+  return fNTested;
+}
+//____________________________________________________________________________
+long EVGEventFilter::NRejected(void) const
+{
+  std::lock_guard<std::mutex> lock(fMutex);
+  return fNRejected;
+}
+//____________________________________________________________________________
+double EVGEventFilter::Efficiency(void) const
+{
+  std::lock_guard<std::mutex> lock(fMutex);
+  if(fNTested <= 0) return 1.;
+  return (double)(fNTested - fNRejected) / (double)fNTested;
+}
+//____________________________________________________________________________
+void EVGEventFilter::Reset(void)
+{
+  std::lock_guard<std::mutex> lock(fMutex);
+  fNTested   = 0;
+  fNRejected = 0;
+}
+//____________________________________________________________________________
@@ -0,0 +1,102 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::EVGEventFilter
+
+\brief    Early-exit event filter for the event generation threads
+          (EventGenerator objects) run in a job.
+
+          The filter is a cheap, truth-level selection (e.g. a primary lepton
+          above threshold) evaluated by every EventGenerator right after the
+          chosen EventRecordVisitorI processing step; the remaining (usually
+          expensive: hadronization, decays, intranuclear rescattering) steps
+          are skipped for the rejected events. The rejected events are flagged
+          with kFilteredOut and are not returned by GEVGDriver / GMCJDriver.
+
+          Rejected events are dropped rather than regenerated, so the
+          accepted events keep their weights. For flux-driven jobs the
+          exposure (number of flux neutrinos thrown, POT) needs no correction.
+          Jobs generating a fixed number of events for a given cross section
+          should scale their exposure by 1/Efficiency().
+
+          Filtering is off until a filter is set. Updates are serialized so
+          that the class can be used from several event generation threads.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _EVG_EVENT_FILTER_H_
+#define _EVG_EVENT_FILTER_H_
+
+#include <string>
+#include <functional>
+#include <mutex>
+
+using std::string;
+
+namespace genie {
+
+class GHepRecord;
+
+class EVGEventFilter
+{
+public:
+  static EVGEventFilter * Instance(void);
+
+  // Returns true to keep the event
+  typedef std::function<bool (const GHepRecord *)> Filter_t;
+
+  // Set the filter, evaluated after the processing step run by the named
+  // EventRecordVisitorI (algorithm name, e.g. "genie::PrimaryLeptonGenerator"
+  // or algorithm key, e.g. "genie::CCQEPrimaryLeptonGenerator/Default").
+  // Resets the counters
+  void Set       (Filter_t filter, string after_module);
+  void Unset     (void);
+  bool IsEnabled (void) const { return (bool) fFilter; }
+
+  // Called by the event generation threads after each processing step:
+  // Returns false if the event was tested and rejected
+  bool Apply (const GHepRecord * event, string module_name,
+              string module_key);
+
+  // Counters
+  long   NTested     (void) const;
+  long   NRejected   (void) const;
+  double Efficiency  (void) const;  ///< fraction of tested events kept (1 if none tested)
+  void   Reset       (void);
+
+private:
+  EVGEventFilter();
+  EVGEventFilter(const EVGEventFilter & filter);
+  virtual ~EVGEventFilter();
+
+  Filter_t              fFilter;       ///< the filter
+  string                fAfterModule;  ///< name or key of the module to run the filter after
+  long                  fNTested;      ///< number of events tested
+  long                  fNRejected;    ///< number of events rejected
+  mutable std::mutex    fMutex;
+
+  static EVGEventFilter * fInstance;
+
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (EVGEventFilter::fInstance !=0) {
+            delete EVGEventFilter::fInstance;
+            EVGEventFilter::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+}      // genie namespace
+
+#endif // _EVG_EVENT_FILTER_H_
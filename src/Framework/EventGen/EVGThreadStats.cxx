@@ -0,0 +1,254 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+
+#include <TFile.h>
+#include <TTree.h>
+
+#include "Framework/EventGen/EVGThreadStats.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/RunOpt.h"
+
+using std::endl;
+using std::setw;
+using std::ofstream;
+using std::ostringstream;
+
+using namespace genie;
+
+//____________________________________________________________________________
+namespace genie {
+  ostream & operator << (ostream & stream, const EVGThreadStats & stats)
+  {
+    stats.Print(stream);
+    return stream;
+  }
+}
+//____________________________________________________________________________
+EVGThreadStats * EVGThreadStats::fInstance = 0;
+//____________________________________________________________________________
+EVGThreadStats::EVGThreadStats()
+{
+  fInstance = 0;
+  fEnabled  = ! RunOpt::Instance()->EVGStatsFile().empty();
+}
+//____________________________________________________________________________
+EVGThreadStats::~EVGThreadStats()
+{
+  fEntries.clear();
+  fInstance = 0;
+}
+//____________________________________________________________________________
+EVGThreadStats * EVGThreadStats::Instance()
+{
+  static std::mutex init_mutex;
+  std::lock_guard<std::mutex> lock(init_mutex);
+
+  if(fInstance == 0) {
+    static EVGThreadStats::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+    fInstance = new EVGThreadStats;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+EVGThreadStats::Entry & EVGThreadStats::GetEntry(
+   string thread, int step, string module, int probe_pdg, int tgt_pdg)
+{
+// Caller must hold fMutex
+
+  ostringstream key;
+  key << thread << ";" << step << ";" << module
+      << ";" << probe_pdg << ";" << tgt_pdg;
+
+  map<string, Entry>::iterator it = fEntries.find(key.str());
+  if(it != fEntries.end()) return it->second;
+
+  Entry & e = fEntries[key.str()];
+  e.Thread   = thread;
+  e.Step     = step;
+  e.Module   = module;
+  e.ProbePdg = probe_pdg;
+  e.TgtPdg   = tgt_pdg;
+  e.NCalls   = 0;
+  e.NRetries = 0;
+  e.RealTime = 0;
+  e.CpuTime  = 0;
+  return e;
+}
+//____________________________________________________________________________
+void EVGThreadStats::AddModuleCall(
+   string thread, int step, string module, int probe_pdg, int tgt_pdg,
+   double real, double cpu)
+{
+  if(!fEnabled) return;
+
+  std::lock_guard<std::mutex> lock(fMutex);
+  Entry & e = this->GetEntry(thread, step, module, probe_pdg, tgt_pdg);
+  e.NCalls++;
+  e.RealTime += real;
+  e.CpuTime  += cpu;
+}
+//____________________________________________________________________________
+void EVGThreadStats::AddRetry(
+   string thread, int step, string module, int probe_pdg, int tgt_pdg)
+{
+  if(!fEnabled) return;
+
+  std::lock_guard<std::mutex> lock(fMutex);
+  Entry & e = this->GetEntry(thread, step, module, probe_pdg, tgt_pdg);
+  e.NRetries++;
+}
+//____________________________________________________________________________
+void EVGThreadStats::AddThreadCall(
+   string thread, int probe_pdg, int tgt_pdg, double real, double cpu)
+{
+  this->AddModuleCall(thread, -1, thread, probe_pdg, tgt_pdg, real, cpu);
+}
+//____________________________________________________________________________
+void EVGThreadStats::Reset(void)
+{
+  std::lock_guard<std::mutex> lock(fMutex);
+  fEntries.clear();
+}
+//____________________________________________________________________________
+vector<EVGThreadStats::Entry> EVGThreadStats::Entries(void) const
+{
+  std::lock_guard<std::mutex> lock(fMutex);
+
+  vector<Entry> entries;
+  entries.reserve(fEntries.size());
+  map<string, Entry>::const_iterator it = fEntries.begin();
+  for( ; it != fEntries.end(); ++it) entries.push_back(it->second);
+  return entries;
+}
+//____________________________________________________________________________
+void EVGThreadStats::Print(ostream & stream) const
+{
+  std::lock_guard<std::mutex> lock(fMutex);
+
+  stream << "\n[-] Event generation thread statistics:";
+  if(fEntries.empty()) {
+    stream << " (none)" << endl;
+    return;
+  }
+
+  map<string, Entry>::const_iterator it = fEntries.begin();
+  for( ; it != fEntries.end(); ++it) {
+    const Entry & e = it->second;
+    stream << "\n |-> " << e.Thread
+           << " [probe: " << e.ProbePdg << ", target: " << e.TgtPdg << "] ";
+    if(e.Step < 0) stream << "(all steps)";
+    else           stream << "step " << e.Step << ": " << e.Module;
+    stream << "\n |      calls: "   << setw(10) << e.NCalls
+           << ", retries: "         << setw(8)  << e.NRetries
+           << ", wall time: "       << e.RealTime << " s"
+           << ", cpu time: "        << e.CpuTime  << " s";
+  }
+  stream << endl;
+}
+//____________________________________________________________________________
+bool EVGThreadStats::Save(string filename) const
+{
+  if(filename.empty()) return false;
+
+  bool is_root = filename.size() > 5 &&
+                 filename.compare(filename.size()-5, 5, ".root") == 0;
+
+  bool ok = (is_root) ? this->SaveAsTree(filename) : this->SaveAsJson(filename);
+  if(ok) {
+    LOG("EVGThreadStats", pNOTICE)
+       << "Saved event generation thread statistics in: " << filename;
+  } else {
+    LOG("EVGThreadStats", pERROR)
+       << "Couldn't save event generation thread statistics in: " << filename;
+  }
+  return ok;
+}
+//____________________________________________________________________________
+bool EVGThreadStats::SaveAsTree(string filename) const
+{
+  TFile file(filename.c_str(), "RECREATE");
+  if(file.IsZombie()) return false;
+
+  TTree * tree = new TTree("evgstats", "GENIE event generation thread stats");
+
+  char   thread[512];
+  char   module[512];
+  int    step, probe, tgt;
+  long   ncalls, nretries;
+  double real, cpu;
+
+  tree->Branch("thread",   thread,    "thread/C");
+  tree->Branch("step",     &step,     "step/I");
+  tree->Branch("module",   module,    "module/C");
+  tree->Branch("probe",    &probe,    "probe/I");
+  tree->Branch("tgt",      &tgt,      "tgt/I");
+  tree->Branch("ncalls",   &ncalls,   "ncalls/L");
+  tree->Branch("nretries", &nretries, "nretries/L");
+  tree->Branch("realtime", &real,     "realtime/D");
+  tree->Branch("cputime",  &cpu,      "cputime/D");
+
+  std::lock_guard<std::mutex> lock(fMutex);
+
+  map<string, Entry>::const_iterator it = fEntries.begin();
+  for( ; it != fEntries.end(); ++it) {
+    const Entry & e = it->second;
+    strncpy(thread, e.Thread.c_str(), sizeof(thread)-1);
+    strncpy(module, e.Module.c_str(), sizeof(module)-1);
+    thread[sizeof(thread)-1] = 0;
+    module[sizeof(module)-1] = 0;
+    step     = e.Step;
+    probe    = e.ProbePdg;
+    tgt      = e.TgtPdg;
+    ncalls   = e.NCalls;
+    nretries = e.NRetries;
+    real     = e.RealTime;
+    cpu      = e.CpuTime;
+    tree->Fill();
+  }
+
+  tree->Write();
+  file.Close();
+  return true;
+}
+//____________________________________________________________________________
+bool EVGThreadStats::SaveAsJson(string filename) const
+{
+  ofstream out(filename.c_str());
+  if(!out.is_open()) return false;
+
+  std::lock_guard<std::mutex> lock(fMutex);
+
+  out << "{\n  \"evgstats\": [";
+  map<string, Entry>::const_iterator it = fEntries.begin();
+  for( ; it != fEntries.end(); ++it) {
+    const Entry & e = it->second;
+    if(it != fEntries.begin()) out << ",";
+    out << "\n    { \"thread\": \""  << e.Thread   << "\""
+        << ", \"step\": "            << e.Step
+        << ", \"module\": \""        << e.Module   << "\""
+        << ", \"probe\": "           << e.ProbePdg
+        << ", \"tgt\": "             << e.TgtPdg
+        << ", \"ncalls\": "          << e.NCalls
+        << ", \"nretries\": "        << e.NRetries
+        << ", \"realtime\": "        << e.RealTime
+        << ", \"cputime\": "         << e.CpuTime
+        << " }";
+  }
+  out << "\n  ]\n}\n";
+  out.close();
+  return true;
+}
+//____________________________________________________________________________
@@ -0,0 +1,121 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::EVGThreadStats
+
+\brief    Collects per-module timing and counters for the event generation
+          threads (EventGenerator objects) run in a job.
+
+          For every EventRecordVisitorI step of every EventGenerator, and for
+          every probe / target combination, it keeps the number of calls,
+          the number of EVGThreadExceptions thrown (retries) and the summed
+          wall and cpu time. An extra entry (step -1) holds the totals for
+          the whole thread.
+
+          Collection is off by default. It is switched on either explicitly,
+          via Enable(), or with the --evg-stats command-line option (see
+          RunOpt). The collected statistics can be printed or saved, at the
+          end of the job, in a ROOT tree (file names ending in `.root') or
+          in JSON format (any other file name).
+
+          Updates are serialized so that the class can be used from several
+          event generation threads.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _EVG_THREAD_STATS_H_
+#define _EVG_THREAD_STATS_H_
+
+#include <iostream>
+#include <string>
+#include <map>
+#include <vector>
+#include <mutex>
+
+using std::ostream;
+using std::string;
+using std::map;
+using std::vector;
+
+namespace genie {
+
+class EVGThreadStats;
+ostream & operator << (ostream & stream, const EVGThreadStats & stats);
+
+class EVGThreadStats
+{
+public:
+  static EVGThreadStats * Instance(void);
+
+  // Statistics entry for a single (thread, step, module, probe, target)
+  struct Entry {
+    string Thread;
+    int    Step;
+    string Module;
+    int    ProbePdg;
+    int    TgtPdg;
+    long   NCalls;
+    long   NRetries;
+    double RealTime; // sec
+    double CpuTime;  // sec
+  };
+
+  void Enable    (bool on = true) { fEnabled = on;   }
+  bool IsEnabled (void) const     { return fEnabled; }
+
+  // Called by the event generation threads
+  void AddModuleCall (string thread, int step, string module,
+                      int probe_pdg, int tgt_pdg, double real, double cpu);
+  void AddRetry      (string thread, int step, string module,
+                      int probe_pdg, int tgt_pdg);
+  void AddThreadCall (string thread,
+                      int probe_pdg, int tgt_pdg, double real, double cpu);
+
+  // Access / output
+  unsigned int  NEntries (void) const { return fEntries.size(); }
+  vector<Entry> Entries  (void) const; ///< a snapshot of all entries
+  void Reset (void);
+  void Print (ostream & stream) const;
+  bool Save  (string filename) const;
+
+  friend ostream & operator << (ostream & stream, const EVGThreadStats & stats);
+
+private:
+  EVGThreadStats();
+  EVGThreadStats(const EVGThreadStats & stats);
+  virtual ~EVGThreadStats();
+
+  Entry & GetEntry (string thread, int step, string module,
+                    int probe_pdg, int tgt_pdg);
+  bool SaveAsTree  (string filename) const;
+  bool SaveAsJson  (string filename) const;
+
+  bool                  fEnabled;
+  map<string, Entry>    fEntries;  ///< entries keyed by thread/step/module/probe/target
+  mutable std::mutex    fMutex;
+
+  static EVGThreadStats * fInstance;
+
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (EVGThreadStats::fInstance !=0) {
+            delete EVGThreadStats::fInstance;
+            EVGThreadStats::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+}      // genie namespace
+
+#endif // _EVG_THREAD_STATS_H_
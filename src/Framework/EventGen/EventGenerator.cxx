@@ -24,10 +24,14 @@
 #include "Framework/EventGen/EventGenerator.h"
 #include "Framework/EventGen/InteractionListGeneratorI.h"
 #include "Framework/EventGen/EVGThreadException.h"
+#include "Framework/EventGen/EVGThreadStats.h"
+#include "Framework/EventGen/EVGEventFilter.h"
+#include "Framework/EventGen/EVGAltXSecWeights.h"
 #include "Framework/EventGen/GVldContext.h"
 #include "Framework/GHEP/GHepVirtualListFolder.h"
 #include "Framework/GHEP/GHepRecord.h"
 #include "Framework/GHEP/GHepFlags.h"
+#include "Framework/Interaction/Interaction.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Utils/PrintUtils.h"
 
@@ -81,6 +85,22 @@ void EventGenerator::ProcessEventRecord(GHepRecord * event_rec) const
   //-- Reset stop-watch
   fWatch->Reset();
 
+  //-- Per-module statistics (only if enabled)
+  EVGThreadStats * stats = EVGThreadStats::Instance();
+  bool collect_stats = stats->IsEnabled();
+  string thread = this->Id().Key();
+  int probe_pdg = 0, tgt_pdg = 0;
+  if(collect_stats && event_rec->Summary()) {
+    const InitialState & init_state = event_rec->Summary()->InitState();
+    probe_pdg = init_state.ProbePdg();
+    tgt_pdg   = init_state.Tgt().Pdg();
+  }
+  double thread_real = 0, thread_cpu = 0;
+
+  //-- Early-exit event filter (only if set)
+  EVGEventFilter * filter = EVGEventFilter::Instance();
+  bool apply_filter = filter->IsEnabled();
+
   string mesgh = "Event generation thread: " + this->Id().Key() + 
                  " -> Running module: ";
 
@@ -108,9 +128,32 @@ void EventGenerator::ProcessEventRecord(GHepRecord * event_rec) const
       fWatch->Stop();
       fRecHistory.AddSnapshot(istep, event_rec);
       (*fEVGTime)[istep] = fWatch->CpuTime(); // sec
+      if(collect_stats) {
+        stats->AddModuleCall(thread, istep, visitor->Id().Key(),
+           probe_pdg, tgt_pdg, fWatch->RealTime(), fWatch->CpuTime());
+        thread_real += fWatch->RealTime();
+        thread_cpu  += fWatch->CpuTime();
+      }
+      if(apply_filter && !filter->Apply(event_rec,
+                           visitor->Id().Name(), visitor->Id().Key())) {
+        LOG("EventGenerator", pNOTICE)
+           << "The event was rejected by the event filter - Skipping the "
+           << "remaining processing steps";
+        event_rec->EventFlags()->SetBitNumber(kFilteredOut, true);
+        ffwd = true;
+      }
     }
     catch (EVGThreadException exception)
     {
+      fWatch->Stop();
+      if(collect_stats) {
+        stats->AddModuleCall(thread, istep, visitor->Id().Key(),
+           probe_pdg, tgt_pdg, fWatch->RealTime(), fWatch->CpuTime());
+        stats->AddRetry(thread, istep, visitor->Id().Key(), probe_pdg, tgt_pdg);
+        thread_real += fWatch->RealTime();
+        thread_cpu  += fWatch->CpuTime();
+      }
+
       LOG("EventGenerator", pNOTICE)
            << "An exception was thrown and caught by EventGenerator!";
       LOG("EventGenerator", pNOTICE) << exception;
@@ -176,6 +219,17 @@ void EventGenerator::ProcessEventRecord(GHepRecord * event_rec) const
     istep++;
   }
 
+  if(collect_stats) {
+    stats->AddThreadCall(thread, probe_pdg, tgt_pdg, thread_real, thread_cpu);
+  }
+
+  //-- Weights for alternative xsec model configurations (only if requested),
+  //   while the interaction summary is still in memory
+  EVGAltXSecWeights * altw = EVGAltXSecWeights::Instance();
+  if(altw->IsEnabled() && !event_rec->EventFlags()->TestBitNumber(kFilteredOut)) {
+    altw->Compute(event_rec, fXSecModel);
+  }
+
   LOG("EventGenerator", pNOTICE)
               << utils::print::PrintFramedMesg("Thread Summary",0,'*');
   LOG("EventGenerator", pNOTICE)
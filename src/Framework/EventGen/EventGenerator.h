@@ -50,6 +50,9 @@ public :
   const InteractionListGeneratorI * IntListGenerator (void) const;
   const XSecAlgorithmI *            CrossSectionAlg  (void) const;
 
+  //-- the event record processing modules, in processing order
+  const vector<const EventRecordVisitorI *> & Modules (void) const { return *fEVGModuleVec; }
+
   //-- override the Algorithm::Configure methods to load configuration
   //   data to private data members
   void Configure (const Registry & config);
@@ -29,6 +29,7 @@
 #include "Framework/EventGen/InteractionList.h"
 #include "Framework/EventGen/InteractionListGeneratorI.h"
 #include "Framework/EventGen/InteractionGeneratorMap.h"
+#include "Framework/EventGen/XSecChannelTable.h"
 #include "Framework/EventGen//RunningThreadInfo.h"
 #include "Framework/GHEP/GHepFlags.h"
 #include "Framework/Interaction/Interaction.h"
@@ -39,6 +40,7 @@
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/Utils/XSecSplineList.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/StartupProfiler.h"
 
 using std::ostringstream;
 
@@ -91,6 +93,9 @@ void GEVGDriver::Init(void)
   // depths
   fNRecLevel = 0;
 
+  // the start-up profile (if enabled) is reported at the first event
+  fFirstEvent = true;
+
   // an "interaction" -> "generator" associative contained built for all
   // simulated interactions (from the loaded Event Generators and for the
   // input initial state)
@@ -155,6 +160,8 @@ void GEVGDriver::Configure(const InitialState & is)
   LOG("GEVGDriver", pNOTICE)
         << utils::print::PrintFramedMesg(mesg.str(), 0, '*');
 
+  StartupTimer timer("GEVGDriver::Configure [" + init_state.AsString() + "]");
+
   this -> BuildInitialState            (init_state);
   this -> BuildGeneratorList           ();
   this -> BuildInteractionGeneratorMap ();
@@ -227,22 +234,28 @@ void GEVGDriver::SetUnphysEventMask(const TBits & mask)
 //___________________________________________________________________________
 EventRecord * GEVGDriver::GenerateEvent(const TLorentzVector & nu4p)
 {
-  //-- Build initial state information from inputs
-  LOG("GEVGDriver", pINFO) << "Creating the initial state";
-  InitialState init_state(*fInitState);
-  init_state.SetProbeP4(nu4p);
+  return this->GenerateEvent(nu4p, 0);
+}
+//___________________________________________________________________________
+EventRecord * GEVGDriver::GenerateEvent(
+                       const TLorentzVector & nu4p, EventRecord * reuse)
+{
+  if(fFirstEvent) {
+    StartupProfiler::Instance()->Report();
+    fFirstEvent = false;
+  }
 
   //-- Select the interaction to be generated (amongst the entries of the
   //   InteractionList assembled by the EventGenerators) and bootstrap the
   //   event record
   LOG("GEVGDriver", pINFO)
      << "Selecting an Interaction & Bootstraping the EventRecord";
-  fCurrentRecord = fIntSelector->SelectInteraction(fIntGenMap, nu4p);
+  fCurrentRecord = fIntSelector->SelectInteraction(fIntGenMap, nu4p, reuse);
 
   if(!fCurrentRecord) {
      LOG("GEVGDriver", pWARN)
          << "No interaction could be selected for: "
-         << init_state.AsString() << " at E = " << nu4p.E() << " GeV";
+         << fInitState->AsString() << " at E = " << nu4p.E() << " GeV";
      return 0;
   }
 
@@ -276,11 +289,13 @@ EventRecord * GEVGDriver::GenerateEvent(const TLorentzVector & nu4p)
   //
   //   (note: use of the 'Visitor' Design Pattern)
 
-  string mesg = "Requesting from event generation thread: " +
-         evgen->Id().Key() + " to generate the selected interaction";
+  if(LOG_ENABLED("GEVGDriver", pNOTICE)) {
+    string mesg = "Requesting from event generation thread: " +
+           evgen->Id().Key() + " to generate the selected interaction";
 
-  LOG("GEVGDriver", pNOTICE)
-         << utils::print::PrintFramedMesg(mesg,1,'=');
+    LOG("GEVGDriver", pNOTICE)
+           << utils::print::PrintFramedMesg(mesg,1,'=');
+  }
 
   fCurrentRecord->SetUnphysEventMask(*fUnphysEventMask);
   evgen->ProcessEventRecord(fCurrentRecord);
@@ -291,6 +306,17 @@ EventRecord * GEVGDriver::GenerateEvent(const TLorentzVector & nu4p)
   //   been set, error conditions may be ignored so that the
   //   requested classes of unphysical events can be passed-through.
 
+  //-- Events rejected by the early-exit event filter (see EVGEventFilter)
+  //   are dropped rather than regenerated
+
+  if(fCurrentRecord->EventFlags()->TestBitNumber(kFilteredOut)) {
+     LOG("GEVGDriver", pINFO) << "The event was rejected by the event filter";
+     if(fCurrentRecord != reuse) delete fCurrentRecord;
+     fCurrentRecord = 0;
+     fNRecLevel = 0;
+     return 0;
+  }
+
   bool unphys = fCurrentRecord->IsUnphysical();
   if(!unphys) {
      LOG("GEVGDriver", pINFO) << "Returning the current event!";
@@ -309,19 +335,18 @@ EventRecord * GEVGDriver::GenerateEvent(const TLorentzVector & nu4p)
      } else {
        LOG("GEVGDriver", pWARN)
           << "The generated unphysical event is rejected";
-       delete fCurrentRecord;
+       if(fCurrentRecord != reuse) delete fCurrentRecord;
        fCurrentRecord = 0;
        fNRecLevel++; // increase the nested level counter
 
        if(fNRecLevel<=kRecursiveModeMaxDepth) {
           LOG("GEVGDriver", pWARN)
             << "Attempting to regenerate the event...";
-          return this->GenerateEvent(nu4p);
+          return this->GenerateEvent(nu4p, reuse);
        } else {
           LOG("GEVGDriver", pERROR)
                << "Could not produce a physical event after "
                       << kRecursiveModeMaxDepth << " attempts!";
-          delete fCurrentRecord;
           fCurrentRecord = 0;
           fNRecLevel = 0;
           return 0;
@@ -485,6 +510,27 @@ void GEVGDriver::CreateXSecSumSpline(
   delete [] xsec;
 }
 //___________________________________________________________________________
+void GEVGDriver::AdoptXSecSumSpline(Spline * spl)
+{
+  if (fXSecSumSpl && fXSecSumSpl != spl) delete fXSecSumSpl;
+  fXSecSumSpl = spl;
+}
+//___________________________________________________________________________
+bool GEVGDriver::CreateChannelTable(
+                               int nk, double Emin, double Emax, bool inlogE)
+{
+  // the table is built from the xsec splines of all the interactions
+  // (returns false if any is missing)
+  XSecChannelTable * table = new XSecChannelTable;
+  if(!table->Build(*fIntGenMap, nk, Emin, Emax, inlogE)) {
+     delete table;
+     fIntGenMap->AdoptChannelTable(0);
+     return false;
+  }
+  fIntGenMap->AdoptChannelTable(table);
+  return true;
+}
+//___________________________________________________________________________
 const Spline * GEVGDriver::XSecSpline(const Interaction * interaction) const
 {
 // Returns the cross section spline for the input interaction as was
@@ -505,6 +551,41 @@ const Spline * GEVGDriver::XSecSpline(const Interaction * interaction) const
   return spl;
 }
 //___________________________________________________________________________
+void GEVGDriver::SplineKeys(set<string> & keys) const
+{
+  if(!fIntGenMap) return;
+
+  XSecSplineList * xssl = XSecSplineList::Instance();
+
+  const InteractionList & ilst = fIntGenMap->GetInteractionList();
+  InteractionList::const_iterator intliter = ilst.begin();
+  for( ; intliter != ilst.end(); ++intliter) {
+     const Interaction * interaction = *intliter;
+     const EventGeneratorI * evgen = fIntGenMap->FindGenerator(interaction);
+     if(!evgen) continue;
+     const XSecAlgorithmI * alg = evgen->CrossSectionAlg();
+     keys.insert(xssl->BuildSplineKey(alg, interaction));
+     // and the free nucleon spline a nuclear spline may be derived from
+     if(xssl->CanDeriveSpline(alg, interaction)) {
+       Interaction * free_nucleon = xssl->FreeNucleonInteraction(interaction);
+       keys.insert(xssl->BuildSplineKey(alg, free_nucleon));
+       delete free_nucleon;
+     }
+  }
+}
+//___________________________________________________________________________
+size_t GEVGDriver::MemoryFootprint(void) const
+{
+  size_t bytes = sizeof(GEVGDriver);
+  if(fXSecSumSpl) bytes += fXSecSumSpl->MemoryFootprint();
+  if(fIntGenMap) {
+    bytes += fIntGenMap->GetInteractionList().size() * sizeof(Interaction);
+    const XSecChannelTable * table = fIntGenMap->ChannelTable();
+    if(table) bytes += table->MemoryFootprint();
+  }
+  return bytes;
+}
+//___________________________________________________________________________
 void GEVGDriver::UseSplines(void)
 {
 // Instructs the driver to use cross section splines rather than computing
@@ -574,11 +655,12 @@ void GEVGDriver::UseSplines(void)
   }//use-splines?
 }
 //___________________________________________________________________________
-void GEVGDriver::CreateSplines(int nknots, double emax, bool useLogE)
+void GEVGDriver::CreateSplines(
+   int nknots, double emax, bool useLogE, SplineFilter_t filter)
 {
 // Creates all the cross section splines that are needed by this driver.
 // It will check for pre-loaded splines and it will skip the creation of the
-// splines it already finds loaded.
+// splines it already finds loaded, or the ones rejected by the input filter.
 
   LOG("GEVGDriver", pINFO)
        << "Creating (missing) splines with [UseLogE: "
@@ -602,38 +684,16 @@ void GEVGDriver::CreateSplines(int nknots, double emax, bool useLogE)
      // ask the event generator to produce a list of all interaction it can
      // generate for the input initial state
      const InteractionListGeneratorI * ilstgen = evgen->IntListGenerator();
-     InteractionList * ilst = ilstgen->CreateInteractionList(*fInitState);
+     InteractionList * ilst =
+         ilstgen->CreateInteractionListFromTemplate(*fInitState);
      if(!ilst) continue;
 
      // total cross section algorithm used by the current EventGenerator
      const XSecAlgorithmI * alg = evgen->CrossSectionAlg();
 
-     // get the energy range of the spline from the EventGenerator
-     // validity context
-     double Emin = TMath::Max(0.001,evgen->ValidityContext().Emin());
-     double Emax = evgen->ValidityContext().Emax();
-
-     // if the user set a maximum energy, create the spline up to this
-     // energy - otherwise use the upper limit of the validity range of
-     // the current generator
-     if ( emax > 0 ) {
-       if ( emax > Emax ) {
-         LOG("GEVGDriver", pWARN)
-           << "Refusing to exceed validity range: Emax = " << Emax;
-       }
-       emax = TMath::Min(emax,Emax); // don't exceed validity range
-     } else {
-       emax = Emax;
-     }
-
-     assert( emax > Emin );
-
-     // number of knots: use specified number. If not set, use 15 knots
-     // per decade. Don't use less than 30 knots.
-     if ( nknots < 0 ) {
-       nknots = (int) (15 * TMath::Log10(emax-Emin));
-     }
-     nknots = TMath::Max(nknots,30);
+     // energy range & number of knots of the splines
+     double Emin = 0;
+     this->SplineKnots(evgen, nknots, Emin, emax);
 
      // loop over all interactions that can be generated and ask the
      // appropriate cross section algorithm to compute its cross section
@@ -647,14 +707,32 @@ void GEVGDriver::CreateSplines(int nknots, double emax, bool useLogE)
 
          // only create the spline if it does not already exists
          bool spl_exists = xsl->SplineExists(alg, interaction);
-         if(!spl_exists) {
+
+         // splines derived from free nucleon splines: build the free nucleon
+         // spline instead (the nuclear one is derived when queried)
+         Interaction * free_nucleon = 0;
+         if(!spl_exists && xsl->CanDeriveSpline(alg, interaction)) {
+             free_nucleon = xsl->FreeNucleonInteraction(interaction);
+         }
+         Interaction * spl_interaction = free_nucleon ? free_nucleon : interaction;
+
+         if(!spl_exists && filter && !filter(spl_interaction)) {
+             SLOG("GEVGDriver", pDEBUG)
+               << "The spline is built by another job - Skipping";
+         } else if(!spl_exists) {
              SLOG("GEVGDriver", pDEBUG)
                << "The spline wasn't loaded at initialization. "
                << "I can build it now but it might take a while...";
-             xsl->CreateSpline(alg, interaction, nknots, Emin, emax);
+             if(free_nucleon) {
+               SLOG("GEVGDriver", pINFO)
+                 << "Building the free nucleon spline for "
+                 << free_nucleon->AsString() << " (" << code << " is derived from it)";
+             }
+             xsl->CreateSpline(alg, spl_interaction, nknots, Emin, emax);
          } else {
              SLOG("GEVGDriver", pDEBUG) << "Spline was found";
          }
+         delete free_nucleon;
      } // loop over interaction that can be generated by this generator
      delete ilst;
      ilst = 0;
@@ -665,6 +743,94 @@ void GEVGDriver::CreateSplines(int nknots, double emax, bool useLogE)
   fUseSplines = true;
 }
 //___________________________________________________________________________
+int GEVGDriver::RemoveStaleSplines(int nknots, double emax, bool useLogE)
+{
+// Follows CreateSplines(): the splines are compared with the ones it would
+// build for the same arguments
+
+  XSecSplineList * xsl = XSecSplineList::Instance();
+  xsl->SetLogE(useLogE);
+
+  int nremoved = 0;
+
+  EventGeneratorList::const_iterator evgliter = fEvGenList->begin();
+  for( ; evgliter != fEvGenList->end(); ++evgliter) {
+     const EventGeneratorI * evgen = *evgliter;
+     InteractionList * ilst =
+         evgen->IntListGenerator()->CreateInteractionListFromTemplate(*fInitState);
+     if(!ilst) continue;
+
+     const XSecAlgorithmI * alg = evgen->CrossSectionAlg();
+
+     double Emin = 0;
+     this->SplineKnots(evgen, nknots, Emin, emax);
+
+     InteractionList::const_iterator intliter = ilst->begin();
+     for( ; intliter != ilst->end(); ++intliter) {
+         Interaction * interaction = *intliter;
+         if(!xsl->SplineExists(alg, interaction)) continue;
+
+         // derived splines are as current as the free nucleon spline
+         Interaction * free_nucleon = 0;
+         if(xsl->IsDerivedSpline(xsl->BuildSplineKey(alg, interaction))) {
+             free_nucleon = xsl->FreeNucleonInteraction(interaction);
+         }
+         Interaction * spl_interaction = free_nucleon ? free_nucleon : interaction;
+
+         if(!xsl->SplineIsCurrent(alg, spl_interaction, nknots, Emin, emax)) {
+           SLOG("GEVGDriver", pNOTICE)
+             << "The spline for " << spl_interaction->AsString()
+             << " (algorithm: " << alg->Id().Key() << ") was built with a different "
+             << "configuration" << (xsl->SplineConfigHash(alg, spl_interaction).empty() ?
+                                    " or an unknown one" : "");
+           xsl->RemoveSpline(alg, spl_interaction);
+           if(free_nucleon) xsl->RemoveSpline(alg, interaction);
+           nremoved++;
+         }
+         delete free_nucleon;
+     }
+     delete ilst;
+  }
+
+  return nremoved;
+}
+//___________________________________________________________________________
+void GEVGDriver::SplineKnots(const EventGeneratorI * evgen,
+                        int & nknots, double & emin, double & emax) const
+{
+// Energy range and number of knots of the splines built for the interactions
+// of the input generator. The input nknots and emax are as given to
+// CreateSplines() and are updated in place, as they carry over to the next
+// generators of the list.
+
+  // get the energy range of the spline from the EventGenerator
+  // validity context
+  emin = TMath::Max(0.001,evgen->ValidityContext().Emin());
+  double Emax = evgen->ValidityContext().Emax();
+
+  // if the user set a maximum energy, create the spline up to this
+  // energy - otherwise use the upper limit of the validity range of
+  // the current generator
+  if ( emax > 0 ) {
+    if ( emax > Emax ) {
+      LOG("GEVGDriver", pWARN)
+        << "Refusing to exceed validity range: Emax = " << Emax;
+    }
+    emax = TMath::Min(emax,Emax); // don't exceed validity range
+  } else {
+    emax = Emax;
+  }
+
+  assert( emax > emin );
+
+  // number of knots: use specified number. If not set, use 15 knots
+  // per decade. Don't use less than 30 knots.
+  if ( nknots < 0 ) {
+    nknots = (int) (15 * TMath::Log10(emax-emin));
+  }
+  nknots = TMath::Max(nknots,30);
+}
+//___________________________________________________________________________
 Range1D_t GEVGDriver::ValidEnergyRange(void) const
 {
 // loops over all loaded event generation threads, queries for the energy
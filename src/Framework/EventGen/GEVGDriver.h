@@ -26,6 +26,8 @@
 
 #include <ostream>
 #include <string>
+#include <functional>
+#include <set>
 
 #include <TLorentzVector.h>
 #include <TBits.h>
@@ -34,6 +36,7 @@
 
 using std::ostream;
 using std::string;
+using std::set;
 
 namespace genie {
 
@@ -70,6 +73,10 @@ public :
 
   // Generate single event
   EventRecord * GenerateEvent (const TLorentzVector & nu4p);
+  // Generate single event in the (caller-owned) input event record,
+  // recycling its allocated particles, flags & summary. Returns the input
+  // record on success, 0 otherwise (the record is left owned by the caller)
+  EventRecord * GenerateEvent (const TLorentzVector & nu4p, EventRecord * reuse);
 
   // Get the list of all interactions that can be simulated for the specified
   // initial state (depends on which event generation threads were loaded into
@@ -87,12 +94,37 @@ public :
   const Spline * XSecSumSpline       (void) const { return fXSecSumSpl; }
   const Spline * XSecSpline          (const Interaction * interaction) const;
 
-  // Instruct the driver to create all the splines it needs
-  void CreateSplines (int nknots=-1, double emax=-1, bool inLogE=true);
+  // Instruct the driver to create all the splines it needs.
+  // An optional filter, called for each missing spline in a fixed order,
+  // selects the splines to be built by this job and allows the spline
+  // building work to be distributed across several jobs or processes.
+  typedef std::function<bool (const Interaction *)> SplineFilter_t;
+  void CreateSplines (int nknots=-1, double emax=-1, bool inLogE=true,
+                      SplineFilter_t filter = SplineFilter_t());
+
+  // Remove the loaded splines that CreateSplines(), with the same arguments,
+  // would not build identically any more: those whose configuration hash (see
+  // XSecSplineList::ConfigHash()) differs from the current one, or is unknown.
+  // Returns the number of splines removed.
+  int  RemoveStaleSplines (int nknots=-1, double emax=-1, bool inLogE=true);
+
+  // Add the keys (see XSecSplineList::BuildSplineKey()) of the xsec splines
+  // of all interactions simulated by this driver to the input set
+  void SplineKeys (set<string> & keys) const;
+
+  // Approximate memory held by the driver (interaction list, total xsec
+  // spline & channel table), in bytes. Excludes the shared xsec splines
+  size_t MemoryFootprint (void) const;
 
   // Methods used for building the 'total' cross section spline
   double XSecSum             (const TLorentzVector & nup4);
   void   CreateXSecSumSpline (int nk, double Emin, double Emax, bool inlogE=true);
+  void   AdoptXSecSumSpline  (Spline * spl); ///< eg a spline saved by an earlier job
+
+  // Tabulate the cumulative cross sections of all simulated interactions at
+  // nk energies in [Emin, Emax] (nk=1: at Emin only), so that interactions
+  // can be selected without evaluating every xsec spline (see XSecChannelTable)
+  bool   CreateChannelTable  (int nk, double Emin, double Emax, bool inlogE=true);
 
   // Get validity range (combined validity range of loaded evg threads)
   Range1D_t ValidEnergyRange (void) const;
@@ -113,6 +145,8 @@ private:
   void BuildInteractionGeneratorMap (void);
   void BuildInteractionSelector     (void);
   void AssertIsValidInitState       (void) const;
+  void SplineKnots                  (const EventGeneratorI * evgen,
+                                     int & nknots, double & emin, double & emax) const;
 
   // Private data members
   InitialState *            fInitState;       ///< initial state information for driver instance
@@ -125,6 +159,7 @@ private:
   Spline *                  fXSecSumSpl;      ///< sum{xsec(all interactions | this init state)}
   unsigned int              fNRecLevel;       ///< recursive mode depth counter
   string                    fEventGenList;    ///< list of event generators loaded by this driver (what used to be the $GEVGL setting)
+  bool                      fFirstEvent;      ///< no event generated yet? (start-up profile report)
 };
 
 }      // genie namespace
@@ -41,8 +41,44 @@ GEVGPool::~GEVGPool()
   }
 }
 //___________________________________________________________________________
+void GEVGPool::AddDriver(const InitialState & init, GEVGDriver * driver)
+{
+  this->insert( GEVGPool::value_type(init.AsString(), driver) );
+
+  Long64_t key = GEVGPool::DriverKey(init.ProbePdg(), init.TgtPdg());
+  fDriverIndex[key] = driver;
+
+  fHashIndex[init.Hash()] = driver;
+}
+//___________________________________________________________________________
+GEVGDriver * GEVGPool::FindDriver(int probe_pdg, int tgt_pdg) const
+{
+// Integer-keyed lookup, avoiding the InitialState::AsString() call and the
+// string comparisons of the string-keyed lookup. Falls back to the latter
+// for drivers that were inserted directly in the underlying map.
+
+  map<Long64_t, GEVGDriver *>::const_iterator it =
+       fDriverIndex.find( GEVGPool::DriverKey(probe_pdg, tgt_pdg) );
+  if(it != fDriverIndex.end()) return it->second;
+
+  InitialState init(tgt_pdg, probe_pdg);
+  return this->FindDriver(init);
+}
+//___________________________________________________________________________
+Long64_t GEVGPool::DriverKey(int probe_pdg, int tgt_pdg)
+{
+  return ( ((Long64_t) probe_pdg) << 32 ) | ( (Long64_t) (UInt_t) tgt_pdg );
+}
+//___________________________________________________________________________
 GEVGDriver * GEVGPool::FindDriver(const InitialState & init) const
 {
+// Hash-keyed lookup, falling back to the string-keyed one for drivers that
+// were inserted directly in the underlying map
+
+  std::unordered_map<uint64_t, GEVGDriver *>::const_iterator it =
+                                                 fHashIndex.find(init.Hash());
+  if(it != fHashIndex.end()) return it->second;
+
   string str_init = init.AsString();
 
   return this->FindDriver(str_init);
@@ -52,8 +88,8 @@ GEVGDriver * GEVGPool::FindDriver(string init) const
 {
   GEVGDriver * driver = 0;
 
-  if ( this->count(init) == 1 ) {
-    GEVGPool::const_iterator giter = this->find(init);
+  GEVGPool::const_iterator giter = this->find(init);
+  if ( giter != this->end() ) {
     driver = giter->second;
   } else {
      LOG("GEVGPool", pWARN)
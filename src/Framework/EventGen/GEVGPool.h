@@ -3,7 +3,9 @@
 
 \class   genie::GEVGPool
 
-\brief   A pool of GEVGDriver objects with an initial state key
+\brief   A pool of GEVGDriver objects with an initial state key.
+         Drivers added via AddDriver() are also indexed by a packed
+         (probe PDG, target PDG) integer key for fast per-neutrino lookups.
 
 \author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
  University of Liverpool & STFC Rutherford Appleton Laboratory
@@ -18,9 +20,13 @@
 #ifndef _GEVG_DRIVER_POOL_H_
 #define _GEVG_DRIVER_POOL_H_
 
+#include <cstdint>
 #include <map>
 #include <string>
 #include <ostream>
+#include <unordered_map>
+
+#include <Rtypes.h>
 
 using std::map;
 using std::string;
@@ -41,12 +47,21 @@ public :
   GEVGPool();
   ~GEVGPool();
 
+  void         AddDriver  (const InitialState & init, GEVGDriver * driver);
   GEVGDriver * FindDriver (const InitialState & init) const;
   GEVGDriver * FindDriver (string init)               const;
+  GEVGDriver * FindDriver (int probe_pdg, int tgt_pdg) const;
+
+  static Long64_t DriverKey (int probe_pdg, int tgt_pdg);
 
   void Print (ostream & stream) const;
 
   friend ostream & operator << (ostream & stream, const GEVGPool & pool);
+
+private:
+
+  map<Long64_t, GEVGDriver *>                fDriverIndex; ///< (probe, target) integer key -> driver
+  std::unordered_map<uint64_t, GEVGDriver *> fHashIndex;   ///< init state hash (see InitialState::Hash()) -> driver
 };
 
 }      // genie namespace
@@ -21,6 +21,7 @@
 #include <TObject.h>
 
 class TLorentzVector;
+class TDirectory;
 
 namespace genie {
 
@@ -46,6 +47,14 @@ public :
   virtual void                   Clear            (Option_t * opt   ) = 0; ///< reset state variables based on opt
   virtual void                   GenerateWeighted (bool gen_weighted) = 0; ///< set whether to generate weighted or unweighted neutrinos
 
+  //
+  // optional checkpoint / restart support: save / restore the driver's
+  // cursor & accumulators so that an interrupted job can be resumed
+  // (drivers that don't support it return false)
+  //
+  virtual bool                   SaveState     (TDirectory * /*dir*/) const { return false; }
+  virtual bool                   RestoreState  (TDirectory * /*dir*/)       { return false; }
+
 protected:
   GFluxI();
 };
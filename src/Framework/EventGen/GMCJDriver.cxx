@@ -9,10 +9,18 @@
 //____________________________________________________________________________
 
 #include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <set>
+#include <sstream>
 
 #include <TVector3.h>
 #include <TSystem.h>
 #include <TStopwatch.h>
+#include <TROOT.h>
+#include <TVectorD.h>
+#include <TObjString.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
 #include "Framework/Conventions/GBuild.h"
@@ -25,20 +33,50 @@
 #include "Framework/EventGen/GEVGPool.h"
 #include "Framework/EventGen/GFluxI.h"
 #include "Framework/EventGen/GeomAnalyzerI.h"
+#include "Framework/EventGen/InteractionList.h"
 #include "Framework/GHEP/GHepFlags.h"
 #include "Framework/GHEP/GHepParticle.h"
 #include "Framework/Interaction/InitialState.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Numerical/Spline.h"
+#include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/ParticleData/PDGUtils.h"
+#include "Framework/Utils/Cache.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/RunCounters.h"
+#include "Framework/Utils/RunOpt.h"
 #include "Framework/Utils/XSecSplineList.h"
 #include "Framework/Conventions/Constants.h"
+#include "Framework/Utils/StartupProfiler.h"
+#include "Framework/Utils/ThreadPool.h"
 
 using namespace genie;
 using namespace genie::constants;
 
+// number of ray coordinates (position & momentum) in a path length cache row
+static const int kNPlCacheRay = 6;
+
+// flux entries per thread read at once when pre-calculating the flux
+// interaction probabilities
+static const int kFluxProbBatchSize = 256;
+
+// flux entry whose interaction probability is being pre-calculated
+namespace {
+struct FluxProbEntry {
+  FluxProbEntry() : fIndex(-1), fPdg(0), fWeight(0), fCached(false) { }
+  long int       fIndex;
+  int            fPdg;
+  double         fWeight;
+  TLorentzVector fX4;
+  TLorentzVector fP4;
+  bool           fCached;       // path lengths taken from the path length cache?
+  PathLengthList fPathLengths;
+};
+}
+
+//____________________________________________________________________________
+bool GMCJDriver::fMultiThreaded = false;
 //____________________________________________________________________________
 GMCJDriver::GMCJDriver()
 {
@@ -63,6 +101,29 @@ GMCJDriver::~GMCJDriver()
   if(fFluxIntProbFile) delete fFluxIntProbFile;
 }
 //___________________________________________________________________________
+void GMCJDriver::EnableMultiThreading(void)
+{
+// Prepare for running several GMCJDriver objects concurrently, one per thread.
+// Enables ROOT's internal thread-safety and instantiates all singletons that
+// are shared between threads, so that they are initialized exactly once and
+// only read afterwards. The singletons holding per-call state (RandomGen,
+// Cache and AlgFactory) are instantiated lazily in each thread.
+
+  if(fMultiThreaded) return;
+
+  LOG("GMCJDriver", pNOTICE)
+     << "Preparing shared state for multi-threaded event generation";
+
+  ROOT::EnableThreadSafety();
+
+  assert( Messenger::Instance()      );
+  assert( AlgConfigPool::Instance()  );
+  assert( PDGLibrary::Instance()     );
+  assert( XSecSplineList::Instance() );
+
+  fMultiThreaded = true;
+}
+//___________________________________________________________________________
 void GMCJDriver::SetEventGeneratorList(string listname)
 {
   LOG("GMCJDriver", pNOTICE)
@@ -137,6 +198,26 @@ void GMCJDriver::ForceSingleProbScale()
     << "Note: That does not force unweighted event kinematics!";
 }
 //___________________________________________________________________________
+void GMCJDriver::ForceInteractions(bool on)
+{
+// Make every flux neutrino that crosses the geometry interact: the target
+// material is selected in proportion to the actual interaction probabilities
+// and the event weight is multiplied by the (exact, unscaled) total
+// interaction probability of the flux neutrino in the geometry. The sum of
+// the event weights over the number of flux neutrinos thrown estimates the
+// interaction probability per flux neutrino. Much fewer flux neutrinos need
+// to be thrown (and swum through the geometry) per event for thin detectors;
+// the weighted sample can be unweighted later on (see gevunweight).
+// The probability scales, the pre-selection with the max path lengths and
+// the pre-calculated flux interaction probabilities aren't used.
+
+  fForceInteractions = on;
+
+  LOG("GMCJDriver", pNOTICE)
+    << "Force the flux neutrinos crossing the geometry to interact? : "
+    << utils::print::BoolAsYNString(fForceInteractions);
+}
+//___________________________________________________________________________
 void GMCJDriver::PreSelectEvents(bool preselect)
 {
 // Set whether to pre-select events based on a max-path lengths file. This
@@ -145,6 +226,224 @@ void GMCJDriver::PreSelectEvents(bool preselect)
   fPreSelect = preselect;
 }
 //___________________________________________________________________________
+void GMCJDriver::UseTabulatedXSecSums(bool on, int nE)
+{
+// Tabulate, at init, the total cross section of every target material on a
+// common energy grid for each flux neutrino species. The cross sections for
+// all materials are then obtained with a single energy lookup (and a linear
+// interpolation pass over contiguous memory) for every flux neutrino thrown,
+// rather than with a driver lookup and a spline evaluation per material.
+// Useful for detailed geometries with many target materials. Note that the
+// interpolated total cross sections differ slightly from the spline values
+// (by an amount controlled by the number of energy points).
+
+  fUseXSecSumTable = on;
+  fXSecSumTableNE  = TMath::Max(nE, 2);
+
+  LOG("GMCJDriver", pNOTICE)
+    << "Use tabulated total cross sections? : "
+    << utils::print::BoolAsYNString(fUseXSecSumTable)
+    << " (energy points: " << fXSecSumTableNE << ")";
+}
+//___________________________________________________________________________
+void GMCJDriver::UseChannelTables(bool on, int nE)
+{
+// Tabulate, at init, the cumulative cross sections of all interactions of
+// every initial state on a common energy grid (see XSecChannelTable). Each
+// event driver then selects an interaction with an energy lookup and a
+// binary search rather than with a spline evaluation per interaction.
+// Note that the interpolated channel probabilities differ slightly from the
+// spline values (by an amount controlled by the number of energy points).
+
+  fUseChannelTables = on;
+  fChannelTableNE   = TMath::Max(nE, 2);
+
+  LOG("GMCJDriver", pNOTICE)
+    << "Select interactions from tabulated cross sections? : "
+    << utils::print::BoolAsYNString(fUseChannelTables)
+    << " (energy points: " << fChannelTableNE << ")";
+}
+//___________________________________________________________________________
+void GMCJDriver::UsePathLengthCache(bool on)
+{
+// Keep the path lengths computed for each flux entry (as numbered by the flux
+// driver Index()) together with the ray they were computed for, and re-use
+// them, instead of navigating through the geometry, whenever the flux driver
+// returns the same entry with exactly the same ray. Useful for flux files
+// (such as GSimpleNtpFlux ones) with fixed ray origins that are recycled,
+// and, with Load/SavePathLengthCache(), for later jobs with the same flux
+// file & geometry. Rays of flux drivers that randomize the ray origin (eg on
+// a flux window) are never re-used. The cache takes (6 + number of targets)
+// doubles per flux entry.
+
+  fUsePlCache = on;
+
+  LOG("GMCJDriver", pNOTICE)
+    << "Use a path length cache? : "
+    << utils::print::BoolAsYNString(fUsePlCache);
+}
+//___________________________________________________________________________
+void GMCJDriver::UseInitCache(string filename, string key)
+{
+// Re-use the total cross section splines, the max path lengths and the
+// interaction probability scales computed by an earlier job: Configure()
+// loads them from the input file if it was written for the same tune, flux
+// neutrinos, target materials, max energy, xsec splines (hash of all their
+// knots) and user key (name or hash the geometry and flux inputs in the key;
+// they can't be checked here). Otherwise they are computed as usual and saved
+// in the file for later jobs.
+
+  fInitCacheFile = filename;
+  fInitCacheKey  = key;
+
+  LOG("GMCJDriver", pNOTICE)
+    << "Init cache file: " << fInitCacheFile << " (key: " << fInitCacheKey << ")";
+}
+//___________________________________________________________________________
+void GMCJDriver::ShuffleBatches(bool on)
+{
+// Hand over the events of each GenerateEvents() batch in random order. Use
+// with flux drivers that don't return independently ordered neutrinos (for
+// example genie::flux::GFluxEnergySorter, which returns them in energy-sorted
+// blocks), with batches of at least one flux block worth of events.
+
+  fShuffleBatches = on;
+
+  LOG("GMCJDriver", pNOTICE)
+    << "Shuffle the events of each batch? : "
+    << utils::print::BoolAsYNString(fShuffleBatches);
+}
+//___________________________________________________________________________
+void GMCJDriver::FoldFluxWeights(bool on)
+{
+// Multiply the weight of each generated event (GHepRecord::Weight()) by the
+// weight of its flux neutrino (GFluxI::Weight()), e.g. to carry the weights
+// of an importance-biased flux driver into the event record.
+
+  fFoldFluxWeights = on;
+
+  LOG("GMCJDriver", pNOTICE)
+    << "Fold the flux neutrino weights into the event weights? : "
+    << utils::print::BoolAsYNString(fFoldFluxWeights);
+}
+//___________________________________________________________________________
+bool GMCJDriver::LoadPathLengthCache(string filename)
+{
+// Load a path length cache saved by an earlier job (see SavePathLengthCache())
+// and switch the cache on. Call after Configure(). The cache must have been
+// made with the same flux file & geometry: only the list of targets can be
+// checked here.
+
+  int ntgt = fMaxPathLengths.size();
+  if(ntgt == 0) {
+     LOG("GMCJDriver", pERROR)
+       << "Load the path length cache after configuring the driver";
+     return false;
+  }
+
+  TFile file(filename.c_str(), "READ");
+  if(file.IsZombie()) {
+     LOG("GMCJDriver", pWARN)
+       << "Can not open path length cache file: " << filename;
+     return false;
+  }
+  TTree * tgt_tree = dynamic_cast<TTree *> (file.Get("gPlCacheTgt"));
+  TTree * pl_tree  = dynamic_cast<TTree *> (file.Get("gPlCache"));
+  if(!tgt_tree || !pl_tree) {
+     LOG("GMCJDriver", pERROR)
+       << "No path length cache trees in file: " << filename;
+     return false;
+  }
+
+  // check the targets
+  int tgt = 0;
+  bool tgt_ok = (tgt_tree->GetEntries() == ntgt) &&
+                (tgt_tree->SetBranchAddress("Tgt", &tgt) >= 0);
+  PathLengthList::const_iterator pliter = fMaxPathLengths.begin();
+  for(int i = 0; tgt_ok && i < ntgt; i++, ++pliter) {
+     tgt_tree->GetEntry(i);
+     tgt_ok = (tgt == pliter->first);
+  }
+  if(!tgt_ok) {
+     LOG("GMCJDriver", pERROR)
+       << "The path length cache in " << filename
+       << " was made for a different list of targets";
+     return false;
+  }
+
+  Long64_t iflux = 0;
+  vector<double> row(kNPlCacheRay + ntgt);
+  if(pl_tree->SetBranchAddress("FluxIndex", &iflux) < 0 ||
+     pl_tree->SetBranchAddress("RayPL", row.data()) < 0) {
+     LOG("GMCJDriver", pERROR)
+       << "Cannot find expected branches in the path length cache tree";
+     return false;
+  }
+  for(Long64_t i = 0; i < pl_tree->GetEntries(); i++) {
+     pl_tree->GetEntry(i);
+     TLorentzVector x4(row[0], row[1], row[2], 0.);
+     TLorentzVector p4(row[3], row[4], row[5], 0.);
+     this->CachePathLengths(iflux, x4, p4, row.data() + kNPlCacheRay);
+  }
+
+  LOG("GMCJDriver", pNOTICE)
+    << "Loaded the path lengths of " << pl_tree->GetEntries()
+    << " flux entries from " << filename;
+
+  this->UsePathLengthCache(true);
+  return true;
+}
+//___________________________________________________________________________
+bool GMCJDriver::SavePathLengthCache(string filename) const
+{
+// Save the path length cache in a ROOT file (a tree with the targets and a
+// tree with the ray & path lengths of each cached flux entry), which can be
+// loaded by later jobs using the same flux file & geometry.
+
+  int ntgt = fMaxPathLengths.size();
+
+  TFile * file = new TFile(filename.c_str(), "RECREATE");
+  if(file->IsZombie()) {
+     LOG("GMCJDriver", pERROR)
+       << "Can not create path length cache file: " << filename;
+     delete file;
+     return false;
+  }
+
+  int tgt = 0;
+  TTree * tgt_tree = new TTree("gPlCacheTgt", "Targets of the path length cache");
+  tgt_tree->Branch("Tgt", &tgt, "Tgt/I");
+  PathLengthList::const_iterator pliter = fMaxPathLengths.begin();
+  for( ; pliter != fMaxPathLengths.end(); ++pliter) {
+     tgt = pliter->first;
+     tgt_tree->Fill();
+  }
+
+  Long64_t iflux = 0;
+  vector<double> row(kNPlCacheRay + ntgt);
+  std::ostringstream leaves;
+  leaves << "RayPL[" << row.size() << "]/D";
+  TTree * pl_tree = new TTree("gPlCache", "Path lengths per flux entry");
+  pl_tree->Branch("FluxIndex", &iflux, "FluxIndex/L");
+  pl_tree->Branch("RayPL", row.data(), leaves.str().c_str());
+  map<long int, long int>::const_iterator riter = fPlCacheRows.begin();
+  for( ; riter != fPlCacheRows.end(); ++riter) {
+     iflux = riter->first;
+     const double * cached = fPlCache.data() + riter->second * row.size();
+     std::copy(cached, cached + row.size(), row.begin());
+     pl_tree->Fill();
+  }
+
+  file->Write();
+  file->Close();
+  delete file;
+
+  LOG("GMCJDriver", pNOTICE)
+    << "Saved the path lengths of " << fPlCacheRows.size()
+    << " flux entries in " << filename;
+  return true;
+}
+//___________________________________________________________________________
 bool GMCJDriver::PreCalcFluxProbabilities(void)
 {
 // Loop over complete set of flux entries satisfying input config options
@@ -194,43 +493,103 @@ bool GMCJDriver::PreCalcFluxProbabilities(void)
 
     fGlobPmax = 1.0; // Force ComputeInteractionProbabilities to return absolute value
 
+    // The flux entries are read in batches by this thread (flux drivers are
+    // not thread-safe). If the geometry driver supports it, the path lengths
+    // of a batch are computed over the threads of the GENIE thread pool.
+    // The interaction probabilities are then computed and stored in flux
+    // entry order, so the tree does not depend on the number of threads.
+    ThreadPool * pool = ThreadPool::Instance();
+    bool parallel = pool->NThreads() > 1 &&
+                    fGeomAnalyzer->SetThreadSafeNavigation(pool->NThreads());
+    int nbatch = parallel ? kFluxProbBatchSize * pool->NThreads() : 1;
+    vector<FluxProbEntry> batch(nbatch);
+
+    LOG("GMCJDriver", pNOTICE)
+      << "Pre-calculating flux interaction probabilities using "
+      << (parallel ? pool->NThreads() : 1) << " thread(s)"
+      << " for part " << fFluxProbIJob << " of " << fFluxProbNJobs;
+
     // Loop over flux entries and calculate interaction probabilities
     TStopwatch stopwatch;
     stopwatch.Start();
     long int first_index = -1;
+    long int ientry = 0;
     bool first_loop = true;
+    bool cycled = false;
     // loop until at end of flux ntuple
-    while(fFluxDriver->End() == false){
+    while(success && !cycled && fFluxDriver->End() == false){
 
-      // get the next flux neutrino
-      bool gotnext = fFluxDriver->GenerateNext();
-      if(!gotnext){
-        LOG("GMCJDriver", pWARN) << "*** Couldn't generate next flux ray! ";
-        continue;
+      // read the next batch of flux neutrinos of this part
+      int n = 0;
+      while(n < nbatch && fFluxDriver->End() == false){
+
+        // get the next flux neutrino
+        bool gotnext = fFluxDriver->GenerateNext();
+        if(!gotnext){
+          LOG("GMCJDriver", pWARN) << "*** Couldn't generate next flux ray! ";
+          continue;
+        }
+
+        // stop if completed a full cycle (this check is necessary as fluxdriver
+        // may be set to loop over more than one cycle before reaching end)
+        bool already_been_here = first_loop ? false : first_index == fFluxDriver->Index();
+        if(already_been_here) { cycled = true; break; }
+
+        // store the first index so know when have cycled exactly once
+        if(first_loop){
+          first_index = fFluxDriver->Index();
+          first_loop = false;
+        }
+
+        // entries of the other parts are left to the other jobs
+        if((ientry++) % fFluxProbNJobs != fFluxProbIJob) continue;
+
+        FluxProbEntry & entry = batch[n++];
+        entry.fIndex  = fFluxDriver->Index();
+        entry.fPdg    = fFluxDriver->PdgCode();
+        entry.fWeight = fFluxDriver->Weight();
+        entry.fX4     = fFluxDriver->Position();
+        entry.fP4     = fFluxDriver->Momentum();
+        entry.fCached = fUsePlCache && entry.fIndex >= 0 &&
+            this->PathLengthsFromCache(entry.fIndex, entry.fX4, entry.fP4);
+        if(entry.fCached) entry.fPathLengths = fCurPathLengths;
       }
 
-      // stop if completed a full cycle (this check is necessary as fluxdriver
-      // may be set to loop over more than one cycle before reaching end)
-      bool already_been_here = first_loop ? false : first_index == fFluxDriver->Index();
-      if(already_been_here) break;
-
-      // compute the path lengths for current flux neutrino
-      if(this->ComputePathLengths() == false){ success = false; break;}
-
-      // compute and store the interaction probability
-      double psum = this->ComputeInteractionProbabilities(false /*Based on actual PLs*/);
-      assert(psum+controls::kASmallNum > 0.);
-      fBrFluxIntProb = psum;
-      fBrFluxIndex   = fFluxDriver->Index();
-      fBrFluxEnu     = fFluxDriver->Momentum().E();
-      fBrFluxWeight  = fFluxDriver->Weight();
-      fBrFluxPDG     = fFluxDriver->PdgCode();
-      fFluxIntTree->Fill();
-
-      // store the first index so know when have cycled exactly once
-      if(first_loop){
-        first_index = fFluxDriver->Index();
-        first_loop = false;
+      // compute the path lengths for the batch
+      auto swim = [&] (int i, unsigned int /*worker*/) {
+        FluxProbEntry & entry = batch[i];
+        if(entry.fCached) return;
+        entry.fPathLengths =
+           fGeomAnalyzer->ComputePathLengths(entry.fX4, entry.fP4);
+      };
+      if(parallel) pool->ParallelFor(n, swim);
+      else {
+        for(int i = 0; i < n; i++) swim(i, 0);
+      }
+
+      // compute and store the interaction probabilities
+      for(int i = 0; i < n; i++) {
+        FluxProbEntry & entry = batch[i];
+        if(entry.fPathLengths.size() == 0) {
+          LOG("GMCJDriver", pFATAL)
+            << "\n *** Geometry driver error ***"
+            << "\n Got an empty PathLengthList - No material found in geometry?";
+          success = false;
+          break;
+        }
+        if(fUsePlCache && entry.fIndex >= 0 && !entry.fCached) {
+          this->CachePathLengths(
+             entry.fIndex, entry.fX4, entry.fP4, entry.fPathLengths);
+        }
+        double psum = this->ComputeInteractionProbabilities(
+             entry.fPdg, entry.fP4, entry.fPathLengths);
+        assert(psum+controls::kASmallNum > 0.);
+        fBrFluxIntProb = psum;
+        fBrFluxIndex   = entry.fIndex;
+        fBrFluxEnu     = entry.fP4.E();
+        fBrFluxWeight  = entry.fWeight;
+        fBrFluxPDG     = entry.fPdg;
+        fFluxIntTree->Fill();
       }
     } // flux loop
     stopwatch.Stop();
@@ -352,6 +711,215 @@ void GMCJDriver::SaveFluxProbabilities(string outfilename)
   fFluxIntFileName = outfilename;
 }
 //___________________________________________________________________________
+void GMCJDriver::SetFluxProbabilitiesPartition(int ijob, int njobs)
+{
+// Split the pre-calculation of the flux interaction probabilities over njobs
+// jobs: PreCalcFluxProbabilities() then only processes the flux entries with
+// (position in the flux cycle) % njobs == ijob. Each job should save its part
+// (see SaveFluxProbabilities()) and exit; the parts, merged with hadd, form a
+// file that can be fed to LoadFluxProbabilities() for event generation.
+// Do not generate events in a partial job: the probability scale and the
+// interaction probability sums only account for its part of the flux.
+//
+  if(njobs < 1 || ijob < 0 || ijob >= njobs) {
+    LOG("GMCJDriver", pFATAL)
+      << "Invalid flux probabilities partition: part " << ijob
+      << " of " << njobs;
+    gAbortingInErr = true;
+    exit(1);
+  }
+  fFluxProbIJob  = ijob;
+  fFluxProbNJobs = njobs;
+
+  LOG("GMCJDriver", pNOTICE)
+    << "Pre-calculating the flux interaction probabilities of part "
+    << ijob << " of " << njobs;
+}
+//___________________________________________________________________________
+bool GMCJDriver::ComputeEventRates(vector<EventRate> & rates, Long64_t nflux)
+{
+// Compute the expected event rate of every enabled channel for each neutrino
+// type & target material, without generating any events: Loops over (up to
+// nflux, or a full cycle of) the flux neutrinos and sums their flux weight x
+// interaction probability of each channel along their path in the geometry.
+// The rates are for the flux normalization of the flux driver (eg per the POT
+// it has used so far). Call after Configure(); prob scales aren't needed.
+// The flux neutrinos are read in batches, as in PreCalcFluxProbabilities():
+// the path lengths of a batch are computed over the threads of the GENIE
+// thread pool (if the geometry driver supports it) and then the channels of
+// the batch are summed over the threads.
+//
+  rates.clear();
+  if(!fUseSplines || !fGPool) {
+    LOG("GMCJDriver", pERROR)
+      << "Event rates need a driver configured with cross section splines";
+    return false;
+  }
+
+  // the enabled channels, with their cross section splines
+  struct RateChannel {
+    int            fNuPdg;
+    int            fTgtPdg;
+    int            fA;
+    const Spline * fXSec;
+    double         fSum;     // sum{weight x probability}
+    double         fSum2;    // sum{(weight x probability)^2}
+    string         fName;
+  };
+  vector<RateChannel> channels;
+  PDGCodeList::const_iterator nuiter, tgtiter;
+  for(nuiter = fNuList.begin(); nuiter != fNuList.end(); ++nuiter) {
+   for(tgtiter = fTgtList.begin(); tgtiter != fTgtList.end(); ++tgtiter) {
+     GEVGDriver * evgdriver = fGPool->FindDriver(*nuiter, *tgtiter);
+     if(!evgdriver || !evgdriver->Interactions()) continue;
+     const InteractionList & ilst = *evgdriver->Interactions();
+     InteractionList::const_iterator intiter = ilst.begin();
+     for( ; intiter != ilst.end(); ++intiter) {
+       const Spline * spl = evgdriver->XSecSpline(*intiter);
+       if(!spl) {
+         LOG("GMCJDriver", pERROR)
+           << "No cross section spline for: " << (*intiter)->AsString();
+         return false;
+       }
+       // build the flat evaluator here: it is built lazily, on first use
+       spl->Evaluate(fEmax);
+       RateChannel ch;
+       ch.fNuPdg  = *nuiter;
+       ch.fTgtPdg = *tgtiter;
+       ch.fA      = pdg::IonPdgCodeToA(*tgtiter);
+       ch.fXSec   = spl;
+       ch.fSum    = 0;
+       ch.fSum2   = 0;
+       ch.fName   = (*intiter)->AsString();
+       channels.push_back(ch);
+     }
+   }
+  }
+
+  fFluxDriver->GenerateWeighted(true);
+
+  ThreadPool * pool = ThreadPool::Instance();
+  bool parallel = pool->NThreads() > 1;
+  bool parallel_swim = parallel &&
+                  fGeomAnalyzer->SetThreadSafeNavigation(pool->NThreads());
+  int nbatch = kFluxProbBatchSize * (parallel ? pool->NThreads() : 1);
+  vector<FluxProbEntry> batch(nbatch);
+
+  LOG("GMCJDriver", pNOTICE)
+    << "Computing the event rates of " << channels.size()
+    << " channels using " << (parallel ? pool->NThreads() : 1) << " thread(s)";
+
+  TStopwatch stopwatch;
+  stopwatch.Start();
+  long int first_index = -1;
+  Long64_t nread = 0;
+  bool first_loop = true;
+  bool cycled = false;
+  while(!cycled && fFluxDriver->End() == false &&
+        (nflux < 0 || nread < nflux)) {
+
+    // read the next batch of flux neutrinos
+    int n = 0;
+    while(n < nbatch && fFluxDriver->End() == false &&
+          (nflux < 0 || nread < nflux)) {
+      if(!fFluxDriver->GenerateNext()) {
+        LOG("GMCJDriver", pWARN) << "*** Couldn't generate next flux ray! ";
+        continue;
+      }
+      bool already_been_here = first_loop ? false : first_index == fFluxDriver->Index();
+      if(already_been_here) { cycled = true; break; }
+      if(first_loop){
+        first_index = fFluxDriver->Index();
+        first_loop = false;
+      }
+      nread++;
+
+      FluxProbEntry & entry = batch[n++];
+      entry.fIndex  = fFluxDriver->Index();
+      entry.fPdg    = fFluxDriver->PdgCode();
+      entry.fWeight = fFluxDriver->Weight();
+      entry.fX4     = fFluxDriver->Position();
+      entry.fP4     = fFluxDriver->Momentum();
+      entry.fCached = fUsePlCache && entry.fIndex >= 0 &&
+          this->PathLengthsFromCache(entry.fIndex, entry.fX4, entry.fP4);
+      if(entry.fCached) entry.fPathLengths = fCurPathLengths;
+    }
+
+    // compute the path lengths for the batch
+    auto swim = [&] (int i, unsigned int /*worker*/) {
+      FluxProbEntry & entry = batch[i];
+      if(entry.fCached) return;
+      entry.fPathLengths =
+         fGeomAnalyzer->ComputePathLengths(entry.fX4, entry.fP4);
+    };
+    if(parallel_swim) pool->ParallelFor(n, swim);
+    else {
+      for(int i = 0; i < n; i++) swim(i, 0);
+    }
+    if(fUsePlCache) {
+      for(int i = 0; i < n; i++) {
+        FluxProbEntry & entry = batch[i];
+        if(entry.fIndex < 0 || entry.fCached) continue;
+        this->CachePathLengths(
+           entry.fIndex, entry.fX4, entry.fP4, entry.fPathLengths);
+      }
+    }
+
+    // add the batch to the channel sums (each channel is summed by one thread)
+    auto sum = [&] (int ic, unsigned int /*worker*/) {
+      RateChannel & ch = channels[ic];
+      for(int i = 0; i < n; i++) {
+        const FluxProbEntry & entry = batch[i];
+        if(entry.fPdg != ch.fNuPdg) continue;
+        PathLengthList::const_iterator pliter = entry.fPathLengths.find(ch.fTgtPdg);
+        if(pliter == entry.fPathLengths.end() || pliter->second <= 0.) continue;
+        double xsec = ch.fXSec->Evaluate(entry.fP4.Energy());
+        if(xsec <= 0.) continue;
+        double r = entry.fWeight *
+             this->InteractionProbability(xsec, pliter->second, ch.fA);
+        ch.fSum  += r;
+        ch.fSum2 += r*r;
+      }
+    };
+    if(parallel) pool->ParallelFor(channels.size(), sum);
+    else {
+      for(unsigned int ic = 0; ic < channels.size(); ic++) sum(ic, 0);
+    }
+  } // flux loop
+  stopwatch.Stop();
+
+  fNFluxNeutrinos += nread;
+  fFluxDriver->Clear("CycleHistory");
+
+  rates.resize(channels.size());
+  for(unsigned int ic = 0; ic < channels.size(); ic++) {
+    rates[ic].fNuPdg   = channels[ic].fNuPdg;
+    rates[ic].fTgtPdg  = channels[ic].fTgtPdg;
+    rates[ic].fChannel = channels[ic].fName;
+    rates[ic].fRate    = channels[ic].fSum;
+    rates[ic].fRateErr = TMath::Sqrt(channels[ic].fSum2);
+  }
+  LOG("GMCJDriver", pNOTICE)
+    << "Computed the event rates of " << channels.size() << " channels for "
+    << nread << " flux neutrinos in " << stopwatch.RealTime() << " s";
+  return true;
+}
+//___________________________________________________________________________
+void GMCJDriver::UseLowMemoryMode(bool on)
+{
+// Reduce the memory footprint of jobs with many target materials: at the
+// end of Configure(), the xsec splines not used by any event generation
+// driver of this job (eg splines for other targets loaded from a large
+// spline file) and the cache branches only needed while building splines
+// (integrated xsecs) are deleted. Not done for multi-threaded jobs, as the
+// spline list is shared by the drivers of all worker threads.
+
+  fLowMemory = on;
+
+  LOG("GMCJDriver", pNOTICE)
+    << "Use low memory mode? : " << utils::print::BoolAsYNString(fLowMemory);
+}
+//___________________________________________________________________________
 void GMCJDriver::Configure(bool calc_prob_scales)
 {
   LOG("GMCJDriver", pNOTICE)
@@ -383,12 +951,38 @@ void GMCJDriver::Configure(bool calc_prob_scales)
   // them into the XSecSplineList
   this->BootstrapXSecSplines();
 
+  // If requested, drop what is not needed for event generation once all
+  // splines are available (before the channel tables, keyed on the spline
+  // list revision, are built)
+  if(fLowMemory) {
+    if(fMultiThreaded) {
+      LOG("GMCJDriver", pWARN)
+        << "Multi-threaded job: Keeping the (shared) xsec splines";
+    } else if(fUseSplines) {
+      set<string> keys;
+      GEVGPool::const_iterator gpiter = fGPool->begin();
+      for( ; gpiter != fGPool->end(); ++gpiter) {
+        if(gpiter->second) gpiter->second->SplineKeys(keys);
+      }
+      XSecSplineList::Instance()->RemoveSplinesExcept(keys);
+    }
+    Cache::Instance()->RmBuildOnlyCacheBranches();
+  }
+
+  // Re-use the total cross sections & probability scales of an earlier job,
+  // if requested and available
+  bool cached = !fInitCacheFile.empty() && this->LoadInitCache(calc_prob_scales);
+
   // Create cross section splines describing the total interaction xsec
   // for a given initial state (Create them by summing all xsec splines
   // for each possible initial state)
   this->BootstrapXSecSplineSummation();
 
-  if(calc_prob_scales){
+  // If requested, tabulate the total cross sections for all target materials
+  // on a common energy grid
+  if(fUseXSecSumTable) this->BuildXSecSumTable();
+
+  if(calc_prob_scales && !cached){
     // Ask the input geometry driver to compute the max. path length for each
     // material in the list of target materials (or load a precomputed list)
     this->GetMaxPathLengthList();
@@ -397,9 +991,50 @@ void GMCJDriver::Configure(bool calc_prob_scales)
     // probabilities to be computed by this driver
     this->ComputeProbScales();
   }
+
+  if(!fInitCacheFile.empty() && !cached) this->SaveInitCache(calc_prob_scales);
+
+  this->PrintMemoryUsage();
+
   LOG("GMCJDriver", pNOTICE) << "Finished configuring GMCJDriver\n\n";
 }
 //___________________________________________________________________________
+void GMCJDriver::PrintMemoryUsage(void) const
+{
+  const double MB = 1024.*1024.;
+
+  size_t spl_bytes = XSecSplineList::Instance()->MemoryFootprint();
+  size_t cache_bytes = Cache::Instance()->MemoryFootprint();
+  size_t drv_bytes = 0;
+  unsigned int ndrv = 0;
+  if(fGPool) {
+    GEVGPool::const_iterator gpiter = fGPool->begin();
+    for( ; gpiter != fGPool->end(); ++gpiter) {
+      if(!gpiter->second) continue;
+      drv_bytes += gpiter->second->MemoryFootprint();
+      ndrv++;
+    }
+  }
+  size_t tab_bytes = sizeof(double) * (fPlCache.capacity() + fCurXSecSum.capacity());
+  map<int, vector<double> >::const_iterator xsiter = fXSecSumTable.begin();
+  for( ; xsiter != fXSecSumTable.end(); ++xsiter) {
+    tab_bytes += sizeof(double) * xsiter->second.capacity();
+  }
+
+  ProcInfo_t pinfo;
+  gSystem->GetProcInfo(&pinfo);
+
+  LOG("GMCJDriver", pNOTICE)
+     << "Approximate memory usage:"
+     << "\n - xsec splines           : " << spl_bytes   / MB << " MB ("
+     << XSecSplineList::Instance()->NSplines() << " splines in the current tune)"
+     << "\n - cache branches         : " << cache_bytes / MB << " MB"
+     << "\n - event gen. drivers     : " << drv_bytes   / MB << " MB ("
+     << ndrv << " initial states)"
+     << "\n - xsec & path len. tables: " << tab_bytes   / MB << " MB"
+     << "\n - process resident memory: " << pinfo.fMemResident / 1024. << " MB";
+}
+//___________________________________________________________________________
 void GMCJDriver::InitJob(void)
 {
   fEventGenList       = "Default";  // <-- set of event generators to be loaded by this driver
@@ -418,21 +1053,41 @@ void GMCJDriver::InitJob(void)
   fUseExtMaxPl        = false;
   fUseSplines         = false;
   fNFluxNeutrinos     = 0;     // <-- number of flux neutrinos thrown so far
+  fIEvent             = 0;     // <-- number of GenerateEvent() calls so far
 
   fGlobPmax           = 0;     // <-- maximum interaction probability (global prob scale)
   fPmax.clear();               // <-- maximum interaction probability per neutrino & per energy bin
 
   fGenerateUnweighted = false; // <-- default opt to generate weighted events
+  fForceInteractions  = false; // <-- default to decide whether each flux neutrino interacts
   fPreSelect          = true;  // <-- default to use pre-selection based on maximum path lengths
+  fUseXSecSumTable    = false; // <-- default to evaluate the total xsec spline of each material
+  fUsePlCache         = false; // <-- default to navigate through the geometry for every flux neutrino
+  fShuffleBatches     = false; // <-- default to hand over events in the order they are generated
+  fFoldFluxWeights    = false; // <-- default to leave the flux neutrino weights out of the event weights
+  fLowMemory          = false; // <-- default to keep all loaded splines & cache branches
+  fPlCacheRows.clear();
+  fPlCache.clear();
+  fInitCacheFile      = "";    // <-- default to compute the total xsec splines & prob scales at init
+  fInitCacheKey       = "";
+  fXSecSumTableNE     = 5000;
+  fUseChannelTables   = false; // <-- default to evaluate the xsec spline of every interaction for every event
+  fChannelTableNE     = 1000;
+  fXSecSumTableDE     = 0;
+  fXSecSumTableTgt.clear();
+  fXSecSumTable.clear();
 
   fSelTgtPdg          = 0;
   fCurEvt             = 0;
+  fReuseEvt           = 0;
   fCurVtx.SetXYZT(0.,0.,0.,0.);
 
   fFluxIntProbFile    = 0;
   fFluxIntTreeName    = "gFlxIntProb";
   fFluxIntFileName    = "";
   fFluxIntTree        = 0;
+  fFluxProbIJob       = 0;
+  fFluxProbNJobs      = 1;
   fBrFluxIntProb      = -1.;
   fBrFluxIndex        = -1;
   fBrFluxEnu          = -1.;
@@ -485,6 +1140,8 @@ void GMCJDriver::GetParticleLists(void)
 //___________________________________________________________________________
 void GMCJDriver::GetMaxPathLengthList(void)
 {
+  StartupTimer timer("GMCJDriver: max path-length computation");
+
   if(fUseExtMaxPl) {
      LOG("GMCJDriver", pNOTICE)
        << "Loading external max path-length list for input geometry from "
@@ -540,7 +1197,7 @@ void GMCJDriver::PopulateEventGenDriverPool(void)
      evgdriver->UseSplines(); // check if all splines needed are loaded
 
      LOG("GMCJDriver", pDEBUG) << "Adding new GEVGDriver object to GEVGPool";
-     fGPool->insert( GEVGPool::value_type(init_state.AsString(), evgdriver) );
+     fGPool->AddDriver(init_state, evgdriver);
    } // targets
   } // neutrinos
 
@@ -553,6 +1210,33 @@ void GMCJDriver::BootstrapXSecSplines(void)
 // Bootstrap cross section spline generation by the event generation drivers
 // that handle each initial state.
 
+  StartupTimer timer("GMCJDriver: cross-section spline bootstrapping");
+
+  // If the loading of input splines was deferred, load only those for the
+  // initial states this job can see (plus the free-nucleon ones, used by
+  // some algorithms when computing nuclear cross sections)
+  XSecSplineList * xspl = XSecSplineList::Instance();
+  if(xspl->HasDeferredFiles()) {
+    set<string> init_states;
+    PDGCodeList::const_iterator nuiter;
+    PDGCodeList::const_iterator tgtiter;
+    for(nuiter = fNuList.begin(); nuiter != fNuList.end(); ++nuiter){
+      init_states.insert(InitialState(kPdgTgtFreeP, *nuiter).AsString());
+      init_states.insert(InitialState(kPdgTgtFreeN, *nuiter).AsString());
+      for(tgtiter = fTgtList.begin(); tgtiter != fTgtList.end(); ++tgtiter) {
+        init_states.insert(InitialState(*tgtiter, *nuiter).AsString());
+      }
+    }
+    LOG("GMCJDriver", pNOTICE)
+      << "Loading the input xsec splines for " << init_states.size()
+      << " initial states";
+    if(xspl->LoadDeferred(init_states) != kXmlOK) {
+      LOG("GMCJDriver", pFATAL) << "Couldn't load the input xsec splines";
+      gAbortingInErr = true;
+      exit(1);
+    }
+  }
+
   if(!fUseSplines) return;
 
   LOG("GMCJDriver", pNOTICE)
@@ -568,7 +1252,7 @@ void GMCJDriver::BootstrapXSecSplines(void)
        LOG("GMCJDriver", pINFO)
            << "Computing all splines needed for init-state: "
            << init_state.AsString();
-       GEVGDriver * evgdriver = fGPool->FindDriver(init_state);
+       GEVGDriver * evgdriver = fGPool->FindDriver(neutrino_pdgc, target_pdgc);
        evgdriver->CreateSplines(-1,-1,fUseLogE);
      } // targets
   } // neutrinos
@@ -580,16 +1264,24 @@ void GMCJDriver::BootstrapXSecSplineSummation(void)
 // Sum-up the cross section splines for all the interaction that can be
 // simulated for each initial state
 
+  StartupTimer timer("GMCJDriver: total cross section splines");
+
   LOG("GMCJDriver", pNOTICE)
     << "Summing-up splines to get total cross section for each init state";
 
+  // The initial states are independent: their splines are summed (and their
+  // channel tables built) concurrently on the thread pool, if running. Each
+  // driver only evaluates its own (already loaded) xsec splines, so the
+  // results don't depend on the number of threads. Total xsec splines loaded
+  // from the init cache are kept.
+  vector<string>       init_states;
+  vector<GEVGDriver *> drivers;
+  vector<double>       emin, emax;
+
   GEVGPool::iterator diter;
   for(diter = fGPool->begin(); diter != fGPool->end(); ++diter) {
-    string       init_state = diter->first;
     GEVGDriver * evgdriver  = diter->second;
     assert(evgdriver);
-    LOG("GMCJDriver", pNOTICE)
-             << "**** Summing xsec splines for init-state = " << init_state;
 
     Range1D_t rE = evgdriver->ValidEnergyRange();
     if (fEmax>rE.max || fEmax<rE.min)
@@ -605,12 +1297,113 @@ void GMCJDriver::BootstrapXSecSplineSummation(void)
     double dE  = fEmax/10.;
     double min = rE.min;
     double max = (fEmax+dE < rE.max) ? fEmax+dE : rE.max;
-    evgdriver->CreateXSecSumSpline(100,min,max,true);
+
+    init_states.push_back(diter->first);
+    drivers.push_back(evgdriver);
+    emin.push_back(min);
+    emax.push_back(max);
+  }
+
+  auto sum = [&] (int i, unsigned int /*worker*/) {
+    GEVGDriver * evgdriver = drivers[i];
+    if(!evgdriver->XSecSumSpline()) {
+      LOG("GMCJDriver", pNOTICE)
+        << "**** Summing xsec splines for init-state = " << init_states[i];
+      evgdriver->CreateXSecSumSpline(100,emin[i],emax[i],true);
+    }
+    if(fUseChannelTables) {
+      evgdriver->CreateChannelTable(fChannelTableNE,emin[i],emax[i],true);
+    }
+    // build the flat evaluator of the new spline here, rather than at its
+    // first (possibly concurrent) evaluation
+    evgdriver->XSecSumSpline()->Evaluate(emin[i]);
+  };
+  ThreadPool * pool = ThreadPool::Instance();
+  int n = drivers.size();
+  if(pool->NThreads() > 1) pool->ParallelFor(n, sum);
+  else {
+    for(int i = 0; i < n; i++) sum(i, 0);
   }
   LOG("GMCJDriver", pNOTICE)
      << "Finished summing all interaction xsec splines per initial state";
 }
 //___________________________________________________________________________
+void GMCJDriver::BuildXSecSumTable(void)
+{
+  LOG("GMCJDriver", pNOTICE)
+    << "Tabulating total cross sections for all targets at "
+    << fXSecSumTableNE << " energies in [0, " << fEmax << "] GeV";
+
+  fXSecSumTable.clear();
+  fXSecSumTableTgt.clear();
+
+  // Columns in ascending target code order, so that the table can be walked
+  // in parallel with any PathLengthList
+  PathLengthList tgtlist(fTgtList);
+  PathLengthList::const_iterator tgtiter;
+  for(tgtiter = tgtlist.begin(); tgtiter != tgtlist.end(); ++tgtiter) {
+    fXSecSumTableTgt.push_back(tgtiter->first);
+  }
+
+  unsigned int ntgt = fXSecSumTableTgt.size();
+  int          nE   = fXSecSumTableNE;
+  fXSecSumTableDE   = fEmax / (nE-1);
+
+  vector<double> energies(nE), xsecs(nE);
+  for(int ie = 0; ie < nE; ie++) energies[ie] = ie*fXSecSumTableDE;
+
+  PDGCodeList::const_iterator nuiter;
+  for(nuiter = fNuList.begin(); nuiter != fNuList.end(); ++nuiter) {
+    int neutrino_pdgc = *nuiter;
+    vector<double> & table = fXSecSumTable[neutrino_pdgc];
+    table.assign(nE*ntgt, 0.);
+    for(unsigned int it = 0; it < ntgt; it++) {
+      GEVGDriver * evgdriver = fGPool->FindDriver(neutrino_pdgc, fXSecSumTableTgt[it]);
+      assert(evgdriver);
+      const Spline * totxsecspl = evgdriver->XSecSumSpline();
+      assert(totxsecspl);
+      totxsecspl->Evaluate(&energies[0], &xsecs[0], nE);
+      for(int ie = 0; ie < nE; ie++) {
+        table[ie*ntgt + it] = xsecs[ie];
+      }
+    }
+  }
+  fCurXSecSum.assign(ntgt, 0.);
+}
+//___________________________________________________________________________
+bool GMCJDriver::InterpolateXSecSumTable(
+       int nupdg, double Ev, const PathLengthList & plist)
+{
+// Fill fCurXSecSum with the total cross section of every target at the input
+// energy. Returns false if there are no tabulated cross sections for the input
+// neutrino, or if the path-length list targets don't match the table columns.
+
+  if(!fUseXSecSumTable) return false;
+
+  map<int, vector<double> >::const_iterator tbliter = fXSecSumTable.find(nupdg);
+  if(tbliter == fXSecSumTable.end()) return false;
+
+  unsigned int ntgt = fXSecSumTableTgt.size();
+  if(plist.size() != ntgt || ntgt == 0) return false;
+
+  PathLengthList::const_iterator pliter = plist.begin();
+  for(unsigned int it = 0; it < ntgt; ++it, ++pliter) {
+    if(pliter->first != fXSecSumTableTgt[it]) return false;
+  }
+
+  double x  = Ev / fXSecSumTableDE;
+  int    ie = TMath::Max(0, TMath::Min((int) x, fXSecSumTableNE-2));
+  double f  = x - ie;
+
+  const double * lo = &(tbliter->second[ie*ntgt]);
+  const double * hi = lo + ntgt;
+  double *       xs = &fCurXSecSum[0];
+  for(unsigned int it = 0; it < ntgt; it++) {
+    xs[it] = lo[it] + f * (hi[it] - lo[it]);
+  }
+  return true;
+}
+//___________________________________________________________________________
 void GMCJDriver::ComputeProbScales(void)
 {
 // Computing interaction probability scales.
@@ -624,6 +1417,8 @@ void GMCJDriver::ComputeProbScales(void)
 // proportions between differect flux neutrino species or flux neutrinos of
 // different energies.
 
+  StartupTimer timer("GMCJDriver: interaction probability scales");
+
   LOG("GMCJDriver", pNOTICE)
     << "Computing the max. interaction probability (probability scale)";
 
@@ -650,24 +1445,27 @@ void GMCJDriver::ComputeProbScales(void)
   int n = 1 + (int) ((emax-emin)/de);
 
   PDGCodeList::const_iterator nuiter;
-  PDGCodeList::const_iterator tgtiter;
 
-  // loop over all neutrino types generated by the flux driver
-  for(nuiter = fNuList.begin(); nuiter != fNuList.end(); ++nuiter) {
-    int neutrino_pdgc = *nuiter;
-    TH1D * pmax_hst = new TH1D("pmax_hst",
-             "max interaction probability vs E | geom",n,emin,emax);
-    pmax_hst->SetDirectory(0);
-
-    // loop over energy bins
-    for(int ie = 1; ie <= pmax_hst->GetNbinsX(); ie++) {
-      double EvLow  = pmax_hst->GetBinCenter(ie) - 0.5*pmax_hst->GetBinWidth(ie);
-      double EvHigh = pmax_hst->GetBinCenter(ie) + 0.5*pmax_hst->GetBinWidth(ie);
-      //double Ev = pmax_hst->GetBinCenter(ie);
+  // The (neutrino, energy bin) entries are independent: they are computed
+  // concurrently on the thread pool, if running, and then filled in the
+  // histograms in order (the total xsec splines are only read)
+  vector<int> nus(fNuList.begin(), fNuList.end());
+  int nnu = nus.size();
+  double bin_width = (emax-emin)/n; // as in the pmax histogram axis below
+  vector<double> pmax_values(nnu*n, 0.);
+
+  auto compute = [&] (int i, unsigned int /*worker*/) {
+    int neutrino_pdgc = nus[i / n];
+    int ie            = 1 + i % n;
+    {
+      double EvCentre = emin + (ie-0.5)*bin_width;
+      double EvLow    = EvCentre - 0.5*bin_width;
+      double EvHigh   = EvCentre + 0.5*bin_width;
 
        // loop over targets in input geometry, form initial state and compute
        // the sum of maximum interaction probabilities at the current energy bin
        //
+       PDGCodeList::const_iterator tgtiter;
        for(tgtiter = fTgtList.begin(); tgtiter != fTgtList.end(); ++tgtiter) {
          int target_pdgc = *tgtiter;
 
@@ -677,7 +1475,7 @@ void GMCJDriver::ComputeProbScales(void)
            << "Computing Pmax for init-state: " << init_state.AsString() << " E from " << EvLow << "-" << EvHigh;
 
          // get the appropriate driver
-         GEVGDriver * evgdriver = fGPool->FindDriver(init_state);
+         GEVGDriver * evgdriver = fGPool->FindDriver(neutrino_pdgc, target_pdgc);
 
          // get xsec sum over all modelled processes for given neutrino+target)
          double sxsecLow  = evgdriver->XSecSumSpline()->Evaluate(EvLow);
@@ -699,19 +1497,34 @@ void GMCJDriver::ComputeProbScales(void)
 	     << " pmaxLow(E=" << EvLow << ")=" << pmaxLow << " and " << " pmaxHigh(E=" << EvHigh << ")=" << pmaxHigh;
 	 }
 
-         pmax_hst->SetBinContent(ie, pmax_hst->GetBinContent(ie) + pmax);
+         pmax_values[i] += pmax;
 
          LOG("GMCJDriver", pDEBUG)
            << "Pmax[" << init_state.AsString() << ", Ev from " << EvLow << "-" << EvHigh << "] = " << pmax;
        } // targets
 
-       pmax_hst->SetBinContent(ie, 1.2 * pmax_hst->GetBinContent(ie));
+       pmax_values[i] *= 1.2;
 
        LOG("GMCJDriver", pINFO)
 	 << "Pmax[nu=" << neutrino_pdgc << ", Ev from " << EvLow << "-" << EvHigh << "] = "
-          <<  pmax_hst->GetBinContent(ie);
+          <<  pmax_values[i];
     } // E
+  };
+  ThreadPool * pool = ThreadPool::Instance();
+  if(pool->NThreads() > 1) pool->ParallelFor(nnu*n, compute);
+  else {
+    for(int i = 0; i < nnu*n; i++) compute(i, 0);
+  }
 
+  // loop over all neutrino types generated by the flux driver
+  for(int inu = 0; inu < nnu; inu++) {
+    int neutrino_pdgc = nus[inu];
+    TH1D * pmax_hst = new TH1D("pmax_hst",
+             "max interaction probability vs E | geom",n,emin,emax);
+    pmax_hst->SetDirectory(0);
+    for(int ie = 1; ie <= pmax_hst->GetNbinsX(); ie++) {
+       pmax_hst->SetBinContent(ie, pmax_values[inu*n + ie-1]);
+    }
     fPmax.insert(map<int,TH1D*>::value_type(neutrino_pdgc,pmax_hst));
   } // nu
 
@@ -736,6 +1549,236 @@ void GMCJDriver::ComputeProbScales(void)
   }
 }
 //___________________________________________________________________________
+string GMCJDriver::InitCacheKey(void) const
+{
+// The key identifying the init cache written by jobs with the same tune,
+// event generators, flux neutrinos, targets & max energy (& user key), and
+// a hash of the knots of all the xsec splines used by the pool drivers, so
+// that a cache made with other splines (for the same tune) isn't re-used
+
+  std::ostringstream key;
+  const TuneId * tune = RunOpt::Instance()->Tune();
+  key << "tune:" << (tune ? tune->Name() : "") << ";evgl:" << fEventGenList;
+  key << ";nu:";
+  PDGCodeList::const_iterator it;
+  for(it = fNuList.begin(); it != fNuList.end(); ++it) key << *it << ",";
+  key << ";tgt:";
+  for(it = fTgtList.begin(); it != fTgtList.end(); ++it) key << *it << ",";
+  key << ";emax:" << fEmax << ";key:" << fInitCacheKey;
+
+  uint64_t h = 14695981039346656037ULL;
+  GEVGPool::const_iterator diter;
+  for(diter = fGPool->begin(); diter != fGPool->end(); ++diter) {
+    const GEVGDriver * evgdriver = diter->second;
+    const InteractionList * ilst = evgdriver->Interactions();
+    InteractionList::const_iterator iiter;
+    for(iiter = ilst->begin(); iiter != ilst->end(); ++iiter) {
+      const Spline * spl = evgdriver->XSecSpline(*iiter);
+      int nk = spl ? spl->NKnots() : 0;
+      h ^= (uint64_t) nk;
+      h *= 1099511628211ULL;
+      for(int ik = 0; ik < nk; ik++) {
+        double xy[2];
+        spl->GetKnot(ik, xy[0], xy[1]);
+        uint64_t bits[2];
+        memcpy(bits, xy, sizeof(bits));
+        for(int j = 0; j < 2; j++) {
+          h ^= bits[j];
+          h *= 1099511628211ULL;
+        }
+      }
+    }
+  }
+  key << ";xsec:" << std::hex << h;
+  return key.str();
+}
+//___________________________________________________________________________
+bool GMCJDriver::LoadInitCache(bool with_prob_scales)
+{
+// Load the total xsec splines (and the max path lengths & probability
+// scales) saved by an earlier job - see UseInitCache(). Nothing is loaded
+// unless the cache was made with the same key & has all that's needed.
+
+  if(gSystem->AccessPathName(fInitCacheFile.c_str())) {
+     LOG("GMCJDriver", pNOTICE)
+       << "No init cache file " << fInitCacheFile << " yet - Will create it";
+     return false;
+  }
+  TFile file(fInitCacheFile.c_str(), "READ");
+  if(file.IsZombie()) {
+     LOG("GMCJDriver", pWARN)
+       << "Can not open init cache file: " << fInitCacheFile;
+     return false;
+  }
+  TObjString * key = dynamic_cast<TObjString *> (file.Get("gInitCacheKey"));
+  string this_key = this->InitCacheKey();
+  if(!key || string(key->GetString().Data()) != this_key) {
+     LOG("GMCJDriver", pNOTICE)
+       << "The init cache in " << fInitCacheFile
+       << " was made for a different job - Will re-create it";
+     if(key) {
+       LOG("GMCJDriver", pINFO)
+         << "Cache key: " << key->GetString().Data()
+         << "\n  Job key: " << this_key;
+     }
+     return false;
+  }
+
+  // total xsec splines
+  TTree * xs_tree = dynamic_cast<TTree *> (file.Get("gInitCacheXSec"));
+  if(!xs_tree) return false;
+  char init_state[256];
+  int  nk = 0;
+  int  nkmax = (int) xs_tree->GetMaximum("NKnots");
+  vector<double> E(TMath::Max(nkmax,1)), xsec(TMath::Max(nkmax,1));
+  if(xs_tree->SetBranchAddress("InitState", init_state) < 0 ||
+     xs_tree->SetBranchAddress("NKnots",    &nk)        < 0 ||
+     xs_tree->SetBranchAddress("E",         E.data())   < 0 ||
+     xs_tree->SetBranchAddress("XSec",      xsec.data()) < 0) return false;
+
+  map<string, Spline *> splines;
+  for(Long64_t i = 0; i < xs_tree->GetEntries(); i++) {
+     xs_tree->GetEntry(i);
+     splines[init_state] = new Spline(nk, E.data(), xsec.data());
+  }
+  bool complete = true;
+  GEVGPool::iterator diter;
+  for(diter = fGPool->begin(); diter != fGPool->end(); ++diter) {
+     complete = complete && (splines.count(diter->first) > 0);
+  }
+
+  // max path lengths & probability scales
+  PathLengthList   maxpl;
+  map<int, TH1D *> pmax;
+  TVectorD *       globpmax = 0;
+  if(complete && with_prob_scales) {
+     TTree * pl_tree = dynamic_cast<TTree *> (file.Get("gInitCacheMaxPL"));
+     globpmax = dynamic_cast<TVectorD *> (file.Get("gInitCacheGlobPmax"));
+     complete = (pl_tree && globpmax);
+     int    tgt = 0;
+     double pl  = 0;
+     if(complete) {
+        complete = (pl_tree->SetBranchAddress("Tgt", &tgt) >= 0 &&
+                    pl_tree->SetBranchAddress("PL",  &pl)  >= 0);
+     }
+     for(Long64_t i = 0; complete && i < pl_tree->GetEntries(); i++) {
+        pl_tree->GetEntry(i);
+        maxpl.SetPathLength(tgt, pl);
+     }
+     PDGCodeList::const_iterator nuiter;
+     for(nuiter = fNuList.begin(); complete && nuiter != fNuList.end(); ++nuiter) {
+        std::ostringstream name;
+        name << "gInitCachePmax_" << *nuiter;
+        TH1D * hst = dynamic_cast<TH1D *> (file.Get(name.str().c_str()));
+        if(!hst) { complete = false; break; }
+        hst = (TH1D *) hst->Clone("pmax_hst");
+        hst->SetDirectory(0);
+        pmax[*nuiter] = hst;
+     }
+  }
+
+  if(!complete) {
+     LOG("GMCJDriver", pNOTICE)
+       << "The init cache in " << fInitCacheFile
+       << " is incomplete - Will re-create it";
+     map<string, Spline *>::iterator siter = splines.begin();
+     for( ; siter != splines.end(); ++siter) delete siter->second;
+     map<int, TH1D *>::iterator hiter = pmax.begin();
+     for( ; hiter != pmax.end(); ++hiter) delete hiter->second;
+     return false;
+  }
+
+  for(diter = fGPool->begin(); diter != fGPool->end(); ++diter) {
+     diter->second->AdoptXSecSumSpline(splines[diter->first]);
+     splines.erase(diter->first);
+  }
+  map<string, Spline *>::iterator siter = splines.begin();
+  for( ; siter != splines.end(); ++siter) delete siter->second;
+
+  if(with_prob_scales) {
+     fMaxPathLengths = maxpl;
+     map<int,TH1D*>::iterator pmax_iter = fPmax.begin();
+     for( ; pmax_iter != fPmax.end(); ++pmax_iter) delete pmax_iter->second;
+     fPmax     = pmax;
+     fGlobPmax = (*globpmax)[0];
+     LOG("GMCJDriver", pNOTICE) << "*** Probability scale = " << fGlobPmax;
+  }
+
+  LOG("GMCJDriver", pNOTICE)
+    << "Loaded the total cross section splines"
+    << (with_prob_scales ? ", max path lengths & probability scales" : "")
+    << " from the init cache: " << fInitCacheFile;
+  return true;
+}
+//___________________________________________________________________________
+void GMCJDriver::SaveInitCache(bool with_prob_scales) const
+{
+  TFile file(fInitCacheFile.c_str(), "RECREATE");
+  if(file.IsZombie()) {
+     LOG("GMCJDriver", pWARN)
+       << "Can not create init cache file: " << fInitCacheFile;
+     return;
+  }
+
+  TObjString key(this->InitCacheKey().c_str());
+  key.Write("gInitCacheKey");
+
+  // total xsec splines
+  int nkmax = 1;
+  GEVGPool::const_iterator diter;
+  for(diter = fGPool->begin(); diter != fGPool->end(); ++diter) {
+     nkmax = TMath::Max(nkmax, diter->second->XSecSumSpline()->NKnots());
+  }
+  char init_state[256];
+  int  nk = 0;
+  vector<double> E(nkmax), xsec(nkmax);
+  TTree * xs_tree = new TTree("gInitCacheXSec", "Total xsec splines per init state");
+  xs_tree->Branch("InitState", init_state,  "InitState/C");
+  xs_tree->Branch("NKnots",    &nk,         "NKnots/I");
+  xs_tree->Branch("E",         E.data(),    "E[NKnots]/D");
+  xs_tree->Branch("XSec",      xsec.data(), "XSec[NKnots]/D");
+  for(diter = fGPool->begin(); diter != fGPool->end(); ++diter) {
+     const Spline * spl = diter->second->XSecSumSpline();
+     strncpy(init_state, diter->first.c_str(), sizeof(init_state)-1);
+     init_state[sizeof(init_state)-1] = 0;
+     nk = spl->NKnots();
+     for(int i = 0; i < nk; i++) spl->GetKnot(i, E[i], xsec[i]);
+     xs_tree->Fill();
+  }
+
+  // max path lengths & probability scales
+  if(with_prob_scales) {
+     int    tgt = 0;
+     double pl  = 0;
+     TTree * pl_tree = new TTree("gInitCacheMaxPL", "Max path lengths per target");
+     pl_tree->Branch("Tgt", &tgt, "Tgt/I");
+     pl_tree->Branch("PL",  &pl,  "PL/D");
+     PathLengthList::const_iterator pliter = fMaxPathLengths.begin();
+     for( ; pliter != fMaxPathLengths.end(); ++pliter) {
+        tgt = pliter->first;
+        pl  = pliter->second;
+        pl_tree->Fill();
+     }
+     map<int,TH1D*>::const_iterator pmax_iter = fPmax.begin();
+     for( ; pmax_iter != fPmax.end(); ++pmax_iter) {
+        std::ostringstream name;
+        name << "gInitCachePmax_" << pmax_iter->first;
+        pmax_iter->second->Write(name.str().c_str());
+     }
+     TVectorD globpmax(1);
+     globpmax[0] = fGlobPmax;
+     globpmax.Write("gInitCacheGlobPmax");
+  }
+
+  file.Write();
+  file.Close();
+
+  LOG("GMCJDriver", pNOTICE)
+    << "Saved the total cross section splines"
+    << (with_prob_scales ? ", max path lengths & probability scales" : "")
+    << " in the init cache: " << fInitCacheFile;
+}
+//___________________________________________________________________________
 void GMCJDriver::InitEventGeneration(void)
 {
   fCurPathLengths.clear();
@@ -748,8 +1791,173 @@ EventRecord * GMCJDriver::GenerateEvent(void)
 {
   LOG("GMCJDriver", pNOTICE) << "Generating next event...";
 
+  return this->GenerateNextEvent();
+}
+//___________________________________________________________________________
+EventRecord * GMCJDriver::GenerateEvent(EventRecord & reuse)
+{
+  LOG("GMCJDriver", pNOTICE) << "Generating next event (re-using record)...";
+
+  fReuseEvt = &reuse;
+  EventRecord * event = this->GenerateNextEvent();
+  fReuseEvt = 0;
+
+  return event;
+}
+//___________________________________________________________________________
+unsigned int GMCJDriver::GenerateEvents(
+   unsigned int n, vector<EventRecord *> & events)
+{
+  events.reserve(events.size() + n);
+
+  return this->GenerateEvents(n,
+     [&events](EventRecord * event) { events.push_back(event); return true; });
+}
+//___________________________________________________________________________
+unsigned int GMCJDriver::GenerateEvents(unsigned int n, EventSink_t sink)
+{
+  LOG("GMCJDriver", pNOTICE) << "Generating a batch of " << n << " events...";
+
+  // with shuffling, generate the whole batch first
+  vector<EventRecord *> batch;
+  EventSink_t batch_sink = sink;
+  if(fShuffleBatches) {
+    batch.reserve(n);
+    batch_sink = [&batch](EventRecord * event) {
+      batch.push_back(event); return true; };
+  }
+
+  unsigned int ngen = 0;
+  while(ngen < n) {
+    if(fFluxDriver->End()) {
+       LOG("GMCJDriver", pNOTICE)
+           << "No more neutrinos can be thrown by the flux driver";
+       break;
+    }
+    EventRecord * event = this->GenerateNextEvent();
+    if(!event) continue;
+
+    ngen++;
+    if(!batch_sink(event)) break;
+  }
+
+  if(fShuffleBatches) {
+    RandomGen * rnd = RandomGen::Instance();
+    for(unsigned int i = batch.size(); i > 1; i--) {
+      std::swap(batch[i-1], batch[rnd->RndEvg().Integer(i)]);
+    }
+    unsigned int i = 0;
+    while(i < batch.size() && sink(batch[i++])) { }
+    // the sink ended the batch early: delete the events it didn't take
+    for( ; i < batch.size(); i++) delete batch[i];
+  }
+
+  LOG("GMCJDriver", pNOTICE) << "Generated " << ngen << " events in batch";
+  return ngen;
+}
+//___________________________________________________________________________
+bool GMCJDriver::SaveCheckpoint(string filename, Long64_t nevents) const
+{
+// The checkpoint is written in a temporary file which then replaces the
+// previous checkpoint, so that a job killed while checkpointing can still be
+// restarted from the previous one
+
+  string tmpfilename = filename + ".tmp";
+
+  TDirectory * prevdir = gDirectory;
+  TFile file(tmpfilename.c_str(), "RECREATE");
+  if(file.IsZombie()) {
+     LOG("GMCJDriver", pERROR)
+        << "Couldn't open checkpoint file: " << tmpfilename;
+     prevdir->cd();
+     return false;
+  }
+
+  TVectorD state(4);
+  state[0] = nevents;
+  state[1] = fIEvent;
+  state[2] = fNFluxNeutrinos;
+  state[3] = fGlobPmax;
+  file.cd();
+  state.Write("mcj_state");
+
+  bool ok = RandomGen::Instance()->SaveState(&file);
+
+  bool flux_ok = fFluxDriver->SaveState(file.mkdir("flux"));
+  if(!flux_ok) {
+     LOG("GMCJDriver", pWARN)
+        << "The flux driver doesn't support checkpointing: On restart, "
+        << "it will start from its initial state";
+  }
+  file.Close();
+  prevdir->cd();
+
+  if(!ok || gSystem->Rename(tmpfilename.c_str(), filename.c_str()) != 0) {
+     LOG("GMCJDriver", pERROR) << "Failed to write checkpoint: " << filename;
+     return false;
+  }
+
+  LOG("GMCJDriver", pNOTICE)
+     << "Saved checkpoint after " << nevents << " events in: " << filename;
+  return true;
+}
+//___________________________________________________________________________
+bool GMCJDriver::RestoreCheckpoint(string filename, Long64_t & nevents)
+{
+  nevents = 0;
+
+  TDirectory * prevdir = gDirectory;
+  TFile file(filename.c_str(), "READ");
+  if(file.IsZombie()) {
+     LOG("GMCJDriver", pERROR)
+        << "Couldn't open checkpoint file: " << filename;
+     prevdir->cd();
+     return false;
+  }
+
+  TVectorD * state = (TVectorD*) file.Get("mcj_state");
+  if(!state) {
+     LOG("GMCJDriver", pERROR) << "Not a GMCJDriver checkpoint: " << filename;
+     prevdir->cd();
+     return false;
+  }
+  nevents         = (Long64_t) (*state)[0];
+  fIEvent         = (long int) (*state)[1];
+  fNFluxNeutrinos =            (*state)[2];
+  double pmax     =            (*state)[3];
+  delete state;
+
+  if(TMath::Abs(pmax - fGlobPmax) > controls::kASmallNum * fGlobPmax) {
+     LOG("GMCJDriver", pWARN)
+        << "The interaction probability scale (" << fGlobPmax
+        << ") differs from the one of the checkpointed job (" << pmax
+        << "): Was the job configured identically?";
+  }
+
+  bool ok = RandomGen::Instance()->RestoreState(&file);
+
+  TDirectory * fluxdir = file.GetDirectory("flux");
+  if(fluxdir) fFluxDriver->RestoreState(fluxdir);
+
+  file.Close();
+  prevdir->cd();
+
+  if(ok) {
+     LOG("GMCJDriver", pNOTICE)
+        << "Restored checkpoint with " << nevents << " events from: "
+        << filename;
+  }
+  return ok;
+}
+//___________________________________________________________________________
+EventRecord * GMCJDriver::GenerateNextEvent(void)
+{
   this->InitEventGeneration();
 
+  // Re-key the random number streams (if independent, keyed streams are
+  // used) so that this event can be regenerated in isolation
+  RandomGen::Instance()->SetEventNumber(fIEvent++);
+
   while(1) {
     bool flux_end = fFluxDriver->End();
     if(flux_end) {
@@ -762,7 +1970,7 @@ EventRecord * GMCJDriver::GenerateEvent(void)
     if(event) return event;
 
     if(fKeepThrowingFluxNu) {
-         LOG("GMCJDriver", pNOTICE)
+         LOG("GMCJDriver", pINFO)
              << "Flux neutrino didn't interact - Trying the next one...";
          continue;
     }
@@ -788,6 +1996,8 @@ EventRecord * GMCJDriver::GenerateEvent1Try(void)
   if(!flux_ok) {
      LOG("GMCJDriver", pERROR)
         << "** Rejecting current flux neutrino (flux driver err)";
+     RunCounters::Instance()->Increment(
+        "GMCJDriver: rejected flux neutrinos (flux driver error)");
      return 0;
   }
 
@@ -796,8 +2006,9 @@ EventRecord * GMCJDriver::GenerateEvent1Try(void)
   // Many flux neutrinos should be rejected here, drastically reducing
   // the number of neutrinos that I need to propagate through the
   // actual detector geometry (this is skipped when using
-  // pre-calculated flux interaction probabilities)
-  if(fPreSelect) {
+  // pre-calculated flux interaction probabilities, or when forcing the
+  // flux neutrinos to interact)
+  if(fPreSelect && !fForceInteractions) {
        LOG("GMCJDriver", pNOTICE)
           << "Computing interaction probabilities for max. path lengths";
 
@@ -814,8 +2025,10 @@ EventRecord * GMCJDriver::GenerateEvent1Try(void)
            exit(1);
        }
        if(R>=1-Pno) {
-  	   LOG("GMCJDriver", pNOTICE)
+  	   LOG("GMCJDriver", pINFO)
               << "** Rejecting current flux neutrino";
+           RunCounters::Instance()->Increment(
+              "GMCJDriver: rejected flux neutrinos (max path lengths)");
 	   return 0;
        }
   } // preselect
@@ -824,22 +2037,45 @@ EventRecord * GMCJDriver::GenerateEvent1Try(void)
 
 
   // If possible use pre-generated flux neutrino interaction probabilities
-  if(fFluxIntTree){
+  if(fFluxIntTree && !fForceInteractions){
     Psum = this->PreGenFluxInteractionProbability();
   }
   // Else compute them in the usual manner
   else {
+    // If the geometry driver provides cheap upper bounds of the path lengths
+    // (eg from a voxel grid), reject the neutrino if it would not interact
+    // even with those: the exact path lengths could only lower Psum
+    if(fPreSelect && !fForceInteractions) {
+       const TLorentzVector & nup4 = fFluxDriver->Momentum();
+       const TLorentzVector & nux4 = fFluxDriver->Position();
+       bool bounds_ok =
+          fGeomAnalyzer->ComputePathLengthBounds(nux4, nup4, fCurPathLengths);
+       if(bounds_ok) {
+          Psum = this->ComputeInteractionProbabilities(false /* <- PL bounds */);
+          if(R>=Psum) {
+             LOG("GMCJDriver", pINFO)
+                << "** Rejecting current flux neutrino (path length bounds)";
+             RunCounters::Instance()->Increment(
+                "GMCJDriver: rejected flux neutrinos (path length bounds)");
+             return 0;
+          }
+       }
+    }
     // Compute (pathLength x density x weight fraction) for all materials
     // in the input geometry, for the neutrino generated by the flux driver
     pl_ok = this->ComputePathLengths();
     if(!pl_ok) {
        LOG("GMCJDriver", pERROR)
           << "** Rejecting current flux neutrino (err computing path-lengths)";
+       RunCounters::Instance()->Increment(
+          "GMCJDriver: rejected flux neutrinos (path length error)");
        return 0;
     }
     if(fCurPathLengths.AreAllZero()) {
-       LOG("GMCJDriver", pNOTICE)
+       LOG("GMCJDriver", pINFO)
           << "** Rejecting current flux neutrino (misses generation volume)";
+       RunCounters::Instance()->Increment(
+          "GMCJDriver: rejected flux neutrinos (misses generation volume)");
        return 0;
     }
     Psum = this->ComputeInteractionProbabilities(false /* <- actual PL */);
@@ -847,8 +2083,10 @@ EventRecord * GMCJDriver::GenerateEvent1Try(void)
 
 
   if(TMath::Abs(Psum) < controls::kASmallNum){
-    LOG("GMCJDriver", pNOTICE)
+    LOG("GMCJDriver", pINFO)
        << "** Rejecting current flux neutrino (has null interaction probability)";
+    RunCounters::Instance()->Increment(
+       "GMCJDriver: rejected flux neutrinos (null interaction probability)");
     return 0;
   }
 
@@ -880,9 +2118,15 @@ EventRecord * GMCJDriver::GenerateEvent1Try(void)
 
       exit(1);
   }
-  if(R>=1-Pno) {
-     LOG("GMCJDriver", pNOTICE)
+  if(fForceInteractions) {
+     // it interacts: select the target in proportion to the probabilities
+     R *= Psum;
+  }
+  else if(R>=1-Pno) {
+     LOG("GMCJDriver", pINFO)
         << "** Rejecting current flux neutrino";
+     RunCounters::Instance()->Increment(
+        "GMCJDriver: rejected flux neutrinos (no interaction)");
      return 0;
   }
 
@@ -892,7 +2136,7 @@ EventRecord * GMCJDriver::GenerateEvent1Try(void)
 
   // Calculate path lengths for first time and check potential mismatch if
   // used pre-generated flux interaction probabilities
-  if(fFluxIntTree){
+  if(fFluxIntTree && !fForceInteractions){
     pl_ok = this->ComputePathLengths();
     if(!pl_ok) {
       LOG("GMCJDriver", pFATAL) << "** Cannot calculate path lenths!";
@@ -991,12 +2235,21 @@ bool GMCJDriver::ComputePathLengths(void)
 // for all detector materials for the neutrino generated by the flux driver
 // and make sure that things look ok...
 
-  fCurPathLengths.clear();
-
   const TLorentzVector & nup4  = fFluxDriver -> Momentum ();
   const TLorentzVector & nux4  = fFluxDriver -> Position ();
 
-  fCurPathLengths = fGeomAnalyzer->ComputePathLengths(nux4, nup4);
+  long int iflux = fFluxDriver->Index();
+  bool use_cache = fUsePlCache && iflux >= 0;
+
+  if(use_cache && this->PathLengthsFromCache(iflux, nux4, nup4)) {
+     RunCounters::Instance()->Increment(
+        "GMCJDriver: path lengths re-used from cache");
+  } else {
+     fCurPathLengths = fGeomAnalyzer->ComputePathLengths(nux4, nup4);
+     if(use_cache) {
+        this->CachePathLengths(iflux, nux4, nup4, fCurPathLengths);
+     }
+  }
 
   LOG("GMCJDriver", pNOTICE) << fCurPathLengths;
 
@@ -1014,25 +2267,114 @@ bool GMCJDriver::ComputePathLengths(void)
   return true;
 }
 //___________________________________________________________________________
-double GMCJDriver::ComputeInteractionProbabilities(bool use_max_path_length)
+bool GMCJDriver::PathLengthsFromCache(
+   long int iflux, const TLorentzVector & x4, const TLorentzVector & p4)
 {
-  LOG("GMCJDriver", pNOTICE)
-       << "Computing relative interaction probabilities for each material";
+// Set the current path lengths from the cache, if the input flux entry was
+// cached for exactly the same ray
+
+  map<long int, long int>::const_iterator riter = fPlCacheRows.find(iflux);
+  if(riter == fPlCacheRows.end()) return false;
+
+  int ntgt = fMaxPathLengths.size();
+  const double * row = fPlCache.data() + riter->second * (kNPlCacheRay + ntgt);
+  bool same_ray =
+     row[0] == x4.X()  && row[1] == x4.Y()  && row[2] == x4.Z() &&
+     row[3] == p4.Px() && row[4] == p4.Py() && row[5] == p4.Pz();
+  if(!same_ray) return false;
+
+  // the list of targets is that of the max path lengths
+  if(fCurPathLengths.size() != fMaxPathLengths.size()) {
+     fCurPathLengths = fMaxPathLengths;
+  }
+  row += kNPlCacheRay;
+  PathLengthList::iterator pliter = fCurPathLengths.begin();
+  for( ; pliter != fCurPathLengths.end(); ++pliter, ++row) {
+     pliter->second = *row;
+  }
+  return true;
+}
+//___________________________________________________________________________
+void GMCJDriver::CachePathLengths(
+   long int iflux, const TLorentzVector & x4, const TLorentzVector & p4,
+   const double * pl)
+{
+// Store (or replace) the ray & path lengths (one per target, as iterated in
+// a PathLengthList) of the input flux entry in the cache
+
+  int ntgt  = fMaxPathLengths.size();
+  int nrow  = kNPlCacheRay + ntgt;
+
+  map<long int, long int>::const_iterator riter = fPlCacheRows.find(iflux);
+  long int irow = 0;
+  if(riter != fPlCacheRows.end()) {
+     irow = riter->second;
+  } else {
+     irow = fPlCacheRows.size();
+     fPlCacheRows[iflux] = irow;
+     fPlCache.resize((irow+1) * nrow);
+  }
+
+  double * row = fPlCache.data() + irow * nrow;
+  row[0] = x4.X();  row[1] = x4.Y();  row[2] = x4.Z();
+  row[3] = p4.Px(); row[4] = p4.Py(); row[5] = p4.Pz();
+  std::copy(pl, pl + ntgt, row + kNPlCacheRay);
+}
+//___________________________________________________________________________
+void GMCJDriver::CachePathLengths(
+   long int iflux, const TLorentzVector & x4, const TLorentzVector & p4,
+   const PathLengthList & plist)
+{
+  if(plist.size() != fMaxPathLengths.size()) return;
 
+  vector<double> pl;
+  PathLengthList::const_iterator pliter = plist.begin();
+  for( ; pliter != plist.end(); ++pliter) {
+     pl.push_back(pliter->second);
+  }
+  this->CachePathLengths(iflux, x4, p4, pl.data());
+}
+//___________________________________________________________________________
+double GMCJDriver::ComputeInteractionProbabilities(bool use_max_path_length)
+{
   // current flux neutrino code & 4-p
   int                    nupdg = fFluxDriver->PdgCode();
   const TLorentzVector & nup4  = fFluxDriver->Momentum();
 
-  fCurCumulProbMap.clear();
-
   const PathLengthList & path_length_list =
         (use_max_path_length) ? fMaxPathLengths : fCurPathLengths;
 
+  return this->ComputeInteractionProbabilities(nupdg, nup4, path_length_list);
+}
+//___________________________________________________________________________
+double GMCJDriver::ComputeInteractionProbabilities(
+  int nupdg, const TLorentzVector & nup4, const PathLengthList & path_length_list)
+{
+  LOG("GMCJDriver", pNOTICE)
+       << "Computing relative interaction probabilities for each material";
+
+  // the list of materials is normally the same for all flux neutrinos:
+  // the cummulative probability arrays are only resized if it changes
+  unsigned int nmat = path_length_list.size();
+  if(fCurCumulProb.size() != nmat) {
+     fCurCumulProb.resize(nmat);
+     fCurCumulProbTgt.resize(nmat);
+  }
+
+  // the probability scale depends only on the neutrino type & energy:
+  // it is looked up once, for the first material with a non-zero path-length
+  double pmax = -1;
+
+  // if tabulated, get the total xsecs for all materials in a single pass
+  bool use_table =
+     this->InterpolateXSecSumTable(nupdg, nup4.Energy(), path_length_list);
+
   double probsum=0;
   PathLengthList::const_iterator pliter;
 
+  int itgt = 0;
   for(pliter = path_length_list.begin();
-                            pliter != path_length_list.end(); ++pliter) {
+                   pliter != path_length_list.end(); ++pliter, ++itgt) {
      int    mpdg  = pliter->first;            // material PDG code
      double pl    = pliter->second;           // density x path-length
      int    A     = pdg::IonPdgCodeToA(mpdg);
@@ -1040,28 +2382,32 @@ double GMCJDriver::ComputeInteractionProbabilities(bool use_max_path_length)
      double prob  = 0.;                       // interaction probability
      double probn = 0.;                       // normalized interaction probability
 
-     // find the GEVGDriver object that is handling the current init state
-     InitialState init_state(mpdg, nupdg);
-     GEVGDriver * evgdriver = fGPool->FindDriver(init_state);
-     if(!evgdriver) {
-       LOG("GMCJDriver", pFATAL)
-        << "\n * The MC Job driver isn't properly configured!"
-        << "\n * No event generation driver could be found for init state: "
-        << init_state.AsString();
-       exit(1);
-     }
      // compute the interaction xsec and probability (if path-length>0)
-     if(pl>0.) {
+     if(pl>0. && use_table) {
+        xsec = fCurXSecSum[itgt];
+     }
+     else if(pl>0.) {
+        // find the GEVGDriver object that is handling the current init state
+        GEVGDriver * evgdriver = fGPool->FindDriver(nupdg, mpdg);
+        if(!evgdriver) {
+          LOG("GMCJDriver", pFATAL)
+           << "\n * The MC Job driver isn't properly configured!"
+           << "\n * No event generation driver could be found for init state: "
+           << InitialState(mpdg, nupdg).AsString();
+          exit(1);
+        }
         const Spline * totxsecspl = evgdriver->XSecSumSpline();
         if(!totxsecspl) {
             LOG("GMCJDriver", pFATAL)
               << "\n * The MC Job driver isn't properly configured!"
               << "\n * Couldn't retrieve total cross section spline for init state: "
-              << init_state.AsString();
+              << InitialState(mpdg, nupdg).AsString();
             exit(1);
         } else {
             xsec = totxsecspl->Evaluate( nup4.Energy() );
         }
+     }
+     if(pl>0.) {
         prob = this->InteractionProbability(xsec,pl,A);
         LOG("GMCJDriver", pDEBUG)
           << " (xsec, pl, A)=(" << xsec << "," << pl << "," << A << ")";
@@ -1069,15 +2415,17 @@ double GMCJDriver::ComputeInteractionProbabilities(bool use_max_path_length)
         // scale the interaction probability to the maximum one so as not
         // to have to throw few billions of flux neutrinos before getting
         // an interaction...
-        double pmax = 0;
-        if(fGenerateUnweighted) pmax = fGlobPmax;
-        else {
-           map<int,TH1D*>::const_iterator pmax_iter = fPmax.find(nupdg);
-           assert(pmax_iter != fPmax.end());
-           TH1D * pmax_hst = pmax_iter->second;
-           assert(pmax_hst);
-           int    ie   = pmax_hst->FindBin(nup4.Energy());
-           pmax = pmax_hst->GetBinContent(ie);
+        if(pmax < 0) {
+          if(fForceInteractions) pmax = 1.; // actual probabilities
+          else if(fGenerateUnweighted) pmax = fGlobPmax;
+          else {
+             map<int,TH1D*>::const_iterator pmax_iter = fPmax.find(nupdg);
+             assert(pmax_iter != fPmax.end());
+             TH1D * pmax_hst = pmax_iter->second;
+             assert(pmax_hst);
+             int    ie   = pmax_hst->FindBin(nup4.Energy());
+             pmax = pmax_hst->GetBinContent(ie);
+          }
         }
         assert(pmax>0);
         LOG("GMCJDriver", pDEBUG)
@@ -1091,7 +2439,8 @@ double GMCJDriver::ComputeInteractionProbabilities(bool use_max_path_length)
 #endif
 
      probsum += probn;
-     fCurCumulProbMap.insert(map<int,double>::value_type(mpdg,probsum));
+     fCurCumulProbTgt[itgt] = mpdg;
+     fCurCumulProb   [itgt] = probsum;
   }
   return probsum;
 }
@@ -1102,16 +2451,14 @@ int GMCJDriver::SelectTargetMaterial(double R)
 // for a flux neutrino that has already been determined that interacts
 
   LOG("GMCJDriver", pNOTICE) << "Selecting target material";
-  int tgtpdg = 0;
-  map<int,double>::const_iterator probiter = fCurCumulProbMap.begin();
-  for( ; probiter != fCurCumulProbMap.end(); ++probiter) {
-     double prob = probiter->second;
-     if(R<prob) {
-        tgtpdg = probiter->first;
-        LOG("GMCJDriver", pNOTICE)
-          << "Selected target material = " << tgtpdg;
-        return tgtpdg;
-     }
+  // binary search for the first material with R < cummulative probability
+  vector<double>::const_iterator probiter =
+     std::upper_bound(fCurCumulProb.begin(), fCurCumulProb.end(), R);
+  if(probiter != fCurCumulProb.end()) {
+     int tgtpdg = fCurCumulProbTgt[probiter - fCurCumulProb.begin()];
+     LOG("GMCJDriver", pNOTICE)
+       << "Selected target material = " << tgtpdg;
+     return tgtpdg;
   }
   LOG("GMCJDriver", pERROR)
      << "Could not select target material for an interacting neutrino";
@@ -1125,11 +2472,11 @@ void GMCJDriver::GenerateEventKinematics(void)
 
   // Find the GEVGDriver object that generates interactions for the
   // given initial state (neutrino + target)
-  InitialState init_state(fSelTgtPdg, nupdg);
-  GEVGDriver * evgdriver = fGPool->FindDriver(init_state);
+  GEVGDriver * evgdriver = fGPool->FindDriver(nupdg, fSelTgtPdg);
   if(!evgdriver) {
      LOG("GMCJDriver", pFATAL)
-       << "No GEVGDriver object for init state: " << init_state.AsString();
+       << "No GEVGDriver object for init state: "
+       << InitialState(fSelTgtPdg, nupdg).AsString();
      exit(1);
   }
 
@@ -1140,7 +2487,7 @@ void GMCJDriver::GenerateEventKinematics(void)
   // the selected initial state & neutrino 4-momentum
   LOG("GMCJDriver", pNOTICE)
           << "Asking the selected GEVGDriver object to generate an event";
-  fCurEvt = evgdriver->GenerateEvent(nup4);
+  fCurEvt = evgdriver->GenerateEvent(nup4, fReuseEvt);
 }
 //___________________________________________________________________________
 void GMCJDriver::GenerateVertexPosition(void)
@@ -1196,7 +2543,11 @@ void GMCJDriver::ComputeEventProbability(void)
   double Ev     = nu->P4()->Energy();
 
   double weight = 1.0;
-  if(!fGenerateUnweighted) {
+  if(fForceInteractions) {
+     // total interaction probability of the flux neutrino in the geometry
+     weight = fCurCumulProb.back();
+  }
+  else if(!fGenerateUnweighted) {
      map<int,TH1D*>::const_iterator pmax_iter = fPmax.find(nu_pdg);
      assert(pmax_iter != fPmax.end());
      TH1D * pmax_hst = pmax_iter->second;
@@ -1205,6 +2556,9 @@ void GMCJDriver::ComputeEventProbability(void)
      assert(pmax>0);
      weight = pmax/fGlobPmax;
   }
+  if(fFoldFluxWeights) {
+     weight *= fFluxDriver->Weight();
+  }
 
   // set probability & update weight
   fCurEvt->SetProbability(P);
@@ -22,6 +22,8 @@
 
 #include <string>
 #include <map>
+#include <vector>
+#include <functional>
 
 #include <TH1D.h>
 #include <TLorentzVector.h>
@@ -34,6 +36,7 @@
 
 using std::string;
 using std::map;
+using std::vector;
 
 namespace genie {
 
@@ -58,17 +61,87 @@ public :
   bool UseMaxPathLengths           (string xml_filename);
   void KeepOnThrowingFluxNeutrinos (bool keep_on);
   void ForceSingleProbScale        (void);
+  void ForceInteractions           (bool on = true);
   void PreSelectEvents             (bool preselect = true);
+  void UseTabulatedXSecSums        (bool on = true, int nE = 5000);
+  void UseChannelTables            (bool on = true, int nE = 1000);
+  void UsePathLengthCache          (bool on = true);
+  void UseInitCache                (string filename, string key = "");
+  void ShuffleBatches              (bool on = true);
+  void FoldFluxWeights             (bool on = true);
+  bool LoadPathLengthCache         (string filename);
+  bool SavePathLengthCache         (string filename) const;
   bool PreCalcFluxProbabilities    (void);
   bool LoadFluxProbabilities       (string filename);
   void SaveFluxProbabilities       (string outfilename);
+  void SetFluxProbabilitiesPartition (int ijob, int njobs);
+  void UseLowMemoryMode            (bool on = true);
   void Configure                   (bool calc_prob_scales = true);
 
+  // report the (approximate) memory held by the xsec splines, the cache and
+  // the event generation drivers, and the resident memory of the process.
+  // Printed at the end of Configure(), and on demand
+  void PrintMemoryUsage (void) const;
+
   // generate single neutrino event for input flux & geometry
   EventRecord * GenerateEvent (void);
+  // as above, but re-fill the input (caller-owned) event record rather than
+  // allocating a new one; its particle slots, flags & summary are recycled.
+  // Returns &reuse, or 0 if no event was generated
+  EventRecord * GenerateEvent (EventRecord & reuse);
+
+  // generate a batch of (up to) n events for input flux & geometry:
+  // Events are appended to the input vector, or handed over one at a time to
+  // the input sink which takes ownership of them (returning false from the
+  // sink ends the batch early). Flux neutrinos that do not interact are not
+  // returned. The batch ends early if the flux driver runs out of neutrinos.
+  // Returns the number of events generated. The per-event driver banner is
+  // replaced by a single per-batch message. With ShuffleBatches(), the events
+  // of a batch are generated first and then handed over in random order.
+  typedef std::function<bool (EventRecord *)> EventSink_t;
+
+  unsigned int GenerateEvents (unsigned int n, vector<EventRecord *> & events);
+  unsigned int GenerateEvents (unsigned int n, EventSink_t sink);
+
+  // event rate calculator, with no event generation (no kinematics,
+  // hadronization or FSI): ComputeEventRates(), called after Configure(),
+  // sums the flux weight x interaction probability in the geometry of (up to
+  // nflux, or a full cycle of) the flux neutrinos, for each enabled channel.
+  // The rates are for the flux normalization of the flux driver.
+  struct EventRate {
+    int    fNuPdg;    ///< neutrino pdg code
+    int    fTgtPdg;   ///< target material pdg code
+    string fChannel;  ///< interaction, as in Interaction::AsString()
+    double fRate;     ///< sum{flux weight x interaction probability}
+    double fRateErr;  ///< statistical error of fRate
+  };
+  bool ComputeEventRates (vector<EventRate> & rates, Long64_t nflux = -1);
+
+  // checkpoint / restart of long MC jobs:
+  // SaveCheckpoint() saves the random number generator state, the flux driver
+  // cursor & accumulators (if supported by the flux driver) and the job
+  // counters, together with the number of events written out so far.
+  // RestoreCheckpoint(), called on a driver configured exactly as in the
+  // original job, restores them and returns the number of saved events.
+  // Pair with NtpWriter::Checkpoint() / NtpWriter::Resume().
+  bool SaveCheckpoint    (string filename, Long64_t nevents) const;
+  bool RestoreCheckpoint (string filename, Long64_t & nevents);
+
+  // multi-threaded event generation:
+  // Call EnableMultiThreading() once, from the main thread, before any
+  // GMCJDriver is configured. Then use one GMCJDriver per worker thread, each
+  // with its own flux driver and geometry analyzer, and call RandomGen::SetSeed()
+  // from each worker with a distinct seed. Algorithms, caches and random number
+  // generators are per-thread. The config pool, the spline list and the
+  // hadron-transport data tables are shared. Splines should be loaded (or
+  // computed by a driver configured in the main thread) before workers start.
+  static void EnableMultiThreading (void);
+  static bool IsMultiThreaded      (void) { return fMultiThreaded; }
 
   // info needed for computing the generated sample normalization
-  double   GlobProbScale  (void) const { return fGlobPmax;                  }
+  // (with ForceInteractions(), the probability scale is 1: the interaction
+  // probabilities are carried by the event weights)
+  double   GlobProbScale  (void) const { return fForceInteractions ? 1. : fGlobPmax; }
   long int NFluxNeutrinos (void) const { return (long int) fNFluxNeutrinos; }
   map<int, double> SumFluxIntProbs(void) const { return fSumFluxIntProbs;   }
 
@@ -89,11 +162,21 @@ private:
   void          PopulateEventGenDriverPool      (void);
   void          BootstrapXSecSplines            (void);
   void          BootstrapXSecSplineSummation    (void);
+  void          BuildXSecSumTable               (void);
+  bool          InterpolateXSecSumTable         (int nupdg, double Ev, const PathLengthList & plist);
+  bool          PathLengthsFromCache            (long int iflux, const TLorentzVector & x4, const TLorentzVector & p4);
+  void          CachePathLengths                (long int iflux, const TLorentzVector & x4, const TLorentzVector & p4, const double * pl);
+  void          CachePathLengths                (long int iflux, const TLorentzVector & x4, const TLorentzVector & p4, const PathLengthList & pl);
   void          ComputeProbScales               (void);
+  string        InitCacheKey                    (void) const;
+  bool          LoadInitCache                   (bool with_prob_scales);
+  void          SaveInitCache                   (bool with_prob_scales) const;
+  EventRecord * GenerateNextEvent               (void);
   EventRecord * GenerateEvent1Try               (void);
   bool          GenerateFluxNeutrino            (void);
   bool          ComputePathLengths              (void);
   double	ComputeInteractionProbabilities (bool use_max_path_length);
+  double        ComputeInteractionProbabilities (int nupdg, const TLorentzVector & nup4, const PathLengthList & pl);
   int           SelectTargetMaterial            (double R);
   void          GenerateEventKinematics         (void);
   void          GenerateVertexPosition          (void);
@@ -102,6 +185,7 @@ private:
   double        PreGenFluxInteractionProbability(void);
 
   // private data members:
+  static bool     fMultiThreaded;      ///< [config] were shared singletons prepared for concurrent event generation?
   GEVGPool *      fGPool;              ///< A pool of GEVGDrivers properly configured event generation drivers / one per init state
   GFluxI *        fFluxDriver;         ///< [input] neutrino flux driver
   GeomAnalyzerI * fGeomAnalyzer;       ///< [input] detector geometry analyzer
@@ -112,9 +196,12 @@ private:
   PathLengthList  fCurPathLengths;     ///< [current] path length list for current flux neutrino
   TLorentzVector  fCurVtx;             ///< [current] interaction vertex
   EventRecord *   fCurEvt;             ///< [current] generated event
+  EventRecord *   fReuseEvt;           ///< [current] caller-owned event record to re-fill, if any
   int             fSelTgtPdg;          ///< [current] selected target material PDG code
-  map<int,double> fCurCumulProbMap;    ///< [current] cummulative interaction probabilities
+  vector<int>     fCurCumulProbTgt;    ///< [current] target materials, in the order of the cummulative interaction probabilities below
+  vector<double>  fCurCumulProb;       ///< [current] cummulative interaction probabilities (flat array, re-used across flux neutrinos)
   double          fNFluxNeutrinos;     ///< [current] number of flux nuetrinos fired by the flux driver so far
+  long int        fIEvent;             ///< [current] number of GenerateEvent() calls so far (keys independent rnd streams, if used)
   map<int,TH1D*>  fPmax;               ///< [computed at init] interaction probability scale /neutrino /energy for given geometry
   double          fGlobPmax;           ///< [computed at init] global interaction probability scale for given flux & geometry
   string          fEventGenList;       ///< [config] list of event generators loaded by this driver (what used to be the $GEVGL setting)
@@ -125,7 +212,24 @@ private:
   bool            fUseLogE;            ///< [config] build splines = f(logE) (rather than f(E)) ?
   bool            fKeepThrowingFluxNu; ///< [config] keep firing flux neutrinos till one of them interacts
   bool            fGenerateUnweighted; ///< [config] force single probability scale?
+  bool            fForceInteractions;  ///< [config] make every flux neutrino crossing the geometry interact, weighting the event by its interaction probability?
   bool            fPreSelect;          ///< [config] set whether to pre-select events using max interaction paths
+  bool            fUseXSecSumTable;    ///< [config] use tabulated total xsecs (all targets at once) when computing interaction probabilities?
+  int             fXSecSumTableNE;     ///< [config] number of energy points in the tabulated total xsecs
+  double          fXSecSumTableDE;     ///< [computed at init] energy step of the tabulated total xsecs
+  bool            fUseChannelTables;   ///< [config] select interactions from tabulated cumulative xsecs (see XSecChannelTable)?
+  int             fChannelTableNE;     ///< [config] number of energy points in the tabulated cumulative xsecs
+  vector<int>     fXSecSumTableTgt;    ///< [computed at init] target codes of the tabulated total xsecs (ascending, as iterated in a PathLengthList)
+  map<int, vector<double> > fXSecSumTable; ///< [computed at init] nu code -> total xsec at each (energy point, target), targets contiguous
+  vector<double>  fCurXSecSum;         ///< [current] total xsec for each tabulated target at the current flux neutrino energy
+  bool            fUsePlCache;         ///< [config] re-use the path lengths computed for the same flux entry & ray?
+  string          fInitCacheFile;      ///< [config] file with the total xsec splines & prob scales of an earlier job with the same key (see UseInitCache())
+  string          fInitCacheKey;       ///< [config] user part of the key of the init cache (eg geometry & flux file names)
+  bool            fShuffleBatches;     ///< [config] hand over the events of a batch in random order?
+  bool            fFoldFluxWeights;    ///< [config] multiply the event weights by the flux neutrino weights?
+  bool            fLowMemory;          ///< [config] drop the xsec splines & cache branches not needed for event generation at the end of Configure()?
+  map<long int, long int> fPlCacheRows; ///< [current] flux entry index -> row of the path length cache
+  vector<double>  fPlCache;            ///< [current] path length cache rows: ray position (3), momentum (3) & path length per target (as iterated in a PathLengthList)
   TFile*          fFluxIntProbFile;    ///< [input] pre-generated flux interaction probability file
   TTree*          fFluxIntTree;        ///< [computed-or-loaded] pre-computed flux interaction probabilities (expected tree name is "gFlxIntProbs")
   double          fBrFluxIntProb;      ///< flux interaction probability (set to branch:"FluxIntProb")
@@ -135,6 +239,8 @@ private:
   int             fBrFluxPDG;          ///< corresponding flux pdg code (set to address of branch: "FluxPDG")
   string          fFluxIntFileName;    ///< whether to save pre-generated flux tree for use in later jobs
   string          fFluxIntTreeName;    ///< name for tree holding flux probabilities
+  int             fFluxProbIJob;       ///< [config] part of the flux entries whose interaction probabilities are pre-calculated by this job
+  int             fFluxProbNJobs;      ///< [config] number of parts the pre-calculation of the flux interaction probabilities is split into
   map<int, double> fSumFluxIntProbs;   ///< map where the key is flux pdg code and the value is sum of fBrFluxWeight * fBrFluxIntProb for all these flux neutrinos
 };
 
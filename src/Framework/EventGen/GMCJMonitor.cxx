@@ -11,6 +11,14 @@
 #include <sstream>
 #include <fstream>
 #include <cstdlib>
+#include <cstdio>
+#include <ctime>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
 
 #include <TSystem.h>
 #include <TMath.h>
@@ -20,6 +28,7 @@
 #include "Framework/GHEP/GHepParticle.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/RunCounters.h"
 
 using std::ostringstream;
 using std::endl;
@@ -28,16 +37,35 @@ using std::ofstream;
 
 using namespace genie;
 
+//____________________________________________________________________________
+struct GMCJMonitor::StatusThread
+{
+  std::thread             thread;
+  std::mutex              mutex;
+  std::condition_variable cond;     ///< signals stop
+  bool                    stop;
+  double                  period;   ///< s between status records
+  std::atomic<long>       nev;      ///< events generated so far
+  std::chrono::steady_clock::time_point start;
+  std::clock_t            cpu_start;
+};
 //____________________________________________________________________________
 GMCJMonitor::GMCJMonitor(Long_t runnu) :
-fRunNu(runnu)
+fRunNu(runnu),
+fStatusThread(0)
 {
   this->Init();
 }
 //____________________________________________________________________________
 GMCJMonitor::~GMCJMonitor()
 {
+  this->StopStatusThread();
 
+  // summary of the hot-path counters at the end of the job
+  RunCounters * counters = RunCounters::Instance();
+  if(!counters->IsEmpty()) {
+    LOG("GMCJMonitor", pNOTICE) << *counters;
+  }
 }
 //____________________________________________________________________________
 void GMCJMonitor::SetRefreshRate(int rate)
@@ -45,8 +73,32 @@ void GMCJMonitor::SetRefreshRate(int rate)
   fRefreshRate = TMath::Max(1,rate);
 }
 //____________________________________________________________________________
+void GMCJMonitor::SetLightweight(bool on, double period)
+{
+  this->StopStatusThread();
+  if(!on) return;
+
+  fStatusThread = new StatusThread;
+  fStatusThread->stop      = false;
+  fStatusThread->period    = TMath::Max(0.1, period);
+  fStatusThread->nev       = 0;
+  fStatusThread->start     = std::chrono::steady_clock::now();
+  fStatusThread->cpu_start = std::clock();
+  fStatusThread->thread    = std::thread(&GMCJMonitor::RunStatusThread, this);
+
+  LOG("GMCJMonitor", pNOTICE)
+     << "Writing a status record in " << fStatusFile
+     << " every " << fStatusThread->period << " s";
+}
+//____________________________________________________________________________
 void GMCJMonitor::Update(int iev, const EventRecord * event)
 {
+  // in lightweight mode, just record the progress for the status thread
+  if(fStatusThread) {
+    fStatusThread->nev.store(iev+1, std::memory_order_relaxed);
+    return;
+  }
+
   if(iev%fRefreshRate) return; // continue only every fRefreshRate events
 
   fWatch.Stop();
@@ -67,6 +119,8 @@ void GMCJMonitor::Update(int iev, const EventRecord * event)
   if(!event) status << "NULL" << endl;
   else       status << *event << endl;
 
+  status << *RunCounters::Instance();
+
   out << status.str();
   out.close();
 
@@ -91,11 +145,95 @@ void GMCJMonitor::Init(void)
   } else fRefreshRate = 100;
 
   fRefreshRate = TMath::Max(1,fRefreshRate);
+
+  // lightweight (background thread) status record?
+  const char * lite = gSystem->Getenv("GMCJMONLITE");
+  if( lite && atoi(lite) > 0 ) {
+    const char * period = gSystem->Getenv("GMCJMONPERIOD");
+    this->SetLightweight(true, period ? atof(period) : 30.);
+  }
+}
+//____________________________________________________________________________
+void GMCJMonitor::RunStatusThread(void)
+{
+  StatusThread * st = fStatusThread;
+  std::chrono::duration<double> period(st->period);
+
+  std::unique_lock<std::mutex> lock(st->mutex);
+  while(!st->stop) {
+    st->cond.wait_for(lock, period, [st] { return st->stop; });
+    string filename = fStatusFile;
+    lock.unlock();
+    this->WriteStatusRecord(filename);
+    lock.lock();
+  }
+}
+//____________________________________________________________________________
+void GMCJMonitor::StopStatusThread(void)
+{
+  if(!fStatusThread) return;
+  {
+    std::lock_guard<std::mutex> lock(fStatusThread->mutex);
+    fStatusThread->stop = true;
+  }
+  fStatusThread->cond.notify_all();
+  fStatusThread->thread.join();   // writes a last record on exit
+  delete fStatusThread;
+  fStatusThread = 0;
+}
+//____________________________________________________________________________
+void GMCJMonitor::WriteStatusRecord(string filename) const
+{
+  const StatusThread * st = fStatusThread;
+
+  long   nev  = st->nev.load(std::memory_order_relaxed);
+  double wall = std::chrono::duration<double>(
+                   std::chrono::steady_clock::now() - st->start).count();
+  double cpu  = double(std::clock() - st->cpu_start) / CLOCKS_PER_SEC;
+
+  ostringstream status;
+  status << "# GENIE MC job status" << endl;
+  status << "genie_mcjob_run "                     << fRunNu << endl;
+  status << "genie_mcjob_events "                  << nev    << endl;
+  status << "genie_mcjob_wall_time_seconds "       << wall   << endl;
+  status << "genie_mcjob_cpu_time_seconds "        << cpu    << endl;
+  status << "genie_mcjob_event_rate_hz "
+         << ((wall > 0) ? nev/wall : 0.) << endl;
+  status << "genie_mcjob_time_per_event_seconds "
+         << ((nev  > 0) ? wall/nev : 0.) << endl;
+
+  std::map<string, long> counters = RunCounters::Instance()->Counters();
+  std::map<string, long>::const_iterator it = counters.begin();
+  for( ; it != counters.end(); ++it) {
+    string name;
+    for(unsigned int i = 0; i < it->first.size(); i++) {
+      char c = it->first[i];
+      if(c == '"' || c == '\\') name += '\\';
+      name += c;
+    }
+    status << "genie_mcjob_counter{name=\"" << name << "\"} "
+           << it->second << endl;
+  }
+
+  // write under a temporary name & rename, so that readers see either the
+  // previous or the new record
+  string tmpfile = filename + ".tmp";
+  FILE * out = fopen(tmpfile.c_str(), "w");
+  if(!out) return;
+  string record = status.str();
+  bool ok = fwrite(record.data(), 1, record.size(), out) == record.size();
+  ok = (fclose(out) == 0) && ok;
+  if(ok) rename(tmpfile.c_str(), filename.c_str());
 }
 //____________________________________________________________________________
 
 void GMCJMonitor::CustomizeFilename(string filename)
 {
+  if(fStatusThread) {
+    std::lock_guard<std::mutex> lock(fStatusThread->mutex);
+    fStatusFile = filename;
+    return;
+  }
   fStatusFile = filename;
 }
 //____________________________________________________________________________
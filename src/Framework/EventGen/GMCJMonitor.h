@@ -7,6 +7,17 @@
          This is used to be able to keep track of an MC job status even when
          all output is suppressed or redirected to /dev/null.
 
+         In the default mode the status file (with a print-out of the last
+         event) is rewritten every so many events (GMCJMONREFRESH, default
+         100) by the generating thread.
+         In the lightweight mode (SetLightweight(), or GMCJMONLITE=1) Update()
+         only records the event number, and a background thread replaces the
+         status file every few seconds (GMCJMONPERIOD, default 30) with a
+         short record in the Prometheus text format (events, rate, time per
+         event and the RunCounters counts), eg for the node exporter textfile
+         collector. The file is written under a temporary name and renamed,
+         so readers never see a partial record.
+
 \author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
  University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -20,8 +31,12 @@
 #ifndef _G_MC_JOB_MONITOR_H_
 #define _G_MC_JOB_MONITOR_H_
 
+#include <string>
+
 #include <TStopwatch.h>
 
+using std::string;
+
 namespace genie {
 
 class EventRecord;
@@ -33,18 +48,26 @@ public :
  ~GMCJMonitor();
 
   void SetRefreshRate (int rate);
+  void SetLightweight (bool on, double period = 30.); ///< period in s
   void Update (int iev, const EventRecord * event);
   void CustomizeFilename(string filename);
+  string Filename (void) const { return fStatusFile; }
 
 private:
 
-  void Init (void);
+  struct StatusThread;
+
+  void Init              (void);
+  void RunStatusThread   (void);
+  void StopStatusThread  (void);
+  void WriteStatusRecord (string filename) const;
 
-  Long_t     fRunNu;       ///< run number
-  string     fStatusFile;  ///< name of output status file
-  TStopwatch fWatch;
-  double     fCpuTime;     ///< total cpu time so far
-  int        fRefreshRate; ///< update output every so many events
+  Long_t         fRunNu;        ///< run number
+  string         fStatusFile;   ///< name of output status file
+  TStopwatch     fWatch;
+  double         fCpuTime;      ///< total cpu time so far
+  int            fRefreshRate;  ///< update output every so many events
+  StatusThread * fStatusThread; //!< lightweight mode writer thread, if running
 };
 
 }      // genie namespace
@@ -23,3 +23,15 @@ GeomAnalyzerI::~GeomAnalyzerI()
 
 }
 //____________________________________________________________________________
+bool GeomAnalyzerI::ComputePathLengthBounds(
+       const TLorentzVector & /*x*/, const TLorentzVector & /*p*/,
+       PathLengthList & /*pl*/)
+{
+  return false;
+}
+//____________________________________________________________________________
+bool GeomAnalyzerI::SetThreadSafeNavigation(int max_threads)
+{
+  return (max_threads < 2);
+}
+//____________________________________________________________________________
@@ -46,6 +46,18 @@ public :
             GenerateVertex (
               const TLorentzVector & x, const TLorentzVector & p, int tgtpdg) = 0;
 
+  // optional: cheap upper bounds of the ComputePathLengths() path lengths,
+  // used to reject flux neutrinos before the exact path lengths are computed
+  // (returns false if the analyzer can not provide them)
+  virtual bool
+            ComputePathLengthBounds (
+              const TLorentzVector & x, const TLorentzVector & p, PathLengthList & pl);
+
+  // optional: allow ComputePathLengths() to be called concurrently by up to
+  // max_threads threads (returns false if the analyzer can not support it)
+  virtual bool
+            SetThreadSafeNavigation (int max_threads);
+
 protected:
 
   GeomAnalyzerI();
@@ -17,8 +17,11 @@
 #include "Framework/EventGen/InteractionGeneratorMap.h"
 #include "Framework/EventGen/EventGeneratorI.h"
 #include "Framework/EventGen/InteractionListGeneratorI.h"
+#include "Framework/EventGen/XSecAlgorithmI.h"
+#include "Framework/EventGen/XSecChannelTable.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/XSecSplineList.h"
 
 using std::setw;
 using std::setfill;
@@ -44,6 +47,7 @@ InteractionGeneratorMap::InteractionGeneratorMap(
                                      const InteractionGeneratorMap & igmap) :
 map<string, const EventGeneratorI *> ()
 {
+  this->Init();
   this->Copy(igmap);
 }
 //___________________________________________________________________________
@@ -64,12 +68,19 @@ void InteractionGeneratorMap::Init(void)
 
   fInitState       = new InitialState;
   fInteractionList = new InteractionList;
+
+  fXSecSplines.clear();
+  fXSecSplinesRevision = -1;
+
+  fChannelTable = 0;
 }
 //___________________________________________________________________________
 void InteractionGeneratorMap::CleanUp(void)
 {
   delete fInitState;
   delete fInteractionList;
+  if(fChannelTable) delete fChannelTable;
+  fChannelTable = 0;
 
   this->clear();
 }
@@ -81,6 +92,13 @@ void InteractionGeneratorMap::Copy(const InteractionGeneratorMap & xsmap)
   fInitState       -> Copy (*xsmap.fInitState);
   fInteractionList -> Copy (*xsmap.fInteractionList);
 
+  fXSecSplines.clear();
+  fXSecSplinesRevision = -1;
+
+  // the channel table is not copied (see AdoptChannelTable())
+  if(fChannelTable) delete fChannelTable;
+  fChannelTable = 0;
+
   this->clear();
 
   InteractionGeneratorMap::const_iterator iter;
@@ -111,13 +129,15 @@ void InteractionGeneratorMap::BuildMap(const InitialState & init_state)
   }
 
   fInitState->Copy(init_state);
+  fXSecSplinesRevision = -1;
 
   EventGeneratorList::const_iterator evgliter; // event generator list iter
   InteractionList::iterator          intliter; // interaction list iter
 
   // loop over all EventGenerator objects used in the current job
+  int igen = 0;
   for(evgliter = fEventGeneratorList->begin();
-                       evgliter != fEventGeneratorList->end(); ++evgliter) {
+              evgliter != fEventGeneratorList->end(); ++evgliter, ++igen) {
      // current EventGenerator
      const EventGeneratorI * evgen = *evgliter;
      assert(evgen);
@@ -128,20 +148,19 @@ void InteractionGeneratorMap::BuildMap(const InitialState & init_state)
         << "Querying [" << evgen->Id().Key() << "] for its InteractionList";
 
      const InteractionListGeneratorI * ilstgen = evgen->IntListGenerator();
-     InteractionList * ilst = ilstgen->CreateInteractionList(init_state);
+     InteractionList * ilst =
+         ilstgen->CreateInteractionListFromTemplate(init_state);
 
      // no point to go on if the list is NULL - continue to next iteration
      if(!ilst) continue;
 
-     // append the new InteractionList to the local copy
-     fInteractionList->Append(*ilst);
-
      // loop over all interaction that can be genererated by the current
      // EventGenerator and link all of them to iy
      for(intliter = ilst->begin(); intliter != ilst->end(); ++intliter)
      {
         // current interaction
         Interaction * interaction = *intliter;
+        interaction->SetGeneratorIndex(igen);
         string code = interaction->AsString();
 
         SLOG("IntGenMap", pDEBUG)
@@ -149,6 +168,10 @@ void InteractionGeneratorMap::BuildMap(const InitialState & init_state)
         this->insert(
              map<string, const EventGeneratorI *>::value_type(code,evgen));
      } // loop over interactions
+
+     // append the new InteractionList to the local copy
+     fInteractionList->Append(*ilst);
+
      delete ilst;
      ilst = 0;
   } // loop over event generators
@@ -161,6 +184,14 @@ const EventGeneratorI * InteractionGeneratorMap::FindGenerator(
     LOG("IntGenMap", pWARN) << "Null interaction!!";
     return 0;
   }
+
+  // interactions selected from the interaction list know their generator
+  int igen = interaction->GeneratorIndex();
+  if(fEventGeneratorList && igen >= 0 &&
+     igen < (int) fEventGeneratorList->size()) {
+    return (*fEventGeneratorList)[igen];
+  }
+
   string code = interaction->AsString();
   InteractionGeneratorMap::const_iterator evgiter = this->find(code);
   if(evgiter == this->end()) {
@@ -177,6 +208,48 @@ const InteractionList & InteractionGeneratorMap::GetInteractionList(void) const
   return *fInteractionList;
 }
 //___________________________________________________________________________
+const Spline * InteractionGeneratorMap::XSecSpline(unsigned int ientry) const
+{
+  if(fXSecSplinesRevision != XSecSplineList::Instance()->Revision()) {
+    this->ResolveXSecSplines();
+  }
+  if(ientry >= fXSecSplines.size()) return 0;
+
+  return fXSecSplines[ientry];
+}
+//___________________________________________________________________________
+void InteractionGeneratorMap::AdoptChannelTable(XSecChannelTable * table)
+{
+  if(fChannelTable) delete fChannelTable;
+  fChannelTable = table;
+}
+//___________________________________________________________________________
+void InteractionGeneratorMap::ResolveXSecSplines(void) const
+{
+// Look-up the xsec spline of each interaction list entry once, so that the
+// spline keys need not be rebuilt every time an interaction is selected
+
+  XSecSplineList * xssl = XSecSplineList::Instance();
+
+  unsigned int n = fInteractionList->size();
+  fXSecSplines.assign(n, (const Spline *) 0);
+
+  for(unsigned int i = 0; i < n; i++) {
+    const Interaction * interaction = (*fInteractionList)[i];
+    const EventGeneratorI * evg = this->FindGenerator(interaction);
+    if(!evg) continue;
+    const XSecAlgorithmI * xsec_alg = evg->CrossSectionAlg();
+    if(!xsec_alg) continue;
+    if(xssl->SplineExists(xsec_alg, interaction)) {
+      fXSecSplines[i] = xssl->GetSpline(xsec_alg, interaction);
+    }
+  }
+  fXSecSplinesRevision = xssl->Revision();
+
+  SLOG("IntGenMap", pDEBUG)
+     << "Resolved xsec spline handles for " << n << " interactions";
+}
+//___________________________________________________________________________
 void InteractionGeneratorMap::Print(ostream & stream) const
 {
   stream << endl;
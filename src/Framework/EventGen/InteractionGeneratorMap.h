@@ -22,12 +22,14 @@
 #define _INTERACTION_GENERATOR_MAP_H_
 
 #include <map>
+#include <vector>
 #include <string>
 #include <ostream>
 
 #include "Framework/Interaction/Interaction.h"
 
 using std::map;
+using std::vector;
 using std::string;
 using std::ostream;
 
@@ -38,6 +40,8 @@ class EventGeneratorI;
 class InteractionList;
 class InitialState;
 class EventGeneratorList;
+class Spline;
+class XSecChannelTable;
 
 ostream & operator << (ostream & stream, const InteractionGeneratorMap & xsmap);
 
@@ -54,6 +58,17 @@ public :
   const EventGeneratorI * FindGenerator      (const Interaction * in) const;
   const InteractionList & GetInteractionList (void) const;
 
+  //! Handle to the xsec spline of the i^th interaction list entry (null if
+  //! there is no such spline). Handles are resolved at the first call and then
+  //! only re-resolved if the contents of the XSecSplineList change.
+  const Spline * XSecSpline (unsigned int ientry) const;
+
+  //! Cumulative xsec table of the interaction list entries, used to select
+  //! interactions quickly (null if none was built, see GEVGDriver).
+  //! The map takes ownership of the adopted table.
+  void                     AdoptChannelTable (XSecChannelTable * table);
+  const XSecChannelTable * ChannelTable      (void) const { return fChannelTable; }
+
   void Reset (void);
   void Copy  (const InteractionGeneratorMap & xsmap);
   void Print (ostream & stream) const;
@@ -63,13 +78,18 @@ public :
 
 private:
 
-  void Init    (void);
-  void CleanUp (void);
+  void Init               (void);
+  void CleanUp            (void);
+  void ResolveXSecSplines (void) const;
 
   const EventGeneratorList * fEventGeneratorList;
 
   InitialState *    fInitState;
   InteractionList * fInteractionList;
+
+  mutable vector<const Spline *> fXSecSplines;         ///< spline handle per interaction list entry
+  mutable long int               fXSecSplinesRevision; ///< XSecSplineList revision the handles were resolved at (-1: unresolved)
+  XSecChannelTable *             fChannelTable;        ///< cumulative xsec table (owned), if any
 };
 
 }      // genie namespace
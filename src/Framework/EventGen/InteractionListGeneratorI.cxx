@@ -8,10 +8,25 @@
 */
 //____________________________________________________________________________
 
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+
+#include "Framework/EventGen/InteractionList.h"
 #include "Framework/EventGen/InteractionListGeneratorI.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
 
 using namespace genie;
 
+namespace {
+  // interaction list templates, keyed on the generator, its configuration
+  // epoch, the probe and the target class (a null list if no interactions)
+  std::mutex gTemplateMutex;
+  std::map<string, std::unique_ptr<InteractionList> > gTemplates;
+}
+
 //___________________________________________________________________________
 InteractionListGeneratorI::InteractionListGeneratorI() :
 Algorithm()
@@ -37,3 +52,58 @@ InteractionListGeneratorI::~InteractionListGeneratorI()
 
 }
 //___________________________________________________________________________
+string InteractionListGeneratorI::TargetClass(const Target & /*target*/) const
+{
+  return "";
+}
+//___________________________________________________________________________
+string InteractionListGeneratorI::NucleonContentClass(const Target & target)
+{
+  std::ostringstream tclass;
+  tclass << "p:" << (target.Z() > 0) << ";n:" << (target.N() > 0);
+  return tclass.str();
+}
+//___________________________________________________________________________
+InteractionList * InteractionListGeneratorI::CreateInteractionListFromTemplate(
+                                       const InitialState & init_state) const
+{
+  string tclass = this->TargetClass(init_state.Tgt());
+  if(tclass.size() == 0) return this->CreateInteractionList(init_state);
+
+  std::ostringstream key;
+  key << this->Id().Key() << ";epoch:" << Algorithm::ConfigEpoch()
+      << ";probe:" << init_state.ProbePdg() << ";" << tclass;
+
+  std::lock_guard<std::mutex> lock(gTemplateMutex);
+
+  std::map<string, std::unique_ptr<InteractionList> >::iterator it =
+     gTemplates.find(key.str());
+  if(it == gTemplates.end()) {
+    LOG("IntLst", pINFO)
+       << "Building the interaction list template " << key.str()
+       << " from init-state: " << init_state.AsString();
+    it = gTemplates.insert(std::make_pair(key.str(),
+           std::unique_ptr<InteractionList>(
+              this->CreateInteractionList(init_state)))).first;
+  }
+  const InteractionList * tmpl = it->second.get();
+  if(!tmpl) return 0;
+
+  // copy the template interactions, substituting the target (keeping the
+  // hit nucleon etc set by the list generator) and the probe & target 4-p
+  int tgtpdg = init_state.Tgt().Pdg();
+  TLorentzVector * p4tgt = init_state.GetTgtP4(kRfLab);
+  InteractionList * intlist = new InteractionList;
+  InteractionList::const_iterator intliter = tmpl->begin();
+  for( ; intliter != tmpl->end(); ++intliter) {
+    Interaction * interaction = new Interaction(**intliter);
+    InitialState * init = interaction->InitStatePtr();
+    init->TgtPtr()->SetId(tgtpdg);
+    init->SetTgtP4  (*p4tgt);
+    init->SetProbeP4(init_state.ProbeP4Lab());
+    intlist->push_back(interaction);
+  }
+  delete p4tgt;
+  return intlist;
+}
+//___________________________________________________________________________
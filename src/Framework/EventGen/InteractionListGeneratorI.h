@@ -27,6 +27,7 @@ namespace genie {
 
 class InteractionList;
 class InitialState;
+class Target;
 
 class InteractionListGeneratorI : public Algorithm {
 
@@ -37,12 +38,29 @@ public :
   virtual InteractionList *
                  CreateInteractionList(const InitialState & init) const = 0;
 
+  //-- targets for which the generator builds the same interaction list, apart
+  //   from the target itself: the key of their class (eg whether the target
+  //   has protons & neutrons), or an empty string (the default) if the list
+  //   has to be built for each target
+
+  virtual string TargetClass (const Target & target) const;
+
+  //-- as CreateInteractionList(), but the list is built once for each probe
+  //   and target class (see TargetClass()) and copied, with the target
+  //   substituted, for the other targets of the class
+
+  InteractionList *
+                 CreateInteractionListFromTemplate(const InitialState & init) const;
+
 protected :
 
   InteractionListGeneratorI();
   InteractionListGeneratorI(string name);
   InteractionListGeneratorI(string name, string config);
   ~InteractionListGeneratorI();
+
+  //-- target class of generators that only check which nucleons the target has
+  static string NucleonContentClass (const Target & target);
 };
 
 }      // genie namespace
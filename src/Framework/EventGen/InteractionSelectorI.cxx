@@ -9,6 +9,7 @@
 //____________________________________________________________________________
 
 #include "Framework/EventGen/InteractionSelectorI.h"
+#include "Framework/EventGen/EventRecord.h"
 #include "Framework/Interaction/Interaction.h"
 
 using namespace genie;
@@ -37,3 +38,35 @@ InteractionSelectorI::~InteractionSelectorI()
 
 }
 //___________________________________________________________________________
+EventRecord * InteractionSelectorI::SelectInteraction(
+    const InteractionGeneratorMap * igmp, const TLorentzVector & p4,
+    EventRecord * reuse) const
+{
+// Default implementation for selectors bootstrapping new event records only:
+// Copy the selected interaction & cross sections into the input record
+
+  EventRecord * evrec = this->SelectInteraction(igmp, p4);
+  if(!reuse || !evrec) return evrec;
+
+  reuse->Copy(*evrec);
+  delete evrec;
+
+  return reuse;
+}
+//___________________________________________________________________________
+EventRecord * InteractionSelectorI::BootstrapEventRecord(
+    const Interaction & interaction, EventRecord * reuse) const
+{
+  EventRecord * evrec = reuse;
+  if(!evrec) {
+    evrec = new EventRecord;
+  } else {
+    evrec->RecycleRecord();
+  }
+
+  if(evrec->HasSummary()) evrec->Summary()->Copy(interaction);
+  else evrec->AttachSummary(new Interaction(interaction));
+
+  return evrec;
+}
+//___________________________________________________________________________
@@ -27,6 +27,7 @@ namespace genie {
 
 class InteractionGeneratorMap;
 class EventRecord;
+class Interaction;
 
 class InteractionSelectorI : public Algorithm {
 
@@ -37,10 +38,22 @@ public :
   virtual EventRecord * SelectInteraction
     (const InteractionGeneratorMap * igmp, const TLorentzVector & p4) const = 0;
 
+  //!  As above, but bootstrap the (caller-owned) input event record, if any,
+  //!  rather than a new one. The input record is recycled (see
+  //!  GHepRecord::RecycleRecord()) and returned on success
+  virtual EventRecord * SelectInteraction
+    (const InteractionGeneratorMap * igmp, const TLorentzVector & p4,
+     EventRecord * reuse) const;
+
 protected:
   InteractionSelectorI();
   InteractionSelectorI(string name);
   InteractionSelectorI(string name, string config);
+
+  //!  Bootstrap the event record (the input one, if any, or a new one) with
+  //!  a copy of the selected interaction
+  EventRecord * BootstrapEventRecord
+    (const Interaction & interaction, EventRecord * reuse) const;
 };
 
 }      // genie namespace
@@ -14,6 +14,7 @@
 #pragma link C++ class genie::EventGeneratorList;
 #pragma link C++ class genie::EventGeneratorListAssembler;
 #pragma link C++ class genie::RunningThreadInfo;
+#pragma link C++ class genie::EVGThreadStats;
 #pragma link C++ class genie::InteractionSelectorI;
 #pragma link C++ class genie::ToyInteractionSelector;
 #pragma link C++ class genie::PhysInteractionSelector;
@@ -22,6 +23,7 @@
 #pragma link C++ class genie::InteractionListGeneratorI;
 #pragma link C++ class genie::XSecAlgorithmMap;
 #pragma link C++ class genie::InteractionGeneratorMap;
+#pragma link C++ class genie::XSecChannelTable;
 
 #pragma link C++ class genie::GEVGDriver;
 #pragma link C++ class genie::GMCJDriver;
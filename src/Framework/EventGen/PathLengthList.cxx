@@ -157,6 +157,22 @@ bool PathLengthList::AreAllZero(void) const
 //___________________________________________________________________________
 void PathLengthList::Copy(const PathLengthList & plist)
 {
+  // Lists for consecutive flux neutrinos normally hold the same materials:
+  // if so, overwrite path lengths in place rather than re-building the map
+  if(this->size() == plist.size()) {
+    PathLengthList::iterator       it  = this->begin();
+    PathLengthList::const_iterator pit = plist.begin();
+    for( ; it != this->end(); ++it, ++pit) {
+      if(it->first != pit->first) break;
+    }
+    if(it == this->end()) {
+      for(it = this->begin(), pit = plist.begin(); it != this->end(); ++it, ++pit) {
+        it->second = pit->second;
+      }
+      return;
+    }
+  }
+
   this->clear();
   PathLengthList::const_iterator pl_iter;
   for(pl_iter = plist.begin(); pl_iter != plist.end(); ++pl_iter) {
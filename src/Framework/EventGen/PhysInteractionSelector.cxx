@@ -23,10 +23,10 @@
 #include "Framework/EventGen/EventGeneratorI.h"
 #include "Framework/EventGen/InteractionList.h"
 #include "Framework/EventGen/InteractionGeneratorMap.h"
+#include "Framework/EventGen/XSecChannelTable.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Numerical/Spline.h"
-#include "Framework/Utils/XSecSplineList.h"
 #include "Framework/Utils/PrintUtils.h"
 
 using std::vector;
@@ -58,6 +58,13 @@ PhysInteractionSelector::~PhysInteractionSelector()
 //___________________________________________________________________________
 EventRecord * PhysInteractionSelector::SelectInteraction
      (const InteractionGeneratorMap * igmap, const TLorentzVector & p4) const
+{
+  return this->SelectInteraction(igmap, p4, 0);
+}
+//___________________________________________________________________________
+EventRecord * PhysInteractionSelector::SelectInteraction
+     (const InteractionGeneratorMap * igmap, const TLorentzVector & p4,
+      EventRecord * reuse) const
 {
   if(!igmap) {
      LOG("IntSel", pERROR)
@@ -70,108 +77,142 @@ EventRecord * PhysInteractionSelector::SelectInteraction
      return 0;
   }
 
-  // Get the list of spline objects
-  // Should have been constructed at the job initialization
-  XSecSplineList * xssl = 0;
-  if (fUseSplines) xssl = XSecSplineList::Instance();
-
   const InteractionList & ilst = igmap->GetInteractionList();
+
+  // if the cumulative xsecs of all entries were tabulated, select an entry
+  // from the table and only evaluate the xsec spline of the selected one
+  // (not with channel biasing, as the table holds the unbiased xsecs)
+  const XSecChannelTable * table = igmap->ChannelTable();
+  if(fUseSplines && fChannelBias.empty() && table && table->IsCurrent() && table->InRange(p4.E())) {
+     RandomGen * rnd = RandomGen::Instance();
+     int iint = table->Select(p4.E(), rnd->RndISel().Rndm());
+     const Spline * spl = (iint >= 0) ? igmap->XSecSpline(iint) : 0;
+     if(spl) {
+       double E = this->ProbeE(*ilst[iint], p4);
+       double xsec = (spl->ClosestKnotValueIsZero(E,"-")) ? 0 : spl->Evaluate(E);
+       if(xsec > 0) {
+         EventRecord * evrec = this->BootstrapEventRecord(*ilst[iint], reuse);
+         Interaction * selected_interaction = evrec->Summary();
+         selected_interaction->InitStatePtr()->SetProbeP4(p4);
+         evrec->SetXSec(xsec);
+
+         LOG("IntSel", pNOTICE)
+           << "Selected interaction (from channel table): "
+           << selected_interaction->AsString();
+
+         return evrec;
+       }
+     }
+     LOG("IntSel", pINFO)
+       << "Channel table selection failed at E = " << p4.E()
+       << " GeV - Evaluating all xsec splines";
+  }
+
   vector<double> xseclist(ilst.size());
 
-  string istate = ilst[0]->InitState().AsString();
-  ostringstream msg;
-  msg << "Selecting an interaction for the given initial state = "
-      << istate << " at E = " << p4.E() << " GeV";
+  // the cross section table is only put together if it is going to be shown
+  bool print_table = LOG_ENABLED("IntSel", pNOTICE);
 
-  LOG("IntSel", pNOTICE)
-             << utils::print::PrintFramedMesg(msg.str(), 0, '=');
-  LOG("IntSel", pNOTICE)
-     << "Computing xsecs for all relevant modeled interactions:";
+  if(print_table) {
+    string istate = ilst[0]->InitState().AsString();
+    ostringstream msg;
+    msg << "Selecting an interaction for the given initial state = "
+        << istate << " at E = " << p4.E() << " GeV";
 
-  unsigned int i=0;
-  InteractionList::const_iterator intliter = ilst.begin();
+    LOG("IntSel", pNOTICE)
+               << utils::print::PrintFramedMesg(msg.str(), 0, '=');
+    LOG("IntSel", pNOTICE)
+       << "Computing xsecs for all relevant modeled interactions:";
+  }
 
   ostringstream xsec_table_printout;
 
-  xsec_table_printout
+  if(print_table) {
+    xsec_table_printout
       << " |"  << setfill('-') << setw(112) << "|" << endl
       << " | " << setfill(' ') << setw(80) << "interaction"
       << " | cross-section (1E-38*cm^2) |" << endl
       << " |"  << setfill('-') << setw(112) << "|" << endl;
+  }
 
-  for( ; intliter != ilst.end(); ++intliter) {
+  for(unsigned int i = 0; i < ilst.size(); i++) {
 
-     Interaction * interaction = new Interaction(**intliter);
-     interaction->InitStatePtr()->SetProbeP4(p4);
+     const Interaction * candidate = ilst[i];
 
      SLOG("IntSel", pDEBUG)
-           << "Computing xsec for: \n  " << interaction->AsString();
-
-     // get the cross section for this interaction
-     const XSecAlgorithmI * xsec_alg =
-               igmap->FindGenerator(interaction)->CrossSectionAlg();
-     assert(xsec_alg);
+           << "Computing xsec for: \n  " << candidate->AsString();
 
      double xsec = 0; // cross section for this interaction
 
-     bool spline_computed = xssl->SplineExists(xsec_alg, interaction);
-     bool eval = fUseSplines && spline_computed;
-     if (eval) {
-           const InitialState & init = interaction->InitState();
-           const ProcessInfo & proc  = interaction->ProcInfo();
-           // choose ref frame ('Lab' or 'Hit nucleon rest frame')
-           RefFrame_t frame =
-              (proc.IsCoherentProduction() || proc.IsElectronScattering()) ?
-              kRfLab : kRfHitNucRest;
-           double E = init.ProbeE(frame);
+     // Get the xsec spline handle, resolved once by the interaction generator
+     // map (the splines should have been constructed at job initialization).
+     // Splines only need the probe energy, so the candidate interactions are
+     // evaluated as they are in the interaction list, without a copy.
+     const Spline * spl = (fUseSplines) ? igmap->XSecSpline(i) : 0;
+     if (spl) {
+           double E = this->ProbeE(*candidate, p4);
            if(TMath::IsNaN(E)) {
-    		 BLOG("IntSel", pFATAL) << *interaction;
+    		 BLOG("IntSel", pFATAL) << *candidate;
     		 BLOG("IntSel", pFATAL) << "E = " << E;
 		 abort();
 	   }
-           const Spline * spl = xssl->GetSpline(xsec_alg,interaction);
            if(spl->ClosestKnotValueIsZero(E,"-")) xsec = 0;
            else xsec = spl->Evaluate(E);
      } else {
+           // the cross section algorithm needs the full interaction
+           const XSecAlgorithmI * xsec_alg =
+                     igmap->FindGenerator(candidate)->CrossSectionAlg();
+           assert(xsec_alg);
+           Interaction * interaction = new Interaction(*candidate);
+           interaction->InitStatePtr()->SetProbeP4(p4);
            xsec = xsec_alg->Integral(interaction);
+           delete interaction;
      }
-     TMath::Max(0., xsec);
-/*
-     LOG("IntSel", pNOTICE)
-       << interaction->AsString()
-       << " --> xsec " << (eval ? "[**interp**]" : "[**calc**]")
-       << " = " << xsec/genie::units::cm2 << " cm^2";
-*/
-     xsec_table_printout
-           << " | " << setfill(' ') << setw(80) << interaction->AsString()
+     xsec = TMath::Max(0., xsec);
+
+     if(print_table) {
+       xsec_table_printout
+           << " | " << setfill(' ') << setw(80) << candidate->AsString()
            << " | " << setfill(' ') << setw(26) << xsec/(1E-38*genie::units::cm2)
            << " | " << endl;
+     }
 
-     xseclist[i++] = xsec;
-     delete interaction;
+     xseclist[i] = xsec;
 
   } // loop over interaction that can be generated
 
-  xsec_table_printout
+  if(print_table) {
+    xsec_table_printout
       << " |"  << setfill('-') << setw(112) << "|" << endl;
 
-  LOG("IntSel", pNOTICE)
-    << "\n" << xsec_table_printout.str();
+    LOG("IntSel", pNOTICE)
+      << "\n" << xsec_table_printout.str();
+  }
 
   // select an interaction
 
+  // select an interaction, with probability bias * xsec if any channels
+  // are biased (the list then holds the summed biased xsecs)
+
   LOG("IntSel", pINFO)
             << "Selecting an entry from the Interaction List";
   double xsec_sum  = 0;
+  double bxsec_sum = 0;
+  vector<double> biaslist(fChannelBias.empty() ? 0 : ilst.size(), 1.);
   for(unsigned int iint = 0; iint < xseclist.size(); iint++) {
-     xsec_sum       += xseclist[iint];
-     xseclist[iint]  = xsec_sum;
+     xsec_sum += xseclist[iint];
+     if(!biaslist.empty()) {
+       biaslist[iint] = this->ChannelBias(*ilst[iint]);
+       xseclist[iint] *= biaslist[iint];
+     }
+     bxsec_sum      += xseclist[iint];
+     xseclist[iint]  = bxsec_sum;
 
      SLOG("IntSel", pINFO)
-             << "Sum{xsec}(0->" << iint << ") = " << xsec_sum;
+             << "Sum{xsec}(0->" << iint << ") = " << bxsec_sum;
   }
   RandomGen * rnd = RandomGen::Instance();
-  double R = xsec_sum * rnd->RndISel().Rndm();
+  double R = bxsec_sum * rnd->RndISel().Rndm();
 
   LOG("IntSel", pINFO)
       << "Generating Rndm (0. -> max = " << xsec_sum << ") = " << R;
@@ -182,23 +223,31 @@ EventRecord * PhysInteractionSelector::SelectInteraction
                << "Sum{xsec}(0->" << iint <<") = " << xseclist[iint];
 
      if( R < xseclist[iint] ) {
-       Interaction * selected_interaction = new Interaction (*ilst[iint]);
-       selected_interaction->InitStatePtr()->SetProbeP4(p4);
-
        // set the cross section for the selected interaction (just extract it
        // from the array of summed xsecs rather than recomputing it)
        double xsec_pedestal = (iint > 0) ? xseclist[iint-1] : 0.;
        double xsec = xseclist[iint] - xsec_pedestal;
        assert(xsec>0);
-
-       LOG("IntSel", pNOTICE)
-         << "Selected interaction: " << selected_interaction->AsString();
+       double bias = biaslist.empty() ? 1. : biaslist[iint];
+       xsec /= bias;
 
        // bootstrap the event record
-       EventRecord * evrec = new EventRecord;
-       evrec->AttachSummary(selected_interaction);
+       EventRecord * evrec = this->BootstrapEventRecord(*ilst[iint], reuse);
+       Interaction * selected_interaction = evrec->Summary();
+       selected_interaction->InitStatePtr()->SetProbeP4(p4);
        evrec->SetXSec(xsec);
 
+       // weight biased selections back to the physical channel mixture
+       if(!biaslist.empty()) {
+         double wght = (bxsec_sum / xsec_sum) / bias;
+         evrec->SetWeight(wght * evrec->Weight());
+         LOG("IntSel", pINFO)
+           << "Channel bias = " << bias << ", event weight = " << evrec->Weight();
+       }
+
+       LOG("IntSel", pNOTICE)
+         << "Selected interaction: " << selected_interaction->AsString();
+
        return evrec;
      }
   }
@@ -206,6 +255,35 @@ EventRecord * PhysInteractionSelector::SelectInteraction
   return 0;
 }
 //___________________________________________________________________________
+double PhysInteractionSelector::ProbeE(
+    const Interaction & in, const TLorentzVector & p4) const
+{
+// Probe energy in the frame the xsec splines are tabulated in ('Lab' or
+// 'Hit nucleon rest frame') for the input candidate interaction, as
+// InitialState::ProbeE() would give once the probe 4-momentum is set
+
+  const ProcessInfo & proc = in.ProcInfo();
+  if(proc.IsCoherentProduction() || proc.IsElectronScattering()) {
+    return p4.E();
+  }
+
+  const TLorentzVector * pnuc4 = in.InitState().Tgt().HitNucP4Ptr();
+  assert(pnuc4 != 0);
+
+  TLorentzVector k4(p4);
+  k4.Boost(-pnuc4->Px()/pnuc4->Energy(),
+           -pnuc4->Py()/pnuc4->Energy(),
+           -pnuc4->Pz()/pnuc4->Energy());
+  return k4.Energy();
+}
+//___________________________________________________________________________
+double PhysInteractionSelector::ChannelBias(const Interaction & in) const
+{
+  std::map<ScatteringType_t, double>::const_iterator it =
+     fChannelBias.find(in.ProcInfo().ScatteringTypeId());
+  return (it == fChannelBias.end()) ? 1. : it->second;
+}
+//___________________________________________________________________________
 void PhysInteractionSelector::Configure(const Registry & config)
 {
   Algorithm::Configure(config);
@@ -225,5 +303,32 @@ void PhysInteractionSelector::LoadConfigData(void)
   fUseSplines = false ;
   GetParam( "UseStoredXSecs", fUseSplines ) ;
 
+  // per-scattering-type bias factors for enhancing rare channels
+  const ScatteringType_t sctypes[] = {
+    kScQuasiElastic, kScSingleKaon, kScDeepInelastic, kScResonant,
+    kScCoherentProduction, kScDiffractive, kScNuElectronElastic,
+    kScInverseMuDecay, kScAMNuGamma, kScMEC, kScCoherentElastic,
+    kScInverseBetaDecay, kScGlashowResonance, kScIMDAnnihilation,
+    kScDarkMatterElastic, kScDarkMatterDeepInelastic, kScDarkMatterElectron
+  };
+  fChannelBias.clear();
+  for(unsigned int i = 0; i < sizeof(sctypes)/sizeof(sctypes[0]); i++) {
+    string key = "ChannelBias-" + ScatteringType::AsString(sctypes[i]);
+    double bias = 1.;
+    GetParamDef( key, bias, 1. ) ;
+    if(bias <= 0.) {
+      LOG("IntSel", pFATAL)
+        << "Invalid " << key << " = " << bias << " (must be > 0)";
+      gAbortingInErr = true;
+      exit(1);
+    }
+    if(bias != 1.) {
+      fChannelBias[sctypes[i]] = bias;
+      LOG("IntSel", pNOTICE)
+        << "Biasing " << ScatteringType::AsString(sctypes[i])
+        << " channels by a factor of " << bias;
+    }
+  }
+
 }
 //___________________________________________________________________________
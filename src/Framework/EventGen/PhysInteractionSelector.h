@@ -7,6 +7,13 @@
 
          Is a concrete implementation of the InteractionSelectorI interface.
 
+         Rare channels (eg COH, IMD, NuEEL or DFR) can be enhanced with
+         per-scattering-type bias factors (ChannelBias-<type> parameters).
+         Channels are then selected with probability bias * xsec and each
+         event carries the weight (sum{bias * xsec} / sum{xsec}) / bias, so
+         the weighted sample keeps the unbiased channel mixture and
+         normalization.
+
 \author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
  University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -20,7 +27,10 @@
 #ifndef _PHYS_INTERACTION_SELECTOR_H_
 #define _PHYS_INTERACTION_SELECTOR_H_
 
+#include <map>
+
 #include "Framework/EventGen/InteractionSelectorI.h"
+#include "Framework/Interaction/ScatteringType.h"
 
 namespace genie {
 
@@ -34,6 +44,9 @@ public :
   //! implement the InteractionSelectorI interface
   EventRecord * SelectInteraction
      (const InteractionGeneratorMap * igmp, const TLorentzVector & p4) const;
+  EventRecord * SelectInteraction
+     (const InteractionGeneratorMap * igmp, const TLorentzVector & p4,
+      EventRecord * reuse) const;
 
   //! override the Algorithm::Configure methods to load configuration
   //! data to private data members
@@ -41,9 +54,12 @@ public :
   void Configure (string param_set);
 
 private:
-  void LoadConfigData (void);
+  void   LoadConfigData (void);
+  double ProbeE         (const Interaction & in, const TLorentzVector & p4) const;
+  double ChannelBias    (const Interaction & in) const;
 
   bool fUseSplines;
+  std::map<ScatteringType_t, double> fChannelBias; ///< bias factors != 1, per scattering type
 };
 
 }      // genie namespace
@@ -42,6 +42,13 @@ ToyInteractionSelector::~ToyInteractionSelector()
 //___________________________________________________________________________
 EventRecord * ToyInteractionSelector::SelectInteraction
      (const InteractionGeneratorMap * igmap, const TLorentzVector & p4) const
+{
+  return this->SelectInteraction(igmap, p4, 0);
+}
+//___________________________________________________________________________
+EventRecord * ToyInteractionSelector::SelectInteraction
+     (const InteractionGeneratorMap * igmap, const TLorentzVector & p4,
+      EventRecord * reuse) const
 {
   if(!igmap) {
      LOG("IntSel", pERROR)
@@ -64,16 +71,13 @@ EventRecord * ToyInteractionSelector::SelectInteraction
 
   Interaction * interaction = ilst[iint];
 
-  // clone interaction
-  Interaction * selected_interaction = new Interaction( *interaction );
+  // bootstrap the event record with a clone of the interaction
+  EventRecord * evrec = this->BootstrapEventRecord(*interaction, reuse);
+  Interaction * selected_interaction = evrec->Summary();
   selected_interaction->InitStatePtr()->SetProbeP4(p4);
   LOG("IntSel", pINFO)
              << "Interaction to generate: \n" << *selected_interaction;
 
-  // bootstrap the event record
-  EventRecord * evrec = new EventRecord;
-  evrec->AttachSummary(selected_interaction);
-
   return evrec;
 }
 //___________________________________________________________________________
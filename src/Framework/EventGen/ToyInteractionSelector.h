@@ -38,6 +38,9 @@ public :
   //! implement the InteractionSelectorI interface
   EventRecord * SelectInteraction
     (const InteractionGeneratorMap * igmp, const TLorentzVector & p4) const;
+  EventRecord * SelectInteraction
+    (const InteractionGeneratorMap * igmp, const TLorentzVector & p4,
+     EventRecord * reuse) const;
 };
 
 }      // genie namespace
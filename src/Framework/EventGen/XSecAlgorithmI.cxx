@@ -35,6 +35,21 @@ Algorithm(name, config)
 XSecAlgorithmI::~XSecAlgorithmI()
 {
 
+}
+//___________________________________________________________________________
+void XSecAlgorithmI::XSecBatch(
+    const Interaction* interaction, KinePhaseSpace_t kps,
+    unsigned int npoints, unsigned int nkv, const KineVar_t * kv,
+    const double * values, double * xsec) const
+{
+  Kinematics * kine = interaction->KinePtr();
+  for(unsigned int p = 0; p < npoints; p++) {
+    const double * point = values + p*nkv;
+    for(unsigned int j = 0; j < nkv; j++) {
+      kine->SetKV(kv[j], point[j]);
+    }
+    xsec[p] = this->XSec(interaction, kps);
+  }
 }
 //___________________________________________________________________________
 bool XSecAlgorithmI::ValidKinematics(const Interaction* interaction) const
@@ -57,3 +72,10 @@ bool XSecAlgorithmI::ValidKinematics(const Interaction* interaction) const
   return true;
 }
 //___________________________________________________________________________
+bool XSecAlgorithmI::DerivesNuclearSplines(void) const
+{
+  bool derive = false;
+  GetParamDef("DerivedNuclearSplines", derive, false);
+  return derive;
+}
+//___________________________________________________________________________
@@ -32,6 +32,17 @@ public:
   //! Compute the cross section for the input interaction
   virtual double XSec (const Interaction* i, KinePhaseSpace_t k=kPSfE) const = 0;
 
+  //! Compute the cross section at npoints kinematic points of the input
+  //! interaction, whose initial state and process stay fixed. At point p the
+  //! nkv kinematic variables kv[] take the values values[p*nkv + j]; all other
+  //! kinematic variables keep their input values. The default implementation
+  //! sets the point kinematics and calls XSec() for each point; models with
+  //! a sizeable per-call setup can override it. On return the interaction
+  //! holds the kinematics of the last point.
+  virtual void XSecBatch (const Interaction* i, KinePhaseSpace_t k,
+                          unsigned int npoints, unsigned int nkv, const KineVar_t * kv,
+                          const double * values, double * xsec) const;
+
   //! Integrate the model over the kinematic phase space available to the
   //! input interaction (kinematical cuts can be included)
   virtual double Integral (const Interaction* i) const = 0;
@@ -42,6 +53,12 @@ public:
   //! Is the input kinematical point a physically allowed one?
   virtual bool ValidKinematics (const Interaction* i) const;
 
+  //! Is the integral of this model for a bound hit nucleon just the number of
+  //! such nucleons times the free nucleon integral? If so (DerivedNuclearSplines
+  //! configuration option), the XSecSplineList derives the nuclear target
+  //! splines from the free nucleon ones (see XSecSplineList::DeriveSpline())
+  virtual bool DerivesNuclearSplines (void) const;
+
 protected:
   XSecAlgorithmI();
   XSecAlgorithmI(string name);
@@ -123,7 +123,8 @@ void XSecAlgorithmMap::BuildMap(const InitialState & init_state)
         << "Querying [" << evgen->Id().Key() << "] for its InteractionList";
 
      const InteractionListGeneratorI * ilstgen = evgen->IntListGenerator();
-     InteractionList * ilst = ilstgen->CreateInteractionList(init_state);
+     InteractionList * ilst =
+         ilstgen->CreateInteractionListFromTemplate(init_state);
 
      // no point to go on if the list is NULL - continue to next iteration
      if(!ilst) continue;
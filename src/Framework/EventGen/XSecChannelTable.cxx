@@ -0,0 +1,157 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <sstream>
+
+#include <TMath.h>
+#include <TLorentzVector.h>
+
+#include "Framework/EventGen/XSecChannelTable.h"
+#include "Framework/EventGen/InteractionList.h"
+#include "Framework/EventGen/InteractionGeneratorMap.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/Spline.h"
+#include "Framework/Utils/XSecSplineList.h"
+
+using std::ostringstream;
+using namespace genie;
+
+//___________________________________________________________________________
+XSecChannelTable::XSecChannelTable() :
+fNChannels(0),
+fNE(0),
+fEmin(0),
+fEmax(0),
+fInLogE(true),
+fX0(0),
+fDX(0),
+fRevision(-1)
+{
+
+}
+//___________________________________________________________________________
+XSecChannelTable::~XSecChannelTable()
+{
+
+}
+//___________________________________________________________________________
+bool XSecChannelTable::Build(const InteractionGeneratorMap & igmap,
+                             int nk, double Emin, double Emax, bool inlogE)
+{
+  fNE = 0;
+  fCumXSec.clear();
+
+  const InteractionList & ilst = igmap.GetInteractionList();
+  fNChannels = ilst.size();
+  if(fNChannels == 0 || nk < 1 || Emin <= 0) return false;
+  if(nk == 1) Emax = Emin;
+  if(nk > 1 && Emax <= Emin) return false;
+
+  for(unsigned int ich = 0; ich < fNChannels; ich++) {
+    if(!igmap.XSecSpline(ich)) {
+      LOG("XSecChTable", pNOTICE)
+        << "No xsec spline for " << ilst[ich]->AsString()
+        << " - Can not tabulate the interaction channels";
+      return false;
+    }
+  }
+
+  fEmin   = Emin;
+  fEmax   = Emax;
+  fInLogE = inlogE;
+  fX0     = (inlogE) ? TMath::Log(Emin) : Emin;
+  fDX     = (nk > 1) ? (((inlogE) ? TMath::Log(Emax) : Emax) - fX0) / (nk-1) : 0;
+
+  fCumXSec.resize(nk * fNChannels);
+
+  // evaluate each channel spline at the energy of the probe in the frame the
+  // spline is tabulated in, as the PhysInteractionSelector does
+  TLorentzVector p4(0,0,0,0);
+  for(unsigned int ich = 0; ich < fNChannels; ich++) {
+    const Spline * spl = igmap.XSecSpline(ich);
+    Interaction interaction(*ilst[ich]);
+    const ProcessInfo & proc = interaction.ProcInfo();
+    RefFrame_t frame =
+       (proc.IsCoherentProduction() || proc.IsElectronScattering()) ?
+       kRfLab : kRfHitNucRest;
+    for(int ie = 0; ie < nk; ie++) {
+      double x = fX0 + ie*fDX;
+      double e = (inlogE) ? TMath::Exp(x) : x;
+      if(ie == nk-1) e = Emax;
+      p4.SetPxPyPzE(0.,0.,e,e);
+      interaction.InitStatePtr()->SetProbeP4(p4);
+      double E = interaction.InitState().ProbeE(frame);
+      double xsec = (spl->ClosestKnotValueIsZero(E,"-")) ? 0 : spl->Evaluate(E);
+      fCumXSec[ie*fNChannels + ich] = TMath::Max(0., xsec);
+    }
+  }
+  for(int ie = 0; ie < nk; ie++) {
+    double * row = &fCumXSec[ie*fNChannels];
+    for(unsigned int ich = 1; ich < fNChannels; ich++) row[ich] += row[ich-1];
+  }
+
+  fNE       = nk;
+  fRevision = XSecSplineList::Instance()->Revision();
+
+  ostringstream grid;
+  if(fNE == 1) grid << "E = " << fEmin << " GeV";
+  else         grid << fNE << " energies in E = [" << fEmin << ", " << fEmax << "] GeV";
+  LOG("XSecChTable", pNOTICE)
+    << "Tabulated " << fNChannels << " interaction channels at " << grid.str();
+
+  return true;
+}
+//___________________________________________________________________________
+bool XSecChannelTable::IsCurrent(void) const
+{
+  return (fNE > 0 && fRevision == XSecSplineList::Instance()->Revision());
+}
+//___________________________________________________________________________
+bool XSecChannelTable::InRange(double E) const
+{
+  if(fNE == 0) return false;
+  if(fNE == 1) return (TMath::Abs(E - fEmin) <= 1E-9 * fEmin);
+  return (E >= fEmin && E <= fEmax);
+}
+//___________________________________________________________________________
+int XSecChannelTable::Select(double E, double R) const
+{
+  if(!this->InRange(E)) return -1;
+
+  // energy interval & interpolation weight
+  int    ie = 0;
+  double w  = 0;
+  if(fNE > 1) {
+    double x = ((fInLogE) ? TMath::Log(E) : E);
+    ie = TMath::Min((int) ((x - fX0) / fDX), fNE-2);
+    ie = TMath::Max(ie, 0);
+    w  = (x - (fX0 + ie*fDX)) / fDX;
+  }
+
+  const double * lo = &fCumXSec[ie*fNChannels];
+  const double * hi = (fNE > 1) ? lo + fNChannels : lo;
+
+  double sum = (1-w) * lo[fNChannels-1] + w * hi[fNChannels-1];
+  if(sum <= 0) return -1;
+  double target = R * sum;
+
+  // binary search for the first channel with an interpolated cumulative xsec
+  // above the target value
+  unsigned int first = 0, last = fNChannels-1;
+  while(first < last) {
+    unsigned int mid = (first + last) / 2;
+    double cum = (1-w) * lo[mid] + w * hi[mid];
+    if(cum > target) last  = mid;
+    else             first = mid + 1;
+  }
+  return (int) first;
+}
+//___________________________________________________________________________
@@ -0,0 +1,85 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::XSecChannelTable
+
+\brief   Cumulative cross sections of all the interactions (channels) an
+         event generation driver can simulate, tabulated on an energy grid
+         shared by all channels.
+
+         With the table, the PhysInteractionSelector picks a channel with a
+         lookup of the energy interval, a linear interpolation and a binary
+         search over the cumulative sums, rather than evaluating the cross
+         section spline of every channel for every event. The cross section
+         of the selected channel is still evaluated from its spline.
+
+         A table built at a single energy is only used at that energy (and
+         is exact there), as needed for jobs generating events at a fixed
+         energy. The table is built from the cross section splines and is
+         disregarded once the contents of the XSecSplineList change.
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _XSEC_CHANNEL_TABLE_H_
+#define _XSEC_CHANNEL_TABLE_H_
+
+#include <vector>
+
+using std::vector;
+
+namespace genie {
+
+class InteractionGeneratorMap;
+
+class XSecChannelTable {
+
+public :
+  XSecChannelTable();
+ ~XSecChannelTable();
+
+  //! Tabulate the channels of the input map at nk energies in [Emin, Emax]
+  //! (nk=1: at Emin only). Returns false if a channel has no xsec spline.
+  bool Build (const InteractionGeneratorMap & igmap,
+              int nk, double Emin, double Emax, bool inlogE=true);
+
+  //! Was the table built for the current contents of the XSecSplineList?
+  bool IsCurrent (void) const;
+
+  //! Is the input probe energy (lab frame) in the tabulated range?
+  bool InRange (double E) const;
+
+  //! Select the channel for probe energy E (lab frame) and the random
+  //! number R in [0,1). Returns -1 if E is out of the tabulated range.
+  int Select (double E, double R) const;
+
+  unsigned int NChannels (void) const { return fNChannels; }
+  int          NEnergies (void) const { return fNE;        }
+
+  //! approximate memory held by the table, in bytes
+  size_t MemoryFootprint (void) const
+  { return sizeof(XSecChannelTable) + fCumXSec.capacity() * sizeof(double); }
+
+private:
+
+  unsigned int   fNChannels;  ///< number of channels (interaction list entries)
+  int            fNE;         ///< number of energies (0: no table)
+  double         fEmin;       ///< min tabulated energy
+  double         fEmax;       ///< max tabulated energy
+  bool           fInLogE;     ///< is the grid uniform in log(E)?
+  double         fX0;         ///< grid start, in E or log(E)
+  double         fDX;         ///< grid step,  in E or log(E)
+  vector<double> fCumXSec;    ///< cumulative xsec, fNChannels per energy
+  long int       fRevision;   ///< XSecSplineList revision the table was built at
+};
+
+}      // genie namespace
+
+#endif // _XSEC_CHANNEL_TABLE_H_
@@ -31,7 +31,8 @@ namespace genie {
      kKineGenErr      = 4,
      kHadroSysGenErr  = 5,
      kLeptoGenErr     = 6,
-     kDecayErr        = 7
+     kDecayErr        = 7,
+     kFilteredOut     = 8
 
   } GHepFlag_t;
 
@@ -66,6 +67,9 @@ class GHepFlags {
      case kDecayErr :
             return "Generic error during unstable particle decay";
             break;
+     case kFilteredOut :
+            return "Event rejected by the event filter";
+            break;
      default:
             return "Unknown GHEP flag";
             break;
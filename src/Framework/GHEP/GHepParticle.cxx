@@ -11,6 +11,7 @@
 #include <cstdlib>
 #include <cassert>
 #include <iomanip>
+#include <atomic>
 
 #include <TMath.h>
 #include <TRootIOCtor.h>
@@ -36,6 +37,10 @@ using std::cout;
 const double kPCutOff    = 1e-15;
 const double kOffShellDm = 0.002; // 2 MeV
 
+namespace {
+  std::atomic<unsigned long> gPdgCodeEpoch(0);
+}
+
 ClassImp(GHepParticle)
 
 //____________________________________________________________________________
@@ -58,18 +63,20 @@ GHepParticle::GHepParticle(int pdg, GHepStatus_t status,
         int mother1, int mother2, int daughter1, int daughter2,
         const TLorentzVector & p, const TLorentzVector & v) :
 TObject(),
+fPdgCode(pdg),
 fStatus(status),
 fFirstMother(mother1),
 fLastMother(mother2),
 fFirstDaughter(daughter1),
 fLastDaughter(daughter2)
 {
-  this->SetPdgCode(pdg);
+  this->AssertIsKnownParticle();
 
-  fP4 = new TLorentzVector(p);
-  fX4 = new TLorentzVector(v);
+  fP4 = p;
+  fX4 = v;
 
   fRescatterCode  = -1;
+  fRescatterWeight = 1.;
   fPolzTheta      = -999;
   fPolzPhi        = -999;
   fIsBound        = false;
@@ -82,18 +89,20 @@ GHepParticle::GHepParticle(int pdg, GHepStatus_t status,
         double px, double py, double pz, double En,
         double x, double y, double z, double t) :
 TObject(),
+fPdgCode(pdg),
 fStatus(status),
 fFirstMother(mother1),
 fLastMother(mother2),
 fFirstDaughter(daughter1),
 fLastDaughter(daughter2)
 {
-  this->SetPdgCode(pdg);
+  this->AssertIsKnownParticle();
 
-  fP4 = new TLorentzVector(px,py,pz,En);
-  fX4 = new TLorentzVector(x,y,z,t);
+  fP4.SetPxPyPzE(px,py,pz,En);
+  fX4.SetXYZT(x,y,z,t);
 
   fRescatterCode  = -1;
+  fRescatterWeight = 1.;
   fPolzTheta      = -999;
   fPolzPhi        = -999;
   fIsBound        = false;
@@ -105,6 +114,7 @@ GHepParticle::GHepParticle(const GHepParticle & particle) :
 TObject()
 {
   this->Init();
+  fPdgCode = particle.fPdgCode; // a new particle: not a pdg code change
   this->Copy(particle);
 }
 //___________________________________________________________________________
@@ -113,12 +123,13 @@ TObject(),
 fPdgCode(0),
 fStatus(kIStUndefined),
 fRescatterCode(-1),
+fRescatterWeight(1.),
 fFirstMother(-1),
 fLastMother(-1),
 fFirstDaughter(-1),
 fLastDaughter(-1),
-fP4(0),
-fX4(0),
+fP4(0,0,0,0),
+fX4(0,0,0,0),
 fPolzTheta(-999.),
 fPolzPhi(-999.),
 fRemovalEnergy(0),
@@ -158,13 +169,8 @@ double GHepParticle::Charge(void) const
 //___________________________________________________________________________
 double GHepParticle::KinE(bool mass_from_pdg) const
 {
-  if(!fP4) {
-    LOG("GHepParticle", pWARN) << "4-momentum not yet set!";
-    return 0;
-  }
-
-  double En = fP4->Energy();
-  double M = ( (mass_from_pdg) ? this->Mass() : fP4->M() );
+  double En = fP4.Energy();
+  double M = ( (mass_from_pdg) ? this->Mass() : fP4.M() );
   double K = En - M;
 
   K = TMath::Max(K,0.);
@@ -196,17 +202,12 @@ TLorentzVector * GHepParticle::GetP4(void) const
 // see GHepParticle::P4() for a method that does not create a new object and
 // transfers its ownership
 
-  if(fP4) {
-     TLorentzVector * p4 = new TLorentzVector(*fP4);
+  TLorentzVector * p4 = new TLorentzVector(fP4);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-     LOG("GHepParticle", pDEBUG)
-          << "Return vp = " << utils::print::P4AsShortString(p4);
+  LOG("GHepParticle", pDEBUG)
+       << "Return vp = " << utils::print::P4AsShortString(p4);
 #endif
-     return p4;
-  } else {
-    LOG("GHepParticle", pWARN) << "NULL 4-momentum TLorentzVector";
-    return 0;
-  }
+  return p4;
 }
 //___________________________________________________________________________
 TLorentzVector * GHepParticle::GetX4(void) const
@@ -214,39 +215,29 @@ TLorentzVector * GHepParticle::GetX4(void) const
 // see GHepParticle::X4() for a method that does not create a new object and
 // transfers its ownership
 
-  if(fX4) {
-     TLorentzVector * x4 = new TLorentzVector(*fX4);
+  TLorentzVector * x4 = new TLorentzVector(fX4);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-     LOG("GHepParticle", pDEBUG)
-         << "Return x4 = " << utils::print::X4AsString(x4);
+  LOG("GHepParticle", pDEBUG)
+      << "Return x4 = " << utils::print::X4AsString(x4);
 #endif
-     return x4;
-  } else {
-    LOG("GHepParticle", pWARN) << "NULL 4-position TLorentzVector";
-    return 0;
-  }
+  return x4;
 }
 //___________________________________________________________________________
 void GHepParticle::SetPdgCode(int code)
 {
+  if(code != fPdgCode) gPdgCodeEpoch.fetch_add(1, std::memory_order_relaxed);
   fPdgCode = code;
   this->AssertIsKnownParticle();
 }
 //___________________________________________________________________________
 void GHepParticle::SetMomentum(const TLorentzVector & p4)
 {
-  if(fP4)
-      fP4->SetPxPyPzE( p4.Px(), p4.Py(), p4.Pz(), p4.Energy() );
-  else
-      fP4 = new TLorentzVector(p4);
+  fP4.SetPxPyPzE( p4.Px(), p4.Py(), p4.Pz(), p4.Energy() );
 }
 //___________________________________________________________________________
 void GHepParticle::SetMomentum(double px, double py, double pz, double En)
 {
-  if(fP4)
-      fP4->SetPxPyPzE(px, py, pz, En);
-  else
-      fP4 = new TLorentzVector(px, py, pz, En);
+  fP4.SetPxPyPzE(px, py, pz, En);
 }
 //___________________________________________________________________________
 void GHepParticle::SetPosition(const TLorentzVector & v4)
@@ -262,8 +253,7 @@ void GHepParticle::SetPosition(double x, double y, double z, double t)
                                << y << ", z = " << z << ", t = " << t << ")";
 #endif
 
-  if(fX4) fX4->SetXYZT(x,y,z,t);
-  else    fX4 = new TLorentzVector(x,y,z,t);
+  fX4.SetXYZT(x,y,z,t);
 }
 //___________________________________________________________________________
 void GHepParticle::SetEnergy(double En)
@@ -293,7 +283,7 @@ bool GHepParticle::IsOnMassShell(void) const
   TParticlePDG * p = PDGLibrary::Instance()->Find(fPdgCode);
 
   double Mpdg = p->Mass();
-  double M4p  = (fP4) ? fP4->M() : 0.;
+  double M4p  = fP4.M();
 
 //  return utils::math::AreEqual(Mpdg, M4p);
 
@@ -390,6 +380,7 @@ void GHepParticle::Init(void)
   fPdgCode       = 0;
   fStatus        = kIStUndefined;
   fRescatterCode = -1;
+  fRescatterWeight = 1.;
   fFirstMother   = -1;
   fLastMother    = -1;
   fFirstDaughter = -1;
@@ -398,28 +389,33 @@ void GHepParticle::Init(void)
   fPolzPhi       = -999;
   fIsBound       = false;
   fRemovalEnergy = 0.;
-  fP4            = new TLorentzVector(0,0,0,0);
-  fX4            = new TLorentzVector(0,0,0,0);
+  fP4.SetPxPyPzE (0,0,0,0);
+  fX4.SetXYZT    (0,0,0,0);
 }
 //___________________________________________________________________________
 void GHepParticle::CleanUp(void)
 {
-// deallocate memory
+// reset the 4-vectors (they are embedded in the particle: there is nothing
+// to deallocate)
 
-  if(fP4) delete fP4;
-  if(fX4) delete fX4;
-  fP4 = 0;
-  fX4 = 0;
+  fP4.SetPxPyPzE (0,0,0,0);
+  fX4.SetXYZT    (0,0,0,0);
 }
 //___________________________________________________________________________
 void GHepParticle::Reset(void)
 {
-// deallocate memory + initialize
+// reset + initialize
 
+  if(fPdgCode != 0) gPdgCodeEpoch.fetch_add(1, std::memory_order_relaxed);
   this->CleanUp();
   this->Init();
 }
 //___________________________________________________________________________
+unsigned long GHepParticle::PdgCodeEpoch(void)
+{
+  return gPdgCodeEpoch.load(std::memory_order_relaxed);
+}
+//___________________________________________________________________________
 void GHepParticle::Clear(Option_t * /*option*/)
 {
 // implement the Clear(Option_t *) method so that the GHepParticle when is a
@@ -517,6 +513,7 @@ void GHepParticle::Copy(const GHepParticle & particle)
   this->SetStatus           (particle.Status()          );
   this->SetPdgCode          (particle.Pdg()             );
   this->SetRescatterCode    (particle.RescatterCode()   );
+  this->SetRescatterWeight  (particle.RescatterWeight() );
   this->SetFirstMother      (particle.FirstMother()     );
   this->SetLastMother       (particle.LastMother()      );
   this->SetFirstDaughter    (particle.FirstDaughter()   );
@@ -78,7 +78,9 @@ fEventMask(0),
 fWeight(0.),
 fProb(0.),
 fXSec(0.),
-fDiffXSec(0.)
+fDiffXSec(0.),
+fPdgIndexN(-1),
+fPdgIndexEpoch(0)
 {
 
 }
@@ -121,17 +123,10 @@ GHepParticle * GHepRecord::FindParticle(
 // Returns the first GHepParticle with the input pdg-code and status
 // starting from the specified position of the event record.
 
-  int nentries = this->GetEntries();
-  for(int i = start; i < nentries; i++) {
-     GHepParticle * p = (GHepParticle *) (*this)[i];
-     if(p->Status() == status && p->Pdg() == pdg) return p;
-  }
+  int pos = this->ParticlePosition(pdg, status, start);
+  if(pos < 0) return 0;
 
-  LOG("GHEP", pINFO)
-    << "No particle found with: (pos >= " << start
-    << ", pdg = " << pdg << ", ist = " << status << ")";
-
-  return 0;
+  return (GHepParticle *) (*this)[pos];
 }
 //___________________________________________________________________________
 int GHepRecord::ParticlePosition(
@@ -140,15 +135,21 @@ int GHepRecord::ParticlePosition(
 // Returns the position of the first GHepParticle with the input pdg-code
 // and status starting from the specified position of the event record.
 
-  int nentries = this->GetEntries();
-  for(int i = start; i < nentries; i++) {
-     GHepParticle * p = (GHepParticle *) (*this)[i];
-     if(p->Status() == status && p->Pdg() == pdg) return i;
+  const vector<int> * positions = this->PdgPositions(pdg);
+  if(positions) {
+    vector<int>::const_iterator it =
+        std::lower_bound(positions->begin(), positions->end(), start);
+    for( ; it != positions->end(); ++it) {
+       GHepParticle * p = (GHepParticle *) (*this)[*it];
+       if(p->Status() == status) return *it;
+    }
   }
 
-  LOG("GHEP", pINFO)
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("GHEP", pDEBUG)
     << "No particle found with: (pos >= " << start
     << ", pdg = " << pdg << ", ist = " << status << ")";
+#endif
 
   return -1;
 }
@@ -158,10 +159,14 @@ int GHepRecord::ParticlePosition(GHepParticle * particle, int start) const
 // Returns the position of the first match with the specified GHepParticle
 // starting from the specified position of the event record.
 
-  int nentries = this->GetEntries();
-  for(int i = start; i < nentries; i++) {
-     GHepParticle * p = (GHepParticle *) (*this)[i];
-     if( p->Compare(particle) ) return i;
+  const vector<int> * positions = this->PdgPositions(particle->Pdg());
+  if(positions) {
+    vector<int>::const_iterator it =
+        std::lower_bound(positions->begin(), positions->end(), start);
+    for( ; it != positions->end(); ++it) {
+       GHepParticle * p = (GHepParticle *) (*this)[*it];
+       if( p->Compare(particle) ) return *it;
+    }
   }
 
   LOG("GHEP", pINFO)
@@ -470,22 +475,25 @@ unsigned int GHepRecord::NEntries(int pdg, GHepStatus_t ist, int start) const
 {
   unsigned int nentries = 0;
 
-  for(int i = start; i < this->GetEntries(); i++) {
-     GHepParticle * p = (GHepParticle *) (*this)[i];
-     if(p->Pdg()==pdg && p->Status()==ist) nentries++;
+  const vector<int> * positions = this->PdgPositions(pdg);
+  if(!positions) return 0;
+
+  vector<int>::const_iterator it =
+      std::lower_bound(positions->begin(), positions->end(), start);
+  for( ; it != positions->end(); ++it) {
+     GHepParticle * p = (GHepParticle *) (*this)[*it];
+     if(p->Status()==ist) nentries++;
   }
   return nentries;
 }
 //___________________________________________________________________________
 unsigned int GHepRecord::NEntries(int pdg, int start) const
 {
-  unsigned int nentries = 0;
+  const vector<int> * positions = this->PdgPositions(pdg);
+  if(!positions) return 0;
 
-  for(int i = start; i < this->GetEntries(); i++) {
-     GHepParticle * p = (GHepParticle *) (*this)[i];
-     if(p->Pdg()==pdg) nentries++;
-  }
-  return nentries;
+  return positions->end() -
+      std::lower_bound(positions->begin(), positions->end(), start);
 }
 //___________________________________________________________________________
 void GHepRecord::AddParticle(const GHepParticle & p)
@@ -498,7 +506,9 @@ void GHepRecord::AddParticle(const GHepParticle & p)
   LOG("GHEP", pINFO)
     << "Adding particle with pdgc = " << p.Pdg() << " at slot = " << pos;
 #endif
+  bool indexed = this->PdgIndexIsCurrent();
   new ((*this)[pos]) GHepParticle(p);
+  this->IndexLastParticle(indexed);
 
   // Update the mother's daughter list. If the newly inserted particle broke
   // compactification, then run CompactifyDaughterLists()
@@ -517,7 +527,9 @@ void GHepRecord::AddParticle(
   LOG("GHEP", pINFO)
            << "Adding particle with pdgc = " << pdg << " at slot = " << pos;
 #endif
+  bool indexed = this->PdgIndexIsCurrent();
   new ((*this)[pos]) GHepParticle(pdg,status, mom1,mom2,dau1,dau2, p, v);
+  this->IndexLastParticle(indexed);
 
   // Update the mother's daughter list. If the newly inserted particle broke
   // compactification, then run CompactifyDaughterLists()
@@ -537,8 +549,10 @@ void GHepRecord::AddParticle(
   LOG("GHEP", pINFO)
            << "Adding particle with pdgc = " << pdg << " at slot = " << pos;
 #endif
+  bool indexed = this->PdgIndexIsCurrent();
   new ( (*this)[pos] ) GHepParticle (
             pdg, status, mom1, mom2, dau1, dau2, px, py, pz, E, x, y, z, t);
+  this->IndexLastParticle(indexed);
 
   // Update the mother's daughter list. If the newly inserted particle broke
   // compactification, then run CompactifyDaughterLists()
@@ -609,6 +623,7 @@ void GHepRecord::UpdateDaughterLists(void)
 void GHepRecord::RemoveIntermediateParticles(void)
 {
   LOG("GHEP", pNOTICE) << "Removing all intermediate particles from GHEP";
+  this->InvalidatePdgIndex();
   this->Compress();
 
   int i=0;
@@ -666,11 +681,9 @@ void GHepRecord::CompactifyDaughterLists(void)
         int ndp  = dau2+1;
         if(dau1==-1) {ndau=0;}
 
-        int curr_pos = n-1;
-        while (curr_pos > ndp) {
-           this->SwapParticles(curr_pos,curr_pos-1);
-           curr_pos--;
-        }
+        // move the new daughter right after its siblings
+        this->MoveLastParticle(ndp);
+        if(i >= ndp) i++; // the mother itself was shifted
         if(ndau>0) {
           this->Particle(i)->SetFirstDaughter(dau1);
           this->Particle(i)->SetLastDaughter(dau2+1);
@@ -751,6 +764,8 @@ void GHepRecord::SwapParticles(int i, int j)
 
   if(i==j) return;
 
+  this->InvalidatePdgIndex();
+
   GHepParticle * pi  = this->Particle(i);
   GHepParticle * pj  = this->Particle(j);
   GHepParticle * tmp = new GHepParticle(*pi);
@@ -788,31 +803,62 @@ void GHepRecord::SwapParticles(int i, int j)
   }
 }
 //___________________________________________________________________________
+void GHepRecord::MoveLastParticle(int pos)
+{
+// Moves the last entry to the input position, shifting the entries from that
+// position onwards by one slot, and updates the mother links of all entries.
+// Unlike a sequence of SwapParticles() calls it copies each particle once
+// and walks the record once.
+
+  int n    = this->GetEntries();
+  int last = n-1;
+  assert(pos>=0 && pos<=last);
+
+  if(pos==last) return;
+
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("GHEP", pINFO) << "Moving GHepParticle : " << last << " --> " << pos;
+#endif
+
+  this->InvalidatePdgIndex();
+
+  GHepParticle moved( *((GHepParticle *) (*this)[last]) );
+  for(int k = last; k > pos; k--) {
+     ((GHepParticle *) (*this)[k]) -> Copy( *((GHepParticle *) (*this)[k-1]) );
+  }
+  ((GHepParticle *) (*this)[pos]) -> Copy(moved);
+
+  // the entry previously at 'last' is now at 'pos' and the entries previously
+  // at [pos, last-1] moved one slot up
+  for(int k = 0; k < n; k++) {
+     GHepParticle * p = (GHepParticle *) (*this)[k];
+     int mom1 = p->FirstMother();
+     int mom2 = p->LastMother();
+     if      (mom1 == last)  p->SetFirstMother(pos);
+     else if (mom1 >= pos)   p->SetFirstMother(mom1+1);
+     if      (mom2 == last)  p->SetLastMother(pos);
+     else if (mom2 >= pos)   p->SetLastMother(mom2+1);
+  }
+}
+//___________________________________________________________________________
 void GHepRecord::FinalizeDaughterLists(void)
 {
 // Update all daughter-lists based on particle 'first mother' field.
 // To work correctly, the daughter-lists must have been compactified first.
 
-  GHepParticle * p1 = 0;
-  TIter iter1(this);
-  int i1=0;
-  while( (p1 = (GHepParticle *)iter1.Next()) ) {
-    int dau1 = -1;
-    int dau2 = -1;
-    GHepParticle * p2 = 0;
-    TIter iter2(this);
-    int i2=0;
-    while( (p2 = (GHepParticle *)iter2.Next()) ) {
-
-       if(p2->FirstMother() == i1) {
-          dau1 = (dau1<0) ? i2 : TMath::Min(dau1,i2);
-          dau2 = (dau2<0) ? i2 : TMath::Max(dau2,i2);
-       }
-       i2++;
-    }
-    i1++;
-    p1 -> SetFirstDaughter (dau1);
-    p1 -> SetLastDaughter  (dau2);
+  int n = this->GetEntries();
+  vector<int> dau1(n, -1);
+  vector<int> dau2(n, -1);
+  for(int i = 0; i < n; i++) {
+    int mom = ((GHepParticle *) (*this)[i])->FirstMother();
+    if(mom < 0 || mom >= n) continue;
+    if(dau1[mom] < 0) dau1[mom] = i;
+    dau2[mom] = i;
+  }
+  for(int i = 0; i < n; i++) {
+    GHepParticle * p = (GHepParticle *) (*this)[i];
+    p -> SetFirstDaughter (dau1[i]);
+    p -> SetLastDaughter  (dau2[i]);
   }
 }
 //___________________________________________________________________________
@@ -837,8 +883,13 @@ void GHepRecord::InitRecord(void)
   fXSec         = 0.;
   fDiffXSec     = 0.;
   fDiffXSecPhSp = kPSNull;
+  fXSecWeights.clear();
   fVtx          = new TLorentzVector(0,0,0,0);
 
+  fPdgIndex.clear();
+  fPdgIndexN     = -1;
+  fPdgIndexEpoch = 0;
+
   fEventFlags  = new TBits(GHepFlags::NFlags());
   fEventFlags -> ResetAllBits(false);
 
@@ -872,6 +923,39 @@ void GHepRecord::ResetRecord(void)
   this->InitRecord();
 }
 //___________________________________________________________________________
+void GHepRecord::RecycleRecord(void)
+{
+// Brings the record back to its initial (ResetRecord()) state for re-use,
+// without de-allocating and re-allocating: the particles are cleared in their
+// TClonesArray slots (and re-constructed in place as new ones are added) and
+// the vertex, flags & mask objects are reset. The interaction summary, if
+// any, is kept for its next owner to re-fill (see Interaction::Copy()).
+
+  if(!fVtx || !fEventFlags || !fEventMask) {
+    Interaction * interaction = fInteraction;
+    fInteraction = 0;
+    this->ResetRecord();
+    fInteraction = interaction;
+    return;
+  }
+
+  TClonesArray::Clear("C");
+  this->InvalidatePdgIndex();
+
+  fWeight       = 1.;
+  fProb         = 1.;
+  fXSec         = 0.;
+  fDiffXSec     = 0.;
+  fDiffXSecPhSp = kPSNull;
+  fXSecWeights.clear();
+  fVtx->SetXYZT(0,0,0,0);
+
+  fEventFlags -> ResetAllBits(false);
+  for(unsigned int i = 0; i < GHepFlags::NFlags(); i++) {
+   fEventMask->SetBitNumber(i, true);
+  }
+}
+//___________________________________________________________________________
 void GHepRecord::Clear(Option_t * opt)
 {
   if (fInteraction) delete fInteraction;
@@ -887,6 +971,7 @@ void GHepRecord::Clear(Option_t * opt)
   fEventMask=0;
 
   TClonesArray::Clear(opt);
+  this->InvalidatePdgIndex();
 
 //  if (fInteraction) delete fInteraction;
 //  delete fVtx;
@@ -898,8 +983,8 @@ void GHepRecord::Clear(Option_t * opt)
 //___________________________________________________________________________
 void GHepRecord::Copy(const GHepRecord & record)
 {
-  // clean up
-  this->ResetRecord();
+  // clean up (re-using the allocated particles, vertex, flags & summary)
+  this->RecycleRecord();
 
   // copy event record entries
   unsigned int ientry = 0;
@@ -907,9 +992,11 @@ void GHepRecord::Copy(const GHepRecord & record)
   TIter ghepiter(&record);
   while ( (p = (GHepParticle *) ghepiter.Next()) )
                               new ( (*this)[ientry++] ) GHepParticle(*p);
+  this->InvalidatePdgIndex();
 
   // copy summary
-  fInteraction = new Interaction( *record.fInteraction );
+  if(fInteraction) fInteraction->Copy( *record.fInteraction );
+  else             fInteraction = new Interaction( *record.fInteraction );
 
   // copy flags & mask
   *fEventFlags = *(record.EventFlags());
@@ -925,6 +1012,50 @@ void GHepRecord::Copy(const GHepRecord & record)
   fXSec         = record.fXSec;
   fDiffXSec     = record.fDiffXSec;
   fDiffXSecPhSp = record.fDiffXSecPhSp;
+  fXSecWeights  = record.fXSecWeights;
+}
+//___________________________________________________________________________
+const vector<int> * GHepRecord::PdgPositions(int pdg) const
+{
+// Returns the (ordered) positions of the entries with the input pdg code,
+// or 0 if there is none. Re-indexes the record if needed.
+
+  if(!this->PdgIndexIsCurrent()) {
+    int nentries = this->GetEntriesFast();
+    fPdgIndex.clear();
+    fPdgIndexEpoch = GHepParticle::PdgCodeEpoch();
+    for(int i = 0; i < nentries; i++) {
+       GHepParticle * p = (GHepParticle *) (*this)[i];
+       if(p) fPdgIndex[p->Pdg()].push_back(i);
+    }
+    fPdgIndexN = nentries;
+  }
+
+  map<int, vector<int> >::const_iterator it = fPdgIndex.find(pdg);
+  if(it == fPdgIndex.end() || it->second.empty()) return 0;
+  return &(it->second);
+}
+//___________________________________________________________________________
+bool GHepRecord::PdgIndexIsCurrent(void) const
+{
+  return fPdgIndexN >= 0 && fPdgIndexN == this->GetEntriesFast() &&
+         fPdgIndexEpoch == GHepParticle::PdgCodeEpoch();
+}
+//___________________________________________________________________________
+void GHepRecord::IndexLastParticle(bool index_was_current)
+{
+// Adds the just appended entry to the pdg index, if the index was current
+// before the insertion
+
+  int pos = this->GetEntriesFast() - 1;
+  if(!index_was_current || fPdgIndexN != pos) {
+    this->InvalidatePdgIndex();
+    return;
+  }
+  GHepParticle * p = (GHepParticle *) (*this)[pos];
+  fPdgIndex[p->Pdg()].push_back(pos);
+  fPdgIndexN     = pos + 1;
+  fPdgIndexEpoch = GHepParticle::PdgCodeEpoch();
 }
 //___________________________________________________________________________
 void GHepRecord::SetUnphysEventMask(const TBits & mask)
@@ -1047,6 +1178,9 @@ void GHepRecord::Print(ostream & stream) const
 
      if (p->RescatterCode() != -1) {
        stream << "FSI = " << p->RescatterCode();
+       if (p->RescatterWeight() != 1.) {
+         stream << " (w = " << p->RescatterWeight() << ")";
+       }
      }
 
      // plot particle position if requested
@@ -1192,6 +1326,15 @@ void GHepRecord::Print(ostream & stream) const
 
     stream << "\n|";
     stream << setfill('-') << setw(115) << "|";
+
+    if(fXSecWeights.size() > 0) {
+      stream << "\n| Alternative xsec model weights:";
+      for(unsigned int i = 0; i < fXSecWeights.size(); i++) {
+        stream << " " << setprecision(5) << fXSecWeights[i];
+      }
+      stream << "\n|";
+      stream << setfill('-') << setw(115) << "|";
+    }
   }
 
   stream << "\n";
@@ -20,6 +20,7 @@
 
 #include <ostream>
 #include <vector>
+#include <map>
 
 #include <TClonesArray.h>
 #include <TBits.h>
@@ -34,6 +35,7 @@ class TLorentzVector;
 
 using std::ostream;
 using std::vector;
+using std::map;
 
 namespace genie {
 
@@ -57,6 +59,7 @@ public :
   // Methods to attach / get summary information
 
   virtual Interaction * Summary       (void) const;
+  virtual bool          HasSummary    (void) const { return fInteraction != 0; }
   virtual void          AttachSummary (Interaction * interaction);
 
   // Provide a simplified wrapper of the 'new with placement'
@@ -135,6 +138,12 @@ public :
     fDiffXSec = (xsec>0) ? xsec : 0.;
   }
 
+  // Methods to set/get the event weights for alternative cross section model
+  // configurations, computed at generation time (see EVGAltXSecWeights)
+
+  virtual const vector<double> & XSecWeights    (void) const { return fXSecWeights; }
+  virtual void                   SetXSecWeights (const vector<double> & w) { fXSecWeights = w; }
+
   // Set/get event vertex in detector coordinate system
 
   virtual TLorentzVector * Vertex (void) const { return fVtx; }
@@ -147,6 +156,7 @@ public :
   virtual void Copy        (const GHepRecord & record);
   virtual void Clear       (Option_t * opt="");
   virtual void ResetRecord (void);
+  virtual void RecycleRecord (void); ///< as ResetRecord(), but keeping the allocated particle slots, vertex, flags & summary
   virtual void CompactifyDaughterLists     (void);
   virtual void RemoveIntermediateParticles (void);
 
@@ -180,15 +190,32 @@ protected:
   double           fXSec;           ///< cross section for selected event
   double           fDiffXSec;       ///< differential cross section for selected event kinematics
   KinePhaseSpace_t fDiffXSecPhSp;   ///< specifies which differential cross-section (dsig/dQ2, dsig/dQ2dW, dsig/dxdy,...)
+  vector<double>   fXSecWeights;    ///< weights for alternative xsec model configurations (empty if not computed)
+
+  // Transient index of the entry positions per pdg code, used by the search
+  // methods (the status codes change too often to be indexed and are checked
+  // on the indexed entries). Extended by AddParticle(), rebuilt on the next
+  // search after the entries are re-arranged or removed or after any pdg code
+  // change (see GHepParticle::PdgCodeEpoch()).
+  mutable map<int, vector<int> > fPdgIndex;      //! positions per pdg code
+  mutable int                    fPdgIndexN;     //! entries indexed (-1: invalid)
+  mutable unsigned long          fPdgIndexEpoch; //! pdg code epoch when indexed
 
   // Utility methods
   void InitRecord  (void);
   void CleanRecord (void);
 
+  // Methods used by the pdg index
+  const vector<int> * PdgPositions      (int pdg) const;
+  bool                PdgIndexIsCurrent (void) const;
+  void                IndexLastParticle (bool index_was_current);
+  void                InvalidatePdgIndex(void) { fPdgIndexN = -1; }
+
   // Methods used by the daughter list compactifier
   virtual void UpdateDaughterLists    (void);
   virtual bool HasCompactDaughterList (int pos);
   virtual void SwapParticles          (int i, int j);
+  virtual void MoveLastParticle       (int pos);
   virtual void FinalizeDaughterLists  (void);
   virtual int  FirstNonInitStateEntry (void);
 
@@ -197,7 +224,7 @@ protected:
 
 private:
 
-ClassDef(GHepRecord, 2)
+ClassDef(GHepRecord, 3)
 
 };
 
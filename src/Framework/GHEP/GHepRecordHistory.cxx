@@ -45,6 +45,12 @@ map<int, GHepRecord*>()
 GHepRecordHistory::~GHepRecordHistory()
 {
   this->PurgeHistory();
+
+  vector<GHepRecord *>::iterator rec_iter = fFreeRecords.begin();
+  for( ; rec_iter != fFreeRecords.end(); ++rec_iter) {
+    delete *rec_iter;
+  }
+  fFreeRecords.clear();
 }
 //___________________________________________________________________________
 void GHepRecordHistory::AddSnapshot(int step, GHepRecord * record)
@@ -65,7 +71,15 @@ void GHepRecordHistory::AddSnapshot(int step, GHepRecord * record)
      LOG("GHEP", pNOTICE)
                      << "Adding GHEP snapshot for processing step: " << step;
 
-     GHepRecord * snapshot = new GHepRecord(*record);
+     // re-use a previously purged snapshot, if one is available
+     GHepRecord * snapshot = 0;
+     if(fFreeRecords.empty()) {
+        snapshot = new GHepRecord(*record);
+     } else {
+        snapshot = fFreeRecords.back();
+        fFreeRecords.pop_back();
+        snapshot->Copy(*record);
+     }
      this->insert( map<int, GHepRecord*>::value_type(step,snapshot));
 
   } else {
@@ -89,11 +103,7 @@ void GHepRecordHistory::PurgeHistory(void)
     LOG("GHEP", pINFO)
                   << "Deleting GHEP snapshot for processing step: " << step;
 
-    GHepRecord * record = history_iter->second;
-    if(record) {
-      delete record;
-      record = 0;
-    }
+    this->Recycle(history_iter->second);
   }
   this->clear();
 }
@@ -121,19 +131,24 @@ void GHepRecordHistory::PurgeRecentHistory(int start_step)
     return;
   }
 
-  GHepRecordHistory::iterator history_iter;
-  for(history_iter = this->begin();
-                              history_iter != this->end(); ++history_iter) {
-
-    if(history_iter->first >= start_step) {
-       int step = history_iter->first;
-       LOG("GHEP", pINFO)
-                  << "Deleting GHEP snapshot for processing step: " << step;
-       this->erase(history_iter);
-    }
+  GHepRecordHistory::iterator history_iter = this->lower_bound(start_step);
+  while(history_iter != this->end()) {
+     int step = history_iter->first;
+     LOG("GHEP", pINFO)
+                << "Deleting GHEP snapshot for processing step: " << step;
+     this->Recycle(history_iter->second);
+     this->erase(history_iter++);
   }
 }
 //___________________________________________________________________________
+void GHepRecordHistory::Recycle(GHepRecord * record)
+{
+  if(!record) return;
+
+  record->ResetRecord();
+  fFreeRecords.push_back(record);
+}
+//___________________________________________________________________________
 void GHepRecordHistory::Copy(const GHepRecordHistory & history)
 {
   this->PurgeHistory();
@@ -7,7 +7,9 @@
           the processing steps of an event generation thread.
           The event record history can be used to step back in the generation
           sequence if a processing step is to be re-run (this the GENIE event
-          generation framework equivalent of an 'Undo')
+          generation framework equivalent of an 'Undo').
+          Purged snapshots are recycled, so that, in steady state, taking a
+          snapshot only copies the record contents and allocates nothing.
 
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
@@ -23,10 +25,12 @@
 #define _GHEP_RECORD_HISTORY_H_
 
 #include <map>
+#include <vector>
 #include <string>
 #include <ostream>
 
 using std::map;
+using std::vector;
 using std::string;
 using std::ostream;
 
@@ -57,6 +61,10 @@ public :
 
 private:
 
+  void Recycle (GHepRecord * record);
+
+  vector<GHepRecord *> fFreeRecords; ///< purged snapshots, kept for re-use
+
   bool fEnabledFull;          ///< keep the full GHEP record history
   bool fEnabledBootstrapStep; ///< keep only the record that bootsrapped the generation cycle
 };
@@ -15,6 +15,7 @@
 //____________________________________________________________________________
 
 #include <cassert>
+#include <cstring>
 #include <sstream>
 #include <iomanip>
 
@@ -424,6 +425,30 @@ string InitialState::AsString(void) const
   return init_state.str();
 }
 //___________________________________________________________________________
+uint64_t InitialState::Hash(void) const
+{
+// FNV-1a over the fields of AsString(): probe code (or mass, for probes
+// with a nonzero mass), and target code
+
+  uint64_t fields[3] = { 0, 0, (uint64_t) (unsigned int) this->Tgt().Pdg() };
+
+  double mass = this->Probe()->Mass();
+  if (mass > 0) {
+    fields[0] = 1;
+    std::memcpy(&fields[1], &mass, sizeof(double));
+  }
+  else {
+    fields[1] = (uint64_t) (unsigned int) this->ProbePdg();
+  }
+
+  uint64_t h = 14695981039346656037ULL;
+  for(int i = 0; i < 3; i++) {
+    h ^= fields[i];
+    h *= 1099511628211ULL;
+  }
+  return h;
+}
+//___________________________________________________________________________
 void InitialState::Print(ostream & stream) const
 {
   stream << "[-] [Init-State] " << endl;
@@ -25,6 +25,7 @@
 #ifndef _INITIAL_STATE_H_
 #define _INITIAL_STATE_H_
 
+#include <cstdint>
 #include <iostream>
 #include <string>
 
@@ -67,6 +68,7 @@ public:
   Target *         TgtPtr     (void) const { return  fTgt; }
   TLorentzVector * GetTgtP4   (RefFrame_t rf = kRfLab) const;
   TLorentzVector * GetProbeP4 (RefFrame_t rf = kRfHitNucRest) const;
+  const TLorentzVector & ProbeP4Lab (void) const { return *fProbeP4; } ///< no copy made
   double           ProbeE     (RefFrame_t rf) const;
   double           CMEnergy   () const; ///< centre-of-mass energy (sqrt s)
 
@@ -93,6 +95,10 @@ public:
   string AsString (void) const;
   void   Print    (ostream & stream) const;
 
+  //! 64-bit hash of the fields of the string code (see AsString()), for
+  //! hash-keyed lookups
+  uint64_t Hash (void) const;
+
   //-- Overloaded operators
   bool             operator == (const InitialState & i) const;             ///< equal?
   InitialState &   operator =  (const InitialState & i);                   ///< copy
@@ -67,7 +67,9 @@ fInitialState(0),
 fProcInfo(0),
 fKinematics(0),
 fExclusiveTag(0),
-fKinePhSp(0)
+fKinePhSp(0),
+fStringIsSet(false),
+fGenIndex(-1)
 {
 
 }
@@ -90,6 +92,9 @@ void Interaction::Init(void)
   fKinematics   = new Kinematics   ();
   fExclusiveTag = new XclsTag      ();
   fKinePhSp     = new KPhaseSpace  (this);
+
+  fStringIsSet  = false;
+  fGenIndex     = -1;
 }
 //___________________________________________________________________________
 void Interaction::CleanUp(void)
@@ -118,6 +123,8 @@ void Interaction::Copy(const Interaction & interaction)
   fProcInfo     -> Copy (proc);
   fKinematics   -> Copy (kine);
   fExclusiveTag -> Copy (xcls);
+
+  fGenIndex = interaction.fGenIndex;
 }
 //___________________________________________________________________________
 TParticlePDG * Interaction::FSPrimLepton(void) const
@@ -234,7 +241,21 @@ void Interaction::SetExclTag(const XclsTag & xcls_tag)
   fExclusiveTag->Copy(xcls_tag);
 }
 //___________________________________________________________________________
-string Interaction::AsString(void) const
+const string & Interaction::AsString(void) const
+{
+// The string code is a function of the integer code: it is only rebuilt
+// if the latter has changed since it was last built
+
+  InteractionCode code = this->Code();
+  if(!fStringIsSet || code != fStringCode) {
+    fString      = this->BuildString();
+    fStringCode  = code;
+    fStringIsSet = true;
+  }
+  return fString;
+}
+//___________________________________________________________________________
+string Interaction::BuildString(void) const
 {
 // Code-ify the interaction in a string to be used as (part of a) cache
 // branch key.
@@ -275,6 +296,39 @@ string Interaction::AsString(void) const
   return interaction.str();
 }
 //___________________________________________________________________________
+InteractionCode Interaction::Code(void) const
+{
+// Integer version of AsString(): keep the two in sync.
+
+  const Target &  tgt  = fInitialState->Tgt();
+  const XclsTag & xcls = *fExclusiveTag;
+
+  InteractionCode code;
+  int * f = code.fField;
+  f[ 0] = fInitialState->ProbePdg();
+  f[ 1] = tgt.Pdg();
+  f[ 2] = (tgt.HitNucIsSet()) ? tgt.HitNucPdg() : 0;
+  f[ 3] = (tgt.HitQrkIsSet()) ? tgt.HitQrkPdg() : 0;
+  f[ 4] = (tgt.HitQrkIsSet()) ? (int) tgt.HitSeaQrk() : -1;
+  f[ 5] = (int) fProcInfo->InteractionTypeId();
+  f[ 6] = (int) fProcInfo->ScatteringTypeId();
+  f[ 7] = (xcls.IsCharmEvent())   ? xcls.CharmHadronPdg()   : -1;
+  f[ 8] = (xcls.IsStrangeEvent()) ? xcls.StrangeHadronPdg() : -1;
+  f[ 9] = xcls.NProtons();
+  f[10] = xcls.NNeutrons();
+  f[11] = xcls.NPiPlus();
+  f[12] = xcls.NPiMinus();
+  f[13] = xcls.NPi0();
+  f[14] = xcls.NSingleGammas();
+  f[15] = xcls.NRhoPlus();
+  f[16] = xcls.NRhoMinus();
+  f[17] = xcls.NRho0();
+  f[18] = (int) xcls.Resonance();
+  f[19] = xcls.DecayMode();
+
+  return code;
+}
+//___________________________________________________________________________
 void Interaction::Print(ostream & stream) const
 {
   const string line(110, '-');
@@ -35,6 +35,7 @@
 #include "Framework/Interaction/Kinematics.h"
 #include "Framework/Interaction/XclsTag.h"
 #include "Framework/Interaction/KPhaseSpace.h"
+#include "Framework/Interaction/InteractionCode.h"
 
 using std::ostream;
 using std::string;
@@ -89,11 +90,30 @@ public:
   TParticlePDG * FSPrimLepton     (void) const; ///< final state primary lepton
   TParticlePDG * RecoilNucleon    (void) const; ///< recoil nucleon 
 
-  // Copy, reset, print itself and build string code
-  void   Reset    (void);
-  void   Copy     (const Interaction & i);
-  string AsString (void) const;
-  void   Print    (ostream & stream) const;
+  // Copy, reset, print itself and build string code.
+  // The string code is cached, and only rebuilt when the interaction fields
+  // it is made of change (as per Code())
+  void           Reset    (void);
+  void           Copy     (const Interaction & i);
+  const string & AsString (void) const;
+  void           Print    (ostream & stream) const;
+
+  // Build the integer code corresponding to the string code (see AsString())
+  InteractionCode Code (void) const;
+
+  // 64-bit hash of the integer code, for hash-keyed lookups (see eg
+  // XSecSplineList, Cache and GEVGPool). Interactions with the same string
+  // code have the same hash; hash collisions between different interactions
+  // are assumed not to happen (their probability is ~1E-11 for the 10^4 or
+  // so keys of a job)
+  uint64_t Hash (void) const { return this->Code().Digest(); }
+
+  // Position of the EventGeneratorI that generates the interaction in the
+  // EventGeneratorList, set when the interaction lists are assembled (see
+  // InteractionGeneratorMap::BuildMap()) so that the generator can be found
+  // without a string-keyed lookup. Carried over by Copy(); -1 if unset.
+  int  GeneratorIndex    (void) const { return fGenIndex; }
+  void SetGeneratorIndex (int i)      { fGenIndex = i;    }
 
   // Overloaded operators
   Interaction &    operator =  (const Interaction & i);                   ///< copy
@@ -170,12 +190,20 @@ private:
   // Utility method for "named ctor"
   static Interaction * Create(int tgt, int probe, ScatteringType_t st, InteractionType_t it);
 
+  // Build the string code (see AsString())
+  string BuildString (void) const;
+
   // Private data members
   InitialState * fInitialState;  ///< Initial State info
   ProcessInfo *  fProcInfo;      ///< Process info (scattering, weak current,...)
   Kinematics *   fKinematics;    ///< kinematical variables
   XclsTag *      fExclusiveTag;  ///< Additional info for exclusive channels
   KPhaseSpace *  fKinePhSp;      ///< Kinematic phase space
+
+  mutable string          fString;       //! cached string code
+  mutable InteractionCode fStringCode;   //! integer code the cached string code was built for
+  mutable bool            fStringIsSet;  //! is there a cached string code?
+  int                     fGenIndex;     //! EventGeneratorList position of the interaction generator (-1: unset)
   
 ClassDef(Interaction,2)
 };
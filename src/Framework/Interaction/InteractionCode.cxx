@@ -0,0 +1,39 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include "Framework/Interaction/InteractionCode.h"
+
+using namespace genie;
+
+//___________________________________________________________________________
+bool InteractionCode::operator == (const InteractionCode & code) const
+{
+  for(int i = 0; i < kNFields; i++) {
+    if(fField[i] != code.fField[i]) return false;
+  }
+  return true;
+}
+//___________________________________________________________________________
+uint64_t InteractionCode::Digest(void) const
+{
+  // FNV-1a over the fields
+  uint64_t h = 14695981039346656037ULL;
+  for(int i = 0; i < kNFields; i++) {
+    h ^= (uint64_t) (unsigned int) fField[i];
+    h *= 1099511628211ULL;
+  }
+  return h;
+}
+//___________________________________________________________________________
+size_t InteractionCode::Hash::operator () (const InteractionCode & code) const
+{
+  return (size_t) code.Digest();
+}
+//___________________________________________________________________________
@@ -0,0 +1,49 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::InteractionCode
+
+\brief    A compact, allocation-free integer code of the interaction fields
+          packed in the Interaction::AsString() string code (see
+          Interaction::Code()). Interactions with the same string code have
+          the same InteractionCode (and vice versa, except that the code
+          does not merge fields the string code omits when empty).
+          Used for keying per-interaction lookups at hot code paths.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _INTERACTION_CODE_H_
+#define _INTERACTION_CODE_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace genie {
+
+struct InteractionCode {
+  static const int kNFields = 20;
+  int fField[kNFields];
+
+  bool operator == (const InteractionCode & code) const;
+  bool operator != (const InteractionCode & code) const { return !(*this == code); }
+
+  //! 64-bit hash of the fields
+  uint64_t Digest (void) const;
+
+  //! hash functor, for use in unordered containers
+  struct Hash {
+    size_t operator () (const InteractionCode & code) const;
+  };
+};
+
+}      // genie namespace
+
+#endif // _INTERACTION_CODE_H_
@@ -75,9 +75,49 @@ double KPhaseSpace::GetTMaxDFR()
 void KPhaseSpace::UseInteraction(const Interaction * in)
 {
   fInteraction = in;
+  fCachedMask  = 0;
+}
+//___________________________________________________________________________
+void KPhaseSpace::CheckCachedState(void) const
+{
+// Forgets the memoized limits if the interaction initial state (probe and
+// hit nucleon 4-momenta, or any of the fields of the interaction code) has
+// changed since they were computed
+
+  const InitialState &   init_state = fInteraction->InitState();
+  const TLorentzVector & k4 = init_state.ProbeP4Lab();
+  const TLorentzVector * p4 = init_state.Tgt().HitNucP4Ptr();
+
+  double P4[8] = { k4.Px(), k4.Py(), k4.Pz(), k4.E(), 0, 0, 0, 0 };
+  if(p4) {
+    P4[4] = p4->Px(); P4[5] = p4->Py(); P4[6] = p4->Pz(); P4[7] = p4->E();
+  }
+  InteractionCode code = fInteraction->Code();
+
+  bool same = (fCachedMask != 0) && (code == fCachedCode);
+  for(int i = 0; same && i < 8; i++) {
+    same = (P4[i] == fCachedP4[i]);
+  }
+  if(same) return;
+
+  fCachedCode = code;
+  for(int i = 0; i < 8; i++) fCachedP4[i] = P4[i];
+  fCachedMask = 0;
 }
 //___________________________________________________________________________
 double KPhaseSpace::Threshold(void) const
+{
+  this->CheckCachedState();
+  if(fCachedMask & (1<<kCLThreshold)) return fCachedLimits[kCLThreshold].min;
+
+  double Ethr = this->ComputeThreshold();
+
+  fCachedLimits[kCLThreshold].min = Ethr;
+  fCachedMask |= (1<<kCLThreshold);
+  return Ethr;
+}
+//___________________________________________________________________________
+double KPhaseSpace::ComputeThreshold(void) const
 {
   const ProcessInfo &  pi         = fInteraction->ProcInfo();
   const InitialState & init_state = fInteraction->InitState();
@@ -392,6 +432,16 @@ bool KPhaseSpace::IsAllowed(void) const
 }
 //___________________________________________________________________________
 Range1D_t KPhaseSpace::WLim(void) const
+{
+  this->CheckCachedState();
+  if(fCachedMask & (1<<kCLW)) return fCachedLimits[kCLW];
+
+  fCachedLimits[kCLW] = this->ComputeWLim();
+  fCachedMask |= (1<<kCLW);
+  return fCachedLimits[kCLW];
+}
+//____________________________________________________________________________
+Range1D_t KPhaseSpace::ComputeWLim(void) const
 {
 // Computes hadronic invariant mass limits.
 // For QEL the range reduces to the recoil nucleon mass.
@@ -523,6 +573,16 @@ Range1D_t KPhaseSpace::q2Lim_W(void) const
 }
 //____________________________________________________________________________
 Range1D_t KPhaseSpace::Q2Lim(void) const
+{
+  this->CheckCachedState();
+  if(fCachedMask & (1<<kCLQ2)) return fCachedLimits[kCLQ2];
+
+  fCachedLimits[kCLQ2] = this->ComputeQ2Lim();
+  fCachedMask |= (1<<kCLQ2);
+  return fCachedLimits[kCLQ2];
+}
+//____________________________________________________________________________
+Range1D_t KPhaseSpace::ComputeQ2Lim(void) const
 {
   // Computes momentum transfer (Q2>0) limits irrespective of the invariant mass
   // For QEL this is identical to Q2Lim_W (since W is fixed)
@@ -643,6 +703,16 @@ Range1D_t KPhaseSpace::q2Lim(void) const
 }
 //____________________________________________________________________________
 Range1D_t KPhaseSpace::XLim(void) const
+{
+  this->CheckCachedState();
+  if(fCachedMask & (1<<kCLx)) return fCachedLimits[kCLx];
+
+  fCachedLimits[kCLx] = this->ComputeXLim();
+  fCachedMask |= (1<<kCLx);
+  return fCachedLimits[kCLx];
+}
+//____________________________________________________________________________
+Range1D_t KPhaseSpace::ComputeXLim(void) const
 {
   // Computes x-limits;
 
@@ -697,6 +767,16 @@ Range1D_t KPhaseSpace::XLim(void) const
 }
 //____________________________________________________________________________
 Range1D_t KPhaseSpace::YLim(void) const
+{
+  this->CheckCachedState();
+  if(fCachedMask & (1<<kCLy)) return fCachedLimits[kCLy];
+
+  fCachedLimits[kCLy] = this->ComputeYLim();
+  fCachedMask |= (1<<kCLy);
+  return fCachedLimits[kCLy];
+}
+//____________________________________________________________________________
+Range1D_t KPhaseSpace::ComputeYLim(void) const
 {
   Range1D_t yl;
   yl.min = -1;
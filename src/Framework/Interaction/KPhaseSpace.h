@@ -23,6 +23,7 @@
 #include <TObject.h>
 
 #include "Framework/Conventions/KineVar.h"
+#include "Framework/Interaction/InteractionCode.h"
 //#include "Interaction/KPhaseSpaceCut.h"
 #include "Framework/Utils/Range1.h"
 
@@ -70,8 +71,25 @@ public:
 private:
   void Init(void);
 
+  // The limits that depend only on the interaction initial state (not on
+  // the running kinematics) are computed once per state and memoized
+  enum ECachedLimit {
+    kCLThreshold = 0, kCLW, kCLQ2, kCLx, kCLy, kNCachedLimits
+  };
+  void      CheckCachedState (void) const;
+  double    ComputeThreshold (void) const;
+  Range1D_t ComputeWLim      (void) const;
+  Range1D_t ComputeQ2Lim     (void) const;
+  Range1D_t ComputeXLim      (void) const;
+  Range1D_t ComputeYLim      (void) const;
+
   const Interaction * fInteraction;
 
+  mutable InteractionCode fCachedCode;                  //! interaction code of the memoized state
+  mutable double          fCachedP4[8];                 //! probe & hit nucleon 4-momenta of the memoized state
+  mutable unsigned int    fCachedMask;                  //! bit i set if fCachedLimits[i] is valid
+  mutable Range1D_t       fCachedLimits[kNCachedLimits]; //! memoized limits (threshold kept in .min)
+
 ClassDef(KPhaseSpace,2)
 };
 
@@ -18,14 +18,12 @@
 #ifndef _KINEMATICS_H_
 #define _KINEMATICS_H_
 
-#include <map>
 #include <iostream>
 
 #include <TObject.h>
 
 #include "Framework/Conventions/KineVar.h"
 
-using std::map;
 using std::ostream;
 
 class TRootIOCtor;
@@ -97,13 +95,16 @@ private:
   void Init    (void); ///< initialize
   void CleanUp (void); ///< clean-up
 
+  static unsigned int KVBit (KineVar_t kv) { return 1u << kv; }
+
   //-- Private data members
 
-  map<KineVar_t, double> fKV;        ///< selected kinematics
-  TLorentzVector *       fP4Fsl;     ///< generated final state primary lepton 4-p  (LAB)
-  TLorentzVector *       fP4HadSyst; ///< generated final state hadronic system 4-p (LAB)
+  double           fKV[kNumOfKineVar]; ///< kinematic variables, indexed by KineVar_t
+  unsigned int     fKVMask;            ///< bit kv is set if fKV[kv] holds a value
+  TLorentzVector * fP4Fsl;             ///< generated final state primary lepton 4-p  (LAB)
+  TLorentzVector * fP4HadSyst;         ///< generated final state hadronic system 4-p (LAB)
 
-ClassDef(Kinematics,2)
+ClassDef(Kinematics,3)
 };
 
 }       // genie namespace
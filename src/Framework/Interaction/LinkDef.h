@@ -14,8 +14,17 @@
 #pragma link C++ class genie::XclsTag;
 #pragma link C++ class genie::KPhaseSpace;
 
+// Kinematics objects up to v2 stored their variables in a map
 #pragma link C++ class std::map<genie::KineVar_t,double>+; // in Kinematics object
 #pragma link C++ class std::pair<genie::KineVar_t,double>+; // in Kinematics object
+#pragma read sourceClass="genie::Kinematics" version="[-2]" \
+  source="std::map<genie::KineVar_t,double> fKV" \
+  targetClass="genie::Kinematics" target="fKV,fKVMask" \
+  code="{ fKVMask = 0; \
+          std::map<genie::KineVar_t,double>::const_iterator it; \
+          for(it = onfile.fKV.begin(); it != onfile.fKV.end(); ++it) { \
+            if(it->first < 0 || it->first >= genie::kNumOfKineVar) continue; \
+            fKV[it->first] = it->second; fKVMask |= (1u << it->first); } }"
 
 #pragma link C++ ioctortype TRootIOCtor;
 
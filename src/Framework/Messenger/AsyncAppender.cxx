@@ -0,0 +1,176 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <chrono>
+#include <mutex>
+
+#include <pthread.h>
+
+#include "log4cpp/Priority.hh"
+
+#include "Framework/Messenger/AsyncAppender.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+std::atomic<bool> AsyncAppender::fgForked(false);
+//____________________________________________________________________________
+AsyncAppender::AsyncAppender(
+   const string & name, ostream * stream, unsigned int capacity) :
+log4cpp::LayoutAppender(name),
+fStream     (stream),
+fEnqueuePos (0),
+fDequeuePos (0),
+fNWritten   (0),
+fStop       (false)
+{
+  // the ring buffer size must be a power of 2
+  size_t size = 2;
+  while(size < capacity) size <<= 1;
+
+  fSlots.reset(new Slot[size]);
+  fMask = size - 1;
+  for(size_t i = 0; i < size; i++) {
+    fSlots[i].seq.store(i, std::memory_order_relaxed);
+  }
+
+  static std::once_flag atfork_flag;
+  std::call_once(atfork_flag, [] () {
+    pthread_atfork(0, 0, &AsyncAppender::ForkedChild);
+  });
+
+  fWorker = std::thread(&AsyncAppender::Drain, this);
+}
+//____________________________________________________________________________
+AsyncAppender::~AsyncAppender()
+{
+  this->close();
+}
+//____________________________________________________________________________
+bool AsyncAppender::reopen(void)
+{
+  return true;
+}
+//____________________________________________________________________________
+void AsyncAppender::close(void)
+{
+  if(fgForked.load()) {
+    // The worker thread does not exist in this process
+    if(fWorker.joinable()) fWorker.detach();
+    return;
+  }
+  fStop.store(true);
+  if(fWorker.joinable()) fWorker.join();
+}
+//____________________________________________________________________________
+void AsyncAppender::Flush(void)
+{
+  if(fgForked.load() || !fWorker.joinable()) return;
+
+  size_t target = fEnqueuePos.load();
+  while(fNWritten.load() < target) {
+    std::this_thread::yield();
+  }
+}
+//____________________________________________________________________________
+void AsyncAppender::_append(const log4cpp::LoggingEvent & event)
+{
+  string msg = _getLayout().format(event);
+
+  if(fgForked.load(std::memory_order_relaxed) || fStop.load()) {
+    (*fStream) << msg;
+    return;
+  }
+
+  while(!this->Push(msg)) {
+    std::this_thread::yield();
+  }
+
+  if(event.priority <= log4cpp::Priority::ERROR) {
+    this->Flush();
+  }
+}
+//____________________________________________________________________________
+bool AsyncAppender::Push(string & msg)
+{
+// Bounded MPSC queue push (after D.Vyukov's bounded MPMC queue).
+// Returns false if the buffer is full.
+
+  size_t pos = fEnqueuePos.load(std::memory_order_relaxed);
+  Slot * slot = 0;
+  while(true) {
+    slot = &fSlots[pos & fMask];
+    size_t seq = slot->seq.load(std::memory_order_acquire);
+    long diff = (long) seq - (long) pos;
+    if(diff == 0) {
+      if(fEnqueuePos.compare_exchange_weak(
+           pos, pos + 1, std::memory_order_relaxed)) break;
+    }
+    else if(diff < 0) {
+      return false;
+    }
+    else {
+      pos = fEnqueuePos.load(std::memory_order_relaxed);
+    }
+  }
+  slot->msg.swap(msg);
+  slot->seq.store(pos + 1, std::memory_order_release);
+  return true;
+}
+//____________________________________________________________________________
+bool AsyncAppender::Pop(string & msg)
+{
+// Single consumer pop. Returns false if the buffer is empty.
+
+  Slot & slot = fSlots[fDequeuePos & fMask];
+  size_t seq = slot.seq.load(std::memory_order_acquire);
+  if((long) seq - (long) (fDequeuePos + 1) < 0) return false;
+
+  msg.swap(slot.msg);
+  slot.msg.clear();
+  slot.seq.store(fDequeuePos + fMask + 1, std::memory_order_release);
+  fDequeuePos++;
+  return true;
+}
+//____________________________________________________________________________
+void AsyncAppender::Drain(void)
+{
+// Background thread: writes out the queued records, flushing the output
+// stream whenever the queue runs empty.
+
+  string msg;
+  bool pending_flush = false;
+  while(true) {
+    if(this->Pop(msg)) {
+      (*fStream) << msg;
+      fNWritten.fetch_add(1);
+      pending_flush = true;
+      continue;
+    }
+    if(pending_flush) {
+      fStream->flush();
+      pending_flush = false;
+    }
+    if(fStop.load()) {
+      // claimed slots may still be being filled
+      if(fNWritten.load() == fEnqueuePos.load()) break;
+      std::this_thread::yield();
+      continue;
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds(200));
+  }
+  fStream->flush();
+}
+//____________________________________________________________________________
+void AsyncAppender::ForkedChild(void)
+{
+  fgForked.store(true);
+}
+//____________________________________________________________________________
@@ -0,0 +1,101 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::AsyncAppender
+
+\brief    A log4cpp appender that moves the message output off the calling
+          threads.
+
+          Messages are formatted (using the appender layout) by the calling
+          thread and pushed, as preformatted records, in a bounded lock-free
+          multi-producer / single-consumer ring buffer. A background thread
+          drains the buffer and writes the records to the output stream.
+          If the buffer is full, the calling thread waits for a free slot:
+          messages are never dropped.
+
+          Messages of priority ERROR or higher are written out before the
+          logging call returns, so that they are not lost if the job aborts.
+
+          In processes forked after the background thread was started, the
+          appender falls back to writing out messages synchronously.
+
+          Enabled via the GMSGASYNC environmental variable, or the <async>
+          tag of the messenger XML configuration (see Messenger).
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _ASYNC_APPENDER_H_
+#define _ASYNC_APPENDER_H_
+
+// ROOT5 has difficulty with parsing log4cpp headers
+#if !defined(__CINT__) && !defined(__MAKECINT__)
+
+#include <iostream>
+#include <string>
+#include <atomic>
+#include <thread>
+#include <memory>
+
+#include "log4cpp/LayoutAppender.hh"
+#include "log4cpp/LoggingEvent.hh"
+
+using std::string;
+using std::ostream;
+
+namespace genie {
+
+class AsyncAppender : public log4cpp::LayoutAppender
+{
+public:
+  AsyncAppender(const string & name, ostream * stream,
+                unsigned int capacity = 8192);
+  virtual ~AsyncAppender();
+
+  //! Waits until all messages logged so far have been written out
+  void Flush (void);
+
+  virtual bool reopen (void);
+  virtual void close  (void);
+
+protected:
+  virtual void _append (const log4cpp::LoggingEvent & event);
+
+private:
+  // Slot of the ring buffer. The sequence number tells producers and the
+  // consumer whose turn it is to access the slot.
+  struct Slot {
+    std::atomic<size_t> seq;
+    string              msg;
+  };
+
+  bool Push  (string & msg);
+  bool Pop   (string & msg);
+  void Drain (void);
+
+  static void ForkedChild (void);
+
+  ostream *                fStream;
+  std::unique_ptr<Slot[]>  fSlots;
+  size_t                   fMask;
+  std::atomic<size_t>      fEnqueuePos;  ///< next slot to be filled (producers)
+  size_t                   fDequeuePos;  ///< next slot to be drained (consumer only)
+  std::atomic<size_t>      fNWritten;    ///< number of records written out so far
+  std::atomic<bool>        fStop;
+  std::thread              fWorker;
+
+  static std::atomic<bool> fgForked;     ///< set in child processes forked after start-up
+};
+
+}      // genie namespace
+
+#endif // !__CINT__
+
+#endif // _ASYNC_APPENDER_H_
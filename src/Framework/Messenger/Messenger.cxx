@@ -11,6 +11,9 @@
 #include <iostream>
 #include <vector>
 #include <iomanip>
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
 
 #include "libxml/parser.h"
 #include "libxml/xmlmemory.h"
@@ -18,6 +21,7 @@
 
 #include <TSystem.h>
 
+#include "Framework/Messenger/AsyncAppender.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Utils/StringUtils.h"
 #include "Framework/Utils/PrintUtils.h"
@@ -35,14 +39,18 @@ bool genie::gAbortingInErr = false;
 
 //____________________________________________________________________________
 Messenger * Messenger::fInstance = 0;
+std::atomic<int>          Messenger::fgMaxPriority(log4cpp::Priority::NOTSET);
+std::atomic<unsigned int> Messenger::fgGeneration(1);
 //____________________________________________________________________________
 Messenger::Messenger()
 {
   fInstance =  0;
+  fAsyncAppender = 0;
 }
 //____________________________________________________________________________
 Messenger::~Messenger()
 {
+  this->Flush();
   fInstance = 0;
 }
 //____________________________________________________________________________
@@ -58,26 +66,62 @@ Messenger * Messenger::Instance()
 
     fInstance = new Messenger;
 
-    log4cpp::Appender * appender;
-    appender = new log4cpp::OstreamAppender("default", &cout);
-    const char* layoutenv = gSystem->Getenv("GMSGLAYOUT");
-    std::string layoutstr = (layoutenv) ? string(layoutenv) : "BASIC";
-    if ( layoutstr == "SIMPLE" )
-      appender->setLayout(new log4cpp::SimpleLayout());
-    else
-      appender->setLayout(new log4cpp::BasicLayout());
+    log4cpp::Category & MSG = log4cpp::Category::getRoot();
+    MSG.setAdditivity(false);
 
+    // asynchronous output requested via the environment?
+    const char* asyncenv = gSystem->Getenv("GMSGASYNC");
+    string asyncstr = (asyncenv) ? utils::str::ToUpper(asyncenv) : "NO";
+    bool async = (asyncstr == "YES" || asyncstr == "TRUE" || asyncstr == "1");
 
-    log4cpp::Category & MSG = log4cpp::Category::getRoot();
+    fInstance->SetAsync(async);
 
-    MSG.setAdditivity(false);
-    MSG.addAppender(appender);
+    fInstance->UpdateMaxPriority();
 
     fInstance->Configure(); // set user-defined priority levels
   }
   return fInstance;
 }
 //____________________________________________________________________________
+void Messenger::SetAsync(bool on)
+{
+// Replaces the root category appender with either a synchronous (the
+// default) or an asynchronous one. The layout is set via the GMSGLAYOUT
+// environmental variable.
+
+  log4cpp::Category & MSG = log4cpp::Category::getRoot();
+
+  // nothing to change?
+  if(MSG.getAppender("default") && on == this->IsAsync()) return;
+
+  log4cpp::Appender * appender = 0;
+  AsyncAppender * async_appender = 0;
+  if(on) {
+    async_appender = new AsyncAppender("default", &cout);
+    appender = async_appender;
+  } else {
+    appender = new log4cpp::OstreamAppender("default", &cout);
+  }
+
+  const char* layoutenv = gSystem->Getenv("GMSGLAYOUT");
+  std::string layoutstr = (layoutenv) ? string(layoutenv) : "BASIC";
+  if ( layoutstr == "SIMPLE" )
+    appender->setLayout(new log4cpp::SimpleLayout());
+  else
+    appender->setLayout(new log4cpp::BasicLayout());
+
+  // the old appender (if any) writes out all its queued messages on deletion
+  MSG.removeAllAppenders();
+  MSG.addAppender(appender);
+
+  fAsyncAppender = async_appender;
+}
+//____________________________________________________________________________
+void Messenger::Flush(void)
+{
+  if(fAsyncAppender) fAsyncAppender->Flush();
+}
+//____________________________________________________________________________
 log4cpp::Category & Messenger::operator () (const char * stream)
 {
   log4cpp::Category & MSG = log4cpp::Category::getInstance(stream);
@@ -88,9 +132,64 @@ log4cpp::Category & Messenger::operator () (const char * stream)
 void Messenger::SetPriorityLevel(
    const char * stream, log4cpp::Priority::Value priority)
 {
+  static std::mutex priority_mutex;
+  std::lock_guard<std::mutex> lock(priority_mutex);
+
   log4cpp::Category & MSG = log4cpp::Category::getInstance(stream);
 
   MSG.setPriority(priority);
+
+  fPriorities[string(stream)] = priority;
+  this->UpdateMaxPriority();
+}
+//____________________________________________________________________________
+void Messenger::UpdateMaxPriority(void)
+{
+// Finds the most verbose priority level of any stream (streams without a
+// priority level of their own inherit the one of the root category).
+// Messages of lower priority can be rejected without any stream look-up.
+// Invalidates the cached per-stream priority levels.
+
+  int max_priority = log4cpp::Category::getRoot().getPriority();
+
+  std::map<string, log4cpp::Priority::Value>::const_iterator it;
+  for(it = fPriorities.begin(); it != fPriorities.end(); ++it) {
+    max_priority = std::max(max_priority, (int) it->second);
+  }
+
+  fgMaxPriority.store(max_priority);
+  fgGeneration++;
+}
+//____________________________________________________________________________
+log4cpp::Priority::Value Messenger::CachedPriority(const char * stream)
+{
+// Returns the priority level of the input stream. The (locked) log4cpp
+// category look-up is done only once per stream, per thread, and after
+// every change of priority levels.
+// The cache is keyed on the stream name address, which, for the usual
+// string literals, is unique. The name is verified at every look-up.
+
+  struct CachedLevel {
+    CachedLevel() : generation(0), priority(log4cpp::Priority::NOTSET) { }
+    string                   name;
+    unsigned int             generation;
+    log4cpp::Priority::Value priority;
+  };
+  static thread_local std::unordered_map<const char *, CachedLevel> cache;
+
+  unsigned int generation = fgGeneration.load();
+
+  // streams named by non-literal strings may add many entries
+  if(cache.size() > 1024) cache.clear();
+
+  CachedLevel & level = cache[stream];
+  if(level.generation != generation || level.name != stream) {
+    level.name       = stream;
+    level.generation = generation;
+    level.priority   =
+       log4cpp::Category::getInstance(stream).getChainedPriority();
+  }
+  return level.priority;
 }
 //____________________________________________________________________________
 void Messenger::Configure(void)
@@ -178,6 +277,16 @@ bool Messenger::SetPrioritiesFromXmlFile(string filenames)
                   << "Set priority level: " << setfill('.')
                           << setw(24) << msgstream << " --> " << priority;
       }
+
+      // enter everytime you find an <async> tag
+      if( (!xmlStrcmp(xml_msgp->name, (const xmlChar *) "async")) ) {
+         string async = utils::str::ToUpper( utils::xml::TrimSpaces(
+                  xmlNodeListGetString(xml_doc, xml_msgp->xmlChildrenNode, 1)));
+         bool on = (async == "YES" || async == "TRUE" || async == "1");
+         this->SetAsync(on);
+         SLOG("Messenger", pINFO)
+                  << "Asynchronous message output: " << (on ? "on" : "off");
+      }
       xml_msgp = xml_msgp->next;
     }//xml_msgp != NULL
 
@@ -22,6 +22,7 @@
 #include <cstring>
 #include <string>
 #include <map>
+#include <atomic>
 
 // ROOT5 has difficulty with parsing log4cpp headers
 #if !defined(__CINT__) && !defined(__MAKECINT__)
@@ -74,6 +75,36 @@ using std::string;
   #define ENDL std::endl
 #endif
 
+/*!
+  \def   __GENIE_MESG_FLOOR__
+  \brief The lowest priority level compiled in. All messages of lower priority
+         (eg pDEBUG and pINFO messages, if set to pNOTICE) are stripped at
+         compile time. Set via configure's --with-mesg-floor option.
+*/
+
+#ifndef __GENIE_MESG_FLOOR__
+  #define __GENIE_MESG_FLOOR__ log4cpp::Priority::DEBUG
+#endif
+
+/*!
+  \def   LOG_ENABLED(stream, priority)
+  \brief Checks whether a message of the given priority would be printed out
+         at the given stream. Can be used to guard expensive debug printouts.
+
+  \def   GENIE_LOG_STREAM(stream, priority)
+  \brief Returns the requested log4cpp::Category, if a message of the given
+         priority is to be printed out. Otherwise the whole statement, with
+         all the streamed arguments, is skipped without evaluating them.
+*/
+
+#define LOG_ENABLED(stream, priority) \
+           ( (priority) <= __GENIE_MESG_FLOOR__ && \
+             Messenger::Instance()->IsEnabled(stream, priority) )
+
+#define GENIE_LOG_STREAM(stream, priority) \
+           !LOG_ENABLED(stream, priority) ? (void) 0 : \
+             MessengerVoidify() & (*Messenger::Instance())(stream)
+
 /*!
   \def   SLOG(stream, priority)
   \brief A macro that returns the requested log4cpp::Category
@@ -82,7 +113,7 @@ using std::string;
 */
 
 #define SLOG(stream, priority) \
-           (*Messenger::Instance())(stream) \
+           GENIE_LOG_STREAM(stream, priority) \
                << priority << "[s] <" \
                << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
@@ -94,7 +125,7 @@ using std::string;
 */
 
 #define LOG(stream, priority) \
-           (*Messenger::Instance())(stream) \
+           GENIE_LOG_STREAM(stream, priority) \
                << priority << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
@@ -110,42 +141,42 @@ using std::string;
 #ifndef HIDE_GENIE_MSG_LOG_MACROS
 
 #define LOG_FATAL(stream) \
-          (*Messenger::Instance())(stream) \
+          GENIE_LOG_STREAM(stream, log4cpp::Priority::FATAL) \
                << log4cpp::Priority::FATAL << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LOG_ALERT(stream) \
-          (*Messenger::Instance())(stream) \
+          GENIE_LOG_STREAM(stream, log4cpp::Priority::ALERT) \
                << log4cpp::Priority::ALERT << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LOG_CRIT(stream) \
-          (*Messenger::Instance())(stream) \
+          GENIE_LOG_STREAM(stream, log4cpp::Priority::CRIT) \
                << log4cpp::Priority::CRIT << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LOG_ERROR(stream) \
-          (*Messenger::Instance())(stream) \
+          GENIE_LOG_STREAM(stream, log4cpp::Priority::ERROR) \
                << log4cpp::Priority::ERROR << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LOG_WARN(stream) \
-          (*Messenger::Instance())(stream) \
+          GENIE_LOG_STREAM(stream, log4cpp::Priority::WARN) \
                << log4cpp::Priority::WARN << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LOG_NOTICE(stream) \
-          (*Messenger::Instance())(stream) \
+          GENIE_LOG_STREAM(stream, log4cpp::Priority::NOTICE) \
                << log4cpp::Priority::NOTICE << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LOG_INFO(stream) \
-          (*Messenger::Instance())(stream) \
+          GENIE_LOG_STREAM(stream, log4cpp::Priority::INFO) \
                << log4cpp::Priority::INFO << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LOG_DEBUG(stream) \
-          (*Messenger::Instance())(stream) \
+          GENIE_LOG_STREAM(stream, log4cpp::Priority::DEBUG) \
                << log4cpp::Priority::DEBUG << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
@@ -159,47 +190,47 @@ using std::string;
 */
 
 #define LLOG(stream, priority) \
-           (*Messenger::Instance())(stream) \
+           GENIE_LOG_STREAM(stream, priority) \
                << priority << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_FATAL(stream) \
-          (*Messenger::Instance())(stream) \
+          GENIE_LOG_STREAM(stream, log4cpp::Priority::FATAL) \
                << log4cpp::Priority::FATAL << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_ALERT(stream) \
-          (*Messenger::Instance())(stream) \
+          GENIE_LOG_STREAM(stream, log4cpp::Priority::ALERT) \
                << log4cpp::Priority::ALERT << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_CRIT(stream) \
-          (*Messenger::Instance())(stream) \
+          GENIE_LOG_STREAM(stream, log4cpp::Priority::CRIT) \
                << log4cpp::Priority::CRIT << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_ERROR(stream) \
-          (*Messenger::Instance())(stream) \
+          GENIE_LOG_STREAM(stream, log4cpp::Priority::ERROR) \
                << log4cpp::Priority::ERROR << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_WARN(stream) \
-          (*Messenger::Instance())(stream) \
+          GENIE_LOG_STREAM(stream, log4cpp::Priority::WARN) \
                << log4cpp::Priority::WARN << "'[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_NOTICE(stream) \
-          (*Messenger::Instance())(stream) \
+          GENIE_LOG_STREAM(stream, log4cpp::Priority::NOTICE) \
                << log4cpp::Priority::NOTICE << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_INFO(stream) \
-          (*Messenger::Instance())(stream) \
+          GENIE_LOG_STREAM(stream, log4cpp::Priority::INFO) \
                << log4cpp::Priority::INFO << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_DEBUG(stream) \
-          (*Messenger::Instance())(stream) \
+          GENIE_LOG_STREAM(stream, log4cpp::Priority::DEBUG) \
                << log4cpp::Priority::DEBUG << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
@@ -210,7 +241,7 @@ using std::string;
 */
 
 #define BLOG(stream, priority) \
-          (*Messenger::Instance())(stream) << priority
+          GENIE_LOG_STREAM(stream, priority) << priority
 
 /*!
   \def   MAXSLOG(stream, priority, maxcount)
@@ -255,6 +286,8 @@ namespace genie {
 
 extern bool gAbortingInErr;
 
+class AsyncAppender;
+
 class Messenger
 {
 public:
@@ -263,8 +296,16 @@ public:
   log4cpp::Category & operator () (const char * stream);
   void SetPriorityLevel(const char * stream, log4cpp::Priority::Value p);
 
+  //! Checks the (cached) priority threshold of the input stream
+  bool IsEnabled(const char * stream, log4cpp::Priority::Value p);
+
   bool SetPrioritiesFromXmlFile(string filename);
 
+  //! Switches between synchronous and asynchronous (background thread) output
+  void SetAsync (bool on);
+  bool IsAsync  (void) const { return (fAsyncAppender != 0); }
+  void Flush    (void);
+
 private:
   Messenger();
   Messenger(const Messenger & config_pool);
@@ -275,6 +316,14 @@ private:
   void Configure(void);
 
   log4cpp::Priority::Value PriorityFromString(string priority);
+  log4cpp::Priority::Value CachedPriority(const char * stream);
+  void UpdateMaxPriority(void);
+
+  std::map<string, log4cpp::Priority::Value> fPriorities; ///< explicitly set priority levels
+  AsyncAppender * fAsyncAppender; ///< root category appender, if output is asynchronous
+
+  static std::atomic<int>          fgMaxPriority; ///< most verbose level set at any stream
+  static std::atomic<unsigned int> fgGeneration;  ///< incremented whenever a priority level changes
 
   struct Cleaner {
       void DummyMethodAndSilentCompiler() { }
@@ -288,5 +337,27 @@ private:
   friend struct Cleaner;
 };
 
+//____________________________________________________________________________
+/*!
+  \class MessengerVoidify
+  \brief Turns a streamed log message into a void expression, so that it
+         can be used alongside (void) 0 inside the GENIE_LOG_STREAM macro
+*/
+class MessengerVoidify
+{
+public:
+  template<class T> void operator & (const T &) { }
+};
+//____________________________________________________________________________
+inline bool Messenger::IsEnabled(
+   const char * stream, log4cpp::Priority::Value p)
+{
+  // no stream is set to print out messages of that low priority
+  if(p > fgMaxPriority.load(std::memory_order_relaxed)) return false;
+
+  return (this->CachedPriority(stream) >= p);
+}
+//____________________________________________________________________________
+
 }      // genie namespace
 #endif // _MESSENGER_H_
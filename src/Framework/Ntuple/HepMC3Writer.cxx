@@ -0,0 +1,223 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <set>
+#include <sstream>
+
+#include <TFolder.h>
+#include <TCollection.h>
+#include <TLorentzVector.h>
+
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/GHEP/GHepParticle.h"
+#include "Framework/GHEP/GHepStatus.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Ntuple/HepMC3Writer.h"
+#include "Framework/Ntuple/NtpMCTreeHeader.h"
+#include "Framework/Ntuple/NtpMCJobConfig.h"
+#include "Framework/Utils/RunOpt.h"
+
+using std::endl;
+using std::ofstream;
+using std::ostringstream;
+
+using namespace genie;
+
+// GHEP vertex units (m, s) to HepMC3 ones (mm, mm/c)
+static const double kHepMC3Length = 1.E+3;
+static const double kHepMC3Time   = 2.99792458E+11;
+
+//____________________________________________________________________________
+namespace {
+  // HepMC3 status code of a GHEP particle
+  int HepMC3Status(GHepStatus_t ist)
+  {
+    switch(ist) {
+      case kIStInitialState     : return 4;
+      case kIStStableFinalState : return 1;
+      case kIStDecayedState     : return 2;
+      default                   : return 20 + (int) ist;
+    }
+  }
+  // escape a string value as in the HepMC3 ASCII format
+  string HepMC3Escape(string s)
+  {
+    string out;
+    for(unsigned int i = 0; i < s.size(); i++) {
+      if     (s[i] == '\\') out += "\\\\";
+      else if(s[i] == '\n') out += "\\|";
+      else                  out += s[i];
+    }
+    return out;
+  }
+}
+//____________________________________________________________________________
+HepMC3Writer::HepMC3Writer(Long_t runnu) :
+fRunNu(runnu),
+fOut(0),
+fOwnOut(false)
+{
+  ostringstream filename;
+  filename << "gntp." << fRunNu << ".hepmc3";
+  fOutFilename = filename.str();
+}
+//____________________________________________________________________________
+HepMC3Writer::~HepMC3Writer()
+{
+  if(fOut) this->Save();
+}
+//____________________________________________________________________________
+void HepMC3Writer::CustomizeFilename(string filename)
+{
+  fOutFilename = filename;
+}
+//____________________________________________________________________________
+void HepMC3Writer::Initialize(void)
+{
+  LOG("Ntp", pINFO) << "Initializing HepMC3 output stream: " << fOutFilename;
+
+  if(fOutFilename == "-") {
+    fOut    = &std::cout;
+    fOwnOut = false;
+  } else {
+    ofstream * file = new ofstream(fOutFilename.c_str());
+    if(!file->is_open()) {
+      LOG("Ntp", pFATAL) << "Could not open output file: " << fOutFilename;
+      delete file;
+      gAbortingInErr = true;
+      exit(1);
+    }
+    fOut    = file;
+    fOwnOut = true;
+  }
+  *fOut << std::setprecision(16);
+
+  *fOut << "HepMC::Version 3.02.00" << endl;
+  *fOut << "HepMC::Asciiv3-START_EVENT_LISTING" << endl;
+
+  this->WriteRunInfo();
+}
+//____________________________________________________________________________
+void HepMC3Writer::WriteRunInfo(void)
+{
+  // the tree header information (as written by the NtpWriter)
+  NtpMCTreeHeader header;
+  header.runnu = fRunNu;
+
+  string tunename("unknown");
+  TuneId * tuneId = RunOpt::Instance()->Tune();
+  if(tuneId) {
+    tunename = tuneId->Name();
+    if(tuneId->IsCustom()) tunename += "*"; // flag it as possibly modified
+  }
+  string version = header.cvstag.GetString().Data();
+
+  // weight names, tool, run attributes
+  *fOut << "W Weight" << endl;
+  *fOut << "T " << HepMC3Escape("GENIE\n" + version +
+                                "\nneutrino event generator") << endl;
+  *fOut << "A GENIE.RunNumber " << fRunNu << endl;
+  *fOut << "A GENIE.Tune " << HepMC3Escape(tunename) << endl;
+  const NtpMCDTime & dt = header.datime;
+  *fOut << "A GENIE.Date " << std::setfill('0')
+        << dt.year << "-" << std::setw(2) << dt.month << "-" << std::setw(2) << dt.day
+        << "T" << std::setw(2) << dt.hour << ":" << std::setw(2) << dt.min
+        << ":" << std::setw(2) << dt.sec << std::setfill(' ') << endl;
+
+  // the configured algorithms (as saved by NtpMCJobConfig)
+  NtpMCJobConfig configuration;
+  TFolder * config = configuration.Load();
+  if(config) {
+    string configs;
+    TIter next_alg(config->GetListOfFolders());
+    TFolder * alg_folder = 0;
+    while( (alg_folder = dynamic_cast<TFolder *>(next_alg())) ) {
+      TIter next_set(alg_folder->GetListOfFolders());
+      TObject * set_folder = 0;
+      while( (set_folder = next_set()) ) {
+        if(!configs.empty()) configs += " ";
+        configs += string(alg_folder->GetName()) + "/" + set_folder->GetName();
+      }
+    }
+    *fOut << "A GENIE.AlgConfigs " << HepMC3Escape(configs) << endl;
+  }
+}
+//____________________________________________________________________________
+void HepMC3Writer::AddEventRecord(int ievent, const EventRecord * ev_rec)
+{
+  if(!fOut) {
+    LOG("Ntp", pERROR) << "The HepMC3 output stream was not initialized!";
+    return;
+  }
+  if(!ev_rec) return;
+
+  int npart = ev_rec->GetEntriesFast();
+
+  // one vertex per GHEP particle with daughters (mothers always come first)
+  std::set<int> mothers;
+  for(int i = 0; i < npart; i++) {
+    int mom = ev_rec->Particle(i)->FirstMother();
+    if(mom >= 0 && mom < i) mothers.insert(mom);
+  }
+
+  const TLorentzVector * vtx = ev_rec->Vertex();
+
+  *fOut << "E " << ievent << " " << mothers.size() << " " << npart
+        << " @ " << vtx->X() * kHepMC3Length
+        << " "   << vtx->Y() * kHepMC3Length
+        << " "   << vtx->Z() * kHepMC3Length
+        << " "   << vtx->T() * kHepMC3Time << "\n";
+  *fOut << "U GEV MM\n";
+  *fOut << "W " << ev_rec->Weight() << "\n";
+  *fOut << "A 0 GENIE.XSec "        << ev_rec->XSec()        << "\n";
+  *fOut << "A 0 GENIE.DiffXSec "    << ev_rec->DiffXSec()    << "\n";
+  *fOut << "A 0 GENIE.Probability " << ev_rec->Probability() << "\n";
+  const Interaction * interaction = ev_rec->Summary();
+  if(interaction) {
+    const ProcessInfo & proc = interaction->ProcInfo();
+    *fOut << "A 0 GENIE.ScatteringType "
+          << (int) proc.ScatteringTypeId()  << "\n";
+    *fOut << "A 0 GENIE.InteractionType "
+          << (int) proc.InteractionTypeId() << "\n";
+    *fOut << "A 0 GENIE.Interaction "
+          << HepMC3Escape(interaction->AsString()) << "\n";
+  }
+
+  for(int i = 0; i < npart; i++) {
+    const GHepParticle * p = ev_rec->Particle(i);
+    int mom = p->FirstMother();
+    int parent = (mom >= 0 && mom < i) ? mom + 1 : 0;
+    const TLorentzVector * p4 = p->P4();
+    *fOut << "P " << i + 1 << " " << parent << " " << p->Pdg()
+          << " " << p4->Px() << " " << p4->Py() << " " << p4->Pz()
+          << " " << p4->E()  << " " << p4->M()
+          << " " << HepMC3Status(p->Status()) << "\n";
+  }
+  fOut->flush();
+}
+//____________________________________________________________________________
+void HepMC3Writer::Save(void)
+{
+  if(!fOut) return;
+
+  *fOut << "HepMC::Asciiv3-END_EVENT_LISTING" << endl;
+
+  if(fOwnOut) delete fOut;
+  fOut = 0;
+  fOwnOut = false;
+
+  LOG("Ntp", pINFO) << "Closed HepMC3 output stream: " << fOutFilename;
+}
+//____________________________________________________________________________
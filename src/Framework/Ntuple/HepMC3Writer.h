@@ -0,0 +1,83 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::HepMC3Writer
+
+\brief   A utility class writing the output GENIE GHEP event records as a
+         HepMC3 (Asciiv3) event stream, to a file or to the standard output.
+
+         The stream is written directly from the EventRecords in the event
+         generation loop, one event at a time, so that a detector simulation
+         reading HepMC3 can be fed through a pipe (or a named pipe) with no
+         intermediate file (as the GENIE messages go to the standard output
+         too, prefer a named pipe to "-"). The run info at the top of the stream holds the
+         NtpMCTreeHeader information (run number, GENIE version, tune) and
+         the list of configured algorithms (see NtpMCJobConfig) as run
+         attributes.
+
+         GHEP particles become HepMC3 particles in the same order (id = GHEP
+         index + 1), each produced at the end vertex of its (first) GHEP
+         mother. Status codes: initial state -> 4 (beam), stable final state
+         -> 1, decayed -> 2, any other GHEP status s -> 20 + s. Momenta in
+         GeV, the event vertex (EventRecord::Vertex()) in mm and mm/c.
+
+         Writes the ASCII format only: the HepMC3 ROOT tree format needs the
+         HepMC3 dictionaries, which GENIE does not depend on.
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _HEPMC3_WRITER_H_
+#define _HEPMC3_WRITER_H_
+
+#include <string>
+#include <ostream>
+
+#include <Rtypes.h>
+
+using std::string;
+using std::ostream;
+
+namespace genie {
+
+class EventRecord;
+
+class HepMC3Writer {
+
+public :
+  HepMC3Writer(Long_t runnu = 0);
+ ~HepMC3Writer();
+
+  ///< open the output stream & write the run info
+  void Initialize (void);
+
+  ///< write event
+  void AddEventRecord (int ievent, const EventRecord * ev_rec);
+
+  ///< end the event listing & close the output stream
+  void Save (void);
+
+  ///< use before Initialize() to override the default filename ("-" for
+  ///< the standard output)
+  void CustomizeFilename (string filename);
+
+private:
+
+  void WriteRunInfo (void);
+
+  Long_t     fRunNu;        ///< run nu
+  string     fOutFilename;  ///< output filename ("-": standard output)
+  ostream *  fOut;          ///< output stream
+  bool       fOwnOut;       ///< is the output stream owned (a file)?
+};
+
+}      // genie namespace
+
+#endif // _HEPMC3_WRITER_H_
@@ -13,6 +13,10 @@
 #pragma link C++ class genie::NtpMCRecHeader;
 #pragma link C++ class genie::NtpMCRecordI;
 #pragma link C++ class genie::NtpMCEventRecord;
+#pragma link C++ class genie::NtpMCFlatRecord;
+#pragma link C++ class genie::NtpMCEventIndex;
+#pragma link C++ class genie::NtpMCReweightRecord;
 #pragma link C++ class genie::NtpWriter;
+#pragma link C++ class genie::HepMC3Writer;
 
 #endif
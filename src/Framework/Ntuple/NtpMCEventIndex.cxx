@@ -0,0 +1,149 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <TTree.h>
+#include <TBits.h>
+
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/GHEP/GHepParticle.h"
+#include "Framework/GHEP/GHepStatus.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Ntuple/NtpMCEventIndex.h"
+#include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/ParticleData/PDGUtils.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+NtpMCEventIndex::NtpMCEventIndex()
+{
+  this->Clear();
+}
+//____________________________________________________________________________
+NtpMCEventIndex::~NtpMCEventIndex()
+{
+
+}
+//____________________________________________________________________________
+void NtpMCEventIndex::Clear(void)
+{
+  neu = tgt = scat = intr = 0;
+  flags = 0;
+  np = npbar = nn = nnbar = 0;
+  npip = npim = npi0 = 0;
+  nkp = nkm = nk0 = nk0bar = 0;
+  nhyp = noth = 0;
+  wght = 0;
+}
+//____________________________________________________________________________
+void NtpMCEventIndex::CreateBranches(TTree * tree)
+{
+  tree->Branch("idx_neu",    &neu,    "idx_neu/I"    );
+  tree->Branch("idx_tgt",    &tgt,    "idx_tgt/I"    );
+  tree->Branch("idx_scat",   &scat,   "idx_scat/I"   );
+  tree->Branch("idx_int",    &intr,   "idx_int/I"    );
+  tree->Branch("idx_flags",  &flags,  "idx_flags/i"  );
+  tree->Branch("idx_np",     &np,     "idx_np/I"     );
+  tree->Branch("idx_npbar",  &npbar,  "idx_npbar/I"  );
+  tree->Branch("idx_nn",     &nn,     "idx_nn/I"     );
+  tree->Branch("idx_nnbar",  &nnbar,  "idx_nnbar/I"  );
+  tree->Branch("idx_npip",   &npip,   "idx_npip/I"   );
+  tree->Branch("idx_npim",   &npim,   "idx_npim/I"   );
+  tree->Branch("idx_npi0",   &npi0,   "idx_npi0/I"   );
+  tree->Branch("idx_nkp",    &nkp,    "idx_nkp/I"    );
+  tree->Branch("idx_nkm",    &nkm,    "idx_nkm/I"    );
+  tree->Branch("idx_nk0",    &nk0,    "idx_nk0/I"    );
+  tree->Branch("idx_nk0bar", &nk0bar, "idx_nk0bar/I" );
+  tree->Branch("idx_nhyp",   &nhyp,   "idx_nhyp/I"   );
+  tree->Branch("idx_noth",   &noth,   "idx_noth/I"   );
+  tree->Branch("idx_wght",   &wght,   "idx_wght/D"   );
+}
+//____________________________________________________________________________
+bool NtpMCEventIndex::SetBranchAddresses(TTree * tree)
+{
+  if(!tree->GetBranch("idx_neu") || !tree->GetBranch("idx_noth")) return false;
+
+  tree->SetBranchAddress("idx_neu",    &neu    );
+  tree->SetBranchAddress("idx_tgt",    &tgt    );
+  tree->SetBranchAddress("idx_scat",   &scat   );
+  tree->SetBranchAddress("idx_int",    &intr   );
+  tree->SetBranchAddress("idx_flags",  &flags  );
+  tree->SetBranchAddress("idx_np",     &np     );
+  tree->SetBranchAddress("idx_npbar",  &npbar  );
+  tree->SetBranchAddress("idx_nn",     &nn     );
+  tree->SetBranchAddress("idx_nnbar",  &nnbar  );
+  tree->SetBranchAddress("idx_npip",   &npip   );
+  tree->SetBranchAddress("idx_npim",   &npim   );
+  tree->SetBranchAddress("idx_npi0",   &npi0   );
+  tree->SetBranchAddress("idx_nkp",    &nkp    );
+  tree->SetBranchAddress("idx_nkm",    &nkm    );
+  tree->SetBranchAddress("idx_nk0",    &nk0    );
+  tree->SetBranchAddress("idx_nk0bar", &nk0bar );
+  tree->SetBranchAddress("idx_nhyp",   &nhyp   );
+  tree->SetBranchAddress("idx_noth",   &noth   );
+  if(tree->GetBranch("idx_wght")) {
+    tree->SetBranchAddress("idx_wght", &wght   );
+  }
+  return true;
+}
+//____________________________________________________________________________
+void NtpMCEventIndex::EnableBranches(TTree * tree)
+{
+  tree->SetBranchStatus("*",     0);
+  tree->SetBranchStatus("idx_*", 1);
+}
+//____________________________________________________________________________
+void NtpMCEventIndex::Fill(const EventRecord * ev_rec)
+{
+  this->Clear();
+
+  Interaction * in = ev_rec->Summary();
+  if(in) {
+    neu  = in->InitState().ProbePdg();
+    tgt  = in->InitState().TgtPdg();
+    scat = (int) in->ProcInfo().ScatteringTypeId();
+    intr = (int) in->ProcInfo().InteractionTypeId();
+  }
+  wght = ev_rec->Weight();
+
+  const TBits * evflags = ev_rec->EventFlags();
+  for(unsigned int i = 0; i < 32 && i < evflags->GetNbits(); i++) {
+    if(evflags->TestBitNumber(i)) flags |= (1u << i);
+  }
+
+  int npart = ev_rec->GetEntriesFast();
+  for(int ip = 0; ip < npart; ip++) {
+    const GHepParticle * p = ev_rec->Particle(ip);
+    // only final state particles
+    if(p->Status() != kIStStableFinalState) continue;
+    // don't count final state lepton as part of the hadronic system
+    if(p->FirstMother() == 0) continue;
+    // skip pseudo-particles
+    int pdgc = p->Pdg();
+    if(pdg::IsPseudoParticle(pdgc)) continue;
+    // count ...
+    if      (pdgc == kPdgProton     ) np++;
+    else if (pdgc == kPdgAntiProton ) npbar++;
+    else if (pdgc == kPdgNeutron    ) nn++;
+    else if (pdgc == kPdgAntiNeutron) nnbar++;
+    else if (pdgc == kPdgPiP        ) npip++;
+    else if (pdgc == kPdgPiM        ) npim++;
+    else if (pdgc == kPdgPi0        ) npi0++;
+    else if (pdgc == kPdgKP         ) nkp++;
+    else if (pdgc == kPdgKM         ) nkm++;
+    else if (pdgc == kPdgK0         ) nk0++;
+    else if (pdgc == kPdgAntiK0     ) nk0bar++;
+    else if (pdgc == kPdgSigmaP || pdgc == kPdgSigma0 || pdgc == kPdgSigmaM ||
+             pdgc == kPdgLambda || pdgc == kPdgXi0    || pdgc == kPdgXiM    ||
+             pdgc == kPdgOmegaM ) nhyp++;
+    else                          noth++;
+  }
+}
+//____________________________________________________________________________
@@ -0,0 +1,81 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::NtpMCEventIndex
+
+\brief   Event-level summary columns written next to the NtpMCEventRecord
+         branch of GHEP event trees (see NtpWriter), as plain branches, so
+         that utilities selecting events (like gevpick) can decide which
+         entries to read by reading these few columns only, rather than
+         streaming every EventRecord.
+
+         Columns:
+           idx_neu (probe pdg), idx_tgt (target pdg), idx_scat
+           (ScatteringType_t), idx_int (InteractionType_t), idx_flags
+           (event flag bits), and the numbers of final state p, pbar, n,
+           nbar, pi+, pi-, pi0, K+, K-, K0, K0bar, hyperons (Sigma,
+           Lambda, Xi, Omega) and other particles in the hadronic system
+           (stable final state particles, excl. the primary lepton and
+           pseudo-particles): idx_np, idx_npbar, idx_nn, idx_nnbar,
+           idx_npip, idx_npim, idx_npi0, idx_nkp, idx_nkm, idx_nk0,
+           idx_nk0bar, idx_nhyp, idx_noth, and the event weight idx_wght
+           (eg for unweighting weighted samples, see gevunweight; absent
+           in older files)
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _NTP_MC_EVENT_INDEX_H_
+#define _NTP_MC_EVENT_INDEX_H_
+
+class TTree;
+
+namespace genie {
+
+class EventRecord;
+
+class NtpMCEventIndex {
+
+public :
+  NtpMCEventIndex();
+ ~NtpMCEventIndex();
+
+  void CreateBranches     (TTree * tree);  ///< add the index branches to a new tree
+  bool SetBranchAddresses (TTree * tree);  ///< attach to the index branches of an existing tree (false if none)
+  void EnableBranches     (TTree * tree);  ///< read only the index branches of the tree
+  void Fill               (const EventRecord * ev_rec);
+  void Clear              (void);
+
+  // Ntuple is treated like a C-struct with public data members and
+  // rule-breaking field data members not prefaced by "f" and mostly lowercase.
+
+  int neu;
+  int tgt;
+  int scat;
+  int intr;
+  unsigned int flags;
+  int np;
+  int npbar;
+  int nn;
+  int nnbar;
+  int npip;
+  int npim;
+  int npi0;
+  int nkp;
+  int nkm;
+  int nk0;
+  int nk0bar;
+  int nhyp;
+  int noth;
+  double wght;
+};
+
+}      // genie namespace
+#endif // _NTP_MC_EVENT_INDEX_H_
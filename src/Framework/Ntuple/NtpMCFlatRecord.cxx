@@ -0,0 +1,173 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <TTree.h>
+#include <TLorentzVector.h>
+
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/GHEP/GHepParticle.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Ntuple/NtpMCFlatRecord.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+NtpMCFlatRecord::NtpMCFlatRecord()
+{
+  iev = neu = tgt = hitnuc = scat = intr = 0;
+  Ev = x = y = t = Q2 = W = 0;
+  wght = prob = xsec = dxsec = 0;
+  vx = vy = vz = vt = 0;
+  n  = 0;
+}
+//____________________________________________________________________________
+NtpMCFlatRecord::~NtpMCFlatRecord()
+{
+
+}
+//____________________________________________________________________________
+void NtpMCFlatRecord::CreateBranches(TTree * tree)
+{
+  tree->Branch("iev",    &iev,    "iev/I"    );
+  tree->Branch("neu",    &neu,    "neu/I"    );
+  tree->Branch("tgt",    &tgt,    "tgt/I"    );
+  tree->Branch("hitnuc", &hitnuc, "hitnuc/I" );
+  tree->Branch("scat",   &scat,   "scat/I"   );
+  tree->Branch("int",    &intr,   "int/I"    );
+  tree->Branch("Ev",     &Ev,     "Ev/D"     );
+  tree->Branch("x",      &x,      "x/D"      );
+  tree->Branch("y",      &y,      "y/D"      );
+  tree->Branch("t",      &t,      "t/D"      );
+  tree->Branch("Q2",     &Q2,     "Q2/D"     );
+  tree->Branch("W",      &W,      "W/D"      );
+  tree->Branch("wght",   &wght,   "wght/D"   );
+  tree->Branch("prob",   &prob,   "prob/D"   );
+  tree->Branch("xsec",   &xsec,   "xsec/D"   );
+  tree->Branch("dxsec",  &dxsec,  "dxsec/D"  );
+  tree->Branch("vx",     &vx,     "vx/D"     );
+  tree->Branch("vy",     &vy,     "vy/D"     );
+  tree->Branch("vz",     &vz,     "vz/D"     );
+  tree->Branch("vt",     &vt,     "vt/D"     );
+  tree->Branch("n",      &n,      "n/I"      );
+  tree->Branch("pdg",    pdg,     "pdg[n]/I"    );
+  tree->Branch("ist",    ist,     "ist[n]/I"    );
+  tree->Branch("rescat", rescat,  "rescat[n]/I" );
+  tree->Branch("fm",     fm,      "fm[n]/I"     );
+  tree->Branch("lm",     lm,      "lm[n]/I"     );
+  tree->Branch("fd",     fd,      "fd[n]/I"     );
+  tree->Branch("ld",     ld,      "ld[n]/I"     );
+  tree->Branch("p4",     p4,      "p4[n][4]/D"  );
+  tree->Branch("x4",     x4,      "x4[n][4]/D"  );
+}
+//____________________________________________________________________________
+bool NtpMCFlatRecord::SetBranchAddresses(TTree * tree)
+{
+  if(!tree->GetBranch("iev") || !tree->GetBranch("p4")) {
+    LOG("Ntp", pERROR) << "Not a flat GENIE event tree: " << tree->GetName();
+    return false;
+  }
+
+  tree->SetBranchAddress("iev",    &iev    );
+  tree->SetBranchAddress("neu",    &neu    );
+  tree->SetBranchAddress("tgt",    &tgt    );
+  tree->SetBranchAddress("hitnuc", &hitnuc );
+  tree->SetBranchAddress("scat",   &scat   );
+  tree->SetBranchAddress("int",    &intr   );
+  tree->SetBranchAddress("Ev",     &Ev     );
+  tree->SetBranchAddress("x",      &x      );
+  tree->SetBranchAddress("y",      &y      );
+  tree->SetBranchAddress("t",      &t      );
+  tree->SetBranchAddress("Q2",     &Q2     );
+  tree->SetBranchAddress("W",      &W      );
+  tree->SetBranchAddress("wght",   &wght   );
+  tree->SetBranchAddress("prob",   &prob   );
+  tree->SetBranchAddress("xsec",   &xsec   );
+  tree->SetBranchAddress("dxsec",  &dxsec  );
+  tree->SetBranchAddress("vx",     &vx     );
+  tree->SetBranchAddress("vy",     &vy     );
+  tree->SetBranchAddress("vz",     &vz     );
+  tree->SetBranchAddress("vt",     &vt     );
+  tree->SetBranchAddress("n",      &n      );
+  tree->SetBranchAddress("pdg",    pdg     );
+  tree->SetBranchAddress("ist",    ist     );
+  tree->SetBranchAddress("rescat", rescat  );
+  tree->SetBranchAddress("fm",     fm      );
+  tree->SetBranchAddress("lm",     lm      );
+  tree->SetBranchAddress("fd",     fd      );
+  tree->SetBranchAddress("ld",     ld      );
+  tree->SetBranchAddress("p4",     p4      );
+  tree->SetBranchAddress("x4",     x4      );
+  return true;
+}
+//____________________________________________________________________________
+void NtpMCFlatRecord::Fill(int ievent, const EventRecord * ev_rec)
+{
+  iev = ievent;
+
+  // event summary
+  Interaction * in = ev_rec->Summary();
+  if(in) {
+    const InitialState & init_state = in->InitState();
+    const Kinematics &   kine       = in->Kine();
+    neu    = init_state.ProbePdg();
+    tgt    = init_state.TgtPdg();
+    hitnuc = init_state.Tgt().HitNucPdg();
+    scat   = (int) in->ProcInfo().ScatteringTypeId();
+    intr   = (int) in->ProcInfo().InteractionTypeId();
+    x      = kine.x (true);
+    y      = kine.y (true);
+    t      = kine.t (true);
+    Q2     = kine.Q2(true);
+    W      = kine.W (true);
+  } else {
+    neu = tgt = hitnuc = scat = intr = 0;
+    x = y = t = Q2 = W = 0;
+  }
+  GHepParticle * probe = ev_rec->Probe();
+  Ev     = (probe) ? probe->E() : 0;
+  wght   = ev_rec->Weight();
+  prob   = ev_rec->Probability();
+  xsec   = ev_rec->XSec();
+  dxsec  = ev_rec->DiffXSec();
+  const TLorentzVector * vtx = ev_rec->Vertex();
+  vx     = vtx->X();
+  vy     = vtx->Y();
+  vz     = vtx->Z();
+  vt     = vtx->T();
+
+  // particles
+  n = ev_rec->GetEntries();
+  if(n > kNtpFlatMaxParticles) {
+    LOG("Ntp", pWARN)
+      << "Event " << ievent << " has " << n << " particles; keeping only the "
+      << "first " << kNtpFlatMaxParticles << " in the flat event tree";
+    n = kNtpFlatMaxParticles;
+  }
+  for(int i = 0; i < n; i++) {
+    GHepParticle * p = ev_rec->Particle(i);
+    pdg   [i]    = p->Pdg();
+    ist   [i]    = (int) p->Status();
+    rescat[i]    = p->RescatterCode();
+    fm    [i]    = p->FirstMother();
+    lm    [i]    = p->LastMother();
+    fd    [i]    = p->FirstDaughter();
+    ld    [i]    = p->LastDaughter();
+    p4    [i][0] = p->Px();
+    p4    [i][1] = p->Py();
+    p4    [i][2] = p->Pz();
+    p4    [i][3] = p->E();
+    x4    [i][0] = p->Vx();
+    x4    [i][1] = p->Vy();
+    x4    [i][2] = p->Vz();
+    x4    [i][3] = p->Vt();
+  }
+}
+//____________________________________________________________________________
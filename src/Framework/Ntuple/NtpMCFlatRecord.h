@@ -0,0 +1,93 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::NtpMCFlatRecord
+
+\brief   Flat, columnar ntuple record (kNFFlat format). Holds the branch
+         buffers of an event tree with one plain (split) branch per event
+         summary quantity and one variable-length array branch per particle
+         property, so that analyses can read any subset of columns without
+         streaming EventRecord objects.
+
+         Event summary columns:
+           iev, neu (probe pdg), tgt (target pdg), hitnuc (hit nucleon pdg),
+           scat (ScatteringType_t), int (InteractionType_t), Ev (LAB probe
+           energy), x, y, t, Q2, W (selected kinematics), wght, prob, xsec,
+           dxsec, vx, vy, vz, vt (event vertex)
+         Particle columns (n entries each):
+           pdg, ist (GHepStatus_t), rescat, fm, lm, fd, ld (first/last mother
+           & daughter), p4[4] (px,py,pz,E), x4[4] (x,y,z,t)
+
+         Events with more than kNtpFlatMaxParticles particles are truncated.
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _NTP_MC_FLAT_RECORD_H_
+#define _NTP_MC_FLAT_RECORD_H_
+
+class TTree;
+
+namespace genie {
+
+class EventRecord;
+
+const int kNtpFlatMaxParticles = 500;
+
+class NtpMCFlatRecord {
+
+public :
+  NtpMCFlatRecord();
+ ~NtpMCFlatRecord();
+
+  void CreateBranches      (TTree * tree);  ///< create the branches of a new tree
+  bool SetBranchAddresses  (TTree * tree);  ///< attach to the branches of an existing tree
+  void Fill                (int ievent, const EventRecord * ev_rec);
+
+  // Ntuple is treated like a C-struct with public data members and
+  // rule-breaking field data members not prefaced by "f" and mostly lowercase.
+
+  // event summary
+  int    iev;
+  int    neu;
+  int    tgt;
+  int    hitnuc;
+  int    scat;
+  int    intr;
+  double Ev;
+  double x;
+  double y;
+  double t;
+  double Q2;
+  double W;
+  double wght;
+  double prob;
+  double xsec;
+  double dxsec;
+  double vx;
+  double vy;
+  double vz;
+  double vt;
+
+  // particles
+  int    n;
+  int    pdg    [kNtpFlatMaxParticles];
+  int    ist    [kNtpFlatMaxParticles];
+  int    rescat [kNtpFlatMaxParticles];
+  int    fm     [kNtpFlatMaxParticles];
+  int    lm     [kNtpFlatMaxParticles];
+  int    fd     [kNtpFlatMaxParticles];
+  int    ld     [kNtpFlatMaxParticles];
+  double p4     [kNtpFlatMaxParticles][4];
+  double x4     [kNtpFlatMaxParticles][4];
+};
+
+}      // genie namespace
+#endif // _NTP_MC_FLAT_RECORD_H_
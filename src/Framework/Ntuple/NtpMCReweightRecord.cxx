@@ -0,0 +1,262 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <sstream>
+
+#include <TTree.h>
+#include <TLorentzVector.h>
+
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/GHEP/GHepParticle.h"
+#include "Framework/GHEP/GHepStatus.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Ntuple/NtpMCReweightRecord.h"
+
+using std::ostringstream;
+
+using namespace genie;
+
+//____________________________________________________________________________
+NtpMCReweightRecord::NtpMCReweightRecord()
+{
+  this->Clear();
+}
+//____________________________________________________________________________
+NtpMCReweightRecord::~NtpMCReweightRecord()
+{
+
+}
+//____________________________________________________________________________
+void NtpMCReweightRecord::Clear(void)
+{
+  iev = neu = tgt = hitnuc = hitqrk = seaqrk = scat = intr = 0;
+  charm = strange = -1;
+  res = (int) kNoResonance;
+  xnp = xnn = xnpip = xnpim = xnpi0 = 0;
+  for(int k = 0; k < 4; k++) {
+    nup4[k] = nucp4[k] = fslp4[k] = hadp4[k] = 0;
+  }
+  nucerm = nucrad = 0;
+  kvset = 0;
+  for(int k = 0; k < kNumOfKineVar; k++) kv[k] = 0;
+  wght = prob = xsec = dxsec = 0;
+  kps = (int) kPSNull;
+  n = 0;
+}
+//____________________________________________________________________________
+void NtpMCReweightRecord::CreateBranches(TTree * tree)
+{
+  ostringstream kvleaf;
+  kvleaf << "kv[" << (int) kNumOfKineVar << "]/D";
+
+  tree->Branch("iev",     &iev,     "iev/I"        );
+  tree->Branch("neu",     &neu,     "neu/I"        );
+  tree->Branch("tgt",     &tgt,     "tgt/I"        );
+  tree->Branch("hitnuc",  &hitnuc,  "hitnuc/I"     );
+  tree->Branch("hitqrk",  &hitqrk,  "hitqrk/I"     );
+  tree->Branch("seaqrk",  &seaqrk,  "seaqrk/I"     );
+  tree->Branch("scat",    &scat,    "scat/I"       );
+  tree->Branch("int",     &intr,    "int/I"        );
+  tree->Branch("charm",   &charm,   "charm/I"      );
+  tree->Branch("strange", &strange, "strange/I"    );
+  tree->Branch("res",     &res,     "res/I"        );
+  tree->Branch("xnp",     &xnp,     "xnp/I"        );
+  tree->Branch("xnn",     &xnn,     "xnn/I"        );
+  tree->Branch("xnpip",   &xnpip,   "xnpip/I"      );
+  tree->Branch("xnpim",   &xnpim,   "xnpim/I"      );
+  tree->Branch("xnpi0",   &xnpi0,   "xnpi0/I"      );
+  tree->Branch("nup4",    nup4,     "nup4[4]/D"    );
+  tree->Branch("nucp4",   nucp4,    "nucp4[4]/D"   );
+  tree->Branch("nucerm",  &nucerm,  "nucerm/D"     );
+  tree->Branch("nucrad",  &nucrad,  "nucrad/D"     );
+  tree->Branch("kvset",   &kvset,   "kvset/i"      );
+  tree->Branch("kv",      kv,       kvleaf.str().c_str());
+  tree->Branch("fslp4",   fslp4,    "fslp4[4]/D"   );
+  tree->Branch("hadp4",   hadp4,    "hadp4[4]/D"   );
+  tree->Branch("wght",    &wght,    "wght/D"       );
+  tree->Branch("prob",    &prob,    "prob/D"       );
+  tree->Branch("xsec",    &xsec,    "xsec/D"       );
+  tree->Branch("dxsec",   &dxsec,   "dxsec/D"      );
+  tree->Branch("kps",     &kps,     "kps/I"        );
+  tree->Branch("n",       &n,       "n/I"          );
+  tree->Branch("hpdg",    hpdg,     "hpdg[n]/I"    );
+  tree->Branch("hresc",   hresc,    "hresc[n]/I"   );
+  tree->Branch("hp4",     hp4,      "hp4[n][4]/D"  );
+  tree->Branch("hx4",     hx4,      "hx4[n][4]/D"  );
+}
+//____________________________________________________________________________
+bool NtpMCReweightRecord::SetBranchAddresses(TTree * tree)
+{
+  if(!tree->GetBranch("kvset") || !tree->GetBranch("hresc")) {
+    LOG("Ntp", pERROR) << "Not a GENIE reweight tree: " << tree->GetName();
+    return false;
+  }
+
+  tree->SetBranchAddress("iev",     &iev     );
+  tree->SetBranchAddress("neu",     &neu     );
+  tree->SetBranchAddress("tgt",     &tgt     );
+  tree->SetBranchAddress("hitnuc",  &hitnuc  );
+  tree->SetBranchAddress("hitqrk",  &hitqrk  );
+  tree->SetBranchAddress("seaqrk",  &seaqrk  );
+  tree->SetBranchAddress("scat",    &scat    );
+  tree->SetBranchAddress("int",     &intr    );
+  tree->SetBranchAddress("charm",   &charm   );
+  tree->SetBranchAddress("strange", &strange );
+  tree->SetBranchAddress("res",     &res     );
+  tree->SetBranchAddress("xnp",     &xnp     );
+  tree->SetBranchAddress("xnn",     &xnn     );
+  tree->SetBranchAddress("xnpip",   &xnpip   );
+  tree->SetBranchAddress("xnpim",   &xnpim   );
+  tree->SetBranchAddress("xnpi0",   &xnpi0   );
+  tree->SetBranchAddress("nup4",    nup4     );
+  tree->SetBranchAddress("nucp4",   nucp4    );
+  tree->SetBranchAddress("nucerm",  &nucerm  );
+  tree->SetBranchAddress("nucrad",  &nucrad  );
+  tree->SetBranchAddress("kvset",   &kvset   );
+  tree->SetBranchAddress("kv",      kv       );
+  tree->SetBranchAddress("fslp4",   fslp4    );
+  tree->SetBranchAddress("hadp4",   hadp4    );
+  tree->SetBranchAddress("wght",    &wght    );
+  tree->SetBranchAddress("prob",    &prob    );
+  tree->SetBranchAddress("xsec",    &xsec    );
+  tree->SetBranchAddress("dxsec",   &dxsec   );
+  tree->SetBranchAddress("kps",     &kps     );
+  tree->SetBranchAddress("n",       &n       );
+  tree->SetBranchAddress("hpdg",    hpdg     );
+  tree->SetBranchAddress("hresc",   hresc    );
+  tree->SetBranchAddress("hp4",     hp4      );
+  tree->SetBranchAddress("hx4",     hx4      );
+  return true;
+}
+//____________________________________________________________________________
+void NtpMCReweightRecord::Fill(int ievent, const EventRecord * ev_rec)
+{
+  this->Clear();
+
+  iev = ievent;
+
+  // interaction summary
+  Interaction * in = ev_rec->Summary();
+  if(in) {
+    const InitialState & init_state = in->InitState();
+    const Target &       target     = init_state.Tgt();
+    const Kinematics &   kine       = in->Kine();
+    const XclsTag &      xcls       = in->ExclTag();
+
+    neu     = init_state.ProbePdg();
+    tgt     = init_state.TgtPdg();
+    hitnuc  = target.HitNucPdg();
+    hitqrk  = target.HitQrkPdg();
+    seaqrk  = (target.HitSeaQrk()) ? 1 : 0;
+    scat    = (int) in->ProcInfo().ScatteringTypeId();
+    intr    = (int) in->ProcInfo().InteractionTypeId();
+    charm   = (xcls.IsCharmEvent())   ? xcls.CharmHadronPdg()   : -1;
+    strange = (xcls.IsStrangeEvent()) ? xcls.StrangeHadronPdg() : -1;
+    res     = (int) xcls.Resonance();
+    xnp     = xcls.NProtons();
+    xnn     = xcls.NNeutrons();
+    xnpip   = xcls.NPiPlus();
+    xnpim   = xcls.NPiMinus();
+    xnpi0   = xcls.NPi0();
+
+    const TLorentzVector & p4nu  = init_state.ProbeP4Lab();
+    const TLorentzVector & p4nuc = target.HitNucP4();
+    const TLorentzVector & p4fsl = kine.FSLeptonP4();
+    const TLorentzVector & p4had = kine.HadSystP4();
+    for(int k = 0; k < 4; k++) {
+      nup4 [k] = p4nu  [k];
+      nucp4[k] = p4nuc [k];
+      fslp4[k] = p4fsl [k];
+      hadp4[k] = p4had [k];
+    }
+    nucrad = target.HitNucPosition();
+
+    for(int k = 0; k < kNumOfKineVar; k++) {
+      KineVar_t kvar = (KineVar_t) k;
+      if(!kine.KVSet(kvar)) continue;
+      kvset |= (1u << k);
+      kv[k]  = kine.GetKV(kvar);
+    }
+  }
+
+  GHepParticle * nucleon = ev_rec->HitNucleon();
+  if(nucleon) nucerm = nucleon->RemovalEnergy();
+
+  wght  = ev_rec->Weight();
+  prob  = ev_rec->Probability();
+  xsec  = ev_rec->XSec();
+  dxsec = ev_rec->DiffXSec();
+  kps   = (int) ev_rec->DiffXSecVars();
+
+  // hadron transport history: the hadrons marked for the transport modules
+  int npart = ev_rec->GetEntries();
+  for(int ip = 0; ip < npart; ip++) {
+    GHepParticle * p = ev_rec->Particle(ip);
+    if(p->Status() != kIStHadronInTheNucleus) continue;
+    if(n >= kNtpRwMaxHadrons) {
+      LOG("Ntp", pWARN)
+        << "Event " << ievent << " has more than " << kNtpRwMaxHadrons
+        << " hadrons in the nucleus; keeping only the first ones in the "
+        << "reweight tree";
+      break;
+    }
+    hpdg [n]    = p->Pdg();
+    hresc[n]    = p->RescatterCode();
+    hp4  [n][0] = p->Px();
+    hp4  [n][1] = p->Py();
+    hp4  [n][2] = p->Pz();
+    hp4  [n][3] = p->E();
+    hx4  [n][0] = p->Vx();
+    hx4  [n][1] = p->Vy();
+    hx4  [n][2] = p->Vz();
+    hx4  [n][3] = p->Vt();
+    n++;
+  }
+}
+//____________________________________________________________________________
+Interaction * NtpMCReweightRecord::MakeInteraction(void) const
+{
+  InitialState init_state(tgt, neu);
+  ProcessInfo  proc_info((ScatteringType_t) scat, (InteractionType_t) intr);
+
+  Interaction * in = new Interaction(init_state, proc_info);
+
+  InitialState * is = in->InitStatePtr();
+  is->SetProbeP4(TLorentzVector(nup4[0], nup4[1], nup4[2], nup4[3]));
+
+  Target * target = is->TgtPtr();
+  if(hitnuc != 0) {
+    target->SetHitNucPdg(hitnuc);
+    target->SetHitNucP4(TLorentzVector(nucp4[0], nucp4[1], nucp4[2], nucp4[3]));
+    target->SetHitNucPosition(nucrad);
+  }
+  if(hitqrk != 0) {
+    target->SetHitQrkPdg(hitqrk);
+    target->SetHitSeaQrk(seaqrk != 0);
+  }
+
+  Kinematics * kine = in->KinePtr();
+  for(int k = 0; k < kNumOfKineVar; k++) {
+    if(kvset & (1u << k)) kine->SetKV((KineVar_t) k, kv[k]);
+  }
+  kine->SetFSLeptonP4(fslp4[0], fslp4[1], fslp4[2], fslp4[3]);
+  kine->SetHadSystP4 (hadp4[0], hadp4[1], hadp4[2], hadp4[3]);
+
+  XclsTag * xcls = in->ExclTagPtr();
+  if(charm   >= 0) xcls->SetCharm  (charm);
+  if(strange >= 0) xcls->SetStrange(strange);
+  xcls->SetResonance((Resonance_t) res);
+  xcls->SetNNucleons(xnp, xnn);
+  xcls->SetNPions(xnpip, xnpi0, xnpim);
+
+  return in;
+}
+//____________________________________________________________________________
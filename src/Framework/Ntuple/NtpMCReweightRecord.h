@@ -0,0 +1,113 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::NtpMCReweightRecord
+
+\brief   Compact, fixed-size per-event record written by NtpWriter to an
+         optional side tree (grwtree, one entry per entry of the event tree)
+         holding only what event reweighting needs: the inputs of the cross
+         section calculation (interaction summary and selected kinematics,
+         the hit nucleon 4-momentum, removal energy and radius) and a compact
+         intranuclear hadron transport history (the hadrons marked for the
+         hadron transport modules, with their rescattering codes / fates).
+         Reweighting tools can read it instead of deserializing the full
+         NtpMCEventRecord, and MakeInteraction() restores the Interaction to
+         pass to XSecAlgorithmI::XSec().
+
+         Columns:
+           iev, neu, tgt, hitnuc, hitqrk, seaqrk, scat, intr (ScatteringType_t,
+           InteractionType_t), charm, strange (hadron pdg, 0 if
+           inclusive, -1 if not a charm / strange event), res (Resonance_t),
+           xnp, xnn, xnpip, xnpim, xnpi0 (exclusive tag multiplicities),
+           nup4[4], nucp4[4] (LAB probe & hit nucleon 4-momenta), nucerm
+           (hit nucleon removal energy), nucrad (hit nucleon radius, fm),
+           kvset (bit field of the set KineVar_t values), kv[kNumOfKineVar]
+           (running & selected kinematics), fslp4[4], hadp4[4] (primary lepton
+           & hadronic system 4-momenta), wght, prob, xsec, dxsec, kps
+           (KinePhaseSpace_t of dxsec), and the hadrons in the nucleus
+           (n entries each): hpdg, hresc (rescattering code), hp4[4], hx4[4]
+           (4-momentum & position in the nucleus)
+
+         Events with more than kNtpRwMaxHadrons hadrons in the nucleus are
+         truncated.
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _NTP_MC_REWEIGHT_RECORD_H_
+#define _NTP_MC_REWEIGHT_RECORD_H_
+
+#include "Framework/Conventions/KineVar.h"
+
+class TTree;
+
+namespace genie {
+
+class EventRecord;
+class Interaction;
+
+const int kNtpRwMaxHadrons = 50;
+
+class NtpMCReweightRecord {
+
+public :
+  NtpMCReweightRecord();
+ ~NtpMCReweightRecord();
+
+  void CreateBranches     (TTree * tree);  ///< create the branches of a new (side) tree
+  bool SetBranchAddresses (TTree * tree);  ///< attach to the branches of an existing tree (false if not a reweight tree)
+  void Fill               (int ievent, const EventRecord * ev_rec);
+  void Clear              (void);
+
+  Interaction * MakeInteraction (void) const;  ///< the interaction summary of the current entry (caller owns it)
+
+  // Ntuple is treated like a C-struct with public data members and
+  // rule-breaking field data members not prefaced by "f" and mostly lowercase.
+
+  int          iev;
+  int          neu;
+  int          tgt;
+  int          hitnuc;
+  int          hitqrk;
+  int          seaqrk;
+  int          scat;
+  int          intr;
+  int          charm;
+  int          strange;
+  int          res;
+  int          xnp;
+  int          xnn;
+  int          xnpip;
+  int          xnpim;
+  int          xnpi0;
+  double       nup4   [4];
+  double       nucp4  [4];
+  double       nucerm;
+  double       nucrad;
+  unsigned int kvset;
+  double       kv     [kNumOfKineVar];
+  double       fslp4  [4];
+  double       hadp4  [4];
+  double       wght;
+  double       prob;
+  double       xsec;
+  double       dxsec;
+  int          kps;
+
+  // hadrons in the nucleus
+  int          n;
+  int          hpdg   [kNtpRwMaxHadrons];
+  int          hresc  [kNtpRwMaxHadrons];
+  double       hp4    [kNtpRwMaxHadrons][4];
+  double       hx4    [kNtpRwMaxHadrons][4];
+};
+
+}      // genie namespace
+#endif // _NTP_MC_REWEIGHT_RECORD_H_
@@ -9,8 +9,15 @@
 //____________________________________________________________________________
 
 #include <cassert>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <sstream>
+#include <thread>
+#include <utility>
+#include <vector>
 
+#include <TROOT.h>
 #include <TFile.h>
 #include <TTree.h>
 #include <TClonesArray.h>
@@ -19,7 +26,10 @@
 #include "Framework/EventGen/EventRecord.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Ntuple/NtpWriter.h"
+#include "Framework/Ntuple/NtpMCEventIndex.h"
 #include "Framework/Ntuple/NtpMCEventRecord.h"
+#include "Framework/Ntuple/NtpMCFlatRecord.h"
+#include "Framework/Ntuple/NtpMCReweightRecord.h"
 #include "Framework/Ntuple/NtpMCTreeHeader.h"
 #include "Framework/Ntuple/NtpMCJobConfig.h"
 #include "Framework/Ntuple/NtpMCJobEnv.h"
@@ -31,6 +41,18 @@ using std::ostringstream;
 
 using namespace genie;
 
+//____________________________________________________________________________
+struct NtpWriter::WriterThread
+{
+  std::thread                  thread;
+  std::mutex                   mutex;
+  std::condition_variable      cond;     ///< signals any change below
+  std::vector<EventRecord *>   pool;     ///< all event buffers (owned)
+  std::vector<EventRecord *>   free;     ///< event buffers free to be filled
+  std::deque< std::pair<int, EventRecord *> > queue; ///< events to be written
+  bool                         busy;     ///< is the thread writing an event?
+  bool                         stop;     ///< should the thread exit once the queue is empty?
+};
 //____________________________________________________________________________
 NtpWriter::NtpWriter(NtpMCFormat_t fmt, Long_t runnu) :
 fNtpFormat(fmt),
@@ -39,7 +61,14 @@ fOutFile(0),
 fOutTree(0),
 fEventBranch(0),
 fNtpMCEventRecord(0),
-fNtpMCTreeHeader(0)
+fNtpMCEventIndex(0),
+fNtpMCFlatRecord(0),
+fNtpMCTreeHeader(0),
+fWriteRwStream(false),
+fRwTree(0),
+fNtpMCReweightRecord(0),
+fWriterQueueSize(0),
+fWriterThread(0)
 {
   LOG("Ntp", pNOTICE) << "Run number: " << runnu;
   LOG("Ntp", pNOTICE)
@@ -50,7 +79,11 @@ fNtpMCTreeHeader(0)
 //____________________________________________________________________________
 NtpWriter::~NtpWriter()
 {
-
+  this->StopWriterThread();
+  if(fNtpMCEventRecord) delete fNtpMCEventRecord;
+  if(fNtpMCEventIndex) delete fNtpMCEventIndex;
+  if(fNtpMCFlatRecord)  delete fNtpMCFlatRecord;
+  if(fNtpMCReweightRecord) delete fNtpMCReweightRecord;
 }
 //____________________________________________________________________________
 void NtpWriter::AddEventRecord(int ievent, const EventRecord * ev_rec)
@@ -66,17 +99,153 @@ void NtpWriter::AddEventRecord(int ievent, const EventRecord * ev_rec)
     return;
   }
 
+  if(fWriterQueueSize > 0) {
+     // hand a copy of the event over to the writer thread
+     if(!fWriterThread) this->StartWriterThread();
+     WriterThread & wt = *fWriterThread;
+     EventRecord * buffer = 0;
+     {
+       std::unique_lock<std::mutex> lock(wt.mutex);
+       wt.cond.wait(lock, [&wt] { return !wt.free.empty(); });
+       buffer = wt.free.back();
+       wt.free.pop_back();
+     }
+     buffer->Copy(*ev_rec);
+     {
+       std::lock_guard<std::mutex> lock(wt.mutex);
+       wt.queue.push_back(std::make_pair(ievent, buffer));
+     }
+     wt.cond.notify_all();
+     return;
+  }
+
+  this->FillEvent(ievent, ev_rec);
+}
+//____________________________________________________________________________
+void NtpWriter::FillEvent(int ievent, const EventRecord * ev_rec)
+{
   switch (fNtpFormat) {
      case kNFGHEP:
-          fNtpMCEventRecord = new NtpMCEventRecord();
-          fNtpMCEventRecord->Fill(ievent, ev_rec);
+          this->FillGHEPEvent(ievent, ev_rec);
+          break;
+     case kNFFlat:
+          fNtpMCFlatRecord->Fill(ievent, ev_rec);
           fOutTree->Fill();
-          delete fNtpMCEventRecord;
-          fNtpMCEventRecord = 0;
           break;
      default:
         break;
   }
+
+  if(fRwTree) {
+     fNtpMCReweightRecord->Fill(ievent, ev_rec);
+     fRwTree->Fill();
+  }
+}
+//____________________________________________________________________________
+void NtpWriter::FillGHEPEvent(int ievent, const EventRecord * ev_rec)
+{
+// Stream the input event record through the persistent branch object, rather
+// than copying it into a new NtpMCEventRecord: point the branch object to it
+// for the duration of the fill
+
+  EventRecord * own = fNtpMCEventRecord->event;
+  fNtpMCEventRecord->event      = const_cast<EventRecord *> (ev_rec);
+  fNtpMCEventRecord->hdr.ievent = ievent;
+  if(fNtpMCEventIndex) fNtpMCEventIndex->Fill(ev_rec);
+  fOutTree->Fill();
+  fNtpMCEventRecord->event      = own;
+}
+//____________________________________________________________________________
+void NtpWriter::UseWriterThread(unsigned int queue_size)
+{
+  if(fWriterThread) {
+    LOG("Ntp", pERROR)
+      << "The writer thread is already running; can't change its queue size";
+    return;
+  }
+
+  fWriterQueueSize = queue_size;
+
+  LOG("Ntp", pNOTICE)
+    << "Output tree filled from a separate writer thread? : "
+    << ((fWriterQueueSize > 0) ? "Yes" : "No")
+    << " (event queue size: " << fWriterQueueSize << ")";
+}
+//____________________________________________________________________________
+void NtpWriter::StartWriterThread(void)
+{
+  // the calling and the writer threads both use ROOT
+  ROOT::EnableThreadSafety();
+
+  fWriterThread = new WriterThread;
+  fWriterThread->busy = false;
+  fWriterThread->stop = false;
+  for(unsigned int i = 0; i < fWriterQueueSize; i++) {
+    EventRecord * buffer = new EventRecord;
+    fWriterThread->pool.push_back(buffer);
+    fWriterThread->free.push_back(buffer);
+  }
+  fWriterThread->thread = std::thread(&NtpWriter::RunWriterThread, this);
+
+  LOG("Ntp", pINFO) << "Started the output tree writer thread";
+}
+//____________________________________________________________________________
+void NtpWriter::RunWriterThread(void)
+{
+  WriterThread & wt = *fWriterThread;
+  while(1) {
+    std::pair<int, EventRecord *> entry;
+    {
+      std::unique_lock<std::mutex> lock(wt.mutex);
+      wt.cond.wait(lock, [&wt] { return !wt.queue.empty() || wt.stop; });
+      if(wt.queue.empty()) break;
+      entry = wt.queue.front();
+      wt.queue.pop_front();
+      wt.busy = true;
+    }
+
+    this->FillEvent(entry.first, entry.second);
+
+    {
+      std::lock_guard<std::mutex> lock(wt.mutex);
+      wt.free.push_back(entry.second);
+      wt.busy = false;
+    }
+    wt.cond.notify_all();
+  }
+}
+//____________________________________________________________________________
+void NtpWriter::DrainWriterThread(void)
+{
+// wait till all queued events are in the output tree
+
+  if(!fWriterThread) return;
+
+  WriterThread & wt = *fWriterThread;
+  std::unique_lock<std::mutex> lock(wt.mutex);
+  wt.cond.wait(lock, [&wt] { return wt.queue.empty() && !wt.busy; });
+}
+//____________________________________________________________________________
+void NtpWriter::StopWriterThread(void)
+{
+// write out all queued events and join the writer thread
+
+  if(!fWriterThread) return;
+
+  {
+    std::lock_guard<std::mutex> lock(fWriterThread->mutex);
+    fWriterThread->stop = true;
+  }
+  fWriterThread->cond.notify_all();
+  fWriterThread->thread.join();
+
+  for(unsigned int i = 0; i < fWriterThread->pool.size(); i++) {
+    delete fWriterThread->pool[i];
+  }
+  delete fWriterThread;
+  fWriterThread = 0;
+
+  LOG("Ntp", pINFO) << "Stopped the output tree writer thread";
 }
 //____________________________________________________________________________
 void NtpWriter::Initialize()
@@ -89,6 +258,11 @@ void NtpWriter::Initialize()
   //-- create the event branch
   this->CreateEventBranch();
 
+  //-- create the reweighting summary side tree, if requested
+  if(fWriteRwStream || RunOpt::Instance()->ReweightStream()) {
+    this->CreateReweightTree();
+  }
+
   //-- create the tree header
   this->CreateTreeHeader();
   //-- update the tune name (and associated directories) from RunOpt
@@ -124,6 +298,97 @@ void NtpWriter::Initialize()
   environment.TakeSnapshot()->Write();
 }
 //____________________________________________________________________________
+void NtpWriter::Checkpoint(void)
+{
+  if(!fOutTree) {
+    LOG("Ntp", pERROR) << "No open output TTree to checkpoint!";
+    return;
+  }
+
+  this->DrainWriterThread();
+
+  LOG("Ntp", pINFO)
+    << "Checkpointing output tree at " << fOutTree->GetEntries() << " entries";
+
+  // Automatic autosaves would make the tree on disk run ahead of the last
+  // checkpoint: once checkpointing is in use, the tree is only saved here
+  fOutTree->SetAutoSave(0);
+  fOutTree->AutoSave("SaveSelf");
+  if(fRwTree) {
+    fRwTree->SetAutoSave(0);
+    fRwTree->AutoSave("SaveSelf");
+  }
+}
+//____________________________________________________________________________
+bool NtpWriter::Resume(Long64_t nevents)
+{
+  LOG("Ntp",pNOTICE)
+    << "Resuming GENIE output MC tree in file: " << fOutFilename;
+
+  if(fOutFile) delete fOutFile;
+  fOutFile = TFile::Open(fOutFilename.c_str(),"UPDATE");
+  if(!fOutFile || fOutFile->IsZombie()) {
+    LOG("Ntp", pERROR) << "Couldn't re-open output file: " << fOutFilename;
+    return false;
+  }
+
+  fOutTree = dynamic_cast<TTree*> (fOutFile->Get("gtree"));
+  fNtpMCTreeHeader =
+      dynamic_cast<NtpMCTreeHeader*> (fOutFile->Get("header"));
+  if(!fOutTree || !fNtpMCTreeHeader) {
+    LOG("Ntp", pERROR)
+      << "No GENIE event tree / tree header in file: " << fOutFilename;
+    return false;
+  }
+  if(fOutTree->GetEntries() != nevents) {
+    LOG("Ntp", pERROR)
+      << "The event tree holds " << fOutTree->GetEntries()
+      << " events but the checkpoint was taken at " << nevents << " events";
+    return false;
+  }
+  fOutTree->SetAutoSave(0);
+
+  // keep the reweighting summary tree going only if the file has one
+  fRwTree = dynamic_cast<TTree*> (fOutFile->Get("grwtree"));
+  if(fRwTree) {
+    if(!fNtpMCReweightRecord) fNtpMCReweightRecord = new NtpMCReweightRecord();
+    if(!fNtpMCReweightRecord->SetBranchAddresses(fRwTree) ||
+        fRwTree->GetEntries() != nevents) {
+      LOG("Ntp", pERROR)
+        << "Inconsistent reweighting summary tree in file: " << fOutFilename;
+      return false;
+    }
+    fRwTree->SetAutoSave(0);
+  }
+
+  if(fNtpFormat == kNFFlat) {
+    if(!fNtpMCFlatRecord) fNtpMCFlatRecord = new NtpMCFlatRecord();
+    if(!fNtpMCFlatRecord->SetBranchAddresses(fOutTree)) return false;
+    fEventBranch = fOutTree->GetBranch("iev");
+    LOG("Ntp",pNOTICE) << "Appending to event tree after event " << nevents;
+    return true;
+  }
+
+  if(!fNtpMCEventRecord) fNtpMCEventRecord = new NtpMCEventRecord();
+  fEventBranch = fOutTree->GetBranch("gmcrec");
+  if(!fEventBranch) {
+    LOG("Ntp", pERROR) << "No event branch in the GENIE event tree";
+    return false;
+  }
+  fOutTree->SetBranchAddress("gmcrec", &fNtpMCEventRecord);
+  fEventBranch->SetAutoDelete(kFALSE);
+
+  // keep the event index going only if the tree has one from the start
+  if(!fNtpMCEventIndex) fNtpMCEventIndex = new NtpMCEventIndex();
+  if(!fNtpMCEventIndex->SetBranchAddresses(fOutTree)) {
+    delete fNtpMCEventIndex;
+    fNtpMCEventIndex = 0;
+  }
+
+  LOG("Ntp",pNOTICE) << "Appending to event tree after event " << nevents;
+  return true;
+}
+//____________________________________________________________________________
 void NtpWriter::CustomizeFilename(string filename)
 {
  fOutFilename = filename;
@@ -177,6 +442,9 @@ void NtpWriter::CreateEventBranch(void)
      case kNFGHEP:
         this->CreateGHEPEventBranch();
         break;
+     case kNFFlat:
+        this->CreateFlatEventBranch();
+        break;
      default:
         LOG("Ntp", pERROR)
            << "Unknown TTree format. Can not create TBranches";
@@ -190,7 +458,8 @@ void NtpWriter::CreateGHEPEventBranch(void)
 {
   LOG("Ntp", pINFO) << "Creating a NtpMCEventRecord TBranch";
 
-  fNtpMCEventRecord = 0;
+  // a single, persistent branch object (see AddEventRecord())
+  if(!fNtpMCEventRecord) fNtpMCEventRecord = new NtpMCEventRecord();
   TTree::SetBranchStyle(1);
 
 #if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
@@ -204,6 +473,34 @@ void NtpWriter::CreateGHEPEventBranch(void)
   // was split=1 ... but, at least w/ ROOT 6.06/04, this generates
   //   Warning in <TTree::Bronch>: genie::NtpMCEventRecord cannot be split, resetting splitlevel to 0
   // which the art framework turns into a fatal error
+
+  // plain event summary columns, for fast event selection (eg in gevpick)
+  if(!fNtpMCEventIndex) fNtpMCEventIndex = new NtpMCEventIndex();
+  fNtpMCEventIndex->CreateBranches(fOutTree);
+}
+//____________________________________________________________________________
+void NtpWriter::CreateFlatEventBranch(void)
+{
+  LOG("Ntp", pINFO) << "Creating the flat event TBranches";
+
+  if(!fNtpMCFlatRecord) fNtpMCFlatRecord = new NtpMCFlatRecord();
+  fNtpMCFlatRecord->CreateBranches(fOutTree);
+
+  fEventBranch = fOutTree->GetBranch("iev");
+}
+//____________________________________________________________________________
+void NtpWriter::CreateReweightTree(void)
+{
+  LOG("Ntp", pNOTICE)
+    << "Creating the reweighting summary tree (one entry per event)";
+
+  if(fRwTree) delete fRwTree;
+
+  fRwTree = new TTree("grwtree","GENIE MC event reweighting summary TTree");
+  fRwTree->SetAutoSave(200000000);
+
+  if(!fNtpMCReweightRecord) fNtpMCReweightRecord = new NtpMCReweightRecord();
+  fNtpMCReweightRecord->CreateBranches(fRwTree);
 }
 //____________________________________________________________________________
 void NtpWriter::CreateTreeHeader(void)
@@ -224,6 +521,8 @@ void NtpWriter::Save(void)
 {
   LOG("Ntp", pINFO) << "Saving the output tree";
 
+  this->StopWriterThread();
+
   if(fOutFile) {
 
     fOutFile->Write();
@@ -34,6 +34,9 @@ namespace genie {
 
 class EventRecord;
 class NtpMCEventRecord;
+class NtpMCEventIndex;
+class NtpMCFlatRecord;
+class NtpMCReweightRecord;
 class NtpMCTreeHeader;
 
 class NtpWriter {
@@ -51,14 +54,42 @@ public :
   ///< save the event tree
   void Save (void);
 
+  ///< flush the events added so far to the output file, so that the job can
+  ///< be restarted from this point (see GMCJDriver::SaveCheckpoint())
+  void Checkpoint (void);
+
+  ///< use instead of Initialize() to re-open the output file of a previously
+  ///< checkpointed job and keep appending to its event tree; checks that the
+  ///< tree holds the input number of (checkpointed) events
+  bool Resume (Long64_t nevents);
+
   ///< get the even tree
   TTree *  EventTree (void) { return fOutTree; }
 
+  ///< use before the first AddEventRecord() to fill the event tree (i.e.
+  ///< compress and write its baskets) from a separate writer thread:
+  ///< AddEventRecord() then copies the input event into one of queue_size
+  ///< recycled buffers (waiting for one to be free) and returns. Checkpoint()
+  ///< and Save() wait for the queued events to be written first. Don't touch
+  ///< the EventTree() in between
+  void UseWriterThread (unsigned int queue_size = 64);
+
+  ///< use before Initialize() to also write the compact reweighting summary
+  ///< of each event (see NtpMCReweightRecord) to a side tree (grwtree); also
+  ///< enabled by the --reweight-stream run option (see RunOpt)
+  void EnableReweightStream (bool enable = true) { fWriteRwStream = enable; }
+
+  ///< get the reweighting summary tree (0 if not written)
+  TTree *  ReweightTree (void) { return fRwTree; }
+
   ///< use before Initialize() only if you wish to override the default
   ///< filename, or the default filename prefix
   void CustomizeFilename       (string filename);
   void CustomizeFilenamePrefix (string prefix);
 
+  ///< get the output filename
+  string Filename (void) const { return fOutFilename; }
+
 private:
 
   void SetDefaultFilename    (string filename_prefix="gntp");
@@ -67,6 +98,16 @@ private:
   void CreateTreeHeader      (void);
   void CreateEventBranch     (void);
   void CreateGHEPEventBranch (void);
+  void CreateFlatEventBranch (void);
+  void CreateReweightTree    (void);
+  void FillEvent             (int ievent, const EventRecord * ev_rec);
+  void FillGHEPEvent         (int ievent, const EventRecord * ev_rec);
+
+  struct WriterThread;
+  void StartWriterThread     (void);
+  void DrainWriterThread     (void);
+  void StopWriterThread      (void);
+  void RunWriterThread       (void);
 
   NtpMCFormat_t      fNtpFormat;          ///< enumeration of event formats
   Long_t             fRunNu;              ///< run nu
@@ -74,8 +115,15 @@ private:
   TFile *            fOutFile;            ///< output file
   TTree *            fOutTree;            ///< output tree
   TBranch *          fEventBranch;        ///< the generated event branch
-  NtpMCEventRecord * fNtpMCEventRecord;   ///<
+  NtpMCEventRecord * fNtpMCEventRecord;   ///< persistent branch object, pointed to each added event in turn
+  NtpMCEventIndex *  fNtpMCEventIndex;    ///< branch buffers of the event index columns of the GHEP format
+  NtpMCFlatRecord *  fNtpMCFlatRecord;    ///< branch buffers of the flat format
   NtpMCTreeHeader *  fNtpMCTreeHeader;    ///<
+  bool                  fWriteRwStream;       ///< write the reweighting summary side tree?
+  TTree *               fRwTree;              ///< reweighting summary side tree, if written
+  NtpMCReweightRecord * fNtpMCReweightRecord; ///< branch buffers of the reweighting summary tree
+  unsigned int       fWriterQueueSize;    ///< event buffers of the writer thread (0: no writer thread)
+  WriterThread *     fWriterThread;       //!< writer thread & its event queue, if running
 };
 
 }      // genie namespace
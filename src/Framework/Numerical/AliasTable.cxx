@@ -0,0 +1,74 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include "Framework/Numerical/AliasTable.h"
+
+using std::vector;
+using namespace genie;
+
+//____________________________________________________________________________
+AliasTable::AliasTable() :
+fN(0)
+{
+
+}
+//____________________________________________________________________________
+AliasTable::AliasTable(const vector<double> & weights) :
+fN(0)
+{
+  this->Build(weights);
+}
+//____________________________________________________________________________
+AliasTable::~AliasTable()
+{
+
+}
+//____________________________________________________________________________
+bool AliasTable::Build(const vector<double> & weights)
+{
+  fN = 0;
+  fCut  .clear();
+  fAlias.clear();
+
+  int    n   = weights.size();
+  double sum = 0;
+  for(int i = 0; i < n; i++) {
+    if(weights[i] > 0) sum += weights[i];
+  }
+  if(n == 0 || sum <= 0) return false;
+
+  // scaled weights (mean 1), split in under-full and over-full buckets
+  vector<double> w(n);
+  vector<int> small, large;
+  fCut  .resize(n);
+  fAlias.resize(n);
+  for(int i = 0; i < n; i++) {
+    w[i] = (weights[i] > 0) ? weights[i] * n / sum : 0.;
+    fAlias[i] = i;
+    if(w[i] < 1.) small.push_back(i); else large.push_back(i);
+  }
+
+  // fill each under-full bucket with an over-full one
+  while(!small.empty() && !large.empty()) {
+    int s = small.back(); small.pop_back();
+    int l = large.back();
+    fCut  [s] = w[s];
+    fAlias[s] = l;
+    w[l] -= (1. - w[s]);
+    if(w[l] < 1.) { large.pop_back(); small.push_back(l); }
+  }
+  // what is left is full, up to rounding errors
+  for(unsigned int i = 0; i < small.size(); i++) fCut[small[i]] = 1.;
+  for(unsigned int i = 0; i < large.size(); i++) fCut[large[i]] = 1.;
+
+  fN = n;
+  return true;
+}
+//____________________________________________________________________________
@@ -0,0 +1,61 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::AliasTable
+
+\brief    Walker's alias table for sampling a discrete distribution in O(1).
+
+          The table is built once from the (unnormalised) weights of the n
+          outcomes. Each draw then takes one uniform random number and at
+          most one table indirection, with no search and no allocation.
+          Tables are read-only once built and can be shared by threads.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _ALIAS_TABLE_H_
+#define _ALIAS_TABLE_H_
+
+#include <vector>
+
+namespace genie {
+
+class AliasTable {
+
+public:
+  AliasTable();
+  AliasTable(const std::vector<double> & weights);
+ ~AliasTable();
+
+  //! Builds the table from the input non-negative weights. Returns false
+  //! (and leaves the table empty) if the weights sum up to zero.
+  bool Build (const std::vector<double> & weights);
+
+  //! Returns an outcome in [0, Size()), for u uniformly distributed in [0,1)
+  int Sample (double u) const
+  {
+    double x = u * fN;
+    int    i = (int) x;
+    if(i >= fN) i = fN-1;
+    return (x - i < fCut[i]) ? i : fAlias[i];
+  }
+
+  int  Size    (void) const { return fN;    }
+  bool IsEmpty (void) const { return fN==0; }
+
+private:
+  int                 fN;       ///< number of outcomes
+  std::vector<double> fCut;     ///< probability of keeping outcome i at bucket i
+  std::vector<int>    fAlias;   ///< alternative outcome of bucket i
+};
+
+}      // genie namespace
+
+#endif // _ALIAS_TABLE_H_
@@ -12,18 +12,25 @@
 
 #include <cassert>
 #include <limits>
+#include <algorithm>
+#include <mutex>
 
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/BLI2D.h"
 
 using namespace genie;
 
+namespace {
+  std::mutex gCellMutex; // serializes building the cell-major grid copies
+}
+
 ClassImp(BLI2DGrid)
 
 //___________________________________________________________________________
 BLI2DGrid::BLI2DGrid()
 {
-
+  fCellNY     = 0;
+  fCellsReady = false;
 }
 //___________________________________________________________________________
 BLI2DGrid::~BLI2DGrid()
@@ -38,6 +45,56 @@ int BLI2DGrid::IdxZ(int ix, int iy) const
   return ix*fNY+iy;
 }
 //___________________________________________________________________________
+void BLI2DGrid::Evaluate(
+  const double * x, const double * y, double * z, int n) const
+{
+  for(int i=0; i<n; i++) {
+    z[i] = this->Evaluate(x[i], y[i]);
+  }
+}
+//___________________________________________________________________________
+void BLI2DGrid::BuildCells(int nx, int ny) const
+{
+// Copy the grid values, for the nx * ny filled grid points, in cell-major
+// order: z11, z21, z12, z22 for cell (ix,iy) = ([x_ix, x_ix+1], [y_iy, y_iy+1])
+
+  std::lock_guard<std::mutex> lock(gCellMutex);
+  if(fCellsReady) return;
+
+  int ncx = std::max(nx-1, 0);
+  int ncy = std::max(ny-1, 0);
+  fCellZ.resize(4*ncx*ncy);
+  for(int ix=0; ix<ncx; ix++) {
+    for(int iy=0; iy<ncy; iy++) {
+      double * c = &fCellZ[4*(ix*ncy+iy)];
+      c[0] = fZ[ this->IdxZ(ix,  iy  ) ];
+      c[1] = fZ[ this->IdxZ(ix+1,iy  ) ];
+      c[2] = fZ[ this->IdxZ(ix,  iy+1) ];
+      c[3] = fZ[ this->IdxZ(ix+1,iy+1) ];
+    }
+  }
+  fCellNY     = ncy;
+  fCellsReady = true;
+}
+//___________________________________________________________________________
+double BLI2DGrid::Interpolate(int ix, int iy, double x, double y) const
+{
+// Bilinear interpolation in cell (ix,iy)
+
+  const double * c = &fCellZ[4*(ix*fCellNY+iy)];
+
+  double x1  = fX[ix];
+  double x2  = fX[ix+1];
+  double y1  = fY[iy];
+  double y2  = fY[iy+1];
+
+  double z1  = c[0] * (x2-x)/(x2-x1) + c[1] * (x-x1)/(x2-x1);
+  double z2  = c[2] * (x2-x)/(x2-x1) + c[3] * (x-x1)/(x2-x1);
+  double z   = z1   * (y2-y)/(y2-y1) + z2   * (y-y1)/(y2-y1);
+
+  return z;
+}
+//___________________________________________________________________________
 //___________________________________________________________________________
 //___________________________________________________________________________
 ClassImp(BLI2DUnifGrid)
@@ -77,6 +134,7 @@ bool BLI2DUnifGrid::AddPoint(double x, double y, double z)
   int iz = this->IdxZ(ix,iy);
 
   fZ[iz] = z;
+  fCellsReady = false;
 
   fZmin = TMath::Min(z, fZmin);
   fZmax = TMath::Max(z, fZmax);
@@ -94,33 +152,19 @@ double BLI2DUnifGrid::Evaluate(double x, double y) const
   if(x < fXmin || x > fXmax) return 0.;
   if(y < fYmin || y > fYmax) return 0.;
 
+  if(!fCellsReady) this->BuildCells(fNX, fNY);
+
+  // cell index; x = xmax (y = ymax) falls in the last cell
   int ix_lo  = TMath::FloorNint( (x - fXmin) / fDX );
   int iy_lo  = TMath::FloorNint( (y - fYmin) / fDY );
-  int ix_hi  = ix_lo + 1;
-  int iy_hi  = iy_lo + 1;
-
-  double x1  = fX[ix_lo];
-  double x2  = fX[ix_hi];
-  double y1  = fY[iy_lo];
-  double y2  = fY[iy_hi];
+  ix_lo = TMath::Min(ix_lo, fNX-2);
+  iy_lo = TMath::Min(iy_lo, fNY-2);
 
-  double z11 = fZ[ this->IdxZ(ix_lo,iy_lo) ];
-  double z21 = fZ[ this->IdxZ(ix_hi,iy_lo) ];
-  double z12 = fZ[ this->IdxZ(ix_lo,iy_hi) ];
-  double z22 = fZ[ this->IdxZ(ix_hi,iy_hi) ];
-
-  double z1  = z11 * (x2-x)/(x2-x1) + z21 * (x-x1)/(x2-x1);
-  double z2  = z12 * (x2-x)/(x2-x1) + z22 * (x-x1)/(x2-x1);
-  double z   = z1  * (y2-y)/(y2-y1) + z2  * (y-y1)/(y2-y1);
+  double z = this->Interpolate(ix_lo, iy_lo, x, y);
 
 /*
-  LOG("BLI2DUnifGrid", pDEBUG) << "x = " << x << " -> nearby nodes: " << x1 << ", " << x2;
-  LOG("BLI2DUnifGrid", pDEBUG) << "y = " << x << " -> nearby nodes: " << y1 << ", " << y2;
-  LOG("BLI2DUnifGrid", pDEBUG) << "z11 := z(" << this->IdxZ(ix_lo,iy_lo) << ")  = " << z11;
-  LOG("BLI2DUnifGrid", pDEBUG) << "z21 := z(" << this->IdxZ(ix_hi,iy_lo) << ")  = " << z21;
-  LOG("BLI2DUnifGrid", pDEBUG) << "z12 := z(" << this->IdxZ(ix_lo,iy_hi) << ")  = " << z12;
-  LOG("BLI2DUnifGrid", pDEBUG) << "z22 := z(" << this->IdxZ(ix_hi,iy_hi) << ")  = " << z22;
-  LOG("BLI2DUnifGrid", pDEBUG) << "z1 = " << z1 << ", z2 = " << z2;
+  LOG("BLI2DUnifGrid", pDEBUG) << "x = " << x << " -> cell: " << ix_lo;
+  LOG("BLI2DUnifGrid", pDEBUG) << "y = " << y << " -> cell: " << iy_lo;
   LOG("BLI2DUnifGrid", pDEBUG) << "interpolated z(x,y) = " << z;
 */
 
@@ -144,6 +188,7 @@ void BLI2DUnifGrid::Init(
   fX    = 0;
   fY    = 0;
   fZ    = 0;
+  fCellsReady = false;
 
   if(nx>1 && ny>1) {
     fNX = nx;
@@ -310,6 +355,7 @@ bool BLI2DNonUnifGrid::AddPoint(double x, double y, double z)
   int iz = this->IdxZ(xidx,yidx);
 
   fZ[iz] = z;
+  fCellsReady = false;
 
   fZmin = TMath::Min(z, fZmin);
   fZmax = TMath::Max(z, fZmax);
@@ -329,61 +375,78 @@ double BLI2DNonUnifGrid::Evaluate(double x, double y) const
   double evaly=TMath::Min(y,fYmax);
   evaly=TMath::Max(evaly,fYmin);
 
-  int ix_lo  = -2;
-  int iy_lo  = -2;
-  for (int i=0;i<fNFillX;i++)
-    {
-      if (evalx<=fX[fNFillX-1-i]) ix_lo=fNFillX-2-i;
-      else break;
-    }
-  for (int i=0;i<fNFillY;i++)
-    {
-      if (evaly<=fY[fNFillY-1-i]) iy_lo=fNFillY-2-i;
-      else break;
-    }
-  int ix_hi  = ix_lo + 1;
-  int iy_hi  = iy_lo + 1;
-
-  // in case x = xmin
-  if (ix_lo==-1) {ix_lo++; ix_hi++;}
-  if (iy_lo==-1) {iy_lo++; iy_hi++;}
-  // in case x = xmax
-  if (ix_lo==-2) {ix_lo=fNFillX-2; ix_hi=fNFillX-1;}
-  if (iy_lo==-2) {iy_lo=fNFillY-2; iy_hi=fNFillY-1;}
   // if an error occurs
-  if (ix_lo<0       || iy_lo<0      ) return 0.;
-  if (ix_hi>fNFillX || iy_hi>fNFillY) return 0.;
+  if (fNFillX<2 || fNFillY<2) return 0.;
 
-  double x1  = fX[ix_lo];
-  double x2  = fX[ix_hi];
-  double y1  = fY[iy_lo];
-  double y2  = fY[iy_hi];
+  if(!fCellsReady) this->BuildCells(fNFillX, fNFillY);
 
-  double z11 = fZ[ this->IdxZ(ix_lo,iy_lo) ];
-  double z21 = fZ[ this->IdxZ(ix_hi,iy_lo) ];
-  double z12 = fZ[ this->IdxZ(ix_lo,iy_hi) ];
-  double z22 = fZ[ this->IdxZ(ix_hi,iy_hi) ];
+  int ix_lo = this->FindCell(fX, fNFillX, evalx, fLastIX);
+  int iy_lo = this->FindCell(fY, fNFillY, evaly, fLastIY);
+  fLastIX = ix_lo;
+  fLastIY = iy_lo;
 
-  double z1  = z11 * (x2-evalx)/(x2-x1) + z21 * (evalx-x1)/(x2-x1);
-  double z2  = z12 * (x2-evalx)/(x2-x1) + z22 * (evalx-x1)/(x2-x1);
-  double z   = z1  * (y2-evaly)/(y2-y1) + z2  * (evaly-y1)/(y2-y1);
+  double z = this->Interpolate(ix_lo, iy_lo, evalx, evaly);
 
   /*
-  LOG("BLI2DNonUnifGrid", pINFO) << "x = " << evalx << " -> nearby nodes: " << x1 << ", " << x2;
-  LOG("BLI2DNonUnifGrid", pINFO) << "y = " << evaly << " -> nearby nodes: " << y1 << ", " << y2;
+  LOG("BLI2DNonUnifGrid", pINFO) << "x = " << evalx << " -> cell: " << ix_lo;
+  LOG("BLI2DNonUnifGrid", pINFO) << "y = " << evaly << " -> cell: " << iy_lo;
   LOG("BLI2DNonUnifGrid", pINFO) << "xmin = " << fXmin << ", xmax = " << fXmax;
   LOG("BLI2DNonUnifGrid", pINFO) << "ymin = " << fYmin << ", ymax = " << fYmax;
-  LOG("BLI2DNonUnifGrid", pINFO) << "z11 := z(" << this->IdxZ(ix_lo,iy_lo) << ")  = " << z11;
-  LOG("BLI2DNonUnifGrid", pINFO) << "z21 := z(" << this->IdxZ(ix_hi,iy_lo) << ")  = " << z21;
-  LOG("BLI2DNonUnifGrid", pINFO) << "z12 := z(" << this->IdxZ(ix_lo,iy_hi) << ")  = " << z12;
-  LOG("BLI2DNonUnifGrid", pINFO) << "z22 := z(" << this->IdxZ(ix_hi,iy_hi) << ")  = " << z22;
-  LOG("BLI2DNonUnifGrid", pINFO) << "z1 = " << z1 << ", z2 = " << z2;
   LOG("BLI2DNonUnifGrid", pINFO) << "interpolated z(x,y) = " << z;
   */
 
   return z;
 }
 //___________________________________________________________________________
+void BLI2DNonUnifGrid::Evaluate(const BLI2DNonUnifGrid * const grids[],
+  int ngrids, double x, double y, double * z)
+{
+// The cell found for each grid is the first one tried for the next grid: For
+// grids sharing the same x,y points the search is only done once.
+
+  int ix_lo = -1;
+  int iy_lo = -1;
+  for(int i=0; i<ngrids; i++) {
+    const BLI2DNonUnifGrid * grid = grids[i];
+
+    double evalx=TMath::Min(x,grid->fXmax);
+    evalx=TMath::Max(evalx,grid->fXmin);
+    double evaly=TMath::Min(y,grid->fYmax);
+    evaly=TMath::Max(evaly,grid->fYmin);
+
+    if (grid->fNFillX<2 || grid->fNFillY<2) { z[i] = 0.; continue; }
+
+    if(!grid->fCellsReady) grid->BuildCells(grid->fNFillX, grid->fNFillY);
+
+    ix_lo = grid->FindCell(grid->fX, grid->fNFillX, evalx,
+                           (ix_lo < 0) ? grid->fLastIX : ix_lo);
+    iy_lo = grid->FindCell(grid->fY, grid->fNFillY, evaly,
+                           (iy_lo < 0) ? grid->fLastIY : iy_lo);
+    grid->fLastIX = ix_lo;
+    grid->fLastIY = iy_lo;
+
+    z[i] = grid->Interpolate(ix_lo, iy_lo, evalx, evaly);
+  }
+}
+//___________________________________________________________________________
+int BLI2DNonUnifGrid::FindCell(
+  const double * v, int n, double val, int hint) const
+{
+// Find the cell i, in [0,n-2], with v[i] < val <= v[i+1] (val = v[0] falls
+// in the first cell). The hint cell and its neighbours are tried first.
+
+  if (hint >= 0 && hint <= n-2) {
+    if (val <= v[hint+1]) {
+      if (val > v[hint] || hint == 0) return hint;
+      if (hint >= 1 && val > v[hint-1]) return hint-1;
+    }
+    else if (hint <= n-3 && val <= v[hint+2]) return hint+1;
+  }
+
+  int i = std::lower_bound(v, v+n, val) - v - 1;
+  return TMath::Min(TMath::Max(i, 0), n-2);
+}
+//___________________________________________________________________________
 void BLI2DNonUnifGrid::Init(
   int nx, double xmin, double xmax, int ny, double ymin, double ymax)
 {
@@ -392,6 +455,9 @@ void BLI2DNonUnifGrid::Init(
   fNZ    = 0;
   fNFillX= 0;
   fNFillY= 0;
+  fLastIX= 0;
+  fLastIY= 0;
+  fCellsReady = false;
   fXmin  = 0.;
   fXmax  = 0.;
   fYmin  = 0.;
@@ -5,6 +5,12 @@
 
 \brief    Bilinear interpolation of 2D functions on a regular grid.
 
+          For evaluation, the grid values are also kept in a cell-major
+          layout, storing the 4 corners of each grid cell contiguously, so
+          that each evaluation touches a single cache line. The cell found
+          in the last evaluation is checked first, which speeds up the
+          locally coherent queries made by rejection samplers.
+
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -18,6 +24,8 @@
 #ifndef _BILLINEAR_INTERPOLATION_2D_GRID_H_
 #define _BILLINEAR_INTERPOLATION_2D_GRID_H_
 
+#include <vector>
+
 #include <TObject.h>
 
 namespace genie {
@@ -37,6 +45,9 @@ public:
   //-- evaluate the function at the input position
   virtual double Evaluate (double x, double y) const =0;
 
+  //-- evaluate the function at n input positions
+  void Evaluate (const double * x, const double * y, double * z, int n) const;
+
   // report min/max values
   double XMin (void) const { return fXmin; }
   double XMax (void) const { return fXmax; }
@@ -48,7 +59,9 @@ public:
 protected:
 
   virtual void Init (int nx, double xmin, double xmax, int ny, double ymin, double ymax) =0;
-  int  IdxZ (int ix, int iy) const;
+  int    IdxZ        (int ix, int iy) const;
+  void   BuildCells  (int nx, int ny) const;
+  double Interpolate (int ix, int iy, double x, double y) const;
 
   //-- private data members
   int      fNX;
@@ -66,6 +79,11 @@ protected:
   double   fZmin;
   double   fZmax;
 
+  //-- cell-major copy of fZ, built on first evaluation
+  mutable std::vector<double> fCellZ;      //! corners of cell (ix,iy) at 4*(ix*(ny-1)+iy)
+  mutable int                 fCellNY;     //! number of cells along y
+  mutable bool                fCellsReady; //!
+
   ClassDef(BLI2DGrid, 1)
   };
 
@@ -85,6 +103,7 @@ public:
 
   //-- evaluate the function at the input position
   double Evaluate (double x, double y) const;
+  using BLI2DGrid::Evaluate;
 
 private:
 
@@ -109,13 +128,23 @@ public:
 
   //-- evaluate the function at the input position
   double Evaluate (double x, double y) const;
+  using BLI2DGrid::Evaluate;
+
+  //-- evaluate a set of functions tabulated on the same x,y grid points
+  //   (the grid cell is only searched for once)
+  static void Evaluate (const BLI2DNonUnifGrid * const grids[], int ngrids,
+                        double x, double y, double * z);
 
 private:
 
   void Init (int nx=0, double xmin=0, double xmax=0, int ny=0, double ymin=0, double ymax=0);
+  int  FindCell (const double * v, int n, double val, int hint) const;
   int      fNFillX;
   int      fNFillY;
 
+  mutable int fLastIX; //! cell found in the last evaluation
+  mutable int fLastIY; //!
+
   ClassDef(BLI2DNonUnifGrid, 1)
   };
 
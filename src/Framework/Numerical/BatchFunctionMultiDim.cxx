@@ -0,0 +1,29 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include "Framework/Numerical/BatchFunctionMultiDim.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+BatchFunctionMultiDim::~BatchFunctionMultiDim()
+{
+
+}
+//____________________________________________________________________________
+void BatchFunctionMultiDim::DoEvalBatch(
+   unsigned int npoints, const double * x, double * f) const
+{
+  const unsigned int ndim = this->NDim();
+  for(unsigned int i = 0; i < npoints; i++) {
+    f[i] = (*this)(x + i*ndim);
+  }
+}
+//____________________________________________________________________________
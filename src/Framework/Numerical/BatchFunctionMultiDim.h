@@ -0,0 +1,46 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::BatchFunctionMultiDim
+
+\brief    A multi-dimensional function that can be evaluated at a batch of
+          points in one call.
+
+          Integrators that work out many evaluation points at a time (see
+          VegasIntegrator) hand them over in a single DoEvalBatch() call, so
+          that functions with an expensive per-call setup, or that can be
+          vectorized or offloaded, evaluate them together. The default
+          implementation evaluates the points one by one. The function remains
+          a ROOT::Math::IBaseFunctionMultiDim and can be passed to any ROOT
+          or GSL integrator.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _BATCH_FUNCTION_MULTI_DIM_H_
+#define _BATCH_FUNCTION_MULTI_DIM_H_
+
+#include <Math/IFunction.h>
+
+namespace genie {
+
+class BatchFunctionMultiDim : public ROOT::Math::IBaseFunctionMultiDim {
+
+public:
+  virtual ~BatchFunctionMultiDim();
+
+  //! Evaluates the function at npoints points. The coordinates are stored
+  //! point after point: x[i*NDim() + k] is coordinate k of point i.
+  virtual void DoEvalBatch (unsigned int npoints, const double * x, double * f) const;
+};
+
+}      // genie namespace
+
+#endif // _BATCH_FUNCTION_MULTI_DIM_H_
@@ -14,10 +14,33 @@
 #define _OLD_GSL_INTEGRATION_ENUM_TYPES_
 #endif
 
+#include <Math/IntegratorMultiDim.h>
+#include <Math/AdaptiveIntegratorMultiDim.h>
+#ifndef _OLD_GSL_INTEGRATION_ENUM_TYPES_
+#include <Math/IntegratorOptions.h>
+#endif
+
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Utils/StringUtils.h"
 #include "Framework/Numerical/GSLUtils.h"
-
+#include "Framework/Numerical/VegasIntegrator.h"
+
+namespace {
+  // Integrators re-used by IntegrateMultiDim on each thread. Only integrators
+  // keeping no random number state across calls are kept, so that integrals
+  // don't depend on what was integrated before on the same thread.
+  struct IntegratorWorkspace {
+    genie::VegasIntegrator vegas;
+#ifndef _OLD_GSL_INTEGRATION_ENUM_TYPES_
+    ROOT::Math::AdaptiveIntegratorMultiDim adaptive;
+#endif
+  };
+  IntegratorWorkspace & Workspace(void)
+  {
+    thread_local IntegratorWorkspace workspace;
+    return workspace;
+  }
+}
 //____________________________________________________________________________
 ROOT::Math::IntegrationOneDim::Type
      genie::utils::gsl::Integration1DimTypeFromString (string type)
@@ -67,6 +90,7 @@ ROOT::Math::IntegrationMultiDim::Type
   if      (t=="adaptive") return ROOT::Math::IntegrationMultiDim::ADAPTIVE;
   else if (t=="plain")    return ROOT::Math::IntegrationMultiDim::PLAIN;
   else if (t=="vegas")    return ROOT::Math::IntegrationMultiDim::VEGAS;
+  else if (t=="gsl-vegas") return ROOT::Math::IntegrationMultiDim::VEGAS;
   else if (t=="miser")    return ROOT::Math::IntegrationMultiDim::MISER;
 
   LOG("GSL", pWARN)
@@ -80,6 +104,7 @@ ROOT::Math::IntegrationMultiDim::Type
   if      (t=="adaptive") return ROOT::Math::IntegrationMultiDim::kADAPTIVE;
   else if (t=="plain")    return ROOT::Math::IntegrationMultiDim::kPLAIN;
   else if (t=="vegas")    return ROOT::Math::IntegrationMultiDim::kVEGAS;
+  else if (t=="gsl-vegas") return ROOT::Math::IntegrationMultiDim::kVEGAS;
   else if (t=="miser")    return ROOT::Math::IntegrationMultiDim::kMISER;
 
   LOG("GSL", pWARN)
@@ -92,3 +117,40 @@ ROOT::Math::IntegrationMultiDim::Type
 
 }
 //____________________________________________________________________________
+double genie::utils::gsl::IntegrateMultiDim(
+     const ROOT::Math::IBaseFunctionMultiDim & func, string type,
+     const double * xmin, const double * xmax,
+     double abstol, double reltol, unsigned int maxeval, unsigned int mineval,
+     bool warm_start)
+{
+  string t = genie::utils::str::ToLower(type);
+
+  if(t=="vegas") {
+    VegasIntegrator & ig = Workspace().vegas;
+    ig.SetAbsTolerance(abstol);
+    ig.SetRelTolerance(reltol);
+    ig.SetMaxEval(maxeval);
+    ig.SetWarmStart(warm_start);
+    return ig.Integral(func, xmin, xmax);
+  }
+
+  ROOT::Math::IntegrationMultiDim::Type ig_type =
+     genie::utils::gsl::IntegrationNDimTypeFromString(type);
+
+#ifndef _OLD_GSL_INTEGRATION_ENUM_TYPES_
+  if (ig_type == ROOT::Math::IntegrationMultiDim::kADAPTIVE) {
+    ROOT::Math::AdaptiveIntegratorMultiDim & ig = Workspace().adaptive;
+    ig.SetFunction(func);
+    ig.SetAbsTolerance(abstol);
+    ig.SetRelTolerance(reltol);
+    ig.SetMaxPts(maxeval > 0 ? maxeval : ROOT::Math::IntegratorMultiDimOptions::DefaultNCalls());
+    ig.SetMinPts(mineval);
+    return ig.Integral(xmin, xmax);
+  }
+#endif
+
+  // the GSL Monte Carlo integrators are seeded when built
+  ROOT::Math::IntegratorMultiDim ig(func, ig_type, abstol, reltol, maxeval);
+  return ig.Integral(xmin, xmax);
+}
+//____________________________________________________________________________
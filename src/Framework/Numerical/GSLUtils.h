@@ -18,7 +18,12 @@
 #ifndef _GSL_UTILS_H_
 #define _GSL_UTILS_H_
 
+#include <string>
+
 #include <Math/AllIntegrationTypes.h>
+#include <Math/IFunction.h>
+
+using std::string;
 
 namespace genie {
 namespace utils {
@@ -30,6 +35,21 @@ namespace gsl   {
   ROOT::Math::IntegrationMultiDim::Type
        IntegrationNDimTypeFromString (string type);
 
+  // Integrates a multi-dimensional function over [xmin, xmax] with the named
+  // integrator: "vegas" selects the GENIE VEGAS integrator, which evaluates
+  // the integrand at batches of points (see VegasIntegrator), "gsl-vegas" the
+  // GSL implementation and the other types the ROOT / GSL integrators as in
+  // IntegrationNDimTypeFromString(). mineval is used by the adaptive type only.
+  // The GENIE VEGAS and the adaptive integrators are kept in a per-thread
+  // workspace and re-used by every call on that thread. With warm_start, the
+  // GENIE VEGAS integrator starts from the grid adapted by the previous call
+  // on this thread (eg at the previous knot of a spline computed in a loop).
+  double IntegrateMultiDim (
+       const ROOT::Math::IBaseFunctionMultiDim & func, string type,
+       const double * xmin, const double * xmax,
+       double abstol, double reltol, unsigned int maxeval, unsigned int mineval = 0,
+       bool warm_start = false);
+
 } // namespace gsl
 } // namespace utils
 } // namespace genie
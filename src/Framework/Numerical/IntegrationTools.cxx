@@ -24,6 +24,76 @@ typedef std::complex<double> cdouble;
 
 // All numerical values from Abscissas and weights for Gaussian quadratures of high order (1956)
 // https://archive.org/details/jresv56n1p35
+//
+// Compile-time tables: positive abscissas (y) and weights (w), in decreasing
+// abscissa order, for the 20 and 48 point Gauss-Legendre rules
+//
+namespace {
+  constexpr unsigned int kNGL20 = 10;
+  constexpr double kYGL20[kNGL20] = {
+   .9931285991, .9639719272, .9122344282, .8391169718, .7463319064, .6360536807,
+   .5108670019, .3737060887, .2277858511, .0765265211 };
+  constexpr double kWGL20[kNGL20] = {
+   .0176140071, .0406014298, .0626720483, .0832767415, .1019301198, .1181945319,
+   .1316886384, .1420961093, .1491729864, .1527533871 };
+
+  constexpr unsigned int kNGL48 = 24;
+  constexpr double kYGL48[kNGL48] = {
+   0.9987710072, 0.9935301722, 0.9841245873, 0.9705915925, 0.9529877031,
+   0.9313866907, 0.9058791367, 0.8765720202, 0.8435882616, 0.8070662040, 0.7671590325, 0.7240341309,
+   0.6778723796, 0.6288673967, 0.5772247260, 0.5231609747, 0.4669029047, 0.4086864819, 0.3487558862,
+   0.2873624873, 0.2247637903, 0.1612223560, 0.0970046992, 0.0323801709 };
+  constexpr double kWGL48[kNGL48] = {
+   0.0031533460, 0.0073275539, 0.0114772345, 0.0155793157, 0.0196161604,
+   0.0235707608, 0.0274265097, 0.0311672278, 0.0347772225, 0.0382413510, 0.0415450829, 0.0446745608,
+   0.0476166584, 0.0503590355, 0.0528901894, 0.0551995036, 0.0572772921, 0.0591148396, 0.0607044391,
+   0.0620394231, 0.0631141922, 0.0639242385, 0.0644661644, 0.0647376968 };
+
+  //
+  // Evaluation points of a k-pair Gauss-Legendre rule applied to each of n
+  // equal sub-intervals of [a,b]. Each sub-interval uses nsamp = 2k points.
+  //
+  void GLPoints(const double * y, const unsigned int k,
+                const double a, const double b, const unsigned int n,
+                const unsigned int nsamp, double * x)
+  {
+    const double dint = (b - a) / double(n);
+    const double delt = dint * 0.5;
+    for(unsigned int i = 0; i != n; ++i)
+    {
+      const double orig  = a + delt + i * dint;
+      const double dorig = orig + orig;
+      double * xi = x + i * nsamp;
+      for(unsigned int j = 0; j != k; ++j)
+      {
+        xi[j]         = orig - delt * y[j];
+        xi[nsamp-1-j] = dorig - xi[j];
+      }
+    }
+  }
+  //
+  // Weighted sum of the integrand values at the points computed by GLPoints.
+  // Real and imaginary parts are accumulated separately, so that the inner
+  // loop can be vectorized.
+  //
+  cdouble GLSum(const double * w, const unsigned int k,
+                const double a, const double b, const unsigned int n,
+                const unsigned int nsamp, const cdouble * cf)
+  {
+    double sre = 0.;
+    double sim = 0.;
+    for(unsigned int i = 0; i != n; ++i)
+    {
+      const cdouble * fi = cf + i * nsamp;
+      for(unsigned int j = 0; j != k; ++j)
+      {
+        sre += w[j] * (fi[j].real() + fi[nsamp-1-j].real());
+        sim += w[j] * (fi[j].imag() + fi[nsamp-1-j].imag());
+      }
+    }
+    return cdouble(sre, sim) * 0.5 * (b-a) / double(n);
+  }
+}
 
 //
 // Routine to work out the evaluation points for a Gaussian integral given the
@@ -32,53 +102,15 @@ typedef std::complex<double> cdouble;
 void integrationtools::SG20R(const double a, const double b, const unsigned int n, const unsigned int nsamp,
            double* x, unsigned int& np, double* /*w*/)
 {
-  static const double y[10] = {.9931285991, .9639719272, .9122344282, .8391169718, .7463319064, .6360536807, .5108670019, .3737060887, .2277858511, .0765265211 };
   np = 20 * n;
-  double dint = (b - a) / double(n);
-  double delt = dint * 0.5;
-  double orig = a - delt;
-  int i1 = -nsamp;
-  int i2, j1, j2;
-  double dorig;
-  for(unsigned int i = 1; i <= n; i++)
-  {
-    orig += dint;
-    dorig = orig + orig;
-    i1 += nsamp;
-    i2 = i1 + nsamp+1;
-    for(unsigned int j = 1; j <= 10; j++)
-    {
-      j1 = i1 + j;
-      j2 = i2 - j;
-      x[j1-1] = orig - delt * y[j-1];
-      x[j2-1] = dorig - x[j1-1];
-    }
-  }
+  GLPoints(kYGL20, kNGL20, a, b, n, nsamp, x);
 }
 
 //-----------------------------------------------------------------------------------------------------------
 // Gaussian-Legendre integration of the function defined by CF
 cdouble integrationtools::RG201D(const double A, const double B, const unsigned int N, const unsigned int nsamp, const cdouble CF[])
 {
-  // Gaussian-Legendre integration of the function defined by CF
-  const double W[10] = {.0176140071,.0406014298,.0626720483,.0832767415,.1019301198,.1181945319,.1316886384,.1420961093,.1491729864,.1527533871};
-  cdouble CR(0.0, 0.0);
-  int I1 = -nsamp;
-  int I2, J1, J2;
-  for(unsigned int i = 1; i <= N; ++i)
-  {
-    I1 += nsamp;
-    I2 = I1 + nsamp+1;
-    for(unsigned int j = 1; j <= 10; ++j)
-    {
-      J1 = I1 + j;
-      J2 = I2 - j;
-      CR += W[j-1] * (CF[J1-1]+CF[J2-1]);
-    }
-  }
-  //CRES=CR*0.5*(B-A)/float(N)
-  cdouble CRES = CR*0.5*(B-A)/Double_t(N);
-  return CRES;
+  return GLSum(kWGL20, kNGL20, A, B, N, nsamp, CF);
 }
 //-----------------------------------------------------------------------------------------------------------
 // Gaussian-Legendre integration of the function defined by CF
@@ -89,34 +121,9 @@ void integrationtools::RG202D(const double a, const double b, unsigned int n, un
   // This is a fast integrator based on a Gauss-Legendre method. This only support two-dimensional integration
   n = 2; l = 0; m = 3;
 
-  static const double w[10] = {.0176140071,.0406014298,.0626720483,.0832767415,.1019301198,.1181945319,.1316886384,.1420961093,.1491729864,.1527533871};
-
-  std::vector<cdouble> cr(4, cdouble(0.0,0.0));
-
-  int i1 = -nsamp;
-  int i2;
-  int j1;
-  int j2;
-
-  for(unsigned int i = 0; i != n; ++i)
+  for(unsigned int ll = l; ll <= m; ++ll)
   {
-    i1 += nsamp;
-    i2 = i1 + nsamp-1;
-    for(unsigned int j = 0; j != 10; ++j)
-    {
-      j1 = i1 + j;
-      j2 = i2 - j;
-
-      for(unsigned int ll = l; ll <= m; ++ll)
-      {
-        cr[ll] += w[j] * ( cf[ll][j1] + cf[ll][j2] );
-      }
-    }
-  }
-
-  for(unsigned int i = 0; i != 4; ++i)
-  {
-    cres[i] = cr[i] * 0.5 * (b-a) / static_cast<double>(n);
+    cres[ll] = GLSum(kWGL20, kNGL20, a, b, n, nsamp, &cf[ll][0]);
   }
 }
 //-----------------------------------------------------------------------------------------------------------
@@ -127,58 +134,14 @@ void integrationtools::RG202D(const double a, const double b, unsigned int n, un
 void integrationtools::SG48R(const double a, const double b, const unsigned int n, const unsigned int nsamp,
            double* x, unsigned int& np, double* /*w*/)
 {
-  static const double y[24] = {0.9987710072, 0.9935301722, 0.9841245873, 0.9705915925, 0.9529877031,
-   0.9313866907, 0.9058791367, 0.8765720202, 0.8435882616, 0.8070662040, 0.7671590325, 0.7240341309,
-   0.6778723796, 0.6288673967, 0.5772247260, 0.5231609747, 0.4669029047, 0.4086864819, 0.3487558862,
-   0.2873624873, 0.2247637903, 0.1612223560, 0.0970046992, 0.0323801709};
   np = 48 * n;
-  double dint = (b - a) / double(n);
-  double delt = dint * 0.5;
-  double orig = a - delt;
-  int i1 = -nsamp;
-  int i2, j1, j2;
-  double dorig;
-  for(unsigned int i = 1; i <= n; i++)
-  {
-    orig += dint;
-    dorig = orig + orig;
-    i1 += nsamp;
-    i2 = i1 + nsamp+1;
-    for(unsigned int j = 1; j <= 24; j++)
-    {
-      j1 = i1 + j;
-      j2 = i2 - j;
-      x[j1-1] = orig - delt * y[j-1];
-      x[j2-1] = dorig - x[j1-1];
-    }
-  }
+  GLPoints(kYGL48, kNGL48, a, b, n, nsamp, x);
 }
 //-----------------------------------------------------------------------------------------------------------
 // Gaussian-Legendre integration of the function defined by CF
 cdouble integrationtools::RG481D(const double A, const double B, const unsigned int N, const unsigned int nsamp, const cdouble CF[])
 {
-  // Gaussian-Legendre integration of the function defined by CF
-  static const double W[24] = {0.0031533460, 0.0073275539, 0.0114772345, 0.0155793157, 0.0196161604,
-   0.0235707608, 0.0274265097, 0.0311672278, 0.0347772225, 0.0382413510, 0.0415450829, 0.0446745608,
-   0.0476166584, 0.0503590355, 0.0528901894, 0.0551995036, 0.0572772921, 0.0591148396, 0.0607044391,
-   0.0620394231, 0.0631141922, 0.0639242385, 0.0644661644, 0.0647376968 };
-  cdouble CR(0.0, 0.0);
-  int I1 = -nsamp;
-  int I2, J1, J2;
-  for(unsigned int i = 1; i <= N; ++i)
-  {
-    I1 += nsamp;
-    I2 = I1 + nsamp+1;
-    for(unsigned int j = 1; j <= 24; ++j)
-    {
-      J1 = I1 + j;
-      J2 = I2 - j;
-      CR += W[j-1] * (CF[J1-1]+CF[J2-1]);
-    }
-  }
-  //CRES=CR*0.5*(B-A)/float(N)
-  cdouble CRES = CR*0.5*(B-A)/Double_t(N);
-  return CRES;
+  return GLSum(kWGL48, kNGL48, A, B, N, nsamp, CF);
 }
 //-----------------------------------------------------------------------------------------------------------
 // Gaussian-Legendre integration of the function defined by CF
@@ -189,37 +152,9 @@ void integrationtools::RG482D(const double a, const double b, unsigned int n, un
   // This is a fast integrator based on a Gauss-Legendre method. This only support two-dimensional integration
   n = 2; l = 0; m = 3;
 
-  static const double w[24] = {0.0031533460, 0.0073275539, 0.0114772345, 0.0155793157, 0.0196161604,
-   0.0235707608, 0.0274265097, 0.0311672278, 0.0347772225, 0.0382413510, 0.0415450829, 0.0446745608,
-   0.0476166584, 0.0503590355, 0.0528901894, 0.0551995036, 0.0572772921, 0.0591148396, 0.0607044391,
-   0.0620394231, 0.0631141922, 0.0639242385, 0.0644661644, 0.0647376968 };
-
-  std::vector<cdouble> cr(4, cdouble(0.0,0.0));
-
-  int i1 = -nsamp;
-  int i2;
-  int j1;
-  int j2;
-
-  for(unsigned int i = 0; i != n; ++i)
+  for(unsigned int ll = l; ll <= m; ++ll)
   {
-    i1 += nsamp;
-    i2 = i1 + nsamp-1;
-    for(unsigned int j = 0; j != 24; ++j)
-    {
-      j1 = i1 + j;
-      j2 = i2 - j;
-
-      for(unsigned int ll = l; ll <= m; ++ll)
-      {
-        cr[ll] += w[j] * ( cf[ll][j1] + cf[ll][j2] );
-      }
-    }
-  }
-
-  for(unsigned int i = 0; i != 4; ++i)
-  {
-    cres[i] = cr[i] * 0.5 * (b-a) / static_cast<double>(n);
+    cres[ll] = GLSum(kWGL48, kNGL48, a, b, n, nsamp, &cf[ll][0]);
   }
 }
 
@@ -270,5 +205,19 @@ void integrationtools::RGN2D (const double a, const double b, unsigned int n, un
   }
 }
 
+//______________________________________________________________________
+// Integrates a batch integrand: all the evaluation points are computed first
+// and passed to the integrand in a single call
+cdouble integrationtools::IntegrateGLN1D(const double a, const double b, const unsigned int n,
+              const unsigned int nsamp, BatchIntegrand_t integrand)
+{
+  std::vector<double>  x (n * nsamp);
+  std::vector<cdouble> cf(n * nsamp);
+  unsigned int np = 0;
+  integrationtools::SGNR(a, b, n, nsamp, &x[0], np, 0);
+  integrand(np, &x[0], &cf[0]);
+  return integrationtools::RGN1D(a, b, n, nsamp, &cf[0]);
+}
+
 } // alvarezruso namespace
 } // genie namespace
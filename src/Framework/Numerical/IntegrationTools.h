@@ -20,6 +20,7 @@
 
 #include <vector>
 #include <complex>
+#include <functional>
 
 namespace genie {
 namespace alvarezruso {
@@ -43,6 +44,15 @@ namespace integrationtools
               unsigned int m, std::vector< std::vector<std::complex<double> > >& cf,
               const unsigned int nsamp, std::vector<std::complex<double> >& cres);
 
+  // Batch integrand: fills f[i] = f(x[i]) for all the np evaluation points
+  typedef std::function<void (const unsigned int np, const double * x,
+                              std::complex<double> * f)> BatchIntegrand_t;
+
+  // Gauss-Legendre (nsamp = 20 or 48 points) integration of a batch integrand
+  // over n sub-intervals of [a,b], evaluated with a single integrand call
+  std::complex<double>  IntegrateGLN1D (const double a, const double b, const unsigned int n,
+              const unsigned int nsamp, BatchIntegrand_t integrand);
+
 } // IntegrationTools namespace
 } // alvarezruso namespace
 } // genie namespace
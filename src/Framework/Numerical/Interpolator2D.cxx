@@ -10,6 +10,7 @@
 
 #include <cassert>
 #include <cstdlib>
+#include <mutex>
 
 #include "Framework/Numerical/Interpolator2D.h"
 #include "gsl/gsl_version.h"
@@ -25,87 +26,103 @@ using namespace genie;
 struct Interpolator2D::spline2d_container
 {
   spline2d_container() : spl(NULL) {};
-  ~spline2d_container() { if (spl) delete spl; };
+  ~spline2d_container() { if (spl) gsl_spline2d_free(spl); };
   gsl_spline2d * spl;
 };
 //____________________________________________________________________________
 struct Interpolator2D::interp_accel_container
 {
-  interp_accel_container() : acc(NULL) {};
-  ~interp_accel_container() { if (acc) delete acc; };
+  interp_accel_container() : acc(gsl_interp_accel_alloc()) {};
+  ~interp_accel_container() { if (acc) gsl_interp_accel_free(acc); };
   gsl_interp_accel * acc;
 };
 //____________________________________________________________________________
 
 // Now define our actual code (GSL)
 //____________________________________________________________________________
+Interpolator2D::Accelerator::Accelerator() :
+  fAcc_x  (new Interpolator2D::interp_accel_container() ),
+  fAcc_y  (new Interpolator2D::interp_accel_container() )
+{
+
+}
+//____________________________________________________________________________
+Interpolator2D::Accelerator::~Accelerator()
+{
+  if (fAcc_x) delete fAcc_x;
+  if (fAcc_y) delete fAcc_y;
+}
+//____________________________________________________________________________
+void Interpolator2D::Accelerator::Reset(void)
+{
+  gsl_interp_accel_reset(fAcc_x->acc);
+  gsl_interp_accel_reset(fAcc_y->acc);
+}
+//____________________________________________________________________________
 Interpolator2D::Interpolator2D(
   const size_t & size_x, const double * grid_x,
   const size_t & size_y, const double * grid_y,
   const double * knots) :
-  fSpline (new Interpolator2D::spline2d_container()     ),
-  fAcc_x  (new Interpolator2D::interp_accel_container() ),
-  fAcc_y  (new Interpolator2D::interp_accel_container() )
+  fSpline (new Interpolator2D::spline2d_container()     )
 {
   fSpline->spl = gsl_spline2d_alloc(gsl_interp2d_bilinear,size_x,size_y);
   gsl_spline2d_init(fSpline->spl,grid_x,grid_y,knots,size_x,size_y);
-  fAcc_x->acc = gsl_interp_accel_alloc();
-  fAcc_y->acc = gsl_interp_accel_alloc();
 }
 //____________________________________________________________________________
 Interpolator2D::~Interpolator2D()
 {
   if (fSpline) delete fSpline;
-  if (fAcc_x ) delete fAcc_x;
-  if (fAcc_y ) delete fAcc_y;
 }
 //____________________________________________________________________________
+// Without accelerators, GSL locates the grid cell using a binary search and
+// the evaluation does not modify any state.
+//____________________________________________________________________________
 double Interpolator2D::Eval(const double & x, const double & y) const
+{
+  return gsl_spline2d_eval(fSpline->spl, x, y, NULL, NULL);
+}
+//____________________________________________________________________________
+double Interpolator2D::Eval(
+  const double & x, const double & y, Accelerator & acc) const
 {
   return gsl_spline2d_eval(
     fSpline->spl, x, y,
-    fAcc_x->acc,
-    fAcc_y->acc);
+    acc.fAcc_x->acc,
+    acc.fAcc_y->acc);
+}
+//____________________________________________________________________________
+void Interpolator2D::EvalBatch(
+  size_t n, const double * x, const double * y, double * z) const
+{
+  Accelerator acc;
+  for (size_t i = 0; i < n; i++) {
+    z[i] = this->Eval(x[i], y[i], acc);
+  }
 }
 //____________________________________________________________________________
 double Interpolator2D::DerivX(const double & x, const double & y) const
 {
-  return gsl_spline2d_eval_deriv_x(
-    fSpline->spl, x, y,
-    fAcc_x->acc,
-    fAcc_y->acc);
+  return gsl_spline2d_eval_deriv_x(fSpline->spl, x, y, NULL, NULL);
 }
 //____________________________________________________________________________
 double Interpolator2D::DerivY(const double & x, const double & y) const
 {
-  return gsl_spline2d_eval_deriv_y(
-    fSpline->spl, x, y,
-    fAcc_x->acc,
-    fAcc_y->acc);
+  return gsl_spline2d_eval_deriv_y(fSpline->spl, x, y, NULL, NULL);
 }
 //____________________________________________________________________________
 double Interpolator2D::DerivXX(const double & x, const double & y) const
 {
-  return gsl_spline2d_eval_deriv_xx(
-    fSpline->spl, x, y,
-    fAcc_x->acc,
-    fAcc_y->acc);
+  return gsl_spline2d_eval_deriv_xx(fSpline->spl, x, y, NULL, NULL);
 }
 //____________________________________________________________________________
 double Interpolator2D::DerivXY(const double & x, const double & y) const
 {
-  return gsl_spline2d_eval_deriv_xy(
-    fSpline->spl, x, y,
-    fAcc_x->acc,
-    fAcc_y->acc);
+  return gsl_spline2d_eval_deriv_xy(fSpline->spl, x, y, NULL, NULL);
 }
 //____________________________________________________________________________
 double Interpolator2D::DerivYY(const double & x, const double & y) const
 {
-  return gsl_spline2d_eval_deriv_yy(
-    fSpline->spl, x, y,
-    fAcc_x->acc,
-    fAcc_y->acc);
+  return gsl_spline2d_eval_deriv_yy(fSpline->spl, x, y, NULL, NULL);
 }
 //____________________________________________________________________________
 //____________________________________________________________________________
@@ -127,15 +144,33 @@ struct Interpolator2D::interp_accel_container
   ~interp_accel_container() { };
 };
 //____________________________________________________________________________
+// TGraph2D::Interpolate() modifies the graph: serialize the evaluations
+static std::mutex gTGraph2DMutex;
+//____________________________________________________________________________
 // Now define our actual code (TGraph2D)
 //____________________________________________________________________________
+Interpolator2D::Accelerator::Accelerator() :
+  fAcc_x  (NULL),
+  fAcc_y  (NULL)
+{
+
+}
+//____________________________________________________________________________
+Interpolator2D::Accelerator::~Accelerator()
+{
+
+}
+//____________________________________________________________________________
+void Interpolator2D::Accelerator::Reset(void)
+{
+
+}
+//____________________________________________________________________________
 Interpolator2D::Interpolator2D(
   const size_t & size_x, const double * grid_x,
   const size_t & size_y, const double * grid_y,
   const double * knots) :
-  fSpline (new spline2d_container()),
-  fAcc_x  (NULL),
-  fAcc_y  (NULL)
+  fSpline (new spline2d_container())
 {
   fSpline->spl = new TGraph2D(size_x*size_y);
   fSpline->spl->SetDirectory(0);
@@ -151,15 +186,29 @@ Interpolator2D::Interpolator2D(
 Interpolator2D::~Interpolator2D()
 {
   if (fSpline) delete fSpline;
-  if (fAcc_x ) delete fAcc_x;
-  if (fAcc_y ) delete fAcc_y;
 }
 //____________________________________________________________________________
 double Interpolator2D::Eval(const double & x, const double & y) const
 {
+  std::lock_guard<std::mutex> lock(gTGraph2DMutex);
   return fSpline->spl->Interpolate(x,y);
 }
 //____________________________________________________________________________
+double Interpolator2D::Eval(
+  const double & x, const double & y, Accelerator & /*acc*/) const
+{
+  return this->Eval(x,y);
+}
+//____________________________________________________________________________
+void Interpolator2D::EvalBatch(
+  size_t n, const double * x, const double * y, double * z) const
+{
+  std::lock_guard<std::mutex> lock(gTGraph2DMutex);
+  for (size_t i = 0; i < n; i++) {
+    z[i] = fSpline->spl->Interpolate(x[i],y[i]);
+  }
+}
+//____________________________________________________________________________
 double Interpolator2D::DerivX(const double & x, const double & y) const
 {
   assert(!"Method requires GSL version 2 or higher.");
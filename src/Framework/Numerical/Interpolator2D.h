@@ -7,6 +7,12 @@
           If GSL version is not sufficient, does an inefficient version
           using TGraph2D.
 
+          The interpolator holds no evaluation state: Eval() and the
+          derivatives can be called concurrently from several threads, all
+          sharing the same copy of the table. Callers making many locally
+          coherent queries can speed up the grid search by passing their own
+          (e.g. per thread) Accelerator object, or use EvalBatch().
+
 \author   Steve Dennis <s.r.dennis \at liverpool.ac.uk>
           University of Liverpool
 
@@ -26,13 +32,35 @@ namespace genie {
 
 class Interpolator2D
 {
+  private:
+    // Done using PIMPL to avoid GSL vs ROOT mess in libraries
+    // Struct type declarations will be done in object code
+    struct spline2d_container    ; // stores type gsl_spline2d
+    struct interp_accel_container; // stores type gsl_interp_accel
+
   public:
+    // Grid search accelerator. Not thread-safe: use one per thread.
+    class Accelerator
+    {
+      public:
+        Accelerator();
+       ~Accelerator();
+        void Reset (void);
+      private:
+        Accelerator(const Accelerator &);
+        friend class Interpolator2D;
+        interp_accel_container * fAcc_x;
+        interp_accel_container * fAcc_y;
+    };
+
     Interpolator2D(const size_t & size_x, const double * grid_x,
                    const size_t & size_y, const double * grid_y,
                    const double * knots);
     ~Interpolator2D();
 
     double Eval    (const double & x, const double & y) const;
+    double Eval    (const double & x, const double & y, Accelerator & acc) const;
+    void   EvalBatch (size_t n, const double * x, const double * y, double * z) const;
     double DerivX  (const double & x, const double & y) const;
     double DerivY  (const double & x, const double & y) const;
     double DerivXX (const double & x, const double & y) const;
@@ -40,14 +68,8 @@ class Interpolator2D
     double DerivYY (const double & x, const double & y) const;
 
   private:
-    // Done using PIMPL to avoid GSL vs ROOT mess in libraries
-    // Struct type declarations will be done in object code
-    struct spline2d_container    ; // stores type gsl_spline2d
-    struct interp_accel_container; // stores type gsl_interp_accel
     // And these are our actual members
-    spline2d_container             * fSpline;
-    mutable interp_accel_container * fAcc_x;
-    mutable interp_accel_container * fAcc_y;
+    spline2d_container * fSpline;
 };
 
 } // namespace genie
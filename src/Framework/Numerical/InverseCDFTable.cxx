@@ -0,0 +1,97 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <cmath>
+#include <algorithm>
+
+#include "Framework/Numerical/InverseCDFTable.h"
+
+using std::vector;
+using namespace genie;
+
+//____________________________________________________________________________
+InverseCDFTable::InverseCDFTable() :
+fXMin(0),
+fDX(0)
+{
+
+}
+//____________________________________________________________________________
+InverseCDFTable::InverseCDFTable(
+    const PDF_t & pdf, double xmin, double xmax, int n) :
+fXMin(0),
+fDX(0)
+{
+  this->Build(pdf, xmin, xmax, n);
+}
+//____________________________________________________________________________
+InverseCDFTable::~InverseCDFTable()
+{
+
+}
+//____________________________________________________________________________
+bool InverseCDFTable::Build(
+    const PDF_t & pdf, double xmin, double xmax, int n)
+{
+  fPDF.clear();
+  fCDF.clear();
+
+  if(n < 2 || xmax <= xmin) return false;
+
+  double dx = (xmax - xmin) / (n-1);
+
+  vector<double> f(n), F(n);
+  for(int i = 0; i < n; i++) {
+    f[i] = std::max(0., pdf(xmin + i*dx));
+  }
+  F[0] = 0;
+  for(int i = 1; i < n; i++) {
+    F[i] = F[i-1] + 0.5 * (f[i-1] + f[i]) * dx;
+  }
+  double norm = F[n-1];
+  if(! (norm > 0)) return false;
+
+  for(int i = 0; i < n; i++) {
+    f[i] /= norm;
+    F[i] /= norm;
+  }
+  F[n-1] = 1.;
+
+  fXMin = xmin;
+  fDX   = dx;
+  fPDF.swap(f);
+  fCDF.swap(F);
+  return true;
+}
+//____________________________________________________________________________
+double InverseCDFTable::Sample(double u) const
+{
+  // interval [i, i+1] with fCDF[i] <= u < fCDF[i+1]
+  int n = fCDF.size();
+  int i = std::upper_bound(fCDF.begin(), fCDF.end(), u) - fCDF.begin() - 1;
+  i = std::min(std::max(i, 0), n-2);
+
+  // invert the quadratic CDF in the interval, in t = (x-xi)/dx in [0,1]:
+  // dx * (f0 t + (f1-f0) t^2 / 2) = u - F0
+  double f0 = fPDF[i];
+  double f1 = fPDF[i+1];
+  double r  = (u - fCDF[i]) / fDX;
+  double t  = 0;
+  double df = f1 - f0;
+  if(std::abs(df) < 1E-9 * (f0 + f1)) {
+    t = (f0 > 0) ? r / f0 : 0.5;
+  } else {
+    t = (std::sqrt(std::max(0., f0*f0 + 2*df*r)) - f0) / df;
+  }
+  t = std::min(std::max(t, 0.), 1.);
+
+  return fXMin + (i + t) * fDX;
+}
+//____________________________________________________________________________
@@ -0,0 +1,64 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::InverseCDFTable
+
+\brief    Tabulated inverse CDF for sampling a continuous 1-D distribution.
+
+          The (unnormalised) pdf is evaluated once on n equidistant nodes in
+          [xmin, xmax] and taken as piecewise linear in between, so that its
+          cumulative distribution is known exactly at the nodes and is a
+          quadratic within each interval. Each draw then takes one uniform
+          random number, a binary search in the CDF and the solution of a
+          quadratic, with no allocation. Tables are read-only once built and
+          can be shared by threads.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _INVERSE_CDF_TABLE_H_
+#define _INVERSE_CDF_TABLE_H_
+
+#include <functional>
+#include <vector>
+
+namespace genie {
+
+class InverseCDFTable {
+
+public:
+  typedef std::function<double (double)> PDF_t;
+
+  InverseCDFTable();
+  InverseCDFTable(const PDF_t & pdf, double xmin, double xmax, int n = 1000);
+ ~InverseCDFTable();
+
+  //! Tabulates the input pdf on n nodes in [xmin, xmax]. Negative pdf values
+  //! are taken as 0. Returns false (and leaves the table empty) if the pdf
+  //! integrates to zero.
+  bool Build (const PDF_t & pdf, double xmin, double xmax, int n = 1000);
+
+  //! Returns x in [xmin, xmax], for u uniformly distributed in [0,1)
+  double Sample (double u) const;
+
+  double XMin    (void) const { return fXMin; }
+  double XMax    (void) const { return fXMin + (fCDF.size()-1) * fDX; }
+  bool   IsEmpty (void) const { return fCDF.empty(); }
+
+private:
+  double              fXMin;   ///< first node
+  double              fDX;     ///< node spacing
+  std::vector<double> fPDF;    ///< pdf at the nodes, normalised to 1
+  std::vector<double> fCDF;    ///< CDF at the nodes
+};
+
+}      // genie namespace
+
+#endif // _INVERSE_CDF_TABLE_H_
@@ -12,6 +12,8 @@
 
 #include <TSystem.h>
 #include <TPythia6.h>
+#include <TDirectory.h>
+#include <TVectorD.h>
 
 #include "Framework/Conventions/Controls.h"
 #include "Framework/Messenger/Messenger.h"
@@ -22,14 +24,18 @@ using namespace genie::controls;
 namespace genie {
 
 //____________________________________________________________________________
-RandomGen * RandomGen::fInstance = 0;
+thread_local RandomGen * RandomGen::fInstance = 0;
 //____________________________________________________________________________
 RandomGen::RandomGen()
 {
   LOG("Rndm", pINFO) << "RandomGen late initialization";
 
-  fInitalized = false;
-  fInstance = 0;
+  fInitalized         = false;
+  fInstance           = 0;
+  fRandom3            = 0;
+  fEventNumber        = 0;
+  fIndependentStreams = false;
+  for(int i = 0; i < kNRndStreams; i++) fStream[i] = 0;
 /*
   // try to get this job's random number seed from the environment
   const char * seed = gSystem->Getenv("GSEED");
@@ -65,13 +71,14 @@ RandomGen::RandomGen()
 RandomGen::~RandomGen()
 {
   fInstance = 0;
+  this->DeleteStreams();
   if(fRandom3) delete fRandom3;
 }
 //____________________________________________________________________________
 RandomGen * RandomGen::Instance()
 {
   if(fInstance == 0) {
-    static RandomGen::Cleaner cleaner;
+    static thread_local RandomGen::Cleaner cleaner;
     cleaner.DummyMethodAndSilentCompiler();
 
     fInstance = new RandomGen;
@@ -79,6 +86,12 @@ RandomGen * RandomGen::Instance()
   return fInstance;
 }
 //____________________________________________________________________________
+std::recursive_mutex & RandomGen::Pythia6Mutex(void)
+{
+  static std::recursive_mutex mutex;
+  return mutex;
+}
+//____________________________________________________________________________
 void RandomGen::SetSeed(long int seed)
 {
   LOG("Rndm", pNOTICE)
@@ -88,23 +101,30 @@ void RandomGen::SetSeed(long int seed)
      << ((fInitalized) ? ": " : " at random number generator initialization: ")
      << seed;
 
+  fCurrSeed = seed;
+
   // Set the seed number for all internal GENIE random number generators
-  this->RndKine ().SetSeed(seed);
-  this->RndHadro().SetSeed(seed);
-  this->RndDec  ().SetSeed(seed);
-  this->RndFsi  ().SetSeed(seed);
-  this->RndLep  ().SetSeed(seed);
-  this->RndISel ().SetSeed(seed);
-  this->RndGeom ().SetSeed(seed);
-  this->RndFlux ().SetSeed(seed);
-  this->RndEvg  ().SetSeed(seed);
-  this->RndNum  ().SetSeed(seed);
-  this->RndGen  ().SetSeed(seed);
+  // (for independent streams, the run seed is only part of the stream key)
+  if(fIndependentStreams) this->ReseedStreams();
+  else {
+    this->RndKine ().SetSeed(seed);
+    this->RndHadro().SetSeed(seed);
+    this->RndDec  ().SetSeed(seed);
+    this->RndFsi  ().SetSeed(seed);
+    this->RndLep  ().SetSeed(seed);
+    this->RndISel ().SetSeed(seed);
+    this->RndGeom ().SetSeed(seed);
+    this->RndFlux ().SetSeed(seed);
+    this->RndEvg  ().SetSeed(seed);
+    this->RndNum  ().SetSeed(seed);
+    this->RndGen  ().SetSeed(seed);
+  }
 
   // Set the seed number for ROOT's gRandom
   gRandom ->SetSeed (seed);
 
   // Set the PYTHIA6 seed number
+  std::lock_guard<std::recursive_mutex> lock(RandomGen::Pythia6Mutex());
   TPythia6 * pythia6 = TPythia6::Instance();
   pythia6->SetMRPY(1, seed);
 
@@ -123,9 +143,152 @@ void RandomGen::SetSeed(long int seed)
   LOG("Rndm", pINFO) << "PYTHIA6  seed = " << pythia6->GetMRPY(1);
 }
 //____________________________________________________________________________
+void RandomGen::UseIndependentStreams(bool on)
+{
+  if(on == fIndependentStreams) return;
+
+  LOG("Rndm", pNOTICE)
+     << "Using " << ((on) ? "independent (keyed)" : "a single shared")
+     << " random number stream" << ((on) ? "s per module" : "");
+
+  this->DeleteStreams();
+  fIndependentStreams = on;
+  for(int i = 0; i < kNRndStreams; i++) {
+    fStream[i] = (on) ? new TRandom3() : fRandom3;
+  }
+  if(on) this->ReseedStreams();
+  else fRandom3->SetSeed(fCurrSeed);
+}
+//____________________________________________________________________________
+void RandomGen::SetEventNumber(long int ievent)
+{
+// Re-key all independent streams for the input event. Has no effect on the
+// (default) single shared stream.
+
+  fEventNumber = ievent;
+  if(fIndependentStreams) this->ReseedStreams();
+}
+//____________________________________________________________________________
+UInt_t RandomGen::StreamSeed(RndStream_t stream) const
+{
+// Derive the seed of the input stream from the key (run seed, event number,
+// stream id). Each key component is folded in through the SplitMix64 finalizer
+// so that neighbouring keys give statistically unrelated seeds. A zero seed is
+// avoided as TRandom3 would then seed itself from the machine state.
+
+  ULong64_t key[3] = {
+    (ULong64_t) fCurrSeed, (ULong64_t) fEventNumber, (ULong64_t) stream };
+
+  ULong64_t h = 0x9E3779B97F4A7C15ULL;
+  for(int i = 0; i < 3; i++) {
+    h ^= key[i];
+    h += 0x9E3779B97F4A7C15ULL;
+    h  = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    h  = (h ^ (h >> 27)) * 0x94D049BB133111EBULL;
+    h  =  h ^ (h >> 31);
+  }
+  UInt_t seed = (UInt_t) (h ^ (h >> 32));
+  return (seed == 0) ? 1 : seed;
+}
+//____________________________________________________________________________
+bool RandomGen::SaveState(TDirectory * dir) const
+{
+// Write the state of all generators in the input directory. The Mersenne
+// Twister state is written by streaming out the TRandom3 objects; the
+// PYTHIA6 generator state (MRPY, RRPY) and the stream keys go in a vector.
+
+  if(!dir) return false;
+  TDirectory * prevdir = gDirectory;
+  dir->cd();
+
+  int nstreams = (fIndependentStreams) ? kNRndStreams : 1;
+  for(int i = 0; i < nstreams; i++) {
+    fStream[i]->Write(Form("rnd_stream_%d", i), TObject::kOverwrite);
+  }
+  gRandom->Write("rnd_groot", TObject::kOverwrite);
+
+  std::lock_guard<std::recursive_mutex> lock(RandomGen::Pythia6Mutex());
+  TPythia6 * pythia6 = TPythia6::Instance();
+  TVectorD state(4+6+100);
+  state[0] = fCurrSeed;
+  state[1] = fEventNumber;
+  state[2] = (fIndependentStreams) ? 1 : 0;
+  state[3] = nstreams;
+  for(int i = 0; i <   6; i++) state[4+i]  = pythia6->GetMRPY(i+1);
+  for(int i = 0; i < 100; i++) state[10+i] = pythia6->GetRRPY(i+1);
+  state.Write("rnd_state", TObject::kOverwrite);
+
+  prevdir->cd();
+  return true;
+}
+//____________________________________________________________________________
+bool RandomGen::RestoreState(TDirectory * dir)
+{
+  if(!dir) return false;
+
+  TVectorD * state = (TVectorD*) dir->Get("rnd_state");
+  if(!state) {
+    LOG("Rndm", pERROR) << "No random number generator state found";
+    return false;
+  }
+
+  fCurrSeed = (long int) (*state)[0];
+  this->UseIndependentStreams( (*state)[2] > 0 );
+  fEventNumber = (long int) (*state)[1];
+
+  int nstreams = (int) (*state)[3];
+  for(int i = 0; i < nstreams; i++) {
+    TRandom3 * saved = (TRandom3*) dir->Get(Form("rnd_stream_%d", i));
+    if(!saved) {
+      LOG("Rndm", pERROR) << "Missing saved state for rnd stream " << i;
+      delete state;
+      return false;
+    }
+    *fStream[i] = *saved;
+    delete saved;
+  }
+  TRandom3 * groot = dynamic_cast<TRandom3*> (gRandom);
+  TRandom3 * saved_groot = (TRandom3*) dir->Get("rnd_groot");
+  if(groot && saved_groot) *groot = *saved_groot;
+  delete saved_groot;
+
+  {
+    std::lock_guard<std::recursive_mutex> lock(RandomGen::Pythia6Mutex());
+    TPythia6 * pythia6 = TPythia6::Instance();
+    for(int i = 0; i <   6; i++) pythia6->SetMRPY(i+1, (int) (*state)[4+i]);
+    for(int i = 0; i < 100; i++) pythia6->SetRRPY(i+1, (*state)[10+i]);
+  }
+
+  delete state;
+
+  LOG("Rndm", pNOTICE)
+     << "Restored random number generator state (seed: " << fCurrSeed
+     << ", event: " << fEventNumber << ")";
+  return true;
+}
+//____________________________________________________________________________
+void RandomGen::ReseedStreams(void)
+{
+  for(int i = 0; i < kNRndStreams; i++) {
+    fStream[i]->SetSeed( this->StreamSeed((RndStream_t)i) );
+  }
+  LOG("Rndm", pDEBUG)
+     << "Re-keyed independent rnd streams for (seed, event) = ("
+     << fCurrSeed << ", " << fEventNumber << ")";
+}
+//____________________________________________________________________________
+void RandomGen::DeleteStreams(void)
+{
+  for(int i = 0; i < kNRndStreams; i++) {
+    if(fStream[i] && fStream[i] != fRandom3) delete fStream[i];
+    fStream[i] = 0;
+  }
+}
+//____________________________________________________________________________
 void RandomGen::InitRandomGenerators(long int seed)
 {
   fRandom3 = new TRandom3();
+  for(int i = 0; i < kNRndStreams; i++) fStream[i] = fRandom3;
   this->SetSeed(seed);
 }
 //____________________________________________________________________________
@@ -22,15 +22,38 @@
 #ifndef _RANDOM_GEN_H_
 #define _RANDOM_GEN_H_
 
+#include <mutex>
+
 #include <TRandom3.h>
 
+class TDirectory;
+
 namespace genie {
 
 class RandomGen {
 
 public:
 
-  //! Access instance
+  //! Identifiers of the random number streams used by the various GENIE modules
+  typedef enum ERndStream {
+    kRndStreamKine = 0,
+    kRndStreamHadro,
+    kRndStreamDec,
+    kRndStreamFsi,
+    kRndStreamLep,
+    kRndStreamISel,
+    kRndStreamGeom,
+    kRndStreamFlux,
+    kRndStreamEvg,
+    kRndStreamNum,
+    kRndStreamGen,
+    kNRndStreams
+  } RndStream_t;
+
+  //! Access instance.
+  //! Each thread gets its own instance (and its own generator state) so that
+  //! several GMCJDriver objects can generate events concurrently. Seed each
+  //! worker thread explicitly by calling SetSeed() from within that thread.
   static RandomGen * Instance();
 
   //! Random number generators used by various GENIE modules.
@@ -38,63 +61,91 @@ public:
   //!  on using several TRandom objects each with each own
   //!  "independent" run sequence).
 
-  //! At this point, since the actual random number generator
+  //! By default, since the actual random number generator
   //! periodicity is very high, all the generators are in fact one!
-  //! However, the option to use many generators is reserved.
+  //! Calling UseIndependentStreams() gives each module its own generator,
+  //! re-seeded at every SetEventNumber() call with a seed derived from the
+  //! key (run seed, event number, stream). Any event, or any single module
+  //! within an event (eg the intranuclear cascade), can then be regenerated
+  //! without replaying the rest of the job.
 
   //! Currently, the preferred generator is the "Mersenne Twister"
   //! with a periodicity of 10**6000
   //! See: http://root.cern.ch/root/html/TRandom3.html
 
   //! rnd number generator used by kinematics generators
-  TRandom3 & RndKine (void) const { return *fRandom3; }
+  TRandom3 & RndKine (void) const { return *fStream[kRndStreamKine]; }
 
   //! rnd number generator used by hadronization models
-  TRandom3 & RndHadro (void) const { return *fRandom3; }
+  TRandom3 & RndHadro (void) const { return *fStream[kRndStreamHadro]; }
 
   //! rnd number generator used by decay models
-  TRandom3 & RndDec (void) const { return *fRandom3; }
+  TRandom3 & RndDec (void) const { return *fStream[kRndStreamDec]; }
 
   //! rnd number generator used by intranuclear cascade monte carlos
-  TRandom3 & RndFsi (void) const { return *fRandom3; }
+  TRandom3 & RndFsi (void) const { return *fStream[kRndStreamFsi]; }
 
   //! rnd number generator used by final state primary lepton generators
-  TRandom3 & RndLep (void) const { return *fRandom3; }
+  TRandom3 & RndLep (void) const { return *fStream[kRndStreamLep]; }
 
   //! rnd number generator used by interaction selectors
-  TRandom3 & RndISel (void) const { return *fRandom3; }
+  TRandom3 & RndISel (void) const { return *fStream[kRndStreamISel]; }
 
   //! rnd number generator used by geometry drivers
-  TRandom3 & RndGeom (void) const { return *fRandom3; }
+  TRandom3 & RndGeom (void) const { return *fStream[kRndStreamGeom]; }
 
   //! rnd number generator used by flux drivers
-  TRandom3 & RndFlux (void) const { return *fRandom3; }
+  TRandom3 & RndFlux (void) const { return *fStream[kRndStreamFlux]; }
 
   //! rnd number generator used by the event generation drivers
-  TRandom3 & RndEvg (void) const { return *fRandom3; }
+  TRandom3 & RndEvg (void) const { return *fStream[kRndStreamEvg]; }
 
   //! rnd number generator used by MC integrators & other numerical methods
-  TRandom3 & RndNum (void) const { return *fRandom3; }
+  TRandom3 & RndNum (void) const { return *fStream[kRndStreamNum]; }
 
   //! rnd number generator for generic usage
-  TRandom3 & RndGen  (void) const { return *fRandom3; }
+  TRandom3 & RndGen  (void) const { return *fStream[kRndStreamGen]; }
+
+  //! rnd number generator for the input stream
+  TRandom3 & Rnd (RndStream_t stream) const { return *fStream[stream]; }
 
   long int GetSeed (void)         const { return fCurrSeed; }
   void     SetSeed (long int seed);
 
+  //! keyed, per-module random number streams
+  void     UseIndependentStreams   (bool on = true);
+  bool     UsingIndependentStreams (void) const { return fIndependentStreams; }
+  void     SetEventNumber          (long int ievent);
+  long int EventNumber             (void) const { return fEventNumber; }
+  UInt_t   StreamSeed              (RndStream_t stream) const;
+
+  //! save / restore the full generator state (GENIE streams, gRandom and
+  //! PYTHIA6) to / from the input directory, for job checkpointing
+  bool     SaveState    (TDirectory * dir) const;
+  bool     RestoreState (TDirectory * dir);
+
+  //! PYTHIA6 (its common blocks and its random number generator) is shared
+  //! by all threads: any code using it must hold this lock
+  static std::recursive_mutex & Pythia6Mutex (void);
+
 private:
 
   RandomGen();
   RandomGen(const RandomGen & rgen);
   virtual ~RandomGen();
 
-  static RandomGen * fInstance;
+  static thread_local RandomGen * fInstance;
 
-  TRandom3 * fRandom3;    ///< Mersenne Twistor
-  long int   fCurrSeed;   ///< random number generator seed number
-  bool       fInitalized; ///< done initializing singleton?
+  TRandom3 * fRandom3;                 ///< Mersenne Twistor
+  TRandom3 * fStream[kNRndStreams];    ///< generator used by each module (all point to fRandom3 unless independent streams are used)
+  long int   fCurrSeed;                ///< random number generator seed number
+  long int   fEventNumber;             ///< current event number (part of the key of independent streams)
+  bool       fIndependentStreams;      ///< use a separately keyed generator per module?
+  bool       fInitalized;              ///< done initializing singleton?
 
-  void InitRandomGenerators(long int seed);
+  void InitRandomGenerators (long int seed);
+  void DeleteStreams        (void);
+  void ReseedStreams        (void);
 
   struct Cleaner {
       void DummyMethodAndSilentCompiler() { }
@@ -129,7 +129,7 @@ TObject()
 }
 //___________________________________________________________________________
 Spline::Spline(const Spline & spline) :
-  TObject(), fInterpolator(0)
+  TObject(), fInterpolator(0), fFlatReady(false)
 {
   LOG("Spline", pDEBUG) << "Spline copy constructor";
 
@@ -137,7 +137,7 @@ Spline::Spline(const Spline & spline) :
 }
 //___________________________________________________________________________
 Spline::Spline(const TSpline3 & spline, int nknots) :
-  TObject(), fInterpolator(0)
+  TObject(), fInterpolator(0), fFlatReady(false)
 {
   LOG("Spline", pDEBUG)
                     << "Constructing spline from the input TSpline3 object";
@@ -364,34 +364,14 @@ double Spline::Evaluate(double x) const
   assert(!TMath::IsNaN(x));
 
   double y = 0;
-  if( this->IsWithinValidRange(x) ) {
-
-    // we can interpolate within the range of spline knots - be careful with
-    // strange cubic spline behaviour when close to knots with y=0
-    bool is0p = this->ClosestKnotValueIsZero(x, "+");
-    bool is0n = this->ClosestKnotValueIsZero(x, "-");
-
-    if(!is0p && !is0n) {
-      // both knots (on the left and right are non-zero) - just interpolate
-      LOG("Spline", pDEBUG) << "Point is between non-zero knots";
-      y = fInterpolator->Eval(x);
-    } else {
-      // at least one of the neighboring knots has y=0
-      if(is0p && is0n) {
-        // both neighboring knots have y=0
-        LOG("Spline", pDEBUG) << "Point is between zero knots";
-        y=0;
-      } else {
-        // just 1 neighboring knot has y=0 - do a linear interpolation
-        LOG("Spline", pDEBUG)
-          << "Point has zero" << (is0n ? " left " : " right ") << "knot";
-        double xpknot=0, ypknot=0, xnknot=0, ynknot=0;
-        this->FindClosestKnot(x, xnknot, ynknot, "-");
-        this->FindClosestKnot(x, xpknot, ypknot, "+");
-        if(is0n) y = ypknot * (x-xnknot)/(xpknot-xnknot);
-        else     y = ynknot * (x-xnknot)/(xpknot-xnknot);
-      }
-    }
+  if( this->IsWithinValidRange(x) && fNKnots < 2 ) {
+    y = fInterpolator->Eval(x);
+  }
+  else if( this->IsWithinValidRange(x) ) {
+
+    if(!fFlatReady) this->BuildFlatEvaluator();
+
+    y = this->EvaluateInterval(this->FindKnotInterval(x), x);
 
   } else {
     LOG("Spline", pDEBUG) << "x = " << x
@@ -409,6 +389,92 @@ double Spline::Evaluate(double x) const
   return y;
 }
 //___________________________________________________________________________
+void Spline::Evaluate(const double * x, double * y, size_t n) const
+{
+// Evaluate the spline at n points. Gives the same results as Evaluate(x[i])
+// but without the per-point bookkeeping: For increasing x the previous knot
+// interval is re-used (and the x-grid search skipped) whenever possible.
+
+  if(fNKnots > 1 && !fFlatReady) this->BuildFlatEvaluator();
+
+  int k = 0;
+  for(size_t i = 0; i < n; i++) {
+    double xi = x[i];
+    assert(!TMath::IsNaN(xi));
+    if(!this->IsWithinValidRange(xi)) {
+      y[i] = 0;
+      continue;
+    }
+    if(fNKnots < 2) {
+      y[i] = fInterpolator->Eval(xi);
+      continue;
+    }
+    if(!this->InKnotInterval(k, xi)) k = this->FindKnotInterval(xi);
+    y[i] = this->EvaluateInterval(k, xi);
+  }
+}
+//___________________________________________________________________________
+void Spline::Evaluate(
+  const Spline * const splines[], size_t nspl, double x, double * y)
+{
+  assert(!TMath::IsNaN(x));
+
+  const Spline * ref = 0; // spline whose knot interval was looked-up last
+  int k = 0;
+  for(size_t i = 0; i < nspl; i++) {
+    const Spline * spl = splines[i];
+    y[i] = 0;
+    if(!spl || !spl->IsWithinValidRange(x)) continue;
+    if(spl->fNKnots < 2) {
+      y[i] = spl->fInterpolator->Eval(x);
+      continue;
+    }
+    if(!spl->fFlatReady) spl->BuildFlatEvaluator();
+
+    bool same_grid = ref && spl->fNKnots == ref->fNKnots &&
+                     spl->InKnotInterval(k, x);
+    if(!same_grid) {
+      k   = spl->FindKnotInterval(x);
+      ref = spl;
+    }
+    y[i] = spl->EvaluateInterval(k, x);
+  }
+}
+//___________________________________________________________________________
+bool Spline::InKnotInterval(int k, double x) const
+{
+// Would FindKnotInterval(x) return k?
+
+  int n = fNKnots;
+  if(k < 0 || k > n-2) return false;
+  bool above_low  = (k == 0)   || (x >  fFlatX[k]);
+  bool below_high = (k == n-2) || (x <= fFlatX[k+1]);
+  return above_low && below_high;
+}
+//___________________________________________________________________________
+double Spline::EvaluateInterval(int k, double x) const
+{
+// Interpolate in the k-th knot interval - be careful with strange cubic
+// spline behaviour when close to knots with y=0
+
+  bool is0p = fFlatIsZero[k+1];
+  bool is0n = fFlatIsZero[k];
+
+  // both knots (on the left and right are non-zero) - just interpolate
+  if(!is0p && !is0n) {
+    double dx = x - fFlatX[k];
+    return fFlatY[k] + dx * (fFlatB[k] + dx * (fFlatC[k] + dx * fFlatD[k]));
+  }
+  // both neighboring knots have y=0
+  if(is0p && is0n) return 0;
+
+  // just 1 neighboring knot has y=0 - do a linear interpolation
+  double xnknot = fFlatX[k],   ynknot = fFlatY[k];
+  double xpknot = fFlatX[k+1], ypknot = fFlatY[k+1];
+  if(is0n) return ypknot * (x-xnknot)/(xpknot-xnknot);
+  else     return ynknot * (x-xnknot)/(xpknot-xnknot);
+}
+//___________________________________________________________________________
 void Spline::SaveAsXml(
                 string filename, string xtag, string ytag, string name) const
 {
@@ -426,7 +492,7 @@ void Spline::SaveAsXml(
 }
 //___________________________________________________________________________
 void Spline::SaveAsXml(
-    ofstream & ofs, string xtag, string ytag, string name) const
+    ofstream & ofs, string xtag, string ytag, string name, string attributes) const
 {
   string spline_name = (name.size()>0 ? name : fName);
 
@@ -434,7 +500,9 @@ void Spline::SaveAsXml(
   int nknots = this->NKnots();
   string padding = "    ";
   ofs << padding << "<spline name=\"" << spline_name
-      << "\" nknots=\"" << nknots << "\">" << endl;
+      << "\" nknots=\"" << nknots << "\"";
+  if(attributes.size() > 0) ofs << " " << attributes;
+  ofs << ">" << endl;
 
   // start printing the knots
   double x=0, y=0;
@@ -559,6 +627,21 @@ bool Spline::ClosestKnotValueIsZero(double x, Option_t * opt) const
   return false;
 }
 //___________________________________________________________________________
+size_t Spline::MemoryFootprint(void) const
+{
+// Approximate memory held by the spline: the object itself, its TSpline3
+// interpolator & knots and the flat evaluation arrays
+
+  size_t bytes = sizeof(Spline) + fName.capacity();
+  if(fInterpolator) {
+    bytes += sizeof(TSpline3) + fNKnots * sizeof(TSplinePoly3);
+  }
+  bytes += sizeof(double) * ( fFlatX.capacity() + fFlatY.capacity() +
+             fFlatB.capacity() + fFlatC.capacity() + fFlatD.capacity() );
+  bytes += fFlatIsZero.capacity();
+  return bytes;
+}
+//___________________________________________________________________________
 void Spline::Print(ostream & stream) const
 {
   int    nknots = this->NKnots();
@@ -726,6 +809,8 @@ void Spline::InitSpline(void)
 
   fYCanBeNegative = false;
 
+  fFlatReady = false;
+
   LOG("Spline", pDEBUG) << "...done initializing spline";
 }
 //___________________________________________________________________________
@@ -751,6 +836,83 @@ void Spline::BuildSpline(int nentries, double x[], double y[])
 
   fInterpolator = new TSpline3("spl3", x, y, nentries, "0");
 
+  fFlatReady = false;
+  if(nentries > 1) this->BuildFlatEvaluator();
+
   LOG("Spline", pDEBUG) << "...done building spline";
 }
 //___________________________________________________________________________
+void Spline::BuildFlatEvaluator(void) const
+{
+// Copy the TSpline3 knots & cubic coefficients into contiguous arrays and
+// work out whether knot intervals can be looked-up without a binary search
+
+  int n = fNKnots;
+
+  fFlatX.resize(n);
+  fFlatY.resize(n);
+  fFlatB.resize(n);
+  fFlatC.resize(n);
+  fFlatD.resize(n);
+  fFlatIsZero.resize(n);
+
+  for(int i = 0; i < n; i++) {
+    fInterpolator->GetCoeff(i, fFlatX[i], fFlatY[i],
+                               fFlatB[i], fFlatC[i], fFlatD[i]);
+    fFlatIsZero[i] = utils::math::AreEqual(fFlatY[i], 0) ? 1 : 0;
+  }
+
+  // check for uniform knot spacing in x, or in log(x): the lookup is then
+  // only used as a first guess, corrected against the knots themselves
+  fFlatLookup = 0;
+  fFlatU0     = 0;
+  fFlatInvDU  = 0;
+  for(int mode = 1; mode <= 2 && fFlatLookup == 0; mode++) {
+    if(mode == 2 && fFlatX[0] <= 0) break;
+    double u0 = (mode == 1) ? fFlatX[0]   : TMath::Log(fFlatX[0]);
+    double u1 = (mode == 1) ? fFlatX[n-1] : TMath::Log(fFlatX[n-1]);
+    double du = (u1 - u0) / (n - 1);
+    if(du <= 0) continue;
+    bool uniform = true;
+    for(int i = 1; i < n-1 && uniform; i++) {
+      double u = (mode == 1) ? fFlatX[i] : TMath::Log(fFlatX[i]);
+      uniform = TMath::Abs(u - (u0 + i*du)) < 1E-3 * du;
+    }
+    if(uniform) {
+      fFlatLookup = mode;
+      fFlatU0     = u0;
+      fFlatInvDU  = 1./du;
+    }
+  }
+
+  fFlatReady = true;
+}
+//___________________________________________________________________________
+int Spline::FindKnotInterval(double x) const
+{
+// Returns k in [0, NKnots-2] so that the x is in (x[k], x[k+1]], selecting
+// the same interval as TSpline3::FindX() for points inside the spline range
+
+  int n = fNKnots;
+  if(x <= fFlatX[0])   return 0;
+  if(x >= fFlatX[n-1]) return n-2;
+
+  int k = 0;
+  if(fFlatLookup == 0) {
+    int khigh = n-1;
+    while(khigh - k > 1) {
+      int khalf = (k + khigh) / 2;
+      if(x > fFlatX[khalf]) k = khalf;
+      else                  khigh = khalf;
+    }
+    return k;
+  }
+
+  double u = (fFlatLookup == 1) ? x : TMath::Log(x);
+  k = (int) ((u - fFlatU0) * fFlatInvDU);
+  k = TMath::Max(0, TMath::Min(k, n-2));
+  while(k > 0   && x <= fFlatX[k]  ) k--;
+  while(k < n-2 && x >  fFlatX[k+1]) k++;
+  return k;
+}
+//___________________________________________________________________________
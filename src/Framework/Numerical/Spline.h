@@ -5,9 +5,15 @@
 
 \brief    A numeric analysis tool class for interpolating 1-D functions.
 
-          Uses ROOT's TSpline3 for the actual interpolation and can retrieve
+          Uses ROOT's TSpline3 for building the interpolation and can retrieve
           function (x,y(x)) pairs from an XML file, a flat ascii file, a
           TNtuple, a TTree or an SQL database.
+          For speed, Evaluate() does not go through TSpline3::Eval(): the
+          knots and cubic coefficients of the TSpline3 are copied into flat
+          arrays, with pre-computed zero-knot flags. Knot intervals are found
+          in O(1) when knots are uniformly spaced in x or log(x) (as for the
+          cross section splines built by XSecSplineList), otherwise by binary
+          search. The TSpline3 is kept, and is what gets written out.
 
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
@@ -25,6 +31,7 @@
 #include <string>
 #include <fstream>
 #include <ostream>
+#include <vector>
 
 #include <TObject.h>
 #include <TSpline.h>
@@ -37,6 +44,7 @@ class TGraph;
 using std::string;
 using std::ostream;
 using std::ofstream;
+using std::vector;
 
 namespace genie {
 
@@ -77,16 +85,25 @@ public:
   double XMax               (void) const {return fXMax;  }
   double YMax               (void) const {return fYMax;  }
   double Evaluate           (double x) const;
+  void   Evaluate           (const double * x, double * y, size_t n) const;
   bool   IsWithinValidRange (double x) const;
+  size_t MemoryFootprint    (void) const; ///< approximate size in bytes
 
   void   SetName (string name) { fName = name; }
   string Name (void) const     { return fName; }
 
   void   YCanBeNegative(bool tf) { fYCanBeNegative = tf; }
 
+  // Evaluate several splines at the same x. The knot interval is looked-up
+  // once and re-used for all splines sharing the knot grid of the first one.
+  // Null splines evaluate to 0.
+  static void Evaluate (const Spline * const splines[], size_t nspl,
+                        double x, double * y);
+
   // Save the Spline in XML, flat ASCII or ROOT format
   void   SaveAsXml (string filename, string xtag, string ytag, string name="") const;
-  void   SaveAsXml (ofstream & str,  string xtag, string ytag, string name="") const;
+  void   SaveAsXml (ofstream & str,  string xtag, string ytag, string name="",
+                    string attributes="") const; ///< attributes: extra spline tag attributes, eg `config="..."'
   void   SaveAsText(string filename, string format="%10.6f\t%10.6f") const;
   void   SaveAsROOT(string filename, string name="", bool recreate=false) const;
 
@@ -120,6 +137,12 @@ private:
   void ResetSpline (void);
   void BuildSpline (int nentries, double x[], double y[]);
 
+  // Flat evaluation engine
+  void BuildFlatEvaluator (void) const;
+  int  FindKnotInterval   (double x) const;
+  bool InKnotInterval     (int k, double x) const;
+  double EvaluateInterval (int k, double x) const;
+
   // Private data members
   string     fName;
   int        fNKnots;
@@ -129,6 +152,18 @@ private:
   TSpline3 * fInterpolator;
   bool       fYCanBeNegative;
 
+  // Flat evaluation arrays (transient: rebuilt from the TSpline3 when needed)
+  mutable bool           fFlatReady;   //! flat evaluation arrays built?
+  mutable int            fFlatLookup;  //! knot lookup: 0 -> binary search, 1 -> uniform x, 2 -> uniform log(x)
+  mutable double         fFlatU0;      //! x (or log(x)) of first knot, for uniform lookups
+  mutable double         fFlatInvDU;   //! inverse of knot spacing in x (or log(x)), for uniform lookups
+  mutable vector<double> fFlatX;       //! knot x
+  mutable vector<double> fFlatY;       //! knot y
+  mutable vector<double> fFlatB;       //! cubic coefficients
+  mutable vector<double> fFlatC;       //! ...
+  mutable vector<double> fFlatD;       //! ...
+  mutable vector<char>   fFlatIsZero;  //! is knot y = 0?
+
 ClassDef(Spline,1)
 };
 
@@ -0,0 +1,303 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <cmath>
+#include <algorithm>
+#include <vector>
+
+#include <TRandom3.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/BatchFunctionMultiDim.h"
+#include "Framework/Numerical/VegasIntegrator.h"
+
+using std::vector;
+using namespace genie;
+
+//____________________________________________________________________________
+VegasIntegrator::VegasIntegrator(
+   double abstol, double reltol, unsigned int maxeval) :
+fAbsTol        (abstol),
+fRelTol        (reltol),
+fMaxEval       (maxeval),
+fNCallsPerIter (0),
+fBatchSize     (1024),
+fNBins         (50),
+fAlpha         (1.5),
+fSeed          (4357),
+fWarmStart     (false),
+fGridNDim      (0),
+fError         (0.),
+fChiSq         (0.),
+fNEval         (0),
+fStatus        (0)
+{
+
+}
+//____________________________________________________________________________
+VegasIntegrator::~VegasIntegrator()
+{
+
+}
+//____________________________________________________________________________
+double VegasIntegrator::Integral(const ROOT::Math::IBaseFunctionMultiDim & func,
+   const double * xmin, const double * xmax)
+{
+  const unsigned int ndim = func.NDim();
+
+  const BatchFunctionMultiDim * bfunc =
+     dynamic_cast<const BatchFunctionMultiDim *> (&func);
+  if(bfunc) {
+    return this->Integral(ndim,
+      [bfunc] (unsigned int n, const double * x, double * f) {
+         bfunc->DoEvalBatch(n, x, f);
+      }, xmin, xmax);
+  }
+  return this->Integral(ndim,
+    [&func, ndim] (unsigned int n, const double * x, double * f) {
+       for(unsigned int i = 0; i < n; i++) f[i] = func(x + i*ndim);
+    }, xmin, xmax);
+}
+//____________________________________________________________________________
+double VegasIntegrator::Integral(unsigned int ndim,
+   const BatchIntegrand_t & func, const double * xmin, const double * xmax)
+{
+  double result = 0.;
+  this->Integral(ndim, 1,
+    [&func] (unsigned int n, const double * x, const bool * /*active*/, double * f) {
+       func(n, x, f);
+    }, xmin, xmax, &result);
+  return result;
+}
+//____________________________________________________________________________
+void VegasIntegrator::Integral(unsigned int ndim, unsigned int nfunc,
+   const MultiBatchIntegrand_t & func, const double * xmin, const double * xmax,
+   double * result, double * error)
+{
+  fError  = 0.;
+  fChiSq  = 0.;
+  fNEval  = 0;
+  fStatus = 1;
+
+  if(nfunc == 0) return;
+  std::fill(result, result+nfunc, 0.);
+  if(error) std::fill(error, error+nfunc, 0.);
+
+  if(ndim == 0) return;
+
+  vector<double> range(ndim);
+  double volume = 1.;
+  for(unsigned int k = 0; k < ndim; k++) {
+    range[k] = xmax[k] - xmin[k];
+    volume  *= range[k];
+  }
+  if(volume == 0.) {
+    fStatus = 0;
+    return;
+  }
+
+  const unsigned int nbins = fNBins;
+  const unsigned int nedge = nbins + 1;
+
+  // grid bin edges, in [0,1], for each dimension: uniform, or else the grid
+  // adapted by the previous integral
+  bool warm = fWarmStart && fGridNDim == ndim && fGrid.size() == ndim*nedge;
+  if(!warm) {
+    fGrid.resize(ndim*nedge);
+    for(unsigned int k = 0; k < ndim; k++) {
+      for(unsigned int j = 0; j < nedge; j++) fGrid[k*nedge+j] = double(j)/nbins;
+    }
+  }
+  fGridNDim = ndim;
+  double * grid = &fGrid[0];
+
+  unsigned int ncalls = (fNCallsPerIter > 0) ?
+                        fNCallsPerIter : std::max(1000u, fMaxEval/10);
+  ncalls = std::max(2u, std::min(ncalls, fMaxEval));
+  const bool warmup = !warm && (fMaxEval / ncalls >= 3);
+
+  const unsigned int batch = std::min(fBatchSize, ncalls);
+  vector<double> u   (batch*ndim);
+  vector<double> x   (batch*ndim);
+  vector<int>    bins(batch*ndim);
+  vector<double> jac (batch);
+  vector<double> f   (batch*nfunc);
+  vector<double> d   (ndim*nbins);   // sum of squared weighted values, per grid bin
+
+  // per integrand: sums over the iteration & the combined iteration estimates
+  vector<double> s1(nfunc), s2(nfunc);
+  vector<double> sum_w(nfunc, 0.), sum_iw(nfunc, 0.), sum_i2w(nfunc, 0.);
+  vector<double> err(nfunc, 0.), chisq(nfunc, 0.);
+  bool * active = new bool[nfunc];
+  std::fill(active, active+nfunc, true);
+  unsigned int nactive = nfunc;
+
+  TRandom3 rnd(fSeed);
+
+  unsigned int niter = 0, nacc = 0, nbad = 0;
+
+  while(fNEval + ncalls <= fMaxEval) {
+
+    std::fill(d.begin(), d.end(), 0.);
+    std::fill(s1.begin(), s1.end(), 0.);
+    std::fill(s2.begin(), s2.end(), 0.);
+
+    for(unsigned int done = 0; done < ncalls; done += batch) {
+      unsigned int nb = std::min(batch, ncalls - done);
+
+      // points, distributed according to the current grid
+      rnd.RndmArray(nb*ndim, &u[0]);
+      for(unsigned int i = 0; i < nb; i++) {
+        double w = volume;
+        for(unsigned int k = 0; k < ndim; k++) {
+          double z = u[i*ndim+k] * nbins;
+          unsigned int j = std::min((unsigned int) z, nbins-1);
+          const double * edges = &grid[k*nedge];
+          double width = edges[j+1] - edges[j];
+          x   [i*ndim+k] = xmin[k] + range[k] * (edges[j] + (z-j) * width);
+          bins[i*ndim+k] = j;
+          w *= nbins * width;
+        }
+        jac[i] = w;
+      }
+
+      func(nb, &x[0], active, &f[0]);
+
+      for(unsigned int i = 0; i < nb; i++) {
+        double fw2 = 0.;
+        for(unsigned int c = 0; c < nfunc; c++) {
+          if(!active[c]) continue;
+          double fw = f[i*nfunc+c] * jac[i];
+          if(!std::isfinite(fw)) { fw = 0.; nbad++; }
+          s1[c] += fw;
+          s2[c] += fw*fw;
+          fw2   += fw*fw;
+        }
+        for(unsigned int k = 0; k < ndim; k++) d[k*nbins + bins[i*ndim+k]] += fw2;
+      }
+    }
+    fNEval += ncalls;
+    niter++;
+
+    bool accept = (!warmup || niter > 1);
+    if(accept) nacc++;
+
+    for(unsigned int c = 0; c < nfunc; c++) {
+      if(!active[c]) continue;
+
+      double mean = s1[c] / ncalls;
+      double var  = std::max(0., (s2[c]/ncalls - mean*mean) / (ncalls-1));
+
+      if(var == 0.) {
+        // constant (eg vanishing) integrand over the sampled points
+        result[c] = mean;
+        err   [c] = 0.;
+        active[c] = false;
+        nactive--;
+        continue;
+      }
+      if(!accept) continue;
+
+      double w = 1./var;
+      sum_w  [c] += w;
+      sum_iw [c] += w * mean;
+      sum_i2w[c] += w * mean * mean;
+
+      result[c] = sum_iw[c] / sum_w[c];
+      err   [c] = std::sqrt(1./sum_w[c]);
+      chisq [c] = (nacc > 1) ?
+         std::max(0., sum_i2w[c] - sum_iw[c]*result[c]) / (nacc-1) : 0.;
+
+      if(nacc > 1 && err[c] <= std::max(fAbsTol, fRelTol * std::fabs(result[c]))) {
+        active[c] = false;
+        nactive--;
+      }
+    }
+    if(nactive == 0) {
+      fStatus = 0;
+      break;
+    }
+
+    this->RefineGrid(ndim, &d[0], grid);
+  }
+  delete [] active;
+
+  fError = *std::max_element(err.begin(),   err.end());
+  fChiSq = *std::max_element(chisq.begin(), chisq.end());
+  if(error) std::copy(err.begin(), err.end(), error);
+
+  if(nbad > 0) {
+    LOG("VegasIntegrator", pWARN)
+       << "The integrand was not finite at " << nbad << " of "
+       << fNEval*nfunc << " points (taken as 0)";
+  }
+  if(nfunc == 1) {
+    LOG("VegasIntegrator", pINFO)
+       << "Integral = " << result[0] << " +/- " << fError << " (" << niter
+       << " iterations, " << fNEval << " evaluations, chi2/dof = " << fChiSq << ")";
+  } else {
+    LOG("VegasIntegrator", pINFO)
+       << nfunc << " integrals, max error = " << fError << " (" << niter
+       << " iterations, " << fNEval << " points, max chi2/dof = " << fChiSq << ")";
+  }
+}
+//____________________________________________________________________________
+void VegasIntegrator::RefineGrid(
+   unsigned int ndim, const double * d, double * grid) const
+{
+// Moves the bin edges of each dimension so that the bins hold equal shares of
+// the smoothed & damped bin contributions to the variance
+
+  const unsigned int nbins = fNBins;
+  const unsigned int nedge = nbins + 1;
+  if(nbins < 2) return;
+
+  vector<double> r(nbins), edges(nedge);
+
+  for(unsigned int k = 0; k < ndim; k++) {
+
+    const double * dk = d + k*nbins;
+
+    // smooth over neighbouring bins
+    r[0] = 0.5 * (dk[0] + dk[1]);
+    for(unsigned int j = 1; j < nbins-1; j++) r[j] = (dk[j-1] + dk[j] + dk[j+1]) / 3.;
+    r[nbins-1] = 0.5 * (dk[nbins-2] + dk[nbins-1]);
+
+    double sum = 0.;
+    for(unsigned int j = 0; j < nbins; j++) sum += r[j];
+    if(sum <= 0.) continue;
+
+    // damp
+    double rsum = 0.;
+    for(unsigned int j = 0; j < nbins; j++) {
+      double t = r[j] / sum;
+      if     (t <= 0.) r[j] = 0.;
+      else if(t >= 1.) r[j] = 1.;
+      else             r[j] = std::pow((t - 1.) / std::log(t), fAlpha);
+      rsum += r[j];
+    }
+    if(rsum <= 0.) continue;
+
+    // new edges, with rsum/nbins of the weight in each bin
+    double * gk = grid + k*nedge;
+    double per = rsum / nbins, cum = 0.;
+    unsigned int j = 0;
+    edges[0]     = 0.;
+    edges[nbins] = 1.;
+    for(unsigned int jn = 1; jn < nbins; jn++) {
+      double target = jn * per;
+      while(j < nbins-1 && cum + r[j] < target) { cum += r[j]; j++; }
+      double frac = (r[j] > 0.) ? std::min(1., (target - cum) / r[j]) : 0.;
+      edges[jn] = gk[j] + frac * (gk[j+1] - gk[j]);
+    }
+    std::copy(edges.begin(), edges.end(), gk);
+  }
+}
+//____________________________________________________________________________
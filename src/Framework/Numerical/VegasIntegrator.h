@@ -0,0 +1,118 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::VegasIntegrator
+
+\brief    VEGAS adaptive Monte Carlo integrator (G.P.Lepage, J.Comput.Phys.27
+          (1978) 192), evaluating the integrand at batches of points.
+
+          The integration volume is mapped on a separable grid that is refined,
+          after each iteration, so that the grid bins contribute equally to the
+          variance of the estimate (importance sampling). Iteration estimates
+          are combined weighted by their inverse variance, and iterations stop
+          as soon as the error meets the absolute or relative tolerance, or the
+          max number of evaluations is reached. When the budget allows for at
+          least three iterations, the first one only trains the grid.
+
+          The points of each iteration are worked out in batches, and passed
+          to the integrand in a single call per batch: BatchFunctionMultiDim
+          integrands evaluate them with DoEvalBatch(), other ROOT functions
+          point by point.
+
+          The random numbers come from a generator owned by the integrator,
+          with a fixed default seed, so that integrals (eg cross section
+          splines) are reproducible and integrators can be used concurrently.
+
+          With SetWarmStart(true), an integral starts from the grid adapted by
+          the previous integral of the same dimension (eg at the previous knot
+          of a cross section spline, where the integrand has a similar shape)
+          and skips the grid training iteration.
+
+          Several integrands over the same volume (eg the quark channels of a
+          DIS cross section) can be integrated in one pass: they are evaluated
+          at the same points, the grid is adapted to their combined variance,
+          and each gets its own estimate. Integrands that met the tolerance
+          are no longer evaluated.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _VEGAS_INTEGRATOR_H_
+#define _VEGAS_INTEGRATOR_H_
+
+#include <functional>
+#include <vector>
+
+#include <Math/IFunction.h>
+
+namespace genie {
+
+class VegasIntegrator {
+
+public:
+  VegasIntegrator(double abstol = 0., double reltol = 1E-2, unsigned int maxeval = 100000);
+ ~VegasIntegrator();
+
+  //! Integrand evaluated at npoints points, stored point after point
+  //! (x[i*ndim + k] is coordinate k of point i)
+  typedef std::function<void (unsigned int npoints, const double * x, double * f)> BatchIntegrand_t;
+
+  //! nfunc integrands evaluated at npoints points (f[i*nfunc + c] is integrand
+  //! c at point i). Integrands with active[c] == false need not be evaluated
+  typedef std::function<void (unsigned int npoints, const double * x,
+                              const bool * active, double * f)> MultiBatchIntegrand_t;
+
+  double Integral (const ROOT::Math::IBaseFunctionMultiDim & func,
+                   const double * xmin, const double * xmax);
+  double Integral (unsigned int ndim, const BatchIntegrand_t & func,
+                   const double * xmin, const double * xmax);
+  void   Integral (unsigned int ndim, unsigned int nfunc, const MultiBatchIntegrand_t & func,
+                   const double * xmin, const double * xmax, double * result, double * error = 0);
+
+  void SetAbsTolerance      (double tol)       { fAbsTol = tol;     }
+  void SetRelTolerance      (double tol)       { fRelTol = tol;     }
+  void SetMaxEval           (unsigned int n)   { fMaxEval = n;      }
+  void SetCallsPerIteration (unsigned int n)   { fNCallsPerIter = n; } ///< 0: max(1000, max evaluations / 10)
+  void SetBatchSize         (unsigned int n)   { fBatchSize = (n>0) ? n : 1; }
+  void SetNBins             (unsigned int n)   { fNBins = (n>0) ? n : 1; }     ///< grid bins per dimension
+  void SetAlpha             (double alpha)     { fAlpha = alpha;    }          ///< grid refinement damping
+  void SetSeed              (unsigned int s)   { fSeed = s;         }
+  void SetWarmStart         (bool on)          { fWarmStart = on;   }          ///< start from the last adapted grid
+
+  double       Error       (void) const { return fError;  } ///< error estimate of the last integral (largest one, for several integrands)
+  double       ChiSqPerDoF (void) const { return fChiSq;  } ///< consistency of the iteration estimates (worst one)
+  unsigned int NEval       (void) const { return fNEval;  } ///< evaluation points of the last integral
+  int          Status      (void) const { return fStatus; } ///< 0 if the tolerance was met (by all integrands)
+
+private:
+  void RefineGrid (unsigned int ndim, const double * d, double * grid) const;
+
+  double       fAbsTol;         ///< absolute tolerance
+  double       fRelTol;         ///< relative tolerance
+  unsigned int fMaxEval;        ///< max number of integrand evaluations
+  unsigned int fNCallsPerIter;  ///< evaluations per iteration (0: automatic)
+  unsigned int fBatchSize;      ///< points per integrand call
+  unsigned int fNBins;          ///< grid bins per dimension
+  double       fAlpha;          ///< grid refinement damping parameter
+  unsigned int fSeed;           ///< random number seed
+  bool         fWarmStart;      ///< start from the grid of the previous integral?
+
+  std::vector<double> fGrid;    ///< grid bin edges, in [0,1], of the last integral
+  unsigned int fGridNDim;       ///< dimension of the last grid (0: none)
+
+  double       fError;
+  double       fChiSq;
+  unsigned int fNEval;
+  int          fStatus;
+};
+
+}      // genie namespace
+
+#endif // _VEGAS_INTEGRATOR_H_
@@ -13,12 +13,15 @@
 
 #include <iostream>
 #include <string>
+#include <mutex>
 
 #include <TSystem.h>
+#include <THashList.h>
 
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGLibrary.h"
+#include "Framework/Utils/StartupProfiler.h"
 
 using std::string;
 
@@ -27,7 +30,9 @@ using namespace genie;
 //____________________________________________________________________________
 PDGLibrary * PDGLibrary::fInstance = 0;
 //____________________________________________________________________________
-PDGLibrary::PDGLibrary()
+PDGLibrary::PDGLibrary() :
+fDatabasePDG(0),
+fHashShift(32)
 {
   if( ! LoadDBase() ) LOG("PDG", pERROR) << "Could not load PDG data";
 
@@ -42,12 +47,16 @@ PDGLibrary::~PDGLibrary()
 PDGLibrary * PDGLibrary::Instance()
 {
   if(fInstance == 0) {
-    LOG("PDG", pINFO) << "PDGLibrary late initialization";
+    static std::mutex init_mutex;
+    std::lock_guard<std::mutex> lock(init_mutex);
+    if(fInstance == 0) {
+      LOG("PDG", pINFO) << "PDGLibrary late initialization";
 
-    static PDGLibrary::Cleaner cleaner;
-    cleaner.DummyMethodAndSilentCompiler();
+      static PDGLibrary::Cleaner cleaner;
+      cleaner.DummyMethodAndSilentCompiler();
 
-    fInstance = new PDGLibrary;
+      fInstance = new PDGLibrary;
+    }
   }
   return fInstance;
 }
@@ -61,12 +70,60 @@ TParticlePDG * PDGLibrary::Find(int pdgc)
 {
 // save some typing in the most frequently typed TDatabasePDG method
 
+  int i = this->Index(pdgc);
+  if(i >= 0) return fProperties[i].fParticle;
+
   return fDatabasePDG->GetParticle(pdgc);
 }
+//____________________________________________________________________________
+void PDGLibrary::BuildIndices(void)
+{
+  fProperties.clear();
+  fHashPdg.clear();
+  fHashIndex.clear();
+
+  const THashList * plist = fDatabasePDG->ParticleList();
+  if(!plist) return;
+
+  TIter particle_iter(plist);
+  TParticlePDG * p = 0;
+  while( (p = dynamic_cast<TParticlePDG *> (particle_iter.Next())) ) {
+    if(p->PdgCode() == 0) continue;
+    Properties prop;
+    prop.fPdg      = p->PdgCode();
+    prop.fMass     = p->Mass();
+    prop.fWidth    = p->Width();
+    prop.fCharge   = p->Charge();
+    prop.fParticle = p;
+    fProperties.push_back(prop);
+  }
+
+  // hash map with a load factor below 1/2
+  unsigned int nbits = 4;
+  while( (1u << nbits) < 2 * fProperties.size() ) nbits++;
+  fHashShift = 32 - nbits;
+  fHashPdg  .assign(1u << nbits, 0);
+  fHashIndex.assign(1u << nbits, -1);
+
+  unsigned int mask = fHashPdg.size() - 1;
+  for(unsigned int i = 0; i < fProperties.size(); i++) {
+    int pdgc = fProperties[i].fPdg;
+    if(this->Index(pdgc) >= 0) continue;
+    unsigned int slot = ((unsigned int) pdgc * 2654435761u) >> fHashShift;
+    while(fHashPdg[slot] != 0) slot = (slot + 1) & mask;
+    fHashPdg  [slot] = pdgc;
+    fHashIndex[slot] = i;
+  }
+
+  LOG("PDG", pINFO)
+    << "Indexed the properties of " << fProperties.size() << " particles";
+}
 
 //____________________________________________________________________________
 bool PDGLibrary::LoadDBase(void)
 {
+  StartupTimer timer("PDGLibrary::LoadDBase");
+
   fDatabasePDG = TDatabasePDG::Instance();
 
   // loading PDG data from $GENIE/config/
@@ -76,6 +133,7 @@ bool PDGLibrary::LoadDBase(void)
         LOG("PDG", pINFO) << "Load PDG data from $GENIE_PDG_TABLE: "
                           << altpdgtable;
         fDatabasePDG->ReadPDGTable( altpdgtable );
+        this->BuildIndices();
         return true;
     }
   }
@@ -88,6 +146,7 @@ bool PDGLibrary::LoadDBase(void)
     if ( ! (gSystem->AccessPathName(path.c_str()) ) ) {
         LOG("PDG", pINFO) << "Load PDG data from: " << path;
         fDatabasePDG->ReadPDGTable( path.c_str() );
+        this->BuildIndices();
         return true;
     }
   }
@@ -101,11 +160,13 @@ bool PDGLibrary::LoadDBase(void)
     if ( !(gSystem->AccessPathName(path.c_str())) ) {
         LOG("PDG", pINFO) << "Load PDG data from: " << path;
         fDatabasePDG->ReadPDGTable( path.c_str() );
+        this->BuildIndices();
         return true;
      }
   }
 
   LOG("PDG", pERROR) << " *** The PDG extensions will not be loaded!! ***";
+  this->BuildIndices();
   return false;
 };
 //____________________________________________________________________________
@@ -130,6 +191,8 @@ void PDGLibrary::AddDarkMatter(double mass, double med_ratio)
   else {
     assert(med_particle->Mass() == med_mass);
   }
+
+  this->BuildIndices();
 }
 //____________________________________________________________________________
 // EDIT: need a way to clear and then reload the PDG database
@@ -137,7 +200,11 @@ void PDGLibrary::ReloadDBase(void)
 {
   if(fDatabasePDG) {
     delete fDatabasePDG;
+    fDatabasePDG = 0;
   }
+  fProperties.clear();
+  fHashPdg.clear();
+  fHashIndex.clear();
 
   if( ! LoadDBase() ) LOG("PDG", pERROR) << "Could not load PDG data";
 }
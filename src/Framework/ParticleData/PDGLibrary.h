@@ -5,6 +5,12 @@
 
 \brief    Singleton class to load & serve a TDatabasePDG.
 
+          At load, the mass, width and charge of all particles are copied
+          in a dense table, indexed via a small open-addressing hash map
+          from PDG code to index, which serves the inline Mass(), Width()
+          and Charge() accessors and Find(). The table is read-only once
+          built and is therefore shared by all threads.
+
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -21,6 +27,8 @@
 #ifndef _PDG_LIBRARY_H_
 #define _PDG_LIBRARY_H_
 
+#include <vector>
+
 #include <TDatabasePDG.h>
 #include <TParticlePDG.h>
 
@@ -36,6 +44,15 @@ public:
   TParticlePDG * Find  (int pdgc);
   void           ReloadDBase (void);
 
+  // Fast access to the basic particle properties.
+  // Index() is the dense index of the particle in the property table, or -1.
+  // Charge() is in units of |e|/3, as in TParticlePDG.
+  int    Index  (int pdgc) const;
+  double Mass   (int pdgc);
+  double Width  (int pdgc);
+  double Charge (int pdgc);
+  int    NIndices (void) const { return fProperties.size(); }
+
   // Add dark matter and mediator with parameters from Boosted Dark Matter app configuration
   // Ideally, this code should be in the Dark Matter app, not here.
   // But presently there is no way to edit the PDGLibrary after it has been created.
@@ -47,11 +64,25 @@ private:
   PDGLibrary(const PDGLibrary & config_pool);
   virtual ~PDGLibrary();
 
-  bool LoadDBase(void);
+  bool LoadDBase    (void);
+  void BuildIndices (void);
+
+  struct Properties {
+    int            fPdg;
+    double         fMass;
+    double         fWidth;
+    double         fCharge;
+    TParticlePDG * fParticle;
+  };
 
   static PDGLibrary * fInstance;
   TDatabasePDG      * fDatabasePDG;
 
+  std::vector<Properties> fProperties;  ///< particle properties, by index
+  std::vector<int>        fHashPdg;     ///< hash map keys (0: empty slot)
+  std::vector<int>        fHashIndex;   ///< hash map values
+  unsigned int            fHashShift;   ///< 32 - log2(hash map size)
+
   struct Cleaner {
       void DummyMethodAndSilentCompiler() { }
       ~Cleaner() {
@@ -63,6 +94,42 @@ private:
   };
   friend struct Cleaner;
 };
+//____________________________________________________________________________
+inline int PDGLibrary::Index(int pdgc) const
+{
+  if(pdgc == 0 || fHashPdg.empty()) return -1;
+  unsigned int mask = fHashPdg.size() - 1;
+  unsigned int slot = ((unsigned int) pdgc * 2654435761u) >> fHashShift;
+  while(fHashPdg[slot] != 0) {
+    if(fHashPdg[slot] == pdgc) return fHashIndex[slot];
+    slot = (slot + 1) & mask;
+  }
+  return -1;
+}
+//____________________________________________________________________________
+inline double PDGLibrary::Mass(int pdgc)
+{
+  int i = this->Index(pdgc);
+  if(i >= 0) return fProperties[i].fMass;
+  TParticlePDG * p = this->Find(pdgc);
+  return (p) ? p->Mass() : 0.;
+}
+//____________________________________________________________________________
+inline double PDGLibrary::Width(int pdgc)
+{
+  int i = this->Index(pdgc);
+  if(i >= 0) return fProperties[i].fWidth;
+  TParticlePDG * p = this->Find(pdgc);
+  return (p) ? p->Width() : 0.;
+}
+//____________________________________________________________________________
+inline double PDGLibrary::Charge(int pdgc)
+{
+  int i = this->Index(pdgc);
+  if(i >= 0) return fProperties[i].fCharge;
+  TParticlePDG * p = this->Find(pdgc);
+  return (p) ? p->Charge() : 0.;
+}
 
 }      // genie namespace
 
@@ -12,6 +12,10 @@
 #include <cstdlib>
 #include <sstream>
 #include <iomanip>
+#include <functional>
+#include <unordered_map>
+#include <atomic>
+#include <mutex>
 
 #include <TH1F.h>
 #include <TH2F.h>
@@ -82,23 +86,65 @@ namespace genie {
  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 }
 //____________________________________________________________________________
-Registry::Registry()
+namespace {
+  // Process-wide table of interned registry keys. The table is node-based
+  // so the entries handed out never move.
+  typedef std::unordered_map<RgKey, size_t> RgKeyTable;
+
+  RgKeyTable & InternedKeys(void)
+  {
+    static RgKeyTable * table = new RgKeyTable; // never deleted
+    return *table;
+  }
+  std::mutex & InternedKeysMutex(void)
+  {
+    static std::mutex mtx;
+    return mtx;
+  }
+  std::atomic<unsigned long> gRegistryVersion(0);
+}
+//____________________________________________________________________________
+RgIKey::RgIKey(const RgKey & key)
+{
+  std::lock_guard<std::mutex> lock(InternedKeysMutex());
+  RgKeyTable & table = InternedKeys();
+  RgKeyTable::const_iterator it = table.find(key);
+  if(it == table.end()) {
+    it = table.insert(RgKeyTable::value_type(key, RgIKey::HashOf(key))).first;
+  }
+  fEntry = &(*it);
+}
+//____________________________________________________________________________
+size_t RgIKey::HashOf(const RgKey & key)
+{
+  return std::hash<RgKey>()(key);
+}
+//____________________________________________________________________________
+Registry::Registry() :
+fIndexUsed (0),
+fVersion   (0)
 {
   this->Init();
+  this->Touch();
 }
 //____________________________________________________________________________
 Registry::Registry(string name, bool isReadOnly) :
 fName             ( name       ),
 fIsReadOnly       ( isReadOnly ),
-fInhibitItemLocks ( false      )
+fInhibitItemLocks ( false      ),
+fIndexUsed        ( 0          ),
+fVersion          ( 0          )
 {
-
+  this->Touch();
 }
 //____________________________________________________________________________
 Registry::Registry(const Registry & registry) :
 fName("uninitialised"),
-fIsReadOnly(false)
+fIsReadOnly(false),
+fIndexUsed(0),
+fVersion(0)
 {
+  this->Touch();
   this->Copy(registry);
 }
 //____________________________________________________________________________
@@ -177,8 +223,8 @@ bool Registry::ItemLocksAreActive(void) const
 //____________________________________________________________________________
 bool Registry::ItemIsLocal(RgKey key) const
 {
-  if( this->Exists(key) ) {
-     RgIMapConstIter entry = fRegistry.find(key);
+  RgIMapConstIter entry = this->Find(key, RgIKey::HashOf(key));
+  if( entry != fRegistry.end() ) {
      bool is_local = entry->second->IsLocal();
      return is_local;
   } else {
@@ -193,8 +239,8 @@ bool Registry::ItemIsLocal(RgKey key) const
 //____________________________________________________________________________
 void Registry::OverrideGlobalDef(RgKey key)
 {
-  if( this->Exists(key) ) {
-     RgIMapConstIter entry = fRegistry.find(key);
+  RgIMapConstIter entry = this->Find(key, RgIKey::HashOf(key));
+  if( entry != fRegistry.end() ) {
      entry->second->SetLocal(true);
   } else {
      LOG("Registry", pWARN)
@@ -205,8 +251,8 @@ void Registry::OverrideGlobalDef(RgKey key)
 //____________________________________________________________________________
 void Registry::LinkToGlobalDef(RgKey key)
 {
-  if( this->Exists(key) ) {
-     RgIMapConstIter entry = fRegistry.find(key);
+  RgIMapConstIter entry = this->Find(key, RgIKey::HashOf(key));
+  if( entry != fRegistry.end() ) {
      entry->second->SetLocal(false);
   } else {
      LOG("Registry", pWARN)
@@ -217,8 +263,8 @@ void Registry::LinkToGlobalDef(RgKey key)
 //____________________________________________________________________________
 bool Registry::ItemIsLocked(RgKey key) const
 {
-  if( this->Exists(key) ) {
-     RgIMapConstIter entry = fRegistry.find(key);
+  RgIMapConstIter entry = this->Find(key, RgIKey::HashOf(key));
+  if( entry != fRegistry.end() ) {
      bool is_locked = entry->second->IsLocked();
      return is_locked;
   } else {
@@ -233,8 +279,8 @@ bool Registry::ItemIsLocked(RgKey key) const
 //____________________________________________________________________________
 void Registry::LockItem(RgKey key)
 {
-  if( this->Exists(key) ) {
-     RgIMapConstIter entry = fRegistry.find(key);
+  RgIMapConstIter entry = this->Find(key, RgIKey::HashOf(key));
+  if( entry != fRegistry.end() ) {
      entry->second->Lock();
   } else {
      LOG("Registry", pWARN)
@@ -244,8 +290,8 @@ void Registry::LockItem(RgKey key)
 //____________________________________________________________________________
 void Registry::UnLockItem(RgKey key)
 {
-  if( this->Exists(key) ) {
-     RgIMapConstIter entry = fRegistry.find(key);
+  RgIMapConstIter entry = this->Find(key, RgIKey::HashOf(key));
+  if( entry != fRegistry.end() ) {
      entry->second->UnLock();
   } else {
     LOG("Registry", pWARN)
@@ -268,8 +314,20 @@ void Registry::Set(RgIMapPair entry)
 {
   RgKey key = entry.first;
   if( this->CanSetItem(key) ) {
-    this->DeleteEntry(key);
-    fRegistry.insert(entry);
+    RgIMapIter current = this->Find(key, RgIKey::HashOf(key));
+    if(current == fRegistry.end()) {
+      this->Insert(key, entry.second);
+    }
+    else if(!fIsReadOnly) {
+      // replace the item in place (keeps the index valid)
+      delete current->second;
+      current->second = entry.second;
+      this->Touch();
+    }
+    else {
+      // read-only registries keep their existing items
+      delete entry.second;
+    }
   } else {
      LOG("Registry", pWARN)
              << "*** Registry item [" << key << "] can not be set";
@@ -494,7 +552,7 @@ RgAlg Registry::GetAlg(RgKey key) const
 //____________________________________________________________________________
 RgH1F Registry::GetH1F(RgKey key) const
 {
-  RgIMapConstIter entry = fRegistry.find(key);
+  RgIMapConstIter entry = this->SafeFind(key);
   RegistryItemI * rib = entry->second;
   RegistryItem<RgH1F> *ri = dynamic_cast<RegistryItem<RgH1F>*> (rib);
 
@@ -504,7 +562,7 @@ RgH1F Registry::GetH1F(RgKey key) const
 //____________________________________________________________________________
 RgH2F Registry::GetH2F(RgKey key) const
 {
-  RgIMapConstIter entry = fRegistry.find(key);
+  RgIMapConstIter entry = this->SafeFind(key);
   RegistryItemI * rib = entry->second;
   RegistryItem<RgH2F> *ri = dynamic_cast<RegistryItem<RgH2F>*> (rib);
 
@@ -514,7 +572,7 @@ RgH2F Registry::GetH2F(RgKey key) const
 //____________________________________________________________________________
 RgTree Registry::GetTree(RgKey key) const
 {
-  RgIMapConstIter entry = fRegistry.find(key);
+  RgIMapConstIter entry = this->SafeFind(key);
   RegistryItemI * rib = entry->second;
   RegistryItem<RgTree> *ri = dynamic_cast<RegistryItem<RgTree>*> (rib);
 
@@ -549,7 +607,7 @@ RgAlg Registry::GetAlgDef(RgKey key, RgAlg  def_opt, bool set_def)
 //____________________________________________________________________________
 RgIMapConstIter Registry::SafeFind(RgKey key) const
 {
-  RgIMapConstIter entry = fRegistry.find(key);
+  RgIMapConstIter entry = this->Find(key, RgIKey::HashOf(key));
   if (entry!=fRegistry.end()) {
     return entry;
   }
@@ -560,21 +618,57 @@ RgIMapConstIter Registry::SafeFind(RgKey key) const
   exit(1);
 }
 //____________________________________________________________________________
+RgIMapConstIter Registry::SafeFind(const RgIKey & key) const
+{
+  RgIMapConstIter entry = this->Find(key);
+  if (entry!=fRegistry.end()) {
+    return entry;
+  }
+  return this->SafeFind(key.Key()); // report & abort
+}
+//____________________________________________________________________________
+const RegistryItemI * Registry::FindItem(const RgKey & key) const
+{
+  RgIMapConstIter entry = this->Find(key, RgIKey::HashOf(key));
+  return (entry!=fRegistry.end()) ? entry->second : 0;
+}
+//____________________________________________________________________________
+const RegistryItemI * Registry::FindItem(const RgIKey & key) const
+{
+  RgIMapConstIter entry = this->Find(key);
+  return (entry!=fRegistry.end()) ? entry->second : 0;
+}
+//____________________________________________________________________________
 bool Registry::Exists(RgKey key) const
 {
-  RgIMapConstIter entry = fRegistry.find(key);
+  RgIMapConstIter entry = this->Find(key, RgIKey::HashOf(key));
   return (entry!=fRegistry.end());
 }
 //____________________________________________________________________________
+bool Registry::Exists(const RgIKey & key) const
+{
+  return (this->Find(key) != fRegistry.end());
+}
+//____________________________________________________________________________
+bool Registry::ItemIsLocal(const RgIKey & key) const
+{
+  const RegistryItemI * item = this->FindItem(key);
+  return (item) ? item->IsLocal() : false;
+}
+//____________________________________________________________________________
 bool Registry::DeleteEntry(RgKey key)
 {
-  if(!fIsReadOnly && Exists(key)) {
-      RgIMapIter entry = fRegistry.find(key);
+  if(!fIsReadOnly) {
+    RgIMapIter entry = this->Find(key, RgIKey::HashOf(key));
+    if(entry != fRegistry.end()) {
       RegistryItemI * item = entry->second;
       delete item;
       item = 0;
       fRegistry.erase(entry);
+      this->RebuildIndex();
+      this->Touch();
       return true;
+    }
   }
   return false;
 }
@@ -761,7 +855,7 @@ void Registry::Append(const Registry & registry, RgKey prefix)
      RgKey name     = reg_iter->first;
      RgKey new_name = prefix + name;
 
-     if ( fRegistry.count( new_name ) > 0 ) continue ;
+     if ( this->Find( new_name, RgIKey::HashOf(new_name) ) != fRegistry.end() ) continue ;
 
      RgType_t type  = reg_iter -> second -> TypeInfo();
      string   stype = RgType::AsString(type);
@@ -772,15 +866,7 @@ void Registry::Append(const Registry & registry, RgKey prefix)
 
      RegistryItemI * cri = registry.CloneRegistryItem( name ) ; // cloned registry item
 
-     RgIMapPair reg_entry(new_name, cri);
-
-     if ( ! fRegistry.insert(reg_entry).second ) {
-    	 // The registry already contained an entry with key new_name
-    	 //   so the new registryItem has to be deleted or we leak memory.
-    	 //   This should not happened as a check is performed
-    	 LOG("Registry", pERROR ) << "Failing to insert item " << new_name ;
-    	 delete cri ;
-     }
+     this->Insert(new_name, cri);
    } // loop on the incoming registry items
 }
 //____________________________________________________________________________
@@ -815,20 +901,24 @@ void Registry::Merge(const Registry & registry, RgKey prefix)
 
      RegistryItemI * cri = registry.CloneRegistryItem( name ) ; // cloned registry item
 
-     if ( fRegistry.count( new_name ) > 0 ) {
+     RgIMapIter current = this->Find( new_name, RgIKey::HashOf(new_name) ) ;
+     if ( current != fRegistry.end() ) {
 
-       RegistryItemI * old_ri = fRegistry[new_name] ;
+       RegistryItemI * old_ri = current -> second ;
    	   delete old_ri ;
+       current -> second = cri ;
+       this -> Touch() ;
+     }
+     else {
+       this -> Insert( new_name, cri ) ;
      }
-
-     fRegistry[new_name] = cri ;
 
    } // loop on the incoming registry items
 
 }//____________________________________________________________________________
 RgType_t Registry::ItemType(RgKey key) const
 {
-  RgIMapConstIter reg_iter = fRegistry.find(key);
+  RgIMapConstIter reg_iter = this->Find(key, RgIKey::HashOf(key));
   if(reg_iter != fRegistry.end()) {
      RegistryItemI * ri = reg_iter->second;
      RgType_t type  = ri->TypeInfo();
@@ -885,11 +975,14 @@ void Registry::Clear(bool force)
      item = 0;
   }
   fRegistry.clear();
+  fIndex.clear();
+  fIndexUsed = 0;
+  this->Touch();
 }
 //____________________________________________________________________________
 RegistryItemI * Registry::CloneRegistryItem( const RgKey & key ) const {
 
-	std::map<RgKey, RegistryItemI*>::const_iterator it = fRegistry.find( key ) ;
+	RgIMapConstIter it = this->Find( key, RgIKey::HashOf(key) ) ;
 
 	if ( it == fRegistry.end() ) {
 		LOG("Registry", pFATAL) << "Item " << key << " not found while cloning for registry " << Name() ;
@@ -953,3 +1046,100 @@ RegistryItemI * Registry::CloneRegistryItem( const RgKey & key ) const {
      return cri ;
 
 }
+//____________________________________________________________________________
+RgIMapIter Registry::Find(const RgKey & key, size_t hash) const
+{
+// Looks-up the input key in the hash index. Returns fRegistry.end() if the
+// key is not found.
+
+  RgIMap & reg = const_cast<RgIMap &> (fRegistry);
+  if(fIndexUsed == 0) return reg.end();
+
+  size_t mask = fIndex.size() - 1;
+  for(size_t i = hash & mask; ; i = (i+1) & mask) {
+    const IndexSlot & slot = fIndex[i];
+    if(!slot.key) return reg.end();
+    if(slot.key->second == hash && slot.key->first == key) return slot.entry;
+  }
+}
+//____________________________________________________________________________
+RgIMapIter Registry::Find(const RgIKey & key) const
+{
+// As above, but interned keys are compared by address
+
+  RgIMap & reg = const_cast<RgIMap &> (fRegistry);
+  if(fIndexUsed == 0) return reg.end();
+
+  size_t mask = fIndex.size() - 1;
+  for(size_t i = key.Hash() & mask; ; i = (i+1) & mask) {
+    const IndexSlot & slot = fIndex[i];
+    if(!slot.key) return reg.end();
+    if(slot.key == key.fEntry) return slot.entry;
+  }
+}
+//____________________________________________________________________________
+RgIMapIter Registry::Insert(const RgKey & key, RegistryItemI * item)
+{
+// Adds a new entry (the key must not exist already) & indexes it
+
+  RgIMapIter entry = fRegistry.insert(RgIMapPair(key, item)).first;
+  this->IndexInsert(entry);
+  this->Touch();
+  return entry;
+}
+//____________________________________________________________________________
+void Registry::IndexInsert(RgIMapIter entry)
+{
+// Indexes an entry already inserted in fRegistry
+
+  // keep the load factor below 1/2; the rebuilt index includes the entry
+  if(2*(fIndexUsed+1) > fIndex.size()) {
+    this->RebuildIndex();
+    return;
+  }
+  RgIKey ikey(entry->first);
+  size_t mask = fIndex.size() - 1;
+  size_t i = ikey.Hash() & mask;
+  while(fIndex[i].key) i = (i+1) & mask;
+  fIndex[i].key   = ikey.fEntry;
+  fIndex[i].entry = entry;
+  fIndexUsed++;
+}
+//____________________________________________________________________________
+void Registry::RebuildIndex(void)
+{
+  size_t size = 8;
+  while(size < 4*fRegistry.size()) size <<= 1;
+
+  IndexSlot empty;
+  empty.key   = 0;
+  empty.entry = fRegistry.end();
+  fIndex.assign(size, empty);
+  fIndexUsed = 0;
+
+  size_t mask = size - 1;
+  RgIMapIter it = fRegistry.begin();
+  for( ; it != fRegistry.end(); ++it) {
+    RgIKey ikey(it->first);
+    size_t i = ikey.Hash() & mask;
+    while(fIndex[i].key) i = (i+1) & mask;
+    fIndex[i].key   = ikey.fEntry;
+    fIndex[i].entry = it;
+    fIndexUsed++;
+  }
+}
+//____________________________________________________________________________
+void Registry::Touch(void)
+{
+  fVersion = ++gRegistryVersion;
+}
+//____________________________________________________________________________
+void Registry::AbortOnTypeMismatch(const RgKey & key) const
+{
+  LOG("Registry", pFATAL)
+       << "*** Item: " << key << " in registry: " << this->Name()
+       << " is not of the requested type";
+  gAbortingInErr = true;
+  exit(1);
+}
+//____________________________________________________________________________
@@ -6,6 +6,14 @@
 \brief    A registry. Provides the container for algorithm configuration
           parameters.
 
+          Besides the ordered key -> item map (used for iterating over the
+          registry entries), the registry keeps a flat open-addressing hash
+          index over its entries, with the key hashes computed once, when
+          the keys are interned (see RgIKey). All lookups go through the
+          index. Parameters read repeatedly can be looked up via an RgIKey,
+          which skips hashing the key, or via an RgHandle<T>, which caches
+          the item found in the last registry it was used with.
+
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -49,6 +57,30 @@ typedef map <RgKey, RegistryItemI *>::iterator       RgIMapIter;
 typedef map <RgKey, RegistryItemI *>::const_iterator RgIMapConstIter;
 typedef vector<RgKey>                                RgKeyList;
 
+//
+// Interned registry key. Each distinct key string is stored only once (in a
+// process-wide table) along with its precomputed hash, so that copying and
+// comparing interned keys are pointer operations.
+//
+class RgIKey {
+public:
+  typedef pair<const RgKey, size_t> Entry;
+
+  explicit RgIKey (const RgKey & key);
+
+  const RgKey & Key  (void) const { return fEntry->first;  }
+  size_t        Hash (void) const { return fEntry->second; }
+
+  bool operator == (const RgIKey & k) const { return fEntry == k.fEntry; }
+  bool operator != (const RgIKey & k) const { return fEntry != k.fEntry; }
+
+  static size_t HashOf (const RgKey & key);
+
+private:
+  friend class Registry;
+  const Entry * fEntry;
+};
+
 // Templated utility methods to set/get registry items
 //
 class Registry;
@@ -139,6 +171,20 @@ public:
   RgAlg  GetAlgDef    (RgKey key, RgAlg  def_opt, bool set_def=true);
 
   RgIMapConstIter SafeFind  (RgKey key) const;
+  RgIMapConstIter SafeFind  (const RgIKey & key) const;
+
+  // Lookups by interned key (hash computed once, at interning)
+  //
+  const RegistryItemI * FindItem (const RgKey  & key) const; ///< null if missing
+  const RegistryItemI * FindItem (const RgIKey & key) const; ///< null if missing
+  bool   Exists       (const RgIKey & key) const;
+  bool   ItemIsLocal  (const RgIKey & key) const;
+  template<class T>
+    void Get          (const RgIKey & key, T & item) const;
+
+  //! Changes whenever entries are added, removed or replaced (never reused,
+  //! even across registries), so that lookup results can be cached
+  unsigned long Version (void) const { return fVersion; }
 
   int    NEntries     (void) const;                     ///< get number of items
   bool   Exists       (RgKey key) const;                ///< item with input key exists?
@@ -175,12 +221,85 @@ private:
 
   RegistryItemI * CloneRegistryItem( const RgKey & key ) const ;   ///< Properly clone a registry Item according to its type
 
+  template<class T> friend class RgHandle;
+  void AbortOnTypeMismatch (const RgKey & key) const;
+
+  // Hash index over fRegistry
+  //
+  struct IndexSlot {
+    const RgIKey::Entry * key;   ///< interned key, null for empty slots
+    RgIMapIter            entry;
+  };
+  RgIMapIter Find        (const RgKey & key, size_t hash) const;
+  RgIMapIter Find        (const RgIKey & key) const;
+  RgIMapIter Insert      (const RgKey & key, RegistryItemI * item);
+  void       IndexInsert (RgIMapIter entry);
+  void       RebuildIndex(void);
+  void       Touch       (void);
+
   // Registry's private data members
   //
   string fName;              ///< registry's name
   bool   fIsReadOnly;        ///< is read only?
   bool   fInhibitItemLocks;  ///<
   RgIMap fRegistry;          ///< 'key' -> 'value' map
+
+  vector<IndexSlot> fIndex;      ///< open-addressing hash index (size is a power of 2)
+  size_t            fIndexUsed;  ///< number of occupied index slots
+  unsigned long     fVersion;    ///< see Version()
+};
+
+//____________________________________________________________________________
+template<class T>
+  void Registry::Get(const RgIKey & key, T & item) const
+{
+  const RegistryItem<T> * ri =
+     dynamic_cast<const RegistryItem<T> *> (this->SafeFind(key)->second);
+  if(!ri) this->AbortOnTypeMismatch(key.Key());
+  item = ri->Data();
+}
+
+//____________________________________________________________________________
+//
+// Typed, cached handle to a registry parameter read repeatedly. The handle
+// remembers the item found in the last registry it was used with and looks
+// it up again only when a different registry is given, or the registry
+// entries have changed since. A handle is not safe to be shared between
+// threads, but it can be a data member of (thread-local) algorithms.
+//
+template<class T> class RgHandle {
+public:
+  explicit RgHandle(const RgKey & key) :
+    fKey(key), fRegistry(0), fVersion(0), fItem(0) { }
+
+  const RgIKey & Key (void) const { return fKey; }
+
+  //! The item in the input registry, null if missing or of a different type
+  const RegistryItem<T> * Find (const Registry & r) const {
+    if(&r != fRegistry || r.Version() != fVersion) {
+      fRegistry = &r;
+      fVersion  = r.Version();
+      fItem     = dynamic_cast<const RegistryItem<T> *> (r.FindItem(fKey));
+    }
+    return fItem;
+  }
+  bool Exists (const Registry & r) const { return this->Find(r) != 0; }
+
+  //! The item value; aborts if missing (like Registry::Get)
+  const T & Get (const Registry & r) const {
+    const RegistryItem<T> * ri = this->Find(r);
+    if(!ri) {
+      r.SafeFind(fKey);
+      r.AbortOnTypeMismatch(fKey.Key());
+    }
+    return ri->Data();
+  }
+
+private:
+  RgIKey                          fKey;
+  mutable const Registry *        fRegistry;
+  mutable unsigned long           fVersion;
+  mutable const RegistryItem<T> * fItem;
 };
 
 }        // genie namespace
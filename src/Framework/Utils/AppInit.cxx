@@ -10,6 +10,12 @@
 
 // for exit()
 #include <cstdlib>
+#include <sstream>
+#include <vector>
+
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
 
 #include <TSystem.h>
 
@@ -22,9 +28,16 @@
 #include "Framework/Utils/AppInit.h"
 #include "Framework/Utils/StringUtils.h"
 #include "Framework/Utils/XmlParserUtils.h"
+#include "Framework/Utils/StartupProfiler.h"
+#include "Framework/Utils/ThreadPool.h"
 
+using std::ostringstream;
+using std::vector;
 using namespace genie;
 
+// process ids of the forked workers (see ForkWorkers())
+static vector<pid_t> gWorkerPids;
+
 //___________________________________________________________________________
 
 void genie::utils::app_init::RandGen(long int seed)
@@ -35,9 +48,14 @@ void genie::utils::app_init::RandGen(long int seed)
   }
 }
 //___________________________________________________________________________
-void genie::utils::app_init::XSecTable (string inpfile, bool require_table)
+void genie::utils::app_init::XSecTable (
+   string inpfile, bool require_table, bool defer)
 {
   // Load cross-section splines using file specified at the command-line.
+  // If defer is set, the splines are not loaded here but, later on, only for
+  // the initial states needed by the job (see XSecSplineList::LoadDeferred())
+
+  StartupTimer timer("Cross-section spline loading");
 
   XSecSplineList * xspl = XSecSplineList::Instance();
 
@@ -60,7 +78,9 @@ void genie::utils::app_init::XSecTable (string inpfile, bool require_table)
   // file was specified & exists - load table
   if (utils::system::FileExists(fullinpfile)) {
     xspl = XSecSplineList::Instance();
-    XmlParserStatus_t status = xspl->LoadFromXml(fullinpfile);
+    xspl->DeferLoading(defer);
+    XmlParserStatus_t status = xspl->Load(fullinpfile);
+    xspl->DeferLoading(false);
     if (status != kXmlOK) {
       LOG("AppInit", pFATAL)
          << "Problem reading file: " << expandedinpfile;
@@ -121,3 +141,85 @@ void genie::utils::app_init::CacheFile(string inp_file)
   }
 }
 //___________________________________________________________________________
+//___________________________________________________________________________
+int genie::utils::app_init::ForkWorkers(int nworkers)
+{
+  if(nworkers <= 1) return 0;
+
+  RandomGen * rnd = RandomGen::Instance();
+  long int seed = rnd->GetSeed();
+
+  // the pool threads are not carried over to the workers: stop them before
+  // forking and restart them in every process
+  unsigned int nthreads = ThreadPool::Instance()->NThreads();
+  ThreadPool::Instance()->SetNThreads(1);
+
+  LOG("AppInit", pNOTICE)
+    << "Forking " << nworkers-1 << " event generation worker processes";
+
+  int iworker = 0;
+  for(int iw = 1; iw < nworkers; iw++) {
+    pid_t pid = fork();
+    if(pid < 0) {
+      LOG("AppInit", pFATAL) << "Couldn't fork event generation worker " << iw;
+      gAbortingInErr = true;
+      exit(1);
+    }
+    if(pid == 0) {
+      gWorkerPids.clear();
+      iworker = iw;
+      break;
+    }
+    gWorkerPids.push_back(pid);
+  }
+
+  if(iworker > 0) {
+    // derive the worker seed from the key (job seed, worker) through the
+    // SplitMix64 finalizer, as for the RandomGen keyed streams, so that
+    // jobs with neighbouring seeds don't share worker seeds
+    ULong64_t key[2] = { (ULong64_t) seed, (ULong64_t) iworker };
+    ULong64_t h = 0x9E3779B97F4A7C15ULL;
+    for(int i = 0; i < 2; i++) {
+      h ^= key[i];
+      h += 0x9E3779B97F4A7C15ULL;
+      h  = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ULL;
+      h  = (h ^ (h >> 27)) * 0x94D049BB133111EBULL;
+      h  =  h ^ (h >> 31);
+    }
+    long int wseed = (long int) ((h ^ (h >> 32)) & 0x7FFFFFFF);
+    rnd->SetSeed( (wseed == 0) ? 1 : wseed );
+    LOG("AppInit", pNOTICE)
+      << "Event generation worker " << iworker << " (pid: " << getpid()
+      << ") using random number seed " << rnd->GetSeed();
+  }
+
+  ThreadPool::Instance()->SetNThreads(nthreads);
+
+  return iworker;
+}
+//___________________________________________________________________________
+bool genie::utils::app_init::WaitForWorkers(void)
+{
+  bool ok = true;
+  for(unsigned int i = 0; i < gWorkerPids.size(); i++) {
+    int status = 0;
+    waitpid(gWorkerPids[i], &status, 0);
+    bool worker_ok = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    if(!worker_ok) {
+      LOG("AppInit", pERROR)
+        << "Event generation worker " << i+1 << " (pid: " << gWorkerPids[i]
+        << ") failed";
+    }
+    ok = ok && worker_ok;
+  }
+  gWorkerPids.clear();
+  return ok;
+}
+//___________________________________________________________________________
+string genie::utils::app_init::WorkerFilename(string filename, int iworker)
+{
+  ostringstream name;
+  name << filename << ".w" << iworker;
+  return name.str();
+}
+//___________________________________________________________________________
@@ -26,10 +26,24 @@ namespace utils {
 namespace app_init
 {
   void RandGen        (long int seed);
-  void XSecTable      (string inpfile, bool require_table);
+  void XSecTable      (string inpfile, bool require_table, bool defer = false);
   void MesgThresholds (string inpfile);
   void CacheFile      (string inpfile);
 
+  // Multi-process event generation (see eg gevgen --nworkers):
+  // ForkWorkers() forks nworkers-1 worker processes once the expensive job
+  // initialization is done, so that all workers inherit the initialized
+  // state (copy-on-write). Each worker re-seeds the random number generator
+  // with a seed derived from the job seed and the worker index (worker 0,
+  // the parent process, keeps the job seed) and restarts the thread pool.
+  // Returns the index of the calling worker. WaitForWorkers(), called by
+  // the parent process only, waits for the forked workers to finish and
+  // returns false if any failed. WorkerFilename() gives the output file
+  // of each worker, to be merged by the parent process.
+  int    ForkWorkers    (int nworkers);
+  bool   WaitForWorkers (void);
+  string WorkerFilename (string filename, int iworker);
+
 } // app_init namespace
 } // utils namespace
 } // genie namespace
@@ -10,6 +10,7 @@
 
 #include <sstream>
 #include <iostream>
+#include <functional>
 
 #include <TSystem.h>
 #include <TDirectory.h>
@@ -32,13 +33,14 @@ ostream & operator << (ostream & stream, const Cache & cache)
   return stream;
 }
 //____________________________________________________________________________
-Cache * Cache::fInstance = 0;
+thread_local Cache * Cache::fInstance = 0;
 //____________________________________________________________________________
 Cache::Cache()
 {
   fInstance  = 0;
   fCacheMap  = 0;
   fCacheFile = 0;
+  fRevision  = 0;
 }
 //____________________________________________________________________________
 Cache::~Cache()
@@ -67,7 +69,7 @@ Cache::~Cache()
 Cache * Cache::Instance()
 {
   if(fInstance == 0) {
-    static Cache::Cleaner cleaner;
+    static thread_local Cache::Cleaner cleaner;
     cleaner.DummyMethodAndSilentCompiler();
 
     fInstance = new Cache;
@@ -85,9 +87,10 @@ CacheBranchI * Cache::FindCacheBranch(string key)
   return map_iter->second;
 }
 //____________________________________________________________________________
-void Cache::AddCacheBranch(string key, CacheBranchI * branch)
+void Cache::AddCacheBranch(string key, CacheBranchI * branch, bool build_only)
 {
   fCacheMap->insert( map<string, CacheBranchI *>::value_type(key,branch) );
+  if(build_only) fBuildOnlyKeys.insert(key);
 }
 //____________________________________________________________________________
 string Cache::CacheBranchKey(string k0, string k1, string k2) const
@@ -101,15 +104,45 @@ string Cache::CacheBranchKey(string k0, string k1, string k2) const
   return key.str();
 }
 //____________________________________________________________________________
+CacheBranchI * Cache::FindCacheBranch(uint64_t hkey) const
+{
+  std::unordered_map<uint64_t, CacheBranchI *>::const_iterator it =
+                                                     fCacheIndex.find(hkey);
+  if (it == fCacheIndex.end()) return 0;
+  return it->second;
+}
+//____________________________________________________________________________
+void Cache::IndexCacheBranch(uint64_t hkey, CacheBranchI * branch)
+{
+  fCacheIndex[hkey] = branch;
+}
+//____________________________________________________________________________
+uint64_t Cache::CacheBranchHash(
+                     const string & k0, uint64_t k1, const string & k2)
+{
+  uint64_t h = 14695981039346656037ULL;
+  uint64_t fields[3] = { (uint64_t) std::hash<string>()(k0), k1,
+                         (uint64_t) std::hash<string>()(k2) };
+  for(int i = 0; i < 3; i++) {
+    h ^= fields[i];
+    h *= 1099511628211ULL;
+  }
+  return h;
+}
+//____________________________________________________________________________
 void Cache::RmCacheBranch(string key)
 {
   LOG("Cache", pNOTICE) << "Removing cache branch: " << key;
+  fRevision++;
+  fCacheIndex.clear();
 
 }
 //____________________________________________________________________________
 void Cache::RmAllCacheBranches(void)
 {
   LOG("Cache", pNOTICE) << "Removing cache branches";
+  fRevision++;
+  fCacheIndex.clear();
 
   if(fCacheMap) {
     map<string, CacheBranchI * >::iterator citer;
@@ -122,12 +155,54 @@ void Cache::RmAllCacheBranches(void)
     }
     fCacheMap->clear();
   }
+  fBuildOnlyKeys.clear();
 }
 //____________________________________________________________________________
 void Cache::RmMatchedCacheBranches(string key_substring)
 {
   LOG("Cache", pNOTICE) << "Removing cache branches: *"<< key_substring<< "*";
+  fRevision++;
+  fCacheIndex.clear();
+
+}
+//____________________________________________________________________________
+void Cache::RmBuildOnlyCacheBranches(void)
+{
+  if(fBuildOnlyKeys.empty()) return;
 
+  // branches are only saved to the cache file on exit: keep them all
+  if(fCacheFile) {
+    LOG("Cache", pNOTICE)
+       << "Keeping build-only cache branches (to be saved in the cache file)";
+    return;
+  }
+
+  LOG("Cache", pNOTICE)
+     << "Removing " << fBuildOnlyKeys.size() << " build-only cache branches";
+  fRevision++;
+  fCacheIndex.clear();
+
+  set<string>::const_iterator kiter = fBuildOnlyKeys.begin();
+  for( ; kiter != fBuildOnlyKeys.end(); ++kiter) {
+    map<string, CacheBranchI * >::iterator citer = fCacheMap->find(*kiter);
+    if(citer == fCacheMap->end()) continue;
+    delete citer->second;
+    fCacheMap->erase(citer);
+  }
+  fBuildOnlyKeys.clear();
+}
+//____________________________________________________________________________
+size_t Cache::MemoryFootprint(void) const
+{
+  size_t bytes = sizeof(Cache);
+  if(!fCacheMap) return bytes;
+
+  map<string, CacheBranchI * >::const_iterator citer;
+  for(citer = fCacheMap->begin(); citer != fCacheMap->end(); ++citer) {
+    bytes += citer->first.capacity();
+    if(citer->second) bytes += citer->second->MemoryFootprint();
+  }
+  return bytes;
 }
 //____________________________________________________________________________
 void Cache::Load(void)
@@ -18,13 +18,17 @@
 #ifndef _CACHE_H_
 #define _CACHE_H_
 
+#include <cstdint>
 #include <map>
+#include <set>
 #include <string>
 #include <ostream>
+#include <unordered_map>
 
 #include <TFile.h>
 
 using std::map;
+using std::set;
 using std::string;
 using std::ostream;
 
@@ -39,20 +43,41 @@ class Cache
 {
 public:
 
+  //! Access instance (one per thread, as cached results are typically
+  //! computed from the calling thread's own algorithm instances)
   static Cache * Instance(void);
 
   //! cache file
   void OpenCacheFile (string filename);
 
-  //! finding/adding cache branches
+  //! finding/adding cache branches. Build-only branches hold intermediate
+  //! results only needed while cross section splines are being built (eg
+  //! the integrated cross sections they are computed from) and can be
+  //! dropped with RmBuildOnlyCacheBranches() once the splines are ready
   CacheBranchI * FindCacheBranch (string key);
-  void           AddCacheBranch  (string key, CacheBranchI * branch);
+  void           AddCacheBranch  (string key, CacheBranchI * branch, bool build_only = false);
   string         CacheBranchKey  (string k0, string k1="", string k2="") const;
 
+  //! hash-keyed finding of cache branches: a branch indexed by a 64-bit
+  //! hash key (typically built from the algorithm key and Interaction::Hash(),
+  //! see CacheBranchHash()) can be found again without building its string
+  //! key. The index is not persistent, and is cleared when branches are removed
+  CacheBranchI *  FindCacheBranch  (uint64_t hkey) const;
+  void            IndexCacheBranch (uint64_t hkey, CacheBranchI * branch);
+  static uint64_t CacheBranchHash  (const string & k0, uint64_t k1, const string & k2="");
+
   //! removing cache branches
   void RmCacheBranch         (string key);
   void RmAllCacheBranches    (void);
   void RmMatchedCacheBranches(string key_substring);
+  void RmBuildOnlyCacheBranches(void);
+
+  //! approximate memory held by the cache branches, in bytes
+  size_t MemoryFootprint (void) const;
+
+  //! incremented whenever cache branches are removed: clients holding
+  //! CacheBranchI pointers must look them up again if it changed
+  long Revision (void) const { return fRevision; }
 
   //! print cache buffers
   void   Print (ostream & stream) const;
@@ -65,11 +90,14 @@ private:
   void Save (void);
 
   //! singleton instance
-  static Cache * fInstance;
+  static thread_local Cache * fInstance;
 
   //! map of cache buffers & cache file
-  map<string, CacheBranchI * > * fCacheMap;
-  TFile *                        fCacheFile;
+  map<string, CacheBranchI * > *                 fCacheMap;
+  std::unordered_map<uint64_t, CacheBranchI * >  fCacheIndex; ///< hash key -> branch (see IndexCacheBranch())
+  set<string>                                    fBuildOnlyKeys; ///< keys of build-only branches
+  TFile *                                        fCacheFile;
+  long                                           fRevision;
 
   //! singleton class: constructors are private
   Cache();
@@ -0,0 +1,149 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <algorithm>
+
+#include "Framework/Utils/CacheBranchEnvelope.h"
+
+using std::endl;
+
+using namespace genie;
+
+ClassImp(CacheBranchEnvelope);
+
+//____________________________________________________________________________
+namespace genie
+{
+  ostream & operator << (ostream & stream, const CacheBranchEnvelope & cbenv)
+  {
+     cbenv.Print(stream);
+     return stream;
+  }
+}
+//____________________________________________________________________________
+CacheBranchEnvelope::CacheBranchEnvelope(void) :
+CacheBranchI()
+{
+  this->Init(1);
+}
+//____________________________________________________________________________
+CacheBranchEnvelope::CacheBranchEnvelope(string name, unsigned int nbins) :
+CacheBranchI()
+{
+  this->Init(nbins);
+  fName = name;
+}
+//____________________________________________________________________________
+CacheBranchEnvelope::~CacheBranchEnvelope()
+{
+
+}
+//____________________________________________________________________________
+void CacheBranchEnvelope::Init(unsigned int nbins)
+{
+  fName     = "";
+  fNBins    = std::max(nbins, 1u);
+  fBuilt    = false;
+  fCDFReady = false;
+
+  fValues.assign(fNBins*fNBins, 0.);
+  fCDF.clear();
+}
+//____________________________________________________________________________
+void CacheBranchEnvelope::Reset(void)
+{
+  this->Init(fNBins);
+}
+//____________________________________________________________________________
+double CacheBranchEnvelope::Generate(
+         double r1, double r2, double r3, double & u, double & v) const
+{
+  if(!fCDFReady) this->BuildCDF();
+
+  // select a cell with probability proportional to its value
+  double t = r1 * fCDF.back();
+  unsigned int ic =
+      std::upper_bound(fCDF.begin(), fCDF.end(), t) - fCDF.begin();
+  ic = std::min(ic, fNBins*fNBins-1);
+
+  unsigned int iu = ic / fNBins;
+  unsigned int iv = ic % fNBins;
+
+  u = (iu + r2) / fNBins;
+  v = (iv + r3) / fNBins;
+
+  return fValues[ic];
+}
+//____________________________________________________________________________
+double CacheBranchEnvelope::Value(double u, double v) const
+{
+  return fValues[this->FindBin(u) * fNBins + this->FindBin(v)];
+}
+//____________________________________________________________________________
+void CacheBranchEnvelope::SetCell(unsigned int iu, unsigned int iv, double value)
+{
+  fValues[iu*fNBins + iv] = value;
+  fCDFReady = false;
+}
+//____________________________________________________________________________
+double CacheBranchEnvelope::Cell(unsigned int iu, unsigned int iv) const
+{
+  return fValues[iu*fNBins + iv];
+}
+//____________________________________________________________________________
+void CacheBranchEnvelope::Raise(double u, double v, double value)
+{
+  unsigned int ic = this->FindBin(u) * fNBins + this->FindBin(v);
+  if(value > fValues[ic]) {
+    fValues[ic] = value;
+    fCDFReady   = false;
+  }
+}
+//____________________________________________________________________________
+double CacheBranchEnvelope::Integral(void) const
+{
+  if(!fCDFReady) this->BuildCDF();
+  return fCDF.back();
+}
+//____________________________________________________________________________
+unsigned int CacheBranchEnvelope::FindBin(double x) const
+{
+  int i = (int) (x * fNBins);
+  if(i < 0) i = 0;
+  if(i > (int)fNBins-1) i = fNBins-1;
+  return i;
+}
+//____________________________________________________________________________
+void CacheBranchEnvelope::BuildCDF(void) const
+{
+  fCDF.resize(fValues.size());
+  double sum = 0;
+  for(unsigned int i = 0; i < fValues.size(); i++) {
+    sum += std::max(fValues[i], 0.);
+    fCDF[i] = sum;
+  }
+  fCDFReady = true;
+}
+//____________________________________________________________________________
+size_t CacheBranchEnvelope::MemoryFootprint(void) const
+{
+  return sizeof(CacheBranchEnvelope) + fName.capacity() +
+         sizeof(double) * (fValues.capacity() + fCDF.capacity());
+}
+//____________________________________________________________________________
+void CacheBranchEnvelope::Print(ostream & stream) const
+{
+  stream << "type:   [CacheBranchEnvelope]" << endl;
+  stream << "name:   " << fName << endl;
+  stream << "bins:   " << fNBins << " x " << fNBins << endl;
+  stream << "status: " << (fBuilt ? "built" : "not built")
+         << ", integral = " << this->Integral() << endl;
+}
+//____________________________________________________________________________
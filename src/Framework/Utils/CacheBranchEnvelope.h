@@ -0,0 +1,101 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::CacheBranchEnvelope
+
+\brief    A cache branch storing a tabulated 2-D rejection envelope over
+          the unit square.
+
+          The envelope is piecewise constant on N x N equal cells. Points
+          (u,v) are generated with a density proportional to it: a cell is
+          selected with probability proportional to its value and the point
+          is sampled uniformly within it. Unweighting a function f bounded
+          by the envelope with probability f(u,v)/Value(u,v) then gives
+          points distributed as f.
+
+          A cell value found too low when generating events can be raised
+          with Raise().
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _CACHE_BRANCH_ENVELOPE_H_
+#define _CACHE_BRANCH_ENVELOPE_H_
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Framework/Utils/CacheBranchI.h"
+
+using std::string;
+using std::ostream;
+using std::vector;
+
+namespace genie {
+
+class CacheBranchEnvelope;
+ostream & operator << (ostream & stream, const CacheBranchEnvelope & cbenv);
+
+class CacheBranchEnvelope : public CacheBranchI
+{
+public:
+  using TObject::Print; // suppress clang 'hides overloaded virtual function [-Woverloaded-virtual]' warnings
+
+  CacheBranchEnvelope();
+  CacheBranchEnvelope(string name, unsigned int nbins = 30);
+  ~CacheBranchEnvelope();
+
+  //! Maps three uniform random numbers in [0,1) to a point (u,v) of the
+  //! unit square, distributed according to the envelope. Returns the
+  //! envelope value at that point.
+  double Generate (double r1, double r2, double r3, double & u, double & v) const;
+
+  //! Envelope value at (u,v)
+  double Value    (double u, double v) const;
+
+  //! Envelope value in cell (iu,iv), covering [iu/N, (iu+1)/N] x [iv/N, (iv+1)/N]
+  void   SetCell  (unsigned int iu, unsigned int iv, double value);
+  double Cell     (unsigned int iu, unsigned int iv) const;
+
+  //! Raises the envelope value of the cell including (u,v), if lower
+  void   Raise    (double u, double v, double value);
+
+  //! Sum of the cell values
+  double Integral (void) const;
+
+  void   SetBuilt (bool built) { fBuilt = built; }
+  bool   IsBuilt  (void) const { return fBuilt; }
+
+  unsigned int NBins (void) const { return fNBins; }
+
+  void   Reset           (void);
+  void   Print           (ostream & stream) const;
+  size_t MemoryFootprint (void) const;
+
+  friend ostream & operator << (ostream & stream, const CacheBranchEnvelope & cbenv);
+
+private:
+  void         Init     (unsigned int nbins);
+  unsigned int FindBin  (double x) const;
+  void         BuildCDF (void) const;
+
+  string           fName;      ///< cache branch name
+  unsigned int     fNBins;     ///< number of bins per axis
+  vector<double>   fValues;    ///< value of cell (iu,iv) at [iu*fNBins+iv]
+  bool             fBuilt;     ///< have the cell values been computed?
+  mutable vector<double> fCDF; //! cumulative sum of the cell values
+  mutable bool     fCDFReady;  //!
+
+ClassDef(CacheBranchEnvelope,1)
+};
+
+}      // genie namespace
+#endif // _CACHE_BRANCH_ENVELOPE_H_
@@ -8,6 +8,8 @@
 */
 //____________________________________________________________________________
 
+#include <algorithm>
+
 #include "Framework/Utils/CacheBranchFx.h"
 
 using namespace genie;
@@ -46,12 +48,14 @@ void CacheBranchFx::Init(void)
 {
   fName   = "";
   fSpline = 0;
+  fFrozen = false;
 }
 //____________________________________________________________________________
 void CacheBranchFx::CleanUp(void)
 {
   if(fSpline) delete fSpline;
-  fFx.clear();
+  fX.clear();
+  fY.clear();
 }
 //____________________________________________________________________________
 void CacheBranchFx::Reset(void)
@@ -62,36 +66,71 @@ void CacheBranchFx::Reset(void)
 //____________________________________________________________________________
 void CacheBranchFx::AddValues(double x, double y)
 {
-  fFx.insert(map<double,double>::value_type(x,y));
+  if(fFrozen) return;
+
+  // common case: values added in increasing x
+  if(fX.empty() || x > fX.back()) {
+    fX.push_back(x);
+    fY.push_back(y);
+    return;
+  }
+  vector<double>::iterator it = std::lower_bound(fX.begin(), fX.end(), x);
+  if(*it == x) return;
+
+  size_t i = it - fX.begin();
+  fX.insert(it, x);
+  fY.insert(fY.begin() + i, y);
 }
 //____________________________________________________________________________
 void CacheBranchFx::CreateSpline(void)
 {
-  int n = fFx.size();
-  double * x = new double[n];
-  double * y = new double[n];
-
-  int i=0;
-  map<double,double>::const_iterator iter = fFx.begin();
-  for( ; iter !=fFx.end(); ++iter) {
-    x[i] = iter->first;
-    y[i] = iter->second;
-    i++;
-  }
+  if(fFrozen) return;
 
   if(fSpline) delete fSpline;
-  fSpline = new Spline(n,x,y);
+  fSpline = new Spline(fX.size(), fX.data(), fY.data());
+}
+//____________________________________________________________________________
+bool CacheBranchFx::Interpolate(double x, double & y) const
+{
+  size_t n = fX.size();
+  if(n < 2 || x < fX.front() || x > fX.back()) return false;
 
-  delete [] x;
-  delete [] y;
+  size_t i = std::upper_bound(fX.begin(), fX.end(), x) - fX.begin();
+  if(i == n) {
+    y = fY.back();
+    return true;
+  }
+  double x0 = fX[i-1], x1 = fX[i];
+  double y0 = fY[i-1], y1 = fY[i];
+  y = y0 + (y1-y0) * (x-x0) / (x1-x0);
+  return true;
+}
+//____________________________________________________________________________
+bool CacheBranchFx::FindAbove(double x, double & xf, double & yf) const
+{
+  vector<double>::const_iterator it =
+      std::lower_bound(fX.begin(), fX.end(), x);
+  if(it == fX.end()) return false;
+
+  xf = *it;
+  yf = fY[it - fX.begin()];
+  return true;
 }
 //____________________________________________________________________________
 void CacheBranchFx::Print(ostream & stream) const
 {
-  stream << "type: [CacheBranchFx]  - nentries: " << fFx.size()
+  stream << "type: [CacheBranchFx]  - nentries: " << fX.size()
            << " / spline: " << ((fSpline) ? "built" : "null");
 }
 //____________________________________________________________________________
+size_t CacheBranchFx::MemoryFootprint(void) const
+{
+  size_t bytes = sizeof(CacheBranchFx) + fName.capacity() +
+                 sizeof(double) * (fX.capacity() + fY.capacity());
+  if(fSpline) bytes += fSpline->MemoryFootprint();
+  return bytes;
+}
+//____________________________________________________________________________
 double CacheBranchFx::operator () (double x) const
 {
   if(!fSpline) return 0;
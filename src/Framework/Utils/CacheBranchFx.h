@@ -3,7 +3,17 @@
 
 \class    genie::CacheBranchFx
 
-\brief    A simple cache branch storing the cached data in a TNtuple
+\brief    A simple cache branch storing cached y = f(x) values.
+
+          The values are kept in flat arrays sorted in x: appending values
+          in increasing x is amortized O(1). Besides the (optional) spline
+          built over all values, the branch provides a piecewise-linear
+          interpolation over the stored values that needs no rebuild as
+          values are added (see Interpolate()).
+
+          Once frozen (see Freeze()), a branch no longer accepts values and
+          all its access methods are read-only, so that it can be shared by
+          concurrent readers.
 
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
@@ -20,14 +30,14 @@
 
 #include <iostream>
 #include <string>
-#include <map>
+#include <vector>
 
 #include "Framework/Numerical/Spline.h"
 #include "Framework/Utils/CacheBranchI.h"
 
 using std::string;
 using std::ostream;
-using std::map;
+using std::vector;
 
 namespace genie {
 
@@ -43,14 +53,28 @@ public:
   CacheBranchFx(string name);
   ~CacheBranchFx();
 
-  const map<double,double> & Map (void) const { return fFx;     }
-  Spline *                   Spl (void) const { return fSpline; }
+  unsigned int           NPoints (void) const { return fX.size(); }
+  const vector<double> & X       (void) const { return fX;        }
+  const vector<double> & Y       (void) const { return fY;        }
+  Spline *               Spl     (void) const { return fSpline;   }
+
+  void CreateSpline (void);
+  void AddValues    (double x, double y);  ///< ignored if x is already stored or if frozen
+
+  //! Piecewise-linear interpolation over the stored values. Returns false
+  //! if x is outside the range of stored values.
+  bool Interpolate  (double x, double & y) const;
+
+  //! Finds the stored value with the smallest x >= the input x. Returns
+  //! false if there is none.
+  bool FindAbove    (double x, double & xf, double & yf) const;
 
-  void CreateSpline(void);
-  void AddValues(double x, double y);
+  void Freeze   (void)       { fFrozen = true; }
+  bool IsFrozen (void) const { return fFrozen; }
 
-  void Reset (void);
-  void Print (ostream & stream) const;
+  void   Reset           (void);
+  void   Print           (ostream & stream) const;
+  size_t MemoryFootprint (void) const;
 
   double operator () (double x) const;
   friend ostream & operator << (ostream & stream, const CacheBranchFx & cbntp);
@@ -59,11 +83,13 @@ private:
   void Init    (void);
   void CleanUp (void);
 
-  string             fName;   ///< cache branch name
-  map<double,double> fFx;     ///< x->y map
-  Spline *           fSpline; ///< spline y = f(x)
+  string         fName;   ///< cache branch name
+  vector<double> fX;      ///< x values, in increasing order
+  vector<double> fY;      ///< y values, for each x
+  Spline *       fSpline; ///< spline y = f(x)
+  bool           fFrozen; //! no more values accepted?
 
-ClassDef(CacheBranchFx,1)
+ClassDef(CacheBranchFx,2)
 };
 
 }      // genie namespace
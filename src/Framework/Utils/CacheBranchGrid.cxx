@@ -0,0 +1,201 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <cmath>
+#include <algorithm>
+
+#include "Framework/Utils/CacheBranchGrid.h"
+
+using std::endl;
+
+using namespace genie;
+
+ClassImp(CacheBranchGrid);
+
+//____________________________________________________________________________
+namespace genie
+{
+  ostream & operator << (ostream & stream, const CacheBranchGrid & cbgrid)
+  {
+     cbgrid.Print(stream);
+     return stream;
+  }
+}
+//____________________________________________________________________________
+CacheBranchGrid::CacheBranchGrid(void) :
+CacheBranchI()
+{
+  this->Init(1);
+}
+//____________________________________________________________________________
+CacheBranchGrid::CacheBranchGrid(string name, unsigned int nbins) :
+CacheBranchI()
+{
+  this->Init(nbins);
+  fName = name;
+}
+//____________________________________________________________________________
+CacheBranchGrid::~CacheBranchGrid()
+{
+
+}
+//____________________________________________________________________________
+void CacheBranchGrid::Init(unsigned int nbins)
+{
+  fName      = "";
+  fNBins     = std::max(nbins, 1u);
+  fMaxWeight = -1;
+  fTrained   = false;
+
+  fEdgesU.resize(fNBins+1);
+  fEdgesV.resize(fNBins+1);
+  for(unsigned int i = 0; i <= fNBins; i++) {
+    fEdgesU[i] = (double) i / fNBins;
+    fEdgesV[i] = (double) i / fNBins;
+  }
+  fSumU.assign(fNBins, 0.);
+  fSumV.assign(fNBins, 0.);
+}
+//____________________________________________________________________________
+void CacheBranchGrid::Reset(void)
+{
+  this->Init(fNBins);
+}
+//____________________________________________________________________________
+double CacheBranchGrid::Generate(
+                      double r1, double r2, double & u, double & v) const
+{
+  // each bin is selected with probability 1/N and sampled uniformly
+  double xu = r1 * fNBins;
+  double xv = r2 * fNBins;
+  unsigned int iu = std::min((unsigned int) xu, fNBins-1);
+  unsigned int iv = std::min((unsigned int) xv, fNBins-1);
+
+  double wu = fEdgesU[iu+1] - fEdgesU[iu];
+  double wv = fEdgesV[iv+1] - fEdgesV[iv];
+
+  u = fEdgesU[iu] + (xu - iu) * wu;
+  v = fEdgesV[iv] + (xv - iv) * wv;
+
+  return 1. / (fNBins * wu * fNBins * wv);
+}
+//____________________________________________________________________________
+double CacheBranchGrid::Density(double u, double v) const
+{
+  unsigned int iu = this->FindBin(fEdgesU, u);
+  unsigned int iv = this->FindBin(fEdgesV, v);
+
+  double wu = fEdgesU[iu+1] - fEdgesU[iu];
+  double wv = fEdgesV[iv+1] - fEdgesV[iv];
+
+  return 1. / (fNBins * wu * fNBins * wv);
+}
+//____________________________________________________________________________
+void CacheBranchGrid::Fill(double u, double v, double w)
+{
+  if(fSumU.size() != fNBins) fSumU.assign(fNBins, 0.);
+  if(fSumV.size() != fNBins) fSumV.assign(fNBins, 0.);
+
+  fSumU[this->FindBin(fEdgesU, u)] += w*w;
+  fSumV[this->FindBin(fEdgesV, v)] += w*w;
+}
+//____________________________________________________________________________
+void CacheBranchGrid::Refine(double alpha)
+{
+  if(fSumU.size() == fNBins) this->RefineAxis(fEdgesU, fSumU, alpha);
+  if(fSumV.size() == fNBins) this->RefineAxis(fEdgesV, fSumV, alpha);
+
+  fSumU.assign(fNBins, 0.);
+  fSumV.assign(fNBins, 0.);
+}
+//____________________________________________________________________________
+unsigned int CacheBranchGrid::FindBin(
+                            const vector<double> & edges, double x) const
+{
+  vector<double>::const_iterator it =
+                      std::upper_bound(edges.begin(), edges.end(), x);
+  int i = (it - edges.begin()) - 1;
+  if(i < 0) i = 0;
+  if(i > (int)fNBins-1) i = fNBins-1;
+  return i;
+}
+//____________________________________________________________________________
+void CacheBranchGrid::RefineAxis(
+               vector<double> & edges, vector<double> & d, double alpha)
+{
+// Standard VEGAS rebinning: the accumulated w^2 in each bin is smoothed
+// and compressed, and the bin edges are moved so that every new bin holds
+// an equal share of it. A floor keeps every bin at a finite width so that
+// the proposal density never vanishes where the function is nonzero.
+
+  unsigned int N = fNBins;
+  if(N < 2) return;
+
+  vector<double> ds(N);
+  ds[0]   = (d[0]   + d[1]  ) / 2.;
+  ds[N-1] = (d[N-2] + d[N-1]) / 2.;
+  for(unsigned int i = 1; i < N-1; i++) {
+    ds[i] = (d[i-1] + d[i] + d[i+1]) / 3.;
+  }
+  double sum = 0;
+  for(unsigned int i = 0; i < N; i++) sum += ds[i];
+  if(sum <= 0) return;
+
+  vector<double> r(N);
+  double rsum = 0;
+  for(unsigned int i = 0; i < N; i++) {
+    double f = ds[i] / sum;
+    if     (f <= 0) r[i] = 0;
+    else if(f >= 1) r[i] = 1;
+    else            r[i] = std::pow((1.-f) / std::log(1./f), alpha);
+    rsum += r[i];
+  }
+  if(rsum <= 0) return;
+
+  double rfloor = 1E-3 * rsum / N;
+  rsum = 0;
+  for(unsigned int i = 0; i < N; i++) {
+    r[i] = std::max(r[i], rfloor);
+    rsum += r[i];
+  }
+
+  vector<double> old(edges);
+  double delta = rsum / N;
+  double acc   = 0;
+  unsigned int j = 0;
+  for(unsigned int i = 1; i < N; i++) {
+    double target = i * delta;
+    while(j < N-1 && acc + r[j] < target) {
+      acc += r[j];
+      j++;
+    }
+    double frac = std::min(1., (target - acc) / r[j]);
+    edges[i] = old[j] + (old[j+1] - old[j]) * frac;
+  }
+  edges[0] = 0.;
+  edges[N] = 1.;
+}
+//____________________________________________________________________________
+size_t CacheBranchGrid::MemoryFootprint(void) const
+{
+  return sizeof(CacheBranchGrid) + fName.capacity() +
+         sizeof(double) * (fEdgesU.capacity() + fEdgesV.capacity() +
+                           fSumU.capacity()   + fSumV.capacity());
+}
+//____________________________________________________________________________
+void CacheBranchGrid::Print(ostream & stream) const
+{
+  stream << "type:   [CacheBranchGrid]" << endl;
+  stream << "name:   " << fName << endl;
+  stream << "bins:   " << fNBins << " x " << fNBins << endl;
+  stream << "status: " << (fTrained ? "trained" : "not trained")
+         << ", max weight = " << fMaxWeight << endl;
+}
+//____________________________________________________________________________
@@ -0,0 +1,100 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::CacheBranchGrid
+
+\brief    A cache branch storing an adaptive (VEGAS-style) importance
+          sampling grid over the unit square.
+
+          The proposal density is the product of two 1-D step densities,
+          each defined by N bins of variable width but equal probability.
+          The grid is learnt iteratively: points are generated with the
+          current grid, their weights (f/g) are filled in with Fill(), and
+          Refine() moves the bin edges so that the bins shrink where the
+          sampled function is large.
+
+          The branch also keeps the max weight found over the learnt grid,
+          used to unweight the generated samples.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _CACHE_BRANCH_GRID_H_
+#define _CACHE_BRANCH_GRID_H_
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Framework/Utils/CacheBranchI.h"
+
+using std::string;
+using std::ostream;
+using std::vector;
+
+namespace genie {
+
+class CacheBranchGrid;
+ostream & operator << (ostream & stream, const CacheBranchGrid & cbgrid);
+
+class CacheBranchGrid : public CacheBranchI
+{
+public:
+  using TObject::Print; // suppress clang 'hides overloaded virtual function [-Woverloaded-virtual]' warnings
+
+  CacheBranchGrid();
+  CacheBranchGrid(string name, unsigned int nbins = 50);
+  ~CacheBranchGrid();
+
+  //! Maps two uniform random numbers in [0,1) to a point (u,v) of the
+  //! unit square, distributed according to the grid. Returns the proposal
+  //! density g(u,v) at that point.
+  double Generate (double r1, double r2, double & u, double & v) const;
+
+  //! Proposal density g(u,v)
+  double Density  (double u, double v) const;
+
+  // learning
+  void Fill   (double u, double v, double w);  ///< adds a sample of weight w = f/g
+  void Refine (double alpha = 1.5);            ///< moves the bin edges, clears the filled samples
+
+  void   SetMaxWeight (double w) { fMaxWeight = w;    }
+  double MaxWeight    (void) const { return fMaxWeight; }
+
+  void   SetTrained   (bool trained) { fTrained = trained; }
+  bool   IsTrained    (void) const { return fTrained; }
+
+  unsigned int NBins (void) const { return fNBins; }
+
+  void   Reset           (void);
+  void   Print           (ostream & stream) const;
+  size_t MemoryFootprint (void) const;
+
+  friend ostream & operator << (ostream & stream, const CacheBranchGrid & cbgrid);
+
+private:
+  void         Init       (unsigned int nbins);
+  unsigned int FindBin    (const vector<double> & edges, double x) const;
+  void         RefineAxis (vector<double> & edges, vector<double> & d, double alpha);
+
+  string         fName;      ///< cache branch name
+  unsigned int   fNBins;     ///< number of bins per axis
+  vector<double> fEdgesU;    ///< bin edges along u (fNBins+1 values in [0,1])
+  vector<double> fEdgesV;    ///< bin edges along v (fNBins+1 values in [0,1])
+  double         fMaxWeight; ///< max f/g over the learnt grid (incl. safety factor)
+  bool           fTrained;   ///< has the grid been learnt?
+  vector<double> fSumU;      //! sum of w^2 of the filled samples, per u bin
+  vector<double> fSumV;      //! sum of w^2 of the filled samples, per v bin
+
+ClassDef(CacheBranchGrid,1)
+};
+
+}      // genie namespace
+#endif // _CACHE_BRANCH_GRID_H_
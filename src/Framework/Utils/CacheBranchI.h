@@ -26,6 +26,10 @@ class CacheBranchI : public TObject
 {
 public:
   virtual ~CacheBranchI() {}
+
+  //! approximate memory held by the branch, in bytes
+  virtual size_t MemoryFootprint (void) const { return sizeof(*this); }
+
 protected:
   CacheBranchI() : TObject() {}
 
@@ -0,0 +1,312 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <mutex>
+#include <sstream>
+
+#include <TChain.h>
+#include <TH1D.h>
+#include <TMath.h>
+#include <TTreeFormula.h>
+#include <TTreeFormulaManager.h>
+#include <THLimitsFinder.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/GSimFiles.h"
+#include "Framework/Utils/GSimFilesAnalyzer.h"
+#include "Framework/Utils/ThreadPool.h"
+
+using std::ostringstream;
+
+using namespace genie;
+
+//____________________________________________________________________________
+GSimFilesAnalyzer::GSimFilesAnalyzer(void)
+{
+
+}
+//____________________________________________________________________________
+GSimFilesAnalyzer::GSimFilesAnalyzer(const GSimFiles & simfiles)
+{
+  for(int imodel = 0; imodel < simfiles.NModels(); imodel++) {
+    TChain * chain = simfiles.EvtChain(imodel);
+    string tree_name = (chain) ? chain->GetName() : "gst";
+    this->AddModel(simfiles.ModelTag(imodel),
+                   simfiles.EvtFileNames(imodel), tree_name);
+  }
+}
+//____________________________________________________________________________
+GSimFilesAnalyzer::~GSimFilesAnalyzer(void)
+{
+  this->CleanUp();
+}
+//____________________________________________________________________________
+int GSimFilesAnalyzer::AddModel(
+    string tag, const vector<string> & filenames, string tree_name)
+{
+  fModelTag.push_back(tag);
+  fFileNames.push_back(filenames);
+  fTreeName.push_back(tree_name);
+  return fModelTag.size() - 1;
+}
+//____________________________________________________________________________
+int GSimFilesAnalyzer::Book(
+    string varexp, string selection, int nbins, double xmin, double xmax)
+{
+  int iplot = this->FindPlot(varexp, selection);
+  if(iplot >= 0) return iplot;
+
+  Plot plot;
+  plot.varexp    = varexp;
+  plot.selection = selection;
+  plot.nbins     = TMath::Max(1, nbins);
+  plot.xmin      = xmin;
+  plot.xmax      = xmax;
+  plot.autorange = (xmin >= xmax);
+  fPlots.push_back(plot);
+
+  return fPlots.size() - 1;
+}
+//____________________________________________________________________________
+int GSimFilesAnalyzer::FindPlot(string varexp, string selection) const
+{
+  for(unsigned int iplot = 0; iplot < fPlots.size(); iplot++) {
+    if(fPlots[iplot].varexp    == varexp &&
+       fPlots[iplot].selection == selection) return iplot;
+  }
+  return -1;
+}
+//____________________________________________________________________________
+TH1D * GSimFilesAnalyzer::Histogram(int imodel, int iplot) const
+{
+  if(imodel < 0 || imodel >= (int)fHist.size()) return 0;
+  if(iplot  < 0 || iplot  >= (int)fHist[imodel].size()) return 0;
+  return fHist[imodel][iplot];
+}
+//____________________________________________________________________________
+TH1D * GSimFilesAnalyzer::NewHistogram(
+    int imodel, int iplot, double xmin, double xmax) const
+{
+  ostringstream name;
+  name << "gsimfa_" << this << "_m" << imodel << "_p" << iplot;
+
+  const Plot & plot = fPlots[iplot];
+  TH1D * h = new TH1D(name.str().c_str(), plot.varexp.c_str(),
+                      plot.nbins, xmin, xmax);
+  h->SetDirectory(0);
+  h->GetXaxis()->SetTitle(plot.varexp.c_str());
+  return h;
+}
+//____________________________________________________________________________
+void GSimFilesAnalyzer::Process(Long64_t nmax)
+{
+  this->CleanUp();
+
+  int nmodels = this->NModels();
+  int nplots  = this->NPlots();
+
+  // Split the entries of each model sample into ranges
+  unsigned int nthreads = ThreadPool::Instance()->NThreads();
+  vector<Range> ranges;
+  for(int imodel = 0; imodel < nmodels; imodel++) {
+    TChain chain(fTreeName[imodel].c_str());
+    for(unsigned int ifile = 0; ifile < fFileNames[imodel].size(); ifile++) {
+      chain.Add(fFileNames[imodel][ifile].c_str());
+    }
+    Long64_t nentries = chain.GetEntries();
+    if(nmax >= 0) nentries = TMath::Min(nentries, nmax);
+
+    LOG("GSimFilesAnalyzer", pNOTICE)
+      << "Filling " << nplots << " plots from " << nentries
+      << " entries of model: " << fModelTag[imodel];
+
+    Long64_t nranges = TMath::Max(1LL,
+           TMath::Min((Long64_t) (4*nthreads), nentries / 10000));
+    for(Long64_t ir = 0; ir < nranges; ir++) {
+      Range range;
+      range.imodel = imodel;
+      range.first  = (nentries *  ir   ) / nranges;
+      range.last   = (nentries * (ir+1)) / nranges;
+      range.hist.assign(nplots, (TH1D *) 0);
+      range.values.resize(nplots);
+      for(int iplot = 0; iplot < nplots; iplot++) {
+        const Plot & plot = fPlots[iplot];
+        if(!plot.autorange) {
+          range.hist[iplot] =
+               this->NewHistogram(imodel, iplot, plot.xmin, plot.xmax);
+        }
+      }
+      ranges.push_back(range);
+    }
+  }
+
+  // Read the ranges concurrently
+  ThreadPool::Instance()->ParallelFor(ranges.size(),
+     [&] (int ir, unsigned int /*worker*/) {
+        this->ProcessRange(ranges[ir]);
+  });
+
+  // Merge: fixed-range plots
+  fHist.assign(nmodels, vector<TH1D *>(nplots, (TH1D *) 0));
+  for(unsigned int ir = 0; ir < ranges.size(); ir++) {
+    Range & range = ranges[ir];
+    for(int iplot = 0; iplot < nplots; iplot++) {
+      TH1D * h = range.hist[iplot];
+      if(!h) continue;
+      TH1D * & hm = fHist[range.imodel][iplot];
+      if(!hm) { hm = h; }
+      else    { hm->Add(h); delete h; }
+    }
+  }
+
+  // Merge: auto-range plots, using the range of the first sample that has
+  // entries (else the [0,1] range of an empty TTree::Draw() histogram)
+  for(int iplot = 0; iplot < nplots; iplot++) {
+    const Plot & plot = fPlots[iplot];
+    if(!plot.autorange) continue;
+
+    double xmin = 0, xmax = 1;
+    bool found = false;
+    for(int imodel = 0; imodel < nmodels && !found; imodel++) {
+      for(unsigned int ir = 0; ir < ranges.size(); ir++) {
+        if(ranges[ir].imodel != imodel) continue;
+        const vector< pair<double,double> > & v = ranges[ir].values[iplot];
+        for(unsigned int i = 0; i < v.size(); i++) {
+          if(!found) { xmin = xmax = v[i].first; found = true; }
+          xmin = TMath::Min(xmin, v[i].first);
+          xmax = TMath::Max(xmax, v[i].first);
+        }
+      }
+    }
+    if(found) {
+      if(xmin == xmax) { xmin -= 1; xmax += 1; }
+      TH1D htmp("gsimfa_limits", "", plot.nbins, xmin, xmax);
+      htmp.SetDirectory(0);
+      THLimitsFinder::GetLimitsFinder()->FindGoodLimits(&htmp, xmin, xmax);
+      xmin = htmp.GetXaxis()->GetXmin();
+      xmax = htmp.GetXaxis()->GetXmax();
+    }
+    for(int imodel = 0; imodel < nmodels; imodel++) {
+      fHist[imodel][iplot] = this->NewHistogram(imodel, iplot, xmin, xmax);
+    }
+    for(unsigned int ir = 0; ir < ranges.size(); ir++) {
+      TH1D * h = fHist[ranges[ir].imodel][iplot];
+      const vector< pair<double,double> > & v = ranges[ir].values[iplot];
+      for(unsigned int i = 0; i < v.size(); i++) h->Fill(v[i].first, v[i].second);
+    }
+  }
+
+  // Models with no entries get empty histograms
+  for(int imodel = 0; imodel < nmodels; imodel++) {
+    for(int iplot = 0; iplot < nplots; iplot++) {
+      if(fHist[imodel][iplot]) continue;
+      fHist[imodel][iplot] = this->NewHistogram(
+                          imodel, iplot, fPlots[iplot].xmin, fPlots[iplot].xmax);
+    }
+  }
+}
+//____________________________________________________________________________
+void GSimFilesAnalyzer::ProcessRange(Range & range) const
+{
+  if(range.last <= range.first) return;
+
+  // formula compilation goes through the (shared) ROOT interpreter state
+  static std::mutex formula_mutex;
+
+  int imodel = range.imodel;
+  int nplots = this->NPlots();
+
+  TChain chain(fTreeName[imodel].c_str());
+  for(unsigned int ifile = 0; ifile < fFileNames[imodel].size(); ifile++) {
+    chain.Add(fFileNames[imodel][ifile].c_str());
+  }
+  chain.LoadTree(range.first);
+
+  vector<TTreeFormula *>        var (nplots, (TTreeFormula *) 0);
+  vector<TTreeFormula *>        sel (nplots, (TTreeFormula *) 0);
+  vector<TTreeFormulaManager *> mgr (nplots, (TTreeFormulaManager *) 0);
+  {
+    std::lock_guard<std::mutex> lock(formula_mutex);
+    for(int iplot = 0; iplot < nplots; iplot++) {
+      const Plot & plot = fPlots[iplot];
+      string selection = (plot.selection.size() > 0) ? plot.selection : "1";
+      ostringstream vname, sname;
+      vname << "var" << iplot;
+      sname << "sel" << iplot;
+      var[iplot] = new TTreeFormula(vname.str().c_str(), plot.varexp.c_str(), &chain);
+      sel[iplot] = new TTreeFormula(sname.str().c_str(), selection.c_str(),   &chain);
+      if(var[iplot]->GetNdim() <= 0 || sel[iplot]->GetNdim() <= 0) {
+        LOG("GSimFilesAnalyzer", pERROR)
+          << "Invalid plot expression: " << plot.varexp << " {" << selection << "}";
+        delete var[iplot]; var[iplot] = 0;
+        delete sel[iplot]; sel[iplot] = 0;
+        continue;
+      }
+      mgr[iplot] = new TTreeFormulaManager;
+      mgr[iplot]->Add(var[iplot]);
+      mgr[iplot]->Add(sel[iplot]);
+      mgr[iplot]->Sync();
+    }
+  }
+
+  int tree_number = chain.GetTreeNumber();
+  for(Long64_t ientry = range.first; ientry < range.last; ientry++) {
+    Long64_t local = chain.LoadTree(ientry);
+    if(local < 0) break;
+    if(chain.GetTreeNumber() != tree_number) {
+      tree_number = chain.GetTreeNumber();
+      for(int iplot = 0; iplot < nplots; iplot++) {
+        if(!mgr[iplot]) continue;
+        var[iplot]->UpdateFormulaLeaves();
+        sel[iplot]->UpdateFormulaLeaves();
+        mgr[iplot]->UpdateFormulaLeaves();
+      }
+    }
+    for(int iplot = 0; iplot < nplots; iplot++) {
+      if(!mgr[iplot]) continue;
+      int ndata = mgr[iplot]->GetNdata();
+      if(ndata <= 0) continue;
+      // as in TSelectorDraw: instance 0 is always evaluated first (it loads
+      // the branches) and a scalar selection applies to all instances
+      bool multiple_sel = (sel[iplot]->GetMultiplicity() != 0);
+      double w = sel[iplot]->EvalInstance(0);
+      if(w == 0 && !multiple_sel) continue;
+      double x = var[iplot]->EvalInstance(0);
+      for(int i = 0; i < ndata; i++) {
+        if(i > 0) {
+          if(multiple_sel) w = sel[iplot]->EvalInstance(i);
+          if(w == 0) continue;
+          x = var[iplot]->EvalInstance(i);
+        }
+        if(w == 0) continue;
+        if(range.hist[iplot]) range.hist[iplot]->Fill(x, w);
+        else range.values[iplot].push_back(std::make_pair(x, w));
+      }
+    }
+  }
+
+  // the formulas delete their manager along with the last of them
+  std::lock_guard<std::mutex> lock(formula_mutex);
+  for(int iplot = 0; iplot < nplots; iplot++) {
+    if(var[iplot]) delete var[iplot];
+    if(sel[iplot]) delete sel[iplot];
+  }
+}
+//____________________________________________________________________________
+void GSimFilesAnalyzer::CleanUp(void)
+{
+  for(unsigned int imodel = 0; imodel < fHist.size(); imodel++) {
+    for(unsigned int iplot = 0; iplot < fHist[imodel].size(); iplot++) {
+      if(fHist[imodel][iplot]) delete fHist[imodel][iplot];
+    }
+  }
+  fHist.clear();
+}
+//____________________________________________________________________________
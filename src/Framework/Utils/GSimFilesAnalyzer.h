@@ -0,0 +1,110 @@
+//__________________________________________________________________________
+/*!
+
+\class    GSimFilesAnalyzer
+
+\brief    Fills many 1-D histograms of GENIE event sample quantities for
+          several model samples (eg those held by a GSimFiles) in a single,
+          multi-threaded pass over each sample, rather than through one
+          TTree::Draw() scan per plot.
+
+          A plot is booked as a TTree::Draw(varexp, selection) call would be
+          made (with the same TTreeFormula expressions): it gets one entry
+          per selected instance of varexp, weighted with the value of the
+          selection. All booked plots are filled for every model.
+
+          Process() splits the entries of each model sample into ranges, read
+          concurrently by the threads of the ThreadPool (see --thread-pool-size)
+          with their own TChain and formulas, and merges the range histograms.
+
+          Plots booked without a range (xmin >= xmax) are given one, as in
+          TTree::Draw(), from the values of the first model sample with any
+          selected entries, and all models share it, as when the other
+          samples are drawn on top of the first one (option "same").
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//__________________________________________________________________________
+
+#ifndef _GSIM_FILES_ANALYZER_H_
+#define _GSIM_FILES_ANALYZER_H_
+
+#include <string>
+#include <vector>
+#include <utility>
+
+#include <Rtypes.h>
+
+class TH1D;
+
+using std::string;
+using std::vector;
+using std::pair;
+
+namespace genie {
+
+class GSimFiles;
+
+class GSimFilesAnalyzer
+{
+public:
+  GSimFilesAnalyzer(void);
+  GSimFilesAnalyzer(const GSimFiles & simfiles);
+ ~GSimFilesAnalyzer(void);
+
+  //! Add a model sample: its event files and event tree name
+  int      AddModel  (string tag, const vector<string> & filenames,
+                      string tree_name = "gst");
+  int      NModels   (void) const { return fModelTag.size(); }
+  string   ModelTag  (int imodel) const { return fModelTag[imodel]; }
+
+  //! Book a plot (as TTree::Draw(varexp, selection)). No range: automatic
+  int      Book      (string varexp, string selection,
+                      int nbins = 100, double xmin = 0., double xmax = 0.);
+  int      FindPlot  (string varexp, string selection) const;
+  int      NPlots    (void) const { return fPlots.size(); }
+
+  //! Fill all booked plots for all models, with up to nmax entries per model
+  void     Process   (Long64_t nmax = -1);
+
+  //! The filled histogram (owned by the analyzer)
+  TH1D *   Histogram (int imodel, int iplot) const;
+
+private:
+
+  struct Plot {
+    string varexp;
+    string selection;
+    int    nbins;
+    double xmin;
+    double xmax;
+    bool   autorange;
+  };
+  struct Range {
+    int      imodel;
+    Long64_t first;
+    Long64_t last;
+    vector<TH1D *>                            hist;    ///< fixed-range plots
+    vector< vector< pair<double,double> > >   values;  ///< (value, weight) of auto-range plots
+  };
+
+  void     ProcessRange (Range & range) const;
+  TH1D *   NewHistogram (int imodel, int iplot, double xmin, double xmax) const;
+  void     CleanUp      (void);
+
+  vector<string>            fModelTag;    ///< model tags
+  vector< vector<string> >  fFileNames;   ///< event files, for each model
+  vector<string>            fTreeName;    ///< event tree name, for each model
+  vector<Plot>              fPlots;       ///< booked plots
+  vector< vector<TH1D *> >  fHist;        ///< filled histograms: [model][plot]
+};
+
+}      // genie namespace
+
+#endif // _GSIM_FILES_ANALYZER_H_
@@ -206,6 +206,17 @@ int genie::utils::hadxs::berger::PionNucleusXSec(double tpi, double ppistar, dou
 
   //Berger code for Tpi<=1.0
   //Returns the entire dsigma(pi + N -> pi + N)/dt term based on pi-Carbon scattering data
+  double clow = 0, betalow = 0, chigh = 0, betahigh = 0;
+  if(PionNucleusXSecFit(tpi, A, tpilow, clow, betalow, tpihigh, chigh, betahigh)) return 1;
+
+  siglow  = clow  * TMath::Exp( -1.0 * betalow  * t_new / (ppistar*ppistar) );
+  sighigh = chigh * TMath::Exp( -1.0 * betahigh * t_new / (ppistar*ppistar) );
+
+  return 0;
+}
+//_____________________________________________________________________________
+int genie::utils::hadxs::berger::PionNucleusXSecFit(double tpi, double A, double &tpilow, double &clow, double &betalow, double &tpihigh, double &chigh, double &betahigh){
+
   double binedges[13] = {0.000, 0.076, 0.080, 0.100, 0.148, 0.162, 0.226, 0.486, 0.584, 0.662, 0.766, 0.870, 1.000};
   double parones[13]  = {0.0, 11600.0, 14700.0, 18300.0, 21300.0, 22400.0, 16400.0, 5730.0, 4610.0, 4570.0, 4930.0, 5140.0, 5140.0};
   double partwos[13]  = {0.0, 116.0, 109.0, 89.8, 91.0, 89.2, 80.8, 54.6, 55.2, 58.4, 60.5, 62.2, 62.2};
@@ -223,21 +234,19 @@ int genie::utils::hadxs::berger::PionNucleusXSec(double tpi, double ppistar, dou
   tpilow  = binedges[btu];
   tpihigh = binedges[btu + 1];
 
-  double dsigdzlow = -9999.99;
-  if(btu==0) dsigdzlow = 0.0;
-  else       dsigdzlow = 2.0 * factors[btu]*factors[btu]
-    * parones[btu]*TMath::Power(A/12.0,1.3333333)
-      * TMath::Exp( -1.0 * partwos[btu]*TMath::Power(A/12.0,0.6666666) * t_new * factors[btu]*factors[btu] / (ppistar*ppistar) );
-  siglow = dsigdzlow;
+  double Anorm  = TMath::Power(A/12.0,1.3333333);
+  double Aslope = TMath::Power(A/12.0,0.6666666);
+
+  if(btu==0) { clow = 0.0; betalow = 0.0; }
+  else {
+    clow    = 2.0 * factors[btu]*factors[btu] * parones[btu] * Anorm;
+    betalow = partwos[btu] * Aslope * factors[btu]*factors[btu];
+  }
 
-  double dsigdzhigh = -9999.99;
   btu++;
-  if(btu>12) btu        = 12;
-  if(btu==0) dsigdzhigh = 0.0;
-  else       dsigdzhigh = 2.0 * factors[btu]*factors[btu]
-    * parones[btu]*TMath::Power(A/12.0,1.3333333)
-      * TMath::Exp( -1.0 * partwos[btu]*TMath::Power(A/12.0,0.6666666) * t_new * factors[btu]*factors[btu] / (ppistar*ppistar) );
-  sighigh = dsigdzhigh;
+  if(btu>12) btu = 12;
+  chigh    = 2.0 * factors[btu]*factors[btu] * parones[btu] * Anorm;
+  betahigh = partwos[btu] * Aslope * factors[btu]*factors[btu];
 
   return 0;
 }
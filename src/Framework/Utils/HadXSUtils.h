@@ -89,6 +89,9 @@ namespace hadxs
                            //Also pass pointers to varaibles which store the output:
                            //       the data points (xsec -vs- tpi) above and below the input tpi
                            //       an interpolation algorithm must be used to determine the xsec from this information
+    //The same fit, in terms of its t-independent coefficients: at the data points above and below tpi,
+    //dsigma/dz = c * exp(-beta * t / ppistar^2) (see PionNucleusXSec)
+    int    PionNucleusXSecFit(double tpi, double A, double &tpilow, double &clow, double &betalow, double &tpihigh, double &chigh, double &betahigh);
   }
 }      // hadxs namespace
 }      // utils namespace
@@ -26,12 +26,17 @@
 #pragma link C++ class genie::CacheBranchI;
 #pragma link C++ class genie::CacheBranchNtp;
 #pragma link C++ class genie::CacheBranchFx;
+#pragma link C++ class genie::CacheBranchGrid;
+#pragma link C++ class genie::CacheBranchEnvelope;
 #pragma link C++ class genie::CmdLnArgParser;
 #pragma link C++ class genie::XSecSplineList;
+#pragma link C++ class genie::RunCounters;
+#pragma link C++ class genie::StartupProfiler;
 #pragma link C++ class genie::Range1D_t;
 #pragma link C++ class genie::Range1F_t;
 #pragma link C++ class genie::Range1I_t;
 #pragma link C++ class genie::GSimFiles;
+#pragma link C++ class genie::GSimFilesAnalyzer;
 #pragma link C++ class genie::utils::T2KEvGenMetaData;
 
 #endif
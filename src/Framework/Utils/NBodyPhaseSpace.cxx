@@ -0,0 +1,88 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <cmath>
+
+#include "Framework/Utils/NBodyPhaseSpace.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+NBodyPhaseSpace::NBodyPhaseSpace(unsigned int nscan, double wbin) :
+fNScan    (nscan),
+fWBin     (wbin),
+fUseStore (true),
+fW        (0.),
+fCurrMax  (0)
+{
+
+}
+//____________________________________________________________________________
+NBodyPhaseSpace::~NBodyPhaseSpace()
+{
+
+}
+//____________________________________________________________________________
+bool NBodyPhaseSpace::SetDecay(
+                        TLorentzVector & p4, int n, const double * masses)
+{
+  fCurrMax = 0;
+  fW = p4.M();
+  fMasses.assign(masses, masses+n);
+  return fGenerator.SetDecay(p4, n, masses);
+}
+//____________________________________________________________________________
+double NBodyPhaseSpace::MaxWeight(int tag)
+{
+  TGenPhaseSpace & gen = fGenerator;
+  return this->MaxWeight(tag, [&gen] () { return gen.Generate(); });
+}
+//____________________________________________________________________________
+double NBodyPhaseSpace::MaxWeight(int tag, const WeightFunc_t & weight)
+{
+  fCurrMax = 0;
+
+  if(fUseStore) {
+    fKey.resize(2 + fMasses.size());
+    fKey[0] = tag;
+    fKey[1] = std::floor(fW / fWBin);
+    for(unsigned int i = 0; i < fMasses.size(); i++) fKey[2+i] = fMasses[i];
+
+    std::map<std::vector<double>, double>::iterator it = fMaxWeights.find(fKey);
+    if(it != fMaxWeights.end()) {
+      fCurrMax = &(it->second);
+      return it->second;
+    }
+  }
+
+  double wmax = -1;
+  for(unsigned int i = 0; i < fNScan; i++) {
+    double w = weight();
+    if(w > wmax) wmax = w;
+  }
+
+  if(fUseStore && wmax > 0) {
+    fCurrMax = &(fMaxWeights[fKey]);
+    *fCurrMax = wmax;
+  }
+  return wmax;
+}
+//____________________________________________________________________________
+void NBodyPhaseSpace::UpdateMaxWeight(double w)
+{
+  if(fCurrMax && w > *fCurrMax) *fCurrMax = w;
+}
+//____________________________________________________________________________
+void NBodyPhaseSpace::ClearMaxWeights(void)
+{
+  fMaxWeights.clear();
+  fCurrMax = 0;
+}
+//____________________________________________________________________________
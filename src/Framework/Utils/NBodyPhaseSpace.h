@@ -0,0 +1,93 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::NBodyPhaseSpace
+
+\brief    A TGenPhaseSpace N-body phase space generator that keeps the max
+          weights it has estimated, so that these are not re-estimated at
+          every decay.
+
+          Unweighted phase space decays are generated by accept/reject
+          against the max weight of the decay, estimated from a scan of
+          (typically 200) weighted decays. The generator keeps the max
+          weight of each decay type, ie of each (weight tag, ordered list of
+          product masses, bin of the decaying system invariant mass), and
+          only scans the first decay of every type. The stored weights are
+          raised online when a larger weight is generated (see
+          UpdateMaxWeight()). The weight tag tells apart different weighting
+          schemes (eg with and without pT reweighting) of the same decay.
+
+          The max weights are estimated at the first invariant mass met in
+          each bin: the bins (10 MeV by default) should be small compared
+          with the W dependence of the weights absorbed by the safety factor
+          applied by the callers.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _NBODY_PHASE_SPACE_H_
+#define _NBODY_PHASE_SPACE_H_
+
+#include <functional>
+#include <map>
+#include <vector>
+
+#include <TGenPhaseSpace.h>
+#include <TLorentzVector.h>
+
+namespace genie {
+
+class NBodyPhaseSpace {
+
+public:
+  NBodyPhaseSpace(unsigned int nscan = 200, double wbin = 0.010);
+ ~NBodyPhaseSpace();
+
+  typedef std::function<double (void)> WeightFunc_t;
+
+  //! Same as TGenPhaseSpace
+  bool             SetDecay (TLorentzVector & p4, int n, const double * masses);
+  double           Generate (void)  { return fGenerator.Generate();  }
+  TLorentzVector * GetDecay (int i) { return fGenerator.GetDecay(i); }
+
+  //! Returns the max weight of the current decay. The input function must
+  //! generate a decay and return its weight (by default, the TGenPhaseSpace
+  //! weight); it is called for the scans of decay types not met before.
+  double MaxWeight       (int tag = 0);
+  double MaxWeight       (int tag, const WeightFunc_t & weight);
+
+  //! Raises the stored max weight of the current decay type to w, if larger
+  void   UpdateMaxWeight (double w);
+
+  //! Disabling the max weight store makes MaxWeight() scan every decay
+  void   SetUseMaxWeightStore (bool on) { fUseStore = on; fCurrMax = 0; }
+  bool   UseMaxWeightStore    (void) const { return fUseStore; }
+  void   ClearMaxWeights      (void);
+
+  unsigned int NScan (void) const { return fNScan; }
+  double       WBin  (void) const { return fWBin;  }
+
+private:
+
+  TGenPhaseSpace      fGenerator;
+  unsigned int        fNScan;      ///< number of decays scanned for a max weight
+  double              fWBin;       ///< invariant mass bin width (GeV)
+  bool                fUseStore;   ///< keep the max weights?
+  double              fW;          ///< invariant mass of the current decay
+  std::vector<double> fMasses;     ///< product masses of the current decay
+  std::vector<double> fKey;        ///< scratch key: tag, W bin, masses
+
+  std::map<std::vector<double>, double> fMaxWeights;
+  double *            fCurrMax;    ///< stored max weight of the current decay
+};
+
+}      // genie namespace
+
+#endif // _NBODY_PHASE_SPACE_H_
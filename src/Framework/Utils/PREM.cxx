@@ -14,6 +14,44 @@
 #include "Framework/Conventions/Units.h"
 #include "Framework/Utils/PREM.h"
 
+//___________________________________________________________________________
+namespace {
+  // PREM layers: outer radius (km) & density polynomial coefficients in
+  // x = r/R_earth (g/cm^3); the last layer (the ocean) ends at R_earth
+  const int kNLayers = 10;
+  const double kLayers[kNLayers][5] = {
+    { 1221.5, 13.0885,  0.0,    -8.8381,  0.0    },
+    { 3480.0, 12.5815, -1.2638, -3.6426, -5.5281 },
+    { 5701.0,  7.9565, -6.4761,  5.5283, -3.0807 },
+    { 5771.0,  5.3197, -1.4836,  0.0,     0.0    },
+    { 5971.0, 11.2494, -8.0298,  0.0,     0.0    },
+    { 6151.0,  7.1089, -3.8045,  0.0,     0.0    },
+    { 6346.6,  2.691,   0.6924,  0.0,     0.0    },
+    { 6356.0,  2.90,    0.0,     0.0,     0.0    },
+    { 6368.0,  2.60,    0.0,     0.0,     0.0    },
+    {   -1.0,  1.02,    0.0,     0.0,     0.0    }
+  };
+  double OuterRadiusKm(int ilayer)
+  {
+    if(ilayer == kNLayers-1) return genie::constants::kREarth/genie::units::km;
+    return kLayers[ilayer][0];
+  }
+  // integral of (c0 + c1 x + c2 x^2 + c3 x^3) ds, x = r/R_earth, along the
+  // line at distance b from the centre, from s = 0 to s (lengths in km)
+  double Primitive(int ilayer, double b, double s)
+  {
+    double rE = genie::constants::kREarth/genie::units::km;
+    double b2 = b*b;
+    double r  = TMath::Sqrt(b2 + s*s);
+    double ash = (b > 0) ? TMath::ASinH(s/b) : 0.;
+    double f0 = s;
+    double f1 = 0.5 * (s*r + b2*ash);
+    double f2 = b2*s + s*s*s/3.;
+    double f3 = 0.25*s*r*r*r + 0.375*b2*s*r + 0.375*b2*b2*ash;
+    const double * c = kLayers[ilayer];
+    return c[1]*f0 + c[2]*f1/rE + c[3]*f2/(rE*rE) + c[4]*f3/(rE*rE*rE);
+  }
+}
 //___________________________________________________________________________
 double genie::utils::prem::Density(double r)
 {
@@ -22,55 +60,86 @@ double genie::utils::prem::Density(double r)
 // Outputs: rho, Earth density (in std GENIE  units)
 //
 
-  r = TMath::Max(0., r/units::km); // convert to km
+  int ilayer = Layer(r);
+  if(ilayer < 0) return 0.;
 
-  double rE  = constants::kREarth/units::km;
-  double rho = 0.;
-  double x   = r / rE;
+  double x = TMath::Max(0., r/units::km) / (constants::kREarth/units::km);
+  const double * c = kLayers[ilayer];
+  double rho = c[1] + x*(c[2] + x*(c[3] + x*c[4]));
 
-  if (r <= 1221.5 )
-  {
-    rho = 13.0885 - 8.8381*x*x;
-  }
-  else if (r >  1221.5 && r <= 3480.0 )
-  {
-    rho = 12.5815 - 1.2638*x - 3.6426*x*x - 5.5281*x*x*x;
-  }
-  else if (r >  3480.0 && r <= 5701.0 )
-  {
-    rho = 7.9565  - 6.4761*x + 5.5283*x*x - 3.0807*x*x*x;
-  }
-  else if (r >  5701.0 && r <= 5771.0 )
-  {
-    rho = 5.3197  - 1.4836*x;
-  }
-  else if (r >  5771.0 && r <= 5971.0 )
-  {
-    rho = 11.2494 - 8.0298*x;
-  }
-  else if (r >  5971.0 && r <= 6151.0 )
-  {
-    rho = 7.1089  - 3.8045*x;
-  }
-  else if (r >  6151.0 && r <= 6346.6 )
-  {
-    rho = 2.691   + 0.6924*x;
-  }
-  else if (r >  6346.6 && r <= 6356.0 )
-  {
-    rho = 2.90;
-  }
-  else if (r >  6356.0 && r <= 6368.0 )
-  {
-    rho = 2.60;
+  rho = rho * units::g_cm3;
+
+  return rho;
+}
+//___________________________________________________________________________
+int genie::utils::prem::NLayers(void)
+{
+  return kNLayers;
+}
+//___________________________________________________________________________
+int genie::utils::prem::Layer(double r)
+{
+  r = TMath::Max(0., r/units::km); // convert to km
+
+  for(int ilayer = 0; ilayer < kNLayers; ilayer++) {
+    if(r <= OuterRadiusKm(ilayer)) return ilayer;
   }
-  else if (r >  6368.0 && r <= rE)
-  {
-    rho = 1.02;
+  return -1;
+}
+//___________________________________________________________________________
+double genie::utils::prem::LayerInnerRadius(int ilayer)
+{
+  return (ilayer > 0) ? OuterRadiusKm(ilayer-1) * units::km : 0.;
+}
+//___________________________________________________________________________
+double genie::utils::prem::LayerOuterRadius(int ilayer)
+{
+  return OuterRadiusKm(ilayer) * units::km;
+}
+//___________________________________________________________________________
+double genie::utils::prem::LayerColumnDensity(
+                                int ilayer, double b, double s0, double s1)
+{
+// Integral of the density of the input layer along the line at distance b
+// from the centre of the Earth, between the points s0 < s1 on the line.
+// The line is inside the layer for smin <= |s| <= smax, smin^2 = rin^2-b^2,
+// smax^2 = rout^2-b^2 (smin = 0 if the line does not reach rin)
+
+  if(ilayer < 0 || ilayer >= kNLayers) return 0.;
+
+  b  = TMath::Abs(b)/units::km; // convert to km
+  s0 = s0/units::km;
+  s1 = s1/units::km;
+
+  double rin  = (ilayer > 0) ? OuterRadiusKm(ilayer-1) : 0.;
+  double rout = OuterRadiusKm(ilayer);
+  if(b >= rout || s1 <= s0) return 0.;
+
+  double smax = TMath::Sqrt(rout*rout - b*b);
+  double smin = (b < rin) ? TMath::Sqrt(rin*rin - b*b) : 0.;
+
+  double col = 0;
+  // the two crossings of the layer: s in [-smax,-smin] & [smin,smax]
+  for(int side = -1; side <= 1; side += 2) {
+    double lo = (side < 0) ? -smax : smin;
+    double hi = (side < 0) ? -smin : smax;
+    lo = TMath::Max(lo, s0);
+    hi = TMath::Min(hi, s1);
+    if(hi > lo) col += Primitive(ilayer, b, hi) - Primitive(ilayer, b, lo);
   }
 
-  rho = rho * units::g_cm3;
+  return col * units::g_cm3 * units::km;
+}
+//___________________________________________________________________________
+double genie::utils::prem::ColumnDensity(double b, double s0, double s1)
+{
+// Integral of the Earth density along the line at distance b from the centre
+// of the Earth, between the points s0 < s1 on the line
 
-  return rho;
+  double col = 0;
+  for(int ilayer = 0; ilayer < kNLayers; ilayer++) {
+    col += LayerColumnDensity(ilayer, b, s0, s1);
+  }
+  return col;
 }
 //___________________________________________________________________________
@@ -31,6 +31,21 @@ namespace prem
   //
   double Density(double r);
 
+  //
+  // the PREM layers (numbered outwards from 0 = inner core), in each of
+  // which the density is a polynomial of r, and the closed form integrals
+  // of the density along a straight line, for fast Earth traversal.
+  // A line is given by its distance b from the centre of the Earth and
+  // points on it by their signed distance s from its point of closest
+  // approach (r^2 = b^2 + s^2). All in std GENIE units.
+  //
+  int    NLayers            (void);
+  int    Layer              (double r);   ///< layer at radius r (-1 if r > R_earth)
+  double LayerInnerRadius   (int ilayer);
+  double LayerOuterRadius   (int ilayer);
+  double LayerColumnDensity (int ilayer, double b, double s0, double s1);
+  double ColumnDensity      (double b, double s0, double s1);
+
 } // prem  namespace
 } // utils namespace
 } // genie namespace
@@ -0,0 +1,62 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include "Framework/Algorithm/Algorithm.h"
+#include "Framework/Utils/RejectionMonitor.h"
+#include "Framework/Utils/RunCounters.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+RejectionMonitor::RejectionMonitor(const Algorithm * owner) :
+fOwner     (owner),
+fNXSecEval (0)
+{
+
+}
+//____________________________________________________________________________
+RejectionMonitor::~RejectionMonitor()
+{
+  fEntries.clear();
+}
+//____________________________________________________________________________
+void RejectionMonitor::CountViolation(const Interaction * in)
+{
+  RunCounters::Instance()->Increment(this->FindEntries(in).Violations);
+}
+//____________________________________________________________________________
+void RejectionMonitor::Accepted(const Interaction * in, unsigned int ntries)
+{
+  const Entries & entries = this->FindEntries(in);
+
+  RunCounters * counters = RunCounters::Instance();
+  counters->Fill(entries.Tries,     ntries);
+  counters->Fill(entries.XSecEvals, fNXSecEval);
+
+  fNXSecEval = 0;
+}
+//____________________________________________________________________________
+const RejectionMonitor::Entries &
+   RejectionMonitor::FindEntries(const Interaction * in)
+{
+  InteractionCode code = in->Code();
+  EntryMap_t::const_iterator it = fEntries.find(code);
+  if(it != fEntries.end()) return it->second;
+
+  string name =
+     "Rejection: " + fOwner->Id().Name() + " [" + in->AsString() + "]";
+  Entries entries;
+  entries.Tries      = name + " - tries / accepted event";
+  entries.XSecEvals  = name + " - xsec evaluations / accepted event";
+  entries.Violations = name + " - max xsec violations";
+
+  return fEntries.insert(EntryMap_t::value_type(code, entries)).first->second;
+}
+//____________________________________________________________________________
@@ -0,0 +1,83 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::RejectionMonitor
+
+\brief    Monitors the efficiency of the accept/reject loop of a kinematics
+          generator, per interaction: the number of tries and of cross
+          section evaluations per accepted event, and the number of times
+          the cross section exceeded the maximum used in the rejection
+          method.
+
+          The per-event numbers are accumulated by the generator instance
+          and, at every accepted event, filled as value summaries in the
+          RunCounters (so they are reported in the MC job status file and
+          in the job log at the end of the job). The summary names
+          (generator name and interaction string code) are built only once
+          per interaction.
+
+          Each generator instance holds its own monitor: the class is not
+          meant to be shared by threads.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _REJECTION_MONITOR_H_
+#define _REJECTION_MONITOR_H_
+
+#include <string>
+#include <unordered_map>
+
+#include "Framework/Interaction/Interaction.h"
+
+using std::string;
+
+namespace genie {
+
+class Algorithm;
+
+class RejectionMonitor
+{
+public:
+  RejectionMonitor(const Algorithm * owner);
+ ~RejectionMonitor();
+
+  //! Starts a new event (forgets evaluations made for a failed event)
+  void NewEvent        (void) { fNXSecEval = 0; }
+
+  //! Counts cross section evaluations in the accept/reject loop
+  void CountXSecEval   (unsigned int n = 1) { fNXSecEval += n; }
+
+  //! Counts a cross section exceeding the max cross section
+  void CountViolation  (const Interaction * in);
+
+  //! Records the number of tries (incl. the accepted one) for an event
+  void Accepted        (const Interaction * in, unsigned int ntries);
+
+private:
+  // RunCounters entry names for an interaction
+  struct Entries {
+    string Tries;
+    string XSecEvals;
+    string Violations;
+  };
+  const Entries & FindEntries (const Interaction * in);
+
+  typedef std::unordered_map<InteractionCode, Entries,
+                             InteractionCode::Hash> EntryMap_t;
+
+  const Algorithm * fOwner;      ///< generator being monitored
+  unsigned int      fNXSecEval;  ///< xsec evaluations for the current event
+  EntryMap_t        fEntries;    ///< entry names, per interaction
+};
+
+}      // genie namespace
+
+#endif // _REJECTION_MONITOR_H_
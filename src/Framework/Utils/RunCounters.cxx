@@ -0,0 +1,155 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <cmath>
+#include <iomanip>
+#include <algorithm>
+
+#include "Framework/Utils/RunCounters.h"
+
+using std::endl;
+using std::setw;
+using std::left;
+using std::right;
+
+using namespace genie;
+
+//____________________________________________________________________________
+namespace genie {
+  ostream & operator << (ostream & stream, const RunCounters & counters)
+  {
+    counters.Print(stream);
+    return stream;
+  }
+}
+//____________________________________________________________________________
+RunCounters * RunCounters::fInstance = 0;
+//____________________________________________________________________________
+RunCounters::RunCounters()
+{
+  fInstance = 0;
+}
+//____________________________________________________________________________
+RunCounters::~RunCounters()
+{
+  fCounters.clear();
+  fSummaries.clear();
+  fInstance = 0;
+}
+//____________________________________________________________________________
+RunCounters * RunCounters::Instance()
+{
+  static std::mutex init_mutex;
+  std::lock_guard<std::mutex> lock(init_mutex);
+
+  if(fInstance == 0) {
+    static RunCounters::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+    fInstance = new RunCounters;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+void RunCounters::Increment(const string & name, long n)
+{
+  std::lock_guard<std::mutex> lock(fMutex);
+  fCounters[name] += n;
+}
+//____________________________________________________________________________
+void RunCounters::Fill(const string & name, double value)
+{
+  std::lock_guard<std::mutex> lock(fMutex);
+
+  map<string, Summary>::iterator it = fSummaries.find(name);
+  if(it == fSummaries.end()) {
+    Summary s;
+    s.N    = 1;
+    s.Sum  = value;
+    s.Sum2 = value*value;
+    s.Min  = value;
+    s.Max  = value;
+    fSummaries.insert(map<string, Summary>::value_type(name, s));
+    return;
+  }
+  Summary & s = it->second;
+  s.N++;
+  s.Sum  += value;
+  s.Sum2 += value*value;
+  if(value < s.Min) s.Min = value;
+  if(value > s.Max) s.Max = value;
+}
+//____________________________________________________________________________
+long RunCounters::Count(const string & name) const
+{
+  std::lock_guard<std::mutex> lock(fMutex);
+
+  map<string, long>::const_iterator it = fCounters.find(name);
+  return (it == fCounters.end()) ? 0 : it->second;
+}
+//____________________________________________________________________________
+RunCounters::Summary RunCounters::GetSummary(const string & name) const
+{
+  std::lock_guard<std::mutex> lock(fMutex);
+
+  map<string, Summary>::const_iterator it = fSummaries.find(name);
+  if(it != fSummaries.end()) return it->second;
+
+  Summary s;
+  s.N = 0; s.Sum = 0; s.Sum2 = 0; s.Min = 0; s.Max = 0;
+  return s;
+}
+//____________________________________________________________________________
+map<string, long> RunCounters::Counters(void) const
+{
+  std::lock_guard<std::mutex> lock(fMutex);
+  return fCounters;
+}
+//____________________________________________________________________________
+bool RunCounters::IsEmpty(void) const
+{
+  std::lock_guard<std::mutex> lock(fMutex);
+  return fCounters.empty() && fSummaries.empty();
+}
+//____________________________________________________________________________
+void RunCounters::Reset(void)
+{
+  std::lock_guard<std::mutex> lock(fMutex);
+  fCounters.clear();
+  fSummaries.clear();
+}
+//____________________________________________________________________________
+void RunCounters::Print(ostream & stream) const
+{
+  std::lock_guard<std::mutex> lock(fMutex);
+
+  stream << "\n[-] Run counters:";
+  if(fCounters.empty() && fSummaries.empty()) {
+    stream << " (none)" << endl;
+    return;
+  }
+
+  map<string, long>::const_iterator cit = fCounters.begin();
+  for( ; cit != fCounters.end(); ++cit) {
+    stream << "\n |-> " << setw(60) << left << cit->first << right
+           << " : " << cit->second;
+  }
+  map<string, Summary>::const_iterator sit = fSummaries.begin();
+  for( ; sit != fSummaries.end(); ++sit) {
+    const Summary & s = sit->second;
+    double mean = s.Sum / s.N;
+    double rms  = std::sqrt(std::max(0., s.Sum2/s.N - mean*mean));
+    stream << "\n |-> " << setw(60) << left << sit->first << right
+           << " : entries = " << s.N
+           << ", mean = " << mean << ", rms = " << rms
+           << ", min = "  << s.Min << ", max = " << s.Max;
+  }
+  stream << endl;
+}
+//____________________________________________________________________________
@@ -0,0 +1,99 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::RunCounters
+
+\brief    A registry of named counters and value summaries, filled at hot
+          code paths in place of printing a message for every occurrence
+          of some frequent (and, individually, uninteresting) condition,
+          eg the rejection of a flux neutrino.
+
+          Counters are incremented via Increment(). Value summaries (number
+          of entries, mean, rms, min and max) are filled via Fill(). The
+          totals are printed in the MC job status file at every GMCJMonitor
+          update and in the job log at the end of the job.
+
+          Updates are serialized so that the class can be used from several
+          threads.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _RUN_COUNTERS_H_
+#define _RUN_COUNTERS_H_
+
+#include <iostream>
+#include <string>
+#include <map>
+#include <mutex>
+
+using std::ostream;
+using std::string;
+using std::map;
+
+namespace genie {
+
+class RunCounters;
+ostream & operator << (ostream & stream, const RunCounters & counters);
+
+class RunCounters
+{
+public:
+  static RunCounters * Instance(void);
+
+  // Summary of the values filled in a named entry
+  struct Summary {
+    long   N;
+    double Sum;
+    double Sum2;
+    double Min;
+    double Max;
+  };
+
+  // Called at the hot code paths
+  void Increment (const string & name, long n = 1);
+  void Fill      (const string & name, double value);
+
+  // Access / output
+  long    Count      (const string & name) const;
+  Summary GetSummary (const string & name) const;
+  map<string, long> Counters (void) const;  ///< copy of all counters
+  bool    IsEmpty    (void) const;
+  void    Reset      (void);
+  void    Print      (ostream & stream) const;
+
+  friend ostream & operator << (ostream & stream, const RunCounters & counters);
+
+private:
+  RunCounters();
+  RunCounters(const RunCounters & counters);
+  virtual ~RunCounters();
+
+  map<string, long>    fCounters;  ///< counters, keyed by name
+  map<string, Summary> fSummaries; ///< value summaries, keyed by name
+  mutable std::mutex   fMutex;
+
+  static RunCounters * fInstance;
+
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (RunCounters::fInstance !=0) {
+            delete RunCounters::fInstance;
+            RunCounters::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+}      // genie namespace
+
+#endif // _RUN_COUNTERS_H_
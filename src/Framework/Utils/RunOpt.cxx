@@ -14,15 +14,21 @@
 #include <TMath.h>
 #include <TBits.h>
 
+#include "Framework/Algorithm/AlgConfigPool.h"
+#include "Framework/EventGen/EVGAltXSecWeights.h"
 #include "Framework/GHEP/GHepFlags.h"
 #include "Framework/Utils/CmdLnArgParser.h"
 #include "Framework/Utils/RunOpt.h"
 #include "Framework/Utils/SystemUtils.h"
+#include "Framework/Utils/StartupProfiler.h"
+#include "Framework/Utils/StringUtils.h"
+#include "Framework/Utils/ThreadPool.h"
 #include "Framework/Utils/XSecSplineList.h"
 #include "Framework/Messenger/Messenger.h"
 
 using std::cout;
 using std::endl;
+using std::vector;
 
 namespace genie {
 
@@ -46,7 +52,10 @@ RunOpt::RunOpt() : fTune(0)
 //____________________________________________________________________________
 RunOpt::~RunOpt()
 {
-  if ( fTune )                    delete fTune ;
+  if ( fTune && ! this->IsBuiltTune(fTune) ) delete fTune ;
+  map<string, TuneId*>::iterator it = fBuiltTunes.begin();
+  for( ; it != fBuiltTunes.end(); ++it) delete it->second;
+  fBuiltTunes.clear();
   if ( fUnphysEventMask )         delete fUnphysEventMask ;
   fInstance = 0;
 }
@@ -76,6 +85,22 @@ void RunOpt::Init(void)
   fEventRecordPrintLevel  = 3;
   fEventGeneratorList     = "Default";
   fXMLPath = "";
+  fEVGStatsFile = "";
+  fCheckpointFile = "";
+  fCheckpointInterval = 1000;
+  fRestart = false;
+  const char * snapshot = std::getenv("GCONFSNAPSHOT");
+  fConfigSnapshot = (snapshot) ? string(snapshot) : "";
+  const char * lazy = std::getenv("GCONFLAZY");
+  fLazyConfig = (lazy) && (string(lazy) == "1" || string(lazy) == "YES");
+  const char * profile = std::getenv("GPROFSTARTUP");
+  fProfileStartup =
+     (profile) && (string(profile) == "1" || string(profile) == "YES");
+  if(fProfileStartup) StartupProfiler::Instance()->Enable();
+  const char * nthreads = std::getenv("GTHREADPOOLSIZE");
+  fThreadPoolSize = (nthreads) ? std::atoi(nthreads) : 1;
+  fXSecUniverses = "";
+  fReweightStream = false;
 }
 //____________________________________________________________________________
 void RunOpt::SetTuneName(string tuneName)
@@ -84,7 +109,7 @@ void RunOpt::SetTuneName(string tuneName)
   if ( fTune ) {
     LOG("RunOpt",pNOTICE) << "RunOpt::SetTune() already had " << fTune->Name()
               << ", now being re-set to " << tuneName;
-    delete fTune;
+    if ( ! this->IsBuiltTune(fTune) ) delete fTune;
   }
   fTune = new TuneId( tuneName ) ;
 }
@@ -96,6 +121,49 @@ void RunOpt::BuildTune()
   XSecSplineList::Instance()->SetCurrentTune( Tune()->Name() ) ;
 }
 //____________________________________________________________________________
+void RunOpt::SwitchTune(string tuneName)
+{
+  if ( tuneName == "Default" || tuneName == "" ) tuneName = gDefaultTune;
+  if ( fTune && fTune->Name() == tuneName && fTune->IsValidated() ) {
+    AlgConfigPool::ActivateTune( tuneName ) ;
+    XSecSplineList::Instance()->SetCurrentTune( tuneName ) ;
+    return;
+  }
+
+  // keep the current (built) tune: its configuration pool stays loaded
+  if ( fTune && ! this->IsBuiltTune(fTune) ) {
+    if ( fTune->IsValidated() && fBuiltTunes.count(fTune->Name()) == 0 ) {
+      fBuiltTunes[fTune->Name()] = fTune;
+    } else {
+      delete fTune;
+    }
+  }
+  fTune = 0;
+
+  map<string, TuneId*>::iterator it = fBuiltTunes.find(tuneName);
+  if ( it != fBuiltTunes.end() ) {
+    LOG("RunOpt",pNOTICE) << "Switching to tune " << tuneName;
+    fTune = it->second;
+  } else {
+    LOG("RunOpt",pNOTICE) << "Switching to (new) tune " << tuneName;
+    fTune = new TuneId( tuneName ) ;
+    fTune->Build() ;
+    fBuiltTunes[tuneName] = fTune;
+  }
+
+  AlgConfigPool::ActivateTune( tuneName ) ;
+  XSecSplineList::Instance()->SetCurrentTune( tuneName ) ;
+}
+//____________________________________________________________________________
+bool RunOpt::IsBuiltTune(const TuneId * tune) const
+{
+  map<string, TuneId*>::const_iterator it = fBuiltTunes.begin();
+  for( ; it != fBuiltTunes.end(); ++it) {
+    if ( it->second == tune ) return true;
+  }
+  return false;
+}
+//____________________________________________________________________________
 void RunOpt::ReadFromCommandLine(int argc, char ** argv)
 {
   LOG("RunOpt",pDEBUG) << "Reading "<<argc-1<<" command line arguments.";
@@ -133,6 +201,50 @@ void RunOpt::ReadFromCommandLine(int argc, char ** argv)
     fXMLPath = parser.ArgAsString("xml-path");
   }
 
+  if( parser.OptionExists("evg-stats") ) {
+    fEVGStatsFile = parser.ArgAsString("evg-stats");
+  }
+
+  if( parser.OptionExists("checkpoint") ) {
+    fCheckpointFile = parser.ArgAsString("checkpoint");
+  }
+  if( parser.OptionExists("checkpoint-interval") ) {
+    fCheckpointInterval = TMath::Max(
+        1, parser.ArgAsInt("checkpoint-interval"));
+  }
+  if( parser.OptionExists("restart") ) {
+    fRestart = true;
+  }
+
+  if( parser.OptionExists("config-snapshot") ) {
+    fConfigSnapshot = parser.ArgAsString("config-snapshot");
+  }
+  if( parser.OptionExists("lazy-config") ) {
+    fLazyConfig = true;
+  }
+  if( parser.OptionExists("profile-startup") ) {
+    fProfileStartup = true;
+    StartupProfiler::Instance()->Enable();
+  }
+  if( parser.OptionExists("thread-pool-size") ) {
+    fThreadPoolSize = TMath::Max(1, parser.ArgAsInt("thread-pool-size"));
+    ThreadPool::Instance()->SetNThreads(fThreadPoolSize);
+  }
+
+  if( parser.OptionExists("reweight-stream") ) {
+    fReweightStream = true;
+  }
+
+  if( parser.OptionExists("xsec-universes") ) {
+    fXSecUniverses = parser.ArgAsString("xsec-universes");
+    vector<string> universes = utils::str::Split(fXSecUniverses, ",");
+    EVGAltXSecWeights::Instance()->Clear();
+    for(unsigned int i = 0; i < universes.size(); i++) {
+      string key = utils::str::TrimSpaces(universes[i]);
+      if(key.size() > 0) EVGAltXSecWeights::Instance()->AddUniverse(key);
+    }
+  }
+
   if( parser.OptionExists("tune") ) {
     SetTuneName( parser.ArgAsString("tune") ) ;
   }
@@ -171,6 +283,32 @@ void RunOpt::Print(ostream & stream) const
   if (fXMLPath.size()) {
     stream << "\n XMLPath over-ride : "<<fXMLPath;
   }
+  if (fCheckpointFile.size()) {
+    stream << "\n Checkpoint file : " << fCheckpointFile
+           << " (every " << fCheckpointInterval << " events"
+           << ((fRestart) ? ", restarting" : "") << ")";
+  }
+  if (fConfigSnapshot.size()) {
+    stream << "\n Configuration snapshot : " << fConfigSnapshot;
+  }
+  if (fLazyConfig) {
+    stream << "\n Algorithm XML config files parsed on demand";
+  }
+  if (fProfileStartup) {
+    stream << "\n Start-up profiling enabled";
+  }
+  if (fThreadPoolSize > 1) {
+    stream << "\n Thread pool size : " << fThreadPoolSize;
+  }
+  if (fEVGStatsFile.size()) {
+    stream << "\n Event generation statistics file : " << fEVGStatsFile;
+  }
+  if (fReweightStream) {
+    stream << "\n Reweighting summary tree written next to the event tree";
+  }
+  if (fXSecUniverses.size()) {
+    stream << "\n Alternative xsec model configurations : " << fXSecUniverses;
+  }
 
   stream << "\n";
 }
@@ -19,6 +19,7 @@
 #define _RUN_OPT_H_
 
 #include <iostream>
+#include <map>
 #include <string>
 
 #include "Framework/Utils/TuneId.h"
@@ -26,6 +27,7 @@
 class TBits;
 
 using std::ostream;
+using std::map;
 
 namespace genie {
 
@@ -50,12 +52,32 @@ public:
   int    MCJobStatusRefreshRate (void) const { return fMCJobStatusRefreshRate; }
   bool   BareXSecPreCalc        (void) const { return fEnableBareXSecPreCalc;  }
   string XMLPath                (void) const { return fXMLPath;  }
+  string EVGStatsFile           (void) const { return fEVGStatsFile;           }
+  string CheckpointFile         (void) const { return fCheckpointFile;         }
+  int    CheckpointInterval     (void) const { return fCheckpointInterval;     }
+  bool   Restart                (void) const { return fRestart;                }
+  string ConfigSnapshot         (void) const { return fConfigSnapshot;         }
+  bool   LazyConfig             (void) const { return fLazyConfig;             }
+  bool   ProfileStartup         (void) const { return fProfileStartup;         }
+  int    ThreadPoolSize         (void) const { return fThreadPoolSize;         }
+  string XSecUniverses          (void) const { return fXSecUniverses;          }
+  bool   ReweightStream         (void) const { return fReweightStream;         }
 
   // If a user accesses the GENIE objects directly, then most of the options above
   // can be set directly to the relevant objects (Messenger, Cache, etc).
   //
   void SetTuneName(string tuneName="Default");
   void BuildTune(); ///< build tune and inform XSecSplineList
+
+  //! Make the input tune the active one without restarting the process, eg
+  //! to generate batches of events under several tunes with the same flux &
+  //! geometry. The tune, its AlgConfigPool and (per thread) AlgFactory are
+  //! built at its first use and kept, so switching back is immediate; the
+  //! tune-independent data (PDG tables, hadron transport data, flux and
+  //! geometry drivers) are shared. Event generation drivers must be set up
+  //! while their tune is active and used only while it is active. Switch
+  //! tunes between batches, while no other thread is generating events
+  void SwitchTune(string tuneName);
   void SetEventGeneratorList(string evgenlist) { fEventGeneratorList = evgenlist; }
   void EnableBareXSecPreCalc(bool flag)        { fEnableBareXSecPreCalc = flag; }
 
@@ -66,6 +88,7 @@ public:
 private:
 
   void Init (void);
+  bool IsBuiltTune (const TuneId * tune) const;
 
   // options
   TuneId * fTune;                    ///< GENIE comprehensive neutrino interaction model tune.
@@ -78,6 +101,17 @@ private:
   bool   fEnableBareXSecPreCalc;     ///< Cache calcs relevant to free-nucleon xsecs before any nuclear xsec computation?
                                      ///< The option switches on/off cacheing calculations which interfere with event reweighting.
   string fXMLPath;                   ///< An path to look for XML in. Higher priority than GXMLPATH
+  string fEVGStatsFile;              ///< Output file for per-module event generation statistics (.root -> TTree, else JSON).
+  string fCheckpointFile;            ///< Checkpoint file of long MC jobs (no checkpointing if empty).
+  int    fCheckpointInterval;        ///< Number of generated events between checkpoints.
+  bool   fRestart;                   ///< Restart from the checkpoint file (rather than from scratch)?
+  string fConfigSnapshot;            ///< Binary AlgConfigPool snapshot to load instead of parsing all XML config files.
+  bool   fLazyConfig;                ///< Parse algorithm XML config files only when first requested?
+  bool   fProfileStartup;            ///< Time the job initialization phases (see StartupProfiler)?
+  int    fThreadPoolSize;            ///< Threads used by parallel scans, eg of the max xsec (see ThreadPool).
+  bool   fReweightStream;            ///< Write the compact reweighting summary of each event to a side tree (see NtpMCReweightRecord)?
+  string fXSecUniverses;             ///< Comma-separated alternative xsec algorithm keys to compute event weights for (see EVGAltXSecWeights).
+  map<string, TuneId *> fBuiltTunes; ///< Tunes built by SwitchTune(), by name (owned; fTune may be one of them).
 
   // Self
   static RunOpt * fInstance;
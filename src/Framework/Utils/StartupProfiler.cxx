@@ -0,0 +1,134 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <iomanip>
+#include <sstream>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/StartupProfiler.h"
+
+using std::endl;
+using std::setw;
+using std::left;
+using std::right;
+using std::fixed;
+using std::setprecision;
+using std::ostringstream;
+
+using namespace genie;
+
+//____________________________________________________________________________
+namespace genie {
+  ostream & operator << (ostream & stream, const StartupProfiler & prof)
+  {
+    prof.Print(stream);
+    return stream;
+  }
+}
+//____________________________________________________________________________
+StartupProfiler * StartupProfiler::fInstance = 0;
+//____________________________________________________________________________
+StartupProfiler::StartupProfiler() :
+fEnabled  (false),
+fReported (false),
+fStart    (std::chrono::steady_clock::now())
+{
+  fInstance = 0;
+}
+//____________________________________________________________________________
+StartupProfiler::~StartupProfiler()
+{
+  fOrder.clear();
+  fPhases.clear();
+  fInstance = 0;
+}
+//____________________________________________________________________________
+StartupProfiler * StartupProfiler::Instance()
+{
+  static std::mutex init_mutex;
+  std::lock_guard<std::mutex> lock(init_mutex);
+
+  if(fInstance == 0) {
+    static StartupProfiler::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+    fInstance = new StartupProfiler;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+void StartupProfiler::Enable(bool on)
+{
+  std::lock_guard<std::mutex> lock(fMutex);
+  if(on && !fEnabled.load()) fStart = std::chrono::steady_clock::now();
+  fEnabled.store(on);
+}
+//____________________________________________________________________________
+void StartupProfiler::Add(const string & phase, double seconds)
+{
+  std::lock_guard<std::mutex> lock(fMutex);
+
+  map<string, Phase>::iterator it = fPhases.find(phase);
+  if(it == fPhases.end()) {
+    Phase p;
+    p.N    = 1;
+    p.Time = seconds;
+    fPhases.insert(map<string, Phase>::value_type(phase, p));
+    fOrder.push_back(phase);
+    return;
+  }
+  it->second.N++;
+  it->second.Time += seconds;
+}
+//____________________________________________________________________________
+void StartupProfiler::Report(void)
+{
+  if(!this->IsEnabled()) return;
+  if(fReported.exchange(true)) return;
+
+  ostringstream report;
+  this->Print(report);
+  LOG("StartupProfiler", pNOTICE) << report.str();
+}
+//____________________________________________________________________________
+void StartupProfiler::Print(ostream & stream) const
+{
+  std::lock_guard<std::mutex> lock(fMutex);
+
+  std::chrono::duration<double> total =
+        std::chrono::steady_clock::now() - fStart;
+
+  stream << "\n[-] Start-up profile (wall-clock time):";
+  for(unsigned int i = 0; i < fOrder.size(); i++) {
+    const Phase & p = fPhases.find(fOrder[i])->second;
+    stream << "\n |-> " << setw(70) << left << fOrder[i] << right
+           << " : " << fixed << setprecision(3) << setw(9) << p.Time << " s";
+    if(p.N > 1) stream << " (" << p.N << " entries)";
+  }
+  stream << "\n |-> " << setw(70) << left << "Total time since start-up" << right
+         << " : " << fixed << setprecision(3) << setw(9) << total.count() << " s"
+         << endl;
+}
+//____________________________________________________________________________
+StartupTimer::StartupTimer(const string & phase) :
+fOn(StartupProfiler::Instance()->IsEnabled())
+{
+  if(fOn) {
+    fPhase = phase;
+    fStart = std::chrono::steady_clock::now();
+  }
+}
+//____________________________________________________________________________
+StartupTimer::~StartupTimer()
+{
+  if(!fOn) return;
+  std::chrono::duration<double> dt = std::chrono::steady_clock::now() - fStart;
+  StartupProfiler::Instance()->Add(fPhase, dt.count());
+}
+//____________________________________________________________________________
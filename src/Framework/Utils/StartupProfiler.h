@@ -0,0 +1,118 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::StartupProfiler
+
+\brief    Records the wall-clock time spent in each initialization phase of
+          a GENIE application (configuration loading, particle data base,
+          cross-section splines, event generation drivers, hadron transport
+          data, geometry, flux, max path-lengths, ...) and prints a report
+          when the first event is generated.
+
+          Phases are timed with StartupTimer objects placed at the relevant
+          initialization methods. Phases may nest (eg the configuration of
+          an event generation driver may load algorithm configuration files)
+          and a phase entered several times is reported once, with the number
+          of entries and the summed time.
+
+          Off by default. Enabled with the --profile-startup option of the
+          GENIE apps, or the GPROFSTARTUP env. var. (see RunOpt).
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _STARTUP_PROFILER_H_
+#define _STARTUP_PROFILER_H_
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+
+using std::ostream;
+using std::string;
+using std::vector;
+using std::map;
+
+namespace genie {
+
+class StartupProfiler;
+ostream & operator << (ostream & stream, const StartupProfiler & prof);
+
+class StartupProfiler
+{
+public:
+  static StartupProfiler * Instance(void);
+
+  void   Enable    (bool on = true);
+  bool   IsEnabled (void) const { return fEnabled.load(std::memory_order_relaxed); }
+
+  //! Adds the input time (in sec) to the named phase
+  void   Add       (const string & phase, double seconds);
+
+  //! Prints the report in the log, once (later calls do nothing)
+  void   Report    (void);
+  void   Print     (ostream & stream) const;
+
+  friend ostream & operator << (ostream & stream, const StartupProfiler & prof);
+
+private:
+  StartupProfiler();
+  StartupProfiler(const StartupProfiler & prof);
+  virtual ~StartupProfiler();
+
+  struct Phase {
+    long   N;
+    double Time;
+  };
+
+  std::atomic<bool>                     fEnabled;
+  std::atomic<bool>                     fReported;
+  std::chrono::steady_clock::time_point fStart;    ///< when profiling was enabled
+  vector<string>                        fOrder;    ///< phases, in order of first entry
+  map<string, Phase>                    fPhases;
+  mutable std::mutex                    fMutex;
+
+  static StartupProfiler * fInstance;
+
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (StartupProfiler::fInstance !=0) {
+            delete StartupProfiler::fInstance;
+            StartupProfiler::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+//
+// Times the named start-up phase, from construction to destruction.
+// Does nothing unless start-up profiling is enabled.
+//
+class StartupTimer
+{
+public:
+  StartupTimer(const string & phase);
+ ~StartupTimer();
+
+private:
+  bool                                  fOn;
+  string                                fPhase;
+  std::chrono::steady_clock::time_point fStart;
+};
+
+}      // genie namespace
+
+#endif // _STARTUP_PROFILER_H_
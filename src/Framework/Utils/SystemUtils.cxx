@@ -14,6 +14,8 @@
 
 #include <dirent.h>
 #include <ctime>
+#include <cstdio>
+#include <sstream>
 
 #include <TSystem.h>
 
@@ -87,6 +89,27 @@ bool genie::utils::system::FileExists(string filename)
   return false;
 }
 
+//___________________________________________________________________________
+string genie::utils::system::FileContentHash(string filename)
+{
+  FILE * file = fopen(filename.c_str(), "rb");
+  if(!file) return "";
+
+  unsigned long long h = 14695981039346656037ULL;
+  unsigned char buffer[65536];
+  size_t n = 0;
+  while( (n = fread(buffer, 1, sizeof(buffer), file)) > 0 ) {
+    for(size_t i = 0; i < n; i++) {
+      h ^= buffer[i];
+      h *= 1099511628211ULL;
+    }
+  }
+  fclose(file);
+
+  std::ostringstream hash;
+  hash << std::hex << h;
+  return hash.str();
+}
 //___________________________________________________________________________
 
 bool genie::utils::system::DirectoryExists( const char * path ) {
@@ -37,6 +37,10 @@ namespace system
   int GenieRevisVrsNum (string tag);
 
   bool FileExists(string filename);
+
+  // FNV-1a hash of the file contents, as a hex string ("" if unreadable),
+  // eg for checking that a cached result was made with the same input file
+  string FileContentHash(string filename);
   bool DirectoryExists( const char * path ) ;
 
   string LocalTimeAsString(string format);
@@ -0,0 +1,158 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+
+#include <TROOT.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/ThreadPool.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+ThreadPool * ThreadPool::fInstance = 0;
+thread_local bool ThreadPool::fgInLoop = false;
+//____________________________________________________________________________
+ThreadPool::ThreadPool() :
+fBody   (0),
+fN      (0),
+fNext   (0),
+fLoopId (0),
+fNBusy  (0),
+fStop   (false)
+{
+  fInstance = 0;
+}
+//____________________________________________________________________________
+ThreadPool::~ThreadPool()
+{
+  this->Stop();
+  fInstance = 0;
+}
+//____________________________________________________________________________
+ThreadPool * ThreadPool::Instance()
+{
+  static std::mutex init_mutex;
+  std::lock_guard<std::mutex> lock(init_mutex);
+
+  if(fInstance == 0) {
+    static ThreadPool::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+    fInstance = new ThreadPool;
+
+    const char * nthreads = std::getenv("GTHREADPOOLSIZE");
+    if(nthreads) fInstance->SetNThreads(std::atoi(nthreads));
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+void ThreadPool::SetNThreads(unsigned int n)
+{
+  std::lock_guard<std::mutex> loop_lock(fLoopMutex);
+
+  if(n < 1) n = 1;
+  if(n == this->NThreads()) return;
+
+  this->Stop();
+
+  if(n > 1) {
+    ROOT::EnableThreadSafety();
+    LOG("ThreadPool", pNOTICE) << "Starting " << n-1 << " worker threads";
+  }
+  for(unsigned int iw = 1; iw < n; iw++) {
+    fWorkers.push_back(std::thread(&ThreadPool::Work, this, iw, fLoopId));
+  }
+}
+//____________________________________________________________________________
+void ThreadPool::ParallelFor(int n, const Body_t & body)
+{
+  if(n <= 0) return;
+
+  // run serially if there are no workers, if the pool is busy, or if this
+  // is a nested loop
+  std::unique_lock<std::mutex> loop_lock(fLoopMutex, std::defer_lock);
+  if(fgInLoop || n == 1 || !loop_lock.try_lock() || fWorkers.empty()) {
+    for(int i = 0; i < n; i++) body(i, 0);
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(fMutex);
+    fBody  = &body;
+    fN     = n;
+    fNext  = 0;
+    fError = std::exception_ptr();
+    fNBusy = fWorkers.size();
+    fLoopId++;
+  }
+  fStartCond.notify_all();
+
+  fgInLoop = true;
+  this->RunIndices(0);
+  fgInLoop = false;
+
+  std::exception_ptr error;
+  {
+    std::unique_lock<std::mutex> lock(fMutex);
+    fDoneCond.wait(lock, [this] { return fNBusy == 0; });
+    fBody = 0;
+    error = fError;
+  }
+  if(error) std::rethrow_exception(error);
+}
+//____________________________________________________________________________
+void ThreadPool::RunIndices(unsigned int worker)
+{
+  int i = 0;
+  while( (i = fNext.fetch_add(1)) < fN ) {
+    try {
+      (*fBody)(i, worker);
+    }
+    catch(...) {
+      std::lock_guard<std::mutex> lock(fMutex);
+      if(!fError) fError = std::current_exception();
+      fNext = fN;  // skip the remaining indices
+    }
+  }
+}
+//____________________________________________________________________________
+void ThreadPool::Work(unsigned int worker, unsigned long done_id)
+{
+  fgInLoop = true;
+
+  while(true) {
+    std::unique_lock<std::mutex> lock(fMutex);
+    fStartCond.wait(lock, [&] { return fStop || fLoopId != done_id; });
+    if(fStop) return;
+    done_id = fLoopId;
+    lock.unlock();
+
+    this->RunIndices(worker);
+
+    lock.lock();
+    if(--fNBusy == 0) fDoneCond.notify_all();
+  }
+}
+//____________________________________________________________________________
+void ThreadPool::Stop(void)
+{
+  {
+    std::lock_guard<std::mutex> lock(fMutex);
+    fStop = true;
+  }
+  fStartCond.notify_all();
+  for(unsigned int iw = 0; iw < fWorkers.size(); iw++) {
+    if(fWorkers[iw].joinable()) fWorkers[iw].join();
+  }
+  fWorkers.clear();
+  fStop = false;
+}
+//____________________________________________________________________________
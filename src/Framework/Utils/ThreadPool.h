@@ -0,0 +1,103 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::ThreadPool
+
+\brief    A shared pool of worker threads running parallel-for loops, used
+          to spread embarrassingly parallel scans (eg the max cross section
+          scans of the kinematics generators) over several cores.
+
+          ParallelFor(n, body) calls body(i, worker) for every i in [0, n),
+          the calling thread taking part as worker 0, and returns once all
+          calls have completed. The pool is serial (all calls are made from
+          the calling thread) unless its size was set to more than 1, via
+          SetNThreads(), the GTHREADPOOLSIZE env. var or the --thread-pool-size
+          option of GENIE apps (see RunOpt).
+
+          Workers own their thread-local GENIE state (algorithms, cache and
+          random number generators): loop bodies run by workers other than
+          0 must not use algorithms configured in the calling thread but
+          look up their own ones through the AlgFactory.
+
+          Only one ParallelFor runs at a time: loops started while the pool
+          is busy (eg from several event generation threads), or from within
+          a loop body, run serially in their calling thread.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _THREAD_POOL_H_
+#define _THREAD_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace genie {
+
+class ThreadPool
+{
+public:
+  static ThreadPool * Instance(void);
+
+  typedef std::function<void (int i, unsigned int worker)> Body_t;
+
+  //! Calls body(i, worker) for i in [0, n) and waits for all calls to return
+  void ParallelFor (int n, const Body_t & body);
+
+  //! Number of threads taking part in a loop (incl. the calling thread)
+  unsigned int NThreads   (void) const { return fWorkers.size() + 1; }
+  void         SetNThreads(unsigned int n);
+
+private:
+  ThreadPool();
+  ThreadPool(const ThreadPool & pool);
+  virtual ~ThreadPool();
+
+  void Work       (unsigned int worker, unsigned long done_id);
+  void RunIndices (unsigned int worker);
+  void Stop       (void);
+
+  std::vector<std::thread> fWorkers;
+  std::mutex               fLoopMutex;   ///< held by the thread running a loop
+  std::mutex               fMutex;       ///< guards the loop state below
+  std::condition_variable  fStartCond;
+  std::condition_variable  fDoneCond;
+  const Body_t *           fBody;        ///< body of the current loop
+  int                      fN;           ///< size of the current loop
+  std::atomic<int>         fNext;        ///< next index of the current loop
+  unsigned long            fLoopId;      ///< incremented at every loop
+  unsigned int             fNBusy;       ///< workers still running the current loop
+  std::exception_ptr       fError;       ///< first exception thrown by the loop body
+  bool                     fStop;
+
+  static thread_local bool fgInLoop;     ///< is this thread running a loop body?
+
+  static ThreadPool * fInstance;
+
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (ThreadPool::fInstance !=0) {
+            delete ThreadPool::fInstance;
+            ThreadPool::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+}      // genie namespace
+
+#endif // _THREAD_POOL_H_
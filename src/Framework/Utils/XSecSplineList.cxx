@@ -12,26 +12,47 @@
 #include <cmath>   //provides: std::isnan()
 
 #include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <mutex>
+
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include "libxml/parser.h"
 #include "libxml/xmlmemory.h"
 #include "libxml/xmlreader.h"
 
 #include <TMath.h>
+#include <TMD5.h>
 #include <TLorentzVector.h>
 
+#include "Framework/Algorithm/AlgFactory.h"
 #include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Framework/Conventions/Units.h"
 #include "Framework/Conventions/GBuild.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/Spline.h"
+#include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/ParticleData/PDGUtils.h"
+#include "Framework/Registry/Registry.h"
+#include "Framework/Utils/Cache.h"
+#include "Framework/Utils/CacheBranchFx.h"
 #include "Framework/Utils/StringUtils.h"
 #include "Framework/Utils/PrintUtils.h"
 #include "Framework/Utils/XSecSplineList.h"
 #include "Framework/Utils/XmlParserUtils.h"
+#include "Framework/Utils/StartupProfiler.h"
 
 using std::ofstream;
+using std::ostringstream;
 using std::endl;
 
 namespace genie {
@@ -44,11 +65,19 @@ ostream & operator << (ostream & stream, const XSecSplineList & list)
 }
 //____________________________________________________________________________
 XSecSplineList * XSecSplineList::fInstance = 0;
+std::mutex       XSecSplineList::fgMutex;
+std::mutex       XSecSplineList::fgIndexMutex;
 //____________________________________________________________________________
 XSecSplineList::XSecSplineList()
 {
   fInstance    =  0;
   fCurrentTune = "";
+  fRevision    = 0;
+  fIndexRevision = 0;
+  fDeferLoad   = false;
+  fAdaptiveKnots = false;
+  fAdaptiveTol   = 1E-3;
+  fUseIntegralCache = false;
   fUseLogE     = true;
   fNKnots      = 100;
   fEmin        =   0.01; // GeV
@@ -59,6 +88,19 @@ XSecSplineList::~XSecSplineList()
 {
 // Clean up.
 
+  this->DeleteSplines();
+  fInstance = 0;
+}
+//____________________________________________________________________________
+void XSecSplineList::Clear(void)
+{
+  std::lock_guard<std::mutex> lock(fgMutex);
+  fRevision++;
+  this->DeleteSplines();
+}
+//____________________________________________________________________________
+void XSecSplineList::DeleteSplines(void)
+{
   map<string,  map<string, Spline *> >::iterator mm_iter = fSplineMap.begin();
   for( ; mm_iter != fSplineMap.end(); ++mm_iter) {
     // loop over splines for given tune
@@ -72,15 +114,19 @@ XSecSplineList::~XSecSplineList()
     spl_map_curr_tune.clear();
   }
   fSplineMap.clear();
-  fInstance = 0;
+  fConfigHashes.clear();
+  fDerivedSplineSet.clear();
 }
 //____________________________________________________________________________
 XSecSplineList * XSecSplineList::Instance()
 {
   if(fInstance == 0) {
-    static XSecSplineList::Cleaner cleaner;
-    cleaner.DummyMethodAndSilentCompiler();
-    fInstance = new XSecSplineList;
+    std::lock_guard<std::mutex> lock(fgMutex);
+    if(fInstance == 0) {
+      static XSecSplineList::Cleaner cleaner;
+      cleaner.DummyMethodAndSilentCompiler();
+      fInstance = new XSecSplineList;
+    }
   }
   return fInstance;
 }
@@ -88,12 +134,25 @@ XSecSplineList * XSecSplineList::Instance()
 bool XSecSplineList::SplineExists(
             const XSecAlgorithmI * alg, const Interaction * interaction) const
 {
+  if(!alg || !interaction) return false;
+
+  uint64_t hkey = this->BuildSplineHash(alg,interaction);
+  if(this->GetSpline(hkey)) return true;
+
   string key = this->BuildSplineKey(alg,interaction);
-  return this->SplineExists(key);
+  const Spline * spline = 0;
+  if(this->SplineExists(key)) {
+    spline = this->GetSpline(key);
+  } else if(this->CanDeriveSpline(alg,interaction)) {
+    spline = this->DeriveSpline(alg,interaction,key);
+  }
+  this->IndexSpline(hkey, spline);
+  return (spline != 0);
 }
 //____________________________________________________________________________
 bool XSecSplineList::SplineExists(string key) const
 {
+  this->LoadPending();
 
   if ( fCurrentTune.size() == 0 ) {
     SLOG("XSecSplLst", pERROR) << "Spline requested while CurrentTune not set" ;
@@ -120,12 +179,53 @@ bool XSecSplineList::SplineExists(string key) const
 const Spline * XSecSplineList::GetSpline(
             const XSecAlgorithmI * alg, const Interaction * interaction) const
 {
+  if(alg && interaction) {
+    uint64_t hkey = this->BuildSplineHash(alg,interaction);
+    const Spline * spline = this->GetSpline(hkey);
+    if(spline) return spline;
+
+    string key = this->BuildSplineKey(alg,interaction);
+    if(!this->SplineExists(key) && this->CanDeriveSpline(alg,interaction)) {
+      spline = this->DeriveSpline(alg,interaction,key);
+    }
+    if(!spline) spline = this->GetSpline(key);
+    this->IndexSpline(hkey, spline);
+    return spline;
+  }
   string key = this->BuildSplineKey(alg,interaction);
   return this->GetSpline(key);
 }
 //____________________________________________________________________________
+const Spline * XSecSplineList::GetSpline(uint64_t hkey) const
+{
+  std::lock_guard<std::mutex> lock(fgIndexMutex);
+
+  if(fIndexRevision != fRevision) return 0;
+
+  std::unordered_map<uint64_t, const Spline *>::const_iterator it =
+                                                    fSplineIndex.find(hkey);
+  if(it == fSplineIndex.end()) return 0;
+  return it->second;
+}
+//____________________________________________________________________________
+void XSecSplineList::IndexSpline(uint64_t hkey, const Spline * spline) const
+{
+  if(!spline) return;
+
+  std::lock_guard<std::mutex> lock(fgIndexMutex);
+
+  // splines added / loaded or a change of the current tune invalidate the
+  // index (see Revision())
+  if(fIndexRevision != fRevision) {
+    fSplineIndex.clear();
+    fIndexRevision = fRevision;
+  }
+  fSplineIndex[hkey] = spline;
+}
+//____________________________________________________________________________
 const Spline * XSecSplineList::GetSpline(string key) const
 {
+  this->LoadPending();
 
   if ( fCurrentTune.size() == 0 ) {
     SLOG("XSecSplLst", pFATAL) << "Spline requested while CurrentTune not set" ;
@@ -166,9 +266,6 @@ void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
   // rwh -- uncomment to catch NaN
   // feenableexcept(FE_DIVBYZERO|FE_INVALID|FE_OVERFLOW);
 
-  double xsec[nknots];
-  double E   [nknots];
-
   SLOG("XSecSplLst", pNOTICE)
      << "Creating cross section spline using the algorithm: " << *alg;
 
@@ -177,9 +274,7 @@ void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
   // If any of the nknots,e_min,e_max was not set or its value is not acceptable
   // use the list values
   //
-  if (e_min   < 0.) e_min = this->Emin();
-  if (e_max   < 0.) e_max = this->Emax();
-  if (nknots <= 2) nknots = this->NKnots();
+  this->KnotSettings(nknots, e_min, e_max);
   assert( e_min < e_max );
 
   // Distribute the knots in the energy range (e_min,e_max) :
@@ -198,6 +293,16 @@ void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
   int nkb = (Ethr>e_min) ? 5 : 0; // number of knots <  threshold
   int nka = nknots-nkb;           // number of knots >= threshold
 
+  // In adaptive mode, start from a coarse grid above threshold and refine
+  // it later on. The number of knots requested becomes the maximum number.
+  if(fAdaptiveKnots) {
+    nka = TMath::Min(nka, TMath::Max(5, nka/8));
+  }
+  int nk = nkb + nka;
+
+  vector<double> E   (nk);
+  vector<double> xsec(nk);
+
   // knots < energy threshold
   double dEb =  (Ethr>e_min) ? (Ethr - e_min) / nkb : 0;
   for(int i=0; i<nkb; i++) {
@@ -218,52 +323,58 @@ void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
        E[i+nkb] = E0 + i * dEa;
   }
   // force last point to avoid floating point cumulative slew
-  E[nknots-1] = e_max;
+  E[nk-1] = e_max;
 
   // Compute cross sections for the input interaction at the selected
   // set of energies
   //
-  double pr_mass = interaction->InitStatePtr()->Probe()->Mass();
-  for (int i = 0; i < nknots; i++) {
-    TLorentzVector p4(0,0,E[i],E[i]);
-    if (pr_mass > 0.) {
-      double pz = TMath::Max(0.,E[i]*E[i] - pr_mass*pr_mass);
-      pz = TMath::Sqrt(pz);
-      p4.SetPz(pz);
-    }
-    interaction->InitStatePtr()->SetProbeP4(p4);
-    xsec[i] = alg->Integral(interaction);
-    SLOG("XSecSplLst", pNOTICE)
-                       << "xsec(E = " << E[i] << ") =  "
-                       << (1E+38/units::cm2)*xsec[i] << " x 1E-38 cm^2";
-    if ( std::isnan(xsec[i]) ) {
-      // this sometimes happens near threshold, warn and move on
-      SLOG("XSecSplLst", pWARN)
-                       << "xsec(E = " << E[i] << ") =  "
-                       << (1E+38/units::cm2)*xsec[i] << " x 1E-38 cm^2"
-                       << " : converting NaN to 0.0";
-      xsec[i] = 0.0;
+  // If requested, integrals computed by any previous job for an identical
+  // algorithm configuration and interaction are taken from the cache
+  //
+  CacheBranchFx * cache_branch = 0;
+  if(fUseIntegralCache) {
+    Cache * cache = Cache::Instance();
+    string cache_key = this->IntegralCacheKey(alg, interaction);
+    cache_branch = dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(cache_key));
+    if(!cache_branch) {
+      cache_branch = new CacheBranchFx("xsec integrals for " + key);
+      cache->AddCacheBranch(cache_key, cache_branch, true);
     }
+  }
 
+  for (int i = 0; i < nk; i++) {
+    xsec[i] = this->ComputeXSec(alg, interaction, E[i], cache_branch);
+  }
+
+  // Adaptive mode: refine the knots above threshold
+  //
+  if(fAdaptiveKnots) {
+    this->RefineKnots(alg, interaction, nkb, nknots, E, xsec, cache_branch);
+    nk = E.size();
   }
 
   // Warn about odd case of decreasing cross section
   //    but allow for small variation due to integration errors
   const double eps_xsec = 1.0e-5;
   const double xsec_scale = (1.0-eps_xsec);
-  if ( xsec[nknots-1] < xsec[nknots-2]*xsec_scale ) {
+  if ( xsec[nk-1] < xsec[nk-2]*xsec_scale ) {
     SLOG("XSecSplLst", pWARN)
       << "Last point oddity: " << key <<  " has "
-      << " xsec[nknots-1] " << xsec[nknots-1] << " < "
-      << " xsec[nknots-2] " << xsec[nknots-2];
+      << " xsec[nknots-1] " << xsec[nk-1] << " < "
+      << " xsec[nknots-2] " << xsec[nk-2];
   }
 
   // Build
   //
-  Spline * spline = new Spline(nknots, E, xsec);
+  Spline * spline = new Spline(nk, &E[0], &xsec[0]);
+  string config_hash = this->ConfigHash(alg, interaction, nknots, e_min, e_max);
 
   // Save
+  // (splines may be computed concurrently by the GEVGDrivers of different
+  // event generation threads - serialize the insertion)
   //
+  std::lock_guard<std::mutex> lock(fgMutex);
+  fRevision++;
   map<string,  map<string, Spline *> >::iterator //\/
   mm_iter = fSplineMap.find(fCurrentTune);
   if(mm_iter == fSplineMap.end()) {
@@ -274,10 +385,279 @@ void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
   }
   map<string, Spline *> & spl_map_curr_tune = mm_iter->second;
   spl_map_curr_tune.insert( map<string, Spline *>::value_type(key, spline) );
+  fConfigHashes[fCurrentTune][key] = config_hash;
+}
+//____________________________________________________________________________
+void XSecSplineList::RemoveSpline(
+   const XSecAlgorithmI * alg, const Interaction * interaction)
+{
+// Delete the spline for the input algorithm and interaction (in the current
+// tune), eg so that it can be built again with CreateSpline()
+
+  this->LoadPending();
+
+  string key = this->BuildSplineKey(alg,interaction);
+
+  std::lock_guard<std::mutex> lock(fgMutex);
+  map<string,  map<string, Spline *> >::iterator //\/
+  mm_iter = fSplineMap.find(fCurrentTune);
+  if(mm_iter == fSplineMap.end()) return;
+  map<string, Spline *>::iterator m_iter = mm_iter->second.find(key);
+  if(m_iter == mm_iter->second.end()) return;
+
+  SLOG("XSecSplLst", pNOTICE) << "Removing spline: " << key;
+
+  // the hash index is rebuilt as the revision changes
+  fRevision++;
+  delete m_iter->second;
+  mm_iter->second.erase(m_iter);
+  fLoadedSplineSet[fCurrentTune].erase(key);
+  fConfigHashes[fCurrentTune].erase(key);
+  fDerivedSplineSet[fCurrentTune].erase(key);
+}
+//____________________________________________________________________________
+int XSecSplineList::RemoveSplinesExcept(const set<string> & keys)
+{
+// Delete all splines of the current tune whose key is not in the input set,
+// eg the splines loaded from a file but not needed by any event generation
+// driver of the job
+
+  this->LoadPending();
+
+  std::lock_guard<std::mutex> lock(fgMutex);
+  map<string,  map<string, Spline *> >::iterator //\/
+  mm_iter = fSplineMap.find(fCurrentTune);
+  if(mm_iter == fSplineMap.end()) return 0;
+
+  int nrm = 0;
+  map<string, Spline *> & spl_map_curr_tune = mm_iter->second;
+  map<string, Spline *>::iterator m_iter = spl_map_curr_tune.begin();
+  while(m_iter != spl_map_curr_tune.end()) {
+    if(keys.count(m_iter->first) > 0) { ++m_iter; continue; }
+    fLoadedSplineSet[fCurrentTune].erase(m_iter->first);
+    fConfigHashes[fCurrentTune].erase(m_iter->first);
+    fDerivedSplineSet[fCurrentTune].erase(m_iter->first);
+    delete m_iter->second;
+    spl_map_curr_tune.erase(m_iter++);
+    nrm++;
+  }
+  if(nrm > 0) {
+    SLOG("XSecSplLst", pNOTICE)
+       << "Removed " << nrm << " splines of tune " << fCurrentTune
+       << " (kept " << spl_map_curr_tune.size() << ")";
+    // the hash index is rebuilt as the revision changes
+    fRevision++;
+  }
+  return nrm;
+}
+//____________________________________________________________________________
+size_t XSecSplineList::MemoryFootprint(void) const
+{
+  this->LoadPending();
+
+  size_t bytes = sizeof(XSecSplineList);
+  map<string,  map<string, Spline *> >::const_iterator //\/
+  mm_iter = fSplineMap.begin();
+  for( ; mm_iter != fSplineMap.end(); ++mm_iter) {
+    map<string, Spline *>::const_iterator m_iter = mm_iter->second.begin();
+    for( ; m_iter != mm_iter->second.end(); ++m_iter) {
+      bytes += m_iter->first.capacity();
+      if(m_iter->second) bytes += m_iter->second->MemoryFootprint();
+    }
+  }
+  return bytes;
+}
+//____________________________________________________________________________
+double XSecSplineList::ComputeXSec(const XSecAlgorithmI * alg,
+        const Interaction * interaction, double E, CacheBranchFx * cache) const
+{
+// Compute the cross section for the input interaction at energy E, unless it
+// is found in the input cache branch (if any)
+
+  if(cache) {
+    double Ec = 0, xsec_cached = 0;
+    if(cache->FindAbove(E, Ec, xsec_cached) && Ec == E) {
+      SLOG("XSecSplLst", pNOTICE)
+                     << "xsec(E = " << E << ") =  "
+                     << (1E+38/units::cm2)*xsec_cached << " x 1E-38 cm^2 (cached)";
+      return xsec_cached;
+    }
+  }
+
+  double pr_mass = interaction->InitStatePtr()->Probe()->Mass();
+  TLorentzVector p4(0,0,E,E);
+  if (pr_mass > 0.) {
+    double pz = TMath::Max(0.,E*E - pr_mass*pr_mass);
+    pz = TMath::Sqrt(pz);
+    p4.SetPz(pz);
+  }
+  interaction->InitStatePtr()->SetProbeP4(p4);
+  double xsec = alg->Integral(interaction);
+  SLOG("XSecSplLst", pNOTICE)
+                     << "xsec(E = " << E << ") =  "
+                     << (1E+38/units::cm2)*xsec << " x 1E-38 cm^2";
+  if ( std::isnan(xsec) ) {
+    // this sometimes happens near threshold, warn and move on
+    SLOG("XSecSplLst", pWARN)
+                     << "xsec(E = " << E << ") =  "
+                     << (1E+38/units::cm2)*xsec << " x 1E-38 cm^2"
+                     << " : converting NaN to 0.0";
+    xsec = 0.0;
+  }
+  if(cache) cache->AddValues(E, xsec);
+  return xsec;
+}
+//____________________________________________________________________________
+string XSecSplineList::IntegralCacheKey(
+   const XSecAlgorithmI * alg, const Interaction * interaction) const
+{
+// Content-addressed key for the cross section integrals: MD5 hash of the
+// resolved configuration of the cross section algorithm (and of all its
+// sub-algorithms) and of the interaction. The key does not depend on the
+// tune name, so integrals are shared by all tunes with identical settings.
+
+  string fp = alg->ConfigFingerprint() + "|" + interaction->AsString();
+  TMD5 md5;
+  md5.Update((const UChar_t *) fp.data(), fp.size());
+  md5.Final();
+
+  return Cache::Instance()->CacheBranchKey("XSecIntegral", md5.AsString());
+}
+//____________________________________________________________________________
+void XSecSplineList::KnotSettings(int & nknots, double & e_min, double & e_max) const
+{
+  if (e_min   < 0.) e_min = this->Emin();
+  if (e_max   < 0.) e_max = this->Emax();
+  if (nknots <= 2) nknots = this->NKnots();
+}
+//____________________________________________________________________________
+string XSecSplineList::ConfigHash(const XSecAlgorithmI * alg,
+   const Interaction * interaction, int nknots, double e_min, double e_max) const
+{
+// Unlike the integral cache key, the hash depends on the knot settings: a
+// spline built with a different number of knots or energy range, or in E
+// rather than log(E), changes too.
+
+  this->KnotSettings(nknots, e_min, e_max);
+
+  ostringstream fp;
+  fp << alg->ConfigFingerprint() << "|" << interaction->AsString()
+     << "|" << std::setprecision(17) << nknots << ";" << e_min << ";" << e_max
+     << ";" << fUseLogE << ";" << (fAdaptiveKnots ? fAdaptiveTol : 0.);
+  string sfp = fp.str();
+
+  TMD5 md5;
+  md5.Update((const UChar_t *) sfp.data(), sfp.size());
+  md5.Final();
+
+  return md5.AsString();
+}
+//____________________________________________________________________________
+string XSecSplineList::SplineConfigHash(
+   const XSecAlgorithmI * alg, const Interaction * interaction) const
+{
+  this->LoadPending();
+
+  map<string, map<string, string> >::const_iterator //\/
+  mm_iter = fConfigHashes.find(fCurrentTune);
+  if(mm_iter == fConfigHashes.end()) return "";
+  map<string, string>::const_iterator m_iter =
+     mm_iter->second.find(this->BuildSplineKey(alg,interaction));
+  if(m_iter == mm_iter->second.end()) return "";
+  return m_iter->second;
+}
+//____________________________________________________________________________
+bool XSecSplineList::SplineIsCurrent(const XSecAlgorithmI * alg,
+   const Interaction * interaction, int nknots, double e_min, double e_max) const
+{
+// Does the spline exist and was it built with the current configuration?
+// Splines loaded from files without configuration hashes are not current.
+
+  if(!this->SplineExists(alg, interaction)) return false;
+  string stored = this->SplineConfigHash(alg, interaction);
+  if(stored.size() == 0) return false;
+  return stored == this->ConfigHash(alg, interaction, nknots, e_min, e_max);
+}
+//____________________________________________________________________________
+void XSecSplineList::RefineKnots(const XSecAlgorithmI * alg,
+        const Interaction * interaction, int nkb, int nkmax,
+        vector<double> & E, vector<double> & xsec, CacheBranchFx * cache) const
+{
+// Adaptive knot placement: Compare, at the midpoint of each interval above
+// the threshold (knot nkb onwards), the computed cross section with the one
+// interpolated from the current knots. Intervals where the relative
+// difference exceeds the tolerance are split, worst first, as long as the
+// number of knots stays below nkmax. Repeat until all intervals converge.
+// Midpoints are in log(E) if the list is built in log(E).
+
+  const double min_width = 1E-4; // don't split intervals narrower than that (relative)
+
+  int ncalls = 0;
+  vector<bool> converged(E.size(), false); // interval i: E[i] to E[i+1]
+  for(int i = 0; i < nkb; i++) converged[i] = true;
+
+  while( (int) E.size() < nkmax ) {
+
+    double xsec_max = *std::max_element(xsec.begin(), xsec.end());
+    Spline current(E.size(), &E[0], &xsec[0]);
+
+    // test the midpoints of all intervals not converged yet
+    vector< pair<double, int> > failed; // { error, interval }
+    map<int, pair<double,double> > midpoints; // interval -> { E, xsec }
+    for(unsigned int i = 0; i < E.size()-1; i++) {
+      if(converged[i]) continue;
+      if(E[i+1] - E[i] < min_width * E[i+1]) { converged[i] = true; continue; }
+
+      double Em = (this->UseLogE()) ? TMath::Sqrt(E[i] * E[i+1]) : 0.5*(E[i] + E[i+1]);
+      double xm = this->ComputeXSec(alg, interaction, Em, cache);
+      ncalls++;
+
+      double xi    = current.Evaluate(Em);
+      double scale = TMath::Max(TMath::Abs(xm), fAdaptiveTol * xsec_max);
+      double err   = (scale > 0) ? TMath::Abs(xm - xi) / scale : 0;
+      if(err > fAdaptiveTol) {
+        failed.push_back(pair<double,int>(err, i));
+        midpoints[i] = pair<double,double>(Em, xm);
+      } else {
+        converged[i] = true;
+      }
+    }
+    if(failed.empty()) break;
+
+    // split the worst intervals first, within the knot budget
+    std::sort(failed.rbegin(), failed.rend());
+    int nsplit = TMath::Min((int) failed.size(), nkmax - (int) E.size());
+    set<int> split;
+    for(int j = 0; j < nsplit; j++) split.insert(failed[j].second);
+
+    vector<double> newE, newxsec;
+    vector<bool>   newconverged;
+    for(unsigned int i = 0; i < E.size(); i++) {
+      newE.push_back(E[i]);
+      newxsec.push_back(xsec[i]);
+      if(i == E.size()-1) break;
+      newconverged.push_back(converged[i]);
+      if(split.count(i) == 1) {
+        newE.push_back(midpoints[i].first);
+        newxsec.push_back(midpoints[i].second);
+        newconverged.push_back(false);
+      }
+    }
+    newconverged.push_back(false);
+    E.swap(newE);
+    xsec.swap(newxsec);
+    converged.swap(newconverged);
+  }
+
+  SLOG("XSecSplLst", pNOTICE)
+    << "Adaptive knot placement: " << E.size() << " knots (max: " << nkmax
+    << "), " << ncalls << " extra cross section calculations";
 }
 //____________________________________________________________________________
 int XSecSplineList::NSplines(void) const
 {
+  this->LoadPending();
+
   map<string,  map<string, Spline *> >::const_iterator //
   mm_iter = fSplineMap.find(fCurrentTune);
   if(mm_iter == fSplineMap.end()) {
@@ -295,11 +675,94 @@ bool XSecSplineList::IsEmpty(void) const
   return (n == 0);
 }
 //____________________________________________________________________________
+bool XSecSplineList::CanDeriveSpline(
+            const XSecAlgorithmI * alg, const Interaction * interaction) const
+{
+// Can the spline of the input interaction be derived from a free nucleon
+// spline? Only for a bound (proton or neutron) hit nucleon and for models
+// flagged so.
+
+  if(!alg || !interaction) return false;
+
+  const Target & target = interaction->InitState().Tgt();
+  if(!target.IsNucleus() || !target.HitNucIsSet()) return false;
+  if(interaction->TestBit(kIAssumeFreeNucleon)) return false;
+
+  return alg->DerivesNuclearSplines();
+}
+//____________________________________________________________________________
+Interaction * XSecSplineList::FreeNucleonInteraction(
+                                        const Interaction * interaction) const
+{
+// Copy of the input interaction, with the hit nucleon as the target
+
+  Interaction * in = new Interaction(*interaction);
+  int nucleon_pdgc = in->InitState().Tgt().HitNucPdg();
+  in->InitStatePtr()->TgtPtr()->SetId(
+     pdg::IsProton(nucleon_pdgc) ? kPdgTgtFreeP : kPdgTgtFreeN);
+  return in;
+}
+//____________________________________________________________________________
+bool XSecSplineList::IsDerivedSpline(string key) const
+{
+  map<string, set<string> >::const_iterator //\/
+  it = fDerivedSplineSet.find(fCurrentTune);
+  return (it != fDerivedSplineSet.end() && it->second.count(key) == 1);
+}
+//____________________________________________________________________________
+const Spline * XSecSplineList::DeriveSpline(const XSecAlgorithmI * alg,
+           const Interaction * interaction, const string & key) const
+{
+// Synthesise the spline of the input interaction (with the input key) as
+// Z x the free proton or N x the free neutron spline, and store it in the
+// current tune. Returns 0 if there is no free nucleon spline.
+
+  Interaction * in = this->FreeNucleonInteraction(interaction);
+  string free_key = this->BuildSplineKey(alg, in);
+  delete in;
+
+  if(!this->SplineExists(free_key)) {
+    SLOG("XSecSplLst", pDEBUG)
+      << "No free nucleon spline " << free_key << " to derive " << key << " from";
+    return 0;
+  }
+  const Spline * free_spline = this->GetSpline(free_key);
+
+  const Target & target = interaction->InitState().Tgt();
+  int NNucl = pdg::IsProton(target.HitNucPdg()) ? target.Z() : target.N();
+
+  std::lock_guard<std::mutex> lock(fgMutex);
+
+  // derived by another thread meanwhile?
+  map<string, Spline *> & spl_map_curr_tune =
+     const_cast<XSecSplineList *>(this)->fSplineMap[fCurrentTune];
+  map<string, Spline *>::const_iterator m_iter = spl_map_curr_tune.find(key);
+  if(m_iter != spl_map_curr_tune.end()) return m_iter->second;
+
+  SLOG("XSecSplLst", pINFO)
+    << "Deriving spline: " << key << " as " << NNucl << " x " << free_key;
+
+  Spline * spline = new Spline(*free_spline);
+  spline->Multiply((double) NNucl);
+
+  XSecSplineList * self = const_cast<XSecSplineList *>(this);
+  self->fRevision++;
+  spl_map_curr_tune.insert( map<string, Spline *>::value_type(key, spline) );
+  self->fDerivedSplineSet[fCurrentTune].insert(key);
+  return spline;
+}
+//____________________________________________________________________________
 void XSecSplineList::SetLogE(bool on)
 {
   fUseLogE = on;
 }
 //____________________________________________________________________________
+void XSecSplineList::SetAdaptiveKnots(bool on, double tolerance)
+{
+  fAdaptiveKnots = on;
+  if(tolerance > 0) fAdaptiveTol = tolerance;
+}
+//____________________________________________________________________________
 void XSecSplineList::SetNKnots(int nk)
 {
   fNKnots = nk;
@@ -366,9 +829,23 @@ void XSecSplineList::SaveAsXml(const string & filename, bool save_init) const
       }
       if(from_init_set && !save_init) continue;
 
+      // Splines derived from free nucleon splines are not saved
+      map<string, set<string> >::const_iterator //\/
+      dit = fDerivedSplineSet.find(tune_name);
+      if(dit != fDerivedSplineSet.end() && dit->second.count(key) == 1) continue;
+
       // Add current spline to output file
       Spline * spline = m_iter->second;
-      spline->SaveAsXml(outxml,"E","xsec", key);
+      string config = "";
+      map<string, map<string, string> >::const_iterator //\/
+      ch_iter = fConfigHashes.find(tune_name);
+      if(ch_iter != fConfigHashes.end()) {
+        map<string, string>::const_iterator h = ch_iter->second.find(key);
+        if(h != ch_iter->second.end() && h->second.size() > 0) {
+          config = "config=\"" + h->second + "\"";
+        }
+      }
+      spline->SaveAsXml(outxml,"E","xsec", key, config);
     }//spline loop
 
     outxml << "  </genie_tune>" << endl;
@@ -379,11 +856,13 @@ void XSecSplineList::SaveAsXml(const string & filename, bool save_init) const
   outxml.close();
 }
 //____________________________________________________________________________
-XmlParserStatus_t XSecSplineList::LoadFromXml(const string & filename, bool keep)
+XmlParserStatus_t XSecSplineList::LoadFromXml(
+   const string & filename, bool keep, const set<string> * init_states)
 {
 //! Load XSecSplineList from ROOT file. If keep = true, then the loaded splines
 //! are added to the existing list. If false, then the existing list is reset
-//! before loading the splines.
+//! before loading the splines. If init_states are given, only the splines
+//! for these initial states are loaded.
 
   SLOG("XSecSplLst", pNOTICE)
     << "Loading splines from: " << filename;
@@ -391,18 +870,51 @@ XmlParserStatus_t XSecSplineList::LoadFromXml(const string & filename, bool keep
     << "Option to keep pre-existing splines is switched "
     << ( (keep) ? "ON" : "OFF" );
 
-  if(!keep) fSplineMap.clear();
+  if(!keep) { fSplineMap.clear(); fConfigHashes.clear(); fDerivedSplineSet.clear(); }
+  fRevision++;
+
+  int uselog = -1;
+  XmlParserStatus_t status = XSecSplineList::ReadXml(filename,
+    [this, init_states] (const string & tune, const string & key,
+                         int nknots, const double * E, const double * xsec,
+                         const string & config) {
+       // skip splines for initial states not requested
+       if(!XSecSplineList::PassesFilter(key, init_states)) return;
+       // the spline copies the knots: they are not modified
+       Spline * spline = new Spline(nknots,
+           const_cast<double *>(E), const_cast<double *>(xsec));
+       fSplineMap[tune].insert( map<string, Spline *>::value_type(key, spline) );
+       fLoadedSplineSet[tune].insert(key);
+       if(config.size() > 0) fConfigHashes[tune][key] = config;
+    }, &uselog);
+
+  if(uselog >= 0) this->SetLogE(uselog == 1);
+
+  // a missing file is reported but is not an error
+  if(status == kXmlEmpty) return kXmlOK;
+  return status;
+}
+//____________________________________________________________________________
+XmlParserStatus_t XSecSplineList::ReadXml(
+   const string & filename, const SplineVisitor_t & visitor, int * uselog)
+{
+//! Reads the splines of an XML file, calling the visitor for each spline in
+//! file order. Nothing is kept: The knot arrays passed to the visitor are
+//! only valid during the call. Returns kXmlEmpty if the file isn't found.
 
   const int kNodeTypeStartElement = 1;
   const int kNodeTypeEndElement   = 15;
   const int kKnotX                = 0;
   const int kKnotY                = 1;
 
+  if(uselog) *uselog = -1;
+
   xmlTextReaderPtr reader;
 
   int ret = 0, val_type = -1, iknot = 0, nknots = 0;
-  double * E = 0, * xsec = 0;
+  vector<double> E, xsec;
   string spline_name = "";
+  string spline_config = "";
   string temp_tune ;
 
   reader = xmlNewTextReaderFilename(filename.c_str());
@@ -419,6 +931,9 @@ XmlParserStatus_t XSecSplineList::LoadFromXml(const string & filename, bool keep
                if(xmlStrcmp(name, (const xmlChar *) "genie_xsec_spline_list")) {
                    LOG("XSecSplLst", pERROR)
                      << "\nXML doc. has invalid root element! [filename: " << filename << "]";
+                   xmlFree(name);
+                   xmlFree(value);
+                   xmlFreeTextReader(reader);
                    return kXmlInvalidRoot;
                }
 
@@ -430,8 +945,7 @@ XmlParserStatus_t XSecSplineList::LoadFromXml(const string & filename, bool keep
                LOG("XSecSplLst", pNOTICE)
                    << "Input x-section spline XML file format version: " << svrs;
 
-               if (atoi(sinlog.c_str()) == 1) this->SetLogE(true);
-               else this->SetLogE(false);
+               if(uselog) *uselog = (atoi(sinlog.c_str()) == 1) ? 1 : 0;
 
                xmlFree(xvrs);
                xmlFree(xinlog);
@@ -447,16 +961,22 @@ XmlParserStatus_t XSecSplineList::LoadFromXml(const string & filename, bool keep
             if( (!xmlStrcmp(name, (const xmlChar *) "spline")) && type==kNodeTypeStartElement) {
                xmlChar * xname = xmlTextReaderGetAttribute(reader,(const xmlChar*)"name");
                xmlChar * xnkn  = xmlTextReaderGetAttribute(reader,(const xmlChar*)"nknots");
+               xmlChar * xcfg  = xmlTextReaderGetAttribute(reader,(const xmlChar*)"config");
                string sname    = utils::str::TrimSpaces((const char *)xname);
                string snkn     = utils::str::TrimSpaces((const char *)xnkn);
 
-               spline_name = sname;
+               spline_name   = sname;
+               spline_config = "";
+               if(xcfg) {
+                 spline_config = utils::str::TrimSpaces((const char *)xcfg);
+                 xmlFree(xcfg);
+               }
                SLOG("XSecSplLst", pNOTICE) << "Loading spline: " << spline_name;
 
                nknots = atoi( snkn.c_str() );
                iknot=0;
-               E     = new double[nknots];
-               xsec  = new double[nknots];
+               E.assign   (nknots, 0.);
+               xsec.assign(nknots, 0.);
 
                xmlFree(xname);
                xmlFree(xnkn);
@@ -465,38 +985,24 @@ XmlParserStatus_t XSecSplineList::LoadFromXml(const string & filename, bool keep
             if( (!xmlStrcmp(name, (const xmlChar *) "E"))    && type==kNodeTypeStartElement) { val_type = kKnotX; }
             if( (!xmlStrcmp(name, (const xmlChar *) "xsec")) && type==kNodeTypeStartElement) { val_type = kKnotY; }
 
-            if( (!xmlStrcmp(name, (const xmlChar *) "#text")) && depth==5) {
+            if( (!xmlStrcmp(name, (const xmlChar *) "#text")) && depth==5 && iknot < nknots) {
                 if      (val_type==kKnotX) E   [iknot] = atof((const char *)value);
                 else if (val_type==kKnotY) xsec[iknot] = atof((const char *)value);
             }
             if( (!xmlStrcmp(name, (const xmlChar *) "knot")) && type==kNodeTypeEndElement) {
                iknot++;
             }
-            if( (!xmlStrcmp(name, (const xmlChar *) "spline")) && type==kNodeTypeEndElement) {
+            bool spline_end =
+               (!xmlStrcmp(name, (const xmlChar *) "spline")) && type==kNodeTypeEndElement;
+            if(spline_end) {
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
                LOG("XSecSplLst", pINFO) << "Done with current spline";
                for(int i=0; i<nknots; i++) {
                   LOG("XSecSplLst", pINFO) << "xsec[E = " << E[i] << "] = " << xsec[i];
                }
 #endif
-               // done looping over knots - build the spline
-               Spline * spline = new Spline(nknots, E, xsec);
-               delete [] E;
-               delete [] xsec;
-
-               // insert the spline to the map
-               map<string,  map<string, Spline *> >::iterator //\/
-               mm_iter = fSplineMap.find( temp_tune );
-               if(mm_iter == fSplineMap.end()) {
-                 map<string, Spline *> spl_map_curr_tune;
-                 fSplineMap.insert( map<string, map<string, Spline *> >::value_type(
-                    temp_tune, spl_map_curr_tune) );
-                 mm_iter = fSplineMap.find( temp_tune );
-               }
-               map<string, Spline *> & spl_map_curr_tune = mm_iter->second;
-               spl_map_curr_tune.insert(
-                  map<string, Spline *>::value_type(spline_name, spline) );
-               fLoadedSplineSet[temp_tune].insert(spline_name);
+               // done looping over knots - pass the spline on
+               if(nknots > 0) visitor(temp_tune, spline_name, nknots, &E[0], &xsec[0], spline_config);
             }
             xmlFree(name);
             xmlFree(value);
@@ -511,11 +1017,382 @@ XmlParserStatus_t XSecSplineList::LoadFromXml(const string & filename, bool keep
   } else {
     LOG("XSecSplLst", pERROR)
           << "\nXML file could not be found! [filename: " << filename << "]";
+    return kXmlEmpty;
+  }
+
+  return kXmlOK;
+}
+//____________________________________________________________________________
+// Binary spline file layout (native byte order, all offsets in bytes from
+// the start of the file):
+//
+//   BinSplHeader                        : signature, version, counts, offsets
+//   BinSplIndexEntry [nsplines]         : one per spline, sorted by tune & key
+//   char             [...]              : string table (tune names, keys &
+//                                         configuration hashes)
+//   double           [...]              : knots, 8-byte aligned, for each
+//                                         spline E[nknots] then xsec[nknots]
+//
+namespace {
+  const char     kBinSplSignature[8] = { 'G','X','S','P','L','B','I','N' };
+  const uint32_t kBinSplVersion      = 2; // 1: no configuration hashes
+
+  struct BinSplHeader {
+    char     signature[8];
+    uint32_t version;
+    uint32_t uselog;
+    uint64_t nsplines;
+    uint64_t index_offset;
+    uint64_t strings_offset;
+    uint64_t knots_offset;
+    uint64_t file_size;
+  };
+  struct BinSplIndexEntry {
+    uint64_t tune_offset;   // in string table
+    uint64_t key_offset;    // in string table
+    uint32_t tune_length;
+    uint32_t key_length;
+    uint64_t knots_offset;  // in doubles, from the start of the knot block
+    uint64_t nknots;
+    uint64_t config_offset; // in string table
+    uint32_t config_length; // 0 if unknown
+    uint32_t reserved;
+  };
+  struct BinSplIndexEntryV1 {
+    uint64_t tune_offset;
+    uint64_t key_offset;
+    uint32_t tune_length;
+    uint32_t key_length;
+    uint64_t knots_offset;
+    uint64_t nknots;
+  };
+}
+//____________________________________________________________________________
+void XSecSplineList::SaveAsBinary(const string & filename, bool save_init) const
+{
+  SLOG("XSecSplLst", pNOTICE)
+       << "Saving XSecSplineList in binary format in file: " << filename;
+
+  // collect the splines to write out, as in SaveAsXml()
+  vector<BinSplIndexEntry> index;
+  vector<const Spline *>   splines;
+  string                   strings;
+  uint64_t                 nknots_total = 0;
+
+  map<string,  map<string, Spline *> >::const_iterator //\/
+  mm_iter = fSplineMap.begin();
+  for( ; mm_iter != fSplineMap.end(); ++mm_iter) {
+    string tune_name = mm_iter->first;
+    uint64_t tune_offset = strings.size();
+    strings += tune_name;
+
+    map<string, set<string> >::const_iterator //\/
+    it = fLoadedSplineSet.find(tune_name);
+    map<string, map<string, string> >::const_iterator //\/
+    ch_iter = fConfigHashes.find(tune_name);
+    map<string, set<string> >::const_iterator //\/
+    dit = fDerivedSplineSet.find(tune_name);
+
+    const map<string, Spline *> & spl_map_curr_tune = mm_iter->second;
+    map<string, Spline *>::const_iterator //\/
+    m_iter = spl_map_curr_tune.begin();
+    for( ; m_iter != spl_map_curr_tune.end(); ++m_iter) {
+      string key = m_iter->first;
+      bool from_init_set =
+        (it != fLoadedSplineSet.end() && it->second.count(key) == 1);
+      if(from_init_set && !save_init) continue;
+      if(dit != fDerivedSplineSet.end() && dit->second.count(key) == 1) continue;
+
+      BinSplIndexEntry entry;
+      entry.tune_offset  = tune_offset;
+      entry.tune_length  = tune_name.size();
+      entry.key_offset   = strings.size();
+      entry.key_length   = key.size();
+      entry.knots_offset = 2*nknots_total;
+      entry.nknots       = m_iter->second->NKnots();
+      strings += key;
+      nknots_total += entry.nknots;
+
+      string config = "";
+      if(ch_iter != fConfigHashes.end()) {
+        map<string, string>::const_iterator h = ch_iter->second.find(key);
+        if(h != ch_iter->second.end()) config = h->second;
+      }
+      entry.config_offset = strings.size();
+      entry.config_length = config.size();
+      entry.reserved      = 0;
+      strings += config;
+
+      index.push_back(entry);
+      splines.push_back(m_iter->second);
+    }
+  }
+
+  BinSplHeader header;
+  memcpy(header.signature, kBinSplSignature, sizeof(header.signature));
+  header.version        = kBinSplVersion;
+  header.uselog         = (fUseLogE ? 1 : 0);
+  header.nsplines       = index.size();
+  header.index_offset   = sizeof(BinSplHeader);
+  header.strings_offset = header.index_offset +
+                          index.size() * sizeof(BinSplIndexEntry);
+  header.knots_offset   = 8 * ((header.strings_offset + strings.size() + 7) / 8);
+  header.file_size      = header.knots_offset + 2*nknots_total*sizeof(double);
+
+  ofstream outbin(filename.c_str(), std::ios::binary);
+  if(!outbin.is_open()) {
+    SLOG("XSecSplLst", pERROR) << "Couldn't create file = " << filename;
+    return;
+  }
+  outbin.write((const char *) &header, sizeof(header));
+  if(!index.empty()) {
+    outbin.write((const char *) &index[0], index.size()*sizeof(BinSplIndexEntry));
+  }
+  outbin.write(strings.data(), strings.size());
+  uint64_t npad = header.knots_offset - header.strings_offset - strings.size();
+  const char pad[8] = { 0,0,0,0,0,0,0,0 };
+  outbin.write(pad, npad);
+
+  for(unsigned int i = 0; i < splines.size(); i++) {
+    int nknots = splines[i]->NKnots();
+    vector<double> E(nknots), xsec(nknots);
+    for(int k = 0; k < nknots; k++) splines[i]->GetKnot(k, E[k], xsec[k]);
+    outbin.write((const char *) &E[0],    nknots*sizeof(double));
+    outbin.write((const char *) &xsec[0], nknots*sizeof(double));
   }
+  outbin.close();
+}
+//____________________________________________________________________________
+XmlParserStatus_t XSecSplineList::LoadFromBinary(
+   const string & filename, bool keep, const set<string> * init_states)
+{
+//! Load XSecSplineList from a binary file. The keep and init_states options
+//! are as for LoadFromXml().
+
+  SLOG("XSecSplLst", pNOTICE)
+    << "Loading splines from binary file: " << filename;
+
+  bool cleared = false;
+  uint64_t nloaded = 0, nsplines = 0;
+  int uselog = -1;
+  XmlParserStatus_t status = XSecSplineList::ReadBinary(filename,
+    [&] (const string & tune, const string & key,
+         int nknots, const double * E, const double * xsec,
+         const string & config) {
+       // the list is reset only once the file is known to be valid
+       if(!cleared) {
+         if(!keep) { fSplineMap.clear(); fConfigHashes.clear(); fDerivedSplineSet.clear(); }
+         cleared = true;
+       }
+       nsplines++;
+       if(!XSecSplineList::PassesFilter(key, init_states)) return;
+
+       // the spline copies the knots: they are not modified
+       Spline * spline = new Spline(nknots,
+           const_cast<double *>(E), const_cast<double *>(xsec));
+       fSplineMap[tune].insert( map<string, Spline *>::value_type(key, spline) );
+       fLoadedSplineSet[tune].insert(key);
+       if(config.size() > 0) fConfigHashes[tune][key] = config;
+       nloaded++;
+    }, &uselog);
+
+  if(status != kXmlOK) return status;
+
+  if(!cleared && !keep) { fSplineMap.clear(); fConfigHashes.clear(); fDerivedSplineSet.clear(); }
+  fRevision++;
+  if(uselog >= 0) this->SetLogE(uselog == 1);
+
+  SLOG("XSecSplLst", pNOTICE)
+    << "Loaded " << nloaded << " of " << nsplines
+    << " splines from: " << filename;
+
+  return status;
+}
+//____________________________________________________________________________
+XmlParserStatus_t XSecSplineList::ReadBinary(
+   const string & filename, const SplineVisitor_t & visitor, int * uselog)
+{
+//! Reads the splines of a binary file, calling the visitor for each spline in
+//! file order (see ReadXml()). The knot arrays passed to the visitor point to
+//! the memory-mapped file.
 
+  if(uselog) *uselog = -1;
+
+  int fd = open(filename.c_str(), O_RDONLY);
+  if(fd < 0) {
+    LOG("XSecSplLst", pERROR)
+          << "\nBinary file could not be found! [filename: " << filename << "]";
+    return kXmlNotParsed;
+  }
+  struct stat st;
+  if(fstat(fd, &st) != 0 || (size_t) st.st_size < sizeof(BinSplHeader)) {
+    close(fd);
+    return kXmlEmpty;
+  }
+
+  // map the file read-only & shared: the pages are shared through the page
+  // cache by all the jobs loading the same file on a node
+  size_t size = st.st_size;
+  void * addr = mmap(0, size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if(addr == MAP_FAILED) {
+    LOG("XSecSplLst", pERROR) << "Couldn't map file: " << filename;
+    return kXmlNotParsed;
+  }
+  const char * data = (const char *) addr;
+
+  const BinSplHeader * header = (const BinSplHeader *) data;
+  bool valid =
+     memcmp(header->signature, kBinSplSignature, sizeof(kBinSplSignature)) == 0 &&
+     (header->version == kBinSplVersion || header->version == 1) &&
+     header->file_size == size;
+  if(!valid) {
+    LOG("XSecSplLst", pERROR)
+      << "\nNot a (compatible) binary spline file! [filename: " << filename << "]";
+    munmap(addr, size);
+    return kXmlInvalidRoot;
+  }
+
+  if(uselog) *uselog = (header->uselog == 1) ? 1 : 0;
+
+  const char   * strings = data + header->strings_offset;
+  const double * knots   = (const double *) (data + header->knots_offset);
+
+  for(uint64_t i = 0; i < header->nsplines; i++) {
+    // version 1 files have no configuration hashes, and a shorter index entry
+    BinSplIndexEntry entry;
+    if(header->version == 1) {
+      const BinSplIndexEntryV1 & entry_v1 =
+         ((const BinSplIndexEntryV1 *) (data + header->index_offset))[i];
+      entry.tune_offset   = entry_v1.tune_offset;
+      entry.key_offset    = entry_v1.key_offset;
+      entry.tune_length   = entry_v1.tune_length;
+      entry.key_length    = entry_v1.key_length;
+      entry.knots_offset  = entry_v1.knots_offset;
+      entry.nknots        = entry_v1.nknots;
+      entry.config_offset = 0;
+      entry.config_length = 0;
+    } else {
+      entry = ((const BinSplIndexEntry *) (data + header->index_offset))[i];
+    }
+    string key   (strings + entry.key_offset,    entry.key_length   );
+    string tune  (strings + entry.tune_offset,   entry.tune_length  );
+    string config(strings + entry.config_offset, entry.config_length);
+    int nknots = (int) entry.nknots;
+
+    const double * E    = knots + entry.knots_offset;
+    const double * xsec = E + nknots;
+    visitor(tune, key, nknots, E, xsec, config);
+  }
+
+  munmap(addr, size);
   return kXmlOK;
 }
 //____________________________________________________________________________
+XmlParserStatus_t XSecSplineList::ReadFile(
+   const string & filename, const SplineVisitor_t & visitor, int * uselog)
+{
+  if(XSecSplineList::IsBinaryFile(filename))
+     return XSecSplineList::ReadBinary(filename, visitor, uselog);
+  return XSecSplineList::ReadXml(filename, visitor, uselog);
+}
+//____________________________________________________________________________
+bool XSecSplineList::IsBinaryFile(const string & filename)
+{
+  std::ifstream inp(filename.c_str(), std::ios::binary);
+  if(!inp.is_open()) return false;
+  char signature[sizeof(kBinSplSignature)];
+  inp.read(signature, sizeof(signature));
+  return inp.gcount() == sizeof(signature) &&
+         memcmp(signature, kBinSplSignature, sizeof(signature)) == 0;
+}
+//____________________________________________________________________________
+void XSecSplineList::Save(const string & filename, bool save_init) const
+{
+  bool binary = filename.size() > 4 &&
+                filename.compare(filename.size()-4, 4, ".bin") == 0;
+  if(binary) this->SaveAsBinary(filename, save_init);
+  else       this->SaveAsXml   (filename, save_init);
+}
+//____________________________________________________________________________
+XmlParserStatus_t XSecSplineList::Load(const string & filename, bool keep)
+{
+  if(fDeferLoad) {
+    SLOG("XSecSplLst", pNOTICE)
+      << "Deferring loading of splines from: " << filename;
+    fDeferredFiles.push_back(pair<string,bool>(filename, keep));
+    return kXmlOK;
+  }
+  if(XSecSplineList::IsBinaryFile(filename))
+     return this->LoadFromBinary(filename, keep);
+  return this->LoadFromXml(filename, keep);
+}
+//____________________________________________________________________________
+XmlParserStatus_t XSecSplineList::LoadDeferred(const set<string> & init_states)
+{
+//! Load the splines for the input initial states from all the files recorded
+//! by Load() while deferred loading was on. An empty set loads all splines.
+
+  StartupTimer timer("Cross-section spline loading (deferred)");
+
+  const set<string> * filter = (init_states.empty()) ? 0 : &init_states;
+
+  if(filter) {
+    SLOG("XSecSplLst", pNOTICE)
+      << "Loading splines for " << init_states.size() << " initial states";
+  }
+
+  vector< pair<string,bool> > files;
+  files.swap(fDeferredFiles);
+
+  XmlParserStatus_t status = kXmlOK;
+  vector< pair<string,bool> >::const_iterator it = files.begin();
+  for( ; it != files.end(); ++it) {
+    const string & filename = it->first;
+    bool           keep     = it->second;
+    status = (XSecSplineList::IsBinaryFile(filename)) ?
+        this->LoadFromBinary (filename, keep, filter) :
+        this->LoadFromXml    (filename, keep, filter);
+    if(status != kXmlOK) {
+      SLOG("XSecSplLst", pERROR)
+        << "Problem reading file: " << filename;
+      break;
+    }
+  }
+  return status;
+}
+//____________________________________________________________________________
+void XSecSplineList::LoadPending(void) const
+{
+// Splines queried before LoadDeferred() was called: load them all
+
+  if(fDeferredFiles.empty()) return;
+
+  std::lock_guard<std::mutex> lock(fgMutex);
+  if(fDeferredFiles.empty()) return;
+
+  SLOG("XSecSplLst", pWARN)
+    << "Splines queried before deferred loading - Loading all splines";
+  XmlParserStatus_t status =
+     const_cast<XSecSplineList *>(this)->LoadDeferred(set<string>());
+  if(status != kXmlOK) {
+    SLOG("XSecSplLst", pFATAL) << "Couldn't load cross section splines";
+    exit(1);
+  }
+}
+//____________________________________________________________________________
+bool XSecSplineList::PassesFilter(
+   const string & key, const set<string> * init_states)
+{
+  if(!init_states) return true;
+
+  set<string>::const_iterator it = init_states->begin();
+  for( ; it != init_states->end(); ++it) {
+    if(key.find(*it) != string::npos) return true;
+  }
+  return false;
+}
+//____________________________________________________________________________
 string XSecSplineList::BuildSplineKey(
             const XSecAlgorithmI * alg, const Interaction * interaction) const
 {
@@ -540,8 +1417,18 @@ string XSecSplineList::BuildSplineKey(
   return key;
 }
 //____________________________________________________________________________
+uint64_t XSecSplineList::BuildSplineHash(
+            const XSecAlgorithmI * alg, const Interaction * interaction) const
+{
+// Hash counterpart of BuildSplineKey()
+
+  return Cache::CacheBranchHash(alg->Id().Key(), interaction->Hash());
+}
+//____________________________________________________________________________
 const vector<string> * XSecSplineList::GetSplineKeys(void) const
 {
+  this->LoadPending();
+
   map<string,  map<string, Spline *> >::const_iterator //\/
   mm_iter = fSplineMap.find(fCurrentTune);
   if(mm_iter == fSplineMap.end()) {
@@ -562,6 +1449,8 @@ const vector<string> * XSecSplineList::GetSplineKeys(void) const
 //____________________________________________________________________________
 void XSecSplineList::Print(ostream & stream) const
 {
+  this->LoadPending();
+
   stream << "\n ******************* XSecSplineList *************************";
   stream << "\n [-] Options:";
   stream << "\n  |";
@@ -588,5 +1477,188 @@ void XSecSplineList::Print(ostream & stream) const
   }
 }
 //___________________________________________________________________________
+XSecSplineFileWriter::XSecSplineFileWriter() :
+fBinary   (false),
+fUseLog   (false),
+fTuneOpen (false),
+fNSplines (0),
+fNKnots   (0)
+{
+
+}
+//___________________________________________________________________________
+XSecSplineFileWriter::~XSecSplineFileWriter()
+{
+  if(fOut.is_open()) this->Close();
+}
+//___________________________________________________________________________
+bool XSecSplineFileWriter::Open(const string & filename, bool uselog)
+{
+  fFilename = filename;
+  fBinary   = filename.size() > 4 &&
+              filename.compare(filename.size()-4, 4, ".bin") == 0;
+  fUseLog   = uselog;
+  fTuneOpen = false;
+  fNSplines = 0;
+  fNKnots   = 0;
+  fTunes.clear();
+  fKeys.clear();
+  fKnotCounts.clear();
+  fConfigs.clear();
+
+  if(fBinary) {
+    fKnotsFile = filename + ".knots.tmp";
+    fOut.open(fKnotsFile.c_str(), std::ios::binary);
+  } else {
+    fOut.open(filename.c_str());
+  }
+  if(!fOut.is_open()) {
+    SLOG("XSecSplLst", pERROR)
+      << "Couldn't create file = " << (fBinary ? fKnotsFile : filename);
+    return false;
+  }
+
+  if(!fBinary) {
+    fOut << "<?xml version=\"1.0\" encoding=\"ISO-8859-1\"?>";
+    fOut << endl << endl;
+    fOut << "<!-- generated by genie::XSecSplineFileWriter -->";
+    fOut << endl << endl;
+    fOut << "<genie_xsec_spline_list "
+         << "version=\"3.00\" uselog=\"" << (fUseLog ? 1 : 0) << "\">";
+    fOut << endl << endl;
+  }
+  return true;
+}
+//___________________________________________________________________________
+void XSecSplineFileWriter::Write(const string & tune, const string & key,
+     int nknots, const double * E, const double * xsec, const string & config)
+{
+  if(!fOut.is_open()) return;
+
+  fNSplines++;
+
+  if(fBinary) {
+    fTunes.push_back(tune);
+    fKeys.push_back(key);
+    fKnotCounts.push_back(nknots);
+    fConfigs.push_back(config);
+    fOut.write((const char *) E,    nknots*sizeof(double));
+    fOut.write((const char *) xsec, nknots*sizeof(double));
+    fNKnots += nknots;
+    return;
+  }
+
+  // a genie_tune element per run of consecutive splines of the same tune
+  if(!fTuneOpen || tune != fCurrTune) {
+    if(fTuneOpen) fOut << "  </genie_tune>" << endl;
+    fOut << "  <genie_tune name=\"" << tune << "\">";
+    fOut << endl << endl;
+    fCurrTune = tune;
+    fTuneOpen = true;
+  }
+  Spline spline(nknots, const_cast<double *>(E), const_cast<double *>(xsec));
+  spline.SaveAsXml(fOut, "E", "xsec", key,
+     config.size() > 0 ? "config=\"" + config + "\"" : "");
+}
+//___________________________________________________________________________
+bool XSecSplineFileWriter::Close(void)
+{
+  if(!fOut.is_open()) return false;
+
+  if(!fBinary) {
+    if(fTuneOpen) fOut << "  </genie_tune>" << endl;
+    fOut << "</genie_xsec_spline_list>" << endl;
+    fOut.close();
+    fTuneOpen = false;
+    return true;
+  }
+
+  fOut.close();
+
+  // the spline index, sorted by tune & key as in XSecSplineList::SaveAsBinary()
+  vector<unsigned int> order(fKeys.size());
+  for(unsigned int i = 0; i < order.size(); i++) order[i] = i;
+  std::sort(order.begin(), order.end(),
+     [this] (unsigned int a, unsigned int b) {
+        if(fTunes[a] != fTunes[b]) return fTunes[a] < fTunes[b];
+        return fKeys[a] < fKeys[b];
+     });
+
+  // knot offsets in file order
+  vector<uint64_t> knots_offset(fKeys.size());
+  uint64_t offset = 0;
+  for(unsigned int i = 0; i < fKeys.size(); i++) {
+    knots_offset[i] = offset;
+    offset += 2*fKnotCounts[i];
+  }
+
+  vector<BinSplIndexEntry> index;
+  string                   strings;
+  map<string, uint64_t>    tune_offsets;
+  for(unsigned int j = 0; j < order.size(); j++) {
+    unsigned int i = order[j];
+    map<string, uint64_t>::const_iterator it = tune_offsets.find(fTunes[i]);
+    if(it == tune_offsets.end()) {
+      it = tune_offsets.insert(
+             map<string, uint64_t>::value_type(fTunes[i], strings.size())).first;
+      strings += fTunes[i];
+    }
+    BinSplIndexEntry entry;
+    entry.tune_offset  = it->second;
+    entry.tune_length  = fTunes[i].size();
+    entry.key_offset   = strings.size();
+    entry.key_length   = fKeys[i].size();
+    entry.knots_offset = knots_offset[i];
+    entry.nknots       = fKnotCounts[i];
+    strings += fKeys[i];
+    entry.config_offset = strings.size();
+    entry.config_length = fConfigs[i].size();
+    entry.reserved      = 0;
+    strings += fConfigs[i];
+    index.push_back(entry);
+  }
+
+  BinSplHeader header;
+  memcpy(header.signature, kBinSplSignature, sizeof(header.signature));
+  header.version        = kBinSplVersion;
+  header.uselog         = (fUseLog ? 1 : 0);
+  header.nsplines       = index.size();
+  header.index_offset   = sizeof(BinSplHeader);
+  header.strings_offset = header.index_offset +
+                          index.size() * sizeof(BinSplIndexEntry);
+  header.knots_offset   = 8 * ((header.strings_offset + strings.size() + 7) / 8);
+  header.file_size      = header.knots_offset + 2*fNKnots*sizeof(double);
+
+  ofstream outbin(fFilename.c_str(), std::ios::binary);
+  if(!outbin.is_open()) {
+    SLOG("XSecSplLst", pERROR) << "Couldn't create file = " << fFilename;
+    remove(fKnotsFile.c_str());
+    return false;
+  }
+  outbin.write((const char *) &header, sizeof(header));
+  if(!index.empty()) {
+    outbin.write((const char *) &index[0], index.size()*sizeof(BinSplIndexEntry));
+  }
+  outbin.write(strings.data(), strings.size());
+  uint64_t npad = header.knots_offset - header.strings_offset - strings.size();
+  const char pad[8] = { 0,0,0,0,0,0,0,0 };
+  outbin.write(pad, npad);
+
+  // append the knots
+  std::ifstream knots(fKnotsFile.c_str(), std::ios::binary);
+  if(fNKnots > 0) outbin << knots.rdbuf();
+  knots.close();
+  remove(fKnotsFile.c_str());
+
+  bool ok = outbin.good();
+  outbin.close();
+
+  fTunes.clear();
+  fKeys.clear();
+  fKnotCounts.clear();
+  fConfigs.clear();
+  return ok;
+}
+//___________________________________________________________________________
 
 } // genie namespace
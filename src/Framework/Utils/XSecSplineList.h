@@ -18,11 +18,16 @@
 #ifndef _XSEC_SPLINE_LIST_H_
 #define _XSEC_SPLINE_LIST_H_
 
+#include <cstdint>
+#include <fstream>
+#include <functional>
 #include <ostream>
 #include <map>
+#include <unordered_map>
 #include <set>
 #include <vector>
 #include <string>
+#include <mutex>
 
 #include "Framework/Conventions/XmlParserStatus.h"
 
@@ -38,6 +43,7 @@ namespace genie {
 class XSecAlgorithmI;
 class Interaction;
 class Spline;
+class CacheBranchFx;
 
 class XSecSplineList;
 ostream & operator << (ostream & stream, const XSecSplineList & xsl);
@@ -49,8 +55,50 @@ public:
   static XSecSplineList * Instance();
 
   // Save/load to/from XML file
+  // If a set of initial states (see InitialState::AsString()) is given, only
+  // the splines whose keys contain one of them are loaded
   void               SaveAsXml   (const string & filename, bool save_init = true) const;
-  XmlParserStatus_t  LoadFromXml (const string & filename, bool keep = false);
+  XmlParserStatus_t  LoadFromXml (const string & filename, bool keep = false,
+                                  const set<string> * init_states = 0);
+
+  // Save/load to/from binary file.
+  // The binary format holds a spline index followed by the contiguous knot
+  // arrays of all splines, and is loaded by memory-mapping the file (no
+  // parsing and no text to number conversions are involved)
+  void               SaveAsBinary   (const string & filename, bool save_init = true) const;
+  XmlParserStatus_t  LoadFromBinary (const string & filename, bool keep = false,
+                                     const set<string> * init_states = 0);
+  static bool        IsBinaryFile   (const string & filename);
+
+  // Streaming access to spline files (XML or binary), eg for merging many
+  // files without loading them all: The visitor is called for every spline in
+  // the file, in file order, and nothing is kept. The knot arrays it gets are
+  // only valid during the call. The file uselog flag is returned in uselog.
+  // The configuration hash of the spline (see ConfigHash()) is empty for files
+  // written by earlier versions.
+  typedef std::function<void (const string & tune, const string & key,
+               int nknots, const double * E, const double * xsec,
+               const string & config)> SplineVisitor_t;
+  static XmlParserStatus_t ReadFile   (const string & filename,
+                                       const SplineVisitor_t & visitor, int * uselog = 0);
+  static XmlParserStatus_t ReadXml    (const string & filename,
+                                       const SplineVisitor_t & visitor, int * uselog = 0);
+  static XmlParserStatus_t ReadBinary (const string & filename,
+                                       const SplineVisitor_t & visitor, int * uselog = 0);
+
+  // Save/load in either format: Files named *.bin are saved in binary format.
+  // Binary files are recognized by their signature when loading.
+  void               Save (const string & filename, bool save_init = true) const;
+  XmlParserStatus_t  Load (const string & filename, bool keep = false);
+
+  // Deferred (lazy) loading.
+  // When switched on, Load() only records the input files. The splines are
+  // loaded by LoadDeferred(), typically called by the MC job driver with the
+  // initial states it needs, so that only those splines are materialized.
+  // If any spline is queried before that, all recorded files are loaded.
+  void               DeferLoading     (bool on = true) { fDeferLoad = on; }
+  bool               HasDeferredFiles (void) const { return !fDeferredFiles.empty(); }
+  XmlParserStatus_t  LoadDeferred     (const set<string> & init_states);
 
   // Print available splines
   void   Print (ostream & stream) const;
@@ -59,9 +107,9 @@ public:
   // Set and query current tune.
   // An XSecSplineList can keep splines for numerous tunes and pick the appropriate
   // one for each process, as instructed.
-  void   SetCurrentTune (const string & tune) { fCurrentTune = tune; }
+  void   SetCurrentTune (const string & tune) { fCurrentTune = tune; fRevision++; }
   string CurrentTune    (void) const  { return fCurrentTune; }
-  bool   HasSplineFromTune( const string & tune ) const { return fSplineMap.count(tune) > 0 ; }
+  bool   HasSplineFromTune( const string & tune ) const { this->LoadPending(); return fSplineMap.count(tune) > 0 ; }
 
   // Query the existence, access or create a spline
   // The results of the following methods depend on the current tune setting
@@ -71,12 +119,55 @@ public:
   const Spline * GetSpline    (string spline_key) const;
   void           CreateSpline (const XSecAlgorithmI * alg, const Interaction * i,
                                int nknots = -1, double e_min = -1, double e_max = -1);
+  void           RemoveSpline (const XSecAlgorithmI * alg, const Interaction * i);
+  int            RemoveSplinesExcept (const set<string> & keys); ///< returns the number of splines removed
   int  NSplines (void) const;
   bool IsEmpty  (void) const;
 
+  // Splines derived from free nucleon splines.
+  // For models with the DerivedNuclearSplines option on (see XSecAlgorithmI::
+  // DerivesNuclearSplines()), a missing spline for a bound hit nucleon is
+  // synthesised when first queried, as the free nucleon spline times the number
+  // of protons or neutrons of the target. Derived splines are never saved.
+  bool          CanDeriveSpline        (const XSecAlgorithmI * alg, const Interaction * i) const;
+  Interaction * FreeNucleonInteraction (const Interaction * i) const; ///< new free nucleon interaction, owned by the caller
+  bool          IsDerivedSpline        (string spline_key) const;
+
+  // Configuration hash of a spline: MD5 hash of the resolved configuration of
+  // the cross section algorithm (and of all its sub-algorithms), of the
+  // interaction and of the knot settings the spline is built with (as in
+  // CreateSpline()). It is stored with every spline built, saved in the XML
+  // and binary files and restored on loading, so that splines whose inputs
+  // changed since they were built can be identified and rebuilt.
+  string ConfigHash       (const XSecAlgorithmI * alg, const Interaction * i,
+                           int nknots = -1, double e_min = -1, double e_max = -1) const;
+  string SplineConfigHash (const XSecAlgorithmI * alg, const Interaction * i) const; ///< stored hash ("" if unknown)
+  bool   SplineIsCurrent  (const XSecAlgorithmI * alg, const Interaction * i,
+                           int nknots = -1, double e_min = -1, double e_max = -1) const;
+
+  // Delete all splines, of all tunes (eg between the points of a model
+  // parameter scan whose splines are saved in separate files)
+  void Clear    (void);
+
+  // Approximate memory held by the splines of all tunes, in bytes
+  size_t MemoryFootprint (void) const;
+
+  // Revision number, incremented every time splines are added / loaded or the
+  // current tune changes. Clients caching spline handles (const Spline *)
+  // must re-resolve them when the revision changes.
+  long int Revision (void) const { return fRevision; }
+
   // Methods for building / getting keys
   // The results of the following methods depend on the current tune setting
   string BuildSplineKey(const XSecAlgorithmI * alg, const Interaction * i) const;
+
+  // Hash-keyed spline access.
+  // The (algorithm, interaction) queries above resolve the string key of
+  // every spline once, and then find it again by the 64-bit hash of the
+  // algorithm and interaction (see Interaction::Hash()), without building
+  // the key string. GetSpline(hkey) only finds splines already resolved so.
+  uint64_t       BuildSplineHash (const XSecAlgorithmI * alg, const Interaction * i) const;
+  const Spline * GetSpline       (uint64_t hkey) const;
   const vector<string> * GetSplineKeys(void) const;
 
 
@@ -85,10 +176,15 @@ public:
   void   SetNKnots (int    nk); ///< set default number of knots for building the spline
   void   SetMinE   (double Ev); ///< set default minimum energy for xsec splines
   void   SetMaxE   (double Ev); ///< set default maximum energy for xsec splines
+  void   SetAdaptiveKnots (bool on, double tolerance = -1); ///< refine knots until the midpoint interpolation error is below tolerance
+  void   SetIntegralCache (bool on) { fUseIntegralCache = on; } ///< memoize computed xsec integrals in the (persistent) genie::Cache
   bool   UseLogE   (void) const { return fUseLogE;  }
   int    NKnots    (void) const { return fNKnots;   }
   double Emin      (void) const { return fEmin;     }
   double Emax      (void) const { return fEmax;     }
+  bool   AdaptiveKnots     (void) const { return fAdaptiveKnots; }
+  double AdaptiveTolerance (void) const { return fAdaptiveTol;   }
+  bool   UseIntegralCache  (void) const { return fUseIntegralCache; }
 
 private:
 
@@ -97,16 +193,45 @@ private:
   virtual ~XSecSplineList();
 
   static XSecSplineList * fInstance;
+  static std::mutex       fgMutex;  ///< guards late initialization & spline insertion
+  static std::mutex       fgIndexMutex; ///< guards the hash index
 
   bool   fUseLogE;
   int    fNKnots;
   double fEmin;
   double fEmax;
+  bool   fAdaptiveKnots; ///< adaptive knot placement? (the number of knots is then the maximum)
+  double fAdaptiveTol;   ///< relative interpolation error tolerance for adaptive knot placement
+  bool   fUseIntegralCache; ///< look up / store computed xsec integrals in the genie::Cache
 
-  string fCurrentTune; ///< The `active' tune, out the many that can co-exist
+  string   fCurrentTune; ///< The `active' tune, out the many that can co-exist
+  long int fRevision;    ///< incremented at each modification (see Revision())
 
   map<string, map<string, Spline *> > fSplineMap;       ///< tune -> { xsec_alg/xsec_config/interaction -> Spline }
   map<string, set<string>           > fLoadedSplineSet; ///< tune -> { set of initialy loaded splines             }
+  map<string, map<string, string>   > fConfigHashes;    ///< tune -> { xsec_alg/xsec_config/interaction -> config hash }
+  map<string, set<string>           > fDerivedSplineSet; ///< tune -> { set of splines derived from free nucleon splines }
+
+  bool                        fDeferLoad;     ///< record input files in Load(), rather than loading them
+  vector< pair<string,bool> > fDeferredFiles; ///< input files (and keep flag) not loaded yet
+
+  mutable std::unordered_map<uint64_t, const Spline *> fSplineIndex;  ///< hash key -> spline, in the current tune
+  mutable long int                                     fIndexRevision; ///< revision the hash index was built at
+
+  void        IndexSpline  (uint64_t hkey, const Spline * spline) const;
+  const Spline * DeriveSpline (const XSecAlgorithmI * alg, const Interaction * i,
+                               const string & key) const;
+
+  void        LoadPending  (void) const;
+  void        DeleteSplines(void);
+  double      ComputeXSec  (const XSecAlgorithmI * alg, const Interaction * i, double E,
+                            CacheBranchFx * cache) const;
+  void        RefineKnots  (const XSecAlgorithmI * alg, const Interaction * i,
+                            int nkb, int nkmax, vector<double> & E, vector<double> & xsec,
+                            CacheBranchFx * cache) const;
+  string      IntegralCacheKey (const XSecAlgorithmI * alg, const Interaction * i) const;
+  void        KnotSettings (int & nknots, double & e_min, double & e_max) const;
+  static bool PassesFilter (const string & key, const set<string> * init_states);
 
   struct Cleaner {
       void DummyMethodAndSilentCompiler() { }
@@ -120,6 +245,58 @@ private:
   friend struct Cleaner;
 };
 
+//____________________________________________________________________________
+/*!
+
+\class    genie::XSecSplineFileWriter
+
+\brief    Writes a spline file (XML, or binary if named *.bin) one spline at a
+          time, in the formats of XSecSplineList::Save(), so that the splines
+          need not be held in memory. XML splines are written as they come.
+          For binary files the knots go to a temporary file and only the
+          spline index is kept, until Close().
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+class XSecSplineFileWriter {
+
+public:
+  XSecSplineFileWriter();
+ ~XSecSplineFileWriter();
+
+  bool Open  (const string & filename, bool uselog);
+  void Write (const string & tune, const string & key,
+              int nknots, const double * E, const double * xsec,
+              const string & config = "");
+  bool Close (void);
+
+  uint64_t NSplines (void) const { return fNSplines; }
+
+private:
+  string           fFilename;   ///< output file
+  string           fKnotsFile;  ///< temporary knot file (binary output)
+  bool             fBinary;     ///< binary output?
+  bool             fUseLog;     ///< uselog flag of the output file
+  std::ofstream    fOut;        ///< output (XML) or temporary knot (binary) stream
+  string           fCurrTune;   ///< tune of the open genie_tune element (XML output)
+  bool             fTuneOpen;   ///< is a genie_tune element open? (XML output)
+  uint64_t         fNSplines;   ///< splines written
+  uint64_t         fNKnots;     ///< knots written (binary output)
+
+  vector<string>   fTunes;      ///< tune of each spline (binary output)
+  vector<string>   fKeys;       ///< key of each spline (binary output)
+  vector<uint64_t> fKnotCounts; ///< number of knots of each spline (binary output)
+  vector<string>   fConfigs;    ///< configuration hash of each spline (binary output)
+};
+
 }      // genie namespace
 
 #endif // _XSEC_SPLINE_LIST_H_
@@ -126,6 +126,13 @@ InteractionList * DMDISInteractionListGenerator::CreateInteractionList(
   return intlist;
 }
 //___________________________________________________________________________
+string DMDISInteractionListGenerator::TargetClass(const Target & target) const
+{
+// The list only depends on whether the target has protons and neutrons
+
+  return InteractionListGeneratorI::NucleonContentClass(target);
+}
+//___________________________________________________________________________
 void DMDISInteractionListGenerator::Configure(const Registry & config)
 {
   Algorithm::Configure(config);
@@ -160,6 +160,7 @@ void DMDISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {
+         this->RecordAccepted(interaction, iter);
          LOG("DMDISKinematics", pNOTICE) 
             << "Selected:  x = " << gx << ", y = " << gy
             << " (W  = " << interaction->KinePtr()->W()  << ","
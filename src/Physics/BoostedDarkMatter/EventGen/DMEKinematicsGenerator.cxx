@@ -125,6 +125,7 @@ void DMEKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {
+        this->RecordAccepted(interaction, iter);
         LOG("DMEKinematics", pINFO) << "Selected: y = " << y;
 
         // set the cross section for the selected kinematics
@@ -204,6 +204,7 @@ void DMELEventGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
         // If the generated kinematics are accepted, finish-up module's job
         if(accept) {
+            this->RecordAccepted(interaction, iter);
             double gQ2 = interaction->KinePtr()->Q2(false);
             LOG("DMELEvent", pINFO) << "*Selected* Q^2 = " << gQ2 << " GeV^2";
 
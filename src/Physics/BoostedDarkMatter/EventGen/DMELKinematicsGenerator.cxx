@@ -172,6 +172,7 @@ void DMELKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {
+        this->RecordAccepted(interaction, iter);
         LOG("DMELKinematics", pINFO) << "Selected: Q^2 = " << gQ2;
 
         // reset bits
@@ -392,6 +393,7 @@ void DMELKinematicsGenerator::SpectralFuncExperimentalCode(
 
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {
+        this->RecordAccepted(interaction, iter);
         LOG("DMELKinematics", pNOTICE) << "Selected: Q^2 = " << gQ2;
 
         // reset bits
@@ -12,6 +12,9 @@
 */
 //____________________________________________________________________________
 
+#include <sstream>
+#include <iomanip>
+
 #include <TMath.h>
 #include <Math/IFunction.h>
 #include <Math/IntegratorMultiDim.h>
@@ -26,6 +29,7 @@
 #include "Physics/XSectionIntegration/GSLXSecFunc.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/Utils/RunOpt.h"
 #include "Framework/Numerical/MathUtils.h"
@@ -35,6 +39,8 @@
 #include "Framework/Utils/XSecSplineList.h"
 #include "Framework/Numerical/GSLUtils.h"
 
+using std::ostringstream;
+
 using namespace genie;
 using namespace genie::controls;
 using namespace genie::constants;
@@ -226,7 +232,7 @@ void DMDISXSec::CacheFreeNucleonXSec(
            dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
   assert(!cache_branch);
   cache_branch = new CacheBranchFx("DMDIS XSec");
-  cache->AddCacheBranch(key, cache_branch);
+  cache->AddCacheBranch(key, cache_branch, true);
 
   // Tweak interaction to be on a free nucleon target
   Target * target = interaction->InitStatePtr()->TgtPtr();
@@ -324,13 +330,22 @@ void DMDISXSec::CacheFreeNucleonXSec(
 string DMDISXSec::CacheBranchName(
           const XSecAlgorithmI * model, const Interaction * interaction) const
 {
-// Build a unique name for the cache branch
+// Build a unique name for the cache branch.
+// The dark matter and mediator masses aren't part of the interaction string
+// but are included, so that a single job can build the splines of many mass
+// hypotheses (see gmkspl_dm)
 
   Cache * cache = Cache::Instance();
-      
+  PDGLibrary * pdglib = PDGLibrary::Instance();
+
+  ostringstream masses;
+  masses << std::setprecision(17)
+         << "mdm:"  << pdglib->Find(kPdgDarkMatter)->Mass() << ";"
+         << "mmed:" << pdglib->Find(kPdgMediator  )->Mass();
+
   string algkey = model->Id().Key();
   string ikey   = interaction->AsString();  
-  string key    = cache->CacheBranchKey(algkey, ikey);
+  string key    = cache->CacheBranchKey(algkey, ikey, masses.str());
   return key;
 }
 //____________________________________________________________________________
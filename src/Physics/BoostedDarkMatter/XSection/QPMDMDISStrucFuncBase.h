@@ -28,6 +28,9 @@
 #ifndef _DM_QPM_DIS_STRUCTURE_FUNCTIONS_BASE_H_
 #define _DM_QPM_DIS_STRUCTURE_FUNCTIONS_BASE_H_
 
+#include <memory>
+#include <vector>
+
 #include "Physics/DeepInelastic/XSection/DISStructureFuncModelI.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Physics/PartonDistributions/PDF.h"
@@ -70,6 +73,26 @@ protected:
   virtual double R          (const Interaction * i) const;
   virtual void   KFactors   (const Interaction * i, double & kuv, 
                                      double & kdv, double & kus, double & kds) const;
+
+  // dark matter coupling weighted quark density sums entering F2 and xF3
+  void   CalcQuarkSums (const Interaction * i, double & F2val, double & xF3val) const;
+
+  // Optionally (SF-Tabulate), the quark density sums of a free nucleon, which
+  // depend only on (x,Q2), are interpolated from tables built once for all
+  // the dark matter and mediator masses
+  struct SFTable {
+    int    fNX;                ///< number of x nodes (log spaced, up to x=1)
+    int    fNQ2;               ///< number of Q2 nodes (log spaced)
+    double fLogXMin;           ///< log of the first x node
+    double fDLogX;             ///< log(x) step
+    double fLogQ2Min;          ///< log of the first Q2 node
+    double fDLogQ2;            ///< log(Q2) step
+    std::vector<double> fF2;   ///< F2 quark density sum, at [ix*fNQ2 + iq]
+    std::vector<double> fxF3;  ///< xF3 quark density sum, at [ix*fNQ2 + iq]
+  };
+  bool      InterpolateSF (const Interaction * i, double & F2val, double & xF3val) const;
+  SFTable * BuildSFTable  (int nuc_pdgc) const;
+
   // configuration
   //
   double fQ2min;             ///< min Q^2 allowed for PDFs: PDF(Q2<Q2min):=PDF(Q2min)
@@ -87,6 +110,14 @@ protected:
   double fQsR;               ///< Strange Right Dark Matter Coupling
   bool   fUse2016Corrections;///< Use 2016 SF relation corrections
   double fLowQ2CutoffF1F2;   ///< Set min for relation between 2xF1 and F2
+  bool   fTabulateSF;        ///< interpolate the quark density sums from tables?
+  int    fSFTableNX;         ///< number of tabulated x nodes
+  double fSFTableXMin;       ///< min tabulated x
+  int    fSFTableNQ2;        ///< number of tabulated Q2 nodes
+  double fSFTableQ2Min;      ///< min tabulated Q2
+  double fSFTableQ2Max;      ///< max tabulated Q2
+  mutable std::shared_ptr<const SFTable> fSFTableP; ///< proton table (if tabulated)
+  mutable std::shared_ptr<const SFTable> fSFTableN; ///< neutron table (if tabulated)
 
   mutable double fF1;
   mutable double fF2;
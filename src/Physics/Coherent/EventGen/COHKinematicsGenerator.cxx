@@ -22,6 +22,7 @@
 #include "Framework/Conventions/Controls.h"
 #include "Framework/Conventions/Units.h"
 #include "Physics/Coherent/EventGen/COHKinematicsGenerator.h"
+#include "Physics/Coherent/XSection/BergerSehgalCOHPiPXSec2015.h"
 #include "Framework/Conventions/KinePhaseSpace.h"
 #include "Framework/EventGen/EVGThreadException.h"
 #include "Framework/EventGen/EventGeneratorI.h"
@@ -144,35 +145,22 @@ void COHKinematicsGenerator::CalculateKin_BergerSehgal(GHepRecord * evrec) const
 
     //-- If the generated kinematics are accepted, finish-up module's job
     if(accept) {
+      this->RecordAccepted(interaction, iter);
       LOG("COHKinematics", pNOTICE)
         << "Selected: Q^2 = " << gQ2 << ", y = " << gy; /* << ", t = " << gt; */
 
       // the Berger-Sehgal COH cross section should be a triple differential cross section
       // d^2xsec/dQ2dydt where t is the the square of the 4p transfer to the
       // nucleus. The cross section used for kinematical selection should have
-      // the t-dependence integrated out. The t-dependence is of the form
-      // ~exp(-bt). Now that the x,y kinematical variables have been selected
-      // we can generate a t using the t-dependence as a PDF.
-      const InitialState & init_state = interaction->InitState();
-      double Ev    = init_state.ProbeE(kRfLab);
-      double Epi   = gy*Ev; // pion energy
-      double Epi2  = TMath::Power(Epi,2);
-      double pme2  = kPionMass2/Epi2;
-      double gx    = interaction->KinePtr()->x(); // utils::kinematics::Q2YtoX(Ev,kNucleonMass,gQ2,gy); // gQ2 / ( 2. * gy * kNucleonMass * Ev);
-      double xME   = kNucleonMass*gx/Epi;
-      double tA    = 1. + xME - 0.5*pme2;
-      /* Range1D_t tl = kps.TLim();   // this becomes the bounds for t */
-      double tB    = TMath::Sqrt(1.+ 2*xME) * TMath::Sqrt(1.-pme2);
-      double tmin  = 2*Epi2 * (tA-tB);
-      double tmax  = 2*Epi2 * (tA+tB);
-      double A     = (double) init_state.Tgt().A();
-      double A13   = TMath::Power(A,1./3.);
-      double R     = fRo * A13 * units::fermi; // nuclear radius
-      double R2    = TMath::Power(R,2.);
-      double b     = 0.33333 * R2;
-      double tsum  = (TMath::Exp(-b*tmin) - TMath::Exp(-b*tmax))/b;
-      double rt    = tsum * rnd->RndKine().Rndm();
-      double gt    = -1.*TMath::Log(-1.*b*rt + TMath::Exp(-1.*b*tmin))/b;
+      // the t-dependence integrated out. The t-dependence is a sum of
+      // exponentials ~exp(-bt). Now that the x,y kinematical variables have been
+      // selected we can generate a t directly from the model t-distribution.
+      const BergerSehgalCOHPiPXSec2015 * bsmodel =
+        dynamic_cast<const BergerSehgalCOHPiPXSec2015 *> (fXSecModel);
+      assert(bsmodel);
+      double gx    = interaction->KinePtr()->x();
+      double tpdf  = 0;
+      double gt    = bsmodel->GenerateT(interaction, tpdf);
 
       // TODO: If we re-install the fGenerateUniformly option, we
       // would compute the event weight here.
@@ -190,7 +178,7 @@ void COHKinematicsGenerator::CalculateKin_BergerSehgal(GHepRecord * evrec) const
       interaction->KinePtr()->ClearRunningValues();
 
       // set the cross section for the selected kinematics
-      evrec->SetDiffXSec(xsec * TMath::Exp(-b * gt) / tsum, kPSQ2yfE);
+      evrec->SetDiffXSec(xsec * tpdf, kPSQ2yfE);
 
       return;
     }
@@ -264,6 +252,7 @@ void COHKinematicsGenerator::CalculateKin_BergerSehgalFM(GHepRecord * evrec) con
 
     //-- If the generated kinematics are accepted, finish-up module's job
     if(accept) {
+      this->RecordAccepted(interaction, iter);
       LOG("COHKinematics", pNOTICE)
         << "Selected: Q^2 = " << gQ2 << ", y = " << gy << ", t = " << gt;
 
@@ -375,6 +364,7 @@ void COHKinematicsGenerator::CalculateKin_ReinSehgal(GHepRecord * evrec) const
 
     //-- If the generated kinematics are accepted, finish-up module's job
     if(accept) {
+      this->RecordAccepted(interaction, iter);
       LOG("COHKinematics", pNOTICE) << "Selected: x = "<< gx << ", y = "<< gy;
 
       // the Rein-Sehgal COH cross section should be a triple differential cross section
@@ -528,6 +518,7 @@ void COHKinematicsGenerator::CalculateKin_AlvarezRuso(GHepRecord * evrec) const
 
     //-- If the generated kinematics are accepted, finish-up module's job
     if(accept) {
+      this->RecordAccepted(interaction, iter);
       LOG("COHKinematics", pNOTICE) << "Selected: Lepton(" <<
         g_E_l << ", " << g_theta_l << ", " <<
         g_phi_l << ") Pion(" << g_theta_pi << ", " << g_phi_pi << ")";
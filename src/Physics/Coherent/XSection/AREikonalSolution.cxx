@@ -46,51 +46,39 @@ cdouble AREikonalSolution::Element(const double radius, const double cosine_rz,
   const double ppim = TMath::Sqrt(omepi*omepi - mpi*mpi);
   unsigned int sampling = (this->Nucleus())->GetSampling();
 
-  double absiz[sampling];
-  double decoy[sampling];
-
-  unsigned int junk;
-
-  integrationtools::SGNR(za, rmax, nz, sampling, absiz, junk, decoy);
-
-  //do i=1,nzs
-//  cdouble ordez[sampling];
-  cdouble * ordez = new cdouble[sampling]; // CA
-  double zp, rp;
-  cdouble piself;
-
   unsigned int A = fNucleus->A();
   unsigned int Z = fNucleus->Z();
 
-  for(unsigned int i = 0; i != sampling; ++i)
+  // Optical potential at all the sample points in the nucleus
+  integrationtools::BatchIntegrand_t optical_potential =
+    [&] (const unsigned int np, const double * absiz, cdouble * ordez)
   {
-    // Sample point in nucleus
-    zp = absiz[i];
-
-    // Radius in nucleus
-    rp = TMath::Sqrt( be*be + zp*zp );
+    for(unsigned int i = 0; i != np; ++i)
+    {
+      // Sample point in nucleus
+      double zp = absiz[i];
 
-    // Get nuclear densities
-    double dens_cent = fNucleus->CalcNumberDensity(rp);
-    double dens_p_cent = dens_cent * Z / A ;
-    double dens_n_cent = dens_cent * (A-Z)/A;
+      // Radius in nucleus
+      double rp = TMath::Sqrt( be*be + zp*zp );
 
-    // Calculate pion self energy
-    piself = this->PionSelfEnergy(dens_p_cent, dens_n_cent, omepi, ppim);
+      // Get nuclear densities
+      double dens_cent = fNucleus->CalcNumberDensity(rp);
+      double dens_p_cent = dens_cent * Z / A ;
+      double dens_n_cent = dens_cent * (A-Z)/A;
 
-    // Optical potential at each point in the nucleus
-    ordez[i] = piself / 2.0 / ppim;
+      // Calculate pion self energy
+      cdouble piself = this->PionSelfEnergy(dens_p_cent, dens_n_cent, omepi, ppim);
 
-  }
+      ordez[i] = piself / 2.0 / ppim;
+    }
+  };
 
   //Integrate the optical potential through the nucleus
-  cdouble resu = integrationtools::RGN1D(za, rmax, nz, sampling, ordez);
+  cdouble resu = integrationtools::IntegrateGLN1D(za, rmax, nz, sampling, optical_potential);
 
   // Eikonal approximation to the wave function
   cdouble uwaveik = exp( - cdouble(0,1) * ( ppim*za + resu ) );
 
-  delete [] ordez; // CA
-
   return uwaveik;
 }
 
@@ -0,0 +1,40 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include "Physics/Coherent/XSection/ARWavefunctionTable.h"
+
+namespace genie
+{
+namespace alvarezruso
+{
+
+ARWavefunctionTable::ARWavefunctionTable(double emin, double step) :
+  fEmin(emin),
+  fStep(step)
+{
+}
+
+ARWavefunctionTable::~ARWavefunctionTable()
+{
+}
+
+const ARWavefunctionTable::Node * ARWavefunctionTable::Find(int k) const
+{
+  std::map<int, Node>::const_iterator it = fNodes.find(k);
+  return (it == fNodes.end()) ? 0 : &(it->second);
+}
+
+ARWavefunctionTable::Node & ARWavefunctionTable::Add(int k)
+{
+  return fNodes[k];
+}
+
+} //namespace alvarezruso
+} //namespace genie
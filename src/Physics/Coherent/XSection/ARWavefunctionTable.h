@@ -0,0 +1,77 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::alvarezruso::ARWavefunctionTable
+
+\brief    Lookup table of the distorted pion wave functions of the
+          Alvarez-Ruso Coherent Pion Production xsec, in pion energy.
+
+          The wave function and its radial and angular derivatives at the
+          nuclear sampling points depend only on the nucleus and on the
+          pion energy. They are kept at pion energies E(k) = Emin + k * Step
+          (k = 0, 1, ...), filled at first use, and linearly interpolated in
+          between. The nodes are stored with the plane wave phase
+          exp(-i p za) divided out, so that only the smooth distortion
+          factor is interpolated and the interpolation error is of order
+          Step^2. A table can be shared by all the cross section objects of
+          the same nucleus and pion mass.
+
+\ref
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _AR_WAVEFUNCTION_TABLE_H_
+#define _AR_WAVEFUNCTION_TABLE_H_
+
+#include <complex>
+#include <map>
+#include <vector>
+
+namespace genie
+{
+namespace alvarezruso
+{
+
+class ARWavefunctionTable
+{
+  public:
+
+    // wave function, radial and angular derivative at all sampling points,
+    // divided by the plane wave phase
+    struct Node {
+      std::vector<std::complex<double> > fUwave;
+      std::vector<std::complex<double> > fUwaveDr;
+      std::vector<std::complex<double> > fUwaveDtheta;
+    };
+
+    ARWavefunctionTable(double emin, double step);
+    ~ARWavefunctionTable();
+
+    double Emin (void) const { return fEmin; }
+    double Step (void) const { return fStep; }
+
+    //! Node k, at pion energy Emin + k * Step, or 0 if not filled yet
+    const Node * Find (int k) const;
+    Node &       Add  (int k);
+
+    unsigned int NNodes (void) const { return fNodes.size(); }
+
+  private:
+
+    double fEmin;
+    double fStep;
+    std::map<int, Node> fNodes;
+};
+
+} //namespace alvarezruso
+} //namespace genie
+
+#endif
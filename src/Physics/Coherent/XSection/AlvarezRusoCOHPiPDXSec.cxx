@@ -296,9 +296,26 @@ void AlvarezRusoCOHPiPDXSec::SetCurrent()
 /// This is only a function of the nucleus and pion momentum/energy
 /// so if neither of those have changed there is no need to re-calculate
 /// the wavefunction values.
-/// Such a caching has not been implemented here yet!
+/// With a wavefunction table, the values are interpolated in pion energy
+/// from the solutions at the table nodes.
+
+void AlvarezRusoCOHPiPDXSec::SetWavefunctionTable(std::shared_ptr<ARWavefunctionTable> table)
+{
+  fWFTable  = table;
+  fLastE_pi = -9999999.;
+}
 
 void AlvarezRusoCOHPiPDXSec::SolveWavefunctions()
+{
+  if (fWFTable) {
+    this->InterpolateWavefunctions();
+  } else {
+    this->SolveWavefunctions(fP_pi.E(), *fUwave, *fUwaveDr, *fUwaveDtheta);
+  }
+}
+
+void AlvarezRusoCOHPiPDXSec::SolveWavefunctions(double e_pion, ARWavefunction & uwave,
+                          ARWavefunction & uwave_dr, ARWavefunction & uwave_dtheta)
 {
   unsigned int n_points = fNucleus->GetNDensities();
 
@@ -326,18 +343,18 @@ void AlvarezRusoCOHPiPDXSec::SolveWavefunctions()
       cosine_rz = x2 / radius;
 
       // Calculate wavefunction
-      fUwave->set(i, j, fWfsolution->Element(radius, -cosine_rz,
-                          fP_pi.E()));
+      uwave.set(i, j, fWfsolution->Element(radius, -cosine_rz,
+                          e_pion));
       delta_r = 0.0001;
       if( radius < delta_r ) delta_r = radius;
 
       // Calculate derivative of wavefunction in the radial direction
       uwave_plus  = fWfsolution->Element( (radius+delta_r), -cosine_rz,
-                                     fP_pi.E());
+                                     e_pion);
       uwave_minus = fWfsolution->Element( (radius-delta_r), -cosine_rz,
-                                     fP_pi.E());
+                                     e_pion);
 
-      fUwaveDr->set(i, j, (uwave_plus - uwave_minus) / (2.0 * delta_r) );
+      uwave_dr.set(i, j, (uwave_plus - uwave_minus) / (2.0 * delta_r) );
 
       // Calculate derivative of wavefunction in the angle space
       delta_c = 0.0001;
@@ -345,14 +362,91 @@ void AlvarezRusoCOHPiPDXSec::SolveWavefunctions()
       else if( (cosine_rz + delta_c) >=  1.0 )  delta_c = 1.0 - cosine_rz - 1E-12;
 
       uwave_plus  = fWfsolution->Element(radius, -(cosine_rz+delta_c),
-                                        fP_pi.E());
+                                        e_pion);
       uwave_minus = fWfsolution->Element(radius, -(cosine_rz-delta_c),
-                                        fP_pi.E());
-      fUwaveDtheta->set( i, j, (uwave_plus - uwave_minus) / (2.0 * delta_c) );
+                                        e_pion);
+      uwave_dtheta.set( i, j, (uwave_plus - uwave_minus) / (2.0 * delta_c) );
+
+    }
+  }
+
+}
+
+/*
+ * Interpolate the wavefunctions linearly between the table nodes around the
+ * pion energy. At sampling point (i,j) the wavefunction has the plane wave
+ * phase exp(i p x2), which is factored out of the nodes and applied at the
+ * pion momentum. The first node is one step above the pion mass (where the
+ * momentum vanishes): energies below it are extrapolated from nodes 1 and 2.
+ */
+void AlvarezRusoCOHPiPDXSec::InterpolateWavefunctions()
+{
+  double e_pion = fP_pi.E();
+  double u = (e_pion - fWFTable->Emin()) / fWFTable->Step();
+  int    k = TMath::Max(1, (int) TMath::Floor(u));
+  double t = u - k;
+
+  const ARWavefunctionTable::Node & node0 = this->WavefunctionNode(k);
+  const ARWavefunctionTable::Node & node1 = this->WavefunctionNode(k+1);
+
+  double ppim = this->PlaneWaveMomentum(e_pion);
+  unsigned int n_points = fNucleus->GetNDensities();
 
+  for(unsigned int j = 0; j != n_points; ++j)
+  {
+    cdouble phase = exp( cdouble(0, ppim * fNucleus->SamplePoint2(j)) );
+    for(unsigned int i = 0; i != n_points; ++i)
+    {
+      unsigned int ij = i*n_points + j;
+      fUwave     ->set(i, j, phase * ((1-t)*node0.fUwave     [ij] + t*node1.fUwave     [ij]));
+      fUwaveDr   ->set(i, j, phase * ((1-t)*node0.fUwaveDr   [ij] + t*node1.fUwaveDr   [ij]));
+      fUwaveDtheta->set(i, j, phase * ((1-t)*node0.fUwaveDtheta[ij] + t*node1.fUwaveDtheta[ij]));
     }
   }
+}
+
+const ARWavefunctionTable::Node & AlvarezRusoCOHPiPDXSec::WavefunctionNode(int k)
+{
+  const ARWavefunctionTable::Node * node = fWFTable->Find(k);
+  if (node) return *node;
+
+  double e_pion = fWFTable->Emin() + k * fWFTable->Step();
+
+  ARWavefunction uwave       (fSampling, debug_);
+  ARWavefunction uwave_dr    (fSampling, debug_);
+  ARWavefunction uwave_dtheta(fSampling, debug_);
+  this->SolveWavefunctions(e_pion, uwave, uwave_dr, uwave_dtheta);
+
+  double ppim = this->PlaneWaveMomentum(e_pion);
+  unsigned int n_points = fNucleus->GetNDensities();
 
+  ARWavefunctionTable::Node & new_node = fWFTable->Add(k);
+  new_node.fUwave      .resize(n_points*n_points);
+  new_node.fUwaveDr    .resize(n_points*n_points);
+  new_node.fUwaveDtheta.resize(n_points*n_points);
+  for(unsigned int j = 0; j != n_points; ++j)
+  {
+    cdouble phase = exp( cdouble(0, -ppim * fNucleus->SamplePoint2(j)) );
+    for(unsigned int i = 0; i != n_points; ++i)
+    {
+      unsigned int ij = i*n_points + j;
+      new_node.fUwave      [ij] = phase * uwave       (i,j);
+      new_node.fUwaveDr    [ij] = phase * uwave_dr    (i,j);
+      new_node.fUwaveDtheta[ij] = phase * uwave_dtheta(i,j);
+    }
+  }
+  return new_node;
+}
+
+/*
+ * Pion momentum of the plane wave in the eikonal wavefunction
+ * (see AREikonalSolution::Element)
+ */
+double AlvarezRusoCOHPiPDXSec::PlaneWaveMomentum(double e_pion)
+{
+  double mpi   = fConstants->PiPMass();
+  double omepi = e_pion - fM_pi + mpi;
+  return TMath::Sqrt( TMath::Max(0., omepi*omepi - mpi*mpi) );
 }
 
 cdouble AlvarezRusoCOHPiPDXSec::DeltaPropagatorInMed(LorentzVector delta_momentum)
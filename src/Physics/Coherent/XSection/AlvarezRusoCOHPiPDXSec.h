@@ -27,9 +27,11 @@
 #include "Physics/Coherent/XSection/ARSampledNucleus.h"
 #include "Physics/Coherent/XSection/ARConstants.h"
 #include "Physics/Coherent/XSection/ARWavefunction.h"
+#include "Physics/Coherent/XSection/ARWavefunctionTable.h"
 #include "Physics/NuclearState/NuclearUtils.h"
 
 #include <complex>
+#include <memory>
 
 namespace genie
 {
@@ -58,6 +60,10 @@ class AlvarezRusoCOHPiPDXSec
 
     void SetDebug(bool debug)  {  debug_ = debug;  };
 
+    // Interpolate the pion wave functions from the input table (of the same
+    // nucleus and pion mass) rather than solving them at every pion energy
+    void SetWavefunctionTable(std::shared_ptr<ARWavefunctionTable> table);
+
     ARConstants      & GetConstants(void);
     ARSampledNucleus & GetNucleus  (void);
 
@@ -101,6 +107,11 @@ class AlvarezRusoCOHPiPDXSec
 
         // Fill the wavefunctions
         void SolveWavefunctions();
+        void SolveWavefunctions(double e_pion, ARWavefunction & uwave,
+                   ARWavefunction & uwave_dr, ARWavefunction & uwave_dtheta);
+        void InterpolateWavefunctions();
+        const ARWavefunctionTable::Node & WavefunctionNode(int k);
+        double PlaneWaveMomentum(double e_pion);
 
         //______________________________________________________________
         // Properties
@@ -160,6 +171,7 @@ class AlvarezRusoCOHPiPDXSec
         ARWavefunction* fUwave;
         ARWavefunction* fUwaveDr;
         ARWavefunction* fUwaveDtheta;
+        std::shared_ptr<ARWavefunctionTable> fWFTable;
 
         std::complex<double>  fJ_hadronic[4];
 };
@@ -41,20 +41,20 @@ using namespace alvarezruso;
 AlvarezRusoCOHPiPXSec::AlvarezRusoCOHPiPXSec() :
 XSecAlgorithmI("genie::AlvarezRusoCOHPiPXSec")
 {
-  fMultidiff = NULL;
-  fLastInteraction = NULL;
+  fUseLookupTable  = false;
+  fLookupTableStep = 0.;
 }
 //____________________________________________________________________________
 AlvarezRusoCOHPiPXSec::AlvarezRusoCOHPiPXSec(string config) :
 XSecAlgorithmI("genie::AlvarezRusoCOHPiPXSec", config)
 {
-  fMultidiff = NULL;
-  fLastInteraction = NULL;
+  fUseLookupTable  = false;
+  fLookupTableStep = 0.;
 }
 //____________________________________________________________________________
 AlvarezRusoCOHPiPXSec::~AlvarezRusoCOHPiPXSec()
 {
-  if (fMultidiff) delete fMultidiff;
+  this->ClearCaches();
 }
 //____________________________________________________________________________
 double AlvarezRusoCOHPiPXSec::XSec(
@@ -66,66 +66,89 @@ double AlvarezRusoCOHPiPXSec::XSec(
   const Kinematics &   kinematics = interaction -> Kine();
   const InitialState & init_state = interaction -> InitState();
 
-  int A       = init_state.Tgt().A(); // mass number
-  int Z       = init_state.Tgt().Z(); // atomic number
   double E_nu = init_state.ProbeE(kRfLab); // neutrino energy
 
   const TLorentzVector p4_lep = kinematics.FSLeptonP4();
   const TLorentzVector p4_pi  = kinematics.HadSystP4();
   double E_lep = p4_lep.E();
 
-  if (fLastInteraction!=interaction) {
-    if (fMultidiff != NULL) {
-      delete fMultidiff;
-      fMultidiff = NULL;
-    }
+  AlvarezRusoCOHPiPDXSec * multidiff = this->Multidiff(interaction);
+  if (!multidiff) return 0.;
 
-    current_t current;
-    if ( interaction->ProcInfo().IsWeakCC() ) {
-      current = kCC;
-    }
-    else if ( interaction->ProcInfo().IsWeakNC() ) {
-      current = kNC;
-    }
-    else {
-      LOG("AlvarezRusoCohPi",pDEBUG)<<"Unknown current for AlvarezRuso implementation";
-      return 0.;
-    }
+  double xsec = multidiff->DXSec(E_nu, E_lep, p4_lep.Theta(), p4_lep.Phi(), p4_pi.Theta(), p4_pi.Phi());
+  xsec = xsec * 1E-38 * units::cm2;
 
-    flavour_t flavour;
-    if ( init_state.ProbePdg() == 12 || init_state.ProbePdg() == -12) {
-      flavour=kE;
-    }
-    else if ( init_state.ProbePdg() == 14 || init_state.ProbePdg() == -14) {
-      flavour=kMu;
-    }
-    else if ( init_state.ProbePdg() == 16 || init_state.ProbePdg() == -16) {
-      flavour=kTau;
-    }
-    else {
-      LOG("AlvarezRusoCohPi",pDEBUG)<<"Unknown probe for AlvarezRuso implementation";
-      return 0.;
-    }
+  if (kps != kPSElOlOpifE) {
+    xsec *= utils::kinematics::Jacobian(interaction, kPSElOlOpifE, kps );
+  }
 
-    nutype_t nutype;
-    if ( init_state.ProbePdg() > 0) {
-      nutype = kNu;
-    } else {
-      nutype = kAntiNu;
-    }
+  return (xsec);
+}
+//____________________________________________________________________________
+AlvarezRusoCOHPiPDXSec * AlvarezRusoCOHPiPXSec::Multidiff(
+                                       const Interaction * interaction) const
+{
+  const InitialState & init_state = interaction -> InitState();
+
+  int A = init_state.Tgt().A(); // mass number
+  int Z = init_state.Tgt().Z(); // atomic number
 
-    fMultidiff = new AlvarezRusoCOHPiPDXSec(Z, A ,current, flavour, nutype);
-    fLastInteraction = interaction;
+  current_t current;
+  if ( interaction->ProcInfo().IsWeakCC() ) {
+    current = kCC;
+  }
+  else if ( interaction->ProcInfo().IsWeakNC() ) {
+    current = kNC;
+  }
+  else {
+    LOG("AlvarezRusoCohPi",pDEBUG)<<"Unknown current for AlvarezRuso implementation";
+    return 0;
   }
 
-  double xsec = fMultidiff->DXSec(E_nu, E_lep, p4_lep.Theta(), p4_lep.Phi(), p4_pi.Theta(), p4_pi.Phi());
-  xsec = xsec * 1E-38 * units::cm2;
+  flavour_t flavour;
+  if ( init_state.ProbePdg() == 12 || init_state.ProbePdg() == -12) {
+    flavour=kE;
+  }
+  else if ( init_state.ProbePdg() == 14 || init_state.ProbePdg() == -14) {
+    flavour=kMu;
+  }
+  else if ( init_state.ProbePdg() == 16 || init_state.ProbePdg() == -16) {
+    flavour=kTau;
+  }
+  else {
+    LOG("AlvarezRusoCohPi",pDEBUG)<<"Unknown probe for AlvarezRuso implementation";
+    return 0;
+  }
 
-  if (kps != kPSElOlOpifE) {
-    xsec *= utils::kinematics::Jacobian(interaction, kPSElOlOpifE, kps );
+  nutype_t nutype;
+  if ( init_state.ProbePdg() > 0) {
+    nutype = kNu;
+  } else {
+    nutype = kAntiNu;
   }
 
-  return (xsec);
+  MultidiffKey_t key(A, Z, current, flavour, nutype);
+  std::map<MultidiffKey_t, AlvarezRusoCOHPiPDXSec *>::const_iterator it =
+     fMultidiffs.find(key);
+  if (it != fMultidiffs.end()) return it->second;
+
+  AlvarezRusoCOHPiPDXSec * multidiff =
+     new AlvarezRusoCOHPiPDXSec(Z, A ,current, flavour, nutype);
+  fMultidiffs[key] = multidiff;
+
+  // the wave functions depend on the nucleus and, via the pion mass, on the
+  // current only: share one table by all flavours and nu/nubar
+  if (fUseLookupTable) {
+    WFTableKey_t tkey(A, Z, current);
+    std::shared_ptr<ARWavefunctionTable> & table = fWFTables[tkey];
+    if (!table) {
+      double step = fLookupTableStep / multidiff->GetConstants().HBar();
+      table = std::make_shared<ARWavefunctionTable>(multidiff->GetPiMass(), step);
+    }
+    multidiff->SetWavefunctionTable(table);
+  }
+
+  return multidiff;
 }
 //____________________________________________________________________________
 double AlvarezRusoCOHPiPXSec::Integral(const Interaction * interaction) const
@@ -185,5 +208,27 @@ void AlvarezRusoCOHPiPXSec::LoadConfig(void)
       dynamic_cast<const XSecIntegratorI *> (this->SubAlg("XSec-Integrator"));
   assert(fXSecIntegrator);
 
+  //-- pion wave function tables
+  GetParamDef( "UseLookupTable",  fUseLookupTable,  false );
+  GetParamDef( "LookupTableStep", fLookupTableStep, 0.002 );
+
+  if (fUseLookupTable && fLookupTableStep <= 0.) {
+    LOG("AlvarezRusoCohPi", pFATAL)
+      << "Invalid pion wave function table step: " << fLookupTableStep;
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  // cached cross sections & tables were made with the previous configuration
+  this->ClearCaches();
+}
+//____________________________________________________________________________
+void AlvarezRusoCOHPiPXSec::ClearCaches(void)
+{
+  std::map<MultidiffKey_t, AlvarezRusoCOHPiPDXSec *>::iterator it =
+     fMultidiffs.begin();
+  for( ; it != fMultidiffs.end(); ++it) delete it->second;
+  fMultidiffs.clear();
+  fWFTables.clear();
 }
 //____________________________________________________________________________
@@ -22,8 +22,13 @@
 #ifndef _ALVAREZ_RUSO_COH_XSEC_H_
 #define _ALVAREZ_RUSO_COH_XSEC_H_
 
+#include <map>
+#include <memory>
+#include <tuple>
+
 #include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Physics/Coherent/XSection/AlvarezRusoCOHPiPDXSec.h"
+#include "Physics/Coherent/XSection/ARWavefunctionTable.h"
 
 namespace genie {
 
@@ -48,14 +53,25 @@ public:
   void Configure(string config);
 
 private:
-  void LoadConfig(void);
+  void LoadConfig  (void);
+  void ClearCaches (void);
+
+  alvarezruso::AlvarezRusoCOHPiPDXSec * Multidiff (const Interaction * i) const;
 
   //-- private data members loaded from config Registry or set to defaults
 
   const XSecIntegratorI * fXSecIntegrator;
 
-  mutable alvarezruso::AlvarezRusoCOHPiPDXSec * fMultidiff;
-  mutable const Interaction * fLastInteraction;
+  bool   fUseLookupTable;  ///< interpolate the pion wave functions in pion energy?
+  double fLookupTableStep; ///< pion energy step of the wave function tables (GeV)
+
+  // 5d cross sections, kept for every (A, Z, current, flavour, nu/nubar) used
+  // so that the nucleus is sampled and the wave functions solved only once,
+  // and the pion wave function tables for every (A, Z, current)
+  typedef std::tuple<int,int,int,int,int> MultidiffKey_t;
+  typedef std::tuple<int,int,int>         WFTableKey_t;
+  mutable std::map<MultidiffKey_t, alvarezruso::AlvarezRusoCOHPiPDXSec *> fMultidiffs;
+  mutable std::map<WFTableKey_t, std::shared_ptr<alvarezruso::ARWavefunctionTable> > fWFTables;
   //Parameters
   //bool fUseLookupTable;
   //double fa4;
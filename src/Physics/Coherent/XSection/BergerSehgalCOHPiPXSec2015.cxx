@@ -7,15 +7,20 @@
 */
 //____________________________________________________________________________
 
+#include <sstream>
+#include <iomanip>
+
 #include <TMath.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
+#include "Framework/Algorithm/AlgSharedData.h"
 #include "Physics/XSectionIntegration/XSecIntegratorI.h"
 #include "Framework/Conventions/GBuild.h"
 #include "Framework/Conventions/Constants.h"
 #include "Framework/Conventions/Units.h"
 #include "Framework/Conventions/RefFrame.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/RandomGen.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Physics/Coherent/XSection/BergerSehgalCOHPiPXSec2015.h"
@@ -58,114 +63,23 @@ double BergerSehgalCOHPiPXSec2015::XSec(
   const InitialState & init_state = interaction -> InitState();
 
   bool pionIsCharged = interaction->ProcInfo().IsWeakCC();
-  double xsec = 0.0;
 
   double E      = init_state.ProbeE(kRfLab);        // nu E
   double Q2     = kinematics.Q2();
   double y      = kinematics.y();                   // inelasticity
-  double x      = kinematics.x();
   assert(E > 0.);
   assert(y > 0.);
   assert(y < 1.);
-  double ppistar = PionCOMAbsMomentum(interaction); // |Center of Mass Momentum|
-  if (ppistar <= 0.0) {
-    LOG("BergerSehgalCohPi", pDEBUG) << "Pion COM momentum negative for Q2 = " << Q2 <<
-      " x = " << x << " y = " << y;
-    return 0.0;
-  }
-  double front  = ExactKinematicTerm(interaction);
-  if (front <= 0.0) {
-    LOG("BergerSehgalCohPi", pDEBUG) << "Exact kin. form = " << front <<
-      " E = " << E << " Q2 = " << Q2 << " y = " << y << " x = " << x;
-    return 0.0;
-  }
 
-  double A      = (double) init_state.Tgt().A();   // mass number
-  double A2     = TMath::Power(A, 2.);
-  double A_3    = TMath::Power(A, 1./3.);
-  double M      = init_state.Tgt().Mass();
-  double M_pi   = pionIsCharged ? kPionMass : kPi0Mass;
-  double Epi    = y*E;                             // ~pion energy
   double ma2    = TMath::Power(fMa, 2);            // "axial mass" squared
   double Ga     = ma2 / (ma2 + Q2);
   double Ga2    = TMath::Power(Ga, 2.);            // propagator term
-  double Ro2    = TMath::Power(fRo * units::fermi, 2.);
-
-  // the xsec is d^3xsec/dQ^2dydt but the only t-dependent factor
-  // is an exp(-bt) so it can be integrated analyticaly
-  double Epi2   = TMath::Power(Epi, 2.);
-  double R      = fRo * A_3 * units::fermi; // nuclear radius
-  double R2     = TMath::Power(R, 2.);
-  double b      = 0.33333 * R2;
-  double MxEpi  = M * x / Epi;
-  double mEpi2  = (M_pi * M_pi) / Epi2;
-  double tA     = 1. + MxEpi - 0.5 * mEpi2;
-  double tB     = TMath::Sqrt(1.0 + 2 * MxEpi) * TMath::Sqrt(1.0 - mEpi2);
-  double tmin   = 2 * Epi2 * (tA - tB);
-  double tmax   = 2 * Epi2 * (tA + tB);
-  if (tmin < 1.0e-8) {
-      tmin = 1.0e-8;
-  }
-
-  /* const KPhaseSpace & kphase = interaction->PhaseSpace(); */
-  /* Range1D_t tl = kphase.TLim();   // TESTING! */
 
-  double sigtot_pin  = utils::hadxs::berger::PionNucleonXSec(Epi, /* get_total = */ true, pionIsCharged);
-  double sigel_pin   = utils::hadxs::berger::PionNucleonXSec(Epi, /* get_total = */ false, pionIsCharged);
-  double siginel_pin = sigtot_pin - sigel_pin;
-
-  // fabs (F_{abs}) describes the average attenuation of a pion emerging
-  // from a sphere of nuclear matter with radius = R_0 A^{1/3}. it is
-  // Eq. 13 in Berger-Sehgal PRD 79, 053003
-  double fabs_input  = (9.0 * A_3) / (16.0 * kPi * Ro2);
-  double fabs        = TMath::Exp( -1.0 * fabs_input * siginel_pin);
-
-  // my old hackery to get things to work, A. Mislivec provided a better alt.
-  // double factor      = 0.1; // to go from 10^-37 cm^2 -> 10^-38 cm^2
-  // double RS_factor   = (units::mb*A2*fabs)/(16.0*kPi) * (sigtot_pin*sigtot_pin);
-
-  // A_RS for BS version of RS, and/or Tpi>1.0
-  double RS_factor = (A2 * fabs) / (16.0 * kPi) * (sigtot_pin * sigtot_pin);
-
-  // get the pion-nucleus cross section on carbon, fold it into differential cross section
-  double tpi         = (E * y) - M_pi - ((Q2 + M_pi * M_pi) / (2 * M));
-  double tpilow      = 0.0;
-  double siglow      = 0.0;
-  double tpihigh     = 0.0;
-  double sighigh     = 0.0;
-  double dsigdzfit   = 0.0;
-  double dsigdtfit   = 0.0;
-  int    xsec_stat   = 0;
-  double dsig        = 0.0;
-  double tstep       = 100;
-  double logt_step   = TMath::Abs(log(tmax) - log(tmin)) / tstep;
-  double logt        = log(tmin) - logt_step/2.0;
-  double t_itt       = TMath::Exp(logt);
-  double t_width     = 0.0;
-
-  for (double t_step = 0; t_step<tstep; t_step++) {
-
-    logt = logt + logt_step;
-    t_itt = TMath::Exp(logt);
-    t_width = t_itt*logt_step;
-
-    if (tpi <= 1.0 && fRSPionXSec == false) {
-      xsec_stat =  utils::hadxs::berger::PionNucleusXSec(tpi, ppistar, t_itt, A, tpilow, siglow, tpihigh, sighigh);
-      if(xsec_stat){
-        LOG("BergerSehgalCohPi", pERROR) << "Call to PionNucleusXSec code failed - return xsec of 0.0";
-        return 0.0;
-      }
-      dsigdzfit = siglow + (sighigh - siglow) * (tpi - tpilow) / (tpihigh - tpilow);
-      dsigdtfit = dsigdzfit / (2.0 * ppistar * ppistar);
-      // we are handed a cross section in mb, need to convert it to GeV^{-2}
-      dsig +=   1.0  * front * Ga2 * t_width * dsigdtfit * units::mb;
-    }
-    else {
-      dsig += /*factor **/ front * Ga2 * t_width * RS_factor * exp(-1.0*b*t_itt);
-    }
-
-  }
-  xsec = dsig;
+  // the xsec is d^3xsec/dQ^2dydt but the t-dependence is a sum of
+  // exponentials so it can be integrated analyticaly
+  TSpectrum ts;
+  if(! this->TDistribution(interaction, ts) ) return 0.0;
+  double xsec = ts.Integral();
 
   // Correction for finite final state lepton mass.
   // Lepton mass modification is part of Berger-Sehgal and is not optional.
@@ -192,14 +106,10 @@ double BergerSehgalCOHPiPXSec2015::XSec(
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("BergerSehgalCohPi", pDEBUG)
     << "\n momentum transfer .............. Q2    = " << Q2
-    << "\n mass number .................... A     = " << A
-    << "\n pion energy .................... Epi   = " << Epi
+    << "\n pion energy .................... Epi   = " << y*E
     << "\n propagator term ................ Ga2   = " << Ga2
-    << "\n total pi+N cross section ....... sigT  = " << sigtot_pin
-    << "\n inelastic pi+N cross section ... sigI  = " << siginel_pin
     << "\n nuclear size scale ............. Ro    = " << fRo
-    << "\n pion absorption factor ......... Fabs  = " << fabs
-    << "\n t integration range ............ [" << tmin << "," << tmax << "]"
+    << "\n t integration range ............ [" << ts.fTMin << "," << ts.fTMax << "]";
   LOG("BergerSehgalCohPi", pINFO)
     << "d2xsec/dQ2dy[COHPi] (Q2= " << Q2 << ", y="
     << y << ", E=" << E << ") = "<< xsec;
@@ -215,6 +125,219 @@ double BergerSehgalCOHPiPXSec2015::XSec(
   return xsec;
 }
 //____________________________________________________________________________
+bool BergerSehgalCOHPiPXSec2015::TDistribution(
+                   const Interaction * interaction, TSpectrum & ts) const
+{
+// Computes the t-dependence of d^3xsec/dQ2dydt. This is Eq.'s 6 (CC) and
+// 7 (NC) of PRD 79, 053003, with the (NC) propagator term but without the
+// CC lepton mass correction. Returns false for forbidden kinematics.
+
+  const Kinematics &   kinematics = interaction -> Kine();
+  const InitialState & init_state = interaction -> InitState();
+
+  bool pionIsCharged = interaction->ProcInfo().IsWeakCC();
+
+  double E      = init_state.ProbeE(kRfLab);        // nu E
+  double Q2     = kinematics.Q2();
+  double y      = kinematics.y();                   // inelasticity
+  double x      = kinematics.x();
+
+  double ppistar = PionCOMAbsMomentum(interaction); // |Center of Mass Momentum|
+  if (ppistar <= 0.0) {
+    LOG("BergerSehgalCohPi", pDEBUG) << "Pion COM momentum negative for Q2 = " << Q2 <<
+      " x = " << x << " y = " << y;
+    return false;
+  }
+  double front  = ExactKinematicTerm(interaction);
+  if (front <= 0.0) {
+    LOG("BergerSehgalCohPi", pDEBUG) << "Exact kin. form = " << front <<
+      " E = " << E << " Q2 = " << Q2 << " y = " << y << " x = " << x;
+    return false;
+  }
+
+  int    A      = init_state.Tgt().A();            // mass number
+  double A_3    = TMath::Power(A, 1./3.);
+  double M      = init_state.Tgt().Mass();
+  double M_pi   = pionIsCharged ? kPionMass : kPi0Mass;
+  double Epi    = y*E;                             // ~pion energy
+  double ma2    = TMath::Power(fMa, 2);            // "axial mass" squared
+  double Ga     = ma2 / (ma2 + Q2);
+  double Ga2    = TMath::Power(Ga, 2.);            // propagator term
+
+  double Epi2   = TMath::Power(Epi, 2.);
+  double MxEpi  = M * x / Epi;
+  double mEpi2  = (M_pi * M_pi) / Epi2;
+  double tA     = 1. + MxEpi - 0.5 * mEpi2;
+  double tB     = TMath::Sqrt(1.0 + 2 * MxEpi) * TMath::Sqrt(1.0 - mEpi2);
+  ts.fTMin      = 2 * Epi2 * (tA - tB);
+  ts.fTMax      = 2 * Epi2 * (tA + tB);
+  if (ts.fTMin < 1.0e-8) {
+      ts.fTMin = 1.0e-8;
+  }
+  if (!(ts.fTMax > ts.fTMin)) return false;
+
+  double tpi    = (E * y) - M_pi - ((Q2 + M_pi * M_pi) / (2 * M));
+
+  if (tpi <= 1.0 && fRSPionXSec == false) {
+    // get the pion-nucleus cross section on carbon, fold it into the
+    // differential cross section: dsig/dz is interpolated linearly in tpi
+    // between two data points, each an exponential in t
+    double tpilow = 0, clow = 0, blow = 0, tpihigh = 0, chigh = 0, bhigh = 0;
+    int xsec_stat = utils::hadxs::berger::PionNucleusXSecFit(
+                        tpi, A, tpilow, clow, blow, tpihigh, chigh, bhigh);
+    if(xsec_stat){
+      LOG("BergerSehgalCohPi", pERROR) << "Call to PionNucleusXSec code failed - return xsec of 0.0";
+      return false;
+    }
+    double w  = (tpi - tpilow) / (tpihigh - tpilow);
+    double p2 = ppistar * ppistar;
+    // dsig/dt = dsig/dz / (2 p*^2); we are handed a cross section in mb,
+    // need to convert it to GeV^{-2}
+    double norm = front * Ga2 * units::mb / (2.0 * p2);
+    ts.fN    = 2;
+    ts.fC[0] = norm * (1-w) * clow;
+    ts.fB[0] = blow / p2;
+    ts.fC[1] = norm * w * chigh;
+    ts.fB[1] = bhigh / p2;
+  }
+  else {
+    // A_RS for BS version of RS, and/or Tpi>1.0
+    double R      = fRo * A_3 * units::fermi; // nuclear radius
+    double R2     = TMath::Power(R, 2.);
+    ts.fN    = 1;
+    ts.fC[0] = front * Ga2 * this->RSFactor(Epi, A, pionIsCharged);
+    ts.fB[0] = 0.33333 * R2;
+  }
+  return true;
+}
+//____________________________________________________________________________
+double BergerSehgalCOHPiPXSec2015::TSpectrum::TermIntegral(int i) const
+{
+  if(fB[i] <= 0) return fC[i] * (fTMax - fTMin);
+  return fC[i] * (TMath::Exp(-fB[i]*fTMin) - TMath::Exp(-fB[i]*fTMax)) / fB[i];
+}
+//____________________________________________________________________________
+double BergerSehgalCOHPiPXSec2015::TSpectrum::Integral(void) const
+{
+  double sum = 0;
+  for(int i = 0; i < fN; i++) sum += this->TermIntegral(i);
+  return sum;
+}
+//____________________________________________________________________________
+double BergerSehgalCOHPiPXSec2015::TSpectrum::Density(double t) const
+{
+  double sum = 0;
+  for(int i = 0; i < fN; i++) sum += fC[i] * TMath::Exp(-fB[i]*t);
+  return sum;
+}
+//____________________________________________________________________________
+double BergerSehgalCOHPiPXSec2015::GenerateT(
+                   const Interaction * interaction, double & tpdf) const
+{
+// Samples t directly from the model t-distribution: an exponential term is
+// selected with probability proportional to its integral, then t is
+// obtained by inverting its cumulative distribution.
+
+  tpdf = 0;
+  TSpectrum ts;
+  if(! this->TDistribution(interaction, ts) ) return -1;
+  double sum = ts.Integral();
+  if(sum <= 0) return -1;
+
+  RandomGen * rnd = RandomGen::Instance();
+
+  int i = 0;
+  if(ts.fN > 1 && rnd->RndKine().Rndm() * sum >= ts.TermIntegral(0)) i = 1;
+
+  double r = rnd->RndKine().Rndm();
+  double t = 0;
+  if(ts.fB[i] <= 0) {
+    t = ts.fTMin + r * (ts.fTMax - ts.fTMin);
+  } else {
+    double e0 = TMath::Exp(-ts.fB[i]*ts.fTMin);
+    double e1 = TMath::Exp(-ts.fB[i]*ts.fTMax);
+    t = -1. * TMath::Log(e0 - r * (e0 - e1)) / ts.fB[i];
+  }
+  tpdf = ts.Density(t) / sum;
+  return t;
+}
+//____________________________________________________________________________
+double BergerSehgalCOHPiPXSec2015::RSFactor(
+                               double Epi, int A, bool charged) const
+{
+// A^2 * Fabs * sigtot(piN)^2 / 16pi, interpolated from the table of the
+// nucleus (linearly in log(Epi))
+
+  int key = 2*A + (charged ? 1 : 0);
+  std::map<int, std::shared_ptr<const PionNucleusTable> >::const_iterator it =
+    fPionNucleusTables.find(key);
+  if ( it == fPionNucleusTables.end() ) {
+    std::ostringstream skey;
+    skey << "BergerSehgalCOHPiPXSec2015/PionNucleus/"
+         << A << "/" << charged << "/" << std::setprecision(17) << fRo;
+    std::shared_ptr<const PionNucleusTable> table =
+      AlgSharedData::Instance()->Get<PionNucleusTable>(skey.str(),
+        [this, A, charged] () { return this->BuildPionNucleusTable(A, charged); });
+    it = fPionNucleusTables.insert(std::make_pair(key, table)).first;
+  }
+  const PionNucleusTable & t = *(it->second);
+
+  double u = (TMath::Log(Epi) - t.fLogEpiMin) / t.fDLogEpi;
+  int n = t.fRSFactor.size();
+  if(u < 0 || u > n-1) return this->RSFactorExact(Epi, A, charged);
+  int i = TMath::Min( (int) u, n-2 );
+  double f = u - i;
+  return t.fRSFactor[i] + f * (t.fRSFactor[i+1] - t.fRSFactor[i]);
+}
+//____________________________________________________________________________
+double BergerSehgalCOHPiPXSec2015::RSFactorExact(
+                               double Epi, int A, bool charged) const
+{
+  double A2    = TMath::Power(A, 2.);
+  double A_3   = TMath::Power(A, 1./3.);
+  double Ro2   = TMath::Power(fRo * units::fermi, 2.);
+
+  double sigtot_pin  = utils::hadxs::berger::PionNucleonXSec(Epi, /* get_total = */ true, charged);
+  double sigel_pin   = utils::hadxs::berger::PionNucleonXSec(Epi, /* get_total = */ false, charged);
+  double siginel_pin = sigtot_pin - sigel_pin;
+
+  // fabs (F_{abs}) describes the average attenuation of a pion emerging
+  // from a sphere of nuclear matter with radius = R_0 A^{1/3}. it is
+  // Eq. 13 in Berger-Sehgal PRD 79, 053003
+  double fabs_input  = (9.0 * A_3) / (16.0 * kPi * Ro2);
+  double fabs        = TMath::Exp( -1.0 * fabs_input * siginel_pin);
+
+  return (A2 * fabs) / (16.0 * kPi) * (sigtot_pin * sigtot_pin);
+}
+//____________________________________________________________________________
+BergerSehgalCOHPiPXSec2015::PionNucleusTable *
+   BergerSehgalCOHPiPXSec2015::BuildPionNucleusTable(int A, bool charged) const
+{
+// Nodes every 0.5% in pion energy, from just above the pion mass (a few MeV
+// apart at the Delta, well within its width) to 500 GeV
+
+  double M_pi   = charged ? kPionMass : kPi0Mass;
+  double logmin = TMath::Log(1.001 * M_pi);
+  double logmax = TMath::Log(500.);
+  double dlog   = TMath::Log(1.005);
+  int    n      = 1 + (int) TMath::Ceil((logmax - logmin) / dlog);
+
+  PionNucleusTable * table = new PionNucleusTable;
+  table->fLogEpiMin = logmin;
+  table->fDLogEpi   = (logmax - logmin) / (n-1);
+  table->fRSFactor.resize(n);
+  for(int i = 0; i < n; i++) {
+    double Epi = TMath::Exp(logmin + i * table->fDLogEpi);
+    table->fRSFactor[i] = this->RSFactorExact(Epi, A, charged);
+  }
+
+  LOG("BergerSehgalCohPi", pNOTICE)
+    << "Tabulated the pion-nucleus factors for A = " << A
+    << (charged ? " (charged" : " (neutral") << " pions) at " << n
+    << " pion energies";
+  return table;
+}
+//____________________________________________________________________________
 double BergerSehgalCOHPiPXSec2015::ExactKinematicTerm(const Interaction * interaction) const
 {
   // This function is a bit inefficient but is being encapsulated as
@@ -296,6 +419,8 @@ void BergerSehgalCOHPiPXSec2015::Configure(string config)
 //____________________________________________________________________________
 void BergerSehgalCOHPiPXSec2015::LoadConfig(void)
 {
+  fPionNucleusTables.clear();
+
   GetParam( "COH-Ma",fMa ) ;
   GetParam( "COH-Ro", fRo ) ;
 
@@ -8,7 +8,10 @@
          v(vbar)A->v(vbar)Api0, vA->l-Api+, vbarA->l+Api-
 
          The t-dependence of the triple differential cross (d^3xsec/dxdydt)
-         is integrated out.
+         is integrated out. It is a sum of (at most two) exponentials in t, so
+         the integral is done in closed form, and GenerateT() samples t from
+         it directly. The pion-nucleus absorption/elastic factor of the
+         Rein-Sehgal style branch is tabulated per nucleus versus pion energy.
 
          Is a concrete implementation of the XSecAlgorithmI interface.
 
@@ -26,6 +29,10 @@
 #ifndef _BERGER_SEHGAL_COHPI_PXSEC_2015_H_
 #define _BERGER_SEHGAL_COHPI_PXSEC_2015_H_
 
+#include <map>
+#include <memory>
+#include <vector>
+
 #include "Framework/EventGen/XSecAlgorithmI.h"
 
 namespace genie {
@@ -49,12 +56,44 @@ namespace genie {
       void Configure(const Registry & config);
       void Configure(string config);
 
+      //-- generate t = |(q-p_pi)^2| for the (Q2,y) kinematics of the input
+      //   interaction; tpdf is the normalized t-distribution at that t
+      double GenerateT(const Interaction * i, double & tpdf) const;
+
     private:
       void LoadConfig(void);
 
       double ExactKinematicTerm(const Interaction * i) const;
       double PionCOMAbsMomentum(const Interaction * i) const;
 
+      /// d^3xsec/dQ2dydt (before the CC lepton mass correction) as a sum of
+      /// exponentials, sum_i c_i exp(-b_i t), in the allowed t range
+      struct TSpectrum {
+        int    fN;
+        double fC[2];
+        double fB[2];
+        double fTMin;
+        double fTMax;
+        double TermIntegral (int i)    const;
+        double Integral     (void)     const;
+        double Density      (double t) const;
+      };
+      bool TDistribution (const Interaction * i, TSpectrum & ts) const;
+
+      /// A^2 * Fabs * sigtot(piN)^2 / 16pi versus log(Epi), for one nucleus
+      /// and pion charge
+      struct PionNucleusTable {
+        double              fLogEpiMin;
+        double              fDLogEpi;
+        std::vector<double> fRSFactor;
+      };
+      double             RSFactor              (double Epi, int A, bool charged) const;
+      double             RSFactorExact         (double Epi, int A, bool charged) const;
+      PionNucleusTable * BuildPionNucleusTable (int A, bool charged) const;
+
+      /// Tables of the nuclei seen so far, by 2*A + (charged pion ? 1 : 0)
+      mutable std::map<int, std::shared_ptr<const PionNucleusTable> > fPionNucleusTables;
+
       //-- private data members loaded from config Registry or set to defaults
       double fMa;          ///< axial mass
       double fRo;          ///< nuclear size scale parameter
@@ -108,13 +108,9 @@ double COHXSecAR::Integrate(
     double kine_min[4] = { Elep_min, zero , zero    , zero    };
     double kine_max[4] = { Elep_max, pi   , pi      , twopi   };
 
-    ROOT::Math::IntegrationMultiDim::Type ig_type =
-      utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
-
     double abstol = 1; //We mostly care about relative tolerance.
-    ROOT::Math::IntegratorMultiDim ig(*func, ig_type, abstol, fGSLRelTol, fGSLMaxEval);
-
-    xsec = ig.Integral(kine_min, kine_max) * (1E-38 * units::cm2);
+    xsec = utils::gsl::IntegrateMultiDim(*func, fGSLIntgType, kine_min, kine_max,
+              abstol, fGSLRelTol, fGSLMaxEval) * (1E-38 * units::cm2);
     delete func;
   }
 
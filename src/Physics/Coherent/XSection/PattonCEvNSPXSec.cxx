@@ -8,10 +8,14 @@
 */
 //____________________________________________________________________________
 
+#include <sstream>
+#include <iomanip>
+
 #include <TMath.h>
 #include <Math/Integrator.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
+#include "Framework/Algorithm/AlgSharedData.h"
 #include "Framework/Conventions/Constants.h"
 #include "Framework/Conventions/RefFrame.h"
 #include "Framework/Conventions/KineVar.h"
@@ -89,12 +93,12 @@ double PattonCEvNSPXSec::XSec(
   // 1/4 was absorbed in the constant front factor (below) and Qw^2 factor would
   // have cancelled with ignored 1/Qw factor in the form factor F.
 
-  // Calculation of nuclear density moments used for the evaluation
-  // of the neutron form factor
-  double avg_density = this->NuclearDensityMoment(A, 0); // units:: fm^-3
-  double Rn2 = this->NuclearDensityMoment(A, 2) / avg_density; // units: fm^2
-  double Rn4 = this->NuclearDensityMoment(A, 4) / avg_density; // units: fm^4
-  double Rn6 = this->NuclearDensityMoment(A, 6) / avg_density; // units: fm^6
+  // Nuclear density moments used for the evaluation of the neutron form
+  // factor (computed once per nucleus)
+  const DensityMoments & moments = this->NuclearDensityMoments(A);
+  double Rn2 = moments.fRn2; // units: fm^2
+  double Rn4 = moments.fRn4; // units: fm^4
+  double Rn6 = moments.fRn6; // units: fm^6
 
   LOG("CEvNS", pDEBUG)
     << "Nuclear density moments:"
@@ -160,9 +164,8 @@ double PattonCEvNSPXSec::NuclearDensityMoment(int A, int k) const
   // Output:
   //   - nuclear density moment in units of fm^k
   //
-  // THINGS TO DO:
-  // 1) The calculation can be stored, as it is required only once per nucleus.
-  //    The calculation is very fast so it doesn't matter.
+  // The moments depend only on the nucleus: XSec() gets them, computed
+  // once per nucleus, from NuclearDensityMoments()
 
   ROOT::Math::IBaseFunctionOneDim * integrand = new
               utils::gsl::wrap::NuclDensityMomentIntegrand(A,k);
@@ -186,6 +189,49 @@ double PattonCEvNSPXSec::NuclearDensityMoment(int A, int k) const
   return moment;
 }
 //____________________________________________________________________________
+const PattonCEvNSPXSec::DensityMoments &
+  PattonCEvNSPXSec::NuclearDensityMoments(int A) const
+{
+  std::map<int, std::shared_ptr<const DensityMoments> >::const_iterator it =
+    fDensityMoments.find(A);
+  if ( it == fDensityMoments.end() ) {
+    // computed at first use, and shared by the instances of all threads
+    // with the same integration settings
+    std::ostringstream key;
+    key << "PattonCEvNSPXSec/DensityMoments/" << A << "/"
+        << std::setprecision(17)
+        << fNuclDensMomentCalc_UpperIntegrationLimit << ","
+        << fNuclDensMomentCalc_RelativeTolerance << ","
+        << fNuclDensMomentCalc_AbsoluteTolerance << ","
+        << fNuclDensMomentCalc_MaxNumOfEvaluations;
+
+    std::shared_ptr<const DensityMoments> moments =
+      AlgSharedData::Instance()->Get<DensityMoments>(key.str(),
+        [this, A] () { return this->BuildNuclearDensityMoments(A); });
+    it = fDensityMoments.insert(std::make_pair(A, moments)).first;
+  }
+  return *(it->second);
+}
+//____________________________________________________________________________
+PattonCEvNSPXSec::DensityMoments *
+  PattonCEvNSPXSec::BuildNuclearDensityMoments(int A) const
+{
+  double avg_density = this->NuclearDensityMoment(A, 0); // units:: fm^-3
+
+  DensityMoments * moments = new DensityMoments;
+  moments->fRn2 = this->NuclearDensityMoment(A, 2) / avg_density; // units: fm^2
+  moments->fRn4 = this->NuclearDensityMoment(A, 4) / avg_density; // units: fm^4
+  moments->fRn6 = this->NuclearDensityMoment(A, 6) / avg_density; // units: fm^6
+
+  LOG("CEvNS", pNOTICE)
+    << "Nuclear density moments for A = " << A << ":"
+    << " <Rn^2> = " << moments->fRn2 << " fm^2,"
+    << " <Rn^4> = " << moments->fRn4 << " fm^4,"
+    << " <Rn^6> = " << moments->fRn6 << " fm^6";
+
+  return moments;
+}
+//____________________________________________________________________________
 double PattonCEvNSPXSec::Integral(const Interaction * interaction) const
 {
   double xsec = fXSecIntegrator->Integrate(this,interaction);
@@ -241,6 +287,9 @@ void PattonCEvNSPXSec::LoadConfig(void)
           fNuclDensMomentCalc_MaxNumOfEvaluations,
           10000);
 
+  // The density moments depend on the integration settings
+  fDensityMoments.clear();
+
   fXSecIntegrator =
       dynamic_cast<const XSecIntegratorI *> (this->SubAlg("XSec-Integrator"));
   assert(fXSecIntegrator);
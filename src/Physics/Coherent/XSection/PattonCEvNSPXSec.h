@@ -21,6 +21,9 @@
 #ifndef _PATTON_ET_AL_COHERENT_ELASTIC_PXSEC_H_
 #define _PATTON_ET_AL_COHERENT_ELASTIC_PXSEC_H_
 
+#include <map>
+#include <memory>
+
 #include "Framework/EventGen/XSecAlgorithmI.h"
 
 namespace genie {
@@ -51,6 +54,19 @@ private:
   // Calculate nuclear density moments
   double NuclearDensityMoment(int A, int k) const;
 
+  /// Nuclear density moments used for the neutron form factor (normalized
+  /// to the average density). They only depend on the nucleus.
+  struct DensityMoments {
+    double fRn2;  ///< <Rn^2>, fm^2
+    double fRn4;  ///< <Rn^4>, fm^4
+    double fRn6;  ///< <Rn^6>, fm^6
+  };
+  const DensityMoments & NuclearDensityMoments      (int A) const;
+  DensityMoments *       BuildNuclearDensityMoments (int A) const;
+
+  /// Density moments of the nuclei seen so far, by mass number
+  mutable std::map<int, std::shared_ptr<const DensityMoments> > fDensityMoments;
+
   const XSecIntegratorI * fXSecIntegrator;  ///< cross section integrator
   double fSin2thw;                          ///< sin^2(weinberg angle)
 
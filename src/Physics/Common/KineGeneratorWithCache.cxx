@@ -10,12 +10,13 @@
 
 #include <sstream>
 #include <cstdlib>
-#include <map>
+#include <cassert>
 
 //#include <TSQLResult.h>
 //#include <TSQLRow.h>
 #include <TMath.h>
 
+#include "Framework/Algorithm/AlgFactory.h"
 #include "Framework/EventGen/EVGThreadException.h"
 #include "Physics/Common/KineGeneratorWithCache.h"
 #include "Framework/GHEP/GHepRecord.h"
@@ -23,30 +24,41 @@
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Utils/Cache.h"
 #include "Framework/Utils/CacheBranchFx.h"
+#include "Framework/Utils/CacheBranchGrid.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/Utils/RunCounters.h"
 #include "Framework/Numerical/MathUtils.h"
 
 using std::ostringstream;
-using std::map;
 
 using namespace genie;
 
 //___________________________________________________________________________
 KineGeneratorWithCache::KineGeneratorWithCache() :
-EventRecordVisitorI()
+EventRecordVisitorI(),
+fRjMonitor(this)
 {
-
+  fCacheBranchesRevision = -1;
+  fGridsRevision         = -1;
+  fUseAdaptiveGrid       = false;
 }
 //___________________________________________________________________________
 KineGeneratorWithCache::KineGeneratorWithCache(string name) :
-EventRecordVisitorI(name)
+EventRecordVisitorI(name),
+fRjMonitor(this)
 {
-
+  fCacheBranchesRevision = -1;
+  fGridsRevision         = -1;
+  fUseAdaptiveGrid       = false;
 }
 //___________________________________________________________________________
 KineGeneratorWithCache::KineGeneratorWithCache(string name, string config) :
-EventRecordVisitorI(name, config)
+EventRecordVisitorI(name, config),
+fRjMonitor(this)
 {
-
+  fCacheBranchesRevision = -1;
+  fGridsRevision         = -1;
+  fUseAdaptiveGrid       = false;
 }
 //___________________________________________________________________________
 KineGeneratorWithCache::~KineGeneratorWithCache()
@@ -62,6 +74,8 @@ double KineGeneratorWithCache::MaxXSec(GHepRecord * event_rec) const
   double xsec_max = -1;
   Interaction * interaction = event_rec->Summary();
 
+  fRjMonitor.NewEvent();
+
   LOG("Kinematics", pINFO)
                   << "Attempting to find a cached max{dxsec/dK} value";
   xsec_max = this->FindMaxXSec(interaction);
@@ -78,6 +92,16 @@ double KineGeneratorWithCache::MaxXSec(GHepRecord * event_rec) const
 
   LOG("Kinematics", pNOTICE)
             << "Can not generate event kinematics {K} (max_xsec({K};E)<=0)";
+  this->NoKinematics(event_rec, "kinematics generation: max_xsec({K};E)<=0");
+
+  return 0;
+}
+//___________________________________________________________________________
+void KineGeneratorWithCache::NoKinematics(
+                                    GHepRecord * event_rec, string reason) const
+{
+  Interaction * interaction = event_rec->Summary();
+
   // xsec for selected kinematics = 0
   event_rec->SetDiffXSec(0,kPSNull);
   // switch on error flag
@@ -87,11 +111,9 @@ double KineGeneratorWithCache::MaxXSec(GHepRecord * event_rec) const
   interaction->ResetBit(kISkipKinematicChk);
   // throw exception
   genie::exceptions::EVGThreadException exception;
-  exception.SetReason("kinematics generation: max_xsec({K};E)<=0");
+  exception.SetReason(reason);
   exception.SwitchOnFastForward();
   throw exception;
-
-  return 0;
 }
 //___________________________________________________________________________
 double KineGeneratorWithCache::FindMaxXSec(
@@ -113,27 +135,26 @@ double KineGeneratorWithCache::FindMaxXSec(
   // access the the cache branch
   CacheBranchFx * cb = this->AccessCacheBranch(interaction);
 
-  // if there are enough points stored in the cache buffer to build a
-  // spline, then intepolate
-  if( cb->Spl() ) {
-     if( E >= cb->Spl()->XMin() && E <= cb->Spl()->XMax()) {
-       double spl_max_xsec = cb->Spl()->Evaluate(E);
+  // if there are enough points stored in the cache buffer, then intepolate
+  // (the piecewise-linear envelope extends as points are added, no rebuild)
+  if( cb->NPoints() > 40 ) {
+     double max_xsec = 0;
+     if( cb->Interpolate(E, max_xsec) ) {
        LOG("Kinematics", pINFO)
-          << "\nInterpolated: max xsec (E=" << E << ") = " << spl_max_xsec;
-       return spl_max_xsec;
+          << "\nInterpolated: max xsec (E=" << E << ") = " << max_xsec;
+       return max_xsec;
      }
      LOG("Kinematics", pINFO)
-          << "Outside spline boundaries - Forcing explicit calculation";
+          << "Outside cached energy range - Forcing explicit calculation";
      return -1.;
   }
 
-  // if there are not enough points at the cache buffer to have a spline,
+  // if there are not enough points at the cache buffer to interpolate,
   // look whether there is another point that is sufficiently close
   double dE = TMath::Min(0.25, 0.05*E);
-  const map<double,double> & fmap = cb->Map();
-  map<double,double>::const_iterator iter = fmap.lower_bound(E);
-  if(iter != fmap.end()) {
-     if(TMath::Abs(E - iter->first) < dE) return iter->second;
+  double Ec = 0, xsec_c = 0;
+  if(cb->FindAbove(E, Ec, xsec_c)) {
+     if(TMath::Abs(E - Ec) < dE) return xsec_c;
   }
 
   return -1;
@@ -188,16 +209,6 @@ void KineGeneratorWithCache::CacheMaxXSec(
 
   double E = this->Energy(interaction);
   if(max_xsec>0) cb->AddValues(E,max_xsec);
-
-  if(! cb->Spl() ) {
-    if( cb->Map().size() > 40 ) cb->CreateSpline();
-  }
-
-  if( cb->Spl() ) {
-     if( E < cb->Spl()->XMin() || E > cb->Spl()->XMax() ) {
-        cb->CreateSpline();
-     }
-  }
 }
 //___________________________________________________________________________
 double KineGeneratorWithCache::Energy(const Interaction * interaction) const
@@ -216,9 +227,20 @@ CacheBranchFx * KineGeneratorWithCache::AccessCacheBranch(
 {
 // Returns the cache branch for this algorithm and this interaction. If no
 // branch is found then one is created.
+// Branches are looked up by their string key only once per interaction:
+// the handles are then kept, keyed by the interaction integer code, until
+// cache branches get removed.
 
   Cache * cache = Cache::Instance();
 
+  if(fCacheBranchesRevision != cache->Revision()) {
+    fCacheBranches.clear();
+    fCacheBranchesRevision = cache->Revision();
+  }
+  InteractionCode code = interaction->Code();
+  CacheBranchMap_t::const_iterator hiter = fCacheBranches.find(code);
+  if(hiter != fCacheBranches.end()) return hiter->second;
+
   // build the cache branch key as: namespace::algorithm/config/interaction
   string algkey = this->Id().Key();
   string intkey = interaction->AsString();
@@ -235,17 +257,206 @@ CacheBranchFx * KineGeneratorWithCache::AccessCacheBranch(
     cache->AddCacheBranch(key, cache_branch);
   }
   assert(cache_branch);
+  fCacheBranches[code] = cache_branch;
 
   return cache_branch;
 }
 //___________________________________________________________________________
+void KineGeneratorWithCache::PrecomputeMaxXSec(
+    const XSecAlgorithmI * xsec_model, const Interaction * interaction,
+    double Emin, double Emax, int nE) const
+{
+// Fills the cache branch for the input interaction with the max xsec at nE
+// log-spaced energies (struck nucleon at rest).
+// Energies below the minimum cached energy are skipped, as are energies
+// already in the cache.
+
+  fXSecModel = xsec_model;
+
+  Emin = TMath::Max(Emin, fEMin);
+  if(Emin >= Emax || nE < 2) return;
+
+  Interaction in(*interaction);
+  CacheBranchFx * cb = this->AccessCacheBranch(&in);
+
+  double logEmin = TMath::Log10(Emin);
+  double dlogE   = (TMath::Log10(Emax) - logEmin) / (nE-1);
+  int nadded = 0;
+  for(int i = 0; i < nE; i++) {
+    double E = TMath::Power(10., logEmin + i*dlogE);
+    in.InitStatePtr()->SetProbeE(E);
+    double Ecache = this->Energy(&in);
+    double Ec = 0, xsec_c = 0;
+    if(cb->FindAbove(Ecache, Ec, xsec_c) && Ec == Ecache) continue;
+    double max_xsec = this->ComputeMaxXSec(&in);
+    if(max_xsec > 0) {
+      cb->AddValues(Ecache, max_xsec);
+      nadded++;
+    }
+  }
+
+  LOG("Kinematics", pNOTICE)
+     << "Precomputed " << nadded << " max{dxsec/dK} values for "
+     << this->Id().Key() << " / " << in.AsString()
+     << " (" << cb->NPoints() << " cached values)";
+}
+//___________________________________________________________________________
+CacheBranchGrid * KineGeneratorWithCache::AdaptiveGrid(
+                                                GHepRecord * event_rec) const
+{
+  Interaction * interaction = event_rec->Summary();
+
+  fRjMonitor.NewEvent();
+
+  CacheBranchGrid * grid = this->AccessAdaptiveGrid(interaction);
+  if(!grid->IsTrained()) {
+    this->LearnAdaptiveGrid(grid, interaction);
+  }
+  if(grid->MaxWeight() <= 0) {
+    LOG("Kinematics", pNOTICE)
+      << "Can not generate event kinematics {K} (max_weight({K};E)<=0)";
+    this->NoKinematics(event_rec, "kinematics generation: max_weight({K};E)<=0");
+  }
+  return grid;
+}
+//___________________________________________________________________________
+double KineGeneratorWithCache::AdaptiveGridXSec(
+       const Interaction * /*in*/, double /*u*/, double /*v*/, double & jac) const
+{
+  LOG("Kinematics", pERROR)
+    << this->Id().Key() << " does not support adaptive sampling";
+  jac = 0;
+  return 0;
+}
+//___________________________________________________________________________
+CacheBranchGrid * KineGeneratorWithCache::AccessAdaptiveGrid(
+                                      const Interaction * interaction) const
+{
+// Returns the adaptive grid for this algorithm, this interaction and the
+// current energy bin (10 bins per decade). If none is found, a new (not yet
+// learnt) grid is created. Grids are cache branches, so they are saved in,
+// and restored from, the cache file along with the max xsec values.
+
+  Cache * cache = Cache::Instance();
+
+  if(fGridsRevision != cache->Revision()) {
+    fGrids.clear();
+    fGridsRevision = cache->Revision();
+  }
+
+  double E = this->Energy(interaction);
+  int ebin = (int) TMath::Floor(10. * TMath::Log10(E));
+
+  std::map<int, CacheBranchGrid *> & grids = fGrids[interaction->Code()];
+  std::map<int, CacheBranchGrid *>::const_iterator giter = grids.find(ebin);
+  if(giter != grids.end()) return giter->second;
+
+  ostringstream binkey;
+  binkey << "adaptive-grid/e-bin:" << ebin;
+  string key = cache->CacheBranchKey(
+                  this->Id().Key(), interaction->AsString(), binkey.str());
+
+  CacheBranchGrid * grid =
+              dynamic_cast<CacheBranchGrid *> (cache->FindCacheBranch(key));
+  if(!grid) {
+    LOG("Kinematics", pINFO) << "Creating adaptive grid - key = " << key;
+    grid = new CacheBranchGrid(
+                  "adaptive d^nXSec/d^n{K} proposal grid", fAdaptiveGridNBins);
+    cache->AddCacheBranch(key, grid);
+  }
+  grids[ebin] = grid;
+
+  return grid;
+}
+//___________________________________________________________________________
+void KineGeneratorWithCache::LearnAdaptiveGrid(
+         CacheBranchGrid * grid, const Interaction * interaction) const
+{
+// Refines the grid over a few iterations of points sampled from it, then
+// estimates the max weight (scaled up by the safety factor) with a last
+// batch of points.
+
+  RandomGen * rnd = RandomGen::Instance();
+
+  for(int it = 0; it < fAdaptiveGridNIter; it++) {
+    for(int i = 0; i < fAdaptiveGridNPoints; i++) {
+      double u = 0, v = 0, jac = 0;
+      double g = grid->Generate(
+                   rnd->RndKine().Rndm(), rnd->RndKine().Rndm(), u, v);
+      double xsec = this->AdaptiveGridXSec(interaction, u, v, jac);
+      if(xsec > 0) grid->Fill(u, v, xsec*jac/g);
+    }
+    grid->Refine();
+  }
+
+  double wmax = 0;
+  for(int i = 0; i < fAdaptiveGridNPoints; i++) {
+    double u = 0, v = 0, jac = 0;
+    double g = grid->Generate(
+                 rnd->RndKine().Rndm(), rnd->RndKine().Rndm(), u, v);
+    double xsec = this->AdaptiveGridXSec(interaction, u, v, jac);
+    wmax = TMath::Max(wmax, xsec*jac/g);
+  }
+  grid->SetMaxWeight(fSafetyFactor * wmax);
+  grid->SetTrained(true);
+
+  LOG("Kinematics", pNOTICE)
+     << "Learnt adaptive grid for " << interaction->AsString()
+     << " at E = " << this->Energy(interaction)
+     << ": max weight = " << grid->MaxWeight();
+}
+//___________________________________________________________________________
+void KineGeneratorWithCache::LoadAdaptiveSamplingConfig(void)
+{
+  this->GetParamDef("AdaptiveSampling",            fUseAdaptiveGrid,     false);
+  this->GetParamDef("AdaptiveSampling-NBins",      fAdaptiveGridNBins,   50   );
+  this->GetParamDef("AdaptiveSampling-NIterations",fAdaptiveGridNIter,   5    );
+  this->GetParamDef("AdaptiveSampling-NPoints",    fAdaptiveGridNPoints, 2000 );
+}
+//___________________________________________________________________________
+const XSecAlgorithmI * KineGeneratorWithCache::WorkerXSecModel(
+                                                  unsigned int worker) const
+{
+  if(worker == 0) return fXSecModel;
+
+  // algorithm instances are per-thread (see AlgFactory)
+  const XSecAlgorithmI * xsec_model = dynamic_cast<const XSecAlgorithmI *> (
+           AlgFactory::Instance()->GetAlgorithm(fXSecModel->Id()));
+  assert(xsec_model);
+  return xsec_model;
+}
+//___________________________________________________________________________
+const Interaction * KineGeneratorWithCache::WorkerInteraction(
+    const Interaction * interaction, unsigned int worker,
+    std::unique_ptr<Interaction> & copy) const
+{
+  if(worker == 0) return interaction;
+
+  // the copy constructor doesn't copy the bits telling the xsec algorithms
+  // which checks / corrections to skip
+  const UInt_t mask = kISkipProcessChk | kISkipKinematicChk |
+                      kIAssumeFreeNucleon | kIAssumeFreeElectron |
+                      kINoNuclearCorrection;
+  copy.reset(new Interaction(*interaction));
+  copy->SetBit(interaction->TestBits(mask));
+  return copy.get();
+}
+//___________________________________________________________________________
+void KineGeneratorWithCache::RecordAccepted(
+                   const Interaction * interaction, unsigned int ntries) const
+{
+  fRjMonitor.Accepted(interaction, ntries);
+}
+//___________________________________________________________________________
 void KineGeneratorWithCache::AssertXSecLimits(
          const Interaction * interaction, double xsec, double xsec_max) const
 {
   // check the computed cross section for the current kinematics against the
   // maximum cross section used in the rejection MC method for the current
   // interaction at the current energy.
+  fRjMonitor.CountXSecEval();
   if(xsec>xsec_max) {
+    fRjMonitor.CountViolation(interaction);
     double f = 200*(xsec-xsec_max)/(xsec_max+xsec);
     if(f>fMaxXSecDiffTolerance) {
        LOG("Kinematics", pFATAL)
@@ -255,11 +466,13 @@ void KineGeneratorWithCache::AssertXSecLimits(
  	  << "*** Exceeding estimated maximum differential cross section";
        exit(1);
     } else {
-       LOG("Kinematics", pWARN)
+       LOG("Kinematics", pINFO)
     	  << "xsec: (curr) = " << xsec
       	         << " > (max) = " << xsec_max << "\n for " << *interaction;
-       LOG("Kinematics", pWARN)
+       LOG("Kinematics", pINFO)
   	    << "*** The fractional deviation of " << f << " % was allowed";
+       RunCounters::Instance()->Fill(
+          "Kinematics: allowed max xsec deviation (%) - " + this->Id().Name(), f);
     }
   }
 
@@ -13,6 +13,10 @@
           method for computing the maximum xsec in case it has not already
           being pushed into the cache at a previous iteration.
 
+          The cached max xsec envelopes can also be precomputed over the
+          full energy range (see PrecomputeMaxXSec()) and saved in the
+          cache file given to the GENIE apps with --cache-file.
+
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -27,20 +31,33 @@
 #define _KINE_GENERATOR_WITH_CACHE_H_
 
 #include <string>
+#include <map>
+#include <memory>
+#include <unordered_map>
 
 #include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Framework/EventGen/EventRecordVisitorI.h"
 #include "Framework/Utils/Range1.h"
+#include "Framework/Utils/RejectionMonitor.h"
 
 using std::string;
 
 namespace genie {
 
 class CacheBranchFx;
+class CacheBranchGrid;
 class XSecAlgorithmI;
 
 class KineGeneratorWithCache : public EventRecordVisitorI {
 
+public:
+  //! Computes the max xsec for the input interaction and xsec model at nE
+  //! (log-spaced) energies in [Emin, Emax] and stores the envelope in the
+  //! cache, so that it needn't be computed during event generation.
+  //! Used by gmkspl (see its --max-xsec-envelopes option).
+  virtual void PrecomputeMaxXSec (const XSecAlgorithmI * xsec_model,
+           const Interaction * in, double Emin, double Emax, int nE) const;
+
 protected:
   KineGeneratorWithCache();
   KineGeneratorWithCache(string name);
@@ -57,12 +74,62 @@ protected:
 
   virtual void AssertXSecLimits (const Interaction * in, double xsec, double xsec_max) const;
 
+  //! Adaptive importance sampling (opt-in through the AdaptiveSampling
+  //! config param): Returns the proposal grid for the event interaction at
+  //! the current energy, learning it at the first call. Sample (u,v) from
+  //! the grid and unweight with w = xsec * jacobian / g against the grid
+  //! max weight.
+  virtual CacheBranchGrid * AdaptiveGrid (GHepRecord * evrec) const;
+
+  //! Sets the kinematics of the input interaction for the point (u,v) of
+  //! the unit square and returns the differential xsec there. The jacobian
+  //! of the (u,v) -> kinematics map is returned in jac. Must be overriden
+  //! by generators using adaptive sampling.
+  virtual double AdaptiveGridXSec (const Interaction * in,
+                                   double u, double v, double & jac) const;
+
+  //! Reads the AdaptiveSampling* config params
+  void LoadAdaptiveSamplingConfig (void);
+
+  //! For max xsec scans spread over the ThreadPool: The xsec model and the
+  //! interaction a loop body must use when run by the input worker. Worker
+  //! 0 (the calling thread) uses the generator's own; other workers use
+  //! their thread's instance of the xsec model and a copy of the input
+  //! interaction (kept in copy).
+  const XSecAlgorithmI * WorkerXSecModel   (unsigned int worker) const;
+  const Interaction *    WorkerInteraction (const Interaction * in,
+            unsigned int worker, std::unique_ptr<Interaction> & copy) const;
+
+  //! Call when the accept/reject loop accepted kinematics after ntries tries
+  //! (feeds the rejection efficiency summaries, see RejectionMonitor)
+  void RecordAccepted (const Interaction * in, unsigned int ntries) const;
+
   mutable const XSecAlgorithmI * fXSecModel;
 
   double fSafetyFactor;         ///< maxxsec -> maxxsec * safety_factor
   double fMaxXSecDiffTolerance; ///< max{100*(xsec-maxxsec)/.5*(xsec+maxxsec)} if xsec>maxxsec
   double fEMin;                 ///< min E for which maxxsec is cached - forcing explicit calc.
   bool   fGenerateUniformly;    ///< uniform over allowed phase space + event weight?
+  bool   fUseAdaptiveGrid;      ///< sample from a learnt adaptive grid, in place of flat rejection?
+  int    fAdaptiveGridNBins;    ///< adaptive grid bins per kinematic variable
+  int    fAdaptiveGridNIter;    ///< adaptive grid learning iterations
+  int    fAdaptiveGridNPoints;  ///< xsec evaluations per adaptive grid learning iteration
+
+private:
+  CacheBranchGrid * AccessAdaptiveGrid (const Interaction * in) const;
+  void              LearnAdaptiveGrid  (CacheBranchGrid * grid, const Interaction * in) const;
+  void              NoKinematics       (GHepRecord * evrec, string reason) const;
+
+  typedef std::unordered_map<InteractionCode, CacheBranchFx *,
+                             InteractionCode::Hash> CacheBranchMap_t;
+  typedef std::unordered_map<InteractionCode, std::map<int, CacheBranchGrid *>,
+                             InteractionCode::Hash> GridMap_t;
+
+  mutable CacheBranchMap_t fCacheBranches;        ///< cache branch handles, keyed by interaction code
+  mutable long             fCacheBranchesRevision; ///< Cache revision the handles were looked up at
+  mutable RejectionMonitor fRjMonitor;             ///< accept/reject loop efficiency monitor
+  mutable GridMap_t        fGrids;                 ///< adaptive grid handles, keyed by interaction code and energy bin
+  mutable long             fGridsRevision;         ///< Cache revision the grid handles were looked up at
 };
 
 }      // genie namespace
@@ -8,12 +8,13 @@
 */
 //____________________________________________________________________________
 
+#include <algorithm>
+
 #include <TMath.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
 #include "Framework/Conventions/Constants.h"
 #include "Framework/Conventions/Controls.h"
-#include "Framework/EventGen/EVGThreadException.h"
 #include "Physics/Common/VertexGenerator.h"
 #include "Framework/GHEP/GHepStatus.h"
 #include "Framework/GHEP/GHepParticle.h"
@@ -23,6 +24,7 @@
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Physics/NuclearState/NuclearDensityProfile.h"
 #include "Physics/NuclearState/NuclearUtils.h"
 
 using namespace genie;
@@ -30,6 +32,11 @@ using namespace genie::utils;
 using namespace genie::controls;
 using namespace genie::constants;
 
+namespace {
+  // number of radial bins of the realistic density tables (R/400 wide)
+  const int kNRadialBins = 1200;
+}
+
 //___________________________________________________________________________
 VertexGenerator::VertexGenerator() :
 EventRecordVisitorI("genie::VertexGenerator")
@@ -93,6 +100,8 @@ void VertexGenerator::LoadConfig(void)
   GetParam( "VtxGenerationMethod", fVtxGenMethod ) ;
   GetParam( "NUCL-R0",             fR0 ) ;  //fm
 
+  // the radial tables depend on R0
+  fRadialCDF.clear();
 }
 //____________________________________________________________________________
 TVector3 VertexGenerator::GenerateVertex(const Interaction * interaction,
@@ -142,52 +151,24 @@ TVector3 VertexGenerator::GenerateVertex(const Interaction * interaction,
       //
       LOG("Vtx", pINFO)
 	<< "Generating vertex according to a realistic nuclear density profile";
-      // get inputs to the rejection method
-      double ymax = -1;
+      // invert the (tabulated) cumulative distribution of r^2 rho(r)
+      const vector<double> & cdf = this->RadialCDF((int)A, R);
       double rmax = 3*R;
-      double dr   = R/40.;
-      for(double r = 0; r < rmax; r+=dr) {
-	ymax = TMath::Max(ymax, r*r * utils::nuclear::Density(r,(int)A));
-      }
-      ymax *= 1.2;
-
-      // select a vertex using the rejection method
-      unsigned int iter = 0;
-      while(1) {
-	iter++;
-
-	// throw an exception if it hasn't find a solution after many attempts
-	if(iter > kRjMaxIterations) {
-	  LOG("Vtx", pWARN)
-	    << "Couldn't generate a vertex position after " << iter << " iterations";
-	  //evrec->EventFlags()->SetBitNumber(kGenericErr, true);
-	  genie::exceptions::EVGThreadException exception;
-	  exception.SetReason("Couldn't generate vertex");
-	  exception.SwitchOnFastForward();
-	  throw exception;
-	}
-
-	double r = rmax * rnd->RndFsi().Rndm();
-	double t = ymax * rnd->RndFsi().Rndm();
-	double y = r*r * utils::nuclear::Density(r,(int)A);
-	if(y > ymax) {
-	  LOG("Vtx", pERROR)
-	    << "y = " << y << " > ymax = " << ymax
-	    << " for r = " << r << ", A = " << A;
-	}
-	bool accept = (t < y);
-	if(accept) {
-	  double phi      = 2*kPi * rnd->RndFsi().Rndm();
-	  double cosphi   = TMath::Cos(phi);
-	  double sinphi   = TMath::Sin(phi);
-	  double costheta = -1 + 2 * rnd->RndFsi().Rndm();
-	  double sintheta = TMath::Sqrt(1-costheta*costheta);
-	  vtx.SetX(r*sintheta*cosphi);
-	  vtx.SetY(r*sintheta*sinphi);
-	  vtx.SetZ(r*costheta);
-	  break;
-	}
-      }//w(1)
+      double u    = rnd->RndFsi().Rndm();
+      int    ibin = std::upper_bound(cdf.begin(), cdf.end(), u) - cdf.begin() - 1;
+      ibin = TMath::Min(TMath::Max(ibin, 0), kNRadialBins-1);
+      double dcdf = cdf[ibin+1] - cdf[ibin];
+      double f    = (dcdf > 0) ? (u - cdf[ibin]) / dcdf : 0.;
+      double r    = rmax * (ibin + f) / kNRadialBins;
+
+      double phi      = 2*kPi * rnd->RndFsi().Rndm();
+      double cosphi   = TMath::Cos(phi);
+      double sinphi   = TMath::Sin(phi);
+      double costheta = -1 + 2 * rnd->RndFsi().Rndm();
+      double sintheta = TMath::Sqrt(1-costheta*costheta);
+      vtx.SetX(r*sintheta*cosphi);
+      vtx.SetY(r*sintheta*sinphi);
+      vtx.SetZ(r*costheta);
     } //use density?
 
     if(uniform) {
@@ -210,3 +191,32 @@ TVector3 VertexGenerator::GenerateVertex(const Interaction * interaction,
     << print::Vec3AsString(&vtx);
   return vtx;
 }
+//___________________________________________________________________________
+const vector<double> & VertexGenerator::RadialCDF(int A, double R) const
+{
+  std::map<int, vector<double> >::const_iterator it = fRadialCDF.find(A);
+  if(it != fRadialCDF.end()) return it->second;
+
+  LOG("Vtx", pNOTICE)
+    << "Tabulating the radial vertex distribution for A = " << A;
+
+  // trapezoidal integration of r^2 rho(r) in [0, 3R]
+  const NuclearDensityProfile * density = NuclearDensityProfile::Instance(A);
+  vector<double> & cdf = fRadialCDF[A];
+  cdf.resize(kNRadialBins+1);
+  double dr    = 3*R / kNRadialBins;
+  double yprev = 0.;
+  cdf[0] = 0.;
+  for(int i = 1; i <= kNRadialBins; i++) {
+    double r = i*dr;
+    double y = r*r * density->Density(r);
+    cdf[i] = cdf[i-1] + 0.5*(y + yprev)*dr;
+    yprev  = y;
+  }
+  double norm = cdf[kNRadialBins];
+  for(int i = 1; i <= kNRadialBins; i++) {
+    cdf[i] = (norm > 0) ? cdf[i]/norm : double(i)/kNRadialBins;
+  }
+  return cdf;
+}
+//___________________________________________________________________________
@@ -18,6 +18,9 @@
 #ifndef _VERTEX_GENERATOR_H_
 #define _VERTEX_GENERATOR_H_
 
+#include <map>
+#include <vector>
+
 #include "Framework/EventGen/EventRecordVisitorI.h"
 #include "Framework/GHEP/GHepParticle.h"
 #include "Framework/Interaction/Interaction.h"
@@ -46,8 +49,14 @@ public :
 private:
   void  LoadConfig (void);
 
+  //-- Cumulative distribution of r^2 rho(r) in [0,3R] for the input mass
+  //   number, normalized to 1 (built at its first use)
+  const std::vector<double> & RadialCDF (int A, double R) const;
+
   int    fVtxGenMethod; ///< vtx generation method (0: uniform, 1: according to nuclear density [def])
   double fR0;           ///< parameter controlling nuclear sizes
+
+  mutable std::map<int, std::vector<double> > fRadialCDF; ///< radial CDF tables, by mass number
 };
 
 }      // genie namespace
@@ -10,6 +10,7 @@
 #include <cmath>
 
 #include <cmath>
+#include <algorithm>
 
 #include <TClonesArray.h>
 #include <TDecayChannel.h>
@@ -37,6 +38,30 @@
 using namespace genie;
 using namespace genie::controls;
 using namespace genie::constants;
+
+namespace {
+  // W range and spacing of the tabulated W-evolved decay widths
+  const double kEvolvedBRWMax = 5.0;
+  const double kEvolvedBRDW   = 0.001;
+
+  // Solves cdf(x) = y in [lo, hi] for a non-decreasing cdf of derivative
+  // pdf, with Newton steps safeguarded by bisection
+  template<class CDF, class PDF>
+  double InvertCDF(const CDF & cdf, const PDF & pdf, double y, double lo, double hi)
+  {
+    double x = 0.5 * (lo + hi);
+    for ( int i = 0; i < 100; i++ ) {
+      double r = cdf(x) - y;
+      if ( r > 0 ) hi = x; else lo = x;
+      if ( hi - lo < 1E-12 ) break;
+      double d  = pdf(x);
+      double xn = ( d > 0 ) ? x - r / d : lo - 1.;
+      x = ( xn > lo && xn < hi ) ? xn : 0.5 * (lo + hi);
+      if ( TMath::Abs(r) < 1E-13 ) break;
+    }
+    return x;
+  }
+}
 //____________________________________________________________________________
 BaryonResonanceDecayer::BaryonResonanceDecayer() :
 Decayer("genie::BaryonResonanceDecayer")
@@ -80,8 +105,7 @@ void BaryonResonanceDecayer::ProcessEventRecord(GHepRecord * event) const
 
     //    std::cout << "Decaing particle " << ipos << " with PDG " << pdg_code << std::endl ; 
 
-    if(!this->IsHandled  (pdg_code)) continue;
-    if(!this->ToBeDecayed(pdg_code, status_code)) continue;
+    if(!this->ShouldDecay(pdg_code, status_code)) continue;
 
     LOG("ResonanceDecay", pNOTICE)
           << "Decaying unstable particle: " << p->Name();
@@ -121,11 +145,9 @@ bool BaryonResonanceDecayer::Decay(
     return false;
   }
 
-  bool to_be_deleted ; 
-
   // Select a decay channel
   TDecayChannel * selected_decay_channel =
-    this->SelectDecayChannel(decay_particle_id, event, to_be_deleted ) ;
+    this->SelectDecayChannel(decay_particle_id, event) ;
 
   if(!selected_decay_channel) {
     LOG("ResonanceDecay", pERROR)
@@ -139,9 +161,6 @@ bool BaryonResonanceDecayer::Decay(
   // Decay the exclusive state and copy daughters in the event record
   bool decayed = this->DecayExclusive(decay_particle_id, event, selected_decay_channel);
 
-  if ( to_be_deleted ) 
-    delete selected_decay_channel ; 
-
   if ( ! decayed ) return false ;
 
   // Update the event weight for each weighted particle decay
@@ -155,8 +174,7 @@ bool BaryonResonanceDecayer::Decay(
 }
 //____________________________________________________________________________
 TDecayChannel * BaryonResonanceDecayer::SelectDecayChannel( int decay_particle_id, 
-							    GHepRecord * event, 
-							    bool & to_be_deleted ) const
+							    GHepRecord * event ) const
 {
   // Get particle to be decayed
   GHepParticle * decay_particle = event->Particle(decay_particle_id);
@@ -185,46 +203,54 @@ TDecayChannel * BaryonResonanceDecayer::SelectDecayChannel( int decay_particle_i
   LOG("ResonanceDecay", pINFO) << "Available mass W = " << W;
 
   // Get all decay channels
-  TObjArray * original_decay_list = mother->DecayList();
+  const ChannelTable & table = this->Channels(decay_particle_pdg_code);
 
-  unsigned int nch = original_decay_list -> GetEntries();
+  unsigned int nch = table.fChannels.size();
   LOG("ResonanceDecay", pINFO)
     << mother->GetName() << " has: " << nch << " decay channels";
 
   // Loop over the decay channels (dc) and write down the branching
   // ratios to be used for selecting a decay channel.
   // Since a baryon resonance can be created at W < Mres, explicitly
-  // check and inhibit decay channels for which W > final-state-mass
+  // check and inhibit decay channels for which W > final-state-mass.
+  // For resonances with W-evolved BRs, the channel widths are interpolated
+  // in the tabulated ones (or computed, out of the table)
 
-  bool has_evolved_brs = BaryonResonanceDecayer::HasEvolvedBRs( decay_particle_pdg_code ) ; 
-  
-  TObjArray * actual_decay_list = nullptr ;
+  bool has_evolved_brs = (table.fNW > 0);
 
+  double tw  = 0.;
+  int    iw  = 0;
+  bool   tabulated = false;
   if ( has_evolved_brs ) {
-    actual_decay_list = EvolveDeltaBR( decay_particle_pdg_code, original_decay_list, W ) ;
-    if ( ! actual_decay_list ) return nullptr ;
-    nch = actual_decay_list -> GetEntries() ;
-    to_be_deleted = true ;
-  }
-  else {
-    actual_decay_list = original_decay_list ;
-    to_be_deleted = false ;
+    double t = (W - table.fWMin) / table.fDW;
+    iw = TMath::Max( 0, TMath::Min( (int) t, table.fNW - 2 ) );
+    tw = t - iw;
+    tabulated = (t >= 0 && t <= table.fNW - 1);
   }
 
-  double BR[nch], tot_BR = 0;
+  fCumBR.resize(nch);
+  double tot_BR = 0;
 
   for(unsigned int ich = 0; ich < nch; ich++) {
 
-    TDecayChannel * ch = (TDecayChannel *) actual_decay_list -> At(ich);
-
-    double fsmass = this->FinalStateMass(ch) ;
+    double fsmass = table.fFSMass[ich] ;
     if ( fsmass < W ) {
 
       SLOG("ResonanceDecay", pDEBUG)
                 << "Using channel: " << ich
                 << " with final state mass = " << fsmass << " GeV";
 
-      tot_BR += ch->BranchingRatio();
+      if ( ! has_evolved_brs ) {
+        tot_BR += table.fBR[ich];
+      }
+      else if ( tabulated ) {
+        tot_BR += (1-tw) * table.fWidths[ iw   *nch + ich] +
+                     tw  * table.fWidths[(iw+1)*nch + ich];
+      }
+      else {
+        tot_BR += EvolveDeltaDecayWidth(
+                     decay_particle_pdg_code, table.fChannels[ich], W ) ;
+      }
 
     } else {
       SLOG("ResonanceDecay", pINFO)
@@ -232,7 +258,7 @@ TDecayChannel * BaryonResonanceDecayer::SelectDecayChannel( int decay_particle_i
                 << " with final state mass = " << fsmass << " GeV";
     } // final state mass
 
-    BR[ich] = tot_BR;
+    fCumBR[ich] = tot_BR;
   }//channel loop
 
   if( tot_BR <= 0. ) {
@@ -242,29 +268,65 @@ TDecayChannel * BaryonResonanceDecayer::SelectDecayChannel( int decay_particle_i
   }
 
   // Select a resonance based on the branching ratios
-  unsigned int ich = 0, sel_ich; // id of selected decay channel
   RandomGen * rnd = RandomGen::Instance();
   double x = tot_BR * rnd->RndDec().Rndm();
-  do {
-    sel_ich = ich;
-  } while (x > BR[ich++]);
+  unsigned int sel_ich = std::lower_bound(fCumBR.begin(), fCumBR.end(), x) - fCumBR.begin();
+  sel_ich = TMath::Min(sel_ich, nch-1);
 
-  TDecayChannel * sel_ch = (TDecayChannel *) actual_decay_list -> At(sel_ich);
+  TDecayChannel * sel_ch = table.fChannels[sel_ich];
 
+  double sel_BR = fCumBR[sel_ich] - ( (sel_ich > 0) ? fCumBR[sel_ich-1] : 0. );
   LOG("ResonanceDecay", pINFO)
     << "Selected " << sel_ch->NDaughters() << "-particle decay channel ("
-    << sel_ich << ") has BR = " << sel_ch->BranchingRatio();
+    << sel_ich << ") has BR = " << sel_BR / tot_BR;
 
-  if ( has_evolved_brs ) {
+  return sel_ch;
+}
+//____________________________________________________________________________
+const BaryonResonanceDecayer::ChannelTable &
+  BaryonResonanceDecayer::Channels(int dec_part_pdgc) const
+{
+  std::map<int, ChannelTable>::const_iterator it = fChannelTables.find(dec_part_pdgc);
+  if ( it != fChannelTables.end() ) return it->second;
 
-    for ( unsigned int i = 0; i < nch; ++i) {
-      if ( sel_ich != i ) delete actual_decay_list -> At(i);
-    }
+  ChannelTable & table = fChannelTables[dec_part_pdgc];
+
+  TParticlePDG * mother = PDGLibrary::Instance()->Find(dec_part_pdgc);
+  TObjArray * decay_list = mother->DecayList();
+  unsigned int nch = (decay_list) ? decay_list -> GetEntries() : 0;
 
-    delete actual_decay_list ;
+  double wmin = kEvolvedBRWMax;
+  for(unsigned int ich = 0; ich < nch; ich++) {
+    TDecayChannel * ch = (TDecayChannel *) decay_list -> At(ich);
+    table.fChannels.push_back( ch );
+    table.fFSMass  .push_back( this->FinalStateMass(ch) );
+    table.fBR      .push_back( ch->BranchingRatio() );
+    wmin = TMath::Min( wmin, table.fFSMass.back() );
   }
 
-  return sel_ch;
+  table.fNW   = 0;
+  table.fWMin = wmin;
+  table.fDW   = kEvolvedBRDW;
+
+  if ( nch > 0 && BaryonResonanceDecayer::HasEvolvedBRs( dec_part_pdgc ) &&
+       wmin + kEvolvedBRDW < kEvolvedBRWMax ) {
+
+    table.fNW = 1 + (int) ( (kEvolvedBRWMax - wmin) / kEvolvedBRDW );
+    table.fWidths.resize( table.fNW * nch );
+    for ( int iw = 0; iw < table.fNW; iw++ ) {
+      double W = wmin + iw * kEvolvedBRDW;
+      for ( unsigned int ich = 0; ich < nch; ich++ ) {
+        table.fWidths[iw*nch + ich] =
+          EvolveDeltaDecayWidth( dec_part_pdgc, table.fChannels[ich], W );
+      }
+    }
+    LOG("ResonanceDecay", pINFO)
+      << "Tabulated the W-evolved decay widths of " << mother->GetName()
+      << " at " << table.fNW << " W nodes in [" << wmin << ", "
+      << wmin + (table.fNW-1) * kEvolvedBRDW << "] GeV";
+  }
+
+  return table;
 }
 //____________________________________________________________________________
 bool BaryonResonanceDecayer::DecayExclusive(
@@ -311,92 +373,20 @@ bool BaryonResonanceDecayer::DecayExclusive(
   // Decay the resonance using an N-body phase space generator
   // The particle will be decayed in its rest frame and then the daughters
   // will be boosted back to the original frame.
+  // We don't want the decay Delta -> Pi + N to be isotropic in the Delta
+  // reference frame: for un-weighted decays, the pion direction is then
+  // directly generated from the pion angular distribution W(Theta, Phi).
 
-  bool is_permitted = fPhaseSpaceGenerator.SetDecay(decay_particle_p4, nd, mass);
-  if ( ! is_permitted ) return false ;
+  bool direct_decay = is_delta_N_Pi_decay && ! fGenerateWeighted ;
+  TLorentzVector direct_p4[2] ;
 
-  // Find the maximum phase space decay weight
-  // double wmax = fPhaseSpaceGenerator.GetWtMax();
-  double wmax = -1;
-  for(int i=0; i<50; i++) {
-     double w = fPhaseSpaceGenerator.Generate();
-     wmax = TMath::Max(wmax,w);
+  if ( direct_decay ) {
+    if ( decay_particle_p4.M() <= mass[0] + mass[1] ) return false ;
+    this -> GenerateDeltaNPiDecay( decay_particle_id, event, ch, mass, direct_p4 ) ;
   }
-  assert(wmax>0);
-  LOG("ResonanceDecay", pINFO)
-    << "Max phase space gen. weight for current decay: " << wmax;
-
-  if(fGenerateWeighted)
-  {
-    // Generating weighted decays
-    // Do a single draw of momentum 4-vectors and then stop,
-    // taking into account the weight for this particular draw
-    double w = fPhaseSpaceGenerator.Generate();
-    fWeight *= TMath::Max(w/wmax, 1.);
+  else {
+    if ( ! this -> GeneratePhaseSpaceDecay( decay_particle_p4, nd, mass ) ) return false ;
   }
-  else
-  {
-    // Generating un-weighted decays
-    RandomGen * rnd = RandomGen::Instance();
-    wmax *= 2;
-    bool accept_decay=false;
-    unsigned int itry=0;
-
-    while(!accept_decay)
-    {
-      itry++;
-      assert(itry<kMaxUnweightDecayIterations);
-
-      double w  = fPhaseSpaceGenerator.Generate();
-      double gw = wmax * rnd->RndDec().Rndm();
-
-      if(w>wmax) {
-         LOG("ResonanceDecay", pWARN)
-            << "Current decay weight = " << w << " > wmax = " << wmax;
-      }
-      LOG("ResonanceDecay", pINFO)
-        << "Current decay weight = " << w << " / R = " << gw;
-
-      accept_decay = (gw<=w);
-
-      // Extra logic that applies only for Delta -> N + pi
-      if( accept_decay && is_delta_N_Pi_decay ) {
-
-        // We don't want the decay Delta -> Pi + N to be isotropic in the Delta referemce frame
-        // as generated by the simple phase space generator.
-        // In order to sample pion distribution according to W(Theta, phi) in the Delta resonance decay,
-        // we make use of the following.
-    	// Note that Theta and Phi are defined in a reference frame which depends on the whole event
-        // For each event generated from a Delta -> N + Pi event with Pi emitted at
-        // at angles Theta and Phi (in the Delta rest frame), attach a random number to it.
-        // then we calculate W(Theta, Phi).
-        // Each possible final state is used to evaluate (Theta, Phi),
-        // then a random number is thrown, if the the random number is higher than W(Theta, Phi) drop this event and go
-        // back to re-generate an event and repeat the procedure.
-        // Otherwise keep this event to the record.
-    	// For efficiency reasons the maxium of the function is Q2 dependent
-
-        // Locate the pion in the decay products
-        // at this point we already know that the pion is unique so the first pion we find is our pion
-        unsigned int pi_id = 0 ;
-
-        for(unsigned int iparticle = 0; iparticle < nd; iparticle++) {
-
-          if ( genie::pdg::IsPion( ch->DaughterPdgCode(iparticle) ) ) {
-            pi_id = iparticle ;
-            break ;
-          }
-        }//iparticle
-
-        TLorentzVector * lab_pion = fPhaseSpaceGenerator.GetDecay(pi_id);
-
-        accept_decay = AcceptPionDecay( *lab_pion, decay_particle_id, event) ;
-
-      } //if it is a Delta -> N + Pi
-
-    }//accept_decay
-
-  }//fGenerateWeighted
 
   // A decay was generated - Copy to the event record
 
@@ -411,7 +401,8 @@ bool BaryonResonanceDecayer::DecayExclusive(
 
      int daughter_pdg_code = pdgc[id];
 
-     TLorentzVector * daughter_p4 = fPhaseSpaceGenerator.GetDecay(id);
+     TLorentzVector * daughter_p4 = (direct_decay) ?
+        & direct_p4[id] : fPhaseSpaceGenerator.GetDecay(id);
      LOG("ResonanceDecay", pDEBUG)
         << "Adding daughter particle with PDG code = " << pdgc[id]
         << " and mass = " << mass[id] << " GeV";
@@ -429,57 +420,6 @@ bool BaryonResonanceDecayer::DecayExclusive(
 
   return true ;
 }
-//__________________________________________________________________________________
-TObjArray *  BaryonResonanceDecayer::EvolveDeltaBR(int dec_part_pdgc, TObjArray * decay_list, double W) const {
-
-  unsigned int nch = decay_list -> GetEntries();
-
-  std::vector<double> widths( nch, 0. ) ;
-  double tot = 0. ;
-
-  TDecayChannel * temp = nullptr ;
-
-  for ( unsigned int i = 0 ; i < nch ; ++i ) {
-
-    temp = (TDecayChannel*) decay_list -> At(i) ;
-    tot += widths[i] = EvolveDeltaDecayWidth(dec_part_pdgc, temp, W ) ;
-
-  }
-
-  if ( tot <= 0. ) return nullptr ;
-
-  TObjArray * new_list = new TObjArray() ;
-
-  TDecayChannel * update = nullptr ;
-
-  for ( unsigned int i = 0 ; i < nch ; ++i ) {
-
-    if ( widths[i] <= 0. ) continue ;
-
-    temp = (TDecayChannel*) decay_list -> At(i) ;
-
-    unsigned int nd = temp -> NDaughters() ;
-    std::vector<Int_t> ds( nd, 0 ) ;
-    for ( unsigned int d = 0 ; d < nd; ++d ) {
-      ds[d] = temp -> DaughterPdgCode(d) ;
-    }
-
-    update = new TDecayChannel(
-        temp -> Number(),
-        temp -> MatrixElementCode(),
-        widths[i] / tot,
-        nd,
-        & ds[0]
-        ) ;
-
-    new_list -> Add( update ) ;
-  }
-
-  new_list -> SetOwner(kFALSE);
-
-  return new_list ;
-}
-
 //____________________________________________________________________________
 double BaryonResonanceDecayer::EvolveDeltaDecayWidth(int dec_part_pdgc, TDecayChannel * ch, double W) const {
 
@@ -591,23 +531,85 @@ double BaryonResonanceDecayer::EvolveDeltaDecayWidth(int dec_part_pdgc, TDecayCh
 
 }
 //____________________________________________________________________________
-bool BaryonResonanceDecayer::AcceptPionDecay( TLorentzVector pion,
-					      int dec_part_id,
-					      const GHepRecord * event ) const {
+bool BaryonResonanceDecayer::GeneratePhaseSpaceDecay(
+  const TLorentzVector & p4, unsigned int nd, double * mass) const
+{
+  bool is_permitted = fPhaseSpaceGenerator.SetDecay(
+                        const_cast<TLorentzVector &>(p4), nd, mass);
+  if ( ! is_permitted ) return false ;
+
+  // Find the maximum phase space decay weight
+  // double wmax = fPhaseSpaceGenerator.GetWtMax();
+  double wmax = -1;
+  for(int i=0; i<50; i++) {
+     double w = fPhaseSpaceGenerator.Generate();
+     wmax = TMath::Max(wmax,w);
+  }
+  assert(wmax>0);
+  LOG("ResonanceDecay", pINFO)
+    << "Max phase space gen. weight for current decay: " << wmax;
+
+  if(fGenerateWeighted)
+  {
+    // Generating weighted decays
+    // Do a single draw of momentum 4-vectors and then stop,
+    // taking into account the weight for this particular draw
+    double w = fPhaseSpaceGenerator.Generate();
+    fWeight *= TMath::Max(w/wmax, 1.);
+  }
+  else
+  {
+    // Generating un-weighted decays
+    RandomGen * rnd = RandomGen::Instance();
+    wmax *= 2;
+    bool accept_decay=false;
+    unsigned int itry=0;
+
+    while(!accept_decay)
+    {
+      itry++;
+      assert(itry<kMaxUnweightDecayIterations);
+
+      double w  = fPhaseSpaceGenerator.Generate();
+      double gw = wmax * rnd->RndDec().Rndm();
 
-  // This evaluate the function W(theta, phi) as a function of the emitted pion and of the status of
-  // the Delta to be decayed and the whole event
+      if(w>wmax) {
+         LOG("ResonanceDecay", pWARN)
+            << "Current decay weight = " << w << " > wmax = " << wmax;
+      }
+      LOG("ResonanceDecay", pINFO)
+        << "Current decay weight = " << w << " / R = " << gw;
 
-  // in its simplest form W(theta) is
+      accept_decay = (gw<=w);
+
+    }//accept_decay
+
+  }//fGenerateWeighted
+
+  return true ;
+}
+//____________________________________________________________________________
+void BaryonResonanceDecayer::GenerateDeltaNPiDecay(
+  int dec_part_id, const GHepRecord * event, TDecayChannel * ch,
+  const double * mass, TLorentzVector * p4 ) const {
+
+  // Generates the Delta -> N + Pi decay with the pion angular distribution
+  // W(theta, phi) in the Delta rest frame. In its simplest form W(theta) is
   // W(Theta) = 1 − P[ 3/2 ] x L_2(cos Theta) + P[ 1/2 ] x L_2(cos Theta)
   // where
   // L_2 is the second Legendre polynomial L_2(x) = (3x^2 -1)/2
   // and P[3/2] and P[1/2] have to some up to 1.
-  // But the code has been extended to include a phi dependence
+  // But the code has been extended to include a phi dependence.
+  // Theta is the angle between the pion and the momentum transfer, phi the
+  // angle between the pion transverse direction and the lepton plane.
+  // As the 2-body phase space is isotropic, (cos Theta, Phi) are directly
+  // generated from W: cos Theta from its marginal distribution and Phi from
+  // its distribution at the generated cos Theta, inverting their CDFs.
 
   // Get the delta 4-momentum
   GHepParticle * decay_particle = event->Particle( dec_part_id );
   TLorentzVector delta_p4 = *(decay_particle->P4() );
+  TVector3 delta_boost = delta_p4.BoostVector() ;
 
   // find incoming lepton
   TLorentzVector in_lep_p4( * (event -> Probe()-> GetP4()) ) ;
@@ -618,16 +620,8 @@ bool BaryonResonanceDecayer::AcceptPionDecay( TLorentzVector pion,
 
   TLorentzVector q = in_lep_p4 - out_lep_p4 ;
 
-  pion.Boost(-delta_p4.BoostVector() );  // this gives us the pion in the Delta reference frame
-  q.Boost(-delta_p4.BoostVector() );  // this gives us the transferred momentm in the Delta reference frame
-
-  TVector3 pion_dir = pion.Vect().Unit() ;
-  TVector3 z_axis = q.Vect().Unit() ;
-
-
-
   unsigned int q2_index = 0 ;
-  
+
   // find out Q2 region for values
   // note that Q2 is a lorentz invariant so it does not matter it is evaluated in the lab frame
   // like in this case or in the Delta reference frame
@@ -637,45 +631,64 @@ bool BaryonResonanceDecayer::AcceptPionDecay( TLorentzVector pion,
     else break ;
   }
 
-  double w_function ; 
+  q.Boost( -delta_boost );  // this gives us the transferred momentm in the Delta reference frame
+  TVector3 z_axis = q.Vect().Unit() ;
 
+  // the reference frame x axis is in the lepton plane
+  TVector3 x_axis, y_axis ;
   if ( fDeltaThetaOnly ) {
-    
-    double c_t = pion_dir*z_axis; // cos theta
-    
-    w_function = 1. - (fR33[q2_index] - 0.5)*(3.*c_t*c_t - 1.) ;
-
+    x_axis = z_axis.Orthogonal().Unit() ;
   }
-
   else {
-
-    double x[2] ; // 0 : theta, 1 : phi 
-
-    x[0] = pion_dir.Angle( z_axis ) ; // theta
-
-    in_lep_p4.Boost(-delta_p4.BoostVector() ) ;
-    out_lep_p4.Boost( -delta_p4.BoostVector() ) ;
-
-    // evaluate reference frame -> define x axis
-    TVector3 y_axis = in_lep_p4.Vect().Cross( out_lep_p4.Vect() ).Unit() ;
-    TVector3 x_axis = y_axis.Cross(z_axis);
-
-    TVector3 pion_perp( z_axis.Cross( pion_dir.Cross( z_axis ).Unit() ) ) ;
-    
-    x[1] = pion_perp.Angle( x_axis ) ;  // phi
-
-    w_function = BaryonResonanceDecayer::PionAngularDist( x, fRParams[q2_index] ) ; 
-    
+    in_lep_p4.Boost( -delta_boost ) ;
+    out_lep_p4.Boost( -delta_boost ) ;
+    y_axis = in_lep_p4.Vect().Cross( out_lep_p4.Vect() ).Unit() ;
+    x_axis = y_axis.Cross( z_axis ) ;
   }
-
-  if ( fW_max[q2_index] <= 0. ) {
-    const_cast<genie::BaryonResonanceDecayer*>( this ) -> fW_max[q2_index] = FindDistributionExtrema( q2_index, true ) ; 
+  y_axis = z_axis.Cross( x_axis ) ;
+
+  RandomGen * rnd = RandomGen::Instance() ;
+
+  // cos Theta: W integrated over Phi is 2pi x ( 1 - a (3c^2 - 1) )
+  double a = fR33[q2_index] - 0.5 ;
+  double u = 2. * rnd -> RndDec().Rndm() ;
+  double c_t = InvertCDF(
+     [a] (double c) { return (c + 1.) - a * ( c*c*c - c ) ; },
+     [a] (double c) { return 1. - a * ( 3.*c*c - 1. ) ; },
+     u, -1., 1. ) ;
+  double s_t = TMath::Sqrt( TMath::Max( 0., 1. - c_t*c_t ) ) ;
+
+  // Phi: uniform unless there is a phi dependence
+  double A   = 1. - a * ( 3.*c_t*c_t - 1. ) ;
+  double phi = 2. * kPi * rnd -> RndDec().Rndm() ;
+  if ( ! fDeltaThetaOnly && A > 0. ) {
+    double b1 = kSqrt3 * 2. * fRParams[q2_index][1] * s_t * c_t ;
+    double b2 = kSqrt3 * fRParams[q2_index][2] * s_t ;
+    phi = InvertCDF(
+       [A, b1, b2] (double f) { return A * f - b1 * TMath::Sin(f) - 0.5 * b2 * TMath::Sin(2.*f) ; },
+       [A, b1, b2] (double f) { return A     - b1 * TMath::Cos(f) -       b2 * TMath::Cos(2.*f) ; },
+       A * phi, 0., 2. * kPi ) ;
   }
 
-  double aidrnd = fW_max[q2_index] * RandomGen::Instance()-> RndDec().Rndm();
-
-  return ( aidrnd <= w_function ) ;
-
+  TVector3 pion_dir = s_t * TMath::Cos(phi) * x_axis +
+                      s_t * TMath::Sin(phi) * y_axis + c_t * z_axis ;
+
+  // Locate the pion in the decay products
+  // at this point we already know that the pion is unique so the first pion we find is our pion
+  unsigned int pi_id = genie::pdg::IsPion( ch->DaughterPdgCode(0) ) ? 0 : 1 ;
+  unsigned int n_id  = 1 - pi_id ;
+
+  // 2-body decay momenta in the Delta reference frame, boosted to the lab
+  double W = delta_p4.M() ;
+  double m_pi = mass[pi_id], m_n = mass[n_id] ;
+  double p = TMath::Sqrt( TMath::Max( 0.,
+      ( W*W - TMath::Power(m_pi + m_n, 2) ) * ( W*W - TMath::Power(m_pi - m_n, 2) ) ) ) / (2.*W) ;
+
+  TVector3 p3 = p * pion_dir ;
+  p4[pi_id].SetVectM(  p3, m_pi ) ;
+  p4[n_id] .SetVectM( -p3, m_n  ) ;
+  p4[pi_id].Boost( delta_boost ) ;
+  p4[n_id] .Boost( delta_boost ) ;
 }
 //____________________________________________________________________________
 double BaryonResonanceDecayer::Weight(void) const
@@ -866,6 +879,9 @@ void BaryonResonanceDecayer::LoadConfig(void) {
 
   this -> GetParam( "FFScaling", fFFScaling ) ;
 
+  // the tabulated W-evolved widths depend on the form factor scaling
+  fChannelTables.clear() ;
+
   this -> GetParamDef( "Delta-ThetaOnly", fDeltaThetaOnly, true ) ;
 
   this -> GetParamDef( "DeltaDecayMaximumTolerance", fMaxTolerance, 0.0005 ) ;
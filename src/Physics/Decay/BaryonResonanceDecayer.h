@@ -25,6 +25,9 @@
 #ifndef _BARYON_RESONANCE_DECAYER_H_
 #define _BARYON_RESONANCE_DECAYER_H_
 
+#include <map>
+#include <vector>
+
 #include <TGenPhaseSpace.h>
 #include <TLorentzVector.h>
 
@@ -53,14 +56,27 @@ private:
   void           UnInhibitDecay    (int pdgc, TDecayChannel * ch=0) const;
   double         Weight            (void) const;
   bool           Decay             (int dec_part_id, GHepRecord * event) const;
-  TDecayChannel* SelectDecayChannel(int dec_part_id, GHepRecord * event, bool & to_be_deleted ) const;
-  // the flag to_be_deleted is referred to the returned decay channel 
+  TDecayChannel* SelectDecayChannel(int dec_part_id, GHepRecord * event) const;
   bool           DecayExclusive    (int dec_part_id, GHepRecord * event, TDecayChannel * ch) const;
+  bool           GeneratePhaseSpaceDecay(const TLorentzVector & p4, unsigned int nd, double * mass) const;
+
+  // Decay channels of a resonance, tabulated at its first decay
+  struct ChannelTable {
+    std::vector<TDecayChannel *> fChannels; ///< PDGLibrary decay channels (not owned)
+    std::vector<double>          fFSMass;   ///< final state mass of each channel
+    std::vector<double>          fBR;       ///< nominal branching ratio of each channel
+    // W-evolved decay widths (for resonances with evolved BRs only)
+    int                          fNW;       ///< number of W nodes
+    double                       fWMin;     ///< W at the first node
+    double                       fDW;       ///< node spacing
+    std::vector<double>          fWidths;   ///< width of channel ich at node iw in [iw*nch+ich]
+  };
+  const ChannelTable & Channels (int dec_part_pdgc) const;
 
   // Methods specific for Delta decay
-  TObjArray *    EvolveDeltaBR        (int dec_part_pdgc, TObjArray * decay_list, double W) const;
   double         EvolveDeltaDecayWidth(int dec_part_pdgc, TDecayChannel * ch, double W) const;
-  bool           AcceptPionDecay( TLorentzVector lab_pion, int dec_part_id, const GHepRecord * event ) const ;
+  void           GenerateDeltaNPiDecay( int dec_part_id, const GHepRecord * event, TDecayChannel * ch,
+                                        const double * mass, TLorentzVector * p4 ) const ;
 
   double         FinalStateMass    ( TDecayChannel * ch ) const;
   bool           IsPiNDecayChannel ( TDecayChannel * ch ) const;
@@ -82,6 +98,9 @@ private:
   mutable TGenPhaseSpace fPhaseSpaceGenerator;
   mutable double         fWeight;
 
+  mutable std::map<int, ChannelTable> fChannelTables; ///< decay channel tables, by resonance PDG code
+  mutable std::vector<double>         fCumBR;         ///< cumulative channel weights of the current decay
+
   bool   fDeltaThetaOnly ;
 
   double fMaxTolerance ;
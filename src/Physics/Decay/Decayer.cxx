@@ -12,6 +12,8 @@
 #include <sstream>
 
 #include <TParticlePDG.h>
+#include <TDatabasePDG.h>
+#include <THashList.h>
 
 #include "Framework/ParticleData/BaryonResUtils.h"
 #include "Framework/ParticleData/PDGLibrary.h"
@@ -63,18 +65,7 @@ bool Decayer::ToBeDecayed(int pdg_code, GHepStatus_t status_code) const
   // Check whether the given unstable particle
   // has the appropriate status code to be decayed
 
-  bool to_be_decayed = false;
-
-  if(fRunBefHadroTransp) {
-    to_be_decayed =
-      (status_code == kIStHadronInTheNucleus    ||
-       status_code == kIStPreDecayResonantState ||
-       status_code == kIStStableFinalState);
-  }
-  else {
-    to_be_decayed =
-      (status_code == kIStStableFinalState);
-  }
+  bool to_be_decayed = this->HasDecayStatus(status_code);
 
   LOG("Decay", pDEBUG)
       << "Particle to be decayed "
@@ -84,6 +75,55 @@ bool Decayer::ToBeDecayed(int pdg_code, GHepStatus_t status_code) const
   return to_be_decayed;
 }
 //___________________________________________________________________________
+bool Decayer::HasDecayStatus(GHepStatus_t status_code) const
+{
+  if(fRunBefHadroTransp) {
+    return (status_code == kIStHadronInTheNucleus    ||
+            status_code == kIStPreDecayResonantState ||
+            status_code == kIStStableFinalState);
+  }
+  return (status_code == kIStStableFinalState);
+}
+//___________________________________________________________________________
+bool Decayer::ShouldDecay(int pdg_code, GHepStatus_t status_code) const
+{
+  // Use the flags tabulated at configuration, unless the particle is not
+  // in the PDGLibrary table (or the table was rebuilt since)
+
+  PDGLibrary * pdglib = PDGLibrary::Instance();
+  int i = pdglib->Index(pdg_code);
+  if(i >= 0 && fDecayFlags.size() == (unsigned int) pdglib->NIndices()) {
+    return fDecayFlags[i] && this->HasDecayStatus(status_code);
+  }
+
+  return this->IsHandled(pdg_code) && this->ToBeDecayed(pdg_code, status_code);
+}
+//___________________________________________________________________________
+void Decayer::BuildDecayFlags(void)
+{
+  PDGLibrary * pdglib = PDGLibrary::Instance();
+  TDatabasePDG * db = pdglib->DBase();
+
+  fDecayFlags.assign(pdglib->NIndices(), 0);
+
+  int nflagged = 0;
+  if(db && db->ParticleList()) {
+    TIter particle_iter(db->ParticleList());
+    TParticlePDG * p = 0;
+    while( (p = dynamic_cast<TParticlePDG *> (particle_iter.Next())) ) {
+      int pdg_code = p->PdgCode();
+      int i = pdglib->Index(pdg_code);
+      if(i < 0) continue;
+      bool decay = this->IsHandled(pdg_code) && this->IsUnstable(pdg_code);
+      fDecayFlags[i] = decay;
+      if(decay) nflagged++;
+    }
+  }
+
+  LOG("Decay", pDEBUG)
+    << nflagged << " particles flagged for decay by " << this->Id().Key();
+}
+//___________________________________________________________________________
 bool Decayer::IsUnstable(int pdg_code) const
 {
   // ROOT's TParticlepdg::Lifetime() does not work properly
@@ -209,6 +249,8 @@ void Decayer::LoadConfig(void)
   sort(fParticlesToDecay.begin(),    fParticlesToDecay.end());
   sort(fParticlesNotToDecay.begin(), fParticlesNotToDecay.end());
 
+  this->BuildDecayFlags();
+
   // Print-out for only one of the two instances of this module
   if(!fRunBefHadroTransp) {
     LOG("Decay", pNOTICE)
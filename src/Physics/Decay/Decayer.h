@@ -6,6 +6,9 @@
 \brief    Base class for decayer classes.
           Implements common configuration, allowing users to toggle on/off
           flags for particles and decay channels.
+          Whether a particle is handled by the decayer and unstable is
+          tabulated at configuration for all particles of the PDGLibrary, so
+          that ShouldDecay() is a table look-up plus a status code check.
           Is a concerete implementation of the EventRecordVisitorI interface.
 
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
@@ -21,6 +24,8 @@
 #ifndef _DECAYER_H_
 #define _DECAYER_H_
 
+#include <vector>
+
 class TDecayChannel;
 
 #include "Framework/EventGen/EventRecordVisitorI.h"
@@ -53,10 +58,16 @@ protected:
   virtual void InhibitDecay  (int pdgc, TDecayChannel * dc=0) const = 0;
   virtual void UnInhibitDecay(int pdgc, TDecayChannel * dc=0) const = 0;
 
+  bool ShouldDecay      (int pdgc, GHepStatus_t ist) const; ///< IsHandled() && ToBeDecayed()
+  bool HasDecayStatus   (GHepStatus_t ist) const;
+  void BuildDecayFlags  (void);
+
   bool        fGenerateWeighted;    ///< generate weighted or unweighted decays?
   bool        fRunBefHadroTransp;   ///< is invoked before or after FSI?
   PDGCodeList fParticlesToDecay;    ///< list of particles to be decayed
   PDGCodeList fParticlesNotToDecay; ///< list of particles for which decay is inhibited
+
+  std::vector<char> fDecayFlags;    ///< IsHandled() && IsUnstable(), by PDGLibrary index
 };
 
 }      // genie namespace
@@ -65,6 +65,9 @@ void PythiaDecayer::ProcessEventRecord(GHepRecord * event) const
     << "Running PYTHIA6 particle decayer "
     << ((fRunBefHadroTransp) ? "*before*" : "*after*") << " FSI";
 
+  // PYTHIA6 is shared by all threads
+  std::lock_guard<std::recursive_mutex> lock(RandomGen::Pythia6Mutex());
+
   // Loop over particles, find unstable ones and decay them
   TObjArrayIter piter(event);
   GHepParticle * p = 0;
@@ -78,8 +81,7 @@ void PythiaDecayer::ProcessEventRecord(GHepRecord * event) const
     int pdg_code = p->Pdg();
     GHepStatus_t status_code = p->Status();
 
-    if(!this->IsHandled  (pdg_code)) continue;
-    if(!this->ToBeDecayed(pdg_code, status_code)) continue;
+    if(!this->ShouldDecay(pdg_code, status_code)) continue;
 
     LOG("Pythia6Decay", pNOTICE)
           << "Decaying unstable particle: " << p->Name();
@@ -230,6 +232,8 @@ void PythiaDecayer::InhibitDecay(int pdg_code, TDecayChannel * dc) const
 {
   if(! this->IsHandled(pdg_code)) return;
 
+  std::lock_guard<std::recursive_mutex> lock(RandomGen::Pythia6Mutex());
+
   int kc = fPythia->Pycomp(pdg_code);
 
   if(!dc) {
@@ -253,6 +257,8 @@ void PythiaDecayer::UnInhibitDecay(int pdg_code, TDecayChannel * dc) const
 {
   if(! this->IsHandled(pdg_code)) return;
 
+  std::lock_guard<std::recursive_mutex> lock(RandomGen::Pythia6Mutex());
+
   int kc = fPythia->Pycomp(pdg_code);
 
   if(!dc) {
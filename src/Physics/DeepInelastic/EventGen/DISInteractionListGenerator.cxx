@@ -122,6 +122,13 @@ InteractionList * DISInteractionListGenerator::CreateInteractionList(
   return intlist;
 }
 //___________________________________________________________________________
+string DISInteractionListGenerator::TargetClass(const Target & target) const
+{
+// The list only depends on whether the target has protons and neutrons
+
+  return InteractionListGeneratorI::NucleonContentClass(target);
+}
+//___________________________________________________________________________
 void DISInteractionListGenerator::Configure(const Registry & config)
 {
   Algorithm::Configure(config);
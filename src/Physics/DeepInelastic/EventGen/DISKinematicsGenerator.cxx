@@ -9,6 +9,7 @@
 //____________________________________________________________________________
 
 #include <cfloat>
+#include <vector>
 
 #include <TMath.h>
 
@@ -26,9 +27,13 @@
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Numerical/MathUtils.h"
+#include "Framework/Utils/CacheBranchGrid.h"
+#include "Framework/Utils/ThreadPool.h"
 #include "Framework/Utils/KineUtils.h"
 #include "Framework/ParticleData/PDGUtils.h"
 
+using std::vector;
+
 using namespace genie;
 using namespace genie::controls;
 using namespace genie::utils;
@@ -100,8 +105,15 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   //   cache. Throw an exception and quit the evg thread if a non-positive
   //   value is found.
   //   If the kinematics are generated uniformly over the allowed phase
-  //   space the max xsec is irrelevant
-  double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
+  //   space the max xsec is irrelevant.
+  //   If adaptive sampling is used, (x,y) are drawn from the learnt grid
+  //   and the rejection is made against its max weight instead.
+  CacheBranchGrid * grid = 0;
+  double xsec_max = -1;
+  if(!fGenerateUniformly) {
+    if(fUseAdaptiveGrid) grid = this->AdaptiveGrid(evrec);
+    else xsec_max = this->MaxXSec(evrec);
+  }
 
   //-- Try to select a valid (x,y) pair using the rejection method
 
@@ -124,8 +136,16 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      }
 
      //-- random x,y
-     gx = xl.min + dx * rnd->RndKine().Rndm();
-     gy = yl.min + dy * rnd->RndKine().Rndm();
+     double g = 1;
+     if(grid) {
+        double u = 0, v = 0;
+        g  = grid->Generate(rnd->RndKine().Rndm(), rnd->RndKine().Rndm(), u, v);
+        gx = xl.min + dx * u;
+        gy = yl.min + dy * v;
+     } else {
+        gx = xl.min + dx * rnd->RndKine().Rndm();
+        gy = yl.min + dy * rnd->RndKine().Rndm();
+     }
      interaction->KinePtr()->Setx(gx);
      interaction->KinePtr()->Sety(gy);
      kinematics::UpdateWQ2FromXY(interaction);
@@ -139,7 +159,14 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      xsec = fXSecModel->XSec(interaction, kPSxyfE);
 
      //-- decide whether to accept the current kinematics
-     if(!fGenerateUniformly) {
+     if(grid) {
+        double w    = xsec * dx * dy / g;
+        double wmax = grid->MaxWeight();
+        this->AssertXSecLimits(interaction, w, wmax);
+        if(w > wmax) grid->SetMaxWeight(fSafetyFactor * w);
+        accept = (wmax * rnd->RndKine().Rndm() < w);
+     }
+     else if(!fGenerateUniformly) {
         this->AssertXSecLimits(interaction, xsec, xsec_max);
         double t = xsec_max * rnd->RndKine().Rndm();
 	double J = 1;
@@ -156,6 +183,7 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {
+         this->RecordAccepted(interaction, iter);
          LOG("DISKinematics", pNOTICE)
             << "Selected:  x = " << gx << ", y = " << gy
             << " (W  = " << interaction->KinePtr()->W()  << ","
@@ -233,6 +261,9 @@ void DISKinematicsGenerator::LoadConfig(void)
   //   an event weight?
     GetParamDef( "UniformOverPhaseSpace", fGenerateUniformly, false ) ;
 
+  //-- Sample (x,y) from an adaptive grid learnt per interaction and
+  //   energy bin, in place of the flat rejection method?
+    this->LoadAdaptiveSamplingConfig();
 }
 //____________________________________________________________________________
 double DISKinematicsGenerator::ComputeMaxXSec(
@@ -294,13 +325,17 @@ double DISKinematicsGenerator::ComputeMaxXSec(
   LOG("DISKinematics", pDEBUG)
     << "Searching max. in x [" << xmin << ", " << xmax << "], y [" << ymin << ", " << ymax << "]";
 #endif
-  double xseclast_y = -1;
-  bool increasing_y;
+  // The y rows are scanned independently, spread over the thread pool
+  vector<double> max_xsec_y(Ny, 0.);
+
+  ThreadPool::Instance()->ParallelFor(Ny, [&] (int i, unsigned int worker) {
+     const XSecAlgorithmI * xsec_model = this->WorkerXSecModel(worker);
+     std::unique_ptr<Interaction> copy;
+     const Interaction * in = this->WorkerInteraction(interaction, worker, copy);
 
-  for(int i=0; i<Ny; i++) {
      double gy = ymin + i*dy;
      //double gy = TMath::Power(10., logymin + i*dlogy);
-     interaction->KinePtr()->Sety(gy);
+     in->KinePtr()->Sety(gy);
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
      LOG("DISKinematics", pDEBUG) << "y = " << gy;
@@ -311,16 +346,16 @@ double DISKinematicsGenerator::ComputeMaxXSec(
      for(int j=0; j<Nx; j++) {
         double gx = xmin + j*dx;
 	//double gx = TMath::Power(10., logxmin + j*dlogx);
-        interaction->KinePtr()->Setx(gx);
-        kinematics::UpdateWQ2FromXY(interaction);
+        in->KinePtr()->Setx(gx);
+        kinematics::UpdateWQ2FromXY(in);
 
-        double xsec = fXSecModel->XSec(interaction, kPSxyfE);
+        double xsec = xsec_model->XSec(in, kPSxyfE);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
         LOG("DISKinematics", pINFO)
                 << "xsec(y=" << gy << ", x=" << gx << ") = " << xsec;
 #endif
         // update maximum xsec
-        max_xsec = TMath::Max(xsec, max_xsec);
+        max_xsec_y[i] = TMath::Max(xsec, max_xsec_y[i]);
 
         increasing_x = xsec-xseclast_x>=0;
         xseclast_x   = xsec;
@@ -338,9 +373,9 @@ double DISKinematicsGenerator::ComputeMaxXSec(
           for(int ik=0; ik<Nxb; ik++) {
 	     //gx = TMath::Exp(TMath::Log(gx) - dlogxn);
    	     gx = gx - dxn;
-             interaction->KinePtr()->Setx(gx);
-             kinematics::UpdateWQ2FromXY(interaction);
-             xsec = fXSecModel->XSec(interaction, kPSxyfE);
+             in->KinePtr()->Setx(gx);
+             kinematics::UpdateWQ2FromXY(in);
+             xsec = xsec_model->XSec(in, kPSxyfE);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
              LOG("DISKinematics", pINFO)
                 << "xsec(y=" << gy << ", x=" << gx << ") = " << xsec;
@@ -349,15 +384,11 @@ double DISKinematicsGenerator::ComputeMaxXSec(
           break;
         } // stepping back within last bin
      } // x
-     increasing_y = max_xsec-xseclast_y>=0;
-     xseclast_y   = max_xsec;
-     if(!increasing_y) {
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-       LOG("DISKinematics", pDEBUG)
-           << "d2xsec/dxdy stopped increasing. Exiting y loop";
-#endif
-       break;
-     }
+  });
+
+  // (the running max never decreases, so all rows contribute)
+  for(int i=0; i<Ny; i++) {
+     max_xsec = TMath::Max(max_xsec, max_xsec_y[i]);
   }// y
 
   // Apply safety factor, since value retrieved from the cache might
@@ -375,3 +406,22 @@ double DISKinematicsGenerator::ComputeMaxXSec(
   return max_xsec;
 }
 //___________________________________________________________________________
+double DISKinematicsGenerator::AdaptiveGridXSec(
+       const Interaction * interaction, double u, double v, double & jac) const
+{
+// Maps (u,v) of the unit square linearly to the allowed (x,y) and returns
+// d2xsec/dxdy there
+
+  const KPhaseSpace & kps = interaction->PhaseSpace();
+  Range1D_t xl = kps.Limits(kKVx);
+  Range1D_t yl = kps.Limits(kKVy);
+
+  jac = (xl.max - xl.min) * (yl.max - yl.min);
+
+  interaction->KinePtr()->Setx(xl.min + (xl.max - xl.min) * u);
+  interaction->KinePtr()->Sety(yl.min + (yl.max - yl.min) * v);
+  kinematics::UpdateWQ2FromXY(interaction);
+
+  return fXSecModel->XSec(interaction, kPSxyfE);
+}
+//___________________________________________________________________________
@@ -47,6 +47,8 @@ public :
 private:
   void   LoadConfig      (void);
   double ComputeMaxXSec  (const Interaction * interaction) const;
+  double AdaptiveGridXSec(const Interaction * interaction,
+                          double u, double v, double & jac) const;
 };
 
 }      // genie namespace
@@ -37,47 +37,47 @@ BYPDF::~BYPDF()
 //____________________________________________________________________________
 double BYPDF::UpValence(double x, double q2) const
 {
-  return AllPDFs(x,q2).uval;
+  return MemoPDFs(x,q2).uval;
 }
 //____________________________________________________________________________
 double BYPDF::DownValence(double x, double q2) const
 {
-  return AllPDFs(x,q2).dval;
+  return MemoPDFs(x,q2).dval;
 }
 //____________________________________________________________________________
 double BYPDF::UpSea(double x, double q2) const
 {
-  return AllPDFs(x,q2).usea;
+  return MemoPDFs(x,q2).usea;
 }
 //____________________________________________________________________________
 double BYPDF::DownSea(double x, double q2) const
 {
-  return AllPDFs(x,q2).dsea;
+  return MemoPDFs(x,q2).dsea;
 }
 //____________________________________________________________________________
 double BYPDF::Strange(double x, double q2) const
 {
-  return AllPDFs(x,q2).str;
+  return MemoPDFs(x,q2).str;
 }
 //____________________________________________________________________________
 double BYPDF::Charm(double x, double q2) const
 {
-  return AllPDFs(x,q2).chm;
+  return MemoPDFs(x,q2).chm;
 }
 //____________________________________________________________________________
 double BYPDF::Bottom(double x, double q2) const
 {
-  return AllPDFs(x,q2).bot;
+  return MemoPDFs(x,q2).bot;
 }
 //____________________________________________________________________________
 double BYPDF::Top(double x, double q2) const
 {
-  return AllPDFs(x,q2).top;
+  return MemoPDFs(x,q2).top;
 }
 //____________________________________________________________________________
 double BYPDF::Gluon(double x, double q2) const
 {
-  return AllPDFs(x,q2).gl;
+  return MemoPDFs(x,q2).gl;
 }
 //____________________________________________________________________________
 PDF_t BYPDF::AllPDFs(double x, double q2) const
@@ -164,6 +164,7 @@ void BYPDF::Configure(string config)
 //____________________________________________________________________________
 void BYPDF::LoadConfig(void)
 {
+  this->ClearPDFMemo();
 
   GetParam( "BY-X0", fX0 ) ;
   GetParam( "BY-X1", fX1 ) ;
@@ -8,10 +8,12 @@
 */
 //____________________________________________________________________________
 
+#include <map>
+#include <sstream>
+#include <vector>
+
 #include <TMath.h>
 #include <Math/IFunction.h>
-#include <Math/IntegratorMultiDim.h>
-#include "Math/AdaptiveIntegratorMultiDim.h"
 
 #include "Framework/Algorithm/AlgConfigPool.h"
 #include "Framework/Conventions/GBuild.h"
@@ -30,11 +32,28 @@
 #include "Framework/Utils/CacheBranchFx.h"
 #include "Framework/Utils/XSecSplineList.h"
 #include "Framework/Numerical/GSLUtils.h"
+#include "Framework/Numerical/VegasIntegrator.h"
 
+using std::ostringstream;
+using std::vector;
 using namespace genie;
 using namespace genie::controls;
 using namespace genie::constants;
 
+namespace {
+  // hit quark channels integrated together (pdg code, from sea?)
+  const int  kNQrkChannels = 10;
+  const int  kQrkChannelPdg[kNQrkChannels] = {
+    kPdgUQuark, kPdgUQuark, kPdgAntiUQuark, kPdgDQuark, kPdgDQuark,
+    kPdgAntiDQuark, kPdgSQuark, kPdgAntiSQuark, kPdgCQuark, kPdgAntiCQuark };
+  const bool kQrkChannelSea[kNQrkChannels] = {
+    false, true, true, false, true, true, true, true, true, true };
+
+  // fused quark channel cross sections, for the channels not asked for yet
+  const unsigned int kMaxFusedEntries = 4096;
+  thread_local std::map<string, vector<double> > tFusedXSec;
+}
+
 //____________________________________________________________________________
 DISXSec::DISXSec() :
 XSecIntegratorI("genie::DISXSec")
@@ -158,14 +177,15 @@ double DISXSec::Integrate(
      if(phsp_ok) {
        ROOT::Math::IBaseFunctionMultiDim * func =
           new utils::gsl::d2XSec_dWdQ2_E(model, interaction);
-       ROOT::Math::IntegrationMultiDim::Type ig_type =
-           utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
-
        double abstol = 1; //We mostly care about relative tolerance.
-       ROOT::Math::IntegratorMultiDim ig(*func, ig_type, abstol, fGSLRelTol, fGSLMaxEval);
        double kine_min[2] = { Wl.min, Q2l.min };
        double kine_max[2] = { Wl.max, Q2l.max };
-       xsec = ig.Integral(kine_min, kine_max) * (1E-38 * units::cm2);
+       if(fFusedQrkChannels && interaction->InitState().Tgt().HitQrkIsSet()) {
+         xsec = this->FusedQrkChannelXSec(model, interaction, kine_min, kine_max);
+       } else {
+         xsec = utils::gsl::IntegrateMultiDim(*func, fGSLIntgType, kine_min, kine_max,
+                   abstol, fGSLRelTol, fGSLMaxEval) * (1E-38 * units::cm2);
+       }
        delete func;
      }//phase space ok?
 
@@ -203,6 +223,15 @@ void DISXSec::LoadConfig(void)
   fGSLMaxEval  = (unsigned int) max_eval ;
   fGSLMinEval  = (unsigned int) min_eval ;
 
+  // Start the integral at each knot of the cached free nucleon cross sections
+  // from the grid adapted at the previous knot (for vegas integration)
+  GetParamDef( "gsl-warm-start", fGSLWarmStart, false ) ;
+
+  // Integrate all hit quark channels of an interaction at the same sample
+  // points, sharing the PDF evaluations, and keep the other channels for
+  // when they are asked for (eg at the same spline knot)
+  GetParamDef( "gsl-fused-quark-channels", fFusedQrkChannels, false ) ;
+
   // Energy range for cached splines
   GetParam( "GVLD-Emin", fVldEmin) ;
   GetParam( "GVLD-Emax", fVldEmax) ;
@@ -222,7 +251,7 @@ void DISXSec::CacheFreeNucleonXSec(
            dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
   assert(!cache_branch);
   cache_branch = new CacheBranchFx("DIS XSec");
-  cache->AddCacheBranch(key, cache_branch);
+  cache->AddCacheBranch(key, cache_branch, true);
 
   // Tweak interaction to be on a free nucleon target
   Target * target = interaction->InitStatePtr()->TgtPtr();
@@ -263,7 +292,10 @@ void DISXSec::CacheFreeNucleonXSec(
   ROOT::Math::IBaseFunctionMultiDim * func =
      new utils::gsl::d2XSec_dWdQ2_E(model, interaction);
 
-  // Compute the cross section at the given set of knots
+  // Compute the cross section at the given set of knots. The knots are
+  // integrated in order on this thread, so the integrator (and, if requested,
+  // its adapted grid) is carried over from one knot to the next.
+  bool warm_start = false;
   for(int ie=0; ie<nknots; ie++) {
     double Ev = E[ie];
     TLorentzVector p4(0,0,Ev,Ev);
@@ -282,21 +314,13 @@ void DISXSec::CacheFreeNucleonXSec(
             Wl.min >= 0. &&  Wl.max >= 0. &&  Wl.max >=  Wl.min);
 
        if(phsp_ok) {
-         ROOT::Math::IntegrationMultiDim::Type ig_type =
-             utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
          double abstol = 1; //We mostly care about relative tolerance.
-         ROOT::Math::IntegratorMultiDim ig(*func, ig_type, abstol, fGSLRelTol, fGSLMaxEval);
-
-         if (ig_type == ROOT::Math::IntegrationMultiDim::kADAPTIVE) {
-            ROOT::Math::AdaptiveIntegratorMultiDim * cast =
-              dynamic_cast<ROOT::Math::AdaptiveIntegratorMultiDim*>( ig.GetIntegrator() );
-            assert(cast);
-            cast->SetMinPts(fGSLMinEval);
-         }
-
          double kine_min[2] = { Wl.min, Q2l.min };
          double kine_max[2] = { Wl.max, Q2l.max };
-         xsec = ig.Integral(kine_min, kine_max) * (1E-38 * units::cm2);
+         xsec = utils::gsl::IntegrateMultiDim(*func, fGSLIntgType, kine_min, kine_max,
+                   abstol, fGSLRelTol, fGSLMaxEval, fGSLMinEval, warm_start) *
+                (1E-38 * units::cm2);
+         warm_start = fGSLWarmStart;
        }// phase space limits ok?
     }//Ev>threshold
 
@@ -326,3 +350,86 @@ string DISXSec::CacheBranchName(
   return key;
 }
 //____________________________________________________________________________
+double DISXSec::FusedQrkChannelXSec(
+         const XSecAlgorithmI * model, const Interaction * in,
+         const double * kine_min, const double * kine_max) const
+{
+// Integrates the input hit quark channel together with all other hit quark
+// channels of the same probe, nucleon, current & energy: the channels are
+// evaluated at the same VEGAS sample points (where the QPM DIS PDFs are
+// computed once), and the results of the other channels are kept for when
+// they are integrated next (eg for the same spline knot). Channels vanishing
+// for the input current drop out after the first iteration.
+
+  const InitialState & init_state = in->InitState();
+  const Target &       tgt        = init_state.Tgt();
+
+  int ich = -1;
+  for(int i = 0; i < kNQrkChannels; i++) {
+    if(kQrkChannelPdg[i] == tgt.HitQrkPdg() &&
+       kQrkChannelSea[i] == tgt.HitSeaQrk()) { ich = i; break; }
+  }
+
+  ostringstream key;
+  key.precision(17);
+  key << model->Id().Key() << ";epoch:" << Algorithm::ConfigEpoch()
+      << ";probe:"  << init_state.ProbePdg() << ";tgt:" << tgt.Pdg()
+      << ";N:"      << tgt.HitNucPdg()
+      << ";free:"   << in->TestBit(kIAssumeFreeNucleon)
+      << ";proc:"   << in->ProcInfo().AsString()
+      << ";xcls:"   << in->ExclTag().AsString()
+      << ";E:"      << init_state.ProbeE(kRfHitNucRest)
+      << ";W:"      << kine_min[0] << "," << kine_max[0]
+      << ";Q2:"     << kine_min[1] << "," << kine_max[1];
+
+  std::map<string, vector<double> >::iterator it = tFusedXSec.find(key.str());
+  if(ich >= 0 && it != tFusedXSec.end()) {
+    LOG("DISXSec", pINFO)
+      << "From the fused quark channel integration: " << in->AsString();
+    return it->second[ich];
+  }
+
+  // the channels to integrate (just the input one, for hit quarks not in the
+  // list), with the input interaction settings (the bits are not copied)
+  const UInt_t bits[4] = { kISkipProcessChk, kISkipKinematicChk,
+                           kIAssumeFreeNucleon, kINoNuclearCorrection };
+  vector<Interaction *> channels;
+  int nch = (ich < 0) ? 1 : kNQrkChannels;
+  for(int i = 0; i < nch; i++) {
+    Interaction * channel = new Interaction(*in);
+    for(int ib = 0; ib < 4; ib++) channel->SetBit(bits[ib], in->TestBit(bits[ib]));
+    if(ich >= 0) {
+      channel->InitStatePtr()->TgtPtr()->SetHitQrkPdg(kQrkChannelPdg[i]);
+      channel->InitStatePtr()->TgtPtr()->SetHitSeaQrk(kQrkChannelSea[i]);
+    }
+    channels.push_back(channel);
+  }
+  utils::gsl::d2XSec_dWdQ2_E_Channels func(model, channels);
+
+  thread_local VegasIntegrator vegas;
+  double abstol = 1; //We mostly care about relative tolerance.
+  vegas.SetAbsTolerance (abstol);
+  vegas.SetRelTolerance (fGSLRelTol);
+  vegas.SetMaxEval      (fGSLMaxEval);
+  vegas.SetWarmStart    (fGSLWarmStart);
+
+  vector<double> xsec(channels.size(), 0.);
+  vegas.Integral(2, channels.size(),
+    [&func] (unsigned int n, const double * x, const bool * active, double * f) {
+       func.DoEvalBatch(n, x, active, f);
+    }, kine_min, kine_max, &xsec[0]);
+  for(unsigned int i = 0; i < xsec.size(); i++) xsec[i] *= (1E-38 * units::cm2);
+
+  LOG("DISXSec", pINFO)
+    << "Integrated " << channels.size() << " quark channel(s) in "
+    << vegas.NEval() << " points for: " << key.str();
+
+  for(unsigned int i = 0; i < channels.size(); i++) delete channels[i];
+
+  if(ich < 0) return xsec[0];
+
+  if(tFusedXSec.size() >= kMaxFusedEntries) tFusedXSec.clear();
+  tFusedXSec[key.str()] = xsec;
+  return xsec[ich];
+}
+//____________________________________________________________________________
@@ -43,9 +43,13 @@ private:
 
   void   CacheFreeNucleonXSec(const XSecAlgorithmI * model, const Interaction * in) const;
   string CacheBranchName     (const XSecAlgorithmI * model, const Interaction * in) const;
+  double FusedQrkChannelXSec (const XSecAlgorithmI * model, const Interaction * in,
+                              const double * kine_min, const double * kine_max) const;
 
   double fVldEmin;
   double fVldEmax;
+  bool   fGSLWarmStart; ///< start each cached knot from the VEGAS grid of the previous one?
+  bool   fFusedQrkChannels; ///< integrate all hit quark channels in one pass?
 };
 
 }       // genie namespace
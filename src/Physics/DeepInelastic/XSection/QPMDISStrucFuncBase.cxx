@@ -63,6 +63,8 @@ QPMDISStrucFuncBase::~QPMDISStrucFuncBase()
 {
   delete fPDF;
   delete fPDFc;
+  delete fPDFMemo;
+  delete fPDFcMemo;
 }
 //____________________________________________________________________________
 void QPMDISStrucFuncBase::Configure(const Registry & config)
@@ -132,6 +134,14 @@ void QPMDISStrucFuncBase::InitPDF(void)
                      // evaluated at:
   fPDF  = new PDF(); //   x = computed (+/-corrections) scaling var, Q2
   fPDFc = new PDF(); //   x = computed charm slow re-scaling var,    Q2
+
+  fPDFMemo      = new PDF();
+  fPDFcMemo     = new PDF();
+  fPDFMemoEpoch = 0;
+  fPDFMemoX     = 0.;
+  fPDFMemoQ2pdf = 0.;
+  fPDFMemoQ2    = 0.;
+  fPDFMemoM     = 0.;
 }
 //____________________________________________________________________________
 void QPMDISStrucFuncBase::Calculate(const Interaction * interaction) const
@@ -494,10 +504,6 @@ double QPMDISStrucFuncBase::R(const Interaction * interaction) const
 //____________________________________________________________________________
 void QPMDISStrucFuncBase::CalcPDFs(const Interaction * interaction) const
 {
-  // Clean-up previous calculation
-  fPDF  -> Reset();
-  fPDFc -> Reset();
-
   // Get the kinematical variables x,Q2 (could include corrections)
   double x     = this->ScalingVar(interaction);
   double Q2val = this->Q2(interaction);
@@ -509,41 +515,66 @@ void QPMDISStrucFuncBase::CalcPDFs(const Interaction * interaction) const
   // Get the Q2 for which PDFs will be evaluated
   double Q2pdf = TMath::Max(Q2val, fQ2min);
 
-  // Compute PDFs at (x,Q2)
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-  LOG("DISSF", pDEBUG) << "Calculating PDFs @ x = " << x << ", Q2 = " << Q2pdf;
-#endif
-  fPDF->Calculate(x, Q2pdf);
-
   // Check whether it is above charm threshold
   bool above_charm =
            utils::kinematics::IsAboveCharmThreshold(x, Q2val, M, fMc);
-  if(above_charm) {
+
+  // The PDFs (before the K factors) only depend on the kinematics, so they
+  // are re-used when the SFs of another hit quark channel are computed at the
+  // same point (eg in a fused quark channel integration, see DISXSec)
+  bool memoized =
+     fPDFMemoEpoch == Algorithm::ConfigEpoch() && fPDFMemoEpoch != 0 &&
+     fPDFMemoX     == x     && fPDFMemoQ2pdf == Q2pdf &&
+     fPDFMemoQ2    == Q2val && fPDFMemoM     == M;
+  if(memoized) {
+    fPDF  -> Copy(*fPDFMemo);
+    fPDFc -> Copy(*fPDFcMemo);
+  } else {
+    // Clean-up previous calculation
+    fPDF  -> Reset();
+    fPDFc -> Reset();
+
+    // Compute PDFs at (x,Q2)
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-    LOG("DISSF", pDEBUG)
-      << "The event is above the charm threshold (mcharm = " << fMc << ")";
+    LOG("DISSF", pDEBUG) << "Calculating PDFs @ x = " << x << ", Q2 = " << Q2pdf;
 #endif
-    if(fCharmOff) {
-       LOG("DISSF", pINFO) << "Charm production is turned off";
-    } else {
-       // compute the slow rescaling var
-       double xc = utils::kinematics::SlowRescalingVar(x, Q2val, M, fMc);
-       if(xc<0 || xc>1) {
-          LOG("DISSF", pINFO) << "Unphys. slow rescaling var: xc = " << xc;
-       } else {
-          // compute PDFs at (xc,Q2)
+    fPDF->Calculate(x, Q2pdf);
+
+    if(above_charm) {
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-          LOG("DISSF", pDEBUG)
-              << "Calculating PDFs @ xc (slow rescaling) = " << x << ", Q2 = " << Q2val;
+      LOG("DISSF", pDEBUG)
+        << "The event is above the charm threshold (mcharm = " << fMc << ")";
 #endif
-          fPDFc->Calculate(xc, Q2pdf);
-       }
-    }// charm off?
-  }//above charm thr?
-  else {
-    LOG("DISSF", pDEBUG)
-     << "The event is below the charm threshold (mcharm = " << fMc << ")";
-  }
+      if(fCharmOff) {
+         LOG("DISSF", pINFO) << "Charm production is turned off";
+      } else {
+         // compute the slow rescaling var
+         double xc = utils::kinematics::SlowRescalingVar(x, Q2val, M, fMc);
+         if(xc<0 || xc>1) {
+            LOG("DISSF", pINFO) << "Unphys. slow rescaling var: xc = " << xc;
+         } else {
+            // compute PDFs at (xc,Q2)
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+            LOG("DISSF", pDEBUG)
+                << "Calculating PDFs @ xc (slow rescaling) = " << x << ", Q2 = " << Q2val;
+#endif
+            fPDFc->Calculate(xc, Q2pdf);
+         }
+      }// charm off?
+    }//above charm thr?
+    else {
+      LOG("DISSF", pDEBUG)
+       << "The event is below the charm threshold (mcharm = " << fMc << ")";
+    }
+
+    fPDFMemo  -> Copy(*fPDF);
+    fPDFcMemo -> Copy(*fPDFc);
+    fPDFMemoEpoch = Algorithm::ConfigEpoch();
+    fPDFMemoX     = x;
+    fPDFMemoQ2pdf = Q2pdf;
+    fPDFMemoQ2    = Q2val;
+    fPDFMemoM     = M;
+  }// memoized?
 
   // Compute the K factors
   double kval_u = 1.;
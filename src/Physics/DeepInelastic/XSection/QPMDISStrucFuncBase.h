@@ -109,6 +109,15 @@ protected:
   mutable double fs_c;
   mutable double fc_c;
 
+  // PDFs of the last CalcPDFs() call, before the K factors, & their kinematics
+  PDF *  fPDFMemo;
+  PDF *  fPDFcMemo;
+  mutable unsigned long fPDFMemoEpoch; ///< config epoch of the memo (0: none)
+  mutable double fPDFMemoX;
+  mutable double fPDFMemoQ2pdf;
+  mutable double fPDFMemoQ2;
+  mutable double fPDFMemoM;
+
 };
 
 }         // genie namespace
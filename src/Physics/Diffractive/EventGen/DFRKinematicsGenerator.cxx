@@ -117,11 +117,18 @@ void DFRKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   //   space the max xsec is irrelevant
   double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
 
-  //-- Try to select a valid (x,y,t) triplet using the rejection method
+  //-- Try to select a valid (x,y,t) triplet using the rejection method.
+  //   The xsec falls as exp(-beta*t): unless generating uniformly, t is
+  //   thrown from that exponential (truncated to the t range) and the
+  //   rejection is on xsec*exp(beta*t) only (the max xsec is then the max
+  //   of that product, see ComputeMaxXSec())
+
+  bool exp_t = this->UseExpTSampling();
 
   double dx = xl.max - xl.min;
   double dy = yl.max - yl.min;
   double dt = tl.max - tl.min;
+  double ft = (exp_t) ? 1. - TMath::Exp(-fBeta*dt) : 0.;
   double gx=-1, gy=-1, gt=-1, gW=-1, gQ2=-1, xsec=-1;
 
   unsigned int iter = 0;
@@ -141,7 +148,11 @@ void DFRKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      //-- random x,y,t
      gx = xl.min + dx * rnd->RndKine().Rndm();
      gy = yl.min + dy * rnd->RndKine().Rndm();
-     gt = tl.min + dt * rnd->RndKine().Rndm();
+     if(exp_t) {
+       gt = tl.min - TMath::Log(1. - ft * rnd->RndKine().Rndm()) / fBeta;
+     } else {
+       gt = tl.min + dt * rnd->RndKine().Rndm();
+     }
 
      interaction->KinePtr()->Setx(gx);
      interaction->KinePtr()->Sety(gy);
@@ -155,9 +166,9 @@ void DFRKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
      //-- decide whether to accept the current kinematics
      if(!fGenerateUniformly) {
-        this->AssertXSecLimits(interaction, xsec, xsec_max);
         double n = xsec_max * rnd->RndKine().Rndm();
-        double J = 1;
+        double J = (exp_t) ? TMath::Exp(fBeta*(gt - tl.min)) : 1;
+        this->AssertXSecLimits(interaction, J*xsec, xsec_max);
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
         LOG("DFRKinematics", pDEBUG)
@@ -171,6 +182,7 @@ void DFRKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {
+         this->RecordAccepted(interaction, iter);
          // reset trust bits
          interaction->ResetBit(kISkipProcessChk);
          interaction->ResetBit(kISkipKinematicChk);
@@ -245,6 +257,13 @@ void DFRKinematicsGenerator::LoadConfig(void)
 
   GetParam( "DFR-Beta", fBeta ) ;
 
+  //-- Throw t from the exp(-beta*t) factor of the xsec rather than uniformly?
+  GetParamDef( "ExponentialTSampling", fSampleTExp, true ) ;
+}
+//____________________________________________________________________________
+bool DFRKinematicsGenerator::UseExpTSampling(void) const
+{
+  return (fSampleTExp && !fGenerateUniformly && fBeta > 0);
 }
 //____________________________________________________________________________
 double DFRKinematicsGenerator::ComputeMaxXSec(
@@ -257,6 +276,8 @@ double DFRKinematicsGenerator::ComputeMaxXSec(
 // The computed max differential cross section does not need to be the exact
 // maximum. The number used in the rejection method will be scaled up by a
 // safety factor. But this needs to be fast - do not use a very fine grid.
+// With exponential t sampling, this is the max of xsec*exp(beta*t) (with t
+// measured from the lower end of the t range used in ProcessEventRecord()).
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("DFRKinematics", pDEBUG)
@@ -287,6 +308,7 @@ double DFRKinematicsGenerator::ComputeMaxXSec(
 #endif
   double xseclast_y = -1;
   bool increasing_y;
+  bool exp_t = this->UseExpTSampling();
 
   for(int i=0; i<Ny; i++) {
      double gy = ymin + i*dy;
@@ -319,6 +341,7 @@ double DFRKinematicsGenerator::ComputeMaxXSec(
           interaction->KinePtr()->Sett(gt);
 
           double xsec = fXSecModel->XSec(interaction, kPSxytfE);
+          if(exp_t) xsec *= TMath::Exp(fBeta*gt);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
 	  LOG("DFRKinematics", pINFO)
 	    << "xsec(y=" << gy << ", x=" << gx << ", t=" << gt << ") = " << xsec;
@@ -42,8 +42,10 @@ public :
 private:
   void   LoadConfig      (void);
   double ComputeMaxXSec  (const Interaction * interaction) const;
+  bool   UseExpTSampling (void) const;
 
   double fBeta;
+  bool   fSampleTExp;  ///< throw t from exp(-fBeta*t), rejecting on xsec*exp(fBeta*t) only?
 };
 
 }      // genie namespace
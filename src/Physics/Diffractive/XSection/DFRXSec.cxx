@@ -85,21 +85,11 @@ double DFRXSec::Integrate (const XSecAlgorithmI* model, const Interaction* in) c
 
   ROOT::Math::IBaseFunctionMultiDim * func =
     new utils::gsl::d3XSec_dxdydt_E(model, interaction);
-  ROOT::Math::IntegrationMultiDim::Type ig_type =
-    utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
-
   double abstol = 1; //We mostly care about relative tolerance.
-  ROOT::Math::IntegratorMultiDim ig(*func, ig_type, abstol, fGSLRelTol, fGSLMaxEval);
-  if (ig_type == ROOT::Math::IntegrationMultiDim::kADAPTIVE) {
-    ROOT::Math::AdaptiveIntegratorMultiDim * cast =
-      dynamic_cast<ROOT::Math::AdaptiveIntegratorMultiDim*>( ig.GetIntegrator() );
-    assert(cast);
-    cast->SetMinPts(fGSLMinEval);
-  }
-
   double kine_min[3] = { xl.min, yl.min, tl.min };
   double kine_max[3] = { xl.max, yl.max, tl.max };
-  xsec = ig.Integral(kine_min, kine_max) * (1E-38 * units::cm2);
+  xsec = utils::gsl::IntegrateMultiDim(*func, fGSLIntgType, kine_min, kine_max,
+            abstol, fGSLRelTol, fGSLMaxEval, fGSLMinEval) * (1E-38 * units::cm2);
   delete func;
   return xsec;
 }
@@ -8,14 +8,14 @@
 */
 //____________________________________________________________________________
 
-#include <cstring>
-
 #include <RVersion.h>
 #include <TClonesArray.h>
+#include <TMCParticle.h>
 #include <TMath.h>
 
 #include "Framework/Conventions/Constants.h"
 #include "Framework/GHEP/GHepStatus.h"
+#include "Framework/GHEP/GHepFlags.h"
 #include "Framework/GHEP/GHepParticle.h"
 #include "Framework/GHEP/GHepRecord.h"
 #include "Framework/Messenger/Messenger.h"
@@ -28,6 +28,29 @@
 using namespace genie;
 using namespace genie::constants;
 
+// PYTHIA6 parton-system setup, showering and fragmentation
+extern "C" void py2ent_(int *,  int *, int *, double *);
+extern "C" void pyshow_(int *,  int *, double *);
+extern "C" void pyexec_(void);
+
+// W- decay channels: (fermion, anti-fermion), branching ratio (PDG), and
+// whether the decay is hadronic. The hadronic width (67.41%) is shared in
+// proportion to |Vij|^2
+const GLRESGenerator::WDecayChannel
+  GLRESGenerator::kWDecayChannels[GLRESGenerator::kNWDecayChannels] = {
+  { kPdgElectron, kPdgAntiNuE,      0.1071,  false },
+  { kPdgMuon,     kPdgAntiNuMu,     0.1063,  false },
+  { kPdgTau,      kPdgAntiNuTau,    0.1138,  false },
+  { kPdgDQuark,   kPdgAntiUQuark,   0.3196,  true  },
+  { kPdgSQuark,   kPdgAntiUQuark,   0.0170,  true  },
+  { kPdgDQuark,   kPdgAntiCQuark,   0.0165,  true  },
+  { kPdgSQuark,   kPdgAntiCQuark,   0.3205,  true  },
+  { kPdgBQuark,   kPdgAntiCQuark,   0.00056, true  }
+};
+
+// min W mass above the quark pair mass for a hadronic decay to be open (GeV)
+const double GLRESGenerator::kWDecayHadronicMinMassGap = 1.0;
+
 //___________________________________________________________________________
 GLRESGenerator::GLRESGenerator() :
 EventRecordVisitorI("genie::GLRESGenerator")
@@ -85,26 +108,57 @@ void GLRESGenerator::ProcessEventRecord(GHepRecord * event) const
   // Decay resonance and add decay products
   //
 
+  int iW = event->GetEntries() - 1;
+  this->DecayW(event, iW, p4_W, x4);
+}
+//___________________________________________________________________________
+void GLRESGenerator::DecayW(GHepRecord * event,
+     int iW, const TLorentzVector & p4_W, const TLorentzVector & x4) const
+{
+// Decays the W- in its rest frame, in a channel selected from the W- decay
+// branching ratios. For the V-A coupling, the fermion (l-, d or s or b) is
+// emitted along cos(theta) ~ (1-cos(theta))^2 with respect to the incoming
+// anti-neutrino (the W direction). Quark pairs are showered and fragmented
+// by PYTHIA6.
+
+  RandomGen * rnd = RandomGen::Instance();
+
   double mass = p4_W.M();
-  char p6frame[10], p6nu[10], p6tgt[10];
-  strcpy(p6frame, "CMS"    );
-  strcpy(p6nu,    "nu_ebar");
-  strcpy(p6tgt,   "e-"     );
-  fPythia->Pyinit(p6frame, p6nu, p6tgt, mass);
-  fPythia->Pyevnt();
-  fPythia->Pylist(1);
 
-  // get LUJETS record
-  fPythia->GetPrimaries();
-  TClonesArray * pythia_particles =
-       (TClonesArray *) fPythia->ImportParticles("All");
+  // select decay channel among the open ones
+  double br_open[kNWDecayChannels];
+  double br_sum = 0;
+  for(int ich = 0; ich < kNWDecayChannels; ich++) {
+    const WDecayChannel & ch = kWDecayChannels[ich];
+    double mthr = fMass[ich][0] + fMass[ich][1];
+    if(ch.fHadronic) mthr += kWDecayHadronicMinMassGap;
+    br_open[ich] = (mass > mthr) ? ch.fBR : 0.;
+    br_sum += br_open[ich];
+  }
+  if(br_sum <= 0) {
+    LOG("GLRES", pWARN)
+      << "No open W- decay channel for W mass = " << mass << " GeV";
+    event->EventFlags()->SetBitNumber(kHadroSysGenErr, true);
+    return;
+  }
+  double r = br_sum * rnd->RndHadro().Rndm();
+  int ich = 0;
+  for( ; ich < kNWDecayChannels-1; ich++) {
+    if(r < br_open[ich]) break;
+    r -= br_open[ich];
+  }
+  const WDecayChannel & ch = kWDecayChannels[ich];
 
-  // copy PYTHIA container to a new TClonesArray so as to transfer ownership
-  // of the container and of its elements to the calling method
-  int np = pythia_particles->GetEntries();
-  assert(np>0);
-  TClonesArray * particle_list = new TClonesArray("genie::GHepParticle", np);
-  particle_list->SetOwner(true);
+  LOG("GLRES", pINFO)
+    << "W- (mass = " << mass << " GeV) -> "
+    << PDGLibrary::Instance()->Find(ch.fPdg1)->GetName() << " + "
+    << PDGLibrary::Instance()->Find(ch.fPdg2)->GetName();
+
+  // fermion direction in the W rest frame, w/ respect to the W direction
+  double costheta = 1. - 2. * TMath::Power(1. - rnd->RndHadro().Rndm(), 1./3.);
+  double sintheta = TMath::Sqrt(TMath::Max(0., 1.-costheta*costheta));
+  double phi      = 2*kPi * rnd->RndHadro().Rndm();
+  TVector3 unitvf(sintheta*TMath::Cos(phi), sintheta*TMath::Sin(phi), costheta);
 
   // Vector defining rotation from LAB to LAB' (z:= \vec{resonance momentum})
   TVector3 unitvq = p4_W.Vect().Unit();
@@ -112,21 +166,58 @@ void GLRESGenerator::ProcessEventRecord(GHepRecord * event) const
   // Boost velocity LAB' -> Resonance rest frame
   TVector3 beta(0,0,p4_W.P()/p4_W.Energy());
 
-  GHepParticle * p = 0;
-  TIter piter(pythia_particles);
-  while( (p = (GHepParticle *) piter.Next()) ) {
-     int pdgc = p->Pdg();
-     int ist  = p->Status();
-     if(ist == 1) {
-        TLorentzVector p4o(p->Px(), p->Py(), p->Pz(), p->Energy());
-        p4o.Boost(beta);
-        TVector3 p3 = p4o.Vect();
-        p3.RotateUz(unitvq);
-        TLorentzVector p4(p3,p4o.Energy());
-        event->AddParticle(pdgc, kIStStableFinalState, 4,-1,-1,-1, p4, x4);
-     }
+  if(!ch.fHadronic) {
+    // 2-body leptonic decay
+    double m1 = fMass[ich][0];
+    double m2 = fMass[ich][1];
+    double p  = TMath::Sqrt( (mass*mass - (m1+m2)*(m1+m2)) *
+                             (mass*mass - (m1-m2)*(m1-m2)) ) / (2*mass);
+    int pdg[2] = { ch.fPdg1, ch.fPdg2 };
+    for(int i = 0; i < 2; i++) {
+      TVector3 p3 = (i==0 ? p : -p) * unitvf;
+      TLorentzVector p4o(p3, TMath::Sqrt(p*p + fMass[ich][i]*fMass[ich][i]));
+      p4o.Boost(beta);
+      TVector3 p3l = p4o.Vect();
+      p3l.RotateUz(unitvq);
+      TLorentzVector p4(p3l, p4o.Energy());
+      event->AddParticle(pdg[i], kIStStableFinalState, iW,-1,-1,-1, p4, x4);
+    }
+    return;
   }
 
+  // Hadronic decay: the quark pair is set up back-to-back along z in the
+  // W rest frame (quark along +z), showered and fragmented. No event listing.
+  int ip   = -1;
+  int kf1  = ch.fPdg1;
+  int kf2  = ch.fPdg2;
+  py2ent_(&ip, &kf1, &kf2, &mass);
+  int    ip1  = 1;
+  int    ip2  = 2;
+  pyshow_(&ip1, &ip2, &mass);
+  pyexec_();
+
+  // get LUJETS record
+  fPythia->GetPrimaries();
+  TClonesArray * pythia_particles =
+       (TClonesArray *) fPythia->ImportParticles("All");
+  int np = pythia_particles->GetEntries();
+  assert(np>0);
+
+  TMCParticle * p = 0;
+  TIter piter(pythia_particles);
+  while( (p = (TMCParticle *) piter.Next()) ) {
+     if(p->GetKS() != 1) continue;
+     int pdgc = p->GetKF();
+     // W rest frame (quark along +z) -> W rest frame (quark along unitvf)
+     TVector3 p3r(p->GetPx(), p->GetPy(), p->GetPz());
+     p3r.RotateUz(unitvf);
+     TLorentzVector p4o(p3r, p->GetEnergy());
+     p4o.Boost(beta);
+     TVector3 p3 = p4o.Vect();
+     p3.RotateUz(unitvq);
+     TLorentzVector p4(p3,p4o.Energy());
+     event->AddParticle(pdgc, kIStStableFinalState, iW,-1,-1,-1, p4, x4);
+  }
 }
 //___________________________________________________________________________
 void GLRESGenerator::Configure(const Registry & config)
@@ -147,5 +238,15 @@ void GLRESGenerator::LoadConfig(void)
 
  // sync GENIE/PYTHIA6 seed number
  RandomGen::Instance();
+
+ // masses of the W- decay products
+ PDGLibrary * pdglib = PDGLibrary::Instance();
+ for(int ich = 0; ich < kNWDecayChannels; ich++) {
+   const WDecayChannel & ch = kWDecayChannels[ich];
+   fMass[ich][0] = ch.fHadronic ?
+     fPythia->Pymass(ch.fPdg1) : pdglib->Find(ch.fPdg1)->Mass();
+   fMass[ich][1] = ch.fHadronic ?
+     fPythia->Pymass(ch.fPdg2) : pdglib->Find(ch.fPdg2)->Mass();
+ }
 }
 //____________________________________________________________________________
@@ -5,6 +5,11 @@
 
 \brief    Glashow resonance event generator
 
+          The W- is decayed in a channel selected from its tabulated branching
+          ratios. Leptonic decays are generated directly, and hadronic decays
+          are showered and fragmented with PYTHIA6 (no per-event PYTHIA6
+          initialization).
+
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -39,11 +44,25 @@ public :
   void Configure(const Registry & config);
   void Configure(string config);
 
+  // W- decay channels
+  struct WDecayChannel {
+    int    fPdg1;      ///< fermion
+    int    fPdg2;      ///< anti-fermion
+    double fBR;        ///< branching ratio
+    bool   fHadronic;  ///< quark pair?
+  };
+  static const int           kNWDecayChannels = 8;
+  static const WDecayChannel kWDecayChannels[kNWDecayChannels];
+  static const double        kWDecayHadronicMinMassGap;
+
 private:
 
   void LoadConfig(void);
+  void DecayW    (GHepRecord * event, int iW,
+                  const TLorentzVector & p4_W, const TLorentzVector & x4) const;
 
   mutable TPythia6 * fPythia;   ///< PYTHIA6 wrapper class
+  double fMass[kNWDecayChannels][2];  ///< masses of the decay products
 };
 
 }      // genie namespace
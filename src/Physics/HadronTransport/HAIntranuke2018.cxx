@@ -146,10 +146,15 @@ void HAIntranuke2018::SimulateHadronicFinalState(
   }
 
   // select a fate for the input particle
-  INukeFateHA_t fate = this->HadronFateHA(p);
+  double wght = 1.;
+  INukeFateHA_t fate = this->HadronFateHA(p, wght);
 
-  // store the fate
-  ev->Particle(p->FirstMother())->SetRescatterCode((int)fate);
+  // store the fate, and the weight of biased fate selections (also applied
+  // to the event weight)
+  GHepParticle * mother = ev->Particle(p->FirstMother());
+  mother->SetRescatterCode((int)fate);
+  mother->SetRescatterWeight(wght);
+  if(wght != 1.) ev->SetWeight(wght * ev->Weight());
 
   if(fate == kIHAFtUndefined) {
      LOG("HAIntranuke2018", pERROR) << "** Couldn't select a fate";
@@ -216,16 +221,24 @@ void HAIntranuke2018::SimulateHadronicFinalStateKinematics(
         << p->Name() << " fate: " << INukeHadroFates::AsString(fate)
         << " after " << fNumIterations-1
         << " attempts. Trying a new fate...";
+      // undo the weight of the previous fate selection
+      GHepParticle * mother = ev->Particle(p->FirstMother());
+      ev->SetWeight(ev->Weight() / mother->RescatterWeight());
+      mother->SetRescatterWeight(1.);
       this->SimulateHadronicFinalState(ev,p);
     }
     }
 }
 //___________________________________________________________________________
-INukeFateHA_t HAIntranuke2018::HadronFateHA(const GHepParticle * p) const
+INukeFateHA_t HAIntranuke2018::HadronFateHA(
+  const GHepParticle * p, double & wght) const
 {
-// Select a hadron fate in HA mode
+// Select a hadron fate in HA mode.
+// With fate biasing, fates are selected with probability bias * fraction and
+// wght is set to the compensating weight: (sum{bias * frac} / sum{frac}) / bias
 //
   RandomGen * rnd = RandomGen::Instance();
+  wght = 1.;
 
   // get pdgc code & kinetic energy in MeV
   int    pdgc = p->Pdg();
@@ -237,141 +250,148 @@ INukeFateHA_t HAIntranuke2018::HadronFateHA(const GHepParticle * p) const
   LOG("HAIntranuke2018", pINFO)
    << "Selecting hA fate for " << p->Name() << " with KE = " << ke << " MeV";
 
+  double frac[kNFatesHA];
+  if(!this->FateFractions(pdgc, p->KinE(), nuclA, frac)) return kIHAFtUndefined;
+
+  // fates in the order they are selected (fates not available for
+  // the input hadron have a zero fraction)
+  const int nsel = 5;
+  const INukeFateHA_t fates[nsel] = {
+    kIHAFtCEx, kIHAFtInelas, kIHAFtAbs, kIHAFtPiProd, kIHAFtCmp };
+
+  // compute total fraction (can be <1 if fates have been switched off)
+  double tf = 0;
+  for(int i=0; i<nsel; i++) tf += frac[fates[i]];
+
+  // the fractions the fates are selected with
+  double sel[nsel];
+  double tsel = 0;
+  for(int i=0; i<nsel; i++) {
+    sel[i] = frac[fates[i]];
+    if(fFateBiased) sel[i] *= fFateBias[fates[i]];
+    tsel += sel[i];
+  }
+
   // try to generate a hadron fate
   unsigned int iter = 0;
   while(iter++ < kRjMaxIterations) {
 
-    // handle pions
-    //
-   if (pdgc==kPdgPiP || pdgc==kPdgPiM || pdgc==kPdgPi0) {
-
-     double frac_cex      = fHadroData2018->FracADep(pdgc, kIHAFtCEx,     ke, nuclA);
-     //     double frac_elas     = fHadroData2018->FracADep(pdgc, kIHAFtElas,    ke, nuclA);
-     double frac_inel     = fHadroData2018->FracADep(pdgc, kIHAFtInelas,  ke, nuclA);
-     double frac_abs      = fHadroData2018->FracADep(pdgc, kIHAFtAbs,     ke, nuclA);
-     double frac_piprod   = fHadroData2018->FracADep(pdgc, kIHAFtPiProd,  ke, nuclA);
-     LOG("HAIntranuke2018", pDEBUG)
-          << "\n frac{" << INukeHadroFates::AsString(kIHAFtCEx)     << "} = " << frac_cex
-       //          << "\n frac{" << INukeHadroFates::AsString(kIHAFtElas)    << "} = " << frac_elas
-          << "\n frac{" << INukeHadroFates::AsString(kIHAFtInelas)  << "} = " << frac_inel
-          << "\n frac{" << INukeHadroFates::AsString(kIHAFtAbs)     << "} = " << frac_abs
-          << "\n frac{" << INukeHadroFates::AsString(kIHAFtPiProd)  << "} = " << frac_piprod;
-
-     // apply external tweaks to fractions
-     frac_cex    *= fPionFracCExScale;
-     frac_inel   *= fPionFracInelScale;
-     frac_abs    *= fPionFracAbsScale;
-     frac_piprod *= fPionFracPiProdScale;
-
-     double frac_rescale = 1./(frac_cex + frac_inel + frac_abs + frac_piprod);
-
-     frac_cex    *= frac_rescale;
-     frac_inel   *= frac_rescale;
-     frac_abs    *= frac_rescale;
-     frac_piprod *= frac_rescale;
-
-
-       // compute total fraction (can be <1 if fates have been switched off)
-       double tf = frac_cex      +
-         //                   frac_elas     +
-                   frac_inel     +
-                   frac_abs      +
-                   frac_piprod;
-
-       double r = tf * rnd->RndFsi().Rndm();
+    double r = tsel * rnd->RndFsi().Rndm();
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-       LOG("HAIntranuke2018", pDEBUG) << "r = " << r << " (max = " << tf << ")";
+    LOG("HAIntranuke2018", pDEBUG) << "r = " << r << " (max = " << tsel << ")";
 #endif
-       double cf=0; // current fraction
-       if(r < (cf += frac_cex     )) return kIHAFtCEx;     // cex
-       //       if(r < (cf += frac_elas    )) return kIHAFtElas;    // elas
-       if(r < (cf += frac_inel    )) return kIHAFtInelas;  // inelas
-       if(r < (cf += frac_abs     )) return kIHAFtAbs;     // abs
-       if(r < (cf += frac_piprod  )) return kIHAFtPiProd;  // pi prod
-
-       LOG("HAIntranuke2018", pWARN)
-         << "No selection after going through all fates! "
-                     << "Total fraction = " << tf << " (r = " << r << ")";
+    double cf=0; // current fraction
+    for(int i=0; i<nsel; i++) {
+      if(r < (cf += sel[i])) {
+        if(fFateBiased) wght = (tsel / tf) / fFateBias[fates[i]];
+        return fates[i];
+      }
     }
 
-    // handle nucleons
-    else if (pdgc==kPdgProton || pdgc==kPdgNeutron) {
-      double frac_cex      = fHadroData2018->FracAIndep(pdgc, kIHAFtCEx,    ke);
-      //double frac_elas     = fHadroData2018->FracAIndep(pdgc, kIHAFtElas,   ke);
-      double frac_inel     = fHadroData2018->FracAIndep(pdgc, kIHAFtInelas, ke);
-      double frac_abs      = fHadroData2018->FracAIndep(pdgc, kIHAFtAbs,    ke);
-      double frac_pipro    = fHadroData2018->FracAIndep(pdgc, kIHAFtPiProd, ke);
-      double frac_cmp      = fHadroData2018->FracAIndep(pdgc, kIHAFtCmp   , ke);
-
-      LOG("HAIntranuke2018", pINFO)
-          << "\n frac{" << INukeHadroFates::AsString(kIHAFtCEx)     << "} = " << frac_cex
-        // << "\n frac{" << INukeHadroFates::AsString(kIHAFtElas)    << "} = " << frac_elas
-          << "\n frac{" << INukeHadroFates::AsString(kIHAFtInelas)  << "} = " << frac_inel
-          << "\n frac{" << INukeHadroFates::AsString(kIHAFtAbs)     << "} = " << frac_abs
-          << "\n frac{" << INukeHadroFates::AsString(kIHAFtPiProd)  << "} = " << frac_pipro
-          << "\n frac{" << INukeHadroFates::AsString(kIHAFtCmp)     << "} = " << frac_cmp; //suarez edit, cmp
-
-      // apply external tweaks to fractions
-      frac_cex    *= fNucleonFracCExScale;
-      frac_inel   *= fNucleonFracInelScale;
-      frac_abs    *= fNucleonFracAbsScale;
-      frac_pipro  *= fNucleonFracPiProdScale;
-
-      double frac_rescale = 1./(frac_cex + frac_inel + frac_abs + frac_pipro);
-
-      frac_cex    *= frac_rescale;
-      frac_inel   *= frac_rescale;
-      frac_abs    *= frac_rescale;
-      frac_pipro  *= frac_rescale;
-
-       // compute total fraction (can be <1 if fates have been switched off)
-       double tf = frac_cex      +
-         //frac_elas     +
-                   frac_inel     +
-                   frac_abs      +
-                   frac_pipro    +
-                   frac_cmp;  //suarez edit, cmp
-
-       double r = tf * rnd->RndFsi().Rndm();
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-       LOG("HAIntranuke2018", pDEBUG) << "r = " << r << " (max = " << tf << ")";
-#endif
-       double cf=0; // current fraction
-       if(r < (cf += frac_cex     )) return kIHAFtCEx;     // cex
-       //if(r < (cf += frac_elas    )) return kIHAFtElas;    // elas
-       if(r < (cf += frac_inel    )) return kIHAFtInelas;  // inelas
-       if(r < (cf += frac_abs     )) return kIHAFtAbs;     // abs
-       if(r < (cf += frac_pipro   )) return kIHAFtPiProd;  // pi prod
-       if(r < (cf += frac_cmp     )) return kIHAFtCmp;  //suarez edit, cmp
-
-       LOG("HAIntranuke2018", pWARN)
-         << "No selection after going through all fates! "
-                        << "Total fraction = " << tf << " (r = " << r << ")";
-    }
-    // handle kaons
-    else if (pdgc==kPdgKP || pdgc==kPdgKM) {
-       double frac_inel     = fHadroData2018->FracAIndep(pdgc, kIHAFtInelas,  ke);
-       double frac_abs      = fHadroData2018->FracAIndep(pdgc, kIHAFtAbs,     ke);
-
-       LOG("HAIntranuke2018", pDEBUG)
-          << "\n frac{" << INukeHadroFates::AsString(kIHAFtInelas)  << "} = " << frac_inel
-          << "\n frac{" << INukeHadroFates::AsString(kIHAFtAbs)     << "} = " << frac_abs;
-       // compute total fraction (can be <1 if fates have been switched off)
-       double tf =  frac_inel     +
-         frac_abs;
-      double r = tf * rnd->RndFsi().Rndm();
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-       LOG("HAIntranuke2018", pDEBUG) << "r = " << r << " (max = " << tf << ")";
-#endif
-       double cf=0; // current fraction
-       if(r < (cf += frac_inel    )) return kIHAFtInelas;  // inelas
-       if(r < (cf += frac_abs     )) return kIHAFtAbs;     // abs
-    }
+    LOG("HAIntranuke2018", pWARN)
+      << "No selection after going through all fates! "
+      << "Total fraction = " << tf << " (r = " << r << ")";
   }//iterations
 
   return kIHAFtUndefined;
 }
 //___________________________________________________________________________
+bool HAIntranuke2018::FateFractions(
+  int pdgc, double ke, int A, double frac[kNFatesHA]) const
+{
+// Computes the hA fate fractions, including the configured tweaks, for a
+// hadron with the input kinetic energy (in GeV) in a nucleus of mass number A.
+// The fractions are indexed by INukeFateHA_t. Returns false if the hadron
+// can not be handled.
+
+  for(int i=0; i<kNFatesHA; i++) frac[i] = 0.;
+
+  ke /= units::MeV;
+
+  // handle pions
+  //
+  if (pdgc==kPdgPiP || pdgc==kPdgPiM || pdgc==kPdgPi0) {
+
+    // fractions order: see INukeHadroData2018::kFracADepFates
+    double frac_adep[INukeHadroData2018::kNFracADep];
+    fHadroData2018->FracADep(pdgc, ke, A, frac_adep);
+    double frac_cex      = frac_adep[0];
+    //     double frac_elas     = fHadroData2018->FracADep(pdgc, kIHAFtElas,    ke, A);
+    double frac_inel     = frac_adep[1];
+    double frac_abs      = frac_adep[2];
+    double frac_piprod   = frac_adep[3];
+    LOG("HAIntranuke2018", pDEBUG)
+         << "\n frac{" << INukeHadroFates::AsString(kIHAFtCEx)     << "} = " << frac_cex
+      //          << "\n frac{" << INukeHadroFates::AsString(kIHAFtElas)    << "} = " << frac_elas
+         << "\n frac{" << INukeHadroFates::AsString(kIHAFtInelas)  << "} = " << frac_inel
+         << "\n frac{" << INukeHadroFates::AsString(kIHAFtAbs)     << "} = " << frac_abs
+         << "\n frac{" << INukeHadroFates::AsString(kIHAFtPiProd)  << "} = " << frac_piprod;
+
+    // apply external tweaks to fractions
+    frac_cex    *= fPionFracCExScale;
+    frac_inel   *= fPionFracInelScale;
+    frac_abs    *= fPionFracAbsScale;
+    frac_piprod *= fPionFracPiProdScale;
+
+    double frac_rescale = 1./(frac_cex + frac_inel + frac_abs + frac_piprod);
+
+    frac[kIHAFtCEx]    = frac_cex    * frac_rescale;
+    frac[kIHAFtInelas] = frac_inel   * frac_rescale;
+    frac[kIHAFtAbs]    = frac_abs    * frac_rescale;
+    frac[kIHAFtPiProd] = frac_piprod * frac_rescale;
+    return true;
+  }
+
+  // handle nucleons
+  else if (pdgc==kPdgProton || pdgc==kPdgNeutron) {
+    double frac_cex      = fHadroData2018->FracAIndep(pdgc, kIHAFtCEx,    ke);
+    //double frac_elas     = fHadroData2018->FracAIndep(pdgc, kIHAFtElas,   ke);
+    double frac_inel     = fHadroData2018->FracAIndep(pdgc, kIHAFtInelas, ke);
+    double frac_abs      = fHadroData2018->FracAIndep(pdgc, kIHAFtAbs,    ke);
+    double frac_pipro    = fHadroData2018->FracAIndep(pdgc, kIHAFtPiProd, ke);
+    double frac_cmp      = fHadroData2018->FracAIndep(pdgc, kIHAFtCmp   , ke);
+
+    LOG("HAIntranuke2018", pINFO)
+        << "\n frac{" << INukeHadroFates::AsString(kIHAFtCEx)     << "} = " << frac_cex
+      // << "\n frac{" << INukeHadroFates::AsString(kIHAFtElas)    << "} = " << frac_elas
+        << "\n frac{" << INukeHadroFates::AsString(kIHAFtInelas)  << "} = " << frac_inel
+        << "\n frac{" << INukeHadroFates::AsString(kIHAFtAbs)     << "} = " << frac_abs
+        << "\n frac{" << INukeHadroFates::AsString(kIHAFtPiProd)  << "} = " << frac_pipro
+        << "\n frac{" << INukeHadroFates::AsString(kIHAFtCmp)     << "} = " << frac_cmp; //suarez edit, cmp
+
+    // apply external tweaks to fractions
+    frac_cex    *= fNucleonFracCExScale;
+    frac_inel   *= fNucleonFracInelScale;
+    frac_abs    *= fNucleonFracAbsScale;
+    frac_pipro  *= fNucleonFracPiProdScale;
+
+    double frac_rescale = 1./(frac_cex + frac_inel + frac_abs + frac_pipro);
+
+    frac[kIHAFtCEx]    = frac_cex   * frac_rescale;
+    frac[kIHAFtInelas] = frac_inel  * frac_rescale;
+    frac[kIHAFtAbs]    = frac_abs   * frac_rescale;
+    frac[kIHAFtPiProd] = frac_pipro * frac_rescale;
+    frac[kIHAFtCmp]    = frac_cmp;  //suarez edit, cmp
+    return true;
+  }
+
+  // handle kaons
+  else if (pdgc==kPdgKP || pdgc==kPdgKM) {
+    double frac_inel     = fHadroData2018->FracAIndep(pdgc, kIHAFtInelas,  ke);
+    double frac_abs      = fHadroData2018->FracAIndep(pdgc, kIHAFtAbs,     ke);
+
+    LOG("HAIntranuke2018", pDEBUG)
+       << "\n frac{" << INukeHadroFates::AsString(kIHAFtInelas)  << "} = " << frac_inel
+       << "\n frac{" << INukeHadroFates::AsString(kIHAFtAbs)     << "} = " << frac_abs;
+
+    frac[kIHAFtInelas] = frac_inel;
+    frac[kIHAFtAbs]    = frac_abs;
+    return true;
+  }
+
+  return false;
+}
+//___________________________________________________________________________
 double HAIntranuke2018::PiBounce(void) const
 {
 // [adapted from neugen3 intranuke_bounce.F]
@@ -654,7 +674,7 @@ void HAIntranuke2018::InelasticHA(
       t.SetMomentum(0,0,0,tM);
     }
 
-  GHepParticle * cl = new GHepParticle(*p); // clone particle, to run IntBounce at proper energy
+  GHepParticle * cl = this->CloneParticle(*p, 1); // clone particle, to run IntBounce at proper energy
                                             // calculate energy and momentum using invariant mass
   double pM  = p->Mass();
   double E_p = ((*p->P4() + *t.P4()).Mag2() - tM*tM - pM*pM)/(2.0*tM);
@@ -662,7 +682,6 @@ void HAIntranuke2018::InelasticHA(
   cl->SetMomentum(TLorentzVector(P_p,0,0,E_p));
                   // momentum doesn't have to be in right direction, only magnitude
   double C3CM = fHadroData2018->IntBounce(cl,tcode,scode,h_fate);
-  delete cl;
   if (C3CM<-1.)   // hope this doesn't occur too often - unphysical but we just pass it on
     {
       LOG("HAIntranuke2018", pWARN) << "unphysical angle chosen in InelasicHA - put particle outside nucleus";
@@ -980,8 +999,8 @@ void HAIntranuke2018::Inelastic(
 
               // create t particles w/ appropriate momenta, code, and status
               // Set target's mom to be the mom of the hadron that was cloned
-              GHepParticle* t1 = new GHepParticle(*p);
-              GHepParticle* t2 = new GHepParticle(*p);
+              GHepParticle* t1 = this->CloneParticle(*p, 1);
+              GHepParticle* t2 = this->CloneParticle(*p, 2);
               t1->SetFirstMother(p->FirstMother());
               t1->SetLastMother(p->LastMother());
               t2->SetFirstMother(p->FirstMother());
@@ -999,8 +1018,6 @@ void HAIntranuke2018::Inelastic(
 
               ev->AddParticle(*t1);
               ev->AddParticle(*t2);
-              delete t1;
-              delete t2;
 
               return;
             }
@@ -1541,12 +1558,16 @@ void HAIntranuke2018::LoadConfig(void)
   GetParam( "INUKE-DoCompoundNucleus", fDoCompoundNucleus ) ;
   GetParam( "INUKE-DoFermi",           fDoFermi ) ;
   GetParam( "INUKE-XsecNNCorr",        fXsecNNCorr ) ;
+  GetParamDef( "INUKE-TabulateMFP",    fTabulateMFP, false ) ;
   GetParamDef( "UseOset",              fUseOset, false ) ;
   GetParamDef( "AltOset",              fAltOset, false ) ;
 
   GetParam( "HAINUKE-DelRPion",    fDelRPion ) ;
   GetParam( "HAINUKE-DelRNucleon", fDelRNucleon ) ;
 
+  fStepConfig = INukeStepConfig(kIMdHA, fDelRPion, fDelRNucleon,
+                                fUseOset, fAltOset, fXsecNNCorr);
+
   GetParamDef( "FSI-Pion-MFPScale",              fPionMFPScale,           1.0 ) ;
   GetParamDef( "FSI-Pion-FracCExScale",          fPionFracCExScale,       1.0 ) ;
   GetParamDef( "FSI-Pion-FracAbsScale",          fPionFracAbsScale,       1.0 ) ;
@@ -1558,6 +1579,33 @@ void HAIntranuke2018::LoadConfig(void)
   GetParamDef( "FSI-Nucleon-FracAbsScale",       fNucleonFracAbsScale,    1.0 ) ;
   GetParamDef( "FSI-Nucleon-FracPiProdScale",    fNucleonFracPiProdScale, 1.0 ) ;
 
+  // fate selection biasing (weighted events, see HadronFateHA())
+  const int nbias = 5;
+  const INukeFateHA_t bias_fates[nbias] = {
+    kIHAFtCEx, kIHAFtInelas, kIHAFtAbs, kIHAFtPiProd, kIHAFtCmp };
+  const char * bias_keys[nbias] = {
+    "FSI-FateBias-CEx", "FSI-FateBias-Inelas", "FSI-FateBias-Abs",
+    "FSI-FateBias-PiProd", "FSI-FateBias-Cmp" };
+  fFateBiased = false;
+  for(int i=0; i<kNFatesHA; i++) fFateBias[i] = 1.;
+  for(int i=0; i<nbias; i++) {
+    double bias = 1.;
+    GetParamDef( bias_keys[i], bias, 1.0 ) ;
+    if(bias <= 0.) {
+      LOG("HAIntranuke2018", pFATAL)
+        << "Invalid " << bias_keys[i] << " = " << bias << " (must be > 0)";
+      gAbortingInErr = true;
+      exit(1);
+    }
+    fFateBias[bias_fates[i]] = bias;
+    if(bias != 1.) {
+      fFateBiased = true;
+      LOG("HAIntranuke2018", pNOTICE)
+        << "Biasing " << INukeHadroFates::AsString(bias_fates[i])
+        << " fates by a factor of " << bias;
+    }
+  }
+
     // report
   LOG("HAIntranuke2018", pINFO) << "Settings for INTRANUKE mode: " << INukeMode::AsString(kIMdHA);
   LOG("HAIntranuke2018", pINFO) << "R0          = " << fR0 << " fermi";
@@ -62,6 +62,13 @@ public :
   virtual string GetINukeMode() const {return "hA2018";};
   virtual string GetGenINukeMode() const {return "hA";};
 
+  //! number of hA fates (size of the FateFractions() array)
+  static const int kNFatesHA = kIHAFtDCEx + 1;
+
+  //! hA fate fractions, indexed by INukeFateHA_t, for a hadron with kinetic
+  //! energy ke (in GeV) in a nucleus of mass number A
+  bool FateFractions (int pdgc, double ke, int A, double frac[kNFatesHA]) const;
+
 private:
 
   void LoadConfig (void);
@@ -69,7 +76,7 @@ private:
   void  SimulateHadronicFinalState           (GHepRecord* ev, GHepParticle* p) const;
   void  SimulateHadronicFinalStateKinematics (GHepRecord* ev, GHepParticle* p) const;
 
-  INukeFateHA_t HadronFateHA     (const GHepParticle* p) const;
+  INukeFateHA_t HadronFateHA     (const GHepParticle* p, double & wght) const;
   //INukeFateHA_t HadronFateOset   (void) const;
   void          Inelastic        (GHepRecord* ev, GHepParticle* p, INukeFateHA_t fate) const;
   void          ElasHA           (GHepRecord* ev, GHepParticle* p, INukeFateHA_t fate) const;
@@ -79,6 +86,8 @@ private:
   int           HandleCompoundNucleus(GHepRecord* ev, GHepParticle* p, int mom) const;           
 
   mutable int nuclA;     ///< value of A for the target nucleus in hA mode
+  double fFateBias[kNFatesHA]; ///< fate selection bias factors (FSI-FateBias-*)
+  bool   fFateBiased;          ///< any fate bias factors != 1?
   mutable unsigned int fNumIterations;
 };
 
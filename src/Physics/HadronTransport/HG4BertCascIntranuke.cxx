@@ -63,20 +63,34 @@ using namespace genie::controls;
 
 //___________________________________________________________________________
 HG4BertCascIntranuke::HG4BertCascIntranuke()
-  : EventRecordVisitorI("genie::HG4BertCascIntranuke")
+  : EventRecordVisitorI("genie::HG4BertCascIntranuke"), fCollider(0)
 {
   InitG4Particles();
 }
 
 //___________________________________________________________________________
 HG4BertCascIntranuke::HG4BertCascIntranuke(string config)
-  : EventRecordVisitorI("genie::HG4BertCascIntranuke", config)
+  : EventRecordVisitorI("genie::HG4BertCascIntranuke", config), fCollider(0)
 {
   InitG4Particles();
 }
 //___________________________________________________________________________
 HG4BertCascIntranuke::~HG4BertCascIntranuke()
 {
+  if ( fCollider ) { delete fCollider; fCollider=0; }
+}
+//___________________________________________________________________________
+G4InuclCollider * HG4BertCascIntranuke::Collider(void) const
+{
+// The Bertini collider (with its cascade, pre-equilibrium and de-excitation
+// models) is built at the first cascade and reused for all events, as in
+// the Geant4 G4CascadeInterface
+
+  if ( ! fCollider ) {
+    fCollider = new G4InuclCollider();
+    fCollider->useCascadeDeexcitation();
+  }
+  return fCollider;
 }
 //___________________________________________________________________________
 int HG4BertCascIntranuke::G4BertCascade(GHepRecord * evrec) const{
@@ -129,10 +143,8 @@ int HG4BertCascIntranuke::G4BertCascade(GHepRecord * evrec) const{
 
     // Set up output and start the cascade
     G4CollisionOutput cascadeOutput;
-    G4InuclCollider bertCollider;
-    bertCollider.useCascadeDeexcitation();
     //collide
-    bertCollider.collide(incident,theNucleus,cascadeOutput);
+    this->Collider()->collide(incident,theNucleus,cascadeOutput);
 
     delete incident;
     delete theNucleus;
@@ -527,10 +539,8 @@ void HG4BertCascIntranuke::TransportHadrons(GHepRecord * evrec) const
     int Nsec = g4secondaries->size();
     // Set up output and start the cascade
     G4CollisionOutput cascadeOutput;
-    G4InuclCollider bertCollider;
-    bertCollider.useCascadeDeexcitation();
-    // bertCollider.setVerboseLevel(3);
-    bertCollider.rescatter(incident, g4secondaries, g4Nucleus, cascadeOutput);
+    // this->Collider()->setVerboseLevel(3);
+    this->Collider()->rescatter(incident, g4secondaries, g4Nucleus, cascadeOutput);
     delete incident;
     delete g4Nucleus;
     for (int n = 0; n < Nsec; n++) delete (*g4secondaries)[n];
@@ -32,6 +32,7 @@ class TVector3;
 
 class G4ParticleDefinition;
 class G4KineticTrackVector;
+class G4InuclCollider;
 
 namespace genie {
 
@@ -60,6 +61,7 @@ private:
   void LoadConfig (void);
 
   void InitG4Particles() const;
+  G4InuclCollider * Collider(void) const;
   void TransportHadrons(GHepRecord* ev) const;
   const G4ParticleDefinition* PDGtoG4Particle(int pdg) const;
   G4KineticTrackVector* ConvertGenieSecondariesToG4(GHepRecord* evrec) const;
@@ -75,6 +77,7 @@ private:
   bool   NeedsRescattering  (const GHepParticle * p) const;
 
   // utility objects & params
+  mutable G4InuclCollider * fCollider; // Bertini collider, reused for all events
   mutable double fTrackingRadius;  // tracking radius for nucleus current event
 
   const NuclearModelI* fNuclmodel; // nuclear model used to generate fermi momentum
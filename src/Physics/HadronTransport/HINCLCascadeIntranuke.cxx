@@ -571,7 +571,7 @@ void HINCLCascadeIntranuke::TransportHadrons(GHepRecord * evrec) const {
       continue; // <-- skip to next GHEP entry
     }
 
-    TLorentzVector *v4= sp->GetX4();
+    const TLorentzVector *v4= sp->X4();
 
     ThreeVector thePosition(0.,0.,0.);
     ThreeVector momentum (0.,0.,0.);
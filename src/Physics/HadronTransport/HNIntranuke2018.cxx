@@ -222,7 +222,12 @@ INukeFateHN_t HNIntranuke2018::HadronFateHN(const GHepParticle * p) const
   LOG("HNIntranuke2018", pNOTICE) 
    << "Selecting hN fate for " << p->Name() << " with KE = " << ke << " MeV";
 
-   // try to generate a hadron fate
+   // all the fate fractions, in INukeHadroData2018::kHNFates order
+  // (cex, elas, inelas, abs, cmp)
+  double frac_hn[INukeHadroData2018::kNHNFates];
+  fHadroData2018->Fracs(pdgc, ke, fRemnA, fRemnZ, frac_hn);
+
+  // try to generate a hadron fate
   unsigned int iter = 0;
   while(iter++ < kRjMaxIterations) {
 
@@ -230,14 +235,10 @@ INukeFateHN_t HNIntranuke2018::HadronFateHN(const GHepParticle * p) const
     //
     if (pdgc==kPdgPiP || pdgc==kPdgPiM || pdgc==kPdgPi0) {
 
-       double frac_cex      = this->FateWeight(pdgc, kIHNFtCEx)
-	                            * fHadroData2018->Frac(pdgc, kIHNFtCEx,     ke, fRemnA, fRemnZ);
-       double frac_elas     = this->FateWeight(pdgc, kIHNFtElas)
-	                            * fHadroData2018->Frac(pdgc, kIHNFtElas,    ke, fRemnA, fRemnZ);
-       double frac_inel     = this->FateWeight(pdgc, kIHNFtInelas)
-	                            * fHadroData2018->Frac(pdgc, kIHNFtInelas,  ke, fRemnA, fRemnZ);
-       double frac_abs      = this->FateWeight(pdgc, kIHNFtAbs)
-	                            * fHadroData2018->Frac(pdgc, kIHNFtAbs,     ke, fRemnA, fRemnZ);
+       double frac_cex      = this->FateWeight(pdgc, kIHNFtCEx)    * frac_hn[0];
+       double frac_elas     = this->FateWeight(pdgc, kIHNFtElas)   * frac_hn[1];
+       double frac_inel     = this->FateWeight(pdgc, kIHNFtInelas) * frac_hn[2];
+       double frac_abs      = this->FateWeight(pdgc, kIHNFtAbs)    * frac_hn[3];
 
        frac_cex     *= fNucCEXFac;    // scaling factors
        frac_abs     *= fNucAbsFac;
@@ -278,12 +279,9 @@ INukeFateHN_t HNIntranuke2018::HadronFateHN(const GHepParticle * p) const
     // handle nucleons
     else if (pdgc==kPdgProton || pdgc==kPdgNeutron) {
 
-      double frac_elas     = this->FateWeight(pdgc, kIHNFtElas)
-	                           * fHadroData2018->Frac(pdgc, kIHNFtElas,   ke, fRemnA, fRemnZ);
-      double frac_inel     = this->FateWeight(pdgc, kIHNFtInelas)
-	                           * fHadroData2018->Frac(pdgc, kIHNFtInelas, ke, fRemnA, fRemnZ);
-      double frac_cmp      = this->FateWeight(pdgc, kIHNFtCmp)
-	                           * fHadroData2018->Frac(pdgc, kIHNFtCmp,    ke, fRemnA , fRemnZ);
+      double frac_elas     = this->FateWeight(pdgc, kIHNFtElas)   * frac_hn[1];
+      double frac_inel     = this->FateWeight(pdgc, kIHNFtInelas) * frac_hn[2];
+      double frac_cmp      = this->FateWeight(pdgc, kIHNFtCmp)    * frac_hn[4];
 
       LOG("HNIntranuke2018", pINFO) 
 	<< "\n frac{" << INukeHadroFates::AsString(kIHNFtElas)    << "} = " << frac_elas
@@ -316,10 +314,8 @@ INukeFateHN_t HNIntranuke2018::HadronFateHN(const GHepParticle * p) const
     else if (pdgc==kPdgGamma)  return kIHNFtInelas;
     // Handle kaon -- elastic + charge exchange
     else if (pdgc==kPdgKP){
-       double frac_cex      = this->FateWeight(pdgc, kIHNFtCEx)
-	                            * fHadroData2018->Frac(pdgc, kIHNFtCEx,     ke, fRemnA, fRemnZ);
-       double frac_elas     = this->FateWeight(pdgc, kIHNFtElas)
-	                            * fHadroData2018->Frac(pdgc, kIHNFtElas,    ke, fRemnA, fRemnZ);
+       double frac_cex      = this->FateWeight(pdgc, kIHNFtCEx)  * frac_hn[0];
+       double frac_elas     = this->FateWeight(pdgc, kIHNFtElas) * frac_hn[1];
 
        //       frac_cex     *= fNucCEXFac;    // scaling factors
        //       frac_elas    *= fNucQEFac;   // Flor - Correct scaling factors?
@@ -628,7 +624,7 @@ void HNIntranuke2018::AbsorbHN(
 
   // create t particle w/ appropriate momenta, code, and status
   // set target's mom to be the mom of the hadron that was cloned
-  GHepParticle * t = new GHepParticle(*p);
+  GHepParticle * t = this->CloneParticle(*p, 1);
   t->SetFirstMother(p->FirstMother());
   t->SetLastMother(p->LastMother());
 
@@ -652,8 +648,6 @@ void HNIntranuke2018::AbsorbHN(
 
   ev->AddParticle(*p);
   ev->AddParticle(*t);
-
-  delete t; // delete particle clone
 }
 //___________________________________________________________________________
 void HNIntranuke2018::ElasHN(
@@ -716,7 +710,7 @@ void HNIntranuke2018::ElasHN(
     }
 
   // create scattered particle
-  GHepParticle * t = new GHepParticle(*p);
+  GHepParticle * t = this->CloneParticle(*p, 1);
   t->SetPdgCode(tcode);
   double Mt = t->Mass();
   //t->SetMomentum(TLorentzVector(0,0,0,Mt));
@@ -754,15 +748,11 @@ void HNIntranuke2018::ElasHN(
     ev->AddParticle(*t);
   } else
   {
-    delete t; //fixes memory leak
     LOG("HNIntranuke2018", pINFO) << "Elastic in hN failed calling TwoBodyCollision";
     exceptions::INukeException exception;
     exception.SetReason("hN scattering kinematics through TwoBodyCollision failed");
     throw exception;
   }
-
-  delete t;
-
 }
 //___________________________________________________________________________
 void HNIntranuke2018::InelasticHN(GHepRecord* ev, GHepParticle* p) const
@@ -856,7 +846,7 @@ void HNIntranuke2018::GammaInelasticHN(GHepRecord* ev, GHepParticle* p, INukeFat
   LOG("HNIntranuke2018", pNOTICE)
     << " scattering angle: " << C3CM;
 
-  GHepParticle * t = new GHepParticle(*p);
+  GHepParticle * t = this->CloneParticle(*p, 1);
   t->SetPdgCode(tcode);
   double Mt = t->Mass();
 
@@ -897,9 +887,6 @@ void HNIntranuke2018::GammaInelasticHN(GHepRecord* ev, GHepParticle* p, INukeFat
   {
     ev->AddParticle(*p);
   }
-
-  delete t;
-
 }
 //___________________________________________________________________________
 int HNIntranuke2018::HandleCompoundNucleus(GHepRecord* ev, GHepParticle* p, int mom) const
@@ -915,14 +902,13 @@ int HNIntranuke2018::HandleCompoundNucleus(GHepRecord* ev, GHepParticle* p, int
 	{
 	  if(fRemnA>4)  //this needs to be matched to what is in PreEq and Eq
             {
-              GHepParticle * sp = new GHepParticle(*p);
+              GHepParticle * sp = this->CloneParticle(*p, 1);
               sp->SetFirstMother(mom);
 	      // this was PreEquilibrium - now just used for hN
 	      //same arguement lists for PreEq and Eq
 	      utils::intranuke2018::Equilibrium(ev,sp,fRemnA,fRemnZ,fRemnP4,
 					       fDoFermi,fFermiFac,fNuclmodel,fNucRmvE,kIMdHN);
 
-              delete sp;
               return 2;
             }
 	  else
@@ -930,11 +916,10 @@ int HNIntranuke2018::HandleCompoundNucleus(GHepRecord* ev, GHepParticle* p, int
               // nothing left to interact with!
               LOG("HNIntranuke2018", pNOTICE)
                 << "*** Nothing left to interact with, escaping.";
-              GHepParticle * sp = new GHepParticle(*p);
+              GHepParticle * sp = this->CloneParticle(*p, 1);
               sp->SetFirstMother(mom);
               sp->SetStatus(kIStStableFinalState);
               ev->AddParticle(*sp);
-              delete sp;
               return 1;
             }
 	}
@@ -973,12 +958,16 @@ void HNIntranuke2018::LoadConfig(void)
   GetParam( "INUKE-DoCompoundNucleus", fDoCompoundNucleus ) ;
   GetParam( "INUKE-DoFermi",           fDoFermi ) ;
   GetParam( "INUKE-XsecNNCorr",        fXsecNNCorr ) ;
+  GetParamDef( "INUKE-TabulateMFP",    fTabulateMFP, false ) ;
   GetParamDef( "AltOset",              fAltOset, false ) ;
 
   GetParam( "HNINUKE-UseOset",     fUseOset ) ;
   GetParam( "HNINUKE-DelRPion",    fDelRPion ) ;
   GetParam( "HNINUKE-DelRNucleon", fDelRNucleon ) ;
 
+  fStepConfig = INukeStepConfig(kIMdHN, fDelRPion, fDelRNucleon,
+                                fUseOset, fAltOset, fXsecNNCorr);
+
   // report
   LOG("HNIntranuke2018", pINFO) << "Settings for Intranuke2018 mode: " << INukeMode::AsString(kIMdHN);
   LOG("HNIntranuke2018", pWARN) << "R0          = " << fR0 << " fermi";
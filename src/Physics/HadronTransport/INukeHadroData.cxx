@@ -45,6 +45,7 @@
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Numerical/Spline.h"
 #include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/Utils/StartupProfiler.h"
 
 using std::ostringstream;
 using std::ios;
@@ -184,6 +185,8 @@ void INukeHadroData::LoadCrossSections(void)
 {
 // Loads hadronic x-section data
 
+  StartupTimer timer("INTRANUKE hadron data loading");
+
   //-- Get the top-level directory with input hadron cross-section data
   //   (search for $GINUKEHADRONDATA or use default location)
   string data_dir = (gSystem->Getenv("GINUKEHADRONDATA")) ?
@@ -37,6 +37,8 @@
 
 #include <cassert>
 #include <string>
+#include <initializer_list>
+#include <mutex>
 
 #include <TSystem.h>
 #include <TNtupleD.h>
@@ -53,6 +55,7 @@
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Numerical/Spline.h"
 #include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/Utils/StartupProfiler.h"
 
 using std::ostringstream;
 using std::ios;
@@ -66,10 +69,17 @@ INukeHadroData2018 * INukeHadroData2018::fInstance = 0;
 double INukeHadroData2018::fMinKinEnergy   =    1.0; // MeV
 double INukeHadroData2018::fMaxKinEnergyHA =  999.0; // MeV
 double INukeHadroData2018::fMaxKinEnergyHN = 1799.0; // MeV
+const INukeFateHA_t INukeHadroData2018::kFracADepFates[kNFracADep] =
+  { kIHAFtCEx, kIHAFtInelas, kIHAFtAbs, kIHAFtPiProd };
+const INukeFateHN_t INukeHadroData2018::kHNFates[kNHNFates] =
+  { kIHNFtCEx, kIHNFtElas, kIHNFtInelas, kIHNFtAbs, kIHNFtCmp };
 //____________________________________________________________________________
 INukeHadroData2018::INukeHadroData2018()
 {
+  for(int A = 0; A <= kMaxFracADepA; A++) fFracADepTables[A] = 0;
+
   this->LoadCrossSections();
+  this->BuildHNXSecTables();
   fInstance = 0;
 }
 //____________________________________________________________________________
@@ -162,6 +172,8 @@ INukeHadroData2018::~INukeHadroData2018()
 //  delete TfracPipA_Elas;
   delete TfracPipA_Inelas;
   delete TfracPipA_PiPro;
+
+  for(int A = 0; A <= kMaxFracADepA; A++) delete [] fFracADepTables[A].load();
   
   // K+A x-section fraction splines
   delete fFracKA_Tot;
@@ -174,11 +186,18 @@ INukeHadroData2018::~INukeHadroData2018()
 //____________________________________________________________________________
 INukeHadroData2018 * INukeHadroData2018::Instance()
 {
+// The hadron x-section tables are shared (read-only) by all event generation
+// threads. Make sure that only one of them loads the data.
+
   if(fInstance == 0) {
-    LOG("INukeData", pINFO) << "INukeHadroData2018 late initialization";
-    static INukeHadroData2018::Cleaner cleaner;
-    cleaner.DummyMethodAndSilentCompiler();
-    fInstance = new INukeHadroData2018;
+    static std::mutex init_mutex;
+    std::lock_guard<std::mutex> lock(init_mutex);
+    if(fInstance == 0) {
+      LOG("INukeData", pINFO) << "INukeHadroData2018 late initialization";
+      static INukeHadroData2018::Cleaner cleaner;
+      cleaner.DummyMethodAndSilentCompiler();
+      fInstance = new INukeHadroData2018;
+    }
   }
   return fInstance;
 }
@@ -187,6 +206,8 @@ void INukeHadroData2018::LoadCrossSections(void)
 {
 // Loads hadronic x-section data
 
+  StartupTimer timer("INTRANUKE hadron data loading");
+
   //-- Get the top-level directory with input hadron cross-section data
   //   (search for $GINUKEHADRONDATA or use default location)
   string data_dir = (gSystem->Getenv("GINUKEHADRONDATA")) ?
@@ -1379,42 +1400,82 @@ double INukeHadroData2018::FracADep(int hpdgc, INukeFateHA_t fate, double ke, in
   // return the x-section fraction for the input fate for the particle with the input pdg
   // code and the target with the input mass number at the input kinetic energy
 
+  double frac[kNFracADep];
+  if ( ! this->FracADep(hpdgc, ke, targA, frac) ) {
+    LOG("INukeData", pWARN) << "Can't handle particles with pdg code = " << hpdgc;
+    return 0.;
+  }
+
+  for ( int i = 0; i < kNFracADep; i++ ) {
+    if ( fate == kFracADepFates[i] ) return frac[i];
+  }
+
+  std::string sign("+");
+  if ( hpdgc == kPdgPiM ) sign = "-";
+  else if ( hpdgc == kPdgPi0 ) sign = "0";
+  LOG("INukeData", pWARN) << "Pi" << sign << "'s don't have this fate: " << INukeHadroFates::AsString(fate);
+  return 0.;
+}
+//____________________________________________________________________________
+bool INukeHadroData2018::FracADep(int hpdgc, double ke, int targA, double frac[]) const
+{
+  // return all the x-section fractions of kFracADepFates, renormalized to unity,
+  // for the particle with the input pdg code and the target with the input mass
+  // number at the input kinetic energy
+
+  // Handle pions (currently the same cross sections are used for pi+, pi-, and pi0)
+  if ( hpdgc != kPdgPiP && hpdgc != kPdgPiM && hpdgc != kPdgPi0 ) return false;
+
   ke = TMath::Max(fMinKinEnergy,   ke);  // ke >= 1 MeV
   ke = TMath::Min(fMaxKinEnergyHA, ke);  // ke <= 999 MeV
 
-  targA = TMath::Min(208, targA);  // A <= 208
+  targA = TMath::Min(kMaxFracADepA, TMath::Max(1, targA));  // 1 <= A <= 208
 
   LOG("INukeData", pDEBUG)  << "Querying hA cross section at ke  = " << ke << " and target " << targA;
 
-  // Handle pions (currently the same cross sections are used for pi+, pi-, and pi0)
-  if ( hpdgc == kPdgPiP || hpdgc == kPdgPiM || hpdgc == kPdgPi0 ) {
+  const double * table = this->FracADepTable(targA);
 
-    double frac_cex = TfracPipA_CEx->Interpolate(targA, ke);
-    //double frac_elas = TfracPipA_Elas->Interpolate(targA, ke);
-    double frac_inelas = TfracPipA_Inelas->Interpolate(targA, ke);
-    double frac_abs = TfracPipA_Abs->Interpolate(targA, ke);
-    double frac_pipro = TfracPipA_PiPro->Interpolate(targA, ke);
+  double t = ke - fMinKinEnergy;
+  int ike = TMath::Min( (int) t, kNFracADepKE - 2 );
+  t -= ike;
 
-    // Protect against unitarity violation due to interpolation problems
-    // by renormalizing all available fate fractions to unity.
-    double total = frac_cex + frac_inelas + frac_abs + frac_pipro; // + frac_elas
+  const double * f0 = table + ike * kNFracADep;
+  const double * f1 = f0 + kNFracADep;
+  for ( int i = 0; i < kNFracADep; i++ ) frac[i] = f0[i] + t * (f1[i] - f0[i]);
 
-    if ( fate == kIHAFtCEx ) return frac_cex / total;
-  //else if ( fate == kIHAFtElas   ) return frac_elas / total;
-    else if ( fate == kIHAFtInelas ) return frac_inelas / total;
-    else if ( fate == kIHAFtAbs    ) return frac_abs / total;
-    else if ( fate == kIHAFtPiProd ) return frac_pipro / total;
-    else {
-      std::string sign("+");
-      if ( hpdgc == kPdgPiM ) sign = "-";
-      else if ( hpdgc == kPdgPi0 ) sign = "0";
-      LOG("INukeData", pWARN) << "Pi" << sign << "'s don't have this fate: " << INukeHadroFates::AsString(fate);
-      return 0.;
+  return true;
+}
+//____________________________________________________________________________
+const double * INukeHadroData2018::FracADepTable(int targA) const
+{
+  const double * table = fFracADepTables[targA].load(std::memory_order_acquire);
+  if ( table ) return table;
+
+  std::lock_guard<std::mutex> lock(fFracADepMutex);
+  table = fFracADepTables[targA].load(std::memory_order_relaxed);
+  if ( table ) return table;
+
+  LOG("INukeData", pINFO) << "Tabulating the hA pion fate fractions for A = " << targA;
+
+  TGraph2D * graphs[kNFracADep] =
+     { TfracPipA_CEx, TfracPipA_Inelas, TfracPipA_Abs, TfracPipA_PiPro };
+
+  double * new_table = new double[kNFracADepKE * kNFracADep];
+  for ( int ike = 0; ike < kNFracADepKE; ike++ ) {
+    double ke = fMinKinEnergy + ike;
+    double * f = new_table + ike * kNFracADep;
+    double total = 0.;
+    for ( int i = 0; i < kNFracADep; i++ ) {
+      f[i] = graphs[i]->Interpolate(targA, ke);
+      total += f[i];
     }
+    // Protect against unitarity violation due to interpolation problems
+    // by renormalizing all available fate fractions to unity.
+    for ( int i = 0; i < kNFracADep; i++ ) f[i] /= total;
   }
 
-  LOG("INukeData", pWARN) << "Can't handle particles with pdg code = " << hpdgc;
-  return 0.;
+  fFracADepTables[targA].store(new_table, std::memory_order_release);
+  return new_table;
 }
 //____________________________________________________________________________
 double INukeHadroData2018::FracAIndep(int hpdgc, INukeFateHA_t fate, double ke) const
@@ -1664,6 +1725,155 @@ double INukeHadroData2018::Frac(int hpdgc, INukeFateHN_t fate, double ke, int ta
   return frac;
 }
 //____________________________________________________________________________
+void INukeHadroData2018::BuildHNXSecTables(void)
+{
+// Groups the hN x-section splines used by XSec() and Frac() by hadron species
+
+  struct Entry { const Spline * spl; int fate; EHNWeight weight; };
+
+  const int kTot = kNHNFates;
+  const int kCEx = 0, kElas = 1, kInel = 2, kAbs = 3, kCmp = 4;
+
+  auto fill = [] (HNXSecTable & table, std::initializer_list<Entry> entries) {
+    table.fNSplines = 0;
+    for ( const Entry & e : entries ) {
+      assert( table.fNSplines < kNHNSplines );
+      table.fSplines[table.fNSplines] = e.spl;
+      table.fFate   [table.fNSplines] = e.fate;
+      table.fWeight [table.fNSplines] = e.weight;
+      table.fNSplines++;
+    }
+  };
+
+  fill( fHNXSecPip, {
+    { fXSecPipp_CEx,  kCEx,  kHNWeightZ }, { fXSecPipn_CEx,  kCEx,  kHNWeightN },
+    { fXSecPipp_Elas, kElas, kHNWeightZ }, { fXSecPipn_Elas, kElas, kHNWeightN },
+    { fXSecPipp_Reac, kInel, kHNWeightZ }, { fXSecPipn_Reac, kInel, kHNWeightN },
+    { fXSecPipd_Abs,  kAbs,  kHNWeightA },
+    { fXSecPipp_Tot,  kTot,  kHNWeightZ }, { fXSecPipn_Tot,  kTot,  kHNWeightN } } );
+  fill( fHNXSecPim, {
+    { fXSecPipn_CEx,  kCEx,  kHNWeightZ }, { fXSecPipp_CEx,  kCEx,  kHNWeightN },
+    { fXSecPipn_Elas, kElas, kHNWeightZ }, { fXSecPipp_Elas, kElas, kHNWeightN },
+    { fXSecPipn_Reac, kInel, kHNWeightZ }, { fXSecPipp_Reac, kInel, kHNWeightN },
+    { fXSecPipd_Abs,  kAbs,  kHNWeightA },
+    { fXSecPipn_Tot,  kTot,  kHNWeightZ }, { fXSecPipp_Tot,  kTot,  kHNWeightN } } );
+  fill( fHNXSecPi0, {
+    { fXSecPi0p_CEx,  kCEx,  kHNWeightZ }, { fXSecPi0n_CEx,  kCEx,  kHNWeightN },
+    { fXSecPi0p_Elas, kElas, kHNWeightZ }, { fXSecPi0n_Elas, kElas, kHNWeightN },
+    { fXSecPi0p_Reac, kInel, kHNWeightZ }, { fXSecPi0n_Reac, kInel, kHNWeightN },
+    { fXSecPi0d_Abs,  kAbs,  kHNWeightA },
+    { fXSecPi0p_Tot,  kTot,  kHNWeightZ }, { fXSecPi0n_Tot,  kTot,  kHNWeightN } } );
+  fill( fHNXSecP, {
+    { fXSecPp_Elas,   kElas, kHNWeightZ }, { fXSecPn_Elas,   kElas, kHNWeightN },
+    { fXSecPp_Reac,   kInel, kHNWeightZ }, { fXSecPn_Reac,   kInel, kHNWeightN },
+    { fXSecPp_Cmp,    kCmp,  kHNWeightZ }, { fXSecPn_Cmp,    kCmp,  kHNWeightN },
+    { fXSecPp_Tot,    kTot,  kHNWeightZ }, { fXSecPn_Tot,    kTot,  kHNWeightN } } );
+  fill( fHNXSecN, {
+    { fXSecPn_Elas,   kElas, kHNWeightZ }, { fXSecNn_Elas,   kElas, kHNWeightN },
+    { fXSecPn_Reac,   kInel, kHNWeightZ }, { fXSecNn_Reac,   kInel, kHNWeightN },
+    { fXSecPp_Cmp,    kCmp,  kHNWeightZ }, { fXSecPn_Cmp,    kCmp,  kHNWeightN },
+    { fXSecPn_Tot,    kTot,  kHNWeightZ }, { fXSecNn_Tot,    kTot,  kHNWeightN } } );
+  fill( fHNXSecKp, {
+    { fXSecKpn_CEx,   kCEx,  kHNWeightA },
+    { fXSecKpn_Elas,  kElas, kHNWeightA },
+    { fXSecKpN_Tot,   kTot,  kHNWeightOne } } );
+  fill( fHNXSecGam, {
+    { fXSecGamN_Tot,  kTot,  kHNWeightOne } } );
+}
+//____________________________________________________________________________
+const INukeHadroData2018::HNXSecTable *
+  INukeHadroData2018::HNXSecTableOf(int hpdgc) const
+{
+  switch ( hpdgc ) {
+    case kPdgPiP     : return &fHNXSecPip;
+    case kPdgPiM     : return &fHNXSecPim;
+    case kPdgPi0     : return &fHNXSecPi0;
+    case kPdgProton  : return &fHNXSecP;
+    case kPdgNeutron : return &fHNXSecN;
+    case kPdgKP      : return &fHNXSecKp;
+    case kPdgGamma   : return &fHNXSecGam;
+    default          : return 0;
+  }
+}
+//____________________________________________________________________________
+bool INukeHadroData2018::XSecs(
+   int hpdgc, double ke, int targA, int targZ, double xsec[], double & xsec_tot) const
+{
+// return the x-sections for all the kHNFates fates and the total x-section for
+// the particle with the input pdg code at the input kinetic energy
+
+  for ( int i = 0; i < kNHNFates; i++ ) xsec[i] = 0.;
+  xsec_tot = 0.;
+
+  const HNXSecTable * table = this->HNXSecTableOf(hpdgc);
+  if ( ! table ) {
+    LOG("INukeData", pWARN)
+      << "Can't handle particles with pdg code = " << hpdgc;
+    return false;
+  }
+
+  ke = TMath::Max(fMinKinEnergy,   ke);
+  ke = TMath::Min(fMaxKinEnergyHN, ke);
+
+  double y[kNHNSplines];
+  Spline::Evaluate( table->fSplines, table->fNSplines, ke, y );
+
+  for ( int i = 0; i < table->fNSplines; i++ ) {
+    double w = 1.;
+    switch ( table->fWeight[i] ) {
+      case kHNWeightZ   : w = targZ;         break;
+      case kHNWeightN   : w = targA - targZ; break;
+      case kHNWeightA   : w = targA;         break;
+      case kHNWeightOne : w = 1.;            break;
+    }
+    double term = TMath::Max(0., y[i]) * w;
+    if ( table->fFate[i] == kNHNFates ) xsec_tot += term;
+    else xsec[ table->fFate[i] ] += term;
+  }
+
+  return true;
+}
+//____________________________________________________________________________
+bool INukeHadroData2018::Fracs(
+   int hpdgc, double ke, int targA, int targZ, double frac[]) const
+{
+// return the x-section fractions for all the kHNFates fates for the particle
+// with the input pdg code at the input kinetic energy
+
+  double xsec_tot = 0.;
+  bool ok = this->XSecs(hpdgc, ke, targA, targZ, frac, xsec_tot);
+
+  for ( int i = 0; i < kNHNFates; i++ ) {
+    frac[i] = (xsec_tot>0) ? frac[i]/xsec_tot : 0.;
+  }
+  return ok;
+}
+//____________________________________________________________________________
+bool INukeHadroData2018::TotXSecs(
+   int hpdgc, double ke, double & xsec_p, double & xsec_n) const
+{
+// return the total x-sections on a proton and on a neutron for the pion or
+// nucleon with the input pdg code at the input kinetic energy
+
+  xsec_p = 0.;
+  xsec_n = 0.;
+
+  bool is_handled = ( hpdgc == kPdgPiP || hpdgc == kPdgPiM  || hpdgc == kPdgPi0 ||
+                      hpdgc == kPdgProton || hpdgc == kPdgNeutron );
+  if ( ! is_handled ) return false;
+
+  const HNXSecTable * table = this->HNXSecTableOf(hpdgc);
+
+  // the total x-sections are the last two splines of the table
+  int n = table->fNSplines;
+  double y[2];
+  Spline::Evaluate( table->fSplines + n - 2, 2, ke, y );
+
+  xsec_p = y[0];
+  xsec_n = y[1];
+  return true;
+}
+//____________________________________________________________________________
 double INukeHadroData2018::IntBounce(const GHepParticle* p, int target, int scode, INukeFateHN_t fate)
 {
   // This method returns a random cos(ang) according to a distribution
@@ -21,6 +21,17 @@
           data and extrapolations, and INC model results from Mashnik et al.
           for h+Fe56.
 
+          The A-dependent pion hA fate fractions are tabulated per nucleus on
+          a regular 1 MeV kinetic energy grid, at the first use of the
+          nucleus, so that all of them are obtained by a single linear
+          interpolation instead of one TGraph2D interpolation per fate.
+
+          The hN x-section splines of all the fates of a hadron, and its total
+          x-section on protons and neutrons, are grouped in one table per
+          hadron species, so that XSecs() and Fracs() return all the fates
+          with a single knot interval look-up (the hN splines share their
+          kinetic energy grid).
+
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>, Rutherford Lab.
           Steve Dytman <dytman+@pitt.edu>, Pittsburgh Univ.
 	  Aaron Meyer <asm58@pitt.edu>, Pittsburgh Univ.
@@ -38,6 +49,9 @@
 #ifndef _INTRANUKE_HADRON_CROSS_SECTIONS_2018_H_
 #define _INTRANUKE_HADRON_CROSS_SECTIONS_2018_H_
 
+#include <atomic>
+#include <mutex>
+
 #include "Physics/HadronTransport/INukeHadroFates2018.h"
 #include "Framework/GHEP/GHepParticle.h"
 #include "Framework/Numerical/BLI2D.h"
@@ -60,8 +74,18 @@ public:
   double XSec (int hpdgc, int tgt, int nprod, INukeFateHN_t rxnType, double ke, double costh) const;
   double XSec (int hpdgc, INukeFateHN_t fate, double ke, int targA, int targZ) const;
   double FracADep (int hpdgc, INukeFateHA_t fate, double ke, int targA) const;
+  bool   FracADep (int hpdgc, double ke, int targA, double frac[/*kNFracADep*/]) const;
   double FracAIndep (int hpdgc, INukeFateHA_t fate, double ke) const;
   double Frac (int hpdgc, INukeFateHN_t fate, double ke, int targA=0, int targZ=0) const;
+
+  //! All the hN fates at once, in kHNFates order (0 for the fates the hadron
+  //! doesn't have): XSecs() returns the fate x-sections and the total
+  //! x-section, Fracs() the fractions, as XSec() and Frac() would.
+  //! Both return false for hadrons with no hN x-sections.
+  bool XSecs (int hpdgc, double ke, int targA, int targZ, double xsec[/*kNHNFates*/], double & xsec_tot) const;
+  bool Fracs (int hpdgc, double ke, int targA, int targZ, double frac[/*kNHNFates*/]) const;
+  //! Total hN x-sections on a proton and on a neutron (pions and nucleons only)
+  bool TotXSecs (int hpdgc, double ke, double & xsec_p, double & xsec_n) const;
   double IntBounce       (const GHepParticle* p, int target, int s1, INukeFateHN_t fate);
 
 
@@ -146,6 +170,14 @@ public:
   static double fMaxKinEnergyHA; ///<
   static double fMaxKinEnergyHN; ///<
 
+  //! A-dependent fates, in the order of the fractions returned by FracADep()
+  static const int           kNFracADep = 4;
+  static const INukeFateHA_t kFracADepFates[kNFracADep];
+
+  //! hN fates, in the order of the x-sections returned by XSecs() and Fracs()
+  static const int           kNHNFates = 5;
+  static const INukeFateHN_t kHNFates[kNHNFates];
+
 private:
   INukeHadroData2018();
   INukeHadroData2018(const INukeHadroData2018 & shx);
@@ -157,6 +189,20 @@ private:
          string filename, double ke, int npoints, int & curr_point,
          /*double * ke_array,*/ double * costh_array, double * xsec_array, int cols);
 
+  const double * FracADepTable (int targA) const;
+
+  // hN x-section splines of a hadron species, evaluated together
+  static const int kNHNSplines = 2*kNHNFates + 2;
+  enum EHNWeight { kHNWeightZ, kHNWeightN, kHNWeightA, kHNWeightOne };
+  struct HNXSecTable {
+    int            fNSplines;
+    const Spline * fSplines[kNHNSplines];
+    int            fFate   [kNHNSplines];  ///< index in kHNFates, or kNHNFates for the total x-section
+    EHNWeight      fWeight [kNHNSplines];  ///< spline multiplier: Z, A-Z, A or 1
+  };
+  void                BuildHNXSecTables (void);
+  const HNXSecTable * HNXSecTableOf     (int hpdgc) const;
+
   static INukeHadroData2018 * fInstance;
 
   Spline * fXSecPipn_Tot;      ///< pi+n hN x-section splines
@@ -224,6 +270,12 @@ private:
   TGraph2D * TfracPipA_Abs;
   TGraph2D * TfracPipA_PiPro;
 
+  static const int kMaxFracADepA = 208;
+  static const int kNFracADepKE  = 999;  ///< 1 MeV spaced nodes in [fMinKinEnergy, fMaxKinEnergyHA]
+
+  mutable std::atomic<const double *> fFracADepTables[kMaxFracADepA+1]; ///< by A, normalised fractions at [ike*kNFracADep+ifate]
+  mutable std::mutex                  fFracADepMutex; ///< serializes the table building (TGraph2D are not thread-safe)
+
   BLI2DNonUnifGrid * fhN2dXSecPP_Elas;
   BLI2DNonUnifGrid * fhN2dXSecNP_Elas;
   BLI2DNonUnifGrid * fhN2dXSecPipN_Elas;
@@ -240,6 +292,8 @@ private:
   BLI2DNonUnifGrid * fhN2dXSecGamPipN_Inelas;
   BLI2DNonUnifGrid * fhN2dXSecGamPimP_Inelas;
 
+  HNXSecTable fHNXSecPip, fHNXSecPim, fHNXSecPi0, fHNXSecP, fHNXSecN, fHNXSecKp, fHNXSecGam;
+
   //-- Sinleton cleaner
   struct Cleaner {
       void DummyMethodAndSilentCompiler() { }
@@ -30,9 +30,11 @@ potential in (e,e'p).  GENIE code was adapted from NuWro implementation.
 #include "Physics/HadronTransport/INukeUtils2018.h"
 #include "Physics/HadronTransport/INukeHadroData2018.h"
 #include "Framework/ParticleData/PDGLibrary.h"
+#include "Framework/Conventions/GBuild.h"
 #include "Framework/Conventions/Units.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/ThreadPool.h"
 using namespace genie;
 
 #include <vector>
@@ -43,8 +45,8 @@ using namespace genie;
 #include <iostream>
 #include <cmath>
 #include <cstdlib>
-
-#include <TGraph.h>
+#include <map>
+#include <mutex>
 using namespace std;
 
 
@@ -111,18 +113,32 @@ double INukeNucleonCorr :: localFermiMom (const double rho, const int A, const i
     vector<vector<double> > UraniumValues;
     vector<vector<double> > clear;
 
-//! generate random momentum direction and return 4-momentum of target nucleon
-TLorentzVector INukeNucleonCorr :: generateTargetNucleon (const double mass, const double fermiMom)
-{
-  RandomGen * rnd = RandomGen::Instance();
+namespace {
+  //! i-th element of the van der Corput sequence in the input base (one
+  //! coordinate of the Halton sequence)
+  double RadicalInverse (unsigned int i, const unsigned int base)
+  {
+    double f = 1.0, r = 0.0;
+    while (i > 0) {
+      f /= base;
+      r += f * (i % base);
+      i /= base;
+    }
+    return r;
+  }
+}
 
-  // get random momentum direction
-  const double costheta = 2.0 * rnd->RndGen().Rndm() - 1.0;  // random cos (theta)
-  const double sintheta = sqrt (1.0 - costheta * costheta);  // sin (theta)
-  const double      phi = 2.0 * M_PI * rnd->RndGen().Rndm(); // random phi
+//! return 4-momentum of target nucleon, for the input point u of the unit cube
+//! (u[0]: momentum up to Fermi level, u[1]: cos (theta), u[2]: phi)
+TLorentzVector INukeNucleonCorr :: generateTargetNucleon (const double mass, const double fermiMom, const double u[3])
+{
+  // get momentum direction
+  const double costheta = 2.0 * u[1] - 1.0;                // cos (theta)
+  const double sintheta = sqrt (1.0 - costheta * costheta); // sin (theta)
+  const double      phi = 2.0 * M_PI * u[2];                // phi
 
   // set nucleon 4-momentum
-  const double p = rnd->RndGen().Rndm() * fermiMom; // random nucleon momentum up to Fermi level
+  const double p = u[0] * fermiMom; // nucleon momentum up to Fermi level
 
   const TVector3   p3 = TVector3 (p * sintheta * cos (phi), p * sintheta * sin (phi), p * costheta); // 3-momentum
   const double energy = sqrt (p3.Mag2() + mass * mass); // energy
@@ -142,15 +158,23 @@ double INukeNucleonCorr :: getCorrection (const double mass, const double rho,
 }
 
 //! generate kinematics fRepeat times to calculate average correction
-double INukeNucleonCorr :: AvgCorrection (const double rho, const int A, const int Z, const int pdg, const double Ek)
+double INukeNucleonCorr :: AvgCorrection (const double rho, const int A, const int Z, const int pdg, const double Ek,
+                                          const unsigned long seed)
 {
+  // the scattering angle & azimuth are the only random numbers (FSI stream)
+  if (seed > 0) RandomGen::Instance()->RndFsi().SetSeed(seed);
 
-  RandomGen * rnd = RandomGen::Instance();
+  // local Fermi momenta; not stored in the object, as table cells are
+  // computed concurrently
+  const double fermiMomProton  = localFermiMom (rho, A, Z, kPdgProton);
+  const double fermiMomNeutron = localFermiMom (rho, A, Z, kPdgNeutron);
+  const double fermiMom        = pdg == kPdgProton ? fermiMomProton : fermiMomNeutron;
 
-  setFermiLevel (rho, A, Z); // set Fermi momenta for protons and neutrons
-
-  const double mass   = PDGLibrary::Instance()->Find(pdg)->Mass(); // mass of incoming nucleon
+  PDGLibrary * pdglib = PDGLibrary::Instance();
+  const double mass   = pdglib->Find(pdg)->Mass(); // mass of incoming nucleon
   const double energy = Ek + mass;
+  const double massProton  = pdglib->Find(kPdgProton)->Mass();
+  const double massNeutron = pdglib->Find(kPdgNeutron)->Mass();
 
   TLorentzVector p (0.0, 0.0, sqrt (energy * energy - mass * mass), energy); // incoming particle 4-momentum
   GHepParticle incomingParticle (pdg, kIStUndefined, -1,-1,-1,-1, p, TLorentzVector ()); // for IntBounce
@@ -160,12 +184,16 @@ double INukeNucleonCorr :: AvgCorrection (const double rho, const int A, const i
 
   for (unsigned int i = 0; i < fRepeat; i++) // generate kinematics fRepeat times to get avg corrections
   {
-    // get proton vs neutron randomly based on Z/A
-    const int targetPdg = rnd->RndGen().Rndm() < (double) Z / A ? kPdgProton : kPdgNeutron;
+    // target nucleon from the (quasi-random) Halton sequence: momentum, direction & proton vs neutron (based on Z/A)
+    const double u[4] = { RadicalInverse (i+1, 2), RadicalInverse (i+1, 3),
+                          RadicalInverse (i+1, 5), RadicalInverse (i+1, 7) };
+
+    const int targetPdg = u[3] < (double) Z / A ? kPdgProton : kPdgNeutron;
 
-    const double targetMass = PDGLibrary::Instance()->Find(targetPdg)->Mass(); // set nucleon mass
+    const double targetMass     = targetPdg == kPdgProton ? massProton     : massNeutron;     // set nucleon mass
+    const double targetFermiMom = targetPdg == kPdgProton ? fermiMomProton : fermiMomNeutron;
 
-    const TLorentzVector target = generateTargetNucleon (targetMass, fermiMomentum (targetPdg)); // generate target nucl
+    const TLorentzVector target = generateTargetNucleon (targetMass, targetFermiMom, u); // generate target nucl
 
     TLorentzVector outNucl1, outNucl2, RemnP4; // final 4-momenta
 
@@ -176,7 +204,7 @@ double INukeNucleonCorr :: AvgCorrection (const double rho, const int A, const i
     utils::intranuke2018::TwoBodyKinematics (mass, targetMass, p, target, outNucl1, outNucl2, C3CM, RemnP4);
 
     // update Pauli blocking correction
-    corrPauliBlocking += (outNucl1.Vect().Mag() > fermiMomentum (pdg) and outNucl2.Vect().Mag() > fermiMomentum (targetPdg));
+    corrPauliBlocking += (outNucl1.Vect().Mag() > fermiMom and outNucl2.Vect().Mag() > targetFermiMom);
 
     // update potential-based correction
     corrPotential += getCorrection (mass, rho, p.Vect(), target.Vect(), outNucl1.Vect(), outNucl2.Vect());
@@ -230,7 +258,59 @@ void read_file(string rfilename)
 }
 
 
-// This function interpolates and returns correction values
+// Reads the correction tables of the 6 nuclei (He, C, Ca, Fe, Sn, U), once
+//
+namespace {
+  const int    kNCorrNuclei = 6;
+  const double kCorrNucleusA[kNCorrNuclei] = { 4, 12, 40, 56, 120, 238 };
+  vector<vector<double> > * const kCorrValues[kNCorrNuclei] = {
+    &HeliumValues, &CarbonValues, &CalciumValues, &IronValues, &TinValues, &UraniumValues };
+  const char * const kCorrFiles[kNCorrNuclei] = {
+    "NNCorrection_2_4.txt",   "NNCorrection_6_12.txt",  "NNCorrection_20_40.txt",
+    "NNCorrection_26_56.txt", "NNCorrection_50_120.txt", "NNCorrection_92_238.txt" };
+
+  std::once_flag gCorrFilesRead;
+
+  void ReadCorrectionFiles(void)
+  {
+    for(int i = 0; i < kNCorrNuclei; i++) {
+      read_file(dir+kCorrFiles[i]);
+      *kCorrValues[i] = infile_values;
+      infile_values = clear;
+      if(kCorrValues[i]->size() < (unsigned int) NRows) {
+        LOG("INukeNucleonCorr",pFATAL)
+          << "Incomplete nucleon correction table: " << dir+kCorrFiles[i];
+        gAbortingInErr = true;
+        exit(1);
+      }
+    }
+    LOG("INukeNucleonCorr",pNOTICE)
+      << "Nucleon Corr interpolation files read in successfully";
+  }
+
+  // The correction table of the input nucleus (rows: KE, columns: rho),
+  // interpolated linearly in A between the tables of the 6 nuclei and
+  // extrapolated from the nearest two outside them (as TGraph::Eval).
+  // Stored flat, row after row.
+  void BuildCorrectionTable(double A, vector<double> & table)
+  {
+    int i = 0;
+    while(i < kNCorrNuclei-2 && A > kCorrNucleusA[i+1]) i++;
+    double w = (A - kCorrNucleusA[i]) / (kCorrNucleusA[i+1] - kCorrNucleusA[i]);
+    const vector<vector<double> > & lo = *kCorrValues[i];
+    const vector<vector<double> > & hi = *kCorrValues[i+1];
+
+    table.resize(NRows*NColumns);
+    for(int row = 0; row < NRows; row++) {
+      for(int col = 0; col < NColumns; col++) {
+        table[row*NColumns + col] = lo[row][col] + w * (hi[row][col] - lo[row][col]);
+      }
+    }
+  }
+}
+//____________________________________________________________________________
+// This function returns the correction value, from the table of the nucleus
+// interpolated in A at its first use
 //
 double INukeNucleonCorr :: getAvgCorrection(double rho, double A, double ke)
 {
@@ -244,88 +324,31 @@ double INukeNucleonCorr :: getAvgCorrection(double rho, double A, double ke)
    if(ke>.1&&ke<=.5) Row = round(.1*1000.+(ke-.1)*200);
    if(ke>.5&&ke<=1) Row = round(.1*1000.+(.5-.1)*200+(ke-.5)*40);
    if(ke>1) Row = NRows-1;
-   //LOG ("INukeNucleonCorr",pNOTICE)
-   //  << "row, column = " << Row << "   " << Column;
-  //If the table of correction values has already been created
-  // return a value. Else, interpolate the needed correction table//
-//  static double cache[NRows][NColumns] = {{-1}};
-  static bool ReadFile = false;
-  if( ReadFile == true ) {
-   int Npoints = 6;
-   TGraph * Interp = new TGraph(Npoints);
-   //LOG("INukeNucleonCorr",pNOTICE)
-   //  << HeliumValues[Row][Column];
-   Interp->SetPoint(0,4,HeliumValues[Row][Column]);
-   Interp->SetPoint(1,12,CarbonValues[Row][Column]);
-   Interp->SetPoint(2,40,CalciumValues[Row][Column]);
-   Interp->SetPoint(3,56,IronValues[Row][Column]);
-   Interp->SetPoint(4,120,TinValues[Row][Column]);
-   Interp->SetPoint(5,238,UraniumValues[Row][Column]);
-
-   //   Interpolated[e][r] = Interp->Eval(A);
-	//	LOG("INukeNucleonCorr",pNOTICE)
-	//	  << "e,r,value= " << e << "   " << r << "   " << Interpolated[e][r];
-   double returnval = Interp->Eval(A);
-   delete Interp;
-   LOG("INukeNucleonCorr",pINFO)
-      << "Nucleon Corr interpolated correction factor = "
-      << returnval  //cache[Row][Column]
-      << " for rho, KE, A= "<<  rho << "  " << ke << "   " << A;
-    //    return cache[Row][Column];
-   return returnval;
-  } else {
-    //Reading in correction files//
-    //    string dir = genie_dir + string("/data/evgen/nncorr/");
-
-    read_file(dir+"NNCorrection_2_4.txt");
-    HeliumValues = infile_values;
-    infile_values = clear;
-
-    read_file(dir+"NNCorrection_6_12.txt");
-    CarbonValues = infile_values;
-    infile_values = clear;
-
-    read_file(dir+"NNCorrection_20_40.txt");
-    CalciumValues = infile_values;
-    infile_values = clear;
-
-    read_file(dir+"NNCorrection_26_56.txt");
-    IronValues = infile_values;
-    infile_values = clear;
-
-    read_file(dir+"NNCorrection_50_120.txt");
-    TinValues = infile_values;
-    infile_values = clear;
-
-    read_file(dir+"NNCorrection_92_238.txt");
-    UraniumValues = infile_values;
-    infile_values = clear;
 
-    LOG("INukeNucleonCorr",pNOTICE)
-      << "Nucleon Corr interpolation files read in successfully";
-    //get interpolated value for first event.
-    int Npoints = 6;
-    TGraph * Interp = new TGraph(Npoints);
-    //LOG("INukeNucleonCorr",pNOTICE)
-    //  << HeliumValues[Row][Column];
-    Interp->SetPoint(0,4,HeliumValues[Row][Column]);
-    Interp->SetPoint(1,12,CarbonValues[Row][Column]);
-    Interp->SetPoint(2,40,CalciumValues[Row][Column]);
-    Interp->SetPoint(3,56,IronValues[Row][Column]);
-    Interp->SetPoint(4,120,TinValues[Row][Column]);
-    Interp->SetPoint(5,238,UraniumValues[Row][Column]);
-
-    //	LOG("INukeNucleonCorr",pNOTICE)
-    //	  << "Row,Column,value= " << Row << "   " << Column << "   " << Interp->Eval(A);
-    double returnval = Interp->Eval(A);
-    delete Interp;
-    ReadFile = true;
-    LOG("INukeNucleonCorr",pINFO)
-      << "Nucleon Corr interpolated correction factor = "
-      << returnval
-      << " for rho, KE, A= "<<  rho << "  " << ke << "   " << A;
-    return returnval;
+  std::call_once(gCorrFilesRead, ReadCorrectionFiles);
+
+  // per-thread tables, by nucleus, and the last one used
+  static thread_local map<double, vector<double> > tables;
+  static thread_local double                 last_A     = -1;
+  static thread_local const vector<double> * last_table = 0;
+  if(A != last_A || !last_table) {
+    map<double, vector<double> >::iterator it = tables.find(A);
+    if(it == tables.end()) {
+      it = tables.insert(std::make_pair(A, vector<double>())).first;
+      BuildCorrectionTable(A, it->second);
+    }
+    last_A     = A;
+    last_table = &(it->second);
   }
+
+  double returnval = (*last_table)[Row*NColumns + Column];
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("INukeNucleonCorr",pDEBUG)
+     << "Nucleon Corr interpolated correction factor = "
+     << returnval
+     << " for rho, KE, A= "<<  rho << "  " << ke << "   " << A;
+#endif
+  return returnval;
 }
 
 //This function outputs new correction files a new target if needed//
@@ -354,14 +377,21 @@ void  INukeNucleonCorr :: OutputFiles(int A, int Z)
       output[e][0] = energy;}
 
   //loop over each energy and density to get corrections and build the correction table//
-  for(int e = 1; e < 1002; e++){
+  //the energies are spread over the thread pool; each cell has its own seed, so the
+  //table doesn't depend on the number of threads//
+  INukeNucleonCorr * corr = INukeNucleonCorr::getInstance();
+  PDGLibrary::Instance();         // shared singletons: initialize them before the workers use them
+  INukeHadroData2018::Instance();
+  ThreadPool::Instance()->ParallelFor(1001, [&] (int ie, unsigned int /*worker*/) {
+    int e = ie + 1;
     for(int r = 1; r < 18; r++){
       double energy  = (e-1)*0.001;
       double density = (r-1)*0.01;
-      double correction = INukeNucleonCorr::getInstance()-> AvgCorrection (density, A, Z, pdgc, energy);
+      unsigned long seed = 1 + (e-1)*17 + (r-1);
+      double correction = corr-> AvgCorrection (density, A, Z, pdgc, energy, seed);
       output[e][r] = correction;
     }
-  }
+  });
   //output the new correction table //
   ofstream outfile;
   outfile.open((char*)file.c_str(), ios::trunc);
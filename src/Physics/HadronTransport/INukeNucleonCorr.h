@@ -25,8 +25,12 @@ class INukeNucleonCorr
     //! get the correction for given four-momentum and density
     //    double getAvgCorrection (const double rho, const int A, const int Z, const int pdg, const double Ek);
     double getAvgCorrection (const double rho, const double A, const double Ek);
+    //! write the correction table for the input nucleus, computing its cells in parallel (see genie::ThreadPool)
     void OutputFiles(int A, int Z);
-    double AvgCorrection (const double rho, const int A, const int Z, const int pdg, const double Ek);
+    //! average correction for given density & kinetic energy, from fRepeat target nucleons of a quasi-random
+    //! (Halton) sequence; if seed > 0, the FSI random number stream is re-seeded first for a reproducible result
+    double AvgCorrection (const double rho, const int A, const int Z, const int pdg, const double Ek,
+                          const unsigned long seed = 0);
 
   private:
   
@@ -97,7 +101,7 @@ class INukeNucleonCorr
     
     double localFermiMom (const double rho, const int A, const int Z, const int pdg); //!< calculate local Fermi momentum 
     
-    TLorentzVector generateTargetNucleon (const double mass, const double fermiMomentum); //!< generate target nucleon
+    TLorentzVector generateTargetNucleon (const double mass, const double fermiMomentum, const double u[3]); //!< generate target nucleon
     
     double getCorrection (const double mass, const double rho,
                           const TVector3 &k1, const TVector3 &k2,
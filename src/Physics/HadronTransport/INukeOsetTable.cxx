@@ -8,7 +8,8 @@ using namespace osetUtils;
 
 //! load tables from file and check its integrity
 INukeOsetTable :: INukeOsetTable (const char *filename) : fNDensityBins (0), fNEnergyBins (0), 
-                                                          fDensityBinWidth (0.0), fEnergyBinWidth (0.0)
+                                                          fDensityBinWidth (0.0), fEnergyBinWidth (0.0),
+                                                          fInvBinArea (0.0)
 {
   // open file with Oset table
   std::ifstream fileWithTables (filename);
@@ -32,6 +33,7 @@ INukeOsetTable :: INukeOsetTable (const char *filename) : fNDensityBins (0), fNE
 
   fDensityHandler.setHandler (fDensityBinWidth, fNDensityBins);
   fEnergyHandler.setHandler  (fEnergyBinWidth,  fNEnergyBins);
+  fInvBinArea = 1.0 / (fDensityBinWidth * fEnergyBinWidth);
 }
 
 // process single line from table file, push values to proper vector
@@ -62,16 +64,16 @@ int INukeOsetTable :: processLine (const std::string &line)
     // get qel and cex cross sections for i-th channel
     double xsecQel, xsecCex;
     splitLine >> xsecQel >> xsecCex;
-    // save them in proper vector
-    fQelCrossSectionTable[i].push_back (xsecQel);
-    fCexCrossSectionTable[i].push_back (xsecCex);
+    // save them in the table
+    fCrossSectionTable.push_back (xsecQel);
+    fCrossSectionTable.push_back (xsecCex);
   } // channel loop
 
   // get absorption cross section
   double absorption;
   splitLine >> absorption;
-  // save it in proper vector
-  fAbsorptionCrossSectionTable.push_back (absorption);
+  // save it in the table
+  fCrossSectionTable.push_back (absorption);
 
   return 0; // no errors
 }
@@ -156,56 +158,48 @@ void INukeOsetTable :: badFile (const char* file, const int &errorCode, const in
 }
 
 //! make bilinear interpolation between four points around (density, energy)
-double INukeOsetTable :: interpolate (const std::vector<double> &data) const
+//! for all cross sections at once
+void INukeOsetTable :: interpolate (double *values) const
 {
   // take four points adjacent to (density, energy) = (d,E):
   // (d0, E0), (d1, E0), (d0, E1), (d1, E1)
   // where d0 < d < d1, E0 < E < E1
   // each point goes in with weight = proper distance
 
-  // total bin width for normalization
-  static const double totalBinWidth = fDensityBinWidth * fEnergyBinWidth;
-  
-  // extract low boundary value from table
-  double lowValue = data[fEnergyHandler.index +
-                         fDensityHandler.index * fNEnergyBins]; // (d0, E0)
+  // low boundary point
+  const unsigned int low = fEnergyHandler.index +
+                           fDensityHandler.index * fNEnergyBins; // (d0, E0)
   // high boundaries = low boundary if on edge
-  double highDensityValue = lowValue; // (d1, E0)
-  double highEnergyValue  = lowValue; // (d0, E1)
-  double highValue        = lowValue; // (d1, E1)
-
-  // extract high boundaries values from table (if not on edge)
-  if (not fDensityHandler.isEdge)
-  {
-    highDensityValue = data[fEnergyHandler.index +
-                            (fDensityHandler.index + 1) * fNEnergyBins];
-
-    if (not fEnergyHandler.isEdge)
-    {
-      highEnergyValue = data[fEnergyHandler.index + 1 +
-                             fDensityHandler.index * fNEnergyBins];
-      highValue       = data[fEnergyHandler.index + 1 +
-                             (fDensityHandler.index + 1) * fNEnergyBins];
-    }
-  }
-  else if (not fEnergyHandler.isEdge)
-    highEnergyValue = data[fEnergyHandler.index + 1 +
-                           fDensityHandler.index * fNEnergyBins];
-
-  lowValue         *= fDensityHandler.lowWeight  * fEnergyHandler.lowWeight;
-  highDensityValue *= fDensityHandler.highWeight * fEnergyHandler.lowWeight;
-  highEnergyValue  *= fDensityHandler.lowWeight  * fEnergyHandler.highWeight;
-  highValue        *= fDensityHandler.highWeight * fEnergyHandler.highWeight;
-  
-  return (lowValue + highDensityValue + highEnergyValue + highValue) /
-          totalBinWidth;
+  unsigned int highDensity = low; // (d1, E0)
+  unsigned int highEnergy  = low; // (d0, E1)
+  unsigned int high        = low; // (d1, E1)
+
+  if (not fDensityHandler.isEdge) highDensity = low + fNEnergyBins;
+  if (not fEnergyHandler.isEdge)  highEnergy  = low + 1;
+  if (not fDensityHandler.isEdge and not fEnergyHandler.isEdge)
+    high = low + fNEnergyBins + 1;
+
+  // weights, including the normalization to total bin width
+  const double wLow         = fDensityHandler.lowWeight  * fEnergyHandler.lowWeight  * fInvBinArea;
+  const double wHighDensity = fDensityHandler.highWeight * fEnergyHandler.lowWeight  * fInvBinArea;
+  const double wHighEnergy  = fDensityHandler.lowWeight  * fEnergyHandler.highWeight * fInvBinArea;
+  const double wHigh        = fDensityHandler.highWeight * fEnergyHandler.highWeight * fInvBinArea;
+
+  const double *pLow         = &fCrossSectionTable[low         * fNValues];
+  const double *pHighDensity = &fCrossSectionTable[highDensity * fNValues];
+  const double *pHighEnergy  = &fCrossSectionTable[highEnergy  * fNValues];
+  const double *pHigh        = &fCrossSectionTable[high        * fNValues];
+
+  for (unsigned int i = 0; i < fNValues; i++)
+    values[i] = wLow * pLow[i] + wHighDensity * pHighDensity[i] +
+                wHighEnergy * pHighEnergy[i] + wHigh * pHigh[i];
 }
 
 //! set up table index and weights for given point
 void INukeOsetTable :: PointHandler :: update (const double &newValue)
 {
   value = newValue;         // update value
-  index = value / binWidth; // update index
+  index = value * invBinWidth; // update index
 
   // in the case value > max value use max; check if it is on edge
   if (index >= nBins - 1)
@@ -242,11 +236,14 @@ void INukeOsetTable :: setupOset (const double &density, const double &pionTk, c
  */ 
 void INukeOsetTable :: setCrossSections ()
 {
+    double values[fNValues];
+    interpolate (values);
+
     for (unsigned int i = 0; i < fNChannels; i++) // channel loop
     {
-      fQelCrossSections[i] = interpolate (fQelCrossSectionTable[i]);
-      fCexCrossSections[i] = interpolate (fCexCrossSectionTable[i]);
+      fQelCrossSections[i] = values[2*i];
+      fCexCrossSections[i] = values[2*i+1];
     }
 
-    fAbsorptionCrossSection = interpolate (fAbsorptionCrossSectionTable); 
+    fAbsorptionCrossSection = values[2*fNChannels];
 }
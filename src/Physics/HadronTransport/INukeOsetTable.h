@@ -33,34 +33,27 @@ class INukeOsetTable : public INukeOset
   void setupOset (const double &density, const double &pionTk, const int &pionPDG, const double &protonFraction);
 
   private:
-  
-  //! quasi-elastic piN cross section
-  /*! vector contains values in the following order:
-   * d0 e0, d0 e1, ... , d0 en, d1 e0 ... \n
-   * channel = 0 -> pi+n or pi-p, 1 -> pi+p or pi-n, 2 -> pi0
-   */
-  std::vector <double> fQelCrossSectionTable [fNChannels]; 
-  
-  //! charge-exchange piN cross section
-  /*! vector contains values in the following order:
+
+  //! number of cross sections per table point: qel and cex for each channel + absorption
+  static const unsigned int fNValues = 2 * fNChannels + 1;
+
+  //! all cross sections, fNValues consecutive values per table point
+  /*! points are in the following order:
    * d0 e0, d0 e1, ... , d0 en, d1 e0 ... \n
+   * values are in the following order:
+   * qel0 cex0 qel1 cex1 qel2 cex2 abs \n
    * channel = 0 -> pi+n or pi-p, 1 -> pi+p or pi-n, 2 -> pi0
    */
-  std::vector <double> fCexCrossSectionTable [fNChannels];
-  
-  //! pi absorption cross section
-  /*! vector contains values in the following order:
-   * d0 e0, d0 e1, ... , d0 en, d1 e0 ...
-   */
-  std::vector <double> fAbsorptionCrossSectionTable;
+  std::vector <double> fCrossSectionTable;
 
   unsigned int fNDensityBins; //!< number of denisty bins
   unsigned int fNEnergyBins;  //!< number of energy bins
   double fDensityBinWidth;    //!< density step (must be fixed)
   double fEnergyBinWidth;     //!< energy step (must be fixed)
+  double fInvBinArea;         //!< 1 / (density step * energy step)
 
-  //! interpolate cross section (method fixed for Oset tables)
-  double interpolate (const std::vector<double> &data) const;
+  //! interpolate all cross sections (method fixed for Oset tables)
+  void interpolate (double *values) const;
 
   //! process single line from table file, push values to proper vector (method fixed for Oset tables)
   int processLine (const std::string &line);
@@ -82,6 +75,7 @@ class INukeOsetTable : public INukeOset
     double highWeight; //!< distance from low boundary
     int index;         //!< point index = index of low boundary
     double binWidth;   //!< bin width used to calculate distances
+    double invBinWidth; //!< 1 / binWidth
     int nBins;         //!< nBins to check isEdge
     bool isEdge; //!< true if value is on edge of table (should never happen)
 
@@ -90,8 +84,9 @@ class INukeOsetTable : public INukeOset
     //! set up binWidth and nBins
     inline void setHandler (const double &width, const int &bins)
     {
-      binWidth = width;
-      nBins    = bins;
+      binWidth    = width;
+      invBinWidth = 1.0 / width;
+      nBins       = bins;
     }
     
     void update (const double &newValue); //!< update point if changed
@@ -0,0 +1,73 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::INukeStepConfig
+
+\brief    The INTRANUKE configuration entering the hadron mean free path.
+
+          Built once, when an INTRANUKE module is configured, and passed by
+          reference to the mean free path utilities, so that the INTRANUKE
+          mode is known as an enumeration rather than compared as a string
+          at each step of the cascade.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _INUKE_STEP_CONFIG_H_
+#define _INUKE_STEP_CONFIG_H_
+
+#include <string>
+
+#include "Physics/HadronTransport/INukeMode.h"
+
+using std::string;
+
+namespace genie {
+
+class INukeStepConfig {
+
+public:
+  INukeStepConfig() :
+    fMode(kIMdUndefined), fDelRPion(0.5), fDelRNucleon(1.0),
+    fUseOset(false), fAltOset(false), fXsecNNCorr(false) { }
+
+  INukeStepConfig(INukeMode_t mode, double delr_pion, double delr_nucleon,
+                  bool use_oset, bool alt_oset, bool xsec_nn_corr) :
+    fMode(mode), fDelRPion(delr_pion), fDelRNucleon(delr_nucleon),
+    fUseOset(use_oset), fAltOset(alt_oset), fXsecNNCorr(xsec_nn_corr) { }
+
+  INukeMode_t Mode        (void) const { return fMode;          }
+  bool        IsHN        (void) const { return fMode == kIMdHN; }
+  bool        IsHA        (void) const { return fMode == kIMdHA; }
+  double      DelRPion    (void) const { return fDelRPion;      }
+  double      DelRNucleon (void) const { return fDelRNucleon;   }
+  bool        UseOset     (void) const { return fUseOset;       }
+  bool        AltOset     (void) const { return fAltOset;       }
+  bool        XsecNNCorr  (void) const { return fXsecNNCorr;    }
+
+  //! mode of the 2018 INTRANUKE modules named as in their GetINukeMode()
+  static INukeMode_t ModeFromString(const string & mode) {
+    if(mode == "hN2018") return kIMdHN;
+    if(mode == "hA2018") return kIMdHA;
+    return kIMdUndefined;
+  }
+
+private:
+  INukeMode_t fMode;        ///< INTRANUKE mode
+  double      fDelRPion;    ///< pion ring size, in de Broglie wavelengths
+  double      fDelRNucleon; ///< nucleon ring size, in de Broglie wavelengths
+  bool        fUseOset;     ///< Oset model for low energy pions (hN mode)
+  bool        fAltOset;     ///< table-based Oset implementation
+  bool        fXsecNNCorr;  ///< nuclear medium correction for NN x-sections
+};
+
+}      // genie namespace
+
+#endif // _INUKE_STEP_CONFIG_H_
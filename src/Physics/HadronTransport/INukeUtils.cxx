@@ -57,6 +57,7 @@
 #include "Framework/ParticleData/PDGCodeList.h"
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/Registry/Registry.h"
+#include "Physics/NuclearState/NuclearDensityProfile.h"
 #include "Physics/NuclearState/NuclearUtils.h"
 #include "Framework/Utils/PrintUtils.h"
 
@@ -107,7 +108,7 @@ double genie::utils::intranuke::MeanFreePath(
 
   // get the nuclear density at the current position
   double rnow = x4.Vect().Mag();
-  double rho  = A * utils::nuclear::Density(rnow,(int) A,ring);
+  double rho  = A * NuclearDensityProfile::Instance((int) A)->Density(rnow,ring);
 
   // the hadron+nucleon cross section will be evaluated within the range
   // of the input spline and assumed to be const outside that range
@@ -187,7 +188,7 @@ double genie::utils::intranuke::MeanFreePath_Delta(
 
   // get the nuclear density at the current position
   double rnow = x4.Vect().Mag();
-  double rho  = A * utils::nuclear::Density(rnow,(int) A);
+  double rho  = A * NuclearDensityProfile::Instance((int) A)->Density(rnow);
 
   // the Delta+N->N+N cross section will be evaluated within the range
   // of the input spline and assumed to be const outside that range
@@ -37,6 +37,11 @@
 */
 //____________________________________________________________________________
 
+#include <map>
+#include <memory>
+#include <tuple>
+#include <vector>
+
 #include <TLorentzVector.h>
 #include <TMath.h>
 #include <TSystem.h>
@@ -61,8 +66,10 @@
 #include "Framework/ParticleData/PDGCodeList.h"
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/Registry/Registry.h"
+#include "Physics/NuclearState/NuclearDensityProfile.h"
 #include "Physics/NuclearState/NuclearUtils.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/NBodyPhaseSpace.h"
 #include "Physics/HadronTransport/INukeOset.h"
 #include "Physics/HadronTransport/INukeOsetTable.h"
 #include "Physics/HadronTransport/INukeOsetFormula.h"
@@ -74,10 +81,285 @@ using namespace genie::utils;
 using namespace genie::constants;
 using namespace genie::controls;
 
+//____________________________________________________________________________
+namespace {
+  // Nuclear density (fm^-3) and total hadron+nucleon x-section (fm^2) entering
+  // the mean free path (see MeanFreePath() for the inputs), for a hadron at
+  // distance rnow (fm) from the nucleus centre, with the input momentum (GeV),
+  // kinetic energy ke (MeV) and kinetic energy ekin (GeV) w.r.t. the PDG mass.
+  // Returns false for hadrons which are not handled.
+  bool MFPInputs(
+     int pdgc, double rnow, double momentum, double ke, double ekin,
+     double A, double Z, const INukeStepConfig & cfg,
+     double & rho, double & sigtot)
+  {
+    const double nRpi       = cfg.DelRPion();
+    const double nRnuc      = cfg.DelRNucleon();
+    const bool   useOset    = cfg.UseOset();
+    const bool   altOset    = cfg.AltOset();
+    const bool   xsecNNCorr = cfg.XsecNNCorr();
+    const bool   hN         = cfg.IsHN();
+
+    bool is_pion    = pdgc == kPdgPiP || pdgc == kPdgPi0 || pdgc == kPdgPiM;
+    bool is_nucleon = pdgc == kPdgProton || pdgc == kPdgNeutron;
+    bool is_kaon    = pdgc == kPdgKP;
+    bool is_gamma   = pdgc == kPdgGamma;
+
+    if(!is_pion && !is_nucleon && !is_kaon && !is_gamma) return false;
+
+    // before getting the nuclear density at the current position
+    // check whether the nucleus has to become larger by const times the
+    // de Broglie wavelength -- that is somewhat empirical, but this
+    // is what is needed to get piA total cross sections right.
+    // The ring size is different for light nuclei (using gaus density) /
+    // heavy nuclei (using woods-saxon density).
+    // The ring size is different for pions / nucleons.
+    //
+    double ring = (momentum>0) ? 1.240/momentum : 0; // de-Broglie wavelength
+
+    if(A<=20) { ring /= 2.; }
+
+    /*
+    if      (is_pion               ) { ring *= nRpi;  }
+    else if (is_nucleon            ) { ring *= nRnuc; }
+    else if (is_gamma || is_kaon || useOset) { ring = 0.;     }
+    */
+    if(hN)
+      {
+        if      (is_pion               ) { ring *= nRpi;  }
+        else if (is_nucleon            ) { ring *= nRnuc; }
+        else if (is_gamma || is_kaon || useOset) { ring = 0.;}
+      }
+    else
+      {
+        if      (is_pion    || is_kaon ) { ring *= nRpi;  }
+        else if (is_nucleon            ) { ring *= nRnuc; }
+        else if (is_gamma              ) { ring = 0.;     }
+      }
+
+    // get the nuclear density at the current position
+    rho = A * NuclearDensityProfile::Instance((int) A)->Density(rnow,ring);
+
+    // the hadron+nucleon cross section will be evaluated within the range
+    // of the input spline and assumed to be const outside that range
+    //
+    ke = TMath::Max(INukeHadroData2018::fMinKinEnergy,   ke);
+    ke = TMath::Min(INukeHadroData2018::fMaxKinEnergyHN, ke);
+
+    // get total xsection for the incident hadron at its current
+    // kinetic energy
+    sigtot = 0;
+    double ppcnt = (double) Z/ (double) A; // % of protons remaining
+    INukeHadroData2018 * fHadroData2018 = INukeHadroData2018::Instance();
+
+    if (is_pion and hN and useOset and ke < 350.0)
+      sigtot = intranuke2018::sigmaTotalOset (ke, rho, pdgc, ppcnt, altOset);
+    else if (pdgc == kPdgPiP || pdgc == kPdgPi0 || pdgc == kPdgPiM)
+      { double sig_p = 0, sig_n = 0;
+        fHadroData2018 -> TotXSecs(pdgc, ke, sig_p, sig_n);
+        sigtot = sig_p*ppcnt + sig_n*(1-ppcnt);}
+    else if (pdgc == kPdgProton)
+      {
+        double sig_p = 0, sig_n = 0;
+        fHadroData2018 -> TotXSecs(pdgc, ke, sig_p, sig_n);
+        sigtot = sig_p*ppcnt;
+        //sigtot+= fHadroData2018 -> XSecPn_Tot()   -> Evaluate(ke)*(1-ppcnt);
+
+        PDGLibrary * pLib = PDGLibrary::Instance();
+        double hc = 197.327;
+        double R0 = 1.25 * TMath::Power(A,1./3.) + 2.0 * 0.65; // should all be in units of fm
+        double Mp = pLib->Find(2212)->Mass();
+        double M  = pLib->Find(pdgc)->Mass();
+        //double E  = (p4.Energy() - Mp) * 1000.; // Convert GeV to MeV.
+        double E = ke;
+        if (Z*hc/137./rnow > E)  // Coulomb correction (Cohen, Concepts of Nuclear Physics, pg. 259-260)
+          {
+            double z  = 1.0; // charge for single proton
+            double Bc = z*Z*hc/137./R0;
+            double x  = E/Bc;
+            double f  = TMath::ACos(TMath::Power(x,0.5)) - TMath::Power(x*(1-x),0.5);
+            double B  = 0.63*z*Z*TMath::Power((M/Mp)/E,0.5);
+            double Pc = TMath::Exp(-B*f);
+            sigtot *= Pc;
+          }
+        sigtot+= sig_n*(1-ppcnt);
+
+        double E0 = TMath::Power(A,0.2)*12.;
+        if (hN){if(ke<E0){sigtot=0.0;}}  //empirical - needed to cut off large number of low energy nucleons
+        //      LOG("INukeUtils",pDEBUG) "sigtot for proton= " << sigtot << "; KE= " << ke << "; E0= " << E0;
+      }
+    else if (pdgc == kPdgNeutron)
+      {
+        double sig_p = 0, sig_n = 0;
+        fHadroData2018 -> TotXSecs(pdgc, ke, sig_p, sig_n);
+        sigtot = sig_p*ppcnt + sig_n*(1-ppcnt);
+        double E0 = TMath::Power(A,0.2)*12.;
+        if (hN){if(ke<E0){sigtot=0.0;}}  //empirical - needed to cut off large number of low energy nucleons
+        //      LOG("INukeUtils",pDEBUG) "sigtot for neutron= " << sigtot << "; KE= " << ke;
+      }
+    else if (pdgc == kPdgKP)
+      { sigtot = fHadroData2018 -> XSecKpN_Tot()  -> Evaluate(ke);
+        // this factor is used to empirically get agreement with tot xs data, justified historically.
+        sigtot*=1.1;}
+    else if (pdgc == kPdgGamma)
+      { sigtot = fHadroData2018 -> XSecGamp_fs()  -> Evaluate(ke)*ppcnt;
+        sigtot+= fHadroData2018 -> XSecGamn_fs()  -> Evaluate(ke)*(1-ppcnt);}
+    else {
+       return false;
+    }
+
+    // the xsection splines in INukeHadroData return the hadron x-section in
+    // mb -> convert to fm^2
+    sigtot *= (units::mb / units::fm2);
+
+    // avoid defective error handling
+    //if(sigtot<1E-6){sigtot=1E-6;}
+
+    if (xsecNNCorr and is_nucleon)
+      sigtot *= INukeNucleonCorr::getInstance()->
+        getAvgCorrection (rho, A, ekin);   //uses lookup tables
+
+    return true;
+  }
+
+  // Mean free path (fm) for the input density and x-section
+  double MFP(double rho, double sigtot)
+  {
+    // avoid defective error handling
+    if(sigtot<1E-6){sigtot=1E-6;}
+
+    // compute the mean free path
+    double lamda = 1. / (rho * sigtot);
+
+    // exits if lamda is InF (if cross section is 0)
+    if( ! TMath::Finite(lamda) ) {
+       return -1;
+    }
+    return lamda;
+  }
+
+  // Nuclear density and x-section entering the mean free path of a hadron on a
+  // (r, log(ke)) grid, for given hadron, nucleus and MeanFreePath() options.
+  // Grid cells across which these are not smooth (hN-mode Oset and nucleon
+  // low energy cuts, Coulomb correction for protons) are flagged so that the
+  // mean free path is computed directly there.
+  struct MFPTable {
+    int    fNR;              ///< number of r nodes, from r = 0
+    double fDR;              ///< r node spacing (fm)
+    int    fNKE;             ///< number of log(ke) nodes
+    double fLogKEMin;        ///< log(ke/MeV) of the first node
+    double fDLogKE;          ///< log(ke) node spacing
+    std::vector<float> fRho; ///< density at node (ir,ike) at [ir*fNKE+ike]
+    std::vector<float> fSig; ///< x-section at node (ir,ike)
+    std::vector<char>  fDirect; ///< cell (ir,ike) flag: compute directly
+  };
+
+  typedef std::tuple<int, int, int, int, double, double, bool, bool, bool> MFPTableKey;
+
+  const int    kMFPTableMaxTables = 64;    ///< per thread, cleared when full
+  const double kMFPTableDR        = 0.05;  ///< fm
+  const int    kMFPTableNKE       = 200;
+
+  MFPTable * BuildMFPTable(
+     int pdgc, double A, double Z, const INukeStepConfig & cfg)
+  {
+    LOG("INukeUtils", pINFO)
+      << "Tabulating the mean free path of " << pdgc << " in (A,Z) = ("
+      << A << "," << Z << ")";
+
+    MFPTable * t = new MFPTable;
+
+    // tracking goes up to NR x R0 x A^1/3, with NR = 3 and R0 = 1.4 fm by default
+    double rmax = 4. * 1.4 * TMath::Power(A, 1./3.);
+    double kemin = INukeHadroData2018::fMinKinEnergy;
+    double kemax = INukeHadroData2018::fMaxKinEnergyHN;
+
+    t->fDR       = kMFPTableDR;
+    t->fNR       = (int) TMath::Ceil(rmax / t->fDR) + 1;
+    t->fNKE      = kMFPTableNKE;
+    t->fLogKEMin = TMath::Log(kemin);
+    t->fDLogKE   = (TMath::Log(kemax) - t->fLogKEMin) / (t->fNKE-1);
+
+    int nnodes = t->fNR * t->fNKE;
+    t->fRho   .resize(nnodes);
+    t->fSig   .resize(nnodes);
+    t->fDirect.assign(nnodes, 0);
+
+    double mass = PDGLibrary::Instance()->Mass(pdgc);
+
+    vector<double> ke(t->fNKE);
+    for(int ike = 0; ike < t->fNKE; ike++) {
+      ke[ike] = TMath::Exp(t->fLogKEMin + ike * t->fDLogKE);
+    }
+    ke[t->fNKE-1] = kemax;
+
+    vector<char> finite(nnodes, 1);
+    for(int ir = 0; ir < t->fNR; ir++) {
+      double r = ir * t->fDR;
+      for(int ike = 0; ike < t->fNKE; ike++) {
+        double ekin = ke[ike] * units::MeV;
+        double momentum = TMath::Sqrt(ekin * (ekin + 2*mass));
+        double rho = 0, sigtot = 0;
+        MFPInputs(pdgc, r, momentum, ke[ike], ekin, A, Z, cfg, rho, sigtot);
+        int i = ir * t->fNKE + ike;
+        t->fRho[i] = rho;
+        t->fSig[i] = sigtot;
+        finite[i]  = TMath::Finite(rho) && TMath::Finite(sigtot);
+      }
+    }
+
+    bool is_pion    = pdgc == kPdgPiP || pdgc == kPdgPi0 || pdgc == kPdgPiM;
+    bool is_nucleon = pdgc == kPdgProton || pdgc == kPdgNeutron;
+    bool hN         = cfg.IsHN();
+    double E0       = TMath::Power(A,0.2)*12.;
+
+    for(int ir = 0; ir < t->fNR-1; ir++) {
+      double rlo = ir * t->fDR;
+      for(int ike = 0; ike < t->fNKE-1; ike++) {
+        int i = ir * t->fNKE + ike;
+        bool direct =
+          ! (finite[i] && finite[i+1] && finite[i+t->fNKE] && finite[i+t->fNKE+1]);
+        double kelo = ke[ike], kehi = ke[ike+1];
+        if(hN && is_pion && cfg.UseOset() && kelo < 350. && kehi >= 350.) direct = true;
+        if(hN && is_nucleon && kelo < E0 && kehi >= E0)             direct = true;
+        if(pdgc == kPdgProton && (rlo == 0 || Z*197.327/137./rlo > kelo)) direct = true;
+        t->fDirect[i] = direct;
+      }
+    }
+    return t;
+  }
+
+  const MFPTable * GetMFPTable(
+     int pdgc, double A, double Z, const INukeStepConfig & cfg)
+  {
+    static thread_local std::map<MFPTableKey, std::unique_ptr<MFPTable>> tables;
+
+    MFPTableKey key((int) pdgc, (int) A, (int) Z, (int) cfg.Mode(),
+                    cfg.DelRPion(), cfg.DelRNucleon(),
+                    cfg.UseOset(), cfg.AltOset(), cfg.XsecNNCorr());
+    auto it = tables.find(key);
+    if(it != tables.end()) return it->second.get();
+
+    if((int) tables.size() >= kMFPTableMaxTables) tables.clear();
+
+    MFPTable * t = BuildMFPTable(pdgc, A, Z, cfg);
+    tables[key].reset(t);
+    return t;
+  }
+}
 //____________________________________________________________________________
 double genie::utils::intranuke2018::MeanFreePath(
    int pdgc, const TLorentzVector & x4, const TLorentzVector & p4,
    double A, double Z, double nRpi, double nRnuc, const bool useOset, const bool altOset, const bool xsecNNCorr, string INukeMode)
+{
+  INukeStepConfig cfg(INukeStepConfig::ModeFromString(INukeMode),
+                      nRpi, nRnuc, useOset, altOset, xsecNNCorr);
+  return MeanFreePath(pdgc, x4, p4, A, Z, cfg);
+}
+//____________________________________________________________________________
+double genie::utils::intranuke2018::MeanFreePath(
+   int pdgc, const TLorentzVector & x4, const TLorentzVector & p4,
+   double A, double Z, const INukeStepConfig & cfg)
 {
 // Calculate the mean free path (in fm) for a pions and nucleons in a nucleus
 //
@@ -86,150 +368,69 @@ double genie::utils::intranuke2018::MeanFreePath(
 //  x4   : Hadron 4-position in the nucleus coordinate system (units: fm)
 //  p4   : Hadron 4-momentum (units: GeV)
 //  A    : Nucleus atomic mass number
-//  nRpi : Controls the pion ring size in terms of de-Broglie wavelengths
-//  nRnuc: Controls the nuclepn ring size in terms of de-Broglie wavelengths
+//  Z    : Nucleus atomic number
+//  cfg  : INTRANUKE mode and options (ring sizes in terms of de-Broglie
+//         wavelengths for pions and nucleons, Oset model, NN x-section
+//         medium correction)
 //
-  bool is_pion    = pdgc == kPdgPiP || pdgc == kPdgPi0 || pdgc == kPdgPiM;
-  bool is_nucleon = pdgc == kPdgProton || pdgc == kPdgNeutron;
-  bool is_kaon    = pdgc == kPdgKP;
-  bool is_gamma   = pdgc == kPdgGamma;
-
-  if(!is_pion && !is_nucleon && !is_kaon && !is_gamma) return 0.;
-
-  // before getting the nuclear density at the current position
-  // check whether the nucleus has to become larger by const times the
-  // de Broglie wavelength -- that is somewhat empirical, but this
-  // is what is needed to get piA total cross sections right.
-  // The ring size is different for light nuclei (using gaus density) /
-  // heavy nuclei (using woods-saxon density).
-  // The ring size is different for pions / nucleons.
-  //
-  double momentum = p4.Vect().Mag(); // hadron momentum in GeV
-  double ring = (momentum>0) ? 1.240/momentum : 0; // de-Broglie wavelength
+  double rho = 0, sigtot = 0;
 
-  if(A<=20) { ring /= 2.; }
+  bool is_handled = MFPInputs(
+     pdgc, x4.Vect().Mag(), p4.Vect().Mag(), (p4.Energy() - p4.M()) / units::MeV,
+     p4.E() - PDGLibrary::Instance()->Mass(pdgc),
+     A, Z, cfg, rho, sigtot);
+  if(!is_handled) return 0.;
 
-  /*
-  if      (is_pion               ) { ring *= nRpi;  }
-  else if (is_nucleon            ) { ring *= nRnuc; }
-  else if (is_gamma || is_kaon || useOset) { ring = 0.;     }
-  */
-  if(INukeMode=="hN2018")
-    {
-      if      (is_pion               ) { ring *= nRpi;  }
-      else if (is_nucleon            ) { ring *= nRnuc; }
-      else if (is_gamma || is_kaon || useOset) { ring = 0.;}
-    }
-  else
-    {
-      if      (is_pion    || is_kaon ) { ring *= nRpi;  }
-      else if (is_nucleon            ) { ring *= nRnuc; }
-      else if (is_gamma              ) { ring = 0.;     }
-    }
+/*
+  LOG("INukeUtils", pDEBUG)
+     << "sig_total = " << sigtot << " fm^2, rho = " << rho
+     << " fm^-3  => mfp = " << MFP(rho, sigtot) << " fm.";
+*/
+  return MFP(rho, sigtot);
+}
+//____________________________________________________________________________
+double genie::utils::intranuke2018::MeanFreePathTab(
+   int pdgc, const TLorentzVector & x4, const TLorentzVector & p4,
+   double A, double Z, const INukeStepConfig & cfg)
+{
+// As MeanFreePath(), but interpolating the density and x-section tabulated
+// on a (r, log(ke)) grid, for on-shell hadrons.
+// Falls back to MeanFreePath() out of the tabulated range and where the
+// tabulated quantities aren't smooth.
 
-  // get the nuclear density at the current position
-  double rnow = x4.Vect().Mag();
-  double rho  = A * utils::nuclear::Density(rnow,(int) A,ring);
+  bool is_handled = pdgc == kPdgPiP || pdgc == kPdgPi0 || pdgc == kPdgPiM ||
+                    pdgc == kPdgProton || pdgc == kPdgNeutron ||
+                    pdgc == kPdgKP || pdgc == kPdgGamma;
+  if(!is_handled) return 0.;
 
-  // the hadron+nucleon cross section will be evaluated within the range
-  // of the input spline and assumed to be const outside that range
-  //
   double ke = (p4.Energy() - p4.M()) / units::MeV;  // kinetic energy in MeV
-  ke = TMath::Max(INukeHadroData2018::fMinKinEnergy,   ke);
-  ke = TMath::Min(INukeHadroData2018::fMaxKinEnergyHN, ke);
-
-  // get total xsection for the incident hadron at its current
-  // kinetic energy
-  double sigtot = 0;
-  double ppcnt = (double) Z/ (double) A; // % of protons remaining
-  INukeHadroData2018 * fHadroData2018 = INukeHadroData2018::Instance();
-
-  if (is_pion and (INukeMode == "hN2018") and useOset and ke < 350.0)
-    sigtot = sigmaTotalOset (ke, rho, pdgc, ppcnt, altOset);
-  else if (pdgc == kPdgPiP)
-    { sigtot = fHadroData2018 -> XSecPipp_Tot() -> Evaluate(ke)*ppcnt;
-      sigtot+= fHadroData2018 -> XSecPipn_Tot() -> Evaluate(ke)*(1-ppcnt);}
-  else if (pdgc == kPdgPi0)
-    { sigtot = fHadroData2018 -> XSecPi0p_Tot() -> Evaluate(ke)*ppcnt;
-      sigtot+= fHadroData2018 -> XSecPi0n_Tot() -> Evaluate(ke)*(1-ppcnt);}
-  else if (pdgc == kPdgPiM)
-    { sigtot = fHadroData2018 -> XSecPipn_Tot() -> Evaluate(ke)*ppcnt;
-      sigtot+= fHadroData2018 -> XSecPipp_Tot() -> Evaluate(ke)*(1-ppcnt);}
-  else if (pdgc == kPdgProton)
-    {
-      sigtot = fHadroData2018 -> XSecPp_Tot()   -> Evaluate(ke)*ppcnt;
-      //sigtot+= fHadroData2018 -> XSecPn_Tot()   -> Evaluate(ke)*(1-ppcnt);
-
-      PDGLibrary * pLib = PDGLibrary::Instance();
-      double hc = 197.327;
-      double R0 = 1.25 * TMath::Power(A,1./3.) + 2.0 * 0.65; // should all be in units of fm
-      double Mp = pLib->Find(2212)->Mass();
-      double M  = pLib->Find(pdgc)->Mass();
-      //double E  = (p4.Energy() - Mp) * 1000.; // Convert GeV to MeV.
-      double E = ke;
-      if (Z*hc/137./x4.Vect().Mag() > E)  // Coulomb correction (Cohen, Concepts of Nuclear Physics, pg. 259-260)
-        {
-          double z  = 1.0; // charge for single proton
-          double Bc = z*Z*hc/137./R0;
-          double x  = E/Bc;
-          double f  = TMath::ACos(TMath::Power(x,0.5)) - TMath::Power(x*(1-x),0.5);
-          double B  = 0.63*z*Z*TMath::Power((M/Mp)/E,0.5);
-          double Pc = TMath::Exp(-B*f);
-          sigtot *= Pc;
-        }
-      sigtot+= fHadroData2018 -> XSecPn_Tot()   -> Evaluate(ke)*(1-ppcnt);
-
-      double E0 = TMath::Power(A,0.2)*12.;
-      if (INukeMode=="hN2018"){if(ke<E0){sigtot=0.0;}}  //empirical - needed to cut off large number of low energy nucleons
-      //      LOG("INukeUtils",pDEBUG) "sigtot for proton= " << sigtot << "; KE= " << ke << "; E0= " << E0;
-    }
-  else if (pdgc == kPdgNeutron)
-    {
-      sigtot = fHadroData2018 -> XSecPn_Tot()   -> Evaluate(ke)*ppcnt;
-      sigtot+= fHadroData2018 -> XSecNn_Tot()   -> Evaluate(ke)*(1-ppcnt);
-      double E0 = TMath::Power(A,0.2)*12.;
-      if (INukeMode=="hN2018"){if(ke<E0){sigtot=0.0;}}  //empirical - needed to cut off large number of low energy nucleons
-      //      LOG("INukeUtils",pDEBUG) "sigtot for neutron= " << sigtot << "; KE= " << ke;
-    }
-  else if (pdgc == kPdgKP)
-    { sigtot = fHadroData2018 -> XSecKpN_Tot()  -> Evaluate(ke);
-      // this factor is used to empirically get agreement with tot xs data, justified historically.
-      sigtot*=1.1;}
-  else if (pdgc == kPdgGamma)
-    { sigtot = fHadroData2018 -> XSecGamp_fs()  -> Evaluate(ke)*ppcnt;
-      sigtot+= fHadroData2018 -> XSecGamn_fs()  -> Evaluate(ke)*(1-ppcnt);}
-  else {
-     return 0;
+  if(ke < INukeHadroData2018::fMinKinEnergy || ke >= INukeHadroData2018::fMaxKinEnergyHN) {
+    return MeanFreePath(pdgc, x4, p4, A, Z, cfg);
   }
 
-  // the xsection splines in INukeHadroData return the hadron x-section in
-  // mb -> convert to fm^2
-  sigtot *= (units::mb / units::fm2);
-
-  // avoid defective error handling
-  //if(sigtot<1E-6){sigtot=1E-6;}
+  const MFPTable * t = GetMFPTable(pdgc, A, Z, cfg);
 
-  if (xsecNNCorr and is_nucleon)
-    sigtot *= INukeNucleonCorr::getInstance()->
-      getAvgCorrection (rho, A, p4.E() - PDGLibrary::Instance()->Find(pdgc)->Mass());   //uses lookup tables
-
-  // avoid defective error handling
-  if(sigtot<1E-6){sigtot=1E-6;}
-
-  // compute the mean free path
-  double lamda = 1. / (rho * sigtot);
+  double ur = x4.Vect().Mag() / t->fDR;
+  double uk = (TMath::Log(ke) - t->fLogKEMin) / t->fDLogKE;
+  int ir  = (int) ur;
+  int ike = TMath::Min( (int) uk, t->fNKE-2 );
+  if(ir >= t->fNR-1 || ike < 0) {
+    return MeanFreePath(pdgc, x4, p4, A, Z, cfg);
+  }
 
-  // exits if lamda is InF (if cross section is 0)
-  if( ! TMath::Finite(lamda) ) {
-     return -1;
+  int i = ir * t->fNKE + ike;
+  if(t->fDirect[i]) {
+    return MeanFreePath(pdgc, x4, p4, A, Z, cfg);
   }
 
-/*
-  LOG("INukeUtils", pDEBUG)
-     << "sig_total = " << sigtot << " fm^2, rho = " << rho
-     << " fm^-3  => mfp = " << lamda << " fm.";
-*/
-  return lamda;
+  // bilinear interpolation
+  double fr = ur - ir, fk = uk - ike;
+  double w00 = (1-fr)*(1-fk), w01 = (1-fr)*fk, w10 = fr*(1-fk), w11 = fr*fk;
+  int j = i + t->fNKE;
+  double rho    = w00*t->fRho[i] + w01*t->fRho[i+1] + w10*t->fRho[j] + w11*t->fRho[j+1];
+  double sigtot = w00*t->fSig[i] + w01*t->fSig[i+1] + w10*t->fSig[j] + w11*t->fSig[j+1];
+
+  return MFP(rho, sigtot);
 }
 //____________________________________________________________________________
 double genie::utils::intranuke2018::MeanFreePath_Delta(
@@ -252,7 +453,7 @@ double genie::utils::intranuke2018::MeanFreePath_Delta(
 
   // get the nuclear density at the current position
   double rnow = x4.Vect().Mag();
-  double rho  = A * utils::nuclear::Density(rnow,(int) A);
+  double rho  = A * NuclearDensityProfile::Instance((int) A)->Density(rnow);
 
   // the Delta+N->N+N cross section will be evaluated within the range
   // of the input spline and assumed to be const outside that range
@@ -600,12 +801,10 @@ void genie::utils::intranuke2018::PreEquilibrium(
   // change particle status for decaying particle - take out as test
   //ev->Particle(f_loc)->SetStatus(kIStIntermediateState);
   // decay a clone particle
-  GHepParticle * t = new GHepParticle(*(ev->Particle(f_loc)));
-  t->SetFirstMother(f_loc);
   //next statement was in Alex Bell's original code - PreEq, then Equilibrium using particle with highest energy.  Note it gets IST=kIStIntermediateState.
+  //GHepParticle * t = new GHepParticle(*(ev->Particle(f_loc)));
+  //t->SetFirstMother(f_loc);
   //genie::utils::intranuke2018::Equilibrium(ev,t,RemnA,RemnZ,RemnP4,DoFermi,FermiFac,Nuclmodel,NucRmvE,mode);
-
-  delete t;
 }
 //___________________________________________________________________________
 // Method to handle Equilibrium reaction
@@ -722,18 +921,15 @@ bool genie::utils::intranuke2018::TwoBodyCollision(
   // random number generator
   //RandomGen * rnd = RandomGen::Instance();
 
-  // handle fermi target
-  Target target(ev->TargetNucleus()->Pdg());
-
   // get mass for particles
-  M1 = pLib->Find(pcode)->Mass();
-  // usused // M2 = pLib->Find(tcode)->Mass();
-  M3 = pLib->Find(scode)->Mass();
-  M4 = pLib->Find(s2code)->Mass();
+  M1 = pLib->Mass(pcode);
+  // usused // M2 = pLib->Mass(tcode);
+  M3 = pLib->Mass(scode);
+  M4 = pLib->Mass(s2code);
 
-  // get lab energy and momenta and assign to 4 vectors
-  TLorentzVector t4P1L = *p->P4();
-  TLorentzVector t4P2L = *t->P4();
+  // get lab energy and momenta
+  const TLorentzVector & t4P1L = *p->P4();
+  const TLorentzVector & t4P2L = *t->P4();
 
   // binding energy
   double bindE = 0.025; // empirical choice, might need to be improved
@@ -1661,32 +1857,37 @@ bool genie::utils::intranuke2018::PhaseSpaceDecay(
 
   // Get the decay product masses & names
 
+  // (the mass buffer is kept, to avoid an allocation at each decay; the
+  // final state is only described if it is to be printed out)
+  bool describe_state = LOG_ENABLED("INukeUtils", pINFO);
   ostringstream state_sstream;
-  state_sstream << "( ";
+  if(describe_state) state_sstream << "( ";
   vector<int>::const_iterator pdg_iter;
   int i = 0;
-  double * mass = new double[pdgv.size()];
+  static thread_local vector<double> mass;
+  mass.resize(pdgv.size());
   double   mass_sum = 0;
   for(pdg_iter = pdgv.begin(); pdg_iter != pdgv.end(); ++pdg_iter) {
     int pdgc = *pdg_iter;
-    double m  = PDGLibrary::Instance()->Find(pdgc)->Mass();
-    string nm = PDGLibrary::Instance()->Find(pdgc)->GetName();
+    double m  = PDGLibrary::Instance()->Mass(pdgc);
     mass[i++] = m;
     mass_sum += m;
-    state_sstream << nm << " ";
+    if(describe_state) {
+      state_sstream << PDGLibrary::Instance()->Find(pdgc)->GetName() << " ";
+    }
   }
-  state_sstream << ")";
+  if(describe_state) state_sstream << ")";
 
-  TLorentzVector * pd = p->GetP4(); // incident particle 4p
+  TLorentzVector pd = *p->P4(); // incident particle 4p
 
   bool is_nuc  = pdg::IsNeutronOrProton(p->Pdg());
   bool is_kaon = p->Pdg()==kPdgKP  || p->Pdg()==kPdgKM;
   // not used // bool is_pion = p->Pdg()==kPdgPiP || p->Pdg()==kPdgPi0 || p->Pdg()==kPdgPiM;
   // update available energy -> init (mass + kinetic) + sum of f/s masses
   // for pion only.  Probe mass not available for nucleon, kaon
-  double availE = pd->Energy() + mass_sum;
+  double availE = pd.Energy() + mass_sum;
   if(is_nuc||is_kaon) availE -= p->Mass();
-  pd->SetE(availE);
+  pd.SetE(availE);
 
   LOG("INukeUtils",pNOTICE)
     << "size, mass_sum, availE, pd mass, energy = " << pdgv.size() << "  "
@@ -1702,21 +1903,21 @@ bool genie::utils::intranuke2018::PhaseSpaceDecay(
     << "Final state = " << state_sstream.str() << " has N = " << pdgv.size()
     << " particles / total mass = " << mass_sum;
   LOG("INukeUtils", pINFO)
-    << "Composite system p4 = " << utils::print::P4AsString(pd);
+    << "Composite system p4 = " << utils::print::P4AsString(&pd);
 
   // Set the decay
-  TGenPhaseSpace GenPhaseSpace;
-  bool permitted = GenPhaseSpace.SetDecay(*pd, pdgv.size(), mass);
+  // (the generator is kept so that the max weights of each decay type are
+  // not re-estimated at every decay)
+  static thread_local NBodyPhaseSpace GenPhaseSpace;
+  bool permitted = GenPhaseSpace.SetDecay(pd, pdgv.size(), &mass[0]);
   if(!permitted) {
      LOG("INukeUtils", pERROR)
        << " *** Phase space decay is not permitted \n"
        << " Total particle mass = " << mass_sum << "\n"
-       << " Decaying system p4 = " << utils::print::P4AsString(pd);
+       << " Decaying system p4 = " << utils::print::P4AsString(&pd);
 
-     // clean-up and return
+     // restore and return
      RemnP4 += premnsub;
-     delete [] mass;
-     delete pd;
      return false;
   }
 
@@ -1726,11 +1927,7 @@ bool genie::utils::intranuke2018::PhaseSpaceDecay(
   p->SetPdgCode(kPdgCompNuclCluster);
   ev->AddParticle(*p);
   // Get the maximum weight
-  double wmax = -1;
-  for(int k=0; k<200; k++) {
-     double w = GenPhaseSpace.Generate();
-     wmax = TMath::Max(wmax,w);
-  }
+  double wmax = GenPhaseSpace.MaxWeight();
   assert(wmax>0);
 
   LOG("INukeUtils", pINFO)
@@ -1749,17 +1946,16 @@ bool genie::utils::intranuke2018::PhaseSpaceDecay(
     itry++;
 
     if(itry>kMaxUnweightDecayIterations) {
-       // report, clean-up and return
+       // report and return
        LOG("INukeUtils", pNOTICE)
              << "Couldn't generate an unweighted phase space decay after "
              << itry << " attempts";
-       delete [] mass;
-       delete pd;
        return false;
     }
 
     double w  = GenPhaseSpace.Generate();
     double gw = wmax * rnd->RndFsi().Rndm();
+    GenPhaseSpace.UpdateMaxWeight(w);
 
     if(w > wmax) {
        LOG("INukeUtils", pNOTICE)
@@ -1779,7 +1975,7 @@ bool genie::utils::intranuke2018::PhaseSpaceDecay(
   GHepStatus_t ist = kIStStableFinalState;
   GHepStatus_t ist_pi = kIStHadronInTheNucleus;
 
-  TLorentzVector * v4 = p->GetX4();
+  const TLorentzVector v4 = *p->X4();
 
   double checkpx = p->Px();
   double checkpy = p->Py();
@@ -1792,7 +1988,6 @@ bool genie::utils::intranuke2018::PhaseSpaceDecay(
 
      //-- current PDG code
      int pdgc = *pdg_iter;
-     bool isnuc = pdg::IsNeutronOrProton(pdgc);
 
      //-- get the 4-momentum of the i-th final state particle
      TLorentzVector * p4fin = GenPhaseSpace.GetDecay(i++);
@@ -1801,7 +1996,7 @@ bool genie::utils::intranuke2018::PhaseSpaceDecay(
      //   not going at a simulated f/s particle at a "hadronic blob"
      //   representing the remnant system: do the binding energy subtraction
      //   here & update the remnant hadronic system 4p
-     double M  = PDGLibrary::Instance()->Find(pdgc)->Mass();
+     double M  = mass[i-1];
      double En = p4fin->Energy();
 
      double KE = En-M;
@@ -1832,8 +2027,7 @@ bool genie::utils::intranuke2018::PhaseSpaceDecay(
        {
          if (p4n.Vect().Mag()>=0.001)
            {
-             GHepParticle new_particle(pdgc, ist_pi, mom,-1,-1,-1, p4n, *v4);
-             ev->AddParticle(new_particle);
+             ev->AddParticle(pdgc, ist_pi, mom,-1,-1,-1, p4n, v4);
            }
          else
            {
@@ -1853,16 +2047,13 @@ bool genie::utils::intranuke2018::PhaseSpaceDecay(
 
              RemnP4 -= (p4n - TLorentzVector(0,0,0,M));
 
-             GHepParticle new_particle(pdgc, ist, mom,-1,-1,-1, p4n, *v4);
-             ev->AddParticle(new_particle);
+             ev->AddParticle(pdgc, ist, mom,-1,-1,-1, p4n, v4);
            }
        }
      else
        {
-         GHepParticle new_particle(pdgc, ist, mom,-1,-1,-1, p4n, *v4);
-
-         if(isnuc) new_particle.SetRemovalEnergy(0.);
-         ev->AddParticle(new_particle);
+         // (nucleons are added with a null removal energy)
+         ev->AddParticle(pdgc, ist, mom,-1,-1,-1, p4n, v4);
        }
 
      double dpx = (1-scale)*p4fin->Px();
@@ -1875,11 +2066,6 @@ bool genie::utils::intranuke2018::PhaseSpaceDecay(
   LOG("INukeUtils", pNOTICE) << "check conservation: Px = " << checkpx << " Py = " << checkpy
                              << " Pz = " << checkpz << " E = " << checkE;
 
-  // Clean-up
-  delete [] mass;
-  delete pd;
-  delete v4;
-
   return true;
 }
 
@@ -30,6 +30,7 @@
 #include "Physics/NuclearState/NuclearModelI.h"
 #include "Physics/HadronTransport/INukeHadroFates2018.h"
 #include "Physics/HadronTransport/INukeMode.h"
+#include "Physics/HadronTransport/INukeStepConfig.h"
 #include "Physics/HadronTransport/INukeNucleonCorr.h"
 
 class TLorentzVector;
@@ -53,7 +54,19 @@ namespace intranuke2018
   double MeanFreePath(
     int pdgc, const TLorentzVector & x4, const TLorentzVector & p4, double A,
     double Z, double nRpi=0.5, double nRnuc=1.0, const bool useOset = false, const bool altOset = false, const bool xsecNNCorr = false, string INukeMode = "XX2018");
- 
+
+  //! Mean free path (pions, nucleons), for the given INTRANUKE configuration
+  double MeanFreePath(
+    int pdgc, const TLorentzVector & x4, const TLorentzVector & p4, double A,
+    double Z, const INukeStepConfig & cfg);
+
+  //! Mean free path (pions, nucleons), interpolated in tables of the density
+  //! and x-section vs (r, KE) built per thread at the first use for a given
+  //! hadron, nucleus and configuration
+  double MeanFreePathTab(
+    int pdgc, const TLorentzVector & x4, const TLorentzVector & p4, double A,
+    double Z, const INukeStepConfig & cfg);
+
   //! Mean free path (Delta++ **test**)
   double MeanFreePath_Delta(
 			    int pdgc, const TLorentzVector & x4, const TLorentzVector & p4, double A );
@@ -56,6 +56,7 @@
 */
 //____________________________________________________________________________
 
+#include <cassert>
 #include <cstdlib>
 #include <sstream>
 
@@ -66,6 +67,7 @@
 #include "Framework/Conventions/GBuild.h"
 #include "Framework/Conventions/Constants.h"
 #include "Framework/Conventions/Controls.h"
+#include "Framework/Conventions/Units.h"
 #include "Framework/GHEP/GHepStatus.h"
 #include "Framework/GHEP/GHepRecord.h"
 #include "Framework/GHEP/GHepParticle.h"
@@ -316,7 +318,7 @@ void Intranuke2018::TransportHadrons(GHepRecord * evrec) const
                         << " with kinetic E = " << p->KinE() << " GeV";
 
     // Rescatter a clone, not the original particle
-    GHepParticle * sp = new GHepParticle(*p); 
+    GHepParticle * sp = this->CloneParticle(*p, 0);
 
     // Set clone's mom to be the hadron that was cloned
     sp->SetFirstMother(icurr); 
@@ -330,7 +332,6 @@ void Intranuke2018::TransportHadrons(GHepRecord * evrec) const
        sp->SetFirstMother(icurr); 
        sp->SetStatus(kIStStableFinalState);
        evrec->AddParticle(*sp);
-       delete sp;
        continue; // <-- skip to next GHEP entry
     }
 
@@ -371,7 +372,6 @@ void Intranuke2018::TransportHadrons(GHepRecord * evrec) const
 	evrec->AddParticle(*sp);
 	evrec->Particle(sp->FirstMother())->SetRescatterCode(1);
     }
-    delete sp;
 
     // Current snapshot
     //LOG("Intranuke2018", pINFO) << "Current event record snapshot: " << *evrec;
@@ -399,36 +399,95 @@ double Intranuke2018::GenerateStep(GHepRecord*  /*evrec*/, GHepParticle* p) cons
 // Computes the mean free path L and generate an 'interaction' distance d 
 // from an exp(-d/L) distribution
 
-  int pdgc = p->Pdg();
-
-  double scale = 1.;
-  if (pdgc==kPdgPiP || pdgc==kPdgPiM || pdgc==kPdgPi0) {
-    scale = fPionMFPScale;
-  }
-  else if (pdgc==kPdgProton || pdgc==kPdgNeutron) {
-    scale = fNucleonMFPScale;
-  }
-
   RandomGen * rnd = RandomGen::Instance();
 
-  string fINukeMode = this->GetINukeMode();
-  string fINukeModeGen = this->GetGenINukeMode();
-
-  double L = utils::intranuke2018::MeanFreePath(p->Pdg(), *p->X4(), *p->P4(), fRemnA,
-						fRemnZ, fDelRPion, fDelRNucleon, fUseOset, fAltOset, fXsecNNCorr, fINukeMode);
+  double L = this->MeanFreePath(p->Pdg(), *p->X4(), *p->P4(), fRemnA, fRemnZ);
 
-  LOG("Intranuke2018", pDEBUG)    << "mode= " << fINukeModeGen;
-  if(fINukeModeGen == "hA") L *= scale;
+  LOG("Intranuke2018", pDEBUG)    << "mode= " << INukeMode::AsString(fStepConfig.Mode());
 
   double d = -1.*L * TMath::Log(rnd->RndFsi().Rndm());
 
   /*    LOG("Intranuke2018", pDEBUG)
-    << "mode= " << fINukeMode << "; Mean free path = " << L << " fm / "
+    << "mode= " << INukeMode::AsString(fStepConfig.Mode()) << "; Mean free path = " << L << " fm / "
                               << "Generated path length = " << d << " fm";
   */
   return d;
 }
 //___________________________________________________________________________
+double Intranuke2018::MeanFreePath(int pdgc,
+  const TLorentzVector & x4, const TLorentzVector & p4, int A, int Z) const
+{
+// Mean free path (in fermis) of the hadron, including the hA mode tweaks
+
+  double L = fTabulateMFP ?
+    utils::intranuke2018::MeanFreePathTab(pdgc, x4, p4, A, Z, fStepConfig) :
+    utils::intranuke2018::MeanFreePath   (pdgc, x4, p4, A, Z, fStepConfig);
+
+  if(fStepConfig.IsHA()) {
+    if (pdgc==kPdgPiP || pdgc==kPdgPiM || pdgc==kPdgPi0) {
+      L *= fPionMFPScale;
+    }
+    else if (pdgc==kPdgProton || pdgc==kPdgNeutron) {
+      L *= fNucleonMFPScale;
+    }
+  }
+  return L;
+}
+//___________________________________________________________________________
+double Intranuke2018::ReactionXSec(int pdgc, double ke, int A, int Z, int nb) const
+{
+// Computes the cross section for a hadron with the input kinetic energy (in
+// GeV) to interact in a nucleus (A,Z), without generating events.
+// The hadron is fired uniformly over the tracking disk, as in GenerateVertex(),
+// and is stepped in straight line, as in TransportHadrons(), until it exits
+// the nucleus: the interaction probability 1-exp(-sum_{steps}(step/L)) is
+// integrated over impact parameter rings.
+// The cross section is returned in natural units.
+
+  double m  = PDGLibrary::Instance()->Mass(pdgc);
+  double E  = m + ke;
+  double pz = TMath::Sqrt(TMath::Max(0., E*E - m*m));
+  TLorentzVector p4(0., 0., pz, E);
+
+  double R = fR0 * TMath::Power(A, 1./3.) * fNR;
+  double epsilon = 0.001; // as in GenerateVertex()
+  double db = R/nb;
+
+  TLorentzVector x4(0., 0., 0., 0.);
+  double sum = 0.;
+  for(int ib = 0; ib < nb; ib++) {
+    double b = (ib + 0.5) * db;
+    double z = -1.*TMath::Sqrt(TMath::Max(0., R*R - b*b)) + epsilon;
+    double opacity = 0.;
+    while(TMath::Sqrt(b*b + z*z) < R + fHadStep) {
+      z += fHadStep;
+      x4.SetXYZT(b, 0., z, 0.);
+      opacity += fHadStep / this->MeanFreePath(pdgc, x4, p4, A, Z);
+    }
+    sum += b * (1. - TMath::Exp(-opacity));
+  }
+  double xsec = 2. * kPi * sum * db; // fm^2
+
+  LOG("Intranuke2018", pINFO)
+     << "Reaction x-section for " << pdgc << " with KE = " << ke
+     << " GeV on (A,Z) = (" << A << ", " << Z << "): " << 10.*xsec << " mb";
+
+  return xsec * units::fm2;
+}
+//___________________________________________________________________________
+GHepParticle * Intranuke2018::CloneParticle(const GHepParticle & p, int slot) const
+{
+// Copy the input particle into a clone kept by the module. Unlike creating a
+// new particle, the copy reuses the 4-momentum and 4-position of the clone, so
+// that no memory is allocated at each interaction of the cascade.
+// The clone is valid until CloneParticle() is called again for the same slot.
+
+  assert(slot >= 0 && slot < 3);
+  GHepParticle * clone = &fClones[slot];
+  clone->Copy(p);
+  return clone;
+}
+//___________________________________________________________________________
 void Intranuke2018::Configure(const Registry & config)
 {
   Algorithm::Configure(config);
@@ -37,7 +37,9 @@
 #include "Framework/Algorithm/AlgFactory.h"
 #include "Framework/EventGen/EventRecordVisitorI.h"
 #include "Framework/Conventions/GMode.h"
+#include "Framework/GHEP/GHepParticle.h"
 #include "Physics/HadronTransport/INukeMode.h"
+#include "Physics/HadronTransport/INukeStepConfig.h"
 #include "Physics/HadronTransport/INukeHadroFates2018.h"
 
 class TLorentzVector;
@@ -72,6 +74,11 @@ public :
   virtual string GetINukeMode() const {return "XX2018";};
   virtual string GetGenINukeMode() const {return "XX";};
 
+  //! cross section (in natural units) for a hadron with kinetic energy ke
+  //! (in GeV) to interact in nucleus (A,Z), integrated from the mean free
+  //! path over nb impact parameter rings, without generating events
+  double ReactionXSec (int pdgc, double ke, int A, int Z, int nb=100) const;
+
 protected:
 
   // methods for loading configuration
@@ -85,6 +92,12 @@ protected:
   bool   IsInNucleus        (const GHepParticle* p) const;
   void   SetTrackingRadius  (const GHepParticle* p) const;
   double GenerateStep       (GHepRecord* ev, GHepParticle* p) const;
+  double MeanFreePath       (int pdgc, const TLorentzVector & x4,
+                             const TLorentzVector & p4, int A, int Z) const;
+
+  // reusable hadron clones: slot 0 for the hadron being transported, slots
+  // 1 and 2 for the hadrons cloned at its interaction
+  GHepParticle * CloneParticle (const GHepParticle & p, int slot) const;
 
   // virtual functions for individual modes
   virtual void SimulateHadronicFinalState(GHepRecord* ev, GHepParticle* p) const = 0;
@@ -100,6 +113,7 @@ protected:
   mutable int            fRemnZ;         ///< remnant nucleus Z
   mutable TLorentzVector fRemnP4;        ///< P4 of remnant system
   mutable GEvGenMode_t   fGMode;         ///< event generation mode (lepton+A, hadron+A, ...)
+  mutable GHepParticle   fClones[3];     ///< see CloneParticle()
 
   // configuration parameters
   double       fR0;           ///< effective nuclear size param
@@ -119,6 +133,8 @@ protected:
   bool         fUseOset;      ///< Oset model for low energy pion in hN
   bool         fAltOset;      ///< NuWro's table-based implementation (not recommended)
   bool         fXsecNNCorr;   ///< use nuclear medium correction for NN cross section
+  bool         fTabulateMFP;  ///< interpolate the mean free path in per-nucleus tables
+  INukeStepConfig fStepConfig; ///< mean free path configuration, set at LoadConfig
 
   double       fPionMFPScale;       ///< tweaking factors for tuning
   double       fPionFracCExScale;
@@ -242,7 +242,7 @@ TClonesArray * AGCharm2019::Hadronize(
 
      // Generate the charm hadron pT^2 and pL^2 (with respect to the
      // hadronic system direction @ the LAB)
-     double ptc2 = fCharmPT2pdf->GetRandom();
+     double ptc2 = fCharmPT2Table.Sample( rnd->RndHadro().Rndm() );
      double plc2 = Ec2 - ptc2 - mc2;
      LOG("CharmHad", pINFO)
            << "Trying charm hadron pT^2 (tranv to pHad) = " << ptc2;
@@ -810,11 +810,19 @@ void AGCharm2019::LoadConfig(void)
   string pt_function ;
   this -> GetParam( "PTFunction", pt_function ) ;
 
+  delete fCharmPT2pdf;
   fCharmPT2pdf = new TF1("fCharmPT2pdf", pt_function.c_str(),0,0.6);
 
   // stop ROOT from deleting this object of its own volition
   gROOT->GetListOfFunctions()->Remove(fCharmPT2pdf);
 
+  const TF1 * pt2pdf = fCharmPT2pdf;
+  if( ! fCharmPT2Table.Build( [pt2pdf] (double pt2) { return pt2pdf->Eval(pt2); }, 0., 0.6 ) ) {
+    LOG("CharmHad", pFATAL) << "Invalid charm hadron pT^2 pdf: " << pt_function ;
+    gAbortingInErr = true;
+    exit(1);
+  }
+
   // neutrino charm fractions: D^0, D^+, Ds^+ (remainder: Lamda_c^+)
   std::vector<double> ec, d0frac, dpfrac, dsfrac ;
 
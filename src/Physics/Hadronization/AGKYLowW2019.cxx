@@ -24,6 +24,7 @@
 //____________________________________________________________________________
 
 #include <cstdlib>
+#include <algorithm>
 
 #include <RVersion.h>
 #include <TSystem.h>
@@ -62,7 +63,10 @@ using namespace genie::utils::print;
 
 //____________________________________________________________________________
 AGKYLowW2019::AGKYLowW2019() :
-EventRecordVisitorI("genie::AGKYLowW2019")
+EventRecordVisitorI("genie::AGKYLowW2019"),
+fParticleList("genie::GHepParticle", 20),
+fPDGCodes(true),
+fPDGCodesStrip(true)
 {
   fBaryonXFpdf  = 0;
   fBaryonPT2pdf = 0;
@@ -70,7 +74,10 @@ EventRecordVisitorI("genie::AGKYLowW2019")
 }
 //____________________________________________________________________________
 AGKYLowW2019::AGKYLowW2019(string config) :
-EventRecordVisitorI("genie::AGKYLowW2019", config)
+EventRecordVisitorI("genie::AGKYLowW2019", config),
+fParticleList("genie::GHepParticle", 20),
+fPDGCodes(true),
+fPDGCodesStrip(true)
 {
   fBaryonXFpdf  = 0;
   fBaryonPT2pdf = 0;
@@ -159,7 +166,8 @@ void AGKYLowW2019::ProcessEventRecord(GHepRecord * event) const {
     event->AddParticle(*particle);
   }
 
-  delete particle_list ;
+  // the particle list is owned by the hadronizer and reused
+  particle_list->Delete();
 
   // update the weight of the event
   event -> SetWeight ( Weight() * event->Weight() );
@@ -170,7 +178,8 @@ TClonesArray * AGKYLowW2019::Hadronize(
                                         const Interaction * interaction) const
 {
 // Generate the hadronic system in a neutrino interaction using a KNO-based
-// model.
+// model. The returned list is owned by the hadronizer and is overwritten by
+// the next call.
 
   if(!this->AssertValidity(interaction)) {
      LOG("KNOHad", pWARN) << "Returning a null particle list!";
@@ -182,7 +191,7 @@ TClonesArray * AGKYLowW2019::Hadronize(
   LOG("KNOHad", pINFO) << "W = " << W << " GeV";
 
   //-- Select hadronic shower particles
-  PDGCodeList * pdgcv = this->SelectParticles(interaction);
+  const PDGCodeList * pdgcv = this->SelectParticles(interaction);
 
   if(!pdgcv) {
     LOG("KNOHad", pNOTICE)
@@ -204,43 +213,41 @@ TClonesArray * AGKYLowW2019::Hadronize(
   //      keep the option of using simple phase space decay with reweighting switched
   //      off (for consistency with the neugen/daikon version).
   //
-  TClonesArray * particle_list = 0;
+  TClonesArray * particle_list = &fParticleList;
+  particle_list->Delete();
+
+  bool decayed = false;
   bool reweight_decays = fReWeightDecays;
   if(fUseBaryonXfPt2Param) {
     bool use_isotropic_decay = (pdgcv->size()==2 && fUseIsotropic2BDecays);
     if(use_isotropic_decay) {
-       particle_list = this->DecayMethod1(W,*pdgcv,false);
+       decayed = this->DecayMethod1(W,*pdgcv,false,particle_list);
     } else {
-       particle_list = this->DecayMethod2(W,*pdgcv,reweight_decays);
+       decayed = this->DecayMethod2(W,*pdgcv,reweight_decays,particle_list);
     }
   } else {
-   particle_list = this->DecayMethod1(W,*pdgcv,reweight_decays);
+   decayed = this->DecayMethod1(W,*pdgcv,reweight_decays,particle_list);
   }
 
-  if(!particle_list) {
+  if(!decayed) {
     LOG("KNOHad", pNOTICE)
         << "Failed decaying a hadronic system @ W=" << W
         << "with  multiplicity=" << pdgcv->size();
-
-    // clean-up and exit
-    delete pdgcv;
     return 0;
   }
 
   //-- Handle unstable particle decays (if requested)
   this->HandleDecays(particle_list);
 
-  //-- The container 'owns' its elements
-  particle_list->SetOwner(true);
-
-  delete pdgcv;
-
   return particle_list;
 }
 //____________________________________________________________________________
-PDGCodeList * AGKYLowW2019::SelectParticles(
+const PDGCodeList * AGKYLowW2019::SelectParticles(
                                        const Interaction * interaction) const
 {
+// Returns the hadronic system particle codes. The returned list is owned by
+// the hadronizer and is overwritten by the next call.
+
   if(!this->AssertValidity(interaction)) {
      LOG("KNOHad", pWARN) << "Returning a null particle list!";
      return 0;
@@ -248,7 +255,7 @@ PDGCodeList * AGKYLowW2019::SelectParticles(
 
   unsigned int min_mult = 2;
   unsigned int mult     = 0;
-  PDGCodeList * pdgcv   = 0;
+  PDGCodeList * pdgcv   = &fPDGCodes;
 
   double W = utils::kinematics::W(interaction);
 
@@ -258,19 +265,30 @@ PDGCodeList * AGKYLowW2019::SelectParticles(
   LOG("KNOHad", pINFO) << "Hadron Shower Charge = " << maxQ;
 
    //-- Build the multiplicity probabilities for the input interaction
+   //   (or look up the tabulated ones)
   LOG("KNOHad", pDEBUG) << "Building Multiplicity Probability distribution";
   LOG("KNOHad", pDEBUG) << *interaction;
-  Option_t * opt = "+LowMultSuppr+Renormalize";
-  TH1D * mprob = this->MultiplicityProb(interaction,opt);
+  TH1D * mprob = 0;
+  const vector<double> * mcdf = 0;
+  if(fMultProbWBin > 0) {
+    mcdf = &this->MultiplicityCDF(interaction);
+    if(mcdf->empty() || mcdf->back()<=0) {
+      LOG("KNOHad", pWARN) << "Empty multiplicity probability distribution!";
+      return 0;
+    }
+  } else {
+    Option_t * opt = "+LowMultSuppr+Renormalize";
+    mprob = this->MultiplicityProb(interaction,opt);
 
-  if(!mprob) {
-    LOG("KNOHad", pWARN) << "Null multiplicity probability distribution!";
-    return 0;
-  }
-  if(mprob->Integral("width")<=0) {
-    LOG("KNOHad", pWARN) << "Empty multiplicity probability distribution!";
-    delete mprob;
-    return 0;
+    if(!mprob) {
+      LOG("KNOHad", pWARN) << "Null multiplicity probability distribution!";
+      return 0;
+    }
+    if(mprob->Integral("width")<=0) {
+      LOG("KNOHad", pWARN) << "Empty multiplicity probability distribution!";
+      delete mprob;
+      return 0;
+    }
   }
 
   //----- FIND AN ALLOWED SOLUTION FOR THE HADRONIC FINAL STATE
@@ -292,7 +310,13 @@ PDGCodeList * AGKYLowW2019::SelectParticles(
     }
 
     //-- Generate a hadronic multiplicity
-    mult = TMath::Nint( mprob->GetRandom() );
+    if(mcdf) {
+      double u = mcdf->back() * RandomGen::Instance()->RndHadro().Rndm();
+      unsigned int i = std::upper_bound(mcdf->begin(), mcdf->end(), u) - mcdf->begin();
+      mult = min_mult + TMath::Min(i, (unsigned int) mcdf->size()-1);
+    } else {
+      mult = TMath::Nint( mprob->GetRandom() );
+    }
 
     LOG("KNOHad", pINFO) << "Hadron multiplicity  = " << mult;
 
@@ -323,7 +347,7 @@ PDGCodeList * AGKYLowW2019::SelectParticles(
     }
 
     //-- Determine what kind of particles we have in the final state
-    pdgcv = this->GenerateHadronCodes(mult, maxQ, W);
+    this->GenerateHadronCodes(mult, maxQ, W, pdgcv);
 
     LOG("KNOHad", pNOTICE)
          << "Generated multiplicity (@ W = " << W << "): " << pdgcv->size();
@@ -348,7 +372,6 @@ PDGCodeList * AGKYLowW2019::SelectParticles(
        LOG("KNOHad", pWARN) << "*** Decay forbidden by kinematics! ***";
        LOG("KNOHad", pWARN) << "sum{mass} = " << msum << ", W = " << W;
        LOG("KNOHad", pWARN) << "Discarding hadronic system & re-trying!";
-       delete pdgcv;
        allowed_state = false;
        continue;
     }
@@ -387,6 +410,18 @@ TH1D * AGKYLowW2019::MultiplicityProb(
      return 0;
   }
 
+  // Find the max possible multiplicity as W = Mneutron + (maxmult-1)*Mpion
+  double W       = utils::kinematics::W(interaction);
+  double maxmult = this->MaxMult(interaction);
+
+  return this->MultiplicityProb(interaction, W, maxmult, opt);
+}
+//____________________________________________________________________________
+TH1D * AGKYLowW2019::MultiplicityProb(const Interaction * interaction,
+                          double W, double maxmult, Option_t * opt) const
+{
+// As above, for the input hadronic invariant mass and max multiplicity
+
   const InitialState & init_state = interaction->InitState();
   int nu_pdg  = init_state.ProbePdg();
   int nuc_pdg = init_state.Tgt().HitNucPdg();
@@ -394,16 +429,12 @@ TH1D * AGKYLowW2019::MultiplicityProb(
   // Compute the average charged hadron multiplicity as: <n> = a + b*ln(W^2)
   // Calculate avergage hadron multiplicity (= 1.5 x charged hadron mult.)
 
-  double W     = utils::kinematics::W(interaction);
   double avnch = this->AverageChMult(nu_pdg, nuc_pdg, W);
   double avn   = 1.5*avnch;
 
   SLOG("KNOHad", pINFO)
       << "Average hadronic multiplicity (W=" << W << ") = " << avn;
 
-  // Find the max possible multiplicity as W = Mneutron + (maxmult-1)*Mpion
-  double maxmult = this->MaxMult(interaction);
-
   // If required force the NeuGEN maximum multiplicity limit (10)
   // Note: use for NEUGEN/GENIE comparisons, not physics MC production
   if(fForceNeuGenLimit && maxmult>10) maxmult=10;
@@ -477,6 +508,47 @@ TH1D * AGKYLowW2019::MultiplicityProb(
   return mult_prob;
 }
 //____________________________________________________________________________
+const vector<double> & AGKYLowW2019::MultiplicityCDF(
+                                    const Interaction * interaction) const
+{
+// Returns the (unnormalized) cumulative multiplicity distribution used for
+// generating hadronic multiplicities. The distributions vary slowly with W:
+// they are computed at the centre of W bins (one of their edges being at
+// Wcut) and kept. The max multiplicity is taken at the actual W.
+
+  const InitialState & init_state = interaction->InitState();
+
+  double W       = utils::kinematics::W(interaction);
+  double maxmult = this->MaxMult(interaction);
+  int    iw      = TMath::FloorNint((W-fWcut)/fMultProbWBin);
+
+  MultProbKey_t key(init_state.ProbePdg(), init_state.Tgt().HitNucPdg(),
+                    interaction->ProcInfo().InteractionTypeId(),
+                    (int) maxmult, iw);
+
+  std::map<MultProbKey_t, vector<double> >::const_iterator it = fMultCDFs.find(key);
+  if(it != fMultCDFs.end()) return it->second;
+
+  double Wc = fWcut + (iw+0.5)*fMultProbWBin;
+
+  LOG("KNOHad", pINFO)
+    << "Tabulating the multiplicity distribution @ W = " << Wc
+    << ", max multiplicity = " << maxmult;
+
+  vector<double> & cdf = fMultCDFs[key];
+  TH1D * mprob = this->MultiplicityProb(
+                    interaction, Wc, maxmult, "+LowMultSuppr+Renormalize");
+  if(mprob) {
+    double sum = 0;
+    for(int i = 1; i <= mprob->GetNbinsX(); i++) {
+      sum += mprob->GetBinContent(i);
+      cdf.push_back(sum);
+    }
+    delete mprob;
+  }
+  return cdf;
+}
+//____________________________________________________________________________
 double AGKYLowW2019::Weight(void) const
 {
   return fWeight;
@@ -530,6 +602,17 @@ void AGKYLowW2019::LoadConfig(void)
   // Generated weighted or un-weighted hadronic systems?
   GetParamDef( "GenerateWeighted", fGenerateWeighted, false ) ;
 
+  // Keep the phase space decay max weights, rather than re-estimating them
+  // at every decay? The kept weights depend on the pT reweighting parameter.
+  bool keep_max_weights = true;
+  GetParamDef( "KNO-PhaseSpDec-KeepMaxWeights", keep_max_weights, true ) ;
+  fPhaseSpaceGenerator.SetUseMaxWeightStore(keep_max_weights);
+  fPhaseSpaceGenerator.ClearMaxWeights();
+
+  // Tabulate the multiplicity distributions in W bins of this width (GeV)?
+  GetParamDef( "KNO-MultProb-WBin", fMultProbWBin, 0. ) ;
+  fMultCDFs.clear();
+
 
   // Probabilities for producing hadron pairs
 
@@ -572,6 +655,11 @@ void AGKYLowW2019::LoadConfig(void)
   gROOT->GetListOfFunctions()->Remove(fBaryonXFpdf);
   gROOT->GetListOfFunctions()->Remove(fBaryonPT2pdf);
 
+  const TF1 * xfpdf  = fBaryonXFpdf;
+  const TF1 * pt2pdf = fBaryonPT2pdf;
+  fBaryonXFTable .Build( [xfpdf ] (double xf ) { return xfpdf ->Eval(xf ); }, -1., 0.5 );
+  fBaryonPT2Table.Build( [pt2pdf] (double pt2) { return pt2pdf->Eval(pt2); },  0., 0.6 );
+
 
   // Load parameters determining the average charged hadron multiplicity
   GetParam( "KNO-Alpha-vp",  fAvp ) ;
@@ -726,8 +814,8 @@ int AGKYLowW2019::HadronShowerCharge(const Interaction* interaction) const
   return hadronShowerCharge;
 }
 //____________________________________________________________________________
-TClonesArray * AGKYLowW2019::DecayMethod1(
-               double W, const PDGCodeList & pdgv, bool reweight_decays) const
+bool AGKYLowW2019::DecayMethod1(double W, const PDGCodeList & pdgv,
+                       bool reweight_decays, TClonesArray * plist) const
 {
 // Simple phase space decay including all generated particles.
 // The old NeuGEN decay strategy.
@@ -735,22 +823,20 @@ TClonesArray * AGKYLowW2019::DecayMethod1(
   LOG("KNOHad", pINFO) << "** Using Hadronic System Decay method 1";
 
   TLorentzVector p4had(0,0,0,W);
-  TClonesArray * plist = new TClonesArray("genie::GHepParticle", pdgv.size());
 
   // do the decay
   bool ok = this->PhaseSpaceDecay(*plist, p4had, pdgv, 0, reweight_decays);
 
-  // clean-up and return NULL
+  // clean-up and return
   if(!ok) {
      plist->Delete();
-     delete plist;
-     return 0;
+     return false;
   }
-  return plist;
+  return true;
 }
 //____________________________________________________________________________
-TClonesArray * AGKYLowW2019::DecayMethod2(
-               double W, const PDGCodeList & pdgv, bool reweight_decays) const
+bool AGKYLowW2019::DecayMethod2(double W, const PDGCodeList & pdgv,
+                       bool reweight_decays, TClonesArray * plist) const
 {
 // Generate the baryon based on experimental pT^2 and xF distributions
 // Then pass the remaining system of N-1 particles to a phase space decayer.
@@ -759,7 +845,7 @@ TClonesArray * AGKYLowW2019::DecayMethod2(
   LOG("KNOHad", pINFO) << "** Using Hadronic System Decay method 2";
 
   // If only 2 particles are input then don't call the phase space decayer
-  if(pdgv.size() == 2) return this->DecayBackToBack(W,pdgv);
+  if(pdgv.size() == 2) return this->DecayBackToBack(W,pdgv,plist);
 
   // Now handle the more general case:
 
@@ -772,9 +858,8 @@ TClonesArray * AGKYLowW2019::DecayMethod2(
   // ...
 
   // Strip the PDG list from the baryon
-  bool allowdup = true;
-  PDGCodeList pdgv_strip(pdgv.size()-1, allowdup);
-  for(unsigned int i=1; i<pdgv.size(); i++) pdgv_strip[i-1] = pdgv[i];
+  PDGCodeList & pdgv_strip = fPDGCodesStrip;
+  pdgv_strip.assign(pdgv.begin()+1, pdgv.end());
 
   // Get the sum of all masses for the particles in the stripped list
   double mass_sum = 0;
@@ -784,9 +869,6 @@ TClonesArray * AGKYLowW2019::DecayMethod2(
     mass_sum += PDGLibrary::Instance()->Find(pdgc)->Mass();
   }
 
-  // Create the particle list
-  TClonesArray * plist = new TClonesArray("genie::GHepParticle", pdgv.size());
-
   RandomGen * rnd = RandomGen::Instance();
   TLorentzVector p4had(0,0,0,W);
   TLorentzVector p4N  (0,0,0,0);
@@ -804,8 +886,8 @@ TClonesArray * AGKYLowW2019::DecayMethod2(
     while(!got_baryon_4p) {
 
       //-- generate baryon xF and pT2
-      double xf  = fBaryonXFpdf ->GetRandom();
-      double pt2 = fBaryonPT2pdf->GetRandom();
+      double xf  = fBaryonXFTable .Sample( rnd->RndHadro().Rndm() );
+      double pt2 = fBaryonPT2Table.Sample( rnd->RndHadro().Rndm() );
 
       //-- generate baryon px,py,pz
       double pt  = TMath::Sqrt(pt2);
@@ -855,18 +937,17 @@ TClonesArray * AGKYLowW2019::DecayMethod2(
     }
   }
 
-  // clean-up and return NULL
+  // clean-up and return
   if(0) {
      LOG("KNOHad", pERROR) << "*** Decay forbidden by kinematics! ***";
      plist->Delete();
-     delete plist;
-     return 0;
+     return false;
   }
-  return plist;
+  return true;
 }
 //____________________________________________________________________________
-TClonesArray * AGKYLowW2019::DecayBackToBack(
-                                     double W, const PDGCodeList & pdgv) const
+bool AGKYLowW2019::DecayBackToBack(
+         double W, const PDGCodeList & pdgv, TClonesArray * plist) const
 {
 // Handles a special case (only two particles) of the 2nd decay method
 //
@@ -877,9 +958,6 @@ TClonesArray * AGKYLowW2019::DecayBackToBack(
 
   RandomGen * rnd = RandomGen::Instance();
 
-  // Create the particle list
-  TClonesArray * plist = new TClonesArray("genie::GHepParticle", pdgv.size());
-
   // Get xF,pT2 distribution (y-) maxima for the rejection method
   double xFo  = 1.1 * fBaryonXFpdf ->GetMaximum(-1,1);
   double pT2o = 1.1 * fBaryonPT2pdf->GetMaximum( 0,1);
@@ -898,8 +976,7 @@ TClonesArray * AGKYLowW2019::DecayBackToBack(
     if(!ok) {
       LOG("KNOHad", pERROR) << "*** Decay forbidden by kinematics! ***";
       plist->Delete();
-      delete plist;
-      return 0;
+      return false;
     }
 
     // If the decay was allowed, then compute the baryon xF,pT2 and accept/
@@ -928,7 +1005,7 @@ TClonesArray * AGKYLowW2019::DecayBackToBack(
 
     LOG("KNOHad", pINFO) << ((accepted) ? "Decay accepted":"Decay rejected");
   }
-  return plist;
+  return true;
 }
 //____________________________________________________________________________
 bool AGKYLowW2019::PhaseSpaceDecay(
@@ -949,7 +1026,8 @@ bool AGKYLowW2019::PhaseSpaceDecay(
 
   vector<int>::const_iterator pdg_iter;
   int i = 0;
-  double * mass = new double[pdgv.size()];
+  fMasses.resize(pdgv.size());
+  double * mass = &fMasses[0];
   double   sum  = 0;
   for(pdg_iter = pdgv.begin(); pdg_iter != pdgv.end(); ++pdg_iter) {
     int pdgc = *pdg_iter;
@@ -971,19 +1049,17 @@ bool AGKYLowW2019::PhaseSpaceDecay(
        << " Total particle mass = " << sum << "\n"
        << " Decaying system p4 = " << utils::print::P4AsString(&pd);
 
-     // clean-up and return
-     delete [] mass;
      return false;
   }
 
-  // Get the maximum weight
+  // Get the maximum weight (estimated only at the first decay of each type)
   //double wmax = fPhaseSpaceGenerator.GetWtMax();
-  double wmax = -1;
-  for(int idec=0; idec<200; idec++) {
-     double w = fPhaseSpaceGenerator.Generate();
-     if(reweight) { w *= this->ReWeightPt2(pdgv); }
-     wmax = TMath::Max(wmax,w);
-  }
+  double wmax = fPhaseSpaceGenerator.MaxWeight( (reweight ? 1 : 0),
+    [this, &pdgv, reweight] () {
+       double w = fPhaseSpaceGenerator.Generate();
+       if(reweight) { w *= this->ReWeightPt2(pdgv); }
+       return w;
+    });
   assert(wmax>0);
 
   LOG("KNOHad", pNOTICE)
@@ -998,6 +1074,7 @@ bool AGKYLowW2019::PhaseSpaceDecay(
     // *** generating weighted decays ***
     double w = fPhaseSpaceGenerator.Generate();
     if(reweight) { w *= this->ReWeightPt2(pdgv); }
+    fPhaseSpaceGenerator.UpdateMaxWeight(w);
     fWeight *= TMath::Max(w/wmax, 1.);
   }
   else
@@ -1016,12 +1093,12 @@ bool AGKYLowW2019::PhaseSpaceDecay(
          LOG("KNOHad", pWARN)
              << "Couldn't generate an unweighted phase space decay after "
              << itry << " attempts";
-         delete [] mass;
          return false;
        }
 
        double w  = fPhaseSpaceGenerator.Generate();
        if(reweight) { w *= this->ReWeightPt2(pdgv); }
+       fPhaseSpaceGenerator.UpdateMaxWeight(w);
        if(w > wmax) {
           LOG("KNOHad", pWARN)
            << "Decay weight = " << w << " > max decay weight = " << wmax;
@@ -1037,7 +1114,6 @@ bool AGKYLowW2019::PhaseSpaceDecay(
        if(return_after_not_accepted_decay && !accept_decay) {
            LOG("KNOHad", pWARN)
              << "Was instructed to return after a not-accepted decay";
-           delete [] mass;
            return false;
        }
      }
@@ -1073,9 +1149,6 @@ bool AGKYLowW2019::PhaseSpaceDecay(
      i++;
   }
 
-  // Clean-up
-  delete [] mass;
-
   return true;
 }
 //____________________________________________________________________________
@@ -1103,8 +1176,8 @@ double AGKYLowW2019::ReWeightPt2(const PDGCodeList & pdgcv) const
   return w;
 }
 //____________________________________________________________________________
-PDGCodeList * AGKYLowW2019::GenerateHadronCodes(
-                                   int multiplicity, int maxQ, double W) const
+void AGKYLowW2019::GenerateHadronCodes(
+       int multiplicity, int maxQ, double W, PDGCodeList * pdgc) const
 {
 // Selection of fragments (identical as in NeuGEN).
 
@@ -1112,9 +1185,8 @@ PDGCodeList * AGKYLowW2019::GenerateHadronCodes(
   PDGLibrary * pdg = PDGLibrary::Instance();
   RandomGen * rnd = RandomGen::Instance();
 
-  // Create vector to add final state hadron PDG codes
-  bool allowdup=true;
-  PDGCodeList * pdgc = new PDGCodeList(allowdup);
+  // Reset the vector to add final state hadron PDG codes
+  pdgc->clear();
   //pdgc->reserve(multiplicity);
   int hadrons_to_add = multiplicity;
 
@@ -1373,8 +1445,6 @@ PDGCodeList * AGKYLowW2019::GenerateHadronCodes(
 
      } // while there are more hadrons to add
   } // if charge is balanced (maxQ == 0)
-
-  return pdgc;
 }
 //____________________________________________________________________________
 int AGKYLowW2019::GenerateBaryonPdgCode(
@@ -41,7 +41,16 @@
 #ifndef _KNO_HADRONIZATION_H_
 #define _KNO_HADRONIZATION_H_
 
+#include <map>
+#include <tuple>
+#include <vector>
+
 #include <TGenPhaseSpace.h>
+#include <TClonesArray.h>
+
+#include "Framework/ParticleData/PDGCodeList.h"
+#include "Framework/Utils/NBodyPhaseSpace.h"
+#include "Framework/Numerical/InverseCDFTable.h"
 
 #include "Physics/Decay/Decayer.h"
 #include "Framework/EventGen/EventRecordVisitorI.h"
@@ -78,10 +87,16 @@ private:
   void           Initialize            (void)                                        const;
   TClonesArray * Hadronize             (const Interaction* )                         const;
   double         Weight                (void)                                        const;
-  PDGCodeList *  SelectParticles       (const Interaction*)                          const;
+  const PDGCodeList *
+                 SelectParticles       (const Interaction*)                          const;
   TH1D *         MultiplicityProb      (const Interaction*, Option_t* opt = "")      const;
+  TH1D *         MultiplicityProb      (const Interaction*, double W, double maxmult,
+                                        Option_t* opt)                               const;
+  const std::vector<double> &
+                 MultiplicityCDF       (const Interaction*)                          const;
   bool           AssertValidity        (const Interaction * i)                       const;
-  PDGCodeList *  GenerateHadronCodes   (int mult, int maxQ, double W)                const;
+  void           GenerateHadronCodes   (int mult, int maxQ, double W,
+                                        PDGCodeList * pdgc)                          const;
   int            GenerateBaryonPdgCode (int mult, int maxQ, double W)                const;
   int            HadronShowerCharge    (const Interaction * )                        const;
   double         KNO                   (int nu, int nuc, double z)                   const;
@@ -93,17 +108,29 @@ private:
   void           ApplyRijk             (const Interaction * i, bool norm, TH1D * mp) const;
   double         Wmin                  (void)                                        const;
 
-  TClonesArray* DecayMethod1    (double W, const PDGCodeList & pdgv, bool reweight_decays) const;
-  TClonesArray* DecayMethod2    (double W, const PDGCodeList & pdgv, bool reweight_decays) const;
-  TClonesArray* DecayBackToBack (double W, const PDGCodeList & pdgv) const;
+  bool DecayMethod1    (double W, const PDGCodeList & pdgv, bool reweight_decays, TClonesArray * plist) const;
+  bool DecayMethod2    (double W, const PDGCodeList & pdgv, bool reweight_decays, TClonesArray * plist) const;
+  bool DecayBackToBack (double W, const PDGCodeList & pdgv, TClonesArray * plist) const;
 
   bool PhaseSpaceDecay(
          TClonesArray & pl, TLorentzVector & pd,
 	   const PDGCodeList & pdgv, int offset=0, bool reweight=false) const;
 
-  mutable TGenPhaseSpace fPhaseSpaceGenerator; ///< a phase space generator
+  mutable NBodyPhaseSpace fPhaseSpaceGenerator; ///< a phase space generator, keeping its max weights
   mutable double         fWeight;              ///< weight for generated event
 
+  // Buffers reused from event to event, so that no hadron lists are
+  // allocated per event
+  mutable TClonesArray        fParticleList;  ///< hadronic system returned by Hadronize()
+  mutable PDGCodeList         fPDGCodes;      ///< hadron codes returned by SelectParticles()
+  mutable PDGCodeList         fPDGCodesStrip; ///< hadron codes without the baryon (decay method 2)
+  mutable std::vector<double> fMasses;        ///< phase space decay product masses
+
+  // Tabulated multiplicity CDFs, keyed on (probe, hit nucleon, interaction
+  // type, max multiplicity, W bin). The CDF of multiplicity n is at [n-2].
+  typedef std::tuple<int, int, int, int, int> MultProbKey_t;
+  mutable std::map<MultProbKey_t, std::vector<double> > fMultCDFs;
+
   // Configuration parameters
   // Note: additional configuration parameters common to all hadronizers
   // (Wcut,Rijk,...) are declared one layer down in the inheritance tree
@@ -117,6 +144,7 @@ private:
   bool     fForceMinMult;        ///< force minimum multiplicity if (at low W) generated less?
   bool     fGenerateWeighted;    ///< generate weighted events?
   double   fPhSpRwA;             ///< parameter for phase space decay reweighting
+  double   fMultProbWBin;        ///< W bin width of the tabulated multiplicity CDFs (<=0: not tabulated)
   double   fPpi0;                ///< {pi0 pi0  } production probability
   double   fPpic;                ///< {pi+ pi-  } production probability
   double   fPKc;                 ///< {K+  K-   } production probability
@@ -139,6 +167,8 @@ private:
   double   fCvbn;                ///< Levy function parameter for vbn
   TF1 *    fBaryonXFpdf;         ///< baryon xF PDF
   TF1 *    fBaryonPT2pdf;        ///< baryon pT^2 PDF
+  InverseCDFTable fBaryonXFTable;  ///< tabulated inverse CDF of fBaryonXFpdf
+  InverseCDFTable fBaryonPT2Table; ///< tabulated inverse CDF of fBaryonPT2pdf
 
   // nuegen parameters
   double   fWcut;      ///< Rijk applied for W<Wcut (see DIS/RES join scheme)
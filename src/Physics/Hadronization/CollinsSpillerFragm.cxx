@@ -10,18 +10,21 @@
 
 #include "Physics/Hadronization/CollinsSpillerFragm.h"
 #include "Physics/Hadronization/FragmentationFunctions.h"
+#include "Framework/Numerical/RandomGen.h"
 
 using namespace genie;
 
 //___________________________________________________________________________
 CollinsSpillerFragm::CollinsSpillerFragm() :
-FragmentationFunctionI("genie::CollinsSpillerFragm")
+FragmentationFunctionI("genie::CollinsSpillerFragm"),
+fFunc(0)
 {
 
 }
 //___________________________________________________________________________
 CollinsSpillerFragm::CollinsSpillerFragm(string config) :
-FragmentationFunctionI("genie::CollinsSpillerFragm", config)
+FragmentationFunctionI("genie::CollinsSpillerFragm", config),
+fFunc(0)
 {
 
 }
@@ -43,7 +46,7 @@ double CollinsSpillerFragm::GenerateZ(void) const
 {
 // Return a random number using the fragmentation function as PDF
 
-  return fFunc->GetRandom();
+  return fZTable.Sample( RandomGen::Instance()->RndHadro().Rndm() );
 }
 //___________________________________________________________________________
 void CollinsSpillerFragm::Configure(const Registry & config)
@@ -60,6 +63,8 @@ void CollinsSpillerFragm::Configure(string config)
 //___________________________________________________________________________
 void CollinsSpillerFragm::BuildFunction(void)
 {
+  delete fFunc;
+
   fFunc = new TF1("fFunc",genie::utils::frgmfunc::collins_spiller_func,0,1,2);
 
   fFunc->SetParNames("Norm","Epsilon");
@@ -80,5 +85,10 @@ void CollinsSpillerFragm::BuildFunction(void)
     N = 1./I;
   }
   fFunc->SetParameters(N,e);
+
+  // tabulate its inverse CDF (the function is not modified afterwards)
+  const TF1 * func = fFunc;
+  fZTable.Build( [func] (double z) { return func->Eval(z); }, 0., 1. );
+  assert( ! fZTable.IsEmpty() );
 }
 //___________________________________________________________________________
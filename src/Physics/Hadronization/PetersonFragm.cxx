@@ -12,18 +12,21 @@
 
 #include "Physics/Hadronization/PetersonFragm.h"
 #include "Physics/Hadronization/FragmentationFunctions.h"
+#include "Framework/Numerical/RandomGen.h"
 
 using namespace genie;
 
 //___________________________________________________________________________
 PetersonFragm::PetersonFragm() :
-FragmentationFunctionI("genie::PetersonFragm")
+FragmentationFunctionI("genie::PetersonFragm"),
+fFunc(0)
 {
 
 }
 //___________________________________________________________________________
 PetersonFragm::PetersonFragm(string config) :
-FragmentationFunctionI("genie::PetersonFragm", config)
+FragmentationFunctionI("genie::PetersonFragm", config),
+fFunc(0)
 {
   this->BuildFunction();
 }
@@ -45,7 +48,7 @@ double PetersonFragm::GenerateZ(void) const
 {
 // Return a random number using the fragmentation function as PDF
 
-  return fFunc->GetRandom();
+  return fZTable.Sample( RandomGen::Instance()->RndHadro().Rndm() );
 }
 //___________________________________________________________________________
 void PetersonFragm::Configure(const Registry & config)
@@ -62,6 +65,8 @@ void PetersonFragm::Configure(string config)
 //___________________________________________________________________________
 void PetersonFragm::BuildFunction(void)
 {
+  delete fFunc;
+
   fFunc = new TF1("fFunc",genie::utils::frgmfunc::peterson_func,0,1,2);
 
   fFunc->SetParNames("Norm","Epsilon");
@@ -88,5 +93,10 @@ void PetersonFragm::BuildFunction(void)
     N = 1./I;
   }
   fFunc->SetParameters(N,e);
+
+  // tabulate its inverse CDF (the function is not modified afterwards)
+  const TF1 * func = fFunc;
+  fZTable.Build( [func] (double z) { return func->Eval(z); }, 0., 1. );
+  assert( ! fZTable.IsEmpty() );
 }
 //___________________________________________________________________________
@@ -23,6 +23,7 @@
 
 #include <TF1.h>
 
+#include "Framework/Numerical/InverseCDFTable.h"
 #include "Physics/Hadronization/FragmentationFunctionI.h"
 
 namespace genie {
@@ -45,7 +46,8 @@ public:
 
 private:
   void BuildFunction (void);
-  TF1 * fFunc;
+  TF1 *           fFunc;
+  InverseCDFTable fZTable;  ///< tabulated inverse CDF, for GenerateZ()
 };
 
 }      // genie namespace
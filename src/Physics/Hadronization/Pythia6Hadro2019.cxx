@@ -64,6 +64,10 @@ void Pythia6Hadro2019::ProcessEventRecord(GHepRecord *
 ) const
 {
 #ifdef __GENIE_PYTHIA6_ENABLED__
+  // PYTHIA6 is shared by all threads: hold it for the whole hadronization,
+  // and re-apply this instance's tune in case another instance changed it
+  std::lock_guard<std::recursive_mutex> lock(RandomGen::Pythia6Mutex());
+  this->SetTune();
   PythiaBaseHadro2019::ProcessEventRecord(event);
 #else
   LOG("Pythia6Had", pFATAL)
@@ -309,6 +313,16 @@ void Pythia6Hadro2019::LoadConfig(void)
 {
   PythiaBaseHadro2019::LoadConfig();
 
+#ifdef __GENIE_PYTHIA6_ENABLED__
+  std::lock_guard<std::recursive_mutex> lock(RandomGen::Pythia6Mutex());
+  this->SetTune();
+#endif
+
+  LOG("Pythia6Had", pDEBUG) << this->GetConfig() ;
+}
+//____________________________________________________________________________
+void Pythia6Hadro2019::SetTune(void) const
+{
 #ifdef __GENIE_PYTHIA6_ENABLED__
   fPythia->SetPARJ(2,  fSSBarSuppression       );
   fPythia->SetPARJ(21, fGaussianPt2            );
@@ -321,8 +335,6 @@ void Pythia6Hadro2019::LoadConfig(void)
   fPythia->SetPARJ(42, fLundb                  );
   fPythia->SetPARJ(45, fLundaDiq               );
 #endif
-
-  LOG("Pythia6Had", pDEBUG) << this->GetConfig() ;
 }
 //____________________________________________________________________________
 void Pythia6Hadro2019::Initialize(void)
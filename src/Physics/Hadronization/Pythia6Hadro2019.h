@@ -55,6 +55,7 @@ private:
   void CopyOriginalDecayFlags     (void) const;
   void SetDesiredDecayFlags       (void) const;
   void RestoreOriginalDecayFlags  (void) const;
+  void SetTune                    (void) const;
 
   void LoadConfig (void);
   void Initialize (void);
@@ -11,6 +11,11 @@
 */
 //____________________________________________________________________________
 
+#include <map>
+#include <memory>
+#include <sstream>
+#include <iomanip>
+
 #include <RVersion.h>
 #include <TClonesArray.h>
 // Avoid the inclusion of dlfcn.h by Pythia.h that CINT is not able to process
@@ -40,6 +45,15 @@
 using namespace genie;
 using namespace genie::constants;
 
+#ifdef __GENIE_PYTHIA8_ENABLED__
+namespace {
+  // The PYTHIA8 instances of the current thread, keyed on their tune: all
+  // Pythia8Hadro2019 instances of a thread with the same tune share one
+  // PYTHIA8 instance, initialized once
+  thread_local std::map<string, std::unique_ptr<Pythia8::Pythia> > gPythia8Pool;
+}
+#endif
+
 //____________________________________________________________________________
 Pythia8Hadro2019::Pythia8Hadro2019() :
 PythiaBaseHadro2019("genie::Pythia8Hadro2019")
@@ -55,9 +69,7 @@ PythiaBaseHadro2019("genie::Pythia8Hadro2019", config)
 //____________________________________________________________________________
 Pythia8Hadro2019::~Pythia8Hadro2019()
 {
-#ifdef __GENIE_PYTHIA8_ENABLED__
-  delete fPythia;
-#endif
+
 }
 //____________________________________________________________________________
 void Pythia8Hadro2019::ProcessEventRecord(GHepRecord *
@@ -76,6 +88,55 @@ void Pythia8Hadro2019::ProcessEventRecord(GHepRecord *
 #endif
 }
 //____________________________________________________________________________
+unsigned int Pythia8Hadro2019::ProcessEventRecords(
+  const vector<GHepRecord *> &
+#ifdef __GENIE_PYTHIA8_ENABLED__
+  events // avoid unused variable warning if PYTHIA8 is not enabled
+#endif
+) const
+{
+#ifdef __GENIE_PYTHIA8_ENABLED__
+  LOG("Pythia8Had", pNOTICE)
+    << "Running PYTHIA8 hadronizer on a batch of " << events.size() << " events";
+
+  this->CopyOriginalDecayFlags();
+  this->SetDesiredDecayFlags();
+
+  unsigned int nhad = 0;
+  for(unsigned int ie = 0; ie < events.size(); ie++) {
+    GHepRecord * event = events[ie];
+    Interaction * interaction = event->Summary();
+
+    if(!this->AssertValidity(interaction)) {
+       LOG("Pythia8Had", pFATAL)
+         << "Input interaction type is not allowed!!!";
+       LOG("Pythia8Had", pFATAL)
+         << *event;
+       gAbortingInErr = true;
+       std::exit(1);
+    }
+
+    this->MakeQuarkDiquarkAssignments(interaction);
+
+    if(this->Hadronize(event)) {
+      nhad++;
+    } else {
+      LOG("Pythia8Had", pWARN) << "Hadronization failed!";
+      event->EventFlags()->SetBitNumber(kHadroSysGenErr, true);
+    }
+  }
+
+  this->RestoreOriginalDecayFlags();
+
+  return nhad;
+#else
+  LOG("Pythia8Had", pFATAL)
+    << "Calling GENIE/PYTHIA8 hadronization modules without enabling PYTHIA8";
+  gAbortingInErr = true;
+  std::exit(1);
+#endif
+}
+//____________________________________________________________________________
 bool Pythia8Hadro2019::Hadronize(GHepRecord *
 #ifdef __GENIE_PYTHIA8_ENABLED__
   event // avoid unused variable warning if PYTHIA6 is not enabled
@@ -95,42 +156,7 @@ bool Pythia8Hadro2019::Hadronize(GHepRecord *
     << ", W = " << W << " GeV";
 
   // Hadronize
-
-  LOG("Pythia8Had", pDEBUG) << "Reseting PYTHIA8 event";
-  fPythia->event.reset();
-
-  // Get quark/diquark masses
-  double mA = fPythia->particleData.m0(fLeadingQuark);
-  double mB = fPythia->particleData.m0(fRemnantDiquark);
-
-  LOG("Pythia8Had", pINFO)
-    << "Leading quark mass = " << mA
-    << " GeV, remnant diqurak mass = " << mB << ", GeV";
-
-  // Calculate quark/diquark energy/momentum
-  double pzAcm = 0.5 * Pythia8::sqrtpos(
-     (W + mA + mB) * (W - mA - mB) * (W - mA + mB) * (W + mA - mB) ) / W;
-  double pzBcm = -pzAcm;
-  double eA    = sqrt(mA*mA + pzAcm*pzAcm);
-  double eB    = sqrt(mB*mB + pzBcm*pzBcm);
-
-  LOG("Pythia8Had", pINFO)
-   << "Quark: (pz = " << pzAcm << ", E = " << eA << ") GeV, "
-   << "Diquark: (pz = " << pzBcm << ", E = " << eB << ") GeV";
-
-  // Pythia8 status code for outgoing particles of the hardest subprocesses is 23
-  // anti/colour tags for these 2 particles must complement each other
-  LOG("Pythia8Had", pDEBUG) << "Appending quark/diquark into the PYTHIA8 event";
-  fPythia->event.append(fLeadingQuark,   23, 101, 0, 0., 0., pzAcm, eA, mA);
-  fPythia->event.append(fRemnantDiquark, 23, 0, 101, 0., 0., pzBcm, eB, mB);
-  fPythia->event.list();
-
-  LOG("Pythia8Had", pDEBUG) << "Generating next PYTHIA8 event";
-  fPythia->next();
-
-  // List the event information
-  fPythia->event.list();
-  fPythia->stat();
+  this->FragmentString(W);
 
   // Get LUJETS record
   LOG("Pythia8Had", pDEBUG) << "Copying PYTHIA8 event record into GENIE's";
@@ -138,9 +164,6 @@ bool Pythia8Hadro2019::Hadronize(GHepRecord *
   int np = fEvent.size();
   assert(np>0);
 
-  TClonesArray * particle_list = new TClonesArray("genie::GHepParticle", np);
-  particle_list->SetOwner(true);
-
   // Hadronic 4vec
   TLorentzVector p4Had = kinematics.HadSystP4();
 
@@ -192,12 +215,12 @@ bool Pythia8Hadro2019::Hadronize(GHepRecord *
         // returned by the hadronizer:
         // - boost it back to LAB' frame {z:=\vec{phad}} / doesn't affect pT
         // - rotate its 3-momentum from LAB' to LAB
-        TLorentzVector p4o(
+        TLorentzVector p4(
           fEvent[i].px(), fEvent[i].py(), fEvent[i].pz(), fEvent[i].e());
-        p4o.Boost(beta);
-        TVector3 p3 = p4o.Vect();
+        p4.Boost(beta);
+        TVector3 p3 = p4.Vect();
         p3.RotateUz(unitvq);
-        TLorentzVector p4(p3,p4o.Energy());
+        p4.SetVect(p3);
 
         // Set the proper GENIE status according to a number of things:
         // interaction on a nucleus or nucleon, particle type
@@ -223,30 +246,13 @@ bool Pythia8Hadro2019::Hadronize(GHepRecord *
         int daughter1 = -1;//(fEvent[i].daughter1() <= 0 ) ? -1 : mom  + fEvent[i].daughter1();
         int daughter2 = -1;//(fEvent[i].daughter1() <= 0 ) ? -1 : mom  + fEvent[i].daughter2();
 
-        // Create GHepParticle
-        GHepParticle particle = GHepParticle(
-            particle_pdg_code, // pdg
-            ist,               // status
-            mother1,           // first parent
-            mother2,           // second parent
-            daughter1,         // first daughter
-            daughter2,         // second daughter
-            p4.Px(),           // px
-            p4.Py(),           // py
-            p4.Pz(),           // pz
-            p4.Energy(),       // e
-            vtx.X(),           // x
-            vtx.Y(),           // y
-            vtx.Z(),           // z
-            vtx.T()            // t
-        );
-
         LOG("Pythia8Had", pDEBUG)
-             << "Adding final state particle pdgc = " << particle.Pdg()
-             << " with status = " << particle.Status();
+             << "Adding final state particle pdgc = " << particle_pdg_code
+             << " with status = " << ist;
 
         // Insert the particle in the list
-        event->AddParticle(particle);
+        event->AddParticle(particle_pdg_code, ist,
+           mother1, mother2, daughter1, daughter2, p4, vtx);
      }// copy?
   }// loop over particles
 
@@ -257,6 +263,62 @@ bool Pythia8Hadro2019::Hadronize(GHepRecord *
 #endif
 }
 //____________________________________________________________________________
+bool Pythia8Hadro2019::FragmentString(double
+#ifdef __GENIE_PYTHIA8_ENABLED__
+  W // avoid unused variable warning if PYTHIA8 is not enabled
+#endif
+) const
+{
+// Fragments the (fLeadingQuark, fRemnantDiquark) string of invariant mass W
+// in its rest frame. The products are left in the PYTHIA8 event record.
+
+#ifdef __GENIE_PYTHIA8_ENABLED__
+  LOG("Pythia8Had", pDEBUG) << "Reseting PYTHIA8 event";
+  fPythia->event.reset();
+
+  // Get quark/diquark masses
+  double mA = fPythia->particleData.m0(fLeadingQuark);
+  double mB = fPythia->particleData.m0(fRemnantDiquark);
+
+  LOG("Pythia8Had", pINFO)
+    << "Leading quark mass = " << mA
+    << " GeV, remnant diqurak mass = " << mB << ", GeV";
+
+  // Calculate quark/diquark energy/momentum
+  double pzAcm = 0.5 * Pythia8::sqrtpos(
+     (W + mA + mB) * (W - mA - mB) * (W - mA + mB) * (W + mA - mB) ) / W;
+  double pzBcm = -pzAcm;
+  double eA    = sqrt(mA*mA + pzAcm*pzAcm);
+  double eB    = sqrt(mB*mB + pzBcm*pzBcm);
+
+  LOG("Pythia8Had", pINFO)
+   << "Quark: (pz = " << pzAcm << ", E = " << eA << ") GeV, "
+   << "Diquark: (pz = " << pzBcm << ", E = " << eB << ") GeV";
+
+  // Pythia8 status code for outgoing particles of the hardest subprocesses is 23
+  // anti/colour tags for these 2 particles must complement each other
+  LOG("Pythia8Had", pDEBUG) << "Appending quark/diquark into the PYTHIA8 event";
+  fPythia->event.append(fLeadingQuark,   23, 101, 0, 0., 0., pzAcm, eA, mA);
+  fPythia->event.append(fRemnantDiquark, 23, 0, 101, 0., 0., pzBcm, eB, mB);
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  fPythia->event.list();
+#endif
+
+  LOG("Pythia8Had", pDEBUG) << "Generating next PYTHIA8 event";
+  bool ok = fPythia->next();
+
+  // List the event information
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  fPythia->event.list();
+  fPythia->stat();
+#endif
+
+  return ok;
+#else
+  return false;
+#endif
+}
+//____________________________________________________________________________
 void Pythia8Hadro2019::CopyOriginalDecayFlags(void) const
 {
 #ifdef __GENIE_PYTHIA8_ENABLED__
@@ -334,19 +396,7 @@ void Pythia8Hadro2019::LoadConfig(void)
   PythiaBaseHadro2019::LoadConfig();
 
 #ifdef __GENIE_PYTHIA8_ENABLED__
-  fPythia->settings.parm("StringFlav:probStoUD",         fSSBarSuppression);
-  fPythia->settings.parm("Diffraction:primKTwidth",      fGaussianPt2);
-  fPythia->settings.parm("StringPT:enhancedFraction",    fNonGaussianPt2Tail);
-  fPythia->settings.parm("StringFragmentation:stopMass", fRemainingECutoff);
-  fPythia->settings.parm("StringFlav:probQQtoQ",         fDiQuarkSuppression);
-  fPythia->settings.parm("StringFlav:mesonUDvector",     fLightVMesonSuppression);
-  fPythia->settings.parm("StringFlav:mesonSvector",      fSVMesonSuppression);
-  fPythia->settings.parm("StringZ:aLund",                fLunda);
-  fPythia->settings.parm("StringZ:bLund",                fLundb);
-  fPythia->settings.parm("StringZ:aExtraDiquark",        fLundaDiq);
-
-  fPythia->init(); // needed again to read the above?
-
+  fPythia = this->PythiaInstance();
 #endif
 
   LOG("Pythia8Had", pDEBUG) << this->GetConfig();
@@ -355,21 +405,58 @@ void Pythia8Hadro2019::LoadConfig(void)
 void Pythia8Hadro2019::Initialize(void)
 {
 #ifdef __GENIE_PYTHIA8_ENABLED__
-  fPythia = new Pythia8::Pythia();
-
-  fPythia->readString("ProcessLevel:all = off");
-  fPythia->readString("Print:quiet      = on");
+  fPythia = 0;
+#endif
+}
+//____________________________________________________________________________
+#ifdef __GENIE_PYTHIA8_ENABLED__
+Pythia8::Pythia * Pythia8Hadro2019::PythiaInstance(void) const
+{
+// Returns the PYTHIA8 instance of the current thread for the configured tune,
+// creating and initializing it if needed
 
   // sync GENIE and PYTHIA8 seeds
   RandomGen * rnd = RandomGen::Instance();
   long int seed = rnd->GetSeed();
-  fPythia->readString("Random:setSeed = on");
-  fPythia->settings.mode("Random:seed", seed);
-  LOG("Pythia8Had", pINFO)
-    << "PYTHIA8  seed = " << fPythia->settings.mode("Random:seed");
 
-  fPythia->init();
+  std::ostringstream key;
+  key << std::setprecision(17) << seed
+      << "/" << fSSBarSuppression   << "/" << fGaussianPt2
+      << "/" << fNonGaussianPt2Tail << "/" << fRemainingECutoff
+      << "/" << fDiQuarkSuppression << "/" << fLightVMesonSuppression
+      << "/" << fSVMesonSuppression << "/" << fLunda
+      << "/" << fLundb              << "/" << fLundaDiq;
 
-#endif
+  std::unique_ptr<Pythia8::Pythia> & pythia = gPythia8Pool[key.str()];
+  if(pythia) return pythia.get();
+
+  LOG("Pythia8Had", pNOTICE)
+    << "Initializing a PYTHIA8 instance (tune: " << key.str() << ")";
+
+  pythia.reset(new Pythia8::Pythia());
+
+  pythia->readString("ProcessLevel:all = off");
+  pythia->readString("Print:quiet      = on");
+
+  pythia->readString("Random:setSeed = on");
+  pythia->settings.mode("Random:seed", seed);
+  LOG("Pythia8Had", pINFO)
+    << "PYTHIA8  seed = " << pythia->settings.mode("Random:seed");
+
+  pythia->settings.parm("StringFlav:probStoUD",         fSSBarSuppression);
+  pythia->settings.parm("Diffraction:primKTwidth",      fGaussianPt2);
+  pythia->settings.parm("StringPT:enhancedFraction",    fNonGaussianPt2Tail);
+  pythia->settings.parm("StringFragmentation:stopMass", fRemainingECutoff);
+  pythia->settings.parm("StringFlav:probQQtoQ",         fDiQuarkSuppression);
+  pythia->settings.parm("StringFlav:mesonUDvector",     fLightVMesonSuppression);
+  pythia->settings.parm("StringFlav:mesonSvector",      fSVMesonSuppression);
+  pythia->settings.parm("StringZ:aLund",                fLunda);
+  pythia->settings.parm("StringZ:bLund",                fLundb);
+  pythia->settings.parm("StringZ:aExtraDiquark",        fLundaDiq);
+
+  pythia->init();
+
+  return pythia.get();
 }
+#endif
 //____________________________________________________________________________
@@ -22,6 +22,8 @@
 #ifndef _PYTHIA8_HADRONIZATION_H_
 #define _PYTHIA8_HADRONIZATION_H_
 
+#include <vector>
+
 #include "Framework/Conventions/GBuild.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Physics/Hadronization/PythiaBaseHadro2019.h"
@@ -44,6 +46,12 @@ public:
   // Implement the EventRecordVisitorI interface
   void ProcessEventRecord(GHepRecord * event) const;
 
+  //! Hadronize the string systems of a batch of events in one go, setting
+  //! the PYTHIA8 decay flags once for the whole batch. The events that could
+  //! not be hadronized are flagged with kHadroSysGenErr. Returns the number
+  //! of hadronized events.
+  unsigned int ProcessEventRecords(const std::vector<GHepRecord *> & events) const;
+
   // Overload the Algorithm::Configure() methods to load private data
   // members from configuration options
   void Configure(const Registry & config);
@@ -51,7 +59,8 @@ public:
 
 private:
 
-  bool Hadronize (GHepRecord* event) const;
+  bool Hadronize      (GHepRecord* event) const;
+  bool FragmentString (double W)          const;
 
   void CopyOriginalDecayFlags     (void) const;
   void SetDesiredDecayFlags       (void) const;
@@ -61,7 +70,9 @@ private:
   void Initialize (void);
 
 #ifdef __GENIE_PYTHIA8_ENABLED__
-  mutable Pythia8::Pythia * fPythia; ///< PYTHIA8 instance
+  Pythia8::Pythia * PythiaInstance (void) const;
+
+  mutable Pythia8::Pythia * fPythia; ///< PYTHIA8 instance of this thread and tune (not owned)
 #endif
 
 };
@@ -13,6 +13,8 @@
 */
 //____________________________________________________________________________
 
+#include <sstream>
+
 #include <TMath.h>
 
 #include "Framework/Conventions/GBuild.h"
@@ -32,6 +34,8 @@
 #include "Framework/Numerical/MathUtils.h"
 #include "Framework/Utils/KineUtils.h"
 
+using std::ostringstream;
+
 using namespace genie;
 using namespace genie::controls;
 using namespace genie::constants;
@@ -97,13 +101,20 @@ void IBDKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      throw exception;
   }
 
+  //-- If tabulated, select the inverse CDF of dxsec/dQ2 for the current
+  //   energy: Q2 is then sampled directly, with no rejection. Outside the
+  //   tabulated energy range the rejection method is used.
+  const InverseCDFTable * table =
+     (fTabulateQ2 && !fGenerateUniformly) ? this->SelectQ2Table(interaction) : 0;
+
   //-- For the subsequent kinematic selection with the rejection method:
   //   Calculate the max differential cross section or retrieve it from the
   //   cache. Throw an exception and quit the evg thread if a non-positive
   //   value is found.
   //   If the kinematics are generated uniformly over the allowed phase
-  //   space the max xsec is irrelevant
-  const double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
+  //   space (or sampled from the tables) the max xsec is irrelevant
+  const double xsec_max =
+     (fGenerateUniformly || table) ? -1 : this->MaxXSec(evrec);
 
   //-- Try to select a valid Q2 using the rejection method
 
@@ -128,7 +139,8 @@ void IBDKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      }
      
      //-- Generate a Q2 value within the allowed phase space
-     gQ2 = Q2min + (Q2max-Q2min) * rnd->RndKine().Rndm();
+     double u = (table) ? table->Sample(rnd->RndKine().Rndm()) : rnd->RndKine().Rndm();
+     gQ2 = Q2min + (Q2max-Q2min) * u;
      interaction->KinePtr()->SetQ2(gQ2);
      LOG("IBD", pINFO) << "Trying: Q^2 = " << gQ2;
 
@@ -136,7 +148,9 @@ void IBDKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      xsec = fXSecModel->XSec(interaction, kPSQ2fE);
 
      //-- Decide whether to accept the current kinematics
-     if(!fGenerateUniformly) {
+     if(table) {
+        accept = true;
+     } else if(!fGenerateUniformly) {
         this->AssertXSecLimits(interaction, xsec, xsec_max);
         const double t = xsec_max * rnd->RndKine().Rndm();
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
@@ -150,6 +164,7 @@ void IBDKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {
+        this->RecordAccepted(interaction, iter);
         LOG("IBD", pINFO) << "Selected: Q^2 = " << gQ2;
 
         // reset bits
@@ -237,6 +252,20 @@ void IBDKinematicsGenerator::LoadConfig(void)
 	//   an event weight?
 	GetParamDef( "UniformOverPhaseSpace", fGenerateUniformly, false ) ;
 
+	//-- Sample Q2 from tabulated inverse CDFs of dxsec/dQ2 (no rejection)?
+	GetParamDef( "Tabulate-Q2",   fTabulateQ2, false ) ;
+	GetParamDef( "Table-NE",      fTableNE,    100   ) ;
+	GetParamDef( "Table-EMin",    fTableEMin,  0.0018 ) ;
+	GetParamDef( "Table-EMax",    fTableEMax,  0.2   ) ;
+	GetParamDef( "Table-NQ2",     fTableNQ2,   200   ) ;
+	if(fTabulateQ2 && (fTableNE < 2 || fTableNQ2 < 2 ||
+	                   fTableEMin <= 0 || fTableEMax <= fTableEMin)) {
+	  LOG("IBD", pFATAL) << "Invalid dxsec/dQ2 table grid";
+	  gAbortingInErr = true;
+	  exit(1);
+	}
+
+	fQ2Tables.clear();
 }
 //____________________________________________________________________________
 double IBDKinematicsGenerator::ComputeMaxXSec(
@@ -311,4 +340,69 @@ double IBDKinematicsGenerator::ComputeMaxXSec(
   return max_xsec;
 }
 //___________________________________________________________________________
-
+const InverseCDFTable * IBDKinematicsGenerator::SelectQ2Table(
+                                       const Interaction * interaction) const
+{
+// Selects the tabulated dxsec/dQ2 inverse CDF for the current energy: The
+// distribution at an energy between two nodes is approximated by the mixture
+// of the distributions at the nodes, with the weights of a linear (in lnE)
+// interpolation, so one of the two nodes is selected at random.
+// The tables are built at their first use and returns 0 outside their range.
+
+  const InitialState & init_state = interaction->InitState();
+  const double E = init_state.ProbeE(kRfHitNucRest);
+  if(E < fTableEMin || E >= fTableEMax) return 0;
+
+  ostringstream key;
+  key << init_state.ProbePdg() << ";" << init_state.Tgt().Pdg()
+      << ";" << init_state.Tgt().HitNucPdg();
+  std::vector<InverseCDFTable> & tables = fQ2Tables[key.str()];
+  if(tables.empty()) tables.resize(fTableNE);
+
+  const double dlogE = TMath::Log(fTableEMax/fTableEMin) / (fTableNE-1);
+  const double r     = TMath::Log(E/fTableEMin) / dlogE;
+  int ie = TMath::Min((int)r, fTableNE-2);
+  if(RandomGen::Instance()->RndKine().Rndm() < r - ie) ie++;
+
+  InverseCDFTable & table = tables[ie];
+  if(table.IsEmpty()) {
+    this->BuildQ2Table(interaction, ie, table);
+  }
+  return (table.IsEmpty()) ? 0 : &table;
+}
+//___________________________________________________________________________
+void IBDKinematicsGenerator::BuildQ2Table(
+        const Interaction * interaction, int ie, InverseCDFTable & table) const
+{
+// Tabulates the inverse CDF of dxsec/dQ2 at the energy node ie, in the
+// normalised Q2 u = (Q2-Q2min)/(Q2max-Q2min) in [0,1]: At fixed energy Q2 is
+// linear in the lepton cos(theta), so u is the normalised cos(theta). The
+// cross section is evaluated for a hit nucleon at rest on the mass shell.
+
+  const double E = fTableEMin *
+      TMath::Exp(ie * TMath::Log(fTableEMax/fTableEMin) / (fTableNE-1));
+
+  Interaction in(*interaction);
+  int hitnuc = in.InitState().Tgt().HitNucPdg();
+  double M = PDGLibrary::Instance()->Find(hitnuc)->Mass();
+  in.InitStatePtr()->TgtPtr()->SetHitNucP4(TLorentzVector(0,0,0,M));
+  in.InitStatePtr()->SetProbeE(E);
+  in.SetBit(kISkipProcessChk);
+  in.SetBit(kISkipKinematicChk);
+  in.SetBit(kIAssumeFreeNucleon);
+
+  Range1D_t Q2 = in.PhaseSpace().Limits(kKVQ2);
+  if(Q2.max <= 0 || Q2.min >= Q2.max) return;
+
+  const XSecAlgorithmI * xsec_model = fXSecModel;
+  bool ok = table.Build(
+     [&in, &Q2, xsec_model] (double u) {
+        in.KinePtr()->SetQ2(Q2.min + u * (Q2.max - Q2.min));
+        return xsec_model->XSec(&in, kPSQ2fE);
+     }, 0., 1., fTableNQ2);
+
+  LOG("IBD", pINFO)
+     << "Tabulated dxsec/dQ2 at E = " << E << " GeV for "
+     << in.InitState().AsString() << (ok ? "" : ": empty");
+}
+//___________________________________________________________________________
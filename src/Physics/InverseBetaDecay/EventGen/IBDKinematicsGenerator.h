@@ -6,6 +6,9 @@
 \brief    Generates values for the kinematic variables describing IBD neutrino
           interaction events.
           Is a concrete implementation of the EventRecordVisitorI interface.
+          Optionally (Tabulate-Q2), Q2 is sampled without rejection from
+          inverse CDFs of dxsec/dQ2, tabulated in the normalised Q2 (ie the
+          lepton cos(theta)) at the nodes of a log-spaced energy grid.
 
 \author   Corey Reed <cjreed \at nikhef.nl> - October 29, 2009
           using code from the QELKinematicGenerator written by
@@ -23,7 +26,12 @@
 #ifndef _IBD_KINEMATICS_GENERATOR_H_
 #define _IBD_KINEMATICS_GENERATOR_H_
 
+#include <map>
+#include <string>
+#include <vector>
+
 #include "Physics/Common/KineGeneratorWithCache.h"
+#include "Framework/Numerical/InverseCDFTable.h"
 #include "Framework/Utils/Range1.h"
 
 namespace genie {
@@ -46,6 +54,18 @@ public :
 private:
   void   LoadConfig     (void);
   double ComputeMaxXSec (const Interaction * in) const;
+
+  // tabulated dxsec/dQ2 inverse CDFs
+  const InverseCDFTable * SelectQ2Table (const Interaction * in) const;
+  void                    BuildQ2Table  (const Interaction * in, int ie, InverseCDFTable & table) const;
+
+  bool   fTabulateQ2;   ///< sample Q2 from the tabulated inverse CDFs?
+  int    fTableNE;      ///< number of energy nodes
+  double fTableEMin;    ///< first energy node
+  double fTableEMax;    ///< last energy node
+  int    fTableNQ2;     ///< number of normalised Q2 nodes per inverse CDF
+
+  mutable std::map<std::string, std::vector<InverseCDFTable> > fQ2Tables; ///< by initial state, energy node
 };
 
 }      // genie namespace
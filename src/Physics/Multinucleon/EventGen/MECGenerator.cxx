@@ -11,6 +11,9 @@
 */
 //____________________________________________________________________________
 
+#include <sstream>
+#include <vector>
+
 #include <TMath.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
@@ -35,6 +38,11 @@
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/Utils/KineUtils.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/Cache.h"
+#include "Framework/Utils/CacheBranchEnvelope.h"
+
+using std::ostringstream;
+using std::vector;
 
 using namespace genie;
 using namespace genie::utils;
@@ -43,13 +51,15 @@ using namespace genie::controls;
 
 //___________________________________________________________________________
 MECGenerator::MECGenerator() :
-EventRecordVisitorI("genie::MECGenerator")
+EventRecordVisitorI("genie::MECGenerator"),
+fRjMonitor(this)
 {
 
 }
 //___________________________________________________________________________
 MECGenerator::MECGenerator(string config) :
-EventRecordVisitorI("genie::MECGenerator", config)
+EventRecordVisitorI("genie::MECGenerator", config),
+fRjMonitor(this)
 {
 
 }
@@ -254,6 +264,7 @@ void MECGenerator::SelectEmpiricalKinematics(GHepRecord * event) const
   RandomGen * rnd = RandomGen::Instance();
   unsigned int iter = 0;
   bool accept = false;
+  fRjMonitor.NewEvent();
   while(1) {
      iter++;
      if(iter > kRjMaxIterations) {
@@ -275,6 +286,7 @@ void MECGenerator::SelectEmpiricalKinematics(GHepRecord * event) const
      interaction->KinePtr()->SetQ2(gQ2);
      interaction->KinePtr()->SetW (gW);
      double xsec = fXSecModel->XSec(interaction, kPSWQ2fE);
+     fRjMonitor.CountXSecEval();
 
      // Decide whether to accept the current kinematics
      double t = xsec_max * rnd->RndKine().Rndm();
@@ -283,6 +295,7 @@ void MECGenerator::SelectEmpiricalKinematics(GHepRecord * event) const
 
      // If the generated kinematics are accepted, finish-up module's job
      if(accept) {
+        fRjMonitor.Accepted(interaction, iter);
         LOG("MEC", pINFO) << "Selected: Q^2 = " << gQ2 << ", W = " << gW;
         double gx = 0;
         double gy = 0;
@@ -608,22 +621,7 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
   double Q3 = 0.0; // magnitude of transfered 3 momentum
   double Q2 = 0.0; // properly Q^2 (Q squared) - transfered 4 momentum.
 
-  // Set lepton KE TMax for for throwing rndm in the accept/reject loop.
-  // We can accidentally set it too high, because the xsec will return zero.
-  // This way if someone reuses this code, they are not tripped up by it.
-  TMax = Enu - LepMass;
-
-  // Set Tmin for throwing rndm in the accept/reject loop
-  // the hadron tensors we expect will be limited in q3
-  // therefore also the outgoing lepton KE can't be too low or costheta too backward
-  // make the accept/reject loop more efficient by using Min values.
-  if(Enu < fQ3Max){
-    TMin = 0 ;
-    CosthMin = -1 ;
-  } else {
-    TMin = TMath::Sqrt(TMath::Power(LepMass, 2) + TMath::Power((Enu - fQ3Max), 2)) - LepMass;
-    CosthMin = TMath::Sqrt(1 - TMath::Power((fQ3Max / Enu ), 2));
-  }
+  this->NSVLeptonLimits(Enu, LepMass, TMin, TMax, CosthMin);
 
   // The accept/reject loop tests a rand against a maxxsec - must scale with A.
   int NuclearA = 12;
@@ -643,11 +641,29 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
     }
   }
 
+  // If enabled, (T, Costh) are drawn from a tabulated envelope of the
+  // cross section for this target, neutrino and energy bin, and the
+  // rejection is made against the envelope value at the drawn point
+  CacheBranchEnvelope * envelope = 0;
+  if (fNSVUseEnvelope) {
+      envelope = this->NSVEnvelope(interaction, Enu);
+      if (envelope->Integral() <= 0) {
+          LOG("MEC", pWARN)
+              << "Null lepton kinematics envelope at Ev = " << Enu << " GeV";
+          event->EventFlags()->SetBitNumber(kKineGenErr, true);
+          genie::exceptions::EVGThreadException exception;
+          exception.SetReason("Couldn't select lepton kinematics");
+          exception.SwitchOnFastForward();
+          throw exception;
+      }
+  }
+
   // -- Generate and Test the Kinematics----------------------------------//
 
   RandomGen * rnd = RandomGen::Instance();
   bool accept = false;
   unsigned int iter = 0;
+  fRjMonitor.NewEvent();
 
   // loop over different (randomly) selected T and Costh
   while (!accept) {
@@ -665,8 +681,17 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
       }
 
       // generate random kinetic energy T and Costh
-      T = TMin + (TMax-TMin)*rnd->RndKine().Rndm();
-      Costh = CosthMin + (CosthMax-CosthMin)*rnd->RndKine().Rndm();
+      double u = 0, v = 0;
+      double XSecEnvelope = 0;
+      if (envelope) {
+          XSecEnvelope = envelope->Generate(rnd->RndKine().Rndm(),
+              rnd->RndKine().Rndm(), rnd->RndKine().Rndm(), u, v);
+      } else {
+          u = rnd->RndKine().Rndm();
+          v = rnd->RndKine().Rndm();
+      }
+      T = TMin + (TMax-TMin)*u;
+      Costh = CosthMin + (CosthMax-CosthMin)*v;
 
       // Calculate useful values for judging this choice
       Plep = TMath::Sqrt( T * (T + (2.0 * LepMass)));  // ok is sqrt(E2 - m2)
@@ -697,13 +722,14 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
               //  and fit a line.  Use that plus 1.35 safety factors to limit the accept/reject loop.
               double XSecMax = 1.35 * TMath::Power(10.0, XSecMaxPar1 * TMath::Log10(Enu) - XSecMaxPar2);
               if (NuclearA > 12) XSecMax *=  NuclearAfactorXSecMax;  // Scale it by A, precomputed above.
+              if (envelope) XSecMax = XSecEnvelope;
 
               LOG("MEC", pDEBUG) << " T, Costh: " << T << ", " << Costh ;
 
 
-              // We need four different cross sections. Right now, pursue the
-              // inelegant method of calling XSec four times - there is
-              // definitely some runtime inefficiency here, but it is not awful
+              // We need four different cross sections. Only the delta-less
+              // all one is needed for the accept/reject decision: the other
+              // three are computed for the accepted kinematics only
 
               // first, get delta-less all
               if (NuPDG > 0) {
@@ -712,28 +738,43 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
               else {
                   interaction->InitStatePtr()->TgtPtr()->SetHitNucPdg(kPdgClusterPP);
               }
-              double XSec = fXSecModel->XSec(interaction, kPSTlctl);
-              // now get all with delta
-              interaction->ExclTagPtr()->SetResonance(genie::kP33_1232);
-              double XSecDelta = fXSecModel->XSec(interaction, kPSTlctl);
-              // get PN with delta
-              interaction->InitStatePtr()->TgtPtr()->SetHitNucPdg(kPdgClusterNP);
-              double XSecDeltaPN = fXSecModel->XSec(interaction, kPSTlctl);
-              // now get delta-less PN
               interaction->ExclTagPtr()->SetResonance(genie::kNoResonance);
-              double XSecPN = fXSecModel->XSec(interaction, kPSTlctl);
+              double XSec = fXSecModel->XSec(interaction, kPSTlctl);
 
+              fRjMonitor.CountXSecEval();
               if (XSec > XSecMax) {
-                  LOG("MEC", pERROR) << "XSec is > XSecMax for nucleus " << TgtPDG << " "
+                  fRjMonitor.CountViolation(interaction);
+                  if (envelope) {
+                      // the envelope is tabulated: raise it for later events
+                      LOG("MEC", pWARN) << "XSec is > envelope for nucleus " << TgtPDG << " "
+                                   << XSec << " > " << XSecMax << " at T, Costh: "
+                                   << T << ", " << Costh << " - Raising the envelope";
+                      envelope->Raise(u, v, fNSVEnvelopeSafetyFactor * XSec);
+                  } else {
+                      LOG("MEC", pERROR) << "XSec is > XSecMax for nucleus " << TgtPDG << " "
 				   << XSec << " > " << XSecMax
 				   << " don't let this happen.";
+                  }
               }
-              assert(XSec <= XSecMax);
+              assert(envelope || XSec <= XSecMax);
               accept = XSec > XSecMax*rnd->RndKine().Rndm();
               LOG("MEC", pINFO) << "Xsec, Max, Accept: " << XSec << ", "
                   << XSecMax << ", " << accept;
 
               if(accept){
+                  // now get all with delta
+                  interaction->ExclTagPtr()->SetResonance(genie::kP33_1232);
+                  double XSecDelta = fXSecModel->XSec(interaction, kPSTlctl);
+                  // get PN with delta
+                  interaction->InitStatePtr()->TgtPtr()->SetHitNucPdg(kPdgClusterNP);
+                  double XSecDeltaPN = fXSecModel->XSec(interaction, kPSTlctl);
+                  // now get delta-less PN
+                  interaction->ExclTagPtr()->SetResonance(genie::kNoResonance);
+                  double XSecPN = fXSecModel->XSec(interaction, kPSTlctl);
+
+                  fRjMonitor.CountXSecEval(3);
+                  fRjMonitor.Accepted(interaction, iter);
+
                   // If it passes the All cross section we still need to do two things:
                   // * Was the initial state pn or not?
                   // * Do we assign the reaction to have had a Delta on the inside?
@@ -855,6 +896,151 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
   LOG("MEC",pDEBUG) << "~~~ LEPTON DONE ~~~";
 }
 //___________________________________________________________________________
+void MECGenerator::NSVLeptonLimits(double Enu, double LepMass,
+                 double & TMin, double & TMax, double & CosthMin) const
+{
+  // Set lepton KE TMax for for throwing rndm in the accept/reject loop.
+  // We can accidentally set it too high, because the xsec will return zero.
+  // This way if someone reuses this code, they are not tripped up by it.
+  TMax = Enu - LepMass;
+
+  // Set Tmin for throwing rndm in the accept/reject loop
+  // the hadron tensors we expect will be limited in q3
+  // therefore also the outgoing lepton KE can't be too low or costheta too backward
+  // make the accept/reject loop more efficient by using Min values.
+  if(Enu < fQ3Max){
+    TMin = 0 ;
+    CosthMin = -1 ;
+  } else {
+    TMin = TMath::Sqrt(TMath::Power(LepMass, 2) + TMath::Power((Enu - fQ3Max), 2)) - LepMass;
+    CosthMin = TMath::Sqrt(1 - TMath::Power((fQ3Max / Enu ), 2));
+  }
+}
+//___________________________________________________________________________
+CacheBranchEnvelope * MECGenerator::NSVEnvelope(
+                               Interaction * interaction, double Enu) const
+{
+// Returns the (T, Costh) envelope of the delta-less all cross section for
+// the event target and neutrino at the current energy bin (10 bins per
+// decade), building it at first use. Envelopes are cache branches, so they
+// are saved in, and restored from, the cache file.
+
+  int ebin = (int) TMath::Floor(10. * TMath::Log10(Enu));
+
+  ostringstream intkey;
+  intkey << "nu:" << interaction->InitState().ProbePdg()
+         << ";tgt:" << interaction->InitState().TgtPdg();
+  ostringstream binkey;
+  binkey << "nsv-envelope/e-bin:" << ebin;
+
+  Cache * cache = Cache::Instance();
+  string key = cache->CacheBranchKey(this->Id().Key() + "/" +
+                 fXSecModel->Id().Key(), intkey.str(), binkey.str());
+
+  CacheBranchEnvelope * envelope =
+       dynamic_cast<CacheBranchEnvelope *> (cache->FindCacheBranch(key));
+  if(!envelope) {
+    LOG("MEC", pINFO) << "Creating NSV lepton kinematics envelope - key = " << key;
+    envelope = new CacheBranchEnvelope(
+                  "d^2XSec/dTdCosth envelope", fNSVEnvelopeNBins);
+    cache->AddCacheBranch(key, envelope);
+  }
+  if(!envelope->IsBuilt()) {
+    this->BuildNSVEnvelope(envelope, interaction,
+                           TMath::Power(10., ebin/10.),
+                           TMath::Power(10., (ebin+1)/10.));
+  }
+  return envelope;
+}
+//___________________________________________________________________________
+void MECGenerator::BuildNSVEnvelope(CacheBranchEnvelope * envelope,
+            Interaction * interaction, double Emin, double Emax) const
+{
+// Each cell is bounded by the max cross section at its corners and centre,
+// computed at the low, middle and high energy of the bin, and over its
+// (8) neighbour cells, then scaled up by the safety factor.
+
+  unsigned int N = envelope->NBins();
+  double LepMass = interaction->FSPrimLepton()->Mass();
+  int    NuPDG   = interaction->InitState().ProbePdg();
+
+  // the envelope is built for the delta-less all cross section
+  Kinematics * kinematics = interaction->KinePtr();
+  InitialState * init_state = interaction->InitStatePtr();
+  TLorentzVector p4probe = init_state->ProbeP4Lab();
+  int hitnuc = init_state->Tgt().HitNucPdg();
+  Resonance_t res = interaction->ExclTag().Resonance();
+  init_state->TgtPtr()->SetHitNucPdg(NuPDG > 0 ? kPdgClusterNN : kPdgClusterPP);
+  interaction->ExclTagPtr()->SetResonance(genie::kNoResonance);
+
+  // max cross section over the cell corners & centre
+  vector<double> cellmax(N*N, 0.);
+
+  const int ne = 3;
+  for(int ie = 0; ie < ne; ie++) {
+    double Enu = Emin * TMath::Power(Emax/Emin, (double) ie / (ne-1));
+    init_state->SetProbeE(Enu);
+
+    double TMin = 0, TMax = 0, CosthMin = 0, CosthMax = 1;
+    this->NSVLeptonLimits(Enu, LepMass, TMin, TMax, CosthMin);
+
+    // grid points: cell corners at even (i,j), cell centres at odd (i,j)
+    unsigned int M = 2*N+1;
+    vector<double> xsec(M*M, 0.);
+    for(unsigned int i = 0; i < M; i++) {
+      for(unsigned int j = 0; j < M; j++) {
+        bool corner = (i%2 == 0 && j%2 == 0);
+        bool centre = (i%2 == 1 && j%2 == 1);
+        if(!corner && !centre) continue;
+        double T     = TMin     + (TMax-TMin)         * i / (2.*N);
+        double Costh = CosthMin + (CosthMax-CosthMin) * j / (2.*N);
+        double Plep  = TMath::Sqrt( T * (T + (2.0 * LepMass)));
+        double Q3    = TMath::Sqrt(Plep*Plep + Enu*Enu - 2.0 * Plep * Enu * Costh);
+        if(Q3 >= fQ3Max) continue;
+        kinematics->SetKV(kKVTl,  T);
+        kinematics->SetKV(kKVctl, Costh);
+        xsec[i*M+j] = fXSecModel->XSec(interaction, kPSTlctl);
+      }
+    }
+    for(unsigned int iu = 0; iu < N; iu++) {
+      for(unsigned int iv = 0; iv < N; iv++) {
+        double xmax = cellmax[iu*N+iv];
+        for(unsigned int di = 0; di <= 2; di++) {
+          for(unsigned int dj = 0; dj <= 2; dj++) {
+            xmax = TMath::Max(xmax, xsec[(2*iu+di)*M + 2*iv+dj]);
+          }
+        }
+        cellmax[iu*N+iv] = xmax;
+      }
+    }
+  }
+
+  // restore the event interaction
+  init_state->SetProbeP4(p4probe);
+  init_state->TgtPtr()->SetHitNucPdg(hitnuc);
+  interaction->ExclTagPtr()->SetResonance(res);
+
+  for(unsigned int iu = 0; iu < N; iu++) {
+    for(unsigned int iv = 0; iv < N; iv++) {
+      double xmax = 0;
+      for(int du = -1; du <= 1; du++) {
+        for(int dv = -1; dv <= 1; dv++) {
+          int ju = (int) iu + du;
+          int jv = (int) iv + dv;
+          if(ju < 0 || jv < 0 || ju >= (int) N || jv >= (int) N) continue;
+          xmax = TMath::Max(xmax, cellmax[ju*N+jv]);
+        }
+      }
+      envelope->SetCell(iu, iv, fNSVEnvelopeSafetyFactor * xmax);
+    }
+  }
+  envelope->SetBuilt(true);
+
+  LOG("MEC", pNOTICE)
+     << "Built NSV lepton kinematics envelope for " << interaction->InitState().AsString()
+     << " at Ev = [" << Emin << ", " << Emax << "] GeV";
+}
+//___________________________________________________________________________
 void MECGenerator::GenerateNSVInitialHadrons(GHepRecord * event) const
 {
     // We need a kinematic limits accept/reject loop here, so generating the
@@ -1064,5 +1250,11 @@ void MECGenerator::LoadConfig(void)
     assert(fNuclModel);
 
     GetParam( "NSV-Q3Max", fQ3Max ) ;
+
+    // Draw the NSV lepton kinematics from a tabulated envelope of the
+    // cross section, in place of a flat (T, Costh) rejection?
+    GetParamDef( "NSV-UseEnvelope",           fNSVUseEnvelope,           false ) ;
+    GetParamDef( "NSV-Envelope-NBins",        fNSVEnvelopeNBins,         30    ) ;
+    GetParamDef( "NSV-Envelope-SafetyFactor", fNSVEnvelopeSafetyFactor,  1.2   ) ;
 }
 //___________________________________________________________________________
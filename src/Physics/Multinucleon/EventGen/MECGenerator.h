@@ -25,11 +25,13 @@
 
 #include "Framework/EventGen/EventRecordVisitorI.h"
 #include "Framework/ParticleData/PDGCodeList.h"
+#include "Framework/Utils/RejectionMonitor.h"
 
 namespace genie {
 
 class XSecAlgorithmI;
 class NuclearModelI;
+class CacheBranchEnvelope;
 
 class MECGenerator : public EventRecordVisitorI {
 
@@ -58,13 +60,22 @@ private:
   void    DecayNucleonCluster               (GHepRecord * event) const;
   void    SelectNSVLeptonKinematics         (GHepRecord * event) const;
   void    GenerateNSVInitialHadrons         (GHepRecord * event) const;
+  void    NSVLeptonLimits                   (double Enu, double LepMass, double & TMin,
+                                             double & TMax, double & CosthMin) const;
+  CacheBranchEnvelope * NSVEnvelope         (Interaction * in, double Enu) const;
+  void    BuildNSVEnvelope                  (CacheBranchEnvelope * envelope, Interaction * in,
+                                             double Emin, double Emax) const;
   PDGCodeList NucleonClusterConstituents    (int pdgc)           const;
 
   mutable const XSecAlgorithmI * fXSecModel;
   mutable TGenPhaseSpace         fPhaseSpaceGenerator;
   const NuclearModelI *          fNuclModel;
+  mutable RejectionMonitor       fRjMonitor;
 
   double fQ3Max;
+  bool   fNSVUseEnvelope;          ///< draw the NSV lepton kinematics from a tabulated envelope?
+  int    fNSVEnvelopeNBins;        ///< envelope bins per kinematic variable
+  double fNSVEnvelopeSafetyFactor; ///< envelope scale factor over the tabulated max xsec
 };
 
 }      // genie namespace
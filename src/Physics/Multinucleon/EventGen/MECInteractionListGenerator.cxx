@@ -107,6 +107,13 @@ InteractionList *
 
 }
 //___________________________________________________________________________
+string MECInteractionListGenerator::TargetClass(const Target & target) const
+{
+// The list only depends on whether the target is a nucleus with A >= 4
+
+  return (target.A() < 4) ? "A<4" : "A>=4";
+}
+//___________________________________________________________________________
 void MECInteractionListGenerator::Configure(const Registry & config)
 {
   Algorithm::Configure(config);
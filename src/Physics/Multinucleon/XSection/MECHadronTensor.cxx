@@ -7,30 +7,139 @@
 //_________________________________________________________________________
 
 #include <cstdlib>
+#include <cstring>
 #include <string>
+#include <sstream>
 #include <fstream>
 #include <cassert>
 #include <algorithm>
+#include <mutex>
+
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include "Framework/Conventions/Constants.h"
 #include "Framework/Messenger/Messenger.h"
-#include "Framework/Numerical/Spline.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/ParticleData/PDGLibrary.h"
-#include "Framework/Numerical/BLI2D.h"
 #include "Physics/Multinucleon/XSection/MECHadronTensor.h"
+#include "Framework/Utils/StartupProfiler.h"
 
 #include <TSystem.h>
-#include <TFile.h>
 
 using std::ostringstream;
 using std::istream;
+using std::ofstream;
 using std::ios;
 
 using namespace genie;
 using namespace genie::constants;
 
+//_________________________________________________________________________
+// Binary tensor file layout (native byte order, one file per target):
+//
+//   BinMHTHeader                 : signature, version, target, dimensions
+//   double [nx]                  : qz points
+//   double [ny]                  : q0 points
+//   double [ntypes][nx*ny*ncomp] : for each tensor type (in the order of
+//                                  MECHadronTensorType_t) the components
+//                                  of point (ix,iy) at (ix*ny+iy)*ncomp
+//
+namespace {
+  const char     kBinMHTSignature[8] = { 'G','M','E','C','T','B','I','N' };
+  const uint32_t kBinMHTVersion      = 1;
+
+  struct BinMHTHeader {
+    char     signature[8];
+    uint32_t version;
+    int32_t  target_pdg;
+    uint32_t ntypes;
+    uint32_t ncomponents;
+    uint32_t nx;
+    uint32_t ny;
+    uint64_t x_offset;
+    uint64_t y_offset;
+    uint64_t w_offset;
+    uint64_t file_size;
+  };
+
+  const int kNTensorTypes = MECHadronTensor::kMHTValenciaDeltapn + 1;
+
+  // the singleton is shared by all threads: guards loading the tables
+  std::mutex gTableMutex;
+
+  // point the grids of all tensor types to the input data
+  void SetGrids(MECHadronTensor::MECHadronTensorTable * table,
+                int nx, int ny, const double * x, const double * y, const double * w)
+  {
+    int nw = nx * ny * MECHadronTensor::MECHadronTensorGrid::kNComponents;
+    for(int tensorType = 0; tensorType < kNTensorTypes; ++tensorType) {
+      MECHadronTensor::MECHadronTensorGrid & grid =
+        table->Table[(MECHadronTensor::MECHadronTensorType_t)tensorType];
+      grid.fNX = nx;
+      grid.fNY = ny;
+      grid.fX  = x;
+      grid.fY  = y;
+      grid.fW  = w + tensorType * nw;
+    }
+  }
+}
+//_________________________________________________________________________
+MECHadronTensor::MECHadronTensorGrid::MECHadronTensorGrid() :
+fNX(0),
+fNY(0),
+fX(0),
+fY(0),
+fW(0)
+{
+
+}
+//_________________________________________________________________________
+void MECHadronTensor::MECHadronTensorGrid::Evaluate(
+  double qz, double q0, double * w) const
+{
+  double x = std::min( std::max(qz, fX[0]), fX[fNX-1] );
+  double y = std::min( std::max(q0, fY[0]), fY[fNY-1] );
+
+  // find the cell with fX[ix] < x <= fX[ix+1], fY[iy] < y <= fY[iy+1]
+  int ix = std::lower_bound(fX, fX+fNX, x) - fX - 1;
+  int iy = std::lower_bound(fY, fY+fNY, y) - fY - 1;
+  ix = std::min( std::max(ix, 0), fNX-2 );
+  iy = std::min( std::max(iy, 0), fNY-2 );
+
+  double x1 = fX[ix];
+  double x2 = fX[ix+1];
+  double y1 = fY[iy];
+  double y2 = fY[iy+1];
+
+  // the corners of the cell, all components of a point being contiguous
+  const double * z11 = fW + (ix*fNY + iy) * kNComponents;
+  const double * z12 = z11 + kNComponents;
+  const double * z21 = z11 + fNY * kNComponents;
+  const double * z22 = z21 + kNComponents;
+
+  for(int k = 0; k < kNComponents; k++) {
+    double z1 = z11[k] * (x2-x)/(x2-x1) + z21[k] * (x-x1)/(x2-x1);
+    double z2 = z12[k] * (x2-x)/(x2-x1) + z22[k] * (x-x1)/(x2-x1);
+    w[k] = z1 * (y2-y)/(y2-y1) + z2 * (y-y1)/(y2-y1);
+  }
+}
+//_________________________________________________________________________
+MECHadronTensor::MECHadronTensorTable::MECHadronTensorTable() :
+MapAddr(0),
+MapSize(0)
+{
+
+}
+//_________________________________________________________________________
+MECHadronTensor::MECHadronTensorTable::~MECHadronTensorTable()
+{
+  if(MapAddr) munmap(MapAddr, MapSize);
+}
 //_________________________________________________________________________
 MECHadronTensor * MECHadronTensor::fgInstance = 0;
 //_________________________________________________________________________
@@ -55,34 +164,17 @@ MECHadronTensor::MECHadronTensor()
   // likewise never want Rf208, I used the density for Pb208
   // likewise never want Ba112, I used the density for Cd112
 
-  // this one loads all known targets when instantiated, regardless of what the user wants.
-  // is there a point to being efficient, check if the requested one is loaded ?
-  // TODO  there is a fail if the spline file is missing one of the known targets
-  // and the user requests a mix of two targets.
-  vector<int>::const_iterator it=fKnownTensors.begin();
-  for( ; it!=fKnownTensors.end(); ++it) {
-    this->LoadTensorTables(*it);
-    // this method will fail silently if the target list here does not match later.
-  }
+  // the tables of each target are loaded when first requested
   fgInstance = 0;
 }
 //_________________________________________________________________________
 MECHadronTensor::~MECHadronTensor()
 {
-	vector<int>::const_iterator it=fKnownTensors.begin();
-	for( ; it!=fKnownTensors.end(); ++it) {
-		MECHadronTensor::MECHadronTensorTable table = fTargetTensorTables[*it];
-		for(int tensorType = 0; tensorType <= MECHadronTensor::kMHTValenciaDeltapn; ++tensorType) {
-			vector<genie::BLI2DNonUnifGrid*> Grids = table.Table[(MECHadronTensor::MECHadronTensorType_t)tensorType];
-			for (vector<genie::BLI2DNonUnifGrid*>::iterator gridit = Grids.begin() ; gridit != Grids.end(); ++gridit){
-				genie::BLI2DNonUnifGrid *hadTensorGrid = *gridit;
-				if(hadTensorGrid) {
-				  delete hadTensorGrid;
-				  hadTensorGrid=0;
-				}
-			}
-		}
-	}
+  std::map<int, MECHadronTensorTable *>::iterator it = fTargetTensorTables.begin();
+  for( ; it != fTargetTensorTables.end(); ++it) {
+    delete it->second;
+  }
+  fTargetTensorTables.clear();
 }
 //_________________________________________________________________________
 MECHadronTensor * MECHadronTensor::Instance()
@@ -119,19 +211,145 @@ bool MECHadronTensor::KnownTensor(int targetpdg)
   return std::count(fKnownTensors.begin(), fKnownTensors.end(), targetpdg)!=0;
 }
 //_________________________________________________________________________
-const vector<genie::BLI2DNonUnifGrid *> &
+const MECHadronTensor::MECHadronTensorGrid &
    MECHadronTensor::TensorTable(int targetpdg, MECHadronTensorType_t type)
 {
-  return fTargetTensorTables[targetpdg].Table[type];
+  const MECHadronTensorTable * table = 0;
+  {
+    std::lock_guard<std::mutex> lock(gTableMutex);
+    std::map<int, MECHadronTensorTable *>::const_iterator it =
+       fTargetTensorTables.find(targetpdg);
+    table = (it != fTargetTensorTables.end()) ?
+       it->second : this->LoadTensorTables(targetpdg);
+  }
+
+  map<MECHadronTensorType_t, MECHadronTensorGrid>::const_iterator git =
+     table->Table.find(type);
+  assert(git != table->Table.end());
+  return git->second;
 }
 //_________________________________________________________________________
-void MECHadronTensor::LoadTensorTables(int targetpdg)
+string MECHadronTensor::DataDir(void) const
+{
+// Ideally, the xml configuration can override the default location
+
+  return (gSystem->Getenv("GMECTENSORDATA")) ?
+     string(gSystem->Getenv("GMECTENSORDATA")) :
+     string(gSystem->Getenv("GENIE")) + string("/data/evgen/mectensor/nieves");
+}
+//_________________________________________________________________________
+string MECHadronTensor::BinaryFileName(int targetpdg) const
+{
+  ostringstream filename;
+  filename << this->DataDir() << "/HadTensor120-Nieves-" << targetpdg
+           << "-20150210.bin";
+  return filename.str();
+}
+//_________________________________________________________________________
+const MECHadronTensor::MECHadronTensorTable *
+   MECHadronTensor::LoadTensorTables(int targetpdg)
 {
 // Load the hadron tensor tables.
 // For the Nieves model they are in ${GENIE}/data/evgen/mectensor/nieves/
 
+  StartupTimer timer("MEC hadron tensor loading");
+
+  if(!KnownTensor(targetpdg)){
+    LOG("MECHadronTensor", pFATAL)
+      << "No MEC tensor table for target with PDG code: "
+      << targetpdg;
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  MECHadronTensorTable * table = new MECHadronTensorTable;
+
+  string binfile = this->BinaryFileName(targetpdg);
+  bool loaded = false;
+  if(! gSystem->AccessPathName(binfile.c_str())) {
+    loaded = this->MapBinaryFile(targetpdg, binfile, table);
+  }
+  if(!loaded) {
+    loaded = this->ReadTextFiles(targetpdg, table);
+  }
+  if(!loaded) {
+    LOG("MECHadronTensor", pFATAL)
+      << "Couldn't load the MEC tensor tables for target with PDG code: "
+      << targetpdg;
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  fTargetTensorTables[targetpdg] = table;
+  return table;
+}
+//_________________________________________________________________________
+bool MECHadronTensor::MapBinaryFile(
+  int targetpdg, string filename, MECHadronTensorTable * table)
+{
+  LOG("MECHadronTensor", pNOTICE)
+    << "Mapping MEC tensor tables from binary file: " << filename;
+
+  int fd = open(filename.c_str(), O_RDONLY);
+  if(fd < 0) {
+    LOG("MECHadronTensor", pERROR) << "Couldn't open file: " << filename;
+    return false;
+  }
+  struct stat st;
+  if(fstat(fd, &st) != 0 || (size_t) st.st_size < sizeof(BinMHTHeader)) {
+    close(fd);
+    LOG("MECHadronTensor", pERROR) << "Not a binary tensor file: " << filename;
+    return false;
+  }
+
+  // map the file read-only & shared: the pages are shared through the page
+  // cache by all the jobs loading the same file on a node
+  size_t size = st.st_size;
+  void * addr = mmap(0, size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if(addr == MAP_FAILED) {
+    LOG("MECHadronTensor", pERROR) << "Couldn't map file: " << filename;
+    return false;
+  }
+  const char * data = (const char *) addr;
+
+  const BinMHTHeader * header = (const BinMHTHeader *) data;
+  uint64_t nx = header->nx;
+  uint64_t ny = header->ny;
+  bool valid =
+     memcmp(header->signature, kBinMHTSignature, sizeof(kBinMHTSignature)) == 0 &&
+     header->version     == kBinMHTVersion &&
+     header->target_pdg  == targetpdg      &&
+     header->ntypes      == (uint32_t) kNTensorTypes &&
+     header->ncomponents == (uint32_t) MECHadronTensorGrid::kNComponents &&
+     nx >= 2 && ny >= 2 &&
+     header->x_offset == sizeof(BinMHTHeader) &&
+     header->y_offset == header->x_offset + nx*sizeof(double) &&
+     header->w_offset == header->y_offset + ny*sizeof(double) &&
+     header->file_size == header->w_offset +
+        kNTensorTypes*nx*ny*MECHadronTensorGrid::kNComponents*sizeof(double) &&
+     header->file_size == size;
+  if(!valid) {
+    LOG("MECHadronTensor", pWARN)
+      << "Not a (compatible) binary tensor file for target " << targetpdg
+      << ": " << filename << " - Reading the text files instead";
+    munmap(addr, size);
+    return false;
+  }
+
+  table->MapAddr = addr;
+  table->MapSize = size;
+  SetGrids(table, nx, ny,
+           (const double *) (data + header->x_offset),
+           (const double *) (data + header->y_offset),
+           (const double *) (data + header->w_offset));
+  return true;
+}
+//_________________________________________________________________________
+bool MECHadronTensor::ReadTextFiles(int targetpdg, MECHadronTensorTable * table)
+{
   // define dimensions of data in the hadron tensor files
-  int nwpoints = 5;
+  int nwpoints = MECHadronTensorGrid::kNComponents;
   const int nq0points = 120;
   const int nqzpoints = 120;
   const int nq0qzpoints = nq0points*nqzpoints;
@@ -140,25 +358,22 @@ void MECHadronTensor::LoadTensorTables(int targetpdg)
   // then extract these constants to the config file with the input table specs
   // or find a way for the input tables to be self-descriptive.
 
-  string tensorLocation  = string("/data/evgen/mectensor/nieves");
   string tensorFileStart = "HadTensor120-Nieves-";
   string tensorFileEnd   = "-20150210.dat";
 
-  if(!KnownTarget(targetpdg)){
-    LOG("MECHadronTensor", pERROR)
-      << "No MEC tensor table for target with PDG code: "
-      << targetpdg;
-    return;
-  }
-
   // define directory of hadron tensor files
-  // Ideally, the xml configuration can override the default location
-  string data_dir = string(gSystem->Getenv("GENIE")) + tensorLocation;
+  string data_dir = this->DataDir();
 
-  // define arrays to fill from data files
-  double hadtensor_q0_array[nq0points];
-  double hadtensor_qz_array[nqzpoints];
-  double hadtensor_w_array[nwpoints][nq0qzpoints];
+  LOG("MECHadronTensor", pNOTICE)
+    << "Reading MEC tensor tables for target " << targetpdg
+    << " from text files in: " << data_dir;
+
+  // the qz points, q0 points and tensors, laid out as in the binary file
+  vector<double> & data = table->Data;
+  data.resize(nqzpoints + nq0points + kNTensorTypes*nq0qzpoints*nwpoints);
+  double * hadtensor_qz_array = &data[0];
+  double * hadtensor_q0_array = hadtensor_qz_array + nqzpoints;
+  double * hadtensor_w_arrays = hadtensor_q0_array + nq0points;
 
   // fill q0 array (in GeV)
   // 240 5MeV bins or 120 10 MeV bins
@@ -179,8 +394,7 @@ void MECHadronTensor::LoadTensorTables(int targetpdg)
   tensorTypeNames[MECHadronTensor::kMHTValenciaDeltapn]  = "Deltapn";
 
   // iterate over all four hadron tensor types in the map above.
-  for(int tensorType = 0;
-          tensorType <= MECHadronTensor::kMHTValenciaDeltapn; ++tensorType) {
+  for(int tensorType = 0; tensorType < kNTensorTypes; ++tensorType) {
 
     // build filenames from the bits of string
     ostringstream datafile;
@@ -188,39 +402,22 @@ void MECHadronTensor::LoadTensorTables(int targetpdg)
 	     << tensorTypeNames[(MECHadronTensor::MECHadronTensorType_t)tensorType]
 	     << tensorFileEnd;
 
-    // make sure data files are available
-    LOG("MECHadronTensor", pDEBUG)
-       << "Asserting that file " << datafile.str().c_str() << " exists...";
-    assert (! gSystem->AccessPathName(datafile.str().c_str()));
-
     // read data file
-    ReadHadTensorqzq0File(
-      datafile.str(), nwpoints, nqzpoints, nq0points, hadtensor_w_array
+    bool ok = ReadHadTensorqzq0File(
+      datafile.str(), nwpoints, nqzpoints, nq0points,
+      hadtensor_w_arrays + tensorType*nq0qzpoints*nwpoints
     );
-
-    //loop over all 5 tensors
-    for (int i = 0; i < nwpoints; i++){
-
-      // create a non uniform grid from tensor data
-      genie::BLI2DNonUnifGrid *hadTensorGrid =
-           new genie::BLI2DNonUnifGrid(
-               nqzpoints,
-               nq0points,
-               hadtensor_qz_array,
-               hadtensor_q0_array,
-               hadtensor_w_array[i]
-           );
-
-      // and store in a map using the target PDG as a key
-      fTargetTensorTables[targetpdg].Table[
-         (MECHadronTensor::MECHadronTensorType_t)tensorType].push_back(hadTensorGrid);
-    }
+    if(!ok) return false;
   }
+
+  SetGrids(table, nqzpoints, nq0points,
+           hadtensor_qz_array, hadtensor_q0_array, hadtensor_w_arrays);
+  return true;
 }
 //_________________________________________________________________________
-void MECHadronTensor::ReadHadTensorqzq0File(
+bool MECHadronTensor::ReadHadTensorqzq0File(
   string filename, int nwpoints, int nqzpoints, int nq0points,
-  double hadtensor_w_array[][14400])
+  double * hadtensor_w_array)
 {
   // open file
   std::ifstream tensor_stream(filename.c_str(), ios::in);
@@ -228,15 +425,60 @@ void MECHadronTensor::ReadHadTensorqzq0File(
   // check file exists
   if(!tensor_stream.good()){
     LOG("MECHadronTensor", pERROR) << "Bad file name: " << filename;
-    return;
+    return false;
   }
 
-  double temp;
-  for (int ij = 0; ij < (nqzpoints*nq0points); ij++){
-    for (int k = 0; k < nwpoints; k++) {
-      tensor_stream >> temp;
-      hadtensor_w_array[k][ij]=temp;
-    }
+  // the nwpoints tensor components of each point are stored contiguously
+  int nvalues = nqzpoints*nq0points*nwpoints;
+  for (int i = 0; i < nvalues; i++){
+    tensor_stream >> hadtensor_w_array[i];
+  }
+  if(tensor_stream.fail()){
+    LOG("MECHadronTensor", pERROR) << "Couldn't read tensor file: " << filename;
+    return false;
+  }
+  return true;
+}
+//_________________________________________________________________________
+bool MECHadronTensor::SaveAsBinary(int targetpdg, string filename)
+{
+  const MECHadronTensorGrid & grid = this->TensorTable(targetpdg, kMHTValenciaFullAll);
+  uint64_t nx = grid.fNX;
+  uint64_t ny = grid.fNY;
+  uint64_t nw = nx * ny * MECHadronTensorGrid::kNComponents;
+
+  BinMHTHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.signature, kBinMHTSignature, sizeof(kBinMHTSignature));
+  header.version     = kBinMHTVersion;
+  header.target_pdg  = targetpdg;
+  header.ntypes      = kNTensorTypes;
+  header.ncomponents = MECHadronTensorGrid::kNComponents;
+  header.nx          = nx;
+  header.ny          = ny;
+  header.x_offset    = sizeof(BinMHTHeader);
+  header.y_offset    = header.x_offset + nx*sizeof(double);
+  header.w_offset    = header.y_offset + ny*sizeof(double);
+  header.file_size   = header.w_offset + kNTensorTypes*nw*sizeof(double);
+
+  LOG("MECHadronTensor", pNOTICE)
+    << "Saving MEC tensor tables for target " << targetpdg
+    << " in binary file: " << filename;
+
+  ofstream outbin(filename.c_str(), std::ios::binary);
+  if(!outbin.is_open()) {
+    LOG("MECHadronTensor", pERROR) << "Couldn't create file = " << filename;
+    return false;
+  }
+  outbin.write((const char *) &header, sizeof(header));
+  outbin.write((const char *) grid.fX, nx*sizeof(double));
+  outbin.write((const char *) grid.fY, ny*sizeof(double));
+  for(int tensorType = 0; tensorType < kNTensorTypes; ++tensorType) {
+    const MECHadronTensorGrid & tgrid =
+      this->TensorTable(targetpdg, (MECHadronTensorType_t)tensorType);
+    outbin.write((const char *) tgrid.fW, nw*sizeof(double));
   }
+  outbin.close();
+  return !outbin.fail();
 }
 //_________________________________________________________________________
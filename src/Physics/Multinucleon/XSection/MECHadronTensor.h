@@ -7,6 +7,15 @@
           to aid in the implementation (and improve the CPU efficiency of)
           MEC cross-section models.
 
+          The tables of a target are loaded the first time they are
+          requested. They are read either from the text files distributed
+          with GENIE or, if present, from a preprocessed binary file (one
+          per target, see the gmectensor2bin utility) which is mapped
+          read-only in memory: its pages are then shared, through the page
+          cache, by all the processes on a node using the same target.
+          The tables are searched for in $GMECTENSORDATA, if set, or in
+          $GENIE/data/evgen/mectensor/nieves.
+
 \author   Code contributed by Jackie Schwehr
           Substantial refactorization by the core GENIE group.
 
@@ -33,8 +42,6 @@
 #include "Rtypes.h"
 #endif
 
-#include "Framework/Numerical/BLI2D.h"
-
 using std::map;
 using std::vector;
 using std::string;
@@ -59,15 +66,49 @@ public:
   MECHadronTensorType_t;
 
   // ................................................................
-  // MEC hadron tensor table
+  // MEC hadron tensor grid: the W00, W0Z, WXX, WXY and WZZ components
+  // tabulated on the same (qz,q0) points, with bilinear interpolation
+  // (values out of the grid are evaluated at the closest grid edge).
+  // The data are not owned by the grid.
+  //
+
+  class MECHadronTensorGrid
+  {
+  public:
+     static const int kNComponents = 5;
+
+     MECHadronTensorGrid();
+
+     //! evaluate all the tensor components at the input (qz,q0)
+     void Evaluate (double qz, double q0, double * w) const;
+
+     double XMin (void) const { return fX[0];     }  ///< min qz
+     double XMax (void) const { return fX[fNX-1]; }  ///< max qz
+     double YMin (void) const { return fY[0];     }  ///< min q0
+     double YMax (void) const { return fY[fNY-1]; }  ///< max q0
+
+     int            fNX; ///< number of qz points
+     int            fNY; ///< number of q0 points
+     const double * fX;  ///< qz points
+     const double * fY;  ///< q0 points
+     const double * fW;  ///< component k at point (ix,iy) in [(ix*fNY+iy)*kNComponents+k]
+  };
+
+  // ................................................................
+  // MEC hadron tensor table: data & grids of all tensor types of a target
   //
 
   class MECHadronTensorTable
   {
   public:
-     MECHadronTensorTable() { }
-    ~MECHadronTensorTable() { /* note: should delete the grids! */ }
-     map<MECHadronTensor::MECHadronTensorType_t, vector<genie::BLI2DNonUnifGrid *> > Table;
+     MECHadronTensorTable();
+    ~MECHadronTensorTable();
+     map<MECHadronTensor::MECHadronTensorType_t, MECHadronTensorGrid> Table;
+     vector<double> Data;     ///< data read from text files
+     void *         MapAddr;  ///< start of the mapped binary file, if mapped
+     size_t         MapSize;  ///< size of the mapped binary file
+  private:
+     MECHadronTensorTable(const MECHadronTensorTable &);
   };
 
   // ................................................................
@@ -80,10 +121,19 @@ public:
   // method to return whether the targetpdg is in fKnownTensors
   bool KnownTensor(int targetpdg);
 
-  // method to access a specific set of tables
-  const vector<genie::BLI2DNonUnifGrid *> &
+  // targets with explicit tensor tables
+  const vector<int> & KnownTensors(void) const { return fKnownTensors; }
+
+  // method to access a specific table, loading the target tables if needed
+  const MECHadronTensorGrid &
      TensorTable(int targetpdg, MECHadronTensor::MECHadronTensorType_t type);
 
+  // save the tables of a target in the binary format
+  bool SaveAsBinary(int targetpdg, string filename);
+
+  // name of the binary tensor file of a target
+  string BinaryFileName(int targetpdg) const;
+
 private:
 
   // Ctors & dtor
@@ -94,20 +144,25 @@ private:
   // Self
   static MECHadronTensor * fgInstance;
 
-  // Load available hadron tensor tables.
-  // NOTES: All tables are loaded by the ctor - Consider loading them on demand.
-  //        This will also need to be extended to load tensors for requested model.
-  void LoadTensorTables(int targetpdg);
+  // Load the hadron tensor tables of a target, from the binary file if
+  // available or else from the text files.
+  // NOTES: This will need to be extended to load tensors for requested model.
+  const MECHadronTensorTable * LoadTensorTables(int targetpdg);
+  bool MapBinaryFile (int targetpdg, string filename, MECHadronTensorTable * table);
+  bool ReadTextFiles (int targetpdg, MECHadronTensorTable * table);
+
+  // Directory with the hadron tensor files
+  string DataDir (void) const;
 
-  // This map holds all known tensor tables (target PDG code is the key)
-  std::map<int, MECHadronTensorTable> fTargetTensorTables;
+  // This map holds the loaded tensor tables (target PDG code is the key)
+  std::map<int, MECHadronTensorTable *> fTargetTensorTables;
 
   // List of targets for which we can provide a calculation
   // some known targets use scale from the tensor table from another target.
   std::vector<int> fKnownTensors;
 
-  // that array size 14400 is 120x120.  Could go dynamic in the future, or not.
-  void ReadHadTensorqzq0File(string filename, int nwpoints, int nqzpoints, int nq0points, double hadtensor_w_array[][14400]);
+  // reads nqzpoints*nq0points points, with nwpoints components each
+  bool ReadHadTensorqzq0File(string filename, int nwpoints, int nqzpoints, int nq0points, double * hadtensor_w_array);
 
   // singleton cleaner
   struct Cleaner {
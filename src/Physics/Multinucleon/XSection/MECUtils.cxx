@@ -268,12 +268,10 @@ double genie::utils::mec::TensorContraction(
     v4q.SetZ(v4Nu.Z() - v4lep.Z());
     
     MECHadronTensor * hadtensor = MECHadronTensor::Instance();
-    const vector <genie::BLI2DNonUnifGrid *> &
+    const MECHadronTensor::MECHadronTensorGrid &
          tensor_table = hadtensor->TensorTable(tensorpdg, tensor_type);
     
-    for (int i=0 ; i < 5; i++){
-      wtotd[i] = tensor_table[i]->Evaluate(v4q.Vect().Mag(),v4q.E());
-    }
+    tensor_table.Evaluate(v4q.Vect().Mag(), v4q.E(), wtotd);
     
     // calculate hadron tensor components
     // these are footnote 2 of Nieves PRC 70 055503
@@ -92,12 +92,8 @@ double MECXSec::Integrate(
   double abstol = 1; //We mostly care about relative tolerance.
   ROOT::Math::IBaseFunctionMultiDim * func =
         new utils::gsl::d2Xsec_dTCosth(model, interaction);
-  ROOT::Math::IntegrationMultiDim::Type ig_type =
-    utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
-  ROOT::Math::IntegratorMultiDim ig(
-    *func, ig_type, abstol, fGSLRelTol, fGSLMaxEval);
-
-  xsec = ig.Integral(kine_min, kine_max);
+  xsec = utils::gsl::IntegrateMultiDim(*func, fGSLIntgType, kine_min, kine_max,
+            abstol, fGSLRelTol, fGSLMaxEval);
 
   delete func;
   delete interaction;
@@ -137,7 +133,7 @@ void MECXSec::LoadConfig(void)
 //____________________________________________________________________________
 genie::utils::gsl::d2Xsec_dTCosth::d2Xsec_dTCosth(
      const XSecAlgorithmI * m, const Interaction * i) :
-ROOT::Math::IBaseFunctionMultiDim(),
+BatchFunctionMultiDim(),
 fModel(m),
 fInteraction(i)
 {
@@ -26,6 +26,8 @@
 #include <Math/IFunction.h>
 #include <Math/IntegratorMultiDim.h>
 
+#include "Framework/Numerical/BatchFunctionMultiDim.h"
+
 namespace genie {
 
 class XSecAlgorithmI;
@@ -62,7 +64,7 @@ private:
  namespace utils {
   namespace gsl   {
 
-   class d2Xsec_dTCosth: public ROOT::Math::IBaseFunctionMultiDim
+   class d2Xsec_dTCosth: public genie::BatchFunctionMultiDim
    {
     public:
       d2Xsec_dTCosth(const XSecAlgorithmI * m, const Interaction * i);
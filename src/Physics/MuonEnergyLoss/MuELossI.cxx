@@ -14,11 +14,26 @@
 */
 //____________________________________________________________________________
 
+#include <sstream>
+#include <algorithm>
+
+#include <TMath.h>
+#include <TFile.h>
+#include <TTree.h>
+
+#include "Framework/Algorithm/AlgSharedData.h"
+#include "Framework/Messenger/Messenger.h"
 #include "Physics/MuonEnergyLoss/MuELossI.h"
 
 using namespace genie;
 using namespace genie::mueloss;
 
+// b(E) table nodes per decade of muon energy
+static const int kNTableNodesPerDecade = 100;
+
+// max number of nodes in a b(E) table (log10 of the energy range is < 6)
+static const int kNTableNodesMax = 6 * kNTableNodesPerDecade + 1;
+
 //___________________________________________________________________________
 MuELossI::MuELossI() :
 Algorithm()
@@ -44,3 +59,170 @@ MuELossI::~MuELossI()
 }
 //___________________________________________________________________________
 
+double MuELossI::TabulatedB(double E, MuELMaterial_t material) const
+{
+  if(material == eMuUndefined) return 0;
+  if(E<=MuELProcess::Threshold(this->Process()) || E>=kMaxMuE) return 0;
+
+  const BTable & t = this->Table(material);
+
+  // linear interpolation between the nodes bracketing log(E)
+  double u = (TMath::Log(E) - t.fLogEmin) / t.fDLogE;
+  int i = std::max(0, std::min( (int) u, (int) t.fB.size() - 2 ));
+  double f = u - i;
+  return t.fB[i] + f * (t.fB[i+1] - t.fB[i]);
+}
+//___________________________________________________________________________
+double MuELossI::TabulatedDEDx(double E, MuELMaterial_t material) const
+{
+  return E * this->TabulatedB(E, material);
+}
+//___________________________________________________________________________
+const MuELossI::BTable & MuELossI::Table(MuELMaterial_t material) const
+{
+  std::map<int, std::shared_ptr<const BTable> >::const_iterator it =
+    fTables.find( (int) material );
+  if ( it == fTables.end() ) {
+    std::ostringstream key;
+    key << "MuELossI/" << this->Id().Key() << "/" << (int) material;
+    std::shared_ptr<const BTable> table =
+      AlgSharedData::Instance()->Get<BTable>(key.str(),
+        [this, material] () { return this->BuildTable(material); });
+    it = fTables.insert(std::make_pair( (int) material, table)).first;
+  }
+  return *(it->second);
+}
+//___________________________________________________________________________
+MuELossI::BTable * MuELossI::BuildTable(MuELMaterial_t material) const
+{
+// Computes b(E) with the model dE_dx() at the table nodes. The end nodes are
+// moved just inside the (open) range where the model is defined.
+
+  double Ethr    = MuELProcess::Threshold(this->Process());
+  double logEmin = TMath::Log(Ethr);
+  double logEmax = TMath::Log(kMaxMuE);
+  int    n = 1 + (int) TMath::Ceil(
+                 kNTableNodesPerDecade * (logEmax-logEmin) / TMath::Log(10.));
+  n = std::max(2, std::min(n, kNTableNodesMax));
+
+  BTable * table   = new BTable;
+  table->fLogEmin  = logEmin;
+  table->fDLogE    = (logEmax-logEmin) / (n-1);
+  table->fB.resize(n);
+  for(int i = 0; i < n; i++) {
+    double E = TMath::Exp(logEmin + i * table->fDLogE);
+    E = std::max(E, Ethr    * (1+1E-6));
+    E = std::min(E, kMaxMuE * (1-1E-6));
+    table->fB[i] = this->dE_dx(E, material) / E;
+  }
+
+  LOG("MuELoss", pNOTICE)
+    << "Tabulated b(E) of " << this->Id().Key() << " in "
+    << MuELMaterial::AsString(material) << " at " << n << " energies";
+  return table;
+}
+//___________________________________________________________________________
+string MuELossI::TableName(void) const
+{
+  string name = "MuELossTable_" + this->Id().Key();
+  std::replace(name.begin(), name.end(), ':', '_');
+  std::replace(name.begin(), name.end(), '/', '_');
+  return name;
+}
+//___________________________________________________________________________
+bool MuELossI::SaveTables(string filename) const
+{
+// Saves the tables of this model built (or loaded) so far in a tree of the
+// input ROOT file. The tables of other models in the file are kept.
+
+  TFile file(filename.c_str(), "UPDATE");
+  if(file.IsZombie()) {
+    LOG("MuELoss", pERROR) << "Couldn't open file: " << filename;
+    return false;
+  }
+
+  int    material = 0, n = 0;
+  double logEmin = 0, dlogE = 0;
+  std::vector<double> b(kNTableNodesMax, 0.);
+
+  string name = this->TableName();
+  TTree * tree = new TTree(name.c_str(), this->Id().Key().c_str());
+  tree->Branch("Material", &material, "Material/I");
+  tree->Branch("LogEmin",  &logEmin,  "LogEmin/D");
+  tree->Branch("DLogE",    &dlogE,    "DLogE/D");
+  tree->Branch("N",        &n,        "N/I");
+  tree->Branch("B",        b.data(),  "B[N]/D");
+
+  std::map<int, std::shared_ptr<const BTable> >::const_iterator it;
+  for(it = fTables.begin(); it != fTables.end(); ++it) {
+    const BTable & t = *(it->second);
+    material = it->first;
+    logEmin  = t.fLogEmin;
+    dlogE    = t.fDLogE;
+    n        = t.fB.size();
+    std::copy(t.fB.begin(), t.fB.end(), b.begin());
+    tree->Fill();
+  }
+  tree->Write(name.c_str(), TObject::kOverwrite);
+  file.Close();
+
+  LOG("MuELoss", pNOTICE)
+    << "Saved " << fTables.size() << " b(E) tables of "
+    << this->Id().Key() << " in " << filename;
+  return true;
+}
+//___________________________________________________________________________
+int MuELossI::LoadTables(string filename)
+{
+// Loads the tables of this model saved by an earlier job. Tables built on
+// a different energy grid are skipped (and rebuilt when used).
+
+  TFile file(filename.c_str(), "READ");
+  if(file.IsZombie()) return 0;
+  TTree * tree = dynamic_cast<TTree *> (file.Get(this->TableName().c_str()));
+  if(!tree) return 0;
+
+  int    material = 0, n = 0;
+  double logEmin = 0, dlogE = 0;
+  std::vector<double> b(kNTableNodesMax, 0.);
+  tree->SetBranchAddress("Material", &material);
+  tree->SetBranchAddress("LogEmin",  &logEmin);
+  tree->SetBranchAddress("DLogE",    &dlogE);
+  tree->SetBranchAddress("N",        &n);
+  tree->SetBranchAddress("B",        b.data());
+
+  double Ethr = MuELProcess::Threshold(this->Process());
+  int nloaded = 0;
+  for(Long64_t i = 0; i < tree->GetEntries(); i++) {
+    tree->GetEntry(i);
+    bool same_grid = n >= 2 && n <= kNTableNodesMax &&
+       TMath::Abs(logEmin - TMath::Log(Ethr)) < 1E-9 &&
+       TMath::Abs(logEmin + (n-1)*dlogE - TMath::Log(kMaxMuE)) < 1E-9 &&
+       n == std::max(2, std::min(kNTableNodesMax, 1 + (int) TMath::Ceil(
+           kNTableNodesPerDecade * (n-1)*dlogE / TMath::Log(10.))));
+    if(!same_grid) {
+      LOG("MuELoss", pWARN)
+        << "Skipping the " << this->Id().Key() << " table for material "
+        << material << ": different energy grid";
+      continue;
+    }
+    BTable loaded;
+    loaded.fLogEmin = logEmin;
+    loaded.fDLogE   = dlogE;
+    loaded.fB.assign(b.begin(), b.begin() + n);
+
+    std::ostringstream key;
+    key << "MuELossI/" << this->Id().Key() << "/" << material;
+    fTables[material] = AlgSharedData::Instance()->Get<BTable>(key.str(),
+        [&loaded] () { return new BTable(loaded); });
+    nloaded++;
+  }
+  tree->ResetBranchAddresses();
+  file.Close();
+
+  LOG("MuELoss", pNOTICE)
+    << "Loaded " << nloaded << " b(E) tables of "
+    << this->Id().Key() << " from " << filename;
+  return nloaded;
+}
+//___________________________________________________________________________
@@ -5,6 +5,14 @@
 
 \brief    Cross Section Calculation Interface.
 
+          Besides the model calculation, dE_dx(), it provides tabulated
+          energy losses: b(E) = (-dE/dx)/E is computed once per material on
+          a uniform log(E) grid, from the process threshold to kMaxMuE, and
+          then interpolated (linearly in log(E)) by TabulatedB() and
+          TabulatedDEDx(). The tables are built at first use, and shared by
+          the instances of the model in all threads, or loaded from a file
+          written by an earlier job (SaveTables() / LoadTables()).
+
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -19,6 +27,10 @@
 #ifndef _MUELOSS_I_H_
 #define _MUELOSS_I_H_
 
+#include <map>
+#include <memory>
+#include <vector>
+
 #include "Framework/Algorithm/Algorithm.h"
 #include "Physics/MuonEnergyLoss/MuELMaterial.h"
 #include "Physics/MuonEnergyLoss/MuELProcess.h"
@@ -36,10 +48,31 @@ public:
   virtual double        dE_dx   (double E, MuELMaterial_t m) const = 0;
   virtual MuELProcess_t Process (void) const = 0;
 
+  //! Tabulated energy losses (see the class description)
+  double TabulatedB    (double E, MuELMaterial_t m) const; ///< b(E), in GeV^-3
+  double TabulatedDEDx (double E, MuELMaterial_t m) const; ///< -dE/dx, in GeV^-2
+  bool   SaveTables    (string filename) const; ///< save the tables built so far
+  int    LoadTables    (string filename);       ///< returns the number of tables loaded
+
 protected:
   MuELossI();
   MuELossI(string name);
   MuELossI(string name, string config);
+
+private:
+
+  //! b(E) at nodes uniformly spaced in log(E). Read-only once built.
+  struct BTable {
+    double              fLogEmin;  ///< log(E/GeV) of the first node
+    double              fDLogE;    ///< node spacing in log(E/GeV)
+    std::vector<double> fB;        ///< b(E) at the nodes
+  };
+  const BTable & Table      (MuELMaterial_t m) const;
+  BTable *       BuildTable (MuELMaterial_t m) const;
+  string         TableName  (void) const;
+
+  //! Tables of the materials seen so far
+  mutable std::map<int, std::shared_ptr<const BTable> > fTables;
 };
 
 }       // mueloss namespace
@@ -26,6 +26,7 @@
 #include "Physics/NNBarOscillation/NNBarOscPrimaryVtxGenerator.h"
 #include "Physics/NNBarOscillation/NNBarOscUtils.h"
 #include "Physics/NNBarOscillation/NNBarOscMode.h"
+#include "Physics/NuclearState/NuclearDensityProfile.h"
 #include "Physics/NuclearState/NuclearUtils.h"
 #include "Physics/NuclearState/NuclearModelI.h"
 
@@ -140,14 +141,18 @@ void NNBarOscPrimaryVtxGenerator::GenerateOscillatingNeutronPosition(
   LOG("NNBarOsc", pINFO)
       << "Generating vertex according to a realistic nuclear density profile";
 
-  // get inputs to the rejection method
-  double ymax = -1;
+  const NuclearDensityProfile * density = NuclearDensityProfile::Instance(A);
+
+  // get inputs to the rejection method (scanned once for each nucleus)
   double rmax = 3*R;
-  double dr   = R/40.;
-  for(double r = 0; r < rmax; r+=dr) {
-      ymax = TMath::Max(ymax, r*r * utils::nuclear::Density(r,A));
+  double & ymax = fDensityMax[A];
+  if(ymax <= 0) {
+    double dr = R/40.;
+    for(double r = 0; r < rmax; r+=dr) {
+        ymax = TMath::Max(ymax, r*r * density->Density(r));
+    }
+    ymax *= 1.2;
   }
-  ymax *= 1.2;
 
   // select a vertex using the rejection method
   TLorentzVector vtx(0,0,0,0);
@@ -167,7 +172,7 @@ void NNBarOscPrimaryVtxGenerator::GenerateOscillatingNeutronPosition(
 
     double r = rmax * rnd->RndFsi().Rndm();
     double t = ymax * rnd->RndFsi().Rndm();
-    double y = r*r * utils::nuclear::Density(r,A);
+    double y = r*r * density->Density(r);
     if(y > ymax) {
        LOG("NNBarOsc", pERROR)
           << "y = " << y << " > ymax = " << ymax << " for r = " << r << ", A = " << A;
@@ -269,27 +274,14 @@ void NNBarOscPrimaryVtxGenerator::GenerateDecayProducts(
 {
   LOG("NNBarOsc", pINFO) << "Generating decay...";
 
-  PDGCodeList pdgv = genie::utils::nnbar_osc::DecayProductList(fCurrDecayMode);
-  LOG("NNBarOsc", pINFO) << "Decay product IDs: " << pdgv;
-  assert ( pdgv.size() >  1);
+  const DecayChannel * channel = &(this->Channel(fCurrDecayMode));
+  LOG("NNBarOsc", pINFO) << "Decay product IDs: " << channel->fPdgCodes;
+  assert ( channel->fPdgCodes.size() >  1);
 
   LOG("NNBarOsc", pINFO) << "Performing a phase space decay...";
-
-  // Get the decay product masses
-
-  vector<int>::const_iterator pdg_iter;
-  int idx = 0;
-  double * mass = new double[pdgv.size()];
-  double   sum  = 0;
-  for(pdg_iter = pdgv.begin(); pdg_iter != pdgv.end(); ++pdg_iter) {
-    int pdgc = *pdg_iter;
-    double m = PDGLibrary::Instance()->Find(pdgc)->Mass();
-    mass[idx++] = m;
-    sum += m;
-  }
-
   LOG("NNBarOsc", pINFO)
-    << "Decaying N = " << pdgv.size() << " particles / total mass = " << sum;
+    << "Decaying N = " << channel->fPdgCodes.size()
+    << " particles / total mass = " << channel->fMassSum;
   int initial_nucleus_id      = 0;
   int oscillating_neutron_id  = 1;
   int annihilation_nucleon_id = 2;
@@ -322,7 +314,8 @@ void NNBarOscPrimaryVtxGenerator::GenerateDecayProducts(
     << "Decaying system p4 = " << utils::print::P4AsString(p4d);
 
   // Set the decay
-  bool permitted = fPhaseSpaceGenerator.SetDecay(*p4d, pdgv.size(), mass);
+  bool permitted = fPhaseSpaceGenerator.SetDecay(
+       *p4d, channel->fPdgCodes.size(), &(channel->fMasses[0]));
 
   // If the decay is not energetically allowed, select a new final state
   while(!permitted) {
@@ -388,38 +381,30 @@ void NNBarOscPrimaryVtxGenerator::GenerateDecayProducts(
 
     fCurrDecayMode = (NNBarOscMode_t) interaction->ExclTag().DecayMode();
 
-    pdgv = genie::utils::nnbar_osc::DecayProductList(fCurrDecayMode);
-    LOG("NNBarOsc", pINFO) << "Decay product IDs: " << pdgv;
-    assert ( pdgv.size() > 1);
+    channel = &(this->Channel(fCurrDecayMode));
+    LOG("NNBarOsc", pINFO) << "Decay product IDs: " << channel->fPdgCodes;
+    assert ( channel->fPdgCodes.size() > 1);
 
     // get the decay particles again
     LOG("NNBarOsc", pINFO) << "Performing a phase space decay...";
-    idx = 0;
-    delete [] mass;
-    mass = new double[pdgv.size()];
-    sum = 0;
-    for(pdg_iter = pdgv.begin(); pdg_iter != pdgv.end(); ++pdg_iter) {
-      int pdgc = *pdg_iter;
-      double m = PDGLibrary::Instance()->Find(pdgc)->Mass();
-      mass[idx++] = m;
-      sum += m;
-    }
-
     LOG("NNBarOsc", pINFO)
-      << "Decaying N = " << pdgv.size() << " particles / total mass = " << sum;
+      << "Decaying N = " << channel->fPdgCodes.size()
+      << " particles / total mass = " << channel->fMassSum;
     LOG("NNBarOsc", pINFO)
       << "Decaying system p4 = " << utils::print::P4AsString(p4d);
 
-    permitted = fPhaseSpaceGenerator.SetDecay(*p4d, pdgv.size(), mass);
+    permitted = fPhaseSpaceGenerator.SetDecay(
+         *p4d, channel->fPdgCodes.size(), &(channel->fMasses[0]));
   }
 
+  const PDGCodeList & pdgv = channel->fPdgCodes;
+
   if(!permitted) {
      LOG("NNBarOsc", pERROR)
        << " *** Phase space decay is not permitted \n"
-       << " Total particle mass = " << sum << "\n"
+       << " Total particle mass = " << channel->fMassSum << "\n"
        << " Decaying system p4 = " << utils::print::P4AsString(p4d);
      // clean-up
-     delete [] mass;
      delete p4d;
      delete v4d;
      // throw exception
@@ -429,76 +414,93 @@ void NNBarOscPrimaryVtxGenerator::GenerateDecayProducts(
      throw exception;
   }
 
-  // Get the maximum weight
-  //double wmax = fPhaseSpaceGenerator.GetWtMax();
-  double wmax = -1;
-  for(int i=0; i<200; i++) {
-     double w = fPhaseSpaceGenerator.Generate();
-     wmax = TMath::Max(wmax,w);
+  // The weight of two-body decays is constant: Generate an unweighted decay
+  // directly. Otherwise get the maximum weight (estimated only at the first
+  // decay of each type and decaying system mass bin) and unweight.
+  if(pdgv.size() == 2) {
+     fPhaseSpaceGenerator.Generate();
   }
-  assert(wmax>0);
-  wmax *= 2;
-
-  LOG("NNBarOsc", pNOTICE)
-     << "Max phase space gen. weight @ current hadronic system: " << wmax;
+  else {
+    //double wmax = fPhaseSpaceGenerator.GetWtMax();
+    double wmax = fPhaseSpaceGenerator.MaxWeight();
+    assert(wmax>0);
+    wmax *= 2;
 
-  // Generate an unweighted decay
-  RandomGen * rnd = RandomGen::Instance();
-
-  bool accept_decay=false;
-  unsigned int itry=0;
-  while(!accept_decay)
-  {
-     itry++;
+    LOG("NNBarOsc", pNOTICE)
+       << "Max phase space gen. weight @ current hadronic system: " << wmax;
 
-     if(itry > controls::kMaxUnweightDecayIterations) {
-       // report, clean-up and return
-       LOG("NNBarOsc", pWARN)
-           << "Couldn't generate an unweighted phase space decay after "
-           << itry << " attempts";
-       // clean up
-       delete [] mass;
-       delete p4d;
-       delete v4d;
-       // throw exception
-       genie::exceptions::EVGThreadException exception;
-       exception.SetReason("Couldn't select decay after N attempts");
-       exception.SwitchOnFastForward();
-       throw exception;
-     }
-     double w  = fPhaseSpaceGenerator.Generate();
-     if(w > wmax) {
-        LOG("NNBarOsc", pWARN)
-           << "Decay weight = " << w << " > max decay weight = " << wmax;
-     }
-     double gw = wmax * rnd->RndHadro().Rndm();
-     accept_decay = (gw<=w);
-
-     LOG("NNBarOsc", pINFO)
-        << "Decay weight = " << w << " / R = " << gw
-        << " - accepted: " << accept_decay;
+    RandomGen * rnd = RandomGen::Instance();
 
-  } //!accept_decay
+    bool accept_decay=false;
+    unsigned int itry=0;
+    while(!accept_decay)
+    {
+       itry++;
+
+       if(itry > controls::kMaxUnweightDecayIterations) {
+         // report, clean-up and return
+         LOG("NNBarOsc", pWARN)
+             << "Couldn't generate an unweighted phase space decay after "
+             << itry << " attempts";
+         // clean up
+         delete p4d;
+         delete v4d;
+         // throw exception
+         genie::exceptions::EVGThreadException exception;
+         exception.SetReason("Couldn't select decay after N attempts");
+         exception.SwitchOnFastForward();
+         throw exception;
+       }
+       double w  = fPhaseSpaceGenerator.Generate();
+       fPhaseSpaceGenerator.UpdateMaxWeight(w);
+       if(w > wmax) {
+          LOG("NNBarOsc", pWARN)
+             << "Decay weight = " << w << " > max decay weight = " << wmax;
+       }
+       double gw = wmax * rnd->RndHadro().Rndm();
+       accept_decay = (gw<=w);
+
+       LOG("NNBarOsc", pINFO)
+          << "Decay weight = " << w << " / R = " << gw
+          << " - accepted: " << accept_decay;
+
+    } //!accept_decay
+  }
 
   // Insert final state products into a TClonesArray of GHepParticle's
   TLorentzVector v4(*v4d);
-  int idp = 0;
-  for(pdg_iter = pdgv.begin(); pdg_iter != pdgv.end(); ++pdg_iter) {
-     int pdgc = *pdg_iter;
+  for(unsigned int idp = 0; idp < pdgv.size(); idp++) {
+     int pdgc = pdgv[idp];
      TLorentzVector * p4fin = fPhaseSpaceGenerator.GetDecay(idp);
      GHepStatus_t ist =
         utils::nnbar_osc::DecayProductStatus(fNucleonIsBound, pdgc);
      p4fin->Boost(boost);
      event->AddParticle(pdgc, ist, oscillating_neutron_id,-1,-1,-1, *p4fin, v4);
-     idp++;
   }
 
   // Clean-up
-  delete [] mass;
   delete p4d;
   delete v4d;
 }
 //___________________________________________________________________________
+const NNBarOscPrimaryVtxGenerator::DecayChannel &
+  NNBarOscPrimaryVtxGenerator::Channel(NNBarOscMode_t ndm) const
+{
+  std::map<int, DecayChannel>::const_iterator it = fChannels.find((int)ndm);
+  if(it != fChannels.end()) return it->second;
+
+  DecayChannel & channel = fChannels[(int)ndm];
+  channel.fPdgCodes = genie::utils::nnbar_osc::DecayProductList(ndm);
+  channel.fMassSum  = 0;
+  PDGCodeList::const_iterator pdg_iter = channel.fPdgCodes.begin();
+  for( ; pdg_iter != channel.fPdgCodes.end(); ++pdg_iter) {
+    double m = PDGLibrary::Instance()->Find(*pdg_iter)->Mass();
+    channel.fMasses.push_back(m);
+    channel.fMassSum += m;
+  }
+  return channel;
+}
+//___________________________________________________________________________
 void NNBarOscPrimaryVtxGenerator::Configure(const Registry & config)
 {
   Algorithm::Configure(config);
@@ -517,9 +519,18 @@ void NNBarOscPrimaryVtxGenerator::LoadConfig(void)
 //  const Registry * gc = confp->GlobalParameterList();
 
   fNuclModel = 0;
+  fDensityMax.clear();
 
   RgKey nuclkey = "NuclearModel";
   fNuclModel = dynamic_cast<const NuclearModelI *> (this->SubAlg(nuclkey));
   assert(fNuclModel);
+
+  // Keep the phase space decay max weights per decay type?
+  bool keep_max_weights = true;
+  GetParamDef( "PhaseSpDec-KeepMaxWeights", keep_max_weights, true ) ;
+  fPhaseSpaceGenerator.SetUseMaxWeightStore(keep_max_weights);
+  fPhaseSpaceGenerator.ClearMaxWeights();
+
+  fChannels.clear();
 }
 //___________________________________________________________________________
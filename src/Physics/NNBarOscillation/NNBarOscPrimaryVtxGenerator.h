@@ -20,12 +20,15 @@
 #ifndef _NNBAR_OSC_PRIMARY_VTX_GENERATOR_H_
 #define _NNBAR_OSC_PRIMARY_VTX_GENERATOR_H_
 
-#include <TGenPhaseSpace.h>
 #include <TFile.h>
 #include <TH1.h>
+#include <map>
 #include <string>
+#include <vector>
 
 #include "Framework/EventGen/EventRecordVisitorI.h"
+#include "Framework/ParticleData/PDGCodeList.h"
+#include "Framework/Utils/NBodyPhaseSpace.h"
 #include "Physics/NNBarOscillation/NNBarOscMode.h"
 
 namespace genie {
@@ -55,10 +58,22 @@ private:
    void GenerateFermiMomentum              (GHepRecord * event) const;
    void GenerateDecayProducts              (GHepRecord * event) const;
 
+   // Decay products (and their masses) of an annihilation mode, listed at
+   // the first decay and reused by all subsequent ones
+   struct DecayChannel {
+     PDGCodeList         fPdgCodes;  ///< decay products
+     std::vector<double> fMasses;    ///< decay product masses
+     double              fMassSum;   ///< sum of the decay product masses
+   };
+   const DecayChannel & Channel (NNBarOscMode_t ndm) const;
+
    mutable int                fCurrInitStatePdg;
    mutable NNBarOscMode_t     fCurrDecayMode;
    mutable bool               fNucleonIsBound;
-   mutable TGenPhaseSpace     fPhaseSpaceGenerator;
+   mutable NBodyPhaseSpace    fPhaseSpaceGenerator; ///< a phase space generator, keeping its max weights
+
+   mutable std::map<int, DecayChannel> fChannels;   ///< by annihilation mode
+   mutable std::map<int, double>       fDensityMax; ///< max of r^2 x density used in vertex generation, by A
 
    const NuclearModelI * fNuclModel;
 };
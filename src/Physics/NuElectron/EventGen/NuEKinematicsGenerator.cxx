@@ -114,6 +114,7 @@ void NuEKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {
+        this->RecordAccepted(interaction, iter);
         LOG("NuEKinematics", pINFO) << "Selected: y = " << y;
 
         // set the cross section for the selected kinematics
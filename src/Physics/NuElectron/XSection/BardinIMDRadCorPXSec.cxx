@@ -8,9 +8,14 @@
 */
 //____________________________________________________________________________
 
+#include <cstdlib>
+#include <sstream>
+#include <iomanip>
+
 #include <TMath.h>
 #include <Math/Integrator.h>
 
+#include "Framework/Algorithm/AlgSharedData.h"
 #include "Physics/XSectionIntegration/XSecIntegratorI.h"
 #include "Framework/Conventions/GBuild.h"
 #include "Framework/Conventions/Constants.h"
@@ -23,15 +28,22 @@
 using namespace genie;
 using namespace genie::constants;
 
+namespace {
+  // upper edge of the allowed y range, avoiding ymax=1 due to a log(1-y)
+  const double kBardinYMaxCut = 1 - 1E-5;
+}
+
 //____________________________________________________________________________
 BardinIMDRadCorPXSec::BardinIMDRadCorPXSec() :
-XSecAlgorithmI("genie::BardinIMDRadCorPXSec")
+XSecAlgorithmI("genie::BardinIMDRadCorPXSec"),
+fTabulateFa(false)
 {
 
 }
 //____________________________________________________________________________
 BardinIMDRadCorPXSec::BardinIMDRadCorPXSec(string config) :
-XSecAlgorithmI("genie::BardinIMDRadCorPXSec", config)
+XSecAlgorithmI("genie::BardinIMDRadCorPXSec", config),
+fTabulateFa(false)
 {
 
 }
@@ -60,8 +72,7 @@ double BardinIMDRadCorPXSec::XSec(
   double ymin = r + re;
   double ymax = 1 + re + r*re / (1+re);
 
-  double e = 1E-5;
-  ymax = TMath::Min(ymax,1-e); // avoid ymax=1, due to a log(1-y)
+  ymax = TMath::Min(ymax,kBardinYMaxCut); // avoid ymax=1, due to a log(1-y)
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("BardinIMD", pDEBUG)
@@ -72,7 +83,11 @@ double BardinIMDRadCorPXSec::XSec(
 
   if(y<ymin || y>ymax) return 0;
 
-  double xsec = 2 * sig0 * ( 1 - r + (kAem/kPi) * Fa(re,r,y) );
+  double fa = 0;
+  if( !fFaTable || !this->InterpolateFa(E, (y-ymin)/(ymax-ymin), fa) ) {
+    fa = this->Fa(re,r,y);
+  }
+  double xsec = 2 * sig0 * ( 1 - r + (kAem/kPi) * fa );
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("BardinIMD", pINFO)
@@ -272,6 +287,89 @@ void BardinIMDRadCorPXSec::LoadConfig(void)
   fXSecIntegrator =
       dynamic_cast<const XSecIntegratorI *> (this->SubAlg("XSec-Integrator"));
   assert(fXSecIntegrator);
+
+  // Interpolate the radiative correction function Fa from a table?
+  GetParamDef( "RadCor-Tabulate", fTabulateFa, false ) ;
+
+  fFaTable.reset();
+  if ( fTabulateFa ) {
+    int    nE, nx;
+    double Emax;
+    GetParamDef( "RadCor-Table-NE",   nE,   61     ) ;
+    GetParamDef( "RadCor-Table-NY",   nx,   101    ) ;
+    GetParamDef( "RadCor-Table-EMax", Emax, 1000.  ) ;
+
+    // The table starts just above the IMD threshold (r=1), where Fa is
+    // singular
+    double Emin = 1.001 * kMuonMass2 / (2*kElectronMass);
+
+    if ( nE < 2 || nx < 2 || Emax <= Emin ) {
+      LOG("BardinIMD", pFATAL)
+        << "Invalid Fa table: " << nE << " energy nodes in ["
+        << Emin << ", " << Emax << "] GeV, " << nx << " y nodes";
+      gAbortingInErr = true;
+      std::exit(1);
+    }
+
+    std::ostringstream key;
+    key << "BardinIMDRadCorPXSec/Fa/" << std::setprecision(17)
+        << nE << "," << Emin << "," << Emax << "/" << nx;
+
+    fFaTable = AlgSharedData::Instance()->Get<FaTable>(key.str(),
+      [this, nE, nx, Emin, Emax] () {
+        return this->BuildFaTable(nE, nx, Emin, Emax);
+      });
+  }
+}
+//____________________________________________________________________________
+BardinIMDRadCorPXSec::FaTable * BardinIMDRadCorPXSec::BuildFaTable(
+                         int nE, int nx, double Emin, double Emax) const
+{
+  LOG("BardinIMD", pNOTICE)
+    << "Tabulating the Bardin radiative correction function Fa at "
+    << nE << " x " << nx << " (E, y) nodes in E = ["
+    << Emin << ", " << Emax << "] GeV";
+
+  FaTable * table  = new FaTable;
+  table->fNE       = nE;
+  table->fNX       = nx;
+  table->fLogEmin  = TMath::Log(Emin);
+  table->fDLogE    = (TMath::Log(Emax) - table->fLogEmin) / (nE-1);
+  table->fFa.resize(nE*nx);
+
+  for(int iE = 0; iE < nE; iE++) {
+    double E    = TMath::Exp(table->fLogEmin + iE * table->fDLogE);
+    double re   = 0.5 * kElectronMass / E;
+    double r    = (kMuonMass2 / kElectronMass2) * re;
+    double ymin = r + re;
+    double ymax = TMath::Min(1 + re + r*re / (1+re), kBardinYMaxCut);
+    for(int ix = 0; ix < nx; ix++) {
+      double y = ymin + (ymax-ymin) * ix / (nx-1);
+      table->fFa[iE*nx+ix] = this->Fa(re,r,y);
+    }
+  }
+  return table;
+}
+//____________________________________________________________________________
+bool BardinIMDRadCorPXSec::InterpolateFa(
+                                 double E, double x, double & fa) const
+{
+  const FaTable & t = *fFaTable;
+
+  double u = (TMath::Log(E) - t.fLogEmin) / t.fDLogE;
+  if(u < 0 || u > t.fNE-1) return false;
+  double v = TMath::Max(0., TMath::Min(1., x)) * (t.fNX-1);
+
+  int iE = TMath::Min( (int) u, t.fNE-2 );
+  int ix = TMath::Min( (int) v, t.fNX-2 );
+  double fu = u - iE;
+  double fv = v - ix;
+
+  const double * f0 = &t.fFa[ iE   *t.fNX + ix];
+  const double * f1 = &t.fFa[(iE+1)*t.fNX + ix];
+  fa = (1-fu) * ( (1-fv) * f0[0] + fv * f0[1] ) +
+          fu  * ( (1-fv) * f1[0] + fv * f1[1] );
+  return true;
 }
 //____________________________________________________________________________
 // Auxiliary scalar function for internal integration
@@ -12,6 +12,11 @@
           for experimental situations where a photon energy trigger threshold
           is applied.
 
+          Optionally (RadCor-Tabulate), the radiative correction function Fa
+          is interpolated bilinearly from a table in (log(E), y) built once per
+          configuration, instead of being evaluated with its (numerical)
+          dilogarithms at each call.
+
           Is a concrete implementation of the XSecAlgorithmI interface. \n
 
 \ref      D.Yu.Bardin and V.A.Dokuchaeva, Nucl.Phys.B287:839 (1987)
@@ -29,6 +34,9 @@
 #ifndef _BARDIN_IMD_RADIATIVE_CORRECTIONS_PARTIAL_XSEC_H_
 #define _BARDIN_IMD_RADIATIVE_CORRECTIONS_PARTIAL_XSEC_H_
 
+#include <memory>
+#include <vector>
+
 #include <Math/IFunction.h>
 #include "Framework/EventGen/XSecAlgorithmI.h"
 
@@ -65,7 +73,23 @@ private:
   double P   (int    i,  double r, double y) const;
   double C   (int    i,  int k,    double r) const;
 
+  /// Table of Fa(re,r,y) at nodes uniform in log(E) and in the position
+  /// x = (y-ymin)/(ymax-ymin) of y in its allowed range
+  struct FaTable {
+    int                 fNE;
+    int                 fNX;
+    double              fLogEmin;
+    double              fDLogE;
+    std::vector<double> fFa;       ///< Fa at node (iE,ix): [iE*fNX+ix]
+  };
+  FaTable * BuildFaTable (int nE, int nx, double Emin, double Emax) const;
+
+  // Interpolates Fa from the table; false if E is out of the table range
+  bool InterpolateFa(double E, double x, double & fa) const;
+
   // Private data members
+  bool                           fTabulateFa;     ///< interpolate Fa from a table?
+  std::shared_ptr<const FaTable> fFaTable;
 //  const IntegratorI *      fIntegrator;     ///< num integrator for BardinIMDRadCorIntegrand
   const XSecIntegratorI *  fXSecIntegrator; ///< differential x-sec integrator
 };
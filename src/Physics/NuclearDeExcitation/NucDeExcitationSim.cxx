@@ -10,6 +10,8 @@
 
 #include <cstdlib>
 #include <sstream>
+#include <map>
+#include <memory>
 
 #include <TMath.h>
 
@@ -59,7 +61,7 @@ NucDeExcitationSim::~NucDeExcitationSim()
 //___________________________________________________________________________
 void NucDeExcitationSim::ProcessEventRecord(GHepRecord * evrec) const
 {
-  LOG("NucDeEx", pNOTICE)
+  LOG("NucDeEx", pINFO)
      << "Simulating nuclear de-excitation gamma rays";
 
   GHepParticle * nucltgt = evrec->TargetNucleus();
@@ -69,271 +71,108 @@ void NucDeExcitationSim::ProcessEventRecord(GHepRecord * evrec) const
     return;
   }
 
-  if(nucltgt->Z()==8) this->OxygenTargetSim(evrec);
+  GHepParticle * hitnuc = evrec->HitNucleon();
+  if(!hitnuc) return;
+
+  bool p_hole = (hitnuc->Pdg() == kPdgProton);
+  const DeExTable * table = Table(nucltgt->Z(), p_hole);
+  if(table) this->SimulateDeExcitation(evrec, *table);
 
   LOG("NucDeEx", pINFO)
      << "Done with this event";
 }
 //___________________________________________________________________________
-void NucDeExcitationSim::OxygenTargetSim(GHepRecord * evrec) const
+void NucDeExcitationSim::SimulateDeExcitation(
+                    GHepRecord * evrec, const DeExTable & table) const
 {
-  LOG("NucDeEx", pNOTICE)
-     << "Simulating nuclear de-excitation gamma rays for Oxygen target";
-
-  //LOG("NucDeEx", pNOTICE) << *evrec;
-
-  GHepParticle * hitnuc = evrec->HitNucleon();
-  if(!hitnuc) return;
-
-  bool p_hole = (hitnuc->Pdg() == kPdgProton);
-  double dt   = -1;
+// Selects the shell of the hole, the excited state of the remnant and its
+// de-excitation mode, and adds the photons of that mode in the event.
+// A random number is thrown at each step with more than one choice only.
 
   RandomGen * rnd = RandomGen::Instance();
 
-  //
-  // ****** P-Hole
-  //
-  if (p_hole) {
-    //
-    // * Define all the data required for simulating deexcitations of p-hole states
-    //
+  // select the shell of the hole
+  double r = rnd->RndDec().Rndm();
+  const DeExShell * shell = 0;
+  for(unsigned int i = 0; i < table.fShells.size(); i++) {
+    if(r < table.fShells[i].fCumProb) { shell = &table.fShells[i]; break; }
+  }
+  if(!shell || shell->fStates.empty()) {
+    LOG("NucDeEx", pINFO) << "No photons from the hole state";
+    return;
+  }
 
-    // > probabilities for creating a p-hole in the P1/2, P3/2, S1/2 shells
-    double Pp12 = 0.25;              // P1/2
-    double Pp32 = 0.47;              // P3/2
-    double Ps12 = 1. - Pp12 - Pp32;  // S1/2
-
-    // > excited state energy levels & probabilities for P3/2-shell p-holes
-    const int np32 = 3;
-    double p32Elv[np32] = { 0.00632, 0.00993, 0.01070 };
-    double p32Plv[np32] = { 0.872,   0.064,   0.064   };
-    // - probabilities for deexcitation modes of P3/2-shell p-hole state '1'
-    double p32Plv1_1gamma  = 0.78;  // prob to decay via 1 gamma
-    double p32Plv1_cascade = 0.22;  // prob to decay via gamma cascade
-
-    // > excited state energy levels & probabilities for S1/2-shell p-holes
-    const int ns12 = 11;
-    double s12Elv[ns12] = {
-               0.00309, 0.00368, 0.00385, 0.00444, 0.00492,
-               0.00511, 0.00609, 0.00673, 0.00701, 0.00703, 0.00734 };
-    double s12Plv[ns12] = {
-               0.0625,  0.1875,  0.075,   0.1375,  0.1375,
-               0.0125,  0.0125,  0.075,   0.0563,  0.0563,  0.1874  };
-    // - gamma energies and probabilities for S1/2-shell p-hole excited
-    //   states '2','7' and '10' with >1 deexcitation modes
-    const int ns12lv2 = 3;
-    double s12Elv2[ns12lv2]    = { 0.00309, 0.00369, 0.00385 };
-    double s12Plv2[ns12lv2]    = { 0.013,   0.360,   0.625   };
-    const int ns12lv7 = 2;
-    double s12Elv7[ns12lv7]    = { 0.00609, 0.00673 };
-    double s12Plv7[ns12lv7]    = { 0.04,    0.96    };
-    const int ns12lv10 = 3;
-    double s12Elv10[ns12lv10]  = { 0.00609, 0.00673, 0.00734 };
-    double s12Plv10[ns12lv10]  = { 0.050,   0.033,   0.017   };
-
-    // Select one of the P1/2, P3/2 or S1/2
-    double rshell = rnd->RndDec().Rndm();
-    //
-    // >> P1/2 shell
-    //
-    if(rshell < Pp12) {
-        LOG("NucDeEx", pNOTICE)
-          << "Hit nucleon left a P1/2 shell p-hole. Remnant is at g.s.";
-        return;
+  // select the excited state of the remnant
+  const DeExState * state = &shell->fStates[0];
+  if(shell->fStates.size() > 1) {
+    state = 0;
+    r = rnd->RndDec().Rndm();
+    for(unsigned int i = 0; i < shell->fStates.size(); i++) {
+      if(r < shell->fStates[i].fCumProb) { state = &shell->fStates[i]; break; }
     }
-    //
-    // >> P3/2 shell
-    //
-    else
-    if(rshell < Pp12 + Pp32) {
-        LOG("NucDeEx", pNOTICE)
-            << "Hit nucleon left a P3/2 shell p-hole";
-        // Select one of the excited states
-        double rdecmode  = rnd->RndDec().Rndm();
-        double prob_sum  = 0;
-        int    sel_state = -1;
-        for(int istate=0; istate<np32; istate++) {
-            prob_sum += p32Plv[istate];
-            if(rdecmode < prob_sum) {
-              sel_state = istate;
-              break;
-            }
-        }
-        LOG("NucDeEx", pNOTICE)
-            << "Selected P3/2 excited state = " << sel_state;
-
-        // Decay that excited state
-        // >> 6.32 MeV state
-        if(sel_state==0) {
-            this->AddPhoton(evrec, p32Elv[0], dt);
-        }
-        // >> 9.93 MeV state
-        else
-        if(sel_state==1) {
-            double r = rnd->RndDec().Rndm();
-            // >>> emit a single gamma
-            if(r < p32Plv1_1gamma) {
-               this->AddPhoton(evrec, p32Elv[1], dt);
-            }
-            // >>> emit a cascade of gammas
-            else
-            if(r < p32Plv1_1gamma + p32Plv1_cascade) {
-               this->AddPhoton(evrec, p32Elv[1],           dt);
-               this->AddPhoton(evrec, p32Elv[1]-p32Elv[0], dt);
-            }
-        }
-        // >> 10.7 MeV state
-        else
-        if(sel_state==2) {
-           // Above the particle production threshold - need to emit
-           // a 0.5 MeV kinetic energy proton.
-           // Will neglect that given that it is a very low energy
-           // kinetic energy nucleon and the intranuke break-up nucleon
-           // cross sections are already tuned.
-           return;
-        }
-    } //p3/2
-    //
-    // >> S1/2 shell
-    //
-    else if (rshell < Pp12 + Pp32 + Ps12) {
-        LOG("NucDeEx", pNOTICE)
-            << "Hit nucleon left an S1/2 shell p-hole";
-        // Select one of the excited states caused by a S1/2 shell hole
-        double rdecmode  = rnd->RndDec().Rndm();
-        double prob_sum  = 0;
-        int    sel_state = -1;
-        for(int istate=0; istate<ns12; istate++) {
-            prob_sum += s12Plv[istate];
-            if(rdecmode < prob_sum) {
-              sel_state = istate;
-              break;
-            }
-        }
-        LOG("NucDeEx", pNOTICE)
-            << "Selected S1/2 excited state = " << sel_state;
-
-        // Decay that excited state
-        bool multiple_decay_modes =
-              (sel_state==2 || sel_state==7 || sel_state==10);
-        if(!multiple_decay_modes) {
-          this->AddPhoton(evrec, s12Elv[sel_state], dt);
-        } else {
-          int ndec = -1;
-          double * pdec = 0, * edec = 0;
-          switch(sel_state) {
-           case(2) :
-              ndec = ns12lv2;  pdec = s12Plv2;  edec = s12Elv2;
-              break;
-           case(7) :
-              ndec = ns12lv7;  pdec = s12Plv7;  edec = s12Elv7;
-              break;
-           case(10) :
-              ndec = ns12lv10; pdec = s12Plv10; edec = s12Elv10;
-              break;
-           default:
-             return;
-          }
-          double r = rnd->RndDec().Rndm();
-          double decmode_prob_sum = 0;
-          int sel_decmode = -1;
-          for(int idecmode=0; idecmode < ndec; idecmode++) {
-             decmode_prob_sum += pdec[idecmode];
-             if(r < decmode_prob_sum) {
-                 sel_decmode = idecmode;
-                 break;
-             }
-          }
-          if(sel_decmode == -1) return;
-          this->AddPhoton(evrec, edec[sel_decmode], dt);
-        }//mult.dec.ch
-
-    } // s1/2
-    else {
+    if(!state) return;
+  }
+  if(state->fModes.empty()) {
+    LOG("NucDeEx", pINFO) << "No photons from the excited remnant state";
+    return;
+  }
+
+  // select its de-excitation mode
+  const DeExMode * mode = &state->fModes[0];
+  if(state->fModes.size() > 1 || mode->fCumProb < 1.) {
+    mode = 0;
+    r = rnd->RndDec().Rndm();
+    for(unsigned int i = 0; i < state->fModes.size(); i++) {
+      if(r < state->fModes[i].fCumProb) { mode = &state->fModes[i]; break; }
     }
-  } // p-hole
+    if(!mode) return;
+  }
 
-  //
-  // ****** n-hole
-  //
-  else {
-    //
-    // * Define all the data required for simulating deexcitations of n-hole states
-    //
+  // find the remnant nucleus, which recoils against the photons
+  GHepParticle * target  = evrec->Particle(1);
+  GHepParticle * remnant = 0;
+  for(int i = target->FirstDaughter(); i <= target->LastDaughter(); i++) {
+    remnant  = evrec->Particle(i);
+    if(pdg::IsIon(remnant->Pdg())) break;
+  }
+  if(!remnant) return;
 
-    // > probabilities for creating a n-hole in the P1/2, P3/2, S1/2 shells
-    double Pp12 = 0.25;  // P1/2
-    double Pp32 = 0.44;  // P3/2
-    double Ps12 = 0.09;  // S1/2
-    //>
-    double p32Elv = 0.00618;
-    //>
-    double s12Elv = 0.00703;
-    double s12Plv = 0.222;
-
-    // Select one of the P1/2, P3/2 or S1/2
-    double rshell = rnd->RndDec().Rndm();
-    //
-    // >> P1/2 shell
-    //
-    if(rshell < Pp12) {
-        LOG("NucDeEx", pNOTICE)
-          << "Hit nucleon left a P1/2 shell n-hole. Remnant is at g.s.";
-        return;
-    }
-    //
-    // >> P3/2 shell
-    //
-    else
-    if(rshell < Pp12 + Pp32) {
-        LOG("NucDeEx", pNOTICE)
-            << "Hit nucleon left a P3/2 shell n-hole";
-        this->AddPhoton(evrec, p32Elv, dt);
-    }
-    //
-    // >> S1/2 shell
-    //
-    else
-    if(rshell < Pp12 + Pp32 + Ps12) {
-        LOG("NucDeEx", pNOTICE)
-            << "Hit nucleon left a S1/2 shell n-hole";
-        // only one of the deexcitation modes involve a (7.03 MeV) photon
-        double r = rnd->RndDec().Rndm();
-        if(r < s12Plv) this->AddPhoton(evrec, s12Elv,dt);
-    }
-    else {
-    }
-  } //n-hole
+  double dt = -1;
+  for(int i = 0; i < mode->fNPhotons; i++) {
+    this->AddPhoton(evrec, remnant, mode->fEPhoton[i], dt);
+  }
 }
 //___________________________________________________________________________
 void NucDeExcitationSim::AddPhoton(
-                         GHepRecord * evrec, double E0, double dt) const
+    GHepRecord * evrec, GHepParticle * remnant, double E0, double dt) const
 {
-// Add a photon at the event record & recoil the remnant nucleus so as to
-// conserve energy/momenta
+// Add an isotropic photon at the event record & recoil the remnant nucleus
+// so as to conserve energy/momenta
 //
   double E = (dt>0) ? this->PhotonEnergySmearing(E0, dt) : E0;
 
-  LOG("NucDeEx", pNOTICE)
+  LOG("NucDeEx", pINFO)
     << "Adding a " << E/units::MeV << " MeV photon from nucl. deexcitation";
 
-  GHepParticle * target  = evrec->Particle(1);
-  GHepParticle * remnant = 0;
-  for(int i = target->FirstDaughter(); i <= target->LastDaughter(); i++) {
-    remnant  = evrec->Particle(i);
-    if(pdg::IsIon(remnant->Pdg())) break;
-  }
+  RandomGen * rnd = RandomGen::Instance();
 
-  TLorentzVector x4(0,0,0,0);
-  TLorentzVector p4 = this->Photon4P(E);
-  GHepParticle gamma(kPdgGamma, kIStStableFinalState,1,-1,-1,-1, p4, x4);  // note that this assigns the parent of the photon as the initial-state nucleon/nucleus.  (do we want that??)
-  evrec->AddParticle(gamma);
+  double costheta = -1. + 2. * rnd->RndDec().Rndm();
+  double sintheta = TMath::Sqrt(TMath::Max(0., 1.-costheta*costheta));
+  double phi      = 2*kPi * rnd->RndDec().Rndm();
+
+  double px = E * sintheta * TMath::Cos(phi);
+  double py = E * sintheta * TMath::Sin(phi);
+  double pz = E * costheta;
 
+  // note that this assigns the parent of the photon as the initial-state
+  // nucleon/nucleus.  (do we want that??)
+  evrec->AddParticle(kPdgGamma, kIStStableFinalState, 1,-1,-1,-1,
+                     px, py, pz, E, 0, 0, 0, 0);
 
-  remnant->SetPx     ( remnant->Px() - p4.Px() );
-  remnant->SetPy     ( remnant->Py() - p4.Py() );
-  remnant->SetPz     ( remnant->Pz() - p4.Pz() );
-  remnant->SetEnergy ( remnant->E()  - p4.E()  );
+  remnant->SetPx     ( remnant->Px() - px );
+  remnant->SetPy     ( remnant->Py() - py );
+  remnant->SetPz     ( remnant->Pz() - pz );
+  remnant->SetEnergy ( remnant->E()  - E  );
 }
 //___________________________________________________________________________
 double NucDeExcitationSim::PhotonEnergySmearing(double E0, double dt) const
@@ -353,23 +192,150 @@ double NucDeExcitationSim::PhotonEnergySmearing(double E0, double dt) const
   return E;
 }
 //___________________________________________________________________________
-TLorentzVector NucDeExcitationSim::Photon4P(double E) const
+NucDeExcitationSim::DeExTable &
+   NucDeExcitationSim::DeExTable::AddShell(double prob)
+{
+  DeExShell shell;
+  shell.fCumProb = prob + (fShells.empty() ? 0. : fShells.back().fCumProb);
+  fShells.push_back(shell);
+  return *this;
+}
+//___________________________________________________________________________
+NucDeExcitationSim::DeExTable &
+   NucDeExcitationSim::DeExTable::AddState(double prob)
 {
-// Generate a photon 4p
+  std::vector<DeExState> & states = fShells.back().fStates;
+  DeExState state;
+  state.fCumProb = prob + (states.empty() ? 0. : states.back().fCumProb);
+  states.push_back(state);
+  return *this;
+}
+//___________________________________________________________________________
+NucDeExcitationSim::DeExTable &
+   NucDeExcitationSim::DeExTable::AddMode(
+                      double prob, std::initializer_list<double> egamma)
+{
+  std::vector<DeExMode> & modes = fShells.back().fStates.back().fModes;
+  DeExMode mode;
+  mode.fCumProb  = prob + (modes.empty() ? 0. : modes.back().fCumProb);
+  mode.fNPhotons = 0;
+  for(double E : egamma) {
+    if(mode.fNPhotons < kMaxDeExPhotons) mode.fEPhoton[mode.fNPhotons++] = E;
+  }
+  modes.push_back(mode);
+  return *this;
+}
+//___________________________________________________________________________
+namespace {
 
-  RandomGen * rnd = RandomGen::Instance();
+  typedef std::map<int, NucDeExcitationSim::DeExTable> DeExTableMap_t;
 
-  double costheta = -1. + 2. * rnd->RndDec().Rndm();
-  double sintheta = TMath::Sqrt(TMath::Max(0., 1.-TMath::Power(costheta,2)));
-  double phi      = 2*kPi * rnd->RndDec().Rndm();
-  double cosphi   = TMath::Cos(phi);
-  double sinphi   = TMath::Sin(phi);
+  int DeExTableKey(int Z, bool p_hole) { return 2*Z + (p_hole ? 1 : 0); }
 
-  double px = E * sintheta * cosphi;
-  double py = E * sintheta * sinphi;
-  double pz = E * costheta;
+  DeExTableMap_t * BuildDeExTables(void)
+  {
+  // Energies in GeV. Hole shells / excited states that aren't listed, or
+  // listed without modes, give no photons.
+
+    SLOG("NucDeEx", pNOTICE) << "Building the nuclear de-excitation tables";
+
+    DeExTableMap_t * tables = new DeExTableMap_t;
+
+    //
+    // ****** 16O
+    //
+
+    // > p-hole (15N remnant)
+    (*tables)[DeExTableKey(8,true)]
+       .AddShell(0.25)                                        // P1/2: g.s.
+       .AddShell(0.47)                                        // P3/2
+         .AddState(0.872).AddMode(1.,    { 0.00632 })
+         .AddState(0.064).AddMode(0.78,  { 0.00993 })
+                         .AddMode(0.22,  { 0.00993, 0.00993-0.00632 })
+         .AddState(0.064)  // 10.7 MeV: above the particle production
+                           // threshold; the 0.5 MeV proton is neglected
+       .AddShell(1.-0.25-0.47)                                // S1/2
+         .AddState(0.0625).AddMode(1.,    { 0.00309 })
+         .AddState(0.1875).AddMode(1.,    { 0.00368 })
+         .AddState(0.075 ).AddMode(0.013, { 0.00309 })
+                          .AddMode(0.360, { 0.00369 })
+                          .AddMode(0.625, { 0.00385 })
+         .AddState(0.1375).AddMode(1.,    { 0.00444 })
+         .AddState(0.1375).AddMode(1.,    { 0.00492 })
+         .AddState(0.0125).AddMode(1.,    { 0.00511 })
+         .AddState(0.0125).AddMode(1.,    { 0.00609 })
+         .AddState(0.075 ).AddMode(0.04,  { 0.00609 })
+                          .AddMode(0.96,  { 0.00673 })
+         .AddState(0.0563).AddMode(1.,    { 0.00701 })
+         .AddState(0.0563).AddMode(1.,    { 0.00703 })
+         .AddState(0.1874).AddMode(0.050, { 0.00609 })
+                          .AddMode(0.033, { 0.00673 })
+                          .AddMode(0.017, { 0.00734 });
+
+    // > n-hole (15O remnant)
+    (*tables)[DeExTableKey(8,false)]
+       .AddShell(0.25)                                        // P1/2: g.s.
+       .AddShell(0.44)                                        // P3/2
+         .AddState(1.).AddMode(1.,    { 0.00618 })
+       .AddShell(0.09)                                        // S1/2
+         .AddState(1.).AddMode(0.222, { 0.00703 });
+
+    //
+    // ****** 12C
+    //
+    // S1/2-shell holes leave the remnant well above the particle emission
+    // thresholds and are neglected.
+
+    // > p-hole (11B remnant)
+    (*tables)[DeExTableKey(6,true)]
+       .AddShell(0.67)                                        // P3/2
+         .AddState(0.71)                                      // g.s.
+         .AddState(0.17).AddMode(1.,    { 0.002125 })
+         .AddState(0.12).AddMode(0.86,  { 0.005020 })
+                        .AddMode(0.14,  { 0.005020-0.002125, 0.002125 })
+       .AddShell(0.33);                                       // S1/2
+
+    // > n-hole (11C remnant)
+    (*tables)[DeExTableKey(6,false)]
+       .AddShell(0.67)                                        // P3/2
+         .AddState(0.71)                                      // g.s.
+         .AddState(0.17).AddMode(1.,    { 0.002000 })
+         .AddState(0.12).AddMode(1.,    { 0.004804 })
+       .AddShell(0.33);                                       // S1/2
+
+    //
+    // ****** 40Ar
+    //
+    // Only the lowest single-hole states are included, with shell occupancy
+    // weights. Deeper holes (D5/2 and below) are fragmented over states close
+    // to or above the particle emission thresholds and are neglected.
+
+    // > p-hole (39Cl remnant)
+    (*tables)[DeExTableKey(18,true)]
+       .AddShell(0.11)                                        // D3/2: g.s.
+       .AddShell(0.11)                                        // S1/2
+         .AddState(1.).AddMode(1.,    { 0.000396 });
+
+    // > n-hole (39Ar remnant)
+    (*tables)[DeExTableKey(18,false)]
+       .AddShell(0.09)                                        // F7/2: g.s.
+       .AddShell(0.18)                                        // D3/2
+         .AddState(1.).AddMode(1.,    { 0.001517 })
+       .AddShell(0.09)                                        // S1/2
+         .AddState(1.).AddMode(1.,    { 0.002358-0.001517, 0.001517 });
+
+    return tables;
+  }
+}
+//___________________________________________________________________________
+const NucDeExcitationSim::DeExTable *
+                       NucDeExcitationSim::Table(int Z, bool p_hole)
+{
+// The tables are built at first use and shared by all threads
+
+  static const std::unique_ptr<const DeExTableMap_t> tables(BuildDeExTables());
 
-  TLorentzVector p4(px,py,pz,E);
-  return p4;
+  DeExTableMap_t::const_iterator it = tables->find(DeExTableKey(Z, p_hole));
+  return (it == tables->end()) ? 0 : &(it->second);
 }
 //___________________________________________________________________________
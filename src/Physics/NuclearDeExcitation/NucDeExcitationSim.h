@@ -5,12 +5,24 @@
 
 \brief    Generates nuclear de-excitation gamma rays
 
+          The de-excitation of the hole state left by the hit nucleon is
+          simulated from precomputed tables, one per (target Z, hole nucleon)
+          pair: cumulative probabilities for the shell of the hole, for the
+          excited state of the remnant it leaves and for the de-excitation
+          modes (sets of emitted photons) of that state. The tables cover
+          Carbon, Oxygen and Argon targets and are built once per job.
+
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
 
 \ref      16O:
            H.Ejiri,Phys.Rev.C48,1442(1993);
            K.Kobayashi et al., Nucl.Phys.B (proc Suppl) 139 (2005)
+          12C:
+           Yu.Kamyshkov and E.Kolbe, Phys.Rev.D67, 076007 (2003);
+           V.Panin et al., Phys.Lett.B753, 204 (2016)
+          40Ar:
+           L.Jiang et al., Phys.Rev.D105, 112002 (2022)
 
 \created  March 05, 2008
 
@@ -22,12 +34,17 @@
 #ifndef _NUCLEAR_DEEXCITATION_H_
 #define _NUCLEAR_DEEXCITATION_H_
 
+#include <vector>
+#include <initializer_list>
+
 #include <TLorentzVector.h>
 
 #include "Framework/EventGen/EventRecordVisitorI.h"
 
 namespace genie {
 
+class GHepParticle;
+
 class NucDeExcitationSim : public EventRecordVisitorI {
 
 public :
@@ -38,11 +55,40 @@ public :
   //-- implement the EventRecordVisitorI interface
   void ProcessEventRecord (GHepRecord * evrec) const;
 
+  //-- de-excitation tables
+  //   Each entry stores the cumulative probability up to and including it.
+  //   Mode probabilities of a state may add up to less than 1: the rest are
+  //   de-excitations without photons (eg particle emission).
+
+  static const int kMaxDeExPhotons = 3;
+
+  struct DeExMode {
+    double fCumProb;
+    int    fNPhotons;
+    double fEPhoton[kMaxDeExPhotons];  ///< photon energies (GeV)
+  };
+  struct DeExState {
+    double fCumProb;
+    std::vector<DeExMode> fModes;      ///< empty: no photons
+  };
+  struct DeExShell {
+    double fCumProb;
+    std::vector<DeExState> fStates;    ///< empty: no photons
+  };
+  struct DeExTable {
+    std::vector<DeExShell> fShells;
+
+    DeExTable & AddShell (double prob);
+    DeExTable & AddState (double prob);
+    DeExTable & AddMode  (double prob, std::initializer_list<double> egamma);
+  };
+
+  static const DeExTable * Table (int Z, bool p_hole);
+
 private:
-  void           OxygenTargetSim      (GHepRecord * evrec) const;
-  void           AddPhoton            (GHepRecord * evrec, double E0, double t) const;
+  void           SimulateDeExcitation (GHepRecord * evrec, const DeExTable & table) const;
+  void           AddPhoton            (GHepRecord * evrec, GHepParticle * remnant, double E0, double t) const;
   double         PhotonEnergySmearing (double E0, double t) const;
-  TLorentzVector Photon4P             (double E) const;
 };
 
 }      // genie namespace
@@ -13,6 +13,7 @@
 
 #include <sstream>
 #include <cstdlib>
+#include <vector>
 #include <TMath.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
@@ -51,9 +52,9 @@ NuclearModelI("genie::EffectiveSF", config)
 //____________________________________________________________________________
 EffectiveSF::~EffectiveSF()
 {
-  map<string, TH1D*>::iterator iter = fProbDistroMap.begin();
-  for( ; iter != fProbDistroMap.begin(); ++iter) {
-    TH1D * hst = iter->second;
+  map<DistroKey_t, MomentumDistro>::iterator iter = fProbDistroMap.begin();
+  for( ; iter != fProbDistroMap.end(); ++iter) {
+    TH1D * hst = iter->second.fHist;
     if(hst) {
       delete hst;
       hst=0;
@@ -74,21 +75,25 @@ bool EffectiveSF::GenerateNucleon(const Target & target) const
   //
 
   if ( target.A() > 1 ) {
-    TH1D * prob = this->ProbDistro(target);
-    if(!prob) {
+    const MomentumDistro & distro = this->Distro(target);
+    if ( ! distro.fHist || distro.fBins.IsEmpty() ) {
       LOG("EffectiveSF", pNOTICE)
               << "Null nucleon momentum probability distribution";
       exit(1);
     }
 
-    double p = prob->GetRandom();
+    // pick a bin and a momentum uniformly within the bin, as TH1::GetRandom
+    RandomGen * rnd = RandomGen::Instance();
+
+    const TAxis * axis = distro.fHist->GetXaxis();
+    int    bin = 1 + distro.fBins.Sample(rnd->RndGen().Rndm());
+    double p   = axis->GetBinLowEdge(bin) +
+                 axis->GetBinWidth(bin) * rnd->RndGen().Rndm();
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
     LOG("EffectiveSF", pDEBUG) << "|p,nucleon| = " << p;
 #endif
 
-    RandomGen * rnd = RandomGen::Instance();
-
     double costheta = -1. + 2. * rnd->RndGen().Rndm();
     double sintheta = TMath::Sqrt(1.-costheta*costheta);
     double fi       = 2 * kPi * rnd->RndGen().Rndm();
@@ -143,9 +148,16 @@ double EffectiveSF::Prob(double mom, double w, const Target & target) const
 // compute with.  If not, make one.
 //____________________________________________________________________________
 TH1D * EffectiveSF::ProbDistro(const Target & target) const
+{
+  return this->Distro(target).fHist;
+}
+//____________________________________________________________________________
+const EffectiveSF::MomentumDistro &
+                        EffectiveSF::Distro(const Target & target) const
 {
   //-- return stored /if already computed/
-  map<string, TH1D*>::iterator it = fProbDistroMap.find(target.AsString());
+  DistroKey_t key(target.Pdg(), target.HitNucPdg());
+  map<DistroKey_t, MomentumDistro>::const_iterator it = fProbDistroMap.find(key);
   if(it != fProbDistroMap.end()) return it->second;
 
   LOG("EffectiveSF", pNOTICE)
@@ -156,8 +168,19 @@ TH1D * EffectiveSF::ProbDistro(const Target & target) const
   //-- get information for the nuclear target
   int nucleon_pdgc = target.HitNucPdg();
   assert( pdg::IsProton(nucleon_pdgc) || pdg::IsNeutron(nucleon_pdgc) );
-  return this->MakeEffectiveSF(target);
+  TH1D * prob = this->MakeEffectiveSF(target);
+
+  //-- build the alias table over the bins & store
+  MomentumDistro & distro = fProbDistroMap[key];
+  distro.fHist = prob;
+  if(prob) {
+    int npbins = prob->GetNbinsX();
+    std::vector<double> weights(npbins);
+    for(int i = 0; i < npbins; i++) weights[i] = prob->GetBinContent(i+1);
+    distro.fBins.Build(weights);
+  }
 
+  return distro;
 }
 //____________________________________________________________________________
 // If transverse enhancement form factor modification is enabled, we must
@@ -202,8 +225,7 @@ TH1D * EffectiveSF::MakeEffectiveSF(const Target & target) const
   return NULL;
 }
 //____________________________________________________________________________
-// Makes a momentum distribution using the factors below (see reference) and
-// inserts it into the nucleus/momentum distribution map.
+// Makes a momentum distribution using the factors below (see reference).
 //____________________________________________________________________________
 TH1D * EffectiveSF::MakeEffectiveSF(double bs, double bp, double alpha,
                                     double beta, double c1, double c2,
@@ -237,9 +259,6 @@ TH1D * EffectiveSF::MakeEffectiveSF(double bs, double bp, double alpha,
   //-- normalize the probability distribution
   prob->Scale( 1.0 / prob->Integral("width") );
 
-  //-- store
-  fProbDistroMap.insert(
-      map<string, TH1D*>::value_type(target.AsString(),prob));
   return prob;
 }
 //____________________________________________________________________________
@@ -22,9 +22,11 @@
 #define _EFFECTIVE_SF_H_
 
 #include <map>
+#include <utility>
 
 #include <TH1D.h>
 
+#include "Framework/Numerical/AliasTable.h"
 #include "Physics/NuclearState/NuclearModelI.h"
 
 using std::map;
@@ -55,7 +57,15 @@ public:
   void Configure (string param_set);
 
 private:
-  TH1D * ProbDistro (const Target & t) const;
+  // momentum distribution of a target and hit nucleon
+  struct MomentumDistro {
+    TH1D *     fHist;   ///< normalised dP/dp
+    AliasTable fBins;   ///< alias table over the histogram bins
+  };
+  typedef std::pair<int,int> DistroKey_t;  ///< target & hit nucleon pdg codes
+
+  TH1D *                 ProbDistro (const Target & t) const;
+  const MomentumDistro & Distro     (const Target & t) const;
 
   TH1D * MakeEffectiveSF(const Target & target) const;
 
@@ -69,7 +79,7 @@ private:
   double Returnf1p1h(const Target & target) const;
   void   LoadConfig (void);
 
-  mutable map<string, TH1D *> fProbDistroMap;
+  mutable map<DistroKey_t, MomentumDistro> fProbDistroMap;
   double fPMax;
   double fPCutOff;
   bool   fEjectSecondNucleon2p2h;
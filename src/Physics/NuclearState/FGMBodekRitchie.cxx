@@ -15,11 +15,14 @@
    it from being automatically written out at the event file.
  @ Jun 18, 2008 - CA
    Deallocate the momentum distribution histograms map at dtor
+ @ Oct 14, 2026 - CA
+   Draw nucleon momenta from alias tables built with the distributions
 */
 //____________________________________________________________________________
 
 #include <sstream>
 #include <cstdlib>
+#include <vector>
 #include <TMath.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
@@ -54,9 +57,9 @@ NuclearModelI("genie::FGMBodekRitchie", config)
 //____________________________________________________________________________
 FGMBodekRitchie::~FGMBodekRitchie()
 {
-  map<string, TH1D*>::iterator iter = fProbDistroMap.begin();
+  map<DistroKey_t, MomentumDistro>::iterator iter = fProbDistroMap.begin();
   for( ; iter != fProbDistroMap.end(); ++iter) {
-    TH1D * hst = iter->second;
+    TH1D * hst = iter->second.fHist;
     if(hst) {
       delete hst;
       hst=0;
@@ -74,17 +77,22 @@ bool FGMBodekRitchie::GenerateNucleon(const Target & target) const
 
   //-- set fermi momentum vector
   //
-  TH1D * prob = this->ProbDistro(target);
-  if ( ! prob ) {
+  const MomentumDistro & distro = this->Distro(target);
+  if ( ! distro.fHist || distro.fBins.IsEmpty() ) {
     LOG("BodekRitchie", pNOTICE)
               << "Null nucleon momentum probability distribution";
     exit(1);
   }
-  double p = prob->GetRandom();
-  LOG("BodekRitchie", pINFO) << "|p,nucleon| = " << p;
 
+  // pick a bin and a momentum uniformly within the bin, as TH1::GetRandom
   RandomGen * rnd = RandomGen::Instance();
 
+  const TAxis * axis = distro.fHist->GetXaxis();
+  int    bin = 1 + distro.fBins.Sample(rnd->RndGen().Rndm());
+  double p   = axis->GetBinLowEdge(bin) +
+               axis->GetBinWidth(bin) * rnd->RndGen().Rndm();
+  LOG("BodekRitchie", pINFO) << "|p,nucleon| = " << p;
+
   double costheta = -1. + 2. * rnd->RndGen().Rndm();
   double sintheta = TMath::Sqrt(1.-costheta*costheta);
   double fi       = 2 * kPi * rnd->RndGen().Rndm();
@@ -127,9 +135,16 @@ double FGMBodekRitchie::Prob(double mom, double w, const Target & target) const
 }
 //____________________________________________________________________________
 TH1D * FGMBodekRitchie::ProbDistro(const Target & target) const
+{
+  return this->Distro(target).fHist;
+}
+//____________________________________________________________________________
+const FGMBodekRitchie::MomentumDistro &
+                        FGMBodekRitchie::Distro(const Target & target) const
 {
   //-- return stored /if already computed/
-  map<string, TH1D*>::iterator it = fProbDistroMap.find(target.AsString());
+  DistroKey_t key(target.Pdg(), target.HitNucPdg());
+  map<DistroKey_t, MomentumDistro>::const_iterator it = fProbDistroMap.find(key);
   if(it != fProbDistroMap.end()) return it->second;
 
   LOG("BodekRitchie", pNOTICE)
@@ -211,11 +226,15 @@ TH1D * FGMBodekRitchie::ProbDistro(const Target & target) const
   //-- normalize the probability distribution
   prob->Scale( 1.0 / prob->Integral("width") );
 
-  //-- store
-  fProbDistroMap.insert(
-      map<string, TH1D*>::value_type(target.AsString(),prob));
+  //-- build the alias table over the bins & store
+  std::vector<double> weights(npbins);
+  for(int i = 0; i < npbins; i++) weights[i] = prob->GetBinContent(i+1);
+
+  MomentumDistro & distro = fProbDistroMap[key];
+  distro.fHist = prob;
+  distro.fBins.Build(weights);
 
-  return prob;
+  return distro;
 }
 //____________________________________________________________________________
 void FGMBodekRitchie::Configure(const Registry & config)
@@ -6,6 +6,10 @@
 \brief    The Bodek Richie Fermi Gass model. Implements the NuclearModelI 
           interface.
 
+          The nucleon momentum distribution of each target and hit nucleon
+          is computed once, and kept together with an alias table over its
+          bins, so that nucleon momenta are drawn in O(1).
+
 \ref      
 
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
@@ -23,9 +27,11 @@
 #define _FGM_BODEK_RITCHIE_H_
 
 #include <map>
+#include <utility>
 
 #include <TH1D.h>
 
+#include "Framework/Numerical/AliasTable.h"
 #include "Physics/NuclearState/NuclearModelI.h"
 
 using std::map;
@@ -56,10 +62,18 @@ public:
   void Configure (string param_set);
 
 private:
-  void   LoadConfig (void);
-  TH1D * ProbDistro (const Target & t) const;
-
-  mutable map<string, TH1D *> fProbDistroMap;
+  // momentum distribution of a target and hit nucleon
+  struct MomentumDistro {
+    TH1D *     fHist;   ///< normalised dP/dp
+    AliasTable fBins;   ///< alias table over the histogram bins
+  };
+  typedef std::pair<int,int> DistroKey_t;  ///< target & hit nucleon pdg codes
+
+  void                   LoadConfig (void);
+  TH1D *                 ProbDistro (const Target & t) const;
+  const MomentumDistro & Distro     (const Target & t) const;
+
+  mutable map<DistroKey_t, MomentumDistro> fProbDistroMap;
 
   map<int, double> fNucRmvE;
 
@@ -22,5 +22,6 @@
 #pragma link C++ class genie::EffectiveSF;
 #pragma link C++ class genie::FermiMover;
 #pragma link C++ class genie::PauliBlocker;
+#pragma link C++ class genie::NuclearDensityProfile;
 
 #endif
@@ -59,14 +59,8 @@ bool LocalFGM::GenerateNucleon(const Target & target,
 
   //-- set fermi momentum vector
   //
-  TH1D * prob = this->ProbDistro(target,hitNucleonRadius);
-  if(!prob) {
-    LOG("LocalFGM", pNOTICE)
-              << "Null nucleon momentum probability distribution";
-    exit(1);
-  }
-  double p = prob->GetRandom();
-  delete prob;
+  double KF = this->FermiMomentum(target,hitNucleonRadius);
+  double p  = this->GenerateMomentum(KF);
   LOG("LocalFGM", pINFO) << "|p,nucleon| = " << p;
 
   RandomGen * rnd = RandomGen::Instance();
@@ -117,19 +111,7 @@ TH1D * LocalFGM::ProbDistro(const Target & target, double r) const
   LOG("LocalFGM", pNOTICE)
              << ", P(max) = " << fPMax;
 
-  //-- get information for the nuclear target
-  int nucleon_pdgc = target.HitNucPdg();
-  assert(pdg::IsProton(nucleon_pdgc) || pdg::IsNeutron(nucleon_pdgc));
-  int A = target.A();
-
-  assert(target.HitNucIsSet());
-  bool is_p = pdg::IsProton(nucleon_pdgc);
-  double numNuc = (is_p) ? (double)target.Z():(double)target.N();
-
-  // Calculate Fermi Momentum using Local FG equations
-  double hbarc = kLightSpeed*kPlankConstant/genie::units::fermi;
-  double KF= TMath::Power(3*kPi2*numNuc*genie::utils::nuclear::Density(r,A),
-			    1.0/3.0) *hbarc;
+  double KF = this->FermiMomentum(target, r);
 
   LOG("LocalFGM",pNOTICE) << "KF = " << KF;
 
@@ -183,6 +165,52 @@ TH1D * LocalFGM::ProbDistro(const Target & target, double r) const
   return prob;
 }
 //____________________________________________________________________________
+double LocalFGM::FermiMomentum(const Target & target, double r) const
+{
+  //-- get information for the nuclear target
+  int nucleon_pdgc = target.HitNucPdg();
+  assert(pdg::IsProton(nucleon_pdgc) || pdg::IsNeutron(nucleon_pdgc));
+  int A = target.A();
+
+  assert(target.HitNucIsSet());
+  bool is_p = pdg::IsProton(nucleon_pdgc);
+  double numNuc = (is_p) ? (double)target.Z():(double)target.N();
+
+  // Calculate Fermi Momentum using Local FG equations
+  double hbarc = kLightSpeed*kPlankConstant/genie::units::fermi;
+  double KF= TMath::Power(3*kPi2*numNuc*genie::utils::nuclear::Density(r,A),
+			    1.0/3.0) *hbarc;
+  return KF;
+}
+//____________________________________________________________________________
+double LocalFGM::GenerateMomentum(double KF) const
+{
+// Draws p from the distribution tabulated by ProbDistro(): dP/dp ~ p^2 for
+// p <= KF, with weight 1-fSRC_Fraction, and dP/dp ~ 1/p^2 for KF < p < fPCutOff,
+// with weight fSRC_Fraction, both truncated at fPMax and renormalised
+//
+  if(KF <= 0) return 0.;
+
+  RandomGen * rnd = RandomGen::Instance();
+
+  // weights of the Fermi sphere and of the SRC tail within [0, fPMax]
+  double pcore = TMath::Min(KF, fPMax);
+  double wcore = (1. - fSRC_Fraction) * TMath::Power(pcore/KF, 3.);
+  double wtail = 0.;
+  double ptail = TMath::Min(fPCutOff, fPMax);
+  if(KF < ptail) {
+    wtail = fSRC_Fraction * (1./KF - 1./ptail) / (1./KF - 1./fPCutOff);
+  }
+  if(wcore + wtail <= 0) return 0.;
+
+  double u = rnd->RndGen().Rndm();
+  if(u * (wcore + wtail) < wcore) {
+    return pcore * TMath::Power(rnd->RndGen().Rndm(), 1./3.);
+  }
+  double v = rnd->RndGen().Rndm();
+  return 1. / ( 1./KF - v * (1./KF - 1./ptail) );
+}
+//____________________________________________________________________________
 void LocalFGM::Configure(const Registry & config)
 {
   Algorithm::Configure(config);
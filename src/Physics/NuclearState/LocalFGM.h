@@ -6,6 +6,11 @@
 \brief    local Fermi gas model. Implements the NuclearModelI 
           interface.
 
+          Nucleon momenta are drawn by inverting the cumulative momentum
+          distribution analytically (a uniform Fermi sphere and, if an SRC
+          fraction is set, a 1/p^4 tail up to the cut-off), so that a draw
+          at any radius is O(1) and allocation-free.
+
 \ref      
 
 \author   Joe Johnston, Steven Dytman
@@ -64,8 +69,10 @@ public:
   void Configure (string param_set)
 ;
 private:
-  void   LoadConfig (void);
-  TH1D * ProbDistro (const Target & t, double r) const;
+  void   LoadConfig     (void);
+  TH1D * ProbDistro     (const Target & t, double r) const;
+  double FermiMomentum  (const Target & t, double r) const;
+  double GenerateMomentum (double KF) const;
 
   map<int, double> fNucRmvE;
 
@@ -0,0 +1,124 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include <TMath.h>
+
+#include "Framework/Conventions/Constants.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Physics/NuclearState/NuclearDensityProfile.h"
+
+using namespace genie;
+using namespace genie::constants;
+
+namespace {
+  const int kNIntegralBins = 1000;
+
+  std::mutex gProfileMutex;
+  std::map<int, std::unique_ptr<NuclearDensityProfile> > gProfiles;
+}
+
+//____________________________________________________________________________
+const NuclearDensityProfile * NuclearDensityProfile::Instance(int A)
+{
+  // most callers ask for the same nucleus over and over
+  thread_local const NuclearDensityProfile * last = 0;
+  if(last && last->A() == A) return last;
+
+  std::lock_guard<std::mutex> lock(gProfileMutex);
+  std::unique_ptr<NuclearDensityProfile> & profile = gProfiles[A];
+  if(!profile) profile.reset(new NuclearDensityProfile(A));
+  last = profile.get();
+  return last;
+}
+//____________________________________________________________________________
+NuclearDensityProfile::NuclearDensityProfile(int A) :
+fA   (A),
+fC   (1.),
+fZ   (1.),
+fAp  (1.),
+fAlf (1.),
+fNorm(0.)
+{
+// [by S.Dytman] - the parameters used to be resolved in utils::nuclear::Density()
+//
+  fWoodsSaxon = (A > 20);
+
+  if(fWoodsSaxon) {
+    if      (A ==  27) { fC = 3.07; fZ = 0.52; }  // aluminum
+    else if (A ==  28) { fC = 3.07; fZ = 0.54; }  // silicon
+    else if (A ==  40) { fC = 3.53; fZ = 0.54; }  // argon
+    else if (A ==  56) { fC = 4.10; fZ = 0.56; }  // iron
+    else if (A == 208) { fC = 6.62; fZ = 0.55; }  // lead
+    else {
+       fC = TMath::Power(A,0.35); fZ = 0.54;
+    } //others
+    fNorm = (3./(4.*kPi*TMath::Power(fC,3)))*1./(1.+TMath::Power((kPi*fZ/fC),2));
+  }
+  else {
+    if (A > 4) {
+      if      (A ==  7) { fAp = 1.77; fAlf = 0.327; } // lithium
+      else if (A == 12) { fAp = 1.69; fAlf = 1.08;  } // carbon
+      else if (A == 14) { fAp = 1.76; fAlf = 1.23;  } // nitrogen
+      else if (A == 16) { fAp = 1.83; fAlf = 1.54;  } // oxygen
+      else  {
+        fAp=1.75; fAlf=-0.4+.12*A;
+      }  //others- alf=0.08 if A=4
+    }
+    else {
+      // helium
+      fAp  = 1.9/TMath::Sqrt(2.);
+      fAlf = 0.;
+    }
+    fNorm = 1./((5.568 + fAlf*8.353)*TMath::Power(fAp,3.));
+  }
+
+  // tabulate the fraction of nucleons within r (trapezoidal integration), up
+  // to where the density is negligible
+  fRMax = fWoodsSaxon ? (fC + 20.*fZ) : 6.*fAp;
+  fDr   = fRMax / kNIntegralBins;
+  fIntegral.resize(kNIntegralBins+1);
+  fIntegral[0] = 0.;
+  double yprev = 0.;
+  for(int i = 1; i <= kNIntegralBins; i++) {
+    double r = i*fDr;
+    double y = 4.*kPi * r*r * this->Density(r);
+    fIntegral[i] = fIntegral[i-1] + 0.5*(y + yprev)*fDr;
+    yprev = y;
+  }
+
+  LOG("Nuclear", pINFO)
+     << "Density profile for A = " << A << ": "
+     << (fWoodsSaxon ? "Woods-Saxon, c = " : "harmonic oscillator, a = ")
+     << (fWoodsSaxon ? fC : fAp)
+     << (fWoodsSaxon ? ", z = " : ", alpha = ") << (fWoodsSaxon ? fZ : fAlf)
+     << ", norm = " << fNorm << " (integral up to " << fRMax << " fm = "
+     << fIntegral[kNIntegralBins] << ")";
+}
+//____________________________________________________________________________
+NuclearDensityProfile::~NuclearDensityProfile()
+{
+
+}
+//____________________________________________________________________________
+double NuclearDensityProfile::IntegratedDensity(double r) const
+{
+  if(r <= 0.)    return 0.;
+  if(r >= fRMax) return fIntegral[kNIntegralBins];
+
+  double x = r / fDr;
+  int    i = TMath::Min((int) x, kNIntegralBins-1);
+  double f = x - i;
+  return (1.-f) * fIntegral[i] + f * fIntegral[i+1];
+}
+//____________________________________________________________________________
@@ -0,0 +1,86 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::NuclearDensityProfile
+
+\brief    The nuclear density profile used by utils::nuclear::Density(),
+          resolved once for each mass number A.
+
+          The parameters of the Woods-Saxon (A > 20) or modified harmonic
+          oscillator (A <= 20) profile and their normalization are worked out
+          when the profile is built, so Density() only evaluates the profile
+          at the input radius. The fraction of nucleons within a radius is
+          tabulated as well (IntegratedDensity()).
+
+          Profiles are immutable and shared by all threads: Instance(A) returns
+          a pointer that callers (eg the INTRANUKE stepping or the vertex
+          generators) may hold on to.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _NUCLEAR_DENSITY_PROFILE_H_
+#define _NUCLEAR_DENSITY_PROFILE_H_
+
+#include <cmath>
+#include <algorithm>
+#include <vector>
+
+using std::vector;
+
+namespace genie {
+
+class NuclearDensityProfile {
+
+public:
+  //! The density profile of nuclei with mass number A
+  static const NuclearDensityProfile * Instance(int A);
+
+  NuclearDensityProfile(int A);
+ ~NuclearDensityProfile();
+
+  int    A            (void) const { return fA;           }
+  bool   IsWoodsSaxon (void) const { return fWoodsSaxon;  }
+  double RMax         (void) const { return fRMax;        } ///< range of the tabulation [fm]
+
+  //! Nuclear density [fm^-3], normalized to 1, at radius r [fm] for a nucleus
+  //! made larger by ring [fm] (see utils::nuclear::Density())
+  double Density (double r, double ring = 0.) const
+  {
+    if(fWoodsSaxon) {
+      double ceval = fC + std::min(ring, 0.75*fC);
+      return fNorm / (1. + std::exp((r-ceval)/fZ));
+    }
+    double aeval = fAp + std::min(ring, 0.3*fAp);
+    double b     = (r/aeval) * (r/aeval);
+    return fNorm * (1. + fAlf*b) * std::exp(-b);
+  }
+
+  //! Fraction of nucleons within radius r [fm] (ring = 0), interpolated
+  //! from the tabulated integral of 4 pi r^2 rho(r)
+  double IntegratedDensity (double r) const;
+
+private:
+  int    fA;
+  bool   fWoodsSaxon;   ///< Woods-Saxon or modified harmonic oscillator profile?
+  double fC;            ///< Woods-Saxon radius [fm]
+  double fZ;            ///< Woods-Saxon diffuseness [fm]
+  double fAp;           ///< harmonic oscillator size parameter [fm]
+  double fAlf;          ///< harmonic oscillator alpha parameter
+  double fNorm;         ///< normalization [fm^-3]
+
+  double         fRMax; ///< range of the tabulated integral [fm]
+  double         fDr;   ///< radial step of the tabulated integral [fm]
+  vector<double> fIntegral;
+};
+
+}      // genie namespace
+
+#endif // _NUCLEAR_DENSITY_PROFILE_H_
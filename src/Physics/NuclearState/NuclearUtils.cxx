@@ -38,8 +38,7 @@
 
 #include <TMath.h>
 
-#include "Framework/Algorithm/AlgFactory.h"
-#include "Framework/Algorithm/AlgConfigPool.h"
+#include "Framework/Algorithm/AlgHandle.h"
 #include "Framework/Conventions/Constants.h"
 #include "Framework/Conventions/Units.h"
 #include "Framework/Interaction/Interaction.h"
@@ -47,6 +46,7 @@
 #include "Physics/NuclearState/FermiMomentumTablePool.h"
 #include "Physics/NuclearState/FermiMomentumTable.h"
 #include "Physics/NuclearState/NuclearData.h"
+#include "Physics/NuclearState/NuclearDensityProfile.h"
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Physics/NuclearState/NuclearUtils.h"
 #include "Physics/NuclearState/NuclearModelI.h"
@@ -161,15 +161,11 @@ double genie::utils::nuclear::NuclQELXSecSuppression(
   }
 
   // Check if an LFG model should be used for Fermi momentum
-  // Create a nuclear model object to check the model type
-  AlgConfigPool * confp = AlgConfigPool::Instance();
-  const Registry * gc = confp->GlobalParameterList();
-  RgKey nuclkey = "NuclearModel";
-  RgAlg nuclalg = gc->GetAlg(nuclkey);
-  AlgFactory * algf = AlgFactory::Instance();
+  // Get the nuclear model object to check the model type
+  // (resolved once per configuration)
+  static thread_local AlgHandle<NuclearModelI> nuclmodel_handle;
   const genie::NuclearModelI* nuclModel =
-    dynamic_cast<const genie::NuclearModelI*>(
-			     algf->GetAlgorithm(nuclalg.name,nuclalg.config));
+    nuclmodel_handle.FromGlobalParameterList("NuclearModel");
   // Check if the model is a local Fermi gas
   bool lfg = (nuclModel && nuclModel->ModelType(Target()) == kNucmLocalFermiGas);
 
@@ -388,46 +384,10 @@ double genie::utils::nuclear::Density(double r, int A, double ring)
 {
 // [by S.Dytman]
 //
-  if(A>20) {
-    double c = 1., z = 1.;
-
-    if      (A ==  27) { c = 3.07; z = 0.52; }  // aluminum
-    else if (A ==  28) { c = 3.07; z = 0.54; }  // silicon
-    else if (A ==  40) { c = 3.53; z = 0.54; }  // argon
-    else if (A ==  56) { c = 4.10; z = 0.56; }  // iron
-    else if (A == 208) { c = 6.62; z = 0.55; }  // lead
-    else { 
-       c = TMath::Power(A,0.35); z = 0.54; 
-    } //others
-
-    LOG("Nuclear",pINFO)
-	<< "r= " << r << ", ring= " << ring;
-    double rho = DensityWoodsSaxon(r,c,z,ring);
-    return rho;
-  }
-  else if (A>4) {
-    double ap = 1., alf = 1.;
-
-    if      (A ==  7) { ap = 1.77; alf = 0.327; } // lithium
-    else if (A == 12) { ap = 1.69; alf = 1.08;  } // carbon
-    else if (A == 14) { ap = 1.76; alf = 1.23;  } // nitrogen
-    else if (A == 16) { ap = 1.83; alf = 1.54;  } // oxygen
-    else  { 
-      ap=1.75; alf=-0.4+.12*A; 
-    }  //others- alf=0.08 if A=4
-
-    double rho = DensityGaus(r,ap,alf,ring);
-    return rho;
-  }
-  else {
-    // helium
-    double ap = 1.9/TMath::Sqrt(2.);  
-    double alf=0.;    
-    double rho = DensityGaus(r,ap,alf,ring);
-    return rho;
-  }
+// Woods-Saxon (A > 20) or modified harmonic oscillator density, with the
+// parameters for each A resolved once (see NuclearDensityProfile)
 
-  return 0;
+  return NuclearDensityProfile::Instance(A)->Density(r, ring);
 }
 //___________________________________________________________________________
 double genie::utils::nuclear::DensityGaus(
@@ -37,20 +37,37 @@
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/ParticleData/PDGCodes.h"
+#include "Physics/NuclearState/NuclearDensityProfile.h"
 #include "Physics/NuclearState/NuclearUtils.h"
 
 using namespace genie;
 using namespace genie::constants;
 
+namespace {
+  // radial grid of the LFG Fermi momentum tables: kNKFBins bins up to
+  // kKFRMax nuclear radii; the density is negligible beyond that
+  const int    kNKFBins = 2000;
+  const double kKFRMax  = 3.;
+}
 //___________________________________________________________________________
 PauliBlocker::PauliBlocker() :
-EventRecordVisitorI("genie::PauliBlocker")
+EventRecordVisitorI("genie::PauliBlocker"),
+fLastLFGKey(-1),
+fLastLFGKF(0),
+fLastTgtPdg(0),
+fLastNucPdg(0),
+fLastKF(0)
 {
 
 }
 //___________________________________________________________________________
 PauliBlocker::PauliBlocker(string config) :
-EventRecordVisitorI("genie::PauliBlocker",  config)
+EventRecordVisitorI("genie::PauliBlocker",  config),
+fLastLFGKey(-1),
+fLastLFGKF(0),
+fLastTgtPdg(0),
+fLastNucPdg(0),
+fLastKF(0)
 {
 
 }
@@ -153,6 +170,13 @@ void PauliBlocker::LoadModelType(void){
   // Check if the model is a local Fermi gas
   fLFG = (nuclModel && nuclModel->ModelType(Target()) == kNucmLocalFermiGas);
 
+  // forget the Fermi momenta computed for the previous configuration
+  fLFGKF.clear();
+  fLastLFGKey = -1;
+  fLastLFGKF  = 0;
+  fLastTgtPdg = 0;
+  fLastNucPdg = 0;
+
   if ( !fLFG ) {
     // get the Fermi momentum table for relativistic Fermi gas
 	GetParam( "FermiMomentumTable", fKFTableName ) ;
@@ -175,13 +199,56 @@ double PauliBlocker::GetFermiMomentum(const Target& tgt, int pdg_Nf,
     int A = tgt.A();
     bool is_p = pdg::IsProton( pdg_Nf );
     int numNuc = (is_p) ? tgt.Z() : tgt.N();
-    double hbarc = kLightSpeed * kPlankConstant / units::fermi;
-    kF = TMath::Power(3 * kPi2 * numNuc *
-      genie::utils::nuclear::Density(radius, A), 1.0/3.0) * hbarc;
+
+    // interpolate in the kF(r) table of this target & nucleon type
+    int key = 1000*A + numNuc;
+    if ( key != fLastLFGKey ) {
+      fLastLFGKF  = &this->LFGFermiMomentumTable(A, numNuc);
+      fLastLFGKey = key;
+    }
+    const std::vector<double> & kFr = *fLastLFGKF;
+    double rmax = kKFRMax * utils::nuclear::Radius(A);
+    double x = radius / rmax * kNKFBins;
+    if ( x < kNKFBins ) {
+      int    i = (int) x;
+      double f = x - i;
+      kF = (1-f) * kFr[i] + f * kFr[i+1];
+    }
+    else {
+      double hbarc = kLightSpeed * kPlankConstant / units::fermi;
+      kF = TMath::Power(3 * kPi2 * numNuc *
+        genie::utils::nuclear::Density(radius, A), 1.0/3.0) * hbarc;
+    }
   }
   else {
-    kF = fKFTable->FindClosestKF(tgt.Pdg(), pdg_Nf);
+    if ( tgt.Pdg() != fLastTgtPdg || pdg_Nf != fLastNucPdg ) {
+      fLastKF     = fKFTable->FindClosestKF(tgt.Pdg(), pdg_Nf);
+      fLastTgtPdg = tgt.Pdg();
+      fLastNucPdg = pdg_Nf;
+    }
+    kF = fLastKF;
   }
 
   return kF;
 }
+//___________________________________________________________________________
+const std::vector<double> & PauliBlocker::LFGFermiMomentumTable(
+  int A, int numNuc) const
+{
+  int key = 1000*A + numNuc;
+  std::map<int, std::vector<double> >::const_iterator it = fLFGKF.find(key);
+  if ( it != fLFGKF.end() ) return it->second;
+
+  double hbarc = kLightSpeed * kPlankConstant / units::fermi;
+  double rmax  = kKFRMax * utils::nuclear::Radius(A);
+
+  const NuclearDensityProfile * density = NuclearDensityProfile::Instance(A);
+
+  std::vector<double> & kFr = fLFGKF[key];
+  kFr.resize(kNKFBins+1);
+  for ( int i = 0; i <= kNKFBins; i++ ) {
+    double r = rmax * i / kNKFBins;
+    kFr[i] = TMath::Power(3 * kPi2 * numNuc * density->Density(r), 1.0/3.0) * hbarc;
+  }
+  return kFr;
+}
@@ -26,6 +26,9 @@
 #ifndef _PAULI_BLOCKER_H_
 #define _PAULI_BLOCKER_H_
 
+#include <map>
+#include <vector>
+
 #include "Framework/EventGen/EventRecordVisitorI.h"
 #include "Framework/Interaction/Target.h"
 
@@ -55,9 +58,22 @@ public :
 private:
    void LoadModelType(void);
 
+   /// LFG Fermi momentum on a radial grid, for the input A and number of
+   /// nucleons of the struck nucleon type
+   const std::vector<double> & LFGFermiMomentumTable(int A, int numNuc) const;
+
    bool fLFG;
    const FermiMomentumTable * fKFTable;
    string fKFTableName;
+
+   // Fermi momenta of the last few targets, so that the per event call of
+   // GetFermiMomentum() needs no density evaluation or table name lookup
+   mutable std::map<int, std::vector<double> > fLFGKF;  ///< kF(r) keyed on 1000*A + numNuc
+   mutable int                         fLastLFGKey;     ///< key of the last used kF(r) table
+   mutable const std::vector<double> * fLastLFGKF;      ///< last used kF(r) table
+   mutable int                         fLastTgtPdg;     ///< target of the last RFG kF
+   mutable int                         fLastNucPdg;     ///< nucleon of the last RFG kF
+   mutable double                      fLastKF;         ///< last RFG kF
 };
 
 }      // genie namespace
@@ -15,10 +15,14 @@
 */
 //____________________________________________________________________________
 
+#include <cmath>
+#include <sstream>
+
 #include <TSystem.h>
 #include <TNtupleD.h>
 #include <TGraph2D.h>
 
+#include "Framework/Algorithm/AlgSharedData.h"
 #include "Framework/Conventions/Constants.h"
 #include "Framework/Conventions/Controls.h"
 #include "Framework/Conventions/Units.h"
@@ -31,19 +35,23 @@ using namespace genie;
 using namespace genie::constants;
 using namespace genie::controls;
 
+using std::ostringstream;
+
 //____________________________________________________________________________
 SpectralFunc::SpectralFunc() :
 NuclearModelI("genie::SpectralFunc")
 {
-  fSfFe56 = 0;
-  fSfC12  = 0;
+  fSfFe56  = 0;
+  fSfC12   = 0;
+  fUseGrid = false;
 }
 //____________________________________________________________________________
 SpectralFunc::SpectralFunc(string config) :
 NuclearModelI("genie::SpectralFunc", config)
 {
-  fSfFe56 = 0;
-  fSfC12  = 0;
+  fSfFe56  = 0;
+  fSfC12   = 0;
+  fUseGrid = false;
 }
 //____________________________________________________________________________
 SpectralFunc::~SpectralFunc()
@@ -54,6 +62,31 @@ SpectralFunc::~SpectralFunc()
 //____________________________________________________________________________
 bool SpectralFunc::GenerateNucleon(const Target & target) const
 {
+  RandomGen * rnd = RandomGen::Instance();
+
+  if(fUseGrid) {
+    const Grid * grid = this->SelectGrid(target);
+    if(!grid) {
+      fCurrRemovalEnergy = 0.;
+      fCurrMomentum.SetXYZ(0.,0.,0.);
+      return false;
+    }
+    double kc = 0, wc = 0;
+    grid->Generate(kc, wc);
+
+    LOG("SpectralFunc", pINFO) << "|p,nucleon| = " << kc; 
+    LOG("SpectralFunc", pINFO) << "|w,nucleon| = " << wc;
+
+    double costheta = -1. + 2. * rnd->RndGen().Rndm();
+    double sintheta = TMath::Sqrt(1.-costheta*costheta);
+    double fi       = 2 * kPi * rnd->RndGen().Rndm();
+
+    fCurrRemovalEnergy = wc;
+    fCurrMomentum.SetXYZ(kc*sintheta*TMath::Cos(fi),
+                         kc*sintheta*TMath::Sin(fi), kc*costheta);
+    return true;
+  }
+
   TGraph2D * sf = this->SelectSpectralFunction(target);
 
   if(!sf) {
@@ -75,8 +108,6 @@ bool SpectralFunc::GenerateNucleon(const Target & target) const
   LOG("SpectralFunc", pINFO) << "Momentum range = ["   << kmin << ", " << kmax << "]"; 
   LOG("SpectralFunc", pINFO) << "Rmv energy range = [" << wmin << ", " << wmax << "]";
 
-  RandomGen * rnd = RandomGen::Instance();
-
   unsigned int niter = 0;
   while(1) {
     if(niter > kRjMaxIterations) {
@@ -123,6 +154,11 @@ bool SpectralFunc::GenerateNucleon(const Target & target) const
 double SpectralFunc::Prob(
                          double p, double w, const Target & target) const
 {
+  if(fUseGrid) {
+    const Grid * grid = this->SelectGrid(target);
+    return (grid ? grid->Prob(p,w) : 0.);
+  }
+
   TGraph2D * sf = this->SelectSpectralFunction(target);
   if(!sf) return 0;
 
@@ -143,31 +179,71 @@ void SpectralFunc::Configure(string param_set)
 //____________________________________________________________________________
 void SpectralFunc::LoadConfig(void)
 {
-  LOG("SpectralFunc", pDEBUG) << "Loading Benhar et al. spectral functions";
-
   string data_dir =
         string(gSystem->Getenv("GENIE")) + 
         string("/data/evgen/nucl/spectral_functions/");
+
   string c12file  = data_dir + "benhar-sf-12c.data";
   string fe56file = data_dir + "benhar-sf-56fe.data";
 
-  TNtupleD sfdata_fe56("sfdata_fe56","","k:e:prob");
-  TNtupleD sfdata_c12 ("sfdata_c12", "","k:e:prob");
+  GetParamDef( "UseRegularGrid", fUseGrid, false );
+
+  // no need to re-read the data at a reconfiguration, unless they moved
+  bool reload = this->DataSourceChanged("SpectralFunctions", data_dir) ||
+                !fSfFe56 || !fSfC12;
+
+  if(reload) {
+    LOG("SpectralFunc", pDEBUG) << "Loading Benhar et al. spectral functions";
 
-  sfdata_fe56.ReadFile ( fe56file.c_str() );
-  sfdata_c12. ReadFile ( c12file.c_str () );
+    TNtupleD sfdata_fe56("sfdata_fe56","","k:e:prob");
+    TNtupleD sfdata_c12 ("sfdata_c12", "","k:e:prob");
 
-  LOG("SpectralFunc", pDEBUG) << "Loaded " << sfdata_fe56.GetEntries() << " Fe56 points";
-  LOG("SpectralFunc", pDEBUG) << "Loaded " << sfdata_c12.GetEntries()  << " C12 points";
+    sfdata_fe56.ReadFile ( fe56file.c_str() );
+    sfdata_c12. ReadFile ( c12file.c_str () );
 
-  if (fSfFe56) delete fSfFe56;
-  if (fSfC12 ) delete fSfC12;
+    LOG("SpectralFunc", pDEBUG) << "Loaded " << sfdata_fe56.GetEntries() << " Fe56 points";
+    LOG("SpectralFunc", pDEBUG) << "Loaded " << sfdata_c12.GetEntries()  << " C12 points";
 
-  fSfFe56 = this->Convert2Graph(sfdata_fe56);
-  fSfC12  = this->Convert2Graph(sfdata_c12);
+    if (fSfFe56) delete fSfFe56;
+    if (fSfC12 ) delete fSfC12;
 
-  fSfFe56->SetName("sf_fe56");
-  fSfC12 ->SetName("sf_c12");
+    fSfFe56 = this->Convert2Graph(sfdata_fe56);
+    fSfC12  = this->Convert2Graph(sfdata_c12);
+
+    fSfFe56->SetName("sf_fe56");
+    fSfC12 ->SetName("sf_c12");
+  }
+
+  fGridFe56.reset();
+  fGridC12 .reset();
+  if(!fUseGrid) return;
+
+  int np, nw;
+  GetParamDef( "RegularGrid-NP", np,  80 );
+  GetParamDef( "RegularGrid-NW", nw, 160 );
+  if(np < 2 || nw < 2) {
+    LOG("SpectralFunc", pFATAL)
+      << "Invalid spectral function grid: " << np << " x " << nw << " nodes";
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  // the grids depend only on the data files and on the number of nodes
+  ostringstream grid;
+  grid << "/" << np << "," << nw;
+
+  if(reload) {
+    AlgSharedData::Instance()->Release("SpectralFunc/" + fe56file + grid.str());
+    AlgSharedData::Instance()->Release("SpectralFunc/" + c12file  + grid.str());
+  }
+  const TGraph2D * sf_fe56 = fSfFe56;
+  const TGraph2D * sf_c12  = fSfC12;
+  fGridFe56 = AlgSharedData::Instance()->Get<Grid>(
+      "SpectralFunc/" + fe56file + grid.str(),
+      [sf_fe56, np, nw] () { return SpectralFunc::BuildGrid(sf_fe56, np, nw); });
+  fGridC12  = AlgSharedData::Instance()->Get<Grid>(
+      "SpectralFunc/" + c12file + grid.str(),
+      [sf_c12,  np, nw] () { return SpectralFunc::BuildGrid(sf_c12,  np, nw); });
 }
 //____________________________________________________________________________
 TGraph2D * SpectralFunc::Convert2Graph(TNtupleD & sfdata) const
@@ -207,3 +283,106 @@ TGraph2D * SpectralFunc::SelectSpectralFunction(const Target & t) const
   return sf;
 }
 //____________________________________________________________________________
+const SpectralFunc::Grid * SpectralFunc::SelectGrid(const Target & t) const
+{
+  int pdgc = t.Pdg();
+
+  if      (pdgc == kPdgTgtC12)  return fGridC12.get();
+  else if (pdgc == kPdgTgtFe56) return fGridFe56.get();
+
+  LOG("SpectralFunc", pERROR) 
+     << "** The spectral function for target " << pdgc << " isn't available";
+  return 0;
+}
+//____________________________________________________________________________
+SpectralFunc::Grid * SpectralFunc::BuildGrid(
+                                   const TGraph2D * sf, int np, int nw)
+{
+  LOG("SpectralFunc", pNOTICE)
+    << "Resampling spectral function " << sf->GetName() << " on a "
+    << np << " x " << nw << " (p,w) grid";
+
+  TGraph2D & graph = const_cast<TGraph2D &> (*sf);
+
+  Grid * g = new Grid;
+  g->fNP   = np;
+  g->fNW   = nw;
+  g->fPMin = graph.GetXmin();
+  g->fDP   = (graph.GetXmax() - g->fPMin) / (np-1);
+  g->fWMin = graph.GetYmin();
+  g->fDW   = (graph.GetYmax() - g->fWMin) / (nw-1);
+
+  g->fProb.resize(np*nw);
+  for(int ip = 0; ip < np; ip++) {
+    double p = g->fPMin + ip * g->fDP;
+    for(int iw = 0; iw < nw; iw++) {
+      double w = g->fWMin + iw * g->fDW;
+      g->fProb[ip*nw+iw] = TMath::Max(0., graph.Interpolate(p,w));
+    }
+  }
+
+  // the probability of a cell is the mean of its corners
+  int ncp = np-1, ncw = nw-1, nc = ncp*ncw;
+  std::vector<double> weight(nc);
+  g->fCellMax.resize(nc);
+  for(int ip = 0; ip < ncp; ip++) {
+    for(int iw = 0; iw < ncw; iw++) {
+      const double * f = &g->fProb[ip*nw+iw];
+      double f00 = f[0], f01 = f[1], f10 = f[nw], f11 = f[nw+1];
+      int ic = ip*ncw+iw;
+      weight[ic] = f00 + f01 + f10 + f11;
+      g->fCellMax[ic] = TMath::Max( TMath::Max(f00,f01), TMath::Max(f10,f11) );
+    }
+  }
+  if(!g->fCells.Build(weight)) {
+    LOG("SpectralFunc", pFATAL)
+      << "Null spectral function " << sf->GetName();
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  return g;
+}
+//____________________________________________________________________________
+double SpectralFunc::Grid::Prob(double p, double w) const
+{
+  double tp = (p - fPMin) / fDP;
+  double tw = (w - fWMin) / fDW;
+  if(tp < 0 || tw < 0 || tp > fNP-1 || tw > fNW-1) return 0;
+
+  int ip = TMath::Min( (int) tp, fNP-2 );
+  int iw = TMath::Min( (int) tw, fNW-2 );
+  tp -= ip;
+  tw -= iw;
+
+  const double * f = &fProb[ip*fNW+iw];
+  return (1-tp) * ( (1-tw) * f[0]   + tw * f[1]     ) +
+            tp  * ( (1-tw) * f[fNW] + tw * f[fNW+1] );
+}
+//____________________________________________________________________________
+void SpectralFunc::Grid::Generate(double & p, double & w) const
+{
+  TRandom3 & rnd = RandomGen::Instance()->RndGen();
+
+  // pick a cell from the alias table
+  int ic = fCells.Sample(rnd.Rndm());
+
+  int ip = ic / (fNW-1);
+  int iw = ic % (fNW-1);
+
+  // pick a point from the bilinear density within the cell; the acceptance
+  // is at least 1/4, as the cell max is at most 4 times its mean
+  const double * f = &fProb[ip*fNW+iw];
+  double fmax = fCellMax[ic];
+  double tp, tw;
+  do {
+    tp = rnd.Rndm();
+    tw = rnd.Rndm();
+  } while( fmax * rnd.Rndm() >
+           (1-tp) * ( (1-tw) * f[0]   + tw * f[1]     ) +
+              tp  * ( (1-tw) * f[fNW] + tw * f[fNW+1] ) );
+
+  p = fPMin + (ip + tp) * fDP;
+  w = fWMin + (iw + tw) * fDW;
+}
+//____________________________________________________________________________
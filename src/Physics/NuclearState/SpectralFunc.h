@@ -6,6 +6,14 @@
 \brief    A realistic spectral function - based nuclear model.
           Is a concrete implementation of the NuclearModelI interface.
 
+          With the UseRegularGrid option, the input spectral functions are
+          resampled at configuration onto a regular (p, w) grid, shared by
+          the instances of all threads. Prob() is then a bilinear grid
+          interpolation, and GenerateNucleon() picks a grid cell from an
+          alias table and the (p, w) point within the cell from the bilinear
+          density, rather than looking up the Delaunay triangulation of the
+          input points at every accept/reject trial.
+
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -21,6 +29,10 @@
 #ifndef _SPECTRAL_FUNCTION_H_
 #define _SPECTRAL_FUNCTION_H_
 
+#include <memory>
+#include <vector>
+
+#include "Framework/Numerical/AliasTable.h"
 #include "Physics/NuclearState/NuclearModelI.h"
 
 class TNtupleD;
@@ -52,12 +64,33 @@ public:
   void Configure (string config);
 
 private:
+
+  // spectral function resampled on a regular grid, read-only once built
+  struct Grid {
+    int    fNP;                       ///< number of momentum nodes
+    int    fNW;                       ///< number of removal energy nodes
+    double fPMin, fDP;                ///< momentum of the first node, node spacing
+    double fWMin, fDW;                ///< removal energy of the first node, node spacing
+    std::vector<double> fProb;        ///< probability at node (ip,iw) in [ip*fNW+iw]
+    std::vector<double> fCellMax;     ///< max probability at the corners of each cell
+    AliasTable          fCells;       ///< cell (ip,iw) as outcome ip*(fNW-1)+iw
+
+    double Prob     (double p, double w) const;
+    void   Generate (double & p, double & w) const;
+  };
+
   void       LoadConfig             (void);
   TGraph2D * Convert2Graph          (TNtupleD & data) const;
   TGraph2D * SelectSpectralFunction (const Target & target) const; 
+  const Grid * SelectGrid           (const Target & target) const;
+  static Grid * BuildGrid           (const TGraph2D * sf, int np, int nw);
 
   TGraph2D * fSfFe56;   ///< Benhar's Fe56 SF
   TGraph2D * fSfC12;    ///< Benhar's C12 SF
+
+  bool                        fUseGrid;    ///< use the regular grid SFs below?
+  std::shared_ptr<const Grid> fGridFe56;   ///< Benhar's Fe56 SF on a regular grid
+  std::shared_ptr<const Grid> fGridC12;    ///< Benhar's C12 SF on a regular grid
 };
 
 }      // genie namespace
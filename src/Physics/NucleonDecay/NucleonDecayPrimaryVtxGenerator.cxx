@@ -22,6 +22,7 @@
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Physics/NuclearState/NuclearDensityProfile.h"
 #include "Physics/NuclearState/NuclearUtils.h"
 #include "Physics/NucleonDecay/NucleonDecayPrimaryVtxGenerator.h"
 #include "Physics/NucleonDecay/NucleonDecayUtils.h"
@@ -172,14 +173,18 @@ void NucleonDecayPrimaryVtxGenerator::GenerateDecayedNucleonPosition(
   LOG("NucleonDecay", pINFO)
       << "Generating vertex according to a realistic nuclear density profile";
 
-  // get inputs to the rejection method
-  double ymax = -1;
+  const NuclearDensityProfile * density = NuclearDensityProfile::Instance(A);
+
+  // get inputs to the rejection method (scanned once for each nucleus)
   double rmax = 3*R;
-  double dr   = R/40.;
-  for(double r = 0; r < rmax; r+=dr) {
-      ymax = TMath::Max(ymax, r*r * utils::nuclear::Density(r,A));
+  double & ymax = fDensityMax[A];
+  if(ymax <= 0) {
+    double dr = R/40.;
+    for(double r = 0; r < rmax; r+=dr) {
+        ymax = TMath::Max(ymax, r*r * density->Density(r));
+    }
+    ymax *= 1.2;
   }
-  ymax *= 1.2;
 
   // select a vertex using the rejection method
   TLorentzVector vtx(0,0,0,0);
@@ -199,7 +204,7 @@ void NucleonDecayPrimaryVtxGenerator::GenerateDecayedNucleonPosition(
 
     double r = rmax * rnd->RndFsi().Rndm();
     double t = ymax * rnd->RndFsi().Rndm();
-    double y = r*r * utils::nuclear::Density(r,A);
+    double y = r*r * density->Density(r);
     if(y > ymax) {
        LOG("NucleonDecay", pERROR)
           << "y = " << y << " > ymax = " << ymax << " for r = " << r << ", A = " << A;
@@ -271,27 +276,15 @@ void NucleonDecayPrimaryVtxGenerator::GenerateDecayProducts(
 {
   LOG("NucleonDecay", pINFO) << "Generating decay...";
 
-  PDGCodeList pdgv = utils::nucleon_decay::DecayProductList(fCurrDecayMode, fCurrDecayedNucleon);
+  const DecayChannel & channel = this->Channel(fCurrDecayMode, fCurrDecayedNucleon);
+  const PDGCodeList & pdgv = channel.fPdgCodes;
   LOG("NucleonDecay", pINFO) << "Decay product IDs: " << pdgv;
   assert ( pdgv.size() >  1);
 
   LOG("NucleonDecay", pINFO) << "Performing a phase space decay...";
-
-  // Get the decay product masses
-
-  vector<int>::const_iterator pdg_iter;
-  int i = 0;
-  double * mass = new double[pdgv.size()];
-  double   sum  = 0;
-  for(pdg_iter = pdgv.begin(); pdg_iter != pdgv.end(); ++pdg_iter) {
-    int pdgc = *pdg_iter;
-    double m = PDGLibrary::Instance()->Find(pdgc)->Mass();
-    mass[i++] = m;
-    sum += m;
-  }
-
   LOG("NucleonDecay", pINFO)
-    << "Decaying N = " << pdgv.size() << " particles / total mass = " << sum;
+    << "Decaying N = " << pdgv.size() << " particles / total mass = "
+    << channel.fMassSum;
 
   int decayed_nucleon_id = 1;
   GHepParticle * decayed_nucleon = event->Particle(decayed_nucleon_id);
@@ -303,14 +296,14 @@ void NucleonDecayPrimaryVtxGenerator::GenerateDecayProducts(
     << "Decaying system p4 = " << utils::print::P4AsString(p4d);
 
   // Set the decay
-  bool permitted = fPhaseSpaceGenerator.SetDecay(*p4d, pdgv.size(), mass);
+  bool permitted = fPhaseSpaceGenerator.SetDecay(
+                       *p4d, pdgv.size(), &channel.fMasses[0]);
   if(!permitted) {
      LOG("NucleonDecay", pERROR)
        << " *** Phase space decay is not permitted \n"
-       << " Total particle mass = " << sum << "\n"
+       << " Total particle mass = " << channel.fMassSum << "\n"
        << " Decaying system p4 = " << utils::print::P4AsString(p4d);
      // clean-up
-     delete [] mass;
      delete p4d;
      delete v4d;
      // throw exception
@@ -320,75 +313,94 @@ void NucleonDecayPrimaryVtxGenerator::GenerateDecayProducts(
      throw exception;
   }
 
-  // Get the maximum weight
-  //double wmax = fPhaseSpaceGenerator.GetWtMax();
-  double wmax = -1;
-  for(int idec=0; idec<200; idec++) {
-     double w = fPhaseSpaceGenerator.Generate();
-     wmax = TMath::Max(wmax,w);
+  // The weight of two-body decays is constant: Generate an unweighted decay
+  // directly. Otherwise get the maximum weight (estimated only at the first
+  // decay of each type and decaying system mass bin) and unweight.
+  if(pdgv.size() == 2) {
+     fPhaseSpaceGenerator.Generate();
+  }
+  else {
+    //double wmax = fPhaseSpaceGenerator.GetWtMax();
+    double wmax = fPhaseSpaceGenerator.MaxWeight();
+    assert(wmax>0);
+    wmax *= 2;
+
+    LOG("NucleonDecay", pNOTICE)
+       << "Max phase space gen. weight @ current hadronic system: " << wmax;
+
+    RandomGen * rnd = RandomGen::Instance();
+
+    bool accept_decay=false;
+    unsigned int itry=0;
+    while(!accept_decay)
+    {
+       itry++;
+
+       if(itry > controls::kMaxUnweightDecayIterations) {
+         // report, clean-up and return
+         LOG("NucleonDecay", pWARN)
+             << "Couldn't generate an unweighted phase space decay after "
+             << itry << " attempts";
+         // clean up
+         delete p4d;
+         delete v4d;
+         // throw exception
+         genie::exceptions::EVGThreadException exception;
+         exception.SetReason("Couldn't select decay after N attempts");
+         exception.SwitchOnFastForward();
+         throw exception;
+       }
+       double w  = fPhaseSpaceGenerator.Generate();
+       fPhaseSpaceGenerator.UpdateMaxWeight(w);
+       if(w > wmax) {
+          LOG("NucleonDecay", pWARN)
+             << "Decay weight = " << w << " > max decay weight = " << wmax;
+       }
+       double gw = wmax * rnd->RndHadro().Rndm();
+       accept_decay = (gw<=w);
+
+       LOG("NucleonDecay", pINFO)
+          << "Decay weight = " << w << " / R = " << gw
+          << " - accepted: " << accept_decay;
+
+    } //!accept_decay
   }
-  assert(wmax>0);
-  wmax *= 2;
-
-  LOG("NucleonDecay", pNOTICE)
-     << "Max phase space gen. weight @ current hadronic system: " << wmax;
-
-  // Generate an unweighted decay
-  RandomGen * rnd = RandomGen::Instance();
-
-  bool accept_decay=false;
-  unsigned int itry=0;
-  while(!accept_decay)
-  {
-     itry++;
-
-     if(itry > controls::kMaxUnweightDecayIterations) {
-       // report, clean-up and return
-       LOG("NucleonDecay", pWARN)
-           << "Couldn't generate an unweighted phase space decay after "
-           << itry << " attempts";
-       // clean up
-       delete [] mass;
-       delete p4d;
-       delete v4d;
-       // throw exception
-       genie::exceptions::EVGThreadException exception;
-       exception.SetReason("Couldn't select decay after N attempts");
-       exception.SwitchOnFastForward();
-       throw exception;
-     }
-     double w  = fPhaseSpaceGenerator.Generate();
-     if(w > wmax) {
-        LOG("NucleonDecay", pWARN)
-           << "Decay weight = " << w << " > max decay weight = " << wmax;
-     }
-     double gw = wmax * rnd->RndHadro().Rndm();
-     accept_decay = (gw<=w);
-
-     LOG("NucleonDecay", pINFO)
-        << "Decay weight = " << w << " / R = " << gw
-        << " - accepted: " << accept_decay;
-
-  } //!accept_decay
 
   // Insert final state products into a TClonesArray of GHepParticle's
   TLorentzVector v4(*v4d);
-  int idp = 0;
-  for(pdg_iter = pdgv.begin(); pdg_iter != pdgv.end(); ++pdg_iter) {
-     int pdgc = *pdg_iter;
+  for(unsigned int idp = 0; idp < pdgv.size(); idp++) {
+     int pdgc = pdgv[idp];
      TLorentzVector * p4fin = fPhaseSpaceGenerator.GetDecay(idp);
      GHepStatus_t ist =
         utils::nucleon_decay::DecayProductStatus(fNucleonIsBound, pdgc);
      event->AddParticle(pdgc, ist, decayed_nucleon_id,-1,-1,-1, *p4fin, v4);
-     idp++;
   }
 
   // Clean-up
-  delete [] mass;
   delete p4d;
   delete v4d;
 }
 //____________________________________________________________________________
+const NucleonDecayPrimaryVtxGenerator::DecayChannel &
+  NucleonDecayPrimaryVtxGenerator::Channel(NucleonDecayMode_t ndm, int npdg) const
+{
+  std::pair<int,int> key((int)ndm, npdg);
+  std::map<std::pair<int,int>, DecayChannel>::const_iterator it =
+                                                         fChannels.find(key);
+  if(it != fChannels.end()) return it->second;
+
+  DecayChannel & channel = fChannels[key];
+  channel.fPdgCodes = utils::nucleon_decay::DecayProductList(ndm, npdg);
+  channel.fMassSum  = 0;
+  PDGCodeList::const_iterator pdg_iter = channel.fPdgCodes.begin();
+  for( ; pdg_iter != channel.fPdgCodes.end(); ++pdg_iter) {
+    double m = PDGLibrary::Instance()->Find(*pdg_iter)->Mass();
+    channel.fMasses.push_back(m);
+    channel.fMassSum += m;
+  }
+  return channel;
+}
+//____________________________________________________________________________
 void NucleonDecayPrimaryVtxGenerator::Configure(const Registry & config)
 {
   Algorithm::Configure(config);
@@ -407,9 +419,18 @@ void NucleonDecayPrimaryVtxGenerator::LoadConfig(void)
 //  const Registry * gc = confp->GlobalParameterList();
 
   fNuclModel = 0;
+  fDensityMax.clear();
 
   RgKey nuclkey = "NuclearModel";
   fNuclModel = dynamic_cast<const NuclearModelI *> (this->SubAlg(nuclkey));
   assert(fNuclModel);
+
+  // Keep the phase space decay max weights per decay type?
+  bool keep_max_weights = true;
+  GetParamDef( "PhaseSpDec-KeepMaxWeights", keep_max_weights, true ) ;
+  fPhaseSpaceGenerator.SetUseMaxWeightStore(keep_max_weights);
+  fPhaseSpaceGenerator.ClearMaxWeights();
+
+  fChannels.clear();
 }
 //___________________________________________________________________________
@@ -18,9 +18,13 @@
 #ifndef _NUCLEON_DECAY_PRIMARY_VTX_GENERATOR_H_
 #define _NUCLEON_DECAY_PRIMARY_VTX_GENERATOR_H_
 
-#include <TGenPhaseSpace.h>
+#include <map>
+#include <utility>
+#include <vector>
 
 #include "Framework/EventGen/EventRecordVisitorI.h"
+#include "Framework/ParticleData/PDGCodeList.h"
+#include "Framework/Utils/NBodyPhaseSpace.h"
 #include "Physics/NucleonDecay/NucleonDecayMode.h"
 
 namespace genie {
@@ -50,11 +54,23 @@ private:
    void GenerateFermiMomentum          (GHepRecord * event) const;
    void GenerateDecayProducts          (GHepRecord * event) const;
 
+   // Decay products (and their masses) of a decay mode & decayed nucleon,
+   // listed at the first decay and reused by all subsequent ones
+   struct DecayChannel {
+     PDGCodeList         fPdgCodes;  ///< decay products
+     std::vector<double> fMasses;    ///< decay product masses
+     double              fMassSum;   ///< sum of the decay product masses
+   };
+   const DecayChannel & Channel (NucleonDecayMode_t ndm, int npdg) const;
+
    mutable int                fCurrInitStatePdg;
    mutable NucleonDecayMode_t fCurrDecayMode;
    mutable int                fCurrDecayedNucleon;
    mutable bool               fNucleonIsBound;
-   mutable TGenPhaseSpace     fPhaseSpaceGenerator;
+   mutable NBodyPhaseSpace    fPhaseSpaceGenerator; ///< a phase space generator, keeping its max weights
+
+   mutable std::map<std::pair<int,int>, DecayChannel> fChannels; ///< by (mode, decayed nucleon)
+   mutable std::map<int, double> fDensityMax; ///< max of r^2 x density used in vertex generation, by A
 
    const NuclearModelI * fNuclModel;
 };
@@ -16,6 +16,7 @@
 #include <TMath.h>
 
 #include "Physics/PartonDistributions/GRV98LO.h"
+#include "Framework/Algorithm/AlgSharedData.h"
 #include "Framework/Messenger/Messenger.h"
 
 using namespace std;
@@ -23,19 +24,25 @@ using namespace genie;
 
 //____________________________________________________________________________
 GRV98LO::GRV98LO() :
-PDFModelI("genie::GRV98LO"),
- fXUVF(NULL),
- fXDVF(NULL),
- fXDEF(NULL),
- fXUDF(NULL),
- fXSF (NULL),
- fXGF (NULL)
+PDFModelI("genie::GRV98LO")
 {
   this->Initialize();
 }
 //____________________________________________________________________________
 GRV98LO::GRV98LO(string config) :
-PDFModelI("genie::GRV98LO", config),
+PDFModelI("genie::GRV98LO", config)
+{
+  LOG("GRV98LO", pDEBUG) << "GRV98LO configuration:\n " << GetConfig() ;
+
+  this->Initialize();
+}
+//____________________________________________________________________________
+GRV98LO::~GRV98LO()
+{
+
+}
+//____________________________________________________________________________
+GRV98LO::Grid::Grid() :
  fXUVF(NULL),
  fXDVF(NULL),
  fXDEF(NULL),
@@ -43,12 +50,10 @@ PDFModelI("genie::GRV98LO", config),
  fXSF (NULL),
  fXGF (NULL)
 {
-  LOG("GRV98LO", pDEBUG) << "GRV98LO configuration:\n " << GetConfig() ;
 
-  this->Initialize();
 }
 //____________________________________________________________________________
-GRV98LO::~GRV98LO()
+GRV98LO::Grid::~Grid()
 {
   if (fXUVF) {delete fXUVF; fXUVF = NULL;}
   if (fXDVF) {delete fXDVF; fXDVF = NULL;}
@@ -60,47 +65,47 @@ GRV98LO::~GRV98LO()
 //____________________________________________________________________________
 double GRV98LO::UpValence(double x, double Q2) const
 {
-  return AllPDFs(x,Q2).uval;
+  return MemoPDFs(x,Q2).uval;
 }
 //____________________________________________________________________________
 double GRV98LO::DownValence(double x, double Q2) const
 {
-  return AllPDFs(x,Q2).dval;
+  return MemoPDFs(x,Q2).dval;
 }
 //____________________________________________________________________________
 double GRV98LO::UpSea(double x, double Q2) const
 {
-  return AllPDFs(x,Q2).usea;
+  return MemoPDFs(x,Q2).usea;
 }
 //____________________________________________________________________________
 double GRV98LO::DownSea(double x, double Q2) const
 {
-  return AllPDFs(x,Q2).dsea;
+  return MemoPDFs(x,Q2).dsea;
 }
 //____________________________________________________________________________
 double GRV98LO::Strange(double x, double Q2) const
 {
-  return AllPDFs(x,Q2).str;
+  return MemoPDFs(x,Q2).str;
 }
 //____________________________________________________________________________
 double GRV98LO::Charm(double x, double Q2) const
 {
-  return AllPDFs(x,Q2).chm;
+  return MemoPDFs(x,Q2).chm;
 }
 //____________________________________________________________________________
 double GRV98LO::Bottom(double x, double Q2) const
 {
-  return AllPDFs(x,Q2).bot;
+  return MemoPDFs(x,Q2).bot;
 }
 //____________________________________________________________________________
 double GRV98LO::Top(double x, double Q2) const
 {
-  return AllPDFs(x,Q2).top;
+  return MemoPDFs(x,Q2).top;
 }
 //____________________________________________________________________________
 double GRV98LO::Gluon(double x, double Q2) const
 {
-  return AllPDFs(x,Q2).gl;
+  return MemoPDFs(x,Q2).gl;
 }
 //____________________________________________________________________________
 PDF_t GRV98LO::AllPDFs(double x, double Q2) const
@@ -125,12 +130,14 @@ PDF_t GRV98LO::AllPDFs(double x, double Q2) const
   LOG("GRV98LO", pDEBUG)
     << "Inputs x = " << x << ", Q2 = " << Q2;
 
+  const Grid & g = *fGrid;
+
   // apply kinematical limits
-//Q2 = TMath::Max(Q2, fGridQ2[0]);
+//Q2 = TMath::Max(Q2, g.fGridQ2[0]);
   if(Q2 <= 0.8) Q2 = 0.80001;
-  Q2 = std::min(Q2, fGridQ2[kNQ2-1]);
-  x  = std::max(x,  fGridXbj[0]);
-  x  = std::min(x,  fGridXbj[kNXbj-1]);
+  Q2 = std::min(Q2, g.fGridQ2[kNQ2-1]);
+  x  = std::max(x,  g.fGridXbj[0]);
+  x  = std::min(x,  g.fGridXbj[kNXbj-1]);
 
   double logx  = std::log(x);
   double logQ2 = std::log(Q2);
@@ -142,14 +149,14 @@ PDF_t GRV98LO::AllPDFs(double x, double Q2) const
   double x1p5  = x1*x1p4;
   double x1p7  = x1p3*x1p4;
 
-  double uv = fXUVF->Eval(logx,logQ2) * x1p3 * xv;
-  double dv = fXDVF->Eval(logx,logQ2) * x1p4 * xv;
-  double de = fXDEF->Eval(logx,logQ2) * x1p7 * xv;
-  double ud = fXUDF->Eval(logx,logQ2) * x1p7 * xs;
+  double uv = g.fXUVF->Eval(logx,logQ2) * x1p3 * xv;
+  double dv = g.fXDVF->Eval(logx,logQ2) * x1p4 * xv;
+  double de = g.fXDEF->Eval(logx,logQ2) * x1p7 * xv;
+  double ud = g.fXUDF->Eval(logx,logQ2) * x1p7 * xs;
   double us = 0.5 * (ud - de);
   double ds = 0.5 * (ud + de);
-  double ss = fXSF->Eval(logx,logQ2)  * x1p7 * xs;
-  double gl = fXGF->Eval(logx,logQ2)  * x1p5 * xs;
+  double ss = g.fXSF->Eval(logx,logQ2)  * x1p7 * xs;
+  double gl = g.fXGF->Eval(logx,logQ2)  * x1p5 * xs;
 
   pdf.uval = uv;
   pdf.dval = dv;
@@ -178,19 +185,43 @@ void GRV98LO::Configure(string config)
 //____________________________________________________________________________
 void GRV98LO::Initialize(void)
 {
-  fInitialized = false;
+  this->ClearPDFMemo();
 
   const char * genie_dir = gSystem->Getenv("GENIE");
-  if(!genie_dir) return;
+  if(!genie_dir) {
+    fInitialized = false;
+    return;
+  }
 
   string grid_file_name =
      string(gSystem->Getenv("GENIE")) + string("/data/evgen/pdfs/GRV98lo_patched.LHgrid");
 
+  // nothing to do at a reconfiguration, unless the grid file changed
+  if ( ! this->DataSourceChanged("Grid", grid_file_name) && fGrid ) return;
+
+  fInitialized = false;
+
+  // the grid is read once and shared between threads
+  fGrid = AlgSharedData::Instance()->Get<Grid>(
+     "GRV98LO/" + grid_file_name,
+     [&grid_file_name] () { return GRV98LO::ReadGrid(grid_file_name); });
+
+  fInitialized = (fGrid.get() != 0);
+}
+//____________________________________________________________________________
+GRV98LO::Grid * GRV98LO::ReadGrid(const string & grid_file_name)
+{
   LOG("GRV98LO", pNOTICE)
     << "Reading grid file from:\n " << grid_file_name;
 
   ifstream grid_file;
   grid_file.open (grid_file_name.c_str());
+  if(!grid_file.is_open()) {
+    LOG("GRV98LO", pERROR) << "Couldn't open grid file: " << grid_file_name;
+    return 0;
+  }
+
+  Grid * grid = new Grid;
 
   char rubbish[1000];
 
@@ -209,13 +240,13 @@ void GRV98LO::Initialize(void)
     grid_file >> xbj;
     // check against known limits
     // ...
-    fGridXbj[j] = xbj;
-    fGridLogXbj[j] = TMath::Log(xbj);
+    grid->fGridXbj[j] = xbj;
+    grid->fGridLogXbj[j] = TMath::Log(xbj);
   }
   ostringstream grid_values;
   grid_values << "(";
   for(int j=0; j < kNXbj; j++) {
-    grid_values << fGridXbj[j];
+    grid_values << grid->fGridXbj[j];
     if(j == kNXbj - 1) { grid_values << ")";  }
     else               { grid_values << ", "; }
   }
@@ -231,13 +262,13 @@ void GRV98LO::Initialize(void)
     grid_file >> Q2;
     // check against known limits
     // ...
-    fGridQ2[i] = Q2;
-    fGridLogQ2[i] = TMath::Log(Q2);
+    grid->fGridQ2[i] = Q2;
+    grid->fGridLogQ2[i] = TMath::Log(Q2);
   }
   grid_values.str("");
   grid_values << "(";
   for(int i=0; i < kNQ2; i++) {
-    grid_values << fGridQ2[i];
+    grid_values << grid->fGridQ2[i];
     if(i == kNQ2 - 1) { grid_values << ")";  }
     else              { grid_values << ", "; }
   }
@@ -273,12 +304,12 @@ void GRV98LO::Initialize(void)
          << ", p3 = " << p3
          << ", p4 = " << p4
          << ", p5 = " << p5;
-      fParton [0][i][j]  = p0;
-      fParton [1][i][j]  = p1;
-      fParton [2][i][j]  = p2;
-      fParton [3][i][j]  = p3;
-      fParton [4][i][j]  = p4;
-      fParton [5][i][j]  = p5;
+      grid->fParton [0][i][j]  = p0;
+      grid->fParton [1][i][j]  = p1;
+      grid->fParton [2][i][j]  = p2;
+      grid->fParton [3][i][j]  = p3;
+      grid->fParton [4][i][j]  = p4;
+      grid->fParton [5][i][j]  = p5;
       k++;
     }
   }
@@ -299,27 +330,27 @@ void GRV98LO::Initialize(void)
 
   k=0;
   for(int i=0; i < kNQ2; i++) {
-    double logQ2 = std::log(fGridQ2[i]);
+    double logQ2 = std::log(grid->fGridQ2[i]);
     gridLogQ2[i] = logQ2;
     for(int j=0; j < kNXbj - 1; j++) {
-       double logx  = std::log(fGridXbj[j]);
+       double logx  = std::log(grid->fGridXbj[j]);
        gridLogXbj[j] = logx;
-       double xb0v  = std::sqrt(fGridXbj[j]);
-       double xb0s  = std::pow(fGridXbj[j], -0.2);
-       double xb1   = 1 - fGridXbj[j];
+       double xb0v  = std::sqrt(grid->fGridXbj[j]);
+       double xb0s  = std::pow(grid->fGridXbj[j], -0.2);
+       double xb1   = 1 - grid->fGridXbj[j];
        double xb1p3 = std::pow(xb1, 3.);
        double xb1p4 = std::pow(xb1, 4.);
        double xb1p5 = std::pow(xb1, 5.);
        double xb1p7 = std::pow(xb1, 7.);
-       knotsXUVF[k] = fParton[0][i][j] / (xb1p3 * xb0v);
-       knotsXDVF[k] = fParton[1][i][j] / (xb1p4 * xb0v);
-       knotsXDEF[k] = fParton[2][i][j] / (xb1p7 * xb0v);
-       knotsXUDF[k] = fParton[3][i][j] / (xb1p7 * xb0s);
-       knotsXSF [k] = fParton[4][i][j] / (xb1p7 * xb0s);
-       knotsXGF [k] = fParton[5][i][j] / (xb1p5 * xb0s);
+       knotsXUVF[k] = grid->fParton[0][i][j] / (xb1p3 * xb0v);
+       knotsXDVF[k] = grid->fParton[1][i][j] / (xb1p4 * xb0v);
+       knotsXDEF[k] = grid->fParton[2][i][j] / (xb1p7 * xb0v);
+       knotsXUDF[k] = grid->fParton[3][i][j] / (xb1p7 * xb0s);
+       knotsXSF [k] = grid->fParton[4][i][j] / (xb1p7 * xb0s);
+       knotsXGF [k] = grid->fParton[5][i][j] / (xb1p5 * xb0s);
        k++;
     }
-    double logxmax = TMath::Log(fGridXbj[kNXbj-1]);
+    double logxmax = TMath::Log(grid->fGridXbj[kNXbj-1]);
     gridLogXbj[kNXbj-1] = logxmax;
     knotsXUVF[k] = 0;
     knotsXDVF[k] = 0;
@@ -330,13 +361,13 @@ void GRV98LO::Initialize(void)
     k++;
   }
 
-  fXUVF = new Interpolator2D(gridLogXbj.size(),&gridLogXbj[0],gridLogQ2.size(),&gridLogQ2[0],&knotsXUVF[0]);
-  fXDVF = new Interpolator2D(gridLogXbj.size(),&gridLogXbj[0],gridLogQ2.size(),&gridLogQ2[0],&knotsXDVF[0]);
-  fXDEF = new Interpolator2D(gridLogXbj.size(),&gridLogXbj[0],gridLogQ2.size(),&gridLogQ2[0],&knotsXDEF[0]);
-  fXUDF = new Interpolator2D(gridLogXbj.size(),&gridLogXbj[0],gridLogQ2.size(),&gridLogQ2[0],&knotsXUDF[0]);
-  fXSF  = new Interpolator2D(gridLogXbj.size(),&gridLogXbj[0],gridLogQ2.size(),&gridLogQ2[0],&knotsXSF [0]);
-  fXGF  = new Interpolator2D(gridLogXbj.size(),&gridLogXbj[0],gridLogQ2.size(),&gridLogQ2[0],&knotsXGF [0]);
+  grid->fXUVF = new Interpolator2D(gridLogXbj.size(),&gridLogXbj[0],gridLogQ2.size(),&gridLogQ2[0],&knotsXUVF[0]);
+  grid->fXDVF = new Interpolator2D(gridLogXbj.size(),&gridLogXbj[0],gridLogQ2.size(),&gridLogQ2[0],&knotsXDVF[0]);
+  grid->fXDEF = new Interpolator2D(gridLogXbj.size(),&gridLogXbj[0],gridLogQ2.size(),&gridLogQ2[0],&knotsXDEF[0]);
+  grid->fXUDF = new Interpolator2D(gridLogXbj.size(),&gridLogXbj[0],gridLogQ2.size(),&gridLogQ2[0],&knotsXUDF[0]);
+  grid->fXSF  = new Interpolator2D(gridLogXbj.size(),&gridLogXbj[0],gridLogQ2.size(),&gridLogQ2[0],&knotsXSF [0]);
+  grid->fXGF  = new Interpolator2D(gridLogXbj.size(),&gridLogXbj[0],gridLogQ2.size(),&gridLogQ2[0],&knotsXGF [0]);
 
-  fInitialized = true;
+  return grid;
 }
 //____________________________________________________________________________
@@ -29,6 +29,8 @@
 #ifndef _GRV98LO_H_
 #define _GRV98LO_H_
 
+#include <memory>
+
 #include "Physics/PartonDistributions/PDFModelI.h"
 #include "Framework/Numerical/Interpolator2D.h"
 
@@ -72,24 +74,34 @@ private:
   static const int kNXbj    = 68;
   static const int kNParton = 6;
 
-  // >> Information read from the PDF grid file
-  //
-  // grid points
-  //
-  double fGridQ2    [kNQ2];  // Q^2 (GeV^2)    values in grid; between 0.8 and 1E6
-  double fGridLogQ2 [kNQ2];  // log(Q^2/GeV^2) values in grid
-  double fGridXbj   [kNXbj]; // Bjorken-x      values in grid; between 1E-9 and 1
-  double fGridLogXbj[kNXbj]; // log(Bjorken-x) values in grid
-  double fParton    [kNParton][kNQ2][kNXbj-1]; // PARTON (NPART,NQ,NX-1) array in original code
-  //
-  // arrays for the interpolation routine
+  // >> Information read from the PDF grid file.
+  //    Read-only after it is built, so it is shared by the GRV98LO
+  //    instances of all threads (see AlgSharedData)
   //
-  Interpolator2D * fXUVF; // = f(logx,logQ2)
-  Interpolator2D * fXDVF;
-  Interpolator2D * fXDEF;
-  Interpolator2D * fXUDF;
-  Interpolator2D * fXSF;
-  Interpolator2D * fXGF;
+  struct Grid {
+    Grid();
+   ~Grid();
+    //
+    // grid points
+    //
+    double fGridQ2    [kNQ2];  // Q^2 (GeV^2)    values in grid; between 0.8 and 1E6
+    double fGridLogQ2 [kNQ2];  // log(Q^2/GeV^2) values in grid
+    double fGridXbj   [kNXbj]; // Bjorken-x      values in grid; between 1E-9 and 1
+    double fGridLogXbj[kNXbj]; // log(Bjorken-x) values in grid
+    double fParton    [kNParton][kNQ2][kNXbj-1]; // PARTON (NPART,NQ,NX-1) array in original code
+    //
+    // arrays for the interpolation routine
+    //
+    Interpolator2D * fXUVF; // = f(logx,logQ2)
+    Interpolator2D * fXDVF;
+    Interpolator2D * fXDEF;
+    Interpolator2D * fXUDF;
+    Interpolator2D * fXSF;
+    Interpolator2D * fXGF;
+  };
+  static Grid * ReadGrid (const string & grid_file_name);
+
+  std::shared_ptr<const Grid> fGrid;
 };
 
 }         // genie namespace
@@ -90,47 +90,47 @@ void LHAPDF5::SetPDFSetFromConfig(void) const
 //____________________________________________________________________________
 double LHAPDF5::UpValence(double x, double Q2) const
 {
-  return AllPDFs(x,Q2).uval;
+  return MemoPDFs(x,Q2).uval;
 }
 //____________________________________________________________________________
 double LHAPDF5::DownValence(double x, double Q2) const
 {
-  return AllPDFs(x,Q2).dval;
+  return MemoPDFs(x,Q2).dval;
 }
 //____________________________________________________________________________
 double LHAPDF5::UpSea(double x, double Q2) const
 {
-  return AllPDFs(x,Q2).usea;
+  return MemoPDFs(x,Q2).usea;
 }
 //____________________________________________________________________________
 double LHAPDF5::DownSea(double x, double Q2) const
 {
-  return AllPDFs(x,Q2).dsea;
+  return MemoPDFs(x,Q2).dsea;
 }
 //____________________________________________________________________________
 double LHAPDF5::Strange(double x, double Q2) const
 {
-  return AllPDFs(x,Q2).str;
+  return MemoPDFs(x,Q2).str;
 }
 //____________________________________________________________________________
 double LHAPDF5::Charm(double x, double Q2) const
 {
-  return AllPDFs(x,Q2).chm;
+  return MemoPDFs(x,Q2).chm;
 }
 //____________________________________________________________________________
 double LHAPDF5::Bottom(double x, double Q2) const
 {
-  return AllPDFs(x,Q2).bot;
+  return MemoPDFs(x,Q2).bot;
 }
 //____________________________________________________________________________
 double LHAPDF5::Top(double x, double Q2) const
 {
-  return AllPDFs(x,Q2).top;
+  return MemoPDFs(x,Q2).top;
 }
 //____________________________________________________________________________
 double LHAPDF5::Gluon(double x, double Q2) const
 {
-  return AllPDFs(x,Q2).gl;
+  return MemoPDFs(x,Q2).gl;
 }
 //____________________________________________________________________________
 PDF_t LHAPDF5::AllPDFs(
@@ -168,6 +168,7 @@ void LHAPDF5::Configure(const Registry & config)
 
   this->Initialize();
   this->SetPDFSetFromConfig();
+  this->ClearPDFMemo();
 
   fAllowReconfig=false;
 }
@@ -178,6 +179,7 @@ void LHAPDF5::Configure(string config)
 
   this->Initialize();
   this->SetPDFSetFromConfig();
+  this->ClearPDFMemo();
 
   fAllowReconfig=false;
 }
@@ -55,47 +55,47 @@ LHAPDF6::~LHAPDF6()
 //____________________________________________________________________________
 double LHAPDF6::UpValence(double x, double Q2) const
 {
-  return AllPDFs(x,Q2).uval;
+  return MemoPDFs(x,Q2).uval;
 }
 //____________________________________________________________________________
 double LHAPDF6::DownValence(double x, double Q2) const
 {
-  return AllPDFs(x,Q2).dval;
+  return MemoPDFs(x,Q2).dval;
 }
 //____________________________________________________________________________
 double LHAPDF6::UpSea(double x, double Q2) const
 {
-  return AllPDFs(x,Q2).usea;
+  return MemoPDFs(x,Q2).usea;
 }
 //____________________________________________________________________________
 double LHAPDF6::DownSea(double x, double Q2) const
 {
-  return AllPDFs(x,Q2).dsea;
+  return MemoPDFs(x,Q2).dsea;
 }
 //____________________________________________________________________________
 double LHAPDF6::Strange(double x, double Q2) const
 {
-  return AllPDFs(x,Q2).str;
+  return MemoPDFs(x,Q2).str;
 }
 //____________________________________________________________________________
 double LHAPDF6::Charm(double x, double Q2) const
 {
-  return AllPDFs(x,Q2).chm;
+  return MemoPDFs(x,Q2).chm;
 }
 //____________________________________________________________________________
 double LHAPDF6::Bottom(double x, double Q2) const
 {
-  return AllPDFs(x,Q2).bot;
+  return MemoPDFs(x,Q2).bot;
 }
 //____________________________________________________________________________
 double LHAPDF6::Top(double x, double Q2) const
 {
-  return AllPDFs(x,Q2).top;
+  return MemoPDFs(x,Q2).top;
 }
 //____________________________________________________________________________
 double LHAPDF6::Gluon(double x, double Q2) const
 {
-  return AllPDFs(x,Q2).gl;
+  return MemoPDFs(x,Q2).gl;
 }
 //____________________________________________________________________________
 #ifdef __GENIE_LHAPDF6_ENABLED__
@@ -139,6 +139,8 @@ void LHAPDF6::Configure(string config)
 //____________________________________________________________________________
 void LHAPDF6::LoadConfig(void)
 {
+  this->ClearPDFMemo();
+
   this->GetParam("SetName",  fSetName );
   this->GetParam("MemberID", fMemberID);
 
@@ -12,6 +12,7 @@
 #pragma link C++ class genie::GRV98LO;
 #pragma link C++ class genie::LHAPDF6;
 #pragma link C++ class genie::LHAPDF5;
+#pragma link C++ class genie::TabulatedPDF;
 
 
 #endif
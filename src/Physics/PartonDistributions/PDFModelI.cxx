@@ -14,19 +14,28 @@ using namespace genie;
 
 //____________________________________________________________________________
 PDFModelI::PDFModelI() :
-Algorithm()
+Algorithm(),
+fMemoX(0),
+fMemoQ2(0),
+fMemoIsSet(false)
 {
 
 }
 //____________________________________________________________________________
 PDFModelI::PDFModelI(string name) :
-Algorithm(name)
+Algorithm(name),
+fMemoX(0),
+fMemoQ2(0),
+fMemoIsSet(false)
 {
 
 }
 //____________________________________________________________________________
 PDFModelI::PDFModelI(string name, string config) :
-Algorithm(name, config)
+Algorithm(name, config),
+fMemoX(0),
+fMemoQ2(0),
+fMemoIsSet(false)
 {
 
 }
@@ -36,3 +45,14 @@ PDFModelI::~PDFModelI()
 
 }
 //____________________________________________________________________________
+const PDF_t & PDFModelI::MemoPDFs(double x, double Q2) const
+{
+  if(!fMemoIsSet || x != fMemoX || Q2 != fMemoQ2) {
+    fMemoPDFs  = this->AllPDFs(x, Q2);
+    fMemoX     = x;
+    fMemoQ2    = Q2;
+    fMemoIsSet = true;
+  }
+  return fMemoPDFs;
+}
+//____________________________________________________________________________
@@ -49,6 +49,22 @@ protected:
   PDFModelI();
   PDFModelI(string name);
   PDFModelI(string name, string config);
+
+  //! AllPDFs(x,Q2), memoized for the last (x,Q2) point. Implementations
+  //! compute their single-flavour PDFs with it, so that querying all the
+  //! flavours one by one at the same point costs a single AllPDFs() call.
+  //! (Algorithm instances are used by a single thread, see AlgFactory, so
+  //! the memo is per thread.) Implementations must call ClearPDFMemo()
+  //! when they are reconfigured.
+  const PDF_t & MemoPDFs     (double x, double Q2) const;
+  void          ClearPDFMemo (void) const { fMemoIsSet = false; }
+
+private:
+
+  mutable double fMemoX;      ///< x of the memoized PDFs
+  mutable double fMemoQ2;     ///< Q2 of the memoized PDFs
+  mutable PDF_t  fMemoPDFs;   ///< memoized PDFs
+  mutable bool   fMemoIsSet;  ///< are there memoized PDFs?
 };
 
 }         // genie namespace
@@ -0,0 +1,264 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <cmath>
+#include <cassert>
+#include <cstdlib>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+
+#include "Physics/PartonDistributions/TabulatedPDF.h"
+#include "Framework/Algorithm/AlgSharedData.h"
+#include "Framework/Messenger/Messenger.h"
+
+using std::ostringstream;
+
+using namespace genie;
+
+//____________________________________________________________________________
+namespace {
+  // PDF_t <-> flavour array
+  inline void PDFToArray(const PDF_t & pdf, double * a)
+  {
+    a[0] = pdf.uval; a[1] = pdf.dval; a[2] = pdf.usea;
+    a[3] = pdf.dsea; a[4] = pdf.str;  a[5] = pdf.chm;
+    a[6] = pdf.bot;  a[7] = pdf.top;  a[8] = pdf.gl;
+  }
+  inline PDF_t ArrayToPDF(const double * a)
+  {
+    PDF_t pdf;
+    pdf.uval = a[0]; pdf.dval = a[1]; pdf.usea = a[2];
+    pdf.dsea = a[3]; pdf.str  = a[4]; pdf.chm  = a[5];
+    pdf.bot  = a[6]; pdf.top  = a[7]; pdf.gl   = a[8];
+    return pdf;
+  }
+  // 4-point Lagrange interpolation weights for nodes at 0,1,2,3
+  inline void LagrangeWeights(double t, double * w)
+  {
+    double t1 = t-1, t2 = t-2, t3 = t-3;
+    w[0] = -t1*t2*t3 / 6.;
+    w[1] =  t *t2*t3 / 2.;
+    w[2] = -t *t1*t3 / 2.;
+    w[3] =  t *t1*t2 / 6.;
+  }
+}
+//____________________________________________________________________________
+TabulatedPDF::TabulatedPDF() :
+PDFModelI("genie::TabulatedPDF"),
+fBasePDFModel(0),
+fMemoNext(0)
+{
+  for(int i = 0; i < kNMemo; i++) { fMemoX[i] = -1; fMemoQ2[i] = -1; }
+}
+//____________________________________________________________________________
+TabulatedPDF::TabulatedPDF(string config) :
+PDFModelI("genie::TabulatedPDF", config),
+fBasePDFModel(0),
+fMemoNext(0)
+{
+  for(int i = 0; i < kNMemo; i++) { fMemoX[i] = -1; fMemoQ2[i] = -1; }
+}
+//____________________________________________________________________________
+TabulatedPDF::~TabulatedPDF()
+{
+
+}
+//____________________________________________________________________________
+double TabulatedPDF::UpValence(double x, double Q2) const
+{
+  return AllPDFs(x,Q2).uval;
+}
+//____________________________________________________________________________
+double TabulatedPDF::DownValence(double x, double Q2) const
+{
+  return AllPDFs(x,Q2).dval;
+}
+//____________________________________________________________________________
+double TabulatedPDF::UpSea(double x, double Q2) const
+{
+  return AllPDFs(x,Q2).usea;
+}
+//____________________________________________________________________________
+double TabulatedPDF::DownSea(double x, double Q2) const
+{
+  return AllPDFs(x,Q2).dsea;
+}
+//____________________________________________________________________________
+double TabulatedPDF::Strange(double x, double Q2) const
+{
+  return AllPDFs(x,Q2).str;
+}
+//____________________________________________________________________________
+double TabulatedPDF::Charm(double x, double Q2) const
+{
+  return AllPDFs(x,Q2).chm;
+}
+//____________________________________________________________________________
+double TabulatedPDF::Bottom(double x, double Q2) const
+{
+  return AllPDFs(x,Q2).bot;
+}
+//____________________________________________________________________________
+double TabulatedPDF::Top(double x, double Q2) const
+{
+  return AllPDFs(x,Q2).top;
+}
+//____________________________________________________________________________
+double TabulatedPDF::Gluon(double x, double Q2) const
+{
+  return AllPDFs(x,Q2).gl;
+}
+//____________________________________________________________________________
+PDF_t TabulatedPDF::AllPDFs(double x, double Q2) const
+{
+  for(int i = 0; i < kNMemo; i++) {
+    if(x == fMemoX[i] && Q2 == fMemoQ2[i]) return fMemoPDF[i];
+  }
+
+  PDF_t pdf;
+  const Table * t = fTable.get();
+  if(t && x >= t->fXMin && x <= t->fXMax && Q2 >= t->fQ2Min && Q2 <= t->fQ2Max) {
+    pdf = this->Interpolate(x, Q2);
+  } else {
+    pdf = fBasePDFModel->AllPDFs(x, Q2);
+  }
+
+  fMemoX  [fMemoNext] = x;
+  fMemoQ2 [fMemoNext] = Q2;
+  fMemoPDF[fMemoNext] = pdf;
+  fMemoNext = (fMemoNext + 1) % kNMemo;
+
+  return pdf;
+}
+//____________________________________________________________________________
+PDF_t TabulatedPDF::Interpolate(double x, double Q2) const
+{
+  const Table & t = *fTable;
+
+  // locate the 4x4 node stencil and compute the interpolation weights
+  double tu = (std::log(x/(1-x)) - t.fUMin) / t.fDU;
+  double tv = (std::log(Q2)      - t.fVMin) / t.fDV;
+  int iu = std::min( std::max( (int) std::floor(tu) - 1, 0 ), t.fNU - 4 );
+  int iv = std::min( std::max( (int) std::floor(tv) - 1, 0 ), t.fNV - 4 );
+
+  double wu[4], wv[4];
+  LagrangeWeights(tu - iu, wu);
+  LagrangeWeights(tv - iv, wv);
+
+  double w[16];
+  for(int a = 0; a < 4; a++) {
+    for(int b = 0; b < 4; b++) w[4*a+b] = wu[a] * wv[b];
+  }
+
+  // interpolate all flavours with the same weights
+  int i0 = iu * t.fNV + iv;
+  double f[kNFlavours];
+  for(int k = 0; k < kNFlavours; k++) {
+    const double * p = &t.fPDF[k][i0];
+    double sum = 0;
+    for(int a = 0; a < 4; a++) {
+      const double * row = p + a * t.fNV;
+      sum += w[4*a  ] * row[0] + w[4*a+1] * row[1] +
+             w[4*a+2] * row[2] + w[4*a+3] * row[3];
+    }
+    f[k] = sum;
+  }
+  return ArrayToPDF(f);
+}
+//____________________________________________________________________________
+void TabulatedPDF::Configure(const Registry & config)
+{
+  Algorithm::Configure(config);
+  this->LoadConfig();
+}
+//____________________________________________________________________________
+void TabulatedPDF::Configure(string config)
+{
+  Algorithm::Configure(config);
+  this->LoadConfig();
+}
+//____________________________________________________________________________
+void TabulatedPDF::LoadConfig(void)
+{
+  fBasePDFModel =
+    dynamic_cast<const PDFModelI *> (this->SubAlg("Base-PDF-Set"));
+  assert(fBasePDFModel);
+
+  int    nx, nq2;
+  double xmin, xmax, q2min, q2max;
+  GetParamDef( "Table-NX",    nx,    400       );
+  GetParamDef( "Table-NQ2",   nq2,   120       );
+  GetParamDef( "Table-XMin",  xmin,  1E-6      );
+  GetParamDef( "Table-XMax",  xmax,  1. - 1E-6 );
+  GetParamDef( "Table-Q2Min", q2min, 0.8       );
+  GetParamDef( "Table-Q2Max", q2max, 1E+5      );
+
+  if(nx < 4 || nq2 < 4 || xmin <= 0 || xmax >= 1 || xmin >= xmax ||
+     q2min <= 0 || q2min >= q2max) {
+    LOG("TabulatedPDF", pFATAL)
+      << "Invalid PDF table: " << nx << " x nodes in [" << xmin << ", " << xmax
+      << "], " << nq2 << " Q2 nodes in [" << q2min << ", " << q2max << "]";
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  // the tables depend only on the base model configuration and the grid
+  ostringstream key;
+  key << "TabulatedPDF/" << fBasePDFModel->ConfigFingerprint()
+      << std::setprecision(17)
+      << "/" << nx << "," << xmin << "," << xmax
+      << "/" << nq2 << "," << q2min << "," << q2max;
+
+  const PDFModelI * base = fBasePDFModel;
+  fTable = AlgSharedData::Instance()->Get<Table>(key.str(),
+     [base, nx, nq2, xmin, xmax, q2min, q2max] () {
+       return TabulatedPDF::BuildTable(base, nx, nq2, xmin, xmax, q2min, q2max);
+     });
+
+  // previous results may be for another base model
+  for(int i = 0; i < kNMemo; i++) { fMemoX[i] = -1; fMemoQ2[i] = -1; }
+}
+//____________________________________________________________________________
+TabulatedPDF::Table * TabulatedPDF::BuildTable(const PDFModelI * base,
+   int nx, int nq2, double xmin, double xmax, double q2min, double q2max)
+{
+  LOG("TabulatedPDF", pNOTICE)
+    << "Tabulating PDF model " << base->Id().Key() << " on a "
+    << nx << " x " << nq2 << " (x,Q2) grid";
+
+  Table * t = new Table;
+
+  t->fNU    = nx;
+  t->fNV    = nq2;
+  t->fXMin  = xmin;
+  t->fXMax  = xmax;
+  t->fQ2Min = q2min;
+  t->fQ2Max = q2max;
+  t->fUMin  = std::log(xmin/(1-xmin));
+  t->fDU    = (std::log(xmax/(1-xmax)) - t->fUMin) / (nx-1);
+  t->fVMin  = std::log(q2min);
+  t->fDV    = (std::log(q2max) - t->fVMin) / (nq2-1);
+
+  for(int k = 0; k < kNFlavours; k++) t->fPDF[k].resize(nx*nq2);
+
+  double f[kNFlavours];
+  for(int iu = 0; iu < nx; iu++) {
+    double u = t->fUMin + iu * t->fDU;
+    double x = 1. / (1. + std::exp(-u));
+    for(int iv = 0; iv < nq2; iv++) {
+      double Q2 = std::exp(t->fVMin + iv * t->fDV);
+      PDFToArray(base->AllPDFs(x, Q2), f);
+      for(int k = 0; k < kNFlavours; k++) t->fPDF[k][iu*nq2+iv] = f[k];
+    }
+  }
+  return t;
+}
+//____________________________________________________________________________
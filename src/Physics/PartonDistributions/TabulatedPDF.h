@@ -0,0 +1,100 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::TabulatedPDF
+
+\brief    A PDFModelI tabulating another PDF model on a dense grid.
+
+          At configuration, all flavours of the base PDF model are computed
+          on a uniform grid in (u = log(x/(1-x)), log Q2), dense at both low
+          and high x, and stored in one array per flavour. PDFs are then
+          obtained by 4x4-point Lagrange interpolation: the grid cell and
+          the interpolation weights are computed once and shared by all
+          flavours. Points out of the tabulated range are passed to the base
+          model. The results of the last two (x,Q2) points are kept, so that
+          repeated evaluations (eg by the charm and non-charm PDF sets of a
+          structure function model at the same point) are not recomputed.
+
+          The tables are shared by the instances of all threads and by all
+          TabulatedPDF instances with an equally configured base model.
+
+          Concrete implementation of the PDFModelI interface.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _TABULATED_PDF_H_
+#define _TABULATED_PDF_H_
+
+#include <memory>
+#include <vector>
+
+#include "Physics/PartonDistributions/PDFModelI.h"
+
+namespace genie {
+
+class TabulatedPDF : public PDFModelI {
+
+public:
+  TabulatedPDF();
+  TabulatedPDF(string config);
+  virtual ~TabulatedPDF();
+
+  //! PDFModelI interface implementation
+  double UpValence   (double x, double Q2) const;
+  double DownValence (double x, double Q2) const;
+  double UpSea       (double x, double Q2) const;
+  double DownSea     (double x, double Q2) const;
+  double Strange     (double x, double Q2) const;
+  double Charm       (double x, double Q2) const;
+  double Bottom      (double x, double Q2) const;
+  double Top         (double x, double Q2) const;
+  double Gluon       (double x, double Q2) const;
+  PDF_t  AllPDFs     (double x, double Q2) const;
+
+  //! overload the Algorithm::Configure() methods to load private data
+  //! members from configuration options
+  void Configure (const Registry & config);
+  void Configure (string config);
+
+private:
+
+  static const int kNFlavours = 9;  ///< the PDF_t fields
+  static const int kNMemo     = 2;  ///< number of memoized (x,Q2) points
+
+  // PDF tables, read-only once built
+  struct Table {
+    int    fNU;                         ///< number of u = log(x/(1-x)) nodes
+    int    fNV;                         ///< number of v = log(Q2) nodes
+    double fUMin, fDU;                  ///< u of the first node, node spacing
+    double fVMin, fDV;                  ///< v of the first node, node spacing
+    double fXMin, fXMax;                ///< tabulated x range
+    double fQ2Min, fQ2Max;              ///< tabulated Q2 range
+    std::vector<double> fPDF[kNFlavours]; ///< per flavour, PDF at node (iu,iv) in [iu*fNV+iv]
+  };
+
+  void    LoadConfig    (void);
+  PDF_t   Interpolate   (double x, double Q2) const;
+  static  Table * BuildTable (const PDFModelI * base, int nx, int nq2,
+                              double xmin, double xmax, double q2min, double q2max);
+
+  const PDFModelI *            fBasePDFModel; ///< tabulated PDF model
+  std::shared_ptr<const Table> fTable;
+
+  // memoized results
+  mutable double fMemoX  [kNMemo];
+  mutable double fMemoQ2 [kNMemo];
+  mutable PDF_t  fMemoPDF[kNMemo];
+  mutable int    fMemoNext;
+};
+
+}         // genie namespace
+
+#endif    // _TABULATED_PDF_H_
@@ -13,6 +13,8 @@
 */
 //____________________________________________________________________________
 
+#include <algorithm>
+
 #include <TMath.h>
 
 #include "Framework/Algorithm/AlgFactory.h"
@@ -203,6 +205,7 @@ void QELEventGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
         // If the generated kinematics are accepted, finish-up module's job
         if(accept) {
+            this->RecordAccepted(interaction, iter);
             double gQ2 = interaction->KinePtr()->Q2(false);
             LOG("QELEvent", pINFO) << "*Selected* Q^2 = " << gQ2 << " GeV^2";
 
@@ -459,59 +462,11 @@ double QELEventGenerator::ComputeMaxXSec(const Interaction * in) const
         // BindHitNucleon()
         genie::utils::BindHitNucleon(*interaction, *fNuclModel, dummy_Eb, kOnShell);
 
-        // Just a scoping block for now
-        // OK, we're going to scan the COM frame angles to get the point of max xsec
-        // We'll bin in solid angle, and find the maximum point
-        // Then we'll bin/scan again inside that point
-        // Rinse and repeat until the xsec stabilises to within some fraction of our safety factor
-        const double acceptable_fraction_of_safety_factor = 0.2;
-        const int max_n_layers = 100;
-        const int N_theta = 10;
-        const int N_phi = 10;
-        double phi_at_xsec_max = -1;
-        double costh_at_xsec_max = 0;
-        double this_nuc_xsec_max = -1;
-
-        double costh_range_min = -1.;
-        double costh_range_max = genie::utils::CosTheta0Max( *interaction );
-        double phi_range_min = 0.;
-        double phi_range_max = 2*TMath::Pi();
-        for (int ilayer = 0 ; ilayer < max_n_layers ; ilayer++) {
-          double last_layer_xsec_max = this_nuc_xsec_max;
-          double costh_increment = (costh_range_max-costh_range_min) / N_theta;
-          double phi_increment   = (phi_range_max-phi_range_min) / N_phi;
-          // Now scan through centre-of-mass angles coarsely
-          for (int itheta = 0; itheta < N_theta; itheta++){
-              double costh = costh_range_min + itheta * costh_increment;
-              for (int iphi = 0; iphi < N_phi; iphi++) { // Scan around phi
-                  double phi = phi_range_min + iphi * phi_increment;
-                  // We're after an upper limit on the cross section, so just
-                  // put the nucleon on-shell and call it good. The last
-                  // argument is false because we've already called
-                  // BindHitNucleon() above
-                  double xs = genie::utils::ComputeFullQELPXSec(interaction,
-                    fNuclModel, fXSecModel, costh, phi, dummy_Eb, kOnShell, fMinAngleEM, false);
-
-                  if (xs > this_nuc_xsec_max){
-                      phi_at_xsec_max = phi;
-                      costh_at_xsec_max = costh;
-                      this_nuc_xsec_max = xs;
-                  }
-                  //
-              } // Done with phi scan
-          }// Done with centre-of-mass angles coarsely
-
-          // Calculate the range for the next layer
-          costh_range_min = costh_at_xsec_max - costh_increment;
-          costh_range_max = costh_at_xsec_max + costh_increment;
-          phi_range_min = phi_at_xsec_max - phi_increment;
-          phi_range_max = phi_at_xsec_max + phi_increment;
-
-          double improvement_factor = this_nuc_xsec_max/last_layer_xsec_max;
-          if (ilayer && (improvement_factor-1) < acceptable_fraction_of_safety_factor * (fSafetyFactor-1)) {
-            break;
-          }
-        }
+        // Find the point of max xsec in the COM frame angles: a coarse scan
+        // over the full (cos(theta_0), phi_0) range, followed by a local
+        // pattern search around the best grid point
+        double this_nuc_xsec_max = this->MaxXSecOverAngles(interaction);
+
         if (this_nuc_xsec_max > xsec_max) {
             xsec_max = this_nuc_xsec_max;
             LOG("QELEvent", pINFO) << "best estimate for xsec_max = " << xsec_max;
@@ -533,3 +488,95 @@ double QELEventGenerator::ComputeMaxXSec(const Interaction * in) const
     return xsec_max;
 }
 //____________________________________________________________________________
+double QELEventGenerator::MaxXSecOverAngles(Interaction * interaction) const
+{
+// Maximizes the differential cross section over the lepton COM frame angles
+// for the hit nucleon currently set in the nuclear model (and already bound
+// via BindHitNucleon()).
+// A coarse N_theta x N_phi scan locates the region of the maximum. The
+// best grid point is then refined by a compass search: the step in each
+// direction is halved whenever none of the neighbouring points improves
+// the maximum, until the improvement over a step halving falls below a
+// fraction of the safety factor margin.
+
+  const double acceptable_fraction_of_safety_factor = 0.2;
+  const int    N_theta    = 10;
+  const int    N_phi      = 10;
+  const int    max_n_eval = 1000;
+  double dummy_Eb = 0.;
+
+  double costh_min = -1.;
+  double costh_max = std::min(1., genie::utils::CosTheta0Max( *interaction ));
+  double phi_min   = 0.;
+  double phi_max   = 2*TMath::Pi();
+  if(costh_max <= costh_min) return -1.;
+
+  // We're after an upper limit on the cross section, so just put the nucleon
+  // on-shell and call it good. The last argument is false because we've
+  // already called BindHitNucleon()
+  int neval = 0;
+  auto xsec = [&] (double costh, double phi) {
+    neval++;
+    return genie::utils::ComputeFullQELPXSec(interaction,
+      fNuclModel, fXSecModel, costh, phi, dummy_Eb, kOnShell, fMinAngleEM, false);
+  };
+
+  // Coarse scan
+  double dcosth = (costh_max - costh_min) / N_theta;
+  double dphi   = (phi_max - phi_min) / N_phi;
+  double costh_best = costh_min;
+  double phi_best   = phi_min;
+  double xsec_best  = -1;
+  for (int itheta = 0; itheta <= N_theta; itheta++) {
+    double costh = costh_min + itheta * dcosth;
+    for (int iphi = 0; iphi < N_phi; iphi++) {
+      double phi = phi_min + iphi * dphi;
+      double xs = xsec(costh, phi);
+      if (xs > xsec_best) {
+        costh_best = costh;
+        phi_best   = phi;
+        xsec_best  = xs;
+      }
+    }
+  }
+  if (xsec_best <= 0.) return xsec_best;
+
+  // Local refinement
+  double tolerance = acceptable_fraction_of_safety_factor * (fSafetyFactor-1);
+  double xsec_at_last_halving = xsec_best;
+  dcosth /= 2.;
+  dphi   /= 2.;
+  while (neval < max_n_eval) {
+    const double costh_steps[4] = { dcosth, -dcosth, 0., 0. };
+    const double phi_steps  [4] = { 0., 0., dphi, -dphi };
+    bool improved = false;
+    for (int i = 0; i < 4; i++) {
+      double costh = std::min(costh_max,
+                        std::max(costh_min, costh_best + costh_steps[i]));
+      double phi   = phi_best + phi_steps[i];
+      double xs = xsec(costh, phi);
+      if (xs > xsec_best) {
+        costh_best = costh;
+        phi_best   = phi;
+        xsec_best  = xs;
+        improved   = true;
+      }
+    }
+    if (improved) continue;
+
+    // no better neighbour: shrink the steps
+    if (xsec_best/xsec_at_last_halving - 1. < tolerance &&
+        dcosth < (costh_max - costh_min) / (4*N_theta)) break;
+    xsec_at_last_halving = xsec_best;
+    dcosth /= 2.;
+    dphi   /= 2.;
+  }
+
+  LOG("QELEvent", pDEBUG)
+     << "Max xsec over COM angles = " << xsec_best << " at cos(theta_0) = "
+     << costh_best << ", phi_0 = " << phi_best << " (" << neval
+     << " xsec evaluations)";
+
+  return xsec_best;
+}
+//____________________________________________________________________________
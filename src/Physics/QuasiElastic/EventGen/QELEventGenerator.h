@@ -48,6 +48,7 @@ private:
 
   void   LoadConfig     (void);
   double ComputeMaxXSec(const Interaction* in) const;
+  double MaxXSecOverAngles (Interaction * interaction) const;
 
   void AddTargetNucleusRemnant (GHepRecord * evrec) const; ///< add a recoiled nucleus remnant
 
@@ -198,6 +198,7 @@ void QELEventGeneratorSM::ProcessEventRecord(GHepRecord * evrec) const
      // If the generated kinematics are accepted, finish-up module's job
      if(accept)
      {
+       this->RecordAccepted(interaction, iter+1);
        interaction->ResetBit(kISkipProcessChk);
        interaction->ResetBit(kISkipKinematicChk);
        break;
@@ -602,10 +603,9 @@ double QELEventGeneratorSM::FindMaxXSec2(
   // if there are not enough points at the cache buffer to have a spline,
   // look whether there is another point that is sufficiently close
   double dE = TMath::Min(0.25, 0.05*E);
-  const map<double,double> & fmap = cb->Map();
-  map<double,double>::const_iterator iter = fmap.lower_bound(E);
-  if(iter != fmap.end()) {
-     if(TMath::Abs(E - iter->first) < dE) return iter->second;
+  double Ec = 0, xsec_c = 0;
+  if(cb->FindAbove(E, Ec, xsec_c)) {
+     if(TMath::Abs(E - Ec) < dE) return xsec_c;
   }
 
   return -1;
@@ -623,7 +623,7 @@ void QELEventGeneratorSM::CacheMaxXSec2(
   if(max_xsec>0) cb->AddValues(E,max_xsec);
 
   if(! cb->Spl() ) {
-    if( cb->Map().size() > 40 ) cb->CreateSpline();
+    if( cb->NPoints() > 40 ) cb->CreateSpline();
   }
 
   if( cb->Spl() ) {
@@ -641,6 +641,13 @@ CacheBranchFx * QELEventGeneratorSM::AccessCacheBranch2(
 
   Cache * cache = Cache::Instance();
 
+  // look up the branch by its hash key first, so that the string key is
+  // only built once per interaction
+  uint64_t hkey = Cache::CacheBranchHash(this->Id().Key(), interaction->Hash(), "2nd");
+  CacheBranchFx * indexed_branch =
+              dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(hkey));
+  if(indexed_branch) return indexed_branch;
+
   // build the cache branch key as: namespace::algorithm/config/interaction
   string algkey = this->Id().Key();
   string intkey = interaction->AsString();
@@ -657,6 +664,7 @@ CacheBranchFx * QELEventGeneratorSM::AccessCacheBranch2(
     cache->AddCacheBranch(key, cache_branch);
   }
   assert(cache_branch);
+  cache->IndexCacheBranch(hkey, cache_branch);
 
   return cache_branch;
 }
@@ -755,11 +763,10 @@ double QELEventGeneratorSM::FindMaxDiffv(const Interaction * interaction) const
   // if there are not enough points at the cache buffer to have a spline,
   // look whether there is another point that is sufficiently close
   double dE = TMath::Min(0.25, 0.05*E);
-  const map<double,double> & fmap = cb->Map();
-  map<double,double>::const_iterator iter = fmap.lower_bound(E);
-  if(iter != fmap.end())
+  double Ec = 0, diffv_c = 0;
+  if(cb->FindAbove(E, Ec, diffv_c))
   {
-     if(TMath::Abs(E - iter->first) < dE) return iter->second;
+     if(TMath::Abs(E - Ec) < dE) return diffv_c;
   }
 
   return -1;
@@ -777,7 +784,7 @@ void QELEventGeneratorSM::CacheMaxDiffv(const Interaction * interaction, double
 
   if(! cb->Spl() )
   {
-    if( cb->Map().size() > 40 ) cb->CreateSpline();
+    if( cb->NPoints() > 40 ) cb->CreateSpline();
   }
 
   if( cb->Spl() )
@@ -796,6 +803,13 @@ CacheBranchFx * QELEventGeneratorSM::AccessCacheBranchDiffv(const Interaction *
 
   Cache * cache = Cache::Instance();
 
+  // look up the branch by its hash key first, so that the string key is
+  // only built once per interaction
+  uint64_t hkey = Cache::CacheBranchHash(this->Id().Key(), interaction->Hash(), "diffv");
+  CacheBranchFx * indexed_branch =
+              dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(hkey));
+  if(indexed_branch) return indexed_branch;
+
   // build the cache branch key as: namespace::algorithm/config/interaction
   string algkey = this->Id().Key();
   string intkey = interaction->AsString();
@@ -813,6 +827,7 @@ CacheBranchFx * QELEventGeneratorSM::AccessCacheBranchDiffv(const Interaction *
     cache->AddCacheBranch(key, cache_branch);
   }
   assert(cache_branch);
+  cache->IndexCacheBranch(hkey, cache_branch);
 
   return cache_branch;
 }
@@ -293,6 +293,13 @@ InteractionList *
   return intlist;
 }
 //____________________________________________________________________________
+string QELInteractionListGenerator::TargetClass(const Target & target) const
+{
+// The list only depends on whether the target has protons and neutrons
+
+  return InteractionListGeneratorI::NucleonContentClass(target);
+}
+//____________________________________________________________________________
 void QELInteractionListGenerator::Configure(const Registry & config)
 {
   Algorithm::Configure(config);
@@ -33,6 +33,7 @@ public :
 
   // implement the InteractionListGeneratorI interface
   InteractionList * CreateInteractionList(const InitialState & init) const;
+  string            TargetClass          (const Target & target) const;
 
   // overload the Algorithm::Configure() methods to load private data
   // members from configuration options
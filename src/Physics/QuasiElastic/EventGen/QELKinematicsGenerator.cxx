@@ -165,6 +165,7 @@ void QELKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {
+        this->RecordAccepted(interaction, iter);
         LOG("QELKinematics", pINFO) << "Selected: Q^2 = " << gQ2;
 
         // reset bits
@@ -384,6 +385,7 @@ void QELKinematicsGenerator::SpectralFuncExperimentalCode(
 
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {
+        this->RecordAccepted(interaction, iter);
         LOG("QELKinematics", pNOTICE) << "Selected: Q^2 = " << gQ2;
 
         // reset bits
@@ -14,6 +14,7 @@
 #include <string>
 
 #include "Physics/QuasiElastic/XSection/AxialFormFactor.h"
+#include "Physics/QuasiElastic/XSection/FormFactorMemo.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/MathUtils.h"
@@ -59,7 +60,13 @@ void AxialFormFactor::Calculate(const Interaction * interaction)
     this->Reset("D");
   }
   else {
+    // see ELFormFactors::Calculate()
+    static thread_local FormFactorMemo<1> memo;
+    FormFactorMemoKey key;
+    bool memoize = key.Set(this->fModel, interaction);
+    if(memoize && memo.Find(key, &this->fFA)) return;
     this->fFA = this->fModel->FA(interaction);
+    if(memoize) memo.Store(key, &this->fFA);
   }
 }
 //____________________________________________________________________________
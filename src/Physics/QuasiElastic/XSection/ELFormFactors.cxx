@@ -11,6 +11,7 @@
 #include <string>
 
 #include "Physics/QuasiElastic/XSection/ELFormFactors.h"
+#include "Physics/QuasiElastic/XSection/FormFactorMemo.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/MathUtils.h"
@@ -56,10 +57,30 @@ void ELFormFactors::Calculate(const Interaction * interaction)
     this->Reset("D");
   }
   else {
+    // the same form factors are typically asked for several times per
+    // cross section call: look them up in the per-thread memo first
+    static thread_local FormFactorMemo<4> memo;
+    FormFactorMemoKey key;
+    bool memoize = key.Set(this->fModel, interaction);
+    double ff[4];
+    if(memoize && memo.Find(key, ff)) {
+      this->fGep = ff[0];
+      this->fGmp = ff[1];
+      this->fGen = ff[2];
+      this->fGmn = ff[3];
+      return;
+    }
     this->fGep = this->fModel->Gep(interaction);
     this->fGmp = this->fModel->Gmp(interaction);
     this->fGen = this->fModel->Gen(interaction);
     this->fGmn = this->fModel->Gmn(interaction);
+    if(memoize) {
+      ff[0] = this->fGep;
+      ff[1] = this->fGmp;
+      ff[2] = this->fGen;
+      ff[3] = this->fGmn;
+      memo.Store(key, ff);
+    }
   }
 }
 //____________________________________________________________________________
@@ -0,0 +1,113 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::FormFactorMemo
+
+\brief    A small memo of recently computed form factors.
+
+          The QEL form factor models (LwlynSmithFF and friends) evaluate the
+          same elastic and axial form factors several times per cross section
+          call (eg F1V and xiF2V both need Gep, Gmp, Gen and Gmn), and the
+          CC and NC variants attach the same form factor models. The memo
+          keeps the last few results, keyed on the model, the configuration
+          epoch (see Algorithm::ConfigEpoch()) and everything the form factor
+          models read from the interaction: Q2, the target & hit nucleon and
+          the probe energy.
+
+          The memo is not thread-safe; ELFormFactors and AxialFormFactor keep
+          one per thread.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _FORM_FACTOR_MEMO_H_
+#define _FORM_FACTOR_MEMO_H_
+
+#include "Framework/Algorithm/Algorithm.h"
+#include "Framework/Interaction/Interaction.h"
+
+namespace genie {
+
+class FormFactorMemoKey {
+
+public:
+  FormFactorMemoKey() : fModel(0), fEpoch(0), fQ2(0), fTgtPdg(0), fHitNucPdg(0), fE(0) { }
+
+  //! Set the key for the input model & interaction. Returns false if the
+  //! interaction has no Q2 set (the result is then not memoized)
+  bool Set(const Algorithm * model, const Interaction * interaction)
+  {
+    const Kinematics & kine = interaction->Kine();
+    if      (kine.KVSet(kKVQ2)) fQ2 =    kine.GetKV(kKVQ2);
+    else if (kine.KVSet(kKVq2)) fQ2 = -1*kine.GetKV(kKVq2);
+    else return false;
+
+    const InitialState & init_state = interaction->InitState();
+    fModel     = model;
+    fEpoch     = Algorithm::ConfigEpoch();
+    fTgtPdg    = init_state.Tgt().Pdg();
+    fHitNucPdg = init_state.Tgt().HitNucPdg();
+    fE         = init_state.ProbeE(kRfLab);
+    return true;
+  }
+
+  bool operator == (const FormFactorMemoKey & key) const
+  {
+    return fModel == key.fModel && fEpoch     == key.fEpoch     &&
+           fQ2    == key.fQ2    && fTgtPdg    == key.fTgtPdg    &&
+           fE     == key.fE     && fHitNucPdg == key.fHitNucPdg;
+  }
+
+private:
+  const Algorithm * fModel;
+  unsigned long     fEpoch;
+  double            fQ2;
+  int               fTgtPdg;
+  int               fHitNucPdg;
+  double            fE;
+};
+
+template<unsigned int NFF, unsigned int NEntries = 8>
+class FormFactorMemo {
+
+public:
+  FormFactorMemo() : fNEntries(0), fNext(0) { }
+
+  //! Copy the memoized form factors for the input key to ff, if any
+  bool Find(const FormFactorMemoKey & key, double * ff) const
+  {
+    for(unsigned int i = 0; i < fNEntries; i++) {
+      if(fKeys[i] == key) {
+        for(unsigned int k = 0; k < NFF; k++) ff[k] = fValues[i][k];
+        return true;
+      }
+    }
+    return false;
+  }
+
+  //! Memoize the form factors for the input key, replacing the oldest entry
+  void Store(const FormFactorMemoKey & key, const double * ff)
+  {
+    fKeys[fNext] = key;
+    for(unsigned int k = 0; k < NFF; k++) fValues[fNext][k] = ff[k];
+    fNext = (fNext + 1) % NEntries;
+    if(fNEntries < NEntries) fNEntries++;
+  }
+
+private:
+  FormFactorMemoKey fKeys   [NEntries];
+  double            fValues [NEntries][NFF];
+  unsigned int      fNEntries;
+  unsigned int      fNext;
+};
+
+}        // genie namespace
+
+#endif   // _FORM_FACTOR_MEMO_H_
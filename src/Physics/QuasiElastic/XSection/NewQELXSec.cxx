@@ -36,12 +36,14 @@ using namespace genie::constants;
 using namespace genie::utils::gsl;
 
 //____________________________________________________________________________
-NewQELXSec::NewQELXSec() : XSecIntegratorI("genie::NewQELXSec")
+NewQELXSec::NewQELXSec() : XSecIntegratorI("genie::NewQELXSec"),
+  fNucleonSamplesEpoch(0)
 {
 
 }
 //____________________________________________________________________________
-NewQELXSec::NewQELXSec(std::string config) : XSecIntegratorI("genie::NewQELXSec", config)
+NewQELXSec::NewQELXSec(std::string config) : XSecIntegratorI("genie::NewQELXSec", config),
+  fNucleonSamplesEpoch(0)
 {
 
 }
@@ -76,8 +78,6 @@ double NewQELXSec::Integrate(const XSecAlgorithmI* model, const Interaction* in)
 
   utils::gsl::FullQELdXSec* func = new utils::gsl::FullQELdXSec(model,
     interaction, bind_mode, fMinAngleEM);
-  ROOT::Math::IntegrationMultiDim::Type ig_type =
-    utils::gsl::IntegrationNDimTypeFromString( fGSLIntgType );
 
   // Switch to using the copy of the interaction in the integrator rather than
   // the copy that we made in this function
@@ -87,8 +87,9 @@ double NewQELXSec::Integrate(const XSecAlgorithmI* model, const Interaction* in)
   // Also update the pointer to the Target
   tgt = interaction->InitState().TgtPtr();
 
+  // The integrator is taken from the per-thread workspace of IntegrateMultiDim
+  // and re-used for every sampled nucleon
   double abstol = 1e-16; // We mostly care about relative tolerance
-  ROOT::Math::IntegratorMultiDim ig(*func, ig_type, abstol, fGSLRelTol, fGSLMaxEval);
 
   // Integration ranges for the lepton COM frame scattering angles (in the
   // kPSQELEvGen phase space, these are measured with respect to the COM
@@ -121,7 +122,8 @@ double NewQELXSec::Integrate(const XSecAlgorithmI* model, const Interaction* in)
     }
 
     nucl_model->SetMomentum3( TVector3(0., 0., 0.) );
-    double xsec_total = ig.Integral(kine_min, kine_max);
+    double xsec_total = utils::gsl::IntegrateMultiDim(*func, fGSLIntgType,
+      kine_min, kine_max, abstol, fGSLRelTol, fGSLMaxEval);
     delete func;
     return xsec_total;
   }
@@ -129,38 +131,107 @@ double NewQELXSec::Integrate(const XSecAlgorithmI* model, const Interaction* in)
   // For a nuclear target, we need to loop over a bunch of nucleons sampled
   // from the nuclear model (with positions sampled from the vertex generator
   // to allow for using the local Fermi gas model). The MC estimator for the
-  // total cross section is simply the mean of ig.Integral() for all of the
+  // total cross section is simply the mean of the angular integrals for all of the
   // sampled nucleons.
-  double xsec_sum = 0.;
-  for (int n = 0; n < fNumNucleonThrows; ++n) {
-
-    // Select a new position for the initial hit nucleon (needed for the local
-    // Fermi gas model, but other than slowing things down a bit, it doesn't
-    // hurt to do this for other models)
-    TVector3 vertex_pos = vtx_gen->GenerateVertex( interaction, tgt->A() );
-    double radius = vertex_pos.Mag();
-    tgt->SetHitNucPosition( radius );
+  // If requested, the same set of nucleons is used at every energy, so that
+  // the statistical fluctuations of the estimate are correlated across the
+  // knots of a spline (which is then smooth in energy), and the throws stop
+  // once the standard error of the mean is small enough.
+  const std::vector<NucleonThrow> * sample = 0;
+  if ( fSharedNucleonThrows ) {
+    sample = &this->NucleonSample( nucl_model, vtx_gen, interaction );
+  }
 
-    // Sample a new nucleon 3-momentum and removal energy (this will be applied
-    // to the nucleon via a call to genie::utils::ComputeFullQELPXSec(), so
-    // there's no need to mess with its 4-momentum here)
-    nucl_model->GenerateNucleon(*tgt, radius);
+  double xsec_sum = 0.;
+  double xsec_sum2 = 0.;
+  int nthrows = 0;
+  while ( nthrows < fNumNucleonThrows ) {
+
+    if ( sample ) {
+      // Restore the position, momentum and removal energy of a stored throw
+      const NucleonThrow & nt = (*sample)[ nthrows ];
+      tgt->SetHitNucPosition( nt.fRadius );
+      nucl_model->SetMomentum3( nt.fMomentum );
+      nucl_model->SetRemovalEnergy( nt.fRemovalEnergy );
+    }
+    else {
+      // Select a new position for the initial hit nucleon (needed for the local
+      // Fermi gas model, but other than slowing things down a bit, it doesn't
+      // hurt to do this for other models)
+      TVector3 vertex_pos = vtx_gen->GenerateVertex( interaction, tgt->A() );
+      double radius = vertex_pos.Mag();
+      tgt->SetHitNucPosition( radius );
+
+      // Sample a new nucleon 3-momentum and removal energy (this will be applied
+      // to the nucleon via a call to genie::utils::ComputeFullQELPXSec(), so
+      // there's no need to mess with its 4-momentum here)
+      nucl_model->GenerateNucleon(*tgt, radius);
+    }
 
     // The initial state variables have all been defined, so integrate over
     // the final lepton angles.
-    double xsec = ig.Integral(kine_min, kine_max);
+    double xsec = utils::gsl::IntegrateMultiDim(*func, fGSLIntgType,
+      kine_min, kine_max, abstol, fGSLRelTol, fGSLMaxEval);
 
     xsec_sum += xsec;
+    xsec_sum2 += xsec * xsec;
+    ++nthrows;
+
+    // Stop early if the relative standard error of the mean is small enough
+    if ( fNucleonThrowsRelErr > 0. && nthrows >= fMinNumNucleonThrows && xsec_sum > 0. ) {
+      double mean = xsec_sum / nthrows;
+      double var = TMath::Max( 0., xsec_sum2 / nthrows - mean * mean );
+      double err = TMath::Sqrt( var / nthrows );
+      if ( err < fNucleonThrowsRelErr * mean ) break;
+    }
   }
 
   delete func;
 
+  LOG("NewQELXSec", pDEBUG) << "Integrated over " << nthrows << " nucleon throws";
+
   // MC estimator of the total cross section is the mean of the xsec values
-  double xsec_mean = xsec_sum / fNumNucleonThrows;
+  double xsec_mean = xsec_sum / nthrows;
 
   return xsec_mean;
 }
 //____________________________________________________________________________
+const std::vector<NewQELXSec::NucleonThrow> & NewQELXSec::NucleonSample(
+  const NuclearModelI* nucl_model, const VertexGenerator* vtx_gen,
+  Interaction* interaction) const
+{
+  // Drop the samples drawn for an earlier configuration
+  if ( fNucleonSamplesEpoch != Algorithm::ConfigEpoch() ) {
+    fNucleonSamples.clear();
+    fNucleonSamplesEpoch = Algorithm::ConfigEpoch();
+  }
+
+  Target* tgt = interaction->InitState().TgtPtr();
+  NucleonSampleKey_t key( nucl_model, std::make_pair(tgt->Pdg(), tgt->HitNucPdg()) );
+
+  std::map<NucleonSampleKey_t, std::vector<NucleonThrow> >::iterator it
+    = fNucleonSamples.find( key );
+  if ( it != fNucleonSamples.end() ) return it->second;
+
+  LOG("NewQELXSec", pINFO) << "Drawing " << fNumNucleonThrows
+    << " nucleon throws for target " << tgt->Pdg() << ", hit nucleon "
+    << tgt->HitNucPdg() << " (re-used at all energies)";
+
+  std::vector<NucleonThrow> & sample = fNucleonSamples[ key ];
+  sample.resize( fNumNucleonThrows );
+  for (int n = 0; n < fNumNucleonThrows; ++n) {
+    TVector3 vertex_pos = vtx_gen->GenerateVertex( interaction, tgt->A() );
+    double radius = vertex_pos.Mag();
+    tgt->SetHitNucPosition( radius );
+    nucl_model->GenerateNucleon(*tgt, radius);
+
+    sample[n].fRadius = radius;
+    sample[n].fMomentum = nucl_model->Momentum3();
+    sample[n].fRemovalEnergy = nucl_model->RemovalEnergy();
+  }
+  return sample;
+}
+//____________________________________________________________________________
 void NewQELXSec::Configure(const Registry & config)
 {
   Algorithm::Configure(config);
@@ -187,6 +258,14 @@ void NewQELXSec::LoadConfig(void)
   fVertexGenID = AlgId( vertexGenID );
 
   GetParamDef( "NumNucleonThrows", fNumNucleonThrows, 5000 );
+  fNumNucleonThrows = TMath::Max( fNumNucleonThrows, 1 );
+
+  // Re-use the same nucleon throws at every energy, and stop throwing once
+  // the relative standard error of the xsec estimate is below the tolerance
+  GetParamDef( "SharedNucleonThrows", fSharedNucleonThrows, false );
+  GetParamDef( "NucleonThrowsRelTolerance", fNucleonThrowsRelErr, 0. );
+  GetParamDef( "MinNumNucleonThrows", fMinNumNucleonThrows, 100 );
+  fNucleonSamples.clear();
 
   // TODO: This is a parameter that may also be specified in the XML
   // configuration for QELEventGenerator. Avoid duplication here to ensure
@@ -22,7 +22,12 @@
 #include "Physics/XSectionIntegration/XSecIntegratorI.h"
 #include "Physics/QuasiElastic/XSection/QELUtils.h"
 
+#include <map>
+#include <utility>
+#include <vector>
+
 #include "TMath.h"
+#include "TVector3.h"
 #include "Math/IFunction.h"
 #include "Math/Integrator.h"
 
@@ -80,6 +85,20 @@ private:
 
   void LoadConfig (void);
 
+  /// A hit nucleon drawn from the nuclear model: its position and the
+  /// momentum & removal energy it was given
+  struct NucleonThrow {
+    double   fRadius;
+    TVector3 fMomentum;
+    double   fRemovalEnergy;
+  };
+  typedef std::pair<const NuclearModelI*, std::pair<int,int> > NucleonSampleKey_t;
+
+  /// The fixed set of nucleon throws used at all energies for the input
+  /// nuclear model, target & hit nucleon (see "SharedNucleonThrows")
+  const std::vector<NucleonThrow> & NucleonSample (const NuclearModelI* nucl_model,
+    const VertexGenerator* vtx_gen, Interaction* interaction) const;
+
   // Configuration obtained from cross section model
   //QELEvGen_BindingMode_t fBindingMode;
 
@@ -90,6 +109,12 @@ private:
   AlgId fVertexGenID;
   int fNumNucleonThrows;
   double fMinAngleEM;
+  bool fSharedNucleonThrows;       ///< re-use one set of nucleon throws at all energies?
+  double fNucleonThrowsRelErr;     ///< stop throwing once the relative std error of the mean is below it (<=0: never)
+  int fMinNumNucleonThrows;        ///< min number of nucleon throws before checking the error
+
+  mutable std::map<NucleonSampleKey_t, std::vector<NucleonThrow> > fNucleonSamples;
+  mutable unsigned long fNucleonSamplesEpoch; ///< Algorithm::ConfigEpoch() the samples were drawn at
 };
 
 
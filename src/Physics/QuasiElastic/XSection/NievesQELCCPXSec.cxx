@@ -14,8 +14,13 @@
 #include <Math/IFunction.h>
 #include <Math/Integrator.h>
 #include <complex>
+#include <cmath>
+#include <algorithm>
+#include <sstream>
+#include <iomanip>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
+#include "Framework/Algorithm/AlgSharedData.h"
 #include "Physics/XSectionIntegration/XSecIntegratorI.h"
 #include "Physics/QuasiElastic/XSection/QELFormFactors.h"
 #include "Physics/QuasiElastic/XSection/QELFormFactorsModelI.h"
@@ -49,15 +54,77 @@ using namespace genie::constants;
 using namespace genie::controls;
 using namespace genie::utils;
 
+//____________________________________________________________________________
+namespace {
+  // nu range of the Lindhard function tables, slightly beyond the edges of
+  // the particle-hole continuum (at nu = 0, 1), which are not on nodes
+  const double kLindhardNuMin = -0.25;
+  const double kLindhardNuMax =  1.25;
+
+  // Edges of the particle-hole continuum of a Fermi gas in q0
+  inline void ParticleHoleEdges(double dq, double kF, double M,
+                                double & q0min, double & q0max)
+  {
+    double EF = TMath::Sqrt(M*M + kF*kF);
+    q0max = TMath::Sqrt(M*M + (kF+dq)*(kF+dq)) - EF;
+    q0min = (dq > 2*kF) ? TMath::Sqrt(M*M + (dq-kF)*(dq-kF)) - EF : 0.;
+  }
+
+  // Trilinear interpolation of a table in the cell starting at i0
+  inline double Trilinear(const std::vector<float> & f, int i0,
+                          int skf, int sq, double a, double b, double c)
+  {
+    const float * p = &f[i0];
+    double f00 = p[0]      + c*(p[1]      - p[0]);
+    double f01 = p[sq]     + c*(p[sq+1]     - p[sq]);
+    double f10 = p[skf]    + c*(p[skf+1]    - p[skf]);
+    double f11 = p[skf+sq] + c*(p[skf+sq+1] - p[skf+sq]);
+    double f0  = f00 + b*(f01 - f00);
+    double f1  = f10 + b*(f11 - f10);
+    return f0 + a*(f1 - f0);
+  }
+
+  // Largest relative difference between the RPA factors of CNCTCLimUcalc()
+  // (for the largest g') computed with two sets of Lindhard functions
+  double RPAFactorsDiff(double q0, double dq, double hbarc,
+     std::complex<double> relLin1, std::complex<double> udel1,
+     std::complex<double> relLin2, std::complex<double> udel2)
+  {
+    double q2  = q0*q0 - dq*dq;
+    double dq2 = dq*dq;
+    double fPrime = 0.45*0.380/hbarc;
+    double Vt = 0.08*4*kPi/kPionMass2 *
+      (2* TMath::Power((6.25-0.5929)/(6.25-q2),2)*dq2/(q2-0.5929) + 0.63);
+    double Vl = 0.08*4*kPi/kPionMass2 *
+      (TMath::Power((1.44-kPionMass2)/(1.44-q2),2)*dq2/(q2-kPionMass2)+0.63);
+
+    double C1[3] = { std::norm(1.0-fPrime*relLin1/(hbarc*hbarc)),
+                     std::norm(1.0-(relLin1+udel1)*Vt),
+                     std::norm(1.0-(relLin1+udel1)*Vl) };
+    double C2[3] = { std::norm(1.0-fPrime*relLin2/(hbarc*hbarc)),
+                     std::norm(1.0-(relLin2+udel2)*Vt),
+                     std::norm(1.0-(relLin2+udel2)*Vl) };
+    double diff = 0;
+    for(int i = 0; i < 3; i++) {
+      // relative difference of 1/|..|^2, to first order
+      double d = TMath::Abs(C1[i]-C2[i])/C1[i];
+      if(std::isnan(d)) return d;
+      if(d > diff) diff = d;
+    }
+    return diff;
+  }
+}
 //____________________________________________________________________________
 NievesQELCCPXSec::NievesQELCCPXSec() :
-XSecAlgorithmI("genie::NievesQELCCPXSec")
+XSecAlgorithmI("genie::NievesQELCCPXSec"),
+fTabulateLindhard(false)
 {
 
 }
 //____________________________________________________________________________
 NievesQELCCPXSec::NievesQELCCPXSec(string config) :
-XSecAlgorithmI("genie::NievesQELCCPXSec", config)
+XSecAlgorithmI("genie::NievesQELCCPXSec", config),
+fTabulateLindhard(false)
 {
 
 }
@@ -423,6 +490,51 @@ void NievesQELCCPXSec::LoadConfig(void)
 
   LOG("Nieves", pNOTICE) << "RPA=" << fRPA << ", useCoulomb=" << fCoulomb;
 
+  // Interpolate the Lindhard functions of the RPA corrections from tables?
+  GetParamDef( "RPA-TabulateLindhard", fTabulateLindhard, false ) ;
+
+  fLindhardTable.reset();
+  if ( fRPA && fTabulateLindhard ) {
+    int    nkf, nq, nnu;
+    double kfmin, kfmax, qmin, qmax, tolerance;
+    GetParamDef( "RPA-Lindhard-NKF",       nkf,       41    ) ;
+    GetParamDef( "RPA-Lindhard-NQ",        nq,        201   ) ;
+    GetParamDef( "RPA-Lindhard-NNu",       nnu,       101   ) ;
+    GetParamDef( "RPA-Lindhard-KFMin",     kfmin,     0.05  ) ;
+    GetParamDef( "RPA-Lindhard-KFMax",     kfmax,     0.30  ) ;
+    GetParamDef( "RPA-Lindhard-QMin",      qmin,      0.02  ) ;
+    GetParamDef( "RPA-Lindhard-QMax",      qmax,      2.0   ) ;
+    GetParamDef( "RPA-Lindhard-Tolerance", tolerance, 1E-3  ) ;
+
+    if ( nkf < 2 || nq < 2 || nnu < 2 || kfmin <= 0 || kfmin >= kfmax ||
+         qmin <= 0 || qmin >= qmax ) {
+      LOG("Nieves", pFATAL)
+        << "Invalid Lindhard function table: " << nkf << " kF nodes in ["
+        << kfmin << ", " << kfmax << "], " << nq << " |q| nodes in ["
+        << qmin << ", " << qmax << "], " << nnu << " q0 nodes";
+      gAbortingInErr = true;
+      std::exit(1);
+    }
+
+    // The tables are used for the "nucleon mass" of XSec(), the mean of
+    // the hit and recoil nucleon masses
+    PDGLibrary * pdglib = PDGLibrary::Instance();
+    double M = ( pdglib->Find(kPdgNeutron)->Mass() +
+                 pdglib->Find(kPdgProton )->Mass() ) / 2.;
+
+    std::ostringstream key;
+    key << "NievesQELCCPXSec/Lindhard/" << std::setprecision(17) << M
+        << "/" << nkf << "," << kfmin << "," << kfmax
+        << "/" << nq  << "," << qmin  << "," << qmax
+        << "/" << nnu << "/" << tolerance;
+
+    fLindhardTable = AlgSharedData::Instance()->Get<LindhardTable>(key.str(),
+      [this, M, nkf, nq, nnu, kfmin, kfmax, qmin, qmax, tolerance] () {
+        return this->BuildLindhardTable(M, nkf, nq, nnu,
+                                        kfmin, kfmax, qmin, qmax, tolerance);
+      });
+  }
+
   // Get nuclear model for use in Integral()
   RgKey nuclkey = "IntegralNuclearModel";
   fNuclModel = dynamic_cast<const NuclearModelI *> (this->SubAlg(nuclkey));
@@ -468,6 +580,9 @@ void NievesQELCCPXSec::LoadConfig(void)
     std::exit(1);
   }
 
+  // The Coulomb potential tables depend on Rmax
+  fCoulombTables.clear();
+
   // Method to use to calculate the binding energy of the initial hit nucleon when
   // generating splines
   std::string temp_binding_mode;
@@ -539,9 +654,12 @@ void NievesQELCCPXSec::CNCTCLimUcalc(TLorentzVector qTildeP4,
     std::complex<double> relLin(0,0),udel(0,0);
 
     // By comparison with Nieves' fortran code
-    if(imaginaryU < 0.){
-      relLin = relLindhard(qTildeP4.E(),dq,kF,M,is_neutrino,imU);
-      udel = deltaLindhard(qTildeP4.E(),dq,rho,kF);
+    // (the RPA factors are not used if RPA is off)
+    if(fRPA && imaginaryU < 0.){
+      if(! this->InterpolateLindhard(qTildeP4.E(),dq,kF,M,relLin,udel)) {
+        relLin = relLindhard(qTildeP4.E(),dq,kF,M,is_neutrino,imU);
+        udel = deltaLindhard(qTildeP4.E(),dq,rho,kF);
+      }
     }
     std::complex<double> relLinTot(relLin + udel);
 
@@ -637,19 +755,30 @@ std::complex<double> NievesQELCCPXSec::relLindhard(double q0gev,
 {
   double q0 = q0gev/fhbarc;
   double qm = dqgev/fhbarc;
-  double kf = kFgev/fhbarc;
-  double m = M/fhbarc;
 
   if(q0>qm){
     LOG("Nieves", pWARN) << "relLindhard() failed";
     return 0.0;
   }
 
-  std::complex<double> RealLinRel(ruLinRelX(q0,qm,kf,m)+ruLinRelX(-q0,qm,kf,m));
+  std::complex<double> RealLinRel(relLindhardRe(q0gev,dqgev,kFgev,M));
   double t0,r00;
   std::complex<double> ImLinRel(relLindhardIm(q0gev,dqgev,kFgev,kFgev,M,isNeutrino,t0,r00));
   //Units of GeV^2
-  return(RealLinRel*TMath::Power(fhbarc,2) + 2.0*ImLinRel);
+  return(RealLinRel + 2.0*ImLinRel);
+}
+//____________________________________________________________________________
+//Takes inputs in GeV, and gives output in GeV^2
+std::complex<double> NievesQELCCPXSec::relLindhardRe(double q0gev,
+                        double dqgev, double kFgev, double M) const
+{
+  double q0 = q0gev/fhbarc;
+  double qm = dqgev/fhbarc;
+  double kf = kFgev/fhbarc;
+  double m = M/fhbarc;
+
+  std::complex<double> RealLinRel(ruLinRelX(q0,qm,kf,m)+ruLinRelX(-q0,qm,kf,m));
+  return RealLinRel*TMath::Power(fhbarc,2);
 }
 //____________________________________________________________________________
 //Inputs assumed to be in natural units
@@ -797,67 +926,249 @@ std::complex<double> NievesQELCCPXSec::deltaLindhard(double q0,
   return 2.0/3.0 * rho * md/(q_mod*k_fermi) * (pzeta +pzetap) * fdel_f2 *
     TMath::Power(fhbarc,2);
 }
+//____________________________________________________________________________
+bool NievesQELCCPXSec::InterpolateLindhard(double q0, double dq, double kF,
+  double M, std::complex<double> & relLin, std::complex<double> & udel) const
+{
+  const LindhardTable * t = fLindhardTable.get();
+  if ( !t || M != t->fM || q0 > dq ) return false;
+
+  double u = (kF - t->fKFMin) / t->fDKF;
+  double v = (dq - t->fQMin)  / t->fDQ;
+  if ( !(u >= 0 && u < t->fNKF-1 && v >= 0 && v < t->fNQ-1) ) return false;
+
+  double q0min, q0max;
+  ParticleHoleEdges(dq, kF, M, q0min, q0max);
+  double w = ((q0-q0min)/(q0max-q0min) - t->fNuMin) / t->fDNu;
+  if ( !(w >= 0 && w < t->fNNu-1) ) return false;
+
+  int ikf = (int) u;
+  int iq  = (int) v;
+  int inu = (int) w;
+  int i0  = (ikf*t->fNQ + iq)*t->fNNu + inu;
+  if ( !t->fCellOK[i0] ) return false;
+
+  int skf = t->fNQ*t->fNNu;
+  int sq  = t->fNNu;
+  double a = u-ikf, b = v-iq, c = w-inu;
+
+  double t0,r00;
+  relLin = Trilinear(t->fReLin, i0, skf, sq, a, b, c)
+         + 2.0*relLindhardIm(q0,dq,kF,kF,M,true,t0,r00);
+  udel   = std::complex<double>(Trilinear(t->fReDelta, i0, skf, sq, a, b, c),
+                                Trilinear(t->fImDelta, i0, skf, sq, a, b, c));
+  return true;
+}
+//____________________________________________________________________________
+NievesQELCCPXSec::LindhardTable * NievesQELCCPXSec::BuildLindhardTable(
+  double M, int nkf, int nq, int nnu, double kfmin, double kfmax,
+  double qmin, double qmax, double tolerance) const
+{
+  LOG("Nieves", pNOTICE)
+    << "Tabulating the RPA Lindhard functions on a " << nkf << " x "
+    << nq << " x " << nnu << " (kF, |q|, q0) grid";
+
+  LindhardTable * t = new LindhardTable;
+
+  t->fM     = M;
+  t->fNKF   = nkf;
+  t->fNQ    = nq;
+  t->fNNu   = nnu;
+  t->fKFMin = kfmin;
+  t->fDKF   = (kfmax-kfmin)/(nkf-1);
+  t->fQMin  = qmin;
+  t->fDQ    = (qmax-qmin)/(nq-1);
+  t->fNuMin = kLindhardNuMin;
+  t->fDNu   = (kLindhardNuMax-kLindhardNuMin)/(nnu-1);
+
+  int n = nkf*nq*nnu;
+  t->fReLin  .resize(n);
+  t->fReDelta.resize(n);
+  t->fImDelta.resize(n);
+  t->fCellOK .assign(n, 0);
+
+  // density giving the Fermi momentum kF (see CNCTCLimUcalc)
+  double hbarc = fhbarc;
+  auto rho = [hbarc] (double kF) {
+    return TMath::Power(kF/hbarc, 3) / (1.5*kPi2);
+  };
+
+  for(int ikf = 0; ikf < nkf; ikf++) {
+    double kF = t->fKFMin + ikf*t->fDKF;
+    for(int iq = 0; iq < nq; iq++) {
+      double dq = t->fQMin + iq*t->fDQ;
+      double q0min, q0max;
+      ParticleHoleEdges(dq, kF, M, q0min, q0max);
+      for(int inu = 0; inu < nnu; inu++) {
+        double q0 = q0min + (t->fNuMin + inu*t->fDNu)*(q0max-q0min);
+        std::complex<double> udel = deltaLindhard(q0,dq,rho(kF),kF);
+        int i = (ikf*nq + iq)*nnu + inu;
+        t->fReLin  [i] = relLindhardRe(q0,dq,kF,M).real();
+        t->fReDelta[i] = udel.real();
+        t->fImDelta[i] = udel.imag();
+      }
+    }
+  }
+
+  // Check the interpolation of the RPA factors at the cell centres
+  int skf = nq*nnu;
+  int sq  = nnu;
+  int nbad = 0;
+  for(int ikf = 0; ikf < nkf-1; ikf++) {
+    double kF = t->fKFMin + (ikf+0.5)*t->fDKF;
+    for(int iq = 0; iq < nq-1; iq++) {
+      double dq = t->fQMin + (iq+0.5)*t->fDQ;
+      double q0min, q0max;
+      ParticleHoleEdges(dq, kF, M, q0min, q0max);
+      for(int inu = 0; inu < nnu-1; inu++) {
+        double q0 = q0min + (t->fNuMin + (inu+0.5)*t->fDNu)*(q0max-q0min);
+        int i0 = (ikf*nq + iq)*nnu + inu;
+
+        double t0,r00;
+        std::complex<double> imLin = 2.0*relLindhardIm(q0,dq,kF,kF,M,true,t0,r00);
+
+        std::complex<double> relLin = relLindhardRe(q0,dq,kF,M) + imLin;
+        std::complex<double> udel   = deltaLindhard(q0,dq,rho(kF),kF);
+
+        std::complex<double> relLinInterp =
+            Trilinear(t->fReLin, i0, skf, sq, 0.5, 0.5, 0.5) + imLin;
+        std::complex<double> udelInterp(
+            Trilinear(t->fReDelta, i0, skf, sq, 0.5, 0.5, 0.5),
+            Trilinear(t->fImDelta, i0, skf, sq, 0.5, 0.5, 0.5));
+
+        double diff = RPAFactorsDiff(q0, dq, fhbarc,
+                                     relLin, udel, relLinInterp, udelInterp);
+        t->fCellOK[i0] = (diff <= tolerance);
+        if ( !t->fCellOK[i0] ) nbad++;
+      }
+    }
+  }
+  t->fNBadCells = nbad;
+
+  LOG("Nieves", pNOTICE)
+    << "Lindhard functions computed exactly in " << nbad << " of "
+    << (nkf-1)*(nq-1)*(nnu-1) << " grid cells (tolerance = " << tolerance << ")";
+
+  return t;
+}
 
 //____________________________________________________________________________
 // Gives coulomb potential in units of GeV
 double NievesQELCCPXSec::vcr(const Target * target, double Rcurr) const{
   if(target->IsNucleus()){
-    int A = target->A();
-    int Z = target->Z();
-    double Rmax = 0.;
-
-    if ( fCoulombRmaxMode == kMatchNieves ) {
-      // Rmax calculated using formula from Nieves' fortran code and default
-      // charge and neutron matter density parameters from NuclearUtils.cxx
-      if (A > 20) {
-        double c = TMath::Power(A,0.35), z = 0.54;
-        Rmax = c + 9.25*z;
-      }
-      else {
-        // c = 1.75 for A <= 20
-        Rmax = TMath::Sqrt(20.0)*1.75;
-      }
-    }
-    else if ( fCoulombRmaxMode == kMatchVertexGeneratorRmax ) {
-      // TODO: This solution is fragile. If the formula used by VertexGenerator
-      // changes, then this one will need to change too. Switch to using
-      // a common function to get Rmax for both.
-      Rmax = 3. * fR0 * std::pow(A, 1./3.);
-    }
-    else {
-      LOG("Nieves", pFATAL) << "Unrecognized setting for fCoulombRmaxMode encountered"
-        << " in NievesQELCCPXSec::vcr()";
-      gAbortingInErr = true;
-      std::exit(1);
+    int pdgc = target->Pdg();
+    std::map<int, std::shared_ptr<const CoulombTable> >::const_iterator it =
+      fCoulombTables.find(pdgc);
+    if ( it == fCoulombTables.end() ) {
+      // The potential depends only on the nucleus: tabulate it at first use
+      int A = target->A();
+      int Z = target->Z();
+      double Rmax = this->CoulombRmax(A);
+
+      std::ostringstream key;
+      key << "NievesQELCCPXSec/Coulomb/" << Z << "," << A << "/"
+          << std::setprecision(17) << Rmax;
+
+      std::shared_ptr<const CoulombTable> table =
+        AlgSharedData::Instance()->Get<CoulombTable>(key.str(),
+          [this, A, Z, Rmax] () {
+            return this->BuildCoulombTable(A, Z, Rmax);
+          });
+      it = fCoulombTables.insert(std::make_pair(pdgc, table)).first;
     }
+    const CoulombTable & t = *(it->second);
 
-    if(Rcurr >= Rmax){
+    if(Rcurr >= t.fRmax){
       LOG("Nieves",pNOTICE) << "Radius greater than maximum radius for coulomb corrections."
                           << " Integrating to max radius.";
-      Rcurr = Rmax;
+      return t.fV.back();
     }
 
-    ROOT::Math::IBaseFunctionOneDim * func = new
-      utils::gsl::wrap::NievesQELvcrIntegrand(Rcurr,A,Z);
-    ROOT::Math::IntegrationOneDim::Type ig_type =
-      utils::gsl::Integration1DimTypeFromString("adaptive");
-
-    double abstol = 1; // We mostly care about relative tolerance;
-    double reltol = 1E-4;
-    int nmaxeval = 100000;
-    ROOT::Math::Integrator ig(*func,ig_type,abstol,reltol,nmaxeval);
-    double result = ig.Integral(0,Rmax);
-    delete func;
-
-    // Multiply by Z to normalize densities to number of protons
-    // Multiply by hbarc to put result in GeV instead of fm
-    return -kAem*4*kPi*result*fhbarc;
+    // linear interpolation between the nodes bracketing Rcurr
+    double u = Rcurr / t.fDR;
+    int i = std::min( (int) u, (int) t.fV.size() - 2 );
+    double w = u - i;
+    return (1.-w) * t.fV[i] + w * t.fV[i+1];
   }else{
     // If target is not a nucleus the potential will be 0
     return 0.0;
   }
 }
 //____________________________________________________________________________
+NievesQELCCPXSec::CoulombTable * NievesQELCCPXSec::BuildCoulombTable(
+  int A, int Z, double Rmax) const
+{
+  // The potential is smooth in r: with this many nodes, the interpolation
+  // error is well below the relative tolerance of the integration
+  const int nr = 501;
+
+  LOG("Nieves", pNOTICE)
+    << "Tabulating the Coulomb potential of nucleus (Z,A) = (" << Z << ","
+    << A << ") at " << nr << " radii up to Rmax = " << Rmax << " fm";
+
+  CoulombTable * t = new CoulombTable;
+  t->fRmax = Rmax;
+  t->fDR   = Rmax / (nr-1);
+  t->fV.resize(nr);
+  for(int i = 0; i < nr; i++) {
+    double r = (i == nr-1) ? Rmax : i * t->fDR;
+    t->fV[i] = this->vcrIntegral(A, Z, r, Rmax);
+  }
+  return t;
+}
+//____________________________________________________________________________
+double NievesQELCCPXSec::CoulombRmax(int A) const
+{
+  double Rmax = 0.;
+
+  if ( fCoulombRmaxMode == kMatchNieves ) {
+    // Rmax calculated using formula from Nieves' fortran code and default
+    // charge and neutron matter density parameters from NuclearUtils.cxx
+    if (A > 20) {
+      double c = TMath::Power(A,0.35), z = 0.54;
+      Rmax = c + 9.25*z;
+    }
+    else {
+      // c = 1.75 for A <= 20
+      Rmax = TMath::Sqrt(20.0)*1.75;
+    }
+  }
+  else if ( fCoulombRmaxMode == kMatchVertexGeneratorRmax ) {
+    // TODO: This solution is fragile. If the formula used by VertexGenerator
+    // changes, then this one will need to change too. Switch to using
+    // a common function to get Rmax for both.
+    Rmax = 3. * fR0 * std::pow(A, 1./3.);
+  }
+  else {
+    LOG("Nieves", pFATAL) << "Unrecognized setting for fCoulombRmaxMode encountered"
+      << " in NievesQELCCPXSec::CoulombRmax()";
+    gAbortingInErr = true;
+    std::exit(1);
+  }
+
+  return Rmax;
+}
+//____________________________________________________________________________
+double NievesQELCCPXSec::vcrIntegral(
+  int A, int Z, double Rcurr, double Rmax) const
+{
+  ROOT::Math::IBaseFunctionOneDim * func = new
+    utils::gsl::wrap::NievesQELvcrIntegrand(Rcurr,A,Z);
+  ROOT::Math::IntegrationOneDim::Type ig_type =
+    utils::gsl::Integration1DimTypeFromString("adaptive");
+
+  double abstol = 1; // We mostly care about relative tolerance;
+  double reltol = 1E-4;
+  int nmaxeval = 100000;
+  ROOT::Math::Integrator ig(*func,ig_type,abstol,reltol,nmaxeval);
+  double result = ig.Integral(0,Rmax);
+  delete func;
+
+  // Multiply by Z to normalize densities to number of protons
+  // Multiply by hbarc to put result in GeV instead of fm
+  return -kAem*4*kPi*result*fhbarc;
+}
+//____________________________________________________________________________
 int NievesQELCCPXSec::leviCivita(int input[]) const{
   int copy[4] = {input[0],input[1],input[2],input[3]};
   int permutations = 0;
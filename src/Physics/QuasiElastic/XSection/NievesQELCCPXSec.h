@@ -7,6 +7,12 @@
           with RPA corrections
           Is a concrete implementation of the XSecAlgorithmI interface. \n
 
+          Optionally (RPA-TabulateLindhard), the Lindhard functions entering
+          the RPA corrections are interpolated from tables built at
+          configuration, on a (kF, |q|, q0) grid. The interpolation error of
+          the RPA factors is checked at the centre of each grid cell, and the
+          functions are computed exactly in the cells failing the tolerance.
+
 \ref      Physical Review C 70, 055503 (2004)
 
 \author   Joe Johnston, University of Pittsburgh
@@ -26,6 +32,9 @@
 #include "Physics/QuasiElastic/XSection/QELFormFactors.h"
 #include "Physics/NuclearState/FermiMomentumTable.h"
 #include <complex>
+#include <map>
+#include <memory>
+#include <vector>
 #include <Math/IFunction.h>
 #include "Physics/NuclearState/NuclearModelI.h"
 #include "Physics/NuclearState/PauliBlocker.h"
@@ -106,6 +115,27 @@ private:
   /// for integrating the Coulomb potential
   Nieves_Coulomb_Rmax_t fCoulombRmaxMode;
 
+  /// Tables of the real part of relLindhard() (w/o its relLindhardIm() term,
+  /// which is computed exactly) and of deltaLindhard(), at nodes uniformly
+  /// spaced in kF, |q| and nu = (q0-q0min)/(q0max-q0min), where q0min and
+  /// q0max are the edges of the particle-hole continuum. Node (ikf,iq,inu)
+  /// is stored at [(ikf*fNQ+iq)*fNNu+inu]. Read-only once built.
+  struct LindhardTable {
+    double fM;                       ///< nucleon mass
+    int    fNKF, fNQ, fNNu;          ///< number of kF, |q| and nu nodes
+    double fKFMin, fDKF;             ///< kF of the first node, node spacing
+    double fQMin, fDQ;               ///< |q| of the first node, node spacing
+    double fNuMin, fDNu;             ///< nu of the first node, node spacing
+    std::vector<float> fReLin;       ///< Re relLindhard() - 2*relLindhardIm() (GeV^2)
+    std::vector<float> fReDelta;     ///< Re deltaLindhard() (GeV^2)
+    std::vector<float> fImDelta;     ///< Im deltaLindhard() (GeV^2)
+    std::vector<char>  fCellOK;      ///< is the interpolation in the cell starting at the node within tolerance?
+    int    fNBadCells;               ///< number of cells failing the tolerance
+  };
+
+  bool                                 fTabulateLindhard; ///< interpolate the Lindhard functions?
+  std::shared_ptr<const LindhardTable> fLindhardTable;
+
   //Functions needed to calculate XSec:
 
   // Calculates values of CN, CT, CL, and imU, and stores them in the provided
@@ -129,9 +159,39 @@ private:
 				 double kf, double m) const;
   std::complex<double> deltaLindhard(double q0gev, double dqgev,
 				     double rho, double kFgev) const;
-
-  // Potential for coulomb correction
+  // Real part of relLindhard(), without its relLindhardIm() term
+  std::complex<double> relLindhardRe(double q0gev, double dqgev,
+				     double kFgev, double M) const;
+
+  // Interpolates relLindhard() and deltaLindhard() (for the density giving
+  // the input kF) from the tables. Returns false if the point is not
+  // tabulated or is in a cell failing the interpolation tolerance
+  bool InterpolateLindhard(double q0gev, double dqgev, double kFgev,
+                           double M, std::complex<double> & relLin,
+                           std::complex<double> & udel) const;
+  LindhardTable * BuildLindhardTable(double M, int nkf, int nq, int nnu,
+                                     double kfmin, double kfmax,
+                                     double qmin, double qmax,
+                                     double tolerance) const;
+
+  /// Coulomb potential (GeV) at nodes uniformly spaced in r, from r = 0
+  /// to the max radius of the Coulomb integration. Read-only once built.
+  struct CoulombTable {
+    double              fRmax;       ///< max radius (fm)
+    double              fDR;         ///< node spacing (fm)
+    std::vector<double> fV;          ///< potential at r = i*fDR in [i]
+  };
+
+  /// Coulomb potential tables of the nuclear targets seen so far, by PDG code
+  mutable std::map<int, std::shared_ptr<const CoulombTable> > fCoulombTables;
+
+  // Potential for coulomb correction, interpolated from the target table
   double vcr(const Target * target, double r) const;
+  // Max radius for the integration of the Coulomb potential (fm)
+  double CoulombRmax(int A) const;
+  // Coulomb potential computed by integrating over the charge density
+  double vcrIntegral(int A, int Z, double r, double Rmax) const;
+  CoulombTable * BuildCoulombTable(int A, int Z, double Rmax) const;
 
   //input must be length 4. Returns 1 if input is an even permutation of 0123,
   //-1 if input is an odd permutation of 0123, and 0 if any two elements
@@ -24,6 +24,7 @@
 //____________________________________________________________________________
 
 #include <sstream>
+#include <algorithm>
 
 #include <TMath.h>
 #include <Math/IFunction.h>
@@ -112,6 +113,9 @@ void SmithMonizUtils::LoadConfig(void)
     }
   }
 
+  // the memoized states depend on the configuration
+  fTargetMemo.clear();
+  fQ2LimMemo.clear();
 
 }
 //____________________________________________________________________________
@@ -120,15 +124,46 @@ void SmithMonizUtils::SetInteraction(const Interaction * interaction)
 {
 
   fInteraction = interaction;
-  // Get kinematics & init-state parameters
-  // unused // const Kinematics &   kinematics = interaction -> Kine();
-  const InitialState & init_state = interaction -> InitState();
-  const Target & target = init_state.Tgt();
-  PDGLibrary * pdglib = PDGLibrary::Instance();
+  const Target & target = interaction->InitState().Tgt();
 
   E_nu = interaction->InitState().ProbeE(kRfLab);         //  Neutrino energy (GeV)
 
   assert(target.HitNucIsSet());
+  fTgtPdg  = target.Pdg();
+  fNuclPdg = target.HitNucPdg();
+  fLepPdg  = interaction->FSPrimLeptonPdg();
+
+  // The rest depends only on the target, hit nucleon & final state lepton.
+  // Look it up in the recently used states first.
+  for(unsigned int i = 0; i < fTargetMemo.size(); i++)
+  {
+    const TargetState & st = fTargetMemo[i];
+    if(st.tgt_pdg != fTgtPdg || st.nucl_pdg != fNuclPdg || st.lep_pdg != fLepPdg) continue;
+    m_lep   = st.m_lep;   mm_lep = TMath::Power(m_lep, 2);
+    m_ini   = st.m_ini;   mm_ini = TMath::Power(m_ini, 2);
+    m_fin   = st.m_fin;   mm_fin = TMath::Power(m_fin, 2);
+    m_tar   = st.m_tar;   mm_tar = TMath::Power(m_tar, 2);
+    m_rnu   = st.m_rnu;   mm_rnu = TMath::Power(m_rnu, 2);
+    P_Fermi = st.P_Fermi;
+    E_BIN   = st.E_BIN;
+    std::rotate(fTargetMemo.begin(), fTargetMemo.begin()+i, fTargetMemo.begin()+i+1);
+    return;
+  }
+
+  this->SetTargetState(interaction);
+
+  TargetState st = { fTgtPdg, fNuclPdg, fLepPdg,
+                     m_lep, m_ini, m_fin, m_tar, m_rnu, P_Fermi, E_BIN };
+  fTargetMemo.insert(fTargetMemo.begin(), st);
+  if(fTargetMemo.size() > kNMemo) fTargetMemo.pop_back();
+}
+//____________________________________________________________________________
+// Set the masses, Fermi momentum & binding energy for the input interaction
+void SmithMonizUtils::SetTargetState(const Interaction * interaction)
+{
+  const Target & target = interaction->InitState().Tgt();
+  PDGLibrary * pdglib = PDGLibrary::Instance();
+
   // get lepton&nuclear masses (init & final state nucleus)
   m_lep = interaction->FSPrimLepton()->Mass();          //  Mass of final charged lepton (GeV)
   mm_lep     = TMath::Power(m_lep,    2);
@@ -288,6 +323,41 @@ double SmithMonizUtils::Q2lim2_SM(double Q2) const
 //____________________________________________________________________________
 // Return allowed Q2-range
 Range1D_t SmithMonizUtils::Q2QES_SM_lim(void) const
+{
+  // the limits need a minimisation & up to three root findings: look them
+  // up in the recently used ones first
+  Enu_in = E_nu;
+  for(unsigned int i = 0; i < fQ2LimMemo.size(); i++)
+  {
+    const Q2Limits & lim = fQ2LimMemo[i];
+    if(lim.E_nu != E_nu || lim.tgt_pdg != fTgtPdg ||
+       lim.nucl_pdg != fNuclPdg || lim.lep_pdg != fLepPdg) continue;
+    Range1D_t R = lim.Q2;
+    std::rotate(fQ2LimMemo.begin(), fQ2LimMemo.begin()+i, fQ2LimMemo.begin()+i+1);
+    return R;
+  }
+
+  Range1D_t R = this->ComputeQ2QES_SM_lim();
+
+  Q2Limits lim = { fTgtPdg, fNuclPdg, fLepPdg, E_nu, R };
+  fQ2LimMemo.insert(fQ2LimMemo.begin(), lim);
+  if(fQ2LimMemo.size() > kNMemo) fQ2LimMemo.pop_back();
+  return R;
+}
+//____________________________________________________________________________
+void SmithMonizUtils::Q2QES_SM_lim(
+     unsigned int n, const double * Enu, Range1D_t * Q2lim)
+{
+  double E_nu_set = E_nu;
+  for(unsigned int i = 0; i < n; i++)
+  {
+    E_nu = Enu[i];
+    Q2lim[i] = this->Q2QES_SM_lim();
+  }
+  E_nu = E_nu_set;
+}
+//____________________________________________________________________________
+Range1D_t SmithMonizUtils::ComputeQ2QES_SM_lim(void) const
 {
 
 
@@ -391,6 +461,15 @@ Range1D_t SmithMonizUtils::vQES_SM_lim(double Q2) const
 
 }
 //____________________________________________________________________________
+void SmithMonizUtils::vQES_SM_lim(
+     unsigned int n, const double * Q2, Range1D_t * vlim) const
+{
+  for(unsigned int i = 0; i < n; i++)
+  {
+    vlim[i] = this->vQES_SM_lim(Q2[i]);
+  }
+}
+//____________________________________________________________________________
 // Return allowed Fermi momentum range for given Q2 and v
 Range1D_t SmithMonizUtils::kFQES_SM_lim(double Q2, double nu) const
 {
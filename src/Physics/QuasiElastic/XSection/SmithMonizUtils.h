@@ -37,6 +37,8 @@
 #ifndef _SMITH_MONIZ_UTILS_H_
 #define _SMITH_MONIZ_UTILS_H_
 
+#include <vector>
+
 #include <TLorentzVector.h>
 
 #include "Framework/Algorithm/Algorithm.h"
@@ -62,6 +64,11 @@ public:
         double E_nu_thr_SM(void) const;
         Range1D_t Q2QES_SM_lim(void) const;
         Range1D_t vQES_SM_lim(double Q2) const;
+        //! Q2 limits for each of the n input neutrino energies (eg the knots
+        //! of a cross section spline) for the interaction set by SetInteraction()
+        void Q2QES_SM_lim(unsigned int n, const double * Enu, Range1D_t * Q2lim);
+        //! v limits for each of the n input Q2 values
+        void vQES_SM_lim (unsigned int n, const double * Q2, Range1D_t * vlim) const;
         Range1D_t kFQES_SM_lim(double nu, double Q2) const;
         static double rho(double P_Fermi, double T_Fermi, double p);
         double PhaseSpaceVolume(KinePhaseSpace_t ps) const;
@@ -84,7 +91,23 @@ private:
                 double (C::*f_)(double) const;
         };
 
-        void   LoadConfig (void);
+        //! The part of the SetInteraction() state that depends only on the
+        //! target, hit nucleon and final state lepton (not on the energy)
+        struct TargetState {
+          int    tgt_pdg, nucl_pdg, lep_pdg;
+          double m_lep, m_ini, m_fin, m_tar, m_rnu, P_Fermi, E_BIN;
+        };
+        //! Memoized Q2QES_SM_lim() result
+        struct Q2Limits {
+          int       tgt_pdg, nucl_pdg, lep_pdg;
+          double    E_nu;
+          Range1D_t Q2;
+        };
+        static const unsigned int kNMemo = 16;  ///< entries kept in each memo
+
+        void      LoadConfig         (void);
+        void      SetTargetState     (const Interaction * i);
+        Range1D_t ComputeQ2QES_SM_lim(void) const;
         double QEL_EnuMin_SM(double E_nu) const;
         double Q2lim1_SM(double Q2) const;
         double Q2lim2_SM(double Q2) const;
@@ -99,6 +122,16 @@ private:
 
         const Interaction *  fInteraction;
 
+        // Memos of the recently used target states & Q2 limits, most recently
+        // used first. The generator and the cross section model call
+        // SetInteraction() & Q2QES_SM_lim() for each event / cross section
+        // evaluation with the same few initial states and energies.
+        int                              fTgtPdg;      ///< target pdg of the current interaction
+        int                              fNuclPdg;     ///< hit nucleon pdg of the current interaction
+        int                              fLepPdg;      ///< final state lepton pdg of the current interaction
+        std::vector<TargetState>         fTargetMemo;
+        mutable std::vector<Q2Limits>    fQ2LimMemo;
+
         // Some often used variables of class.
         // To not calculate them again and again and for speed increase
         // they are initialized at once for multiple use
@@ -139,6 +139,13 @@ InteractionList * RESInteractionListGenerator::CreateInteractionList(
   return intlist;
 }
 //___________________________________________________________________________
+string RESInteractionListGenerator::TargetClass(const Target & target) const
+{
+// The list only depends on whether the target has protons and neutrons
+
+  return InteractionListGeneratorI::NucleonContentClass(target);
+}
+//___________________________________________________________________________
 void RESInteractionListGenerator::Configure(const Registry & config)
 {
   Algorithm::Configure(config);
@@ -8,6 +8,8 @@
 */
 //____________________________________________________________________________
 
+#include <vector>
+
 #include <TMath.h>
 #include <TF2.h>
 #include <TROOT.h>
@@ -25,11 +27,15 @@
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Numerical/MathUtils.h"
+#include "Framework/Utils/CacheBranchGrid.h"
+#include "Framework/Utils/ThreadPool.h"
 #include "Framework/ParticleData/BaryonResonance.h"
 #include "Framework/ParticleData/BaryonResUtils.h"
 #include "Framework/Utils/KineUtils.h"
 #include "Physics/Resonance/EventGen/RESKinematicsGenerator.h"
 
+using std::vector;
+
 using namespace genie;
 using namespace genie::controls;
 using namespace genie::utils;
@@ -100,8 +106,15 @@ void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   //   cache. Throw an exception and quit the evg thread if a non-positive
   //   value is found.
   //   If the kinematics are generated uniformly over the allowed phase
-  //   space the max xsec is irrelevant
-  double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
+  //   space the max xsec is irrelevant.
+  //   If adaptive sampling is used, (W,Q2) are drawn from the learnt grid
+  //   and the rejection is made against its max weight instead.
+  CacheBranchGrid * grid = 0;
+  double xsec_max = -1;
+  if(!fGenerateUniformly) {
+    if(fUseAdaptiveGrid) grid = this->AdaptiveGrid(evrec);
+    else xsec_max = this->MaxXSec(evrec);
+  }
 
   //-- Try to select a valid W, Q2 pair using the rejection method
   double dW   = W.max - W.min;
@@ -125,6 +138,8 @@ void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      double gW   = 0; // current hadronic invariant mass
      double gQ2  = 0; // current momentum transfer
      double gQD2 = 0; // tranformed Q2 to take out dipole form
+     double g    = 1; // adaptive grid proposal density
+     double jac  = 1; // jacobian of the map from the adaptive grid
 
      if(fGenerateUniformly) {
        //-- Generate a W uniformly in the kinematically allowed range.
@@ -137,6 +152,12 @@ void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
        interaction->SetBit(kISkipKinematicChk);
 
+     } else if(grid) {
+       // Sample (u,v) from the adaptive grid and map them to (W,Q2)
+       double u = 0, v = 0;
+       g = grid->Generate(rnd->RndKine().Rndm(), rnd->RndKine().Rndm(), u, v);
+       if(!this->AdaptiveGridKinematics(interaction,u,v,gW,gQ2,jac)) continue;
+
      } else {
 
 
@@ -205,7 +226,14 @@ void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      xsec = fXSecModel->XSec(interaction, kPSWQ2fE);
 
      //-- Decide whether to accept the current kinematics
-     if(!fGenerateUniformly) {
+     if(grid) {
+          double w    = xsec * jac / g;
+          double wmax = grid->MaxWeight();
+          this->AssertXSecLimits(interaction, w, wmax);
+          if(w > wmax) grid->SetMaxWeight(fSafetyFactor * w);
+          accept = (wmax * rnd->RndKine().Rndm() < w);
+     }
+     else if(!fGenerateUniformly) {
 
           // unified neutrino / electron scattering
           double max = fEnvelope->Eval(gQD2, gW);
@@ -226,6 +254,7 @@ void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {
+        this->RecordAccepted(interaction, iter);
         LOG("RESKinematics", pINFO)
                             << "Selected: W = " << gW << ", Q2 = " << gQ2;
         // reset 'trust' bits
@@ -301,6 +330,10 @@ void RESKinematicsGenerator::LoadConfig(void)
   // an event weight?
   this->GetParamDef("UniformOverPhaseSpace", fGenerateUniformly, false);
 
+  // Sample (W,Q2) from an adaptive grid learnt per interaction and energy
+  // bin, in place of the importance sampling envelope?
+  this->LoadAdaptiveSamplingConfig();
+
   // Envelope employed when importance sampling is used
   // (initialize with dummy range)
   if(fEnvelope) delete fEnvelope;
@@ -416,15 +449,22 @@ double RESKinematicsGenerator::ComputeMaxXSec(
 
     double dW = (NW>1) ? (Wmax-Wmin)/(NW-1) : 0.;
 
-    for(int iw=0; iw<NW; iw++) {
+    // The W rows are scanned independently, spread over the thread pool
+    vector<double> max_xsec_w(NW, 0.);
+
+    ThreadPool::Instance()->ParallelFor(NW, [&] (int iw, unsigned int worker) {
+      const XSecAlgorithmI * xsec_model = this->WorkerXSecModel(worker);
+      std::unique_ptr<Interaction> copy;
+      const Interaction * in = this->WorkerInteraction(interaction, worker, copy);
+
       double W = Wmin + iw*dW;
-      interaction->KinePtr()->SetW(W);
+      in->KinePtr()->SetW(W);
 
       int NQ2  = 25;
       int NQ2b =  4;
 
-      Range1D_t rQ2 = kps.Q2Lim_W();
-      if( rQ2.max < Q2Thres || rQ2.min <=0 ) continue;
+      Range1D_t rQ2 = in->PhaseSpace().Q2Lim_W();
+      if( rQ2.max < Q2Thres || rQ2.min <=0 ) return;
       if( rQ2.max-rQ2.min<0.02 ) {NQ2=5; NQ2b=3;}
 
       double logQ2min   = TMath::Log(rQ2.min+kASmallNum);
@@ -435,11 +475,11 @@ double RESKinematicsGenerator::ComputeMaxXSec(
 
       for(int iq2=0; iq2<NQ2; iq2++) {
         double Q2 = TMath::Exp(logQ2min + iq2 * dlogQ2);
-        interaction->KinePtr()->SetQ2(Q2);
-        double xsec = fXSecModel->XSec(interaction, kPSWQ2fE);
+        in->KinePtr()->SetQ2(Q2);
+        double xsec = xsec_model->XSec(in, kPSWQ2fE);
         LOG("RESKinematics", pDEBUG)
                 << "xsec(W= " << W << ", Q2= " << Q2 << ") = " << xsec;
-        max_xsec = TMath::Max(xsec, max_xsec);
+        max_xsec_w[iw] = TMath::Max(xsec, max_xsec_w[iw]);
         increasing = xsec-xseclast>=0;
         xseclast=xsec;
 
@@ -451,15 +491,19 @@ double RESKinematicsGenerator::ComputeMaxXSec(
          for(int iq2b=0; iq2b<NQ2b; iq2b++) {
 	   Q2 = TMath::Exp(TMath::Log(Q2) - dlogQ2);
            if(Q2 < rQ2.min) continue;
-           interaction->KinePtr()->SetQ2(Q2);
-           xsec = fXSecModel->XSec(interaction, kPSWQ2fE);
+           in->KinePtr()->SetQ2(Q2);
+           xsec = xsec_model->XSec(in, kPSWQ2fE);
            LOG("RESKinematics", pDEBUG)
                  << "xsec(W= " << W << ", Q2= " << Q2 << ") = " << xsec;
-           max_xsec = TMath::Max(xsec, max_xsec);
+           max_xsec_w[iw] = TMath::Max(xsec, max_xsec_w[iw]);
          }
          break;
 	}
       } // Q2
+    });
+
+    for(int iw=0; iw<NW; iw++) {
+      max_xsec = TMath::Max(max_xsec, max_xsec_w[iw]);
     }//W
   }//2d scan
 
@@ -477,3 +521,44 @@ double RESKinematicsGenerator::ComputeMaxXSec(
   return max_xsec;
 }
 //___________________________________________________________________________
+bool RESKinematicsGenerator::AdaptiveGridKinematics(
+    const Interaction * interaction, double u, double v,
+    double & W, double & Q2, double & jac) const
+{
+// Maps (u,v) of the unit square to (W,Q2): u linearly to the allowed W and,
+// for that W, v linearly to the allowed Q2. Returns false if there is no
+// allowed Q2 for the selected W.
+
+  const KPhaseSpace & kps = interaction->PhaseSpace();
+  Range1D_t Wl = kps.Limits(kKVW);
+
+  W = Wl.min + (Wl.max - Wl.min) * u;
+  interaction->KinePtr()->SetW(W);
+
+  Range1D_t Q2l = kps.Q2Lim_W();
+  double Q2min = Q2l.min + kASmallNum;
+  double Q2max = Q2l.max - kASmallNum;
+  if(Q2max <= Q2min) return false;
+
+  Q2  = Q2min + (Q2max - Q2min) * v;
+  jac = (Wl.max - Wl.min) * (Q2max - Q2min);
+
+  return true;
+}
+//___________________________________________________________________________
+double RESKinematicsGenerator::AdaptiveGridXSec(
+       const Interaction * interaction, double u, double v, double & jac) const
+{
+// Returns d2xsec/dWdQ2 at the (W,Q2) the point (u,v) maps to
+
+  double W = 0, Q2 = 0;
+  if(!this->AdaptiveGridKinematics(interaction, u, v, W, Q2, jac)) {
+    jac = 0;
+    return 0;
+  }
+  interaction->KinePtr()->SetW (W);
+  interaction->KinePtr()->SetQ2(Q2);
+
+  return fXSecModel->XSec(interaction, kPSWQ2fE);
+}
+//___________________________________________________________________________
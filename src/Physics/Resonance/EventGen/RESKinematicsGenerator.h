@@ -44,6 +44,10 @@ public :
 private:
   void   LoadConfig      (void);
   double ComputeMaxXSec  (const Interaction * interaction) const;
+  double AdaptiveGridXSec(const Interaction * interaction,
+                          double u, double v, double & jac) const;
+  bool   AdaptiveGridKinematics (const Interaction * interaction, double u,
+                   double v, double & W, double & Q2, double & jac) const;
 
   mutable TF2 * fEnvelope; ///< 2-D envelope used for importance sampling
   double fWcut;            ///< Wcut parameter in DIS/RES join scheme
@@ -24,6 +24,7 @@
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/ParticleData/BaryonResUtils.h"
 #include "Physics/Resonance/EventGen/RSPPResonanceSelector.h"
+#include "Physics/Resonance/XSection/BSKLNBaseRESPXSec2014.h"
 
 using std::vector;
 using std::ostringstream;
@@ -95,6 +96,21 @@ Resonance_t RSPPResonanceSelector::SelectResonance(GHepRecord * evrec) const
   unsigned int nres = fResList.NResonances();
   vector<double> xsec_vec(nres);
 
+  //-- Models able to do so compute all resonances in a single pass
+  //   (resonances that can not conserve charge are given as kNoResonance)
+  const BSKLNBaseRESPXSec2014 * bsklnalg =
+      dynamic_cast<const BSKLNBaseRESPXSec2014 *> (xsecalg);
+  vector<double> xsec_res;
+  if(bsklnalg) {
+    vector<Resonance_t> resonances(nres);
+    for(unsigned int ires = 0; ires < nres; ires++) {
+      Resonance_t res = fResList.ResonanceId(ires);
+      bool skip = (q_res==2 && !utils::res::IsDelta(res));
+      resonances[ires] = skip ? kNoResonance : res;
+    }
+    bsklnalg->XSecPerResonance(interaction,resonances,xsec_res,kPSWQ2fE);
+  }
+
   for(unsigned int ires = 0; ires < nres; ires++) {
 
      //-- Current resonance
@@ -108,7 +124,9 @@ Resonance_t RSPPResonanceSelector::SelectResonance(GHepRecord * evrec) const
      double xsec = 0;
      bool   skip = (q_res==2 && !utils::res::IsDelta(res));
 
-     if(!skip) xsec = xsecalg->XSec(interaction,kPSWQ2fE);
+     if(!skip) {
+       xsec = bsklnalg ? xsec_res[ires] : xsecalg->XSec(interaction,kPSWQ2fE);
+     }
      else {
        SLOG("RESSelector", pNOTICE)
                  << "RES: " << utils::res::AsString(res)
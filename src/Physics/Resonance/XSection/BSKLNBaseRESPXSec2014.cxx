@@ -50,9 +50,16 @@
 #include "Physics/NuclearState/FermiMomentumTable.h"
 #include "Physics/NuclearState/NuclearUtils.h"
 
+using std::vector;
+
 using namespace genie;
 using namespace genie::constants;
 
+namespace {
+  // number of utils::res::ResonanceIndex() values
+  const int kNResIndices = 3;
+}
+
 //____________________________________________________________________________
 BSKLNBaseRESPXSec2014::BSKLNBaseRESPXSec2014(string name) :
 XSecAlgorithmI(name)
@@ -74,8 +81,62 @@ BSKLNBaseRESPXSec2014::~BSKLNBaseRESPXSec2014()
 double BSKLNBaseRESPXSec2014::XSec(
     const Interaction * interaction, KinePhaseSpace_t kps) const
 {
-  if(! this -> ValidProcess    (interaction) ) return 0.;
-  if(! this -> ValidKinematics (interaction) ) return 0.;
+  if(! this -> ValidProcess (interaction) ) return 0.;
+
+  KineFactors_t f;
+  if(! this -> ComputeKineFactors (interaction, kps, f) ) return 0.;
+
+  // Get the input baryon resonance
+  Resonance_t resonance = interaction->ExclTag().Resonance();
+  if(! this -> ResonanceAllowed (resonance, f) ) return 0.;
+
+  FKRSet_t fkr;
+  this->ComputeFKR(utils::res::ResonanceIndex(resonance), f, fkr);
+
+  return this->ResonanceXSec(resonance, f, fkr);
+}
+//____________________________________________________________________________
+void BSKLNBaseRESPXSec2014::XSecPerResonance(
+    const Interaction * interaction, const vector<Resonance_t> & resonances,
+    vector<double> & xsec, KinePhaseSpace_t kps) const
+{
+  xsec.assign(resonances.size(), 0.);
+
+  if(! interaction->TestBit(kISkipProcessChk) &&
+     ! this->ValidResonantProcess(interaction)) return;
+
+  KineFactors_t f;
+  if(! this -> ComputeKineFactors (interaction, kps, f) ) return;
+
+  // The FKR parameters depend on the resonance only through its index:
+  // compute them once per index
+  FKRSet_t fkr[kNResIndices];
+  bool     has_fkr[kNResIndices] = { false };
+
+  for(unsigned int ires = 0; ires < resonances.size(); ires++) {
+    Resonance_t resonance = resonances[ires];
+    if(resonance == kNoResonance) continue;
+    if(! this -> ResonanceAllowed (resonance, f) ) continue;
+
+    int IR = utils::res::ResonanceIndex(resonance);
+    if(IR < 0 || IR >= kNResIndices) {
+      FKRSet_t fkr_ir;
+      this->ComputeFKR(IR, f, fkr_ir);
+      xsec[ires] = this->ResonanceXSec(resonance, f, fkr_ir);
+      continue;
+    }
+    if(! has_fkr[IR]) {
+      this->ComputeFKR(IR, f, fkr[IR]);
+      has_fkr[IR] = true;
+    }
+    xsec[ires] = this->ResonanceXSec(resonance, f, fkr[IR]);
+  }
+}
+//____________________________________________________________________________
+bool BSKLNBaseRESPXSec2014::ComputeKineFactors(
+    const Interaction * interaction, KinePhaseSpace_t kps, KineFactors_t & f) const
+{
+  if(! this -> ValidKinematics (interaction) ) return false;
 
   const InitialState & init_state = interaction -> InitState();
   const ProcessInfo &  proc_info  = interaction -> ProcInfo();
@@ -95,15 +156,10 @@ double BSKLNBaseRESPXSec2014::XSec(
         << "RES/DIS Join Scheme: XSec[RES, W=" << W
         << " >= Wcut=" << fWcut << "] = 0";
 #endif
-      return 0;
+      return false;
     }
   }
 
-  // Get the input baryon resonance
-  Resonance_t resonance = interaction->ExclTag().Resonance();
-  string      resname   = utils::res::AsString(resonance);
-  bool        is_delta  = utils::res::IsDelta (resonance);
-
   // Get the neutrino, hit nucleon & weak current
   int  nucpdgc   = target.HitNucPdg();
   int  probepdgc = init_state.ProbePdg();
@@ -120,27 +176,6 @@ double BSKLNBaseRESPXSec2014::XSec(
   //  bool new_GV = fGA; //JN
   //  bool new_GA = fGV; //JN
 
-
-  if(is_CC && !is_delta) {
-    if((is_nu && is_p) || (is_nubar && is_n)) return 0;
-  }
-
-  // Get baryon resonance parameters
-  int    IR  = utils::res::ResonanceIndex    (resonance);
-  int    LR  = utils::res::OrbitalAngularMom (resonance);
-  double MR  = utils::res::Mass              (resonance);
-  double WR  = utils::res::Width             (resonance);
-   double NR  = fNormBW?utils::res::BWNorm    (resonance,fN0ResMaxNWidths,fN2ResMaxNWidths,fGnResMaxNWidths):1;
-
-  // Following NeuGEN, avoid problems with underlying unphysical
-  // model assumptions by restricting the allowed W phase space
-  // around the resonance peak
- if (fNormBW) {
-        if      (W > MR + fN0ResMaxNWidths * WR && IR==0) return 0.;
-        else if (W > MR + fN2ResMaxNWidths * WR && IR==2) return 0.;
-        else if (W > MR + fGnResMaxNWidths * WR)          return 0.;
-  }
-
   // Compute auxiliary & kinematical factors
   double E      = init_state.ProbeE(kRfHitNucRest);
   double Mnuc   = target.HitNucMass();
@@ -290,15 +325,17 @@ double BSKLNBaseRESPXSec2014::XSec(
     << "Kinematical params V = " << V << ", U = " << U;
 #endif
 
-  // Calculate the Feynman-Kislinger-Ravndall parameters
-
-  double Go  = TMath::Power(1 - 0.25 * q2/Mnuc2, 0.5-IR);
-  double GV  = Go * TMath::Power( 1./(1-q2/fMv2), 2);
-  double GA  = Go * TMath::Power( 1./(1-q2/fMa2), 2);
+  // Resonance-independent parts of the form factors: the resonance
+  // index enters only through the (0.5-IR) powers taken in ComputeFKR()
+  f.GoBase   = 1 - 0.25 * q2/Mnuc2;
+  f.GVDipole = TMath::Power( 1./(1-q2/fMv2), 2);
+  f.GADipole = TMath::Power( 1./(1-q2/fMa2), 2);
+  f.GNewBase = 1 - q2/(Mnuc + W)/(Mnuc + W);
+  f.GVNew    = 0;
+  f.GANew    = 0;
+  f.CA5      = 0;
 
   if(fGV){
-
-    LOG("BSKLNBaseRESPXSec2014",pDEBUG) <<"Using new GV";
     double CV0 =  1./(1-q2/fMv2/4.);
     double CV3 =  2.13 * CV0 * TMath::Power( 1-q2/fMv2,-2);
     double CV4 = -1.51 * CV0 * TMath::Power( 1-q2/fMv2,-2);
@@ -312,119 +349,366 @@ double BSKLNBaseRESPXSec2014::XSec(
                  + CV4 * (W2 +q2 - Mnuc2)/2./Mnuc2
                  + CV5 * (W2 -q2 - Mnuc2)/2./Mnuc2 );
 
-    GV = 0.5 * TMath::Power( 1 - q2/(Mnuc + W)/(Mnuc + W), 0.5-IR)
-         * TMath::Sqrt( 3 * GV3*GV3 + GV1*GV1);
+    f.GVNew = TMath::Sqrt( 3 * GV3*GV3 + GV1*GV1);
   }
 
   if(fGA){
-    LOG("BSKLNBaseRESPXSec2014",pDEBUG) << "Using new GA";
-
     double CA5_0 = 1.2;
-    double CA5 = CA5_0 *  TMath::Power( 1./(1-q2/fMa2), 2);
-    //  GA = 0.5 * TMath::Sqrt(3.) * TMath::Power( 1 - q2/(Mnuc + W)/(Mnuc + W), 0.5-IR) * (1- (W2 +q2 -Mnuc2)/8./Mnuc2) * CA5/fZeta;
-    GA = 0.5 * TMath::Sqrt(3.) * TMath::Power( 1 - q2/(Mnuc + W)/(Mnuc + W), 0.5-IR) * (1- (W2 +q2 -Mnuc2)/8./Mnuc2) * CA5;
-
-    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"GA= " <<GA << "  C5A= " <<CA5;
+    f.CA5   = CA5_0 *  TMath::Power( 1./(1-q2/fMa2), 2);
+    f.GANew = (1- (W2 +q2 -Mnuc2)/8./Mnuc2);
   }
-  //JN end of new form factors code
+
+  // These lines were ~ 100 lines below, which means that, for EM interactions, the coefficients below were still calculated using the weak coupling constant - Afro
+  double g2 = kGF2;
+
+  // For EM interaction replace  G_{Fermi} with :
+  // a_{em} * pi / ( sqrt(2) * sin^2(theta_weinberg) * Mass_{W}^2 }
+  // See C.Quigg, Gauge Theories of the Strong, Weak and E/M Interactions,
+  // ISBN 0-8053-6021-2, p.112 (6.3.57)
+  // Also, take int account that the photon propagator is 1/p^2 but the
+  // W propagator is 1/(p^2-Mass_{W}^2), so weight the EM case with
+  // Mass_{W}^4 / q^4
+  // So, overall:
+  // G_{Fermi}^2 --> a_{em}^2 * pi^2 / (2 * sin^4(theta_weinberg) * q^{4})
+  //
 
   if(is_EM) {
-    GA = 0.; // zero the axial term for EM scattering
+    double q4 = q2*q2;
+    g2 = kAem2 * kPi2 / (2.0 * fSin48w * q4);
   }
 
-  double d      = TMath::Power(W+Mnuc,2.) - q2;
-  double sq2omg = TMath::Sqrt(2./fOmega);
-  double nomg   = IR * fOmega;
-  double mq_w   = Mnuc*Q/W;
-
-  fFKR.Lamda  = sq2omg * mq_w;
-  fFKR.Tv     = GV / (3.*W*sq2omg);
-  fFKR.Rv     = kSqrt2 * mq_w*(W+Mnuc)*GV / d;
-  fFKR.S      = (-q2/Q2) * (3*W*Mnuc + q2 - Mnuc2) * GV / (6*Mnuc2);
-  fFKR.Ta     = (2./3.) * (fZeta/sq2omg) * mq_w * GA / d;
-  fFKR.Ra     = (kSqrt2/6.) * fZeta * (GA/W) * (W+Mnuc + 2*nomg*W/d );
-  fFKR.B      = fZeta/(3.*W*sq2omg) * (1 + (W2-Mnuc2+q2)/ d) * GA;
-  fFKR.C      = fZeta/(6.*Q) * (W2 - Mnuc2 + nomg*(W2-Mnuc2+q2)/d) * (GA/Mnuc);
-  fFKR.R      = fFKR.Rv;
-  fFKR.Rplus  = - (fFKR.Rv + fFKR.Ra);
-  fFKR.Rminus = - (fFKR.Rv - fFKR.Ra);
-  fFKR.T      = fFKR.Tv;
-  fFKR.Tplus  = - (fFKR.Tv + fFKR.Ta);
-  fFKR.Tminus = - (fFKR.Tv - fFKR.Ta);
+  if(is_CC) g2 = kGF2*fVud2;
 
-  //JN KNL
-  double KNL_S_plus = 0;
-  double KNL_S_minus = 0;
-  double KNL_B_plus = 0;
-  double KNL_B_minus = 0;
-  double KNL_C_plus = 0;
-  double KNL_C_minus = 0;
+  f.sig0 = 0.125*(g2/kPi)*(-q2/Q2)*(W/Mnuc);
+  f.scLR = W/Mnuc;
+  f.scS  = (Mnuc/W)*(-Q2/q2);
+
+  // Helicity amplitude model (the KLN/BRS models use the CC one)
+  f.hamplmod = 0;
+  if(is_CC) {
+    f.hamplmod = fHAmplModelCC;
+  }
+  else
+    if(is_NC) {
+      if (is_p) { f.hamplmod = fHAmplModelNCp;}
+      else      { f.hamplmod = fHAmplModelNCn;}
+    }
+    else
+      if(is_EM) {
+        if (is_p) { f.hamplmod = fHAmplModelEMp;}
+        else      { f.hamplmod = fHAmplModelEMn;}
+      }
+
+  f.interaction = interaction;
+
+  f.is_nu     = is_nu;
+  f.is_nubar  = is_nubar;
+  f.is_lplus  = is_lplus;
+  f.is_lminus = is_lminus;
+  f.is_p      = is_p;
+  f.is_n      = is_n;
+  f.is_CC     = is_CC;
+  f.is_NC     = is_NC;
+  f.is_EM     = is_EM;
+  f.is_KLN    = is_KLN;
+  f.is_BRS    = is_BRS;
+
+  f.E      = E;
+  f.W      = W;
+  f.W2     = W2;
+  f.q2     = q2;
+  f.Q2     = Q2;
+  f.Q      = Q;
+  f.Mnuc   = Mnuc;
+  f.Mnuc2  = Mnuc2;
+  f.U2     = U2;
+  f.V2     = V2;
+  f.UV     = UV;
+  f.vstar  = vstar;
+  f.Qstar  = Qstar;
+  f.a      = a;
+  f.d      = TMath::Power(W+Mnuc,2.) - q2;
+  f.sq2omg = TMath::Sqrt(2./fOmega);
+  f.mq_w   = Mnuc*Q/W;
+
+  f.KNL_Alambda_plus  = KNL_Alambda_plus;
+  f.KNL_Alambda_minus = KNL_Alambda_minus;
+  f.KNL_Qstar_plus    = KNL_Qstar_plus;
+  f.KNL_Qstar_minus   = KNL_Qstar_minus;
+  f.KNL_vstar_plus    = KNL_vstar_plus;
+  f.KNL_vstar_minus   = KNL_vstar_minus;
+  f.KNL_cL_plus       = KNL_cL_plus;
+  f.KNL_cL_minus      = KNL_cL_minus;
+  f.KNL_cR_plus       = KNL_cR_plus;
+  f.KNL_cR_minus      = KNL_cR_minus;
+  f.KNL_cS_plus       = KNL_cS_plus;
+  f.KNL_cS_minus      = KNL_cS_minus;
+
+  // The algorithm computes d^2xsec/dWdQ2
+  // Check whether variable tranformation is needed
+  f.J = 1.0;
+  if ( kps != kPSWQ2fE ) {
+     f.J = utils::kinematics::Jacobian(interaction,kPSWQ2fE,kps);
+  }
+
+  // Apply given scaling factor
+  f.XSecScale = 1.0;
+  if      (is_CC) { f.XSecScale = fXSecScaleCC; }
+  else if (is_NC) { f.XSecScale = fXSecScaleNC; }
+
+  f.NNucl       = 1;
+  f.FactorPauli = 1.0;
 
-  if(is_CC && is_KLN){
-    KNL_S_plus  = (KNL_vstar_plus*vstar  - KNL_Qstar_plus *Qstar )* (Mnuc2 -q2 - 3*W*Mnuc ) * GV / (6*Mnuc2)/Q2; //possibly missing minus sign ()
-    KNL_S_minus = (KNL_vstar_minus*vstar - KNL_Qstar_minus*Qstar )* (Mnuc2 -q2 - 3*W*Mnuc ) * GV / (6*Mnuc2)/Q2;
+  // If requested return the free nucleon xsec even for input nuclear tgt
+  if ( interaction->TestBit(kIAssumeFreeNucleon) ) return true;
 
-    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"KNL S= " <<KNL_S_plus<<"\t"<<KNL_S_minus<<"\t"<<fFKR.S;
+  int Z = target.Z();
+  int A = target.A();
+  int N = A-Z;
 
-    KNL_B_plus  = fZeta/(3.*W*sq2omg)/Qstar * (KNL_Qstar_plus  + KNL_vstar_plus *Qstar/a/Mnuc ) * GA;
-    KNL_B_minus = fZeta/(3.*W*sq2omg)/Qstar * (KNL_Qstar_minus + KNL_vstar_minus*Qstar/a/Mnuc ) * GA;
-    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"KNL B= " <<KNL_B_plus<<"\t"<<KNL_B_minus<<"\t"<<fFKR.B;
+  // Take into account the number of scattering centers in the target
+  f.NNucl = (is_p) ? Z : N; // nuclear xsec (no nuclear suppression factor)
 
-    KNL_C_plus = ( (KNL_Qstar_plus*Qstar - KNL_vstar_plus*vstar ) * ( 1./3. + vstar/a/Mnuc)
-        + KNL_vstar_plus*(2./3.*W +q2/a/Mnuc + nomg/3./a/Mnuc) )* fZeta * (GA/2./W/Qstar);
+  if ( fUsePauliBlocking && A!=1 )
+  {
+    // Calculation of Pauli blocking according references:
+    //
+    //     [1] S.L. Adler,  S. Nussinov,  and  E.A.  Paschos,  "Nuclear
+    //         charge exchange corrections to leptonic pion  production
+    //         in  the (3,3) resonance  region,"  Phys. Rev. D 9 (1974)
+    //         2125-2143 [Erratum Phys. Rev. D 10 (1974) 1669].
+    //     [2] J.Y. Yu, "Neutrino interactions and  nuclear  effects in
+    //         oscillation experiments and the  nonperturbative disper-
+    //         sive  sector in strong (quasi-)abelian  fields,"  Ph. D.
+    //         Thesis, Dortmund U., Dortmund, 2002 (unpublished).
+    //     [3] E.A. Paschos, J.Y. Yu,  and  M. Sakuda,  "Neutrino  pro-
+    //         duction  of  resonances,"  Phys. Rev. D 69 (2004) 014013
+    //         [arXiv: hep-ph/0308130].
 
-    KNL_C_minus = ( (KNL_Qstar_minus*Qstar - KNL_vstar_minus*vstar ) * ( 1./3. + vstar/a/Mnuc)
-        + KNL_vstar_minus*(2./3.*W +q2/a/Mnuc + nomg/3./a/Mnuc) )* fZeta * (GA/2./W/Qstar);
+    double P_Fermi = 0.0;
 
-    LOG("BSKLNBaseRESPXSec2014",pINFO)  <<"KNL C= "<<KNL_C_plus<<"\t"<<KNL_C_minus<<"\t"<<fFKR.C;
+    // Maximum value of Fermi momentum of target nucleon (GeV)
+    if ( A<6 || ! fUseRFGParametrization )
+    {
+        // look up the Fermi momentum for this target
+        FermiMomentumTablePool * kftp = FermiMomentumTablePool::Instance();
+        const FermiMomentumTable * kft = kftp->GetTable(fKFTable);
+        P_Fermi = kft->FindClosestKF(pdg::IonPdgCode(A, Z), nucpdgc);
+     }
+     else {
+        // define the Fermi momentum for this target
+        P_Fermi = utils::nuclear::FermiMomentumForIsoscalarNucleonParametrization(target);
+        // correct the Fermi momentum for the struck nucleon
+        if(is_p) { P_Fermi *= TMath::Power( 2.*Z/A, 1./3); }
+        else     { P_Fermi *= TMath::Power( 2.*N/A, 1./3); }
+     }
+
+     double FactorPauli_RES = 1.0;
+
+     double k0 = 0., q = 0., q0 = 0.;
+
+     if (P_Fermi > 0.)
+     {
+        k0 = (W2-Mnuc2-Q2)/(2*W);
+        k = TMath::Sqrt(k0*k0+Q2);  // previous value of k is overridden
+        q0 = (W2-Mnuc2+kPionMass2)/(2*W);
+        q = TMath::Sqrt(q0*q0-kPionMass2);
+     }
+
+     if ( 2*P_Fermi < k-q )
+        FactorPauli_RES = 1.0;
+     if ( 2*P_Fermi >= k+q )
+        FactorPauli_RES = ((3*k*k+q*q)/(2*P_Fermi)-(5*TMath::Power(k,4)+TMath::Power(q,4)+10*k*k*q*q)/(40*TMath::Power(P_Fermi,3)))/(2*k);
+     if ( 2*P_Fermi >= k-q && 2*P_Fermi <= k+q )
+        FactorPauli_RES = ((q+k)*(q+k)-4*P_Fermi*P_Fermi/5-TMath::Power(k-q, 3)/(2*P_Fermi)+TMath::Power(k-q, 5)/(40*TMath::Power(P_Fermi, 3)))/(4*q*k);
+
+     f.FactorPauli = FactorPauli_RES;
   }
-  double BRS_S_plus = 0;
-  double BRS_S_minus = 0;
-  double BRS_B_plus = 0;
-  double BRS_B_minus = 0;
-  double BRS_C_plus = 0;
-  double BRS_C_minus = 0;
+  return true;
+}
+//____________________________________________________________________________
+void BSKLNBaseRESPXSec2014::ComputeFKR(
+    int IR, const KineFactors_t & f, FKRSet_t & fkr) const
+{
+  double W     = f.W;
+  double W2    = f.W2;
+  double q2    = f.q2;
+  double Q2    = f.Q2;
+  double Q     = f.Q;
+  double Mnuc  = f.Mnuc;
+  double Mnuc2 = f.Mnuc2;
+  double vstar = f.vstar;
+  double Qstar = f.Qstar;
+  double a     = f.a;
 
+  // Calculate the Feynman-Kislinger-Ravndall parameters
 
-  if(is_CC && is_BRS){
+  double Go  = TMath::Power(f.GoBase, 0.5-IR);
+  double GV  = Go * f.GVDipole;
+  double GA  = Go * f.GADipole;
 
-    KNL_S_plus  = (KNL_vstar_plus*vstar  - KNL_Qstar_plus *Qstar )* (Mnuc2 -q2 - 3*W*Mnuc ) * GV / (6*Mnuc2)/Q2;
-    KNL_S_minus = (KNL_vstar_minus*vstar - KNL_Qstar_minus*Qstar )* (Mnuc2 -q2 - 3*W*Mnuc ) * GV / (6*Mnuc2)/Q2;
+  if(fGV){
+    LOG("BSKLNBaseRESPXSec2014",pDEBUG) <<"Using new GV";
+    GV = 0.5 * TMath::Power( f.GNewBase, 0.5-IR) * f.GVNew;
+  }
 
+  if(fGA){
+    LOG("BSKLNBaseRESPXSec2014",pDEBUG) << "Using new GA";
+    //  GA = 0.5 * TMath::Sqrt(3.) * TMath::Power( 1 - q2/(Mnuc + W)/(Mnuc + W), 0.5-IR) * (1- (W2 +q2 -Mnuc2)/8./Mnuc2) * CA5/fZeta;
+    GA = 0.5 * TMath::Sqrt(3.) * TMath::Power( f.GNewBase, 0.5-IR) * f.GANew * f.CA5;
 
-    KNL_B_plus  = fZeta/(3.*W*sq2omg)/Qstar * (KNL_Qstar_plus  + KNL_vstar_plus *Qstar/a/Mnuc ) * GA;
-    KNL_B_minus = fZeta/(3.*W*sq2omg)/Qstar * (KNL_Qstar_minus + KNL_vstar_minus*Qstar/a/Mnuc ) * GA;
+    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"GA= " <<GA << "  C5A= " <<f.CA5;
+  }
+  //JN end of new form factors code
 
+  if(f.is_EM) {
+    GA = 0.; // zero the axial term for EM scattering
+  }
+
+  double d      = f.d;
+  double sq2omg = f.sq2omg;
+  double nomg   = IR * fOmega;
+  double mq_w   = f.mq_w;
+
+  fkr.fkr.Lamda  = sq2omg * mq_w;
+  fkr.fkr.Tv     = GV / (3.*W*sq2omg);
+  fkr.fkr.Rv     = kSqrt2 * mq_w*(W+Mnuc)*GV / d;
+  fkr.fkr.S      = (-q2/Q2) * (3*W*Mnuc + q2 - Mnuc2) * GV / (6*Mnuc2);
+  fkr.fkr.Ta     = (2./3.) * (fZeta/sq2omg) * mq_w * GA / d;
+  fkr.fkr.Ra     = (kSqrt2/6.) * fZeta * (GA/W) * (W+Mnuc + 2*nomg*W/d );
+  fkr.fkr.B      = fZeta/(3.*W*sq2omg) * (1 + (W2-Mnuc2+q2)/ d) * GA;
+  fkr.fkr.C      = fZeta/(6.*Q) * (W2 - Mnuc2 + nomg*(W2-Mnuc2+q2)/d) * (GA/Mnuc);
+  fkr.fkr.R      = fkr.fkr.Rv;
+  fkr.fkr.Rplus  = - (fkr.fkr.Rv + fkr.fkr.Ra);
+  fkr.fkr.Rminus = - (fkr.fkr.Rv - fkr.fkr.Ra);
+  fkr.fkr.T      = fkr.fkr.Tv;
+  fkr.fkr.Tplus  = - (fkr.fkr.Tv + fkr.fkr.Ta);
+  fkr.fkr.Tminus = - (fkr.fkr.Tv - fkr.fkr.Ta);
+
+  fkr.S_plus  = 0;
+  fkr.S_minus = 0;
+  fkr.B_plus  = 0;
+  fkr.B_minus = 0;
+  fkr.C_plus  = 0;
+  fkr.C_minus = 0;
+
+  if(! (f.is_KLN || f.is_BRS) ) {
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+    LOG("FKR", pDEBUG)
+      << "FKR params for RES index = " << IR << " : " << fkr.fkr;
+#endif
+    return;
+  }
+
+  //JN KNL
+  double KNL_S_plus  = (f.KNL_vstar_plus*vstar  - f.KNL_Qstar_plus *Qstar )* (Mnuc2 -q2 - 3*W*Mnuc ) * GV / (6*Mnuc2)/Q2; //possibly missing minus sign ()
+  double KNL_S_minus = (f.KNL_vstar_minus*vstar - f.KNL_Qstar_minus*Qstar )* (Mnuc2 -q2 - 3*W*Mnuc ) * GV / (6*Mnuc2)/Q2;
 
-    KNL_C_plus = ( (KNL_Qstar_plus*Qstar - KNL_vstar_plus*vstar ) * ( 1./3. + vstar/a/Mnuc)
-        + KNL_vstar_plus*(2./3.*W +q2/a/Mnuc + nomg/3./a/Mnuc) )* fZeta * (GA/2./W/Qstar);
+  double KNL_B_plus  = fZeta/(3.*W*sq2omg)/Qstar * (f.KNL_Qstar_plus  + f.KNL_vstar_plus *Qstar/a/Mnuc ) * GA;
+  double KNL_B_minus = fZeta/(3.*W*sq2omg)/Qstar * (f.KNL_Qstar_minus + f.KNL_vstar_minus*Qstar/a/Mnuc ) * GA;
 
-    KNL_C_minus = ( (KNL_Qstar_minus*Qstar - KNL_vstar_minus*vstar ) * ( 1./3. + vstar/a/Mnuc)
-        + KNL_vstar_minus*(2./3.*W +q2/a/Mnuc + nomg/3./a/Mnuc) )* fZeta * (GA/2./W/Qstar);
+  double KNL_C_plus = ( (f.KNL_Qstar_plus*Qstar - f.KNL_vstar_plus*vstar ) * ( 1./3. + vstar/a/Mnuc)
+      + f.KNL_vstar_plus*(2./3.*W +q2/a/Mnuc + nomg/3./a/Mnuc) )* fZeta * (GA/2./W/Qstar);
 
-    BRS_S_plus = KNL_S_plus;
-    BRS_S_minus = KNL_S_minus;
-    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"BRS S= " <<KNL_S_plus<<"\t"<<KNL_S_minus<<"\t"<<fFKR.S;
+  double KNL_C_minus = ( (f.KNL_Qstar_minus*Qstar - f.KNL_vstar_minus*vstar ) * ( 1./3. + vstar/a/Mnuc)
+      + f.KNL_vstar_minus*(2./3.*W +q2/a/Mnuc + nomg/3./a/Mnuc) )* fZeta * (GA/2./W/Qstar);
 
-    BRS_B_plus = KNL_B_plus + fZeta*GA/2./W/Qstar*( KNL_Qstar_plus*vstar - KNL_vstar_plus*Qstar)
+  if(f.is_KLN){
+    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"KNL S= " <<KNL_S_plus<<"\t"<<KNL_S_minus<<"\t"<<fkr.fkr.S;
+    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"KNL B= " <<KNL_B_plus<<"\t"<<KNL_B_minus<<"\t"<<fkr.fkr.B;
+    LOG("BSKLNBaseRESPXSec2014",pINFO)  <<"KNL C= "<<KNL_C_plus<<"\t"<<KNL_C_minus<<"\t"<<fkr.fkr.C;
+
+    fkr.S_plus  = KNL_S_plus;
+    fkr.S_minus = KNL_S_minus;
+    fkr.B_plus  = KNL_B_plus;
+    fkr.B_minus = KNL_B_minus;
+    fkr.C_plus  = KNL_C_plus;
+    fkr.C_minus = KNL_C_minus;
+  }
+  else {
+    double BRS_S_plus  = KNL_S_plus;
+    double BRS_S_minus = KNL_S_minus;
+    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"BRS S= " <<KNL_S_plus<<"\t"<<KNL_S_minus<<"\t"<<fkr.fkr.S;
+
+    double BRS_B_plus = KNL_B_plus + fZeta*GA/2./W/Qstar*( f.KNL_Qstar_plus*vstar - f.KNL_vstar_plus*Qstar)
       *( 2./3 /sq2omg *(vstar + Qstar*Qstar/Mnuc/a))/(kPionMass2 -q2);
 
-    BRS_B_minus = KNL_B_minus + fZeta*GA/2./W/Qstar*( KNL_Qstar_minus*vstar - KNL_vstar_minus*Qstar)
+    double BRS_B_minus = KNL_B_minus + fZeta*GA/2./W/Qstar*( f.KNL_Qstar_minus*vstar - f.KNL_vstar_minus*Qstar)
       *( 2./3 /sq2omg *(vstar + Qstar*Qstar/Mnuc/a))/(kPionMass2 -q2);
-    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"BRS B= " <<KNL_B_plus<<"\t"<<KNL_B_minus<<"\t"<<fFKR.B;
+    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"BRS B= " <<KNL_B_plus<<"\t"<<KNL_B_minus<<"\t"<<fkr.fkr.B;
 
-    BRS_C_plus = KNL_C_plus  + fZeta*GA/2./W/Qstar*( KNL_Qstar_plus*vstar - KNL_vstar_plus*Qstar)
+    double BRS_C_plus = KNL_C_plus  + fZeta*GA/2./W/Qstar*( f.KNL_Qstar_plus*vstar - f.KNL_vstar_plus*Qstar)
       * Qstar*(2./3.*W +q2/Mnuc/a +nomg/3./a/Mnuc)/(kPionMass2 -q2);
 
-    BRS_C_minus = KNL_C_minus  + fZeta*GA/2./W/Qstar*( KNL_Qstar_minus*vstar - KNL_vstar_minus*Qstar)
+    double BRS_C_minus = KNL_C_minus  + fZeta*GA/2./W/Qstar*( f.KNL_Qstar_minus*vstar - f.KNL_vstar_minus*Qstar)
       * Qstar*(2./3.*W +q2/Mnuc/a +nomg/3./a/Mnuc)/(kPionMass2 -q2);
-    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"BRS C= " <<KNL_C_plus<<"\t"<<KNL_C_minus<<"\t"<<fFKR.C;
+    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"BRS C= " <<KNL_C_plus<<"\t"<<KNL_C_minus<<"\t"<<fkr.fkr.C;
+
+    fkr.S_plus  = BRS_S_plus;
+    fkr.S_minus = BRS_S_minus;
+    fkr.B_plus  = BRS_B_plus;
+    fkr.B_minus = BRS_B_minus;
+    fkr.C_plus  = BRS_C_plus;
+    fkr.C_minus = BRS_C_minus;
   }
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("FKR", pDEBUG)
-    << "FKR params for RES = " << resname << " : " << fFKR;
+    << "FKR params for RES index = " << IR << " : " << fkr.fkr;
 #endif
+}
+//____________________________________________________________________________
+bool BSKLNBaseRESPXSec2014::ResonanceAllowed(
+    Resonance_t resonance, const KineFactors_t & f) const
+{
+  bool is_delta = utils::res::IsDelta (resonance);
+
+  if(f.is_CC && !is_delta) {
+    if((f.is_nu && f.is_p) || (f.is_nubar && f.is_n)) return false;
+  }
+
+  // Following NeuGEN, avoid problems with underlying unphysical
+  // model assumptions by restricting the allowed W phase space
+  // around the resonance peak
+  if (fNormBW) {
+    int    IR  = utils::res::ResonanceIndex (resonance);
+    double MR  = utils::res::Mass           (resonance);
+    double WR  = utils::res::Width          (resonance);
+    double W   = f.W;
+
+    if      (W > MR + fN0ResMaxNWidths * WR && IR==0) return false;
+    else if (W > MR + fN2ResMaxNWidths * WR && IR==2) return false;
+    else if (W > MR + fGnResMaxNWidths * WR)          return false;
+  }
+  return true;
+}
+//____________________________________________________________________________
+double BSKLNBaseRESPXSec2014::ResonanceXSec(
+    Resonance_t resonance, const KineFactors_t & f, const FKRSet_t & fkr) const
+{
+  bool is_delta  = utils::res::IsDelta (resonance);
+
+  bool is_KLN    = f.is_KLN;
+  bool is_BRS    = f.is_BRS;
+  bool is_nu     = f.is_nu;
+  bool is_nubar  = f.is_nubar;
+  bool is_lplus  = f.is_lplus;
+  bool is_lminus = f.is_lminus;
+  bool is_CC     = f.is_CC;
+  double W       = f.W;
+  double q2      = f.q2;
+  double U2      = f.U2;
+  double V2      = f.V2;
+  double UV      = f.UV;
+  double sig0    = f.sig0;
+
+  // Get baryon resonance parameters
+  int    LR  = utils::res::OrbitalAngularMom (resonance);
+  double MR  = utils::res::Mass              (resonance);
+  double WR  = utils::res::Width             (resonance);
+  double NR  = fNormBW?utils::res::BWNorm    (resonance,fN0ResMaxNWidths,fN2ResMaxNWidths,fGnResMaxNWidths):1;
+
+  fFKR = fkr.fkr;
 
   // Calculate the Rein-Sehgal Helicity Amplitudes
   double sigL_minus = 0;
@@ -435,37 +719,6 @@ double BSKLNBaseRESPXSec2014::XSec(
   double sigR_plus = 0;
   double sigS_plus = 0;
 
-  const RSHelicityAmplModelI * hamplmod = 0;
-  const RSHelicityAmplModelI * hamplmod_KNL_minus = 0;
-  const RSHelicityAmplModelI * hamplmod_KNL_plus = 0;
-  const RSHelicityAmplModelI * hamplmod_BRS_minus = 0;
-  const RSHelicityAmplModelI * hamplmod_BRS_plus = 0;
-
-  // These lines were ~ 100 lines below, which means that, for EM interactions, the coefficients below were still calculated using the weak coupling constant - Afro
-  double g2 = kGF2;
-
-  // For EM interaction replace  G_{Fermi} with :
-  // a_{em} * pi / ( sqrt(2) * sin^2(theta_weinberg) * Mass_{W}^2 }
-  // See C.Quigg, Gauge Theories of the Strong, Weak and E/M Interactions,
-  // ISBN 0-8053-6021-2, p.112 (6.3.57)
-  // Also, take int account that the photon propagator is 1/p^2 but the
-  // W propagator is 1/(p^2-Mass_{W}^2), so weight the EM case with
-  // Mass_{W}^4 / q^4
-  // So, overall:
-  // G_{Fermi}^2 --> a_{em}^2 * pi^2 / (2 * sin^4(theta_weinberg) * q^{4})
-  //
-
-  if(is_EM) {
-    double q4 = q2*q2;
-    g2 = kAem2 * kPi2 / (2.0 * fSin48w * q4);
-  }
-
-  if(is_CC) g2 = kGF2*fVud2;
-
-  double sig0 = 0.125*(g2/kPi)*(-q2/Q2)*(W/Mnuc);
-  double scLR = W/Mnuc;
-  double scS  = (Mnuc/W)*(-Q2/q2);
-
   double sigL =0;
   double sigR =0;
   double sigS =0;
@@ -474,87 +727,38 @@ double BSKLNBaseRESPXSec2014::XSec(
   double sigRSR =0;
   double sigRSS =0;
 
-  if(is_CC && !(is_KLN || is_BRS) ) {
+  const RSHelicityAmplModelI * hamplmod = f.hamplmod;
+  assert(hamplmod);
 
-    hamplmod = fHAmplModelCC;
-  }
-  else
-    if(is_NC) {
-      if (is_p) { hamplmod = fHAmplModelNCp;}
-      else      { hamplmod = fHAmplModelNCn;}
-    }
-    else
-      if(is_EM) {
-        if (is_p) { hamplmod = fHAmplModelEMp;}
-        else      { hamplmod = fHAmplModelEMn;}
-      }
-      else
-        if(is_CC && is_KLN ){
-          fFKR.S = KNL_S_minus;        //2 times fFKR.S?
-          fFKR.B = KNL_B_minus;
-          fFKR.C = KNL_C_minus;
-
-          hamplmod_KNL_minus = fHAmplModelCC;
-
-          assert(hamplmod_KNL_minus);
-
-          const RSHelicityAmpl & hampl_KNL_minus = hamplmod_KNL_minus->Compute(resonance, fFKR);
-
-          sigL_minus = (hampl_KNL_minus.Amp2Plus3 () + hampl_KNL_minus.Amp2Plus1 ());
-          sigR_minus = (hampl_KNL_minus.Amp2Minus3() + hampl_KNL_minus.Amp2Minus1());
-          sigS_minus = (hampl_KNL_minus.Amp20Plus () + hampl_KNL_minus.Amp20Minus());
-
-
-          fFKR.S = KNL_S_plus;
-          fFKR.B = KNL_B_plus;
-          fFKR.C = KNL_C_plus;
-          hamplmod_KNL_plus = fHAmplModelCC;
-          assert(hamplmod_KNL_plus);
-
-          const RSHelicityAmpl & hampl_KNL_plus = hamplmod_KNL_plus->Compute(resonance, fFKR);
-
-          sigL_plus = (hampl_KNL_plus.Amp2Plus3 () + hampl_KNL_plus.Amp2Plus1 ());
-          sigR_plus = (hampl_KNL_plus.Amp2Minus3() + hampl_KNL_plus.Amp2Minus1());
-          sigS_plus = (hampl_KNL_plus.Amp20Plus () + hampl_KNL_plus.Amp20Minus());
-
-        }
-        else
-          if(is_CC && is_BRS ){
-            fFKR.S = BRS_S_minus;
-            fFKR.B = BRS_B_minus;
-            fFKR.C = BRS_C_minus;
+  // Compute the cross section
+  if(is_KLN || is_BRS) {
 
-            hamplmod_BRS_minus = fHAmplModelCC;
-            assert(hamplmod_BRS_minus);
+     fFKR.S = fkr.S_minus;        //2 times fFKR.S?
+     fFKR.B = fkr.B_minus;
+     fFKR.C = fkr.C_minus;
 
-            const RSHelicityAmpl & hampl_BRS_minus = hamplmod_BRS_minus->Compute(resonance, fFKR);
+     const RSHelicityAmpl & hampl_minus = hamplmod->Compute(resonance, fFKR);
 
-            sigL_minus = (hampl_BRS_minus.Amp2Plus3 () + hampl_BRS_minus.Amp2Plus1 ());
-            sigR_minus = (hampl_BRS_minus.Amp2Minus3() + hampl_BRS_minus.Amp2Minus1());
-            sigS_minus = (hampl_BRS_minus.Amp20Plus () + hampl_BRS_minus.Amp20Minus());
+     sigL_minus = (hampl_minus.Amp2Plus3 () + hampl_minus.Amp2Plus1 ());
+     sigR_minus = (hampl_minus.Amp2Minus3() + hampl_minus.Amp2Minus1());
+     sigS_minus = (hampl_minus.Amp20Plus () + hampl_minus.Amp20Minus());
 
-            fFKR.S = BRS_S_plus;
-            fFKR.B = BRS_B_plus;
-            fFKR.C = BRS_C_plus;
-            hamplmod_BRS_plus = fHAmplModelCC;
-            assert(hamplmod_BRS_plus);
+     fFKR.S = fkr.S_plus;
+     fFKR.B = fkr.B_plus;
+     fFKR.C = fkr.C_plus;
 
-            const RSHelicityAmpl & hampl_BRS_plus = hamplmod_BRS_plus->Compute(resonance, fFKR);
+     const RSHelicityAmpl & hampl_plus = hamplmod->Compute(resonance, fFKR);
 
-            sigL_plus = (hampl_BRS_plus.Amp2Plus3 () + hampl_BRS_plus.Amp2Plus1 ());
-            sigR_plus = (hampl_BRS_plus.Amp2Minus3() + hampl_BRS_plus.Amp2Minus1());
-            sigS_plus = (hampl_BRS_plus.Amp20Plus () + hampl_BRS_plus.Amp20Minus());
-          }
+     sigL_plus = (hampl_plus.Amp2Plus3 () + hampl_plus.Amp2Plus1 ());
+     sigR_plus = (hampl_plus.Amp2Minus3() + hampl_plus.Amp2Minus1());
+     sigS_plus = (hampl_plus.Amp20Plus () + hampl_plus.Amp20Minus());
 
-  // Compute the cross section
-  if(is_KLN || is_BRS) {
-
-     sigL_minus *= scLR;
-     sigR_minus *= scLR;
-     sigS_minus *= scS;
-     sigL_plus  *= scLR;
-     sigR_plus  *= scLR;
-     sigS_plus  *= scS;
+     sigL_minus *= f.scLR;
+     sigR_minus *= f.scLR;
+     sigS_minus *= f.scS;
+     sigL_plus  *= f.scLR;
+     sigR_plus  *= f.scLR;
+     sigS_plus  *= f.scS;
 
      LOG("BSKLNBaseRESPXSec2014", pINFO)
          << "sL,R,S minus = " << sigL_minus << "," << sigR_minus << "," << sigS_minus;
@@ -562,13 +766,11 @@ double BSKLNBaseRESPXSec2014::XSec(
          << "sL,R,S plus = " << sigL_plus << "," << sigR_plus << "," << sigS_plus;
   }
   else {
-     assert(hamplmod);
-
      const RSHelicityAmpl & hampl = hamplmod->Compute(resonance, fFKR);
 
-     sigL = scLR* (hampl.Amp2Plus3 () + hampl.Amp2Plus1 ());
-     sigR = scLR* (hampl.Amp2Minus3() + hampl.Amp2Minus1());
-     sigS = scS * (hampl.Amp20Plus () + hampl.Amp20Minus());
+     sigL = f.scLR* (hampl.Amp2Plus3 () + hampl.Amp2Plus1 ());
+     sigR = f.scLR* (hampl.Amp2Minus3() + hampl.Amp2Minus1());
+     sigS = f.scS * (hampl.Amp20Plus () + hampl.Amp20Minus());
   }
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
@@ -581,22 +783,22 @@ double BSKLNBaseRESPXSec2014::XSec(
   double xsec = 0.0;
 
   if(is_KLN || is_BRS) {
-      xsec =   TMath::Power(KNL_cL_minus,2)*sigL_minus + TMath::Power(KNL_cL_plus,2)*sigL_plus
-             + TMath::Power(KNL_cR_minus,2)*sigR_minus + TMath::Power(KNL_cR_plus,2)*sigR_plus
-             + TMath::Power(KNL_cS_minus,2)*sigS_minus + TMath::Power(KNL_cS_plus,2)*sigS_plus;
+      xsec =   TMath::Power(f.KNL_cL_minus,2)*sigL_minus + TMath::Power(f.KNL_cL_plus,2)*sigL_plus
+             + TMath::Power(f.KNL_cR_minus,2)*sigR_minus + TMath::Power(f.KNL_cR_plus,2)*sigR_plus
+             + TMath::Power(f.KNL_cS_minus,2)*sigS_minus + TMath::Power(f.KNL_cS_plus,2)*sigS_plus;
       xsec *=sig0;
 
-      LOG("BSKLNBaseRESPXSec2014",pINFO) << "A-="<<KNL_Alambda_minus<<" A+="<<KNL_Alambda_plus;
+      LOG("BSKLNBaseRESPXSec2014",pINFO) << "A-="<<f.KNL_Alambda_minus<<" A+="<<f.KNL_Alambda_plus;
       // protect against sigRSR=sigRSL=sigRSS=0
       LOG("BSKLNBaseRESPXSec2014",pINFO) <<q2<<"\t"<<xsec<<"\t"<<sig0*(V2*sigR + U2*sigL + 2*UV*sigS)<<"\t"<<xsec/TMath::Max(sig0*(V2*sigRSR + U2*sigRSL + 2*UV*sigRSS),1.0e-100);
       LOG("BSKLNBaseRESPXSec2014",pINFO) <<"fFKR.B="<<fFKR.B<<" fFKR.C="<<fFKR.C<<" fFKR.S="<<fFKR.S;
-      LOG("BSKLNBaseRESPXSec2014",pINFO) <<"CL-="<<TMath::Power(KNL_cL_minus,2)<<" CL+="<<TMath::Power(KNL_cL_plus,2)<<" U2="<<U2;
+      LOG("BSKLNBaseRESPXSec2014",pINFO) <<"CL-="<<TMath::Power(f.KNL_cL_minus,2)<<" CL+="<<TMath::Power(f.KNL_cL_plus,2)<<" U2="<<U2;
       LOG("BSKLNBaseRESPXSec2014",pINFO) <<"SL-="<<sigL_minus<<" SL+="<<sigL_plus<<" SL="<<sigRSL;
 
-      LOG("BSKLNBaseRESPXSec2014",pINFO) <<"CR-="<<TMath::Power(KNL_cR_minus,2)<<" CR+="<<TMath::Power(KNL_cR_plus,2)<<" V2="<<V2;
+      LOG("BSKLNBaseRESPXSec2014",pINFO) <<"CR-="<<TMath::Power(f.KNL_cR_minus,2)<<" CR+="<<TMath::Power(f.KNL_cR_plus,2)<<" V2="<<V2;
       LOG("BSKLNBaseRESPXSec2014",pINFO) <<"SR-="<<sigR_minus<<" SR+="<<sigR_plus<<" sR="<<sigRSR;
 
-      LOG("BSKLNBaseRESPXSec2014",pINFO) <<"CS-="<<TMath::Power(KNL_cS_minus,2)<<" CS+="<<TMath::Power(KNL_cS_plus,2)<<" UV="<<UV;
+      LOG("BSKLNBaseRESPXSec2014",pINFO) <<"CS-="<<TMath::Power(f.KNL_cS_minus,2)<<" CS+="<<TMath::Power(f.KNL_cS_plus,2)<<" UV="<<UV;
       LOG("BSKLNBaseRESPXSec2014",pINFO) <<"SS-="<<sigL_minus<<" SS+="<<sigS_plus<<" sS="<<sigRSS;
   }
   else {
@@ -611,7 +813,7 @@ double BSKLNBaseRESPXSec2014::XSec(
   }
   double mult = 1.0;
   if ( is_CC && is_delta ) {
-     if ( (is_nu && is_p) || (is_nubar && is_n) ) mult=3.0;
+     if ( (is_nu && f.is_p) || (is_nubar && f.is_n) ) mult=3.0;
   }
   xsec *= mult;
 
@@ -623,93 +825,24 @@ double BSKLNBaseRESPXSec2014::XSec(
   }
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("BSKLNBaseRESPXSec2014", pDEBUG)
-      << "BreitWigner(RES=" << resname << ", W=" << W << ") = " << bw;
+      << "BreitWigner(RES=" << utils::res::AsString(resonance)
+      << ", W=" << W << ") = " << bw;
 #endif
   xsec *= bw;
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("BSKLNBaseRESPXSec2014", pINFO)
-      << "\n d2xsec/dQ2dW"  << "[" << interaction->AsString()
-      << "](W=" << W << ", q2=" << q2 << ", E=" << E << ") = " << xsec;
+      << "\n d2xsec/dQ2dW"  << "[" << f.interaction->AsString()
+      << "](W=" << W << ", q2=" << q2 << ", E=" << f.E << ") = " << xsec;
 #endif
 
-  // The algorithm computes d^2xsec/dWdQ2
-  // Check whether variable tranformation is needed
-  if ( kps != kPSWQ2fE ) {
-     double J = utils::kinematics::Jacobian(interaction,kPSWQ2fE,kps);
-     xsec *= J;
-  }
-
-  // Apply given scaling factor
-  if      (is_CC) { xsec *= fXSecScaleCC; }
-  else if (is_NC) { xsec *= fXSecScaleNC; }
-
-  // If requested return the free nucleon xsec even for input nuclear tgt
-  if ( interaction->TestBit(kIAssumeFreeNucleon) ) return xsec;
-
-  int Z = target.Z();
-  int A = target.A();
-  int N = A-Z;
-
-  // Take into account the number of scattering centers in the target
-  int NNucl = (is_p) ? Z : N;
-  xsec*=NNucl; // nuclear xsec (no nuclear suppression factor)
-
-  if ( fUsePauliBlocking && A!=1 )
-  {
-    // Calculation of Pauli blocking according references:
-    //
-    //     [1] S.L. Adler,  S. Nussinov,  and  E.A.  Paschos,  "Nuclear
-    //         charge exchange corrections to leptonic pion  production
-    //         in  the (3,3) resonance  region,"  Phys. Rev. D 9 (1974)
-    //         2125-2143 [Erratum Phys. Rev. D 10 (1974) 1669].
-    //     [2] J.Y. Yu, "Neutrino interactions and  nuclear  effects in
-    //         oscillation experiments and the  nonperturbative disper-
-    //         sive  sector in strong (quasi-)abelian  fields,"  Ph. D.
-    //         Thesis, Dortmund U., Dortmund, 2002 (unpublished).
-    //     [3] E.A. Paschos, J.Y. Yu,  and  M. Sakuda,  "Neutrino  pro-
-    //         duction  of  resonances,"  Phys. Rev. D 69 (2004) 014013
-    //         [arXiv: hep-ph/0308130].
-
-    double P_Fermi = 0.0;
-
-    // Maximum value of Fermi momentum of target nucleon (GeV)
-    if ( A<6 || ! fUseRFGParametrization )
-    {
-        // look up the Fermi momentum for this target
-        FermiMomentumTablePool * kftp = FermiMomentumTablePool::Instance();
-        const FermiMomentumTable * kft = kftp->GetTable(fKFTable);
-        P_Fermi = kft->FindClosestKF(pdg::IonPdgCode(A, Z), nucpdgc);
-     }
-     else {
-        // define the Fermi momentum for this target
-        P_Fermi = utils::nuclear::FermiMomentumForIsoscalarNucleonParametrization(target);
-        // correct the Fermi momentum for the struck nucleon
-        if(is_p) { P_Fermi *= TMath::Power( 2.*Z/A, 1./3); }
-        else     { P_Fermi *= TMath::Power( 2.*N/A, 1./3); }
-     }
-
-     double FactorPauli_RES = 1.0;
+  // Jacobian, scaling factor, number of scattering centers and Pauli
+  // blocking factor (all 1 if not applicable)
+  xsec *= f.J;
+  xsec *= f.XSecScale;
+  xsec *= f.NNucl;
+  xsec *= f.FactorPauli;
 
-     double k0 = 0., q = 0., q0 = 0.;
-
-     if (P_Fermi > 0.)
-     {
-        k0 = (W2-Mnuc2-Q2)/(2*W);
-        k = TMath::Sqrt(k0*k0+Q2);  // previous value of k is overridden
-        q0 = (W2-Mnuc2+kPionMass2)/(2*W);
-        q = TMath::Sqrt(q0*q0-kPionMass2);
-     }
-
-     if ( 2*P_Fermi < k-q )
-        FactorPauli_RES = 1.0;
-     if ( 2*P_Fermi >= k+q )
-        FactorPauli_RES = ((3*k*k+q*q)/(2*P_Fermi)-(5*TMath::Power(k,4)+TMath::Power(q,4)+10*k*k*q*q)/(40*TMath::Power(P_Fermi,3)))/(2*k);
-     if ( 2*P_Fermi >= k-q && 2*P_Fermi <= k+q )
-        FactorPauli_RES = ((q+k)*(q+k)-4*P_Fermi*P_Fermi/5-TMath::Power(k-q, 3)/(2*P_Fermi)+TMath::Power(k-q, 5)/(40*TMath::Power(P_Fermi, 3)))/(4*q*k);
-
-     xsec *= FactorPauli_RES;
-  }
   return xsec;
 }
 //____________________________________________________________________________
@@ -723,12 +856,18 @@ bool BSKLNBaseRESPXSec2014::ValidProcess(const Interaction * interaction) const
 {
   if(interaction->TestBit(kISkipProcessChk)) return true;
 
+  if(!interaction->ExclTag().KnownResonance()) return false;
+
+  return this->ValidResonantProcess(interaction);
+}
+//____________________________________________________________________________
+bool BSKLNBaseRESPXSec2014::ValidResonantProcess(
+    const Interaction * interaction) const
+{
   const InitialState & init_state = interaction->InitState();
   const ProcessInfo &  proc_info  = interaction->ProcInfo();
-  const XclsTag &      xcls       = interaction->ExclTag();
 
   if(!proc_info.IsResonant()) return false;
-  if(!xcls.KnownResonance())  return false;
 
   int  hitnuc = init_state.Tgt().HitNucPdg();
   bool is_pn = (pdg::IsProton(hitnuc) || pdg::IsNeutron(hitnuc));
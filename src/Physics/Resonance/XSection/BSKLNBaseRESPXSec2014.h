@@ -35,6 +35,8 @@
 #ifndef _BSKLN_BASE_RES_PXSEC_2014_H_
 #define _BSKLN_BASE_RES_PXSEC_2014_H_
 
+#include <vector>
+
 #include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Framework/ParticleData/BaryonResonance.h"
 #include "Physics/Resonance/XSection/FKR.h"
@@ -55,6 +57,15 @@ namespace genie {
       double Integral     (const Interaction * i) const;
       bool   ValidProcess (const Interaction * i) const;
 
+      // d^2xsec/dWdQ2 (or its transformation to the input phase space) of
+      // each of the input resonances at the kinematics of the input interaction:
+      // xsec[i] is the XSec() of the interaction tagged with resonance res[i].
+      // The resonance-independent terms are computed once for all resonances
+      // and the FKR parameters once per resonance index
+      void   XSecPerResonance (const Interaction * i,
+                               const std::vector<Resonance_t> & res,
+                               std::vector<double> & xsec, KinePhaseSpace_t k) const;
+
       // overload the Algorithm::Configure() methods to load private data
       // members from configuration options
       void Configure(const Registry & config);
@@ -104,6 +115,41 @@ namespace genie {
       bool fGV;
 
       const XSecIntegratorI * fXSecIntegrator;
+
+    private:
+
+      // resonance-independent factors of the cross section at a kinematic point
+      struct KineFactors_t {
+        const Interaction * interaction;
+        bool   is_nu, is_nubar, is_lplus, is_lminus, is_p, is_n;
+        bool   is_CC, is_NC, is_EM, is_KLN, is_BRS;
+        double E, W, W2, q2, Q2, Q, Mnuc, Mnuc2, U2, V2, UV;
+        double vstar, Qstar, a, d, sq2omg, mq_w;
+        double KNL_Alambda_plus, KNL_Alambda_minus;
+        double KNL_Qstar_plus, KNL_Qstar_minus, KNL_vstar_plus, KNL_vstar_minus;
+        double KNL_cL_plus, KNL_cL_minus, KNL_cR_plus, KNL_cR_minus;
+        double KNL_cS_plus, KNL_cS_minus;
+        double GoBase, GVDipole, GADipole;     ///< form factors, w/o the IR dependence
+        double GNewBase, GVNew, GANew, CA5;    ///< new (fGV, fGA) form factors, w/o the IR dependence
+        double sig0, scLR, scS;
+        double J;                              ///< Jacobian to the requested phase space
+        double XSecScale;                      ///< CC/NC xsec scaling factor
+        int    NNucl;                          ///< number of scattering centers
+        double FactorPauli;                    ///< Pauli blocking factor
+        const RSHelicityAmplModelI * hamplmod;
+      };
+
+      // FKR parameters for a resonance index, incl. the KLN/BRS S, B, C
+      struct FKRSet_t {
+        FKR    fkr;
+        double S_plus, S_minus, B_plus, B_minus, C_plus, C_minus;
+      };
+
+      bool   ValidResonantProcess (const Interaction * i) const;
+      bool   ComputeKineFactors   (const Interaction * i, KinePhaseSpace_t k, KineFactors_t & f) const;
+      void   ComputeFKR           (int IR, const KineFactors_t & f, FKRSet_t & fkr) const;
+      bool   ResonanceAllowed     (Resonance_t res, const KineFactors_t & f) const;
+      double ResonanceXSec        (Resonance_t res, const KineFactors_t & f, const FKRSet_t & fkr) const;
   };
 
 }       // genie namespace
@@ -65,23 +65,17 @@ double RESXSec::Integrate(
   ROOT::Math::IBaseFunctionMultiDim * func =
       new utils::gsl::d2XSec_dWdQ2_E(model, interaction);
 
-  ROOT::Math::IntegrationMultiDim::Type ig_type =
-      utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
   double abstol = 1E-16; //We mostly care about relative tolerance.
 
-  ROOT::Math::IntegratorMultiDim ig(*func, ig_type, abstol, fGSLRelTol, fGSLMaxEval);
-
   double kine_min[2] = { Wl.min, Q2l.min };
   double kine_max[2] = { Wl.max, Q2l.max };
-  double xsec = ig.Integral(kine_min, kine_max) * (1E-38 * units::cm2);
-
-  LOG("RESXSec", pERROR)  << "Integrator opt / Integrator = " <<  ig.Options().Integrator();
+  double xsec = utils::gsl::IntegrateMultiDim(*func, fGSLIntgType, kine_min, kine_max,
+                   abstol, fGSLRelTol, fGSLMaxEval) * (1E-38 * units::cm2);
 
   if(xsec < 0) {
     LOG("RESXSec", pERROR)  << "Algorithm " << *model << " returns a negative cross-section (xsec = " << xsec << " 1E-38 * cm2)";
     LOG("RESXSec", pERROR)  << "for process" << *interaction;
-    LOG("RESXSec", pERROR)  << "Integrator status code = " << ig.Status();
-    LOG("RESXSec", pERROR)  << "Integrator error code = " << ig.Error();
+    LOG("RESXSec", pERROR)  << "Integrator = " << fGSLIntgType;
   }
 
   //LOG("RESXSec", pINFO)  << "XSec[RES] (Ev = " << Ev << " GeV) = " << xsec;
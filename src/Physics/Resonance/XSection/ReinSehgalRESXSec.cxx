@@ -175,13 +175,10 @@ double ReinSehgalRESXSec::Integrate(
 
     ROOT::Math::IBaseFunctionMultiDim * func =
         new utils::gsl::d2XSec_dWdQ2_E(model, interaction);
-    ROOT::Math::IntegrationMultiDim::Type ig_type =
-        utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
-    ROOT::Math::IntegratorMultiDim ig(ig_type,0,fGSLRelTol,fGSLMaxEval);
-    ig.SetFunction(*func);
     double kine_min[2] = { rW.min, rQ2.min };
     double kine_max[2] = { rW.max, rQ2.max };
-    double xsec = ig.Integral(kine_min, kine_max) * (1E-38 * units::cm2);
+    double xsec = utils::gsl::IntegrateMultiDim(*func, fGSLIntgType,
+       kine_min, kine_max, 0, fGSLRelTol, fGSLMaxEval) * (1E-38 * units::cm2);
 
     delete func;
     return xsec;
@@ -125,7 +125,7 @@ void ReinSehgalRESXSecWithCacheFast::CacheResExcitationXSec(
          LOG("ReinSehgalResCF", pNOTICE)
                         << "\n ** Creating cache branch - key = " << key;
          cache_branch = new CacheBranchFx("RES Excitation XSec");
-         cache->AddCacheBranch(key, cache_branch);
+         cache->AddCacheBranch(key, cache_branch, true);
          assert(cache_branch);
 
          const KPhaseSpace & kps = interaction->PhaseSpace();
@@ -174,12 +174,10 @@ void ReinSehgalRESXSecWithCacheFast::CacheResExcitationXSec(
                               << "** Not allowed kinematically, xsec=0";
                } else {
                                   ROOT::Math::IBaseFunctionMultiDim * func= new utils::gsl::d2XSecRESFast_dWQ2_E(fSingleResXSecModel, interaction);
-                  ROOT::Math::IntegrationMultiDim::Type ig_type = utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
-                  ROOT::Math::IntegratorMultiDim ig(ig_type,0,fGSLRelTol,fGSLMaxEval);
-                  ig.SetFunction(*func);
                   double kine_min[2] = { rW.min, rQ2.min };
                   double kine_max[2] = { rW.max, rQ2.max };
-                  xsec = ig.Integral(kine_min, kine_max) * (1E-38 * units::cm2);
+                  xsec = utils::gsl::IntegrateMultiDim(*func, fGSLIntgType,
+                     kine_min, kine_max, 0, fGSLRelTol, fGSLMaxEval) * (1E-38 * units::cm2);
                   delete func;
                }
              } else {
@@ -226,7 +224,7 @@ string ReinSehgalRESXSecWithCacheFast::CacheBranchName(
 //____________________________________________________________________________
 genie::utils::gsl::d2XSecRESFast_dWQ2_E::d2XSecRESFast_dWQ2_E(
      const XSecAlgorithmI * m, const Interaction * i) :
-ROOT::Math::IBaseFunctionMultiDim(),
+BatchFunctionMultiDim(),
 fModel(m),
 fInteraction(i)
 {
@@ -32,6 +32,7 @@
 #include <Math/IFunction.h>
 #include <Math/IntegratorMultiDim.h>
 
+#include "Framework/Numerical/BatchFunctionMultiDim.h"
 #include "Physics/XSectionIntegration/XSecIntegratorI.h"
 #include "Framework/ParticleData//BaryonResList.h"
 #include "Framework/ParticleData/BaryonResonance.h"
@@ -75,7 +76,7 @@ namespace gsl   {
 // genie::utils::gsl::d2XSecRESFast_dWQ2_E
 // A 2-D cross section function: d2xsec/dWdQ2 = f(W,Q2)|(fixed E)
 //
-class d2XSecRESFast_dWQ2_E: public ROOT::Math::IBaseFunctionMultiDim
+class d2XSecRESFast_dWQ2_E: public genie::BatchFunctionMultiDim
 {
 public:
   d2XSecRESFast_dWQ2_E(const XSecAlgorithmI * m, const Interaction * i);
@@ -209,6 +209,7 @@ void SKKinematicsGenerator::CalculateKin_AtharSingleKaon(GHepRecord * evrec) con
 
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {
+this->RecordAccepted(interaction, iter);
 
         // calculate the stuff
 
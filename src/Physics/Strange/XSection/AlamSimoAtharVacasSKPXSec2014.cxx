@@ -90,24 +90,23 @@ double AlamSimoAtharVacasSKPXSec2014::XSec(
   // Set lepton mass
   aml = PDGLibrary::Instance()->Find(leptonPDG)->Mass(); // mutable
 
-  double theta = TMath::ACos(costheta);
-
   // Set reaction parameters, which are mutables used in the matrix element calculations
+  // (the hadron masses are looked up once, at configuration)
   if (reactionType == 1) {
-    amSig = PDGLibrary::Instance()->Find(kPdgSigmaM)->Mass();
-    amk   = PDGLibrary::Instance()->Find(kPdgKP)->Mass();
+    amSig = fMassSigmaM;
+    amk   = fMassKP;
     ampi  = kPi0Mass;
     am    = kNeutronMass;
   }
   else if (reactionType == 2) {
-    amSig = PDGLibrary::Instance()->Find(kPdgSigma0)->Mass();
-    amk   = PDGLibrary::Instance()->Find(kPdgK0)->Mass();
+    amSig = fMassSigma0;
+    amk   = fMassK0;
     ampi  = kPionMass;
     am    = kNeutronMass;
   }
   else if (reactionType == 3) {
-    amSig = PDGLibrary::Instance()->Find(kPdgSigma0)->Mass();
-    amk   = PDGLibrary::Instance()->Find(kPdgKP)->Mass();
+    amSig = fMassSigma0;
+    amk   = fMassKP;
     ampi  = kPi0Mass;
     am    = kProtonMass;
   }
@@ -140,9 +139,24 @@ double AlamSimoAtharVacasSKPXSec2014::XSec(
   double amat2; // the matrix element
   if (fabs(check) <= 1.0) { // so it has to be smaller than 1, but it could be negative if the kaon backscatters in com frame
     angkq = check;
-    if      (reactionType == 1) amat2 = this->Amatrix_NN(theta, phikq);
-    else if (reactionType == 2) amat2 = this->Amatrix_NP(theta, phikq);
-    else if (reactionType == 3) amat2 = this->Amatrix_PP(theta, phikq);
+
+    // lepton-kaon scalars entering all matrix elements, once per kinematic point
+    double sintheta = TMath::Sqrt(TMath::Max(0., 1.0-costheta*costheta));
+    KineScalars ks;
+    ks.akk1     = Enu*Elep-Enu*alepvec*costheta;
+    double zdotq    = (Enu*Enu-alepvec*alepvec)/2.0;
+    double qdotpk   = aqvec*pkvec*angkq;
+    double akcrosk1 = Enu*alepvec*sintheta;
+    double qcrospk  = aqvec*pkvec*sqrt(1.0-angkq*angkq);
+    double zdotpk   = (akcrosk1*qcrospk*cos(phikq)+zdotq*qdotpk)/(aqvec*aqvec);
+    double azpk     = Ekaon*(Enu+Elep)/2.0-zdotpk;
+    ks.aqkaon   = aq0*Ekaon-qdotpk;
+    ks.akpk     = azpk + ks.aqkaon/2.0;
+    ks.apkk1    = azpk - ks.aqkaon/2.0;
+
+    if      (reactionType == 1) amat2 = this->Amatrix_NN(ks);
+    else if (reactionType == 2) amat2 = this->Amatrix_NP(ks);
+    else if (reactionType == 3) amat2 = this->Amatrix_PP(ks);
     else    return 0.;
     xsec = alepvec*alepvec*amat2/(32.0*pow(2.0*kPi,4)*am*Enu*Elep*aqvec);
   }
@@ -216,6 +230,13 @@ void AlamSimoAtharVacasSKPXSec2014::LoadConfig(void)
   Fm1 = -(amup+2.0*amun)/(2.0*am);
   Fm2 = -3.0*amup/(2.0*am);
 
+  // constants of the matrix element calculations
+  fCon = g*g*Vus*Vus/(4.0*fpi*fpi);
+  fMassSigmaM = PDGLibrary::Instance()->Find(kPdgSigmaM)->Mass();
+  fMassSigma0 = PDGLibrary::Instance()->Find(kPdgSigma0)->Mass();
+  fMassKP     = PDGLibrary::Instance()->Find(kPdgKP)->Mass();
+  fMassK0     = PDGLibrary::Instance()->Find(kPdgK0)->Mass();
+
 }
 //____________________________________________________________________________
 
@@ -342,26 +363,19 @@ void AlamSimoAtharVacasSKPXSec2014::LoadConfig(void)
 // *****************************************************************************
 
 //____________________________________________________________________________
-double AlamSimoAtharVacasSKPXSec2014::Amatrix_NN(double theta, double phikq) const
+double AlamSimoAtharVacasSKPXSec2014::Amatrix_NN(const KineScalars & ks) const
 {
 
   double sol = 0.;
 
-  double akk1=0., zdotq=0., qdotpk=0., akcrosk1=0., qcrospk=0.;
-  double zdotpk=0., azpk=0., aqkaon=0., akpk=0., apkk1=0.;
+  double akk1=0., aqkaon=0., akpk=0., apkk1=0.;
   double C1=0., C2=0., C3=0., C4=0., /*C5=0., C6=0.,*/ C7=0., C8=0., C9=0.;
   double aq2=0., gform=0., con=0., t1=0., t2=0., t3=0., /*t4=0.,*/ t5=0., t6=0.;
 
-  akk1=Enu*Elep-Enu*alepvec*cos(theta);
-  zdotq=(Enu*Enu-alepvec*alepvec)/2.0;
-  qdotpk=aqvec*pkvec*angkq;
-  akcrosk1 = Enu*alepvec*sin(theta);
-  qcrospk=aqvec*pkvec*sqrt(1.0-angkq*angkq);
-  zdotpk=(akcrosk1*qcrospk*cos(phikq)+zdotq*qdotpk)/(aqvec*aqvec);
-  azpk=Ekaon*(Enu+Elep)/2.0-zdotpk;
-  aqkaon=aq0*Ekaon-aqvec*pkvec*angkq;
-  akpk=azpk + aqkaon/2.0;
-  apkk1=azpk - aqkaon/2.0;
+  akk1     = ks.akk1;
+  aqkaon   = ks.aqkaon;
+  akpk     = ks.akpk;
+  apkk1    = ks.apkk1;
 
   C1=1.0/(am*am+amk*amk-2.0*am*Ekaon-amSig*amSig);
   C2=d+f;
@@ -373,9 +387,10 @@ double AlamSimoAtharVacasSKPXSec2014::Amatrix_NN(double theta, double phikq) con
   C8=2.0*am/(aml*aml-2.0*akk1+amk*amk-2.*aqkaon-amEta*amEta);
   C9=d - 3.*f;
   aq2=aml*aml-2.0*akk1;
-  gform=1.0/pow(1.0-aq2/(1.0*1.0),4);
+  gform=1.0/((1.0-aq2/(1.0*1.0))*(1.0-aq2/(1.0*1.0)));
+  gform*=gform;
 
-  con=g*g*Vus*Vus/(4.0*fpi*fpi);
+  con=fCon;
 
   t1=1.0;
   t2=1.0;
@@ -1191,26 +1206,19 @@ double AlamSimoAtharVacasSKPXSec2014::Amatrix_NN(double theta, double phikq) con
 }
 
 //____________________________________________________________________________
-double AlamSimoAtharVacasSKPXSec2014::Amatrix_NP(double theta, double phikq) const
+double AlamSimoAtharVacasSKPXSec2014::Amatrix_NP(const KineScalars & ks) const
 {
 
   double sol = 0.;
 
-  double akk1=0., zdotq=0., qdotpk=0., akcrosk1=0., qcrospk=0.;
-  double zdotpk=0., azpk=0., aqkaon=0., akpk=0., apkk1=0.;
+  double akk1=0., aqkaon=0., akpk=0., apkk1=0.;
   double C1=0., C2=0., C3=0., C4=0., C5=0., C6=0., C7=0./*, C8=0., C9=0.*/;
   double aq2=0., gform=0., con=0., t1=0., t2=0., t3=0., t4=0., t5=0./*, t6=0.*/;
 
-  akk1=Enu*Elep-Enu*alepvec*cos(theta);
-  zdotq=(Enu*Enu-alepvec*alepvec)/2.0;
-  qdotpk=aqvec*pkvec*angkq;
-  akcrosk1 = Enu*alepvec*sin(theta);
-  qcrospk=aqvec*pkvec*sqrt(1.0-angkq*angkq);
-  zdotpk=(akcrosk1*qcrospk*cos(phikq)+zdotq*qdotpk)/(aqvec*aqvec);
-  azpk=Ekaon*(Enu+Elep)/2.0-zdotpk;
-  aqkaon=aq0*Ekaon-aqvec*pkvec*angkq;
-  akpk=azpk + aqkaon/2.0;
-  apkk1=azpk - aqkaon/2.0;
+  akk1     = ks.akk1;
+  aqkaon   = ks.aqkaon;
+  akpk     = ks.akpk;
+  apkk1    = ks.apkk1;
   C1=1.0/(am*am+amk*amk-2.0*am*Ekaon-amSig*amSig);
   C2=d+f;
   C3=1./(aml*aml-2.0*akk1-amk*amk);
@@ -1221,9 +1229,10 @@ double AlamSimoAtharVacasSKPXSec2014::Amatrix_NP(double theta, double phikq) con
   //C8=am/(aml*aml-2.0*akk1+amk*amk-2.*aqkaon-amEta*amEta);
   //C9=d - 3.*f;
   aq2=aml*aml-2.0*akk1;
-  gform=1.0/pow(1.0-aq2/(1.1*1.1),4);
+  gform=1.0/((1.0-aq2/(1.1*1.1))*(1.0-aq2/(1.1*1.1)));
+  gform*=gform;
 
-  con=g*g*Vus*Vus/(4.0*fpi*fpi);
+  con=fCon;
 
   t1=1.0;
   t2=1.0;               // !Full Term
@@ -4911,25 +4920,18 @@ double AlamSimoAtharVacasSKPXSec2014::Amatrix_NP(double theta, double phikq) con
 
 
 //____________________________________________________________________________
-double AlamSimoAtharVacasSKPXSec2014::Amatrix_PP(double theta, double phikq) const
+double AlamSimoAtharVacasSKPXSec2014::Amatrix_PP(const KineScalars & ks) const
 {
   double sol = 0.;
 
-  double akk1=0., zdotq=0., qdotpk=0., akcrosk1=0., qcrospk=0.;
-  double zdotpk=0., azpk=0., aqkaon=0., akpk=0., apkk1=0.;
+  double akk1=0., aqkaon=0., akpk=0., apkk1=0.;
   double C1=0., C2=0., C3=0., C4=0., C5=0., C6=0., C7=0., C8=0., C9=0.;
   double aq2=0., gform=0., con=0., t1=0., t2=0., t3=0., t4=0., t5=0., t6=0.;
 
-  akk1=Enu*Elep-Enu*alepvec*cos(theta);
-  zdotq=(Enu*Enu-alepvec*alepvec)/2.0;
-  qdotpk=aqvec*pkvec*angkq;
-  akcrosk1 = Enu*alepvec*sin(theta);
-  qcrospk=aqvec*pkvec*sqrt(1.0-angkq*angkq);
-  zdotpk=(akcrosk1*qcrospk*cos(phikq)+zdotq*qdotpk)/(aqvec*aqvec);
-  azpk=Ekaon*(Enu+Elep)/2.0-zdotpk;
-  aqkaon=aq0*Ekaon-aqvec*pkvec*angkq;
-  akpk=azpk + aqkaon/2.0;
-  apkk1=azpk - aqkaon/2.0;
+  akk1     = ks.akk1;
+  aqkaon   = ks.aqkaon;
+  akpk     = ks.akpk;
+  apkk1    = ks.apkk1;
   C1=1.0/(am*am+amk*amk-2.0*am*Ekaon-amSig*amSig);
   C2=d+f;
   C3=1./(aml*aml-2.0*akk1-amk*amk);
@@ -4940,9 +4942,10 @@ double AlamSimoAtharVacasSKPXSec2014::Amatrix_PP(double theta, double phikq) con
   C8=2.0*am/(aml*aml-2.0*akk1+amk*amk-2.*aqkaon-amEta*amEta);
   C9=d - 3.*f;
   aq2=aml*aml-2.0*akk1;
-  gform=1.0/pow(1.0-aq2/(1.1*1.1),4);
+  gform=1.0/((1.0-aq2/(1.1*1.1))*(1.0-aq2/(1.1*1.1)));
+  gform*=gform;
 
-  con=g*g*Vus*Vus/(4.0*fpi*fpi);
+  con=fCon;
 
   t1=1.0;
   t2=1.0;               // !Full Term
@@ -51,10 +51,19 @@ private:
 
   const XSecIntegratorI * fXSecIntegrator;  ///< cross section integrator
 
+  // Lepton-kaon scalar products entering the matrix elements (names as in
+  // the original FORTRAN code), computed once per kinematic point
+  struct KineScalars {
+    double akk1;     ///< k.k'
+    double aqkaon;   ///< q.pk
+    double akpk;     ///< k.pk
+    double apkk1;    ///< k'.pk
+  };
+
   // Calculate matrix elements
-  double Amatrix_NN(double theta, double phikq) const;
-  double Amatrix_NP(double theta, double phikq) const;
-  double Amatrix_PP(double theta, double phikq) const;
+  double Amatrix_NN(const KineScalars & ks) const;
+  double Amatrix_NP(const KineScalars & ks) const;
+  double Amatrix_PP(const KineScalars & ks) const;
 
   // Physics parameters set globally
   // The names of these parameters in the code match the convention in the original FORTRAN code
@@ -62,6 +71,11 @@ private:
   // We try to change as little as possible, so keep these names
   double amLam, amEta, Vus, fpi, d, f, g, amup, amun, Fm1, Fm2;
 
+  // Constants derived from the above, set at configuration
+  double fCon;                    ///< g^2 Vus^2 / 4fpi^2
+  double fMassSigmaM, fMassSigma0; ///< Sigma masses
+  double fMassKP, fMassK0;        ///< kaon masses
+
   // Interaction parameters set locally
   // These are set event-by-event, and used in the matrix element calculation which is thousands
   // of lines long. The names are kept from the original FORTRAN code
@@ -128,13 +128,9 @@ double AlamSimoAtharVacasSKXSec::Integrate(
   double kine_min[3] = { zero, zero, -20 }; // Tlep, Tkaon, cosine theta lep
   double kine_max[3] = { tmax, tmax,  0.69314718056 }; // Tlep, Tkaon, cosine theta lep
 
-  ROOT::Math::IntegrationMultiDim::Type ig_type =
-    utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
-
   double abstol = 1; //We mostly care about relative tolerance.
-  ROOT::Math::IntegratorMultiDim ig(*func, ig_type, abstol, fGSLRelTol, fGSLMaxEval);
-
-  xsec = ig.Integral(kine_min, kine_max) * (1E-38 * units::cm2);
+  xsec = utils::gsl::IntegrateMultiDim(*func, fGSLIntgType, kine_min, kine_max,
+            abstol, fGSLRelTol, fGSLMaxEval) * (1E-38 * units::cm2);
   delete func;
 
   delete interaction;
@@ -170,7 +166,7 @@ void AlamSimoAtharVacasSKXSec::LoadConfig(void)
 
 genie::utils::gsl::d3Xsec_dTldTkdCosThetal::d3Xsec_dTldTkdCosThetal(
      const XSecAlgorithmI * m, const Interaction * i) :
-ROOT::Math::IBaseFunctionMultiDim(),
+BatchFunctionMultiDim(),
 fModel(m),
 fInteraction(i)
 {
@@ -24,6 +24,7 @@
 #include <Math/IFunction.h>
 #include <Math/IntegratorMultiDim.h>
 
+#include "Framework/Numerical/BatchFunctionMultiDim.h"
 #include "Physics/XSectionIntegration/XSecIntegratorI.h"
 
 namespace genie {
@@ -61,7 +62,7 @@ private:
  namespace utils {
   namespace gsl   {
 
-   class d3Xsec_dTldTkdCosThetal: public ROOT::Math::IBaseFunctionMultiDim
+   class d3Xsec_dTldTkdCosThetal: public genie::BatchFunctionMultiDim
    {
     public:
       d3Xsec_dTldTkdCosThetal(const XSecAlgorithmI * m, const Interaction * i);
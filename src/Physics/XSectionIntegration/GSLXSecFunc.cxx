@@ -12,6 +12,7 @@
 //____________________________________________________________________________
 
 #include <cassert>
+#include <vector>
 
 #include <TMath.h>
 
@@ -110,7 +111,7 @@ ROOT::Math::IBaseFunctionOneDim *
 //____________________________________________________________________________
 genie::utils::gsl::d2XSec_dxdy_E::d2XSec_dxdy_E(
      const XSecAlgorithmI * m, const Interaction * i) :
-ROOT::Math::IBaseFunctionMultiDim(),
+BatchFunctionMultiDim(),
 fModel(m),
 fInteraction(i)
 {
@@ -140,6 +141,34 @@ double genie::utils::gsl::d2XSec_dxdy_E::DoEval(const double * xin) const
   double xsec = fModel->XSec(fInteraction, kPSxyfE);
   return xsec/(1E-38 * units::cm2);
 }
+void genie::utils::gsl::d2XSec_dxdy_E::DoEvalBatch(
+    unsigned int npoints, const double * xin, double * f) const
+{
+// As DoEval, for a batch of (x,y) points whose cross sections are computed
+// in a single XSecAlgorithmI::XSecBatch() call
+//
+  if(npoints == 0) return;
+
+  double E = fInteraction->InitState().ProbeE(kRfHitNucRest);
+  double M = fInteraction->InitState().Tgt().HitNucP4Ptr()->M();
+
+  const KineVar_t kv[4] = { kKVx, kKVy, kKVW, kKVQ2 };
+  std::vector<double> values(4*npoints);
+  for(unsigned int p = 0; p < npoints; p++) {
+    double x = xin[2*p];
+    double y = xin[2*p+1];
+    double W=-1, Q2=-1;
+    kinematics::XYtoWQ2(E,M,W,Q2,x,y);
+    values[4*p]   = x;
+    values[4*p+1] = y;
+    values[4*p+2] = W;
+    values[4*p+3] = Q2;
+  }
+  fModel->XSecBatch(fInteraction, kPSxyfE, npoints, 4, kv, &values[0], f);
+  for(unsigned int p = 0; p < npoints; p++) {
+    f[p] /= (1E-38 * units::cm2);
+  }
+}
 ROOT::Math::IBaseFunctionMultiDim *
    genie::utils::gsl::d2XSec_dxdy_E::Clone() const
 {
@@ -149,7 +178,7 @@ ROOT::Math::IBaseFunctionMultiDim *
 //____________________________________________________________________________
 genie::utils::gsl::d2XSec_dQ2dy_E::d2XSec_dQ2dy_E(
      const XSecAlgorithmI * m, const Interaction * i) :
-ROOT::Math::IBaseFunctionMultiDim(),
+BatchFunctionMultiDim(),
 fModel(m),
 fInteraction(i)
 {
@@ -188,7 +217,7 @@ ROOT::Math::IBaseFunctionMultiDim *
 //____________________________________________________________________________
 genie::utils::gsl::d2XSec_dQ2dydt_E::d2XSec_dQ2dydt_E(
      const XSecAlgorithmI * m, const Interaction * i) :
-ROOT::Math::IBaseFunctionMultiDim(),
+BatchFunctionMultiDim(),
 fModel(m),
 fInteraction(i)
 {
@@ -231,7 +260,7 @@ ROOT::Math::IBaseFunctionMultiDim *
 //____________________________________________________________________________
 genie::utils::gsl::d3XSec_dxdydt_E::d3XSec_dxdydt_E(
      const XSecAlgorithmI * m, const Interaction * i) :
-ROOT::Math::IBaseFunctionMultiDim(),
+BatchFunctionMultiDim(),
 fModel(m),
 fInteraction(i)
 {
@@ -264,6 +293,20 @@ double genie::utils::gsl::d3XSec_dxdydt_E::DoEval(const double * xin) const
   double xsec = fModel->XSec(fInteraction, kPSxytfE);
   return xsec/(1E-38 * units::cm2);
 }
+void genie::utils::gsl::d3XSec_dxdydt_E::DoEvalBatch(
+    unsigned int npoints, const double * xin, double * f) const
+{
+// As DoEval, for a batch of (x,y,t) points whose cross sections are computed
+// in a single XSecAlgorithmI::XSecBatch() call
+//
+  if(npoints == 0) return;
+
+  const KineVar_t kv[3] = { kKVx, kKVy, kKVt };
+  fModel->XSecBatch(fInteraction, kPSxytfE, npoints, 3, kv, xin, f);
+  for(unsigned int p = 0; p < npoints; p++) {
+    f[p] /= (1E-38 * units::cm2);
+  }
+}
 ROOT::Math::IBaseFunctionMultiDim *
    genie::utils::gsl::d3XSec_dxdydt_E::Clone() const
 {
@@ -273,7 +316,7 @@ ROOT::Math::IBaseFunctionMultiDim *
 //____________________________________________________________________________
 genie::utils::gsl::d2XSec_dWdQ2_E::d2XSec_dWdQ2_E(
      const XSecAlgorithmI * m, const Interaction * i) :
-ROOT::Math::IBaseFunctionMultiDim(),
+BatchFunctionMultiDim(),
 fModel(m),
 fInteraction(i)
 {
@@ -312,6 +355,39 @@ double genie::utils::gsl::d2XSec_dWdQ2_E::DoEval(const double * xin) const
   double xsec = fModel->XSec(fInteraction, kPSWQ2fE);
   return xsec/(1E-38 * units::cm2);
 }
+void genie::utils::gsl::d2XSec_dWdQ2_E::DoEvalBatch(
+    unsigned int npoints, const double * xin, double * f) const
+{
+// As DoEval, for a batch of (W,Q2) points whose cross sections are computed
+// in a single XSecAlgorithmI::XSecBatch() call
+//
+  if(npoints == 0) return;
+
+  const KineVar_t kv[4] = { kKVW, kKVQ2, kKVx, kKVy };
+  if(fInteraction->ProcInfo().IsDeepInelastic() ||
+     fInteraction->ProcInfo().IsDarkMatterDeepInelastic()) {
+    double E = fInteraction->InitState().ProbeE(kRfHitNucRest);
+    double M = fInteraction->InitState().Tgt().HitNucP4Ptr()->M();
+
+    std::vector<double> values(4*npoints);
+    for(unsigned int p = 0; p < npoints; p++) {
+      double W  = xin[2*p];
+      double Q2 = xin[2*p+1];
+      double x=0,y=0;
+      kinematics::WQ2toXY(E,M,W,Q2,x,y);
+      values[4*p]   = W;
+      values[4*p+1] = Q2;
+      values[4*p+2] = x;
+      values[4*p+3] = y;
+    }
+    fModel->XSecBatch(fInteraction, kPSWQ2fE, npoints, 4, kv, &values[0], f);
+  } else {
+    fModel->XSecBatch(fInteraction, kPSWQ2fE, npoints, 2, kv, xin, f);
+  }
+  for(unsigned int p = 0; p < npoints; p++) {
+    f[p] /= (1E-38 * units::cm2);
+  }
+}
 ROOT::Math::IBaseFunctionMultiDim *
    genie::utils::gsl::d2XSec_dWdQ2_E::Clone() const
 {
@@ -319,6 +395,56 @@ ROOT::Math::IBaseFunctionMultiDim *
     new genie::utils::gsl::d2XSec_dWdQ2_E(fModel,fInteraction);
 }
 //____________________________________________________________________________
+genie::utils::gsl::d2XSec_dWdQ2_E_Channels::d2XSec_dWdQ2_E_Channels(
+     const XSecAlgorithmI * m, const std::vector<Interaction *> & channels) :
+fModel(m),
+fChannels(channels)
+{
+  assert(fChannels.size() > 0);
+}
+genie::utils::gsl::d2XSec_dWdQ2_E_Channels::~d2XSec_dWdQ2_E_Channels()
+{
+
+}
+void genie::utils::gsl::d2XSec_dWdQ2_E_Channels::DoEvalBatch(
+    unsigned int npoints, const double * xin, const bool * active, double * f) const
+{
+// inputs:
+//    W  [GeV], Q2 [GeV^2] of each point
+// outputs:
+//   differential cross section [10^-38 cm^2/GeV^3] of each active channel
+//
+// The channels are evaluated one after the other at each point, so that
+// models memoizing the last point (eg the QPM DIS PDFs) calculate it once
+//
+  const unsigned int nch = fChannels.size();
+  const Interaction * in0 = fChannels[0];
+  bool   is_dis = in0->ProcInfo().IsDeepInelastic() ||
+                  in0->ProcInfo().IsDarkMatterDeepInelastic();
+  double E = in0->InitState().ProbeE(kRfHitNucRest);
+  double M = in0->InitState().Tgt().HitNucP4Ptr()->M();
+
+  for(unsigned int p = 0; p < npoints; p++) {
+    double W  = xin[2*p];
+    double Q2 = xin[2*p+1];
+    double x=0,y=0;
+    if(is_dis) kinematics::WQ2toXY(E,M,W,Q2,x,y);
+
+    for(unsigned int ic = 0; ic < nch; ic++) {
+      f[p*nch+ic] = 0.;
+      if(!active[ic]) continue;
+      Interaction * in = fChannels[ic];
+      in->KinePtr()->SetW(W);
+      in->KinePtr()->SetQ2(Q2);
+      if(is_dis) {
+        in->KinePtr()->Setx(x);
+        in->KinePtr()->Sety(y);
+      }
+      f[p*nch+ic] = fModel->XSec(in, kPSWQ2fE) / (1E-38 * units::cm2);
+    }
+  }
+}
+//____________________________________________________________________________
 genie::utils::gsl::d2XSec_dxdy_Ex::d2XSec_dxdy_Ex(
      const XSecAlgorithmI * m, const Interaction * i, double x) :
 ROOT::Math::IBaseFunctionOneDim(),
@@ -472,7 +598,7 @@ ROOT::Math::IBaseFunctionOneDim *
 //
 genie::utils::gsl::d5XSecAR::d5XSecAR(
      const XSecAlgorithmI * m, const Interaction * i) :
-ROOT::Math::IBaseFunctionMultiDim(),
+BatchFunctionMultiDim(),
 fModel(m),
 fInteraction(i),
 flip(false)
@@ -573,7 +699,7 @@ ROOT::Math::IBaseFunctionMultiDim *
 //
 genie::utils::gsl::d5Xsec_dEldOmegaldOmegapi::d5Xsec_dEldOmegaldOmegapi(
      const XSecAlgorithmI * m, const Interaction * i) :
-ROOT::Math::IBaseFunctionMultiDim(),
+BatchFunctionMultiDim(),
 fModel(m),
 fInteraction(i)
 {
@@ -670,7 +796,7 @@ ROOT::Math::IBaseFunctionMultiDim *
 
 genie::utils::gsl::d4Xsec_dEldThetaldOmegapi::d4Xsec_dEldThetaldOmegapi(
      const XSecAlgorithmI * m, const Interaction * i) :
-ROOT::Math::IBaseFunctionMultiDim(),
+BatchFunctionMultiDim(),
 fModel(m),
 fInteraction(i)
 {
@@ -773,7 +899,7 @@ double genie::utils::gsl::d4Xsec_dEldThetaldOmegapi::GetFactor(void) const
 //____________________________________________________________________________
 genie::utils::gsl::d3Xsec_dOmegaldThetapi::d3Xsec_dOmegaldThetapi(
      const XSecAlgorithmI * m, const Interaction * i) :
-ROOT::Math::IBaseFunctionMultiDim(),
+BatchFunctionMultiDim(),
 fModel(m),
 fInteraction(i),
 fElep(-1)
@@ -18,9 +18,13 @@
 #ifndef _GENIE_XSEC_FUNCTION_GSL_WRAPPERS_H_
 #define _GENIE_XSEC_FUNCTION_GSL_WRAPPERS_H_
 
+#include <vector>
+
 #include <Math/IFunction.h>
 #include <Math/IntegratorMultiDim.h>
 
+#include "Framework/Numerical/BatchFunctionMultiDim.h"
+
 namespace genie {
 
 class XSecAlgorithmI;
@@ -77,7 +81,7 @@ private:
 // genie::utils::gsl::d2XSec_dxdy_E
 // A 2-D cross section function: d2xsec/dxdy = f(x,y)|(fixed E)
 //
-class d2XSec_dxdy_E: public ROOT::Math::IBaseFunctionMultiDim
+class d2XSec_dxdy_E: public genie::BatchFunctionMultiDim
 {
 public:
   d2XSec_dxdy_E(const XSecAlgorithmI * m, const Interaction * i);
@@ -88,6 +92,9 @@ public:
   double                              DoEval (const double * xin) const;
   ROOT::Math::IBaseFunctionMultiDim * Clone  (void)               const;
 
+  // genie::BatchFunctionMultiDim interface
+  void DoEvalBatch (unsigned int npoints, const double * xin, double * f) const;
+
 private:
   const XSecAlgorithmI * fModel;
   const Interaction *    fInteraction;
@@ -98,7 +105,7 @@ private:
 // genie::utils::gsl::d2XSec_dQ2dy_E
 // A 2-D cross section function: d2xsec/dQ2dy = f(Q^2,y)|(fixed E)
 //
-class d2XSec_dQ2dy_E: public ROOT::Math::IBaseFunctionMultiDim
+class d2XSec_dQ2dy_E: public genie::BatchFunctionMultiDim
 {
 public:
   d2XSec_dQ2dy_E(const XSecAlgorithmI * m, const Interaction * i);
@@ -119,7 +126,7 @@ private:
 // genie::utils::gsl::d2XSec_dQ2dydt_E
 // A 3-D cross section function: d3xsec/dQ2dydt = f(Q^2,y,t)|(fixed E)
 //
-class d2XSec_dQ2dydt_E: public ROOT::Math::IBaseFunctionMultiDim
+class d2XSec_dQ2dydt_E: public genie::BatchFunctionMultiDim
 {
 public:
   d2XSec_dQ2dydt_E(const XSecAlgorithmI * m, const Interaction * i);
@@ -140,7 +147,7 @@ private:
 // genie::utils::gsl::d3XSec_dxdydt_E
 // A 3-D cross section function: d3xsec/dxdydt = f(x,y,t)|(fixed E)
 //
-class d3XSec_dxdydt_E: public ROOT::Math::IBaseFunctionMultiDim
+class d3XSec_dxdydt_E: public genie::BatchFunctionMultiDim
 {
 public:
   d3XSec_dxdydt_E(const XSecAlgorithmI * m, const Interaction * i);
@@ -151,6 +158,9 @@ public:
   double                              DoEval (const double * xin) const;
   ROOT::Math::IBaseFunctionMultiDim * Clone  (void)               const;
 
+  // genie::BatchFunctionMultiDim interface
+  void DoEvalBatch (unsigned int npoints, const double * xin, double * f) const;
+
 private:
   const XSecAlgorithmI * fModel;
   const Interaction *    fInteraction;
@@ -161,7 +171,7 @@ private:
 // genie::utils::gsl::d2XSec_dWdQ2_E
 // A 2-D cross section function: d2xsec/dWdQ2 = f(W,Q2)|(fixed E)
 //
-class d2XSec_dWdQ2_E: public ROOT::Math::IBaseFunctionMultiDim
+class d2XSec_dWdQ2_E: public genie::BatchFunctionMultiDim
 {
 public:
   d2XSec_dWdQ2_E(const XSecAlgorithmI * m, const Interaction * i);
@@ -172,11 +182,40 @@ public:
   double                              DoEval (const double * xin) const;
   ROOT::Math::IBaseFunctionMultiDim * Clone  (void)               const;
 
+  // genie::BatchFunctionMultiDim interface
+  void DoEvalBatch (unsigned int npoints, const double * xin, double * f) const;
+
 private:
   const XSecAlgorithmI * fModel;
   const Interaction *    fInteraction;
 };
 
+//.....................................................................................
+//
+// genie::utils::gsl::d2XSec_dWdQ2_E_Channels
+// d2xsec/dWdQ2 = f(W,Q2)|(fixed E) for several interactions sharing the probe,
+// hit nucleon & energy (eg the hit quark channels of DIS), evaluated together
+// at each point so that the channels can share the calculation of the point
+// (eg the PDFs). For VegasIntegrator::MultiBatchIntegrand_t integrands.
+//
+class d2XSec_dWdQ2_E_Channels
+{
+public:
+  d2XSec_dWdQ2_E_Channels(const XSecAlgorithmI * m, const std::vector<Interaction *> & channels);
+ ~d2XSec_dWdQ2_E_Channels();
+
+  unsigned int NChannels (void) const { return fChannels.size(); }
+
+  //! cross sections [10^-38 cm^2/GeV^3] of the active channels at npoints (W,Q2)
+  //! points: f[p*NChannels() + c] is channel c at point p
+  void DoEvalBatch (unsigned int npoints, const double * xin,
+                    const bool * active, double * f) const;
+
+private:
+  const XSecAlgorithmI *      fModel;
+  std::vector<Interaction *>  fChannels;
+};
+
 //.....................................................................................
 //
 // genie::utils::gsl::d2XSec_dxdy_Ex
@@ -271,7 +310,7 @@ private:
 //
 //
 //
-class d5XSecAR : public ROOT::Math::IBaseFunctionMultiDim
+class d5XSecAR : public genie::BatchFunctionMultiDim
 {
 public:
   d5XSecAR(const XSecAlgorithmI * m, const Interaction * i);
@@ -294,7 +333,7 @@ private:
 // genie::utils::gsl::d5Xsec_dEldOmegaldOmegapi
 // A 5-D cross section function (fixed E_nu)
 //
-class d5Xsec_dEldOmegaldOmegapi: public ROOT::Math::IBaseFunctionMultiDim
+class d5Xsec_dEldOmegaldOmegapi: public genie::BatchFunctionMultiDim
 {
 public:
   d5Xsec_dEldOmegaldOmegapi(const XSecAlgorithmI * m, const Interaction * i);
@@ -316,7 +355,7 @@ private:
 /// A 4-D cross section function (fixed E_nu)
 /// DANIEL - for the Alvarez-Russo cross-section
 ///
-class d4Xsec_dEldThetaldOmegapi: public ROOT::Math::IBaseFunctionMultiDim
+class d4Xsec_dEldThetaldOmegapi: public genie::BatchFunctionMultiDim
 {
 public:
   d4Xsec_dEldThetaldOmegapi(const XSecAlgorithmI * m, const Interaction * i);
@@ -341,7 +380,7 @@ private:
 /// A 3-D cross section function (fixed E_nu)
 /// Steve Dennis - for the Alvarez-Russo cross-section
 ///
-class d3Xsec_dOmegaldThetapi: public ROOT::Math::IBaseFunctionMultiDim
+class d3Xsec_dOmegaldThetapi: public genie::BatchFunctionMultiDim
 {
 public:
   d3Xsec_dOmegaldThetapi(const XSecAlgorithmI * m, const Interaction * i);
@@ -402,7 +441,7 @@ private:
 /// dXSec_Log_Wrapper
 /// Redistributes variables over a range to a e^-x distribution.
 /// Allows the integrator to use a logarithmic series of points while calling uniformly.
-class dXSec_Log_Wrapper: public ROOT::Math::IBaseFunctionMultiDim
+class dXSec_Log_Wrapper: public genie::BatchFunctionMultiDim
 {
   public:
     dXSec_Log_Wrapper(const ROOT::Math::IBaseFunctionMultiDim * fn,
@@ -9,6 +9,7 @@
 //____________________________________________________________________________
 
 #include <cassert>
+#include <cmath>
 
 #include <TH1D.h>
 #include <TH2D.h>
@@ -84,15 +85,29 @@ bool GAstroFlux::GenerateNext(void)
      return false;
   }
 
-  status = fNuGen->SelectEnergy(
-     fGenWeighted, *fEnergySpectrum, log10Emin, log10Emax, log10E, wght_energy);
+  if(fBiasEnergy) {
+     double norm = this->SpectrumIntegral(log10Emin, log10Emax);
+     status = fNuGen->SelectEnergyBiased(
+        *fEnergySpectrum, norm, log10Emin, log10Emax, fBiasPowLawIdx,
+        log10E, wght_energy);
+  } else {
+     status = fNuGen->SelectEnergy(
+        fGenWeighted, *fEnergySpectrum, log10Emin, log10Emax, log10E, wght_energy);
+  }
   if(!status) {
      return false;
   }
   double Ev = TMath::Power(10.,log10E);
 
-  status = fNuGen->SelectOrigin(
-    fGenWeighted, *fSolidAngleAcceptance, phi, costheta, wght_origin);
+  if(fBiasOrigin) {
+     double norm = this->AcceptanceIntegral();
+     status = fNuGen->SelectOriginBiased(
+        *fSolidAngleAcceptance, norm, fBiasKappa, fBiasAxis,
+        phi, costheta, wght_origin);
+  } else {
+     status = fNuGen->SelectOrigin(
+        fGenWeighted, *fSolidAngleAcceptance, phi, costheta, wght_origin);
+  }
   if(!status) {
      return false;
   }
@@ -139,12 +154,14 @@ void GAstroFlux::ForceMinEnergy(double emin)
 {
   emin = TMath::Max(0., emin/units::GeV);
   fMinEvCut = emin;
+  fSpectrumNorm = -1;
 }
 //___________________________________________________________________________
 void GAstroFlux::ForceMaxEnergy(double emax)
 {
   emax = TMath::Max(0., emax/units::GeV);
   fMaxEvCut = emax;
+  fSpectrumNorm = -1;
 }
 //___________________________________________________________________________
 void GAstroFlux::Clear(Option_t * opt)
@@ -276,6 +293,52 @@ void GAstroFlux::SetEnergyPowLawIdx(double n)
   // normalize
   double max = fEnergySpectrum->GetMaximum();
   fEnergySpectrum->Scale(1./max);
+
+  fSpectrumNorm = -1;
+}
+//___________________________________________________________________________
+void GAstroFlux::SetEnergyBiasPowLawIdx(double n)
+{
+// Importance biasing: sample log10(E) from a E^-n power law (in the same
+// convention as SetEnergyPowLawIdx()) instead of the physical spectrum.
+// Each neutrino is weighted by the exact ratio of the two densities.
+
+  fBiasEnergy    = true;
+  fBiasPowLawIdx = n;
+
+  LOG("Flux", pNOTICE)
+    << "Sampling the neutrino energy from a E^-" << n << " power law";
+}
+//___________________________________________________________________________
+void GAstroFlux::SetDirectionalBias(
+     double kappa, double phi0, double costheta0)
+{
+// Importance biasing: sample the neutrino starting position on the Earth's
+// surface from a Fisher distribution with concentration kappa around the
+// (phi0, costheta0) direction (in the coordinates of the solid angle
+// acceptance histogram), instead of the detector solid angle acceptance.
+// Each neutrino is weighted by the exact ratio of the two densities.
+// kappa = 0 samples the origin uniformly over the sphere.
+
+  assert(kappa >= 0.);
+  assert(costheta0 >= -1. && costheta0 <= 1.);
+
+  double sintheta0 = TMath::Sqrt(1.-costheta0*costheta0);
+
+  fBiasOrigin = true;
+  fBiasKappa  = kappa;
+  fBiasAxis.SetXYZ(
+     sintheta0*TMath::Sin(phi0), sintheta0*TMath::Cos(phi0), costheta0);
+
+  LOG("Flux", pNOTICE)
+    << "Sampling the neutrino origin from a Fisher distribution (kappa = "
+    << kappa << ") around phi = " << phi0 << ", cos(theta) = " << costheta0;
+}
+//___________________________________________________________________________
+void GAstroFlux::DisableImportanceBiasing(void)
+{
+  fBiasEnergy = false;
+  fBiasOrigin = false;
 }
 //___________________________________________________________________________
 void GAstroFlux::SetUserCoordSystem(TRotation & rotation)
@@ -322,6 +385,19 @@ void GAstroFlux::Initialize(void)
   fRotGEF2THz.SetToIdentity();
   fRotTHz2User.SetToIdentity();
 
+  // No importance biasing
+  // To be set via SetEnergyBiasPowLawIdx() and SetDirectionalBias()
+  fBiasEnergy    = false;
+  fBiasPowLawIdx = 0.;
+  fBiasOrigin    = false;
+  fBiasKappa     = 0.;
+  fBiasAxis.SetXYZ(0,0,1);
+  fSpectrumNorm      = -1;
+  fSpectrumNormMin   = 0;
+  fSpectrumNormMax   = 0;
+  fAcceptanceNorm    = -1;
+  fAcceptanceNormHst = 0;
+
   // Utility objects for generating and propagating neutrinos
   fNuGen   = new NuGenerator();
   fNuPropg = new NuPropagator(1.0*units::km);
@@ -339,6 +415,55 @@ void GAstroFlux::ResetSelection(void)
   fgX4.SetXYZT    (0.,0.,0.,0.);
 }
 //___________________________________________________________________________
+double GAstroFlux::SpectrumIntegral(double log10Emin, double log10Emax)
+{
+// Integral of the energy spectrum (in log10(E)) within the energy cuts,
+// computed once per spectrum & cuts
+
+  if(fSpectrumNorm >= 0 &&
+     fSpectrumNormMin == log10Emin && fSpectrumNormMax == log10Emax) {
+    return fSpectrumNorm;
+  }
+
+  double sum = 0.;
+  int nbins = fEnergySpectrum->GetNbinsX();
+  for(int i=1; i<=nbins; i++) {
+    double xlo = TMath::Max(fEnergySpectrum->GetBinLowEdge(i),   log10Emin);
+    double xhi = TMath::Min(fEnergySpectrum->GetBinLowEdge(i+1), log10Emax);
+    if(xhi > xlo) sum += fEnergySpectrum->GetBinContent(i) * (xhi-xlo);
+  }
+
+  fSpectrumNorm    = sum;
+  fSpectrumNormMin = log10Emin;
+  fSpectrumNormMax = log10Emax;
+  return fSpectrumNorm;
+}
+//___________________________________________________________________________
+double GAstroFlux::AcceptanceIntegral(void)
+{
+// Integral of the solid angle acceptance over the sphere (dphi dcostheta),
+// computed once per acceptance histogram
+
+  if(fAcceptanceNorm >= 0 && fAcceptanceNormHst == fSolidAngleAcceptance) {
+    return fAcceptanceNorm;
+  }
+
+  double sum = 0.;
+  int nx = fSolidAngleAcceptance->GetNbinsX();
+  int ny = fSolidAngleAcceptance->GetNbinsY();
+  for(int i=1; i<=nx; i++) {
+    double dphi = fSolidAngleAcceptance->GetXaxis()->GetBinWidth(i);
+    for(int j=1; j<=ny; j++) {
+      double dcos = fSolidAngleAcceptance->GetYaxis()->GetBinWidth(j);
+      sum += fSolidAngleAcceptance->GetBinContent(i,j) * dphi * dcos;
+    }
+  }
+
+  fAcceptanceNorm    = sum;
+  fAcceptanceNormHst = fSolidAngleAcceptance;
+  return fAcceptanceNorm;
+}
+//___________________________________________________________________________
 void GAstroFlux::CleanUp(void)
 {
   LOG("Flux", pNOTICE) << "Cleaning up...";
@@ -470,6 +595,95 @@ bool GAstroFlux::NuGenerator::SelectOrigin(
   return true;
 }
 //___________________________________________________________________________
+bool GAstroFlux::NuGenerator::SelectEnergyBiased(
+  TH1D & log10Epdf, double norm, double log10Emin, double log10Emax,
+  double n, double & log10E, double & wght)
+{
+// select neutrino energy from a dN/dlog10E ~ E^-n spectrum, sampled
+// analytically, and weight it by the ratio of the normalized log10Epdf
+// density to the sampled one
+//
+  log10E   = -9999999;
+  wght     = 0;
+
+  if(log10Emax <= log10Emin || norm <= 0.) {
+    return false;
+  }
+
+  RandomGen * rnd = RandomGen::Instance();
+  double u  = rnd->RndFlux().Rndm();
+  double dx = log10Emax - log10Emin;
+  double a  = n * TMath::Ln10();
+
+  // density of the sampled log10(E), relative to log10Emin:
+  // q(x) = a exp(-a (x-x0)) / (1-exp(-a dx))
+  double q = 0.;
+  if(TMath::Abs(a*dx) < 1E-8) {
+     log10E = log10Emin + dx * u;
+     q      = 1./dx;
+  } else {
+     double c = std::expm1(-a*dx);
+     log10E = log10Emin - std::log1p(u*c)/a;
+     log10E = TMath::Min(TMath::Max(log10E, log10Emin), log10Emax);
+     q      = -a * TMath::Exp(-a*(log10E-log10Emin)) / c;
+  }
+
+  double p = log10Epdf.GetBinContent(log10Epdf.FindBin(log10E)) / norm;
+  wght = p/q;
+
+  return true;
+}
+//___________________________________________________________________________
+bool GAstroFlux::NuGenerator::SelectOriginBiased(
+  TH2D & opdf, double norm, double kappa, const TVector3 & axis,
+  double & phi, double & costheta, double & wght)
+{
+// select the neutrino origin from a Fisher distribution around the input
+// axis, sampled analytically, and weight it by the ratio of the normalized
+// opdf density to the sampled one (both per steradian)
+//
+  wght     = 0;
+  costheta = -999999;
+  phi      = -999999;
+
+  if(norm <= 0.) {
+    return false;
+  }
+
+  RandomGen * rnd = RandomGen::Instance();
+  double u   = rnd->RndFlux().Rndm();
+  double psi = 2.*kPi * rnd->RndFlux().Rndm();
+
+  // cosine of the angle to the axis, and density per steradian
+  double w = 0.;
+  double q = 0.;
+  if(kappa < 1E-8) {
+     w = 1. - 2.*u;
+     q = 1./(4.*kPi);
+  } else {
+     double c = std::expm1(-2.*kappa);
+     w = 1. + std::log1p(u*c)/kappa;
+     w = TMath::Min(TMath::Max(w, -1.), 1.);
+     q = -kappa * TMath::Exp(kappa*(w-1.)) / (2.*kPi * c);
+  }
+
+  TVector3 e1 = axis.Orthogonal().Unit();
+  TVector3 e2 = axis.Cross(e1);
+  double sinw = TMath::Sqrt(TMath::Max(0., 1.-w*w));
+  TVector3 dir = w * axis +
+                 sinw * (TMath::Cos(psi) * e1 + TMath::Sin(psi) * e2);
+
+  // same convention as in NuPropagator::Go()
+  costheta = dir.Z();
+  phi      = TMath::ATan2(dir.X(), dir.Y());
+  if(phi < 0.) phi += 2.*kPi;
+
+  double p = opdf.GetBinContent(opdf.FindBin(phi,costheta)) / norm;
+  wght = p/q;
+
+  return true;
+}
+//___________________________________________________________________________
 bool GAstroFlux::NuPropagator::Go(
   double phi, double costheta, const TVector3 & detector_centre,
   double detector_sz, int nu_pdg, double Ev)
@@ -71,6 +71,16 @@
           schemes. However, because of the enormous changes in solid angle
           acceptance and energy, only the weighted scheme is practical.
 
+          Importance biasing focuses the generated sample on a region of
+          interest: SetEnergyBiasPowLawIdx() draws log10(E) from a E^-n power
+          law (e.g. harder than the physical spectrum) and SetDirectionalBias()
+          draws the starting position from a Fisher distribution around a
+          given direction. Each biased neutrino is given the exact weight
+          p_true/p_bias, with both densities normalized within the energy cuts
+          (and over the sphere), so that the weights average to 1. Use them via
+          GFluxI::Weight(), or GMCJDriver::FoldFluxWeights() to have them stored
+          in the event weights (GHepRecord::Weight()).
+
           PHYSICS:
 
           The relative neutrino population needs to be set by the user using
@@ -151,6 +161,9 @@ public :
   void SetDetectorPosition (double latitude, double longitude, double depth, double size);
   void SetRelNuPopulations (double nnue=1, double nnumu=2, double nnutau=0, double nnuebar=1, double nnumubar=2, double nnutaubar=0);
   void SetEnergyPowLawIdx  (double n);
+  void SetEnergyBiasPowLawIdx   (double n);                                      ///< importance biasing: sample log10(E) from E^-n
+  void SetDirectionalBias       (double kappa, double phi0, double costheta0);   ///< importance biasing: sample the origin from a Fisher(kappa) distribution around (phi0,costheta0)
+  void DisableImportanceBiasing (void);
   void SetUserCoordSystem  (TRotation & rotation); ///< rotation Topocentric Horizontal -> User-defined Topocentric Coord System
 
 protected:
@@ -165,6 +178,8 @@ protected:
   void Initialize               (void);
   void CleanUp                  (void);
   void ResetSelection           (void);
+  double SpectrumIntegral       (double log10emin, double log10emax);
+  double AcceptanceIntegral     (void);
 
   //
   // protected data members
@@ -186,12 +201,22 @@ protected:
   map<int,double>  fRelNuPopulations;     ///< (config) relative neutrino populations
   TRotation        fRotGEF2THz;         ///< (config) coord. system rotation: GEF translated to detector centre -> THZ
   TRotation        fRotTHz2User;         ///< (config) coord. system rotation: THZ -> Topocentric user-defined
+  bool             fBiasEnergy;           ///< (config) importance biasing: sample the energy from a power law?
+  double           fBiasPowLawIdx;        ///< (config) importance biasing: power-law index of the sampled energy spectrum
+  bool             fBiasOrigin;           ///< (config) importance biasing: sample the origin from a Fisher distribution?
+  double           fBiasKappa;            ///< (config) importance biasing: concentration of the Fisher distribution
+  TVector3         fBiasAxis;             ///< (config) importance biasing: axis of the Fisher distribution (GEF, unit vector)
   // internal flags and utility objects
   TVector3         fDetCenter;            ///<
   TH1D *           fEnergySpectrum;       ///<
   TH2D *           fSolidAngleAcceptance; ///<
   NuGenerator *    fNuGen;                ///<
   NuPropagator *   fNuPropg;              ///<
+  double           fSpectrumNorm;         ///< integral of fEnergySpectrum within the energy cuts (<0: to be computed)
+  double           fSpectrumNormMin;      ///< log10(Emin) of fSpectrumNorm
+  double           fSpectrumNormMax;      ///< log10(Emax) of fSpectrumNorm
+  double           fAcceptanceNorm;       ///< integral of fSolidAngleAcceptance over the sphere (<0: to be computed)
+  const TH2D *     fAcceptanceNormHst;    ///< histogram of fAcceptanceNorm
 
   //
   // utility classes
@@ -203,6 +228,8 @@ protected:
     bool SelectNuPdg (bool weighted, const map<int,double> & nupdgpdf, int & nupdg, double & wght);
     bool SelectEnergy(bool weighted, TH1D & log10epdf, double log10emin, double log10emax, double & log10e, double & wght);
     bool SelectOrigin(bool weighted, TH2D & opdf, double & phi, double & costheta, double & wght);
+    bool SelectEnergyBiased(TH1D & log10epdf, double norm, double log10emin, double log10emax, double n, double & log10e, double & wght);
+    bool SelectOriginBiased(TH2D & opdf, double norm, double kappa, const TVector3 & axis, double & phi, double & costheta, double & wght);
   };
   class NuPropagator {
   public:
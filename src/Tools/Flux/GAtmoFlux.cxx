@@ -9,11 +9,22 @@
 //____________________________________________________________________________
 
 #include <cassert>
+#include <cstring>
 #include <iostream>
 #include <fstream>
+#include <sstream>
+#include <typeinfo>
+
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include <TH3D.h>
 #include <TMath.h>
+#include <TDirectory.h>
+#include <TVectorD.h>
 
 #include "Framework/Conventions/Constants.h"
 #include "Tools/Flux/GAtmoFlux.h"
@@ -29,6 +40,24 @@ using namespace genie;
 using namespace genie::flux;
 using namespace genie::constants;
 
+// node-shared binary image of the loaded flux tables: the header, the energy,
+// cos(theta) & phi bin edges, then for each flux table its neutrino code
+// (as int64_t) followed by its contents in bins (1..ne, 1..nc, 1..np), with
+// the phi bin varying fastest
+namespace {
+  const char     kShmSignature[8] = { 'G','A','T','M','O','S','H','M' };
+  const uint32_t kShmVersion      = 1;
+
+  struct ShmHeader {
+    char     signature[8];
+    uint32_t version;
+    uint32_t nflux;
+    uint64_t key;
+    uint64_t file_size;
+    uint32_t ne, nc, np, pad;
+  };
+}
+
 //____________________________________________________________________________
 GAtmoFlux::GAtmoFlux()
 {
@@ -123,12 +152,25 @@ bool GAtmoFlux::GenerateNext_1try(void)
      // generate nominal flux
      //
 
-     Axis_t ax = 0, ay = 0, az = 0;
-     fTotalFluxHisto->GetRandom3(ax, ay, az);
-     Ev       = (double)ax;
-     costheta = (double)ay;
-     phi      = (double)az;
-     nu_pdg   = this->SelectNeutrino(Ev, costheta, phi);
+     // select a (species, Ev, costheta, phi) bin from the alias table,
+     // then a point uniformly within the bin (as TH3::GetRandom3 does)
+     if(fFluxAlias.IsEmpty()) {
+        LOG("Flux", pFATAL) << "No flux to generate neutrinos from!";
+        gAbortingInErr = true;
+        exit(1);
+     }
+     int nphi  = fNumPhiBins;
+     int ncos8 = fNumCosThetaBins;
+     int nen   = fNumEnergyBins;
+     int ibin  = fFluxAlias.Sample(rnd->RndFlux().Rndm());
+     int iphi  = ibin % nphi;   ibin /= nphi;
+     int icos8 = ibin % ncos8;  ibin /= ncos8;
+     int ien   = ibin % nen;    ibin /= nen;
+
+     Ev       = fEnergyBins  [ien]   + (fEnergyBins  [ien+1]   - fEnergyBins  [ien]  ) * rnd->RndFlux().Rndm();
+     costheta = fCosThetaBins[icos8] + (fCosThetaBins[icos8+1] - fCosThetaBins[icos8]) * rnd->RndFlux().Rndm();
+     phi      = fPhiBins     [iphi]  + (fPhiBins     [iphi+1]  - fPhiBins     [iphi] ) * rnd->RndFlux().Rndm();
+     nu_pdg   = fFluxAliasPdg[ibin];
      weight   = 1.0;
   }
 
@@ -223,6 +265,41 @@ long int GAtmoFlux::NFluxNeutrinos(void) const
   return fNNeutrinos;
 }
 //___________________________________________________________________________
+bool GAtmoFlux::SaveState(TDirectory * dir) const
+{
+// Neutrinos are generated from the flux histograms using RandomGen only, so
+// the flux neutrino counter is all the driver state that needs saving
+
+  if(!dir) return false;
+  TDirectory * prevdir = gDirectory;
+  dir->cd();
+
+  TVectorD state(1);
+  state[0] = fNNeutrinos;
+  state.Write("atmo_flux_state", TObject::kOverwrite);
+
+  prevdir->cd();
+  return true;
+}
+//___________________________________________________________________________
+bool GAtmoFlux::RestoreState(TDirectory * dir)
+{
+  if(!dir) return false;
+
+  TVectorD * state = (TVectorD*) dir->Get("atmo_flux_state");
+  if(!state) {
+    LOG("Flux", pERROR) << "No saved atmospheric flux driver state found";
+    return false;
+  }
+  fNNeutrinos = (long int) (*state)[0];
+  delete state;
+
+  LOG("Flux", pNOTICE)
+     << "Restored atmospheric flux driver state: " << fNNeutrinos
+     << " flux neutrinos generated so far";
+  return true;
+}
+//___________________________________________________________________________
 void GAtmoFlux::ForceMinEnergy(double emin)
 {
   emin = TMath::Max(0., emin);
@@ -280,6 +357,8 @@ void GAtmoFlux::Initialize(void)
   fTotalFluxHisto = 0;
   fTotalFluxHistoIntg = 0;
 
+  fSharedCacheFile = "";
+
   bool allow_dup = false;
   fPdgCList = new PDGCodeList(allow_dup);
 
@@ -428,7 +507,9 @@ bool GAtmoFlux::LoadFluxData(void)
 
   bool loading_status = true;
 
-  for( unsigned int n=0; n<fFluxFlavour.size(); n++ ){
+  bool from_cache = !fSharedCacheFile.empty() && this->ReadSharedFluxCache();
+
+  for( unsigned int n=0; !from_cache && n<fFluxFlavour.size(); n++ ){
     int nu_pdg      = fFluxFlavour.at(n);
     string filename = fFluxFile.at(n);
     string pname = PDGLibrary::Instance()->Find(nu_pdg)->GetName();
@@ -468,6 +549,7 @@ bool GAtmoFlux::LoadFluxData(void)
 
     LOG("Flux", pNOTICE)
           << "Atmospheric neutrino flux simulation data loaded!";
+    if(!from_cache && !fSharedCacheFile.empty()) this->WriteSharedFluxCache();
     this->AddAllFluxes();
     return true;
   }
@@ -477,6 +559,196 @@ bool GAtmoFlux::LoadFluxData(void)
   return false;
 }
 //___________________________________________________________________________
+void GAtmoFlux::UseSharedFluxCache(string filename)
+{
+// Co-scheduled jobs on a node can share the parsing of the flux tables: The
+// first job to call LoadFluxData() parses the input files as usual and saves
+// the filled flux tables in a binary image at the input path (best placed in
+// a node-local shared memory file system such as /dev/shm). The other jobs
+// map that image read-only (so that its pages are shared by all of them)
+// and fill their flux histograms straight from it. The image is keyed on
+// the flux driver and the input files (name, size & modification time) and
+// gets rebuilt if they change. Call before LoadFluxData().
+
+  fSharedCacheFile = filename;
+
+  LOG("Flux", pNOTICE)
+    << "Using the shared flux table image: " << fSharedCacheFile;
+}
+//___________________________________________________________________________
+unsigned long long GAtmoFlux::SharedFluxCacheKey(void) const
+{
+// FNV-1a hash of the flux driver name & the input files
+
+  std::ostringstream key;
+  key << typeid(*this).name();
+  for(unsigned int n = 0; n < fFluxFlavour.size(); n++) {
+    struct stat st;
+    bool ok = (stat(fFluxFile[n].c_str(), &st) == 0);
+    key << "|" << fFluxFlavour[n] << ":" << fFluxFile[n]
+        << ":" << (ok ? (long long) st.st_size  : -1)
+        << ":" << (ok ? (long long) st.st_mtime : -1);
+  }
+  string s = key.str();
+  unsigned long long hash = 14695981039346656037ULL;
+  for(unsigned int i = 0; i < s.size(); i++) {
+    hash ^= (unsigned char) s[i];
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+//___________________________________________________________________________
+bool GAtmoFlux::ReadSharedFluxCache(void)
+{
+  int fd = open(fSharedCacheFile.c_str(), O_RDONLY);
+  if(fd < 0) {
+    LOG("Flux", pNOTICE)
+      << "No shared flux table image yet at: " << fSharedCacheFile;
+    return false;
+  }
+  struct stat st;
+  if(fstat(fd, &st) != 0 || (size_t) st.st_size < sizeof(ShmHeader)) {
+    close(fd);
+    return false;
+  }
+
+  // map the image read-only & shared: its pages are shared by all the jobs
+  // loading it on a node
+  size_t size = st.st_size;
+  void * addr = mmap(0, size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if(addr == MAP_FAILED) {
+    LOG("Flux", pERROR) << "Couldn't map file: " << fSharedCacheFile;
+    return false;
+  }
+  const char * data = (const char *) addr;
+  const ShmHeader * header = (const ShmHeader *) data;
+
+  size_t ne = fNumEnergyBins, nc = fNumCosThetaBins, np = fNumPhiBins;
+  size_t nedges = (ne+1) + (nc+1) + (np+1);
+  size_t nbins  = ne*nc*np;
+  const double * edges = (const double *) (data + sizeof(ShmHeader));
+
+  bool valid =
+     memcmp(header->signature, kShmSignature, sizeof(kShmSignature)) == 0 &&
+     header->version   == kShmVersion &&
+     header->file_size == size &&
+     header->key       == this->SharedFluxCacheKey() &&
+     header->ne == ne && header->nc == nc && header->np == np &&
+     size == sizeof(ShmHeader) + sizeof(double) *
+                 (nedges + header->nflux * (1+nbins));
+  if(valid) {
+    valid =
+       memcmp(edges,           fEnergyBins,   (ne+1)*sizeof(double)) == 0 &&
+       memcmp(edges+ne+1,      fCosThetaBins, (nc+1)*sizeof(double)) == 0 &&
+       memcmp(edges+ne+nc+2,   fPhiBins,      (np+1)*sizeof(double)) == 0;
+  }
+  if(!valid) {
+    LOG("Flux", pWARN)
+      << "The shared flux table image at: " << fSharedCacheFile
+      << " is not for the current flux driver & input files - Ignoring it";
+    munmap(addr, size);
+    return false;
+  }
+
+  const char * table = (const char *) (edges + nedges);
+  for(uint32_t iflux = 0; iflux < header->nflux; iflux++) {
+    int64_t nu_pdg;
+    memcpy(&nu_pdg, table, sizeof(int64_t));
+    const double * contents = (const double *) (table + sizeof(int64_t));
+    table += sizeof(double) * (1+nbins);
+
+    TH3D * hist = 0;
+    map<int,TH3D*>::iterator it = fRawFluxHistoMap.find(nu_pdg);
+    if(it != fRawFluxHistoMap.end()) {
+      hist = it->second;
+      hist->Reset();
+    } else {
+      string pname = PDGLibrary::Instance()->Find(nu_pdg)->GetName();
+      hist = this->CreateFluxHisto(pname.c_str(), pname.c_str());
+      fRawFluxHistoMap.insert( map<int,TH3D*>::value_type(nu_pdg,hist) );
+    }
+    size_t ibin = 0;
+    for(unsigned int ie = 1; ie <= ne; ie++) {
+      for(unsigned int ic = 1; ic <= nc; ic++) {
+        for(unsigned int ip = 1; ip <= np; ip++) {
+          hist->SetBinContent(ie, ic, ip, contents[ibin++]);
+        }
+      }
+    }
+  }
+
+  LOG("Flux", pNOTICE)
+    << "Loaded " << header->nflux << " flux tables from the shared image at: "
+    << fSharedCacheFile;
+
+  munmap(addr, size);
+  return true;
+}
+//___________________________________________________________________________
+void GAtmoFlux::WriteSharedFluxCache(void) const
+{
+// The image is written in a temporary file which then replaces the image,
+// so that jobs never map an incomplete one
+
+  std::ostringstream tmpname;
+  tmpname << fSharedCacheFile << ".tmp." << getpid();
+
+  std::ofstream out(tmpname.str().c_str(), std::ios::binary);
+  if(!out.is_open()) {
+    LOG("Flux", pWARN)
+      << "Couldn't write the shared flux table image: " << tmpname.str();
+    return;
+  }
+
+  size_t ne = fNumEnergyBins, nc = fNumCosThetaBins, np = fNumPhiBins;
+  size_t nedges = (ne+1) + (nc+1) + (np+1);
+  size_t nbins  = ne*nc*np;
+
+  ShmHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.signature, kShmSignature, sizeof(kShmSignature));
+  header.version   = kShmVersion;
+  header.nflux     = fRawFluxHistoMap.size();
+  header.key       = this->SharedFluxCacheKey();
+  header.file_size = sizeof(ShmHeader) +
+                       sizeof(double) * (nedges + header.nflux * (1+nbins));
+  header.ne = ne;
+  header.nc = nc;
+  header.np = np;
+  out.write((const char *) &header, sizeof(header));
+
+  out.write((const char *) fEnergyBins,   (ne+1)*sizeof(double));
+  out.write((const char *) fCosThetaBins, (nc+1)*sizeof(double));
+  out.write((const char *) fPhiBins,      (np+1)*sizeof(double));
+
+  vector<double> contents(nbins);
+  map<int,TH3D*>::const_iterator it = fRawFluxHistoMap.begin();
+  for( ; it != fRawFluxHistoMap.end(); ++it) {
+    int64_t nu_pdg = it->first;
+    out.write((const char *) &nu_pdg, sizeof(int64_t));
+    size_t ibin = 0;
+    for(unsigned int ie = 1; ie <= ne; ie++) {
+      for(unsigned int ic = 1; ic <= nc; ic++) {
+        for(unsigned int ip = 1; ip <= np; ip++) {
+          contents[ibin++] = it->second->GetBinContent(ie, ic, ip);
+        }
+      }
+    }
+    out.write((const char *) &contents[0], nbins*sizeof(double));
+  }
+  out.close();
+
+  if(!out || rename(tmpname.str().c_str(), fSharedCacheFile.c_str()) != 0) {
+    LOG("Flux", pWARN)
+      << "Couldn't write the shared flux table image: " << fSharedCacheFile;
+    unlink(tmpname.str().c_str());
+    return;
+  }
+  LOG("Flux", pNOTICE)
+    << "Saved the flux tables in the shared image at: " << fSharedCacheFile;
+}
+//___________________________________________________________________________
 TH3D* GAtmoFlux::CreateNormalisedFluxHisto(TH3D* hist)
 {
 // return integrated flux
@@ -547,6 +819,41 @@ void GAtmoFlux::AddAllFluxes(void)
   }
 
   fTotalFluxHistoIntg = fTotalFluxHisto->Integral();
+
+  this->BuildFluxAliasTable();
+}
+//___________________________________________________________________________
+void GAtmoFlux::BuildFluxAliasTable(void)
+{
+// Builds the table for selecting the neutrino species and the (Ev,costheta,
+// phi) bin of the nominal flux in one step, with probability proportional to
+// the integrated flux of each bin. Bin ((inu*nEv + iEv)*ncos8 + icos8)*nphi
+// + iphi is species fFluxAliasPdg[inu] at the bin (iEv+1,icos8+1,iphi+1)
+// of its flux histogram.
+
+  fFluxAliasPdg.clear();
+  vector<double> flux;
+  flux.reserve(fFluxHistoMap.size()*fNumEnergyBins*fNumCosThetaBins*fNumPhiBins);
+
+  map<int,TH3D*>::const_iterator it = fFluxHistoMap.begin();
+  for( ; it != fFluxHistoMap.end(); ++it) {
+    TH3D * flux_histogram = it->second;
+    fFluxAliasPdg.push_back(it->first);
+    for(unsigned int ie = 1; ie <= fNumEnergyBins; ie++) {
+      for(unsigned int ic = 1; ic <= fNumCosThetaBins; ic++) {
+        for(unsigned int ip = 1; ip <= fNumPhiBins; ip++) {
+          flux.push_back(flux_histogram->GetBinContent(ie,ic,ip));
+        }
+      }
+    }
+  }
+
+  if(!fFluxAlias.Build(flux)) {
+    LOG("Flux", pERROR) << "The input atmospheric flux is zero everywhere!";
+    return;
+  }
+  LOG("Flux", pNOTICE)
+    << "Built the flux sampling table over " << fFluxAlias.Size() << " bins";
 }
 //___________________________________________________________________________
 TH3D * GAtmoFlux::CreateFluxHisto(string name, string title)
@@ -47,6 +47,7 @@
 #include <TRotation.h>
 
 #include "Framework/EventGen/GFluxI.h"
+#include "Framework/Numerical/AliasTable.h"
 
 class TH3D;
 
@@ -74,6 +75,8 @@ public :
   virtual long int               Index         (void) { return -1;         }
   virtual void                   Clear            (Option_t * opt);
   virtual void                   GenerateWeighted (bool gen_weighted);
+  virtual bool                   SaveState        (TDirectory * dir) const;
+  virtual bool                   RestoreState     (TDirectory * dir);
 
   // get neutrino energy/direction of generated events
   double Enu        (void) { return fgP4.Energy(); }
@@ -91,6 +94,7 @@ public :
   void     AddFluxFile        (int neutrino_pdg, string filename);
   void     AddFluxFile        (string filename);
   bool     LoadFluxData       (void);
+  void     UseSharedFluxCache (string filename); ///< Load the flux tables from (or, if missing, save them to) a binary image shared by the jobs of a node, eg in /dev/shm
 
   TH3D*    GetFluxHistogram   (int flavour);
   double   GetFlux            (int flavour);
@@ -113,6 +117,10 @@ protected:
   void    ZeroFluxHisto     (TH3D * hist);
   void    AddAllFluxes      (void);
   int     SelectNeutrino    (double Ev, double costheta, double phi);
+  void    BuildFluxAliasTable (void);
+  bool    ReadSharedFluxCache  (void);
+  void    WriteSharedFluxCache (void) const;
+  unsigned long long SharedFluxCacheKey (void) const;
   TH3D*   CreateNormalisedFluxHisto ( TH3D* hist);  // normalise flux files
 
   // pure virtual methods; to be implemented by concrete flux drivers
@@ -144,8 +152,11 @@ protected:
   double           fTotalFluxHistoIntg; ///< fFluxSum2D integral
   map<int, TH3D*>  fFluxHistoMap;       ///< flux = f(Ev,cos8,phi) for each neutrino species
   map<int, TH3D*>  fRawFluxHistoMap;    ///< flux = f(Ev,cos8,phi) for each neutrino species
+  AliasTable       fFluxAlias;          ///< sampling table over all (species,Ev,cos8,phi) bins of fFluxHistoMap
+  vector<int>      fFluxAliasPdg;       ///< neutrino species of each fFluxAlias species block
   vector<int>      fFluxFlavour;        ///< input flux file for each neutrino species
   vector<string>   fFluxFile;           ///< input flux file for each neutrino species
+  string           fSharedCacheFile;    ///< node-shared binary image of the loaded flux tables (empty: not used)
 };
 
 } // flux namespace
@@ -8,7 +8,6 @@
 */
 //____________________________________________________________________________
 
-#include <cassert>
 #include <algorithm>
 
 #include <TH1D.h>
@@ -31,6 +30,9 @@ using namespace genie;
 using namespace genie::constants;
 using namespace genie::flux;
 
+// number of segments over which the Rt dependence is tabulated
+static const int kNRtSegments = 1000;
+
 //____________________________________________________________________________
 GCylindTH1Flux::GCylindTH1Flux()
 {
@@ -47,9 +49,22 @@ bool GCylindTH1Flux::GenerateNext(void)
   //-- Reset previously generated neutrino code / 4-p / 4-x
   this->ResetSelection();
 
-  //-- Generate an energy from the 'combined' spectrum histogram
-  //   and compute the momentum vector
-  double Ev = (double) fTotSpectrum->GetRandom();
+  RandomGen * rnd = RandomGen::Instance();
+
+  //-- Select a neutrino species and an energy bin of its spectrum in one
+  //   step, with probability proportional to the bin contents, then an
+  //   energy uniformly within the bin, and compute the momentum vector
+  if(fEvAlias.IsEmpty()) {
+    LOG("Flux", pFATAL) << "No (non-empty) energy spectrum was input!";
+    gAbortingInErr = true;
+    exit(1);
+  }
+  int    ientry   = fEvAlias.Sample(rnd->RndFlux().Rndm());
+  int    inu      = fEvAliasNu [ientry];
+  int    ibin     = fEvAliasBin[ientry];
+  TH1D * spectrum = fSpectrum[inu];
+  double Ev = spectrum->GetBinLowEdge(ibin) +
+              spectrum->GetBinWidth(ibin) * rnd->RndFlux().Rndm();
 
   TVector3 p3(*fDirVec); // momentum along the neutrino direction
   p3.SetMag(Ev);         // with |p|=Ev
@@ -61,9 +76,7 @@ bool GCylindTH1Flux::GenerateNext(void)
 
   fgP4.SetPxPyPzE(p3.Px(), p3.Py(), p3.Pz(), Ev);
 
-  //-- Select a neutrino species from the flux fractions at the
-  //   selected energy
-  fgPdgC = (*fPdgCList)[this->SelectNeutrino(Ev)];
+  fgPdgC = (*fPdgCList)[inu];
 
   //-- Compute neutrino 4-x
 
@@ -178,6 +191,7 @@ void GCylindTH1Flux::SetTransverseRadius(double Rt)
   fRt = Rt;
 
   if(fRtDep) fRtDep->SetRange(0,Rt);
+  this->BuildRtSampler();
 }
 //___________________________________________________________________________
 void GCylindTH1Flux::AddEnergySpectrum(int nu_pdgc, TH1D * spectrum)
@@ -200,7 +214,7 @@ void GCylindTH1Flux::AddEnergySpectrum(int nu_pdgc, TH1D * spectrum)
      LOG("Flux", pNOTICE)
           << "Updating maximum energy of flux particles to: " << fMaxEv;
 
-     this->AddAllFluxes(); // update combined flux
+     this->AddAllFluxes(); // update combined flux & sampling table
   }
 }
 //___________________________________________________________________________
@@ -213,6 +227,34 @@ void GCylindTH1Flux::SetRtDependence(string rdep)
   if(fRtDep) delete fRtDep;
 
   fRtDep = new TF1("rdep", rdep.c_str(), 0,fRt);
+  this->BuildRtSampler();
+}
+//___________________________________________________________________________
+void GCylindTH1Flux::BuildRtSampler(void)
+{
+// Tabulates the Rt dependence at kNRtSegments+1 points in [0,Rt]. A segment
+// is selected with probability proportional to its (trapezoidal) integral
+// and Rt is then generated exactly from the linear interpolation of the Rt
+// dependence within the segment. The default dependence ("x", uniform over
+// the beam cross section) is linear and so it is generated exactly.
+
+  fRtGrid.clear();
+  fRtPdf .clear();
+  fRtAlias.Build(vector<double>());
+
+  if(!fRtDep || fRt <= 0) return;
+
+  vector<double> segment(kNRtSegments);
+  for(int i = 0; i <= kNRtSegments; i++) {
+    double r = fRt * i / kNRtSegments;
+    fRtGrid.push_back(r);
+    fRtPdf .push_back(TMath::Max(0., fRtDep->Eval(r)));
+    if(i > 0) segment[i-1] = 0.5 * (fRtPdf[i-1] + fRtPdf[i]);
+  }
+  if(!fRtAlias.Build(segment)) {
+    LOG("Flux", pERROR)
+      << "The Rt dependence is not positive anywhere in [0," << fRt << "]";
+  }
 }
 //___________________________________________________________________________
 void GCylindTH1Flux::AddAllFluxes(void)
@@ -232,40 +274,21 @@ void GCylindTH1Flux::AddAllFluxes(void)
      else       { fTotSpectrum->Add(spectrum);        }
      inu++;
   }
-}
-//___________________________________________________________________________
-int GCylindTH1Flux::SelectNeutrino(double Ev)
-{
-  const unsigned int n = fPdgCList->size();
-  double fraction[n];
-
-  vector<TH1D *>::const_iterator spectrum_iter;
-
-  unsigned int inu=0;
-  for(spectrum_iter = fSpectrum.begin();
-                       spectrum_iter != fSpectrum.end(); ++spectrum_iter) {
-     TH1D * spectrum = *spectrum_iter;
-     fraction[inu++] = spectrum->GetBinContent(spectrum->FindBin(Ev));
-  }
 
-  double sum = 0;
-  for(inu = 0; inu < n; inu++) {
-     sum += fraction[inu];
-     fraction[inu] = sum;
-     LOG("Flux", pDEBUG) << "SUM-FRACTION(0->" << inu <<") = " << sum;
+  // table for selecting the species and the energy bin (in-range bins only,
+  // as TH1::GetRandom())
+  vector<double> content;
+  fEvAliasNu .clear();
+  fEvAliasBin.clear();
+  for(inu = 0; inu < fSpectrum.size(); inu++) {
+     TH1D * spectrum = fSpectrum[inu];
+     for(int ibin = 1; ibin <= spectrum->GetNbinsX(); ibin++) {
+        content    .push_back(spectrum->GetBinContent(ibin));
+        fEvAliasNu .push_back(inu);
+        fEvAliasBin.push_back(ibin);
+     }
   }
-
-  RandomGen * rnd = RandomGen::Instance();
-  double R = sum * rnd->RndFlux().Rndm();
-
-  LOG("Flux", pDEBUG) << "R e [0,SUM] = " << R;
-
-  for(inu = 0; inu < n; inu++) {if ( R < fraction[inu] ) return inu;}
-
-  LOG("Flux", pERROR) << "Could not select a neutrino species";
-  assert(false);
-
-  return -1;
+  fEvAlias.Build(content);
 }
 //___________________________________________________________________________
 double GCylindTH1Flux::GeneratePhi(void) const
@@ -277,7 +300,20 @@ double GCylindTH1Flux::GeneratePhi(void) const
 //___________________________________________________________________________
 double GCylindTH1Flux::GenerateRt(void) const
 {
-  double Rt = fRtDep->GetRandom(); // rndm R [0,Rtransverse]
+  if(fRtAlias.IsEmpty()) return 0.;
+
+  // select a segment, then Rt within it from the linear pdf p0 + (p1-p0)*t
+  // (t = [sqrt(p0^2 + (p1^2-p0^2)u) - p0] / (p1-p0), in a form that is
+  // stable for p1 ~ p0)
+  RandomGen * rnd = RandomGen::Instance();
+  int    i  = fRtAlias.Sample(rnd->RndFlux().Rndm());
+  double u  = rnd->RndFlux().Rndm();
+  double p0 = fRtPdf[i];
+  double p1 = fRtPdf[i+1];
+  double d  = p0 + TMath::Sqrt(p0*p0 + (p1*p1 - p0*p0)*u);
+  double t  = (d > 0) ? u * (p0 + p1) / d : 0.;
+
+  double Rt = fRtGrid[i] + t * (fRtGrid[i+1] - fRtGrid[i]); // rndm R [0,Rtransverse]
   return Rt;
 }
 //___________________________________________________________________________
@@ -29,6 +29,7 @@
 #include <TLorentzVector.h>
 
 #include "Framework/EventGen/GFluxI.h"
+#include "Framework/Numerical/AliasTable.h"
 
 class TH1D;
 class TF1;
@@ -73,7 +74,7 @@ private:
   void   CleanUp           (void);
   void   ResetSelection    (void);
   void   AddAllFluxes      (void);
-  int    SelectNeutrino    (double Ev);
+  void   BuildRtSampler    (void);
   double GeneratePhi       (void) const;
   double GenerateRt        (void) const;
 
@@ -89,6 +90,12 @@ private:
   TVector3 *     fBeamSpot;    ///< beam spot position
   double         fRt;          ///< transverse size of neutrino beam
   TF1 *          fRtDep;       ///< transverse radius dependence
+  AliasTable     fEvAlias;     ///< sampling table over the bins of all spectra
+  vector<int>    fEvAliasNu;   ///< species (fSpectrum index) of each fEvAlias entry
+  vector<int>    fEvAliasBin;  ///< spectrum bin of each fEvAlias entry
+  AliasTable     fRtAlias;     ///< sampling table over the segments of fRtGrid
+  vector<double> fRtGrid;      ///< Rt points at which fRtDep is tabulated
+  vector<double> fRtPdf;       ///< fRtDep at the fRtGrid points (>=0)
 };
 
 } // flux namespace
@@ -0,0 +1,265 @@
+//____________________________________________________________________________
+/*!
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+#include "Tools/Flux/GFlavorMixerCache.h"
+#include "Tools/Flux/GFlavorMixerFactory.h"
+// self register with the factory
+FLAVORMIXREG4(genie,flux,GFlavorMixerCache,genie::flux::GFlavorMixerCache)
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/StringUtils.h"
+
+using std::string;
+using std::vector;
+
+// index of the { 0, 12, 14, 16, -12, -14, -16 } codes (as in GFlavorMap),
+// -1 for any other code
+static int PDG2Indx(int pdg)
+{
+  switch ( pdg ) {
+  case   0: return 0;
+  case  12: return 1;
+  case  14: return 2;
+  case  16: return 3;
+  case -12: return 4;
+  case -14: return 5;
+  case -16: return 6;
+  default:  return -1;
+  }
+}
+static int Indx2PDG(int indx)
+{
+  static const int pdg[] = { 0, 12, 14, 16, -12, -14, -16 };
+  return pdg[indx];
+}
+
+namespace genie {
+namespace flux {
+//____________________________________________________________________________
+GFlavorMixerCache::GFlavorMixerCache() :
+  fMixer(0), fLogEmin(0), fDLogE(1), fNE(0), fDmin(0), fDD(0), fND(1),
+  fFixedSet(false), fLastIn(-1), fLastE(0), fLastD(0), fNMixerCalls(0)
+{
+  this->SetEnergyGrid(0.01, 1000., 201);
+  this->SetDistanceGrid(0., 0., 1);
+}
+
+GFlavorMixerCache::~GFlavorMixerCache()
+{
+  if ( fMixer ) { delete fMixer; fMixer = 0; }
+}
+
+//____________________________________________________________________________
+void GFlavorMixerCache::Config(std::string configIn)
+{
+  std::string config = genie::utils::str::TrimSpaces(configIn);
+  LOG("FluxBlender", pINFO)
+    << "GFlavorMixerCache::Config \"" << config << "\"";
+
+  vector<string> tokens = genie::utils::str::Split(config," ");
+  unsigned int jtok = 0;
+  for ( ; jtok < tokens.size(); ++jtok ) {
+    string tok1 = tokens[jtok];
+    if ( tok1 == "" ) continue;
+    if ( tok1 == "genie::flux::GFlavorMixerCache" ) continue;
+    bool isegrid = ( tok1.find("egrid=") == 0 );
+    bool isdgrid = ( tok1.find("dgrid=") == 0 );
+    if ( ! isegrid && ! isdgrid ) break;
+    // should have the form  egrid=<min>,<max>,<n>
+    vector<string> vals = genie::utils::str::Split(tok1.substr(6),",");
+    if ( vals.size() != 3 ) {
+      LOG("FluxBlender", pWARN)
+        << "could not parse " << tok1 << " split size=" << vals.size();
+      continue;
+    }
+    double vmin = strtod(vals[0].c_str(),NULL);
+    double vmax = strtod(vals[1].c_str(),NULL);
+    int    n    = strtol(vals[2].c_str(),NULL,0);
+    if ( isegrid ) this->SetEnergyGrid(vmin,vmax,n);
+    else           this->SetDistanceGrid(vmin,vmax,n);
+  }
+
+  if ( jtok >= tokens.size() ) {
+    LOG("FluxBlender", pWARN)
+      << "GFlavorMixerCache::Config no mixer to cache in \"" << config << "\"";
+    return;
+  }
+
+  string name = tokens[jtok];
+  string mixconfig;
+  for ( ++jtok; jtok < tokens.size(); ++jtok ) {
+    mixconfig += " ";
+    mixconfig += tokens[jtok];
+  }
+
+  GFlavorMixerI* mixer = GFlavorMixerFactory::Instance().GetFlavorMixer(name);
+  if ( ! mixer ) return;
+  mixer->Config(mixconfig);
+  GFlavorMixerI* oldmix = this->AdoptFlavorMixer(mixer);
+  if ( oldmix ) delete oldmix;
+}
+
+//____________________________________________________________________________
+GFlavorMixerI* GFlavorMixerCache::AdoptFlavorMixer(GFlavorMixerI* mixer)
+{
+  GFlavorMixerI* oldmix = fMixer;
+  fMixer = mixer;
+  this->ResetTable();
+  return oldmix;
+}
+
+//____________________________________________________________________________
+void GFlavorMixerCache::SetEnergyGrid(double emin, double emax, int nnodes)
+{
+  if ( emin <= 0 || emax <= emin || nnodes < 2 ) {
+    LOG("FluxBlender", pWARN)
+      << "GFlavorMixerCache: ignoring the bad energy grid ["
+      << emin << "," << emax << "] x " << nnodes;
+    return;
+  }
+  fLogEmin = std::log(emin);
+  fDLogE   = ( std::log(emax) - fLogEmin ) / ( nnodes - 1 );
+  fNE      = nnodes;
+  this->ResetTable();
+}
+
+//____________________________________________________________________________
+void GFlavorMixerCache::SetDistanceGrid(double dmin, double dmax, int nnodes)
+{
+  if ( nnodes < 2 ) {
+    // fixed baseline, set by the first call
+    fDmin     = 0;
+    fDD       = 0;
+    fND       = 1;
+    fFixedSet = false;
+  } else {
+    if ( dmax <= dmin ) {
+      LOG("FluxBlender", pWARN)
+        << "GFlavorMixerCache: ignoring the bad distance grid ["
+        << dmin << "," << dmax << "] x " << nnodes;
+      return;
+    }
+    fDmin     = dmin;
+    fDD       = ( dmax - dmin ) / ( nnodes - 1 );
+    fND       = nnodes;
+    fFixedSet = true;
+  }
+  this->ResetTable();
+}
+
+//____________________________________________________________________________
+void GFlavorMixerCache::ResetTable(void)
+{
+  if ( fND == 1 ) fFixedSet = false;
+  fTable.assign(fNE*fND*7*7, 0.);
+  fFilled.assign(fNE*fND*7, 0);
+  fLastIn = -1;
+}
+
+//____________________________________________________________________________
+const double* GFlavorMixerCache::Row(int iin, int ie, int id)
+{
+  int irow = ( ie * fND + id ) * 7 + iin;
+  double* prob = &fTable[irow*7];
+  if ( ! fFilled[irow] ) {
+    double energy = std::exp( fLogEmin + ie * fDLogE );
+    double dist   = fDmin + id * fDD;
+    for (int iout = 0; iout < 7; ++iout ) {
+      prob[iout] = fMixer->Probability(Indx2PDG(iin),Indx2PDG(iout),energy,dist);
+    }
+    fNMixerCalls += 7;
+    fFilled[irow] = 1;
+  }
+  return prob;
+}
+
+//____________________________________________________________________________
+double GFlavorMixerCache::Probability(int pdg_initial, int pdg_final,
+                                      double energy, double dist)
+{
+  if ( ! fMixer ) {
+    LOG("FluxBlender", pFATAL)
+      << "GFlavorMixerCache has no flavor mixer to cache";
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  int iin  = PDG2Indx(pdg_initial);
+  int iout = PDG2Indx(pdg_final);
+
+  // the blender asks for all final flavors in turn at the same E, L
+  if ( iin >= 0 && iout >= 0 &&
+       iin == fLastIn && energy == fLastE && dist == fLastD ) {
+    return fLastProb[iout];
+  }
+
+  if ( fND == 1 && ! fFixedSet ) {
+    fDmin     = dist;
+    fFixedSet = true;
+    LOG("FluxBlender", pNOTICE)
+      << "GFlavorMixerCache: caching at the fixed baseline " << dist << " m";
+  }
+
+  // position in the grid, or pass on the request if outside it
+  double x = ( energy > 0 ) ? ( std::log(energy) - fLogEmin ) / fDLogE : -1;
+  double y = ( fND > 1 ) ? ( dist - fDmin ) / fDD : 0;
+  bool ingrid = ( iin >= 0 && iout >= 0 &&
+                  x >= 0 && x <= fNE-1 &&
+                  ( fND > 1 ? ( y >= 0 && y <= fND-1 ) : dist == fDmin ) );
+  if ( ! ingrid ) {
+    ++fNMixerCalls;
+    return fMixer->Probability(pdg_initial,pdg_final,energy,dist);
+  }
+
+  int    ie = std::min( (int)x, fNE-2 );
+  double fe = x - ie;
+  int    id = ( fND > 1 ) ? std::min( (int)y, fND-2 ) : 0;
+  double fd = ( fND > 1 ) ? y - id : 0;
+
+  const double* r00 = this->Row(iin,ie  ,id);
+  const double* r10 = this->Row(iin,ie+1,id);
+  for (int j = 0; j < 7; ++j ) {
+    fLastProb[j] = (1-fe) * r00[j] + fe * r10[j];
+  }
+  if ( fND > 1 ) {
+    const double* r01 = this->Row(iin,ie  ,id+1);
+    const double* r11 = this->Row(iin,ie+1,id+1);
+    for (int j = 0; j < 7; ++j ) {
+      double p1 = (1-fe) * r01[j] + fe * r11[j];
+      fLastProb[j] = (1-fd) * fLastProb[j] + fd * p1;
+    }
+  }
+  fLastIn = iin;
+  fLastE  = energy;
+  fLastD  = dist;
+
+  return fLastProb[iout];
+}
+
+//____________________________________________________________________________
+void GFlavorMixerCache::PrintConfig(bool verbose)
+{
+  LOG("FluxBlender", pINFO)
+    << "GFlavorMixerCache::PrintConfig(): "
+    << fNE << " energy nodes in [" << std::exp(fLogEmin) << ","
+    << std::exp(fLogEmin + (fNE-1)*fDLogE) << "] GeV, "
+    << ( ( fND > 1 ) ? "" : "fixed baseline, " )
+    << fND << " distance nodes from " << fDmin << " m; "
+    << fNMixerCalls << " calls to the cached mixer so far";
+  if ( fMixer ) fMixer->PrintConfig(verbose);
+}
+
+//____________________________________________________________________________
+} // namespace flux
+} // namespace genie
@@ -0,0 +1,113 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::flux::GFlavorMixerCache
+
+\brief   A GFlavorMixerI adapter that caches the transition probabilities
+         of another (typically expensive, e.g. three-flavour matter) mixer.
+
+         The probabilities are tabulated at the nodes of an (energy,
+         distance) grid, log-spaced in energy and linear in distance, and
+         interpolated bilinearly in between. Each node is filled on first
+         use, for all 7 final flavours of an initial flavour at once, with
+         one Probability() call per flavour to the wrapped mixer. As the
+         interpolation is linear, the interpolated probabilities of an
+         initial flavour still sum up to 1.
+
+         If no distance grid is given the baseline is taken as fixed, at
+         the first distance requested. Requests outside the grid (or at a
+         different baseline) are passed to the wrapped mixer.
+
+         The grid must resolve the oscillations: the default energy grid
+         has 40 nodes per decade, from 10 MeV to 1 TeV.
+
+         Supported config string format (the options come first):
+           " [egrid=emin,emax,n] [dgrid=dmin,dmax,n] mixer-name mixer-config "
+         where mixer-name is a name known to the GFlavorMixerFactory and
+         mixer-config is passed to the Config() of that mixer.
+         Energies are in GeV, distances in meters.
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         for the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef GENIE_FLUX_GFLAVORMIXERCACHE_H
+#define GENIE_FLUX_GFLAVORMIXERCACHE_H
+
+#include <string>
+#include <vector>
+
+#include "Tools/Flux/GFlavorMixerI.h"
+
+namespace genie {
+namespace flux {
+
+  class GFlavorMixerCache : public GFlavorMixerI {
+
+  public:
+
+    GFlavorMixerCache();
+    ~GFlavorMixerCache();
+
+    //
+    // implement the GFlavorMixerI interface:
+    //
+
+    /// parse the grid options, then create & configure the wrapped mixer
+    void      Config(std::string config);
+
+    /// interpolated transition probability of the wrapped mixer
+    double    Probability(int pdg_initial, int pdg_final,
+                          double energy, double dist);
+
+    /// provide a means of printing the configuration
+    void     PrintConfig(bool verbose=true);
+
+    //
+    // specific to the cache:
+    //
+
+    GFlavorMixerI* AdoptFlavorMixer(GFlavorMixerI* mixer); ///< return previous
+    GFlavorMixerI* GetFlavorMixer() { return fMixer; }     ///< access, not ownership
+
+    void  SetEnergyGrid   (double emin, double emax, int nnodes);  ///< GeV, log spaced
+    void  SetDistanceGrid (double dmin, double dmax, int nnodes);  ///< m, linear (nnodes<2: fixed baseline)
+
+    long int NMixerCalls  (void) const { return fNMixerCalls; }    ///< calls to the wrapped mixer
+
+  private:
+
+    void          ResetTable (void);
+    const double* Row        (int iin, int ie, int id);  ///< tabulated probabilities at a node
+
+    GFlavorMixerI*      fMixer;        ///< wrapped mixer (owned)
+
+    double              fLogEmin;      ///< energy grid: log(emin)
+    double              fDLogE;        ///< energy grid: log spacing
+    int                 fNE;           ///< energy grid: number of nodes
+    double              fDmin;         ///< distance grid: first node (or the fixed baseline)
+    double              fDD;           ///< distance grid: spacing
+    int                 fND;           ///< distance grid: number of nodes (1: fixed baseline)
+    bool                fFixedSet;     ///< fixed baseline: has the distance been set?
+
+    std::vector<double> fTable;        ///< [ie][id][iin][iout] probabilities
+    std::vector<char>   fFilled;       ///< [ie][id][iin] is the row filled?
+
+    int                 fLastIn;       ///< last interpolated row: initial flavour index
+    double              fLastE;        ///< last interpolated row: energy
+    double              fLastD;        ///< last interpolated row: distance
+    double              fLastProb[7];  ///< last interpolated row
+
+    long int            fNMixerCalls;  ///< number of calls to the wrapped mixer
+  };
+
+} // namespace flux
+} // namespace genie
+
+#endif //GENIE_FLUX_GFLAVORMIXERCACHE_H
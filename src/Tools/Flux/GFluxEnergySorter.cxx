@@ -0,0 +1,116 @@
+//____________________________________________________________________________
+/*!
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <algorithm>
+
+#include "Tools/Flux/GFluxEnergySorter.h"
+#include "Framework/Messenger/Messenger.h"
+
+namespace genie {
+namespace flux {
+
+//____________________________________________________________________________
+GFluxEnergySorter::GFluxEnergySorter() :
+  GFluxI(),
+  fRealGFluxI(0),
+  fBlockSize(10000),
+  fNext(0)
+{
+  fNone.fPdg    = 0;
+  fNone.fWeight = 0;
+  fNone.fIndex  = -1;
+  fCurr = &fNone;
+}
+
+GFluxEnergySorter::~GFluxEnergySorter()
+{
+  if ( fRealGFluxI ) { delete fRealGFluxI; fRealGFluxI = 0; }
+}
+
+//____________________________________________________________________________
+bool GFluxEnergySorter::GenerateNext(void)
+{
+  if ( fNext >= fBlock.size() ) {
+    if ( ! this->FillBlock() ) return false;
+  }
+  fCurr = &fBlock[fNext++];
+  return true;
+}
+
+//____________________________________________________________________________
+bool GFluxEnergySorter::End(void)
+{
+  return ( fNext >= fBlock.size() && fRealGFluxI->End() );
+}
+
+//____________________________________________________________________________
+bool GFluxEnergySorter::FillBlock(void)
+{
+  fBlock.clear();
+  fNext = 0;
+  fCurr = &fNone;
+
+  while ( fBlock.size() < fBlockSize && ! fRealGFluxI->End() ) {
+    if ( ! fRealGFluxI->GenerateNext() ) {
+      if ( fBlock.empty() ) return false;
+      break;
+    }
+    FluxEntry entry;
+    entry.fPdg    = fRealGFluxI->PdgCode();
+    entry.fWeight = fRealGFluxI->Weight();
+    entry.fP4     = fRealGFluxI->Momentum();
+    entry.fX4     = fRealGFluxI->Position();
+    entry.fIndex  = fRealGFluxI->Index();
+    fBlock.push_back(entry);
+  }
+  if ( fBlock.empty() ) return false;
+
+  std::stable_sort(fBlock.begin(), fBlock.end(), EnergyOrder);
+
+  LOG("Flux", pINFO)
+    << "Sorted a block of " << fBlock.size() << " flux neutrinos, E = ["
+    << fBlock.front().fP4.E() << ", " << fBlock.back().fP4.E() << "] GeV";
+  return true;
+}
+
+//____________________________________________________________________________
+void GFluxEnergySorter::Clear(Option_t * opt)
+{
+  fRealGFluxI->Clear(opt);
+}
+
+//____________________________________________________________________________
+void GFluxEnergySorter::GenerateWeighted(bool gen_weighted)
+{
+  fRealGFluxI->GenerateWeighted(gen_weighted);
+}
+
+//____________________________________________________________________________
+GFluxI* GFluxEnergySorter::AdoptFluxGenerator(GFluxI* generator)
+{
+  GFluxI* oldgen = fRealGFluxI;
+  fRealGFluxI = generator;
+  fBlock.clear();
+  fNext = 0;
+  fCurr = &fNone;
+  return oldgen;
+}
+
+//____________________________________________________________________________
+void GFluxEnergySorter::SetBlockSize(unsigned int n)
+{
+  fBlockSize = std::max(1u, n);
+  LOG("Flux", pNOTICE)
+    << "Handing out flux neutrinos in energy-sorted blocks of " << fBlockSize;
+}
+
+//____________________________________________________________________________
+} // namespace flux
+} // namespace genie
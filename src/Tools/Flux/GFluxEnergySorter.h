@@ -0,0 +1,106 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::flux::GFluxEnergySorter
+
+\brief   GENIE GFluxI adapter that hands out the flux neutrinos of a
+         concrete GFluxI flux generator in energy-sorted blocks.
+
+         The adapter reads a block of flux neutrinos (pdg code, weight,
+         4-momentum, 4-position and index) from the generator, sorts them
+         by energy and hands them over to the GMCJDriver in that order.
+         Consecutive neutrinos then evaluate the cross section splines,
+         the max cross sections and the interaction probability scales in
+         the same (or neighbouring) energy intervals, which makes their
+         lookups cache- and branch-predictor-friendly.
+
+         The flux neutrinos are independent, so their order doesn't change
+         the generated sample. It does order the generated events by energy
+         within each block: Use GMCJDriver::ShuffleBatches() and batches of
+         at least a block worth of events to write them out in random order.
+
+         Place the adapter outermost: the GFluxI interface is all it passes
+         on (e.g. a GFluxBlender wrapped by it still sees the GNuMIFlux or
+         GSimpleNtpFlux decay distances). Checkpointing is not supported
+         and, as the entries are not read in order, neither is the index
+         based cycle detection of GMCJDriver::PreCalcFluxProbabilities().
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         for the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef GENIE_FLUX_GFLUXENERGYSORTER_H
+#define GENIE_FLUX_GFLUXENERGYSORTER_H
+
+#include <vector>
+
+#include <TLorentzVector.h>
+
+#include "Framework/EventGen/GFluxI.h"
+
+namespace genie {
+namespace flux {
+
+  class GFluxEnergySorter : public GFluxI {
+
+  public:
+
+    GFluxEnergySorter();
+    ~GFluxEnergySorter();
+
+    //
+    // implement the GFluxI interface:
+    //
+    const PDGCodeList &    FluxParticles (void) { return fRealGFluxI->FluxParticles(); }
+    double                 MaxEnergy     (void) { return fRealGFluxI->MaxEnergy(); }
+    bool                   GenerateNext  (void);
+    int                    PdgCode       (void) { return fCurr->fPdg;    }
+    double                 Weight        (void) { return fCurr->fWeight; }
+    const TLorentzVector & Momentum      (void) { return fCurr->fP4;     }
+    const TLorentzVector & Position      (void) { return fCurr->fX4;     }
+    bool                   End           (void);
+    long int               Index         (void) { return fCurr->fIndex;  }
+    void                   Clear            (Option_t * opt);
+    void                   GenerateWeighted (bool gen_weighted);
+
+    //
+    // Configuration:
+    //
+    GFluxI*         AdoptFluxGenerator(GFluxI* generator);      ///< return previous
+    GFluxI*         GetFluxGenerator() { return fRealGFluxI; }  ///< access, not ownership
+
+    void            SetBlockSize (unsigned int n);   ///< flux neutrinos per sorted block
+    unsigned int    BlockSize    (void) const { return fBlockSize; }
+
+  private:
+
+    struct FluxEntry {
+      int            fPdg;
+      double         fWeight;
+      TLorentzVector fP4;
+      TLorentzVector fX4;
+      long int       fIndex;
+    };
+    static bool EnergyOrder (const FluxEntry & a, const FluxEntry & b)
+    { return a.fP4.E() < b.fP4.E(); }
+
+    bool            FillBlock (void);
+
+    GFluxI*                 fRealGFluxI;   ///< actual flux generator (owned)
+    unsigned int            fBlockSize;    ///< flux neutrinos per block
+    std::vector<FluxEntry>  fBlock;        ///< current block, sorted by energy
+    unsigned int            fNext;         ///< next entry of fBlock to hand out
+    FluxEntry               fNone;         ///< "current" entry before the first one
+    const FluxEntry *       fCurr;         ///< current entry
+  };
+
+} // namespace flux
+} // namespace genie
+
+#endif //GENIE_FLUX_GFLUXENERGYSORTER_H
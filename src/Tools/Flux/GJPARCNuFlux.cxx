@@ -31,6 +31,7 @@
 #include "Framework/Utils/StringUtils.h"
 
 #include "Tools/Flux/GFluxDriverFactory.h"
+#include "Framework/Utils/StartupProfiler.h"
 FLUXDRIVERREG4(genie,flux,GJPARCNuFlux,genie::flux::GJPARCNuFlux)
 
 using std::endl;
@@ -381,6 +382,8 @@ bool GJPARCNuFlux::LoadBeamSimData(string filename, string detector_location)
 // The detector location can be any of:
 //  "sk","nd1" (<-2km),"nd5" (<-nd280),...,"nd10"
 
+  StartupTimer timer("Flux loading");
+
   LOG("Flux", pNOTICE)
         << "Loading jnubeam flux tree from ROOT file: " << filename;
   LOG("Flux", pNOTICE)
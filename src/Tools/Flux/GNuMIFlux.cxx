@@ -17,6 +17,7 @@
 #include <sstream>
 #include <cassert>
 #include <climits>
+#include <cmath>
 
 #include "libxml/xmlmemory.h"
 #include "libxml/parser.h"
@@ -48,6 +49,7 @@
 #include "Framework/Numerical/MathUtils.h"
 #include "Framework/Utils/PrintUtils.h"
 #include "Framework/Utils/UnitUtils.h"
+#include "Framework/Utils/ThreadPool.h"
 
 using std::endl;
 
@@ -58,6 +60,7 @@ using std::endl;
 #include "TString.h"
 
 #include "Tools/Flux/GFluxDriverFactory.h"
+#include "Framework/Utils/StartupProfiler.h"
 FLUXDRIVERREG4(genie,flux,GNuMIFlux,genie::flux::GNuMIFlux)
 
 #ifdef  GNUMI_TEST_XY_WGT
@@ -272,6 +275,9 @@ bool GNuMIFlux::GenerateNext_weighted(void)
     fCurEntry->ConvertPartCodes();
     // here we might want to do flavor oscillations or simple mappings
     fCurEntry->fgPdgC = fCurEntry->ntype;
+
+    fCurDecay.Clear();
+    if ( fUseFluxAtDetCenter == 0 ) fCurDecay.Add(*fCurEntry);
   }
 
   // Check neutrino pdg against declared list of neutrino species declared
@@ -332,7 +338,11 @@ bool GNuMIFlux::GenerateNext_weighted(void)
     RandomGen * rnd = RandomGen::Instance();
     fCurEntry->fgX4 += ( rnd->RndFlux().Rndm()*fFluxWindowDir1 +
                          rnd->RndFlux().Rndm()*fFluxWindowDir2   );
-    fCurEntry->CalcEnuWgt(fCurEntry->fgX4,Ev,wgt_xy);
+    {
+      // same calculation as in the max weight scan
+      double x = fCurEntry->fgX4.X(), y = fCurEntry->fgX4.Y(), z = fCurEntry->fgX4.Z();
+      fCurDecay.CalcEnuWgt(1,0,0,&x,&y,&z,&Ev,&wgt_xy);
+    }
     break;
   }
 
@@ -487,6 +497,8 @@ void GNuMIFlux::LoadBeamSimData(const std::vector<std::string>& patterns,
 // Loads in a gnumi beam simulation root file (converted from hbook format)
 // into the GNuMIFlux driver.
 
+  StartupTimer timer("Flux loading");
+
   bool found_cfg = this->LoadConfig(config);
   if ( ! found_cfg ) {
     LOG("Flux", pFATAL)
@@ -726,20 +738,19 @@ void GNuMIFlux::ScanForMaxWeight(void)
   // the above works only for things close to the MINOS stored weight
   // values.  otherwise we need to work out our own estimate.
   double wgtgenmx = 0, enumx = 0;
-  TStopwatch t;
-  t.Start();
-  for (int itry=0; itry < fMaxWgtEntries; ++itry) {
-    this->GenerateNext_weighted();
-    double wgt = this->Weight();
-    if ( wgt > wgtgenmx ) wgtgenmx = wgt;
-    double enu = fCurEntry->fgP4.Energy();
-    if ( enu > enumx ) enumx = enu;
-  }
-  t.Stop();
-  t.Print("u");
+  bool cached = this->ReadMaxWgtCache(wgtgenmx,enumx);
+  if ( ! cached ) {
+    TStopwatch t;
+    t.Start();
+    this->ScanEntries(fMaxWgtEntries,wgtgenmx,enumx);
+    t.Stop();
+    t.Print("u");
+    this->WriteMaxWgtCache(wgtgenmx,enumx);
+  }
   LOG("Flux", pNOTICE) << "Maximum flux weight for spin = "
                        << wgtgenmx << ", energy = " << enumx
-                       << " (" << fMaxWgtEntries << ")";
+                       << " (" << fMaxWgtEntries << ")"
+                       << (cached ? " from " + fMaxWgtCacheFile : "");
 
   if (wgtgenmx > fMaxWeight ) fMaxWeight = wgtgenmx;
   // apply a fudge factor to estimated weight
@@ -757,6 +768,169 @@ void GNuMIFlux::ScanForMaxWeight(void)
 
 }
 //___________________________________________________________________________
+void GNuMIFlux::ScanEntries(long int nentries, double& wgtmax, double& enumax)
+{
+// Scan the next nentries flux ntuple entries (cycling over the ntuple) for
+// the max weight and energy at random points of the flux window.
+// The entries and window points are read/drawn serially in batches, the
+// decay-to-window weights are then calculated with GNuMIFluxDecayBlock,
+// in chunks spread over all threads.
+
+  const long int kScanBatch = 4096;
+  const int      kScanChunk =  256;  // points per CalcEnuWgt() call
+
+  GNuMIFluxPassThroughInfo entry;
+  GNuMIFluxDecayBlock      decays;
+  std::vector<int>         pdg;
+  std::vector<double>      nimpwt, vx, vy, vz, xw, yw, zw, wxy, wgt, enu;
+
+  RandomGen * rnd = RandomGen::Instance();
+
+  wgtmax = 0;
+  enumax = 0;
+  long int nscanned = 0;
+  while ( nscanned < nentries && fNEntries > 0 ) {
+    long int n = TMath::Min(kScanBatch, nentries - nscanned);
+    decays.Clear();
+    pdg.resize(n);
+    nimpwt.resize(n);
+    vx.resize(n);  vy.resize(n);  vz.resize(n);
+    xw.resize(n);  yw.resize(n);  zw.resize(n);
+    wxy.resize(n); enu.resize(n); wgt.resize(n);
+    for (long int i = 0; i < n; ++i) {
+      fIEntry = ( fIEntry + 1 < fNEntries ) ? fIEntry + 1 : 0;
+      if      ( fG3NuMI ) { fG3NuMI->GetEntry(fIEntry); entry.MakeCopy(fG3NuMI); }
+      else if ( fG4NuMI ) { fG4NuMI->GetEntry(fIEntry); entry.MakeCopy(fG4NuMI); }
+      else if ( fFlugg  ) { fFlugg->GetEntry(fIEntry);  entry.MakeCopy(fFlugg);  }
+      entry.pcodes = 0;
+      entry.units  = 0;
+      entry.ConvertPartCodes();
+      pdg[i]    = entry.ntype;
+      nimpwt[i] = entry.nimpwt;
+      vx[i] = entry.vx;  vy[i] = entry.vy;  vz[i] = entry.vz;
+      TLorentzVector x4 = fFluxWindowBase;
+      switch ( fUseFluxAtDetCenter ) {
+      case -1:  wxy[i] = entry.nwtnear; enu[i] = entry.nenergyn; break;
+      case +1:  wxy[i] = entry.nwtfar;  enu[i] = entry.nenergyf; break;
+      default:
+        x4 += ( rnd->RndFlux().Rndm()*fFluxWindowDir1 +
+                rnd->RndFlux().Rndm()*fFluxWindowDir2   );
+        break;
+      }
+      if ( fUseFluxAtDetCenter == 0 ) decays.Add(entry);
+      xw[i] = x4.X();  yw[i] = x4.Y();  zw[i] = x4.Z();
+    }
+    nscanned += n;
+
+    int nchunks = (n + kScanChunk - 1) / kScanChunk;
+    ThreadPool::Instance()->ParallelFor(nchunks, [&](int ichunk, unsigned int) {
+      int i0 = ichunk * kScanChunk;
+      int nc = TMath::Min((long int)kScanChunk, n - i0);
+      if ( fUseFluxAtDetCenter == 0 ) {
+        decays.CalcEnuWgt(nc, 0, i0, &xw[i0], &yw[i0], &zw[i0],
+                          &enu[i0], &wxy[i0]);
+      }
+      for (int i = i0; i < i0 + nc; ++i) {
+        if ( ! fPdgCList->ExistsInPDGCodeList(pdg[i]) ) {
+          wgt[i] = 0;
+          enu[i] = 0;
+          continue;
+        }
+        wgt[i] = nimpwt[i] * wxy[i];
+        if ( fApplyTiltWeight ) {
+          TVector3 dirNu =
+            TVector3(xw[i]-vx[i], yw[i]-vy[i], zw[i]-vz[i]).Unit();
+          wgt[i] *= TMath::Abs( dirNu.Dot(fWindowNormal) );
+        }
+      }
+    });
+
+    for (long int i = 0; i < n; ++i) {
+      if ( wgt[i] > wgtmax ) wgtmax = wgt[i];
+      if ( enu[i] > enumax ) enumax = enu[i];
+    }
+  }
+}
+//___________________________________________________________________________
+string GNuMIFlux::MaxWgtCacheKey(void)
+{
+// A hash of everything the max weight scan depends on: the flux files, the
+// flux window, the energy limit, the neutrino species and the scan settings
+
+  std::vector<std::string> flist = this->GetFileList();
+  std::sort(flist.begin(),flist.end());
+
+  std::ostringstream key;
+  key << std::setprecision(12) << fNuFluxGen;
+  for (size_t i = 0; i < flist.size(); ++i) key << " " << flist[i];
+  const TLorentzVector * win[3] =
+    { &fFluxWindowBase, &fFluxWindowDir1, &fFluxWindowDir2 };
+  for (int i = 0; i < 3; ++i) {
+    key << " (" << win[i]->X() << "," << win[i]->Y() << "," << win[i]->Z() << ")";
+  }
+  key << " " << fMaxEv << " " << fUseFluxAtDetCenter << " " << fApplyTiltWeight
+      << " " << fMaxWgtEntries;
+  std::vector<int> pdgs(fPdgCList->begin(),fPdgCList->end());
+  std::sort(pdgs.begin(),pdgs.end());
+  for (size_t i = 0; i < pdgs.size(); ++i) key << " " << pdgs[i];
+
+  // 64-bit FNV-1a
+  std::string skey = key.str();
+  ULong64_t hash = 14695981039346656037ULL;
+  for (size_t i = 0; i < skey.size(); ++i) {
+    hash ^= (unsigned char) skey[i];
+    hash *= 1099511628211ULL;
+  }
+  std::ostringstream shash;
+  shash << std::hex << std::setw(16) << std::setfill('0') << hash;
+  return shash.str();
+}
+//___________________________________________________________________________
+bool GNuMIFlux::ReadMaxWgtCache(double& wgtmax, double& enumax)
+{
+// Look up the max weight & energy of an earlier scan with the same
+// configuration in the cache file (lines of: key wgtmax enumax)
+
+  if ( fMaxWgtCacheFile == "" ) return false;
+
+  std::ifstream cache(fMaxWgtCacheFile.c_str());
+  if ( ! cache.is_open() ) return false;
+
+  string key = this->MaxWgtCacheKey();
+  bool found = false;
+  std::string line;
+  while ( std::getline(cache,line) ) {
+    std::istringstream iss(line);
+    std::string k;
+    double w = 0, e = 0;
+    if ( ! (iss >> k >> w >> e) || k != key ) continue;
+    wgtmax = w;
+    enumax = e;
+    found  = true;   // keep the last one
+  }
+  return found;
+}
+//___________________________________________________________________________
+void GNuMIFlux::WriteMaxWgtCache(double wgtmax, double enumax)
+{
+  if ( fMaxWgtCacheFile == "" ) return;
+
+  // a single short line per append, so concurrent jobs don't interleave
+  std::ostringstream line;
+  line << this->MaxWgtCacheKey() << " " << std::setprecision(17)
+       << wgtmax << " " << enumax << "\n";
+
+  std::ofstream cache(fMaxWgtCacheFile.c_str(), std::ios::app);
+  cache << line.str() << std::flush;
+  if ( ! cache ) {
+    LOG("Flux", pWARN)
+      << "Could not write the max weight to " << fMaxWgtCacheFile;
+  } else {
+    LOG("Flux", pNOTICE)
+      << "Saved the max weight scan results to " << fMaxWgtCacheFile;
+  }
+}
+//___________________________________________________________________________
 void GNuMIFlux::SetMaxEnergy(double Ev)
 {
   fMaxEv = TMath::Max(0.,Ev);
@@ -1056,6 +1230,7 @@ void GNuMIFlux::Initialize(void)
   fMaxWeight       = -1;
   fMaxWgtFudge     =  1.05;
   fMaxWgtEntries   = 2500000;
+  fMaxWgtCacheFile = "";
   fMaxEFudge       =  0;
 
   fSumWeight       =  0;
@@ -2044,6 +2219,182 @@ int GNuMIFluxPassThroughInfo::CalcEnuWgt(const TLorentzVector& xyz,
 
   return 0;
 }
+//___________________________________________________________________________
+void GNuMIFluxDecayBlock::Clear(void)
+{
+  std::vector<double> * cols[] = {
+    &fVx, &fVy, &fVz, &fPx, &fPy, &fPz, &fGamma, &fBeta, &fEnuZr,
+    &fMuBx, &fMuBy, &fMuBz, &fMuSx, &fMuSy, &fMuSz, &fMuB };
+  for (size_t i = 0; i < sizeof(cols)/sizeof(cols[0]); ++i) cols[i]->clear();
+}
+//___________________________________________________________________________
+void GNuMIFluxDecayBlock::Add(const GNuMIFluxPassThroughInfo & info)
+{
+  // same hard-coded masses as GNuMIFluxPassThroughInfo::CalcEnuWgt()
+  const double kPIMASS    = 0.13957;
+  const double kKMASS     = 0.49368;
+  const double kK0MASS    = 0.49767;
+  const double kMUMASS    = 0.105658389;
+  const double kOMEGAMASS = 1.67245;
+
+  double parent_mass = 0;
+  switch ( info.ptype ) {
+  case  211: case  -211:             parent_mass = kPIMASS;    break;
+  case  321: case  -321:             parent_mass = kKMASS;     break;
+  case  130: case   310: case  311:  parent_mass = kK0MASS;    break;
+  case   13: case   -13:             parent_mass = kMUMASS;    break;
+  case 3334: case -3334:             parent_mass = kOMEGAMASS; break;
+  default:
+    LOG("Flux",pFATAL) << "NU_REWGT unknown particle type " << info.ptype;
+    assert(0);
+  }
+
+  double parentp2 = ( info.pdpx*info.pdpx +
+                      info.pdpy*info.pdpy +
+                      info.pdpz*info.pdpz );
+  double parent_energy = TMath::Sqrt( parentp2 + parent_mass*parent_mass );
+  double parentp       = TMath::Sqrt( parentp2 );
+  double gamma         = parent_energy / parent_mass;
+  double gamma_sqr     = gamma * gamma;
+  double beta_mag      = TMath::Sqrt( ( gamma_sqr - 1.0 )/gamma_sqr );
+
+  fVx.push_back(info.vx);
+  fVy.push_back(info.vy);
+  fVz.push_back(info.vz);
+  // a parent at rest has gamma = 1, beta = 0: no boost correction
+  double pinv = ( parentp > 0. ) ? 1.0 / parentp : 0.;
+  fPx.push_back(info.pdpx * pinv);
+  fPy.push_back(info.pdpy * pinv);
+  fPz.push_back(info.pdpz * pinv);
+  fGamma.push_back(gamma);
+  fBeta.push_back(beta_mag);
+  fEnuZr.push_back(info.necm);
+
+  // polarized muon decay: the (anti)spin direction in the muon production
+  // CM and the coefficient of the weight ratio depend only on the parent
+  double bx = 0, by = 0, bz = 0, sx = 0, sy = 0, sz = 0, b = 0;
+  if ( info.ptype == 13 || info.ptype == -13 ) {
+    bx = info.pdpx / parent_energy;
+    by = info.pdpy / parent_energy;
+    bz = info.pdpz / parent_energy;
+
+    double particle_energy = info.ppenergy;
+    double gammamp = particle_energy / parent_mass;
+    double betamp[3] = { info.ppdxdz * info.pppz / particle_energy,
+                         info.ppdydz * info.pppz / particle_energy,
+                                       info.pppz / particle_energy };
+    double partial = gammamp * ( betamp[0]*info.muparpx +
+                                 betamp[1]*info.muparpy +
+                                 betamp[2]*info.muparpz );
+    partial = info.mupare - partial/(gammamp+1.0);
+    double p_pcm_mp[3] = { info.muparpx - betamp[0]*gammamp*partial,
+                           info.muparpy - betamp[1]*gammamp*partial,
+                           info.muparpz - betamp[2]*gammamp*partial };
+    double p_pcm = TMath::Sqrt( p_pcm_mp[0]*p_pcm_mp[0] +
+                                p_pcm_mp[1]*p_pcm_mp[1] +
+                                p_pcm_mp[2]*p_pcm_mp[2] );
+    const double eps = 1.0e-30;
+    if ( p_pcm >= eps ) {
+      sx = p_pcm_mp[0] / p_pcm;
+      sy = p_pcm_mp[1] / p_pcm;
+      sz = p_pcm_mp[2] / p_pcm;
+      switch ( info.ntype ) {
+      case  12: case -12:
+        b = 1.0;
+        break;
+      case  14: case -14:
+      {
+        double xnu = 2.0 * info.necm / kMUMASS;
+        b = (1.0-2.0*xnu) / (3.0-2.0*xnu);
+        break;
+      }
+      default:
+        break;   // bad neutrino type: no correction
+      }
+    }
+    // else mu missing parent info: no correction
+  }
+  fMuBx.push_back(bx);
+  fMuBy.push_back(by);
+  fMuBz.push_back(bz);
+  fMuSx.push_back(sx);
+  fMuSy.push_back(sy);
+  fMuSz.push_back(sz);
+  fMuB.push_back(b);
+}
+//___________________________________________________________________________
+void GNuMIFluxDecayBlock::CalcEnuWgt(int n, const int * iparent, int ifirst,
+                     const double * x, const double * y, const double * z,
+                     double * enu, double * wgt_xy) const
+{
+// Same calculation as GNuMIFluxPassThroughInfo::CalcEnuWgt(), see there.
+// The loop over the points is kept free of branches (the iparent test is
+// loop invariant) and writes to local buffers, which can not alias the
+// inputs, so that the compiler can vectorize it for consecutive parents
+// (with gcc, this needs -fno-math-errno -fno-trapping-math).
+
+  const double kRDET2 = 100.0*100.0;   // flux per 100 cm radius
+  const double eps    = 1.0e-30;
+  const int    kPiece = 64;
+
+  const double * vx = &fVx[0];  const double * vy = &fVy[0];  const double * vz = &fVz[0];
+  const double * ux = &fPx[0];  const double * uy = &fPy[0];  const double * uz = &fPz[0];
+  const double * gm = &fGamma[0];
+  const double * bt = &fBeta[0];
+  const double * e0 = &fEnuZr[0];
+  const double * bx = &fMuBx[0]; const double * by = &fMuBy[0]; const double * bz = &fMuBz[0];
+  const double * sx = &fMuSx[0]; const double * sy = &fMuSy[0]; const double * sz = &fMuSz[0];
+  const double * mb = &fMuB[0];
+
+  double ebuf[kPiece], wbuf[kPiece];
+
+  for (int k0 = 0; k0 < n; k0 += kPiece) {
+    const int m = std::min(kPiece, n - k0);
+    for (int i = 0; i < m; ++i) {
+      const int k = k0 + i;
+      const int j = ( iparent ) ? iparent[k] : ifirst + k;
+
+      double dx   = x[k] - vx[j];
+      double dy   = y[k] - vy[j];
+      double dz   = z[k] - vz[j];
+      double rad2 = dx*dx + dy*dy + dz*dz;
+      double rad  = std::sqrt(rad2);
+
+      // boost from the parent rest frame
+      double costh = ( ux[j]*dx + uy[j]*dy + uz[j]*dz ) / rad;
+      costh = std::min(1.0, std::max(-1.0, costh));
+      double emrat = 1.0 / ( gm[j] * ( 1.0 - bt[j] * costh ) );
+      double e     = emrat * e0[j];
+
+      // solid angle/4pi of the detector element:
+      // (1 - cos(atan(R/rad)))/2 = R^2 / (2 s (s + rad)), s = sqrt(rad^2+R^2)
+      double s    = std::sqrt(rad2 + kRDET2);
+      double sang = 0.5 * kRDET2 / ( s * ( s + rad ) );
+      double w    = sang * ( emrat * emrat );
+
+      // polarized muon decay: nu direction in the mu decay CM w.r.t. (anti)spin
+      double f       = e / rad;
+      double pnx     = dx * f, pny = dy * f, pnz = dz * f;
+      double partial = gm[j] * ( bx[j]*pnx + by[j]*pny + bz[j]*pnz );
+      partial        = e - partial / ( gm[j] + 1.0 );
+      double gp      = gm[j] * partial;
+      double pdx     = pnx - bx[j]*gp;
+      double pdy     = pny - by[j]*gp;
+      double pdz     = pnz - bz[j]*gp;
+      double pd      = std::sqrt( pdx*pdx + pdy*pdy + pdz*pdz );
+      double costhmu = ( pdx*sx[j] + pdy*sy[j] + pdz*sz[j] ) / pd;
+      costhmu = std::min(1.0, std::max(-1.0, costhmu));
+      double b     = mb[j] * ( ( pd < eps ) ? 0. : 1. );
+      double c     = ( b == 0. ) ? 0. : costhmu;
+      double ratio = 1.0 - b * c;
+
+      ebuf[i] = e;
+      wbuf[i] = w * ratio;
+    }
+    std::copy(ebuf, ebuf + m, enu    + k0);
+    std::copy(wbuf, wbuf + m, wgt_xy + k0);
+  }
+}
 
 //___________________________________________________________________________
 
@@ -2629,6 +2980,11 @@ void GNuMIFluxXMLHelper::ParseParamSet(xmlDocPtr& xml_doc, xmlNodePtr& xml_pset)
       fGNuMI->SetUpstreamZ(z0usr);
       SLOG("GNuMIFlux", pINFO) << "set upstreamz = " << z0usr;
 
+    } else if ( pname == "maxwgtcache" ) {
+      string fname = gSystem->ExpandPathName(pval.c_str());
+      fGNuMI->SetMaxWgtCache(fname);
+      SLOG("GNuMIFlux", pINFO) << "set max weight cache file = " << fname;
+
     } else if ( pname == "reuse" ) {
       long int nreuse = 1;
       std::vector<long int> v = GetIntVector(pval);
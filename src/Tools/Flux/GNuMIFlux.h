@@ -210,6 +210,42 @@ public:
 ClassDef(GNuMIFluxPassThroughInfo,5)
 };
 
+/// GNuMIFluxDecayBlock:
+/// ==========
+/// The decay kinematics of a block of neutrino parents, as plain arrays,
+/// for computing GNuMIFluxPassThroughInfo::CalcEnuWgt() for many (parent,
+/// point) pairs at once. All that depends only on the parent is computed
+/// once in Add(), and the loop over the points is free of branches so that
+/// the compiler can vectorize it. The solid angle is computed in a form
+/// without the cancellation of 1-cos(atan(R/d)), so the results agree with
+/// CalcEnuWgt() to rounding, or better than it far from the decay.
+///
+class GNuMIFluxDecayBlock {
+public:
+  GNuMIFluxDecayBlock() { }
+
+  void   Clear (void);
+  int    Size  (void) const { return fVx.size(); }
+  /// append a parent (particle codes must have been converted to PDG)
+  void   Add   (const GNuMIFluxPassThroughInfo & info);
+
+  /// energy & weight at point k (beam coord, cm) of the neutrino from parent
+  /// iparent[k] (or parent ifirst+k if iparent is null), for k < n
+  void   CalcEnuWgt(int n, const int * iparent, int ifirst,
+                    const double * x, const double * y, const double * z,
+                    double * enu, double * wgt_xy) const;
+
+private:
+
+  std::vector<double> fVx, fVy, fVz;         ///< decay vertex
+  std::vector<double> fPx, fPy, fPz;         ///< parent momentum at decay / |p| (0 if at rest)
+  std::vector<double> fGamma, fBeta;         ///< parent boost
+  std::vector<double> fEnuZr;                ///< nu energy in the parent rest frame
+  std::vector<double> fMuBx, fMuBy, fMuBz;   ///< muon parent: beta at decay
+  std::vector<double> fMuSx, fMuSy, fMuSz;   ///< muon parent: unit (anti)spin direction in the mu production CM
+  std::vector<double> fMuB;                  ///< muon parent: wgt ratio = 1 - B*costh (0: no correction)
+};
+
 /// GNuMIFlux:
 /// ==========
 /// An implementation of the GFluxI interface that provides NuMI flux
@@ -299,6 +335,8 @@ public :
             { fMaxWgtFudge = fudge; fMaxWgtEntries = nentries; }
   void      SetMaxEFudge(double fudge = 1.05)                     ///< extra fudge factor in estimating maximum energy
             { fMaxEFudge = fudge; }
+  void      SetMaxWgtCache(string fname)                          ///< file caching the max weight scan results (none if "")
+            { fMaxWgtCacheFile = fname; }
   void      SetApplyWindowTiltWeight(bool apply = true)           ///< apply wgt due to tilt of flux window relative to beam
             { fApplyTiltWeight = apply; }
 
@@ -378,6 +416,10 @@ private:
   void ResetCurrent          (void);
   void AddFile               (TTree* tree, string fname);
   void CalcEffPOTsPerNu      (void);
+  void ScanEntries           (long int nentries, double& wgtmax, double& enumax);
+  string MaxWgtCacheKey      (void);
+  bool ReadMaxWgtCache       (double& wgtmax, double& enumax);
+  void WriteMaxWgtCache      (double wgtmax, double enumax);
   
   // Private data members
   //
@@ -402,6 +444,7 @@ private:
   double    fMaxWgtFudge;         ///< fudge factor for estimating max wgt
   long int  fMaxWgtEntries;       ///< # of entries in estimating max wgt
   double    fMaxEFudge;           ///< fudge factor for estmating max enu (0=> use fixed 120GeV)
+  string    fMaxWgtCacheFile;     ///< file caching the max weight scan results
 
   long int  fNUse;                ///< how often to use same entry in a row
   long int  fIUse;                ///< current # of times an entry has been used
@@ -432,6 +475,7 @@ private:
   TVector3         fWindowNormal;   ///< normal direction for flux window
 
   TLorentzVector   fgX4dkvtx;       ///< decay 4-position beam coord
+  GNuMIFluxDecayBlock fCurDecay;    //! decay kinematics of the current entry
 
   GNuMIFluxPassThroughInfo* fCurEntry;  ///< copy of current ntuple entry info (owned structure)
 
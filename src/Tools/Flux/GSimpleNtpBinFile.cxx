@@ -0,0 +1,478 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+
+ For the class documentation see the corresponding header file.
+*/
+//____________________________________________________________________________
+
+#include <cstring>
+#include <fstream>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Tools/Flux/GSimpleNtpBinFile.h"
+
+using namespace genie;
+using namespace genie::flux;
+
+namespace {
+
+  const char kMagic[8] = { 'G','S','N','T','P','B','I','N' };
+
+  enum { kHasNuMI = 1, kHasAux = 2 };
+
+  struct BinHeader {
+    char      fMagic[8];
+    UInt_t    fVersion;
+    UInt_t    fFlags;
+    ULong64_t fNEntries;
+    ULong64_t fNMeta;
+    ULong64_t fOffset[4];   ///< entry, numi, aux, meta sections
+  };
+
+  inline ULong64_t Pad8(ULong64_t nbytes) { return (nbytes + 7) & ~7ULL; }
+
+  // serialization of the meta records
+
+  template<class T> void Put(vector<char> & blob, const T & value)
+  {
+    const char * p = reinterpret_cast<const char *>(&value);
+    blob.insert(blob.end(), p, p + sizeof(T));
+  }
+  void PutString(vector<char> & blob, const std::string & s)
+  {
+    Put(blob, (UInt_t) s.size());
+    blob.insert(blob.end(), s.begin(), s.end());
+  }
+  void PutStrings(vector<char> & blob, const vector<std::string> & vs)
+  {
+    Put(blob, (UInt_t) vs.size());
+    for (size_t i = 0; i < vs.size(); ++i) PutString(blob, vs[i]);
+  }
+
+  template<class T> bool Get(const char *& p, const char * end, T & value)
+  {
+    if ( p + sizeof(T) > end ) return false;
+    memcpy(&value, p, sizeof(T));
+    p += sizeof(T);
+    return true;
+  }
+  bool GetString(const char *& p, const char * end, std::string & s)
+  {
+    UInt_t n = 0;
+    if ( ! Get(p, end, n) || p + n > end ) return false;
+    s.assign(p, n);
+    p += n;
+    return true;
+  }
+  bool GetStrings(const char *& p, const char * end, vector<std::string> & vs)
+  {
+    UInt_t n = 0;
+    if ( ! Get(p, end, n) ) return false;
+    vs.resize(n);
+    for (UInt_t i = 0; i < n; ++i) if ( ! GetString(p, end, vs[i]) ) return false;
+    return true;
+  }
+
+  void PutMeta(vector<char> & blob, const GSimpleNtpMeta & meta)
+  {
+    Put(blob, meta.seed);
+    Put(blob, meta.metakey);
+    Put(blob, meta.maxEnergy);
+    Put(blob, meta.minWgt);
+    Put(blob, meta.maxWgt);
+    Put(blob, meta.protons);
+    for (int i = 0; i < 3; ++i) Put(blob, meta.windowBase[i]);
+    for (int i = 0; i < 3; ++i) Put(blob, meta.windowDir1[i]);
+    for (int i = 0; i < 3; ++i) Put(blob, meta.windowDir2[i]);
+    Put(blob, (UInt_t) meta.pdglist.size());
+    for (size_t i = 0; i < meta.pdglist.size(); ++i) Put(blob, meta.pdglist[i]);
+    PutStrings(blob, meta.auxintname);
+    PutStrings(blob, meta.auxdblname);
+    PutStrings(blob, meta.infiles);
+  }
+  bool GetMeta(const char *& p, const char * end, GSimpleNtpMeta & meta)
+  {
+    bool ok = Get(p, end, meta.seed) && Get(p, end, meta.metakey) &&
+              Get(p, end, meta.maxEnergy) && Get(p, end, meta.minWgt) &&
+              Get(p, end, meta.maxWgt) && Get(p, end, meta.protons);
+    for (int i = 0; i < 3 && ok; ++i) ok = Get(p, end, meta.windowBase[i]);
+    for (int i = 0; i < 3 && ok; ++i) ok = Get(p, end, meta.windowDir1[i]);
+    for (int i = 0; i < 3 && ok; ++i) ok = Get(p, end, meta.windowDir2[i]);
+    UInt_t npdg = 0;
+    if ( ! ok || ! Get(p, end, npdg) ) return false;
+    meta.pdglist.resize(npdg);
+    for (UInt_t i = 0; i < npdg && ok; ++i) ok = Get(p, end, meta.pdglist[i]);
+    return ok && GetStrings(p, end, meta.auxintname) &&
+                 GetStrings(p, end, meta.auxdblname) &&
+                 GetStrings(p, end, meta.infiles);
+  }
+
+  template<class T> void WriteColumn(std::ofstream & out, const vector<T> & col)
+  {
+    ULong64_t nbytes = col.size() * sizeof(T);
+    if ( nbytes > 0 ) out.write(reinterpret_cast<const char *>(&col[0]), nbytes);
+    static const char zeros[8] = { 0 };
+    out.write(zeros, Pad8(nbytes) - nbytes);
+  }
+
+} // anonymous namespace
+
+//____________________________________________________________________________
+GSimpleNtpBinFile::GSimpleNtpBinFile() :
+fData     (0),
+fSize     (0),
+fMapped   (false),
+fNEntries (0)
+{
+  this->Close();
+}
+//____________________________________________________________________________
+GSimpleNtpBinFile::~GSimpleNtpBinFile()
+{
+  this->Close();
+}
+//____________________________________________________________________________
+bool GSimpleNtpBinFile::Open(string filename, bool use_mmap)
+{
+  this->Close();
+  fFileName = filename;
+
+  int fd = open(filename.c_str(), O_RDONLY);
+  struct stat st;
+  if ( fd < 0 || fstat(fd, &st) != 0 ) {
+    LOG("Flux", pERROR) << "Can not open binary flux file: " << filename;
+    if ( fd >= 0 ) close(fd);
+    return false;
+  }
+  fSize = st.st_size;
+
+  if ( use_mmap && fSize > 0 ) {
+    void * addr = mmap(0, fSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    if ( addr != MAP_FAILED ) {
+      fData   = static_cast<char *>(addr);
+      fMapped = true;
+      madvise(addr, fSize, MADV_SEQUENTIAL);
+    } else {
+      LOG("Flux", pWARN)
+        << "Can not map " << filename << " in memory; reading it instead";
+    }
+  }
+  if ( ! fMapped ) {
+    fBuffer.resize((fSize + 7) / 8 + 1);
+    fData = reinterpret_cast<char *>(&fBuffer[0]);
+    ULong64_t nread = 0;
+    while ( nread < fSize ) {
+      ssize_t n = read(fd, fData + nread, fSize - nread);
+      if ( n <= 0 ) break;
+      nread += n;
+    }
+    if ( nread != fSize ) {
+      LOG("Flux", pERROR) << "Failed to read binary flux file: " << filename;
+      close(fd);
+      this->Close();
+      return false;
+    }
+  }
+  close(fd);
+
+  if ( ! this->MapSections() ) {
+    LOG("Flux", pERROR) << "Not a valid binary flux file: " << filename;
+    this->Close();
+    return false;
+  }
+
+  LOG("Flux", pINFO)
+    << "Opened binary flux file " << filename << " with " << fNEntries
+    << " entries, " << fMeta.size() << " meta records"
+    << (this->HasNuMI() ? " [+numi]" : "") << (this->HasAux() ? " [+aux]" : "")
+    << (fMapped ? " (memory mapped)" : "");
+  return true;
+}
+//____________________________________________________________________________
+void GSimpleNtpBinFile::Close(void)
+{
+  if ( fMapped && fData ) munmap(fData, fSize);
+  fData     = 0;
+  fSize     = 0;
+  fMapped   = false;
+  fNEntries = 0;
+  fBuffer.clear();
+  fMeta.clear();
+
+  for (int i = 0; i <  9; ++i) fEntryD[i] = 0;
+  for (int i = 0; i < 12; ++i) fNuMID[i]  = 0;
+  for (int i = 0; i <  7; ++i) fNuMII[i]  = 0;
+  fPdg       = 0;
+  fMetaKey   = 0;
+  fAuxIntIdx = 0;
+  fAuxDblIdx = 0;
+  fAuxInt    = 0;
+  fAuxDbl    = 0;
+}
+//____________________________________________________________________________
+bool GSimpleNtpBinFile::MapSections(void)
+{
+// Validate the header and set the column pointers
+
+  BinHeader hdr;
+  if ( fSize < sizeof(BinHeader) ) return false;
+  memcpy(&hdr, fData, sizeof(BinHeader));
+  if ( memcmp(hdr.fMagic, kMagic, 8) != 0 ) return false;
+  if ( hdr.fVersion != kVersion ) {
+    LOG("Flux", pERROR) << "Unsupported binary flux file version " << hdr.fVersion;
+    return false;
+  }
+
+  ULong64_t n   = hdr.fNEntries;
+  ULong64_t ndb = n * sizeof(Double_t);
+  ULong64_t nib = Pad8(n * sizeof(Int_t));
+
+  // entry section
+  ULong64_t ofs = hdr.fOffset[0];
+  if ( ofs % 8 != 0 || ofs + 9*ndb + 2*nib > fSize ) return false;
+  for (int i = 0; i < 9; ++i, ofs += ndb) {
+    fEntryD[i] = reinterpret_cast<const Double_t *>(fData + ofs);
+  }
+  fPdg     = reinterpret_cast<const Int_t *> (fData + ofs); ofs += nib;
+  fMetaKey = reinterpret_cast<const UInt_t *>(fData + ofs);
+
+  // numi section
+  if ( hdr.fFlags & kHasNuMI ) {
+    ofs = hdr.fOffset[1];
+    if ( ofs % 8 != 0 || ofs + 12*ndb + 7*nib > fSize ) return false;
+    for (int i = 0; i < 12; ++i, ofs += ndb) {
+      fNuMID[i] = reinterpret_cast<const Double_t *>(fData + ofs);
+    }
+    for (int i = 0; i <  7; ++i, ofs += nib) {
+      fNuMII[i] = reinterpret_cast<const Int_t *>(fData + ofs);
+    }
+  }
+
+  // aux section
+  if ( hdr.fFlags & kHasAux ) {
+    ofs = hdr.fOffset[2];
+    ULong64_t nidx = (n + 1) * sizeof(ULong64_t);
+    if ( ofs % 8 != 0 || ofs + 2*nidx > fSize ) return false;
+    fAuxIntIdx = reinterpret_cast<const ULong64_t *>(fData + ofs); ofs += nidx;
+    fAuxDblIdx = reinterpret_cast<const ULong64_t *>(fData + ofs); ofs += nidx;
+    ULong64_t nint = fAuxIntIdx[n];
+    ULong64_t ndbl = fAuxDblIdx[n];
+    if ( ofs + Pad8(nint*sizeof(Int_t)) + ndbl*sizeof(Double_t) > fSize ) {
+      return false;
+    }
+    fAuxInt = reinterpret_cast<const Int_t *>(fData + ofs);
+    ofs += Pad8(nint*sizeof(Int_t));
+    fAuxDbl = reinterpret_cast<const Double_t *>(fData + ofs);
+  }
+
+  // meta section
+  ofs = hdr.fOffset[3];
+  if ( ofs > fSize ) return false;
+  const char * p   = fData + ofs;
+  const char * end = fData + fSize;
+  fMeta.resize(hdr.fNMeta);
+  for (ULong64_t imeta = 0; imeta < hdr.fNMeta; ++imeta) {
+    if ( ! GetMeta(p, end, fMeta[imeta]) ) return false;
+  }
+
+  fNEntries = n;
+  return true;
+}
+//____________________________________________________________________________
+Int_t GSimpleNtpBinFile::GetEntry(Long64_t ientry, GSimpleNtpEntry * entry,
+                         GSimpleNtpNuMI * numi, GSimpleNtpAux * aux) const
+{
+  if ( ientry < 0 || ientry >= fNEntries ) return 0;
+
+  Int_t nbytes = 9*sizeof(Double_t) + 2*sizeof(Int_t);
+
+  if ( entry ) {
+    entry->wgt     = fEntryD[0][ientry];
+    entry->vtxx    = fEntryD[1][ientry];
+    entry->vtxy    = fEntryD[2][ientry];
+    entry->vtxz    = fEntryD[3][ientry];
+    entry->dist    = fEntryD[4][ientry];
+    entry->px      = fEntryD[5][ientry];
+    entry->py      = fEntryD[6][ientry];
+    entry->pz      = fEntryD[7][ientry];
+    entry->E       = fEntryD[8][ientry];
+    entry->pdg     = fPdg[ientry];
+    entry->metakey = fMetaKey[ientry];
+  }
+
+  if ( numi && this->HasNuMI() ) {
+    numi->tpx      = fNuMID[ 0][ientry];
+    numi->tpy      = fNuMID[ 1][ientry];
+    numi->tpz      = fNuMID[ 2][ientry];
+    numi->vx       = fNuMID[ 3][ientry];
+    numi->vy       = fNuMID[ 4][ientry];
+    numi->vz       = fNuMID[ 5][ientry];
+    numi->pdpx     = fNuMID[ 6][ientry];
+    numi->pdpy     = fNuMID[ 7][ientry];
+    numi->pdpz     = fNuMID[ 8][ientry];
+    numi->pppx     = fNuMID[ 9][ientry];
+    numi->pppy     = fNuMID[10][ientry];
+    numi->pppz     = fNuMID[11][ientry];
+    numi->ndecay   = fNuMII[ 0][ientry];
+    numi->ptype    = fNuMII[ 1][ientry];
+    numi->ppmedium = fNuMII[ 2][ientry];
+    numi->tptype   = fNuMII[ 3][ientry];
+    numi->run      = fNuMII[ 4][ientry];
+    numi->evtno    = fNuMII[ 5][ientry];
+    numi->entryno  = fNuMII[ 6][ientry];
+    nbytes += 12*sizeof(Double_t) + 7*sizeof(Int_t);
+  }
+
+  if ( aux && this->HasAux() ) {
+    aux->auxint.assign(fAuxInt + fAuxIntIdx[ientry],
+                       fAuxInt + fAuxIntIdx[ientry+1]);
+    aux->auxdbl.assign(fAuxDbl + fAuxDblIdx[ientry],
+                       fAuxDbl + fAuxDblIdx[ientry+1]);
+    nbytes += aux->auxint.size()*sizeof(Int_t) +
+              aux->auxdbl.size()*sizeof(Double_t);
+  }
+
+  return nbytes;
+}
+//____________________________________________________________________________
+GSimpleNtpBinWriter::GSimpleNtpBinWriter(string filename, bool numi, bool aux) :
+fFileName (filename),
+fNuMI     (numi),
+fAux      (aux),
+fClosed   (false),
+fNMeta    (0)
+{
+  if ( fAux ) {
+    fAuxIntIdx.push_back(0);
+    fAuxDblIdx.push_back(0);
+  }
+}
+//____________________________________________________________________________
+GSimpleNtpBinWriter::~GSimpleNtpBinWriter()
+{
+  if ( ! fClosed ) this->Close();
+}
+//____________________________________________________________________________
+void GSimpleNtpBinWriter::Fill(const GSimpleNtpEntry & entry,
+                     const GSimpleNtpNuMI * numi, const GSimpleNtpAux * aux)
+{
+  fEntryD[0].push_back(entry.wgt);
+  fEntryD[1].push_back(entry.vtxx);
+  fEntryD[2].push_back(entry.vtxy);
+  fEntryD[3].push_back(entry.vtxz);
+  fEntryD[4].push_back(entry.dist);
+  fEntryD[5].push_back(entry.px);
+  fEntryD[6].push_back(entry.py);
+  fEntryD[7].push_back(entry.pz);
+  fEntryD[8].push_back(entry.E);
+  fPdg.push_back(entry.pdg);
+  fMetaKey.push_back(entry.metakey);
+
+  if ( fNuMI ) {
+    GSimpleNtpNuMI blank;
+    const GSimpleNtpNuMI & n = (numi) ? *numi : blank;
+    fNuMID[ 0].push_back(n.tpx);
+    fNuMID[ 1].push_back(n.tpy);
+    fNuMID[ 2].push_back(n.tpz);
+    fNuMID[ 3].push_back(n.vx);
+    fNuMID[ 4].push_back(n.vy);
+    fNuMID[ 5].push_back(n.vz);
+    fNuMID[ 6].push_back(n.pdpx);
+    fNuMID[ 7].push_back(n.pdpy);
+    fNuMID[ 8].push_back(n.pdpz);
+    fNuMID[ 9].push_back(n.pppx);
+    fNuMID[10].push_back(n.pppy);
+    fNuMID[11].push_back(n.pppz);
+    fNuMII[ 0].push_back(n.ndecay);
+    fNuMII[ 1].push_back(n.ptype);
+    fNuMII[ 2].push_back(n.ppmedium);
+    fNuMII[ 3].push_back(n.tptype);
+    fNuMII[ 4].push_back(n.run);
+    fNuMII[ 5].push_back(n.evtno);
+    fNuMII[ 6].push_back(n.entryno);
+  }
+
+  if ( fAux ) {
+    if ( aux ) {
+      fAuxInt.insert(fAuxInt.end(), aux->auxint.begin(), aux->auxint.end());
+      fAuxDbl.insert(fAuxDbl.end(), aux->auxdbl.begin(), aux->auxdbl.end());
+    }
+    fAuxIntIdx.push_back(fAuxInt.size());
+    fAuxDblIdx.push_back(fAuxDbl.size());
+  }
+}
+//____________________________________________________________________________
+void GSimpleNtpBinWriter::AddMeta(const GSimpleNtpMeta & meta)
+{
+  PutMeta(fMetaBlob, meta);
+  fNMeta++;
+}
+//____________________________________________________________________________
+bool GSimpleNtpBinWriter::Close(void)
+{
+  fClosed = true;
+
+  ULong64_t n   = fPdg.size();
+  ULong64_t ndb = n * sizeof(Double_t);
+  ULong64_t nib = Pad8(n * sizeof(Int_t));
+
+  BinHeader hdr;
+  memset(&hdr, 0, sizeof(BinHeader));
+  memcpy(hdr.fMagic, kMagic, 8);
+  hdr.fVersion  = GSimpleNtpBinFile::kVersion;
+  hdr.fFlags    = (fNuMI ? kHasNuMI : 0) | (fAux ? kHasAux : 0);
+  hdr.fNEntries = n;
+  hdr.fNMeta    = fNMeta;
+
+  ULong64_t ofs = Pad8(sizeof(BinHeader));
+  hdr.fOffset[0] = ofs;  ofs += 9*ndb + 2*nib;
+  hdr.fOffset[1] = ofs;  if ( fNuMI ) ofs += 12*ndb + 7*nib;
+  hdr.fOffset[2] = ofs;
+  if ( fAux ) {
+    ofs += 2*(n+1)*sizeof(ULong64_t) +
+           Pad8(fAuxInt.size()*sizeof(Int_t)) + fAuxDbl.size()*sizeof(Double_t);
+  }
+  hdr.fOffset[3] = ofs;
+
+  std::ofstream out(fFileName.c_str(), std::ios::out | std::ios::binary);
+  if ( ! out ) {
+    LOG("Flux", pERROR) << "Can not create binary flux file: " << fFileName;
+    return false;
+  }
+  out.write(reinterpret_cast<const char *>(&hdr), sizeof(BinHeader));
+  static const char zeros[8] = { 0 };
+  out.write(zeros, Pad8(sizeof(BinHeader)) - sizeof(BinHeader));
+
+  for (int i = 0; i <  9; ++i) WriteColumn(out, fEntryD[i]);
+  WriteColumn(out, fPdg);
+  WriteColumn(out, fMetaKey);
+  if ( fNuMI ) {
+    for (int i = 0; i < 12; ++i) WriteColumn(out, fNuMID[i]);
+    for (int i = 0; i <  7; ++i) WriteColumn(out, fNuMII[i]);
+  }
+  if ( fAux ) {
+    WriteColumn(out, fAuxIntIdx);
+    WriteColumn(out, fAuxDblIdx);
+    WriteColumn(out, fAuxInt);
+    WriteColumn(out, fAuxDbl);
+  }
+  WriteColumn(out, fMetaBlob);
+  out.close();
+
+  bool ok = ! out.fail();
+  LOG("Flux", (ok ? pNOTICE : pERROR))
+    << "Wrote " << n << " entries and " << fNMeta << " meta records to "
+    << fFileName << (ok ? "" : " - FAILED");
+  return ok;
+}
+//____________________________________________________________________________
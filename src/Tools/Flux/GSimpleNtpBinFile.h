@@ -0,0 +1,138 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::flux::GSimpleNtpBinFile
+         genie::flux::GSimpleNtpBinWriter
+
+\brief   Reader and writer of a flat, columnar binary version of the
+         GSimpleNtpFlux ntuples ("gsimple" files), with the same content:
+         the "entry" records, the optional "numi" and "aux" records and the
+         "meta" records. The reader maps the file in memory (or reads it in
+         one go), so that an entry is read from a few plain arrays instead of
+         through the TTree decompression and object streaming.
+
+         File layout (native byte order, all sections 8 byte aligned):
+
+         header   : char magic[8] = "GSNTPBIN", UInt_t version, UInt_t flags
+                    (1: numi, 2: aux), ULong64_t nentries, ULong64_t nmeta,
+                    ULong64_t offsets of the entry, numi, aux, meta sections
+         entry    : Double_t columns wgt, vtxx, vtxy, vtxz, dist, px, py, pz,
+                    E, followed by the Int_t pdg and UInt_t metakey columns
+         numi     : Double_t columns tpx ... pppz, followed by the Int_t
+                    columns ndecay ... entryno (in the GSimpleNtpNuMI order)
+         aux      : ULong64_t index columns [nentries+1] of the first auxint
+                    and auxdbl value of each entry, followed by the Int_t
+                    auxint and Double_t auxdbl values of all entries
+         meta     : nmeta serialized GSimpleNtpMeta records (scalars, then
+                    the vectors as a count followed by the elements)
+
+         Use gsimple2bin.C (in Tools/Flux/GNuMINtuple) to convert a gsimple
+         ROOT file. GSimpleNtpFlux reads any file name ending in ".gsbin"
+         with GSimpleNtpBinFile.
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _GSIMPLE_NTP_BIN_FILE_H_
+#define _GSIMPLE_NTP_BIN_FILE_H_
+
+#include <string>
+#include <vector>
+
+#include <Rtypes.h>
+
+#include "Tools/Flux/GSimpleNtpFlux.h"
+
+using std::string;
+using std::vector;
+
+namespace genie {
+namespace flux  {
+
+class GSimpleNtpBinFile {
+
+public:
+  GSimpleNtpBinFile();
+ ~GSimpleNtpBinFile();
+
+  bool     Open      (string filename, bool use_mmap=true);
+  void     Close     (void);
+
+  string   FileName  (void) const { return fFileName;     }
+  Long64_t NEntries  (void) const { return fNEntries;     }
+  bool     HasNuMI   (void) const { return (fNuMID[0] != 0); }
+  bool     HasAux    (void) const { return (fAuxIntIdx != 0); }
+  int      NMeta     (void) const { return fMeta.size();  }
+
+  const GSimpleNtpMeta & Meta (int imeta) const { return fMeta[imeta]; }
+
+  /// fill the records of entry ientry, return the number of bytes read
+  /// (0 for an entry outside the file); numi and aux may be null
+  Int_t    GetEntry  (Long64_t ientry, GSimpleNtpEntry * entry,
+                      GSimpleNtpNuMI * numi, GSimpleNtpAux * aux) const;
+
+  static const UInt_t kVersion = 1;
+
+private:
+  bool MapSections (void);
+
+  string                 fFileName;
+  char *                 fData;        ///< file contents (mapped or read)
+  ULong64_t              fSize;        ///< file size (bytes)
+  bool                   fMapped;      ///< is fData mapped?
+  vector<Long64_t>       fBuffer;      ///< storage of fData when not mapped (8 byte aligned)
+  Long64_t               fNEntries;
+
+  const Double_t *       fEntryD[9];   ///< entry Double_t columns
+  const Int_t *          fPdg;
+  const UInt_t *         fMetaKey;
+  const Double_t *       fNuMID[12];   ///< numi Double_t columns
+  const Int_t *          fNuMII[7];    ///< numi Int_t columns
+  const ULong64_t *      fAuxIntIdx;
+  const ULong64_t *      fAuxDblIdx;
+  const Int_t *          fAuxInt;
+  const Double_t *       fAuxDbl;
+
+  vector<GSimpleNtpMeta> fMeta;
+};
+
+class GSimpleNtpBinWriter {
+
+public:
+  GSimpleNtpBinWriter(string filename, bool numi, bool aux);
+ ~GSimpleNtpBinWriter();
+
+  void Fill    (const GSimpleNtpEntry & entry,
+                const GSimpleNtpNuMI * numi=0, const GSimpleNtpAux * aux=0);
+  void AddMeta (const GSimpleNtpMeta & meta);
+  bool Close   (void);   ///< write the file (the entries are kept in memory until then)
+
+private:
+  string              fFileName;
+  bool                fNuMI;
+  bool                fAux;
+  bool                fClosed;
+  vector<Double_t>    fEntryD[9];
+  vector<Int_t>       fPdg;
+  vector<UInt_t>      fMetaKey;
+  vector<Double_t>    fNuMID[12];
+  vector<Int_t>       fNuMII[7];
+  vector<ULong64_t>   fAuxIntIdx;
+  vector<ULong64_t>   fAuxDblIdx;
+  vector<Int_t>       fAuxInt;
+  vector<Double_t>    fAuxDbl;
+  vector<char>        fMetaBlob;
+  ULong64_t           fNMeta;
+};
+
+} // flux namespace
+} // genie namespace
+
+#endif // _GSIMPLE_NTP_BIN_FILE_H_
@@ -14,9 +14,15 @@
 #include <cassert>
 #include <limits.h>
 #include <algorithm>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
+#include <TROOT.h>
 #include <TFile.h>
 #include <TChain.h>
+#include <TDirectory.h>
+#include <TVectorD.h>
 #include <TChainElement.h>
 #include <TSystem.h>
 #include <TStopwatch.h>
@@ -25,6 +31,7 @@
 #include "Framework/Conventions/GBuild.h"
 
 #include "Tools/Flux/GSimpleNtpFlux.h"
+#include "Tools/Flux/GSimpleNtpBinFile.h"
 
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
@@ -44,6 +51,7 @@ using std::endl;
 #include "TString.h"
 
 #include "Tools/Flux/GFluxDriverFactory.h"
+#include "Framework/Utils/StartupProfiler.h"
 FLUXDRIVERREG4(genie,flux,GSimpleNtpFlux,genie::flux::GSimpleNtpFlux)
 
 //#define __GENIE_LOW_LEVEL_MESG_ENABLED__
@@ -62,6 +70,174 @@ ClassImp(GSimpleNtpMeta)
 // static storage
 UInt_t genie::flux::GSimpleNtpMeta::mxfileprint = UINT_MAX;
 
+static const Long64_t kDefaultTreeCacheSize = 10000000; // bytes
+
+namespace genie {
+namespace flux  {
+//____________________________________________________________________________
+// Reads the "flux" chain entries ahead of their use in a background thread,
+// into a ring of buffers. Entries are read sequentially (wrapping around at
+// the end of the chain) starting from the requested one; a request for any
+// other entry restarts the read-ahead from it. The chain must not be read by
+// anyone else while the prefetcher exists: its branch addresses are set to
+// the prefetcher's own buffer objects.
+//
+class GSimpleNtpPrefetcher {
+public:
+  GSimpleNtpPrefetcher(TChain * chain, int nslots, bool numi, bool aux);
+ ~GSimpleNtpPrefetcher();
+
+  Int_t GetEntry(Long64_t ientry, GSimpleNtpEntry * entry,
+                 GSimpleNtpNuMI * numi, GSimpleNtpAux * aux);
+
+private:
+  struct Slot {
+    Long64_t        fIEntry;
+    Int_t           fNBytes;
+    GSimpleNtpEntry fEntry;
+    GSimpleNtpNuMI  fNuMI;
+    GSimpleNtpAux   fAux;
+  };
+
+  void Start (Long64_t ientry);
+  void Stop  (void);
+  void Run   (void);
+
+  TChain *                fChain;
+  Long64_t                fNEntries;
+  GSimpleNtpEntry *       fBufEntry;   ///< branch buffers, owned
+  GSimpleNtpNuMI *        fBufNuMI;
+  GSimpleNtpAux *         fBufAux;
+  std::vector<Slot>       fSlots;
+  Long64_t                fStartEntry; ///< entry of the first slot filled since Start()
+  Long64_t                fNRead;      ///< # of slots filled since Start()
+  Long64_t                fNUsed;      ///< # of slots consumed since Start()
+  bool                    fStop;
+  bool                    fRunning;
+  std::mutex              fMutex;
+  std::condition_variable fCondRead;   ///< signalled when a slot is filled
+  std::condition_variable fCondFree;   ///< signalled when a slot is consumed
+  std::thread             fThread;
+};
+//____________________________________________________________________________
+GSimpleNtpPrefetcher::GSimpleNtpPrefetcher(
+                           TChain * chain, int nslots, bool numi, bool aux) :
+fChain    (chain),
+fNEntries (chain->GetEntries()),
+fBufEntry (new GSimpleNtpEntry),
+fBufNuMI  (numi ? new GSimpleNtpNuMI : 0),
+fBufAux   (aux  ? new GSimpleNtpAux  : 0),
+fSlots    (std::max(nslots,1)),
+fStartEntry (0),
+fNRead    (0),
+fNUsed    (0),
+fStop     (false),
+fRunning  (false)
+{
+  ROOT::EnableThreadSafety();
+
+  fChain->SetBranchAddress("entry",&fBufEntry);
+  if ( fBufNuMI ) fChain->SetBranchAddress("numi",&fBufNuMI);
+  if ( fBufAux  ) fChain->SetBranchAddress("aux", &fBufAux);
+}
+//____________________________________________________________________________
+GSimpleNtpPrefetcher::~GSimpleNtpPrefetcher()
+{
+  this->Stop();
+
+  delete fBufEntry;
+  if ( fBufNuMI ) delete fBufNuMI;
+  if ( fBufAux  ) delete fBufAux;
+}
+//____________________________________________________________________________
+Int_t GSimpleNtpPrefetcher::GetEntry(Long64_t ientry,
+      GSimpleNtpEntry * entry, GSimpleNtpNuMI * numi, GSimpleNtpAux * aux)
+{
+  size_t nslots = fSlots.size();
+  std::unique_lock<std::mutex> lock(fMutex);
+
+  // the next slot to be consumed holds entry (fStartEntry+fNUsed) % fNEntries
+  if ( ! fRunning || (fStartEntry+fNUsed) % fNEntries != ientry ) {
+    lock.unlock();
+    this->Stop();
+    this->Start(ientry);
+    lock.lock();
+  }
+
+  fCondRead.wait(lock, [this]{ return fNRead > fNUsed; });
+
+  Slot & slot = fSlots[fNUsed % nslots];
+  Int_t nbytes = slot.fNBytes;
+  *entry = slot.fEntry;
+  if ( numi && fBufNuMI ) *numi = slot.fNuMI;
+  if ( aux  && fBufAux  ) *aux  = slot.fAux;
+  fNUsed++;
+
+  lock.unlock();
+  fCondFree.notify_one();
+
+  return nbytes;
+}
+//____________________________________________________________________________
+void GSimpleNtpPrefetcher::Start(Long64_t ientry)
+{
+  fStartEntry = ientry;
+  fNRead      = 0;
+  fNUsed      = 0;
+  fStop       = false;
+  fRunning    = true;
+  fThread     = std::thread(&GSimpleNtpPrefetcher::Run, this);
+}
+//____________________________________________________________________________
+void GSimpleNtpPrefetcher::Stop(void)
+{
+  if ( ! fRunning ) return;
+  {
+    std::lock_guard<std::mutex> lock(fMutex);
+    fStop = true;
+  }
+  fCondFree.notify_all();
+  fThread.join();
+  fRunning = false;
+}
+//____________________________________________________________________________
+void GSimpleNtpPrefetcher::Run(void)
+{
+  size_t nslots = fSlots.size();
+  Long64_t iread = 0;
+
+  while ( true ) {
+    {
+      std::unique_lock<std::mutex> lock(fMutex);
+      fCondFree.wait(lock,
+         [this,nslots]{ return fStop || fNRead - fNUsed < (Long64_t)nslots; });
+      if ( fStop ) return;
+      iread = fNRead;
+    }
+
+    // the slot being filled is not visible to the consumer until fNRead
+    // is incremented, so it is filled without holding the lock
+    Slot & slot = fSlots[iread % nslots];
+    slot.fIEntry = (fStartEntry + iread) % fNEntries;
+    if ( fBufEntry ) fBufEntry->Reset();
+    if ( fBufNuMI  ) fBufNuMI->Reset();
+    if ( fBufAux   ) fBufAux->Reset();
+    slot.fNBytes = fChain->GetEntry(slot.fIEntry);
+    slot.fEntry = *fBufEntry;
+    if ( fBufNuMI ) slot.fNuMI = *fBufNuMI;
+    if ( fBufAux  ) slot.fAux  = *fBufAux;
+
+    {
+      std::lock_guard<std::mutex> lock(fMutex);
+      fNRead++;
+    }
+    fCondRead.notify_one();
+  }
+}
+//____________________________________________________________________________
+} // flux namespace
+} // genie namespace
+
 //____________________________________________________________________________
 GSimpleNtpFlux::GSimpleNtpFlux() :
   GFluxExposureI(genie::flux::kPOTs)
@@ -193,7 +369,7 @@ bool GSimpleNtpFlux::GenerateNext_weighted(void)
       }
     }
 
-    int nbytes = fNuFluxTree->GetEntry(fIEntry);
+    int nbytes = this->ReadEntry(fIEntry);
     UInt_t metakey = fCurEntry->metakey;
     if ( fAllFilesMeta && ( fCurMeta->metakey != metakey ) ) {
       UInt_t oldkey = fCurMeta->metakey;
@@ -205,10 +381,10 @@ bool GSimpleNtpFlux::GenerateNext_weighted(void)
       // so find the right one by a simple linear search.
       // not a large burden since it only happens infrequently and
       // the list is normally quite short.
-      int nmeta = fNuMetaTree->GetEntries();
+      int nmeta = this->NMetaEntries();
       int nbmeta = 0;
       for (int imeta = 0; imeta < nmeta; ++imeta ) {
-        nbmeta = fNuMetaTree->GetEntry(imeta);
+        nbmeta = this->ReadMetaEntry(imeta);
         if ( fCurMeta->metakey == metakey ) break;
       }
       // next condition should never happen
@@ -228,7 +404,8 @@ bool GSimpleNtpFlux::GenerateNext_weighted(void)
 #endif
     }
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-    Int_t ifile = fNuFluxTree->GetFileNumber();
+    // the chain's current file belongs to the prefetcher's thread
+    Int_t ifile = (fPrefetcher) ? -1 : fNuFluxTree->GetFileNumber();
     LOG("Flux",pDEBUG)
       << "got " << fNNeutrinos << " nu, using fIEntry " << fIEntry
       << " ifile " << ifile << " nbytes " << nbytes
@@ -311,6 +488,69 @@ bool GSimpleNtpFlux::GenerateNext_weighted(void)
   return true;
 }
 //___________________________________________________________________________
+bool GSimpleNtpFlux::SaveState(TDirectory * dir) const
+{
+// Save the flux ntuple cursor and the POT / weight accumulators
+
+  if ( ! dir ) return false;
+  TDirectory * prevdir = gDirectory;
+  dir->cd();
+
+  TVectorD state(7);
+  state[0] = fIEntry;
+  state[1] = fIUse;
+  state[2] = fICycle;
+  state[3] = fSumWeight;
+  state[4] = fNNeutrinos;
+  state[5] = fNEntriesUsed;
+  state[6] = fAccumPOTs;
+  state.Write("gsimple_flux_state", TObject::kOverwrite);
+
+  prevdir->cd();
+  return true;
+}
+//___________________________________________________________________________
+bool GSimpleNtpFlux::RestoreState(TDirectory * dir)
+{
+  if ( ! dir || ! fNuFluxTree ) return false;
+
+  TVectorD * state = (TVectorD*) dir->Get("gsimple_flux_state");
+  if ( ! state ) {
+    LOG("Flux", pERROR) << "No saved GSimpleNtpFlux state found";
+    return false;
+  }
+  fIEntry       = (Long64_t) (*state)[0];
+  fIUse         = (long int) (*state)[1];
+  fICycle       = (long int) (*state)[2];
+  fSumWeight    =            (*state)[3];
+  fNNeutrinos   = (long int) (*state)[4];
+  fNEntriesUsed = (long int) (*state)[5];
+  fAccumPOTs    =            (*state)[6];
+  delete state;
+
+  fEnd = false;
+
+  // re-read the current entry (and its meta data), in case it is re-used
+  if ( fIEntry >= 0 && fIEntry < fNEntries ) {
+    this->ReadEntry(fIEntry);
+    if ( fAllFilesMeta && fCurMeta &&
+         fCurMeta->metakey != fCurEntry->metakey ) {
+      UInt_t metakey = fCurEntry->metakey;
+      int nmeta = this->NMetaEntries();
+      for (int imeta = 0; imeta < nmeta; ++imeta ) {
+        this->ReadMetaEntry(imeta);
+        if ( fCurMeta->metakey == metakey ) break;
+      }
+    }
+  }
+
+  LOG("Flux", pNOTICE)
+    << "Restored GSimpleNtpFlux state: entry " << fIEntry
+    << ", cycle " << fICycle << ", POTs used " << fAccumPOTs
+    << ", sum of weights " << fSumWeight;
+  return true;
+}
+//___________________________________________________________________________
 double GSimpleNtpFlux::GetDecayDist() const
 {
   // return distance (user units) between dk point and start position
@@ -375,6 +615,8 @@ void GSimpleNtpFlux::LoadBeamSimData(const std::vector<string>& patterns,
 {
 // Loads a beam simulation root file into the GSimpleNtpFlux driver.
 
+  StartupTimer timer("Flux loading");
+
   fNuFluxFilePatterns = patterns;
   std::vector<int> nfiles_from_pattern;
 
@@ -431,6 +673,12 @@ void GSimpleNtpFlux::LoadBeamSimData(const std::vector<string>& patterns,
     // if we want to stream via xrootd
     // ! (gSystem->AccessPathName(filename.c_str()));
     if ( ! isok ) continue;
+    // flat binary files are read without ROOT
+    if ( filename.size() > 6 &&
+         filename.compare(filename.size()-6,6,".gsbin") == 0 ) {
+      this->AddBinFile(filename, config.find("no-mmap") == string::npos);
+      continue;
+    }
     // open the file to see what it contains
     LOG("Flux", pINFO) << "Load file " <<  filename;
 
@@ -448,8 +696,18 @@ void GSimpleNtpFlux::LoadBeamSimData(const std::vector<string>& patterns,
     delete tf;
   } // loop over sorted file names
 
-  // this will open all files and read headers!!
-  fNEntries = fNuFluxTree->GetEntries();
+  if ( ! fBinFiles.empty() ) {
+    if ( fNuFluxTree->GetListOfFiles()->GetEntries() > 0 ) {
+      LOG("Flux", pFATAL)
+        << "Can not mix binary (.gsbin) and ROOT flux files";
+      gAbortingInErr = true;
+      exit(1);
+    }
+    fNEntries = fBinFirstEntry.back() + fBinFiles.back()->NEntries();
+  } else {
+    // this will open all files and read headers!!
+    fNEntries = fNuFluxTree->GetEntries();
+  }
 
   if ( fNEntries == 0 ) {
     LOG("Flux", pERROR)
@@ -477,23 +735,29 @@ void GSimpleNtpFlux::LoadBeamSimData(const std::vector<string>& patterns,
     }
   }
 
+  // binary files are read directly into fCurEntry, fCurNuMI, fCurAux
+  bool usechain = fBinFiles.empty();
+
   int sba_status[3] = { -999, -999, -999 };
   // "entry" branch isn't optional ... contains the neutrino info
+  if ( usechain ) {
 #if ROOT_VERSION_CODE >= ROOT_VERSION(5,26,0)
-  sba_status[0] =
+    sba_status[0] =
 #endif
-    fNuFluxTree->SetBranchAddress("entry",&fCurEntry);
+      fNuFluxTree->SetBranchAddress("entry",&fCurEntry);
 #if ROOT_VERSION_CODE >= ROOT_VERSION(5,26,0)
-  if ( sba_status[0] < 0 ) {
-    LOG("Flux", pFATAL)
-      << "flux chain has no \"entry\" branch " << sba_status[0];
-    assert(0);
-  }
+    if ( sba_status[0] < 0 ) {
+      LOG("Flux", pFATAL)
+        << "flux chain has no \"entry\" branch " << sba_status[0];
+      assert(0);
+    }
 #endif
+  }
   //TBranch* bentry = fNuFluxTree->GetBranch("entry");
   //bentry->SetAutoDelete(false);
 
   if ( OptionalAttachBranch("numi") ) {
+    if ( usechain )
 #if ROOT_VERSION_CODE >= ROOT_VERSION(5,26,0)
     sba_status[1] =
 #endif
@@ -503,6 +767,7 @@ void GSimpleNtpFlux::LoadBeamSimData(const std::vector<string>& patterns,
   } else { delete fCurNuMI; fCurNuMI = 0; }
 
   if ( OptionalAttachBranch("aux") ) {
+    if ( usechain )
 #if ROOT_VERSION_CODE >= ROOT_VERSION(5,26,0)
     sba_status[2] =
 #endif
@@ -547,6 +812,105 @@ void GSimpleNtpFlux::LoadBeamSimData(const std::vector<string>& patterns,
   LOG("Flux",pDEBUG) << "about to CalcEffPOTsPerNu";
   this->CalcEffPOTsPerNu();
 
+  // read-ahead of entries in a background thread, e.g. "prefetch=1024"
+  size_t ipf = config.find("prefetch=");
+  if ( ipf != string::npos ) {
+    fNPrefetch = atoi(config.substr(ipf+9).c_str());
+    LOG("Flux",pINFO) << "Config saw \"prefetch=" << fNPrefetch << "\"";
+  }
+  this->ConfigureReading();
+}
+//___________________________________________________________________________
+void GSimpleNtpFlux::SetTreeCacheSize(Long64_t nbytes)
+{
+  fTreeCacheSize = nbytes;
+  if ( fNEntries > 0 ) this->ConfigureReading();
+}
+//___________________________________________________________________________
+void GSimpleNtpFlux::SetPrefetch(int nentries)
+{
+  fNPrefetch = nentries;
+  if ( fNEntries > 0 ) this->ConfigureReading();
+}
+//___________________________________________________________________________
+void GSimpleNtpFlux::ConfigureReading(void)
+{
+// Sets up the reading of the "flux" chain: a TTreeCache restricted to the
+// attached branches and, if requested, the background read-ahead of entries
+// (which takes over the chain: the branch addresses are restored when it is
+// switched off)
+
+  if ( fPrefetcher ) {
+    delete fPrefetcher;
+    fPrefetcher = 0;
+    fNuFluxTree->SetBranchAddress("entry",&fCurEntry);
+    if ( fCurNuMI ) fNuFluxTree->SetBranchAddress("numi",&fCurNuMI);
+    if ( fCurAux  ) fNuFluxTree->SetBranchAddress("aux", &fCurAux);
+  }
+
+  if ( ! fBinFiles.empty() ) {
+    LOG("Flux",pNOTICE)
+      << "Reading flux entries from " << fBinFiles.size() << " binary files";
+    return;
+  }
+
+  if ( fTreeCacheSize > 0 ) {
+    fNuFluxTree->SetCacheSize(fTreeCacheSize);
+    fNuFluxTree->AddBranchToCache("entry",kTRUE);
+    if ( fCurNuMI ) fNuFluxTree->AddBranchToCache("numi",kTRUE);
+    if ( fCurAux  ) fNuFluxTree->AddBranchToCache("aux", kTRUE);
+    fNuFluxTree->StopCacheLearningPhase();
+  } else {
+    fNuFluxTree->SetCacheSize(0);
+  }
+
+  if ( fNPrefetch > 0 && fNEntries > 0 ) {
+    fPrefetcher = new GSimpleNtpPrefetcher(fNuFluxTree, fNPrefetch,
+                                           fCurNuMI != 0, fCurAux != 0);
+  }
+
+  LOG("Flux",pNOTICE)
+    << "Reading flux entries with a " << fTreeCacheSize
+    << " bytes tree cache, " << fNPrefetch << " entries read ahead";
+}
+//___________________________________________________________________________
+Int_t GSimpleNtpFlux::ReadEntry(Long64_t ientry)
+{
+  if ( ! fBinFiles.empty() ) {
+    size_t ifile = std::upper_bound(fBinFirstEntry.begin(), fBinFirstEntry.end(),
+                                    ientry) - fBinFirstEntry.begin() - 1;
+    return fBinFiles[ifile]->GetEntry(ientry - fBinFirstEntry[ifile],
+                                      fCurEntry, fCurNuMI, fCurAux);
+  }
+  if ( fPrefetcher ) {
+    return fPrefetcher->GetEntry(ientry, fCurEntry, fCurNuMI, fCurAux);
+  }
+  return fNuFluxTree->GetEntry(ientry);
+}
+//___________________________________________________________________________
+int GSimpleNtpFlux::NMetaEntries(void)
+{
+  if ( fBinFiles.empty() ) return fNuMetaTree->GetEntries();
+
+  int nmeta = 0;
+  for (size_t i = 0; i < fBinFiles.size(); ++i) nmeta += fBinFiles[i]->NMeta();
+  return nmeta;
+}
+//___________________________________________________________________________
+Int_t GSimpleNtpFlux::ReadMetaEntry(int imeta)
+{
+// Read the imeta-th meta record (of all files) into fCurMeta
+
+  if ( fBinFiles.empty() ) return fNuMetaTree->GetEntry(imeta);
+
+  for (size_t i = 0; i < fBinFiles.size(); ++i) {
+    if ( imeta < fBinFiles[i]->NMeta() ) {
+      *fCurMeta = fBinFiles[i]->Meta(imeta);
+      return sizeof(GSimpleNtpMeta);
+    }
+    imeta -= fBinFiles[i]->NMeta();
+  }
+  return 0;
 }
 //___________________________________________________________________________
 void GSimpleNtpFlux::GetBranchInfo(std::vector<std::string>& branchNames,
@@ -591,14 +955,14 @@ void GSimpleNtpFlux::ProcessMeta(void)
   // PDGLibrary* pdglib = PDGLibrary::Instance(); // get initialized now
 
   if ( fAllFilesMeta ) {
-    fNuMetaTree->SetBranchAddress("meta",&fCurMeta);
+    if ( fBinFiles.empty() ) fNuMetaTree->SetBranchAddress("meta",&fCurMeta);
 #ifdef USE_INDEX_FOR_META
     int nindices = fNuMetaTree->BuildIndex("metakey"); // key used to tie entries to meta data
     LOG("Flux", pDEBUG) << "ProcessMeta() BuildIndex nindices " << nindices;
 #endif
-    int nmeta = fNuMetaTree->GetEntries();
+    int nmeta = this->NMetaEntries();
     for (int imeta = 0; imeta < nmeta; ++imeta ) {
-      fNuMetaTree->GetEntry(imeta);
+      this->ReadMetaEntry(imeta);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
       LOG("Flux", pNOTICE) << "ProcessMeta() ifile " << imeta
                            << " (of " << fNFiles
@@ -737,6 +1101,10 @@ void GSimpleNtpFlux::Initialize(void)
   fAllFilesMeta    = true;
   fAlreadyUnwgt    = false;
 
+  fTreeCacheSize   = kDefaultTreeCacheSize;
+  fNPrefetch       = 0;
+  fPrefetcher      = 0;
+
   this->SetDefaults();
   this->ResetCurrent();
 }
@@ -776,6 +1144,8 @@ void GSimpleNtpFlux::CleanUp(void)
   if (fCurAux)      delete fCurAux;
   if (fCurMeta)     delete fCurMeta;
 
+  if (fPrefetcher)  delete fPrefetcher;
+  for (size_t i = 0; i < fBinFiles.size(); ++i) delete fBinFiles[i];
   if (fNuFluxTree)  delete fNuFluxTree;
   if (fNuMetaTree)  delete fNuMetaTree;
 
@@ -808,6 +1178,29 @@ void GSimpleNtpFlux::AddFile(TTree* fluxtree, TTree* metatree, string fname)
 
 }
 
+//___________________________________________________________________________
+void GSimpleNtpFlux::AddBinFile(string fname, bool use_mmap)
+{
+  // Add a flat binary file (see GSimpleNtpBinFile)
+  GSimpleNtpBinFile* binfile = new GSimpleNtpBinFile;
+  if ( ! binfile->Open(fname, use_mmap) ) {
+    delete binfile;
+    return;
+  }
+  if ( binfile->NMeta() == 0 ) fAllFilesMeta = false;
+
+  Long64_t first = ( fBinFiles.empty() ) ? 0 :
+                     fBinFirstEntry.back() + fBinFiles.back()->NEntries();
+  fBinFiles.push_back(binfile);
+  fBinFirstEntry.push_back(first);
+
+  LOG("Flux",pINFO)
+    << "flux->AddBinFile() of " << binfile->NEntries()
+    << " " << ((binfile->NMeta()>0)?"[+meta]":"[no-meta]")
+    << " entries in file: " << fname;
+
+  fNFiles++;
+}
 //___________________________________________________________________________
 
 bool GSimpleNtpFlux::OptionalAttachBranch(std::string name)
@@ -819,6 +1212,20 @@ bool GSimpleNtpFlux::OptionalAttachBranch(std::string name)
     return false;
   }
 
+  if ( ! fBinFiles.empty() ) {
+    // binary files: all of them must have the records
+    for (size_t i = 0; i < fBinFiles.size(); ++i) {
+      bool has = ( name == "numi" ) ? fBinFiles[i]->HasNuMI() :
+                 ( name == "aux"  ) ? fBinFiles[i]->HasAux()  : false;
+      if ( ! has ) {
+        LOG("Flux", pINFO)
+          << "no \"" << name << "\" records in " << fBinFiles[i]->FileName();
+        return false;
+      }
+    }
+    return true;
+  }
+
   if ( ( fNuFluxTree->GetBranch(name.c_str()) ) ) return true;
 
   LOG("Flux", pINFO)
@@ -1111,6 +1518,9 @@ std::vector<std::string> GSimpleNtpFlux::GetFileList()
   while (( chEl=(TChainElement*)next() )) {
     flist.push_back(chEl->GetTitle());
   }
+  for (size_t i = 0; i < fBinFiles.size(); ++i) {
+    flist.push_back(fBinFiles[i]->FileName());
+  }
   return flist;
 }
 
@@ -36,6 +36,7 @@ class TFile;
 class TChain;
 class TTree;
 class TBranch;
+class TDirectory;
 
 using std::string;
 using std::ostream;
@@ -43,6 +44,9 @@ using std::ostream;
 namespace genie {
 namespace flux  {
 
+class GSimpleNtpPrefetcher;
+class GSimpleNtpBinFile;
+
 class GSimpleNtpEntry;
 ostream & operator << (ostream & stream, const GSimpleNtpEntry & info);
 
@@ -219,6 +223,8 @@ public :
   long int               Index         (void) { return  fIEntry;              }
   void                   Clear            (Option_t * opt);
   void                   GenerateWeighted (bool gen_weighted);
+  bool                   SaveState        (TDirectory * dir) const;
+  bool                   RestoreState     (TDirectory * dir);
 
   // Methods specific to the NuMI flux driver,
   // for configuration/initialization of the flux & event generation drivers
@@ -278,6 +284,9 @@ public :
 
   void      SetRequestedBranchList(string blist="entry,numi,aux") { fNuFluxBranchRequest = blist; }
 
+  void      SetTreeCacheSize(Long64_t nbytes);                    ///< TTreeCache size for the requested branches (0: off, default 10 MB)
+  void      SetPrefetch(int nentries=1024);                       ///< read ahead nentries flux entries in a background thread (0: off)
+
   void      SetMaxEnergy(double Ev);                              ///< specify maximum flx neutrino energy
 
   void      SetGenWeighted(bool genwgt=false) { fGenWeighted = genwgt; } ///< toggle whether GenerateNext() returns weight=1 flux (initial default false)
@@ -300,6 +309,11 @@ private:
   void AddFile               (TTree* fluxtree, TTree* metatree, string fname);
   bool OptionalAttachBranch  (std::string bname);
   void CalcEffPOTsPerNu      (void);
+  Int_t ReadEntry            (Long64_t ientry);
+  int  NMetaEntries          (void);
+  Int_t ReadMetaEntry        (int imeta);
+  void AddBinFile            (string fname, bool use_mmap);
+  void ConfigureReading      (void);
   void ScanMeta              (void);
 
   // Private data members
@@ -347,6 +361,13 @@ private:
   GSimpleNtpNuMI*  fCurNuMICopy;   ///< current "numi" branch extra info
   GSimpleNtpAux*   fCurAuxCopy;    ///< current "aux" branch extra info
 
+  Long64_t  fTreeCacheSize;       ///< TTreeCache size (bytes) for the requested branches
+  int       fNPrefetch;           ///< # of entries read ahead in a background thread (0: no read-ahead)
+  GSimpleNtpPrefetcher* fPrefetcher; //! background reader of the flux chain
+
+  std::vector<GSimpleNtpBinFile*> fBinFiles;  //! flat binary (".gsbin") flux files, used instead of the chains
+  std::vector<Long64_t> fBinFirstEntry;       //! index of the first entry of each binary file
+
 };
 
 } // flux namespace
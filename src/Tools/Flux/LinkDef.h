@@ -39,12 +39,16 @@
 #pragma link C++ class genie::flux::GSimpleNtpMeta+;
 
 #pragma link C++ class genie::flux::GSimpleNtpFlux;
+#pragma link C++ class genie::flux::GSimpleNtpBinFile;
+#pragma link C++ class genie::flux::GSimpleNtpBinWriter;
 
 #pragma link C++ class genie::flux::GFluxBlender;
+#pragma link C++ class genie::flux::GFluxEnergySorter;
 
 #pragma link C++ class genie::flux::GFlavorMixerI;
 #pragma link C++ class genie::flux::GFlavorMixerFactory;
 #pragma link C++ class genie::flux::GFlavorMap;
+#pragma link C++ class genie::flux::GFlavorMixerCache;
 
 #pragma link C++ class genie::flux::GFluxDriverFactory;
 
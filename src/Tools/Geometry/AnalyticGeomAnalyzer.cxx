@@ -0,0 +1,449 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+
+ For the class documentation see the corresponding header file.
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <algorithm>
+
+#include "libxml/parser.h"
+#include "libxml/xmlmemory.h"
+
+#include <TMath.h>
+
+#include "Framework/Conventions/Units.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/ParticleData/PDGLibrary.h"
+#include "Framework/Utils/StringUtils.h"
+#include "Framework/Utils/UnitUtils.h"
+#include "Framework/Utils/XmlParserUtils.h"
+#include "Tools/Geometry/AnalyticGeomAnalyzer.h"
+#include "Tools/Geometry/FidShape.h"
+
+using namespace genie;
+using namespace genie::geometry;
+
+//___________________________________________________________________________
+namespace {
+  // read an "x,y,z" attribute
+  bool ReadVector(xmlNodePtr xml_cur, string attr, TVector3 & vec)
+  {
+    vector<string> v = utils::str::Split(
+      utils::str::TrimSpaces(utils::xml::GetAttribute(xml_cur, attr)), ",");
+    if(v.size() != 3) return false;
+    vec.SetXYZ(atof(v[0].c_str()), atof(v[1].c_str()), atof(v[2].c_str()));
+    return true;
+  }
+  // read a numerical attribute
+  bool ReadNumber(xmlNodePtr xml_cur, string attr, double & val)
+  {
+    string s = utils::str::TrimSpaces(utils::xml::GetAttribute(xml_cur, attr));
+    if(s.size() == 0) return false;
+    val = atof(s.c_str());
+    return true;
+  }
+}
+//___________________________________________________________________________
+AnalyticGeomAnalyzer::AnalyticGeomAnalyzer(string xml_filename) :
+GeomAnalyzerI()
+{
+  this->Initialize(xml_filename);
+}
+//___________________________________________________________________________
+AnalyticGeomAnalyzer::~AnalyticGeomAnalyzer()
+{
+  this->CleanUp();
+}
+//___________________________________________________________________________
+const PDGCodeList & AnalyticGeomAnalyzer::ListOfTargetNuclei(void)
+{
+  return fTgtPdgCodes;
+}
+//___________________________________________________________________________
+const PathLengthList & AnalyticGeomAnalyzer::ComputeMaxPathLengths(void)
+{
+// The max path lengths are computed from the volume dimensions when the
+// geometry is loaded (see the class documentation)
+
+  return fMaxPathLengths;
+}
+//___________________________________________________________________________
+const PathLengthList & AnalyticGeomAnalyzer::ComputePathLengths(
+                        const TLorentzVector & x, const TLorentzVector & p)
+{
+// Computes the (density weighted) path lengths of each target nucleus along
+// the ray starting at x (in m) along the direction of p
+
+  this->TraceRay(x, p);
+
+  fCurrPathLengths.SetAllToZero();
+
+  vector<Segment>::const_iterator siter = fSegments.begin();
+  for( ; siter != fSegments.end(); ++siter) {
+    const Material & mat = fMaterials[siter->fMaterial];
+    map<int, double>::const_iterator fiter = mat.fFractions.begin();
+    for( ; fiter != mat.fFractions.end(); ++fiter) {
+      fCurrPathLengths.AddPathLength(
+         fiter->first, siter->fStep * mat.fDensity * fiter->second);
+    }
+  }
+
+  // geom units -> SI
+  double scale = fLengthScale * fDensityScale;
+  PDGCodeList::const_iterator titer = fTgtPdgCodes.begin();
+  for( ; titer != fTgtPdgCodes.end(); ++titer) {
+    fCurrPathLengths.ScalePathLength(*titer, scale);
+  }
+
+  return fCurrPathLengths;
+}
+//___________________________________________________________________________
+const TVector3 & AnalyticGeomAnalyzer::GenerateVertex(
+              const TLorentzVector & x, const TLorentzVector & p, int tgtpdg)
+{
+// Generates a random vertex (in m), in the materials containing the input
+// target nucleus, along the ray starting at x along the direction of p.
+// The vertex is distributed along the ray according to the density weight
+// of the nucleus, uniform within each segment.
+
+  this->TraceRay(x, p);
+
+  vector<double> cumul(fSegments.size(), 0.);
+  double sum = 0;
+  for(unsigned int i = 0; i < fSegments.size(); i++) {
+    const Material & mat = fMaterials[fSegments[i].fMaterial];
+    map<int, double>::const_iterator fiter = mat.fFractions.find(tgtpdg);
+    if(fiter != mat.fFractions.end()) {
+      sum += fSegments[i].fStep * mat.fDensity * fiter->second;
+    }
+    cumul[i] = sum;
+  }
+
+  if(sum <= 0) {
+    LOG("AnalyticGeom", pERROR)
+      << "The input ray does not cross any material containing: " << tgtpdg
+      << " - Setting the vertex at the ray origin";
+    fCurrVertex = x.Vect();
+    return fCurrVertex;
+  }
+
+  RandomGen * rnd = RandomGen::Instance();
+  double r = sum * rnd->RndGeom().Rndm();
+
+  unsigned int iseg =
+     std::upper_bound(cumul.begin(), cumul.end(), r) - cumul.begin();
+  if(iseg >= fSegments.size()) iseg = fSegments.size() - 1;
+
+  double prev = (iseg > 0) ? cumul[iseg-1] : 0.;
+  double frac = (cumul[iseg] > prev) ? (r - prev) / (cumul[iseg] - prev) : 0.5;
+  double dist = fSegments[iseg].fDistIn + frac * fSegments[iseg].fStep;
+
+  fCurrVertex = fRayPos + dist * fRayDir;
+  fCurrVertex *= fLengthScale; // geom units -> SI
+
+  LOG("AnalyticGeom", pINFO)
+    << "Vertex in volume material: " << fMaterials[fSegments[iseg].fMaterial].fName
+    << " at (" << fCurrVertex.X() << ", " << fCurrVertex.Y()
+    << ", " << fCurrVertex.Z() << ") m";
+
+  return fCurrVertex;
+}
+//___________________________________________________________________________
+void AnalyticGeomAnalyzer::TraceRay(
+                        const TLorentzVector & x, const TLorentzVector & p)
+{
+// Finds the material segments along the ray, from the volume boundaries it
+// crosses. Rays start at x: material behind the ray origin is ignored.
+
+  if(fTraced && fRayX4 == x && fRayP4 == p) return;
+
+  fRayX4  = x;
+  fRayP4  = p;
+  fRayPos = x.Vect();
+  fRayPos *= (1./fLengthScale); // SI -> geom units
+  fRayDir = p.Vect().Unit();
+  fSegments.clear();
+
+  // distances along the ray to enter & exit each volume
+  unsigned int nvol = fVolumes.size();
+  vector<double> dist_in (nvol, 0.);
+  vector<double> dist_out(nvol, 0.);
+  vector<double> bounds;
+  for(unsigned int iv = 0; iv < nvol; iv++) {
+    RayIntercept ri = fVolumes[iv].fShape->Intercept(fRayPos, fRayDir);
+    if(!ri.fIsHit) continue;
+    double din  = TMath::Max(ri.fDistIn, 0.);
+    double dout = ri.fDistOut;
+    if(dout <= din) continue;
+    dist_in [iv] = din;
+    dist_out[iv] = dout;
+    bounds.push_back(din);
+    bounds.push_back(dout);
+  }
+  std::sort(bounds.begin(), bounds.end());
+  bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+
+  // the material between consecutive boundaries is that of the last listed
+  // volume containing it
+  for(unsigned int ib = 1; ib < bounds.size(); ib++) {
+    double d0 = bounds[ib-1];
+    double d1 = bounds[ib];
+    double dmid = 0.5 * (d0 + d1);
+    int imat = -1;
+    for(int iv = nvol-1; iv >= 0; iv--) {
+      if(dist_in[iv] <= dmid && dmid < dist_out[iv]) {
+        imat = fVolumes[iv].fMaterial;
+        break;
+      }
+    }
+    if(imat < 0) continue;
+    const Material & mat = fMaterials[imat];
+    if(mat.fDensity <= 0 || mat.fFractions.size() == 0) continue;
+
+    if(fSegments.size() > 0 && fSegments.back().fMaterial == imat &&
+       fSegments.back().fDistIn + fSegments.back().fStep == d0) {
+      fSegments.back().fStep = d1 - fSegments.back().fDistIn;
+    } else {
+      Segment seg;
+      seg.fDistIn   = d0;
+      seg.fStep     = d1 - d0;
+      seg.fMaterial = imat;
+      fSegments.push_back(seg);
+    }
+  }
+
+  fTraced = true;
+}
+//___________________________________________________________________________
+void AnalyticGeomAnalyzer::Initialize(string xml_filename)
+{
+  fLengthScale  = 1.;
+  fDensityScale = 1.;
+  fTraced       = false;
+
+  if(!this->LoadFromXml(xml_filename)) {
+    LOG("AnalyticGeom", pFATAL)
+      << "Could not load the analytic geometry from: " << xml_filename;
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  // list of target nuclei
+  vector<Material>::const_iterator miter = fMaterials.begin();
+  for( ; miter != fMaterials.end(); ++miter) {
+    map<int, double>::const_iterator fiter = miter->fFractions.begin();
+    for( ; fiter != miter->fFractions.end(); ++fiter) {
+      fTgtPdgCodes.push_back(fiter->first);
+    }
+  }
+  fMaxPathLengths  = PathLengthList(fTgtPdgCodes);
+  fCurrPathLengths = PathLengthList(fTgtPdgCodes);
+
+  // max path lengths: no ray crosses a volume along more than its longest
+  // chord, and each point is in the material of a single volume
+  vector<Volume>::const_iterator viter = fVolumes.begin();
+  for( ; viter != fVolumes.end(); ++viter) {
+    const Material & mat = fMaterials[viter->fMaterial];
+    map<int, double>::const_iterator fiter = mat.fFractions.begin();
+    for( ; fiter != mat.fFractions.end(); ++fiter) {
+      fMaxPathLengths.AddPathLength(fiter->first,
+         viter->fMaxChord * mat.fDensity * fiter->second);
+    }
+  }
+  double scale = fLengthScale * fDensityScale;
+  PDGCodeList::const_iterator titer = fTgtPdgCodes.begin();
+  for( ; titer != fTgtPdgCodes.end(); ++titer) {
+    fMaxPathLengths.ScalePathLength(*titer, scale);
+  }
+
+  LOG("AnalyticGeom", pNOTICE)
+    << "Loaded " << fVolumes.size() << " volumes and "
+    << fMaterials.size() << " materials from: " << xml_filename;
+  LOG("AnalyticGeom", pNOTICE) << fTgtPdgCodes;
+  LOG("AnalyticGeom", pNOTICE) << "Max path lengths: " << fMaxPathLengths;
+}
+//___________________________________________________________________________
+bool AnalyticGeomAnalyzer::LoadFromXml(string xml_filename)
+{
+  xmlDocPtr xml_doc = xmlParseFile(xml_filename.c_str());
+  if(xml_doc == NULL) {
+    LOG("AnalyticGeom", pERROR)
+      << "XML file could not be parsed! [filename: " << xml_filename << "]";
+    return false;
+  }
+
+  xmlNodePtr xml_root = xmlDocGetRootElement(xml_doc);
+  if(xml_root == NULL ||
+     xmlStrcmp(xml_root->name, (const xmlChar *) "analytic_geometry")) {
+    LOG("AnalyticGeom", pERROR)
+      << "XML doc. has invalid root element! [filename: " << xml_filename << "]";
+    xmlFreeDoc(xml_doc);
+    return false;
+  }
+
+  string lunits = utils::str::TrimSpaces(
+                    utils::xml::GetAttribute(xml_root, "length_units"));
+  string dunits = utils::str::TrimSpaces(
+                    utils::xml::GetAttribute(xml_root, "density_units"));
+  if(lunits.size() == 0) lunits = "meter";
+  if(dunits.size() == 0) dunits = "g_cm3";
+  fLengthScale  = utils::units::UnitFromString(lunits) / units::meter;
+  fDensityScale = utils::units::UnitFromString(dunits) /
+                    (units::kilogram / units::meter3);
+
+  PDGLibrary * pdglib = PDGLibrary::Instance();
+  map<string, int> imaterial;
+
+  bool ok = true;
+  xmlNodePtr xml_cur = xml_root->xmlChildrenNode;
+  for( ; ok && xml_cur != NULL; xml_cur = xml_cur->next) {
+
+    if(xml_cur->type != XML_ELEMENT_NODE) continue;
+    string tag  = (const char *) xml_cur->name;
+    string name = utils::str::TrimSpaces(
+                    utils::xml::GetAttribute(xml_cur, "name"));
+
+    // materials
+    if(tag == "material") {
+      Material mat;
+      mat.fName = name;
+      if(!ReadNumber(xml_cur, "density", mat.fDensity) || mat.fDensity < 0) {
+        LOG("AnalyticGeom", pERROR)
+          << "No valid density for material: " << name;
+        ok = false;
+        break;
+      }
+      double sum = 0;
+      xmlNodePtr xml_el = xml_cur->xmlChildrenNode;
+      for( ; xml_el != NULL; xml_el = xml_el->next) {
+        if(xmlStrcmp(xml_el->name, (const xmlChar *) "element")) continue;
+        int pdgc = atoi(utils::str::TrimSpaces(
+                     utils::xml::GetAttribute(xml_el, "pdgc")).c_str());
+        double frac = atof(utils::xml::TrimSpaces(
+                     xmlNodeListGetString(xml_doc, xml_el->xmlChildrenNode, 1)).c_str());
+        if(!pdglib->Find(pdgc) || frac < 0) {
+          LOG("AnalyticGeom", pERROR)
+            << "Invalid element " << pdgc << " [" << frac << "]"
+            << " in material: " << name;
+          ok = false;
+          break;
+        }
+        mat.fFractions[pdgc] += frac;
+        sum += frac;
+      }
+      if(mat.fFractions.size() > 0 && TMath::Abs(sum - 1.) > 1E-3) {
+        LOG("AnalyticGeom", pWARN)
+          << "The mass fractions of material: " << name
+          << " add up to " << sum;
+      }
+      imaterial[name] = fMaterials.size();
+      fMaterials.push_back(mat);
+      continue;
+    }
+
+    // volumes
+    if(tag != "box" && tag != "cylinder" && tag != "sphere") {
+      LOG("AnalyticGeom", pWARN) << "Ignoring unknown XML tag: " << tag;
+      continue;
+    }
+
+    string mname = utils::str::TrimSpaces(
+                     utils::xml::GetAttribute(xml_cur, "material"));
+    map<string, int>::const_iterator miter = imaterial.find(mname);
+    if(miter == imaterial.end()) {
+      LOG("AnalyticGeom", pERROR)
+        << "Unknown material: " << mname << " of volume: " << name
+        << " (materials must be defined before the volumes)";
+      ok = false;
+      break;
+    }
+
+    Volume vol;
+    vol.fName     = name;
+    vol.fMaterial = miter->second;
+    vol.fShape    = 0;
+    vol.fMaxChord = 0;
+
+    if(tag == "box") {
+      TVector3 vmin, vmax;
+      if(ReadVector(xml_cur, "min", vmin) && ReadVector(xml_cur, "max", vmax)) {
+        double lo[3], hi[3];
+        for(int j = 0; j < 3; j++) {
+          lo[j] = TMath::Min(vmin[j], vmax[j]);
+          hi[j] = TMath::Max(vmin[j], vmax[j]);
+        }
+        // same face conventions as GeomVolSelectorFiducial::MakeBox()
+        FidPolyhedron * poly = new FidPolyhedron();
+        poly->push_back(PlaneParam(-1, 0, 0,  lo[0]));
+        poly->push_back(PlaneParam( 0,-1, 0,  lo[1]));
+        poly->push_back(PlaneParam( 0, 0,-1,  lo[2]));
+        poly->push_back(PlaneParam(+1, 0, 0, -hi[0]));
+        poly->push_back(PlaneParam( 0,+1, 0, -hi[1]));
+        poly->push_back(PlaneParam( 0, 0,+1, -hi[2]));
+        vol.fShape    = poly;
+        vol.fMaxChord = TMath::Sqrt( (hi[0]-lo[0])*(hi[0]-lo[0]) +
+                                     (hi[1]-lo[1])*(hi[1]-lo[1]) +
+                                     (hi[2]-lo[2])*(hi[2]-lo[2]) );
+      }
+    }
+    else if(tag == "cylinder") {
+      TVector3 base, axis;
+      double radius = 0, length = 0;
+      if(ReadVector(xml_cur, "base", base) && ReadVector(xml_cur, "axis", axis) &&
+         ReadNumber(xml_cur, "radius", radius) &&
+         ReadNumber(xml_cur, "length", length) &&
+         axis.Mag() > 0 && radius > 0 && length > 0) {
+        axis = axis.Unit();
+        TVector3 top = base + length * axis;
+        // caps: the planes through base & top, normals pointing outwards
+        PlaneParam cap1(-axis.X(), -axis.Y(), -axis.Z(),  axis.Dot(base));
+        PlaneParam cap2( axis.X(),  axis.Y(),  axis.Z(), -axis.Dot(top));
+        vol.fShape    = new FidCylinder(base, axis, radius, cap1, cap2);
+        vol.fMaxChord = TMath::Sqrt(4*radius*radius + length*length);
+      }
+    }
+    else if(tag == "sphere") {
+      TVector3 center;
+      double radius = 0;
+      if(ReadVector(xml_cur, "center", center) &&
+         ReadNumber(xml_cur, "radius", radius) && radius > 0) {
+        vol.fShape    = new FidSphere(center, radius);
+        vol.fMaxChord = 2*radius;
+      }
+    }
+
+    if(!vol.fShape) {
+      LOG("AnalyticGeom", pERROR)
+        << "Invalid dimensions for " << tag << " volume: " << name;
+      ok = false;
+      break;
+    }
+    fVolumes.push_back(vol);
+  }
+
+  xmlFreeDoc(xml_doc);
+
+  if(ok && fVolumes.size() == 0) {
+    LOG("AnalyticGeom", pERROR) << "No volumes in: " << xml_filename;
+    ok = false;
+  }
+  return ok;
+}
+//___________________________________________________________________________
+void AnalyticGeomAnalyzer::CleanUp(void)
+{
+  vector<Volume>::iterator viter = fVolumes.begin();
+  for( ; viter != fVolumes.end(); ++viter) {
+    delete viter->fShape;
+  }
+  fVolumes.clear();
+}
+//___________________________________________________________________________
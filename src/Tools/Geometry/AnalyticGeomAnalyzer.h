@@ -0,0 +1,141 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::geometry::AnalyticGeomAnalyzer
+
+\brief   A GeomAnalyzerI implementation for simple geometries made of a few
+         uniformly filled boxes, cylinders and spheres, described in an XML
+         file and traced analytically (no ROOT geometry or navigator).
+
+         Use it for layered targets, boxes-of-boxes, cylinder stacks or rock
+         shells, where the TGeo navigation per flux neutrino costs far more
+         than the few ray intersections needed here.
+
+         XML format (lengths in length_units, densities in density_units,
+         units as in genie::utils::units::UnitFromString()):
+
+         <analytic_geometry length_units="meter" density_units="g_cm3">
+           <material name="rock" density="2.65">
+             <element pdgc="1000080160"> 0.5 </element>
+             <element pdgc="1000140280"> 0.5 </element>
+           </material>
+           <material name="air" density="0"/>
+           <box      name="shell" material="rock" min="-50,-50,-50" max="50,50,50"/>
+           <box      name="hall"  material="air"  min="-10,-10,-10" max="10,10,10"/>
+           <cylinder name="tank"  material="water"
+                     base="0,0,-5" axis="0,0,1" radius="3" length="10"/>
+           <sphere   name="ball"  material="rock" center="0,0,0" radius="1"/>
+         </analytic_geometry>
+
+         The element weights are mass fractions. Volumes may overlap: at any
+         point the material is that of the last listed volume containing it,
+         so daughter volumes are listed after their mother. A material with
+         no elements (or zero density) is a void.
+         The path lengths are computed, as in ROOTGeomAnalyzer, as
+         length x density x mass fraction in SI units (kgr/m^2), and the ray
+         positions and generated vertices are in meters. The max path lengths
+         are the sum, over volumes, of the longest chord of the volume times
+         its density weight: an upper bound that needs no scan.
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _ANALYTIC_GEOMETRY_ANALYZER_H_
+#define _ANALYTIC_GEOMETRY_ANALYZER_H_
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <TLorentzVector.h>
+#include <TVector3.h>
+
+#include "Framework/EventGen/GeomAnalyzerI.h"
+#include "Framework/EventGen/PathLengthList.h"
+#include "Framework/ParticleData/PDGCodeList.h"
+
+using std::map;
+using std::string;
+using std::vector;
+
+namespace genie    {
+namespace geometry {
+
+class FidShape;
+
+class AnalyticGeomAnalyzer : public GeomAnalyzerI {
+
+public :
+  AnalyticGeomAnalyzer(string xml_filename);
+ ~AnalyticGeomAnalyzer();
+
+  // implement the GeomAnalyzerI interface
+
+  const PDGCodeList &    ListOfTargetNuclei    (void);
+  const PathLengthList & ComputeMaxPathLengths (void);
+
+  const PathLengthList &
+           ComputePathLengths
+             (const TLorentzVector & x, const TLorentzVector & p);
+  const TVector3 &
+           GenerateVertex
+             (const TLorentzVector & x, const TLorentzVector & p, int tgtpdg);
+
+  // geometry info
+
+  unsigned int NVolumes     (void) const { return fVolumes.size(); }
+  double       LengthUnits  (void) const { return fLengthScale;    }
+  double       DensityUnits (void) const { return fDensityScale;   }
+
+private:
+
+  struct Material {
+    string           fName;
+    double           fDensity;    ///< density (geom units)
+    map<int, double> fFractions;  ///< target nucleus pdg -> mass fraction
+  };
+  struct Volume {
+    string     fName;
+    FidShape * fShape;            ///< owned
+    int        fMaterial;         ///< index in fMaterials
+    double     fMaxChord;         ///< longest chord (geom units)
+  };
+  struct Segment {
+    double fDistIn;               ///< distance along the ray to the segment start (geom units)
+    double fStep;                 ///< segment length (geom units)
+    int    fMaterial;             ///< index in fMaterials
+  };
+
+  void Initialize  (string xml_filename);
+  bool LoadFromXml (string xml_filename);
+  void CleanUp     (void);
+  void TraceRay    (const TLorentzVector & x, const TLorentzVector & p);
+
+  vector<Material> fMaterials;          ///< materials
+  vector<Volume>   fVolumes;            ///< volumes, in placement order
+  double           fLengthScale;        ///< geom length units -> m
+  double           fDensityScale;       ///< geom density units -> kgr/m3
+  PDGCodeList      fTgtPdgCodes;        ///< list of target nuclei
+  PathLengthList   fMaxPathLengths;     ///< max path lengths (SI)
+  PathLengthList   fCurrPathLengths;    ///< path lengths of the last traced ray (SI)
+  TVector3         fCurrVertex;         ///< last generated vertex (SI)
+
+  bool             fTraced;             ///< are the segments those of fRayX4, fRayP4?
+  TLorentzVector   fRayX4;              ///< last traced ray position (SI)
+  TLorentzVector   fRayP4;              ///< last traced ray momentum
+  TVector3         fRayPos;             ///< last traced ray position (geom units)
+  TVector3         fRayDir;             ///< last traced ray direction (unit vector)
+  vector<Segment>  fSegments;           ///< material segments along the last traced ray
+};
+
+}      // geometry namespace
+}      // genie    namespace
+
+#endif // _ANALYTIC_GEOMETRY_ANALYZER_H_
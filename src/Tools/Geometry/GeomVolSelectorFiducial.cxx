@@ -173,6 +173,19 @@ void GeomVolSelectorFiducial::EndPSList() const
   fCurrPathSegmentList = 0;
 }
 
+//___________________________________________________________________________
+bool GeomVolSelectorFiducial::RejectsRay(const TVector3& start,
+                                         const TVector3& dir) const
+{
+  // A ray missing the (analytic) fiducial shape has all its segments
+  // rejected, unless the selection is reversed
+
+  if ( fSelectReverse || ! fShape ) return false;
+
+  RayIntercept intercept = fShape->Intercept(start,dir);
+  return ( ! intercept.fIsHit );
+}
+
 //___________________________________________________________________________
 void GeomVolSelectorFiducial::AdoptFidShape(FidShape* shape)
 {
@@ -13,6 +13,10 @@
           cap the fid volume just down from the flux window or use the
           SetUpstreamZ() in the flux driver to push the ray back to make it so).
 
+          Rays missing the (non-reversed) fiducial shape are recognized by
+          RejectsRay() before the geometry is swum, so they cost only the
+          analytic shape intercept.
+
 \author   Robert Hatcher <rhatcher@fnal.gov>
           FNAL
 
@@ -52,6 +56,7 @@ public :
   void TrimSegment(PathSegment& segment) const;
   void BeginPSList(const PathSegmentList* untrimmed) const;
   void EndPSList() const;
+  bool RejectsRay(const TVector3& start, const TVector3& dir) const;
 
   // allow the selection to be reversed (i.e. exclude "fid" region)
   void SetReverseFiducial(Bool_t reverse=true) { fSelectReverse = reverse; }
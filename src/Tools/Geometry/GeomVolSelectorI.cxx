@@ -35,19 +35,28 @@ GeomVolSelectorI::~GeomVolSelectorI()
 
 PathSegmentList*
 GeomVolSelectorI::GenerateTrimmedList(const PathSegmentList* untrimmed) const
+{
+  PathSegmentList* trimmed = new PathSegmentList();
+  this->GenerateTrimmedList(untrimmed,trimmed);
+  return trimmed;
+}
+//___________________________________________________________________________
+void GeomVolSelectorI::GenerateTrimmedList(const PathSegmentList* untrimmed,
+                                           PathSegmentList* trimmed) const
 {
   this->BeginPSList(untrimmed);
 
-  PathSegmentList* trimmed = new PathSegmentList();
+  trimmed->SetAllToZero();
   trimmed->SetStartInfo(untrimmed->GetStartPos(),untrimmed->GetDirection());
 
-  const genie::geometry::PathSegmentList::PathSegmentV_t& segments =
-    untrimmed->GetPathSegmentV();
-  genie::geometry::PathSegmentList::PathSegVCItr_t sitr = segments.begin();
-  genie::geometry::PathSegmentList::PathSegVCItr_t sitr_end = segments.end();
+  // scratch segment, kept so that its path string memory is re-used
+  static thread_local PathSegment ps;
+
+  genie::geometry::PathSegmentList::PathSegVCItr_t sitr = untrimmed->begin();
+  genie::geometry::PathSegmentList::PathSegVCItr_t sitr_end = untrimmed->end();
 
   for ( ; sitr != sitr_end ; ++sitr ) {
-    PathSegment ps = *sitr;  // new PathSegment is a copy of old
+    ps = *sitr;  // PathSegment is a copy of old
     this->TrimSegment(ps);
     if ( fRemoveEntries && ps.GetSummedStepRange() == 0 ) continue; // remove null segments
     // now put (adjusted) entry on trimmed list
@@ -55,7 +64,5 @@ GeomVolSelectorI::GenerateTrimmedList(const PathSegmentList* untrimmed) const
   }
 
   this->EndPSList();
-
-  return trimmed;
 }
 //___________________________________________________________________________
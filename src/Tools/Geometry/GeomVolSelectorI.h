@@ -39,6 +39,10 @@ public :
   /// relinquishes ownership of returned object
   virtual PathSegmentList* GenerateTrimmedList(const PathSegmentList* untrimmed) const;
 
+  /// as above, but fill the input (caller-owned) list, re-using its segments
+  virtual void GenerateTrimmedList(const PathSegmentList* untrimmed,
+                                   PathSegmentList* trimmed) const;
+
   /// This is the method every derived version must implement
   /// To reject a segment outright:  segment.fStepRangeSet.clear()
   virtual void TrimSegment(PathSegment& segment) const = 0;
@@ -50,6 +54,13 @@ public :
   virtual void BeginPSList(const PathSegmentList* untrimmed) const = 0;
   virtual void EndPSList() const = 0;
 
+  /// Whether all segments of the ray starting at start and moving along
+  /// dir (both in "top vol" coords & units) are known to be rejected.
+  /// Asked before the geometry is swum, so that the stepping is skipped.
+  /// It must be cheap, stateless and safe to call from several threads.
+  virtual bool RejectsRay(const TVector3& /*start*/, const TVector3& /*dir*/) const
+  { return false; }
+
   /// configure for individual neutrino ray
   void SetCurrentRay(const TLorentzVector& x4, const TLorentzVector& p4)
   { fX4 = x4; fP4 = p4; }
@@ -9,9 +9,12 @@
 
 #pragma link C++ class genie::geometry::ROOTGeomAnalyzer;
 #pragma link C++ class genie::geometry::PointGeomAnalyzer;
+#pragma link C++ class genie::geometry::AnalyticGeomAnalyzer;
+#pragma link C++ class genie::geometry::PREMGeomAnalyzer;
 
 #pragma link C++ namespace genie::utils::geometry;
 
+#pragma link C++ class genie::geometry::StepRangeSet;
 #pragma link C++ class genie::geometry::PathSegment;
 #pragma link C++ class genie::geometry::PathSegmentList;
 #pragma link C++ class genie::geometry::GeomVolSelectorI;
@@ -0,0 +1,279 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+
+ For the class documentation see the corresponding header file.
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <algorithm>
+
+#include <TMath.h>
+
+#include "Framework/Conventions/Constants.h"
+#include "Framework/Conventions/Units.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/Utils/PREM.h"
+#include "Tools/Geometry/PREMGeomAnalyzer.h"
+
+using namespace genie;
+using namespace genie::geometry;
+
+// number of lines through the Earth scanned for the max path lengths
+static const int    kNMaxPlScan       = 2000;
+static const double kMaxPlSafetyFactor = 1.01;
+
+//___________________________________________________________________________
+PREMGeomAnalyzer::PREMGeomAnalyzer(const map<int,double> & tgtmix) :
+GeomAnalyzerI()
+{
+  fComposition.assign(utils::prem::NLayers(), tgtmix);
+  fEarthCentre.SetXYZ(0., 0., -constants::kREarth/units::m);
+  fTraced = false;
+
+  this->BuildTargetList();
+}
+//___________________________________________________________________________
+PREMGeomAnalyzer::~PREMGeomAnalyzer()
+{
+
+}
+//___________________________________________________________________________
+void PREMGeomAnalyzer::SetLayerComposition(
+                              int ilayer, const map<int,double> & tgtmix)
+{
+// Set the nuclear composition (pdg -> mass fraction) of a PREM layer,
+// numbered outwards from 0 (inner core) to utils::prem::NLayers()-1 (ocean)
+
+  if(ilayer < 0 || ilayer >= (int)fComposition.size()) {
+    LOG("PREMGeom", pFATAL) << "No PREM layer: " << ilayer;
+    gAbortingInErr = true;
+    exit(1);
+  }
+  fComposition[ilayer] = tgtmix;
+
+  this->BuildTargetList();
+}
+//___________________________________________________________________________
+void PREMGeomAnalyzer::SetEarthCentre(const TVector3 & pos)
+{
+  fEarthCentre = pos;
+  fTraced      = false;
+
+  LOG("PREMGeom", pNOTICE)
+    << "Centre of the Earth at (" << pos.X() << ", " << pos.Y()
+    << ", " << pos.Z() << ") m";
+}
+//___________________________________________________________________________
+void PREMGeomAnalyzer::SetDetectorDepth(double depth)
+{
+// Put the origin of the flux frame at the input depth (m) below the surface,
+// with +z pointing towards the local zenith (as in the GAtmoFlux topocentric
+// horizontal frame)
+
+  this->SetEarthCentre(
+     TVector3(0., 0., -(constants::kREarth/units::m - depth)));
+}
+//___________________________________________________________________________
+const PDGCodeList & PREMGeomAnalyzer::ListOfTargetNuclei(void)
+{
+  return fTgtPdgCodes;
+}
+//___________________________________________________________________________
+const PathLengthList & PREMGeomAnalyzer::ComputeMaxPathLengths(void)
+{
+  return fMaxPathLengths;
+}
+//___________________________________________________________________________
+const PathLengthList & PREMGeomAnalyzer::ComputePathLengths(
+                        const TLorentzVector & x, const TLorentzVector & p)
+{
+// Computes the (density weighted) path lengths of each target nucleus along
+// the ray starting at x (in m) along the direction of p
+
+  this->TraceRay(x, p);
+
+  fCurrPathLengths.SetAllToZero();
+
+  double scale = 1. / (units::kilogram / units::meter2); // std units -> SI
+
+  vector<Crossing>::const_iterator citer = fCrossings.begin();
+  for( ; citer != fCrossings.end(); ++citer) {
+    const map<int,double> & mix = fComposition[citer->fLayer];
+    map<int,double>::const_iterator miter = mix.begin();
+    for( ; miter != mix.end(); ++miter) {
+      fCurrPathLengths.AddPathLength(
+         miter->first, citer->fColumn * miter->second * scale);
+    }
+  }
+
+  return fCurrPathLengths;
+}
+//___________________________________________________________________________
+const TVector3 & PREMGeomAnalyzer::GenerateVertex(
+              const TLorentzVector & x, const TLorentzVector & p, int tgtpdg)
+{
+// Generates a random vertex (in m) along the ray starting at x along the
+// direction of p, distributed as the density weight of the input nucleus
+
+  this->TraceRay(x, p);
+
+  vector<double> cumul(fCrossings.size(), 0.);
+  double sum = 0;
+  for(unsigned int i = 0; i < fCrossings.size(); i++) {
+    const map<int,double> & mix = fComposition[fCrossings[i].fLayer];
+    map<int,double>::const_iterator miter = mix.find(tgtpdg);
+    if(miter != mix.end()) sum += fCrossings[i].fColumn * miter->second;
+    cumul[i] = sum;
+  }
+
+  if(sum <= 0) {
+    LOG("PREMGeom", pERROR)
+      << "The input ray does not cross any PREM layer containing: " << tgtpdg
+      << " - Setting the vertex at the ray origin";
+    fCurrVertex = x.Vect();
+    return fCurrVertex;
+  }
+
+  RandomGen * rnd = RandomGen::Instance();
+  double r = sum * rnd->RndGeom().Rndm();
+
+  unsigned int ic =
+     std::upper_bound(cumul.begin(), cumul.end(), r) - cumul.begin();
+  if(ic >= fCrossings.size()) ic = fCrossings.size() - 1;
+
+  // find the point of the crossing where the density integral reaches the
+  // selected fraction of its total (it is monotonic in s)
+  const Crossing & cross = fCrossings[ic];
+  double prev = (ic > 0) ? cumul[ic-1] : 0.;
+  double frac = (cumul[ic] > prev) ? (r - prev) / (cumul[ic] - prev) : 0.5;
+  double target = frac * cross.fColumn;
+  double slo = cross.fS0;
+  double shi = cross.fS1;
+  for(int iter = 0; iter < 60; iter++) {
+    double smid = 0.5 * (slo + shi);
+    double col  = utils::prem::LayerColumnDensity(
+                                cross.fLayer, fRayB, cross.fS0, smid);
+    if(col < target) slo = smid;
+    else             shi = smid;
+  }
+  double s = 0.5 * (slo + shi) / units::m; // std units -> m
+
+  fCurrVertex = fRayClosest + s * fRayDir;
+
+  LOG("PREMGeom", pINFO)
+    << "Vertex in PREM layer: " << cross.fLayer
+    << " at (" << fCurrVertex.X() << ", " << fCurrVertex.Y()
+    << ", " << fCurrVertex.Z() << ") m";
+
+  return fCurrVertex;
+}
+//___________________________________________________________________________
+void PREMGeomAnalyzer::TraceRay(
+                        const TLorentzVector & x, const TLorentzVector & p)
+{
+// Finds the PREM layer crossings along the ray. Rays start at x: the Earth
+// behind the ray origin is ignored.
+
+  if(fTraced && fRayX4 == x && fRayP4 == p) return;
+
+  fRayX4  = x;
+  fRayP4  = p;
+  fRayDir = p.Vect().Unit();
+  fCrossings.clear();
+
+  TVector3 rel = x.Vect() - fEarthCentre;
+  double s0 = rel.Dot(fRayDir);               // m
+  TVector3 brel = rel - s0 * fRayDir;
+  fRayClosest = fEarthCentre + brel;
+  fRayB = brel.Mag() * units::m;              // m -> std units
+  double sstart = s0 * units::m;
+
+  int nlayers = utils::prem::NLayers();
+  for(int ilayer = 0; ilayer < nlayers; ilayer++) {
+    double rin  = utils::prem::LayerInnerRadius(ilayer);
+    double rout = utils::prem::LayerOuterRadius(ilayer);
+    if(fRayB >= rout) continue;
+    double smax = TMath::Sqrt(rout*rout - fRayB*fRayB);
+    double smin = (fRayB < rin) ? TMath::Sqrt(rin*rin - fRayB*fRayB) : 0.;
+    // the (up to two) crossings of the layer, on either side of the point
+    // of closest approach
+    for(int side = -1; side <= 1; side += 2) {
+      double lo = (side < 0) ? -smax : smin;
+      double hi = (side < 0) ? -smin : smax;
+      lo = TMath::Max(lo, sstart);
+      if(hi <= lo) continue;
+      Crossing cross;
+      cross.fLayer  = ilayer;
+      cross.fS0     = lo;
+      cross.fS1     = hi;
+      cross.fColumn = utils::prem::LayerColumnDensity(ilayer, fRayB, lo, hi);
+      if(cross.fColumn > 0) fCrossings.push_back(cross);
+    }
+  }
+
+  fTraced = true;
+}
+//___________________________________________________________________________
+void PREMGeomAnalyzer::BuildTargetList(void)
+{
+// Builds the list of target nuclei and computes their max path lengths,
+// which are those along a full line through the Earth (any ray is part of a
+// line). They are scanned over the distance of the line from the centre,
+// including the layer radii, at which the line is tangent to a layer and
+// its path length in the outer layers is the longest.
+
+  fTgtPdgCodes.clear();
+  vector< map<int,double> >::const_iterator liter = fComposition.begin();
+  for( ; liter != fComposition.end(); ++liter) {
+    map<int,double>::const_iterator miter = liter->begin();
+    for( ; miter != liter->end(); ++miter) {
+      fTgtPdgCodes.push_back(miter->first);
+    }
+  }
+  fMaxPathLengths  = PathLengthList(fTgtPdgCodes);
+  fCurrPathLengths = PathLengthList(fTgtPdgCodes);
+  fTraced = false;
+
+  int    nlayers = utils::prem::NLayers();
+  double rearth  = constants::kREarth;
+  double scale   = kMaxPlSafetyFactor / (units::kilogram / units::meter2);
+
+  vector<double> bscan;
+  for(int i = 0; i < kNMaxPlScan; i++) bscan.push_back(rearth * i / kNMaxPlScan);
+  for(int ilayer = 1; ilayer < nlayers; ilayer++) {
+    bscan.push_back(utils::prem::LayerInnerRadius(ilayer));
+  }
+
+  PathLengthList pl(fTgtPdgCodes);
+  vector<double>::const_iterator biter = bscan.begin();
+  for( ; biter != bscan.end(); ++biter) {
+    pl.SetAllToZero();
+    for(int ilayer = 0; ilayer < nlayers; ilayer++) {
+      double col = utils::prem::LayerColumnDensity(
+                                     ilayer, *biter, -rearth, rearth);
+      if(col <= 0) continue;
+      const map<int,double> & mix = fComposition[ilayer];
+      map<int,double>::const_iterator miter = mix.begin();
+      for( ; miter != mix.end(); ++miter) {
+        pl.AddPathLength(miter->first, col * miter->second * scale);
+      }
+    }
+    PDGCodeList::const_iterator titer = fTgtPdgCodes.begin();
+    for( ; titer != fTgtPdgCodes.end(); ++titer) {
+      if(pl.PathLength(*titer) > fMaxPathLengths.PathLength(*titer)) {
+        fMaxPathLengths.SetPathLength(*titer, pl.PathLength(*titer));
+      }
+    }
+  }
+
+  LOG("PREMGeom", pNOTICE) << fTgtPdgCodes;
+  LOG("PREMGeom", pNOTICE) << "Max path lengths: " << fMaxPathLengths;
+}
+//___________________________________________________________________________
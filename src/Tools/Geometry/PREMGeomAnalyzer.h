@@ -0,0 +1,111 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::geometry::PREMGeomAnalyzer
+
+\brief   A GeomAnalyzerI implementation for the whole Earth, with the density
+         profile of the PREM model (see genie::utils::prem) and a nuclear
+         composition for each PREM layer.
+
+         The rays are traced analytically: the density weighted path length
+         in each PREM layer is computed in closed form (the density is a
+         polynomial of the radius in each layer), instead of navigating a
+         ROOT Earth geometry step by step. Use it for atmospheric and
+         astrophysical neutrino jobs whose rays cross the Earth.
+
+         The ray positions and the generated vertices are in meters, in the
+         frame of the flux driver, in which the centre of the Earth is set
+         with SetEarthCentre() or SetDetectorDepth(). As in ROOTGeomAnalyzer,
+         the path lengths are computed as length x density x mass fraction
+         in kgr/m^2. The max path lengths are computed from a scan of the
+         straight lines through the Earth.
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _PREM_GEOMETRY_ANALYZER_H_
+#define _PREM_GEOMETRY_ANALYZER_H_
+
+#include <map>
+#include <vector>
+
+#include <TLorentzVector.h>
+#include <TVector3.h>
+
+#include "Framework/EventGen/GeomAnalyzerI.h"
+#include "Framework/EventGen/PathLengthList.h"
+#include "Framework/ParticleData/PDGCodeList.h"
+
+using std::map;
+using std::vector;
+
+namespace genie    {
+namespace geometry {
+
+class PREMGeomAnalyzer : public GeomAnalyzerI {
+
+public :
+  PREMGeomAnalyzer(const map<int,double> & tgtmix /* pdg -> mass fraction, all layers */);
+ ~PREMGeomAnalyzer();
+
+  // configure the Earth
+
+  void SetLayerComposition (int ilayer, const map<int,double> & tgtmix);
+  void SetEarthCentre      (const TVector3 & pos /* m */);
+  void SetDetectorDepth    (double depth /* m */);
+
+  const TVector3 & EarthCentre (void) const { return fEarthCentre; }
+
+  // implement the GeomAnalyzerI interface
+
+  const PDGCodeList &    ListOfTargetNuclei    (void);
+  const PathLengthList & ComputeMaxPathLengths (void);
+
+  const PathLengthList &
+           ComputePathLengths
+             (const TLorentzVector & x, const TLorentzVector & p);
+  const TVector3 &
+           GenerateVertex
+             (const TLorentzVector & x, const TLorentzVector & p, int tgtpdg);
+
+private:
+
+  /// crossing of a PREM layer by the traced ray, between the signed
+  /// distances fS0 < fS1 from the point of closest approach (std units)
+  struct Crossing {
+    int    fLayer;
+    double fS0;
+    double fS1;
+    double fColumn;  ///< integral of the density (std units)
+  };
+
+  void BuildTargetList (void);
+  void TraceRay        (const TLorentzVector & x, const TLorentzVector & p);
+
+  vector< map<int,double> > fComposition;      ///< mass fractions of each PREM layer
+  TVector3         fEarthCentre;               ///< centre of the Earth in the flux frame (m)
+  PDGCodeList      fTgtPdgCodes;               ///< list of target nuclei
+  PathLengthList   fMaxPathLengths;            ///< max path lengths (SI)
+  PathLengthList   fCurrPathLengths;           ///< path lengths of the last traced ray (SI)
+  TVector3         fCurrVertex;                ///< last generated vertex (m)
+
+  bool             fTraced;                    ///< are the crossings those of fRayX4, fRayP4?
+  TLorentzVector   fRayX4;                     ///< last traced ray position (m)
+  TLorentzVector   fRayP4;                     ///< last traced ray momentum
+  TVector3         fRayClosest;                ///< point of closest approach to the centre (m)
+  TVector3         fRayDir;                    ///< ray direction (unit vector)
+  double           fRayB;                      ///< distance of the ray from the centre (std units)
+  vector<Crossing> fCrossings;                 ///< layer crossings along the last traced ray
+};
+
+}      // geometry namespace
+}      // genie    namespace
+
+#endif // _PREM_GEOMETRY_ANALYZER_H_
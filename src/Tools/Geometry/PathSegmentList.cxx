@@ -18,6 +18,7 @@
 
 #include <TLorentzVector.h>
 #include <TGeoVolume.h>
+#include <TGeoMedium.h>
 #include <TGeoMaterial.h>
 
 #include "Tools/Geometry/PathSegmentList.h"
@@ -186,12 +187,13 @@ TVector3 PathSegment::GetPosition(Double_t fractrim) const
 //===========================================================================
 //___________________________________________________________________________
 PathSegmentList::PathSegmentList(void)
-  : fDoCrossCheck(false), fPrintVerbose(false)
+  : fNSegments(0), fDoCrossCheck(false), fPrintVerbose(false)
 {
 
 }
 //___________________________________________________________________________
 PathSegmentList::PathSegmentList(const PathSegmentList & plist)
+  : fNSegments(0)
 {
   this->Copy(plist);
 }
@@ -208,10 +210,19 @@ void PathSegmentList::SetAllToZero(void)
 
   this->fStartPos.SetXYZ(0,0,1e37); // clear cache of position/direction
   this->fDirection.SetXYZ(0,0,0);   //
-  this->fSegmentList.clear();       // clear the vector
+  this->fNSegments = 0;             // clear the list (keeping the pool)
   this->fMatStepSum.clear();        // clear the re-factorized info
 }
 
+//___________________________________________________________________________
+void PathSegmentList::AddSegment(const PathSegment& ps)
+{
+  // re-use a pooled segment (and its memory) if there is one
+  if ( fNSegments < fSegmentList.size() ) fSegmentList[fNSegments] = ps;
+  else                                    fSegmentList.push_back(ps);
+  ++fNSegments;
+}
+
 //___________________________________________________________________________
 void PathSegmentList::SetStartInfo(const TVector3& pos, const TVector3& dir)
 {
@@ -228,15 +239,41 @@ bool PathSegmentList::IsSameStart(const TVector3& pos, const TVector3& dir) cons
 //___________________________________________________________________________
 void PathSegmentList::FillMatStepSum(void)
 {
+  // forget the materials of the previous ray
+  for ( size_t i = 0; i < fMatStepSlot.size(); ++i ) fMatStepSlot[i] = -1;
   fMatStepSum.clear();
 
-  PathSegmentList::PathSegVCItr_t sitr = fSegmentList.begin();
-  PathSegmentList::PathSegVCItr_t sitr_end = fSegmentList.end();
+  const int kMaxMediumId = 100000; // look up larger (unusual) ids by material
+
+  PathSegmentList::PathSegVCItr_t sitr = this->begin();
+  PathSegmentList::PathSegVCItr_t sitr_end = this->end();
   for ( ; sitr != sitr_end ; ++sitr ) {
     const PathSegment& ps = *sitr;
     const TGeoMaterial* mat  = ps.fMaterial;
+    if ( ! mat ) continue;  // segment outside geometry has no material
+
+    // find the entry of the material: by medium id, or else by searching
+    // the (few) materials of the ray
+    int id = ( ps.fMedium ) ? ps.fMedium->GetId() : -1;
+    bool byid = ( id >= 0 && id < kMaxMediumId );
+    int slot = -1;
+    if ( byid ) {
+      if ( id >= (int)fMatStepSlot.size() ) fMatStepSlot.resize(id+1, -1);
+      slot = fMatStepSlot[id];
+    }
+    if ( slot < 0 || fMatStepSum[slot].first != mat ) {
+      slot = -1;
+      for ( size_t i = 0; i < fMatStepSum.size(); ++i ) {
+        if ( fMatStepSum[i].first == mat ) { slot = i; break; }
+      }
+      if ( slot < 0 ) {
+        slot = fMatStepSum.size();
+        fMatStepSum.push_back(std::make_pair(mat, 0.));
+      }
+      if ( byid ) fMatStepSlot[id] = slot;
+    }
     // use the post-trim limits on how much material is stepped through
-    fMatStepSum[mat] += ps.GetSummedStepRange();
+    fMatStepSum[slot].second += ps.GetSummedStepRange();
   }
 
 }
@@ -244,7 +281,7 @@ void PathSegmentList::FillMatStepSum(void)
 //___________________________________________________________________________
 void PathSegmentList::Copy(const PathSegmentList & plist)
 {
-  fSegmentList.clear();
+  fNSegments = 0;
   fMatStepSum.clear();
 
   // copy the segments
@@ -256,8 +293,10 @@ void PathSegmentList::Copy(const PathSegmentList & plist)
   // other elements
   fStartPos     = plist.fStartPos;
   fDirection    = plist.fDirection;
-  fSegmentList  = plist.fSegmentList;
+  fSegmentList.assign(plist.begin(), plist.end());
+  fNSegments    = plist.fNSegments;
   fMatStepSum   = plist.fMatStepSum;
+  fMatStepSlot  = plist.fMatStepSlot;
   fDoCrossCheck = plist.fDoCrossCheck;
   fPrintVerbose = plist.fPrintVerbose;
 }
@@ -269,8 +308,8 @@ void PathSegmentList::CrossCheck(double& mxddist, double& mxdstep) const
   double dstep, ddist;
   mxdstep = 0;
   mxddist = 0;
-  PathSegmentList::PathSegVCItr_t sitr = fSegmentList.begin();
-  PathSegmentList::PathSegVCItr_t sitr_end = fSegmentList.end();
+  PathSegmentList::PathSegVCItr_t sitr = this->begin();
+  PathSegmentList::PathSegVCItr_t sitr_end = this->end();
   for ( ; sitr != sitr_end ; ++sitr ) {
     const PathSegment& ps = *sitr;
     ps.DoCrossCheck(fStartPos,ddist,dstep);
@@ -291,8 +330,8 @@ void PathSegmentList::Print(ostream & stream) const
 
   double dstep, ddist, mxdstep = 0, mxddist = 0;
   int k = 0, nseg = 0;
-  PathSegmentList::PathSegVCItr_t sitr = fSegmentList.begin();
-  PathSegmentList::PathSegVCItr_t sitr_end = fSegmentList.end();
+  PathSegmentList::PathSegVCItr_t sitr = this->begin();
+  PathSegmentList::PathSegVCItr_t sitr_end = this->end();
   for ( ; sitr != sitr_end ; ++sitr, ++k ) {
     const PathSegment& ps = *sitr;
     ++nseg;
@@ -318,10 +357,9 @@ void PathSegmentList::Print(ostream & stream) const
            << std::endl;
 
   if ( fPrintVerbose ) {
-    PathSegmentList::MaterialMapCItr_t mitr     = GetMatStepSumMap().begin();
-    PathSegmentList::MaterialMapCItr_t mitr_end = GetMatStepSumMap().end();
-    // loop over map to get tgt weight for each material (once)
-    // steps outside the geometry may have no assigned material
+    PathSegmentList::MaterialStepVCItr_t mitr     = GetMatStepSumV().begin();
+    PathSegmentList::MaterialStepVCItr_t mitr_end = GetMatStepSumV().end();
+    // loop over the materials (each once)
     for ( ; mitr != mitr_end; ++mitr ) {
       const TGeoMaterial* mat = mitr->first;
       double sumsteps         = mitr->second;
@@ -29,10 +29,8 @@
 
 #include <utility>  // for pair<>
 #include <vector>
-#include <list>
 #include <ostream>
 #include <string>
-#include <map>
 
 #include <TVector3.h>
 class TGeoVolume;
@@ -51,7 +49,63 @@ class PathSegment;
 ostream & operator << (ostream & stream, const PathSegment & list);
 
 typedef std::pair<Double_t,Double_t> StepRange;
-typedef std::vector<StepRange>       StepRangeSet;
+
+/// Collection of {steplo,stephi} pairs of a path segment. Segments have one
+/// step range, or a few once trimmed (split by a fiducial volume), which are
+/// held inline: copying a segment does not allocate. Longer sets spill over
+/// to the heap.
+class StepRangeSet {
+
+ public:
+  typedef StepRange*       iterator;
+  typedef const StepRange* const_iterator;
+
+  StepRangeSet() : fN(0) { }
+  StepRangeSet(const StepRangeSet & srs) : fN(0) { *this = srs; }
+
+  StepRangeSet & operator = (const StepRangeSet & srs)
+  {
+    if ( this == &srs ) return *this;
+    fN = srs.fN;
+    if ( fN <= kNInline ) {
+      fOverflow.clear();
+      for ( size_t i = 0; i < fN; ++i ) fInline[i] = srs[i];
+    } else {
+      fOverflow.assign(srs.begin(), srs.end());
+    }
+    return *this;
+  }
+
+  size_t size  (void) const { return fN; }
+  bool   empty (void) const { return fN == 0; }
+  void   clear (void)       { fN = 0; fOverflow.clear(); }
+
+  void push_back(const StepRange & sr)
+  {
+    if ( fN < kNInline ) { fInline[fN++] = sr; return; }
+    if ( fN == kNInline ) fOverflow.assign(fInline, fInline + kNInline);
+    fOverflow.push_back(sr);
+    fN++;
+  }
+
+  iterator       begin (void)       { return this->data(); }
+  iterator       end   (void)       { return this->data() + fN; }
+  const_iterator begin (void) const { return this->data(); }
+  const_iterator end   (void) const { return this->data() + fN; }
+
+  StepRange &       operator [] (size_t i)       { return this->data()[i]; }
+  const StepRange & operator [] (size_t i) const { return this->data()[i]; }
+
+ private:
+  static const size_t kNInline = 4;
+
+  StepRange *       data (void)       { return fOverflow.empty() ? fInline : fOverflow.data(); }
+  const StepRange * data (void) const { return fOverflow.empty() ? fInline : fOverflow.data(); }
+
+  size_t                 fN;                  ///< number of step ranges
+  StepRange              fInline[kNInline];   ///< step ranges, if no more than kNInline
+  std::vector<StepRange> fOverflow;           ///< all the step ranges, if more than kNInline
+};
 
 class PathSegment {
 
@@ -133,22 +187,28 @@ public :
   void    SetStartInfo    (const TVector3& pos = TVector3(0,0,1e37),
                            const TVector3& dir = TVector3(0,0,0)     );
   bool    IsSameStart     (const TVector3& pos, const TVector3& dir) const;
-  void    AddSegment      (const PathSegment& ps) { fSegmentList.push_back(ps); }
+  void    AddSegment      (const PathSegment& ps);
 
   const TVector3& GetDirection() const { return fDirection; }
   const TVector3& GetStartPos() const  { return fStartPos; }
 
-  typedef std::list<PathSegment> PathSegmentV_t;
+  /// The segments are kept in a pool that is re-used from ray to ray (the
+  /// pool only grows): iterate over [begin(), end()), not over the pool
+  typedef std::vector<PathSegment> PathSegmentV_t;
   typedef PathSegmentV_t::const_iterator PathSegVCItr_t;
 
-  const   PathSegmentV_t&   GetPathSegmentV (void) const { return fSegmentList; }
-  size_t                    size(void) const { return fSegmentList.size(); }
+  PathSegVCItr_t            begin(void) const { return fSegmentList.begin(); }
+  PathSegVCItr_t            end  (void) const { return fSegmentList.begin() + fNSegments; }
+  size_t                    size (void) const { return fNSegments; }
 
-  typedef std::map<const TGeoMaterial*,Double_t> MaterialMap_t;
-  typedef MaterialMap_t::const_iterator MaterialMapCItr_t;
+  /// Summed (post-trim) step in each material crossed by the ray, in the
+  /// order the materials are first met. Segments with no material (outside
+  /// the geometry) are left out.
+  typedef std::vector< std::pair<const TGeoMaterial*,Double_t> > MaterialStepV_t;
+  typedef MaterialStepV_t::const_iterator MaterialStepVCItr_t;
 
   void                      FillMatStepSum   (void);
-  const   MaterialMap_t&    GetMatStepSumMap (void) const { return fMatStepSum; };
+  const   MaterialStepV_t&  GetMatStepSumV   (void) const { return fMatStepSum; };
 
   void                      CrossCheck(double& mxddist, double& mxdstep) const;
 
@@ -169,11 +229,16 @@ public :
   TVector3         fStartPos;  ///< starting position (in top vol coords)
   TVector3         fDirection; ///< direction (in top vol coords)
 
-  /// Actual list of segments
+  /// Actual list of segments: the first fNSegments of the pool
   PathSegmentV_t   fSegmentList;
+  size_t           fNSegments;
 
   /// Segment list re-evaluated by material for fast lookup of path lengths
-  MaterialMap_t    fMatStepSum;
+  MaterialStepV_t  fMatStepSum;
+
+  /// Position in fMatStepSum of the material of each medium (by TGeoMedium
+  /// id, -1 if not met by the current ray), see FillMatStepSum()
+  std::vector<int> fMatStepSlot;
 
   bool             fDoCrossCheck;
   bool             fPrintVerbose;
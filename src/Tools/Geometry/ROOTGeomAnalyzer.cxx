@@ -14,7 +14,9 @@
 */
 //____________________________________________________________________________
 
+#include <atomic>
 #include <cassert>
+#include <cfloat>
 #include <cstdlib>
 #include <iomanip>
 #include <set>
@@ -26,6 +28,7 @@
 #include <TGeoMaterial.h>
 #include <TGeoMatrix.h>
 #include <TGeoNode.h>
+#include <TGeoNavigator.h>
 #include <TObjArray.h>
 #include <TLorentzVector.h>
 #include <TList.h>
@@ -47,11 +50,16 @@
 #include "Framework/ParticleData/PDGCodeList.h"
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/StartupProfiler.h"
+#include "Framework/Utils/ThreadPool.h"
 
 using namespace genie;
 using namespace genie::geometry;
 using namespace genie::controls;
 
+// rays per thread swum at once by the max path-length scanners
+static const int kRayBatchSize = 1024;
+
 //#define RWH_DEBUG
 //#define RWH_DEBUG_2
 //#define RWH_COUNTVOLS
@@ -164,10 +172,15 @@ const PathLengthList & ROOTGeomAnalyzer::ComputePathLengths(
        << ", 4x (m,s) = " << utils::print::X4AsString(&x);
 #endif
 
-  // if trimming configure with neutrino ray's info
+  NavState & ns = this->CurrNavState();
+
+  // if trimming configure with neutrino ray's info (in the thread-safe
+  // mode, the shared selector is only configured right before trimming)
   if ( fGeomVolSelector ) {
-    fGeomVolSelector->SetCurrentRay(x,p);
-    fGeomVolSelector->SetSI2Local(1/this->LengthUnits());
+    if ( ! fThreadSafeNav ) {
+      fGeomVolSelector->SetCurrentRay(x,p);
+      fGeomVolSelector->SetSI2Local(1/this->LengthUnits());
+    }
   }
 
   TVector3 udir = p.Vect().Unit(); // unit vector along direction
@@ -180,16 +193,43 @@ const PathLengthList & ROOTGeomAnalyzer::ComputePathLengths(
   }
 
   // reset current list of path-lengths
-  fCurrPathLengthList->SetAllToZero();
+  ns.fPathLengthList->SetAllToZero();
+
+  // swim once and sum the weighted steps in each material for all the
+  // target nuclei at once (a material x nuclide weight matrix product)
+  ns.fRay.fX4 = x;
+  ns.fRay.fP4 = p;
+  this->SwimOnce(pos,udir);
+
+  // remember the ray for GenerateVertex()
+  ns.fRay.fSwum      = true;
+  ns.fRay.fPos       = pos;
+  ns.fRay.fDir       = udir;
+  ns.fRay.fVtxTgtPdg = 0;
+
+  int nnuc = fCurrPDGCodeList->size();
+  ns.fPathLengthSums.assign(nnuc, 0.);
+
+  PathSegmentList::MaterialStepVCItr_t mitr     =
+    ns.fPathSegmentList->GetMatStepSumV().begin();
+  PathSegmentList::MaterialStepVCItr_t mitr_end =
+    ns.fPathSegmentList->GetMatStepSumV().end();
+  for ( ; mitr != mitr_end; ++mitr ) {
+    const TGeoMaterial * mat = mitr->first;
+    if ( ! mat ) continue;  // segment outside geometry has no material
+    double step = mitr->second;
+    const double * weights = this->MaterialWeights(mat);
+    for (int inuc = 0; inuc < nnuc; inuc++) {
+      ns.fPathLengthSums[inuc] += (step*weights[inuc]);
+    }
+  }
 
-  //loop over materials & compute the path-length
-  vector<int>::iterator itr;
-  for (itr=fCurrPDGCodeList->begin();itr!=fCurrPDGCodeList->end();itr++) {
+  for (int inuc = 0; inuc < nnuc; inuc++) {
 
-    int pdgc = *itr;
+    int pdgc = (*fCurrPDGCodeList)[inuc];
 
-    Double_t pl = this->ComputePathLengthPDG(pos,udir,pdgc);
-    fCurrPathLengthList->AddPathLength(pdgc,pl);
+    Double_t pl = ns.fPathLengthSums[inuc];
+    ns.fPathLengthList->AddPathLength(pdgc,pl);
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
     LOG("GROOTGeom", pINFO)
@@ -198,9 +238,102 @@ const PathLengthList & ROOTGeomAnalyzer::ComputePathLengths(
 
   } // loop over materials
 
-  this->Local2SI(*fCurrPathLengthList); // curr geom units -> SI
+  this->Local2SI(*ns.fPathLengthList); // curr geom units -> SI
+
+  return *ns.fPathLengthList;
+}
+
+//___________________________________________________________________________
+bool ROOTGeomAnalyzer::ComputePathLengthBounds(
+     const TLorentzVector & x, const TLorentzVector & p, PathLengthList & pl)
+{
+/// Computes upper bounds of the path-lengths returned by ComputePathLengths()
+/// for the same ray, without navigating the geometry: the ray is followed
+/// through the voxel grid (3D-DDA) and, in each voxel, the chord length is
+/// weighted with the largest weight of the materials found in the voxel.
+/// Returns false if no voxel grid was built (see BuildVoxelGrid()).
+
+  if ( fVoxelWeights.empty() ) return false;
+
+  TVector3 udir = p.Vect().Unit(); // unit vector along direction
+  TVector3 pos = x.Vect();         // initial position
+  this->SI2Local(pos);             // SI -> curr geom units
+
+  if (!fMasterToTopIsIdentity) {
+    this->Master2Top(pos);         // transform position (master -> top)
+    this->Master2TopDir(udir);     // transform direction (master -> top)
+  }
+
+  NavState & ns = this->CurrNavState();
 
-  return *fCurrPathLengthList;
+  int nnuc = fCurrPDGCodeList->size();
+  ns.fPathLengthSums.assign(nnuc, 0.);
+
+  // clip the ray to the grid
+  double tmin = 0.;
+  double tmax = DBL_MAX;
+  for (int a = 0; a < 3; a++) {
+    double lo = fVoxelLo[a];
+    double hi = fVoxelLo[a] + fVoxelN[a]*fVoxelSize[a];
+    if ( udir[a] == 0 ) {
+      if ( pos[a] < lo || pos[a] > hi ) tmax = -1.;
+      continue;
+    }
+    double t1 = (lo-pos[a])/udir[a];
+    double t2 = (hi-pos[a])/udir[a];
+    tmin = TMath::Max(tmin, TMath::Min(t1,t2));
+    tmax = TMath::Min(tmax, TMath::Max(t1,t2));
+  }
+
+  if ( tmin < tmax ) {
+    // walk through the voxels crossed by the ray
+    int    ivox  [3];
+    int    istep [3];
+    double tnext [3];
+    double tdelta[3];
+    for (int a = 0; a < 3; a++) {
+      double xa = pos[a] + tmin*udir[a] - fVoxelLo[a];
+      ivox[a] = TMath::Min(fVoxelN[a]-1,
+                  TMath::Max(0, TMath::FloorNint(xa/fVoxelSize[a])));
+      if ( udir[a] == 0 ) {
+        istep[a] = 0;
+        tnext[a] = tdelta[a] = DBL_MAX;
+        continue;
+      }
+      istep [a] = (udir[a] > 0) ? 1 : -1;
+      tdelta[a] = fVoxelSize[a] / TMath::Abs(udir[a]);
+      double xnext = fVoxelLo[a] + (ivox[a] + (udir[a] > 0 ? 1 : 0))*fVoxelSize[a];
+      tnext [a] = (xnext - pos[a]) / udir[a];
+    }
+
+    double t = tmin;
+    while ( t < tmax ) {
+      int a = 0;
+      if ( tnext[1] < tnext[a] ) a = 1;
+      if ( tnext[2] < tnext[a] ) a = 2;
+      double tend  = TMath::Min(tnext[a], tmax);
+      double chord = TMath::Max(0., tend-t);
+
+      size_t iv = (size_t(ivox[2])*fVoxelN[1] + ivox[1])*fVoxelN[0] + ivox[0];
+      const double * weights = fVoxelWeights.data() + iv*nnuc;
+      for (int inuc = 0; inuc < nnuc; inuc++) {
+        ns.fPathLengthSums[inuc] += (chord*weights[inuc]);
+      }
+
+      t = tend;
+      ivox [a] += istep[a];
+      tnext[a] += tdelta[a];
+      if ( ivox[a] < 0 || ivox[a] >= fVoxelN[a] ) break;
+    }
+  }
+
+  for (int inuc = 0; inuc < nnuc; inuc++) {
+    pl[(*fCurrPDGCodeList)[inuc]] = ns.fPathLengthSums[inuc];
+  }
+
+  this->Local2SI(pl); // curr geom units -> SI
+
+  return true;
 }
 
 //___________________________________________________________________________
@@ -215,12 +348,14 @@ const TVector3 & ROOTGeomAnalyzer::GenerateVertex(
        << "Generating vtx in material: " << tgtpdg
        << " along the input neutrino direction";
 
+  NavState & ns = this->CurrNavState();
+
   int nretry = 0;
   retry:  // goto label in case of abject failure
   nretry++;
 
   // reset current interaction vertex
-  fCurrVertex->SetXYZ(0.,0.,0.);
+  ns.fVertex->SetXYZ(0.,0.,0.);
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("GROOTGeom", pDEBUG)
@@ -233,22 +368,45 @@ const TVector3 & ROOTGeomAnalyzer::GenerateVertex(
       exit(1);
   }
 
-  // calculate the max path length for the selected material starting from
-  // x and looking along the direction of p
-  TVector3 udir = p.Vect().Unit();
-  TVector3 pos = x.Vect();
-  this->SI2Local(pos);           // SI -> curr geom units
+  // re-use the path-segments of the ray of the last ComputePathLengths()
+  // call, if it is that ray, otherwise swim
+  RayContext & ray = ns.fRay;
+  TVector3 pos;
+  if ( ray.fSwum && ray.fX4 == x && ray.fP4 == p ) {
+    pos = ray.fPos;
+  } else {
+    TVector3 udir = p.Vect().Unit();
+    pos = x.Vect();
+    this->SI2Local(pos);           // SI -> curr geom units
 
-  if (!fMasterToTopIsIdentity) {
-    this->Master2Top(pos);       // transform position (master -> top)
-    this->Master2TopDir(udir);   // transform direction (master -> top)
+    if (!fMasterToTopIsIdentity) {
+      this->Master2Top(pos);       // transform position (master -> top)
+      this->Master2TopDir(udir);   // transform direction (master -> top)
+    }
+
+    if ( fGeomVolSelector && ! fThreadSafeNav ) {
+      fGeomVolSelector->SetCurrentRay(x,p);
+      fGeomVolSelector->SetSI2Local(1/this->LengthUnits());
+    }
+    ray.fX4 = x;
+    ray.fP4 = p;
+    this->SwimOnce(pos,udir);
+
+    ray.fSwum      = true;
+    ray.fPos       = pos;
+    ray.fDir       = udir;
+    ray.fVtxTgtPdg = 0;
   }
 
-  double maxwgt_dist = this->ComputePathLengthPDG(pos,udir,tgtpdg);
+  // cumulative weighted lengths along the ray for the selected material
+  if ( ray.fVtxTgtPdg != tgtpdg ) this->FillVertexTable(ray, tgtpdg);
+
+  double maxwgt_dist =
+    ( ray.fVtxCumulWeights.empty() ) ? 0. : ray.fVtxCumulWeights.back();
   if ( maxwgt_dist <= 0 ) {
     LOG("GROOTGeom", pERROR)
      << "The current trajectory does not cross the selected material!!";
-    return *fCurrVertex;
+    return *ns.fVertex;
   }
 
   // generate random number between 0 and max_dist
@@ -256,97 +414,53 @@ const TVector3 & ROOTGeomAnalyzer::GenerateVertex(
   double genwgt_dist(maxwgt_dist * rnd->RndGeom().Rndm());
 
   LOG("GROOTGeom", pINFO)
-    << "Swim mass: Top Vol dir = " << utils::print::P3AsString(&udir)
-    << ", pos = " << utils::print::Vec3AsString(&pos);
+    << "Swim mass: Top Vol dir = " << utils::print::P3AsString(&ray.fDir)
+    << ", pos = " << utils::print::Vec3AsString(&ray.fPos);
   LOG("GROOTGeom", pINFO)
      << "Max {L x Density x Weight} given (init,dir) = " << maxwgt_dist;
   LOG("GROOTGeom", pINFO)
        << "Generated 'distance' in selected material = " << genwgt_dist;
 #ifdef RWH_DEBUG
   if ( ( fDebugFlags & 0x01 ) ) {
-    fCurrPathSegmentList->SetDoCrossCheck(true);       //RWH
-    LOG("GROOTGeom", pINFO) << *fCurrPathSegmentList;  //RWH
+    ns.fPathSegmentList->SetDoCrossCheck(true);       //RWH
+    LOG("GROOTGeom", pINFO) << *ns.fPathSegmentList;  //RWH
     double mxddist = 0, mxdstep = 0;
-    fCurrPathSegmentList->CrossCheck(mxddist,mxdstep);
+    ns.fPathSegmentList->CrossCheck(mxddist,mxdstep);
     fmxddist = TMath::Max(fmxddist,mxddist);
     fmxdstep = TMath::Max(fmxdstep,mxdstep);
   }
 #endif
 
-  // compute the pdg weight for each material just once, then use a stl map
-  PathSegmentList::MaterialMap_t wgtmap;
-  PathSegmentList::MaterialMapCItr_t mitr     =
-    fCurrPathSegmentList->GetMatStepSumMap().begin();
-  PathSegmentList::MaterialMapCItr_t mitr_end =
-    fCurrPathSegmentList->GetMatStepSumMap().end();
-  // loop over map to get tgt weight for each material (once)
-  // steps outside the geometry may have no assigned material
-  for ( ; mitr != mitr_end; ++mitr ) {
-    const TGeoMaterial* mat = mitr->first;
-    double wgt = ( mat ) ? this->GetWeight(mat,tgtpdg) : 0;
-    wgtmap[mat] = wgt;
-#ifdef RWH_DEBUG
-    if ( ( fDebugFlags & 0x02 ) ) {
-      LOG("GROOTGeom", pINFO)
-        << " wgtmap[" << mat->GetName() << "] pdg " << tgtpdg << " wgt " << Form("%.6f",wgt);
-    }
-#endif
-  }
-
-  // walk down the path to pick the vertex
-  const genie::geometry::PathSegmentList::PathSegmentV_t& segments =
-    fCurrPathSegmentList->GetPathSegmentV();
-  genie::geometry::PathSegmentList::PathSegVCItr_t sitr;
-  double walked = 0;
-  for ( sitr = segments.begin(); sitr != segments.end(); ++sitr) {
-    const genie::geometry::PathSegment& seg = *sitr;
-    const TGeoMaterial* mat = seg.fMaterial;
-    double trimmed_step = seg.GetSummedStepRange();
-    double wgtstep = trimmed_step * wgtmap[mat];
-    double beyond = walked + wgtstep;
-#ifdef RWH_DEBUG
-    if ( ( fDebugFlags & 0x04 ) ) {
-      LOG("GROOTGeom", pINFO)
-        << " beyond " << beyond << " genwgt_dist " << genwgt_dist
-        << " trimmed_step " << trimmed_step << " wgtstep " << wgtstep;
-    }
-#endif
-    if ( beyond > genwgt_dist ) {
-      // the end of this segment is beyond our generation point
-#ifdef RWH_DEBUG
-      if ( ( fDebugFlags & 0x08 ) ) {
-        LOG("GROOTGeom", pINFO)
-          << "Choose vertex pos walked=" << walked
-          << " beyond=" << beyond
-          << " wgtstep " << wgtstep
-          << " ( " << trimmed_step << "*" << wgtmap[mat] << ")"
-          << " look for " << genwgt_dist
-          << " in " << seg.fVolume->GetName() << " "
-          << mat->GetName();
-      }
-#endif
-      // choose a vertex in this segment (possibly multiple steps)
-      double frac = ( genwgt_dist - walked ) / wgtstep;
-      if ( frac > 1.0 ) {
-        LOG("GROOTGeom", pWARN)
-          << "Hey, frac = " << frac << " ( > 1.0 ) "
-          << genwgt_dist << " " << walked << " " << wgtstep;
-      }
-      pos = seg.GetPosition(frac);
-      fGeometry -> SetCurrentPoint (pos[0],pos[1],pos[2]);
-      fGeometry -> FindNode();
-      LOG("GROOTGeom", pINFO)
-        << "Choose vertex position in " << seg.fVolume->GetName() << " "
-         << utils::print::Vec3AsString(&pos);
-      break;
-    }
-    walked = beyond;
+  // find the path-segment holding the vertex: the first one whose end is
+  // beyond the generated weighted distance
+  std::vector<double>::const_iterator citr =
+    std::upper_bound(ray.fVtxCumulWeights.begin(),
+                     ray.fVtxCumulWeights.end(), genwgt_dist);
+  if ( citr == ray.fVtxCumulWeights.end() ) --citr;
+  size_t iseg = citr - ray.fVtxCumulWeights.begin();
+
+  const PathSegment & seg = *(ray.fVtxSegments[iseg]);
+  double walked  = ( iseg > 0 ) ? ray.fVtxCumulWeights[iseg-1] : 0.;
+  double wgtstep = ray.fVtxCumulWeights[iseg] - walked;
+
+  // choose a vertex in this segment (possibly multiple steps)
+  double frac = ( genwgt_dist - walked ) / wgtstep;
+  if ( frac > 1.0 ) {
+    LOG("GROOTGeom", pWARN)
+      << "Hey, frac = " << frac << " ( > 1.0 ) "
+      << genwgt_dist << " " << walked << " " << wgtstep;
   }
+  pos = seg.GetPosition(frac);
+  ns.fNavigator -> SetCurrentPoint (pos[0],pos[1],pos[2]);
+  ns.fNavigator -> FindNode();
+  LOG("GROOTGeom", pINFO)
+    << "Choose vertex position in " << seg.fVolume->GetName() << " "
+     << utils::print::Vec3AsString(&pos);
 
   LOG("GROOTGeom", pNOTICE)
      << "The vertex was placed in volume: "
-     << fGeometry->GetCurrentVolume()->GetName()
-     << ", path: " << fGeometry->GetPath();
+     << ns.fNavigator->GetCurrentVolume()->GetName()
+     << ", path: " << ns.fNavigator->GetPath();
 
   // warn for any volume overshoots
   bool ok = this->FindMaterialInCurrentVol(tgtpdg);
@@ -369,14 +483,14 @@ const TVector3 & ROOTGeomAnalyzer::GenerateVertex(
 
   this->Local2SI(pos);   // curr geom units -> SI
 
-  fCurrVertex->SetXYZ(pos[0],pos[1],pos[2]);
+  ns.fVertex->SetXYZ(pos[0],pos[1],pos[2]);
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("GROOTGeom", pDEBUG)
       << "Vtx (m) = " << utils::print::Vec3AsString(&pos);
 #endif
 
-  return *fCurrVertex;
+  return *ns.fVertex;
 }
 
 //===========================================================================
@@ -436,6 +550,16 @@ void ROOTGeomAnalyzer::SetMixtureWeightsSum(double sum)
 /// compute the correct weight normalization.
 
   fMixtWghtSum = sum;
+  this->ClearWeightMatrix();
+}
+
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::SetWeightWithDensity(bool wt)
+{
+/// Weight the path lengths with the material density (default) or not.
+
+  fDensWeight = wt;
+  this->ClearWeightMatrix();
 }
 
 //___________________________________________________________________________
@@ -652,8 +776,14 @@ void ROOTGeomAnalyzer::Initialize(void)
                 << "Initializing ROOT geometry driver & setting defaults";
 
   fCurrMaxPathLengthList = 0;
-  fCurrPathLengthList    = 0;
-  fCurrPathSegmentList   = 0;
+  fNavState.fNavigator        = 0;
+  fNavState.fPathLengthList   = 0;
+  fNavState.fPathSegmentList  = 0;
+  fNavState.fTrimmedList      = 0;
+  fNavState.fVertex           = 0;
+  fThreadSafeNav         = false;
+  fVoxelN[0] = fVoxelN[1] = fVoxelN[2] = 0;
+  fSerial                = 0;
   fGeomVolSelector       = 0;
   fCurrPDGCodeList       = 0;
   fTopVolume             = 0;
@@ -683,8 +813,22 @@ void ROOTGeomAnalyzer::CleanUp(void)
 {
   LOG("GROOTGeom", pNOTICE) << "Cleaning up...";
 
-  if ( fCurrPathSegmentList   ) delete fCurrPathSegmentList;
-  if ( fCurrPathLengthList    ) delete fCurrPathLengthList;
+  std::map<std::thread::id, NavState *>::iterator itr;
+  for (itr = fThreadNavStates.begin(); itr != fThreadNavStates.end(); ++itr) {
+    NavState * ns = itr->second;
+    if ( ns == &fNavState ) continue;
+    if ( ns->fPathSegmentList ) delete ns->fPathSegmentList;
+    if ( ns->fTrimmedList     ) delete ns->fTrimmedList;
+    if ( ns->fPathLengthList  ) delete ns->fPathLengthList;
+    if ( ns->fVertex          ) delete ns->fVertex;
+    delete ns;
+  }
+  fThreadNavStates.clear();
+
+  if ( fNavState.fPathSegmentList ) delete fNavState.fPathSegmentList;
+  if ( fNavState.fTrimmedList     ) delete fNavState.fTrimmedList;
+  if ( fNavState.fPathLengthList  ) delete fNavState.fPathLengthList;
+  if ( fNavState.fVertex          ) delete fNavState.fVertex;
   if ( fCurrMaxPathLengthList ) delete fCurrMaxPathLengthList;
   if ( fCurrPDGCodeList       ) delete fCurrPDGCodeList;
   if ( fMasterToTop           ) delete fMasterToTop;
@@ -695,6 +839,8 @@ void ROOTGeomAnalyzer::Load(string filename)
 {
 /// Load the detector geometry from the input ROOT file
 ///
+  StartupTimer timer("Geometry import");
+
   LOG("GROOTGeom", pNOTICE) << "Loading geometry from: " << filename;
 
   bool is_accessible = ! (gSystem->AccessPathName( filename.c_str() ));
@@ -727,10 +873,16 @@ void ROOTGeomAnalyzer::Load(TGeoManager * gm)
   const PDGCodeList & pdglist = this->ListOfTargetNuclei();
 
   fTopVolume             = 0;
-  fCurrPathSegmentList   = new PathSegmentList();
-  fCurrPathLengthList    = new PathLengthList(pdglist);
   fCurrMaxPathLengthList = new PathLengthList(pdglist);
-  fCurrVertex            = new TVector3(0.,0.,0.);
+
+  // navigation state of the loading thread (the only one used unless
+  // thread-safe navigation is switched on)
+  fNavState.fNavigator        = fGeometry->GetCurrentNavigator();
+  if ( ! fNavState.fNavigator ) fNavState.fNavigator = fGeometry->AddNavigator();
+  fNavState.fPathSegmentList  = new PathSegmentList();
+  fNavState.fTrimmedList      = 0;
+  fNavState.fPathLengthList   = new PathLengthList(pdglist);
+  fNavState.fVertex           = new TVector3(0.,0.,0.);
 
   // ask geometry manager for its top volume
   fTopVolume = fGeometry->GetTopVolume();
@@ -761,6 +913,7 @@ void ROOTGeomAnalyzer::BuildListOfTargetNuclei(void)
 /// found in materials outside the top volume.
 
   fCurrPDGCodeList = new PDGCodeList;
+  this->ClearWeightMatrix();
 
   if (!fGeometry) {
     LOG("GROOTGeom", pFATAL) << "No ROOT geometry is loaded!!";
@@ -970,6 +1123,245 @@ double ROOTGeomAnalyzer::GetWeight(const TGeoMixture* mixt, int ielement, int pd
   return weight;
 }
 
+//___________________________________________________________________________
+int ROOTGeomAnalyzer::NuclideIndex(int pdgc) const
+{
+/// Position of the input target nucleus in the (sorted) list of target
+/// nuclei, or -1 if it is not in the list
+
+  vector<int>::const_iterator itr =
+    std::lower_bound(fCurrPDGCodeList->begin(), fCurrPDGCodeList->end(), pdgc);
+  if (itr == fCurrPDGCodeList->end() || *itr != pdgc) return -1;
+  return itr - fCurrPDGCodeList->begin();
+}
+
+//___________________________________________________________________________
+const double * ROOTGeomAnalyzer::MaterialWeights(const TGeoMaterial * mat)
+{
+/// Row of the material x nuclide weight matrix for the input material:
+/// the GetWeight() of the material for each target nucleus, in the order
+/// of the list of target nuclei. A row is computed the first time its
+/// material is met and re-used for all subsequent rays.
+/// The returned pointer is valid until the next call.
+
+  int nnuc = fCurrPDGCodeList->size();
+
+  std::map<const TGeoMaterial *, int>::const_iterator itr =
+    fWeightMatrixRows.find(mat);
+  if (itr != fWeightMatrixRows.end()) {
+     return fWeightMatrix.data() + itr->second*nnuc;
+  }
+
+  // the matrix is filled for all materials and shared (read-only) by
+  // all threads in the thread-safe mode: compute unknown rows in scratch
+  if (fThreadSafeNav) {
+     NavState & ns = this->CurrNavState();
+     ns.fWeightRow.resize(nnuc);
+     for (int inuc = 0; inuc < nnuc; inuc++) {
+        ns.fWeightRow[inuc] = this->GetWeight(mat, (*fCurrPDGCodeList)[inuc]);
+     }
+     return ns.fWeightRow.data();
+  }
+
+  int row = fWeightMatrixRows.size();
+  fWeightMatrixRows[mat] = row;
+  fWeightMatrix.resize((row+1)*nnuc, 0.);
+  for (int inuc = 0; inuc < nnuc; inuc++) {
+     fWeightMatrix[row*nnuc+inuc] =
+       this->GetWeight(mat, (*fCurrPDGCodeList)[inuc]);
+  }
+  return fWeightMatrix.data() + row*nnuc;
+}
+
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::ClearWeightMatrix(void)
+{
+/// Forget the material weights (eg after a change of the weighting options)
+
+  fWeightMatrix.clear();
+  fWeightMatrixRows.clear();
+
+  // the voxel grid is built from the weights
+  fVoxelWeights.clear();
+}
+
+//___________________________________________________________________________
+ROOTGeomAnalyzer::NavState & ROOTGeomAnalyzer::CurrNavState(void)
+{
+/// Navigation state of the calling thread: the navigator and the scratch
+/// path-segment / path-length lists and vertex used by the analyzer.
+/// There is a single state unless thread-safe navigation is switched on.
+
+  if ( ! fThreadSafeNav ) return fNavState;
+
+  // cache the state of the last analyzer used in this thread
+  static thread_local unsigned long tl_serial = 0;
+  static thread_local NavState *    tl_state  = 0;
+  if ( tl_serial == fSerial ) return *tl_state;
+
+  std::lock_guard<std::mutex> lock(fNavMutex);
+
+  NavState * & ns = fThreadNavStates[std::this_thread::get_id()];
+  if ( ! ns ) {
+    ns = new NavState;
+    ns->fNavigator        = fGeometry->AddNavigator();
+    ns->fPathSegmentList  = new PathSegmentList();
+    ns->fTrimmedList      = 0;
+    ns->fPathLengthList   = new PathLengthList(*fCurrPDGCodeList);
+    ns->fVertex           = new TVector3(0.,0.,0.);
+    LOG("GROOTGeom", pINFO) << "Created a geometry navigator for a new thread";
+  }
+  tl_serial = fSerial;
+  tl_state  = ns;
+  return *ns;
+}
+
+//___________________________________________________________________________
+bool ROOTGeomAnalyzer::SetThreadSafeNavigation(int max_threads)
+{
+/// Allow ComputePathLengths() and GenerateVertex() to be called concurrently
+/// by up to max_threads threads. Each thread then gets its own TGeoNavigator
+/// and scratch buffers, while the (immutable) geometry, the max path-lengths
+/// and the material weights are shared.
+/// Call it once the analyzer is fully configured (weighting options, top
+/// volume, volume selector). It is switched on by ComputeMaxPathLengths()
+/// when the GENIE thread pool has more than one thread.
+/// The volume selector, if any, is shared and serializes the trimming.
+/// Always returns true: this analyzer supports concurrent swims.
+
+  if ( max_threads < 2 || fThreadSafeNav ) return true;
+
+  LOG("GROOTGeom", pNOTICE)
+    << "Switching on thread-safe navigation for up to "
+    << max_threads << " threads";
+
+  fGeometry->SetMaxThreads(max_threads);
+
+  // fill the material weights, shared read-only by the threads
+  TIter next(fGeometry->GetListOfMaterials());
+  TGeoMaterial * mat = 0;
+  while ( (mat = dynamic_cast<TGeoMaterial *>(next())) ) {
+    this->MaterialWeights(mat);
+  }
+
+  // the loading thread keeps its current state
+  fThreadNavStates[std::this_thread::get_id()] = &fNavState;
+
+  static std::atomic<unsigned long> serial(0);
+  fSerial = ++serial;
+
+  fThreadSafeNav = true;
+
+  return true;
+}
+
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::BuildVoxelGrid(int nx, int ny, int nz, int nsub)
+{
+/// Builds a grid of nx x ny x nz voxels over the bounding box of the top
+/// volume, holding for each voxel and target nucleus the largest weight
+/// (see GetWeight()) of the materials found in the voxel. It is used by
+/// ComputePathLengthBounds() and takes nx*ny*nz*(target nuclei) doubles.
+/// The materials of each voxel are found by swimming nsub x nsub lines per
+/// voxel face along each axis: a material thinner than 1/nsub of the voxel
+/// size in two directions can be missed (like the max path-length scans,
+/// the grid is a sampling of the geometry).
+/// Call it after the weighting options and the top volume are set (it is
+/// cleared when they change). The volume selector is ignored: trimming can
+/// only shorten the path lengths.
+
+  if ( nx < 1 || ny < 1 || nz < 1 || nsub < 1 ) {
+    LOG("GROOTGeom", pWARN)
+      << "Invalid voxel grid: " << nx << " x " << ny << " x " << nz
+      << " (" << nsub << " lines / voxel side)";
+    return;
+  }
+
+  TGeoBBox * box = (TGeoBBox *) fTopVolume->GetShape();
+  const double   half[3] = { box->GetDX(), box->GetDY(), box->GetDZ() };
+  const double * orig    = box->GetOrigin();
+
+  fVoxelN[0] = nx;
+  fVoxelN[1] = ny;
+  fVoxelN[2] = nz;
+  for (int a = 0; a < 3; a++) {
+    fVoxelLo  [a] = orig[a] - half[a];
+    fVoxelSize[a] = 2*half[a] / fVoxelN[a];
+  }
+
+  const int nnuc = fCurrPDGCodeList->size();
+  fVoxelWeights.assign(size_t(nx)*ny*nz*nnuc, 0.);
+
+  LOG("GROOTGeom", pNOTICE)
+    << "Building a " << nx << " x " << ny << " x " << nz
+    << " voxel grid of the top volume (" << nsub << " x " << nsub
+    << " lines / voxel face)";
+
+  // swim untrimmed lines
+  GeomVolSelectorI * selector = fGeomVolSelector;
+  fGeomVolSelector = 0;
+
+  ThreadPool * pool = ThreadPool::Instance();
+  if ( pool->NThreads() > 1 ) {
+    this->SetThreadSafeNavigation(pool->NThreads());
+  }
+
+  for (int a = 0; a < 3; a++) {
+    const int b = (a+1) % 3;
+    const int c = (a+2) % 3;
+    // the lines along axis a through a column of voxels only fill the
+    // voxels of that column: the columns are scanned concurrently
+    pool->ParallelFor(fVoxelN[b]*fVoxelN[c], [&] (int icol, unsigned int /*worker*/) {
+      int ivox[3];
+      ivox[b] = icol % fVoxelN[b];
+      ivox[c] = icol / fVoxelN[b];
+
+      TVector3 udir(0,0,0);
+      udir[a] = 1.;
+      TVector3 r0;
+      r0[a] = fVoxelLo[a] - 0.5*fVoxelSize[a]; // start outside the top volume
+
+      for (int jb = 0; jb < nsub; jb++) {
+        for (int jc = 0; jc < nsub; jc++) {
+          r0[b] = fVoxelLo[b] + (ivox[b] + (jb+0.5)/nsub)*fVoxelSize[b];
+          r0[c] = fVoxelLo[c] + (ivox[c] + (jc+0.5)/nsub)*fVoxelSize[c];
+
+          this->SwimOnce(r0,udir);
+
+          const PathSegmentList * segments =
+            this->CurrNavState().fPathSegmentList;
+          PathSegmentList::PathSegVCItr_t sitr = segments->begin();
+          for ( ; sitr != segments->end(); ++sitr) {
+            const PathSegment & ps = *sitr;
+            if ( ! ps.fMaterial || ps.IsTrimmedEmpty() ) continue;
+
+            double lo = r0[a] + ps.fRayDist - fVoxelLo[a];
+            double hi = lo + ps.fStepLength;
+            int i0 = TMath::Max(0,
+                       TMath::FloorNint(lo/fVoxelSize[a]));
+            int i1 = TMath::Min(fVoxelN[a]-1,
+                       TMath::FloorNint(hi/fVoxelSize[a]));
+
+            const double * weights = this->MaterialWeights(ps.fMaterial);
+            for (ivox[a] = i0; ivox[a] <= i1; ivox[a]++) {
+              size_t iv =
+                (size_t(ivox[2])*fVoxelN[1] + ivox[1])*fVoxelN[0] + ivox[0];
+              double * vw = fVoxelWeights.data() + iv*nnuc;
+              for (int inuc = 0; inuc < nnuc; inuc++) {
+                vw[inuc] = TMath::Max(vw[inuc], weights[inuc]);
+              }
+            }
+          } // path segments
+        }
+      }
+      // don't leave untrimmed lists in the swim cache
+      this->CurrNavState().fPathSegmentList->SetAllToZero();
+    });
+  }
+
+  fGeomVolSelector = selector;
+}
+
 //___________________________________________________________________________
 void ROOTGeomAnalyzer::MaxPathLengthsFluxMethod(void)
 {
@@ -980,7 +1372,6 @@ void ROOTGeomAnalyzer::MaxPathLengthsFluxMethod(void)
                << "Computing the maximum path lengths using the FLUX method";
 
   int iparticle = 0;
-  PathLengthList::const_iterator pl_iter;
 
   const int nparticles = abs(this->ScannerNParticles());
 
@@ -994,43 +1385,41 @@ void ROOTGeomAnalyzer::MaxPathLengthsFluxMethod(void)
       << "max path lengths with FLUX method forcing Enu=" << emax;
   }
 
+  // The flux driver is not thread-safe: the neutrinos are generated in
+  // batches by the calling thread and only swum in parallel.
+  // A batch never exceeds the number of rays still to enter the detector,
+  // so exactly the same flux neutrinos are used as in a serial scan.
+  const int nnuc   = fCurrMaxPathLengthList->size();
+  const int nbatch = kRayBatchSize * ThreadPool::Instance()->NThreads();
+  std::vector<TLorentzVector> x4(nbatch), p4(nbatch);
+  std::vector<double> pl;
+
   while (iparticle < nparticles ) {
 
-    bool ok = fFlux->GenerateNext();
-    if (!ok) {
-       LOG("GROOTGeom", pWARN) << "Couldn't generate a flux neutrino";
-       continue;
-    }
+    int nrays = 0;
+    while (nrays < TMath::Min(nbatch, nparticles-iparticle)) {
+      bool ok = fFlux->GenerateNext();
+      if (!ok) {
+         LOG("GROOTGeom", pWARN) << "Couldn't generate a flux neutrino";
+         continue;
+      }
 
-    TLorentzVector   nup4  = fFlux->Momentum();
-    if ( rescale_e ) {
-      double ecurr = nup4.E();
-      if ( ecurr > 0 ) nup4 *= (emax/ecurr);
+      TLorentzVector   nup4  = fFlux->Momentum();
+      if ( rescale_e ) {
+        double ecurr = nup4.E();
+        if ( ecurr > 0 ) nup4 *= (emax/ecurr);
+      }
+      x4[nrays] = fFlux->Position();
+      p4[nrays] = nup4;
+      nrays++;
     }
-    const TLorentzVector & nux4  = fFlux->Position();
-
-    //LOG("GMCJDriver", pNOTICE)
-    //   << "\n [-] Generated flux neutrino: "
-    //   << "\n  |----o 4-momentum : " << utils::print::P4AsString(&nup4)
-    //   << "\n  |----o 4-position : " << utils::print::X4AsString(&nux4);
-
-    const PathLengthList & pl = this->ComputePathLengths(nux4, nup4);
-
-    bool enters = false;
-
-    for (pl_iter = pl.begin(); pl_iter != pl.end(); ++pl_iter) {
-       int    pdgc       = pl_iter->first;
-       double pathlength = pl_iter->second;
 
-       if ( pathlength > 0 ) {
-          pathlength *= (this->MaxPlSafetyFactor());
+    this->SwimRays(nrays, x4, p4, pl);
 
-          pathlength = TMath::Max(pathlength, fCurrMaxPathLengthList->PathLength(pdgc));
-          fCurrMaxPathLengthList->SetPathLength(pdgc,pathlength);
-          enters = true;
-       }
+    for (int iray = 0; iray < nrays; iray++) {
+      bool enters = this->UpdateMaxPathLengths(pl.data() + iray*nnuc);
+      if (enters) iparticle++;
     }
-    if (enters) iparticle++;
   }
 }
 
@@ -1048,31 +1437,28 @@ void ROOTGeomAnalyzer::MaxPathLengthsBoxMethod(void)
 #endif
 
   int  iparticle = 0;
-  bool ok = true;
-  TLorentzVector nux4;
-  TLorentzVector nup4;
-
-  PathLengthList::const_iterator pl_iter;
-
-  while ( (ok = this->GenBoxRay(iparticle++,nux4,nup4)) ) {
-
-    //LOG("GMCJDriver", pNOTICE)
-    //  << "\n [-] Generated flux neutrino: "
-    //  << "\n  |----o 4-momentum : " << utils::print::P4AsString(&nup4)
-    //  << "\n  |----o 4-position : " << utils::print::X4AsString(&nux4);
-
-    const PathLengthList & pllst = this->ComputePathLengths(nux4, nup4);
-
-    for (pl_iter = pllst.begin(); pl_iter != pllst.end(); ++pl_iter) {
-       int    pdgc = pl_iter->first;
-       double pl   = pl_iter->second;
+  bool more = true;
+
+  // The rays are generated in batches by the calling thread, from the
+  // geometry random number stream as in a serial scan, and swum in parallel.
+  // The maxima therefore do not depend on the number of threads.
+  const int nnuc   = fCurrMaxPathLengthList->size();
+  const int nbatch = kRayBatchSize * ThreadPool::Instance()->NThreads();
+  std::vector<TLorentzVector> x4(nbatch), p4(nbatch);
+  std::vector<double> pl;
+
+  while ( more ) {
+
+    int nrays = 0;
+    while ( nrays < nbatch &&
+            (more = this->GenBoxRay(iparticle++,x4[nrays],p4[nrays])) ) {
+      nrays++;
+    }
 
-       if (pl>0) {
-          pl *= (this->MaxPlSafetyFactor());
+    this->SwimRays(nrays, x4, p4, pl);
 
-          pl = TMath::Max(pl, fCurrMaxPathLengthList->PathLength(pdgc));
-          fCurrMaxPathLengthList->SetPathLength(pdgc,pl);
-       }
+    for (int iray = 0; iray < nrays; iray++) {
+      this->UpdateMaxPathLengths(pl.data() + iray*nnuc);
     }
   }
 
@@ -1106,6 +1492,53 @@ void ROOTGeomAnalyzer::MaxPathLengthsBoxMethod(void)
 
 }
 
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::SwimRays(int nrays,
+      const std::vector<TLorentzVector> & x4,
+      const std::vector<TLorentzVector> & p4, std::vector<double> & pl)
+{
+/// Computes the path lengths of the first nrays input rays, over the threads
+/// of the GENIE thread pool. The path length of the ith ray in the kth
+/// material of the max path-length list is returned in pl[i*nnuc+k].
+
+  const int nnuc = fCurrMaxPathLengthList->size();
+  pl.assign(nrays*nnuc, 0.);
+
+  ThreadPool * pool = ThreadPool::Instance();
+  if ( pool->NThreads() > 1 ) {
+    this->SetThreadSafeNavigation(pool->NThreads());
+  }
+
+  pool->ParallelFor(nrays, [&] (int iray, unsigned int /*worker*/) {
+    const PathLengthList & pllst = this->ComputePathLengths(x4[iray], p4[iray]);
+    double * row = pl.data() + iray*nnuc;
+    PathLengthList::const_iterator pl_iter = pllst.begin();
+    for ( ; pl_iter != pllst.end(); ++pl_iter) {
+      *row++ = pl_iter->second;
+    }
+  });
+}
+
+//___________________________________________________________________________
+bool ROOTGeomAnalyzer::UpdateMaxPathLengths(const double * pl)
+{
+/// Raises the max path-lengths to the (safety factor scaled) path lengths
+/// of a ray, given in the order of the max path-length list.
+/// Returns true if the ray entered any material.
+
+  bool enters = false;
+
+  PathLengthList::iterator pl_iter = fCurrMaxPathLengthList->begin();
+  for ( ; pl_iter != fCurrMaxPathLengthList->end(); ++pl_iter, ++pl) {
+     if (*pl > 0) {
+        double plmax = (*pl) * (this->MaxPlSafetyFactor());
+        pl_iter->second = TMath::Max(plmax, pl_iter->second);
+        enters = true;
+     }
+  }
+  return enters;
+}
+
 //___________________________________________________________________________
 bool ROOTGeomAnalyzer::GenBoxRay(int indx, TLorentzVector& x4, TLorentzVector& p4)
 {
@@ -1298,23 +1731,28 @@ double ROOTGeomAnalyzer::ComputePathLengthPDG(
 
   this->SwimOnce(r0,udir);
 
+  NavState & ns = this->CurrNavState();
+
   double step   = 0;
   double weight = 0;
 
+  int inuc = this->NuclideIndex(pdgc);
+
   //  const TGeoVolume   * vol = 0;
   //  const TGeoMedium   * med = 0;
   const TGeoMaterial * mat = 0;
 
   // loop over independent materials, which is shorter or equal to # of volumes
-  PathSegmentList::MaterialMapCItr_t itr     =
-    fCurrPathSegmentList->GetMatStepSumMap().begin();
-  PathSegmentList::MaterialMapCItr_t itr_end =
-    fCurrPathSegmentList->GetMatStepSumMap().end();
+  PathSegmentList::MaterialStepVCItr_t itr     =
+    ns.fPathSegmentList->GetMatStepSumV().begin();
+  PathSegmentList::MaterialStepVCItr_t itr_end =
+    ns.fPathSegmentList->GetMatStepSumV().end();
   for ( ; itr != itr_end; ++itr ) {
     mat  = itr->first;
     if ( ! mat ) continue;  // segment outside geometry has no material
     step = itr->second;
-    weight = this->GetWeight(mat,pdgc);
+    weight = ( inuc < 0 ) ? this->GetWeight(mat,pdgc) :
+                            this->MaterialWeights(mat)[inuc];
     pl += (step*weight);
   }
 
@@ -1326,6 +1764,42 @@ double ROOTGeomAnalyzer::ComputePathLengthPDG(
   return pl;
 }
 
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::FillVertexTable(RayContext & ray, int pdgc)
+{
+/// Fill the vertex placement table of the ray for the material with
+/// pdg-code = pdgc: the weighted length (path length x weight) from the
+/// start of the ray up to the end of each path-segment crossing a material,
+/// so that GenerateVertex() picks the segment of a vertex by binary search.
+/// The table is kept (for retries and further vertices of the same ray)
+/// until the current list of path-segments changes.
+
+  NavState & ns = this->CurrNavState();
+
+  ray.fVtxSegments.clear();
+  ray.fVtxCumulWeights.clear();
+
+  int inuc = this->NuclideIndex(pdgc);
+
+  double walked = 0;
+  const PathSegmentList * segments = ns.fPathSegmentList;
+  PathSegmentList::PathSegVCItr_t sitr = segments->begin();
+  for ( ; sitr != segments->end(); ++sitr) {
+    const PathSegment & seg = *sitr;
+    const TGeoMaterial * mat = seg.fMaterial;
+    if ( ! mat ) continue;  // segment outside geometry has no material
+    double wgt = ( inuc < 0 ) ? this->GetWeight(mat,pdgc) :
+                                this->MaterialWeights(mat)[inuc];
+    double wgtstep = seg.GetSummedStepRange() * wgt;
+    if ( wgtstep <= 0 ) continue;
+    walked += wgtstep;
+    ray.fVtxSegments.push_back(&seg);
+    ray.fVtxCumulWeights.push_back(walked);
+  }
+
+  ray.fVtxTgtPdg = pdgc;
+}
+
 //________________________________________________________________________
 void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
 {
@@ -1335,16 +1809,26 @@ void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
 
   int nvolswim = 0; //rwh
 
-  if ( ! fCurrPathSegmentList ) fCurrPathSegmentList = new PathSegmentList();
+  NavState & ns = this->CurrNavState();
+
+  if ( ! ns.fPathSegmentList ) ns.fPathSegmentList = new PathSegmentList();
 
   // don't swim if the current PathSegmentList is up-to-date
-  if ( fCurrPathSegmentList->IsSameStart(r0,udir) ) return;
+  if ( ns.fPathSegmentList->IsSameStart(r0,udir) ) return;
+
+  // the list no longer corresponds to the ray of ComputePathLengths()
+  ns.fRay.fSwum      = false;
+  ns.fRay.fVtxTgtPdg = 0;
 
   // start fresh
-  fCurrPathSegmentList->SetAllToZero();
+  ns.fPathSegmentList->SetAllToZero();
 
   // set start info so next time we don't swim for the same ray
-  fCurrPathSegmentList->SetStartInfo(r0,udir);
+  ns.fPathSegmentList->SetStartInfo(r0,udir);
+
+  // don't swim at all if the volume selector would reject the whole ray
+  // (eg. a ray missing the fiducial volume): leave the list empty
+  if ( fGeomVolSelector && fGeomVolSelector->RejectsRay(r0,udir) ) return;
 
   PathSegment ps_curr;
 
@@ -1368,38 +1852,38 @@ void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
     << "] udir [" << udir[0] << "," << udir[1] << "," << udir[2];
 #endif
 
-  fGeometry -> SetCurrentDirection (udir[0],udir[1],udir[2]);
-  fGeometry -> SetCurrentPoint     (r0[0],  r0[1],  r0[2]  );
+  ns.fNavigator -> SetCurrentDirection (udir[0],udir[1],udir[2]);
+  ns.fNavigator -> SetCurrentPoint     (r0[0],  r0[1],  r0[2]  );
 
   while (!found_vol || keep_on) {
      keep_on = true;
 
-     fGeometry->FindNode();
+     ns.fNavigator->FindNode();
 
-     ps_curr.SetEnter( fGeometry->GetCurrentPoint() , raydist );
-     vol = fGeometry->GetCurrentVolume();
+     ps_curr.SetEnter( ns.fNavigator->GetCurrentPoint() , raydist );
+     vol = ns.fNavigator->GetCurrentVolume();
      med = vol->GetMedium();
      mat = med->GetMaterial();
      ps_curr.SetGeo(vol,med,mat);
 #ifdef PATHSEG_KEEP_PATH
-     if (fill_path) ps_curr.SetPath(fGeometry->GetPath());
+     if (fill_path) ps_curr.SetPath(ns.fNavigator->GetPath());
 #endif
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
 #ifdef DUMP_SWIM
        LOG("GROOTGeom", pDEBUG) << "Current volume: " << vol->GetName()
-                             << " pos " << fGeometry->GetCurrentPoint()[0]
-                             << " "     << fGeometry->GetCurrentPoint()[1]
-                             << " "     << fGeometry->GetCurrentPoint()[2]
-                             << " dir " << fGeometry->GetCurrentDirection()[0]
-                             << " "     << fGeometry->GetCurrentDirection()[1]
-                             << " "     << fGeometry->GetCurrentDirection()[2]
-                             << "[path: " << fGeometry->GetPath() << "]";
+                             << " pos " << ns.fNavigator->GetCurrentPoint()[0]
+                             << " "     << ns.fNavigator->GetCurrentPoint()[1]
+                             << " "     << ns.fNavigator->GetCurrentPoint()[2]
+                             << " dir " << ns.fNavigator->GetCurrentDirection()[0]
+                             << " "     << ns.fNavigator->GetCurrentDirection()[1]
+                             << " "     << ns.fNavigator->GetCurrentDirection()[2]
+                             << "[path: " << ns.fNavigator->GetPath() << "]";
 #endif
 #endif
 
      // find the start of top
-     if (fGeometry->IsOutside() || !vol) {
+     if (ns.fNavigator->IsOutside() || !vol) {
         keep_on = false;
         if (found_vol) break;
         step = 0;
@@ -1413,7 +1897,7 @@ void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
 #endif
 #endif
 
-        while (!fGeometry->IsEntering()) {
+        while (!ns.fNavigator->IsEntering()) {
           step = this->Step();
           raydist += step;
 #ifdef RWH_DEBUG
@@ -1439,12 +1923,12 @@ void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
                   << " p [" << udir[0] << "," << udir[1] << "," << udir[2] << "]";
             }
 #endif
-            fCurrPathSegmentList->SetAllToZero();
+            ns.fPathSegmentList->SetAllToZero();
             return;
           }
         } // finished while
 
-        ps_curr.SetExit(fGeometry->GetCurrentPoint());
+        ps_curr.SetExit(ns.fNavigator->GetCurrentPoint());
         ps_curr.SetStep(step);
         if ( ( fDebugFlags & 0x10 ) ) {
           // In general don't add the path segments from the start point to
@@ -1453,7 +1937,7 @@ void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
           ps_curr.fStepRangeSet.clear();
           LOG("GROOTGeom", pNOTICE)
             << "debug: step towards top volume: " << ps_curr;
-          fCurrPathSegmentList->AddSegment(ps_curr);
+          ns.fPathSegmentList->AddSegment(ps_curr);
         }
 
      }  // outside or !vol
@@ -1464,9 +1948,9 @@ void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
        step   = this->StepUntilEntering();
        raydist += step;
 
-       ps_curr.SetExit(fGeometry->GetCurrentPoint());
+       ps_curr.SetExit(ns.fNavigator->GetCurrentPoint());
        ps_curr.SetStep(step);
-       fCurrPathSegmentList->AddSegment(ps_curr);
+       ns.fPathSegmentList->AddSegment(ps_curr);
 
        nvolswim++; //rwh
 
@@ -1489,7 +1973,7 @@ void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
     nswims[curface]++;   //rwh
     dnvols[curface]  += (double)nvolswim;
     dnvols2[curface] += (double)nvolswim * (double)nvolswim;
-    long int ns = fCurrPathSegmentList->size();
+    long int ns = ns.fPathSegmentList->size();
     if ( ns > mxsegments ) mxsegments = ns;
   }
 #endif
@@ -1497,15 +1981,15 @@ void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
 //rwh:debug
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("GROOTGeom", pDEBUG)
-    << "PathSegmentList size " << fCurrPathSegmentList->size();
+    << "PathSegmentList size " << ns.fPathSegmentList->size();
 #endif
 
 #ifdef RWH_DEBUG_2
   if ( ( fDebugFlags & 0x20 ) ) {
-    fCurrPathSegmentList->SetDoCrossCheck(true);       //RWH
-    LOG("GROOTGeom", pNOTICE) << "Before trimming" << *fCurrPathSegmentList;
+    ns.fPathSegmentList->SetDoCrossCheck(true);       //RWH
+    LOG("GROOTGeom", pNOTICE) << "Before trimming" << *ns.fPathSegmentList;
     double mxddist = 0, mxdstep = 0;
-    fCurrPathSegmentList->CrossCheck(mxddist,mxdstep);
+    ns.fPathSegmentList->CrossCheck(mxddist,mxdstep);
     fmxddist = TMath::Max(fmxddist,mxddist);
     fmxdstep = TMath::Max(fmxdstep,mxdstep);
   }
@@ -1513,21 +1997,29 @@ void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
 
   // PathSegmentList trimming occurs here!
   if ( fGeomVolSelector ) {
-    PathSegmentList* altlist =
-      fGeomVolSelector->GenerateTrimmedList(fCurrPathSegmentList);
-    std::swap(altlist,fCurrPathSegmentList);
-    delete altlist;  // after swap delete original
+    // the selector is shared by all threads in the thread-safe mode
+    std::unique_lock<std::mutex> lock(fSelectorMutex, std::defer_lock);
+    if ( fThreadSafeNav ) {
+      lock.lock();
+      fGeomVolSelector->SetCurrentRay(ns.fRay.fX4,ns.fRay.fP4);
+      fGeomVolSelector->SetSI2Local(1/this->LengthUnits());
+    }
+    // fill the spare list & swap it in: the original list becomes the spare
+    // one, so that the segments of both are re-used by the following rays
+    if ( ! ns.fTrimmedList ) ns.fTrimmedList = new PathSegmentList();
+    fGeomVolSelector->GenerateTrimmedList(ns.fPathSegmentList,ns.fTrimmedList);
+    std::swap(ns.fTrimmedList,ns.fPathSegmentList);
   }
 
-  fCurrPathSegmentList->FillMatStepSum();
+  ns.fPathSegmentList->FillMatStepSum();
 
 #ifdef RWH_DEBUG_2
   if ( fGeomVolSelector) {
     // after FillMatStepSum() so one can see the summed mass
     if ( ( fDebugFlags & 0x40 ) ) {
-      fCurrPathSegmentList->SetPrintVerbose(true);
-      LOG("GROOTGeom", pNOTICE) << "After  trimming" << *fCurrPathSegmentList;
-      fCurrPathSegmentList->SetPrintVerbose(false);
+      ns.fPathSegmentList->SetPrintVerbose(true);
+      LOG("GROOTGeom", pNOTICE) << "After  trimming" << *ns.fPathSegmentList;
+      ns.fPathSegmentList->SetPrintVerbose(false);
     }
   }
 #endif
@@ -1539,7 +2031,7 @@ void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
 //___________________________________________________________________________
 bool ROOTGeomAnalyzer::FindMaterialInCurrentVol(int tgtpdg)
 {
-  TGeoVolume * vol = fGeometry -> GetCurrentVolume();
+  TGeoVolume * vol = this->Navigator() -> GetCurrentVolume();
   if(vol) {
     TGeoMaterial * mat = vol->GetMedium()->GetMaterial();
     if(mat->IsMixture()) {
@@ -1561,15 +2053,15 @@ bool ROOTGeomAnalyzer::FindMaterialInCurrentVol(int tgtpdg)
 //___________________________________________________________________________
 double ROOTGeomAnalyzer::StepToNextBoundary(void)
 {
-  fGeometry->FindNextBoundary();
-  double step=fGeometry->GetStep();
+  this->Navigator()->FindNextBoundary();
+  double step=this->Navigator()->GetStep();
   return step;
 }
 //___________________________________________________________________________
 double ROOTGeomAnalyzer::Step(void)
 {
-  fGeometry->Step();
-  double step=fGeometry->GetStep();
+  this->Navigator()->Step();
+  double step=this->Navigator()->GetStep();
   return step;
 }
 //___________________________________________________________________________
@@ -1578,14 +2070,14 @@ double ROOTGeomAnalyzer::StepUntilEntering(void)
   this->StepToNextBoundary();  // doesn't actually step, so don't include in sum
   double step = 0; //
 
-  while(!fGeometry->IsEntering()) {
+  while(!this->Navigator()->IsEntering()) {
     step += this->Step();
   }
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
 
-  bool isen = fGeometry->IsEntering();
-  bool isob = fGeometry->IsOnBoundary();
+  bool isen = this->Navigator()->IsEntering();
+  bool isob = this->Navigator()->IsOnBoundary();
 
   LOG("GROOTGeom",pDEBUG)
       << "IsEntering = "     << utils::print::BoolAsYNString(isen)
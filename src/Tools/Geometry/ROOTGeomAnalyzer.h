@@ -27,8 +27,13 @@
 
 #include <string>
 #include <algorithm>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include <TGeoManager.h>
+#include <TLorentzVector.h>
 #include <TVector3.h>
 
 #include "Framework/EventGen/GeomAnalyzerI.h"
@@ -39,6 +44,7 @@ class TGeoMaterial;
 class TGeoMixture;
 class TGeoElement;
 class TGeoHMatrix;
+class TGeoNavigator;
 
 using std::string;
 
@@ -48,6 +54,7 @@ class GFluxI;
 
 namespace geometry {
 
+class PathSegment;
 class PathSegmentList;
 class GeomVolSelectorI;
 
@@ -68,6 +75,8 @@ public :
                                                      const TLorentzVector & p);
   virtual const  TVector3 &       GenerateVertex(const TLorentzVector & x,
                                                  const TLorentzVector & p, int tgtpdg);
+  virtual bool                    ComputePathLengthBounds(const TLorentzVector & x,
+                                                          const TLorentzVector & p, PathLengthList & pl);
 
   /// set geometry driver's configuration options
 
@@ -75,7 +84,7 @@ public :
   virtual void SetScannerNRays      (int    nr) { fNRays      = nr; } /* box  scanner */
   virtual void SetScannerNParticles (int    np) { fNParticles = np; } /* flux scanner */
   virtual void SetScannerFlux       (GFluxI* f) { fFlux       = f;  } /* flux scanner */
-  virtual void SetWeightWithDensity (bool   wt) { fDensWeight = wt; }
+  virtual void SetWeightWithDensity (bool   wt);
   virtual void SetMixtureWeightsSum (double sum);
   virtual void SetLengthUnits       (double lu);
   virtual void SetDensityUnits      (double du);
@@ -83,6 +92,8 @@ public :
   virtual void SetTopVolName        (string nm);
   virtual void SetKeepSegPath       (bool keep) { fKeepSegPath = keep; }
   virtual void SetDebugFlags        (int  flgs) { fDebugFlags  = flgs; }
+  virtual bool SetThreadSafeNavigation (int max_threads);
+  virtual void BuildVoxelGrid       (int nx, int ny, int nz, int nsub = 4);
 
   /// retrieve geometry driver's configuration options
 
@@ -97,6 +108,8 @@ public :
   virtual string        TopVolName        (void) const { return fTopVolumeName;     }
   virtual TGeoManager * GetGeometry       (void) const { return fGeometry;          }
   virtual bool          GetKeepSegPath    (void) const { return fKeepSegPath;       }
+  virtual bool          ThreadSafeNavigation (void) const { return fThreadSafeNav;  }
+  virtual bool          HasVoxelGrid      (void) const { return ! fVoxelWeights.empty(); }
   virtual const PathLengthList& GetMaxPathLengths(void) const { return *fCurrMaxPathLengthList; } // call only after ComputeMaxPathLengths() has been called
 
   /// access to geometry coordinate/unit transforms for validation/test purposes
@@ -117,6 +130,35 @@ public :
 
 protected:
 
+  /// ray of the last ComputePathLengths() call, kept so that GenerateVertex()
+  /// re-uses its path-segments, and the vertex placement table built from them
+  struct RayContext {
+    RayContext() : fSwum(false), fVtxTgtPdg(0) { }
+    bool                fSwum;             ///< is the current list of path-segments that of this ray?
+    TLorentzVector      fX4;               ///< ray start, as input (master coord, SI)
+    TLorentzVector      fP4;               ///< ray momentum, as input (master coord)
+    TVector3            fPos;              ///< ray start (top vol coord & units)
+    TVector3            fDir;              ///< ray unit direction (top vol coord)
+    int                 fVtxTgtPdg;        ///< target nucleus of the vertex placement table (0: none)
+    std::vector<const PathSegment *> fVtxSegments;     ///< path-segments of the table
+    std::vector<double>              fVtxCumulWeights; ///< weighted length up to the end of each of them
+  };
+
+  /// navigation state of a thread, see SetThreadSafeNavigation()
+  struct NavState {
+    TGeoNavigator *     fNavigator;        ///< navigator of the thread
+    PathSegmentList *   fPathSegmentList;  ///< current list of path-segments
+    PathSegmentList *   fTrimmedList;      ///< spare list the trimmed path-segments are written to (then swapped in)
+    PathLengthList *    fPathLengthList;   ///< current list of path-lengths
+    TVector3 *          fVertex;           ///< current generated vertex
+    RayContext          fRay;              ///< ray of the current list of path-segments
+    std::vector<double> fPathLengthSums;   ///< scratch path-length per target nucleus
+    std::vector<double> fWeightRow;        ///< scratch material weights, see MaterialWeights()
+  };
+
+  NavState &      CurrNavState (void);
+  TGeoNavigator * Navigator    (void) { return this->CurrNavState().fNavigator; }
+
   virtual void   Initialize              (void);
   virtual void   CleanUp                 (void);
   virtual void   Load                    (string geometry_filename);
@@ -129,11 +171,19 @@ protected:
   virtual double GetWeight               (const TGeoMixture * mixt, int pdgc);
   virtual double GetWeight               (const TGeoMixture * mixt, int ielement, int pdgc);
 
+  int            NuclideIndex            (int pdgc) const;
+  const double * MaterialWeights         (const TGeoMaterial * mat);
+  void           ClearWeightMatrix       (void);
+
   virtual void   MaxPathLengthsFluxMethod(void);
   virtual void   MaxPathLengthsBoxMethod (void);
   virtual bool   GenBoxRay               (int indx, TLorentzVector& x4, TLorentzVector& p4);
+  virtual void   SwimRays                (int nrays, const std::vector<TLorentzVector> & x4,
+                                          const std::vector<TLorentzVector> & p4, std::vector<double> & pl);
+  virtual bool   UpdateMaxPathLengths    (const double * pl);
 
   virtual double ComputePathLengthPDG    (const TVector3 & r, const TVector3 & udir, int pdgc);
+  virtual void   FillVertexTable         (RayContext & ray, int pdgc);
   virtual void   SwimOnce                (const TVector3 & r, const TVector3 & udir);
 
   virtual bool   FindMaterialInCurrentVol(int pdgc);
@@ -156,8 +206,6 @@ protected:
   double           fDensityScale;          ///< conversion factor: input geometry density units -> kgr/meters^3
   double           fMaxPlSafetyFactor;     ///< factor that can multiply the computed max path lengths
   double           fMixtWghtSum;           ///< norm of relative weights (<0 if explicit summing required)
-  TVector3 *       fCurrVertex;            ///< current generated vertex
-  PathLengthList * fCurrPathLengthList;    ///< current list of path-lengths
   PathLengthList * fCurrMaxPathLengthList; ///< current list of max path-lengths
   PDGCodeList *    fCurrPDGCodeList;       ///< current list of target nuclei
   TGeoVolume *     fTopVolume;             ///< top volume
@@ -165,9 +213,26 @@ protected:
   bool             fMasterToTopIsIdentity; ///< is fMasterToTop matrix the identity matrix?
 
   bool             fKeepSegPath;           ///< need to fill path segment "path"
-  PathSegmentList* fCurrPathSegmentList;   ///< current list of path-segments
   GeomVolSelectorI* fGeomVolSelector;      ///< optional path seg trimmer (owned)
 
+  // material x nuclide weight matrix, see MaterialWeights()
+  std::vector<double>                 fWeightMatrix;     ///< GetWeight() per (material row, target nucleus)
+  std::map<const TGeoMaterial *, int> fWeightMatrixRows; ///< material -> matrix row
+
+  // voxel grid over the top volume bounding box, see BuildVoxelGrid()
+  int                                 fVoxelN[3];        ///< number of voxels along x, y, z
+  double                              fVoxelLo[3];       ///< low corner of the grid (top vol coord & units)
+  double                              fVoxelSize[3];     ///< voxel size along x, y, z (top vol units)
+  std::vector<double>                 fVoxelWeights;     ///< max material weight per (voxel, target nucleus)
+
+  // navigation state: a single one unless thread-safe navigation is on
+  NavState                               fNavState;        //!< state of the loading thread
+  bool                                   fThreadSafeNav;   //!< thread-safe navigation?
+  unsigned long                          fSerial;          //!< identifies the analyzer in thread caches
+  std::map<std::thread::id, NavState *>  fThreadNavStates; //!< state of each thread
+  std::mutex                             fNavMutex;        //!< guards fThreadNavStates
+  std::mutex                             fSelectorMutex;   //!< serializes the volume selector
+
   // used by GenBoxRay to retain history between calls
   TVector3         fGenBoxRayPos;
   TVector3         fGenBoxRayDir;
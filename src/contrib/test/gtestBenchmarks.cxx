@@ -0,0 +1,711 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestBenchmarks
+
+\brief   Benchmark / performance-regression runner: times a set of standard
+         GENIE workloads and saves the results in a machine-readable (JSON)
+         file, which can be compared to the results of another build.
+
+         Workloads :
+           spline    : evaluation of all loaded cross section splines
+           intsel    : interaction selection, per initial state
+           evgen     : full event generation, per initial state, with the
+                       per-module timings of every event generation thread
+                       (kinematics generator per channel, AGKY / PYTHIA
+                       hadronization, FSI, ...) collected by EVGThreadStats
+           fsi       : hA and hN intranuclear cascades, per hadron
+           geom      : path lengths for random rays through a ROOT geometry
+           flux      : flux neutrinos thrown by a histogram-based flux driver
+           ntpwriter : GHEP event tree output (of the evgen events)
+
+         Syntax :
+           gtestBenchmarks [-w workloads] [-n nitems] [-o results_file]
+                           [-p probe] [-t targets] [-e energy]
+                           [--geometry root_file] [--seed seed]
+                           [--compare reference_results_file]
+                           [--tolerance fraction]
+                           --cross-sections xml_file --tune genie_tune
+                           [--event-generator-list list_name]
+                           [--message-thresholds xml_file]
+
+         Options :
+           [] Denotes an optional argument
+           -w Comma separated list of workloads (default: all). The spline,
+              intsel, evgen and ntpwriter workloads need --cross-sections.
+           -n Number of items (events, rays, flux neutrinos...; default: 1000)
+              per workload and initial state. Spline evaluations are done
+              1000 times that number.
+           -o Output results file (default: genie-benchmarks.json)
+           -p Probe PDG code (default: 14)
+           -t Comma separated list of target PDG codes
+              (default: 1000060120,1000180400,1000260560)
+           -e Probe energy, in GeV (default: 2). The fsi workload uses the
+              same kinetic energy for the hadrons.
+           --geometry
+              ROOT geometry file for the geom workload
+              (default: $GENIE/data/geo/samples/BoxWithLArPbLayers.root)
+           --seed
+              Random number seed (default: 1234567, for reproducible loads)
+           --compare
+              Results file of a reference build: after running, the time
+              per item of every benchmark found in both files is compared
+              and the program exits with status 1 if any is more than
+              `tolerance' slower than in the reference.
+           --tolerance
+              Allowed fractional slowdown (default: 0.10)
+           --cross-sections, --tune, --event-generator-list, ...
+              As for gevgen.
+
+         Results file format :
+           One JSON object with the build / host info and a `benchmarks'
+           array, with one entry per line:
+             { "name": ..., "items": ..., "realtime": ..., "cputime": ...,
+               "ns_per_item": ... }
+           Times are in seconds. Benchmark names are stable across builds:
+           workload/..., eg `evgen/14/1000260560', `fsi/hA2018/211', or
+           `evgen-module/<thread>/<module>/<probe>/<target>'.
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+
+*/
+//____________________________________________________________________________
+
+#include <cassert>
+#include <cstdlib>
+#include <sstream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <map>
+
+#include <TSystem.h>
+#include <TStopwatch.h>
+#include <TDatime.h>
+#include <TLorentzVector.h>
+#include <TVector3.h>
+#include <TH1D.h>
+#include <TMath.h>
+#include <RVersion.h>
+
+#include "Framework/Algorithm/AlgFactory.h"
+#include "Framework/Conventions/Units.h"
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EventRecordVisitorI.h"
+#include "Framework/EventGen/EVGThreadStats.h"
+#include "Framework/EventGen/GEVGDriver.h"
+#include "Framework/EventGen/InteractionGeneratorMap.h"
+#include "Framework/EventGen/InteractionSelectorI.h"
+#include "Framework/GHEP/GHepStatus.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Interaction/InitialState.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Ntuple/NtpMCFormat.h"
+#include "Framework/Ntuple/NtpWriter.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/Numerical/Spline.h"
+#include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/ParticleData/PDGLibrary.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/StringUtils.h"
+#include "Framework/Utils/XSecSplineList.h"
+
+#ifdef __GENIE_FLUX_DRIVERS_ENABLED__
+#include "Tools/Flux/GCylindTH1Flux.h"
+#endif
+#ifdef __GENIE_GEOM_DRIVERS_ENABLED__
+#include <TGeoManager.h>
+#include <TGeoVolume.h>
+#include <TGeoBBox.h>
+#include "Tools/Geometry/ROOTGeomAnalyzer.h"
+#endif
+
+using std::string;
+using std::vector;
+using std::map;
+using std::ostringstream;
+using std::ofstream;
+using std::ifstream;
+
+using namespace genie;
+
+// a benchmark result
+struct BenchResult {
+  string   Name;
+  Long64_t NItems;
+  double   RealTime; // sec
+  double   CpuTime;  // sec
+};
+
+void   GetCommandLineArgs (int argc, char ** argv);
+void   PrintSyntax        (void);
+bool   RunWorkload        (string workload);
+void   AddResult          (string name, Long64_t nitems, double real, double cpu);
+void   AddResult          (string name, Long64_t nitems, TStopwatch & sw);
+void   BenchSplines       (void);
+void   BenchInteractionSelection (void);
+void   BenchEventGeneration (void);
+void   BenchFSI           (void);
+void   BenchGeometry      (void);
+void   BenchFlux          (void);
+void   BenchNtpWriter     (void);
+bool   SaveResults        (string filename);
+bool   CompareResults     (string filename);
+double NsPerItem          (const BenchResult & r);
+
+// command-line options
+vector<string> gOptWorkloads;
+int            gOptNItems    = 1000;
+string         gOptResults   = "genie-benchmarks.json";
+int            gOptProbe     = kPdgNuMu;
+vector<int>    gOptTargets;
+double         gOptEnergy    = 2.;
+string         gOptGeometry;
+long int       gOptRanSeed   = 1234567;
+string         gOptReference;
+double         gOptTolerance = 0.10;
+string         gOptXSecFile;
+
+vector<BenchResult>    gResults;
+vector<EventRecord *>  gEvents;  // evgen events, for the ntpwriter workload
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc, argv);
+
+  if ( ! gOptXSecFile.empty() ) {
+    if ( ! RunOpt::Instance()->Tune() ) {
+      LOG("gbench", pFATAL) << " No TuneId in RunOption";
+      gAbortingInErr = true;
+      exit(1);
+    }
+    RunOpt::Instance()->BuildTune();
+  }
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+  utils::app_init::RandGen(gOptRanSeed);
+  if ( ! gOptXSecFile.empty() ) {
+    utils::app_init::XSecTable(gOptXSecFile, false);
+  }
+
+  for ( unsigned int i = 0; i < gOptWorkloads.size(); i++ ) {
+    if ( ! RunWorkload(gOptWorkloads[i]) ) {
+      LOG("gbench", pWARN) << "Skipped workload: " << gOptWorkloads[i];
+    }
+  }
+
+  for ( unsigned int i = 0; i < gEvents.size(); i++ ) delete gEvents[i];
+  gEvents.clear();
+
+  if ( ! SaveResults(gOptResults) ) {
+    LOG("gbench", pFATAL) << "Couldn't write results file: " << gOptResults;
+    gAbortingInErr = true;
+    exit(1);
+  }
+  LOG("gbench", pNOTICE)
+    << "Saved " << gResults.size() << " benchmark results in " << gOptResults;
+
+  if ( ! gOptReference.empty() ) {
+    bool ok = CompareResults(gOptReference);
+    return ok ? 0 : 1;
+  }
+  return 0;
+}
+//____________________________________________________________________________
+bool RunWorkload(string workload)
+{
+  bool need_xsec = workload == "spline" || workload == "intsel" ||
+                   workload == "evgen"  || workload == "ntpwriter";
+  if ( need_xsec && gOptXSecFile.empty() ) {
+    LOG("gbench", pWARN)
+      << "The " << workload << " workload needs --cross-sections";
+    return false;
+  }
+  LOG("gbench", pNOTICE) << "*** Running workload: " << workload;
+
+  if      ( workload == "spline"    ) BenchSplines();
+  else if ( workload == "intsel"    ) BenchInteractionSelection();
+  else if ( workload == "evgen"     ) BenchEventGeneration();
+  else if ( workload == "fsi"       ) BenchFSI();
+  else if ( workload == "geom"      ) BenchGeometry();
+  else if ( workload == "flux"      ) BenchFlux();
+  else if ( workload == "ntpwriter" ) BenchNtpWriter();
+  else {
+    LOG("gbench", pERROR) << "Unknown workload: " << workload;
+    return false;
+  }
+  return true;
+}
+//____________________________________________________________________________
+void AddResult(string name, Long64_t nitems, double real, double cpu)
+{
+  BenchResult r;
+  r.Name     = name;
+  r.NItems   = nitems;
+  r.RealTime = real;
+  r.CpuTime  = cpu;
+  gResults.push_back(r);
+
+  LOG("gbench", pNOTICE)
+    << name << " : " << nitems << " items in " << real << " s ("
+    << NsPerItem(r) << " ns/item)";
+}
+//____________________________________________________________________________
+void AddResult(string name, Long64_t nitems, TStopwatch & sw)
+{
+  AddResult(name, nitems, sw.RealTime(), sw.CpuTime());
+}
+//____________________________________________________________________________
+double NsPerItem(const BenchResult & r)
+{
+  return (r.NItems > 0) ? 1E+9 * r.RealTime / r.NItems : 0.;
+}
+//____________________________________________________________________________
+void BenchSplines(void)
+{
+// Evaluate every loaded spline at random energies within its range
+
+  XSecSplineList * xspl = XSecSplineList::Instance();
+  const vector<string> * keys = xspl->GetSplineKeys();
+  if ( ! keys || keys->empty() ) {
+    LOG("gbench", pWARN) << "No cross section splines loaded";
+    return;
+  }
+  vector<const Spline *> splines;
+  for ( unsigned int i = 0; i < keys->size(); i++ ) {
+    const Spline * spl = xspl->GetSpline((*keys)[i]);
+    if ( spl ) splines.push_back(spl);
+  }
+
+  // the energies are thrown in advance, so that only the evaluation is timed
+  TRandom3 & rnd = RandomGen::Instance()->RndGen();
+  int ne = 1000;
+  vector<double> u(ne);
+  for ( int i = 0; i < ne; i++ ) u[i] = rnd.Rndm();
+
+  Long64_t neval = 1000 * (Long64_t) gOptNItems;
+  Long64_t nper  = TMath::Max(1LL, (long long) (neval / splines.size()));
+  double sum = 0;
+  TStopwatch sw;
+  sw.Start();
+  for ( unsigned int is = 0; is < splines.size(); is++ ) {
+    const Spline * spl = splines[is];
+    double emin = spl->XMin();
+    double de   = spl->XMax() - emin;
+    for ( Long64_t i = 0; i < nper; i++ ) {
+      sum += spl->Evaluate(emin + de * u[i % ne]);
+    }
+  }
+  sw.Stop();
+  AddResult("spline/evaluate", nper * splines.size(), sw);
+
+  LOG("gbench", pDEBUG) << "Checksum: " << sum;
+}
+//____________________________________________________________________________
+void BenchInteractionSelection(void)
+{
+// Select interactions (with the physics interaction selector and splines,
+// as the GEVGDriver does) for each initial state
+
+  AlgFactory * algf = AlgFactory::Instance();
+  const InteractionSelectorI * selector =
+    dynamic_cast<const InteractionSelectorI *> (
+      algf->GetAlgorithm("genie::PhysInteractionSelector","Default"));
+  assert(selector);
+
+  TLorentzVector p4(0., 0., gOptEnergy, gOptEnergy);
+
+  for ( unsigned int it = 0; it < gOptTargets.size(); it++ ) {
+    InitialState init_state(gOptTargets[it], gOptProbe);
+
+    GEVGDriver driver;
+    driver.SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+    driver.UseSplines();
+    driver.Configure(init_state);
+
+    InteractionGeneratorMap igmap;
+    igmap.UseGeneratorList(driver.EventGenerators());
+    igmap.BuildMap(init_state);
+
+    EventRecord reuse;
+    TStopwatch sw;
+    sw.Start();
+    for ( int i = 0; i < gOptNItems; i++ ) {
+      selector->SelectInteraction(&igmap, p4, &reuse);
+    }
+    sw.Stop();
+
+    ostringstream name;
+    name << "intsel/" << gOptProbe << "/" << gOptTargets[it];
+    AddResult(name.str(), gOptNItems, sw);
+  }
+}
+//____________________________________________________________________________
+void BenchEventGeneration(void)
+{
+// Generate events for each initial state; the per-module timings of the
+// event generation threads are added as separate benchmarks
+
+  EVGThreadStats * stats = EVGThreadStats::Instance();
+  stats->Reset();
+  stats->Enable(true);
+
+  TLorentzVector p4(0., 0., gOptEnergy, gOptEnergy);
+
+  for ( unsigned int it = 0; it < gOptTargets.size(); it++ ) {
+    InitialState init_state(gOptTargets[it], gOptProbe);
+
+    GEVGDriver driver;
+    driver.SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+    driver.SetUnphysEventMask(*RunOpt::Instance()->UnphysEventMask());
+    driver.UseSplines();
+    driver.Configure(init_state);
+
+    // the first event is generated untimed (lazy initializations)
+    EventRecord * event = driver.GenerateEvent(p4);
+    if ( event ) delete event;
+
+    int nev = 0;
+    TStopwatch sw;
+    sw.Start();
+    for ( int i = 0; i < gOptNItems; i++ ) {
+      event = driver.GenerateEvent(p4);
+      if ( ! event ) continue;
+      nev++;
+      gEvents.push_back(event);
+    }
+    sw.Stop();
+
+    ostringstream name;
+    name << "evgen/" << gOptProbe << "/" << gOptTargets[it];
+    AddResult(name.str(), nev, sw);
+  }
+
+  vector<EVGThreadStats::Entry> entries = stats->Entries();
+  for ( unsigned int i = 0; i < entries.size(); i++ ) {
+    const EVGThreadStats::Entry & e = entries[i];
+    ostringstream name;
+    name << "evgen-module/" << e.Thread << "/"
+         << (e.Step < 0 ? string("total") : e.Module) << "/"
+         << e.ProbePdg << "/" << e.TgtPdg;
+    AddResult(name.str(), e.NCalls, e.RealTime, e.CpuTime);
+  }
+  stats->Enable(false);
+}
+//____________________________________________________________________________
+void BenchFSI(void)
+{
+// Transport single hadrons in the (first) target nucleus with the hA and hN
+// intranuclear cascade models, as gevgen_hadron does
+
+  const int nh = 6;
+  int hadrons[nh] = { kPdgPiP, kPdgPiM, kPdgPi0, kPdgProton, kPdgNeutron, kPdgKP };
+  const int nm = 2;
+  string modes [nm] = { "hA2018", "hN2018" };
+  string models[nm] = { "genie::HAIntranuke2018", "genie::HNIntranuke2018" };
+
+  int tgt = gOptTargets.empty() ? kPdgTgtFe56 : gOptTargets[0];
+
+  AlgFactory * algf  = AlgFactory::Instance();
+  PDGLibrary * pdglib = PDGLibrary::Instance();
+  TLorentzVector x4null(0.,0.,0.,0.);
+  double M = pdglib->Find(tgt)->Mass();
+  TLorentzVector p4tgt(0.,0.,0.,M);
+
+  for ( int im = 0; im < nm; im++ ) {
+    const EventRecordVisitorI * intranuke =
+      dynamic_cast<const EventRecordVisitorI *> (
+        algf->GetAlgorithm(models[im], "Default"));
+    if ( ! intranuke ) {
+      LOG("gbench", pWARN) << "No " << models[im] << " model";
+      continue;
+    }
+    for ( int ih = 0; ih < nh; ih++ ) {
+      double mh  = pdglib->Find(hadrons[ih])->Mass();
+      double Eh  = mh + gOptEnergy;
+      double pzh = TMath::Sqrt(TMath::Max(0., Eh*Eh - mh*mh));
+      TLorentzVector p4h(0.,0.,pzh,Eh);
+
+      TStopwatch sw;
+      sw.Start();
+      for ( int i = 0; i < gOptNItems; i++ ) {
+        EventRecord * evrec = new EventRecord();
+        evrec->AttachSummary(new Interaction);
+        evrec->AddParticle(hadrons[ih], kIStInitialState, -1,-1,-1,-1, p4h,   x4null);
+        evrec->AddParticle(tgt,         kIStInitialState, -1,-1,-1,-1, p4tgt, x4null);
+        intranuke->ProcessEventRecord(evrec);
+        delete evrec;
+      }
+      sw.Stop();
+
+      ostringstream name;
+      name << "fsi/" << modes[im] << "/" << hadrons[ih] << "/" << tgt;
+      AddResult(name.str(), gOptNItems, sw);
+    }
+  }
+}
+//____________________________________________________________________________
+void BenchGeometry(void)
+{
+// Path lengths for random rays, parallel to z, through the bounding box of
+// the geometry top volume
+
+#ifdef __GENIE_GEOM_DRIVERS_ENABLED__
+  if ( gSystem->AccessPathName(gOptGeometry.c_str()) ) {
+    LOG("gbench", pWARN) << "Can't access geometry file: " << gOptGeometry;
+    return;
+  }
+  geometry::ROOTGeomAnalyzer rgeom(gOptGeometry);
+  rgeom.SetLengthUnits(units::centimeter);
+
+  TGeoBBox * box = dynamic_cast<TGeoBBox *> (
+                 rgeom.GetGeometry()->GetTopVolume()->GetShape());
+  if ( ! box ) {
+    LOG("gbench", pWARN) << "No bounding box for the geometry top volume";
+    return;
+  }
+  // rays in SI units (the geometry is in cm)
+  const double * o = box->GetOrigin();
+  double scale = units::centimeter / units::meter;
+  double dx = box->GetDX() * scale, dy = box->GetDY() * scale;
+  double x0 = o[0] * scale, y0 = o[1] * scale;
+  double z0 = (o[2] - box->GetDZ()) * scale;
+
+  TRandom3 & rnd = RandomGen::Instance()->RndGen();
+  vector<TLorentzVector> x4(gOptNItems);
+  for ( int i = 0; i < gOptNItems; i++ ) {
+    x4[i].SetXYZT(x0 + dx * (2*rnd.Rndm()-1), y0 + dy * (2*rnd.Rndm()-1), z0, 0.);
+  }
+  TLorentzVector p4(0.,0.,1.,1.);
+
+  TStopwatch sw;
+  sw.Start();
+  for ( int i = 0; i < gOptNItems; i++ ) {
+    rgeom.ComputePathLengths(x4[i], p4);
+  }
+  sw.Stop();
+
+  string geom = gSystem->BaseName(gOptGeometry.c_str());
+  AddResult("geom/" + geom, gOptNItems, sw);
+#else
+  LOG("gbench", pWARN) << "The geometry drivers are not enabled";
+#endif
+}
+//____________________________________________________________________________
+void BenchFlux(void)
+{
+// Flux neutrinos thrown by a cylindrical flux driver with a histogram spectrum
+
+#ifdef __GENIE_FLUX_DRIVERS_ENABLED__
+  TH1D * spectrum = new TH1D("gbench_flux", "", 300, 0., 2.*gOptEnergy);
+  spectrum->SetDirectory(0);
+  for ( int i = 1; i <= spectrum->GetNbinsX(); i++ ) {
+    double E = spectrum->GetBinCenter(i);
+    spectrum->SetBinContent(i, E * TMath::Exp(-E/(0.5*gOptEnergy)));
+  }
+  flux::GCylindTH1Flux flux;
+  flux.SetNuDirection(TVector3(0.,0.,1.));
+  flux.SetBeamSpot(TVector3(0.,0.,-5.));
+  flux.SetTransverseRadius(1.);
+  flux.AddEnergySpectrum(gOptProbe, spectrum);  // adopted
+
+  Long64_t n = 10 * (Long64_t) gOptNItems;
+  TStopwatch sw;
+  sw.Start();
+  for ( Long64_t i = 0; i < n; i++ ) flux.GenerateNext();
+  sw.Stop();
+  AddResult("flux/GCylindTH1Flux", n, sw);
+#else
+  LOG("gbench", pWARN) << "The flux drivers are not enabled";
+#endif
+}
+//____________________________________________________________________________
+void BenchNtpWriter(void)
+{
+// Write the events of the evgen workload in a GHEP event tree
+
+  if ( gEvents.empty() ) {
+    LOG("gbench", pWARN)
+      << "No events to write: the ntpwriter workload needs the evgen one";
+    return;
+  }
+  string filename = "genie-benchmarks.ghep.root";
+
+  TStopwatch sw;
+  sw.Start();
+  NtpWriter ntpw(kNFGHEP, 0);
+  ntpw.CustomizeFilename(filename);
+  ntpw.Initialize();
+  for ( unsigned int i = 0; i < gEvents.size(); i++ ) {
+    ntpw.AddEventRecord(i, gEvents[i]);
+  }
+  ntpw.Save();
+  sw.Stop();
+  AddResult("ntpwriter/ghep", gEvents.size(), sw);
+
+  gSystem->Unlink(filename.c_str());
+}
+//____________________________________________________________________________
+bool SaveResults(string filename)
+{
+  ofstream out(filename.c_str());
+  if ( ! out.is_open() ) return false;
+
+  TDatime now;
+  const char * genie = gSystem->Getenv("GENIE");
+  out << "{\n  \"host\": \""   << gSystem->HostName() << "\""
+      << ",\n  \"date\": \""   << now.AsSQLString()   << "\""
+      << ",\n  \"genie\": \""  << (genie ? genie : "") << "\""
+      << ",\n  \"root\": \""   << ROOT_RELEASE        << "\""
+      << ",\n  \"tune\": \""
+      << (RunOpt::Instance()->Tune() ? RunOpt::Instance()->Tune()->Name() : "")
+      << "\""
+      << ",\n  \"nitems\": "   << gOptNItems
+      << ",\n  \"benchmarks\": [";
+  for ( unsigned int i = 0; i < gResults.size(); i++ ) {
+    const BenchResult & r = gResults[i];
+    if ( i > 0 ) out << ",";
+    out << "\n    { \"name\": \""  << r.Name     << "\""
+        << ", \"items\": "         << r.NItems
+        << ", \"realtime\": "      << r.RealTime
+        << ", \"cputime\": "       << r.CpuTime
+        << ", \"ns_per_item\": "   << NsPerItem(r)
+        << " }";
+  }
+  out << "\n  ]\n}\n";
+  out.close();
+  return true;
+}
+//____________________________________________________________________________
+bool CompareResults(string filename)
+{
+// Compare the time per item with the one in a reference results file (as
+// written by SaveResults(): one benchmark per line)
+
+  ifstream in(filename.c_str());
+  if ( ! in.is_open() ) {
+    LOG("gbench", pERROR) << "Couldn't read reference results: " << filename;
+    return false;
+  }
+  map<string, double> ref;
+  string line;
+  while ( std::getline(in, line) ) {
+    size_t iname = line.find("\"name\": \"");
+    size_t itime = line.find("\"ns_per_item\": ");
+    if ( iname == string::npos || itime == string::npos ) continue;
+    iname += 9;
+    string name = line.substr(iname, line.find('"', iname) - iname);
+    ref[name] = atof(line.c_str() + itime + 15);
+  }
+
+  int nslower = 0, ncompared = 0;
+  ostringstream report;
+  for ( unsigned int i = 0; i < gResults.size(); i++ ) {
+    const BenchResult & r = gResults[i];
+    map<string, double>::const_iterator it = ref.find(r.Name);
+    if ( it == ref.end() || it->second <= 0 || r.NItems <= 0 ) continue;
+    ncompared++;
+    double ratio = NsPerItem(r) / it->second;
+    bool slower = ratio > 1. + gOptTolerance;
+    if ( slower ) nslower++;
+    report << "\n " << (slower ? "** " : "   ") << r.Name << " : "
+           << NsPerItem(r) << " ns/item, x" << ratio << " of reference";
+  }
+  LOG("gbench", pNOTICE)
+    << "Compared " << ncompared << " benchmarks with " << filename
+    << " (tolerance: " << 100*gOptTolerance << "%):" << report.str();
+  if ( nslower > 0 ) {
+    LOG("gbench", pERROR)
+      << nslower << " benchmarks are slower than in the reference";
+  }
+  return nslower == 0;
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  // Common run options (tune, event generator list, message thresholds...)
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  CmdLnArgParser parser(argc,argv);
+
+  if ( parser.OptionExists('h') ) {
+    PrintSyntax();
+    exit(0);
+  }
+
+  string workloads = "spline,intsel,evgen,fsi,geom,flux,ntpwriter";
+  if ( parser.OptionExists('w') ) workloads = parser.ArgAsString('w');
+  gOptWorkloads = utils::str::Split(workloads, ",");
+
+  if ( parser.OptionExists('n') ) gOptNItems  = parser.ArgAsInt('n');
+  if ( parser.OptionExists('o') ) gOptResults = parser.ArgAsString('o');
+  if ( parser.OptionExists('p') ) gOptProbe   = parser.ArgAsInt('p');
+  if ( parser.OptionExists('e') ) gOptEnergy  = parser.ArgAsDouble('e');
+
+  string targets = "1000060120,1000180400,1000260560";
+  if ( parser.OptionExists('t') ) targets = parser.ArgAsString('t');
+  vector<string> vtgt = utils::str::Split(targets, ",");
+  for ( unsigned int i = 0; i < vtgt.size(); i++ ) {
+    gOptTargets.push_back(atoi(vtgt[i].c_str()));
+  }
+
+  if ( parser.OptionExists("geometry") ) {
+    gOptGeometry = parser.ArgAsString("geometry");
+  } else {
+    const char * genie = gSystem->Getenv("GENIE");
+    gOptGeometry = string(genie ? genie : ".") +
+                   "/data/geo/samples/BoxWithLArPbLayers.root";
+  }
+  if ( parser.OptionExists("seed") ) {
+    gOptRanSeed = parser.ArgAsLong("seed");
+  }
+  if ( parser.OptionExists("compare") ) {
+    gOptReference = parser.ArgAsString("compare");
+  }
+  if ( parser.OptionExists("tolerance") ) {
+    gOptTolerance = parser.ArgAsDouble("tolerance");
+  }
+  if ( parser.OptionExists("cross-sections") ) {
+    gOptXSecFile = parser.ArgAsString("cross-sections");
+  }
+
+  if ( gOptNItems <= 0 ) {
+    LOG("gbench", pFATAL) << "Invalid number of items: " << gOptNItems;
+    PrintSyntax();
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  LOG("gbench", pNOTICE)
+    << "\n\n gtestBenchmarks job info: "
+    << "\n - workloads      : " << workloads
+    << "\n - items          : " << gOptNItems
+    << "\n - probe / targets: " << gOptProbe << " / " << targets
+    << "\n - energy         : " << gOptEnergy << " GeV"
+    << "\n - geometry       : " << gOptGeometry
+    << "\n - results        : " << gOptResults
+    << "\n - reference      : " << (gOptReference.empty() ? "none" : gOptReference)
+    << "\n";
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("gbench", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "   gtestBenchmarks [-w workloads] [-n nitems] [-o results_file]\n"
+    << "                   [-p probe] [-t targets] [-e energy]\n"
+    << "                   [--geometry root_file] [--seed seed]\n"
+    << "                   [--compare reference_results_file] [--tolerance fraction]\n"
+    << "                   --cross-sections xml_file --tune genie_tune\n"
+    << "                   [--event-generator-list list_name]\n"
+    << "                   [--message-thresholds xml_file]\n";
+}
+//____________________________________________________________________________